@@ -0,0 +1,325 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        SIMD_INLINE __m256i BroadcastAlpha16(__m256i bgra16)
+        {
+            return _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(bgra16, 0xFF), 0xFF);
+        }
+
+        SIMD_INLINE __m256i AlphaPremultiply16(__m256i bgra16)
+        {
+            return DivideI16By255(_mm256_mullo_epi16(bgra16, _mm256_blend_epi16(BroadcastAlpha16(bgra16), K16_00FF, 0x88)));
+        }
+
+        SIMD_INLINE void AlphaPremultiply(const uint8_t * src, uint8_t * dst)
+        {
+            __m256i bgra = _mm256_loadu_si256((__m256i*)src);
+            __m256i lo = AlphaPremultiply16(_mm256_unpacklo_epi8(bgra, K_ZERO));
+            __m256i hi = AlphaPremultiply16(_mm256_unpackhi_epi8(bgra, K_ZERO));
+            _mm256_storeu_si256((__m256i*)dst, _mm256_packus_epi16(lo, hi));
+        }
+
+        void AlphaPremultiply(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+        {
+            assert(width >= F);
+
+            size_t widthF = AlignLo(width, F);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthF; col += F)
+                    AlphaPremultiply(src + col * 4, dst + col * 4);
+                src += srcStride;
+                dst += dstStride;
+            }
+            if (widthF < width)
+                Base::AlphaPremultiply(src - height * srcStride + widthF * 4, srcStride, width - widthF, height, dst - height * dstStride + widthF * 4, dstStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE __m256i AlphaUnpremultiply32(__m256i bgra32)
+        {
+            __m256i alpha = _mm256_shuffle_epi32(bgra32, 0xFF);
+            __m256 dividend = _mm256_cvtepi32_ps(_mm256_add_epi32(_mm256_mullo_epi16(bgra32, K32_000000FF), _mm256_srli_epi32(alpha, 1)));
+            __m256i value = _mm256_cvttps_epi32(_mm256_div_ps(dividend, _mm256_cvtepi32_ps(_mm256_max_epi32(alpha, K32_00000001))));
+            return _mm256_blend_epi16(_mm256_andnot_si256(_mm256_cmpeq_epi32(alpha, K_ZERO), value), alpha, 0xC0);
+        }
+
+        SIMD_INLINE __m256i AlphaUnpremultiply16(__m256i bgra16)
+        {
+            __m256i lo = AlphaUnpremultiply32(_mm256_unpacklo_epi16(bgra16, K_ZERO));
+            __m256i hi = AlphaUnpremultiply32(_mm256_unpackhi_epi16(bgra16, K_ZERO));
+            return _mm256_packs_epi32(lo, hi);
+        }
+
+        SIMD_INLINE void AlphaUnpremultiply(const uint8_t * src, uint8_t * dst)
+        {
+            __m256i bgra = _mm256_loadu_si256((__m256i*)src);
+            __m256i lo = AlphaUnpremultiply16(_mm256_unpacklo_epi8(bgra, K_ZERO));
+            __m256i hi = AlphaUnpremultiply16(_mm256_unpackhi_epi8(bgra, K_ZERO));
+            _mm256_storeu_si256((__m256i*)dst, _mm256_packus_epi16(lo, hi));
+        }
+
+        void AlphaUnpremultiply(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+        {
+            assert(width >= F);
+
+            size_t widthF = AlignLo(width, F);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthF; col += F)
+                    AlphaUnpremultiply(src + col * 4, dst + col * 4);
+                src += srcStride;
+                dst += dstStride;
+            }
+            if (widthF < width)
+                Base::AlphaUnpremultiply(src - height * srcStride + widthF * 4, srcStride, width - widthF, height, dst - height * dstStride + widthF * 4, dstStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE __m256i AlphaBlendingBgraToBgra32(__m256i srcDst, __m256i weight, __m256i half, __m256i divisor)
+        {
+            __m256 dividend = _mm256_cvtepi32_ps(_mm256_add_epi32(_mm256_madd_epi16(srcDst, weight), half));
+            return _mm256_cvttps_epi32(_mm256_div_ps(dividend, _mm256_cvtepi32_ps(divisor)));
+        }
+
+        SIMD_INLINE __m256i AlphaBlendingBgraToBgra16(__m256i src, __m256i dst, __m256i alpha)
+        {
+            __m256i srcAlpha = DivideI16By255(_mm256_mullo_epi16(BroadcastAlpha16(src), alpha));
+            __m256i dstAlpha = DivideI16By255(_mm256_mullo_epi16(BroadcastAlpha16(dst), _mm256_sub_epi16(K16_00FF, srcAlpha)));
+            __m256i sumAlpha = _mm256_add_epi16(srcAlpha, dstAlpha);
+            __m256i half = _mm256_srli_epi16(sumAlpha, 1);
+            __m256i divisor = _mm256_max_epi16(sumAlpha, K16_0001);
+            __m256i lo = AlphaBlendingBgraToBgra32(_mm256_unpacklo_epi16(src, dst), _mm256_unpacklo_epi16(srcAlpha, dstAlpha),
+                _mm256_unpacklo_epi16(half, K_ZERO), _mm256_unpacklo_epi16(divisor, K_ZERO));
+            __m256i hi = AlphaBlendingBgraToBgra32(_mm256_unpackhi_epi16(src, dst), _mm256_unpackhi_epi16(srcAlpha, dstAlpha),
+                _mm256_unpackhi_epi16(half, K_ZERO), _mm256_unpackhi_epi16(divisor, K_ZERO));
+            return _mm256_blend_epi16(_mm256_packs_epi32(lo, hi), sumAlpha, 0x88);
+        }
+
+        SIMD_INLINE __m256i AlphaBlendingPremultipliedBgraToBgra16(__m256i src, __m256i dst, __m256i alpha)
+        {
+            src = DivideI16By255(_mm256_mullo_epi16(src, alpha));
+            return _mm256_add_epi16(src, DivideI16By255(_mm256_mullo_epi16(dst, _mm256_sub_epi16(K16_00FF, BroadcastAlpha16(src)))));
+        }
+
+        template<bool premultiplied> SIMD_INLINE __m256i AlphaBlendingBgraToBgra16(__m256i src, __m256i dst, __m256i alpha)
+        {
+            return premultiplied ? AlphaBlendingPremultipliedBgraToBgra16(src, dst, alpha) : AlphaBlendingBgraToBgra16(src, dst, alpha);
+        }
+
+        template<bool premultiplied> SIMD_INLINE void AlphaBlendingBgraToBgra(const uint8_t * src, __m256i alpha, uint8_t * dst)
+        {
+            __m256i _src = _mm256_loadu_si256((__m256i*)src);
+            __m256i _dst = _mm256_loadu_si256((__m256i*)dst);
+            __m256i lo = AlphaBlendingBgraToBgra16<premultiplied>(_mm256_unpacklo_epi8(_src, K_ZERO), _mm256_unpacklo_epi8(_dst, K_ZERO), alpha);
+            __m256i hi = AlphaBlendingBgraToBgra16<premultiplied>(_mm256_unpackhi_epi8(_src, K_ZERO), _mm256_unpackhi_epi8(_dst, K_ZERO), alpha);
+            _mm256_storeu_si256((__m256i*)dst, _mm256_packus_epi16(lo, hi));
+        }
+
+        template<bool premultiplied> void AlphaBlendingBgraToBgra(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t alpha, uint8_t * dst, size_t dstStride)
+        {
+            size_t widthF = AlignLo(width, F);
+            __m256i _alpha = _mm256_set1_epi16(alpha);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthF; col += F)
+                    AlphaBlendingBgraToBgra<premultiplied>(src + col * 4, _alpha, dst + col * 4);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        void AlphaBlendingBgraToBgra(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t alpha, SimdBool premultiplied, uint8_t * dst, size_t dstStride)
+        {
+            assert(width >= F);
+
+            if (premultiplied)
+                AlphaBlendingBgraToBgra<true>(src, srcStride, width, height, alpha, dst, dstStride);
+            else
+                AlphaBlendingBgraToBgra<false>(src, srcStride, width, height, alpha, dst, dstStride);
+            size_t widthF = AlignLo(width, F);
+            if (widthF < width)
+                Base::AlphaBlendingBgraToBgra(src + widthF * 4, srcStride, width - widthF, height, alpha, premultiplied, dst + widthF * 4, dstStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        const __m256i K32_PERMUTE_Y = SIMD_MM256_SETR_EPI32(0, 4, 1, 5, 2, 6, 3, 7);
+
+        SIMD_INLINE __m256i RestrictRange32(__m256i value)
+        {
+            return _mm256_min_epi32(_mm256_max_epi32(value, K_ZERO), K32_000000FF);
+        }
+
+        SIMD_INLINE __m256i Average32(__m256i sum)
+        {
+            return _mm256_srli_epi32(_mm256_add_epi32(sum, K32_00000002), 2);
+        }
+
+        template <class T> SIMD_INLINE __m256i AlphaBlendingBgraToYuv32(__m256i bgra, __m256i alpha, __m256i y, __m256i & a, __m256i & u, __m256i & v)
+        {
+            __m256i b16_r16 = _mm256_and_si256(bgra, K16_00FF);
+            __m256i g16_1 = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(bgra, 8), K32_000000FF), K32_00010000);
+            a = DivideI16By255(_mm256_mullo_epi16(_mm256_srli_epi32(bgra, 24), alpha));
+            u = DivideI16By255(_mm256_mullo_epi16(RestrictRange32(_mm256_add_epi32(BgrToU32<T>(b16_r16, g16_1), _mm256_set1_epi32(Base::UV_ADJUST))), a));
+            v = DivideI16By255(_mm256_mullo_epi16(RestrictRange32(_mm256_add_epi32(BgrToV32<T>(b16_r16, g16_1), _mm256_set1_epi32(Base::UV_ADJUST))), a));
+            __m256i _y = RestrictRange32(_mm256_add_epi32(BgrToY32<T>(b16_r16, g16_1), _mm256_set1_epi32(T::Y_ADJUST)));
+            return DivideI16By255(_mm256_add_epi16(_mm256_mullo_epi16(_y, a), _mm256_mullo_epi16(y, _mm256_sub_epi16(K32_000000FF, a))));
+        }
+
+        template <class T> SIMD_INLINE void AlphaBlendingBgraToYuv(const uint8_t * bgra, __m256i alpha, uint8_t * y, __m256i a[2], __m256i u[2], __m256i v[2])
+        {
+            __m256i _a[4], _u[4], _v[4], y32[4];
+            for (size_t i = 0; i < 4; ++i)
+                y32[i] = AlphaBlendingBgraToYuv32<T>(_mm256_loadu_si256((__m256i*)bgra + i), alpha,
+                    _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(y + 8 * i))), _a[i], _u[i], _v[i]);
+            __m256i _y = _mm256_packus_epi16(_mm256_packs_epi32(y32[0], y32[1]), _mm256_packs_epi32(y32[2], y32[3]));
+            _mm256_storeu_si256((__m256i*)y, _mm256_permutevar8x32_epi32(_y, K32_PERMUTE_Y));
+            for (size_t i = 0; i < 2; ++i)
+            {
+                a[i] = _mm256_add_epi32(a[i], _mm256_hadd_epi32(_a[2 * i], _a[2 * i + 1]));
+                u[i] = _mm256_add_epi32(u[i], _mm256_hadd_epi32(_u[2 * i], _u[2 * i + 1]));
+                v[i] = _mm256_add_epi32(v[i], _mm256_hadd_epi32(_v[2 * i], _v[2 * i + 1]));
+            }
+        }
+
+        template <bool nv12> SIMD_INLINE void LoadChroma(const uint8_t * u, const uint8_t * v, __m256i u32[2], __m256i v32[2])
+        {
+            if (nv12)
+            {
+                __m256i uv = _mm256_loadu_si256((__m256i*)u);
+                __m256i _u = _mm256_and_si256(uv, K16_00FF), _v = _mm256_srli_epi16(uv, 8);
+                u32[0] = _mm256_cvtepu16_epi32(_mm256_castsi256_si128(_u));
+                u32[1] = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(_u, 1));
+                v32[0] = _mm256_cvtepu16_epi32(_mm256_castsi256_si128(_v));
+                v32[1] = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(_v, 1));
+            }
+            else
+            {
+                u32[0] = _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)u));
+                u32[1] = _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(u + 8)));
+                v32[0] = _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)v));
+                v32[1] = _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(v + 8)));
+            }
+        }
+
+        template <bool nv12> SIMD_INLINE void StoreChroma(const __m256i u32[2], const __m256i v32[2], uint8_t * u, uint8_t * v)
+        {
+            __m256i _u = _mm256_permute4x64_epi64(_mm256_packs_epi32(u32[0], u32[1]), 0xD8);
+            __m256i _v = _mm256_permute4x64_epi64(_mm256_packs_epi32(v32[0], v32[1]), 0xD8);
+            if (nv12)
+                _mm256_storeu_si256((__m256i*)u, _mm256_or_si256(_u, _mm256_slli_epi16(_v, 8)));
+            else
+            {
+                _mm_storeu_si128((__m128i*)u, _mm256_castsi256_si128(_mm256_permute4x64_epi64(_mm256_packus_epi16(_u, K_ZERO), 0x08)));
+                _mm_storeu_si128((__m128i*)v, _mm256_castsi256_si128(_mm256_permute4x64_epi64(_mm256_packus_epi16(_v, K_ZERO), 0x08)));
+            }
+        }
+
+        template <class T, bool nv12> SIMD_INLINE void AlphaBlendingBgraToYuv420(const uint8_t * bgra, size_t bgraStride, __m256i alpha, uint8_t * y, size_t yStride, uint8_t * u, uint8_t * v)
+        {
+            __m256i a[2] = { K_ZERO, K_ZERO }, _u[2] = { K_ZERO, K_ZERO }, _v[2] = { K_ZERO, K_ZERO }, u32[2], v32[2];
+            AlphaBlendingBgraToYuv<T>(bgra, alpha, y, a, _u, _v);
+            AlphaBlendingBgraToYuv<T>(bgra + bgraStride, alpha, y + yStride, a, _u, _v);
+            LoadChroma<nv12>(u, v, u32, v32);
+            for (size_t i = 0; i < 2; ++i)
+            {
+                __m256i inverse = _mm256_sub_epi32(K32_000000FF, Average32(_mm256_permute4x64_epi64(a[i], 0xD8)));
+                u32[i] = _mm256_add_epi32(Average32(_mm256_permute4x64_epi64(_u[i], 0xD8)), DivideI16By255(_mm256_mullo_epi16(u32[i], inverse)));
+                v32[i] = _mm256_add_epi32(Average32(_mm256_permute4x64_epi64(_v[i], 0xD8)), DivideI16By255(_mm256_mullo_epi16(v32[i], inverse)));
+            }
+            StoreChroma<nv12>(u32, v32, u, v);
+        }
+
+        template <class T, bool nv12> void AlphaBlendingBgraToYuv420(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t alpha,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            size_t widthA = AlignLo(width, A);
+            __m256i _alpha = _mm256_set1_epi32(alpha);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0; colY < widthA; colY += A)
+                {
+                    size_t colUV = nv12 ? colY : colY / 2;
+                    AlphaBlendingBgraToYuv420<T, nv12>(bgra + colY * 4, bgraStride, _alpha, y + colY, yStride, u + colUV, v + colUV);
+                }
+                bgra += 2 * bgraStride;
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+            }
+        }
+
+        template <bool nv12> void AlphaBlendingBgraToYuv420(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t alpha,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: AlphaBlendingBgraToYuv420<Base::Bt601, nv12>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: AlphaBlendingBgraToYuv420<Base::Bt709, nv12>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: AlphaBlendingBgraToYuv420<Base::Bt2020, nv12>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: AlphaBlendingBgraToYuv420<Base::Bt601Full, nv12>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: AlphaBlendingBgraToYuv420<Base::Bt709Full, nv12>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: AlphaBlendingBgraToYuv420<Base::Bt2020Full, nv12>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride); break;
+            default: assert(0);
+            }
+        }
+
+        void AlphaBlendingBgraToYuv420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t alpha,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            assert(width >= A && (width % 2 == 0) && (height % 2 == 0));
+
+            AlphaBlendingBgraToYuv420<false>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride, yuvType);
+            size_t widthA = AlignLo(width, A);
+            if (widthA < width)
+                Base::AlphaBlendingBgraToYuv420p(bgra + widthA * 4, bgraStride, width - widthA, height, alpha,
+                    y + widthA, yStride, u + widthA / 2, uStride, v + widthA / 2, vStride, yuvType);
+        }
+
+        void AlphaBlendingBgraToNv12(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t alpha,
+            uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            assert(width >= A && (width % 2 == 0) && (height % 2 == 0));
+
+            AlphaBlendingBgraToYuv420<true>(bgra, bgraStride, width, height, alpha, y, yStride, uv, uvStride, uv, uvStride, yuvType);
+            size_t widthA = AlignLo(width, A);
+            if (widthA < width)
+                Base::AlphaBlendingBgraToNv12(bgra + widthA * 4, bgraStride, width - widthA, height, alpha, y + widthA, yStride, uv + widthA, uvStride, yuvType);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
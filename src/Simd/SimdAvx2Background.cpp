@@ -428,6 +428,371 @@ namespace Simd
             else
                 BackgroundInitMask<false>(src, srcStride, width, height, index, value, dst, dstStride);
         }
+
+        template <bool align, bool grow, bool increment, bool adjust> SIMD_INLINE void BackgroundUpdate(const uint8_t * value, uint8_t * loValue, uint8_t * hiValue,
+            uint8_t * loCount, uint8_t * hiCount, size_t offset, const __m256i & threshold, const __m256i & mask)
+        {
+            const __m256i _value = Load<align>((__m256i*)(value + offset));
+            __m256i _loValue = Load<align>((__m256i*)(loValue + offset));
+            __m256i _hiValue = Load<align>((__m256i*)(hiValue + offset));
+            if (grow)
+            {
+                _loValue = _mm256_subs_epu8(_loValue, _mm256_and_si256(mask, _mm256_subs_epu8(_loValue, _value)));
+                _hiValue = _mm256_adds_epu8(_hiValue, _mm256_and_si256(mask, _mm256_subs_epu8(_value, _hiValue)));
+            }
+            if (increment || adjust)
+            {
+                const __m256i one = _mm256_and_si256(mask, K8_01);
+                __m256i _loCount = Load<align>((__m256i*)(loCount + offset));
+                __m256i _hiCount = Load<align>((__m256i*)(hiCount + offset));
+                if (increment)
+                {
+                    _loCount = _mm256_adds_epu8(_loCount, _mm256_and_si256(one, Lesser8u(_value, _loValue)));
+                    _hiCount = _mm256_adds_epu8(_hiCount, _mm256_and_si256(one, Greater8u(_value, _hiValue)));
+                }
+                if (adjust)
+                {
+                    _loValue = AdjustLo(_loCount, _loValue, one, threshold);
+                    _hiValue = AdjustHi(_hiCount, _hiValue, one, threshold);
+                    _loCount = _mm256_andnot_si256(mask, _loCount);
+                    _hiCount = _mm256_andnot_si256(mask, _hiCount);
+                }
+                Store<align>((__m256i*)(loCount + offset), _loCount);
+                Store<align>((__m256i*)(hiCount + offset), _hiCount);
+            }
+            if (grow || adjust)
+            {
+                Store<align>((__m256i*)(loValue + offset), _loValue);
+                Store<align>((__m256i*)(hiValue + offset), _hiValue);
+            }
+        }
+
+        template <bool align, bool grow, bool increment, bool adjust> void BackgroundUpdate(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * loValue, size_t loValueStride, uint8_t * hiValue, size_t hiValueStride,
+            uint8_t * loCount, size_t loCountStride, uint8_t * hiCount, size_t hiCountStride, uint8_t threshold)
+        {
+            assert(width >= A);
+            if (align)
+            {
+                assert(Aligned(value) && Aligned(valueStride));
+                assert(Aligned(loValue) && Aligned(loValueStride) && Aligned(hiValue) && Aligned(hiValueStride));
+                assert(Aligned(loCount) && Aligned(loCountStride) && Aligned(hiCount) && Aligned(hiCountStride));
+            }
+
+            const __m256i _threshold = _mm256_set1_epi8((char)threshold);
+            size_t alignedWidth = AlignLo(width, A);
+            __m256i tailMask = SetMask<uint8_t>(0, A - width + alignedWidth, 0xFF);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < alignedWidth; col += A)
+                    BackgroundUpdate<align, grow, increment, adjust>(value, loValue, hiValue, loCount, hiCount, col, _threshold, K_INV_ZERO);
+                if (alignedWidth != width)
+                    BackgroundUpdate<false, grow, increment, adjust>(value, loValue, hiValue, loCount, hiCount, width - A, _threshold, tailMask);
+                value += valueStride;
+                loValue += loValueStride;
+                hiValue += hiValueStride;
+                loCount += loCountStride;
+                hiCount += hiCountStride;
+            }
+        }
+
+        typedef void(*BackgroundUpdatePtr)(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * loValue, size_t loValueStride, uint8_t * hiValue, size_t hiValueStride,
+            uint8_t * loCount, size_t loCountStride, uint8_t * hiCount, size_t hiCountStride, uint8_t threshold);
+
+        template <bool align, bool grow, bool increment> BackgroundUpdatePtr GetBackgroundUpdate(int flags)
+        {
+            if (flags & SimdBackgroundUpdateAdjustRange)
+                return BackgroundUpdate<align, grow, increment, true>;
+            else
+                return BackgroundUpdate<align, grow, increment, false>;
+        }
+
+        template <bool align, bool grow> BackgroundUpdatePtr GetBackgroundUpdate(int flags)
+        {
+            if (flags & SimdBackgroundUpdateIncrementCount)
+                return GetBackgroundUpdate<align, grow, true>(flags);
+            else
+                return GetBackgroundUpdate<align, grow, false>(flags);
+        }
+
+        template <bool align> BackgroundUpdatePtr GetBackgroundUpdate(int flags)
+        {
+            if (flags & SimdBackgroundUpdateGrowRange)
+                return GetBackgroundUpdate<align, true>(flags);
+            else
+                return GetBackgroundUpdate<align, false>(flags);
+        }
+
+        void BackgroundUpdate(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * loValue, size_t loValueStride, uint8_t * hiValue, size_t hiValueStride,
+            uint8_t * loCount, size_t loCountStride, uint8_t * hiCount, size_t hiCountStride, uint8_t threshold, int flags)
+        {
+            if ((flags & (SimdBackgroundUpdateGrowRange | SimdBackgroundUpdateIncrementCount | SimdBackgroundUpdateAdjustRange)) == 0)
+                return;
+            BackgroundUpdatePtr backgroundUpdate;
+            if (Aligned(value) && Aligned(valueStride) &&
+                Aligned(loValue) && Aligned(loValueStride) && Aligned(hiValue) && Aligned(hiValueStride) &&
+                Aligned(loCount) && Aligned(loCountStride) && Aligned(hiCount) && Aligned(hiCountStride))
+                backgroundUpdate = GetBackgroundUpdate<true>(flags);
+            else
+                backgroundUpdate = GetBackgroundUpdate<false>(flags);
+            backgroundUpdate(value, valueStride, width, height, loValue, loValueStride, hiValue, hiValueStride,
+                loCount, loCountStride, hiCount, hiCountStride, threshold);
+        }
+
+        const __m256i K32_0000FF00 = SIMD_MM256_SET1_EPI32(0x0000FF00);
+        const __m256i K32_00000100 = SIMD_MM256_SET1_EPI32(0x00000100);
+        const __m256i K32_PERMUTE_FOR_UNPACK = SIMD_MM256_SETR_EPI32(0, 2, 4, 6, 1, 3, 5, 7);
+
+        template <bool align> SIMD_INLINE void BackgroundPackedInit(const uint8_t * value, uint8_t * model)
+        {
+            const __m256i _value = _mm256_permutevar8x32_epi32(Load<align>((__m256i*)value), K32_PERMUTE_FOR_UNPACK);
+            const __m256i value0 = _mm256_unpacklo_epi8(_value, _value);
+            const __m256i value1 = _mm256_unpackhi_epi8(_value, _value);
+            Store<align>((__m256i*)model + 0, _mm256_unpacklo_epi16(value0, K_ZERO));
+            Store<align>((__m256i*)model + 1, _mm256_unpackhi_epi16(value0, K_ZERO));
+            Store<align>((__m256i*)model + 2, _mm256_unpacklo_epi16(value1, K_ZERO));
+            Store<align>((__m256i*)model + 3, _mm256_unpackhi_epi16(value1, K_ZERO));
+        }
+
+        template <bool align> void BackgroundPackedInit(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
+        {
+            assert(width >= A);
+            if (align)
+                assert(Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride));
+
+            size_t alignedWidth = AlignLo(width, A);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < alignedWidth; col += A)
+                    BackgroundPackedInit<align>(value + col, model + 4 * col);
+                if (alignedWidth != width)
+                    BackgroundPackedInit<false>(value + width - A, model + 4 * (width - A));
+                value += valueStride;
+                model += modelStride;
+            }
+        }
+
+        void BackgroundPackedInit(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
+        {
+            if (Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride))
+                BackgroundPackedInit<true>(value, valueStride, width, height, model, modelStride);
+            else
+                BackgroundPackedInit<false>(value, valueStride, width, height, model, modelStride);
+        }
+
+        template <bool grow, bool increment, bool adjust> SIMD_INLINE __m256i BackgroundPackedUpdate(__m256i model, const __m256i & value, const __m256i & threshold)
+        {
+            if (grow)
+            {
+                model = _mm256_min_epu8(model, _mm256_or_si256(value, K32_FFFFFF00));
+                model = _mm256_max_epu8(model, _mm256_and_si256(value, K32_0000FF00));
+            }
+            if (increment)
+            {
+                const __m256i range = _mm256_slli_epi32(model, 16);
+                const __m256i incLo = _mm256_and_si256(K32_00010000, Lesser8u(value, range));
+                const __m256i incHi = _mm256_and_si256(K32_01000000, Greater8u(value, range));
+                model = _mm256_adds_epu8(model, _mm256_or_si256(incLo, incHi));
+            }
+            if (adjust)
+            {
+                const __m256i count = _mm256_srli_epi32(model, 16);
+                const __m256i greater = Greater8u(count, threshold);
+                const __m256i lesser = Lesser8u(count, threshold);
+                const __m256i inc = _mm256_or_si256(_mm256_and_si256(K32_00000001, lesser), _mm256_and_si256(K32_00000100, greater));
+                const __m256i dec = _mm256_or_si256(_mm256_and_si256(K32_00000001, greater), _mm256_and_si256(K32_00000100, lesser));
+                model = _mm256_and_si256(_mm256_subs_epu8(_mm256_adds_epu8(model, inc), dec), K32_0000FFFF);
+            }
+            return model;
+        }
+
+        template <bool align, bool masked, bool grow, bool increment, bool adjust> SIMD_INLINE void BackgroundPackedUpdate(uint8_t * model,
+            const __m256i & value, const __m256i & threshold, const __m256i & mask)
+        {
+            const __m256i _model = Load<align>((__m256i*)model);
+            const __m256i updated = BackgroundPackedUpdate<grow, increment, adjust>(_model, value, threshold);
+            Store<align>((__m256i*)model, masked ? _mm256_blendv_epi8(_model, updated, mask) : updated);
+        }
+
+        template <bool align, bool masked, bool grow, bool increment, bool adjust> SIMD_INLINE void BackgroundPackedUpdate(const uint8_t * value,
+            uint8_t * model, const __m256i & threshold, const __m256i & mask)
+        {
+            const __m256i _value = _mm256_permutevar8x32_epi32(Load<align>((__m256i*)value), K32_PERMUTE_FOR_UNPACK);
+            const __m256i value0 = _mm256_unpacklo_epi8(_value, _value);
+            const __m256i value1 = _mm256_unpackhi_epi8(_value, _value);
+            const __m256i _mask = _mm256_permutevar8x32_epi32(mask, K32_PERMUTE_FOR_UNPACK);
+            const __m256i mask0 = _mm256_unpacklo_epi8(_mask, _mask);
+            const __m256i mask1 = _mm256_unpackhi_epi8(_mask, _mask);
+            BackgroundPackedUpdate<align, masked, grow, increment, adjust>(model + 0 * A, _mm256_unpacklo_epi16(value0, value0), threshold, _mm256_unpacklo_epi16(mask0, mask0));
+            BackgroundPackedUpdate<align, masked, grow, increment, adjust>(model + 1 * A, _mm256_unpackhi_epi16(value0, value0), threshold, _mm256_unpackhi_epi16(mask0, mask0));
+            BackgroundPackedUpdate<align, masked, grow, increment, adjust>(model + 2 * A, _mm256_unpacklo_epi16(value1, value1), threshold, _mm256_unpacklo_epi16(mask1, mask1));
+            BackgroundPackedUpdate<align, masked, grow, increment, adjust>(model + 3 * A, _mm256_unpackhi_epi16(value1, value1), threshold, _mm256_unpackhi_epi16(mask1, mask1));
+        }
+
+        template <bool align, bool grow, bool increment, bool adjust> void BackgroundPackedUpdate(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * model, size_t modelStride, uint8_t threshold)
+        {
+            assert(width >= A);
+            if (align)
+                assert(Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride));
+
+            const __m256i _threshold = _mm256_set1_epi8((char)threshold);
+            size_t alignedWidth = AlignLo(width, A);
+            __m256i tailMask = SetMask<uint8_t>(0, A - width + alignedWidth, 0xFF);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < alignedWidth; col += A)
+                    BackgroundPackedUpdate<align, false, grow, increment, adjust>(value + col, model + 4 * col, _threshold, K_INV_ZERO);
+                if (alignedWidth != width)
+                    BackgroundPackedUpdate<false, true, grow, increment, adjust>(value + width - A, model + 4 * (width - A), _threshold, tailMask);
+                value += valueStride;
+                model += modelStride;
+            }
+        }
+
+        typedef void(*BackgroundPackedUpdatePtr)(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * model, size_t modelStride, uint8_t threshold);
+
+        template <bool align, bool grow, bool increment> BackgroundPackedUpdatePtr GetBackgroundPackedUpdate(int flags)
+        {
+            if (flags & SimdBackgroundUpdateAdjustRange)
+                return BackgroundPackedUpdate<align, grow, increment, true>;
+            else
+                return BackgroundPackedUpdate<align, grow, increment, false>;
+        }
+
+        template <bool align, bool grow> BackgroundPackedUpdatePtr GetBackgroundPackedUpdate(int flags)
+        {
+            if (flags & SimdBackgroundUpdateIncrementCount)
+                return GetBackgroundPackedUpdate<align, grow, true>(flags);
+            else
+                return GetBackgroundPackedUpdate<align, grow, false>(flags);
+        }
+
+        template <bool align> BackgroundPackedUpdatePtr GetBackgroundPackedUpdate(int flags)
+        {
+            if (flags & SimdBackgroundUpdateGrowRange)
+                return GetBackgroundPackedUpdate<align, true>(flags);
+            else
+                return GetBackgroundPackedUpdate<align, false>(flags);
+        }
+
+        void BackgroundPackedUpdate(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * model, size_t modelStride, uint8_t threshold, int flags)
+        {
+            if ((flags & (SimdBackgroundUpdateGrowRange | SimdBackgroundUpdateIncrementCount | SimdBackgroundUpdateAdjustRange)) == 0)
+                return;
+            BackgroundPackedUpdatePtr backgroundPackedUpdate;
+            if (Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride))
+                backgroundPackedUpdate = GetBackgroundPackedUpdate<true>(flags);
+            else
+                backgroundPackedUpdate = GetBackgroundPackedUpdate<false>(flags);
+            backgroundPackedUpdate(value, valueStride, width, height, model, modelStride, threshold);
+        }
+
+        SIMD_INLINE __m256i BackgroundPackedGrowRangeSlow(const __m256i & model, const __m256i & value, const __m256i & threshold)
+        {
+            const __m256i inc = _mm256_and_si256(K32_00000100, Greater8u(value, model));
+            const __m256i dec = _mm256_and_si256(K32_00000001, Lesser8u(value, model));
+            return _mm256_subs_epu8(_mm256_adds_epu8(model, inc), dec);
+        }
+
+        SIMD_INLINE __m256i BackgroundPackedShiftRange(const __m256i & model, const __m256i & value, const __m256i & threshold)
+        {
+            const __m256i add = _mm256_and_si256(K32_0000FF00, _mm256_subs_epu8(value, model));
+            const __m256i sub = _mm256_and_si256(K32_000000FF, _mm256_subs_epu8(model, value));
+            const __m256i added = _mm256_adds_epu8(model, _mm256_or_si256(add, _mm256_srli_epi32(add, 8)));
+            return _mm256_subs_epu8(added, _mm256_or_si256(sub, _mm256_slli_epi32(sub, 8)));
+        }
+
+        SIMD_INLINE __m256i BackgroundPackedAdjustRangeMasked(const __m256i & model, const __m256i & mask, const __m256i & threshold)
+        {
+            const __m256i adjusted = BackgroundPackedUpdate<false, false, true>(model, mask, threshold);
+            return _mm256_blendv_epi8(adjusted, _mm256_and_si256(model, K32_0000FFFF), _mm256_cmpeq_epi8(mask, K_ZERO));
+        }
+
+        typedef __m256i(*BackgroundPackedKernelPtr)(const __m256i & model, const __m256i & value, const __m256i & threshold);
+
+        template <BackgroundPackedKernelPtr kernel, bool align> SIMD_INLINE void BackgroundPackedApply(uint8_t * model,
+            const __m256i & value, const __m256i & threshold, const __m256i & mask)
+        {
+            const __m256i _model = Load<align>((__m256i*)model);
+            Store<align>((__m256i*)model, _mm256_blendv_epi8(_model, kernel(_model, value, threshold), mask));
+        }
+
+        template <BackgroundPackedKernelPtr kernel, bool align, bool masked> SIMD_INLINE void BackgroundPackedApply(const uint8_t * value,
+            const uint8_t * mask, uint8_t * model, const __m256i & threshold, const __m256i & tailMask)
+        {
+            const __m256i _value = _mm256_permutevar8x32_epi32(Load<align>((__m256i*)value), K32_PERMUTE_FOR_UNPACK);
+            const __m256i value0 = _mm256_unpacklo_epi8(_value, _value);
+            const __m256i value1 = _mm256_unpackhi_epi8(_value, _value);
+            const __m256i pixelMask = masked ? _mm256_andnot_si256(_mm256_cmpeq_epi8(Load<align>((__m256i*)mask), K_ZERO), tailMask) : tailMask;
+            const __m256i _mask = _mm256_permutevar8x32_epi32(pixelMask, K32_PERMUTE_FOR_UNPACK);
+            const __m256i mask0 = _mm256_unpacklo_epi8(_mask, _mask);
+            const __m256i mask1 = _mm256_unpackhi_epi8(_mask, _mask);
+            BackgroundPackedApply<kernel, align>(model + 0 * A, _mm256_unpacklo_epi16(value0, value0), threshold, _mm256_unpacklo_epi16(mask0, mask0));
+            BackgroundPackedApply<kernel, align>(model + 1 * A, _mm256_unpackhi_epi16(value0, value0), threshold, _mm256_unpackhi_epi16(mask0, mask0));
+            BackgroundPackedApply<kernel, align>(model + 2 * A, _mm256_unpacklo_epi16(value1, value1), threshold, _mm256_unpacklo_epi16(mask1, mask1));
+            BackgroundPackedApply<kernel, align>(model + 3 * A, _mm256_unpackhi_epi16(value1, value1), threshold, _mm256_unpackhi_epi16(mask1, mask1));
+        }
+
+        template <BackgroundPackedKernelPtr kernel, bool align, bool masked> void BackgroundPackedApply(const uint8_t * value, size_t valueStride,
+            size_t width, size_t height, uint8_t * model, size_t modelStride, uint8_t threshold, const uint8_t * mask, size_t maskStride)
+        {
+            assert(width >= A);
+            if (align)
+                assert(Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride) && (!masked || (Aligned(mask) && Aligned(maskStride))));
+
+            const __m256i _threshold = _mm256_set1_epi8((char)threshold);
+            size_t alignedWidth = AlignLo(width, A);
+            __m256i tailMask = SetMask<uint8_t>(0, A - width + alignedWidth, 0xFF);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < alignedWidth; col += A)
+                    BackgroundPackedApply<kernel, align, masked>(value + col, mask + col, model + 4 * col, _threshold, K_INV_ZERO);
+                if (alignedWidth != width)
+                    BackgroundPackedApply<kernel, false, masked>(value + width - A, mask + width - A, model + 4 * (width - A), _threshold, tailMask);
+                value += valueStride;
+                model += modelStride;
+                mask += maskStride;
+            }
+        }
+
+        void BackgroundPackedGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
+        {
+            if (Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride))
+                BackgroundPackedApply<BackgroundPackedGrowRangeSlow, true, false>(value, valueStride, width, height, model, modelStride, 0, value, valueStride);
+            else
+                BackgroundPackedApply<BackgroundPackedGrowRangeSlow, false, false>(value, valueStride, width, height, model, modelStride, 0, value, valueStride);
+        }
+
+        void BackgroundPackedAdjustRangeMasked(uint8_t * model, size_t modelStride, size_t width, size_t height,
+            uint8_t threshold, const uint8_t * mask, size_t maskStride)
+        {
+            if (Aligned(model) && Aligned(modelStride) && Aligned(mask) && Aligned(maskStride))
+                BackgroundPackedApply<BackgroundPackedAdjustRangeMasked, true, false>(mask, maskStride, width, height, model, modelStride, threshold, mask, maskStride);
+            else
+                BackgroundPackedApply<BackgroundPackedAdjustRangeMasked, false, false>(mask, maskStride, width, height, model, modelStride, threshold, mask, maskStride);
+        }
+
+        void BackgroundPackedShiftRange(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
+        {
+            if (Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride))
+                BackgroundPackedApply<BackgroundPackedShiftRange, true, false>(value, valueStride, width, height, model, modelStride, 0, value, valueStride);
+            else
+                BackgroundPackedApply<BackgroundPackedShiftRange, false, false>(value, valueStride, width, height, model, modelStride, 0, value, valueStride);
+        }
+
+        void BackgroundPackedShiftRangeMasked(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * model, size_t modelStride, const uint8_t * mask, size_t maskStride)
+        {
+            if (Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride) && Aligned(mask) && Aligned(maskStride))
+                BackgroundPackedApply<BackgroundPackedShiftRange, true, true>(value, valueStride, width, height, model, modelStride, 0, mask, maskStride);
+            else
+                BackgroundPackedApply<BackgroundPackedShiftRange, false, true>(value, valueStride, width, height, model, modelStride, 0, mask, maskStride);
+        }
     }
 #endif// SIMD_AVX2_ENABLE
 }
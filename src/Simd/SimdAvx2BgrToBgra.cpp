@@ -30,15 +30,15 @@ namespace Simd
 #ifdef SIMD_AVX2_ENABLE    
     namespace Avx2
     {
-        template <bool align> SIMD_INLINE void BgrToBgra(const uint8_t * bgr, uint8_t * bgra, __m256i alpha)
+        template <bool align, bool rgb> SIMD_INLINE void BgrToBgra(const uint8_t * bgr, uint8_t * bgra, __m256i alpha)
         {
-            Store<align>((__m256i*)bgra + 0, BgrToBgra<false>(Load<align>((__m256i*)(bgr + 0)), alpha));
-            Store<align>((__m256i*)bgra + 1, BgrToBgra<false>(Load<false>((__m256i*)(bgr + 24)), alpha));
-            Store<align>((__m256i*)bgra + 2, BgrToBgra<false>(Load<false>((__m256i*)(bgr + 48)), alpha));
-            Store<align>((__m256i*)bgra + 3, BgrToBgra<true >(Load<align>((__m256i*)(bgr + 64)), alpha));
+            Store<align>((__m256i*)bgra + 0, BgrToBgra<false, rgb>(Load<align>((__m256i*)(bgr + 0)), alpha));
+            Store<align>((__m256i*)bgra + 1, BgrToBgra<false, rgb>(Load<false>((__m256i*)(bgr + 24)), alpha));
+            Store<align>((__m256i*)bgra + 2, BgrToBgra<false, rgb>(Load<false>((__m256i*)(bgr + 48)), alpha));
+            Store<align>((__m256i*)bgra + 3, BgrToBgra<true, rgb>(Load<align>((__m256i*)(bgr + 64)), alpha));
         }
 
-        template <bool align> void BgrToBgra(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        template <bool align, bool rgb> void BgrToBgra(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
         {
             assert(width >= A);
             if (align)
@@ -51,9 +51,9 @@ namespace Simd
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t col = 0; col < alignedWidth; col += A)
-                    BgrToBgra<align>(bgr + 3 * col, bgra + 4 * col, _alpha);
+                    BgrToBgra<align, rgb>(bgr + 3 * col, bgra + 4 * col, _alpha);
                 if (width != alignedWidth)
-                    BgrToBgra<false>(bgr + 3 * (width - A), bgra + 4 * (width - A), _alpha);
+                    BgrToBgra<false, rgb>(bgr + 3 * (width - A), bgra + 4 * (width - A), _alpha);
                 bgr += bgrStride;
                 bgra += bgraStride;
             }
@@ -62,9 +62,17 @@ namespace Simd
         void BgrToBgra(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
         {
             if (Aligned(bgra) && Aligned(bgraStride) && Aligned(bgr) && Aligned(bgrStride))
-                BgrToBgra<true>(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
+                BgrToBgra<true, false>(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
             else
-                BgrToBgra<false>(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
+                BgrToBgra<false, false>(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
+        }
+
+        void BgrToRgba(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * rgba, size_t rgbaStride, uint8_t alpha)
+        {
+            if (Aligned(rgba) && Aligned(rgbaStride) && Aligned(bgr) && Aligned(bgrStride))
+                BgrToBgra<true, true>(bgr, width, height, bgrStride, rgba, rgbaStride, alpha);
+            else
+                BgrToBgra<false, true>(bgr, width, height, bgrStride, rgba, rgbaStride, alpha);
         }
 
         template <bool align> SIMD_INLINE void Bgr48pToBgra32(uint8_t * bgra,
@@ -31,34 +31,35 @@ namespace Simd
     namespace Avx2
     {
         const __m256i K16_BLUE_RED = SIMD_MM256_SET2_EPI16(Base::BLUE_TO_GRAY_WEIGHT, Base::RED_TO_GRAY_WEIGHT);
+        const __m256i K16_RED_BLUE = SIMD_MM256_SET2_EPI16(Base::RED_TO_GRAY_WEIGHT, Base::BLUE_TO_GRAY_WEIGHT);
         const __m256i K16_GREEN_ROUND = SIMD_MM256_SET2_EPI16(Base::GREEN_TO_GRAY_WEIGHT, Base::BGR_TO_GRAY_ROUND_TERM);
 
-        SIMD_INLINE __m256i BgraToGray32(__m256i bgra)
+        template <bool rgb> SIMD_INLINE __m256i BgraToGray32(__m256i bgra)
         {
             const __m256i g0a0 = _mm256_and_si256(_mm256_srli_si256(bgra, 1), K16_00FF);
             const __m256i b0r0 = _mm256_and_si256(bgra, K16_00FF);
-            const __m256i weightedSum = _mm256_add_epi32(_mm256_madd_epi16(g0a0, K16_GREEN_ROUND), _mm256_madd_epi16(b0r0, K16_BLUE_RED));
+            const __m256i weightedSum = _mm256_add_epi32(_mm256_madd_epi16(g0a0, K16_GREEN_ROUND), _mm256_madd_epi16(b0r0, rgb ? K16_RED_BLUE : K16_BLUE_RED));
             return _mm256_srli_epi32(weightedSum, Base::BGR_TO_GRAY_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m256i BgraToGray(__m256i bgra[4])
+        template <bool rgb> SIMD_INLINE __m256i BgraToGray(__m256i bgra[4])
         {
-            const __m256i lo = PackI32ToI16(BgraToGray32(bgra[0]), BgraToGray32(bgra[1]));
-            const __m256i hi = PackI32ToI16(BgraToGray32(bgra[2]), BgraToGray32(bgra[3]));
+            const __m256i lo = PackI32ToI16(BgraToGray32<rgb>(bgra[0]), BgraToGray32<rgb>(bgra[1]));
+            const __m256i hi = PackI32ToI16(BgraToGray32<rgb>(bgra[2]), BgraToGray32<rgb>(bgra[3]));
             return PackU16ToU8(lo, hi);
         }
 
-        template <bool align> SIMD_INLINE __m256i BgrToGray(const uint8_t * bgr)
+        template <bool align, bool rgb> SIMD_INLINE __m256i BgrToGray(const uint8_t * bgr)
         {
             __m256i bgra[4];
             bgra[0] = BgrToBgra<false>(Load<align>((__m256i*)(bgr + 0)), K32_01000000);
             bgra[1] = BgrToBgra<false>(Load<false>((__m256i*)(bgr + 24)), K32_01000000);
             bgra[2] = BgrToBgra<false>(Load<false>((__m256i*)(bgr + 48)), K32_01000000);
             bgra[3] = BgrToBgra<true>(Load<align>((__m256i*)(bgr + 64)), K32_01000000);
-            return BgraToGray(bgra);
+            return BgraToGray<rgb>(bgra);
         }
 
-        template <bool align> void BgrToGray(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * gray, size_t grayStride)
+        template <bool align, bool rgb> void BgrToGray(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * gray, size_t grayStride)
         {
             assert(width >= A);
             if (align)
@@ -69,9 +70,9 @@ namespace Simd
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t col = 0; col < alignedWidth; col += A)
-                    Store<align>((__m256i*)(gray + col), BgrToGray<align>(bgr + 3 * col));
+                    Store<align>((__m256i*)(gray + col), BgrToGray<align, rgb>(bgr + 3 * col));
                 if (width != alignedWidth)
-                    Store<false>((__m256i*)(gray + width - A), BgrToGray<false>(bgr + 3 * (width - A)));
+                    Store<false>((__m256i*)(gray + width - A), BgrToGray<false, rgb>(bgr + 3 * (width - A)));
                 bgr += bgrStride;
                 gray += grayStride;
             }
@@ -80,9 +81,17 @@ namespace Simd
         void BgrToGray(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * gray, size_t grayStride)
         {
             if (Aligned(gray) && Aligned(grayStride) && Aligned(bgr) && Aligned(bgrStride))
-                BgrToGray<true>(bgr, width, height, bgrStride, gray, grayStride);
+                BgrToGray<true, false>(bgr, width, height, bgrStride, gray, grayStride);
             else
-                BgrToGray<false>(bgr, width, height, bgrStride, gray, grayStride);
+                BgrToGray<false, false>(bgr, width, height, bgrStride, gray, grayStride);
+        }
+
+        void RgbToGray(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * gray, size_t grayStride)
+        {
+            if (Aligned(gray) && Aligned(grayStride) && Aligned(rgb) && Aligned(rgbStride))
+                BgrToGray<true, true>(rgb, width, height, rgbStride, gray, grayStride);
+            else
+                BgrToGray<false, true>(rgb, width, height, rgbStride, gray, grayStride);
         }
     }
 #endif//SIMD_Avx2_ENABLE
@@ -0,0 +1,256 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        const __m256i K16_01FE = SIMD_MM256_SET1_EPI16(0x01FE);
+
+        template<int part> SIMD_INLINE __m256i BgrToHue16(__m256i blue, __m256i green, __m256i red, __m256i max, __m256i range)
+        {
+            __m256i b = UnpackU8<part>(blue), g = UnpackU8<part>(green), r = UnpackU8<part>(red);
+            __m256i m = UnpackU8<part>(max), d = UnpackU8<part>(range);
+            __m256i dividend = _mm256_add_epi16(_mm256_sub_epi16(r, g), _mm256_slli_epi16(d, 2));
+            dividend = _mm256_blendv_epi8(dividend, _mm256_add_epi16(_mm256_sub_epi16(b, r), _mm256_slli_epi16(d, 1)), _mm256_cmpeq_epi16(g, m));
+            dividend = _mm256_blendv_epi8(dividend, _mm256_add_epi16(_mm256_sub_epi16(g, b), _mm256_mullo_epi16(d, K16_0006)), _mm256_cmpeq_epi16(r, m));
+            __m256 k = _mm256_set1_ps(Base::KF_255_DIV_6);
+            __m256i lo = _mm256_cvttps_epi32(_mm256_div_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(UnpackU16<0>(dividend)), k), _mm256_cvtepi32_ps(UnpackU16<0>(d))));
+            __m256i hi = _mm256_cvttps_epi32(_mm256_div_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(UnpackU16<1>(dividend)), k), _mm256_cvtepi32_ps(UnpackU16<1>(d))));
+            __m256i hue = _mm256_packs_epi32(_mm256_and_si256(lo, K32_000000FF), _mm256_and_si256(hi, K32_000000FF));
+            return _mm256_andnot_si256(_mm256_cmpeq_epi16(d, K_ZERO), hue);
+        }
+
+        SIMD_INLINE __m256i BgrToHue(__m256i blue, __m256i green, __m256i red, __m256i max, __m256i range)
+        {
+            return _mm256_packus_epi16(BgrToHue16<0>(blue, green, red, max, range), BgrToHue16<1>(blue, green, red, max, range));
+        }
+
+        SIMD_INLINE __m256i Saturation16(__m256i range, __m256i divisor)
+        {
+            __m256i dividend = _mm256_mullo_epi16(range, K16_00FF);
+            __m256i lo = _mm256_cvttps_epi32(_mm256_div_ps(_mm256_cvtepi32_ps(UnpackU16<0>(dividend)), _mm256_cvtepi32_ps(UnpackU16<0>(divisor))));
+            __m256i hi = _mm256_cvttps_epi32(_mm256_div_ps(_mm256_cvtepi32_ps(UnpackU16<1>(dividend)), _mm256_cvtepi32_ps(UnpackU16<1>(divisor))));
+            return _mm256_andnot_si256(_mm256_cmpeq_epi16(divisor, K_ZERO), _mm256_packs_epi32(lo, hi));
+        }
+
+        template<int part> SIMD_INLINE __m256i HslSaturation16(__m256i range, __m256i sum)
+        {
+            return Saturation16(UnpackU8<part>(range), _mm256_min_epi16(sum, _mm256_sub_epi16(K16_01FE, sum)));
+        }
+
+        template<bool hsl> SIMD_INLINE void BgrToHsx(__m256i blue, __m256i green, __m256i red, __m256i hsx[3])
+        {
+            __m256i max = _mm256_max_epu8(_mm256_max_epu8(blue, green), red);
+            __m256i min = _mm256_min_epu8(_mm256_min_epu8(blue, green), red);
+            __m256i range = _mm256_sub_epi8(max, min);
+            hsx[0] = BgrToHue(blue, green, red, max, range);
+            if (hsl)
+            {
+                __m256i sumLo = _mm256_add_epi16(UnpackU8<0>(max), UnpackU8<0>(min));
+                __m256i sumHi = _mm256_add_epi16(UnpackU8<1>(max), UnpackU8<1>(min));
+                hsx[1] = _mm256_packus_epi16(HslSaturation16<0>(range, sumLo), HslSaturation16<1>(range, sumHi));
+                hsx[2] = _mm256_packus_epi16(_mm256_srli_epi16(sumLo, 1), _mm256_srli_epi16(sumHi, 1));
+            }
+            else
+            {
+                hsx[1] = _mm256_packus_epi16(Saturation16(UnpackU8<0>(range), UnpackU8<0>(max)), Saturation16(UnpackU8<1>(range), UnpackU8<1>(max)));
+                hsx[2] = max;
+            }
+        }
+
+        SIMD_INLINE void LoadBgr(const uint8_t * bgr, __m256i & blue, __m256i & green, __m256i & red)
+        {
+            __m256i _bgr[3];
+            _bgr[0] = _mm256_loadu_si256((__m256i*)bgr + 0);
+            _bgr[1] = _mm256_loadu_si256((__m256i*)bgr + 1);
+            _bgr[2] = _mm256_loadu_si256((__m256i*)bgr + 2);
+            blue = BgrToBlue(_bgr);
+            green = BgrToGreen(_bgr);
+            red = BgrToRed(_bgr);
+        }
+
+        SIMD_INLINE void StoreHsx(const __m256i hsx[3], uint8_t * dst)
+        {
+            _mm256_storeu_si256((__m256i*)dst + 0, InterleaveBgr<0>(hsx[0], hsx[1], hsx[2]));
+            _mm256_storeu_si256((__m256i*)dst + 1, InterleaveBgr<1>(hsx[0], hsx[1], hsx[2]));
+            _mm256_storeu_si256((__m256i*)dst + 2, InterleaveBgr<2>(hsx[0], hsx[1], hsx[2]));
+        }
+
+        template<bool hsl> SIMD_INLINE void BgrToHsx(const uint8_t * bgr, uint8_t * hsx)
+        {
+            __m256i blue, green, red, _hsx[3];
+            LoadBgr(bgr, blue, green, red);
+            BgrToHsx<hsl>(blue, green, red, _hsx);
+            StoreHsx(_hsx, hsx);
+        }
+
+        template<bool hsl> void BgrToHsx(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsx, size_t hsxStride)
+        {
+            assert(width >= A);
+
+            size_t widthA = AlignLo(width, A), tail = (width - A) * 3;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA * 3; col += A * 3)
+                    BgrToHsx<hsl>(bgr + col, hsx + col);
+                if (widthA < width)
+                    BgrToHsx<hsl>(bgr + tail, hsx + tail);
+                bgr += bgrStride;
+                hsx += hsxStride;
+            }
+        }
+
+        void BgrToHsl(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsl, size_t hslStride)
+        {
+            BgrToHsx<true>(bgr, width, height, bgrStride, hsl, hslStride);
+        }
+
+        void BgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride)
+        {
+            BgrToHsx<false>(bgr, width, height, bgrStride, hsv, hsvStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        template<bool hsl, class T> SIMD_INLINE void Yuv444pToHsx(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * hsx)
+        {
+            __m256i _y = _mm256_loadu_si256((__m256i*)y), _u = _mm256_loadu_si256((__m256i*)u), _v = _mm256_loadu_si256((__m256i*)v), _hsx[3];
+            BgrToHsx<hsl>(YuvToBlue<T>(_y, _u), YuvToGreen<T>(_y, _u, _v), YuvToRed<T>(_y, _v), _hsx);
+            StoreHsx(_hsx, hsx);
+        }
+
+        template<bool hsl, class T> void Yuv444pToHsx(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsx, size_t hsxStride)
+        {
+            assert(width >= A);
+
+            size_t widthA = AlignLo(width, A), tail = width - A;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                    Yuv444pToHsx<hsl, T>(y + col, u + col, v + col, hsx + col * 3);
+                if (widthA < width)
+                    Yuv444pToHsx<hsl, T>(y + tail, u + tail, v + tail, hsx + tail * 3);
+                y += yStride;
+                u += uStride;
+                v += vStride;
+                hsx += hsxStride;
+            }
+        }
+
+        void Yuv444pToHsl(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsl, size_t hslStride)
+        {
+            Yuv444pToHsx<true, Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride);
+        }
+
+        void Yuv444pToHslV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsl, size_t hslStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv444pToHsx<true, Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride); break;
+            case SimdYuvBt709: Yuv444pToHsx<true, Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride); break;
+            case SimdYuvBt2020: Yuv444pToHsx<true, Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride); break;
+            case SimdYuvBt601Full: Yuv444pToHsx<true, Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride); break;
+            case SimdYuvBt709Full: Yuv444pToHsx<true, Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride); break;
+            case SimdYuvBt2020Full: Yuv444pToHsx<true, Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride); break;
+            default: assert(0);
+            }
+        }
+
+        void Yuv444pToHsv(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsv, size_t hsvStride)
+        {
+            Yuv444pToHsx<false, Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride);
+        }
+
+        void Yuv444pToHsvV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsv, size_t hsvStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv444pToHsx<false, Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride); break;
+            case SimdYuvBt709: Yuv444pToHsx<false, Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride); break;
+            case SimdYuvBt2020: Yuv444pToHsx<false, Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride); break;
+            case SimdYuvBt601Full: Yuv444pToHsx<false, Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride); break;
+            case SimdYuvBt709Full: Yuv444pToHsx<false, Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride); break;
+            case SimdYuvBt2020Full: Yuv444pToHsx<false, Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride); break;
+            default: assert(0);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE __m256i GreaterOrEqual(__m256i a, __m256i b)
+        {
+            return _mm256_cmpeq_epi8(_mm256_max_epu8(a, b), a);
+        }
+
+        SIMD_INLINE __m256i LesserOrEqual(__m256i a, __m256i b)
+        {
+            return _mm256_cmpeq_epi8(_mm256_min_epu8(a, b), a);
+        }
+
+        SIMD_INLINE void BgrToHsvInRange(const uint8_t * bgr, const __m256i lower[3], const __m256i upper[3], const __m256i & wrap, uint8_t * mask)
+        {
+            __m256i blue, green, red, hsv[3];
+            LoadBgr(bgr, blue, green, red);
+            BgrToHsx<false>(blue, green, red, hsv);
+            __m256i hueLower = GreaterOrEqual(hsv[0], lower[0]), hueUpper = LesserOrEqual(hsv[0], upper[0]);
+            __m256i hue = _mm256_blendv_epi8(_mm256_and_si256(hueLower, hueUpper), _mm256_or_si256(hueLower, hueUpper), wrap);
+            __m256i saturation = _mm256_and_si256(GreaterOrEqual(hsv[1], lower[1]), LesserOrEqual(hsv[1], upper[1]));
+            __m256i value = _mm256_and_si256(GreaterOrEqual(hsv[2], lower[2]), LesserOrEqual(hsv[2], upper[2]));
+            _mm256_storeu_si256((__m256i*)mask, _mm256_and_si256(hue, _mm256_and_si256(saturation, value)));
+        }
+
+        void BgrToHsvInRange(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, const uint8_t * lower, const uint8_t * upper, uint8_t * mask, size_t maskStride)
+        {
+            assert(width >= A);
+
+            __m256i _lower[3], _upper[3];
+            for (size_t c = 0; c < 3; ++c)
+            {
+                _lower[c] = _mm256_set1_epi8((char)lower[c]);
+                _upper[c] = _mm256_set1_epi8((char)upper[c]);
+            }
+            __m256i wrap = _mm256_set1_epi8(lower[0] > upper[0] ? -1 : 0);
+            size_t widthA = AlignLo(width, A), tail = width - A;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                    BgrToHsvInRange(bgr + col * 3, _lower, _upper, wrap, mask + col);
+                if (widthA < width)
+                    BgrToHsvInRange(bgr + tail * 3, _lower, _upper, wrap, mask + tail);
+                bgr += bgrStride;
+                mask += maskStride;
+            }
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
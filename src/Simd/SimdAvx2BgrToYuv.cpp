@@ -55,7 +55,7 @@ namespace Simd
         }
 #endif
 
-        template <bool align> SIMD_INLINE void BgrToYuv420p(const uint8_t * bgr0, size_t bgrStride, uint8_t * y0, size_t yStride, uint8_t * u, uint8_t * v)
+        template <bool align, class T = Base::Bt601> SIMD_INLINE void BgrToYuv420p(const uint8_t * bgr0, size_t bgrStride, uint8_t * y0, size_t yStride, __m256i & u, __m256i & v)
         {
             const uint8_t * bgr1 = bgr0 + bgrStride;
             uint8_t * y1 = y0 + yStride;
@@ -63,16 +63,16 @@ namespace Simd
             __m256i blue[2][2], green[2][2], red[2][2];
 
             LoadBgr<align>((__m256i*)bgr0 + 0, blue[0][0], green[0][0], red[0][0]);
-            Store<align>((__m256i*)y0 + 0, BgrToY8(blue[0][0], green[0][0], red[0][0]));
+            Store<align>((__m256i*)y0 + 0, BgrToY8<T>(blue[0][0], green[0][0], red[0][0]));
 
             LoadBgr<align>((__m256i*)bgr0 + 3, blue[0][1], green[0][1], red[0][1]);
-            Store<align>((__m256i*)y0 + 1, BgrToY8(blue[0][1], green[0][1], red[0][1]));
+            Store<align>((__m256i*)y0 + 1, BgrToY8<T>(blue[0][1], green[0][1], red[0][1]));
 
             LoadBgr<align>((__m256i*)bgr1 + 0, blue[1][0], green[1][0], red[1][0]);
-            Store<align>((__m256i*)y1 + 0, BgrToY8(blue[1][0], green[1][0], red[1][0]));
+            Store<align>((__m256i*)y1 + 0, BgrToY8<T>(blue[1][0], green[1][0], red[1][0]));
 
             LoadBgr<align>((__m256i*)bgr1 + 3, blue[1][1], green[1][1], red[1][1]);
-            Store<align>((__m256i*)y1 + 1, BgrToY8(blue[1][1], green[1][1], red[1][1]));
+            Store<align>((__m256i*)y1 + 1, BgrToY8<T>(blue[1][1], green[1][1], red[1][1]));
 
             blue[0][0] = Average16(blue[0][0], blue[1][0]);
             blue[0][1] = Average16(blue[0][1], blue[1][1]);
@@ -81,11 +81,19 @@ namespace Simd
             red[0][0] = Average16(red[0][0], red[1][0]);
             red[0][1] = Average16(red[0][1], red[1][1]);
 
-            Store<align>((__m256i*)u, PackU16ToU8(BgrToU16(blue[0][0], green[0][0], red[0][0]), BgrToU16(blue[0][1], green[0][1], red[0][1])));
-            Store<align>((__m256i*)v, PackU16ToU8(BgrToV16(blue[0][0], green[0][0], red[0][0]), BgrToV16(blue[0][1], green[0][1], red[0][1])));
+            u = PackU16ToU8(BgrToU16<T>(blue[0][0], green[0][0], red[0][0]), BgrToU16<T>(blue[0][1], green[0][1], red[0][1]));
+            v = PackU16ToU8(BgrToV16<T>(blue[0][0], green[0][0], red[0][0]), BgrToV16<T>(blue[0][1], green[0][1], red[0][1]));
         }
 
-        template <bool align> void BgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+        template <bool align, class T = Base::Bt601> SIMD_INLINE void BgrToYuv420p(const uint8_t * bgr0, size_t bgrStride, uint8_t * y0, size_t yStride, uint8_t * u, uint8_t * v)
+        {
+            __m256i _u, _v;
+            BgrToYuv420p<align, T>(bgr0, bgrStride, y0, yStride, _u, _v);
+            Store<align>((__m256i*)u, _u);
+            Store<align>((__m256i*)v, _v);
+        }
+
+        template <bool align, class T = Base::Bt601> void BgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
@@ -100,11 +108,11 @@ namespace Simd
             for (size_t row = 0; row < height; row += 2)
             {
                 for (size_t colUV = 0, colY = 0, colBgr = 0; colY < alignedWidth; colY += DA, colUV += A, colBgr += A6)
-                    BgrToYuv420p<align>(bgr + colBgr, bgrStride, y + colY, yStride, u + colUV, v + colUV);
+                    BgrToYuv420p<align, T>(bgr + colBgr, bgrStride, y + colY, yStride, u + colUV, v + colUV);
                 if (width != alignedWidth)
                 {
                     size_t offset = width - DA;
-                    BgrToYuv420p<false>(bgr + offset * 3, bgrStride, y + offset, yStride, u + offset / 2, v + offset / 2);
+                    BgrToYuv420p<false, T>(bgr + offset * 3, bgrStride, y + offset, yStride, u + offset / 2, v + offset / 2);
                 }
                 y += 2 * yStride;
                 u += uStride;
@@ -113,14 +121,41 @@ namespace Simd
             }
         }
 
-        void BgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+        template <class T> void BgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
-                BgrToYuv420p<true>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+                BgrToYuv420p<true, T>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
             else
-                BgrToYuv420p<false>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+                BgrToYuv420p<false, T>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgrToYuv420p<Base::Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToYuv420p<Base::Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgrToYuv420p<Base::Bt709>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgrToYuv420p<Base::Bt2020>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: BgrToYuv420p<Base::Bt601Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: BgrToYuv420p<Base::Bt709Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: BgrToYuv420p<Base::Bt2020Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            default: assert(0);
+            }
+        }
+
+        void RgbToYuv420p(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgrToYuv420p<Base::Rgb<Base::Bt601>>(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride);
         }
 
         SIMD_INLINE void Average16(__m256i & a)
@@ -132,15 +167,15 @@ namespace Simd
 #endif
         }
 
-        template <bool align> SIMD_INLINE void BgrToYuv422p(const uint8_t * bgr, uint8_t * y, uint8_t * u, uint8_t * v)
+        template <bool align, class T = Base::Bt601> SIMD_INLINE void BgrToYuv422p(const uint8_t * bgr, uint8_t * y, uint8_t * u, uint8_t * v)
         {
             __m256i blue[2], green[2], red[2];
 
             LoadBgr<align>((__m256i*)bgr + 0, blue[0], green[0], red[0]);
-            Store<align>((__m256i*)y + 0, BgrToY8(blue[0], green[0], red[0]));
+            Store<align>((__m256i*)y + 0, BgrToY8<T>(blue[0], green[0], red[0]));
 
             LoadBgr<align>((__m256i*)bgr + 3, blue[1], green[1], red[1]);
-            Store<align>((__m256i*)y + 1, BgrToY8(blue[1], green[1], red[1]));
+            Store<align>((__m256i*)y + 1, BgrToY8<T>(blue[1], green[1], red[1]));
 
             Average16(blue[0]);
             Average16(blue[1]);
@@ -149,11 +184,11 @@ namespace Simd
             Average16(red[0]);
             Average16(red[1]);
 
-            Store<align>((__m256i*)u, PackU16ToU8(BgrToU16(blue[0], green[0], red[0]), BgrToU16(blue[1], green[1], red[1])));
-            Store<align>((__m256i*)v, PackU16ToU8(BgrToV16(blue[0], green[0], red[0]), BgrToV16(blue[1], green[1], red[1])));
+            Store<align>((__m256i*)u, PackU16ToU8(BgrToU16<T>(blue[0], green[0], red[0]), BgrToU16<T>(blue[1], green[1], red[1])));
+            Store<align>((__m256i*)v, PackU16ToU8(BgrToV16<T>(blue[0], green[0], red[0]), BgrToV16<T>(blue[1], green[1], red[1])));
         }
 
-        template <bool align> void BgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+        template <bool align, class T = Base::Bt601> void BgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             assert((width % 2 == 0) && (width >= DA));
@@ -168,11 +203,11 @@ namespace Simd
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t colUV = 0, colY = 0, colBgr = 0; colY < alignedWidth; colY += DA, colUV += A, colBgr += A6)
-                    BgrToYuv422p<align>(bgr + colBgr, y + colY, u + colUV, v + colUV);
+                    BgrToYuv422p<align, T>(bgr + colBgr, y + colY, u + colUV, v + colUV);
                 if (width != alignedWidth)
                 {
                     size_t offset = width - DA;
-                    BgrToYuv422p<false>(bgr + offset * 3, y + offset, u + offset / 2, v + offset / 2);
+                    BgrToYuv422p<false, T>(bgr + offset * 3, y + offset, u + offset / 2, v + offset / 2);
                 }
                 y += yStride;
                 u += uStride;
@@ -181,26 +216,53 @@ namespace Simd
             }
         }
 
-        void BgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+        template <class T> void BgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
-                BgrToYuv422p<true>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+                BgrToYuv422p<true, T>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
             else
-                BgrToYuv422p<false>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+                BgrToYuv422p<false, T>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
         }
 
-        template <bool align> SIMD_INLINE void BgrToYuv444p(const uint8_t * bgr, uint8_t * y, uint8_t * u, uint8_t * v)
+        void BgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgrToYuv422p<Base::Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgrToYuv422pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToYuv422p<Base::Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgrToYuv422p<Base::Bt709>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgrToYuv422p<Base::Bt2020>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: BgrToYuv422p<Base::Bt601Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: BgrToYuv422p<Base::Bt709Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: BgrToYuv422p<Base::Bt2020Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            default: assert(0);
+            }
+        }
+
+        void RgbToYuv422p(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgrToYuv422p<Base::Rgb<Base::Bt601>>(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        template <bool align, class T = Base::Bt601> SIMD_INLINE void BgrToYuv444p(const uint8_t * bgr, uint8_t * y, uint8_t * u, uint8_t * v)
         {
             __m256i blue, green, red;
             LoadBgr<align>((__m256i*)bgr, blue, green, red);
-            Store<align>((__m256i*)y, BgrToY8(blue, green, red));
-            Store<align>((__m256i*)u, BgrToU8(blue, green, red));
-            Store<align>((__m256i*)v, BgrToV8(blue, green, red));
+            Store<align>((__m256i*)y, BgrToY8<T>(blue, green, red));
+            Store<align>((__m256i*)u, BgrToU8<T>(blue, green, red));
+            Store<align>((__m256i*)v, BgrToV8<T>(blue, green, red));
         }
 
-        template <bool align> void BgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+        template <bool align, class T = Base::Bt601> void BgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             assert(width >= A);
@@ -215,11 +277,11 @@ namespace Simd
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t col = 0, colBgr = 0; col < alignedWidth; col += A, colBgr += A3)
-                    BgrToYuv444p<align>(bgr + colBgr, y + col, u + col, v + col);
+                    BgrToYuv444p<align, T>(bgr + colBgr, y + col, u + col, v + col);
                 if (width != alignedWidth)
                 {
                     size_t col = width - A;
-                    BgrToYuv444p<false>(bgr + col * 3, y + col, u + col, v + col);
+                    BgrToYuv444p<false, T>(bgr + col * 3, y + col, u + col, v + col);
                 }
                 y += yStride;
                 u += uStride;
@@ -228,14 +290,121 @@ namespace Simd
             }
         }
 
-        void BgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+        template <class T> void BgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
-                BgrToYuv444p<true>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+                BgrToYuv444p<true, T>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+            else
+                BgrToYuv444p<false, T>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgrToYuv444p<Base::Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgrToYuv444pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToYuv444p<Base::Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgrToYuv444p<Base::Bt709>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgrToYuv444p<Base::Bt2020>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: BgrToYuv444p<Base::Bt601Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: BgrToYuv444p<Base::Bt709Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: BgrToYuv444p<Base::Bt2020Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            default: assert(0);
+            }
+        }
+
+        void RgbToYuv444p(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgrToYuv444p<Base::Rgb<Base::Bt601>>(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        template <bool align, bool nv21, class T> SIMD_INLINE void BgrToNv12(const uint8_t * bgr0, size_t bgrStride, uint8_t * y0, size_t yStride, uint8_t * uv)
+        {
+            __m256i u, v;
+            BgrToYuv420p<align, T>(bgr0, bgrStride, y0, yStride, u, v);
+            StoreUv<align, nv21>(uv, u, v);
+        }
+
+        template <bool align, bool nv21, class T> void BgrToNv12(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * uv, size_t uvStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
+            if (align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride));
+                assert(Aligned(bgr) && Aligned(bgrStride));
+            }
+
+            size_t alignedWidth = AlignLo(width, DA);
+            const size_t A6 = A * 6;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0, colBgr = 0; colY < alignedWidth; colY += DA, colBgr += A6)
+                    BgrToNv12<align, nv21, T>(bgr + colBgr, bgrStride, y + colY, yStride, uv + colY);
+                if (width != alignedWidth)
+                {
+                    size_t offset = width - DA;
+                    BgrToNv12<false, nv21, T>(bgr + offset * 3, bgrStride, y + offset, yStride, uv + offset);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                bgr += 2 * bgrStride;
+            }
+        }
+
+        template <bool nv21, class T> void BgrToNv12(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(bgr) && Aligned(bgrStride))
+                BgrToNv12<true, nv21, T>(bgr, width, height, bgrStride, y, yStride, uv, uvStride);
             else
-                BgrToYuv444p<false>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+                BgrToNv12<false, nv21, T>(bgr, width, height, bgrStride, y, yStride, uv, uvStride);
+        }
+
+        void BgrToNv12(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride)
+        {
+            BgrToNv12<false, Base::Bt601>(bgr, width, height, bgrStride, y, yStride, uv, uvStride);
+        }
+
+        void BgrToNv12V2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToNv12<false, Base::Bt601>(bgr, width, height, bgrStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt709: BgrToNv12<false, Base::Bt709>(bgr, width, height, bgrStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt2020: BgrToNv12<false, Base::Bt2020>(bgr, width, height, bgrStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt601Full: BgrToNv12<false, Base::Bt601Full>(bgr, width, height, bgrStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt709Full: BgrToNv12<false, Base::Bt709Full>(bgr, width, height, bgrStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt2020Full: BgrToNv12<false, Base::Bt2020Full>(bgr, width, height, bgrStride, y, yStride, uv, uvStride); break;
+            default: assert(0);
+            }
+        }
+
+        void BgrToNv21(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * vu, size_t vuStride)
+        {
+            BgrToNv12<true, Base::Bt601>(bgr, width, height, bgrStride, y, yStride, vu, vuStride);
+        }
+
+        void BgrToNv21V2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * vu, size_t vuStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToNv12<true, Base::Bt601>(bgr, width, height, bgrStride, y, yStride, vu, vuStride); break;
+            case SimdYuvBt709: BgrToNv12<true, Base::Bt709>(bgr, width, height, bgrStride, y, yStride, vu, vuStride); break;
+            case SimdYuvBt2020: BgrToNv12<true, Base::Bt2020>(bgr, width, height, bgrStride, y, yStride, vu, vuStride); break;
+            case SimdYuvBt601Full: BgrToNv12<true, Base::Bt601Full>(bgr, width, height, bgrStride, y, yStride, vu, vuStride); break;
+            case SimdYuvBt709Full: BgrToNv12<true, Base::Bt709Full>(bgr, width, height, bgrStride, y, yStride, vu, vuStride); break;
+            case SimdYuvBt2020Full: BgrToNv12<true, Base::Bt2020Full>(bgr, width, height, bgrStride, y, yStride, vu, vuStride); break;
+            default: assert(0);
+            }
         }
     }
 #endif// SIMD_AVX2_ENABLE
@@ -31,21 +31,22 @@ namespace Simd
     namespace Avx2
     {
         const __m256i K16_BLUE_RED = SIMD_MM256_SET2_EPI16(Base::BLUE_TO_GRAY_WEIGHT, Base::RED_TO_GRAY_WEIGHT);
+        const __m256i K16_RED_BLUE = SIMD_MM256_SET2_EPI16(Base::RED_TO_GRAY_WEIGHT, Base::BLUE_TO_GRAY_WEIGHT);
         const __m256i K16_GREEN_0000 = SIMD_MM256_SET2_EPI16(Base::GREEN_TO_GRAY_WEIGHT, 0x0000);
         const __m256i K32_ROUND_TERM = SIMD_MM256_SET1_EPI32(Base::BGR_TO_GRAY_ROUND_TERM);
 
-        SIMD_INLINE __m256i BgraToGray32(__m256i bgra)
+        template <bool rgb> SIMD_INLINE __m256i BgraToGray32(__m256i bgra)
         {
             const __m256i g0a0 = _mm256_and_si256(_mm256_srli_si256(bgra, 1), K16_00FF);
             const __m256i b0r0 = _mm256_and_si256(bgra, K16_00FF);
-            const __m256i weightedSum = _mm256_add_epi32(_mm256_madd_epi16(g0a0, K16_GREEN_0000), _mm256_madd_epi16(b0r0, K16_BLUE_RED));
+            const __m256i weightedSum = _mm256_add_epi32(_mm256_madd_epi16(g0a0, K16_GREEN_0000), _mm256_madd_epi16(b0r0, rgb ? K16_RED_BLUE : K16_BLUE_RED));
             return _mm256_srli_epi32(_mm256_add_epi32(weightedSum, K32_ROUND_TERM), Base::BGR_TO_GRAY_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m256i BgraToGray(__m256i bgra[4])
+        template <bool rgb> SIMD_INLINE __m256i BgraToGray(__m256i bgra[4])
         {
-            const __m256i lo = PackI32ToI16(BgraToGray32(bgra[0]), BgraToGray32(bgra[1]));
-            const __m256i hi = PackI32ToI16(BgraToGray32(bgra[2]), BgraToGray32(bgra[3]));
+            const __m256i lo = PackI32ToI16(BgraToGray32<rgb>(bgra[0]), BgraToGray32<rgb>(bgra[1]));
+            const __m256i hi = PackI32ToI16(BgraToGray32<rgb>(bgra[2]), BgraToGray32<rgb>(bgra[3]));
             return PackU16ToU8(lo, hi);
         }
 
@@ -57,7 +58,7 @@ namespace Simd
             a[3] = Load<align>((__m256i*)p + 3);
         }
 
-        template <bool align> void BgraToGray(const uint8_t *bgra, size_t width, size_t height, size_t bgraStride, uint8_t *gray, size_t grayStride)
+        template <bool align, bool rgb> void BgraToGray(const uint8_t *bgra, size_t width, size_t height, size_t bgraStride, uint8_t *gray, size_t grayStride)
         {
             assert(width >= A);
             if (align)
@@ -70,12 +71,12 @@ namespace Simd
                 for (size_t col = 0; col < alignedWidth; col += A)
                 {
                     Load<align>(bgra + 4 * col, a);
-                    Store<align>((__m256i*)(gray + col), BgraToGray(a));
+                    Store<align>((__m256i*)(gray + col), BgraToGray<rgb>(a));
                 }
                 if (alignedWidth != width)
                 {
                     Load<false>(bgra + 4 * (width - A), a);
-                    Store<false>((__m256i*)(gray + width - A), BgraToGray(a));
+                    Store<false>((__m256i*)(gray + width - A), BgraToGray<rgb>(a));
                 }
                 bgra += bgraStride;
                 gray += grayStride;
@@ -85,9 +86,17 @@ namespace Simd
         void BgraToGray(const uint8_t *bgra, size_t width, size_t height, size_t bgraStride, uint8_t *gray, size_t grayStride)
         {
             if (Aligned(bgra) && Aligned(gray) && Aligned(bgraStride) && Aligned(grayStride))
-                BgraToGray<true>(bgra, width, height, bgraStride, gray, grayStride);
+                BgraToGray<true, false>(bgra, width, height, bgraStride, gray, grayStride);
             else
-                BgraToGray<false>(bgra, width, height, bgraStride, gray, grayStride);
+                BgraToGray<false, false>(bgra, width, height, bgraStride, gray, grayStride);
+        }
+
+        void RgbaToGray(const uint8_t * rgba, size_t width, size_t height, size_t rgbaStride, uint8_t * gray, size_t grayStride)
+        {
+            if (Aligned(rgba) && Aligned(gray) && Aligned(rgbaStride) && Aligned(grayStride))
+                BgraToGray<true, true>(rgba, width, height, rgbaStride, gray, grayStride);
+            else
+                BgraToGray<false, true>(rgba, width, height, rgbaStride, gray, grayStride);
         }
     }
 #endif// SIMD_AVX2_ENABLE
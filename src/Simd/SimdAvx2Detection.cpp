@@ -339,6 +339,195 @@ namespace Simd
                 Image(hid.sum.width - 1, hid.sum.height - 1, dstStride, Image::Gray8, dst).Ref());
         }
 
+        SIMD_INLINE __m256i Norm16i(const __m256 & norm, float inorm)
+        {
+            return _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(norm, _mm256_set1_ps(inorm)), _mm256_set1_ps(0.5f)));
+        }
+
+        SIMD_INLINE __m256i Norm16ip(const HidHaarCascade & hid, size_t offset)
+        {
+            __m256i lo = Norm16i(Norm32fp(hid, offset + 0), hid.inorm);
+            __m256i hi = Norm16i(Norm32fp(hid, offset + 8), hid.inorm);
+            return PackI32ToI16(lo, hi);
+        }
+
+        SIMD_INLINE __m256i Norm16ii(const HidHaarCascade & hid, size_t offset)
+        {
+            __m256i lo = Norm16i(Norm32fi(hid, offset + 0), hid.inorm);
+            __m256i hi = Norm16i(Norm32fi(hid, offset + HA), hid.inorm);
+            return PackI32ToI16(lo, hi);
+        }
+
+        SIMD_INLINE __m256i WeightedSum16i(const WeightedRect16i & rect, size_t offset)
+        {
+            __m256i s0 = _mm256_loadu_si256((__m256i*)(rect.p0 + offset));
+            __m256i s1 = _mm256_loadu_si256((__m256i*)(rect.p1 + offset));
+            __m256i s2 = _mm256_loadu_si256((__m256i*)(rect.p2 + offset));
+            __m256i s3 = _mm256_loadu_si256((__m256i*)(rect.p3 + offset));
+            __m256i sum = _mm256_sub_epi16(_mm256_sub_epi16(s0, s1), _mm256_sub_epi16(s2, s3));
+            return _mm256_mullo_epi16(sum, _mm256_set1_epi16(rect.weight));
+        }
+
+        SIMD_INLINE void StageSum16i(const int * leaves, int threshold, const __m256i & sum, const __m256i & norm, __m256i & stageSum)
+        {
+            __m256i mask = _mm256_cmpgt_epi16(_mm256_mulhrs_epi16(_mm256_set1_epi16(threshold), norm), sum);
+            stageSum = _mm256_add_epi16(stageSum, _mm256_blendv_epi8(_mm256_set1_epi16(leaves[1]), _mm256_set1_epi16(leaves[0]), mask));
+        }
+
+        void Detect16i(const HidHaarCascade & hid, size_t offset, const __m256i & norm, __m256i & result)
+        {
+            typedef HidHaarCascade Hid;
+            const int * leaves = hid.ileaves.data();
+            const Hid::Node * node = hid.nodes.data();
+            const Hid::Stage * stages = hid.stages.data();
+            for (int i = 0, n = (int)hid.stages.size(); i < n; ++i)
+            {
+                const Hid::Stage & stage = stages[i];
+                const Hid::Node * end = node + stage.ntrees;
+                __m256i stageSum = _mm256_setzero_si256();
+                for (; node < end; ++node, leaves += 2)
+                {
+                    const Hid::IFeature & feature = hid.ifeatures[node->featureIdx];
+                    __m256i sum = _mm256_add_epi16(WeightedSum16i(feature.rect[0], offset), WeightedSum16i(feature.rect[1], offset));
+                    if (feature.rect[2].p0)
+                        sum = _mm256_add_epi16(sum, WeightedSum16i(feature.rect[2], offset));
+                    StageSum16i(leaves, node->ithreshold, sum, norm, stageSum);
+                }
+                result = _mm256_andnot_si256(_mm256_cmpgt_epi16(_mm256_set1_epi16(stage.ithreshold), stageSum), result);
+                int resultCount = ResultCount(result);
+                if (resultCount == 0)
+                    return;
+                else if (resultCount == 1)
+                {
+                    uint16_t SIMD_ALIGNED(32) _result[HA];
+                    int16_t SIMD_ALIGNED(32) _norm[HA];
+                    _mm256_store_si256((__m256i*)_result, result);
+                    _mm256_store_si256((__m256i*)_norm, norm);
+                    for (int j = 0; j < HA; ++j)
+                    {
+                        if (_result[j])
+                        {
+                            _result[j] = Base::Detect16i(hid, offset + j, i + 1, _norm[j]) > 0 ? 1 : 0;
+                            break;
+                        }
+                    }
+                    result = _mm256_load_si256((__m256i*)_result);
+                    return;
+                }
+            }
+        }
+
+        void DetectionHaarDetect16ip(const HidHaarCascade & hid, const Image & mask, const Rect & rect, Image & dst)
+        {
+            size_t width = rect.Width();
+            size_t alignedWidth = Simd::AlignLo(width, HA);
+            size_t evenWidth = Simd::AlignLo(width, 2);
+            Buffer<uint16_t> buffer(width);
+            for (ptrdiff_t row = rect.top; row < rect.bottom; row += 1)
+            {
+                size_t col = 0;
+                size_t p_offset = row * hid.isum.stride / sizeof(uint16_t) + rect.left;
+                size_t pq_offset = row * hid.sqsum.stride / sizeof(uint32_t) + rect.left;
+                UnpackMask16i(mask.data + row*mask.stride + rect.left, width, buffer.m, K8_01);
+                memset(buffer.d, 0, width * sizeof(uint16_t));
+                for (; col < alignedWidth; col += HA)
+                {
+                    __m256i result = _mm256_loadu_si256((__m256i*)(buffer.m + col));
+                    if (_mm256_testz_si256(result, K16_0001))
+                        continue;
+                    __m256i norm = Norm16ip(hid, pq_offset + col);
+                    Detect16i(hid, p_offset + col, norm, result);
+                    _mm256_storeu_si256((__m256i*)(buffer.d + col), result);
+                }
+                if (evenWidth > alignedWidth + 2)
+                {
+                    col = evenWidth - HA;
+                    __m256i result = _mm256_loadu_si256((__m256i*)(buffer.m + col));
+                    if (!_mm256_testz_si256(result, K16_0001))
+                    {
+                        __m256i norm = Norm16ip(hid, pq_offset + col);
+                        Detect16i(hid, p_offset + col, norm, result);
+                        _mm256_storeu_si256((__m256i*)(buffer.d + col), result);
+                    }
+                    col += HA;
+                }
+                for (; col < width; ++col)
+                {
+                    if (buffer.m[col] == 0)
+                        continue;
+                    int norm = Base::Norm16i(hid, pq_offset + col);
+                    buffer.d[col] = Base::Detect16i(hid, p_offset + col, 0, norm) > 0 ? 1 : 0;
+                }
+                PackResult16i(buffer.d, width, dst.data + row*dst.stride + rect.left);
+            }
+        }
+
+        void DetectionHaarDetect16ip(const void * _hid, const uint8_t * mask, size_t maskStride,
+            ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
+        {
+            const HidHaarCascade & hid = *(HidHaarCascade*)_hid;
+            return DetectionHaarDetect16ip(hid,
+                Image(hid.sum.width - 1, hid.sum.height - 1, maskStride, Image::Gray8, (uint8_t*)mask),
+                Rect(left, top, right, bottom),
+                Image(hid.sum.width - 1, hid.sum.height - 1, dstStride, Image::Gray8, dst).Ref());
+        }
+
+        void DetectionHaarDetect16ii(const HidHaarCascade & hid, const Image & mask, const Rect & rect, Image & dst)
+        {
+            const size_t step = 2;
+            size_t width = rect.Width();
+            size_t alignedWidth = Simd::AlignLo(width, A);
+            size_t evenWidth = Simd::AlignLo(width, 2);
+
+            for (ptrdiff_t row = rect.top; row < rect.bottom; row += step)
+            {
+                size_t col = 0;
+                size_t p_offset = row * hid.isum.stride / sizeof(uint16_t) + rect.left / 2;
+                size_t pq_offset = row * hid.sqsum.stride / sizeof(uint32_t) + rect.left;
+                const uint8_t * m = mask.data + row*mask.stride + rect.left;
+                uint8_t * d = dst.data + row*dst.stride + rect.left;
+                for (; col < alignedWidth; col += A)
+                {
+                    __m256i result = _mm256_and_si256(_mm256_loadu_si256((__m256i*)(m + col)), K16_0001);
+                    if (_mm256_testz_si256(result, K16_0001))
+                        continue;
+                    __m256i norm = Norm16ii(hid, pq_offset + col);
+                    Detect16i(hid, p_offset + col / 2, norm, result);
+                    _mm256_storeu_si256((__m256i*)(d + col), result);
+                }
+                if (evenWidth > alignedWidth + 2)
+                {
+                    col = evenWidth - A;
+                    __m256i result = _mm256_and_si256(_mm256_loadu_si256((__m256i*)(m + col)), K16_0001);
+                    if (!_mm256_testz_si256(result, K16_0001))
+                    {
+                        __m256i norm = Norm16ii(hid, pq_offset + col);
+                        Detect16i(hid, p_offset + col / 2, norm, result);
+                        _mm256_storeu_si256((__m256i*)(d + col), result);
+                    }
+                    col += A;
+                }
+                for (; col < width; col += step)
+                {
+                    if (mask.At<uint8_t>(col + rect.left, row) == 0)
+                        continue;
+                    int norm = Base::Norm16i(hid, pq_offset + col);
+                    if (Base::Detect16i(hid, p_offset + col / 2, 0, norm) > 0)
+                        dst.At<uint8_t>(col + rect.left, row) = 1;
+                }
+            }
+        }
+
+        void DetectionHaarDetect16ii(const void * _hid, const uint8_t * mask, size_t maskStride,
+            ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
+        {
+            const HidHaarCascade & hid = *(HidHaarCascade*)_hid;
+            return DetectionHaarDetect16ii(hid,
+                Image(hid.sum.width - 1, hid.sum.height - 1, maskStride, Image::Gray8, (uint8_t*)mask),
+                Rect(left, top, right, bottom),
+                Image(hid.sum.width - 1, hid.sum.height - 1, dstStride, Image::Gray8, dst).Ref());
+        }
+
         const __m256i K8_SHUFFLE_BITS = SIMD_MM256_SETR_EPI8(
             0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
             0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00);
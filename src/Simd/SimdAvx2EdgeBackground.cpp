@@ -298,6 +298,226 @@ namespace Simd
             else
                 EdgeBackgroundShiftRangeMasked<false>(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
         }
+
+        const __m256i K16_0100 = SIMD_MM256_SET1_EPI16(0x0100);
+
+        template <bool align> SIMD_INLINE void EdgeBackgroundPackedInit(const uint8_t * value, uint8_t * model)
+        {
+            const __m256i _value = _mm256_permute4x64_epi64(Load<align>((__m256i*)value), 0xD8);
+            Store<align>((__m256i*)model + 0, _mm256_unpacklo_epi8(_value, K_ZERO));
+            Store<align>((__m256i*)model + 1, _mm256_unpackhi_epi8(_value, K_ZERO));
+        }
+
+        template <bool align> void EdgeBackgroundPackedInit(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
+        {
+            assert(width >= A);
+            if (align)
+                assert(Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride));
+
+            size_t alignedWidth = AlignLo(width, A);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < alignedWidth; col += A)
+                    EdgeBackgroundPackedInit<align>(value + col, model + 2 * col);
+                if (alignedWidth != width)
+                    EdgeBackgroundPackedInit<false>(value + width - A, model + 2 * (width - A));
+                value += valueStride;
+                model += modelStride;
+            }
+        }
+
+        void EdgeBackgroundPackedInit(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
+        {
+            if (Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride))
+                EdgeBackgroundPackedInit<true>(value, valueStride, width, height, model, modelStride);
+            else
+                EdgeBackgroundPackedInit<false>(value, valueStride, width, height, model, modelStride);
+        }
+
+        template <bool grow, bool increment, bool adjust> SIMD_INLINE __m256i EdgeBackgroundPackedUpdate(__m256i model, const __m256i & value, const __m256i & threshold)
+        {
+            if (grow)
+                model = _mm256_max_epu8(model, _mm256_and_si256(value, K16_00FF));
+            if (increment)
+                model = _mm256_adds_epu8(model, _mm256_and_si256(K16_0100, Greater8u(value, _mm256_slli_epi16(model, 8))));
+            if (adjust)
+            {
+                const __m256i count = _mm256_srli_epi16(model, 8);
+                const __m256i inc = _mm256_and_si256(K16_0001, Greater8u(count, threshold));
+                const __m256i dec = _mm256_and_si256(K16_0001, Lesser8u(count, threshold));
+                model = _mm256_and_si256(_mm256_subs_epu8(_mm256_adds_epu8(model, inc), dec), K16_00FF);
+            }
+            return model;
+        }
+
+        template <bool align, bool masked, bool grow, bool increment, bool adjust> SIMD_INLINE void EdgeBackgroundPackedUpdate(uint8_t * model,
+            const __m256i & value, const __m256i & threshold, const __m256i & mask)
+        {
+            const __m256i _model = Load<align>((__m256i*)model);
+            const __m256i updated = EdgeBackgroundPackedUpdate<grow, increment, adjust>(_model, value, threshold);
+            Store<align>((__m256i*)model, masked ? _mm256_blendv_epi8(_model, updated, mask) : updated);
+        }
+
+        template <bool align, bool masked, bool grow, bool increment, bool adjust> SIMD_INLINE void EdgeBackgroundPackedUpdate(const uint8_t * value,
+            uint8_t * model, const __m256i & threshold, const __m256i & mask)
+        {
+            const __m256i _value = _mm256_permute4x64_epi64(Load<align>((__m256i*)value), 0xD8);
+            const __m256i _mask = _mm256_permute4x64_epi64(mask, 0xD8);
+            EdgeBackgroundPackedUpdate<align, masked, grow, increment, adjust>(model + 0 * A, _mm256_unpacklo_epi8(_value, _value), threshold, _mm256_unpacklo_epi8(_mask, _mask));
+            EdgeBackgroundPackedUpdate<align, masked, grow, increment, adjust>(model + 1 * A, _mm256_unpackhi_epi8(_value, _value), threshold, _mm256_unpackhi_epi8(_mask, _mask));
+        }
+
+        template <bool align, bool grow, bool increment, bool adjust> void EdgeBackgroundPackedUpdate(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * model, size_t modelStride, uint8_t threshold)
+        {
+            assert(width >= A);
+            if (align)
+                assert(Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride));
+
+            const __m256i _threshold = _mm256_set1_epi8((char)threshold);
+            size_t alignedWidth = AlignLo(width, A);
+            __m256i tailMask = SetMask<uint8_t>(0, A - width + alignedWidth, 0xFF);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < alignedWidth; col += A)
+                    EdgeBackgroundPackedUpdate<align, false, grow, increment, adjust>(value + col, model + 2 * col, _threshold, K_INV_ZERO);
+                if (alignedWidth != width)
+                    EdgeBackgroundPackedUpdate<false, true, grow, increment, adjust>(value + width - A, model + 2 * (width - A), _threshold, tailMask);
+                value += valueStride;
+                model += modelStride;
+            }
+        }
+
+        typedef void(*EdgeBackgroundPackedUpdatePtr)(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * model, size_t modelStride, uint8_t threshold);
+
+        template <bool align, bool grow, bool increment> EdgeBackgroundPackedUpdatePtr GetEdgeBackgroundPackedUpdate(int flags)
+        {
+            if (flags & SimdBackgroundUpdateAdjustRange)
+                return EdgeBackgroundPackedUpdate<align, grow, increment, true>;
+            else
+                return EdgeBackgroundPackedUpdate<align, grow, increment, false>;
+        }
+
+        template <bool align, bool grow> EdgeBackgroundPackedUpdatePtr GetEdgeBackgroundPackedUpdate(int flags)
+        {
+            if (flags & SimdBackgroundUpdateIncrementCount)
+                return GetEdgeBackgroundPackedUpdate<align, grow, true>(flags);
+            else
+                return GetEdgeBackgroundPackedUpdate<align, grow, false>(flags);
+        }
+
+        template <bool align> EdgeBackgroundPackedUpdatePtr GetEdgeBackgroundPackedUpdate(int flags)
+        {
+            if (flags & SimdBackgroundUpdateGrowRange)
+                return GetEdgeBackgroundPackedUpdate<align, true>(flags);
+            else
+                return GetEdgeBackgroundPackedUpdate<align, false>(flags);
+        }
+
+        void EdgeBackgroundPackedUpdate(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * model, size_t modelStride, uint8_t threshold, int flags)
+        {
+            if ((flags & (SimdBackgroundUpdateGrowRange | SimdBackgroundUpdateIncrementCount | SimdBackgroundUpdateAdjustRange)) == 0)
+                return;
+            EdgeBackgroundPackedUpdatePtr edgeBackgroundPackedUpdate;
+            if (Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride))
+                edgeBackgroundPackedUpdate = GetEdgeBackgroundPackedUpdate<true>(flags);
+            else
+                edgeBackgroundPackedUpdate = GetEdgeBackgroundPackedUpdate<false>(flags);
+            edgeBackgroundPackedUpdate(value, valueStride, width, height, model, modelStride, threshold);
+        }
+
+        SIMD_INLINE __m256i EdgeBackgroundPackedGrowRangeSlow(const __m256i & model, const __m256i & value, const __m256i & threshold)
+        {
+            return _mm256_adds_epu8(model, _mm256_and_si256(K16_0001, Greater8u(value, model)));
+        }
+
+        SIMD_INLINE __m256i EdgeBackgroundPackedShiftRange(const __m256i & model, const __m256i & value, const __m256i & threshold)
+        {
+            return _mm256_or_si256(_mm256_and_si256(value, K16_00FF), _mm256_and_si256(model, K16_FF00));
+        }
+
+        SIMD_INLINE __m256i EdgeBackgroundPackedAdjustRangeMasked(const __m256i & model, const __m256i & mask, const __m256i & threshold)
+        {
+            const __m256i adjusted = EdgeBackgroundPackedUpdate<false, false, true>(model, mask, threshold);
+            return _mm256_blendv_epi8(adjusted, _mm256_and_si256(model, K16_00FF), _mm256_cmpeq_epi8(mask, K_ZERO));
+        }
+
+        typedef __m256i(*EdgeBackgroundPackedKernelPtr)(const __m256i & model, const __m256i & value, const __m256i & threshold);
+
+        template <EdgeBackgroundPackedKernelPtr kernel, bool align> SIMD_INLINE void EdgeBackgroundPackedApply(uint8_t * model,
+            const __m256i & value, const __m256i & threshold, const __m256i & mask)
+        {
+            const __m256i _model = Load<align>((__m256i*)model);
+            Store<align>((__m256i*)model, _mm256_blendv_epi8(_model, kernel(_model, value, threshold), mask));
+        }
+
+        template <EdgeBackgroundPackedKernelPtr kernel, bool align, bool masked> SIMD_INLINE void EdgeBackgroundPackedApply(const uint8_t * value,
+            const uint8_t * mask, uint8_t * model, const __m256i & threshold, const __m256i & tailMask)
+        {
+            const __m256i _value = _mm256_permute4x64_epi64(Load<align>((__m256i*)value), 0xD8);
+            const __m256i pixelMask = masked ? _mm256_andnot_si256(_mm256_cmpeq_epi8(Load<align>((__m256i*)mask), K_ZERO), tailMask) : tailMask;
+            const __m256i _mask = _mm256_permute4x64_epi64(pixelMask, 0xD8);
+            EdgeBackgroundPackedApply<kernel, align>(model + 0 * A, _mm256_unpacklo_epi8(_value, _value), threshold, _mm256_unpacklo_epi8(_mask, _mask));
+            EdgeBackgroundPackedApply<kernel, align>(model + 1 * A, _mm256_unpackhi_epi8(_value, _value), threshold, _mm256_unpackhi_epi8(_mask, _mask));
+        }
+
+        template <EdgeBackgroundPackedKernelPtr kernel, bool align, bool masked> void EdgeBackgroundPackedApply(const uint8_t * value, size_t valueStride,
+            size_t width, size_t height, uint8_t * model, size_t modelStride, uint8_t threshold, const uint8_t * mask, size_t maskStride)
+        {
+            assert(width >= A);
+            if (align)
+                assert(Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride) && (!masked || (Aligned(mask) && Aligned(maskStride))));
+
+            const __m256i _threshold = _mm256_set1_epi8((char)threshold);
+            size_t alignedWidth = AlignLo(width, A);
+            __m256i tailMask = SetMask<uint8_t>(0, A - width + alignedWidth, 0xFF);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < alignedWidth; col += A)
+                    EdgeBackgroundPackedApply<kernel, align, masked>(value + col, mask + col, model + 2 * col, _threshold, K_INV_ZERO);
+                if (alignedWidth != width)
+                    EdgeBackgroundPackedApply<kernel, false, masked>(value + width - A, mask + width - A, model + 2 * (width - A), _threshold, tailMask);
+                value += valueStride;
+                model += modelStride;
+                mask += maskStride;
+            }
+        }
+
+        void EdgeBackgroundPackedGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
+        {
+            if (Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride))
+                EdgeBackgroundPackedApply<EdgeBackgroundPackedGrowRangeSlow, true, false>(value, valueStride, width, height, model, modelStride, 0, value, valueStride);
+            else
+                EdgeBackgroundPackedApply<EdgeBackgroundPackedGrowRangeSlow, false, false>(value, valueStride, width, height, model, modelStride, 0, value, valueStride);
+        }
+
+        void EdgeBackgroundPackedAdjustRangeMasked(uint8_t * model, size_t modelStride, size_t width, size_t height,
+            uint8_t threshold, const uint8_t * mask, size_t maskStride)
+        {
+            if (Aligned(model) && Aligned(modelStride) && Aligned(mask) && Aligned(maskStride))
+                EdgeBackgroundPackedApply<EdgeBackgroundPackedAdjustRangeMasked, true, false>(mask, maskStride, width, height, model, modelStride, threshold, mask, maskStride);
+            else
+                EdgeBackgroundPackedApply<EdgeBackgroundPackedAdjustRangeMasked, false, false>(mask, maskStride, width, height, model, modelStride, threshold, mask, maskStride);
+        }
+
+        void EdgeBackgroundPackedShiftRange(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
+        {
+            if (Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride))
+                EdgeBackgroundPackedApply<EdgeBackgroundPackedShiftRange, true, false>(value, valueStride, width, height, model, modelStride, 0, value, valueStride);
+            else
+                EdgeBackgroundPackedApply<EdgeBackgroundPackedShiftRange, false, false>(value, valueStride, width, height, model, modelStride, 0, value, valueStride);
+        }
+
+        void EdgeBackgroundPackedShiftRangeMasked(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * model, size_t modelStride, const uint8_t * mask, size_t maskStride)
+        {
+            if (Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride) && Aligned(mask) && Aligned(maskStride))
+                EdgeBackgroundPackedApply<EdgeBackgroundPackedShiftRange, true, true>(value, valueStride, width, height, model, modelStride, 0, mask, maskStride);
+            else
+                EdgeBackgroundPackedApply<EdgeBackgroundPackedShiftRange, false, true>(value, valueStride, width, height, model, modelStride, 0, mask, maskStride);
+        }
     }
 #endif// SIMD_AVX2_ENABLE
 }
@@ -0,0 +1,122 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        const __m256i K16_8081 = SIMD_MM256_SET1_EPI16(0x8081);
+
+        SIMD_INLINE __m256i DivideBy255(__m256i value)
+        {
+            return _mm256_srli_epi16(_mm256_mulhi_epu16(value, K16_8081), 7);
+        }
+
+        SIMD_INLINE void HueToBgr16(__m256i hue, __m256i min, __m256i max, __m256i bgr[3])
+        {
+            __m256i hue6 = _mm256_mullo_epi16(hue, K16_0006);
+            __m256i sector = DivideBy255(hue6);
+            __m256i delta = DivideBy255(_mm256_mullo_epi16(_mm256_sub_epi16(max, min), _mm256_sub_epi16(hue6, _mm256_mullo_epi16(sector, K16_00FF))));
+            __m256i rising = _mm256_add_epi16(min, delta);
+            __m256i falling = _mm256_sub_epi16(max, delta);
+            __m256i s0 = _mm256_or_si256(_mm256_cmpeq_epi16(sector, K_ZERO), _mm256_cmpeq_epi16(sector, K16_0006));
+            __m256i s1 = _mm256_cmpeq_epi16(sector, K16_0001);
+            __m256i s2 = _mm256_cmpeq_epi16(sector, K16_0002);
+            __m256i s3 = _mm256_cmpeq_epi16(sector, K16_0003);
+            __m256i s4 = _mm256_cmpeq_epi16(sector, K16_0004);
+            __m256i s5 = _mm256_cmpeq_epi16(sector, K16_0005);
+            bgr[0] = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_or_si256(s0, s1), min), _mm256_and_si256(s2, rising)),
+                _mm256_or_si256(_mm256_and_si256(_mm256_or_si256(s3, s4), max), _mm256_and_si256(s5, falling)));
+            bgr[1] = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(s0, rising), _mm256_and_si256(_mm256_or_si256(s1, s2), max)),
+                _mm256_or_si256(_mm256_and_si256(s3, falling), _mm256_and_si256(_mm256_or_si256(s4, s5), min)));
+            bgr[2] = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_or_si256(s0, s5), max), _mm256_and_si256(s1, falling)),
+                _mm256_or_si256(_mm256_and_si256(_mm256_or_si256(s2, s3), min), _mm256_and_si256(s4, rising)));
+        }
+
+        template<bool hsl, int part> SIMD_INLINE void HsxToBgr16(const __m256i hsx[3], __m256i bgr[3])
+        {
+            __m256i hue = UnpackU8<part>(hsx[0]);
+            __m256i saturation = UnpackU8<part>(hsx[1]);
+            __m256i max = UnpackU8<part>(hsx[2]);
+            if (hsl)
+            {
+                __m256i lightness = max;
+                __m256i dark = DivideBy255(_mm256_mullo_epi16(lightness, _mm256_add_epi16(K16_00FF, saturation)));
+                __m256i light = DivideBy255(_mm256_add_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(K16_00FF, lightness), saturation), _mm256_mullo_epi16(lightness, K16_00FF)));
+                max = _mm256_blendv_epi8(dark, light, _mm256_cmpgt_epi16(lightness, K16_0080));
+            }
+            __m256i min = DivideBy255(_mm256_mullo_epi16(_mm256_sub_epi16(K16_00FF, saturation), max));
+            HueToBgr16(hue, min, max, bgr);
+        }
+
+        template<bool hsl> SIMD_INLINE void HsxToBgr(const uint8_t * hsx, uint8_t * bgr)
+        {
+            __m256i src[3], planar[3], lo[3], hi[3];
+            src[0] = _mm256_loadu_si256((__m256i*)hsx + 0);
+            src[1] = _mm256_loadu_si256((__m256i*)hsx + 1);
+            src[2] = _mm256_loadu_si256((__m256i*)hsx + 2);
+            planar[0] = BgrToBlue(src);
+            planar[1] = BgrToGreen(src);
+            planar[2] = BgrToRed(src);
+            HsxToBgr16<hsl, 0>(planar, lo);
+            HsxToBgr16<hsl, 1>(planar, hi);
+            __m256i blue = _mm256_packus_epi16(lo[0], hi[0]);
+            __m256i green = _mm256_packus_epi16(lo[1], hi[1]);
+            __m256i red = _mm256_packus_epi16(lo[2], hi[2]);
+            _mm256_storeu_si256((__m256i*)bgr + 0, InterleaveBgr<0>(blue, green, red));
+            _mm256_storeu_si256((__m256i*)bgr + 1, InterleaveBgr<1>(blue, green, red));
+            _mm256_storeu_si256((__m256i*)bgr + 2, InterleaveBgr<2>(blue, green, red));
+        }
+
+        template<bool hsl> void HsxToBgr(const uint8_t * hsx, size_t width, size_t height, size_t hsxStride, uint8_t * bgr, size_t bgrStride)
+        {
+            assert(width >= A);
+
+            size_t widthA = AlignLo(width, A), tail = (width - A) * 3;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA * 3; col += A * 3)
+                    HsxToBgr<hsl>(hsx + col, bgr + col);
+                if (widthA < width)
+                    HsxToBgr<hsl>(hsx + tail, bgr + tail);
+                hsx += hsxStride;
+                bgr += bgrStride;
+            }
+        }
+
+        void HslToBgr(const uint8_t * hsl, size_t width, size_t height, size_t hslStride, uint8_t * bgr, size_t bgrStride)
+        {
+            HsxToBgr<true>(hsl, width, height, hslStride, bgr, bgrStride);
+        }
+
+        void HsvToBgr(const uint8_t * hsv, size_t width, size_t height, size_t hsvStride, uint8_t * bgr, size_t bgrStride)
+        {
+            HsxToBgr<false>(hsv, width, height, hsvStride, bgr, bgrStride);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
@@ -0,0 +1,301 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdLab.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        const __m256i K32_LAB_PACK = SIMD_MM256_SETR_EPI32(0, 4, 1, 5, 2, 6, 3, 7);
+
+        SIMD_INLINE __m256 LabCbrt(__m256 x)
+        {
+            __m256 k = _mm256_set1_ps(1.0f / 3.0f);
+            __m256i i = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_castps_si256(x)), k));
+            __m256 y = _mm256_castsi256_ps(_mm256_add_epi32(i, _mm256_set1_epi32(Base::LAB_CBRT_MAGIC)));
+            for (int n = 0; n < 3; ++n)
+                y = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(y, y), _mm256_div_ps(x, _mm256_mul_ps(y, y))), k);
+            return y;
+        }
+
+        SIMD_INLINE __m256 LabF(__m256 t)
+        {
+            __m256 linear = _mm256_add_ps(_mm256_mul_ps(t, _mm256_set1_ps(Base::LAB_SLOPE)), _mm256_set1_ps(Base::LAB_BIAS));
+            return _mm256_blendv_ps(linear, LabCbrt(t), _mm256_cmp_ps(t, _mm256_set1_ps(Base::LAB_T_THRESHOLD), _CMP_GT_OQ));
+        }
+
+        SIMD_INLINE __m256 LabFInv(__m256 f)
+        {
+            __m256 linear = _mm256_mul_ps(_mm256_sub_ps(f, _mm256_set1_ps(Base::LAB_BIAS)), _mm256_set1_ps(Base::LAB_SLOPE_INV));
+            return _mm256_blendv_ps(linear, _mm256_mul_ps(_mm256_mul_ps(f, f), f), _mm256_cmp_ps(f, _mm256_set1_ps(Base::LAB_F_THRESHOLD), _CMP_GT_OQ));
+        }
+
+        SIMD_INLINE __m256 Combine(__m256 a, __m256 b, __m256 c, float ka, float kb, float kc)
+        {
+            return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(a, _mm256_set1_ps(ka)), _mm256_mul_ps(b, _mm256_set1_ps(kb))), _mm256_mul_ps(c, _mm256_set1_ps(kc)));
+        }
+
+        template<int part> SIMD_INLINE __m256i LoadU8ToI32(__m256i value)
+        {
+            return _mm256_cvtepu8_epi32(_mm_srli_si128(_mm256_extracti128_si256(value, part >> 1), (part & 1) * 8));
+        }
+
+        template<int part> SIMD_INLINE void BgrToLab(__m256i blue, __m256i green, __m256i red, const float * decode, __m256 lab[3])
+        {
+            __m256 b = _mm256_i32gather_ps(decode, LoadU8ToI32<part>(blue), 4);
+            __m256 g = _mm256_i32gather_ps(decode, LoadU8ToI32<part>(green), 4);
+            __m256 r = _mm256_i32gather_ps(decode, LoadU8ToI32<part>(red), 4);
+            __m256 fx = LabF(Combine(r, g, b, Base::LAB_X_R, Base::LAB_X_G, Base::LAB_X_B));
+            __m256 fy = LabF(Combine(r, g, b, Base::LAB_Y_R, Base::LAB_Y_G, Base::LAB_Y_B));
+            __m256 fz = LabF(Combine(r, g, b, Base::LAB_Z_R, Base::LAB_Z_G, Base::LAB_Z_B));
+            lab[0] = _mm256_sub_ps(_mm256_mul_ps(fy, _mm256_set1_ps(Base::LAB_L_SCALE)), _mm256_set1_ps(Base::LAB_L_SHIFT));
+            lab[1] = _mm256_mul_ps(_mm256_sub_ps(fx, fy), _mm256_set1_ps(Base::LAB_A_SCALE));
+            lab[2] = _mm256_mul_ps(_mm256_sub_ps(fy, fz), _mm256_set1_ps(Base::LAB_B_SCALE));
+        }
+
+        SIMD_INLINE __m256i LabEncode(__m256 value, const float * encode)
+        {
+            value = _mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(value, _mm256_setzero_ps()), _mm256_set1_ps(1.0f)), _mm256_set1_ps(float(Base::LAB_GAMMA_SIZE)));
+            __m256i index = _mm256_min_epi32(_mm256_cvttps_epi32(value), _mm256_set1_epi32(Base::LAB_GAMMA_SIZE - 1));
+            __m256 lo = _mm256_i32gather_ps(encode, index, 4);
+            __m256 hi = _mm256_i32gather_ps(encode + 1, index, 4);
+            return _mm256_cvtps_epi32(_mm256_add_ps(lo, _mm256_mul_ps(_mm256_sub_ps(hi, lo), _mm256_sub_ps(value, _mm256_cvtepi32_ps(index)))));
+        }
+
+        SIMD_INLINE void LabToBgr(__m256 l, __m256 a, __m256 b, const float * encode, __m256i bgr[3])
+        {
+            __m256 fy = _mm256_mul_ps(_mm256_add_ps(l, _mm256_set1_ps(Base::LAB_L_SHIFT)), _mm256_set1_ps(Base::LAB_L_SCALE_INV));
+            __m256 fx = _mm256_add_ps(fy, _mm256_mul_ps(a, _mm256_set1_ps(Base::LAB_A_SCALE_INV)));
+            __m256 fz = _mm256_sub_ps(fy, _mm256_mul_ps(b, _mm256_set1_ps(Base::LAB_B_SCALE_INV)));
+            __m256 x = LabFInv(fx), y = LabFInv(fy), z = LabFInv(fz);
+            bgr[0] = LabEncode(Combine(x, y, z, Base::LAB_B_X, Base::LAB_B_Y, Base::LAB_B_Z), encode);
+            bgr[1] = LabEncode(Combine(x, y, z, Base::LAB_G_X, Base::LAB_G_Y, Base::LAB_G_Z), encode);
+            bgr[2] = LabEncode(Combine(x, y, z, Base::LAB_R_X, Base::LAB_R_Y, Base::LAB_R_Z), encode);
+        }
+
+        SIMD_INLINE __m256i PackI32ToU8(const __m256i src[4])
+        {
+            __m256i u8 = _mm256_packus_epi16(_mm256_packs_epi32(src[0], src[1]), _mm256_packs_epi32(src[2], src[3]));
+            return _mm256_permutevar8x32_epi32(u8, K32_LAB_PACK);
+        }
+
+        SIMD_INLINE void StoreBgr(const __m256i blue[4], const __m256i green[4], const __m256i red[4], uint8_t * dst)
+        {
+            __m256i b = PackI32ToU8(blue), g = PackI32ToU8(green), r = PackI32ToU8(red);
+            _mm256_storeu_si256((__m256i*)dst + 0, InterleaveBgr<0>(b, g, r));
+            _mm256_storeu_si256((__m256i*)dst + 1, InterleaveBgr<1>(b, g, r));
+            _mm256_storeu_si256((__m256i*)dst + 2, InterleaveBgr<2>(b, g, r));
+        }
+
+        SIMD_INLINE void LoadBgr(const uint8_t * src, __m256i & blue, __m256i & green, __m256i & red)
+        {
+            __m256i _src[3];
+            _src[0] = _mm256_loadu_si256((__m256i*)src + 0);
+            _src[1] = _mm256_loadu_si256((__m256i*)src + 1);
+            _src[2] = _mm256_loadu_si256((__m256i*)src + 2);
+            blue = BgrToBlue(_src);
+            green = BgrToGreen(_src);
+            red = BgrToRed(_src);
+        }
+
+        SIMD_INLINE void LoadLab32f(const float * src, __m256 lab[3])
+        {
+            __m128 lo[3], hi[3];
+            Sse41::LoadLab32f(src + 0, lo);
+            Sse41::LoadLab32f(src + 12, hi);
+            for (size_t c = 0; c < 3; ++c)
+                lab[c] = _mm256_insertf128_ps(_mm256_castps128_ps256(lo[c]), hi[c], 1);
+        }
+
+        SIMD_INLINE void StoreLab32f(const __m256 lab[3], float * dst)
+        {
+            __m128 lo[3], hi[3];
+            for (size_t c = 0; c < 3; ++c)
+            {
+                lo[c] = _mm256_castps256_ps128(lab[c]);
+                hi[c] = _mm256_extractf128_ps(lab[c], 1);
+            }
+            Sse41::StoreLab32f(lo, dst + 0);
+            Sse41::StoreLab32f(hi, dst + 12);
+        }
+
+        //---------------------------------------------------------------------
+
+        template<int part> SIMD_INLINE void BgrToLab(__m256i blue, __m256i green, __m256i red, const float * decode, __m256i l[4], __m256i a[4], __m256i b[4])
+        {
+            __m256 lab[3];
+            BgrToLab<part>(blue, green, red, decode, lab);
+            l[part] = _mm256_cvtps_epi32(_mm256_mul_ps(lab[0], _mm256_set1_ps(Base::LAB_L_TO_8U)));
+            a[part] = _mm256_cvtps_epi32(_mm256_add_ps(lab[1], _mm256_set1_ps(Base::LAB_AB_SHIFT)));
+            b[part] = _mm256_cvtps_epi32(_mm256_add_ps(lab[2], _mm256_set1_ps(Base::LAB_AB_SHIFT)));
+        }
+
+        SIMD_INLINE void BgrToLab(const uint8_t * bgr, const float * decode, uint8_t * lab)
+        {
+            __m256i blue, green, red, l[4], a[4], b[4];
+            LoadBgr(bgr, blue, green, red);
+            BgrToLab<0>(blue, green, red, decode, l, a, b);
+            BgrToLab<1>(blue, green, red, decode, l, a, b);
+            BgrToLab<2>(blue, green, red, decode, l, a, b);
+            BgrToLab<3>(blue, green, red, decode, l, a, b);
+            StoreBgr(l, a, b, lab);
+        }
+
+        void BgrToLab(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * lab, size_t labStride)
+        {
+            assert(width >= A);
+
+            const float * decode = Base::GetLabGamma().decode;
+            size_t widthA = AlignLo(width, A), tail = (width - A) * 3;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA * 3; col += A * 3)
+                    BgrToLab(bgr + col, decode, lab + col);
+                if (widthA < width)
+                    BgrToLab(bgr + tail, decode, lab + tail);
+                bgr += bgrStride;
+                lab += labStride;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        template<int part> SIMD_INLINE void BgrToLab32f(__m256i blue, __m256i green, __m256i red, const float * decode, float * lab)
+        {
+            __m256 _lab[3];
+            BgrToLab<part>(blue, green, red, decode, _lab);
+            StoreLab32f(_lab, lab + part * F * 3);
+        }
+
+        SIMD_INLINE void BgrToLab32f(const uint8_t * bgr, const float * decode, float * lab)
+        {
+            __m256i blue, green, red;
+            LoadBgr(bgr, blue, green, red);
+            BgrToLab32f<0>(blue, green, red, decode, lab);
+            BgrToLab32f<1>(blue, green, red, decode, lab);
+            BgrToLab32f<2>(blue, green, red, decode, lab);
+            BgrToLab32f<3>(blue, green, red, decode, lab);
+        }
+
+        void BgrToLab32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * lab, size_t labStride)
+        {
+            assert(width >= A);
+
+            const float * decode = Base::GetLabGamma().decode;
+            size_t widthA = AlignLo(width, A), tail = (width - A) * 3;
+            for (size_t row = 0; row < height; ++row)
+            {
+                float * pLab = (float*)lab;
+                for (size_t col = 0; col < widthA * 3; col += A * 3)
+                    BgrToLab32f(bgr + col, decode, pLab + col);
+                if (widthA < width)
+                    BgrToLab32f(bgr + tail, decode, pLab + tail);
+                bgr += bgrStride;
+                lab += labStride;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        template<int part> SIMD_INLINE void LabToBgr(__m256i l, __m256i a, __m256i b, const float * encode, __m256i blue[4], __m256i green[4], __m256i red[4])
+        {
+            __m256 _l = _mm256_mul_ps(_mm256_cvtepi32_ps(LoadU8ToI32<part>(l)), _mm256_set1_ps(Base::LAB_8U_TO_L));
+            __m256 _a = _mm256_sub_ps(_mm256_cvtepi32_ps(LoadU8ToI32<part>(a)), _mm256_set1_ps(Base::LAB_AB_SHIFT));
+            __m256 _b = _mm256_sub_ps(_mm256_cvtepi32_ps(LoadU8ToI32<part>(b)), _mm256_set1_ps(Base::LAB_AB_SHIFT));
+            __m256i bgr[3];
+            LabToBgr(_l, _a, _b, encode, bgr);
+            blue[part] = bgr[0];
+            green[part] = bgr[1];
+            red[part] = bgr[2];
+        }
+
+        SIMD_INLINE void LabToBgr(const uint8_t * lab, const float * encode, uint8_t * bgr)
+        {
+            __m256i l, a, b, blue[4], green[4], red[4];
+            LoadBgr(lab, l, a, b);
+            LabToBgr<0>(l, a, b, encode, blue, green, red);
+            LabToBgr<1>(l, a, b, encode, blue, green, red);
+            LabToBgr<2>(l, a, b, encode, blue, green, red);
+            LabToBgr<3>(l, a, b, encode, blue, green, red);
+            StoreBgr(blue, green, red, bgr);
+        }
+
+        void LabToBgr(const uint8_t * lab, size_t width, size_t height, size_t labStride, uint8_t * bgr, size_t bgrStride)
+        {
+            assert(width >= A);
+
+            const float * encode = Base::GetLabGamma().encode;
+            size_t widthA = AlignLo(width, A), tail = (width - A) * 3;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA * 3; col += A * 3)
+                    LabToBgr(lab + col, encode, bgr + col);
+                if (widthA < width)
+                    LabToBgr(lab + tail, encode, bgr + tail);
+                lab += labStride;
+                bgr += bgrStride;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void Lab32fToBgr(const float * lab, const float * encode, uint8_t * bgr)
+        {
+            __m256i blue[4], green[4], red[4];
+            for (size_t i = 0; i < 4; ++i)
+            {
+                __m256 _lab[3];
+                __m256i _bgr[3];
+                LoadLab32f(lab + i * F * 3, _lab);
+                LabToBgr(_lab[0], _lab[1], _lab[2], encode, _bgr);
+                blue[i] = _bgr[0];
+                green[i] = _bgr[1];
+                red[i] = _bgr[2];
+            }
+            StoreBgr(blue, green, red, bgr);
+        }
+
+        void Lab32fToBgr(const uint8_t * lab, size_t width, size_t height, size_t labStride, uint8_t * bgr, size_t bgrStride)
+        {
+            assert(width >= A);
+
+            const float * encode = Base::GetLabGamma().encode;
+            size_t widthA = AlignLo(width, A), tail = (width - A) * 3;
+            for (size_t row = 0; row < height; ++row)
+            {
+                const float * pLab = (const float*)lab;
+                for (size_t col = 0; col < widthA * 3; col += A * 3)
+                    Lab32fToBgr(pLab + col, encode, bgr + col);
+                if (widthA < width)
+                    Lab32fToBgr(pLab + tail, encode, bgr + tail);
+                lab += labStride;
+                bgr += bgrStride;
+            }
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
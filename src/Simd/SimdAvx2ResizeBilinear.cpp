@@ -93,13 +93,13 @@ namespace Simd
             };
         }
 
-        template <size_t channelCount> void EstimateAlphaIndexX(size_t srcSize, size_t dstSize, int * indexes, uint8_t * alphas)
+        template <size_t channelCount> void EstimateAlphaIndexX(size_t srcSize, size_t dstSize, int * indexes, uint8_t * alphas, float site)
         {
             float scale = (float)srcSize / dstSize;
 
             for (size_t i = 0; i < dstSize; ++i)
             {
-                float alpha = (float)((i + 0.5)*scale - 0.5);
+                float alpha = (float)((i + (double)site)*scale - site);
                 ptrdiff_t index = (ptrdiff_t)::floor(alpha);
                 alpha -= index;
 
@@ -129,7 +129,7 @@ namespace Simd
             return (size_t)Simd::Max(::ceil(float(src) / (A - 1)), ::ceil(float(dst) / HA));
         }
 
-        void EstimateAlphaIndexX(int srcSize, int dstSize, Index * indexes, uint8_t * alphas, size_t & blockCount)
+        void EstimateAlphaIndexX(int srcSize, int dstSize, Index * indexes, uint8_t * alphas, size_t & blockCount, float site)
         {
             float scale = (float)srcSize / dstSize;
             int block = 0;
@@ -137,7 +137,7 @@ namespace Simd
             indexes[0].dst = 0;
             for (int dstIndex = 0; dstIndex < dstSize; ++dstIndex)
             {
-                float alpha = (float)((dstIndex + 0.5)*scale - 0.5);
+                float alpha = (float)((dstIndex + (double)site)*scale - site);
                 int srcIndex = (int)::floor(alpha);
                 alpha -= srcIndex;
 
@@ -278,7 +278,7 @@ namespace Simd
 
         template <size_t channelCount> void ResizeBilinear(
             const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
-            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
+            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, float siteX, size_t dstRowBeg, size_t dstRowEnd)
         {
             assert(dstWidth >= A);
 
@@ -292,15 +292,17 @@ namespace Simd
 
             Buffer buffer(bufferSize, dstWidth, dstHeight);
 
-            Base::EstimateAlphaIndex(srcHeight, dstHeight, buffer.iy, buffer.ay, 1);
+            Base::EstimateAlphaIndex(srcHeight, dstHeight, buffer.iy, buffer.ay, 1, 0.5f);
 
-            EstimateAlphaIndexX<channelCount>(srcWidth, dstWidth, buffer.ix, buffer.ax);
+            EstimateAlphaIndexX<channelCount>(srcWidth, dstWidth, buffer.ix, buffer.ax, siteX);
 
             ptrdiff_t previous = -2;
 
             __m256i a[2];
 
-            for (size_t yDst = 0; yDst < dstHeight; yDst++, dst += dstStride)
+            dst += dstRowBeg*dstStride;
+
+            for (size_t yDst = dstRowBeg; yDst < dstRowEnd; yDst++, dst += dstStride)
             {
                 a[0] = _mm256_set1_epi16(int16_t(Base::FRACTION_RANGE - buffer.ay[yDst]));
                 a[1] = _mm256_set1_epi16(int16_t(buffer.ay[yDst]));
@@ -366,7 +368,7 @@ namespace Simd
             _mm256_storeu_si256((__m256i*)(dst + index.dst), _mm256_maddubs_epi16(Shuffle(_src, _shuffle), _alpha));
         }
 
-        void ResizeBilinearGray(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
+        void ResizeBilinearGray(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, float siteX, size_t dstRowBeg, size_t dstRowEnd)
         {
             assert(dstWidth >= A);
 
@@ -377,15 +379,17 @@ namespace Simd
 
             BufferG buffer(bufferWidth, blockCount, dstHeight);
 
-            Base::EstimateAlphaIndex(srcHeight, dstHeight, buffer.iy, buffer.ay, 1);
+            Base::EstimateAlphaIndex(srcHeight, dstHeight, buffer.iy, buffer.ay, 1, 0.5f);
 
-            EstimateAlphaIndexX((int)srcWidth, (int)dstWidth, buffer.ix, buffer.ax, blockCount);
+            EstimateAlphaIndexX((int)srcWidth, (int)dstWidth, buffer.ix, buffer.ax, blockCount, siteX);
 
             ptrdiff_t previous = -2;
 
             __m256i a[2];
 
-            for (size_t yDst = 0; yDst < dstHeight; yDst++, dst += dstStride)
+            dst += dstRowBeg*dstStride;
+
+            for (size_t yDst = dstRowBeg; yDst < dstRowEnd; yDst++, dst += dstStride)
             {
                 a[0] = _mm256_set1_epi16(int16_t(Base::FRACTION_RANGE - buffer.ay[yDst]));
                 a[1] = _mm256_set1_epi16(int16_t(buffer.ay[yDst]));
@@ -418,31 +422,38 @@ namespace Simd
             }
         }
 
-        void ResizeBilinear(
+        void ResizeBilinearRows(
             const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
-            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
+            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount, float siteX, size_t dstRowBeg, size_t dstRowEnd)
         {
             switch (channelCount)
             {
             case 1:
                 if (srcWidth >= A && srcWidth < 4 * dstWidth)
-                    ResizeBilinearGray(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                    ResizeBilinearGray(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, siteX, dstRowBeg, dstRowEnd);
                 else
-                    ResizeBilinear<1>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                    ResizeBilinear<1>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, siteX, dstRowBeg, dstRowEnd);
                 break;
             case 2:
-                ResizeBilinear<2>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                ResizeBilinear<2>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, siteX, dstRowBeg, dstRowEnd);
                 break;
             case 3:
-                ResizeBilinear<3>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                ResizeBilinear<3>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, siteX, dstRowBeg, dstRowEnd);
                 break;
             case 4:
-                ResizeBilinear<4>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                ResizeBilinear<4>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, siteX, dstRowBeg, dstRowEnd);
                 break;
             default:
-                Base::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
+                Base::ResizeBilinearRows(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount, siteX, dstRowBeg, dstRowEnd);
             }
         }
+
+        void ResizeBilinear(
+            const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
+        {
+            ResizeBilinearRows(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount, 0.5f, 0, dstHeight);
+        }
     }
 #endif//SIMD_AVX2_ENABLE
 }
@@ -24,6 +24,7 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
 #include "Simd/SimdCompare.h"
+#include "Simd/SimdSegmentation.h"
 
 namespace Simd
 {
@@ -277,6 +278,53 @@ namespace Simd
                 }
             }
         }
+
+        template<SimdCompareType compareType> size_t SegmentationRowEdges(const uint8_t * mask, size_t width, uint8_t value, uint32_t * edges)
+        {
+            const __m256i _value = _mm256_set1_epi8(value);
+            size_t widthDA = AlignLo(width, DA), widthA = AlignLo(width, A), col = 0, count = 0;
+            uint64_t last = 0;
+            for (; col < widthDA; col += DA)
+            {
+                uint64_t bits0 = (uint32_t)_mm256_movemask_epi8(Compare8u<compareType>(_mm256_loadu_si256((__m256i*)(mask + col + 0)), _value));
+                uint64_t bits1 = (uint32_t)_mm256_movemask_epi8(Compare8u<compareType>(_mm256_loadu_si256((__m256i*)(mask + col + A)), _value));
+                Base::SegmentationMaskToEdges(bits0 | (bits1 << 32), DA, (uint32_t)col, last, edges, count);
+            }
+            for (; col < widthA; col += A)
+            {
+                uint64_t bits = (uint32_t)_mm256_movemask_epi8(Compare8u<compareType>(_mm256_loadu_si256((__m256i*)(mask + col)), _value));
+                Base::SegmentationMaskToEdges(bits, A, (uint32_t)col, last, edges, count);
+            }
+            if (col < width)
+            {
+                uint64_t bits = 0;
+                for (size_t i = 0, n = width - col; i < n; ++i)
+                    bits |= uint64_t(Base::Compare8u<compareType>(mask[col + i], value)) << i;
+                Base::SegmentationMaskToEdges(bits, width - col, (uint32_t)col, last, edges, count);
+            }
+            if (last)
+                edges[count++] = (uint32_t)width;
+            return count;
+        }
+
+        size_t SegmentationLabelComponents(const uint8_t * mask, size_t maskStride, size_t width, size_t height, SimdCompareType compareType, uint8_t value,
+            int connectivity, uint32_t * labels, size_t labelsStride, SimdConnectedComponent * components, size_t capacity)
+        {
+            Base::SegmentationRowEdgesPtr rowEdges = NULL;
+            switch (compareType)
+            {
+            case SimdCompareEqual: rowEdges = SegmentationRowEdges<SimdCompareEqual>; break;
+            case SimdCompareNotEqual: rowEdges = SegmentationRowEdges<SimdCompareNotEqual>; break;
+            case SimdCompareGreater: rowEdges = SegmentationRowEdges<SimdCompareGreater>; break;
+            case SimdCompareGreaterOrEqual: rowEdges = SegmentationRowEdges<SimdCompareGreaterOrEqual>; break;
+            case SimdCompareLesser: rowEdges = SegmentationRowEdges<SimdCompareLesser>; break;
+            case SimdCompareLesserOrEqual: rowEdges = SegmentationRowEdges<SimdCompareLesserOrEqual>; break;
+            default:
+                assert(0);
+                return 0;
+            }
+            return Base::SegmentationLabelComponents(mask, maskStride, width, height, value, connectivity, labels, labelsStride, components, capacity, rowEdges);
+        }
     }
 #endif//SIMD_AVX2_ENABLE
 }
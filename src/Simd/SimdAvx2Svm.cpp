@@ -0,0 +1,48 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSvm.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        Svm::Svm(const float * svs, const float * weights, size_t length, size_t count, const float * bias, SimdSvmKernelType kernel, const float * params)
+            : Base::Svm(svs, weights, length, count, bias, kernel, params)
+        {
+            _gemm = Avx2::Gemm32fNN;
+            _productSum = Avx2::NeuralProductSum;
+            _mathFunction = Avx2::MathFunction32f;
+        }
+
+        void * SvmInit(const float * svs, const float * weights, size_t length, size_t count, const float * bias, SimdSvmKernelType kernel, const float * params)
+        {
+            if (!Base::SvmValid(svs, weights, length, count, kernel, params))
+                return NULL;
+            return new Svm(svs, weights, length, count, bias, kernel, params);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
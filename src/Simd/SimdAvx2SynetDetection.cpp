@@ -0,0 +1,94 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdExp.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m256 SynetDetectionDecode32f(const __m256 & loc, const __m256 & prior, const __m256 & variance, const __m256 & sign, Exp & exp)
+        {
+            __m256 lo = _mm256_shuffle_ps(prior, prior, 0x44);
+            __m256 hi = _mm256_shuffle_ps(prior, prior, 0xEE);
+            __m256 size = _mm256_sub_ps(hi, lo);
+            __m256 center = _mm256_mul_ps(_mm256_add_ps(lo, hi), _mm256_set1_ps(0.5f));
+            __m256 delta = _mm256_mul_ps(variance, loc);
+            center = _mm256_fmadd_ps(_mm256_shuffle_ps(delta, delta, 0x44), size, center);
+            size = _mm256_mul_ps(exp.Exponent(_mm256_shuffle_ps(delta, delta, 0xEE)), size);
+            return _mm256_fmadd_ps(size, sign, center);
+        }
+
+        void SynetDetectionDecode32f(const float * loc, const float * prior, size_t count, float * dst)
+        {
+            const float * variance = prior + count * 4;
+            __m256 sign = _mm256_setr_ps(-0.5f, -0.5f, 0.5f, 0.5f, -0.5f, -0.5f, 0.5f, 0.5f);
+            Exp exp;
+            size_t size = count * 4, sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+                _mm256_storeu_ps(dst + i, SynetDetectionDecode32f(_mm256_loadu_ps(loc + i), _mm256_loadu_ps(prior + i), _mm256_loadu_ps(variance + i), sign, exp));
+            if (i < size)
+            {
+                __m256i mask = _mm256_setr_epi32(-1, -1, -1, -1, 0, 0, 0, 0);
+                __m256 _loc = _mm256_maskload_ps(loc + i, mask);
+                __m256 _prior = _mm256_maskload_ps(prior + i, mask);
+                __m256 _variance = _mm256_maskload_ps(variance + i, mask);
+                _mm256_maskstore_ps(dst + i, mask, SynetDetectionDecode32f(_loc, _prior, _variance, sign, exp));
+            }
+        }
+
+        void SynetDetectionSuppress(const float * boxes, size_t current, size_t end, float threshold, uint32_t * suppressed)
+        {
+            const float * xMin = boxes, *yMin = xMin + end, *xMax = yMin + end, *yMax = xMax + end, *area = yMax + end;
+            __m256 _xMin = _mm256_set1_ps(xMin[current]);
+            __m256 _yMin = _mm256_set1_ps(yMin[current]);
+            __m256 _xMax = _mm256_set1_ps(xMax[current]);
+            __m256 _yMax = _mm256_set1_ps(yMax[current]);
+            __m256 _area = _mm256_set1_ps(area[current]);
+            __m256 _threshold = _mm256_set1_ps(threshold);
+            size_t i = current + 1, endF = i + AlignLo(end - i, F);
+            for (; i < endF; i += F)
+            {
+                __m256 w = _mm256_max_ps(_mm256_sub_ps(_mm256_min_ps(_xMax, _mm256_loadu_ps(xMax + i)), _mm256_max_ps(_xMin, _mm256_loadu_ps(xMin + i))), _mm256_setzero_ps());
+                __m256 h = _mm256_max_ps(_mm256_sub_ps(_mm256_min_ps(_yMax, _mm256_loadu_ps(yMax + i)), _mm256_max_ps(_yMin, _mm256_loadu_ps(yMin + i))), _mm256_setzero_ps());
+                __m256 intersection = _mm256_mul_ps(w, h);
+                __m256 junction = _mm256_sub_ps(_mm256_add_ps(_area, _mm256_loadu_ps(area + i)), intersection);
+                __m256 mask = _mm256_cmp_ps(intersection, _mm256_mul_ps(_threshold, junction), _CMP_GT_OQ);
+                float * dst = (float*)(suppressed + i);
+                _mm256_storeu_ps(dst, _mm256_or_ps(_mm256_loadu_ps(dst), mask));
+            }
+            if (i < end)
+                Base::SynetDetectionSuppress(boxes, current, i, end, threshold, suppressed);
+        }
+
+        size_t SynetDetectionNms32f(const float * boxes, const float * scores, size_t count, size_t classes, ptrdiff_t background, float scoreThreshold,
+            float nmsThreshold, size_t topK, size_t keepTopK, SimdBool classAware, float * dst)
+        {
+            return Base::SynetDetectionNms32f(boxes, scores, count, classes, background, scoreThreshold, nmsThreshold, topK, keepTopK, classAware, dst, SynetDetectionSuppress);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
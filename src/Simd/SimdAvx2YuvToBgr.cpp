@@ -30,22 +30,22 @@ namespace Simd
 #ifdef SIMD_AVX2_ENABLE    
     namespace Avx2
     {
-        template <bool align> SIMD_INLINE void YuvToBgr(__m256i y, __m256i u, __m256i v, __m256i * bgr)
+        template <bool align, class T = Base::Bt601> SIMD_INLINE void YuvToBgr(__m256i y, __m256i u, __m256i v, __m256i * bgr)
         {
-            __m256i blue = YuvToBlue(y, u);
-            __m256i green = YuvToGreen(y, u, v);
-            __m256i red = YuvToRed(y, v);
+            __m256i blue = YuvToBlue<T>(y, u);
+            __m256i green = YuvToGreen<T>(y, u, v);
+            __m256i red = YuvToRed<T>(y, v);
             Store<align>(bgr + 0, InterleaveBgr<0>(blue, green, red));
             Store<align>(bgr + 1, InterleaveBgr<1>(blue, green, red));
             Store<align>(bgr + 2, InterleaveBgr<2>(blue, green, red));
         }
 
-        template <bool align> SIMD_INLINE void Yuv444pToBgr(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * bgr)
+        template <bool align, class T = Base::Bt601> SIMD_INLINE void Yuv444pToBgr(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * bgr)
         {
-            YuvToBgr<align>(Load<align>((__m256i*)y), Load<align>((__m256i*)u), Load<align>((__m256i*)v), (__m256i*)bgr);
+            YuvToBgr<align, T>(Load<align>((__m256i*)y), Load<align>((__m256i*)u), Load<align>((__m256i*)v), (__m256i*)bgr);
         }
 
-        template <bool align> void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <bool align, class T = Base::Bt601> void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             assert(width >= A);
@@ -62,12 +62,12 @@ namespace Simd
             {
                 for (size_t colYuv = 0, colBgr = 0; colYuv < bodyWidth; colYuv += A, colBgr += A3)
                 {
-                    Yuv444pToBgr<align>(y + colYuv, u + colYuv, v + colYuv, bgr + colBgr);
+                    Yuv444pToBgr<align, T>(y + colYuv, u + colYuv, v + colYuv, bgr + colBgr);
                 }
                 if (tail)
                 {
                     size_t col = width - A;
-                    Yuv444pToBgr<false>(y + col, u + col, v + col, bgr + 3 * col);
+                    Yuv444pToBgr<false, T>(y + col, u + col, v + col, bgr + 3 * col);
                 }
                 y += yStride;
                 u += uStride;
@@ -76,28 +76,55 @@ namespace Simd
             }
         }
 
-        void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
-                Yuv444pToBgr<true>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv444pToBgr<true, T>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
             else
-                Yuv444pToBgr<false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv444pToBgr<false, T>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Yuv444pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv444pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv444pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Yuv444pToBgr<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Yuv444pToBgr<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt601Full: Yuv444pToBgr<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Yuv444pToBgr<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Yuv444pToBgr<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            default: assert(0);
+            }
         }
 
-        template <bool align> SIMD_INLINE void Yuv422pToBgr(const uint8_t * y, const __m256i & u, const __m256i & v, uint8_t * bgr)
+        void Yuv444pToRgb(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
         {
-            YuvToBgr<align>(Load<align>((__m256i*)y + 0), _mm256_unpacklo_epi8(u, u), _mm256_unpacklo_epi8(v, v), (__m256i*)bgr + 0);
-            YuvToBgr<align>(Load<align>((__m256i*)y + 1), _mm256_unpackhi_epi8(u, u), _mm256_unpackhi_epi8(v, v), (__m256i*)bgr + 3);
+            Yuv444pToBgr<Base::Rgb<Base::Bt601>>(y, yStride, v, vStride, u, uStride, width, height, rgb, rgbStride);
         }
 
-        template <bool align> SIMD_INLINE void Yuv422pToBgr(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * bgr)
+        template <bool align, class T = Base::Bt601> SIMD_INLINE void Yuv422pToBgr(const uint8_t * y, const __m256i & u, const __m256i & v, uint8_t * bgr)
         {
-            Yuv422pToBgr<align>(y, LoadPermuted<align>((__m256i*)u), LoadPermuted<align>((__m256i*)v), bgr);
+            YuvToBgr<align, T>(Load<align>((__m256i*)y + 0), _mm256_unpacklo_epi8(u, u), _mm256_unpacklo_epi8(v, v), (__m256i*)bgr + 0);
+            YuvToBgr<align, T>(Load<align>((__m256i*)y + 1), _mm256_unpackhi_epi8(u, u), _mm256_unpackhi_epi8(v, v), (__m256i*)bgr + 3);
         }
 
-        template <bool align> void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <bool align, class T = Base::Bt601> SIMD_INLINE void Yuv422pToBgr(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * bgr)
+        {
+            Yuv422pToBgr<align, T>(y, LoadPermuted<align>((__m256i*)u), LoadPermuted<align>((__m256i*)v), bgr);
+        }
+
+        template <bool align, class T = Base::Bt601> void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             assert((width % 2 == 0) && (width >= DA));
@@ -113,11 +140,11 @@ namespace Simd
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t colUV = 0, colY = 0, colBgr = 0; colY < bodyWidth; colY += DA, colUV += A, colBgr += A6)
-                    Yuv422pToBgr<align>(y + colY, u + colUV, v + colUV, bgr + colBgr);
+                    Yuv422pToBgr<align, T>(y + colY, u + colUV, v + colUV, bgr + colBgr);
                 if (tail)
                 {
                     size_t offset = width - DA;
-                    Yuv422pToBgr<false>(y + offset, u + offset / 2, v + offset / 2, bgr + 3 * offset);
+                    Yuv422pToBgr<false, T>(y + offset, u + offset / 2, v + offset / 2, bgr + 3 * offset);
                 }
                 y += yStride;
                 u += uStride;
@@ -126,17 +153,44 @@ namespace Simd
             }
         }
 
-        void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
-                Yuv422pToBgr<true>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv422pToBgr<true, T>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
             else
-                Yuv422pToBgr<false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv422pToBgr<false, T>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Yuv422pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv422pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv422pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Yuv422pToBgr<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Yuv422pToBgr<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt601Full: Yuv422pToBgr<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Yuv422pToBgr<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Yuv422pToBgr<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            default: assert(0);
+            }
+        }
+
+        void Yuv422pToRgb(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+        {
+            Yuv422pToBgr<Base::Rgb<Base::Bt601>>(y, yStride, v, vStride, u, uStride, width, height, rgb, rgbStride);
         }
 
-        template <bool align> void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <bool align, class T = Base::Bt601> void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
@@ -155,16 +209,16 @@ namespace Simd
                 {
                     __m256i u_ = LoadPermuted<align>((__m256i*)(u + colUV));
                     __m256i v_ = LoadPermuted<align>((__m256i*)(v + colUV));
-                    Yuv422pToBgr<align>(y + colY, u_, v_, bgr + colBgr);
-                    Yuv422pToBgr<align>(y + colY + yStride, u_, v_, bgr + colBgr + bgrStride);
+                    Yuv422pToBgr<align, T>(y + colY, u_, v_, bgr + colBgr);
+                    Yuv422pToBgr<align, T>(y + colY + yStride, u_, v_, bgr + colBgr + bgrStride);
                 }
                 if (tail)
                 {
                     size_t offset = width - DA;
                     __m256i u_ = LoadPermuted<false>((__m256i*)(u + offset / 2));
                     __m256i v_ = LoadPermuted<false>((__m256i*)(v + offset / 2));
-                    Yuv422pToBgr<false>(y + offset, u_, v_, bgr + 3 * offset);
-                    Yuv422pToBgr<false>(y + offset + yStride, u_, v_, bgr + 3 * offset + bgrStride);
+                    Yuv422pToBgr<false, T>(y + offset, u_, v_, bgr + 3 * offset);
+                    Yuv422pToBgr<false, T>(y + offset + yStride, u_, v_, bgr + 3 * offset + bgrStride);
                 }
                 y += 2 * yStride;
                 u += uStride;
@@ -173,14 +227,128 @@ namespace Simd
             }
         }
 
-        void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
-                Yuv420pToBgr<true>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv420pToBgr<true, T>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+            else
+                Yuv420pToBgr<false, T>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Yuv420pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv420pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Yuv420pToBgr<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Yuv420pToBgr<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt601Full: Yuv420pToBgr<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Yuv420pToBgr<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Yuv420pToBgr<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            default: assert(0);
+            }
+        }
+
+        void Yuv420pToRgb(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+        {
+            Yuv420pToBgr<Base::Rgb<Base::Bt601>>(y, yStride, v, vStride, u, uStride, width, height, rgb, rgbStride);
+        }
+
+        template <bool align, bool nv21, class T> void Nv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
+            if (align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride));
+                assert(Aligned(bgr) && Aligned(bgrStride));
+            }
+
+            size_t bodyWidth = AlignLo(width, DA);
+            size_t tail = width - bodyWidth;
+            size_t A6 = A * 6;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0, colBgr = 0; colY < bodyWidth; colY += DA, colBgr += A6)
+                {
+                    __m256i u_, v_;
+                    LoadPermutedUv<align, nv21>(uv + colY, u_, v_);
+                    Yuv422pToBgr<align, T>(y + colY, u_, v_, bgr + colBgr);
+                    Yuv422pToBgr<align, T>(y + colY + yStride, u_, v_, bgr + colBgr + bgrStride);
+                }
+                if (tail)
+                {
+                    size_t offset = width - DA;
+                    __m256i u_, v_;
+                    LoadPermutedUv<false, nv21>(uv + offset, u_, v_);
+                    Yuv422pToBgr<false, T>(y + offset, u_, v_, bgr + 3 * offset);
+                    Yuv422pToBgr<false, T>(y + offset + yStride, u_, v_, bgr + 3 * offset + bgrStride);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                bgr += 2 * bgrStride;
+            }
+        }
+
+        template <bool nv21, class T> void Nv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(bgr) && Aligned(bgrStride))
+                Nv12ToBgr<true, nv21, T>(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
             else
-                Yuv420pToBgr<false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Nv12ToBgr<false, nv21, T>(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+        }
+
+        void Nv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Nv12ToBgr<false, Base::Bt601>(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+        }
+
+        void Nv12ToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToBgr<false, Base::Bt601>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Nv12ToBgr<false, Base::Bt709>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Nv12ToBgr<false, Base::Bt2020>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt601Full: Nv12ToBgr<false, Base::Bt601Full>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Nv12ToBgr<false, Base::Bt709Full>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Nv12ToBgr<false, Base::Bt2020Full>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            default: assert(0);
+            }
+        }
+
+        void Nv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Nv12ToBgr<true, Base::Bt601>(y, yStride, vu, vuStride, width, height, bgr, bgrStride);
+        }
+
+        void Nv21ToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToBgr<true, Base::Bt601>(y, yStride, vu, vuStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Nv12ToBgr<true, Base::Bt709>(y, yStride, vu, vuStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Nv12ToBgr<true, Base::Bt2020>(y, yStride, vu, vuStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt601Full: Nv12ToBgr<true, Base::Bt601Full>(y, yStride, vu, vuStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Nv12ToBgr<true, Base::Bt709Full>(y, yStride, vu, vuStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Nv12ToBgr<true, Base::Bt2020Full>(y, yStride, vu, vuStride, width, height, bgr, bgrStride); break;
+            default: assert(0);
+            }
         }
     }
 #endif// SIMD_AVX2_ENABLE
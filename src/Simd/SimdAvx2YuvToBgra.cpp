@@ -30,12 +30,12 @@ namespace Simd
 #ifdef SIMD_AVX2_ENABLE    
     namespace Avx2
     {
-        template <bool align> SIMD_INLINE void AdjustedYuv16ToBgra(__m256i y16, __m256i u16, __m256i v16,
+        template <bool align, class T = Base::Bt601> SIMD_INLINE void AdjustedYuv16ToBgra(__m256i y16, __m256i u16, __m256i v16,
             const __m256i & a_0, __m256i * bgra)
         {
-            const __m256i b16 = AdjustedYuvToBlue16(y16, u16);
-            const __m256i g16 = AdjustedYuvToGreen16(y16, u16, v16);
-            const __m256i r16 = AdjustedYuvToRed16(y16, v16);
+            const __m256i b16 = AdjustedYuvToBlue16<T>(y16, u16);
+            const __m256i g16 = AdjustedYuvToGreen16<T>(y16, u16, v16);
+            const __m256i r16 = AdjustedYuvToRed16<T>(y16, v16);
             const __m256i bg8 = _mm256_or_si256(b16, _mm256_slli_si256(g16, 1));
             const __m256i ra8 = _mm256_or_si256(r16, a_0);
             __m256i bgra0 = _mm256_unpacklo_epi16(bg8, ra8);
@@ -45,10 +45,10 @@ namespace Simd
             Store<align>(bgra + 1, bgra1);
         }
 
-        template <bool align> SIMD_INLINE void Yuv16ToBgra(__m256i y16, __m256i u16, __m256i v16,
+        template <bool align, class T = Base::Bt601> SIMD_INLINE void Yuv16ToBgra(__m256i y16, __m256i u16, __m256i v16,
             const __m256i & a_0, __m256i * bgra)
         {
-            AdjustedYuv16ToBgra<align>(AdjustY16(y16), AdjustUV16(u16), AdjustUV16(v16), a_0, bgra);
+            AdjustedYuv16ToBgra<align, T>(AdjustY16<T>(y16), AdjustUV16(u16), AdjustUV16(v16), a_0, bgra);
         }
 
         template <bool align> SIMD_INLINE void Yuva8ToBgra(__m256i y8, __m256i u8, __m256i v8, const __m256i & a8, __m256i * bgra)
@@ -115,21 +115,21 @@ namespace Simd
                 Yuva420pToBgra<false>(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
         }
 
-        template <bool align> SIMD_INLINE void Yuv8ToBgra(__m256i y8, __m256i u8, __m256i v8, const __m256i & a_0, __m256i * bgra)
+        template <bool align, class T = Base::Bt601> SIMD_INLINE void Yuv8ToBgra(__m256i y8, __m256i u8, __m256i v8, const __m256i & a_0, __m256i * bgra)
         {
-            Yuv16ToBgra<align>(_mm256_unpacklo_epi8(y8, K_ZERO), _mm256_unpacklo_epi8(u8, K_ZERO),
+            Yuv16ToBgra<align, T>(_mm256_unpacklo_epi8(y8, K_ZERO), _mm256_unpacklo_epi8(u8, K_ZERO),
                 _mm256_unpacklo_epi8(v8, K_ZERO), a_0, bgra + 0);
-            Yuv16ToBgra<align>(_mm256_unpackhi_epi8(y8, K_ZERO), _mm256_unpackhi_epi8(u8, K_ZERO),
+            Yuv16ToBgra<align, T>(_mm256_unpackhi_epi8(y8, K_ZERO), _mm256_unpackhi_epi8(u8, K_ZERO),
                 _mm256_unpackhi_epi8(v8, K_ZERO), a_0, bgra + 2);
         }
 
-        template <bool align> SIMD_INLINE void Yuv444pToBgra(const uint8_t * y, const uint8_t * u,
+        template <bool align, class T = Base::Bt601> SIMD_INLINE void Yuv444pToBgra(const uint8_t * y, const uint8_t * u,
             const uint8_t * v, const __m256i & a_0, uint8_t * bgra)
         {
-            Yuv8ToBgra<align>(LoadPermuted<align>((__m256i*)y), LoadPermuted<align>((__m256i*)u), LoadPermuted<align>((__m256i*)v), a_0, (__m256i*)bgra);
+            Yuv8ToBgra<align, T>(LoadPermuted<align>((__m256i*)y), LoadPermuted<align>((__m256i*)u), LoadPermuted<align>((__m256i*)v), a_0, (__m256i*)bgra);
         }
 
-        template <bool align> void Yuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <bool align, class T = Base::Bt601> void Yuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
         {
             assert(width >= A);
@@ -146,12 +146,12 @@ namespace Simd
             {
                 for (size_t colYuv = 0, colBgra = 0; colYuv < bodyWidth; colYuv += A, colBgra += QA)
                 {
-                    Yuv444pToBgra<align>(y + colYuv, u + colYuv, v + colYuv, a_0, bgra + colBgra);
+                    Yuv444pToBgra<align, T>(y + colYuv, u + colYuv, v + colYuv, a_0, bgra + colBgra);
                 }
                 if (tail)
                 {
                     size_t col = width - A;
-                    Yuv444pToBgra<false>(y + col, u + col, v + col, a_0, bgra + 4 * col);
+                    Yuv444pToBgra<false, T>(y + col, u + col, v + col, a_0, bgra + 4 * col);
                 }
                 y += yStride;
                 u += uStride;
@@ -160,28 +160,55 @@ namespace Simd
             }
         }
 
-        void Yuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride))
-                Yuv444pToBgra<true>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+                Yuv444pToBgra<true, T>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
             else
-                Yuv444pToBgra<false>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+                Yuv444pToBgra<false, T>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        }
+
+        void Yuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            Yuv444pToBgra<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
         }
 
-        template <bool align> SIMD_INLINE void Yuv422pToBgra(const uint8_t * y, const __m256i & u, const __m256i & v,
+        void Yuv444pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv444pToBgra<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709: Yuv444pToBgra<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020: Yuv444pToBgra<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt601Full: Yuv444pToBgra<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709Full: Yuv444pToBgra<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020Full: Yuv444pToBgra<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            default: assert(0);
+            }
+        }
+
+        void Yuv444pToRgba(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgba, size_t rgbaStride, uint8_t alpha)
+        {
+            Yuv444pToBgra<Base::Rgb<Base::Bt601>>(y, yStride, v, vStride, u, uStride, width, height, rgba, rgbaStride, alpha);
+        }
+
+        template <bool align, class T = Base::Bt601> SIMD_INLINE void Yuv422pToBgra(const uint8_t * y, const __m256i & u, const __m256i & v,
             const __m256i & a_0, uint8_t * bgra)
         {
-            Yuv8ToBgra<align>(LoadPermuted<align>((__m256i*)y + 0),
+            Yuv8ToBgra<align, T>(LoadPermuted<align>((__m256i*)y + 0),
                 _mm256_permute4x64_epi64(_mm256_unpacklo_epi8(u, u), 0xD8),
                 _mm256_permute4x64_epi64(_mm256_unpacklo_epi8(v, v), 0xD8), a_0, (__m256i*)bgra + 0);
-            Yuv8ToBgra<align>(LoadPermuted<align>((__m256i*)y + 1),
+            Yuv8ToBgra<align, T>(LoadPermuted<align>((__m256i*)y + 1),
                 _mm256_permute4x64_epi64(_mm256_unpackhi_epi8(u, u), 0xD8),
                 _mm256_permute4x64_epi64(_mm256_unpackhi_epi8(v, v), 0xD8), a_0, (__m256i*)bgra + 4);
         }
 
-        template <bool align> void Yuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <bool align, class T = Base::Bt601> void Yuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
         {
             assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
@@ -200,16 +227,16 @@ namespace Simd
                 {
                     __m256i u_ = LoadPermuted<align>((__m256i*)(u + colUV));
                     __m256i v_ = LoadPermuted<align>((__m256i*)(v + colUV));
-                    Yuv422pToBgra<align>(y + colY, u_, v_, a_0, bgra + colBgra);
-                    Yuv422pToBgra<align>(y + colY + yStride, u_, v_, a_0, bgra + colBgra + bgraStride);
+                    Yuv422pToBgra<align, T>(y + colY, u_, v_, a_0, bgra + colBgra);
+                    Yuv422pToBgra<align, T>(y + colY + yStride, u_, v_, a_0, bgra + colBgra + bgraStride);
                 }
                 if (tail)
                 {
                     size_t offset = width - DA;
                     __m256i u_ = LoadPermuted<false>((__m256i*)(u + offset / 2));
                     __m256i v_ = LoadPermuted<false>((__m256i*)(v + offset / 2));
-                    Yuv422pToBgra<false>(y + offset, u_, v_, a_0, bgra + 4 * offset);
-                    Yuv422pToBgra<false>(y + offset + yStride, u_, v_, a_0, bgra + 4 * offset + bgraStride);
+                    Yuv422pToBgra<false, T>(y + offset, u_, v_, a_0, bgra + 4 * offset);
+                    Yuv422pToBgra<false, T>(y + offset + yStride, u_, v_, a_0, bgra + 4 * offset + bgraStride);
                 }
                 y += 2 * yStride;
                 u += uStride;
@@ -218,22 +245,49 @@ namespace Simd
             }
         }
 
-        void Yuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride))
-                Yuv420pToBgra<true>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+                Yuv420pToBgra<true, T>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
             else
-                Yuv420pToBgra<false>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+                Yuv420pToBgra<false, T>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
         }
 
-        template <bool align> SIMD_INLINE void Yuv422pToBgra(const uint8_t * y, const uint8_t * u, const uint8_t * v, const __m256i & a_0, uint8_t * bgra)
+        void Yuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
         {
-            Yuv422pToBgra<align>(y, LoadPermuted<align>((__m256i*)u), LoadPermuted<align>((__m256i*)v), a_0, bgra);
+            Yuv420pToBgra<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
         }
 
-        template <bool align> void Yuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        void Yuv420pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv420pToBgra<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709: Yuv420pToBgra<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020: Yuv420pToBgra<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt601Full: Yuv420pToBgra<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709Full: Yuv420pToBgra<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020Full: Yuv420pToBgra<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            default: assert(0);
+            }
+        }
+
+        void Yuv420pToRgba(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgba, size_t rgbaStride, uint8_t alpha)
+        {
+            Yuv420pToBgra<Base::Rgb<Base::Bt601>>(y, yStride, v, vStride, u, uStride, width, height, rgba, rgbaStride, alpha);
+        }
+
+        template <bool align, class T = Base::Bt601> SIMD_INLINE void Yuv422pToBgra(const uint8_t * y, const uint8_t * u, const uint8_t * v, const __m256i & a_0, uint8_t * bgra)
+        {
+            Yuv422pToBgra<align, T>(y, LoadPermuted<align>((__m256i*)u), LoadPermuted<align>((__m256i*)v), a_0, bgra);
+        }
+
+        template <bool align, class T = Base::Bt601> void Yuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
         {
             assert((width % 2 == 0) && (width >= DA));
@@ -249,11 +303,11 @@ namespace Simd
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t colUV = 0, colY = 0, colBgra = 0; colY < bodyWidth; colY += DA, colUV += A, colBgra += OA)
-                    Yuv422pToBgra<align>(y + colY, u + colUV, v + colUV, a_0, bgra + colBgra);
+                    Yuv422pToBgra<align, T>(y + colY, u + colUV, v + colUV, a_0, bgra + colBgra);
                 if (tail)
                 {
                     size_t offset = width - DA;
-                    Yuv422pToBgra<false>(y + offset, u + offset / 2, v + offset / 2, a_0, bgra + 4 * offset);
+                    Yuv422pToBgra<false, T>(y + offset, u + offset / 2, v + offset / 2, a_0, bgra + 4 * offset);
                 }
                 y += yStride;
                 u += uStride;
@@ -262,14 +316,128 @@ namespace Simd
             }
         }
 
-        void Yuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride))
-                Yuv422pToBgra<true>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+                Yuv422pToBgra<true, T>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+            else
+                Yuv422pToBgra<false, T>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        }
+
+        void Yuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            Yuv422pToBgra<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        }
+
+        void Yuv422pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv422pToBgra<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709: Yuv422pToBgra<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020: Yuv422pToBgra<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt601Full: Yuv422pToBgra<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709Full: Yuv422pToBgra<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020Full: Yuv422pToBgra<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            default: assert(0);
+            }
+        }
+
+        void Yuv422pToRgba(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgba, size_t rgbaStride, uint8_t alpha)
+        {
+            Yuv422pToBgra<Base::Rgb<Base::Bt601>>(y, yStride, v, vStride, u, uStride, width, height, rgba, rgbaStride, alpha);
+        }
+
+        template <bool align, bool nv21, class T> void Nv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
+            if (align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride));
+                assert(Aligned(bgra) && Aligned(bgraStride));
+            }
+
+            __m256i a_0 = _mm256_slli_si256(_mm256_set1_epi16(alpha), 1);
+            size_t bodyWidth = AlignLo(width, DA);
+            size_t tail = width - bodyWidth;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0, colBgra = 0; colY < bodyWidth; colY += DA, colBgra += OA)
+                {
+                    __m256i u_, v_;
+                    LoadPermutedUv<align, nv21>(uv + colY, u_, v_);
+                    Yuv422pToBgra<align, T>(y + colY, u_, v_, a_0, bgra + colBgra);
+                    Yuv422pToBgra<align, T>(y + colY + yStride, u_, v_, a_0, bgra + colBgra + bgraStride);
+                }
+                if (tail)
+                {
+                    size_t offset = width - DA;
+                    __m256i u_, v_;
+                    LoadPermutedUv<false, nv21>(uv + offset, u_, v_);
+                    Yuv422pToBgra<false, T>(y + offset, u_, v_, a_0, bgra + 4 * offset);
+                    Yuv422pToBgra<false, T>(y + offset + yStride, u_, v_, a_0, bgra + 4 * offset + bgraStride);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                bgra += 2 * bgraStride;
+            }
+        }
+
+        template <bool nv21, class T> void Nv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(bgra) && Aligned(bgraStride))
+                Nv12ToBgra<true, nv21, T>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
             else
-                Yuv422pToBgra<false>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+                Nv12ToBgra<false, nv21, T>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+        }
+
+        void Nv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            Nv12ToBgra<false, Base::Bt601>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+        }
+
+        void Nv12ToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToBgra<false, Base::Bt601>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709: Nv12ToBgra<false, Base::Bt709>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020: Nv12ToBgra<false, Base::Bt2020>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt601Full: Nv12ToBgra<false, Base::Bt601Full>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709Full: Nv12ToBgra<false, Base::Bt709Full>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020Full: Nv12ToBgra<false, Base::Bt2020Full>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha); break;
+            default: assert(0);
+            }
+        }
+
+        void Nv21ToBgra(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            Nv12ToBgra<true, Base::Bt601>(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha);
+        }
+
+        void Nv21ToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToBgra<true, Base::Bt601>(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709: Nv12ToBgra<true, Base::Bt709>(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020: Nv12ToBgra<true, Base::Bt2020>(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt601Full: Nv12ToBgra<true, Base::Bt601Full>(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709Full: Nv12ToBgra<true, Base::Bt709Full>(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020Full: Nv12ToBgra<true, Base::Bt2020Full>(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha); break;
+            default: assert(0);
+            }
         }
     }
 #endif// SIMD_AVX2_ENABLE
@@ -0,0 +1,318 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdLoad.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        SIMD_INLINE __m512i BroadcastAlpha16(__m512i bgra16)
+        {
+            return _mm512_shufflehi_epi16(_mm512_shufflelo_epi16(bgra16, 0xFF), 0xFF);
+        }
+
+        SIMD_INLINE __m512i AlphaPremultiply16(__m512i bgra16)
+        {
+            return DivideI16By255(_mm512_mullo_epi16(bgra16, _mm512_mask_blend_epi16(0x88888888, BroadcastAlpha16(bgra16), K16_00FF)));
+        }
+
+        template<bool mask> SIMD_INLINE void AlphaPremultiply(const uint8_t * src, uint8_t * dst, __mmask64 tail = -1)
+        {
+            __m512i bgra = Load<false, mask>(src, tail);
+            __m512i lo = AlphaPremultiply16(UnpackU8<0>(bgra));
+            __m512i hi = AlphaPremultiply16(UnpackU8<1>(bgra));
+            Store<false, mask>(dst, _mm512_packus_epi16(lo, hi), tail);
+        }
+
+        void AlphaPremultiply(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+        {
+            size_t widthF = AlignLo(width, F);
+            __mmask64 tail = TailMask64((width - widthF) * 4);
+            for (size_t row = 0; row < height; ++row)
+            {
+                size_t col = 0;
+                for (; col < widthF; col += F)
+                    AlphaPremultiply<false>(src + col * 4, dst + col * 4);
+                if (col < width)
+                    AlphaPremultiply<true>(src + col * 4, dst + col * 4, tail);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE __m512i AlphaUnpremultiply32(__m512i bgra32)
+        {
+            __m512i alpha = _mm512_shuffle_epi32(bgra32, _MM_PERM_DDDD);
+            __m512 dividend = _mm512_cvtepi32_ps(_mm512_add_epi32(_mm512_mullo_epi16(bgra32, K32_000000FF), _mm512_srli_epi32(alpha, 1)));
+            __m512i value = _mm512_cvttps_epi32(_mm512_div_ps(dividend, _mm512_cvtepi32_ps(_mm512_max_epi32(alpha, K32_00000001))));
+            return _mm512_mask_blend_epi32(0x8888, _mm512_maskz_mov_epi32(_mm512_cmpneq_epi32_mask(alpha, K_ZERO), value), alpha);
+        }
+
+        SIMD_INLINE __m512i AlphaUnpremultiply16(__m512i bgra16)
+        {
+            __m512i lo = AlphaUnpremultiply32(_mm512_unpacklo_epi16(bgra16, K_ZERO));
+            __m512i hi = AlphaUnpremultiply32(_mm512_unpackhi_epi16(bgra16, K_ZERO));
+            return _mm512_packs_epi32(lo, hi);
+        }
+
+        template<bool mask> SIMD_INLINE void AlphaUnpremultiply(const uint8_t * src, uint8_t * dst, __mmask64 tail = -1)
+        {
+            __m512i bgra = Load<false, mask>(src, tail);
+            __m512i lo = AlphaUnpremultiply16(UnpackU8<0>(bgra));
+            __m512i hi = AlphaUnpremultiply16(UnpackU8<1>(bgra));
+            Store<false, mask>(dst, _mm512_packus_epi16(lo, hi), tail);
+        }
+
+        void AlphaUnpremultiply(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+        {
+            size_t widthF = AlignLo(width, F);
+            __mmask64 tail = TailMask64((width - widthF) * 4);
+            for (size_t row = 0; row < height; ++row)
+            {
+                size_t col = 0;
+                for (; col < widthF; col += F)
+                    AlphaUnpremultiply<false>(src + col * 4, dst + col * 4);
+                if (col < width)
+                    AlphaUnpremultiply<true>(src + col * 4, dst + col * 4, tail);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE __m512i AlphaBlendingBgraToBgra32(__m512i srcDst, __m512i weight, __m512i half, __m512i divisor)
+        {
+            __m512 dividend = _mm512_cvtepi32_ps(_mm512_add_epi32(_mm512_madd_epi16(srcDst, weight), half));
+            return _mm512_cvttps_epi32(_mm512_div_ps(dividend, _mm512_cvtepi32_ps(divisor)));
+        }
+
+        SIMD_INLINE __m512i AlphaBlendingBgraToBgra16(__m512i src, __m512i dst, __m512i alpha)
+        {
+            __m512i srcAlpha = DivideI16By255(_mm512_mullo_epi16(BroadcastAlpha16(src), alpha));
+            __m512i dstAlpha = DivideI16By255(_mm512_mullo_epi16(BroadcastAlpha16(dst), _mm512_sub_epi16(K16_00FF, srcAlpha)));
+            __m512i sumAlpha = _mm512_add_epi16(srcAlpha, dstAlpha);
+            __m512i half = _mm512_srli_epi16(sumAlpha, 1);
+            __m512i divisor = _mm512_max_epi16(sumAlpha, K16_0001);
+            __m512i lo = AlphaBlendingBgraToBgra32(_mm512_unpacklo_epi16(src, dst), _mm512_unpacklo_epi16(srcAlpha, dstAlpha),
+                _mm512_unpacklo_epi16(half, K_ZERO), _mm512_unpacklo_epi16(divisor, K_ZERO));
+            __m512i hi = AlphaBlendingBgraToBgra32(_mm512_unpackhi_epi16(src, dst), _mm512_unpackhi_epi16(srcAlpha, dstAlpha),
+                _mm512_unpackhi_epi16(half, K_ZERO), _mm512_unpackhi_epi16(divisor, K_ZERO));
+            return _mm512_mask_blend_epi16(0x88888888, _mm512_packs_epi32(lo, hi), sumAlpha);
+        }
+
+        SIMD_INLINE __m512i AlphaBlendingPremultipliedBgraToBgra16(__m512i src, __m512i dst, __m512i alpha)
+        {
+            src = DivideI16By255(_mm512_mullo_epi16(src, alpha));
+            return _mm512_add_epi16(src, DivideI16By255(_mm512_mullo_epi16(dst, _mm512_sub_epi16(K16_00FF, BroadcastAlpha16(src)))));
+        }
+
+        template<bool premultiplied> SIMD_INLINE __m512i AlphaBlendingBgraToBgra16(__m512i src, __m512i dst, __m512i alpha)
+        {
+            return premultiplied ? AlphaBlendingPremultipliedBgraToBgra16(src, dst, alpha) : AlphaBlendingBgraToBgra16(src, dst, alpha);
+        }
+
+        template<bool premultiplied, bool mask> SIMD_INLINE void AlphaBlendingBgraToBgra(const uint8_t * src, __m512i alpha, uint8_t * dst, __mmask64 tail = -1)
+        {
+            __m512i _src = Load<false, mask>(src, tail);
+            __m512i _dst = Load<false, mask>(dst, tail);
+            __m512i lo = AlphaBlendingBgraToBgra16<premultiplied>(UnpackU8<0>(_src), UnpackU8<0>(_dst), alpha);
+            __m512i hi = AlphaBlendingBgraToBgra16<premultiplied>(UnpackU8<1>(_src), UnpackU8<1>(_dst), alpha);
+            Store<false, mask>(dst, _mm512_packus_epi16(lo, hi), tail);
+        }
+
+        template<bool premultiplied> void AlphaBlendingBgraToBgra(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t alpha, uint8_t * dst, size_t dstStride)
+        {
+            size_t widthF = AlignLo(width, F);
+            __mmask64 tail = TailMask64((width - widthF) * 4);
+            __m512i _alpha = _mm512_set1_epi16(alpha);
+            for (size_t row = 0; row < height; ++row)
+            {
+                size_t col = 0;
+                for (; col < widthF; col += F)
+                    AlphaBlendingBgraToBgra<premultiplied, false>(src + col * 4, _alpha, dst + col * 4);
+                if (col < width)
+                    AlphaBlendingBgraToBgra<premultiplied, true>(src + col * 4, _alpha, dst + col * 4, tail);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        void AlphaBlendingBgraToBgra(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t alpha, SimdBool premultiplied, uint8_t * dst, size_t dstStride)
+        {
+            if (premultiplied)
+                AlphaBlendingBgraToBgra<true>(src, srcStride, width, height, alpha, dst, dstStride);
+            else
+                AlphaBlendingBgraToBgra<false>(src, srcStride, width, height, alpha, dst, dstStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE __m512i RestrictRange32(__m512i value)
+        {
+            return _mm512_min_epi32(_mm512_max_epi32(value, K_ZERO), K32_000000FF);
+        }
+
+        SIMD_INLINE __m512i Average32(__m512i sum)
+        {
+            return _mm512_srli_epi32(_mm512_add_epi32(sum, _mm512_set1_epi32(2)), 2);
+        }
+
+        SIMD_INLINE __m512i PairSum32(__m512i lo, __m512i hi)
+        {
+            __m256i _lo = _mm512_cvtepi64_epi32(_mm512_add_epi32(lo, _mm512_srli_epi64(lo, 32)));
+            __m256i _hi = _mm512_cvtepi64_epi32(_mm512_add_epi32(hi, _mm512_srli_epi64(hi, 32)));
+            return _mm512_inserti64x4(_mm512_castsi256_si512(_lo), _hi, 1);
+        }
+
+        template <class T> SIMD_INLINE __m512i AlphaBlendingBgraToYuv32(__m512i bgra, __m512i alpha, __m512i y, __m512i & a, __m512i & u, __m512i & v)
+        {
+            __m512i b16_r16 = _mm512_and_si512(bgra, K16_00FF);
+            __m512i g16_1 = _mm512_or_si512(_mm512_and_si512(_mm512_srli_epi32(bgra, 8), K32_000000FF), K32_00010000);
+            a = DivideI16By255(_mm512_mullo_epi16(_mm512_srli_epi32(bgra, 24), alpha));
+            u = DivideI16By255(_mm512_mullo_epi16(RestrictRange32(_mm512_add_epi32(BgrToU32<T>(b16_r16, g16_1), _mm512_set1_epi32(Base::UV_ADJUST))), a));
+            v = DivideI16By255(_mm512_mullo_epi16(RestrictRange32(_mm512_add_epi32(BgrToV32<T>(b16_r16, g16_1), _mm512_set1_epi32(Base::UV_ADJUST))), a));
+            __m512i _y = RestrictRange32(_mm512_add_epi32(BgrToY32<T>(b16_r16, g16_1), _mm512_set1_epi32(T::Y_ADJUST)));
+            return DivideI16By255(_mm512_add_epi16(_mm512_mullo_epi16(_y, a), _mm512_mullo_epi16(y, _mm512_sub_epi16(K32_000000FF, a))));
+        }
+
+        template <class T> SIMD_INLINE void AlphaBlendingBgraToYuv(const uint8_t * bgra, __m512i alpha, uint8_t * y, __m512i & a, __m512i & u, __m512i & v)
+        {
+            __m512i _a[2], _u[2], _v[2];
+            for (size_t i = 0; i < 2; ++i)
+            {
+                __m512i _y = _mm512_cvtepu8_epi32(_mm_loadu_si128((__m128i*)(y + F * i)));
+                _y = AlphaBlendingBgraToYuv32<T>(_mm512_loadu_si512(bgra + A * i), alpha, _y, _a[i], _u[i], _v[i]);
+                _mm_storeu_si128((__m128i*)(y + F * i), _mm512_cvtepi32_epi8(_y));
+            }
+            a = _mm512_add_epi32(a, PairSum32(_a[0], _a[1]));
+            u = _mm512_add_epi32(u, PairSum32(_u[0], _u[1]));
+            v = _mm512_add_epi32(v, PairSum32(_v[0], _v[1]));
+        }
+
+        template <bool nv12> SIMD_INLINE void LoadChroma(const uint8_t * u, const uint8_t * v, __m512i & u32, __m512i & v32)
+        {
+            if (nv12)
+            {
+                __m512i uv = _mm512_cvtepu16_epi32(_mm256_loadu_si256((__m256i*)u));
+                u32 = _mm512_and_si512(uv, K32_000000FF);
+                v32 = _mm512_srli_epi32(uv, 8);
+            }
+            else
+            {
+                u32 = _mm512_cvtepu8_epi32(_mm_loadu_si128((__m128i*)u));
+                v32 = _mm512_cvtepu8_epi32(_mm_loadu_si128((__m128i*)v));
+            }
+        }
+
+        template <bool nv12> SIMD_INLINE void StoreChroma(__m512i u32, __m512i v32, uint8_t * u, uint8_t * v)
+        {
+            if (nv12)
+                _mm256_storeu_si256((__m256i*)u, _mm512_cvtepi32_epi16(_mm512_or_si512(u32, _mm512_slli_epi32(v32, 8))));
+            else
+            {
+                _mm_storeu_si128((__m128i*)u, _mm512_cvtepi32_epi8(u32));
+                _mm_storeu_si128((__m128i*)v, _mm512_cvtepi32_epi8(v32));
+            }
+        }
+
+        template <class T, bool nv12> SIMD_INLINE void AlphaBlendingBgraToYuv420(const uint8_t * bgra, size_t bgraStride, __m512i alpha, uint8_t * y, size_t yStride, uint8_t * u, uint8_t * v)
+        {
+            __m512i a = K_ZERO, _u = K_ZERO, _v = K_ZERO, u32, v32;
+            AlphaBlendingBgraToYuv<T>(bgra, alpha, y, a, _u, _v);
+            AlphaBlendingBgraToYuv<T>(bgra + bgraStride, alpha, y + yStride, a, _u, _v);
+            LoadChroma<nv12>(u, v, u32, v32);
+            __m512i inverse = _mm512_sub_epi32(K32_000000FF, Average32(a));
+            u32 = _mm512_add_epi32(Average32(_u), DivideI16By255(_mm512_mullo_epi16(u32, inverse)));
+            v32 = _mm512_add_epi32(Average32(_v), DivideI16By255(_mm512_mullo_epi16(v32, inverse)));
+            StoreChroma<nv12>(u32, v32, u, v);
+        }
+
+        template <class T, bool nv12> void AlphaBlendingBgraToYuv420(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t alpha,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            size_t widthHA = AlignLo(width, HA);
+            __m512i _alpha = _mm512_set1_epi32(alpha);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0; colY < widthHA; colY += HA)
+                {
+                    size_t colUV = nv12 ? colY : colY / 2;
+                    AlphaBlendingBgraToYuv420<T, nv12>(bgra + colY * 4, bgraStride, _alpha, y + colY, yStride, u + colUV, v + colUV);
+                }
+                bgra += 2 * bgraStride;
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+            }
+        }
+
+        template <bool nv12> void AlphaBlendingBgraToYuv420(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t alpha,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: AlphaBlendingBgraToYuv420<Base::Bt601, nv12>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: AlphaBlendingBgraToYuv420<Base::Bt709, nv12>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: AlphaBlendingBgraToYuv420<Base::Bt2020, nv12>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: AlphaBlendingBgraToYuv420<Base::Bt601Full, nv12>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: AlphaBlendingBgraToYuv420<Base::Bt709Full, nv12>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: AlphaBlendingBgraToYuv420<Base::Bt2020Full, nv12>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride); break;
+            default: assert(0);
+            }
+        }
+
+        void AlphaBlendingBgraToYuv420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t alpha,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            assert(width >= HA && (width % 2 == 0) && (height % 2 == 0));
+
+            AlphaBlendingBgraToYuv420<false>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride, yuvType);
+            size_t widthHA = AlignLo(width, HA);
+            if (widthHA < width)
+                Base::AlphaBlendingBgraToYuv420p(bgra + widthHA * 4, bgraStride, width - widthHA, height, alpha,
+                    y + widthHA, yStride, u + widthHA / 2, uStride, v + widthHA / 2, vStride, yuvType);
+        }
+
+        void AlphaBlendingBgraToNv12(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t alpha,
+            uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            assert(width >= HA && (width % 2 == 0) && (height % 2 == 0));
+
+            AlphaBlendingBgraToYuv420<true>(bgra, bgraStride, width, height, alpha, y, yStride, uv, uvStride, uv, uvStride, yuvType);
+            size_t widthHA = AlignLo(width, HA);
+            if (widthHA < width)
+                Base::AlphaBlendingBgraToNv12(bgra + widthHA * 4, bgraStride, width - widthHA, height, alpha, y + widthHA, yStride, uv + widthHA, uvStride, yuvType);
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
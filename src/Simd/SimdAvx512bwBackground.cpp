@@ -451,6 +451,382 @@ namespace Simd
             else
                 BackgroundInitMask<false>(src, srcStride, width, height, index, value, dst, dstStride);
         }
+
+        template <bool align, bool mask, bool grow, bool increment, bool adjust> SIMD_INLINE void BackgroundUpdate(const uint8_t * value, uint8_t * loValue, uint8_t * hiValue,
+            uint8_t * loCount, uint8_t * hiCount, const __m512i & threshold, __mmask64 m = -1)
+        {
+            const __m512i _value = Load<align, mask>(value, m);
+            __m512i _loValue = Load<align, mask>(loValue, m);
+            __m512i _hiValue = Load<align, mask>(hiValue, m);
+            if (grow)
+            {
+                _loValue = _mm512_min_epu8(_loValue, _value);
+                _hiValue = _mm512_max_epu8(_hiValue, _value);
+            }
+            if (increment || adjust)
+            {
+                __m512i _loCount = Load<align, mask>(loCount, m);
+                __m512i _hiCount = Load<align, mask>(hiCount, m);
+                if (increment)
+                {
+                    _loCount = _mm512_mask_adds_epu8(_loCount, _mm512_cmplt_epu8_mask(_value, _loValue), _loCount, K8_01);
+                    _hiCount = _mm512_mask_adds_epu8(_hiCount, _mm512_cmpgt_epu8_mask(_value, _hiValue), _hiCount, K8_01);
+                }
+                if (adjust)
+                {
+                    _loValue = AdjustLo(_loCount, _loValue, threshold);
+                    _hiValue = AdjustHi(_hiCount, _hiValue, threshold);
+                    _loCount = K_ZERO;
+                    _hiCount = K_ZERO;
+                }
+                Store<align, mask>(loCount, _loCount, m);
+                Store<align, mask>(hiCount, _hiCount, m);
+            }
+            if (grow || adjust)
+            {
+                Store<align, mask>(loValue, _loValue, m);
+                Store<align, mask>(hiValue, _hiValue, m);
+            }
+        }
+
+        template <bool align, bool grow, bool increment, bool adjust> void BackgroundUpdate(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * loValue, size_t loValueStride, uint8_t * hiValue, size_t hiValueStride,
+            uint8_t * loCount, size_t loCountStride, uint8_t * hiCount, size_t hiCountStride, uint8_t threshold)
+        {
+            if (align)
+            {
+                assert(Aligned(value) && Aligned(valueStride));
+                assert(Aligned(loValue) && Aligned(loValueStride) && Aligned(hiValue) && Aligned(hiValueStride));
+                assert(Aligned(loCount) && Aligned(loCountStride) && Aligned(hiCount) && Aligned(hiCountStride));
+            }
+
+            const __m512i _threshold = _mm512_set1_epi8((char)threshold);
+            size_t alignedWidth = AlignLo(width, A);
+            __mmask64 tailMask = TailMask64(width - alignedWidth);
+            for (size_t row = 0; row < height; ++row)
+            {
+                size_t col = 0;
+                for (; col < alignedWidth; col += A)
+                    BackgroundUpdate<align, false, grow, increment, adjust>(value + col, loValue + col, hiValue + col, loCount + col, hiCount + col, _threshold);
+                if (col < width)
+                    BackgroundUpdate<align, true, grow, increment, adjust>(value + col, loValue + col, hiValue + col, loCount + col, hiCount + col, _threshold, tailMask);
+                value += valueStride;
+                loValue += loValueStride;
+                hiValue += hiValueStride;
+                loCount += loCountStride;
+                hiCount += hiCountStride;
+            }
+        }
+
+        typedef void(*BackgroundUpdatePtr)(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * loValue, size_t loValueStride, uint8_t * hiValue, size_t hiValueStride,
+            uint8_t * loCount, size_t loCountStride, uint8_t * hiCount, size_t hiCountStride, uint8_t threshold);
+
+        template <bool align, bool grow, bool increment> BackgroundUpdatePtr GetBackgroundUpdate(int flags)
+        {
+            if (flags & SimdBackgroundUpdateAdjustRange)
+                return BackgroundUpdate<align, grow, increment, true>;
+            else
+                return BackgroundUpdate<align, grow, increment, false>;
+        }
+
+        template <bool align, bool grow> BackgroundUpdatePtr GetBackgroundUpdate(int flags)
+        {
+            if (flags & SimdBackgroundUpdateIncrementCount)
+                return GetBackgroundUpdate<align, grow, true>(flags);
+            else
+                return GetBackgroundUpdate<align, grow, false>(flags);
+        }
+
+        template <bool align> BackgroundUpdatePtr GetBackgroundUpdate(int flags)
+        {
+            if (flags & SimdBackgroundUpdateGrowRange)
+                return GetBackgroundUpdate<align, true>(flags);
+            else
+                return GetBackgroundUpdate<align, false>(flags);
+        }
+
+        void BackgroundUpdate(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * loValue, size_t loValueStride, uint8_t * hiValue, size_t hiValueStride,
+            uint8_t * loCount, size_t loCountStride, uint8_t * hiCount, size_t hiCountStride, uint8_t threshold, int flags)
+        {
+            if ((flags & (SimdBackgroundUpdateGrowRange | SimdBackgroundUpdateIncrementCount | SimdBackgroundUpdateAdjustRange)) == 0)
+                return;
+            BackgroundUpdatePtr backgroundUpdate;
+            if (Aligned(value) && Aligned(valueStride) &&
+                Aligned(loValue) && Aligned(loValueStride) && Aligned(hiValue) && Aligned(hiValueStride) &&
+                Aligned(loCount) && Aligned(loCountStride) && Aligned(hiCount) && Aligned(hiCountStride))
+                backgroundUpdate = GetBackgroundUpdate<true>(flags);
+            else
+                backgroundUpdate = GetBackgroundUpdate<false>(flags);
+            backgroundUpdate(value, valueStride, width, height, loValue, loValueStride, hiValue, hiValueStride,
+                loCount, loCountStride, hiCount, hiCountStride, threshold);
+        }
+
+        const __mmask64 K64_PACKED_LO_VALUE = 0x1111111111111111;
+        const __mmask64 K64_PACKED_HI_VALUE = 0x2222222222222222;
+        const __mmask64 K64_PACKED_LO_COUNT = 0x4444444444444444;
+        const __mmask64 K64_PACKED_HI_COUNT = 0x8888888888888888;
+
+        template <bool align, bool mask> SIMD_INLINE void BackgroundPackedInit(const uint8_t * value, uint8_t * model, const __mmask64 tails[5])
+        {
+            const __m512i _value = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, Load<align, mask>(value, tails[0]));
+            const __m512i value0 = _mm512_unpacklo_epi8(_value, _value);
+            const __m512i value1 = _mm512_unpackhi_epi8(_value, _value);
+            Store<align, mask>(model + 0 * A, _mm512_unpacklo_epi16(value0, K_ZERO), tails[1]);
+            Store<align, mask>(model + 1 * A, _mm512_unpackhi_epi16(value0, K_ZERO), tails[2]);
+            Store<align, mask>(model + 2 * A, _mm512_unpacklo_epi16(value1, K_ZERO), tails[3]);
+            Store<align, mask>(model + 3 * A, _mm512_unpackhi_epi16(value1, K_ZERO), tails[4]);
+        }
+
+        template <bool align> void BackgroundPackedInit(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
+        {
+            if (align)
+                assert(Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride));
+
+            size_t alignedWidth = AlignLo(width, A);
+            __mmask64 tails[5];
+            tails[0] = TailMask64(width - alignedWidth);
+            for (size_t c = 0; c < 4; ++c)
+                tails[1 + c] = TailMask64((width - alignedWidth) * 4 - A * c);
+            for (size_t row = 0; row < height; ++row)
+            {
+                size_t col = 0;
+                for (; col < alignedWidth; col += A)
+                    BackgroundPackedInit<align, false>(value + col, model + 4 * col, tails);
+                if (col < width)
+                    BackgroundPackedInit<align, true>(value + col, model + 4 * col, tails);
+                value += valueStride;
+                model += modelStride;
+            }
+        }
+
+        void BackgroundPackedInit(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
+        {
+            if (Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride))
+                BackgroundPackedInit<true>(value, valueStride, width, height, model, modelStride);
+            else
+                BackgroundPackedInit<false>(value, valueStride, width, height, model, modelStride);
+        }
+
+        template <bool grow, bool increment, bool adjust> SIMD_INLINE __m512i BackgroundPackedUpdate(__m512i model, const __m512i & value, const __m512i & threshold)
+        {
+            if (grow)
+            {
+                model = _mm512_mask_min_epu8(model, K64_PACKED_LO_VALUE, model, value);
+                model = _mm512_mask_max_epu8(model, K64_PACKED_HI_VALUE, model, value);
+            }
+            if (increment)
+            {
+                const __m512i range = _mm512_slli_epi32(model, 16);
+                const __mmask64 incLo = _mm512_mask_cmplt_epu8_mask(K64_PACKED_LO_COUNT, value, range);
+                const __mmask64 incHi = _mm512_mask_cmpgt_epu8_mask(K64_PACKED_HI_COUNT, value, range);
+                model = _mm512_mask_adds_epu8(model, incLo | incHi, model, K8_01);
+            }
+            if (adjust)
+            {
+                const __m512i count = _mm512_srli_epi32(model, 16);
+                const __mmask64 greater = _mm512_cmpgt_epu8_mask(count, threshold);
+                const __mmask64 lesser = _mm512_cmplt_epu8_mask(count, threshold);
+                const __mmask64 inc = (lesser & K64_PACKED_LO_VALUE) | (greater & K64_PACKED_HI_VALUE);
+                const __mmask64 dec = (greater & K64_PACKED_LO_VALUE) | (lesser & K64_PACKED_HI_VALUE);
+                model = _mm512_mask_adds_epu8(model, inc, model, K8_01);
+                model = _mm512_mask_subs_epu8(model, dec, model, K8_01);
+                model = _mm512_maskz_mov_epi8(K64_PACKED_LO_VALUE | K64_PACKED_HI_VALUE, model);
+            }
+            return model;
+        }
+
+        template <bool align, bool mask, bool grow, bool increment, bool adjust> SIMD_INLINE void BackgroundPackedUpdate(uint8_t * model,
+            const __m512i & value, const __m512i & threshold, __mmask64 m)
+        {
+            const __m512i _model = Load<align, mask>(model, m);
+            Store<align, mask>(model, BackgroundPackedUpdate<grow, increment, adjust>(_model, value, threshold), m);
+        }
+
+        template <bool align, bool mask, bool grow, bool increment, bool adjust> SIMD_INLINE void BackgroundPackedUpdate(const uint8_t * value,
+            uint8_t * model, const __m512i & threshold, const __mmask64 tails[5])
+        {
+            const __m512i _value = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, Load<align, mask>(value, tails[0]));
+            const __m512i value0 = _mm512_unpacklo_epi8(_value, _value);
+            const __m512i value1 = _mm512_unpackhi_epi8(_value, _value);
+            BackgroundPackedUpdate<align, mask, grow, increment, adjust>(model + 0 * A, _mm512_unpacklo_epi16(value0, value0), threshold, tails[1]);
+            BackgroundPackedUpdate<align, mask, grow, increment, adjust>(model + 1 * A, _mm512_unpackhi_epi16(value0, value0), threshold, tails[2]);
+            BackgroundPackedUpdate<align, mask, grow, increment, adjust>(model + 2 * A, _mm512_unpacklo_epi16(value1, value1), threshold, tails[3]);
+            BackgroundPackedUpdate<align, mask, grow, increment, adjust>(model + 3 * A, _mm512_unpackhi_epi16(value1, value1), threshold, tails[4]);
+        }
+
+        template <bool align, bool grow, bool increment, bool adjust> void BackgroundPackedUpdate(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * model, size_t modelStride, uint8_t threshold)
+        {
+            if (align)
+                assert(Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride));
+
+            const __m512i _threshold = _mm512_set1_epi8((char)threshold);
+            size_t alignedWidth = AlignLo(width, A);
+            __mmask64 tails[5];
+            tails[0] = TailMask64(width - alignedWidth);
+            for (size_t c = 0; c < 4; ++c)
+                tails[1 + c] = TailMask64((width - alignedWidth) * 4 - A * c);
+            for (size_t row = 0; row < height; ++row)
+            {
+                size_t col = 0;
+                for (; col < alignedWidth; col += A)
+                    BackgroundPackedUpdate<align, false, grow, increment, adjust>(value + col, model + 4 * col, _threshold, tails);
+                if (col < width)
+                    BackgroundPackedUpdate<align, true, grow, increment, adjust>(value + col, model + 4 * col, _threshold, tails);
+                value += valueStride;
+                model += modelStride;
+            }
+        }
+
+        typedef void(*BackgroundPackedUpdatePtr)(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * model, size_t modelStride, uint8_t threshold);
+
+        template <bool align, bool grow, bool increment> BackgroundPackedUpdatePtr GetBackgroundPackedUpdate(int flags)
+        {
+            if (flags & SimdBackgroundUpdateAdjustRange)
+                return BackgroundPackedUpdate<align, grow, increment, true>;
+            else
+                return BackgroundPackedUpdate<align, grow, increment, false>;
+        }
+
+        template <bool align, bool grow> BackgroundPackedUpdatePtr GetBackgroundPackedUpdate(int flags)
+        {
+            if (flags & SimdBackgroundUpdateIncrementCount)
+                return GetBackgroundPackedUpdate<align, grow, true>(flags);
+            else
+                return GetBackgroundPackedUpdate<align, grow, false>(flags);
+        }
+
+        template <bool align> BackgroundPackedUpdatePtr GetBackgroundPackedUpdate(int flags)
+        {
+            if (flags & SimdBackgroundUpdateGrowRange)
+                return GetBackgroundPackedUpdate<align, true>(flags);
+            else
+                return GetBackgroundPackedUpdate<align, false>(flags);
+        }
+
+        void BackgroundPackedUpdate(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * model, size_t modelStride, uint8_t threshold, int flags)
+        {
+            if ((flags & (SimdBackgroundUpdateGrowRange | SimdBackgroundUpdateIncrementCount | SimdBackgroundUpdateAdjustRange)) == 0)
+                return;
+            BackgroundPackedUpdatePtr backgroundPackedUpdate;
+            if (Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride))
+                backgroundPackedUpdate = GetBackgroundPackedUpdate<true>(flags);
+            else
+                backgroundPackedUpdate = GetBackgroundPackedUpdate<false>(flags);
+            backgroundPackedUpdate(value, valueStride, width, height, model, modelStride, threshold);
+        }
+
+        SIMD_INLINE __m512i BackgroundPackedGrowRangeSlow(__m512i model, const __m512i & value, const __m512i & threshold)
+        {
+            const __mmask64 inc = _mm512_mask_cmpgt_epu8_mask(K64_PACKED_HI_VALUE, value, model);
+            const __mmask64 dec = _mm512_mask_cmplt_epu8_mask(K64_PACKED_LO_VALUE, value, model);
+            model = _mm512_mask_adds_epu8(model, inc, model, K8_01);
+            return _mm512_mask_subs_epu8(model, dec, model, K8_01);
+        }
+
+        SIMD_INLINE __m512i BackgroundPackedShiftRange(__m512i model, const __m512i & value, const __m512i & threshold)
+        {
+            const __m512i add = _mm512_maskz_subs_epu8(K64_PACKED_HI_VALUE, value, model);
+            const __m512i sub = _mm512_maskz_subs_epu8(K64_PACKED_LO_VALUE, model, value);
+            model = _mm512_adds_epu8(model, _mm512_or_si512(add, _mm512_srli_epi32(add, 8)));
+            return _mm512_subs_epu8(model, _mm512_or_si512(sub, _mm512_slli_epi32(sub, 8)));
+        }
+
+        SIMD_INLINE __m512i BackgroundPackedAdjustRangeMasked(__m512i model, const __m512i & mask, const __m512i & threshold)
+        {
+            const __m512i adjusted = BackgroundPackedUpdate<false, false, true>(model, mask, threshold);
+            return _mm512_mask_blend_epi8(_mm512_test_epi8_mask(mask, mask), _mm512_maskz_mov_epi8(K64_PACKED_LO_VALUE | K64_PACKED_HI_VALUE, model), adjusted);
+        }
+
+        typedef __m512i(*BackgroundPackedKernelPtr)(__m512i model, const __m512i & value, const __m512i & threshold);
+
+        template <BackgroundPackedKernelPtr kernel, bool align, bool mask, bool masked> SIMD_INLINE void BackgroundPackedApply(uint8_t * model,
+            const __m512i & value, const __m512i & pixelMask, const __m512i & threshold, __mmask64 tail)
+        {
+            const __m512i _model = Load<align, mask>(model, tail);
+            __mmask64 store = mask ? tail : __mmask64(-1);
+            if (masked)
+                store &= _mm512_test_epi8_mask(pixelMask, pixelMask);
+            Store<align, mask || masked>(model, kernel(_model, value, threshold), store);
+        }
+
+        template <BackgroundPackedKernelPtr kernel, bool align, bool mask, bool masked> SIMD_INLINE void BackgroundPackedApply(const uint8_t * value,
+            const uint8_t * pixelMask, uint8_t * model, const __m512i & threshold, const __mmask64 tails[5])
+        {
+            const __m512i _value = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, Load<align, mask>(value, tails[0]));
+            const __m512i value0 = _mm512_unpacklo_epi8(_value, _value);
+            const __m512i value1 = _mm512_unpackhi_epi8(_value, _value);
+            const __m512i _mask = masked ? _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, Load<align, mask>(pixelMask, tails[0])) : K_ZERO;
+            const __m512i mask0 = _mm512_unpacklo_epi8(_mask, _mask);
+            const __m512i mask1 = _mm512_unpackhi_epi8(_mask, _mask);
+            BackgroundPackedApply<kernel, align, mask, masked>(model + 0 * A, _mm512_unpacklo_epi16(value0, value0), _mm512_unpacklo_epi16(mask0, mask0), threshold, tails[1]);
+            BackgroundPackedApply<kernel, align, mask, masked>(model + 1 * A, _mm512_unpackhi_epi16(value0, value0), _mm512_unpackhi_epi16(mask0, mask0), threshold, tails[2]);
+            BackgroundPackedApply<kernel, align, mask, masked>(model + 2 * A, _mm512_unpacklo_epi16(value1, value1), _mm512_unpacklo_epi16(mask1, mask1), threshold, tails[3]);
+            BackgroundPackedApply<kernel, align, mask, masked>(model + 3 * A, _mm512_unpackhi_epi16(value1, value1), _mm512_unpackhi_epi16(mask1, mask1), threshold, tails[4]);
+        }
+
+        template <BackgroundPackedKernelPtr kernel, bool align, bool masked> void BackgroundPackedApply(const uint8_t * value, size_t valueStride,
+            size_t width, size_t height, uint8_t * model, size_t modelStride, uint8_t threshold, const uint8_t * mask, size_t maskStride)
+        {
+            if (align)
+                assert(Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride) && (!masked || (Aligned(mask) && Aligned(maskStride))));
+
+            const __m512i _threshold = _mm512_set1_epi8((char)threshold);
+            size_t alignedWidth = AlignLo(width, A);
+            __mmask64 tails[5];
+            tails[0] = TailMask64(width - alignedWidth);
+            for (size_t c = 0; c < 4; ++c)
+                tails[1 + c] = TailMask64((width - alignedWidth) * 4 - A * c);
+            for (size_t row = 0; row < height; ++row)
+            {
+                size_t col = 0;
+                for (; col < alignedWidth; col += A)
+                    BackgroundPackedApply<kernel, align, false, masked>(value + col, mask + col, model + 4 * col, _threshold, tails);
+                if (col < width)
+                    BackgroundPackedApply<kernel, align, true, masked>(value + col, mask + col, model + 4 * col, _threshold, tails);
+                value += valueStride;
+                model += modelStride;
+                mask += maskStride;
+            }
+        }
+
+        void BackgroundPackedGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
+        {
+            if (Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride))
+                BackgroundPackedApply<BackgroundPackedGrowRangeSlow, true, false>(value, valueStride, width, height, model, modelStride, 0, value, valueStride);
+            else
+                BackgroundPackedApply<BackgroundPackedGrowRangeSlow, false, false>(value, valueStride, width, height, model, modelStride, 0, value, valueStride);
+        }
+
+        void BackgroundPackedAdjustRangeMasked(uint8_t * model, size_t modelStride, size_t width, size_t height,
+            uint8_t threshold, const uint8_t * mask, size_t maskStride)
+        {
+            if (Aligned(model) && Aligned(modelStride) && Aligned(mask) && Aligned(maskStride))
+                BackgroundPackedApply<BackgroundPackedAdjustRangeMasked, true, false>(mask, maskStride, width, height, model, modelStride, threshold, mask, maskStride);
+            else
+                BackgroundPackedApply<BackgroundPackedAdjustRangeMasked, false, false>(mask, maskStride, width, height, model, modelStride, threshold, mask, maskStride);
+        }
+
+        void BackgroundPackedShiftRange(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
+        {
+            if (Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride))
+                BackgroundPackedApply<BackgroundPackedShiftRange, true, false>(value, valueStride, width, height, model, modelStride, 0, value, valueStride);
+            else
+                BackgroundPackedApply<BackgroundPackedShiftRange, false, false>(value, valueStride, width, height, model, modelStride, 0, value, valueStride);
+        }
+
+        void BackgroundPackedShiftRangeMasked(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * model, size_t modelStride, const uint8_t * mask, size_t maskStride)
+        {
+            if (Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride) && Aligned(mask) && Aligned(maskStride))
+                BackgroundPackedApply<BackgroundPackedShiftRange, true, true>(value, valueStride, width, height, model, modelStride, 0, mask, maskStride);
+            else
+                BackgroundPackedApply<BackgroundPackedShiftRange, false, true>(value, valueStride, width, height, model, modelStride, 0, mask, maskStride);
+        }
     }
 #endif// SIMD_AVX512BW_ENABLE
 }
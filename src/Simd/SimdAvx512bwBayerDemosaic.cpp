@@ -0,0 +1,174 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdStore.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdBayer.h"
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        const __m512i K16_BLUE_RED = SIMD_MM512_SET2_EPI16(Base::BLUE_TO_GRAY_WEIGHT, Base::RED_TO_GRAY_WEIGHT);
+        const __m512i K16_GREEN_ROUND = SIMD_MM512_SET2_EPI16(Base::GREEN_TO_GRAY_WEIGHT, Base::BGR_TO_GRAY_ROUND_TERM);
+
+        SIMD_INLINE __m512i BgrToGray16(__m512i blue, __m512i green, __m512i red)
+        {
+            __m512i lo = _mm512_add_epi32(_mm512_madd_epi16(_mm512_unpacklo_epi16(blue, red), K16_BLUE_RED), _mm512_madd_epi16(_mm512_unpacklo_epi16(green, K16_0001), K16_GREEN_ROUND));
+            __m512i hi = _mm512_add_epi32(_mm512_madd_epi16(_mm512_unpackhi_epi16(blue, red), K16_BLUE_RED), _mm512_madd_epi16(_mm512_unpackhi_epi16(green, K16_0001), K16_GREEN_ROUND));
+            return _mm512_packs_epi32(_mm512_srli_epi32(lo, Base::BGR_TO_GRAY_AVERAGING_SHIFT), _mm512_srli_epi32(hi, Base::BGR_TO_GRAY_AVERAGING_SHIFT));
+        }
+
+        template<size_t channels> SIMD_INLINE void BayerMhcStore(const __m512i bgr[3], const __m512i & alpha, uint8_t * dst);
+
+        template<> SIMD_INLINE void BayerMhcStore<1>(const __m512i bgr[3], const __m512i & alpha, uint8_t * dst)
+        {
+            __m512i even = BgrToGray16(U8To16<0>(bgr[0]), U8To16<0>(bgr[1]), U8To16<0>(bgr[2]));
+            __m512i odd = BgrToGray16(U8To16<1>(bgr[0]), U8To16<1>(bgr[1]), U8To16<1>(bgr[2]));
+            _mm512_storeu_si512((__m512i*)dst, _mm512_or_si512(even, _mm512_slli_epi16(odd, 8)));
+        }
+
+        template<> SIMD_INLINE void BayerMhcStore<3>(const __m512i bgr[3], const __m512i & alpha, uint8_t * dst)
+        {
+            _mm512_storeu_si512((__m512i*)dst + 0, InterleaveBgr<0>(bgr[0], bgr[1], bgr[2]));
+            _mm512_storeu_si512((__m512i*)dst + 1, InterleaveBgr<1>(bgr[0], bgr[1], bgr[2]));
+            _mm512_storeu_si512((__m512i*)dst + 2, InterleaveBgr<2>(bgr[0], bgr[1], bgr[2]));
+        }
+
+        template<> SIMD_INLINE void BayerMhcStore<4>(const __m512i bgr[3], const __m512i & alpha, uint8_t * dst)
+        {
+            __m512i b = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, bgr[0]);
+            __m512i g = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, bgr[1]);
+            __m512i r = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, bgr[2]);
+            __m512i bgLo = UnpackU8<0>(b, g);
+            __m512i bgHi = UnpackU8<1>(b, g);
+            __m512i raLo = UnpackU8<0>(r, alpha);
+            __m512i raHi = UnpackU8<1>(r, alpha);
+            _mm512_storeu_si512((__m512i*)dst + 0, UnpackU16<0>(bgLo, raLo));
+            _mm512_storeu_si512((__m512i*)dst + 1, UnpackU16<1>(bgLo, raLo));
+            _mm512_storeu_si512((__m512i*)dst + 2, UnpackU16<0>(bgHi, raHi));
+            _mm512_storeu_si512((__m512i*)dst + 3, UnpackU16<1>(bgHi, raHi));
+        }
+
+        template<size_t channels, bool greenOdd> SIMD_INLINE void BayerMhcBody(const uint8_t * src[5], size_t width, bool red, const __m512i & alpha, uint8_t * dst)
+        {
+            size_t body = AlignLo(width - 4, A) + 2, tail = width - 2 - A;
+            __m512i bgr[3];
+            for (size_t col = 2; col < body; col += A)
+            {
+                BayerMhc<greenOdd>(src, col, red, bgr);
+                BayerMhcStore<channels>(bgr, alpha, dst + col * channels);
+            }
+            if (body < width - 2)
+            {
+                BayerMhc<greenOdd>(src, tail, red, bgr);
+                BayerMhcStore<channels>(bgr, alpha, dst + tail * channels);
+            }
+        }
+
+        template<size_t channels> void BayerMhc(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && width >= A + 4);
+
+            const uint8_t * src[5];
+            size_t greenOdd;
+            bool red;
+            __m512i _alpha = _mm512_set1_epi8((char)alpha);
+            for (size_t row = 0; row < height; ++row)
+            {
+                Base::BayerMhcRows(bayer, height, bayerStride, row, src);
+                Base::BayerMhcRowInfo(bayerFormat, row, greenOdd, red);
+                Base::BayerMhc<channels>(src, 0, 2, width, greenOdd, red, dst, alpha);
+                if (greenOdd)
+                    BayerMhcBody<channels, true>(src, width, red, _alpha, dst);
+                else
+                    BayerMhcBody<channels, false>(src, width, red, _alpha, dst);
+                Base::BayerMhc<channels>(src, width - 2, width, width, greenOdd, red, dst, alpha);
+                dst += dstStride;
+            }
+        }
+
+        void BayerToBgrMhc(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride)
+        {
+            BayerMhc<3>(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride, 0);
+        }
+
+        void BayerToBgraMhc(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            BayerMhc<4>(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
+        }
+
+        void BayerToGray(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * gray, size_t grayStride)
+        {
+            BayerMhc<1>(bayer, width, height, bayerStride, bayerFormat, gray, grayStride, 0);
+        }
+
+        template <SimdPixelFormatType bayerFormat> void BayerToBgrHalf(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, uint8_t * bgr, size_t bgrStride)
+        {
+            size_t widthDA = AlignLo(width, DA);
+            __m512i _bgr[3];
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0; col < widthDA; col += DA)
+                {
+                    BayerToBgrHalf<bayerFormat>(bayer + col, bayer + bayerStride + col, _bgr);
+                    BayerMhcStore<3>(_bgr, K_ZERO, bgr + col / 2 * 3);
+                }
+                if (widthDA != width)
+                {
+                    size_t col = width - DA;
+                    BayerToBgrHalf<bayerFormat>(bayer + col, bayer + bayerStride + col, _bgr);
+                    BayerMhcStore<3>(_bgr, K_ZERO, bgr + col / 2 * 3);
+                }
+                bayer += 2 * bayerStride;
+                bgr += bgrStride;
+            }
+        }
+
+        void BayerToBgrHalf(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && width >= DA);
+
+            switch (bayerFormat)
+            {
+            case SimdPixelFormatBayerGrbg:
+                BayerToBgrHalf<SimdPixelFormatBayerGrbg>(bayer, width, height, bayerStride, bgr, bgrStride);
+                break;
+            case SimdPixelFormatBayerGbrg:
+                BayerToBgrHalf<SimdPixelFormatBayerGbrg>(bayer, width, height, bayerStride, bgr, bgrStride);
+                break;
+            case SimdPixelFormatBayerRggb:
+                BayerToBgrHalf<SimdPixelFormatBayerRggb>(bayer, width, height, bayerStride, bgr, bgrStride);
+                break;
+            case SimdPixelFormatBayerBggr:
+                BayerToBgrHalf<SimdPixelFormatBayerBggr>(bayer, width, height, bayerStride, bgr, bgrStride);
+                break;
+            default:
+                assert(0);
+            }
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
@@ -35,7 +35,13 @@ namespace Simd
             0x0, 0x1, 0x2, -1, 0x3, 0x4, 0x5, -1, 0x6, 0x7, 0x8, -1, 0x9, 0xA, 0xB, -1,
             0x0, 0x1, 0x2, -1, 0x3, 0x4, 0x5, -1, 0x6, 0x7, 0x8, -1, 0x9, 0xA, 0xB, -1);
 
-        template <bool align, bool mask> SIMD_INLINE void BgrToBgra(const uint8_t * bgr, uint8_t * bgra, const __m512i & alpha, const __mmask64 * ms)
+        const __m512i K8_SHUFFLE_BGR_TO_RGBA = SIMD_MM512_SETR_EPI8(
+            0x2, 0x1, 0x0, -1, 0x5, 0x4, 0x3, -1, 0x8, 0x7, 0x6, -1, 0xB, 0xA, 0x9, -1,
+            0x2, 0x1, 0x0, -1, 0x5, 0x4, 0x3, -1, 0x8, 0x7, 0x6, -1, 0xB, 0xA, 0x9, -1,
+            0x2, 0x1, 0x0, -1, 0x5, 0x4, 0x3, -1, 0x8, 0x7, 0x6, -1, 0xB, 0xA, 0x9, -1,
+            0x2, 0x1, 0x0, -1, 0x5, 0x4, 0x3, -1, 0x8, 0x7, 0x6, -1, 0xB, 0xA, 0x9, -1);
+
+        template <bool align, bool mask, bool rgb> SIMD_INLINE void BgrToBgra(const uint8_t * bgr, uint8_t * bgra, const __m512i & alpha, const __mmask64 * ms)
         {
             __m512i bgr0 = Load<align, mask>(bgr + 0 * A, ms[0]);
             __m512i bgr1 = Load<align, mask>(bgr + 1 * A, ms[1]);
@@ -45,14 +51,15 @@ namespace Simd
             const __m512i bgra1 = _mm512_permutex2var_epi32(bgr0, K32_PERMUTE_BGR_TO_BGRA_1, bgr1);
             const __m512i bgra2 = _mm512_permutex2var_epi32(bgr1, K32_PERMUTE_BGR_TO_BGRA_2, bgr2);
             const __m512i bgra3 = _mm512_permutexvar_epi32(K32_PERMUTE_BGR_TO_BGRA_3, bgr2);
+            const __m512i shuffle = rgb ? K8_SHUFFLE_BGR_TO_RGBA : K8_SHUFFLE_BGR_TO_BGRA;
 
-            Store<align, mask>(bgra + 0 * A, _mm512_or_si512(alpha, _mm512_shuffle_epi8(bgra0, K8_SHUFFLE_BGR_TO_BGRA)), ms[3]);
-            Store<align, mask>(bgra + 1 * A, _mm512_or_si512(alpha, _mm512_shuffle_epi8(bgra1, K8_SHUFFLE_BGR_TO_BGRA)), ms[4]);
-            Store<align, mask>(bgra + 2 * A, _mm512_or_si512(alpha, _mm512_shuffle_epi8(bgra2, K8_SHUFFLE_BGR_TO_BGRA)), ms[5]);
-            Store<align, mask>(bgra + 3 * A, _mm512_or_si512(alpha, _mm512_shuffle_epi8(bgra3, K8_SHUFFLE_BGR_TO_BGRA)), ms[6]);
+            Store<align, mask>(bgra + 0 * A, _mm512_or_si512(alpha, _mm512_shuffle_epi8(bgra0, shuffle)), ms[3]);
+            Store<align, mask>(bgra + 1 * A, _mm512_or_si512(alpha, _mm512_shuffle_epi8(bgra1, shuffle)), ms[4]);
+            Store<align, mask>(bgra + 2 * A, _mm512_or_si512(alpha, _mm512_shuffle_epi8(bgra2, shuffle)), ms[5]);
+            Store<align, mask>(bgra + 3 * A, _mm512_or_si512(alpha, _mm512_shuffle_epi8(bgra3, shuffle)), ms[6]);
         }
 
-        template <bool align> void BgrToBgra(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        template <bool align, bool rgb> void BgrToBgra(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
         {
             if (align)
                 assert(Aligned(bgra) && Aligned(bgraStride) && Aligned(bgr) && Aligned(bgrStride));
@@ -68,9 +75,9 @@ namespace Simd
             {
                 size_t col = 0;
                 for (; col < alignedWidth; col += A)
-                    BgrToBgra<align, false>(bgr + 3 * col, bgra + 4 * col, _alpha, tailMasks);
+                    BgrToBgra<align, false, rgb>(bgr + 3 * col, bgra + 4 * col, _alpha, tailMasks);
                 if (col < width)
-                    BgrToBgra<align, true>(bgr + 3 * col, bgra + 4 * col, _alpha, tailMasks);
+                    BgrToBgra<align, true, rgb>(bgr + 3 * col, bgra + 4 * col, _alpha, tailMasks);
                 bgr += bgrStride;
                 bgra += bgraStride;
             }
@@ -79,9 +86,17 @@ namespace Simd
         void BgrToBgra(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
         {
             if (Aligned(bgra) && Aligned(bgraStride) && Aligned(bgr) && Aligned(bgrStride))
-                BgrToBgra<true>(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
+                BgrToBgra<true, false>(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
+            else
+                BgrToBgra<false, false>(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
+        }
+
+        void BgrToRgba(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * rgba, size_t rgbaStride, uint8_t alpha)
+        {
+            if (Aligned(rgba) && Aligned(rgbaStride) && Aligned(bgr) && Aligned(bgrStride))
+                BgrToBgra<true, true>(bgr, width, height, bgrStride, rgba, rgbaStride, alpha);
             else
-                BgrToBgra<false>(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
+                BgrToBgra<false, true>(bgr, width, height, bgrStride, rgba, rgbaStride, alpha);
         }
 
         template <bool align, bool mask> SIMD_INLINE void Bgr48pToBgra32(
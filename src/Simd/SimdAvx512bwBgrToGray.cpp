@@ -31,18 +31,19 @@ namespace Simd
     namespace Avx512bw
     {
         const __m512i K16_BLUE_RED = SIMD_MM512_SET2_EPI16(Base::BLUE_TO_GRAY_WEIGHT, Base::RED_TO_GRAY_WEIGHT);
+        const __m512i K16_RED_BLUE = SIMD_MM512_SET2_EPI16(Base::RED_TO_GRAY_WEIGHT, Base::BLUE_TO_GRAY_WEIGHT);
         const __m512i K16_GREEN_0000 = SIMD_MM512_SET2_EPI16(Base::GREEN_TO_GRAY_WEIGHT, 0x0000);
         const __m512i K32_ROUND_TERM = SIMD_MM512_SET1_EPI32(Base::BGR_TO_GRAY_ROUND_TERM);
 
-        SIMD_INLINE __m512i PermutedBgrToGray32(__m512i permutedBgr)
+        template <bool rgb> SIMD_INLINE __m512i PermutedBgrToGray32(__m512i permutedBgr)
         {
             const __m512i b0r0 = _mm512_shuffle_epi8(permutedBgr, K8_SUFFLE_BGR_TO_B0R0);
             const __m512i g000 = _mm512_shuffle_epi8(permutedBgr, K8_SUFFLE_BGR_TO_G000);
-            const __m512i weightedSum = _mm512_add_epi32(_mm512_madd_epi16(g000, K16_GREEN_0000), _mm512_madd_epi16(b0r0, K16_BLUE_RED));
+            const __m512i weightedSum = _mm512_add_epi32(_mm512_madd_epi16(g000, K16_GREEN_0000), _mm512_madd_epi16(b0r0, rgb ? K16_RED_BLUE : K16_BLUE_RED));
             return _mm512_srli_epi32(_mm512_add_epi32(weightedSum, K32_ROUND_TERM), Base::BGR_TO_GRAY_AVERAGING_SHIFT);
         }
 
-        template <bool align, bool mask> SIMD_INLINE void BgrToGray(const uint8_t * bgr, uint8_t * gray, const __mmask64 ms[4])
+        template <bool align, bool mask, bool rgb> SIMD_INLINE void BgrToGray(const uint8_t * bgr, uint8_t * gray, const __mmask64 ms[4])
         {
             const __m512i bgr0 = Load<align, mask>(bgr + 0 * A, ms[0]);
             const __m512i bgr1 = Load<align, mask>(bgr + 1 * A, ms[1]);
@@ -53,10 +54,10 @@ namespace Simd
             const __m512i permutedBgr2 = _mm512_permutex2var_epi32(bgr1, K32_PERMUTE_BGR_TO_BGRA_2, bgr2);
             const __m512i permutedBgr3 = _mm512_permutexvar_epi32(K32_PERMUTE_BGR_TO_BGRA_3, bgr2);
 
-            __m512i gray0 = PermutedBgrToGray32(permutedBgr0);
-            __m512i gray1 = PermutedBgrToGray32(permutedBgr1);
-            __m512i gray2 = PermutedBgrToGray32(permutedBgr2);
-            __m512i gray3 = PermutedBgrToGray32(permutedBgr3);
+            __m512i gray0 = PermutedBgrToGray32<rgb>(permutedBgr0);
+            __m512i gray1 = PermutedBgrToGray32<rgb>(permutedBgr1);
+            __m512i gray2 = PermutedBgrToGray32<rgb>(permutedBgr2);
+            __m512i gray3 = PermutedBgrToGray32<rgb>(permutedBgr3);
 
             __m512i gray01 = _mm512_packs_epi32(gray0, gray1);
             __m512i gray23 = _mm512_packs_epi32(gray2, gray3);
@@ -64,7 +65,7 @@ namespace Simd
             Store<align, mask>(gray, _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, gray0123), ms[3]);
         }
 
-        template <bool align> void BgrToGray(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * gray, size_t grayStride)
+        template <bool align, bool rgb> void BgrToGray(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * gray, size_t grayStride)
         {
             if (align)
                 assert(Aligned(gray) && Aligned(grayStride) && Aligned(bgr) && Aligned(bgrStride));
@@ -78,9 +79,9 @@ namespace Simd
             {
                 size_t col = 0;
                 for (; col < alignedWidth; col += A)
-                    BgrToGray<align, false>(bgr + col * 3, gray + col, tailMasks);
+                    BgrToGray<align, false, rgb>(bgr + col * 3, gray + col, tailMasks);
                 if (col < width)
-                    BgrToGray<align, true>(bgr + col * 3, gray + col, tailMasks);
+                    BgrToGray<align, true, rgb>(bgr + col * 3, gray + col, tailMasks);
                 bgr += bgrStride;
                 gray += grayStride;
             }
@@ -89,9 +90,17 @@ namespace Simd
         void BgrToGray(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * gray, size_t grayStride)
         {
             if (Aligned(gray) && Aligned(grayStride) && Aligned(bgr) && Aligned(bgrStride))
-                BgrToGray<true>(bgr, width, height, bgrStride, gray, grayStride);
+                BgrToGray<true, false>(bgr, width, height, bgrStride, gray, grayStride);
             else
-                BgrToGray<false>(bgr, width, height, bgrStride, gray, grayStride);
+                BgrToGray<false, false>(bgr, width, height, bgrStride, gray, grayStride);
+        }
+
+        void RgbToGray(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * gray, size_t grayStride)
+        {
+            if (Aligned(gray) && Aligned(grayStride) && Aligned(rgb) && Aligned(rgbStride))
+                BgrToGray<true, true>(rgb, width, height, rgbStride, gray, grayStride);
+            else
+                BgrToGray<false, true>(rgb, width, height, rgbStride, gray, grayStride);
         }
     }
 #endif//SIMD_AVX512BW_ENABLE
@@ -0,0 +1,249 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        const __m512i K16_01FE = SIMD_MM512_SET1_EPI16(0x01FE);
+
+        template<int part> SIMD_INLINE __m512i BgrToHue16(__m512i blue, __m512i green, __m512i red, __m512i max, __m512i range)
+        {
+            __m512i b = UnpackU8<part>(blue), g = UnpackU8<part>(green), r = UnpackU8<part>(red);
+            __m512i m = UnpackU8<part>(max), d = UnpackU8<part>(range);
+            __m512i dividend = _mm512_add_epi16(_mm512_sub_epi16(r, g), _mm512_slli_epi16(d, 2));
+            dividend = _mm512_mask_blend_epi16(_mm512_cmpeq_epi16_mask(g, m), dividend, _mm512_add_epi16(_mm512_sub_epi16(b, r), _mm512_slli_epi16(d, 1)));
+            dividend = _mm512_mask_blend_epi16(_mm512_cmpeq_epi16_mask(r, m), dividend, _mm512_add_epi16(_mm512_sub_epi16(g, b), _mm512_mullo_epi16(d, K16_0006)));
+            __m512 k = _mm512_set1_ps(Base::KF_255_DIV_6);
+            __m512i lo = _mm512_cvttps_epi32(_mm512_div_ps(_mm512_mul_ps(_mm512_cvtepi32_ps(UnpackU16<0>(dividend)), k), _mm512_cvtepi32_ps(UnpackU16<0>(d))));
+            __m512i hi = _mm512_cvttps_epi32(_mm512_div_ps(_mm512_mul_ps(_mm512_cvtepi32_ps(UnpackU16<1>(dividend)), k), _mm512_cvtepi32_ps(UnpackU16<1>(d))));
+            __m512i hue = _mm512_packs_epi32(_mm512_and_si512(lo, K32_000000FF), _mm512_and_si512(hi, K32_000000FF));
+            return _mm512_maskz_mov_epi16(_mm512_cmpneq_epi16_mask(d, K_ZERO), hue);
+        }
+
+        SIMD_INLINE __m512i BgrToHue(__m512i blue, __m512i green, __m512i red, __m512i max, __m512i range)
+        {
+            return _mm512_packus_epi16(BgrToHue16<0>(blue, green, red, max, range), BgrToHue16<1>(blue, green, red, max, range));
+        }
+
+        SIMD_INLINE __m512i Saturation16(__m512i range, __m512i divisor)
+        {
+            __m512i dividend = _mm512_mullo_epi16(range, K16_00FF);
+            __m512i lo = _mm512_cvttps_epi32(_mm512_div_ps(_mm512_cvtepi32_ps(UnpackU16<0>(dividend)), _mm512_cvtepi32_ps(UnpackU16<0>(divisor))));
+            __m512i hi = _mm512_cvttps_epi32(_mm512_div_ps(_mm512_cvtepi32_ps(UnpackU16<1>(dividend)), _mm512_cvtepi32_ps(UnpackU16<1>(divisor))));
+            return _mm512_maskz_mov_epi16(_mm512_cmpneq_epi16_mask(divisor, K_ZERO), _mm512_packs_epi32(lo, hi));
+        }
+
+        template<int part> SIMD_INLINE __m512i HslSaturation16(__m512i range, __m512i sum)
+        {
+            return Saturation16(UnpackU8<part>(range), _mm512_min_epi16(sum, _mm512_sub_epi16(K16_01FE, sum)));
+        }
+
+        template<bool hsl> SIMD_INLINE void BgrToHsx(__m512i blue, __m512i green, __m512i red, __m512i hsx[3])
+        {
+            __m512i max = _mm512_max_epu8(_mm512_max_epu8(blue, green), red);
+            __m512i min = _mm512_min_epu8(_mm512_min_epu8(blue, green), red);
+            __m512i range = _mm512_sub_epi8(max, min);
+            hsx[0] = BgrToHue(blue, green, red, max, range);
+            if (hsl)
+            {
+                __m512i sumLo = _mm512_add_epi16(UnpackU8<0>(max), UnpackU8<0>(min));
+                __m512i sumHi = _mm512_add_epi16(UnpackU8<1>(max), UnpackU8<1>(min));
+                hsx[1] = _mm512_packus_epi16(HslSaturation16<0>(range, sumLo), HslSaturation16<1>(range, sumHi));
+                hsx[2] = _mm512_packus_epi16(_mm512_srli_epi16(sumLo, 1), _mm512_srli_epi16(sumHi, 1));
+            }
+            else
+            {
+                hsx[1] = _mm512_packus_epi16(Saturation16(UnpackU8<0>(range), UnpackU8<0>(max)), Saturation16(UnpackU8<1>(range), UnpackU8<1>(max)));
+                hsx[2] = max;
+            }
+        }
+
+        SIMD_INLINE void LoadBgr(const uint8_t * bgr, __m512i & blue, __m512i & green, __m512i & red)
+        {
+            __m256i lo[3], hi[3];
+            lo[0] = _mm256_loadu_si256((__m256i*)bgr + 0);
+            lo[1] = _mm256_loadu_si256((__m256i*)bgr + 1);
+            lo[2] = _mm256_loadu_si256((__m256i*)bgr + 2);
+            hi[0] = _mm256_loadu_si256((__m256i*)bgr + 3);
+            hi[1] = _mm256_loadu_si256((__m256i*)bgr + 4);
+            hi[2] = _mm256_loadu_si256((__m256i*)bgr + 5);
+            blue = _mm512_inserti64x4(_mm512_castsi256_si512(Avx2::BgrToBlue(lo)), Avx2::BgrToBlue(hi), 1);
+            green = _mm512_inserti64x4(_mm512_castsi256_si512(Avx2::BgrToGreen(lo)), Avx2::BgrToGreen(hi), 1);
+            red = _mm512_inserti64x4(_mm512_castsi256_si512(Avx2::BgrToRed(lo)), Avx2::BgrToRed(hi), 1);
+        }
+
+        SIMD_INLINE void StoreHsx(const __m512i hsx[3], uint8_t * dst)
+        {
+            _mm512_storeu_si512((__m512i*)dst + 0, InterleaveBgr<0>(hsx[0], hsx[1], hsx[2]));
+            _mm512_storeu_si512((__m512i*)dst + 1, InterleaveBgr<1>(hsx[0], hsx[1], hsx[2]));
+            _mm512_storeu_si512((__m512i*)dst + 2, InterleaveBgr<2>(hsx[0], hsx[1], hsx[2]));
+        }
+
+        template<bool hsl> SIMD_INLINE void BgrToHsx(const uint8_t * bgr, uint8_t * hsx)
+        {
+            __m512i blue, green, red, _hsx[3];
+            LoadBgr(bgr, blue, green, red);
+            BgrToHsx<hsl>(blue, green, red, _hsx);
+            StoreHsx(_hsx, hsx);
+        }
+
+        template<bool hsl> void BgrToHsx(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsx, size_t hsxStride)
+        {
+            assert(width >= A);
+
+            size_t widthA = AlignLo(width, A), tail = (width - A) * 3;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA * 3; col += A * 3)
+                    BgrToHsx<hsl>(bgr + col, hsx + col);
+                if (widthA < width)
+                    BgrToHsx<hsl>(bgr + tail, hsx + tail);
+                bgr += bgrStride;
+                hsx += hsxStride;
+            }
+        }
+
+        void BgrToHsl(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsl, size_t hslStride)
+        {
+            BgrToHsx<true>(bgr, width, height, bgrStride, hsl, hslStride);
+        }
+
+        void BgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride)
+        {
+            BgrToHsx<false>(bgr, width, height, bgrStride, hsv, hsvStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        template<bool hsl, class T> SIMD_INLINE void Yuv444pToHsx(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * hsx)
+        {
+            __m512i _y = _mm512_loadu_si512((__m512i*)y), _u = _mm512_loadu_si512((__m512i*)u), _v = _mm512_loadu_si512((__m512i*)v), _hsx[3];
+            BgrToHsx<hsl>(YuvToBlue<T>(_y, _u), YuvToGreen<T>(_y, _u, _v), YuvToRed<T>(_y, _v), _hsx);
+            StoreHsx(_hsx, hsx);
+        }
+
+        template<bool hsl, class T> void Yuv444pToHsx(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsx, size_t hsxStride)
+        {
+            assert(width >= A);
+
+            size_t widthA = AlignLo(width, A), tail = width - A;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                    Yuv444pToHsx<hsl, T>(y + col, u + col, v + col, hsx + col * 3);
+                if (widthA < width)
+                    Yuv444pToHsx<hsl, T>(y + tail, u + tail, v + tail, hsx + tail * 3);
+                y += yStride;
+                u += uStride;
+                v += vStride;
+                hsx += hsxStride;
+            }
+        }
+
+        void Yuv444pToHsl(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsl, size_t hslStride)
+        {
+            Yuv444pToHsx<true, Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride);
+        }
+
+        void Yuv444pToHslV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsl, size_t hslStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv444pToHsx<true, Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride); break;
+            case SimdYuvBt709: Yuv444pToHsx<true, Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride); break;
+            case SimdYuvBt2020: Yuv444pToHsx<true, Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride); break;
+            case SimdYuvBt601Full: Yuv444pToHsx<true, Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride); break;
+            case SimdYuvBt709Full: Yuv444pToHsx<true, Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride); break;
+            case SimdYuvBt2020Full: Yuv444pToHsx<true, Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride); break;
+            default: assert(0);
+            }
+        }
+
+        void Yuv444pToHsv(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsv, size_t hsvStride)
+        {
+            Yuv444pToHsx<false, Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride);
+        }
+
+        void Yuv444pToHsvV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsv, size_t hsvStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv444pToHsx<false, Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride); break;
+            case SimdYuvBt709: Yuv444pToHsx<false, Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride); break;
+            case SimdYuvBt2020: Yuv444pToHsx<false, Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride); break;
+            case SimdYuvBt601Full: Yuv444pToHsx<false, Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride); break;
+            case SimdYuvBt709Full: Yuv444pToHsx<false, Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride); break;
+            case SimdYuvBt2020Full: Yuv444pToHsx<false, Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride); break;
+            default: assert(0);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void BgrToHsvInRange(const uint8_t * bgr, const __m512i lower[3], const __m512i upper[3], bool wrap, uint8_t * mask)
+        {
+            __m512i blue, green, red, hsv[3];
+            LoadBgr(bgr, blue, green, red);
+            BgrToHsx<false>(blue, green, red, hsv);
+            __mmask64 hueLower = _mm512_cmpge_epu8_mask(hsv[0], lower[0]), hueUpper = _mm512_cmple_epu8_mask(hsv[0], upper[0]);
+            __mmask64 hue = wrap ? (hueLower | hueUpper) : (hueLower & hueUpper);
+            __mmask64 saturation = _mm512_cmpge_epu8_mask(hsv[1], lower[1]) & _mm512_cmple_epu8_mask(hsv[1], upper[1]);
+            __mmask64 value = _mm512_cmpge_epu8_mask(hsv[2], lower[2]) & _mm512_cmple_epu8_mask(hsv[2], upper[2]);
+            _mm512_storeu_si512((__m512i*)mask, _mm512_movm_epi8(hue & saturation & value));
+        }
+
+        void BgrToHsvInRange(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, const uint8_t * lower, const uint8_t * upper, uint8_t * mask, size_t maskStride)
+        {
+            assert(width >= A);
+
+            __m512i _lower[3], _upper[3];
+            for (size_t c = 0; c < 3; ++c)
+            {
+                _lower[c] = _mm512_set1_epi8((char)lower[c]);
+                _upper[c] = _mm512_set1_epi8((char)upper[c]);
+            }
+            bool wrap = lower[0] > upper[0];
+            size_t widthA = AlignLo(width, A), tail = width - A;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                    BgrToHsvInRange(bgr + col * 3, _lower, _upper, wrap, mask + col);
+                if (widthA < width)
+                    BgrToHsvInRange(bgr + tail * 3, _lower, _upper, wrap, mask + tail);
+                bgr += bgrStride;
+                mask += maskStride;
+            }
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
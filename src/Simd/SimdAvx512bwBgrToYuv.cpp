@@ -38,20 +38,20 @@ namespace Simd
             g16_1 = _mm512_shuffle_epi8(bgr1, K8_SUFFLE_BGR_TO_G010);
         }
 
-        template <bool align, bool mask> SIMD_INLINE __m512i LoadAndConvertBgrToY16(const uint8_t * bgr, __m512i & b16_r16, __m512i & g16_1, const __mmask64 * ms)
+        template <bool align, bool mask, class T = Base::Bt601> SIMD_INLINE __m512i LoadAndConvertBgrToY16(const uint8_t * bgr, __m512i & b16_r16, __m512i & g16_1, const __mmask64 * ms)
         {
             __m512i _b16_r16[2], _g16_1[2];
             LoadPreparedBgr16<align, mask>(bgr + 00, _b16_r16[0], _g16_1[0], ms + 0);
             LoadPreparedBgr16<false, mask>(bgr + 48, _b16_r16[1], _g16_1[1], ms + 1);
             b16_r16 = Hadd32(_b16_r16[0], _b16_r16[1]);
             g16_1 = Hadd32(_g16_1[0], _g16_1[1]);
-            return Saturate16iTo8u(_mm512_add_epi16(K16_Y_ADJUST, _mm512_packs_epi32(BgrToY32(_b16_r16[0], _g16_1[0]), BgrToY32(_b16_r16[1], _g16_1[1]))));
+            return Saturate16iTo8u(_mm512_add_epi16(_mm512_set1_epi16(T::Y_ADJUST), _mm512_packs_epi32(BgrToY32<T>(_b16_r16[0], _g16_1[0]), BgrToY32<T>(_b16_r16[1], _g16_1[1]))));
         }
 
-        template <bool align, bool mask> SIMD_INLINE __m512i LoadAndConvertBgrToY8(const uint8_t * bgr, __m512i b16_r16[2], __m512i g16_1[2], const __mmask64 * ms)
+        template <bool align, bool mask, class T = Base::Bt601> SIMD_INLINE __m512i LoadAndConvertBgrToY8(const uint8_t * bgr, __m512i b16_r16[2], __m512i g16_1[2], const __mmask64 * ms)
         {
-            __m512i lo = LoadAndConvertBgrToY16<align, mask>(bgr + 00, b16_r16[0], g16_1[0], ms + 0);
-            __m512i hi = LoadAndConvertBgrToY16<false, mask>(bgr + 96, b16_r16[1], g16_1[1], ms + 2);
+            __m512i lo = LoadAndConvertBgrToY16<align, mask, T>(bgr + 00, b16_r16[0], g16_1[0], ms + 0);
+            __m512i hi = LoadAndConvertBgrToY16<false, mask, T>(bgr + 96, b16_r16[1], g16_1[1], ms + 2);
             return Permuted2Pack16iTo8u(lo, hi);
         }
 
@@ -60,26 +60,26 @@ namespace Simd
             a = _mm512_srli_epi16(_mm512_add_epi16(_mm512_add_epi16(a, b), K16_0002), 2);
         }
 
-        SIMD_INLINE __m512i ConvertU16(__m512i b16_r16[2], __m512i g16_1[2])
+        template <class T = Base::Bt601> SIMD_INLINE __m512i ConvertU16(__m512i b16_r16[2], __m512i g16_1[2])
         {
-            return Saturate16iTo8u(_mm512_add_epi16(K16_UV_ADJUST, _mm512_packs_epi32(BgrToU32(b16_r16[0], g16_1[0]), BgrToU32(b16_r16[1], g16_1[1]))));
+            return Saturate16iTo8u(_mm512_add_epi16(K16_UV_ADJUST, _mm512_packs_epi32(BgrToU32<T>(b16_r16[0], g16_1[0]), BgrToU32<T>(b16_r16[1], g16_1[1]))));
         }
 
-        SIMD_INLINE __m512i ConvertV16(__m512i b16_r16[2], __m512i g16_1[2])
+        template <class T = Base::Bt601> SIMD_INLINE __m512i ConvertV16(__m512i b16_r16[2], __m512i g16_1[2])
         {
-            return Saturate16iTo8u(_mm512_add_epi16(K16_UV_ADJUST, _mm512_packs_epi32(BgrToV32(b16_r16[0], g16_1[0]), BgrToV32(b16_r16[1], g16_1[1]))));
+            return Saturate16iTo8u(_mm512_add_epi16(K16_UV_ADJUST, _mm512_packs_epi32(BgrToV32<T>(b16_r16[0], g16_1[0]), BgrToV32<T>(b16_r16[1], g16_1[1]))));
         }
 
-        template <bool align, bool mask> SIMD_INLINE void BgrToYuv420p(const uint8_t * bgr0, size_t bgrStride, uint8_t * y0, size_t yStride, uint8_t * u, uint8_t * v, const __mmask64 * ms)
+        template <bool align, bool mask, class T = Base::Bt601> SIMD_INLINE void BgrToYuv420p(const uint8_t * bgr0, size_t bgrStride, uint8_t * y0, size_t yStride, __m512i & u, __m512i & v, const __mmask64 * ms)
         {
             const uint8_t * bgr1 = bgr0 + bgrStride;
             uint8_t * y1 = y0 + yStride;
 
             __m512i _b16_r16[2][2][2], _g16_1[2][2][2];
-            Store<align, mask>(y0 + 0, LoadAndConvertBgrToY8<align, mask>(bgr0 + 0 * A, _b16_r16[0][0], _g16_1[0][0], ms + 0), ms[8]);
-            Store<align, mask>(y0 + A, LoadAndConvertBgrToY8<align, mask>(bgr0 + 3 * A, _b16_r16[0][1], _g16_1[0][1], ms + 4), ms[9]);
-            Store<align, mask>(y1 + 0, LoadAndConvertBgrToY8<align, mask>(bgr1 + 0 * A, _b16_r16[1][0], _g16_1[1][0], ms + 0), ms[8]);
-            Store<align, mask>(y1 + A, LoadAndConvertBgrToY8<align, mask>(bgr1 + 3 * A, _b16_r16[1][1], _g16_1[1][1], ms + 4), ms[9]);
+            Store<align, mask>(y0 + 0, LoadAndConvertBgrToY8<align, mask, T>(bgr0 + 0 * A, _b16_r16[0][0], _g16_1[0][0], ms + 0), ms[8]);
+            Store<align, mask>(y0 + A, LoadAndConvertBgrToY8<align, mask, T>(bgr0 + 3 * A, _b16_r16[0][1], _g16_1[0][1], ms + 4), ms[9]);
+            Store<align, mask>(y1 + 0, LoadAndConvertBgrToY8<align, mask, T>(bgr1 + 0 * A, _b16_r16[1][0], _g16_1[1][0], ms + 0), ms[8]);
+            Store<align, mask>(y1 + A, LoadAndConvertBgrToY8<align, mask, T>(bgr1 + 3 * A, _b16_r16[1][1], _g16_1[1][1], ms + 4), ms[9]);
 
             Average16(_b16_r16[0][0][0], _b16_r16[1][0][0]);
             Average16(_b16_r16[0][0][1], _b16_r16[1][0][1]);
@@ -91,11 +91,19 @@ namespace Simd
             Average16(_g16_1[0][1][0], _g16_1[1][1][0]);
             Average16(_g16_1[0][1][1], _g16_1[1][1][1]);
 
-            Store<align, mask>(u, Permuted2Pack16iTo8u(ConvertU16(_b16_r16[0][0], _g16_1[0][0]), ConvertU16(_b16_r16[0][1], _g16_1[0][1])), ms[10]);
-            Store<align, mask>(v, Permuted2Pack16iTo8u(ConvertV16(_b16_r16[0][0], _g16_1[0][0]), ConvertV16(_b16_r16[0][1], _g16_1[0][1])), ms[10]);
+            u = Permuted2Pack16iTo8u(ConvertU16<T>(_b16_r16[0][0], _g16_1[0][0]), ConvertU16<T>(_b16_r16[0][1], _g16_1[0][1]));
+            v = Permuted2Pack16iTo8u(ConvertV16<T>(_b16_r16[0][0], _g16_1[0][0]), ConvertV16<T>(_b16_r16[0][1], _g16_1[0][1]));
         }
 
-        template <bool align> void BgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+        template <bool align, bool mask, class T = Base::Bt601> SIMD_INLINE void BgrToYuv420p(const uint8_t * bgr0, size_t bgrStride, uint8_t * y0, size_t yStride, uint8_t * u, uint8_t * v, const __mmask64 * ms)
+        {
+            __m512i _u, _v;
+            BgrToYuv420p<align, mask, T>(bgr0, bgrStride, y0, yStride, _u, _v, ms);
+            Store<align, mask>(u, _u, ms[10]);
+            Store<align, mask>(v, _v, ms[10]);
+        }
+
+        template <bool align, class T = Base::Bt601> void BgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             assert((width % 2 == 0) && (height % 2 == 0));
@@ -118,9 +126,9 @@ namespace Simd
             {
                 size_t col = 0;
                 for (; col < alignedWidth; col += A)
-                    BgrToYuv420p<align, false>(bgr + col * 6, bgrStride, y + col * 2, yStride, u + col, v + col, tailMasks);
+                    BgrToYuv420p<align, false, T>(bgr + col * 6, bgrStride, y + col * 2, yStride, u + col, v + col, tailMasks);
                 if (col < width)
-                    BgrToYuv420p<align, true>(bgr + col * 6, bgrStride, y + col * 2, yStride, u + col, v + col, tailMasks);
+                    BgrToYuv420p<align, true, T>(bgr + col * 6, bgrStride, y + col * 2, yStride, u + col, v + col, tailMasks);
                 y += 2 * yStride;
                 u += uStride;
                 v += vStride;
@@ -128,14 +136,41 @@ namespace Simd
             }
         }
 
-        void BgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+        template <class T> void BgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
-                BgrToYuv420p<true>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+                BgrToYuv420p<true, T>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
             else
-                BgrToYuv420p<false>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+                BgrToYuv420p<false, T>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgrToYuv420p<Base::Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToYuv420p<Base::Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgrToYuv420p<Base::Bt709>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgrToYuv420p<Base::Bt2020>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: BgrToYuv420p<Base::Bt601Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: BgrToYuv420p<Base::Bt709Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: BgrToYuv420p<Base::Bt2020Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            default: assert(0);
+            }
+        }
+
+        void RgbToYuv420p(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgrToYuv420p<Base::Rgb<Base::Bt601>>(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride);
         }
 
         SIMD_INLINE void Average16(__m512i a[2][2])
@@ -146,20 +181,20 @@ namespace Simd
             a[1][1] = _mm512_srli_epi16(_mm512_add_epi16(a[1][1], K16_0001), 1);
         }
 
-        template <bool align, bool mask> SIMD_INLINE void BgrToYuv422p(const uint8_t * bgr, uint8_t * y, uint8_t * u, uint8_t * v, const __mmask64 * ms)
+        template <bool align, bool mask, class T = Base::Bt601> SIMD_INLINE void BgrToYuv422p(const uint8_t * bgr, uint8_t * y, uint8_t * u, uint8_t * v, const __mmask64 * ms)
         {
             __m512i _b16_r16[2][2], _g16_1[2][2];
-            Store<align, mask>(y + 0, LoadAndConvertBgrToY8<align, mask>(bgr + 0 * A, _b16_r16[0], _g16_1[0], ms + 0), ms[8]);
-            Store<align, mask>(y + A, LoadAndConvertBgrToY8<align, mask>(bgr + 3 * A, _b16_r16[1], _g16_1[1], ms + 4), ms[9]);
+            Store<align, mask>(y + 0, LoadAndConvertBgrToY8<align, mask, T>(bgr + 0 * A, _b16_r16[0], _g16_1[0], ms + 0), ms[8]);
+            Store<align, mask>(y + A, LoadAndConvertBgrToY8<align, mask, T>(bgr + 3 * A, _b16_r16[1], _g16_1[1], ms + 4), ms[9]);
 
             Average16(_b16_r16);
             Average16(_g16_1);
 
-            Store<align, mask>(u, Permuted2Pack16iTo8u(ConvertU16(_b16_r16[0], _g16_1[0]), ConvertU16(_b16_r16[1], _g16_1[1])), ms[10]);
-            Store<align, mask>(v, Permuted2Pack16iTo8u(ConvertV16(_b16_r16[0], _g16_1[0]), ConvertV16(_b16_r16[1], _g16_1[1])), ms[10]);
+            Store<align, mask>(u, Permuted2Pack16iTo8u(ConvertU16<T>(_b16_r16[0], _g16_1[0]), ConvertU16<T>(_b16_r16[1], _g16_1[1])), ms[10]);
+            Store<align, mask>(v, Permuted2Pack16iTo8u(ConvertV16<T>(_b16_r16[0], _g16_1[0]), ConvertV16<T>(_b16_r16[1], _g16_1[1])), ms[10]);
         }
 
-        template <bool align> void BgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+        template <bool align, class T = Base::Bt601> void BgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             assert(width % 2 == 0);
@@ -182,9 +217,9 @@ namespace Simd
             {
                 size_t col = 0;
                 for (; col < alignedWidth; col += A)
-                    BgrToYuv422p<align, false>(bgr + col * 6, y + col * 2, u + col, v + col, tailMasks);
+                    BgrToYuv422p<align, false, T>(bgr + col * 6, y + col * 2, u + col, v + col, tailMasks);
                 if (col < width)
-                    BgrToYuv422p<align, true>(bgr + col * 6, y + col * 2, u + col, v + col, tailMasks);
+                    BgrToYuv422p<align, true, T>(bgr + col * 6, y + col * 2, u + col, v + col, tailMasks);
                 y += yStride;
                 u += uStride;
                 v += vStride;
@@ -192,22 +227,49 @@ namespace Simd
             }
         }
 
-        void BgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+        template <class T> void BgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
-                BgrToYuv422p<true>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+                BgrToYuv422p<true, T>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
             else
-                BgrToYuv422p<false>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+                BgrToYuv422p<false, T>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgrToYuv422p<Base::Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
         }
 
-        SIMD_INLINE __m512i ConvertY16(__m512i b16_r16[2], __m512i g16_1[2])
+        void BgrToYuv422pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
         {
-            return Saturate16iTo8u(_mm512_add_epi16(K16_Y_ADJUST, _mm512_packs_epi32(BgrToY32(b16_r16[0], g16_1[0]), BgrToY32(b16_r16[1], g16_1[1]))));
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToYuv422p<Base::Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgrToYuv422p<Base::Bt709>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgrToYuv422p<Base::Bt2020>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: BgrToYuv422p<Base::Bt601Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: BgrToYuv422p<Base::Bt709Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: BgrToYuv422p<Base::Bt2020Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            default: assert(0);
+            }
+        }
+
+        void RgbToYuv422p(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgrToYuv422p<Base::Rgb<Base::Bt601>>(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride);
         }
 
-        template <bool align, bool mask> SIMD_INLINE void BgrToYuv444p(const uint8_t * bgr, uint8_t * y, uint8_t * u, uint8_t * v, const __mmask64 * ms)
+        template <class T = Base::Bt601> SIMD_INLINE __m512i ConvertY16(__m512i b16_r16[2], __m512i g16_1[2])
+        {
+            return Saturate16iTo8u(_mm512_add_epi16(_mm512_set1_epi16(T::Y_ADJUST), _mm512_packs_epi32(BgrToY32<T>(b16_r16[0], g16_1[0]), BgrToY32<T>(b16_r16[1], g16_1[1]))));
+        }
+
+        template <bool align, bool mask, class T = Base::Bt601> SIMD_INLINE void BgrToYuv444p(const uint8_t * bgr, uint8_t * y, uint8_t * u, uint8_t * v, const __mmask64 * ms)
         {
             __m512i _b16_r16[2][2], _g16_1[2][2];
             LoadPreparedBgr16<align, mask>(bgr + 0x00, _b16_r16[0][0], _g16_1[0][0], ms + 0);
@@ -215,12 +277,12 @@ namespace Simd
             LoadPreparedBgr16<false, mask>(bgr + 0x60, _b16_r16[1][0], _g16_1[1][0], ms + 2);
             LoadPreparedBgr16<false, mask>(bgr + 0x90, _b16_r16[1][1], _g16_1[1][1], ms + 3);
 
-            Store<align, mask>(y, Permuted2Pack16iTo8u(ConvertY16(_b16_r16[0], _g16_1[0]), ConvertY16(_b16_r16[1], _g16_1[1])), ms[4]);
-            Store<align, mask>(u, Permuted2Pack16iTo8u(ConvertU16(_b16_r16[0], _g16_1[0]), ConvertU16(_b16_r16[1], _g16_1[1])), ms[4]);
-            Store<align, mask>(v, Permuted2Pack16iTo8u(ConvertV16(_b16_r16[0], _g16_1[0]), ConvertV16(_b16_r16[1], _g16_1[1])), ms[4]);
+            Store<align, mask>(y, Permuted2Pack16iTo8u(ConvertY16<T>(_b16_r16[0], _g16_1[0]), ConvertY16<T>(_b16_r16[1], _g16_1[1])), ms[4]);
+            Store<align, mask>(u, Permuted2Pack16iTo8u(ConvertU16<T>(_b16_r16[0], _g16_1[0]), ConvertU16<T>(_b16_r16[1], _g16_1[1])), ms[4]);
+            Store<align, mask>(v, Permuted2Pack16iTo8u(ConvertV16<T>(_b16_r16[0], _g16_1[0]), ConvertV16<T>(_b16_r16[1], _g16_1[1])), ms[4]);
         }
 
-        template <bool align> void BgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+        template <bool align, class T = Base::Bt601> void BgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             if (align)
@@ -239,9 +301,9 @@ namespace Simd
             {
                 size_t col = 0;
                 for (; col < alignedWidth; col += A)
-                    BgrToYuv444p<align, false>(bgr + col * 3, y + col, u + col, v + col, tailMasks);
+                    BgrToYuv444p<align, false, T>(bgr + col * 3, y + col, u + col, v + col, tailMasks);
                 if (col < width)
-                    BgrToYuv444p<align, true>(bgr + col * 3, y + col, u + col, v + col, tailMasks);
+                    BgrToYuv444p<align, true, T>(bgr + col * 3, y + col, u + col, v + col, tailMasks);
                 y += yStride;
                 u += uStride;
                 v += vStride;
@@ -249,14 +311,126 @@ namespace Simd
             }
         }
 
-        void BgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+        template <class T> void BgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
-                BgrToYuv444p<true>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+                BgrToYuv444p<true, T>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+            else
+                BgrToYuv444p<false, T>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgrToYuv444p<Base::Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgrToYuv444pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToYuv444p<Base::Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgrToYuv444p<Base::Bt709>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgrToYuv444p<Base::Bt2020>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: BgrToYuv444p<Base::Bt601Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: BgrToYuv444p<Base::Bt709Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: BgrToYuv444p<Base::Bt2020Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            default: assert(0);
+            }
+        }
+
+        void RgbToYuv444p(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgrToYuv444p<Base::Rgb<Base::Bt601>>(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        template <bool align, bool mask, bool nv21, class T> SIMD_INLINE void BgrToNv12(const uint8_t * bgr0, size_t bgrStride, uint8_t * y0, size_t yStride, uint8_t * uv, const __mmask64 * ms)
+        {
+            __m512i u, v;
+            BgrToYuv420p<align, mask, T>(bgr0, bgrStride, y0, yStride, u, v, ms);
+            StoreUv<align, mask, nv21>(uv, u, v, ms[8], ms[9]);
+        }
+
+        template <bool align, bool nv21, class T> void BgrToNv12(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * uv, size_t uvStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+            if (align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride));
+                assert(Aligned(bgr) && Aligned(bgrStride));
+            }
+
+            width /= 2;
+            size_t alignedWidth = AlignLo(width - 1, A);
+            size_t tail = width - alignedWidth;
+            __mmask64 tailMasks[11];
+            for (size_t i = 0; i < 8; ++i)
+                tailMasks[i] = TailMask64(tail * 6 - 48 * i) & 0x0000FFFFFFFFFFFF;
+            for (size_t i = 0; i < 2; ++i)
+                tailMasks[8 + i] = TailMask64(tail * 2 - A*i);
+            tailMasks[10] = TailMask64(tail);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                size_t col = 0;
+                for (; col < alignedWidth; col += A)
+                    BgrToNv12<align, false, nv21, T>(bgr + col * 6, bgrStride, y + col * 2, yStride, uv + col * 2, tailMasks);
+                if (col < width)
+                    BgrToNv12<align, true, nv21, T>(bgr + col * 6, bgrStride, y + col * 2, yStride, uv + col * 2, tailMasks);
+                y += 2 * yStride;
+                uv += uvStride;
+                bgr += 2 * bgrStride;
+            }
+        }
+
+        template <bool nv21, class T> void BgrToNv12(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(bgr) && Aligned(bgrStride))
+                BgrToNv12<true, nv21, T>(bgr, width, height, bgrStride, y, yStride, uv, uvStride);
             else
-                BgrToYuv444p<false>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+                BgrToNv12<false, nv21, T>(bgr, width, height, bgrStride, y, yStride, uv, uvStride);
+        }
+
+        void BgrToNv12(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride)
+        {
+            BgrToNv12<false, Base::Bt601>(bgr, width, height, bgrStride, y, yStride, uv, uvStride);
+        }
+
+        void BgrToNv12V2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToNv12<false, Base::Bt601>(bgr, width, height, bgrStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt709: BgrToNv12<false, Base::Bt709>(bgr, width, height, bgrStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt2020: BgrToNv12<false, Base::Bt2020>(bgr, width, height, bgrStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt601Full: BgrToNv12<false, Base::Bt601Full>(bgr, width, height, bgrStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt709Full: BgrToNv12<false, Base::Bt709Full>(bgr, width, height, bgrStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt2020Full: BgrToNv12<false, Base::Bt2020Full>(bgr, width, height, bgrStride, y, yStride, uv, uvStride); break;
+            default: assert(0);
+            }
+        }
+
+        void BgrToNv21(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * vu, size_t vuStride)
+        {
+            BgrToNv12<true, Base::Bt601>(bgr, width, height, bgrStride, y, yStride, vu, vuStride);
+        }
+
+        void BgrToNv21V2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * vu, size_t vuStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToNv12<true, Base::Bt601>(bgr, width, height, bgrStride, y, yStride, vu, vuStride); break;
+            case SimdYuvBt709: BgrToNv12<true, Base::Bt709>(bgr, width, height, bgrStride, y, yStride, vu, vuStride); break;
+            case SimdYuvBt2020: BgrToNv12<true, Base::Bt2020>(bgr, width, height, bgrStride, y, yStride, vu, vuStride); break;
+            case SimdYuvBt601Full: BgrToNv12<true, Base::Bt601Full>(bgr, width, height, bgrStride, y, yStride, vu, vuStride); break;
+            case SimdYuvBt709Full: BgrToNv12<true, Base::Bt709Full>(bgr, width, height, bgrStride, y, yStride, vu, vuStride); break;
+            case SimdYuvBt2020Full: BgrToNv12<true, Base::Bt2020Full>(bgr, width, height, bgrStride, y, yStride, vu, vuStride); break;
+            default: assert(0);
+            }
         }
     }
 #endif// SIMD_AVX512BW_ENABLE
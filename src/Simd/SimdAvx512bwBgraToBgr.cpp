@@ -35,31 +35,38 @@ namespace Simd
             0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
             0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
 
+        const __m512i K8_SUFFLE_BGRA_TO_RGB = SIMD_MM512_SETR_EPI8(
+            0x2, 0x1, 0x0, 0x6, 0x5, 0x4, 0xA, 0x9, 0x8, 0xE, 0xD, 0xC, -1, -1, -1, -1,
+            0x2, 0x1, 0x0, 0x6, 0x5, 0x4, 0xA, 0x9, 0x8, 0xE, 0xD, 0xC, -1, -1, -1, -1,
+            0x2, 0x1, 0x0, 0x6, 0x5, 0x4, 0xA, 0x9, 0x8, 0xE, 0xD, 0xC, -1, -1, -1, -1,
+            0x2, 0x1, 0x0, 0x6, 0x5, 0x4, 0xA, 0x9, 0x8, 0xE, 0xD, 0xC, -1, -1, -1, -1);
+
         const __m512i K32_PERMUTE_BGRA_TO_BGR = SIMD_MM512_SETR_EPI32(0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
 
         const __m512i K32_PERMUTE_BGRA_TO_BGR_0 = SIMD_MM512_SETR_EPI32(0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x10, 0x11, 0x12, 0x14);
         const __m512i K32_PERMUTE_BGRA_TO_BGR_1 = SIMD_MM512_SETR_EPI32(0x05, 0x06, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x10, 0x11, 0x12, 0x14, 0x15, 0x16, 0x18, 0x19);
         const __m512i K32_PERMUTE_BGRA_TO_BGR_2 = SIMD_MM512_SETR_EPI32(0x0A, 0x0C, 0x0D, 0x0E, 0x10, 0x11, 0x12, 0x14, 0x15, 0x16, 0x18, 0x19, 0x1A, 0x1C, 0x1D, 0x1E);
 
-        template <bool align, bool mask> SIMD_INLINE void BgraToBgr(const uint8_t * bgra, uint8_t * bgr, __mmask64 bgraMask = -1, __mmask64 bgrMask = 0x0000ffffffffffff)
+        template <bool align, bool mask, bool rgb> SIMD_INLINE void BgraToBgr(const uint8_t * bgra, uint8_t * bgr, __mmask64 bgraMask = -1, __mmask64 bgrMask = 0x0000ffffffffffff)
         {
             __m512i _bgra = Load<align, mask>(bgra, bgraMask);
-            __m512i _bgr = _mm512_permutexvar_epi32(K32_PERMUTE_BGRA_TO_BGR, _mm512_shuffle_epi8(_bgra, K8_SUFFLE_BGRA_TO_BGR));
+            __m512i _bgr = _mm512_permutexvar_epi32(K32_PERMUTE_BGRA_TO_BGR, _mm512_shuffle_epi8(_bgra, rgb ? K8_SUFFLE_BGRA_TO_RGB : K8_SUFFLE_BGRA_TO_BGR));
             Store<false, true>(bgr, _bgr, bgrMask);
         }
 
-        template <bool align> SIMD_INLINE void BgraToBgr(const uint8_t * bgra, uint8_t * bgr)
+        template <bool align, bool rgb> SIMD_INLINE void BgraToBgr(const uint8_t * bgra, uint8_t * bgr)
         {
-            __m512i bgr0 = _mm512_shuffle_epi8(Load<align>(bgra + 0 * A), K8_SUFFLE_BGRA_TO_BGR);
-            __m512i bgr1 = _mm512_shuffle_epi8(Load<align>(bgra + 1 * A), K8_SUFFLE_BGRA_TO_BGR);
-            __m512i bgr2 = _mm512_shuffle_epi8(Load<align>(bgra + 2 * A), K8_SUFFLE_BGRA_TO_BGR);
-            __m512i bgr3 = _mm512_shuffle_epi8(Load<align>(bgra + 3 * A), K8_SUFFLE_BGRA_TO_BGR);
+            const __m512i shuffle = rgb ? K8_SUFFLE_BGRA_TO_RGB : K8_SUFFLE_BGRA_TO_BGR;
+            __m512i bgr0 = _mm512_shuffle_epi8(Load<align>(bgra + 0 * A), shuffle);
+            __m512i bgr1 = _mm512_shuffle_epi8(Load<align>(bgra + 1 * A), shuffle);
+            __m512i bgr2 = _mm512_shuffle_epi8(Load<align>(bgra + 2 * A), shuffle);
+            __m512i bgr3 = _mm512_shuffle_epi8(Load<align>(bgra + 3 * A), shuffle);
             Store<align>(bgr + 0 * A, _mm512_permutex2var_epi32(bgr0, K32_PERMUTE_BGRA_TO_BGR_0, bgr1));
             Store<align>(bgr + 1 * A, _mm512_permutex2var_epi32(bgr1, K32_PERMUTE_BGRA_TO_BGR_1, bgr2));
             Store<align>(bgr + 2 * A, _mm512_permutex2var_epi32(bgr2, K32_PERMUTE_BGRA_TO_BGR_2, bgr3));
         }
 
-        template <bool align> void BgraToBgr(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bgr, size_t bgrStride)
+        template <bool align, bool rgb> void BgraToBgr(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bgr, size_t bgrStride)
         {
             if (align)
                 assert(Aligned(bgra) && Aligned(bgraStride) && Aligned(bgr) && Aligned(bgrStride));
@@ -72,11 +79,11 @@ namespace Simd
             {
                 size_t col = 0;
                 for (; col < fullAlignedWidth; col += A)
-                    BgraToBgr<align>(bgra + 4 * col, bgr + 3 * col);
+                    BgraToBgr<align, rgb>(bgra + 4 * col, bgr + 3 * col);
                 for (; col < alignedWidth; col += F)
-                    BgraToBgr<align, false>(bgra + 4 * col, bgr + 3 * col);
+                    BgraToBgr<align, false, rgb>(bgra + 4 * col, bgr + 3 * col);
                 if (col < width)
-                    BgraToBgr<align, true>(bgra + 4 * col, bgr + 3 * col, bgraTailMask, bgrTailMask);
+                    BgraToBgr<align, true, rgb>(bgra + 4 * col, bgr + 3 * col, bgraTailMask, bgrTailMask);
                 bgra += bgraStride;
                 bgr += bgrStride;
             }
@@ -85,9 +92,17 @@ namespace Simd
         void BgraToBgr(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bgr, size_t bgrStride)
         {
             if (Aligned(bgra) && Aligned(bgraStride) && Aligned(bgr) && Aligned(bgrStride))
-                BgraToBgr<true>(bgra, width, height, bgraStride, bgr, bgrStride);
+                BgraToBgr<true, false>(bgra, width, height, bgraStride, bgr, bgrStride);
+            else
+                BgraToBgr<false, false>(bgra, width, height, bgraStride, bgr, bgrStride);
+        }
+
+        void BgraToRgb(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * rgb, size_t rgbStride)
+        {
+            if (Aligned(bgra) && Aligned(bgraStride) && Aligned(rgb) && Aligned(rgbStride))
+                BgraToBgr<true, true>(bgra, width, height, bgraStride, rgb, rgbStride);
             else
-                BgraToBgr<false>(bgra, width, height, bgraStride, bgr, bgrStride);
+                BgraToBgr<false, true>(bgra, width, height, bgraStride, rgb, rgbStride);
         }
     }
 #endif// SIMD_AVX512BW_ENABLE
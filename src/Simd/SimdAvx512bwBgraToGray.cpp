@@ -31,30 +31,31 @@ namespace Simd
     namespace Avx512bw
     {
         const __m512i K16_BLUE_RED = SIMD_MM512_SET2_EPI16(Base::BLUE_TO_GRAY_WEIGHT, Base::RED_TO_GRAY_WEIGHT);
+        const __m512i K16_RED_BLUE = SIMD_MM512_SET2_EPI16(Base::RED_TO_GRAY_WEIGHT, Base::BLUE_TO_GRAY_WEIGHT);
         const __m512i K16_GREEN_0000 = SIMD_MM512_SET2_EPI16(Base::GREEN_TO_GRAY_WEIGHT, 0x0000);
         const __m512i K32_ROUND_TERM = SIMD_MM512_SET1_EPI32(Base::BGR_TO_GRAY_ROUND_TERM);
 
-        SIMD_INLINE __m512i BgraToGray32(__m512i bgra)
+        template <bool rgb> SIMD_INLINE __m512i BgraToGray32(__m512i bgra)
         {
             const __m512i g0a0 = _mm512_shuffle_epi8(bgra, K8_SUFFLE_BGRA_TO_G0A0);
             const __m512i b0r0 = _mm512_and_si512(bgra, K16_00FF);
-            const __m512i weightedSum = _mm512_add_epi32(_mm512_madd_epi16(g0a0, K16_GREEN_0000), _mm512_madd_epi16(b0r0, K16_BLUE_RED));
+            const __m512i weightedSum = _mm512_add_epi32(_mm512_madd_epi16(g0a0, K16_GREEN_0000), _mm512_madd_epi16(b0r0, rgb ? K16_RED_BLUE : K16_BLUE_RED));
             return _mm512_srli_epi32(_mm512_add_epi32(weightedSum, K32_ROUND_TERM), Base::BGR_TO_GRAY_AVERAGING_SHIFT);
         }
 
-        template <bool align, bool mask> SIMD_INLINE void BgraToGray(const uint8_t * bgra, uint8_t * gray, __mmask64 ms[5])
+        template <bool align, bool mask, bool rgb> SIMD_INLINE void BgraToGray(const uint8_t * bgra, uint8_t * gray, __mmask64 ms[5])
         {
-            __m512i gray0 = BgraToGray32(Load<align, mask>(bgra + 0 * A, ms[0]));
-            __m512i gray1 = BgraToGray32(Load<align, mask>(bgra + 1 * A, ms[1]));
-            __m512i gray2 = BgraToGray32(Load<align, mask>(bgra + 2 * A, ms[2]));
-            __m512i gray3 = BgraToGray32(Load<align, mask>(bgra + 3 * A, ms[3]));
+            __m512i gray0 = BgraToGray32<rgb>(Load<align, mask>(bgra + 0 * A, ms[0]));
+            __m512i gray1 = BgraToGray32<rgb>(Load<align, mask>(bgra + 1 * A, ms[1]));
+            __m512i gray2 = BgraToGray32<rgb>(Load<align, mask>(bgra + 2 * A, ms[2]));
+            __m512i gray3 = BgraToGray32<rgb>(Load<align, mask>(bgra + 3 * A, ms[3]));
             __m512i gray01 = _mm512_packs_epi32(gray0, gray1);
             __m512i gray23 = _mm512_packs_epi32(gray2, gray3);
             __m512i gray0123 = _mm512_packus_epi16(gray01, gray23);
             Store<align, mask>(gray, _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, gray0123), ms[4]);
         }
 
-        template <bool align> void BgraToGray(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * gray, size_t grayStride)
+        template <bool align, bool rgb> void BgraToGray(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * gray, size_t grayStride)
         {
             if (align)
                 assert(Aligned(bgra) && Aligned(bgraStride) && Aligned(gray) && Aligned(grayStride));
@@ -68,9 +69,9 @@ namespace Simd
             {
                 size_t col = 0;
                 for (; col < alignedWidth; col += A)
-                    BgraToGray<align, false>(bgra + col * 4, gray + col, tailMasks);
+                    BgraToGray<align, false, rgb>(bgra + col * 4, gray + col, tailMasks);
                 if (col < width)
-                    BgraToGray<align, true>(bgra + col * 4, gray + col, tailMasks);
+                    BgraToGray<align, true, rgb>(bgra + col * 4, gray + col, tailMasks);
                 bgra += bgraStride;
                 gray += grayStride;
             }
@@ -79,9 +80,17 @@ namespace Simd
         void BgraToGray(const uint8_t *bgra, size_t width, size_t height, size_t bgraStride, uint8_t *gray, size_t grayStride)
         {
             if (Aligned(bgra) && Aligned(gray) && Aligned(bgraStride) && Aligned(grayStride))
-                BgraToGray<true>(bgra, width, height, bgraStride, gray, grayStride);
+                BgraToGray<true, false>(bgra, width, height, bgraStride, gray, grayStride);
             else
-                BgraToGray<false>(bgra, width, height, bgraStride, gray, grayStride);
+                BgraToGray<false, false>(bgra, width, height, bgraStride, gray, grayStride);
+        }
+
+        void RgbaToGray(const uint8_t * rgba, size_t width, size_t height, size_t rgbaStride, uint8_t * gray, size_t grayStride)
+        {
+            if (Aligned(rgba) && Aligned(gray) && Aligned(rgbaStride) && Aligned(grayStride))
+                BgraToGray<true, true>(rgba, width, height, rgbaStride, gray, grayStride);
+            else
+                BgraToGray<false, true>(rgba, width, height, rgbaStride, gray, grayStride);
         }
     }
 #endif// SIMD_AVX512BW_ENABLE
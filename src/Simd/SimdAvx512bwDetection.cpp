@@ -338,6 +338,177 @@ namespace Simd
                 Image(hid.sum.width - 1, hid.sum.height - 1, dstStride, Image::Gray8, dst).Ref());
         }
 
+        SIMD_INLINE __m256i Norm16i(const __m512 & norm, float inorm)
+        {
+            return _mm512_cvtepi32_epi16(_mm512_cvttps_epi32(_mm512_add_ps(_mm512_mul_ps(norm, _mm512_set1_ps(inorm)), _mm512_set1_ps(0.5f))));
+        }
+
+        template <bool masked> SIMD_INLINE __m512i Norm16ip(const HidHaarCascade & hid, size_t offset, const __mmask16 * tails)
+        {
+            __m256i lo = Norm16i(Norm32fp<masked>(hid, offset + 0, tails[0]), hid.inorm);
+            __m256i hi = Norm16i(Norm32fp<masked>(hid, offset + F, tails[1]), hid.inorm);
+            return _mm512_inserti64x4(_mm512_castsi256_si512(lo), hi, 1);
+        }
+
+        template <bool masked> SIMD_INLINE __m512i Norm16ii(const HidHaarCascade & hid, size_t offset, const __mmask16 * tails)
+        {
+            __m256i lo = Norm16i(Norm32fi<masked>(hid, offset + 0, tails + 0), hid.inorm);
+            __m256i hi = Norm16i(Norm32fi<masked>(hid, offset + HA, tails + 2), hid.inorm);
+            return _mm512_inserti64x4(_mm512_castsi256_si512(lo), hi, 1);
+        }
+
+        template <bool masked> SIMD_INLINE __m512i WeightedSum16i(const WeightedRect16i & rect, size_t offset, __mmask32 tail = -1)
+        {
+            __m512i s0 = Load<false, masked>(rect.p0 + offset, tail);
+            __m512i s1 = Load<false, masked>(rect.p1 + offset, tail);
+            __m512i s2 = Load<false, masked>(rect.p2 + offset, tail);
+            __m512i s3 = Load<false, masked>(rect.p3 + offset, tail);
+            __m512i sum = _mm512_sub_epi16(_mm512_sub_epi16(s0, s1), _mm512_sub_epi16(s2, s3));
+            return _mm512_mullo_epi16(sum, _mm512_set1_epi16(rect.weight));
+        }
+
+        SIMD_INLINE void StageSum16i(const int * leaves, int threshold, const __m512i & sum, const __m512i & norm, __m512i & stageSum)
+        {
+            __mmask32 mask = _mm512_cmpge_epi16_mask(sum, _mm512_mulhrs_epi16(_mm512_set1_epi16(threshold), norm));
+            stageSum = _mm512_add_epi16(stageSum, _mm512_mask_blend_epi16(mask, _mm512_set1_epi16(leaves[0]), _mm512_set1_epi16(leaves[1])));
+        }
+
+        template <bool masked> __mmask32 Detect16i(const HidHaarCascade & hid, size_t offset, const __m512i & norm, __mmask32 result)
+        {
+            typedef HidHaarCascade Hid;
+            const int * leaves = hid.ileaves.data();
+            const Hid::Node * node = hid.nodes.data();
+            const Hid::Stage * stages = hid.stages.data();
+            for (int i = 0, n = (int)hid.stages.size(); i < n; ++i)
+            {
+                const Hid::Stage & stage = stages[i];
+                const Hid::Node * end = node + stage.ntrees;
+                __m512i stageSum = _mm512_setzero_si512();
+                for (; node < end; ++node, leaves += 2)
+                {
+                    const Hid::IFeature & feature = hid.ifeatures[node->featureIdx];
+                    __m512i sum = _mm512_add_epi16(
+                        WeightedSum16i<masked>(feature.rect[0], offset, result),
+                        WeightedSum16i<masked>(feature.rect[1], offset, result));
+                    if (feature.rect[2].p0)
+                        sum = _mm512_add_epi16(sum, WeightedSum16i<masked>(feature.rect[2], offset, result));
+                    StageSum16i(leaves, node->ithreshold, sum, norm, stageSum);
+                }
+                result = result & _mm512_cmpge_epi16_mask(stageSum, _mm512_set1_epi16(stage.ithreshold));
+                if (!result)
+                    return result;
+                int resultCount = _mm_popcnt_u32(result);
+                if (resultCount == 1)
+                {
+                    int j = _tzcnt_u32(result);
+                    int16_t SIMD_ALIGNED(64) _norm[HA];
+                    _mm512_store_si512(_norm, norm);
+                    return Base::Detect16i(hid, offset + j, i + 1, _norm[j]) > 0 ? result : __mmask32(0);
+                }
+            }
+            return result;
+        }
+
+        void DetectionHaarDetect16ip(const HidHaarCascade & hid, const Image & mask, const Rect & rect, Image & dst)
+        {
+            size_t width = rect.Width();
+            size_t alignedWidth = Simd::AlignLo(width, HA);
+            __mmask32 tailMask = TailMask32(width - alignedWidth);
+            __mmask16 tailMasks[2];
+            for (size_t c = 0; c < 2; ++c)
+                tailMasks[c] = TailMask16(width - alignedWidth - F*c);
+            Buffer<uint16_t> buffer(width);
+            for (ptrdiff_t row = rect.top; row < rect.bottom; row += 1)
+            {
+                size_t col = 0;
+                size_t p_offset = row * hid.isum.stride / sizeof(uint16_t) + rect.left;
+                size_t pq_offset = row * hid.sqsum.stride / sizeof(uint32_t) + rect.left;
+                UnpackMask16i(mask.data + row*mask.stride + rect.left, width, buffer.m, K8_01);
+                memset(buffer.d, 0, width * sizeof(uint16_t));
+                for (; col < alignedWidth; col += HA)
+                {
+                    __mmask32 result = _mm512_cmpneq_epi16_mask(Load<false>(buffer.m + col), K_ZERO);
+                    if (result)
+                    {
+                        __m512i norm = Norm16ip<false>(hid, pq_offset + col, tailMasks);
+                        result = Detect16i<false>(hid, p_offset + col, norm, result);
+                        Store<false>(buffer.d + col, _mm512_maskz_set1_epi16(result, 1));
+                    }
+                }
+                if (col < width)
+                {
+                    __mmask32 result = _mm512_cmpneq_epi16_mask((Load<false, true>(buffer.m + col, tailMask)), K_ZERO);
+                    if (result)
+                    {
+                        __m512i norm = Norm16ip<true>(hid, pq_offset + col, tailMasks);
+                        result = Detect16i<true>(hid, p_offset + col, norm, result);
+                        Store<false, true>(buffer.d + col, _mm512_maskz_set1_epi16(result, 1), tailMask);
+                    }
+                }
+                PackResult16i(buffer.d, width, dst.data + row*dst.stride + rect.left);
+            }
+        }
+
+        void DetectionHaarDetect16ip(const void * _hid, const uint8_t * mask, size_t maskStride,
+            ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
+        {
+            const HidHaarCascade & hid = *(HidHaarCascade*)_hid;
+            return DetectionHaarDetect16ip(hid,
+                Image(hid.sum.width - 1, hid.sum.height - 1, maskStride, Image::Gray8, (uint8_t*)mask),
+                Rect(left, top, right, bottom),
+                Image(hid.sum.width - 1, hid.sum.height - 1, dstStride, Image::Gray8, dst).Ref());
+        }
+
+        void DetectionHaarDetect16ii(const HidHaarCascade & hid, const Image & mask, const Rect & rect, Image & dst)
+        {
+            const size_t step = 2;
+            size_t width = rect.Width();
+            size_t alignedWidth = Simd::AlignLo(width, A);
+            __mmask32 tailMask = TailMask32((width - alignedWidth + 1) / 2);
+            __mmask16 tailMasks[4];
+            for (size_t c = 0; c < 4; ++c)
+                tailMasks[c] = TailMask16(width - alignedWidth - F*c);
+
+            for (ptrdiff_t row = rect.top; row < rect.bottom; row += step)
+            {
+                size_t col = 0;
+                size_t p_offset = row * hid.isum.stride / sizeof(uint16_t) + rect.left / 2;
+                size_t pq_offset = row * hid.sqsum.stride / sizeof(uint32_t) + rect.left;
+                const uint8_t * m = mask.data + row*mask.stride + rect.left;
+                uint8_t * d = dst.data + row*dst.stride + rect.left;
+                for (; col < alignedWidth; col += A)
+                {
+                    __mmask32 result = _mm512_cmpneq_epi16_mask(_mm512_and_si512(Load<false>(m + col), K16_00FF), K_ZERO);
+                    if (result)
+                    {
+                        __m512i norm = Norm16ii<false>(hid, pq_offset + col, tailMasks);
+                        result = Detect16i<false>(hid, p_offset + col / 2, norm, result);
+                        Store<false>(d + col, _mm512_maskz_set1_epi16(result, 1));
+                    }
+                }
+                if (col < width)
+                {
+                    __mmask32 result = _mm512_cmpneq_epi16_mask(_mm512_and_si512((Load<false, true>((uint16_t*)m + col / 2, tailMask)), K16_00FF), K_ZERO);
+                    if (result)
+                    {
+                        __m512i norm = Norm16ii<true>(hid, pq_offset + col, tailMasks);
+                        result = Detect16i<true>(hid, p_offset + col / 2, norm, result);
+                        Store<false, true>((uint16_t*)d + col / 2, _mm512_maskz_set1_epi16(result, 1), tailMask);
+                    }
+                }
+            }
+        }
+
+        void DetectionHaarDetect16ii(const void * _hid, const uint8_t * mask, size_t maskStride,
+            ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
+        {
+            const HidHaarCascade & hid = *(HidHaarCascade*)_hid;
+            return DetectionHaarDetect16ii(hid,
+                Image(hid.sum.width - 1, hid.sum.height - 1, maskStride, Image::Gray8, (uint8_t*)mask),
+                Rect(left, top, right, bottom),
+                Image(hid.sum.width - 1, hid.sum.height - 1, dstStride, Image::Gray8, dst).Ref());
+        }
+
         const __m512i K8_SHUFFLE_BITS = SIMD_MM512_SETR_EPI8(
             0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
             0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -303,6 +303,242 @@ namespace Simd
             else
                 EdgeBackgroundShiftRangeMasked<false>(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
         }
+
+        const __mmask64 K64_PACKED_VALUE = 0x5555555555555555;
+        const __mmask64 K64_PACKED_COUNT = 0xAAAAAAAAAAAAAAAA;
+
+        template <bool align, bool mask> SIMD_INLINE void EdgeBackgroundPackedInit(const uint8_t * value, uint8_t * model, const __mmask64 tails[3])
+        {
+            const __m512i _value = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, Load<align, mask>(value, tails[0]));
+            Store<align, mask>(model + 0 * A, _mm512_unpacklo_epi8(_value, K_ZERO), tails[1]);
+            Store<align, mask>(model + 1 * A, _mm512_unpackhi_epi8(_value, K_ZERO), tails[2]);
+        }
+
+        template <bool align> void EdgeBackgroundPackedInit(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
+        {
+            if (align)
+                assert(Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride));
+
+            size_t alignedWidth = AlignLo(width, A);
+            __mmask64 tails[3];
+            tails[0] = TailMask64(width - alignedWidth);
+            for (size_t c = 0; c < 2; ++c)
+                tails[1 + c] = TailMask64((width - alignedWidth) * 2 - A * c);
+            for (size_t row = 0; row < height; ++row)
+            {
+                size_t col = 0;
+                for (; col < alignedWidth; col += A)
+                    EdgeBackgroundPackedInit<align, false>(value + col, model + 2 * col, tails);
+                if (col < width)
+                    EdgeBackgroundPackedInit<align, true>(value + col, model + 2 * col, tails);
+                value += valueStride;
+                model += modelStride;
+            }
+        }
+
+        void EdgeBackgroundPackedInit(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
+        {
+            if (Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride))
+                EdgeBackgroundPackedInit<true>(value, valueStride, width, height, model, modelStride);
+            else
+                EdgeBackgroundPackedInit<false>(value, valueStride, width, height, model, modelStride);
+        }
+
+        template <bool grow, bool increment, bool adjust> SIMD_INLINE __m512i EdgeBackgroundPackedUpdate(__m512i model, const __m512i & value, const __m512i & threshold)
+        {
+            if (grow)
+                model = _mm512_mask_max_epu8(model, K64_PACKED_VALUE, model, value);
+            if (increment)
+            {
+                const __mmask64 inc = _mm512_mask_cmpgt_epu8_mask(K64_PACKED_COUNT, value, _mm512_slli_epi16(model, 8));
+                model = _mm512_mask_adds_epu8(model, inc, model, K8_01);
+            }
+            if (adjust)
+            {
+                const __m512i count = _mm512_srli_epi16(model, 8);
+                const __mmask64 inc = _mm512_mask_cmpgt_epu8_mask(K64_PACKED_VALUE, count, threshold);
+                const __mmask64 dec = _mm512_mask_cmplt_epu8_mask(K64_PACKED_VALUE, count, threshold);
+                model = _mm512_mask_adds_epu8(model, inc, model, K8_01);
+                model = _mm512_mask_subs_epu8(model, dec, model, K8_01);
+                model = _mm512_maskz_mov_epi8(K64_PACKED_VALUE, model);
+            }
+            return model;
+        }
+
+        template <bool align, bool mask, bool grow, bool increment, bool adjust> SIMD_INLINE void EdgeBackgroundPackedUpdate(uint8_t * model,
+            const __m512i & value, const __m512i & threshold, __mmask64 m)
+        {
+            const __m512i _model = Load<align, mask>(model, m);
+            Store<align, mask>(model, EdgeBackgroundPackedUpdate<grow, increment, adjust>(_model, value, threshold), m);
+        }
+
+        template <bool align, bool mask, bool grow, bool increment, bool adjust> SIMD_INLINE void EdgeBackgroundPackedUpdate(const uint8_t * value,
+            uint8_t * model, const __m512i & threshold, const __mmask64 tails[3])
+        {
+            const __m512i _value = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, Load<align, mask>(value, tails[0]));
+            EdgeBackgroundPackedUpdate<align, mask, grow, increment, adjust>(model + 0 * A, _mm512_unpacklo_epi8(_value, _value), threshold, tails[1]);
+            EdgeBackgroundPackedUpdate<align, mask, grow, increment, adjust>(model + 1 * A, _mm512_unpackhi_epi8(_value, _value), threshold, tails[2]);
+        }
+
+        template <bool align, bool grow, bool increment, bool adjust> void EdgeBackgroundPackedUpdate(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * model, size_t modelStride, uint8_t threshold)
+        {
+            if (align)
+                assert(Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride));
+
+            const __m512i _threshold = _mm512_set1_epi8((char)threshold);
+            size_t alignedWidth = AlignLo(width, A);
+            __mmask64 tails[3];
+            tails[0] = TailMask64(width - alignedWidth);
+            for (size_t c = 0; c < 2; ++c)
+                tails[1 + c] = TailMask64((width - alignedWidth) * 2 - A * c);
+            for (size_t row = 0; row < height; ++row)
+            {
+                size_t col = 0;
+                for (; col < alignedWidth; col += A)
+                    EdgeBackgroundPackedUpdate<align, false, grow, increment, adjust>(value + col, model + 2 * col, _threshold, tails);
+                if (col < width)
+                    EdgeBackgroundPackedUpdate<align, true, grow, increment, adjust>(value + col, model + 2 * col, _threshold, tails);
+                value += valueStride;
+                model += modelStride;
+            }
+        }
+
+        typedef void(*EdgeBackgroundPackedUpdatePtr)(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * model, size_t modelStride, uint8_t threshold);
+
+        template <bool align, bool grow, bool increment> EdgeBackgroundPackedUpdatePtr GetEdgeBackgroundPackedUpdate(int flags)
+        {
+            if (flags & SimdBackgroundUpdateAdjustRange)
+                return EdgeBackgroundPackedUpdate<align, grow, increment, true>;
+            else
+                return EdgeBackgroundPackedUpdate<align, grow, increment, false>;
+        }
+
+        template <bool align, bool grow> EdgeBackgroundPackedUpdatePtr GetEdgeBackgroundPackedUpdate(int flags)
+        {
+            if (flags & SimdBackgroundUpdateIncrementCount)
+                return GetEdgeBackgroundPackedUpdate<align, grow, true>(flags);
+            else
+                return GetEdgeBackgroundPackedUpdate<align, grow, false>(flags);
+        }
+
+        template <bool align> EdgeBackgroundPackedUpdatePtr GetEdgeBackgroundPackedUpdate(int flags)
+        {
+            if (flags & SimdBackgroundUpdateGrowRange)
+                return GetEdgeBackgroundPackedUpdate<align, true>(flags);
+            else
+                return GetEdgeBackgroundPackedUpdate<align, false>(flags);
+        }
+
+        void EdgeBackgroundPackedUpdate(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * model, size_t modelStride, uint8_t threshold, int flags)
+        {
+            if ((flags & (SimdBackgroundUpdateGrowRange | SimdBackgroundUpdateIncrementCount | SimdBackgroundUpdateAdjustRange)) == 0)
+                return;
+            EdgeBackgroundPackedUpdatePtr edgeBackgroundPackedUpdate;
+            if (Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride))
+                edgeBackgroundPackedUpdate = GetEdgeBackgroundPackedUpdate<true>(flags);
+            else
+                edgeBackgroundPackedUpdate = GetEdgeBackgroundPackedUpdate<false>(flags);
+            edgeBackgroundPackedUpdate(value, valueStride, width, height, model, modelStride, threshold);
+        }
+
+        SIMD_INLINE __m512i EdgeBackgroundPackedGrowRangeSlow(__m512i model, const __m512i & value, const __m512i & threshold)
+        {
+            return _mm512_mask_adds_epu8(model, _mm512_mask_cmpgt_epu8_mask(K64_PACKED_VALUE, value, model), model, K8_01);
+        }
+
+        SIMD_INLINE __m512i EdgeBackgroundPackedShiftRange(__m512i model, const __m512i & value, const __m512i & threshold)
+        {
+            return _mm512_mask_mov_epi8(model, K64_PACKED_VALUE, value);
+        }
+
+        SIMD_INLINE __m512i EdgeBackgroundPackedAdjustRangeMasked(__m512i model, const __m512i & mask, const __m512i & threshold)
+        {
+            const __m512i adjusted = EdgeBackgroundPackedUpdate<false, false, true>(model, mask, threshold);
+            return _mm512_mask_blend_epi8(_mm512_test_epi8_mask(mask, mask), _mm512_maskz_mov_epi8(K64_PACKED_VALUE, model), adjusted);
+        }
+
+        typedef __m512i(*EdgeBackgroundPackedKernelPtr)(__m512i model, const __m512i & value, const __m512i & threshold);
+
+        template <EdgeBackgroundPackedKernelPtr kernel, bool align, bool mask, bool masked> SIMD_INLINE void EdgeBackgroundPackedApply(uint8_t * model,
+            const __m512i & value, const __m512i & pixelMask, const __m512i & threshold, __mmask64 tail)
+        {
+            const __m512i _model = Load<align, mask>(model, tail);
+            __mmask64 store = mask ? tail : __mmask64(-1);
+            if (masked)
+                store &= _mm512_test_epi8_mask(pixelMask, pixelMask);
+            Store<align, mask || masked>(model, kernel(_model, value, threshold), store);
+        }
+
+        template <EdgeBackgroundPackedKernelPtr kernel, bool align, bool mask, bool masked> SIMD_INLINE void EdgeBackgroundPackedApply(const uint8_t * value,
+            const uint8_t * pixelMask, uint8_t * model, const __m512i & threshold, const __mmask64 tails[3])
+        {
+            const __m512i _value = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, Load<align, mask>(value, tails[0]));
+            const __m512i _mask = masked ? _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, Load<align, mask>(pixelMask, tails[0])) : K_ZERO;
+            EdgeBackgroundPackedApply<kernel, align, mask, masked>(model + 0 * A, _mm512_unpacklo_epi8(_value, _value), _mm512_unpacklo_epi8(_mask, _mask), threshold, tails[1]);
+            EdgeBackgroundPackedApply<kernel, align, mask, masked>(model + 1 * A, _mm512_unpackhi_epi8(_value, _value), _mm512_unpackhi_epi8(_mask, _mask), threshold, tails[2]);
+        }
+
+        template <EdgeBackgroundPackedKernelPtr kernel, bool align, bool masked> void EdgeBackgroundPackedApply(const uint8_t * value, size_t valueStride,
+            size_t width, size_t height, uint8_t * model, size_t modelStride, uint8_t threshold, const uint8_t * mask, size_t maskStride)
+        {
+            if (align)
+                assert(Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride) && (!masked || (Aligned(mask) && Aligned(maskStride))));
+
+            const __m512i _threshold = _mm512_set1_epi8((char)threshold);
+            size_t alignedWidth = AlignLo(width, A);
+            __mmask64 tails[3];
+            tails[0] = TailMask64(width - alignedWidth);
+            for (size_t c = 0; c < 2; ++c)
+                tails[1 + c] = TailMask64((width - alignedWidth) * 2 - A * c);
+            for (size_t row = 0; row < height; ++row)
+            {
+                size_t col = 0;
+                for (; col < alignedWidth; col += A)
+                    EdgeBackgroundPackedApply<kernel, align, false, masked>(value + col, mask + col, model + 2 * col, _threshold, tails);
+                if (col < width)
+                    EdgeBackgroundPackedApply<kernel, align, true, masked>(value + col, mask + col, model + 2 * col, _threshold, tails);
+                value += valueStride;
+                model += modelStride;
+                mask += maskStride;
+            }
+        }
+
+        void EdgeBackgroundPackedGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
+        {
+            if (Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride))
+                EdgeBackgroundPackedApply<EdgeBackgroundPackedGrowRangeSlow, true, false>(value, valueStride, width, height, model, modelStride, 0, value, valueStride);
+            else
+                EdgeBackgroundPackedApply<EdgeBackgroundPackedGrowRangeSlow, false, false>(value, valueStride, width, height, model, modelStride, 0, value, valueStride);
+        }
+
+        void EdgeBackgroundPackedAdjustRangeMasked(uint8_t * model, size_t modelStride, size_t width, size_t height,
+            uint8_t threshold, const uint8_t * mask, size_t maskStride)
+        {
+            if (Aligned(model) && Aligned(modelStride) && Aligned(mask) && Aligned(maskStride))
+                EdgeBackgroundPackedApply<EdgeBackgroundPackedAdjustRangeMasked, true, false>(mask, maskStride, width, height, model, modelStride, threshold, mask, maskStride);
+            else
+                EdgeBackgroundPackedApply<EdgeBackgroundPackedAdjustRangeMasked, false, false>(mask, maskStride, width, height, model, modelStride, threshold, mask, maskStride);
+        }
+
+        void EdgeBackgroundPackedShiftRange(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
+        {
+            if (Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride))
+                EdgeBackgroundPackedApply<EdgeBackgroundPackedShiftRange, true, false>(value, valueStride, width, height, model, modelStride, 0, value, valueStride);
+            else
+                EdgeBackgroundPackedApply<EdgeBackgroundPackedShiftRange, false, false>(value, valueStride, width, height, model, modelStride, 0, value, valueStride);
+        }
+
+        void EdgeBackgroundPackedShiftRangeMasked(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * model, size_t modelStride, const uint8_t * mask, size_t maskStride)
+        {
+            if (Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride) && Aligned(mask) && Aligned(maskStride))
+                EdgeBackgroundPackedApply<EdgeBackgroundPackedShiftRange, true, true>(value, valueStride, width, height, model, modelStride, 0, mask, maskStride);
+            else
+                EdgeBackgroundPackedApply<EdgeBackgroundPackedShiftRange, false, true>(value, valueStride, width, height, model, modelStride, 0, mask, maskStride);
+        }
     }
 #endif// SIMD_AVX512BW_ENABLE
 }
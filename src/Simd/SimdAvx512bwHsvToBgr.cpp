@@ -0,0 +1,128 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        const __m512i K16_8081 = SIMD_MM512_SET1_EPI16(0x8081);
+
+        SIMD_INLINE __m512i DivideBy255(__m512i value)
+        {
+            return _mm512_srli_epi16(_mm512_mulhi_epu16(value, K16_8081), 7);
+        }
+
+        SIMD_INLINE void HueToBgr16(__m512i hue, __m512i min, __m512i max, __m512i bgr[3])
+        {
+            __m512i hue6 = _mm512_mullo_epi16(hue, K16_0006);
+            __m512i sector = DivideBy255(hue6);
+            __m512i delta = DivideBy255(_mm512_mullo_epi16(_mm512_sub_epi16(max, min), _mm512_sub_epi16(hue6, _mm512_mullo_epi16(sector, K16_00FF))));
+            __m512i rising = _mm512_add_epi16(min, delta);
+            __m512i falling = _mm512_sub_epi16(max, delta);
+            __mmask32 s0 = _mm512_cmpeq_epi16_mask(sector, K_ZERO) | _mm512_cmpeq_epi16_mask(sector, K16_0006);
+            __mmask32 s1 = _mm512_cmpeq_epi16_mask(sector, K16_0001);
+            __mmask32 s2 = _mm512_cmpeq_epi16_mask(sector, K16_0002);
+            __mmask32 s3 = _mm512_cmpeq_epi16_mask(sector, K16_0003);
+            __mmask32 s4 = _mm512_cmpeq_epi16_mask(sector, K16_0004);
+            __mmask32 s5 = _mm512_cmpeq_epi16_mask(sector, K16_0005);
+            bgr[0] = _mm512_mask_mov_epi16(_mm512_mask_mov_epi16(_mm512_mask_mov_epi16(min, s2, rising), s3 | s4, max), s5, falling);
+            bgr[1] = _mm512_mask_mov_epi16(_mm512_mask_mov_epi16(_mm512_mask_mov_epi16(min, s0, rising), s1 | s2, max), s3, falling);
+            bgr[2] = _mm512_mask_mov_epi16(_mm512_mask_mov_epi16(_mm512_mask_mov_epi16(min, s0 | s5, max), s1, falling), s4, rising);
+        }
+
+        template<bool hsl, int part> SIMD_INLINE void HsxToBgr16(const __m512i hsx[3], __m512i bgr[3])
+        {
+            __m512i hue = UnpackU8<part>(hsx[0]);
+            __m512i saturation = UnpackU8<part>(hsx[1]);
+            __m512i max = UnpackU8<part>(hsx[2]);
+            if (hsl)
+            {
+                __m512i lightness = max;
+                __m512i dark = DivideBy255(_mm512_mullo_epi16(lightness, _mm512_add_epi16(K16_00FF, saturation)));
+                __m512i light = DivideBy255(_mm512_add_epi16(_mm512_mullo_epi16(_mm512_sub_epi16(K16_00FF, lightness), saturation), _mm512_mullo_epi16(lightness, K16_00FF)));
+                max = _mm512_mask_blend_epi16(_mm512_cmpgt_epi16_mask(lightness, K16_0080), dark, light);
+            }
+            __m512i min = DivideBy255(_mm512_mullo_epi16(_mm512_sub_epi16(K16_00FF, saturation), max));
+            HueToBgr16(hue, min, max, bgr);
+        }
+
+        SIMD_INLINE void LoadHsx(const uint8_t * hsx, __m512i planar[3])
+        {
+            __m256i lo[3], hi[3];
+            lo[0] = _mm256_loadu_si256((__m256i*)hsx + 0);
+            lo[1] = _mm256_loadu_si256((__m256i*)hsx + 1);
+            lo[2] = _mm256_loadu_si256((__m256i*)hsx + 2);
+            hi[0] = _mm256_loadu_si256((__m256i*)hsx + 3);
+            hi[1] = _mm256_loadu_si256((__m256i*)hsx + 4);
+            hi[2] = _mm256_loadu_si256((__m256i*)hsx + 5);
+            planar[0] = _mm512_inserti64x4(_mm512_castsi256_si512(Avx2::BgrToBlue(lo)), Avx2::BgrToBlue(hi), 1);
+            planar[1] = _mm512_inserti64x4(_mm512_castsi256_si512(Avx2::BgrToGreen(lo)), Avx2::BgrToGreen(hi), 1);
+            planar[2] = _mm512_inserti64x4(_mm512_castsi256_si512(Avx2::BgrToRed(lo)), Avx2::BgrToRed(hi), 1);
+        }
+
+        template<bool hsl> SIMD_INLINE void HsxToBgr(const uint8_t * hsx, uint8_t * bgr)
+        {
+            __m512i planar[3], lo[3], hi[3];
+            LoadHsx(hsx, planar);
+            HsxToBgr16<hsl, 0>(planar, lo);
+            HsxToBgr16<hsl, 1>(planar, hi);
+            __m512i blue = _mm512_packus_epi16(lo[0], hi[0]);
+            __m512i green = _mm512_packus_epi16(lo[1], hi[1]);
+            __m512i red = _mm512_packus_epi16(lo[2], hi[2]);
+            _mm512_storeu_si512((__m512i*)bgr + 0, InterleaveBgr<0>(blue, green, red));
+            _mm512_storeu_si512((__m512i*)bgr + 1, InterleaveBgr<1>(blue, green, red));
+            _mm512_storeu_si512((__m512i*)bgr + 2, InterleaveBgr<2>(blue, green, red));
+        }
+
+        template<bool hsl> void HsxToBgr(const uint8_t * hsx, size_t width, size_t height, size_t hsxStride, uint8_t * bgr, size_t bgrStride)
+        {
+            assert(width >= A);
+
+            size_t widthA = AlignLo(width, A), tail = (width - A) * 3;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA * 3; col += A * 3)
+                    HsxToBgr<hsl>(hsx + col, bgr + col);
+                if (widthA < width)
+                    HsxToBgr<hsl>(hsx + tail, bgr + tail);
+                hsx += hsxStride;
+                bgr += bgrStride;
+            }
+        }
+
+        void HslToBgr(const uint8_t * hsl, size_t width, size_t height, size_t hslStride, uint8_t * bgr, size_t bgrStride)
+        {
+            HsxToBgr<true>(hsl, width, height, hslStride, bgr, bgrStride);
+        }
+
+        void HsvToBgr(const uint8_t * hsv, size_t width, size_t height, size_t hsvStride, uint8_t * bgr, size_t bgrStride)
+        {
+            HsxToBgr<false>(hsv, width, height, hsvStride, bgr, bgrStride);
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
@@ -0,0 +1,283 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdLab.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        const __m512i K32_LAB_PACK = SIMD_MM512_SETR_EPI32(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+
+        SIMD_INLINE __m512 LabCbrt(__m512 x)
+        {
+            __m512 k = _mm512_set1_ps(1.0f / 3.0f);
+            __m512i i = _mm512_cvttps_epi32(_mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_castps_si512(x)), k));
+            __m512 y = _mm512_castsi512_ps(_mm512_add_epi32(i, _mm512_set1_epi32(Base::LAB_CBRT_MAGIC)));
+            for (int n = 0; n < 3; ++n)
+                y = _mm512_mul_ps(_mm512_add_ps(_mm512_add_ps(y, y), _mm512_div_ps(x, _mm512_mul_ps(y, y))), k);
+            return y;
+        }
+
+        SIMD_INLINE __m512 LabF(__m512 t)
+        {
+            __m512 linear = _mm512_add_ps(_mm512_mul_ps(t, _mm512_set1_ps(Base::LAB_SLOPE)), _mm512_set1_ps(Base::LAB_BIAS));
+            return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(t, _mm512_set1_ps(Base::LAB_T_THRESHOLD), _CMP_GT_OQ), linear, LabCbrt(t));
+        }
+
+        SIMD_INLINE __m512 LabFInv(__m512 f)
+        {
+            __m512 linear = _mm512_mul_ps(_mm512_sub_ps(f, _mm512_set1_ps(Base::LAB_BIAS)), _mm512_set1_ps(Base::LAB_SLOPE_INV));
+            return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(f, _mm512_set1_ps(Base::LAB_F_THRESHOLD), _CMP_GT_OQ), linear, _mm512_mul_ps(_mm512_mul_ps(f, f), f));
+        }
+
+        SIMD_INLINE __m512 Combine(__m512 a, __m512 b, __m512 c, float ka, float kb, float kc)
+        {
+            return _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(a, _mm512_set1_ps(ka)), _mm512_mul_ps(b, _mm512_set1_ps(kb))), _mm512_mul_ps(c, _mm512_set1_ps(kc)));
+        }
+
+        template<int part> SIMD_INLINE __m512i LoadU8ToI32(__m512i value)
+        {
+            return _mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(value, part));
+        }
+
+        template<int part> SIMD_INLINE void BgrToLab(__m512i blue, __m512i green, __m512i red, const float * decode, __m512 lab[3])
+        {
+            __m512 b = _mm512_i32gather_ps(LoadU8ToI32<part>(blue), decode, 4);
+            __m512 g = _mm512_i32gather_ps(LoadU8ToI32<part>(green), decode, 4);
+            __m512 r = _mm512_i32gather_ps(LoadU8ToI32<part>(red), decode, 4);
+            __m512 fx = LabF(Combine(r, g, b, Base::LAB_X_R, Base::LAB_X_G, Base::LAB_X_B));
+            __m512 fy = LabF(Combine(r, g, b, Base::LAB_Y_R, Base::LAB_Y_G, Base::LAB_Y_B));
+            __m512 fz = LabF(Combine(r, g, b, Base::LAB_Z_R, Base::LAB_Z_G, Base::LAB_Z_B));
+            lab[0] = _mm512_sub_ps(_mm512_mul_ps(fy, _mm512_set1_ps(Base::LAB_L_SCALE)), _mm512_set1_ps(Base::LAB_L_SHIFT));
+            lab[1] = _mm512_mul_ps(_mm512_sub_ps(fx, fy), _mm512_set1_ps(Base::LAB_A_SCALE));
+            lab[2] = _mm512_mul_ps(_mm512_sub_ps(fy, fz), _mm512_set1_ps(Base::LAB_B_SCALE));
+        }
+
+        SIMD_INLINE __m512i LabEncode(__m512 value, const float * encode)
+        {
+            value = _mm512_mul_ps(_mm512_min_ps(_mm512_max_ps(value, _mm512_setzero_ps()), _mm512_set1_ps(1.0f)), _mm512_set1_ps(float(Base::LAB_GAMMA_SIZE)));
+            __m512i index = _mm512_min_epi32(_mm512_cvttps_epi32(value), _mm512_set1_epi32(Base::LAB_GAMMA_SIZE - 1));
+            __m512 lo = _mm512_i32gather_ps(index, encode, 4);
+            __m512 hi = _mm512_i32gather_ps(index, encode + 1, 4);
+            return _mm512_cvtps_epi32(_mm512_add_ps(lo, _mm512_mul_ps(_mm512_sub_ps(hi, lo), _mm512_sub_ps(value, _mm512_cvtepi32_ps(index)))));
+        }
+
+        SIMD_INLINE void LabToBgr(__m512 l, __m512 a, __m512 b, const float * encode, __m512i bgr[3])
+        {
+            __m512 fy = _mm512_mul_ps(_mm512_add_ps(l, _mm512_set1_ps(Base::LAB_L_SHIFT)), _mm512_set1_ps(Base::LAB_L_SCALE_INV));
+            __m512 fx = _mm512_add_ps(fy, _mm512_mul_ps(a, _mm512_set1_ps(Base::LAB_A_SCALE_INV)));
+            __m512 fz = _mm512_sub_ps(fy, _mm512_mul_ps(b, _mm512_set1_ps(Base::LAB_B_SCALE_INV)));
+            __m512 x = LabFInv(fx), y = LabFInv(fy), z = LabFInv(fz);
+            bgr[0] = LabEncode(Combine(x, y, z, Base::LAB_B_X, Base::LAB_B_Y, Base::LAB_B_Z), encode);
+            bgr[1] = LabEncode(Combine(x, y, z, Base::LAB_G_X, Base::LAB_G_Y, Base::LAB_G_Z), encode);
+            bgr[2] = LabEncode(Combine(x, y, z, Base::LAB_R_X, Base::LAB_R_Y, Base::LAB_R_Z), encode);
+        }
+
+        SIMD_INLINE __m512i PackI32ToU8(const __m512i src[4])
+        {
+            __m512i u8 = _mm512_packus_epi16(_mm512_packs_epi32(src[0], src[1]), _mm512_packs_epi32(src[2], src[3]));
+            return _mm512_permutexvar_epi32(K32_LAB_PACK, u8);
+        }
+
+        SIMD_INLINE void StoreBgr(const __m512i blue[4], const __m512i green[4], const __m512i red[4], uint8_t * dst)
+        {
+            __m512i b = PackI32ToU8(blue), g = PackI32ToU8(green), r = PackI32ToU8(red);
+            _mm512_storeu_si512((__m512i*)dst + 0, InterleaveBgr<0>(b, g, r));
+            _mm512_storeu_si512((__m512i*)dst + 1, InterleaveBgr<1>(b, g, r));
+            _mm512_storeu_si512((__m512i*)dst + 2, InterleaveBgr<2>(b, g, r));
+        }
+
+        SIMD_INLINE void LoadBgr(const uint8_t * src, __m512i & blue, __m512i & green, __m512i & red)
+        {
+            __m256i lo[3], hi[3];
+            lo[0] = _mm256_loadu_si256((__m256i*)src + 0);
+            lo[1] = _mm256_loadu_si256((__m256i*)src + 1);
+            lo[2] = _mm256_loadu_si256((__m256i*)src + 2);
+            hi[0] = _mm256_loadu_si256((__m256i*)src + 3);
+            hi[1] = _mm256_loadu_si256((__m256i*)src + 4);
+            hi[2] = _mm256_loadu_si256((__m256i*)src + 5);
+            blue = _mm512_inserti64x4(_mm512_castsi256_si512(Avx2::BgrToBlue(lo)), Avx2::BgrToBlue(hi), 1);
+            green = _mm512_inserti64x4(_mm512_castsi256_si512(Avx2::BgrToGreen(lo)), Avx2::BgrToGreen(hi), 1);
+            red = _mm512_inserti64x4(_mm512_castsi256_si512(Avx2::BgrToRed(lo)), Avx2::BgrToRed(hi), 1);
+        }
+
+        //---------------------------------------------------------------------
+
+        template<int part> SIMD_INLINE void BgrToLab(__m512i blue, __m512i green, __m512i red, const float * decode, __m512i l[4], __m512i a[4], __m512i b[4])
+        {
+            __m512 lab[3];
+            BgrToLab<part>(blue, green, red, decode, lab);
+            l[part] = _mm512_cvtps_epi32(_mm512_mul_ps(lab[0], _mm512_set1_ps(Base::LAB_L_TO_8U)));
+            a[part] = _mm512_cvtps_epi32(_mm512_add_ps(lab[1], _mm512_set1_ps(Base::LAB_AB_SHIFT)));
+            b[part] = _mm512_cvtps_epi32(_mm512_add_ps(lab[2], _mm512_set1_ps(Base::LAB_AB_SHIFT)));
+        }
+
+        SIMD_INLINE void BgrToLab(const uint8_t * bgr, const float * decode, uint8_t * lab)
+        {
+            __m512i blue, green, red, l[4], a[4], b[4];
+            LoadBgr(bgr, blue, green, red);
+            BgrToLab<0>(blue, green, red, decode, l, a, b);
+            BgrToLab<1>(blue, green, red, decode, l, a, b);
+            BgrToLab<2>(blue, green, red, decode, l, a, b);
+            BgrToLab<3>(blue, green, red, decode, l, a, b);
+            StoreBgr(l, a, b, lab);
+        }
+
+        void BgrToLab(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * lab, size_t labStride)
+        {
+            assert(width >= A);
+
+            const float * decode = Base::GetLabGamma().decode;
+            size_t widthA = AlignLo(width, A), tail = (width - A) * 3;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA * 3; col += A * 3)
+                    BgrToLab(bgr + col, decode, lab + col);
+                if (widthA < width)
+                    BgrToLab(bgr + tail, decode, lab + tail);
+                bgr += bgrStride;
+                lab += labStride;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        template<int part> SIMD_INLINE void BgrToLab32f(__m512i blue, __m512i green, __m512i red, const float * decode, float * lab)
+        {
+            __m512 _lab[3];
+            BgrToLab<part>(blue, green, red, decode, _lab);
+            StoreLab32f(_lab, lab + part * F * 3);
+        }
+
+        SIMD_INLINE void BgrToLab32f(const uint8_t * bgr, const float * decode, float * lab)
+        {
+            __m512i blue, green, red;
+            LoadBgr(bgr, blue, green, red);
+            BgrToLab32f<0>(blue, green, red, decode, lab);
+            BgrToLab32f<1>(blue, green, red, decode, lab);
+            BgrToLab32f<2>(blue, green, red, decode, lab);
+            BgrToLab32f<3>(blue, green, red, decode, lab);
+        }
+
+        void BgrToLab32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * lab, size_t labStride)
+        {
+            assert(width >= A);
+
+            const float * decode = Base::GetLabGamma().decode;
+            size_t widthA = AlignLo(width, A), tail = (width - A) * 3;
+            for (size_t row = 0; row < height; ++row)
+            {
+                float * pLab = (float*)lab;
+                for (size_t col = 0; col < widthA * 3; col += A * 3)
+                    BgrToLab32f(bgr + col, decode, pLab + col);
+                if (widthA < width)
+                    BgrToLab32f(bgr + tail, decode, pLab + tail);
+                bgr += bgrStride;
+                lab += labStride;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        template<int part> SIMD_INLINE void LabToBgr(__m512i l, __m512i a, __m512i b, const float * encode, __m512i blue[4], __m512i green[4], __m512i red[4])
+        {
+            __m512 _l = _mm512_mul_ps(_mm512_cvtepi32_ps(LoadU8ToI32<part>(l)), _mm512_set1_ps(Base::LAB_8U_TO_L));
+            __m512 _a = _mm512_sub_ps(_mm512_cvtepi32_ps(LoadU8ToI32<part>(a)), _mm512_set1_ps(Base::LAB_AB_SHIFT));
+            __m512 _b = _mm512_sub_ps(_mm512_cvtepi32_ps(LoadU8ToI32<part>(b)), _mm512_set1_ps(Base::LAB_AB_SHIFT));
+            __m512i bgr[3];
+            LabToBgr(_l, _a, _b, encode, bgr);
+            blue[part] = bgr[0];
+            green[part] = bgr[1];
+            red[part] = bgr[2];
+        }
+
+        SIMD_INLINE void LabToBgr(const uint8_t * lab, const float * encode, uint8_t * bgr)
+        {
+            __m512i l, a, b, blue[4], green[4], red[4];
+            LoadBgr(lab, l, a, b);
+            LabToBgr<0>(l, a, b, encode, blue, green, red);
+            LabToBgr<1>(l, a, b, encode, blue, green, red);
+            LabToBgr<2>(l, a, b, encode, blue, green, red);
+            LabToBgr<3>(l, a, b, encode, blue, green, red);
+            StoreBgr(blue, green, red, bgr);
+        }
+
+        void LabToBgr(const uint8_t * lab, size_t width, size_t height, size_t labStride, uint8_t * bgr, size_t bgrStride)
+        {
+            assert(width >= A);
+
+            const float * encode = Base::GetLabGamma().encode;
+            size_t widthA = AlignLo(width, A), tail = (width - A) * 3;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA * 3; col += A * 3)
+                    LabToBgr(lab + col, encode, bgr + col);
+                if (widthA < width)
+                    LabToBgr(lab + tail, encode, bgr + tail);
+                lab += labStride;
+                bgr += bgrStride;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void Lab32fToBgr(const float * lab, const float * encode, uint8_t * bgr)
+        {
+            __m512i blue[4], green[4], red[4];
+            for (size_t i = 0; i < 4; ++i)
+            {
+                __m512 _lab[3];
+                __m512i _bgr[3];
+                LoadLab32f(lab + i * F * 3, _lab);
+                LabToBgr(_lab[0], _lab[1], _lab[2], encode, _bgr);
+                blue[i] = _bgr[0];
+                green[i] = _bgr[1];
+                red[i] = _bgr[2];
+            }
+            StoreBgr(blue, green, red, bgr);
+        }
+
+        void Lab32fToBgr(const uint8_t * lab, size_t width, size_t height, size_t labStride, uint8_t * bgr, size_t bgrStride)
+        {
+            assert(width >= A);
+
+            const float * encode = Base::GetLabGamma().encode;
+            size_t widthA = AlignLo(width, A), tail = (width - A) * 3;
+            for (size_t row = 0; row < height; ++row)
+            {
+                const float * pLab = (const float*)lab;
+                for (size_t col = 0; col < widthA * 3; col += A * 3)
+                    Lab32fToBgr(pLab + col, encode, bgr + col);
+                if (widthA < width)
+                    Lab32fToBgr(pLab + tail, encode, bgr + tail);
+                lab += labStride;
+                bgr += bgrStride;
+            }
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
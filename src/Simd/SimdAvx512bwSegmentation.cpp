@@ -24,6 +24,7 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
 #include "Simd/SimdCompare.h"
+#include "Simd/SimdSegmentation.h"
 
 namespace Simd
 {
@@ -284,6 +285,41 @@ namespace Simd
                 }
             }
         }
+
+        template<SimdCompareType compareType> size_t SegmentationRowEdges(const uint8_t * mask, size_t width, uint8_t value, uint32_t * edges)
+        {
+            const __m512i _value = _mm512_set1_epi8(value);
+            size_t count = 0;
+            uint64_t last = 0;
+            for (size_t col = 0; col < width; col += A)
+            {
+                __mmask64 tail = TailMask64(width - col);
+                uint64_t bits = Compare8u<compareType>(_mm512_maskz_loadu_epi8(tail, mask + col), _value) & tail;
+                Base::SegmentationMaskToEdges(bits, Simd::Min(A, width - col), (uint32_t)col, last, edges, count);
+            }
+            if (last)
+                edges[count++] = (uint32_t)width;
+            return count;
+        }
+
+        size_t SegmentationLabelComponents(const uint8_t * mask, size_t maskStride, size_t width, size_t height, SimdCompareType compareType, uint8_t value,
+            int connectivity, uint32_t * labels, size_t labelsStride, SimdConnectedComponent * components, size_t capacity)
+        {
+            Base::SegmentationRowEdgesPtr rowEdges = NULL;
+            switch (compareType)
+            {
+            case SimdCompareEqual: rowEdges = SegmentationRowEdges<SimdCompareEqual>; break;
+            case SimdCompareNotEqual: rowEdges = SegmentationRowEdges<SimdCompareNotEqual>; break;
+            case SimdCompareGreater: rowEdges = SegmentationRowEdges<SimdCompareGreater>; break;
+            case SimdCompareGreaterOrEqual: rowEdges = SegmentationRowEdges<SimdCompareGreaterOrEqual>; break;
+            case SimdCompareLesser: rowEdges = SegmentationRowEdges<SimdCompareLesser>; break;
+            case SimdCompareLesserOrEqual: rowEdges = SegmentationRowEdges<SimdCompareLesserOrEqual>; break;
+            default:
+                assert(0);
+                return 0;
+            }
+            return Base::SegmentationLabelComponents(mask, maskStride, width, height, value, connectivity, labels, labelsStride, components, capacity, rowEdges);
+        }
     }
 #endif//SIMD_AVX512BW_ENABLE
 }
@@ -0,0 +1,133 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        template<int part> SIMD_INLINE __m512i Widen(__m512i value)
+        {
+            return _mm512_cvtepu8_epi16(_mm512_extracti64x4_epi64(value, part));
+        }
+
+        SIMD_INLINE __m512i PackU16ToU8(__m512i lo, __m512i hi)
+        {
+            return _mm512_permutexvar_epi64(K64_PERMUTE_FOR_PACK, _mm512_packus_epi16(lo, hi));
+        }
+
+        SIMD_INLINE __m512i BgrToYCoCgR(__m512i blue, __m512i green, __m512i red, int16_t * co, int16_t * cg)
+        {
+            __m512i _co = _mm512_sub_epi16(red, blue);
+            __m512i t = _mm512_add_epi16(blue, _mm512_srai_epi16(_co, 1));
+            __m512i _cg = _mm512_sub_epi16(green, t);
+            _mm512_storeu_si512((__m512i*)co, _co);
+            _mm512_storeu_si512((__m512i*)cg, _cg);
+            return _mm512_add_epi16(t, _mm512_srai_epi16(_cg, 1));
+        }
+
+        SIMD_INLINE void BgrToYCoCgR(const uint8_t * bgr, uint8_t * y, int16_t * co, int16_t * cg)
+        {
+            __m256i _lo[3], _hi[3];
+            _lo[0] = _mm256_loadu_si256((__m256i*)bgr + 0);
+            _lo[1] = _mm256_loadu_si256((__m256i*)bgr + 1);
+            _lo[2] = _mm256_loadu_si256((__m256i*)bgr + 2);
+            _hi[0] = _mm256_loadu_si256((__m256i*)bgr + 3);
+            _hi[1] = _mm256_loadu_si256((__m256i*)bgr + 4);
+            _hi[2] = _mm256_loadu_si256((__m256i*)bgr + 5);
+            __m512i blue = _mm512_inserti64x4(_mm512_castsi256_si512(Avx2::BgrToBlue(_lo)), Avx2::BgrToBlue(_hi), 1);
+            __m512i green = _mm512_inserti64x4(_mm512_castsi256_si512(Avx2::BgrToGreen(_lo)), Avx2::BgrToGreen(_hi), 1);
+            __m512i red = _mm512_inserti64x4(_mm512_castsi256_si512(Avx2::BgrToRed(_lo)), Avx2::BgrToRed(_hi), 1);
+            __m512i lo = BgrToYCoCgR(Widen<0>(blue), Widen<0>(green), Widen<0>(red), co + 0, cg + 0);
+            __m512i hi = BgrToYCoCgR(Widen<1>(blue), Widen<1>(green), Widen<1>(red), co + HA, cg + HA);
+            _mm512_storeu_si512((__m512i*)y, PackU16ToU8(lo, hi));
+        }
+
+        void BgrToYCoCgR(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * co, size_t coStride, uint8_t * cg, size_t cgStride)
+        {
+            assert(width >= A);
+
+            size_t widthA = AlignLo(width, A), tail = width - A;
+            for (size_t row = 0; row < height; ++row)
+            {
+                int16_t * pCo = (int16_t*)co, * pCg = (int16_t*)cg;
+                for (size_t col = 0; col < widthA; col += A)
+                    BgrToYCoCgR(bgr + col * 3, y + col, pCo + col, pCg + col);
+                if (widthA < width)
+                    BgrToYCoCgR(bgr + tail * 3, y + tail, pCo + tail, pCg + tail);
+                bgr += bgrStride;
+                y += yStride;
+                co += coStride;
+                cg += cgStride;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void YCoCgRToBgr(__m512i y, const int16_t * co, const int16_t * cg, __m512i & blue, __m512i & green, __m512i & red)
+        {
+            __m512i _co = _mm512_loadu_si512((__m512i*)co);
+            __m512i _cg = _mm512_loadu_si512((__m512i*)cg);
+            __m512i t = _mm512_sub_epi16(y, _mm512_srai_epi16(_cg, 1));
+            blue = _mm512_sub_epi16(t, _mm512_srai_epi16(_co, 1));
+            green = _mm512_add_epi16(_cg, t);
+            red = _mm512_add_epi16(blue, _co);
+        }
+
+        SIMD_INLINE void YCoCgRToBgr(const uint8_t * y, const int16_t * co, const int16_t * cg, uint8_t * bgr)
+        {
+            __m512i _y = _mm512_loadu_si512((__m512i*)y), blue[2], green[2], red[2];
+            YCoCgRToBgr(Widen<0>(_y), co + 0, cg + 0, blue[0], green[0], red[0]);
+            YCoCgRToBgr(Widen<1>(_y), co + HA, cg + HA, blue[1], green[1], red[1]);
+            __m512i b = PackU16ToU8(blue[0], blue[1]);
+            __m512i g = PackU16ToU8(green[0], green[1]);
+            __m512i r = PackU16ToU8(red[0], red[1]);
+            _mm512_storeu_si512((__m512i*)bgr + 0, InterleaveBgr<0>(b, g, r));
+            _mm512_storeu_si512((__m512i*)bgr + 1, InterleaveBgr<1>(b, g, r));
+            _mm512_storeu_si512((__m512i*)bgr + 2, InterleaveBgr<2>(b, g, r));
+        }
+
+        void YCoCgRToBgr(const uint8_t * y, size_t yStride, const uint8_t * co, size_t coStride, const uint8_t * cg, size_t cgStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            assert(width >= A);
+
+            size_t widthA = AlignLo(width, A), tail = width - A;
+            for (size_t row = 0; row < height; ++row)
+            {
+                const int16_t * pCo = (const int16_t*)co, * pCg = (const int16_t*)cg;
+                for (size_t col = 0; col < widthA; col += A)
+                    YCoCgRToBgr(y + col, pCo + col, pCg + col, bgr + col * 3);
+                if (widthA < width)
+                    YCoCgRToBgr(y + tail, pCo + tail, pCg + tail, bgr + tail * 3);
+                y += yStride;
+                co += coStride;
+                cg += cgStride;
+                bgr += bgrStride;
+            }
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
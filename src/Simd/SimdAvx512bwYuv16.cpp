@@ -0,0 +1,402 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdArray.h"
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdAvx512bw.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        template <bool mask> SIMD_INLINE void Uint16ToGray(const uint16_t * src, __m512i level, __m128i shift, uint8_t * dst, __mmask32 tail = -1)
+        {
+            __m512i value = Load<false, mask>(src, tail);
+            _mm512_mask_cvtusepi16_storeu_epi8(dst, tail, _mm512_srl_epi16(_mm512_adds_epu16(value, level), shift));
+        }
+
+        static void Uint16ToGray(const uint16_t * src, size_t width, size_t row, size_t shift, SimdBool dither, uint8_t * dst)
+        {
+            uint16_t levels[4];
+            Base::Uint16ToGrayLevels(row, shift, dither == SimdTrue, levels);
+            __m512i _level = _mm512_broadcastq_epi64(_mm_loadl_epi64((__m128i*)levels));
+            __m128i _shift = _mm_cvtsi32_si128((int)shift);
+            size_t alignedWidth = AlignLo(width, HA), col = 0;
+            __mmask32 tail = TailMask32(width - alignedWidth);
+            for (; col < alignedWidth; col += HA)
+                Uint16ToGray<false>(src + col, _level, _shift, dst + col);
+            if (col < width)
+                Uint16ToGray<true>(src + col, _level, _shift, dst + col, tail);
+        }
+
+        void Uint16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, size_t bitDepth, SimdBool dither, uint8_t * dst, size_t dstStride)
+        {
+            assert(bitDepth > 8 && bitDepth <= 16);
+
+            for (size_t row = 0; row < height; ++row)
+            {
+                Uint16ToGray((const uint16_t*)src, width, row, bitDepth - 8, dither, dst);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        template <bool mask> SIMD_INLINE void Uint16ToFloat32(const uint16_t * src, __m512 scale, float * dst, __mmask32 tail = -1)
+        {
+            __m512i value = Load<false, mask>(src, tail);
+            Avx512f::Store<false, mask>(dst + 0, _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_cvtepu16_epi32(_mm512_castsi512_si256(value))), scale), __mmask16(tail >> 00));
+            Avx512f::Store<false, mask>(dst + F, _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64(value, 1))), scale), __mmask16(tail >> 16));
+        }
+
+        void Uint16ToFloat32(const uint8_t * src, size_t width, size_t height, size_t srcStride, size_t bitDepth, uint8_t * dst, size_t dstStride)
+        {
+            assert(bitDepth > 8 && bitDepth <= 16);
+
+            __m512 scale = _mm512_set1_ps(1.0f / float((1 << bitDepth) - 1));
+            size_t alignedWidth = AlignLo(width, HA);
+            __mmask32 tail = TailMask32(width - alignedWidth);
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint16_t * s = (const uint16_t*)src;
+                float * d = (float*)dst;
+                size_t col = 0;
+                for (; col < alignedWidth; col += HA)
+                    Uint16ToFloat32<false>(s + col, scale, d + col);
+                if (col < width)
+                    Uint16ToFloat32<true>(s + col, scale, d + col, tail);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        template<class T> SIMD_INLINE __m512i LoadSamples(const T * src);
+
+        template<> SIMD_INLINE __m512i LoadSamples<uint8_t>(const uint8_t * src)
+        {
+            return _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i*)src));
+        }
+
+        template<> SIMD_INLINE __m512i LoadSamples<uint16_t>(const uint16_t * src)
+        {
+            return _mm512_loadu_si512(src);
+        }
+
+        template<class T> SIMD_INLINE void StoreSamples(T * dst, __m512i value);
+
+        template<> SIMD_INLINE void StoreSamples<uint8_t>(uint8_t * dst, __m512i value)
+        {
+            _mm256_storeu_si256((__m256i*)dst, _mm512_cvtusepi16_epi8(value));
+        }
+
+        template<> SIMD_INLINE void StoreSamples<uint16_t>(uint16_t * dst, __m512i value)
+        {
+            _mm512_storeu_si512(dst, value);
+        }
+
+        struct BitDepthConverter
+        {
+            BitDepthConverter(size_t srcBitDepth, size_t dstBitDepth)
+            {
+                int shift = int(srcBitDepth) - int(dstBitDepth);
+                _up = _mm_cvtsi32_si128(shift < 0 ? -shift : 0);
+                _down = _mm_cvtsi32_si128(shift > 0 ? shift : 0);
+                _round = _mm512_set1_epi16(shift > 0 ? 1 << (shift - 1) : 0);
+                _max = _mm512_set1_epi16((1 << dstBitDepth) - 1);
+            }
+
+            SIMD_INLINE __m512i operator()(__m512i value) const
+            {
+                value = _mm512_srl_epi16(_mm512_adds_epu16(_mm512_sll_epi16(value, _up), _round), _down);
+                return _mm512_min_epu16(value, _max);
+            }
+
+        private:
+            __m128i _up, _down;
+            __m512i _round, _max;
+        };
+
+        const __m512i K16_PERMUTE_INTERLEAVE_UV_0 = SIMD_MM512_SETR_EPI16(
+            0x00, 0x20, 0x01, 0x21, 0x02, 0x22, 0x03, 0x23, 0x04, 0x24, 0x05, 0x25, 0x06, 0x26, 0x07, 0x27,
+            0x08, 0x28, 0x09, 0x29, 0x0A, 0x2A, 0x0B, 0x2B, 0x0C, 0x2C, 0x0D, 0x2D, 0x0E, 0x2E, 0x0F, 0x2F);
+        const __m512i K16_PERMUTE_INTERLEAVE_UV_1 = SIMD_MM512_SETR_EPI16(
+            0x10, 0x30, 0x11, 0x31, 0x12, 0x32, 0x13, 0x33, 0x14, 0x34, 0x15, 0x35, 0x16, 0x36, 0x17, 0x37,
+            0x18, 0x38, 0x19, 0x39, 0x1A, 0x3A, 0x1B, 0x3B, 0x1C, 0x3C, 0x1D, 0x3D, 0x1E, 0x3E, 0x1F, 0x3F);
+
+        SIMD_INLINE void InterleaveUv16(__m512i u, __m512i v, __m512i uv[2])
+        {
+            uv[0] = _mm512_permutex2var_epi16(u, K16_PERMUTE_INTERLEAVE_UV_0, v);
+            uv[1] = _mm512_permutex2var_epi16(u, K16_PERMUTE_INTERLEAVE_UV_1, v);
+        }
+
+        SIMD_INLINE void DeinterleaveUv16(__m512i uv0, __m512i uv1, __m512i & u, __m512i & v)
+        {
+            u = _mm512_permutex2var_epi16(uv0, K16_PERMUTE_FOR_HADD_0, uv1);
+            v = _mm512_permutex2var_epi16(uv0, K16_PERMUTE_FOR_HADD_1, uv1);
+        }
+
+        template<class S, class D> void ChangeBitDepth(const uint8_t * src, size_t width, size_t height, size_t srcStride,
+            const BitDepthConverter & converter, uint8_t * dst, size_t dstStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                const S * s = (const S*)src;
+                D * d = (D*)dst;
+                for (size_t col = 0; col < width; col += HA)
+                    StoreSamples(d + col, converter(LoadSamples(s + col)));
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        void ChangeBitDepth(const uint8_t * src, size_t width, size_t height, size_t srcStride, size_t srcBitDepth, size_t dstBitDepth, uint8_t * dst, size_t dstStride)
+        {
+            assert(srcBitDepth >= 8 && srcBitDepth <= 16 && dstBitDepth >= 8 && dstBitDepth <= 16 && width >= HA);
+
+            BitDepthConverter converter(srcBitDepth, dstBitDepth);
+            size_t widthHA = AlignLo(width, HA), srcSize = srcBitDepth > 8 ? 2 : 1, dstSize = dstBitDepth > 8 ? 2 : 1;
+            if (srcSize == 2)
+            {
+                if (dstSize == 2)
+                    ChangeBitDepth<uint16_t, uint16_t>(src, widthHA, height, srcStride, converter, dst, dstStride);
+                else
+                    ChangeBitDepth<uint16_t, uint8_t>(src, widthHA, height, srcStride, converter, dst, dstStride);
+            }
+            else
+            {
+                if (dstSize == 2)
+                    ChangeBitDepth<uint8_t, uint16_t>(src, widthHA, height, srcStride, converter, dst, dstStride);
+                else
+                    ChangeBitDepth<uint8_t, uint8_t>(src, widthHA, height, srcStride, converter, dst, dstStride);
+            }
+            if (widthHA < width)
+                Base::ChangeBitDepth(src + widthHA * srcSize, width - widthHA, height, srcStride, srcBitDepth, dstBitDepth, dst + widthHA * dstSize, dstStride);
+        }
+
+        template<class S, class D> void InterleaveUvBitDepth(const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, const BitDepthConverter & converter, uint8_t * uv, size_t uvStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                const S * su = (const S*)u, * sv = (const S*)v;
+                D * d = (D*)uv;
+                for (size_t col = 0; col < width; col += HA)
+                {
+                    __m512i _uv[2];
+                    InterleaveUv16(converter(LoadSamples(su + col)), converter(LoadSamples(sv + col)), _uv);
+                    StoreSamples(d + 2 * col + 0, _uv[0]);
+                    StoreSamples(d + 2 * col + HA, _uv[1]);
+                }
+                u += uStride;
+                v += vStride;
+                uv += uvStride;
+            }
+        }
+
+        void InterleaveUvBitDepth(const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height,
+            size_t srcBitDepth, size_t dstBitDepth, uint8_t * uv, size_t uvStride)
+        {
+            assert(srcBitDepth >= 8 && srcBitDepth <= 16 && dstBitDepth >= 8 && dstBitDepth <= 16 && width >= HA);
+
+            BitDepthConverter converter(srcBitDepth, dstBitDepth);
+            size_t widthHA = AlignLo(width, HA), srcSize = srcBitDepth > 8 ? 2 : 1, dstSize = dstBitDepth > 8 ? 2 : 1;
+            if (srcSize == 2)
+            {
+                if (dstSize == 2)
+                    InterleaveUvBitDepth<uint16_t, uint16_t>(u, uStride, v, vStride, widthHA, height, converter, uv, uvStride);
+                else
+                    InterleaveUvBitDepth<uint16_t, uint8_t>(u, uStride, v, vStride, widthHA, height, converter, uv, uvStride);
+            }
+            else
+            {
+                if (dstSize == 2)
+                    InterleaveUvBitDepth<uint8_t, uint16_t>(u, uStride, v, vStride, widthHA, height, converter, uv, uvStride);
+                else
+                    InterleaveUvBitDepth<uint8_t, uint8_t>(u, uStride, v, vStride, widthHA, height, converter, uv, uvStride);
+            }
+            if (widthHA < width)
+                Base::InterleaveUvBitDepth(u + widthHA * srcSize, uStride, v + widthHA * srcSize, vStride, width - widthHA, height,
+                    srcBitDepth, dstBitDepth, uv + 2 * widthHA * dstSize, uvStride);
+        }
+
+        template<class S, class D> void DeinterleaveUvBitDepth(const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            const BitDepthConverter & converter, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                const S * s = (const S*)uv;
+                D * du = (D*)u, * dv = (D*)v;
+                for (size_t col = 0; col < width; col += HA)
+                {
+                    __m512i _u, _v;
+                    DeinterleaveUv16(converter(LoadSamples(s + 2 * col + 0)), converter(LoadSamples(s + 2 * col + HA)), _u, _v);
+                    StoreSamples(du + col, _u);
+                    StoreSamples(dv + col, _v);
+                }
+                uv += uvStride;
+                u += uStride;
+                v += vStride;
+            }
+        }
+
+        void DeinterleaveUvBitDepth(const uint8_t * uv, size_t uvStride, size_t width, size_t height, size_t srcBitDepth, size_t dstBitDepth,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            assert(srcBitDepth >= 8 && srcBitDepth <= 16 && dstBitDepth >= 8 && dstBitDepth <= 16 && width >= HA);
+
+            BitDepthConverter converter(srcBitDepth, dstBitDepth);
+            size_t widthHA = AlignLo(width, HA), srcSize = srcBitDepth > 8 ? 2 : 1, dstSize = dstBitDepth > 8 ? 2 : 1;
+            if (srcSize == 2)
+            {
+                if (dstSize == 2)
+                    DeinterleaveUvBitDepth<uint16_t, uint16_t>(uv, uvStride, widthHA, height, converter, u, uStride, v, vStride);
+                else
+                    DeinterleaveUvBitDepth<uint16_t, uint8_t>(uv, uvStride, widthHA, height, converter, u, uStride, v, vStride);
+            }
+            else
+            {
+                if (dstSize == 2)
+                    DeinterleaveUvBitDepth<uint8_t, uint16_t>(uv, uvStride, widthHA, height, converter, u, uStride, v, vStride);
+                else
+                    DeinterleaveUvBitDepth<uint8_t, uint8_t>(uv, uvStride, widthHA, height, converter, u, uStride, v, vStride);
+            }
+            if (widthHA < width)
+                Base::DeinterleaveUvBitDepth(uv + 2 * widthHA * srcSize, uvStride, width - widthHA, height, srcBitDepth, dstBitDepth,
+                    u + widthHA * dstSize, uStride, v + widthHA * dstSize, vStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        struct Yuv16Buffer
+        {
+            Yuv16Buffer(size_t width, uint8_t * external)
+            {
+                yStride = AlignHi(width, A);
+                uvStride = AlignHi(width / 2, A);
+                if (external)
+                    y = (uint8_t*)AlignHi(external, A);
+                else
+                {
+                    _buffer.Resize(yStride * 3 + uvStride * 2);
+                    y = _buffer.data;
+                }
+                uv = y + 2 * yStride;
+                u = uv + yStride;
+                v = u + uvStride;
+            }
+
+            uint8_t * y, * uv, * u, * v;
+            size_t yStride, uvStride;
+        private:
+            Array8u _buffer;
+        };
+
+        static void Yuv420p16ToYuv420p(const uint8_t * y, size_t yStride, const uint8_t * u, const uint8_t * v,
+            size_t width, size_t row, size_t shift, SimdBool dither, Yuv16Buffer & buffer)
+        {
+            Uint16ToGray((const uint16_t*)y, width, row, shift, dither, buffer.y);
+            Uint16ToGray((const uint16_t*)(y + yStride), width, row + 1, shift, dither, buffer.y + buffer.yStride);
+            Uint16ToGray((const uint16_t*)u, width / 2, row / 2, shift, dither, buffer.u);
+            Uint16ToGray((const uint16_t*)v, width / 2, row / 2, shift, dither, buffer.v);
+        }
+
+        static void P016ToYuv420p(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t width, size_t row, SimdBool dither, Yuv16Buffer & buffer)
+        {
+            Uint16ToGray((const uint16_t*)y, width, row, 8, dither, buffer.y);
+            Uint16ToGray((const uint16_t*)(y + yStride), width, row + 1, 8, dither, buffer.y + buffer.yStride);
+            Uint16ToGray((const uint16_t*)uv, width, row / 2, 8, dither, buffer.uv);
+            DeinterleaveUv(buffer.uv, buffer.yStride, width / 2, 1, buffer.u, buffer.uvStride, buffer.v, buffer.uvStride);
+        }
+
+        void Yuv420p16ToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, size_t bitDepth, uint8_t * bgr, size_t bgrStride, SimdBool dither, SimdYuvType yuvType, uint8_t * buf)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && bitDepth > 8 && bitDepth <= 16);
+
+            Yuv16Buffer buffer(width, buf);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                Yuv420p16ToYuv420p(y, yStride, u, v, width, row, bitDepth - 8, dither, buffer);
+                Yuv420pToBgrV2(buffer.y, buffer.yStride, buffer.u, buffer.uvStride, buffer.v, buffer.uvStride, width, 2, bgr, bgrStride, yuvType);
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+                bgr += 2 * bgrStride;
+            }
+        }
+
+        void Yuv420p16ToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, size_t bitDepth, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdBool dither, SimdYuvType yuvType, uint8_t * buf)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && bitDepth > 8 && bitDepth <= 16);
+
+            Yuv16Buffer buffer(width, buf);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                Yuv420p16ToYuv420p(y, yStride, u, v, width, row, bitDepth - 8, dither, buffer);
+                Yuv420pToBgraV2(buffer.y, buffer.yStride, buffer.u, buffer.uvStride, buffer.v, buffer.uvStride, width, 2, bgra, bgraStride, alpha, yuvType);
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+                bgra += 2 * bgraStride;
+            }
+        }
+
+        void P016ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            uint8_t * bgr, size_t bgrStride, SimdBool dither, SimdYuvType yuvType, uint8_t * buf)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+
+            Yuv16Buffer buffer(width, buf);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                P016ToYuv420p(y, yStride, uv, width, row, dither, buffer);
+                Yuv420pToBgrV2(buffer.y, buffer.yStride, buffer.u, buffer.uvStride, buffer.v, buffer.uvStride, width, 2, bgr, bgrStride, yuvType);
+                y += 2 * yStride;
+                uv += uvStride;
+                bgr += 2 * bgrStride;
+            }
+        }
+
+        void P016ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdBool dither, SimdYuvType yuvType, uint8_t * buf)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+
+            Yuv16Buffer buffer(width, buf);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                P016ToYuv420p(y, yStride, uv, width, row, dither, buffer);
+                Yuv420pToBgraV2(buffer.y, buffer.yStride, buffer.u, buffer.uvStride, buffer.v, buffer.uvStride, width, 2, bgra, bgraStride, alpha, yuvType);
+                y += 2 * yStride;
+                uv += uvStride;
+                bgra += 2 * bgraStride;
+            }
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
@@ -30,31 +30,36 @@ namespace Simd
 #ifdef SIMD_AVX512BW_ENABLE    
     namespace Avx512bw
     {
-        template <bool align, bool mask> SIMD_INLINE void YuvToBgr(const __m512i & y, const __m512i & u, const __m512i & v, uint8_t * bgr, const __mmask64 * tails)
+        template <bool align, bool mask, class T = Base::Bt601> SIMD_INLINE void YuvToBgr(const __m512i & y, const __m512i & u, const __m512i & v, uint8_t * bgr, const __mmask64 * tails)
         {
-            __m512i blue = YuvToBlue(y, u);
-            __m512i green = YuvToGreen(y, u, v);
-            __m512i red = YuvToRed(y, v);
+            __m512i blue = YuvToBlue<T>(y, u);
+            __m512i green = YuvToGreen<T>(y, u, v);
+            __m512i red = YuvToRed<T>(y, v);
             Store<align, mask>(bgr + 0 * A, InterleaveBgr<0>(blue, green, red), tails[0]);
             Store<align, mask>(bgr + 1 * A, InterleaveBgr<1>(blue, green, red), tails[1]);
             Store<align, mask>(bgr + 2 * A, InterleaveBgr<2>(blue, green, red), tails[2]);
         }
 
-        template <bool align, bool mask> SIMD_INLINE void Yuv420pToBgr(const uint8_t * y0, const uint8_t * y1, const uint8_t * u, const uint8_t * v, uint8_t * bgr0, uint8_t * bgr1, const __mmask64 * tails)
+        template <bool align, bool mask, class T = Base::Bt601> SIMD_INLINE void Yuv420pToBgr(const uint8_t * y0, const uint8_t * y1, const __m512i & u, const __m512i & v, uint8_t * bgr0, uint8_t * bgr1, const __mmask64 * tails)
+        {
+            __m512i u0 = UnpackU8<0>(u, u);
+            __m512i u1 = UnpackU8<1>(u, u);
+            __m512i v0 = UnpackU8<0>(v, v);
+            __m512i v1 = UnpackU8<1>(v, v);
+            YuvToBgr<align, mask, T>(Load<align, mask>(y0 + 0, tails[1]), u0, v0, bgr0 + 0 * A, tails + 3);
+            YuvToBgr<align, mask, T>(Load<align, mask>(y0 + A, tails[2]), u1, v1, bgr0 + 3 * A, tails + 6);
+            YuvToBgr<align, mask, T>(Load<align, mask>(y1 + 0, tails[1]), u0, v0, bgr1 + 0 * A, tails + 3);
+            YuvToBgr<align, mask, T>(Load<align, mask>(y1 + A, tails[2]), u1, v1, bgr1 + 3 * A, tails + 6);
+        }
+
+        template <bool align, bool mask, class T = Base::Bt601> SIMD_INLINE void Yuv420pToBgr(const uint8_t * y0, const uint8_t * y1, const uint8_t * u, const uint8_t * v, uint8_t * bgr0, uint8_t * bgr1, const __mmask64 * tails)
         {
             __m512i _u = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, (Load<align, mask>(u, tails[0])));
-            __m512i u0 = UnpackU8<0>(_u, _u);
-            __m512i u1 = UnpackU8<1>(_u, _u);
             __m512i _v = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, (Load<align, mask>(v, tails[0])));
-            __m512i v0 = UnpackU8<0>(_v, _v);
-            __m512i v1 = UnpackU8<1>(_v, _v);
-            YuvToBgr<align, mask>(Load<align, mask>(y0 + 0, tails[1]), u0, v0, bgr0 + 0 * A, tails + 3);
-            YuvToBgr<align, mask>(Load<align, mask>(y0 + A, tails[2]), u1, v1, bgr0 + 3 * A, tails + 6);
-            YuvToBgr<align, mask>(Load<align, mask>(y1 + 0, tails[1]), u0, v0, bgr1 + 0 * A, tails + 3);
-            YuvToBgr<align, mask>(Load<align, mask>(y1 + A, tails[2]), u1, v1, bgr1 + 3 * A, tails + 6);
+            Yuv420pToBgr<align, mask, T>(y0, y1, _u, _v, bgr0, bgr1, tails);
         }
 
-        template <bool align> void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <bool align, class T = Base::Bt601> void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             assert((width % 2 == 0) && (height % 2 == 0));
@@ -77,9 +82,9 @@ namespace Simd
             {
                 size_t col = 0;
                 for (; col < alignedWidth; col += A)
-                    Yuv420pToBgr<align, false>(y + col * 2, y + yStride + col * 2, u + col, v + col, bgr + col * 6, bgr + bgrStride + col * 6, tailMasks);
+                    Yuv420pToBgr<align, false, T>(y + col * 2, y + yStride + col * 2, u + col, v + col, bgr + col * 6, bgr + bgrStride + col * 6, tailMasks);
                 if (col < width)
-                    Yuv420pToBgr<align, true>(y + col * 2, y + yStride + col * 2, u + col, v + col, bgr + col * 6, bgr + bgrStride + col * 6, tailMasks);
+                    Yuv420pToBgr<align, true, T>(y + col * 2, y + yStride + col * 2, u + col, v + col, bgr + col * 6, bgr + bgrStride + col * 6, tailMasks);
                 y += 2 * yStride;
                 u += uStride;
                 v += vStride;
@@ -87,25 +92,52 @@ namespace Simd
             }
         }
 
-        void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
-                Yuv420pToBgr<true>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv420pToBgr<true, T>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
             else
-                Yuv420pToBgr<false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv420pToBgr<false, T>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Yuv420pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv420pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Yuv420pToBgr<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Yuv420pToBgr<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt601Full: Yuv420pToBgr<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Yuv420pToBgr<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Yuv420pToBgr<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            default: assert(0);
+            }
+        }
+
+        void Yuv420pToRgb(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+        {
+            Yuv420pToBgr<Base::Rgb<Base::Bt601>>(y, yStride, v, vStride, u, uStride, width, height, rgb, rgbStride);
         }
 
-        template <bool align, bool mask> SIMD_INLINE void Yuv422pToBgr(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * bgr, const __mmask64 * tails)
+        template <bool align, bool mask, class T = Base::Bt601> SIMD_INLINE void Yuv422pToBgr(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * bgr, const __mmask64 * tails)
         {
             __m512i _u = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, (Load<align, mask>(u, tails[0])));
             __m512i _v = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, (Load<align, mask>(v, tails[0])));
-            YuvToBgr<align, mask>(Load<align, mask>(y + 0, tails[1]), _mm512_unpacklo_epi8(_u, _u), _mm512_unpacklo_epi8(_v, _v), bgr + 0 * A, tails + 3);
-            YuvToBgr<align, mask>(Load<align, mask>(y + A, tails[2]), _mm512_unpackhi_epi8(_u, _u), _mm512_unpackhi_epi8(_v, _v), bgr + 3 * A, tails + 6);
+            YuvToBgr<align, mask, T>(Load<align, mask>(y + 0, tails[1]), _mm512_unpacklo_epi8(_u, _u), _mm512_unpacklo_epi8(_v, _v), bgr + 0 * A, tails + 3);
+            YuvToBgr<align, mask, T>(Load<align, mask>(y + A, tails[2]), _mm512_unpackhi_epi8(_u, _u), _mm512_unpackhi_epi8(_v, _v), bgr + 3 * A, tails + 6);
         }
 
-        template <bool align> void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <bool align, class T = Base::Bt601> void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             assert((width % 2 == 0));
@@ -128,9 +160,9 @@ namespace Simd
             {
                 size_t col = 0;
                 for (; col < alignedWidth; col += A)
-                    Yuv422pToBgr<align, false>(y + col * 2, u + col, v + col, bgr + col * 6, tailMasks);
+                    Yuv422pToBgr<align, false, T>(y + col * 2, u + col, v + col, bgr + col * 6, tailMasks);
                 if (col < width)
-                    Yuv422pToBgr<align, true>(y + col * 2, u + col, v + col, bgr + col * 6, tailMasks);
+                    Yuv422pToBgr<align, true, T>(y + col * 2, u + col, v + col, bgr + col * 6, tailMasks);
                 y += yStride;
                 u += uStride;
                 v += vStride;
@@ -138,22 +170,49 @@ namespace Simd
             }
         }
 
-        void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
-                Yuv422pToBgr<true>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv422pToBgr<true, T>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
             else
-                Yuv422pToBgr<false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv422pToBgr<false, T>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
         }
 
-        template <bool align, bool mask> SIMD_INLINE void Yuv444pToBgr(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * bgr, const __mmask64 * tails)
+        void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
-            YuvToBgr<align, mask>(Load<align, mask>(y, tails[0]), Load<align, mask>(u, tails[0]), Load<align, mask>(v, tails[0]), bgr, tails + 1);
+            Yuv422pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
         }
 
-        template <bool align> void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        void Yuv422pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv422pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Yuv422pToBgr<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Yuv422pToBgr<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt601Full: Yuv422pToBgr<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Yuv422pToBgr<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Yuv422pToBgr<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            default: assert(0);
+            }
+        }
+
+        void Yuv422pToRgb(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+        {
+            Yuv422pToBgr<Base::Rgb<Base::Bt601>>(y, yStride, v, vStride, u, uStride, width, height, rgb, rgbStride);
+        }
+
+        template <bool align, bool mask, class T = Base::Bt601> SIMD_INLINE void Yuv444pToBgr(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * bgr, const __mmask64 * tails)
+        {
+            YuvToBgr<align, mask, T>(Load<align, mask>(y, tails[0]), Load<align, mask>(u, tails[0]), Load<align, mask>(v, tails[0]), bgr, tails + 1);
+        }
+
+        template <bool align, class T = Base::Bt601> void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             if (align)
@@ -172,9 +231,9 @@ namespace Simd
             {
                 size_t col = 0;
                 for (; col < alignedWidth; col += A)
-                    Yuv444pToBgr<align, false>(y + col, u + col, v + col, bgr + col * 3, tailMasks);
+                    Yuv444pToBgr<align, false, T>(y + col, u + col, v + col, bgr + col * 3, tailMasks);
                 if (col < width)
-                    Yuv444pToBgr<align, true>(y + col, u + col, v + col, bgr + col * 3, tailMasks);
+                    Yuv444pToBgr<align, true, T>(y + col, u + col, v + col, bgr + col * 3, tailMasks);
                 y += yStride;
                 u += uStride;
                 v += vStride;
@@ -182,16 +241,132 @@ namespace Simd
             }
         }
 
-        void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
-                Yuv444pToBgr<true>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv444pToBgr<true, T>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
             else
-                Yuv444pToBgr<false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv444pToBgr<false, T>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
         }
 
+        void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Yuv444pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv444pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv444pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Yuv444pToBgr<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Yuv444pToBgr<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt601Full: Yuv444pToBgr<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Yuv444pToBgr<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Yuv444pToBgr<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            default: assert(0);
+            }
+        }
+
+        void Yuv444pToRgb(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+        {
+            Yuv444pToBgr<Base::Rgb<Base::Bt601>>(y, yStride, v, vStride, u, uStride, width, height, rgb, rgbStride);
+        }
+
+        template <bool align, bool nv21, class T> void Nv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+            if (align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride));
+                assert(Aligned(bgr) && Aligned(bgrStride));
+            }
+
+            width /= 2;
+            size_t alignedWidth = AlignLo(width, A);
+            size_t tail = width - alignedWidth;
+            __mmask64 tailMasks[9];
+            tailMasks[0] = TailMask64(tail);
+            for (size_t i = 0; i < 2; ++i)
+                tailMasks[1 + i] = TailMask64(tail * 2 - A * i);
+            for (size_t i = 0; i < 6; ++i)
+                tailMasks[3 + i] = TailMask64(tail * 6 - A * i);
+            __m512i u, v;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                size_t col = 0;
+                for (; col < alignedWidth; col += A)
+                {
+                    LoadPermutedUv<align, false, nv21>(uv + col * 2, u, v, tailMasks[1], tailMasks[2]);
+                    Yuv420pToBgr<align, false, T>(y + col * 2, y + yStride + col * 2, u, v, bgr + col * 6, bgr + bgrStride + col * 6, tailMasks);
+                }
+                if (col < width)
+                {
+                    LoadPermutedUv<align, true, nv21>(uv + col * 2, u, v, tailMasks[1], tailMasks[2]);
+                    Yuv420pToBgr<align, true, T>(y + col * 2, y + yStride + col * 2, u, v, bgr + col * 6, bgr + bgrStride + col * 6, tailMasks);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                bgr += 2 * bgrStride;
+            }
+        }
+
+        template <bool nv21, class T> void Nv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(bgr) && Aligned(bgrStride))
+                Nv12ToBgr<true, nv21, T>(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+            else
+                Nv12ToBgr<false, nv21, T>(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+        }
+
+        void Nv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Nv12ToBgr<false, Base::Bt601>(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+        }
+
+        void Nv12ToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToBgr<false, Base::Bt601>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Nv12ToBgr<false, Base::Bt709>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Nv12ToBgr<false, Base::Bt2020>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt601Full: Nv12ToBgr<false, Base::Bt601Full>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Nv12ToBgr<false, Base::Bt709Full>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Nv12ToBgr<false, Base::Bt2020Full>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            default: assert(0);
+            }
+        }
+
+        void Nv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Nv12ToBgr<true, Base::Bt601>(y, yStride, vu, vuStride, width, height, bgr, bgrStride);
+        }
+
+        void Nv21ToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToBgr<true, Base::Bt601>(y, yStride, vu, vuStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Nv12ToBgr<true, Base::Bt709>(y, yStride, vu, vuStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Nv12ToBgr<true, Base::Bt2020>(y, yStride, vu, vuStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt601Full: Nv12ToBgr<true, Base::Bt601Full>(y, yStride, vu, vuStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Nv12ToBgr<true, Base::Bt709Full>(y, yStride, vu, vuStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Nv12ToBgr<true, Base::Bt2020Full>(y, yStride, vu, vuStride, width, height, bgr, bgrStride); break;
+            default: assert(0);
+            }
+        }
     }
 #endif// SIMD_AVX2_ENABLE
 }
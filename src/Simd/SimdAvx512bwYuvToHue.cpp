@@ -42,11 +42,11 @@ namespace Simd
             return _mm512_packs_epi32(quotientLo, quotientHi);
         }
 
-        SIMD_INLINE __m512i AdjustedYuvToHue16(const __m512i & y, const __m512i & u, const __m512i & v, const __m512 & KF_255_DIV_6)
+        template <class T> SIMD_INLINE __m512i AdjustedYuvToHue16(const __m512i & y, const __m512i & u, const __m512i & v, const __m512 & KF_255_DIV_6)
         {
-            const __m512i red = AdjustedYuvToRed16(y, v);
-            const __m512i green = AdjustedYuvToGreen16(y, u, v);
-            const __m512i blue = AdjustedYuvToBlue16(y, u);
+            const __m512i red = AdjustedYuvToRed16<T>(y, v);
+            const __m512i green = AdjustedYuvToGreen16<T>(y, u, v);
+            const __m512i blue = AdjustedYuvToBlue16<T>(y, u);
             const __m512i max = MaxI16(red, green, blue);
             const __m512i range = _mm512_subs_epi16(max, MinI16(red, green, blue));
 
@@ -61,29 +61,35 @@ namespace Simd
             return _mm512_and_si512(MulDiv16(dividend, range, KF_255_DIV_6), _mm512_maskz_set1_epi16(_mm512_cmpneq_epi16_mask(range, K_ZERO), 0xFF));
         }
 
-        template <bool align, bool mask> SIMD_INLINE void YuvToHue(const __m512i & y, const __m512i & u, const __m512i & v, const __m512 & KF_255_DIV_6, uint8_t * hue, __mmask64 tail)
+        template <bool align, bool mask, class T> SIMD_INLINE void YuvToHue(const __m512i & y, const __m512i & u, const __m512i & v, const __m512 & KF_255_DIV_6, uint8_t * hue, __mmask64 tail)
         {
-            __m512i lo = AdjustedYuvToHue16(AdjustY16(UnpackU8<0>(y)), AdjustUV16(UnpackU8<0>(u)), AdjustUV16(UnpackU8<0>(v)), KF_255_DIV_6);
-            __m512i hi = AdjustedYuvToHue16(AdjustY16(UnpackU8<1>(y)), AdjustUV16(UnpackU8<1>(u)), AdjustUV16(UnpackU8<1>(v)), KF_255_DIV_6);
+            __m512i lo = AdjustedYuvToHue16<T>(AdjustY16<T>(UnpackU8<0>(y)), AdjustUV16(UnpackU8<0>(u)), AdjustUV16(UnpackU8<0>(v)), KF_255_DIV_6);
+            __m512i hi = AdjustedYuvToHue16<T>(AdjustY16<T>(UnpackU8<1>(y)), AdjustUV16(UnpackU8<1>(u)), AdjustUV16(UnpackU8<1>(v)), KF_255_DIV_6);
             Store<align, mask>(hue, _mm512_packus_epi16(lo, hi), tail);
         }
 
-        template <bool align, bool mask> SIMD_INLINE void Yuv420pToHue(const uint8_t * y0, const uint8_t * y1, const uint8_t * u, const uint8_t * v,
+        template <bool align, bool mask, class T> SIMD_INLINE void Yuv420pToHue(const uint8_t * y0, const uint8_t * y1, const __m512i & u, const __m512i & v,
+            const __m512 & KF_255_DIV_6, uint8_t * hue0, uint8_t * hue1, const __mmask64 * tails)
+        {
+            __m512i u0 = UnpackU8<0>(u, u);
+            __m512i u1 = UnpackU8<1>(u, u);
+            __m512i v0 = UnpackU8<0>(v, v);
+            __m512i v1 = UnpackU8<1>(v, v);
+            YuvToHue<align, mask, T>(Load<align, mask>(y0 + 0, tails[1]), u0, v0, KF_255_DIV_6, hue0 + 0, tails[1]);
+            YuvToHue<align, mask, T>(Load<align, mask>(y0 + A, tails[2]), u1, v1, KF_255_DIV_6, hue0 + A, tails[2]);
+            YuvToHue<align, mask, T>(Load<align, mask>(y1 + 0, tails[1]), u0, v0, KF_255_DIV_6, hue1 + 0, tails[1]);
+            YuvToHue<align, mask, T>(Load<align, mask>(y1 + A, tails[2]), u1, v1, KF_255_DIV_6, hue1 + A, tails[2]);
+        }
+
+        template <bool align, bool mask, class T> SIMD_INLINE void Yuv420pToHue(const uint8_t * y0, const uint8_t * y1, const uint8_t * u, const uint8_t * v,
             const __m512 & KF_255_DIV_6, uint8_t * hue0, uint8_t * hue1, const __mmask64 * tails)
         {
             __m512i _u = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, (Load<align, mask>(u, tails[0])));
-            __m512i u0 = UnpackU8<0>(_u, _u);
-            __m512i u1 = UnpackU8<1>(_u, _u);
             __m512i _v = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, (Load<align, mask>(v, tails[0])));
-            __m512i v0 = UnpackU8<0>(_v, _v);
-            __m512i v1 = UnpackU8<1>(_v, _v);
-            YuvToHue<align, mask>(Load<align, mask>(y0 + 0, tails[1]), u0, v0, KF_255_DIV_6, hue0 + 0, tails[1]);
-            YuvToHue<align, mask>(Load<align, mask>(y0 + A, tails[2]), u1, v1, KF_255_DIV_6, hue0 + A, tails[2]);
-            YuvToHue<align, mask>(Load<align, mask>(y1 + 0, tails[1]), u0, v0, KF_255_DIV_6, hue1 + 0, tails[1]);
-            YuvToHue<align, mask>(Load<align, mask>(y1 + A, tails[2]), u1, v1, KF_255_DIV_6, hue1 + A, tails[2]);
+            Yuv420pToHue<align, mask, T>(y0, y1, _u, _v, KF_255_DIV_6, hue0, hue1, tails);
         }
 
-        template <bool align> void Yuv420pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <bool align, class T> void Yuv420pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * hue, size_t hueStride)
         {
             assert((width % 2 == 0) && (height % 2 == 0));
@@ -106,9 +112,9 @@ namespace Simd
             {
                 size_t col = 0;
                 for (; col < alignedWidth; col += A)
-                    Yuv420pToHue<align, false>(y + col * 2, y + yStride + col * 2, u + col, v + col, KF_255_DIV_6, hue + col * 2, hue + hueStride + col * 2, tailMasks);
+                    Yuv420pToHue<align, false, T>(y + col * 2, y + yStride + col * 2, u + col, v + col, KF_255_DIV_6, hue + col * 2, hue + hueStride + col * 2, tailMasks);
                 if (col < width)
-                    Yuv420pToHue<align, true>(y + col * 2, y + yStride + col * 2, u + col, v + col, KF_255_DIV_6, hue + col * 2, hue + hueStride + col * 2, tailMasks);
+                    Yuv420pToHue<align, true, T>(y + col * 2, y + yStride + col * 2, u + col, v + col, KF_255_DIV_6, hue + col * 2, hue + hueStride + col * 2, tailMasks);
                 y += 2 * yStride;
                 u += uStride;
                 v += vStride;
@@ -116,20 +122,39 @@ namespace Simd
             }
         }
 
-        void Yuv420pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * hue, size_t hueStride)
+        template <class T> void Yuv420pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * hue, size_t hueStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride) && Aligned(v) && Aligned(vStride) && Aligned(hue) && Aligned(hueStride))
-                Yuv420pToHue<true>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+                Yuv420pToHue<true, T>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
             else
-                Yuv420pToHue<false>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+                Yuv420pToHue<false, T>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
         }
 
-        template <bool align, bool mask> SIMD_INLINE void Yuv444pToHue(const uint8_t * y, const uint8_t * u, const uint8_t * v, const __m512 & KF_255_DIV_6, uint8_t * hue, __mmask64 tail = -1)
+        void Yuv420pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * hue, size_t hueStride)
         {
-            YuvToHue<align, mask>(Load<align, mask>(y, tail), Load<align, mask>(u, tail), Load<align, mask>(v, tail), KF_255_DIV_6, hue, tail);
+            Yuv420pToHue<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
         }
 
-        template <bool align> void Yuv444pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        void Yuv420pToHueV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * hue, size_t hueStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv420pToHue<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709: Yuv420pToHue<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020: Yuv420pToHue<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt601Full: Yuv420pToHue<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709Full: Yuv420pToHue<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020Full: Yuv420pToHue<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            default: assert(0);
+            }
+        }
+
+        template <bool align, bool mask, class T> SIMD_INLINE void Yuv444pToHue(const uint8_t * y, const uint8_t * u, const uint8_t * v, const __m512 & KF_255_DIV_6, uint8_t * hue, __mmask64 tail = -1)
+        {
+            YuvToHue<align, mask, T>(Load<align, mask>(y, tail), Load<align, mask>(u, tail), Load<align, mask>(v, tail), KF_255_DIV_6, hue, tail);
+        }
+
+        template <bool align, class T> void Yuv444pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * hue, size_t hueStride)
         {
             assert(width >= A);
@@ -148,9 +173,9 @@ namespace Simd
             {
                 size_t col = 0;
                 for (; col < alignedWidth; col += A)
-                    Yuv444pToHue<align, false>(y + col, u + col, v + col, KF_255_DIV_6, hue + col);
+                    Yuv444pToHue<align, false, T>(y + col, u + col, v + col, KF_255_DIV_6, hue + col);
                 if (col < width)
-                    Yuv444pToHue<align, true>(y + col, u + col, v + col, KF_255_DIV_6, hue + col, tailMask);
+                    Yuv444pToHue<align, true, T>(y + col, u + col, v + col, KF_255_DIV_6, hue + col, tailMask);
                 y += yStride;
                 u += uStride;
                 v += vStride;
@@ -158,13 +183,124 @@ namespace Simd
             }
         }
 
-        void Yuv444pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv444pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * hue, size_t hueStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride) && Aligned(v) && Aligned(vStride) && Aligned(hue) && Aligned(hueStride))
-                Yuv444pToHue<true>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+                Yuv444pToHue<true, T>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+            else
+                Yuv444pToHue<false, T>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+        }
+
+        void Yuv444pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride)
+        {
+            Yuv444pToHue<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+        }
+
+        void Yuv444pToHueV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv444pToHue<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709: Yuv444pToHue<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020: Yuv444pToHue<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt601Full: Yuv444pToHue<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709Full: Yuv444pToHue<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020Full: Yuv444pToHue<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            default: assert(0);
+            }
+        }
+
+        template <bool align, bool nv21, class T> void Nv12ToHue(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+            if (align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride));
+                assert(Aligned(hue) && Aligned(hueStride));
+            }
+
+            const __m512 KF_255_DIV_6 = _mm512_set1_ps(Base::KF_255_DIV_6);
+
+            width /= 2;
+            size_t alignedWidth = AlignLo(width, A);
+            size_t tail = width - alignedWidth;
+            __mmask64 tailMasks[3];
+            tailMasks[0] = TailMask64(tail);
+            for (size_t i = 0; i < 2; ++i)
+                tailMasks[1 + i] = TailMask64(tail * 2 - A * i);
+            __m512i u, v;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                size_t col = 0;
+                for (; col < alignedWidth; col += A)
+                {
+                    LoadPermutedUv<align, false, nv21>(uv + col * 2, u, v, tailMasks[1], tailMasks[2]);
+                    Yuv420pToHue<align, false, T>(y + col * 2, y + yStride + col * 2, u, v, KF_255_DIV_6, hue + col * 2, hue + hueStride + col * 2, tailMasks);
+                }
+                if (col < width)
+                {
+                    LoadPermutedUv<align, true, nv21>(uv + col * 2, u, v, tailMasks[1], tailMasks[2]);
+                    Yuv420pToHue<align, true, T>(y + col * 2, y + yStride + col * 2, u, v, KF_255_DIV_6, hue + col * 2, hue + hueStride + col * 2, tailMasks);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                hue += 2 * hueStride;
+            }
+        }
+
+        template <bool nv21, class T> void Nv12ToHue(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(hue) && Aligned(hueStride))
+                Nv12ToHue<true, nv21, T>(y, yStride, uv, uvStride, width, height, hue, hueStride);
             else
-                Yuv444pToHue<false>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+                Nv12ToHue<false, nv21, T>(y, yStride, uv, uvStride, width, height, hue, hueStride);
+        }
+
+        void Nv12ToHue(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride)
+        {
+            Nv12ToHue<false, Base::Bt601>(y, yStride, uv, uvStride, width, height, hue, hueStride);
+        }
+
+        void Nv12ToHueV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToHue<false, Base::Bt601>(y, yStride, uv, uvStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709: Nv12ToHue<false, Base::Bt709>(y, yStride, uv, uvStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020: Nv12ToHue<false, Base::Bt2020>(y, yStride, uv, uvStride, width, height, hue, hueStride); break;
+            case SimdYuvBt601Full: Nv12ToHue<false, Base::Bt601Full>(y, yStride, uv, uvStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709Full: Nv12ToHue<false, Base::Bt709Full>(y, yStride, uv, uvStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020Full: Nv12ToHue<false, Base::Bt2020Full>(y, yStride, uv, uvStride, width, height, hue, hueStride); break;
+            default: assert(0);
+            }
+        }
+
+        void Nv21ToHue(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride)
+        {
+            Nv12ToHue<true, Base::Bt601>(y, yStride, vu, vuStride, width, height, hue, hueStride);
+        }
+
+        void Nv21ToHueV2(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToHue<true, Base::Bt601>(y, yStride, vu, vuStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709: Nv12ToHue<true, Base::Bt709>(y, yStride, vu, vuStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020: Nv12ToHue<true, Base::Bt2020>(y, yStride, vu, vuStride, width, height, hue, hueStride); break;
+            case SimdYuvBt601Full: Nv12ToHue<true, Base::Bt601Full>(y, yStride, vu, vuStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709Full: Nv12ToHue<true, Base::Bt709Full>(y, yStride, vu, vuStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020Full: Nv12ToHue<true, Base::Bt2020Full>(y, yStride, vu, vuStride, width, height, hue, hueStride); break;
+            default: assert(0);
+            }
         }
     }
 #endif// SIMD_AVX512BW_ENABLE
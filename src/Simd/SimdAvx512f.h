@@ -37,6 +37,8 @@ namespace Simd
 
         void Gemm32fNT(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
 
+        void MathFunction32f(const float * src, size_t size, SimdMathFunctionType type, const float * params, SimdMathAccuracyType accuracy, float * dst);
+
         void NeuralProductSum(const float * a, const float * b, size_t size, float * sum);
 
         void NeuralAddVectorMultipliedByValue(const float * src, size_t size, const float * value, float * dst);
@@ -111,6 +113,11 @@ namespace Simd
 
         void SynetAddBias(const float * bias, size_t count, size_t size, float * dst, SimdBool trans);
 
+        void SynetDetectionDecode32f(const float * loc, const float * prior, size_t count, float * dst);
+
+        size_t SynetDetectionNms32f(const float * boxes, const float * scores, size_t count, size_t classes, ptrdiff_t background, float scoreThreshold,
+            float nmsThreshold, size_t topK, size_t keepTopK, SimdBool classAware, float * dst);
+
         void SynetEltwiseLayerForward(float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst);
 
         void SynetFusedLayerForward0(const float * src, const float * bias, const float * scale, size_t count, size_t size, float * dst, SimdBool trans);
@@ -0,0 +1,274 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdMathFunction.h"
+#include "Simd/SimdExp.h"
+#include "Simd/SimdPow.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512F_ENABLE    
+    namespace Avx512f
+    {
+        SIMD_INLINE __m512 Abs(__m512 value)
+        {
+            return AndNot(_mm512_castsi512_ps(_mm512_set1_epi32(0x80000000)), value);
+        }
+
+        SIMD_INLINE __m512 Sign(__m512 value)
+        {
+            return And(_mm512_castsi512_ps(_mm512_set1_epi32(0x80000000)), value);
+        }
+
+        class MathFast
+        {
+            Exp _exp;
+            Pow _pow;
+
+        public:
+            SIMD_INLINE MathFast()
+                : _exp(1.0f)
+            {
+            }
+
+            SIMD_INLINE __m512 Exponent(__m512 x)
+            {
+                return _exp.Exponent(x);
+            }
+
+            SIMD_INLINE __m512 Log(__m512 x)
+            {
+                return _mm512_mul_ps(_pow.Log2(x), _mm512_set1_ps(0.693147181f));
+            }
+
+            SIMD_INLINE __m512 Tanh(__m512 x)
+            {
+                x = _mm512_min_ps(_mm512_max_ps(x, _mm512_set1_ps(-9.0f)), _mm512_set1_ps(9.0f));
+                __m512 e = _exp.Exponent(_mm512_mul_ps(x, _mm512_set1_ps(-2.0f)));
+                return _mm512_div_ps(_mm512_sub_ps(_mm512_set1_ps(1.0f), e), _mm512_add_ps(_mm512_set1_ps(1.0f), e));
+            }
+
+            SIMD_INLINE __m512 Erf(__m512 x)
+            {
+                __m512 a = Abs(x);
+                __m512 t = _mm512_div_ps(_mm512_set1_ps(1.0f), _mm512_fmadd_ps(a, _mm512_set1_ps(0.3275911f), _mm512_set1_ps(1.0f)));
+                __m512 p = _mm512_fmadd_ps(t, _mm512_set1_ps(1.061405429f), _mm512_set1_ps(-1.453152027f));
+                p = _mm512_fmadd_ps(t, p, _mm512_set1_ps(1.421413741f));
+                p = _mm512_fmadd_ps(t, p, _mm512_set1_ps(-0.284496736f));
+                p = _mm512_fmadd_ps(t, p, _mm512_set1_ps(0.254829592f));
+                __m512 e = _exp.Exponent(_mm512_sub_ps(_mm512_setzero_ps(), _mm512_mul_ps(a, a)));
+                __m512 r = _mm512_sub_ps(_mm512_set1_ps(1.0f), _mm512_mul_ps(_mm512_mul_ps(p, t), e));
+                return Or(r, Sign(x));
+            }
+        };
+
+        class MathPrecise
+        {
+        public:
+            SIMD_INLINE __m512 Exponent(__m512 x)
+            {
+                x = _mm512_max_ps(_mm512_min_ps(x, _mm512_set1_ps(88.37f)), _mm512_set1_ps(-87.33654f));
+                __m512i n = _mm512_cvtps_epi32(_mm512_mul_ps(x, _mm512_set1_ps(1.44269504f)));
+                __m512 fn = _mm512_cvtepi32_ps(n);
+                x = _mm512_sub_ps(x, _mm512_mul_ps(fn, _mm512_set1_ps(0.693359375f)));
+                x = _mm512_sub_ps(x, _mm512_mul_ps(fn, _mm512_set1_ps(-2.12194440e-4f)));
+                __m512 p = _mm512_fmadd_ps(x, _mm512_set1_ps(1.9875691500e-4f), _mm512_set1_ps(1.3981999507e-3f));
+                p = _mm512_fmadd_ps(x, p, _mm512_set1_ps(8.3334519073e-3f));
+                p = _mm512_fmadd_ps(x, p, _mm512_set1_ps(4.1665795894e-2f));
+                p = _mm512_fmadd_ps(x, p, _mm512_set1_ps(1.6666665459e-1f));
+                p = _mm512_fmadd_ps(x, p, _mm512_set1_ps(5.0000001201e-1f));
+                p = _mm512_fmadd_ps(_mm512_mul_ps(x, x), p, _mm512_add_ps(x, _mm512_set1_ps(1.0f)));
+                return _mm512_mul_ps(p, _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_add_epi32(n, _mm512_set1_epi32(127)), 23)));
+            }
+
+            SIMD_INLINE __m512 Log(__m512 x)
+            {
+                __m512i i = _mm512_castps_si512(_mm512_max_ps(x, _mm512_castsi512_ps(_mm512_set1_epi32(0x00800000))));
+                __m512 e = _mm512_cvtepi32_ps(_mm512_sub_epi32(_mm512_srli_epi32(i, 23), _mm512_set1_epi32(126)));
+                __m512 m = Or(_mm512_castsi512_ps(_mm512_and_si512(i, _mm512_set1_epi32(0x007FFFFF))), _mm512_set1_ps(0.5f));
+                __mmask16 mask = _mm512_cmp_ps_mask(m, _mm512_set1_ps(0.707106781f), _CMP_LT_OS);
+                e = _mm512_mask_sub_ps(e, mask, e, _mm512_set1_ps(1.0f));
+                __m512 m1 = _mm512_sub_ps(m, _mm512_set1_ps(1.0f));
+                m = _mm512_mask_add_ps(m1, mask, m1, m);
+                __m512 z = _mm512_mul_ps(m, m);
+                __m512 p = _mm512_fmadd_ps(m, _mm512_set1_ps(7.0376836292e-2f), _mm512_set1_ps(-1.1514610310e-1f));
+                p = _mm512_fmadd_ps(m, p, _mm512_set1_ps(1.1676998740e-1f));
+                p = _mm512_fmadd_ps(m, p, _mm512_set1_ps(-1.2420140846e-1f));
+                p = _mm512_fmadd_ps(m, p, _mm512_set1_ps(1.4249322787e-1f));
+                p = _mm512_fmadd_ps(m, p, _mm512_set1_ps(-1.6668057665e-1f));
+                p = _mm512_fmadd_ps(m, p, _mm512_set1_ps(2.0000714765e-1f));
+                p = _mm512_fmadd_ps(m, p, _mm512_set1_ps(-2.4999993993e-1f));
+                p = _mm512_fmadd_ps(m, p, _mm512_set1_ps(3.3333331174e-1f));
+                p = _mm512_mul_ps(_mm512_mul_ps(p, m), z);
+                p = _mm512_fmadd_ps(e, _mm512_set1_ps(-2.12194440e-4f), p);
+                p = _mm512_fmadd_ps(z, _mm512_set1_ps(-0.5f), p);
+                return _mm512_fmadd_ps(e, _mm512_set1_ps(0.693359375f), _mm512_add_ps(m, p));
+            }
+
+            SIMD_INLINE __m512 Tanh(__m512 x)
+            {
+                __m512 a = Abs(x);
+                __m512 e = Exponent(_mm512_min_ps(_mm512_add_ps(a, a), _mm512_set1_ps(18.0f)));
+                __m512 large = _mm512_sub_ps(_mm512_set1_ps(1.0f), _mm512_div_ps(_mm512_set1_ps(2.0f), _mm512_add_ps(e, _mm512_set1_ps(1.0f))));
+                __m512 z = _mm512_mul_ps(a, a);
+                __m512 p = _mm512_fmadd_ps(z, _mm512_set1_ps(-5.70498872745e-3f), _mm512_set1_ps(2.06390887954e-2f));
+                p = _mm512_fmadd_ps(z, p, _mm512_set1_ps(-5.37397155531e-2f));
+                p = _mm512_fmadd_ps(z, p, _mm512_set1_ps(1.33314422036e-1f));
+                p = _mm512_fmadd_ps(z, p, _mm512_set1_ps(-3.33332819422e-1f));
+                __m512 small = _mm512_fmadd_ps(_mm512_mul_ps(p, z), a, a);
+                return Or(_mm512_mask_blend_ps(_mm512_cmp_ps_mask(a, _mm512_set1_ps(0.625f), _CMP_GT_OS), small, large), Sign(x));
+            }
+
+            SIMD_INLINE __m512 Erf(__m512 x)
+            {
+                __m512 a = Abs(x);
+                __m512 t = _mm512_div_ps(_mm512_set1_ps(1.0f), _mm512_fmadd_ps(a, _mm512_set1_ps(0.3275911f), _mm512_set1_ps(1.0f)));
+                __m512 p = _mm512_fmadd_ps(t, _mm512_set1_ps(1.061405429f), _mm512_set1_ps(-1.453152027f));
+                p = _mm512_fmadd_ps(t, p, _mm512_set1_ps(1.421413741f));
+                p = _mm512_fmadd_ps(t, p, _mm512_set1_ps(-0.284496736f));
+                p = _mm512_fmadd_ps(t, p, _mm512_set1_ps(0.254829592f));
+                __m512 z = _mm512_mul_ps(a, a);
+                __m512 large = _mm512_sub_ps(_mm512_set1_ps(1.0f), _mm512_mul_ps(_mm512_mul_ps(p, t), Exponent(_mm512_sub_ps(_mm512_setzero_ps(), z))));
+                __m512 s = _mm512_fmadd_ps(z, _mm512_set1_ps(-8.548327e-4f), _mm512_set1_ps(5.223977e-3f));
+                s = _mm512_fmadd_ps(z, s, _mm512_set1_ps(-2.686617e-2f));
+                s = _mm512_fmadd_ps(z, s, _mm512_set1_ps(1.128379e-1f));
+                s = _mm512_fmadd_ps(z, s, _mm512_set1_ps(-3.761264e-1f));
+                s = _mm512_fmadd_ps(z, s, _mm512_set1_ps(1.128379167f));
+                __m512 small = _mm512_mul_ps(s, a);
+                return Or(_mm512_mask_blend_ps(_mm512_cmp_ps_mask(a, _mm512_set1_ps(0.5f), _CMP_LT_OS), large, small), Sign(x));
+            }
+        };
+
+        template<SimdMathFunctionType type> struct MathFunction;
+
+        template<> struct MathFunction<SimdMathFunctionExp>
+        {
+            template<class M> static SIMD_INLINE __m512 Run(M & m, __m512 x, __m512 param)
+            {
+                return m.Exponent(x);
+            }
+        };
+
+        template<> struct MathFunction<SimdMathFunctionLog>
+        {
+            template<class M> static SIMD_INLINE __m512 Run(M & m, __m512 x, __m512 param)
+            {
+                return m.Log(x);
+            }
+        };
+
+        template<> struct MathFunction<SimdMathFunctionPow>
+        {
+            template<class M> static SIMD_INLINE __m512 Run(M & m, __m512 x, __m512 param)
+            {
+                return m.Exponent(_mm512_mul_ps(m.Log(x), param));
+            }
+        };
+
+        template<> struct MathFunction<SimdMathFunctionSigmoid>
+        {
+            template<class M> static SIMD_INLINE __m512 Run(M & m, __m512 x, __m512 param)
+            {
+                return _mm512_div_ps(_mm512_set1_ps(1.0f), _mm512_add_ps(_mm512_set1_ps(1.0f), m.Exponent(_mm512_sub_ps(_mm512_setzero_ps(), x))));
+            }
+        };
+
+        template<> struct MathFunction<SimdMathFunctionTanh>
+        {
+            template<class M> static SIMD_INLINE __m512 Run(M & m, __m512 x, __m512 param)
+            {
+                return m.Tanh(x);
+            }
+        };
+
+        template<> struct MathFunction<SimdMathFunctionGelu>
+        {
+            template<class M> static SIMD_INLINE __m512 Run(M & m, __m512 x, __m512 param)
+            {
+                __m512 erf = m.Erf(_mm512_mul_ps(x, _mm512_set1_ps(0.707106781f)));
+                return _mm512_mul_ps(_mm512_mul_ps(x, _mm512_set1_ps(0.5f)), _mm512_add_ps(_mm512_set1_ps(1.0f), erf));
+            }
+        };
+
+        template<> struct MathFunction<SimdMathFunctionErf>
+        {
+            template<class M> static SIMD_INLINE __m512 Run(M & m, __m512 x, __m512 param)
+            {
+                return m.Erf(x);
+            }
+        };
+
+        template<> struct MathFunction<SimdMathFunctionSwish>
+        {
+            template<class M> static SIMD_INLINE __m512 Run(M & m, __m512 x, __m512 param)
+            {
+                return _mm512_div_ps(x, _mm512_add_ps(_mm512_set1_ps(1.0f), m.Exponent(_mm512_sub_ps(_mm512_setzero_ps(), _mm512_mul_ps(param, x)))));
+            }
+        };
+
+        template<SimdMathFunctionType type, class M> void MathFunction32f(const float * src, size_t size, const float * params, float * dst)
+        {
+            M m;
+            __m512 param = _mm512_set1_ps(params ? params[0] : 0.0f);
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+                _mm512_storeu_ps(dst + i, MathFunction<type>::Run(m, _mm512_loadu_ps(src + i), param));
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                __m512 value = _mm512_mask_loadu_ps(_mm512_set1_ps(1.0f), tail, src + i);
+                _mm512_mask_storeu_ps(dst + i, tail, MathFunction<type>::Run(m, value, param));
+            }
+        }
+
+        template<class M> void MathFunction32f(const float * src, size_t size, SimdMathFunctionType type, const float * params, float * dst)
+        {
+            switch (type)
+            {
+            case SimdMathFunctionExp: MathFunction32f<SimdMathFunctionExp, M>(src, size, params, dst); break;
+            case SimdMathFunctionLog: MathFunction32f<SimdMathFunctionLog, M>(src, size, params, dst); break;
+            case SimdMathFunctionPow: MathFunction32f<SimdMathFunctionPow, M>(src, size, params, dst); break;
+            case SimdMathFunctionSigmoid: MathFunction32f<SimdMathFunctionSigmoid, M>(src, size, params, dst); break;
+            case SimdMathFunctionTanh: MathFunction32f<SimdMathFunctionTanh, M>(src, size, params, dst); break;
+            case SimdMathFunctionGelu: MathFunction32f<SimdMathFunctionGelu, M>(src, size, params, dst); break;
+            case SimdMathFunctionErf: MathFunction32f<SimdMathFunctionErf, M>(src, size, params, dst); break;
+            case SimdMathFunctionSwish: MathFunction32f<SimdMathFunctionSwish, M>(src, size, params, dst); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void MathFunction32f(const float * src, size_t size, SimdMathFunctionType type, const float * params, SimdMathAccuracyType accuracy, float * dst)
+        {
+            Base::MathFunction32fParallel(src, size, dst, [=](const float * src, size_t size, float * dst)
+            {
+                if (accuracy == SimdMathAccuracyFast)
+                    MathFunction32f<MathFast>(src, size, type, params, dst);
+                else
+                    MathFunction32f<MathPrecise>(src, size, type, params, dst);
+            });
+        }
+    }
+#endif// SIMD_AVX512F_ENABLE
+}
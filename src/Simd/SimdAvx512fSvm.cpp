@@ -24,6 +24,8 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
 #include "Simd/SimdExtract.h"
+#include "Simd/SimdSvm.h"
+#include "Simd/SimdAvx512f.h"
 
 namespace Simd
 {
@@ -79,6 +81,21 @@ namespace Simd
                 _sum = _mm512_fmadd_ps((Load<true, true>(buffer.sums + i, tailMask)), (Load<false, true>(weights + i, tailMask)), _sum);
             *sum = ExtractSum(_sum);
         }
+
+        Svm::Svm(const float * svs, const float * weights, size_t length, size_t count, const float * bias, SimdSvmKernelType kernel, const float * params)
+            : Base::Svm(svs, weights, length, count, bias, kernel, params)
+        {
+            _gemm = Gemm32fNN;
+            _productSum = NeuralProductSum;
+            _mathFunction = MathFunction32f;
+        }
+
+        void * SvmInit(const float * svs, const float * weights, size_t length, size_t count, const float * bias, SimdSvmKernelType kernel, const float * params)
+        {
+            if (!Base::SvmValid(svs, weights, length, count, kernel, params))
+                return NULL;
+            return new Svm(svs, weights, length, count, bias, kernel, params);
+        }
     }
 #endif// SIMD_AVX512F_ENABLE
 }
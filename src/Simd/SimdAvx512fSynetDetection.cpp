@@ -0,0 +1,97 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdExp.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512F_ENABLE    
+    namespace Avx512f
+    {
+        SIMD_INLINE __m512 SynetDetectionDecode32f(const __m512 & loc, const __m512 & prior, const __m512 & variance, const __m512 & sign, Exp & exp)
+        {
+            __m512 lo = _mm512_shuffle_ps(prior, prior, 0x44);
+            __m512 hi = _mm512_shuffle_ps(prior, prior, 0xEE);
+            __m512 size = _mm512_sub_ps(hi, lo);
+            __m512 center = _mm512_mul_ps(_mm512_add_ps(lo, hi), _mm512_set1_ps(0.5f));
+            __m512 delta = _mm512_mul_ps(variance, loc);
+            center = _mm512_fmadd_ps(_mm512_shuffle_ps(delta, delta, 0x44), size, center);
+            size = _mm512_mul_ps(exp.Exponent(_mm512_shuffle_ps(delta, delta, 0xEE)), size);
+            return _mm512_fmadd_ps(size, sign, center);
+        }
+
+        void SynetDetectionDecode32f(const float * loc, const float * prior, size_t count, float * dst)
+        {
+            const float * variance = prior + count * 4;
+            __m512 sign = _mm512_setr_ps(-0.5f, -0.5f, 0.5f, 0.5f, -0.5f, -0.5f, 0.5f, 0.5f, -0.5f, -0.5f, 0.5f, 0.5f, -0.5f, -0.5f, 0.5f, 0.5f);
+            Exp exp;
+            size_t size = count * 4, sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+                _mm512_storeu_ps(dst + i, SynetDetectionDecode32f(_mm512_loadu_ps(loc + i), _mm512_loadu_ps(prior + i), _mm512_loadu_ps(variance + i), sign, exp));
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                __m512 _loc = _mm512_maskz_loadu_ps(tail, loc + i);
+                __m512 _prior = _mm512_maskz_loadu_ps(tail, prior + i);
+                __m512 _variance = _mm512_maskz_loadu_ps(tail, variance + i);
+                _mm512_mask_storeu_ps(dst + i, tail, SynetDetectionDecode32f(_loc, _prior, _variance, sign, exp));
+            }
+        }
+
+        SIMD_INLINE void SynetDetectionSuppress(const float * xMin, const float * yMin, const float * xMax, const float * yMax, const float * area, const __m512 & _xMin, 
+            const __m512 & _yMin, const __m512 & _xMax, const __m512 & _yMax, const __m512 & _area, const __m512 & threshold, uint32_t * suppressed, __mmask16 tail = -1)
+        {
+            __m512 w = _mm512_max_ps(_mm512_sub_ps(_mm512_min_ps(_xMax, _mm512_maskz_loadu_ps(tail, xMax)), _mm512_max_ps(_xMin, _mm512_maskz_loadu_ps(tail, xMin))), _mm512_setzero_ps());
+            __m512 h = _mm512_max_ps(_mm512_sub_ps(_mm512_min_ps(_yMax, _mm512_maskz_loadu_ps(tail, yMax)), _mm512_max_ps(_yMin, _mm512_maskz_loadu_ps(tail, yMin))), _mm512_setzero_ps());
+            __m512 intersection = _mm512_mul_ps(w, h);
+            __m512 junction = _mm512_sub_ps(_mm512_add_ps(_area, _mm512_maskz_loadu_ps(tail, area)), intersection);
+            __mmask16 mask = _mm512_mask_cmp_ps_mask(tail, intersection, _mm512_mul_ps(threshold, junction), _CMP_GT_OQ);
+            _mm512_mask_storeu_epi32(suppressed, mask, _mm512_set1_epi32(-1));
+        }
+
+        void SynetDetectionSuppress(const float * boxes, size_t current, size_t end, float threshold, uint32_t * suppressed)
+        {
+            const float * xMin = boxes, *yMin = xMin + end, *xMax = yMin + end, *yMax = xMax + end, *area = yMax + end;
+            __m512 _xMin = _mm512_set1_ps(xMin[current]);
+            __m512 _yMin = _mm512_set1_ps(yMin[current]);
+            __m512 _xMax = _mm512_set1_ps(xMax[current]);
+            __m512 _yMax = _mm512_set1_ps(yMax[current]);
+            __m512 _area = _mm512_set1_ps(area[current]);
+            __m512 _threshold = _mm512_set1_ps(threshold);
+            size_t i = current + 1, endF = i + AlignLo(end - i, F);
+            for (; i < endF; i += F)
+                SynetDetectionSuppress(xMin + i, yMin + i, xMax + i, yMax + i, area + i, _xMin, _yMin, _xMax, _yMax, _area, _threshold, suppressed + i);
+            if (i < end)
+                SynetDetectionSuppress(xMin + i, yMin + i, xMax + i, yMax + i, area + i, _xMin, _yMin, _xMax, _yMax, _area, _threshold, suppressed + i, TailMask16(end - i));
+        }
+
+        size_t SynetDetectionNms32f(const float * boxes, const float * scores, size_t count, size_t classes, ptrdiff_t background, float scoreThreshold,
+            float nmsThreshold, size_t topK, size_t keepTopK, SimdBool classAware, float * dst)
+        {
+            return Base::SynetDetectionNms32f(boxes, scores, count, classes, background, scoreThreshold, nmsThreshold, topK, keepTopK, classAware, dst, SynetDetectionSuppress);
+        }
+    }
+#endif// SIMD_AVX512F_ENABLE
+}
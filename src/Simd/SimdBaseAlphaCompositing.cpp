@@ -0,0 +1,198 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMath.h"
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE void AlphaPremultiply(const uint8_t * src, uint8_t * dst)
+        {
+            int alpha = src[3];
+            dst[0] = DivideBy255(src[0] * alpha);
+            dst[1] = DivideBy255(src[1] * alpha);
+            dst[2] = DivideBy255(src[2] * alpha);
+            dst[3] = alpha;
+        }
+
+        void AlphaPremultiply(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0, offset = 0; col < width; ++col, offset += 4)
+                    AlphaPremultiply(src + offset, dst + offset);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        SIMD_INLINE void AlphaUnpremultiply(const uint8_t * src, uint8_t * dst)
+        {
+            int alpha = src[3];
+            if (alpha)
+            {
+                int half = alpha >> 1;
+                dst[0] = Min((src[0] * 255 + half) / alpha, 255);
+                dst[1] = Min((src[1] * 255 + half) / alpha, 255);
+                dst[2] = Min((src[2] * 255 + half) / alpha, 255);
+            }
+            else
+                dst[0] = dst[1] = dst[2] = 0;
+            dst[3] = alpha;
+        }
+
+        void AlphaUnpremultiply(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0, offset = 0; col < width; ++col, offset += 4)
+                    AlphaUnpremultiply(src + offset, dst + offset);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void AlphaBlendingBgraToBgra(const uint8_t * src, int alpha, uint8_t * dst)
+        {
+            int srcAlpha = DivideBy255(src[3] * alpha);
+            int dstAlpha = DivideBy255(dst[3] * (255 - srcAlpha));
+            int sumAlpha = srcAlpha + dstAlpha;
+            if (sumAlpha)
+            {
+                int half = sumAlpha >> 1;
+                dst[0] = (src[0] * srcAlpha + dst[0] * dstAlpha + half) / sumAlpha;
+                dst[1] = (src[1] * srcAlpha + dst[1] * dstAlpha + half) / sumAlpha;
+                dst[2] = (src[2] * srcAlpha + dst[2] * dstAlpha + half) / sumAlpha;
+            }
+            else
+                dst[0] = dst[1] = dst[2] = 0;
+            dst[3] = sumAlpha;
+        }
+
+        SIMD_INLINE void AlphaBlendingPremultipliedBgraToBgra(const uint8_t * src, int alpha, uint8_t * dst)
+        {
+            int srcAlpha = DivideBy255(src[3] * alpha);
+            int dstAlpha = 255 - srcAlpha;
+            dst[0] = Min(DivideBy255(src[0] * alpha) + DivideBy255(dst[0] * dstAlpha), 255);
+            dst[1] = Min(DivideBy255(src[1] * alpha) + DivideBy255(dst[1] * dstAlpha), 255);
+            dst[2] = Min(DivideBy255(src[2] * alpha) + DivideBy255(dst[2] * dstAlpha), 255);
+            dst[3] = srcAlpha + DivideBy255(dst[3] * dstAlpha);
+        }
+
+        template<bool premultiplied> void AlphaBlendingBgraToBgra(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t alpha, uint8_t * dst, size_t dstStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0, offset = 0; col < width; ++col, offset += 4)
+                {
+                    if (premultiplied)
+                        AlphaBlendingPremultipliedBgraToBgra(src + offset, alpha, dst + offset);
+                    else
+                        AlphaBlendingBgraToBgra(src + offset, alpha, dst + offset);
+                }
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        void AlphaBlendingBgraToBgra(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t alpha, SimdBool premultiplied, uint8_t * dst, size_t dstStride)
+        {
+            if (premultiplied)
+                AlphaBlendingBgraToBgra<true>(src, srcStride, width, height, alpha, dst, dstStride);
+            else
+                AlphaBlendingBgraToBgra<false>(src, srcStride, width, height, alpha, dst, dstStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        template <class T> SIMD_INLINE void AlphaBlendingBgraToYuv(const uint8_t * bgra, int alpha, uint8_t * y, int & a, int & u, int & v)
+        {
+            int srcAlpha = DivideBy255(bgra[3] * alpha);
+            y[0] = DivideBy255(BgrToY<T>(bgra[0], bgra[1], bgra[2]) * srcAlpha + y[0] * (255 - srcAlpha));
+            a += srcAlpha;
+            u += DivideBy255(BgrToU<T>(bgra[0], bgra[1], bgra[2]) * srcAlpha);
+            v += DivideBy255(BgrToV<T>(bgra[0], bgra[1], bgra[2]) * srcAlpha);
+        }
+
+        template <class T> SIMD_INLINE void AlphaBlendingBgraToYuv420(const uint8_t * bgra0, size_t bgraStride, int alpha, uint8_t * y0, size_t yStride, uint8_t * u, uint8_t * v)
+        {
+            const uint8_t * bgra1 = bgra0 + bgraStride;
+            uint8_t * y1 = y0 + yStride;
+            int a = 0, _u = 0, _v = 0;
+            AlphaBlendingBgraToYuv<T>(bgra0 + 0, alpha, y0 + 0, a, _u, _v);
+            AlphaBlendingBgraToYuv<T>(bgra0 + 4, alpha, y0 + 1, a, _u, _v);
+            AlphaBlendingBgraToYuv<T>(bgra1 + 0, alpha, y1 + 0, a, _u, _v);
+            AlphaBlendingBgraToYuv<T>(bgra1 + 4, alpha, y1 + 1, a, _u, _v);
+            a = 255 - ((a + 2) >> 2);
+            u[0] = ((_u + 2) >> 2) + DivideBy255(u[0] * a);
+            v[0] = ((_v + 2) >> 2) + DivideBy255(v[0] * a);
+        }
+
+        template <class T> void AlphaBlendingBgraToYuv420(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t alpha,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, size_t uvStep)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0, colUV = 0; colY < width; colY += 2, colUV += uvStep)
+                    AlphaBlendingBgraToYuv420<T>(bgra + colY * 4, bgraStride, alpha, y + colY, yStride, u + colUV, v + colUV);
+                bgra += 2 * bgraStride;
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+            }
+        }
+
+        void AlphaBlendingBgraToYuv420(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t alpha,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, size_t uvStep, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: AlphaBlendingBgraToYuv420<Bt601>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride, uvStep); break;
+            case SimdYuvBt709: AlphaBlendingBgraToYuv420<Bt709>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride, uvStep); break;
+            case SimdYuvBt2020: AlphaBlendingBgraToYuv420<Bt2020>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride, uvStep); break;
+            case SimdYuvBt601Full: AlphaBlendingBgraToYuv420<Bt601Full>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride, uvStep); break;
+            case SimdYuvBt709Full: AlphaBlendingBgraToYuv420<Bt709Full>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride, uvStep); break;
+            case SimdYuvBt2020Full: AlphaBlendingBgraToYuv420<Bt2020Full>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride, uvStep); break;
+            default: assert(0);
+            }
+        }
+
+        void AlphaBlendingBgraToYuv420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t alpha,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            AlphaBlendingBgraToYuv420(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride, 1, yuvType);
+        }
+
+        void AlphaBlendingBgraToNv12(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t alpha,
+            uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            AlphaBlendingBgraToYuv420(bgra, bgraStride, width, height, alpha, y, yStride, uv, uvStride, uv + 1, uvStride, 2, yuvType);
+        }
+    }
+}
@@ -216,5 +216,144 @@ namespace Simd
                 dst += dstStride;
             }
         }
+
+        SIMD_INLINE void BackgroundUpdate(const uint8_t & value, uint8_t & loValue, uint8_t & hiValue, uint8_t & loCount, uint8_t & hiCount,
+            uint8_t threshold, bool grow, bool increment, bool adjust)
+        {
+            if (grow)
+            {
+                if (value < loValue)
+                    loValue = value;
+                if (value > hiValue)
+                    hiValue = value;
+            }
+            if (increment)
+            {
+                if (value < loValue && loCount < 0xFF)
+                    loCount++;
+                if (value > hiValue && hiCount < 0xFF)
+                    hiCount++;
+            }
+            if (adjust)
+            {
+                AdjustLo(loCount, loValue, threshold);
+                AdjustHi(hiCount, hiValue, threshold);
+                loCount = 0;
+                hiCount = 0;
+            }
+        }
+
+        void BackgroundUpdate(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * loValue, size_t loValueStride, uint8_t * hiValue, size_t hiValueStride,
+            uint8_t * loCount, size_t loCountStride, uint8_t * hiCount, size_t hiCountStride, uint8_t threshold, int flags)
+        {
+            bool grow = (flags & SimdBackgroundUpdateGrowRange) != 0;
+            bool increment = (flags & SimdBackgroundUpdateIncrementCount) != 0;
+            bool adjust = (flags & SimdBackgroundUpdateAdjustRange) != 0;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < width; ++col)
+                    BackgroundUpdate(value[col], loValue[col], hiValue[col], loCount[col], hiCount[col], threshold, grow, increment, adjust);
+                value += valueStride;
+                loValue += loValueStride;
+                hiValue += hiValueStride;
+                loCount += loCountStride;
+                hiCount += hiCountStride;
+            }
+        }
+
+        void BackgroundPackedInit(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0, offset = 0; col < width; ++col, offset += 4)
+                {
+                    model[offset + 0] = value[col];
+                    model[offset + 1] = value[col];
+                    model[offset + 2] = 0;
+                    model[offset + 3] = 0;
+                }
+                value += valueStride;
+                model += modelStride;
+            }
+        }
+
+        void BackgroundPackedUpdate(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * model, size_t modelStride, uint8_t threshold, int flags)
+        {
+            bool grow = (flags & SimdBackgroundUpdateGrowRange) != 0;
+            bool increment = (flags & SimdBackgroundUpdateIncrementCount) != 0;
+            bool adjust = (flags & SimdBackgroundUpdateAdjustRange) != 0;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0, offset = 0; col < width; ++col, offset += 4)
+                    BackgroundUpdate(value[col], model[offset + 0], model[offset + 1], model[offset + 2], model[offset + 3], threshold, grow, increment, adjust);
+                value += valueStride;
+                model += modelStride;
+            }
+        }
+
+        void BackgroundPackedGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0, offset = 0; col < width; ++col, offset += 4)
+                {
+                    if (value[col] < model[offset + 0])
+                        model[offset + 0]--;
+                    if (value[col] > model[offset + 1])
+                        model[offset + 1]++;
+                }
+                value += valueStride;
+                model += modelStride;
+            }
+        }
+
+        void BackgroundPackedAdjustRangeMasked(uint8_t * model, size_t modelStride, size_t width, size_t height,
+            uint8_t threshold, const uint8_t * mask, size_t maskStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0, offset = 0; col < width; ++col, offset += 4)
+                {
+                    if (mask[col])
+                    {
+                        AdjustLo(model[offset + 2], model[offset + 0], threshold);
+                        AdjustHi(model[offset + 3], model[offset + 1], threshold);
+                    }
+                    model[offset + 2] = 0;
+                    model[offset + 3] = 0;
+                }
+                model += modelStride;
+                mask += maskStride;
+            }
+        }
+
+        void BackgroundPackedShiftRange(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0, offset = 0; col < width; ++col, offset += 4)
+                    BackgroundShiftRange(value[col], model[offset + 0], model[offset + 1]);
+                value += valueStride;
+                model += modelStride;
+            }
+        }
+
+        void BackgroundPackedShiftRangeMasked(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * model, size_t modelStride, const uint8_t * mask, size_t maskStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0, offset = 0; col < width; ++col, offset += 4)
+                {
+                    if (mask[col])
+                        BackgroundShiftRange(value[col], model[offset + 0], model[offset + 1]);
+                }
+                value += valueStride;
+                model += modelStride;
+                mask += maskStride;
+            }
+        }
     }
 }
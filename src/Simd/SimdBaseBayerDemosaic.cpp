@@ -0,0 +1,95 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdBayer.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        template<size_t channels> void BayerMhc(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+
+            const uint8_t * src[5];
+            size_t greenOdd;
+            bool red;
+            for (size_t row = 0; row < height; ++row)
+            {
+                BayerMhcRows(bayer, height, bayerStride, row, src);
+                BayerMhcRowInfo(bayerFormat, row, greenOdd, red);
+                BayerMhc<channels>(src, 0, width, width, greenOdd, red, dst, alpha);
+                dst += dstStride;
+            }
+        }
+
+        void BayerToBgrMhc(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride)
+        {
+            BayerMhc<3>(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride, 0);
+        }
+
+        void BayerToBgraMhc(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            BayerMhc<4>(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
+        }
+
+        void BayerToGray(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * gray, size_t grayStride)
+        {
+            BayerMhc<1>(bayer, width, height, bayerStride, bayerFormat, gray, grayStride, 0);
+        }
+
+        template <SimdPixelFormatType bayerFormat> void BayerToBgrHalf(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, uint8_t * bgr, size_t bgrStride)
+        {
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0, offset = 0; col < width; col += 2, offset += 3)
+                    BayerToBgrHalf<bayerFormat>(bayer + col, bayer + bayerStride + col, bgr + offset);
+                bayer += 2 * bayerStride;
+                bgr += bgrStride;
+            }
+        }
+
+        void BayerToBgrHalf(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+
+            switch (bayerFormat)
+            {
+            case SimdPixelFormatBayerGrbg:
+                BayerToBgrHalf<SimdPixelFormatBayerGrbg>(bayer, width, height, bayerStride, bgr, bgrStride);
+                break;
+            case SimdPixelFormatBayerGbrg:
+                BayerToBgrHalf<SimdPixelFormatBayerGbrg>(bayer, width, height, bayerStride, bgr, bgrStride);
+                break;
+            case SimdPixelFormatBayerRggb:
+                BayerToBgrHalf<SimdPixelFormatBayerRggb>(bayer, width, height, bayerStride, bgr, bgrStride);
+                break;
+            case SimdPixelFormatBayerBggr:
+                BayerToBgrHalf<SimdPixelFormatBayerBggr>(bayer, width, height, bayerStride, bgr, bgrStride);
+                break;
+            default:
+                assert(0);
+            }
+        }
+    }
+}
@@ -74,6 +74,22 @@ namespace Simd
             BgrToBgra(bgr, width, bgra, true, true, alpha);
         }
 
+        void BgrToRgba(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * rgba, size_t rgbaStride, uint8_t alpha)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0, offset3 = 0, offset4 = 0; col < width; ++col, offset3 += 3, offset4 += 4)
+                {
+                    rgba[offset4 + 0] = bgr[offset3 + 2];
+                    rgba[offset4 + 1] = bgr[offset3 + 1];
+                    rgba[offset4 + 2] = bgr[offset3 + 0];
+                    rgba[offset4 + 3] = alpha;
+                }
+                bgr += bgrStride;
+                rgba += rgbaStride;
+            }
+        }
+
         void Bgr48pToBgra32(const uint8_t * blue, size_t blueStride, size_t width, size_t height,
             const uint8_t * green, size_t greenStride, const uint8_t * red, size_t redStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
         {
@@ -39,5 +39,24 @@ namespace Simd
                 }
             }
         }
+
+        void BgrToHsvInRange(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, const uint8_t * lower, const uint8_t * upper, uint8_t * mask, size_t maskStride)
+        {
+            bool wrap = lower[0] > upper[0];
+            uint8_t hsv[3];
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0, offset = 0; col < width; ++col, offset += 3)
+                {
+                    BgrToHsv(bgr[offset + 0], bgr[offset + 1], bgr[offset + 2], hsv);
+                    bool hue = wrap ? (hsv[0] >= lower[0] || hsv[0] <= upper[0]) : (hsv[0] >= lower[0] && hsv[0] <= upper[0]);
+                    bool saturation = hsv[1] >= lower[1] && hsv[1] <= upper[1];
+                    bool value = hsv[2] >= lower[2] && hsv[2] <= upper[2];
+                    mask[col] = hue && saturation && value ? 0xFF : 0;
+                }
+                bgr += bgrStride;
+                mask += maskStride;
+            }
+        }
     }
 }
@@ -51,5 +51,20 @@ namespace Simd
             }
             BgraToBgr(bgra, width, bgr, true);
         }
+
+        void BgraToRgb(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * rgb, size_t rgbStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0, offset3 = 0, offset4 = 0; col < width; ++col, offset3 += 3, offset4 += 4)
+                {
+                    rgb[offset3 + 0] = bgra[offset4 + 2];
+                    rgb[offset3 + 1] = bgra[offset4 + 1];
+                    rgb[offset3 + 2] = bgra[offset4 + 0];
+                }
+                bgra += bgraStride;
+                rgb += rgbStride;
+            }
+        }
     }
 }
@@ -39,5 +39,18 @@ namespace Simd
                 }
             }
         }
+
+        void RgbaToGray(const uint8_t * rgba, size_t width, size_t height, size_t rgbaStride, uint8_t * gray, size_t grayStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint8_t * pRgba = rgba + row*rgbaStride;
+                uint8_t * pGray = gray + row*grayStride;
+                for (const uint8_t *pGrayEnd = pGray + width; pGray < pGrayEnd; pGray += 1, pRgba += 4)
+                {
+                    *pGray = BgrToGray(pRgba[2], pRgba[1], pRgba[0]);
+                }
+            }
+        }
     }
 }
@@ -28,25 +28,25 @@ namespace Simd
 {
     namespace Base
     {
-        SIMD_INLINE void BgraToYuv420p(const uint8_t * bgra0, size_t bgraStride, uint8_t * y0, size_t yStride, uint8_t * u, uint8_t * v)
+        template <class T = Bt601> SIMD_INLINE void BgraToYuv420p(const uint8_t * bgra0, size_t bgraStride, uint8_t * y0, size_t yStride, uint8_t * u, uint8_t * v)
         {
             const uint8_t * bgra1 = bgra0 + bgraStride;
             uint8_t * y1 = y0 + yStride;
 
-            y0[0] = BgrToY(bgra0[0], bgra0[1], bgra0[2]);
-            y0[1] = BgrToY(bgra0[4], bgra0[5], bgra0[6]);
-            y1[0] = BgrToY(bgra1[0], bgra1[1], bgra1[2]);
-            y1[1] = BgrToY(bgra1[4], bgra1[5], bgra1[6]);
+            y0[0] = BgrToY<T>(bgra0[0], bgra0[1], bgra0[2]);
+            y0[1] = BgrToY<T>(bgra0[4], bgra0[5], bgra0[6]);
+            y1[0] = BgrToY<T>(bgra1[0], bgra1[1], bgra1[2]);
+            y1[1] = BgrToY<T>(bgra1[4], bgra1[5], bgra1[6]);
 
             int blue = Average(bgra0[0], bgra0[4], bgra1[0], bgra1[4]);
             int green = Average(bgra0[1], bgra0[5], bgra1[1], bgra1[5]);
             int red = Average(bgra0[2], bgra0[6], bgra1[2], bgra1[6]);
 
-            u[0] = BgrToU(blue, green, red);
-            v[0] = BgrToV(blue, green, red);
+            u[0] = BgrToU<T>(blue, green, red);
+            v[0] = BgrToV<T>(blue, green, red);
         }
 
-        void BgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+        template <class T> void BgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
@@ -54,7 +54,7 @@ namespace Simd
             for (size_t row = 0; row < height; row += 2)
             {
                 for (size_t colUV = 0, colY = 0, colBgra = 0; colY < width; colY += 2, colUV++, colBgra += 8)
-                    BgraToYuv420p(bgra + colBgra, bgraStride, y + colY, yStride, u + colUV, v + colUV);
+                    BgraToYuv420p<T>(bgra + colBgra, bgraStride, y + colY, yStride, u + colUV, v + colUV);
                 y += 2 * yStride;
                 u += uStride;
                 v += vStride;
@@ -62,20 +62,47 @@ namespace Simd
             }
         }
 
-        SIMD_INLINE void BgraToYuv422p(const uint8_t * bgra, uint8_t * y, uint8_t * u, uint8_t * v)
+        void BgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgraToYuv420p<Bt601>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgraToYuv420p<Bt601>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgraToYuv420p<Bt709>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgraToYuv420p<Bt2020>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: BgraToYuv420p<Bt601Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: BgraToYuv420p<Bt709Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: BgraToYuv420p<Bt2020Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            default: assert(0);
+            }
+        }
+
+        void RgbaToYuv420p(const uint8_t * rgba, size_t width, size_t height, size_t rgbaStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgraToYuv420p<Rgb<Bt601>>(rgba, width, height, rgbaStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        template <class T = Bt601> SIMD_INLINE void BgraToYuv422p(const uint8_t * bgra, uint8_t * y, uint8_t * u, uint8_t * v)
         {
-            y[0] = BgrToY(bgra[0], bgra[1], bgra[2]);
-            y[1] = BgrToY(bgra[4], bgra[5], bgra[6]);
+            y[0] = BgrToY<T>(bgra[0], bgra[1], bgra[2]);
+            y[1] = BgrToY<T>(bgra[4], bgra[5], bgra[6]);
 
             int blue = Average(bgra[0], bgra[4]);
             int green = Average(bgra[1], bgra[5]);
             int red = Average(bgra[2], bgra[6]);
 
-            u[0] = BgrToU(blue, green, red);
-            v[0] = BgrToV(blue, green, red);
+            u[0] = BgrToU<T>(blue, green, red);
+            v[0] = BgrToV<T>(blue, green, red);
         }
 
-        void BgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+        template <class T> void BgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             assert((width % 2 == 0) && (width >= 2));
@@ -83,7 +110,7 @@ namespace Simd
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t colUV = 0, colY = 0, colBgra = 0; colY < width; colY += 2, colUV++, colBgra += 8)
-                    BgraToYuv422p(bgra + colBgra, y + colY, u + colUV, v + colUV);
+                    BgraToYuv422p<T>(bgra + colBgra, y + colY, u + colUV, v + colUV);
                 y += yStride;
                 u += uStride;
                 v += vStride;
@@ -91,21 +118,48 @@ namespace Simd
             }
         }
 
-        SIMD_INLINE void BgraToYuv444p(const uint8_t * bgra, uint8_t * y, uint8_t * u, uint8_t * v)
+        void BgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgraToYuv422p<Bt601>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgraToYuv422pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgraToYuv422p<Bt601>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgraToYuv422p<Bt709>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgraToYuv422p<Bt2020>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: BgraToYuv422p<Bt601Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: BgraToYuv422p<Bt709Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: BgraToYuv422p<Bt2020Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            default: assert(0);
+            }
+        }
+
+        void RgbaToYuv422p(const uint8_t * rgba, size_t width, size_t height, size_t rgbaStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgraToYuv422p<Rgb<Bt601>>(rgba, width, height, rgbaStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        template <class T = Bt601> SIMD_INLINE void BgraToYuv444p(const uint8_t * bgra, uint8_t * y, uint8_t * u, uint8_t * v)
         {
             const int blue = bgra[0], green = bgra[1], red = bgra[2];
-            y[0] = BgrToY(blue, green, red);
-            u[0] = BgrToU(blue, green, red);
-            v[0] = BgrToV(blue, green, red);
+            y[0] = BgrToY<T>(blue, green, red);
+            u[0] = BgrToU<T>(blue, green, red);
+            v[0] = BgrToV<T>(blue, green, red);
         }
 
-        void BgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+        template <class T> void BgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t col = 0, colBgra = 0; col < width; ++col, colBgra += 4)
-                    BgraToYuv444p(bgra + colBgra, y + col, u + col, v + col);
+                    BgraToYuv444p<T>(bgra + colBgra, y + col, u + col, v + col);
                 y += yStride;
                 u += uStride;
                 v += vStride;
@@ -113,6 +167,33 @@ namespace Simd
             }
         }
 
+        void BgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgraToYuv444p<Bt601>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgraToYuv444pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgraToYuv444p<Bt601>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgraToYuv444p<Bt709>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgraToYuv444p<Bt2020>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: BgraToYuv444p<Bt601Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: BgraToYuv444p<Bt709Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: BgraToYuv444p<Bt2020Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            default: assert(0);
+            }
+        }
+
+        void RgbaToYuv444p(const uint8_t * rgba, size_t width, size_t height, size_t rgbaStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgraToYuv444p<Rgb<Bt601>>(rgba, width, height, rgbaStride, y, yStride, u, uStride, v, vStride);
+        }
+
         SIMD_INLINE void BgraToYuva420p(const uint8_t * bgra0, size_t bgraStride, uint8_t * y0, size_t yStride, uint8_t * u, uint8_t * v, uint8_t * a0, size_t aStride)
         {
             const uint8_t * bgra1 = bgra0 + bgraStride;
@@ -153,5 +234,60 @@ namespace Simd
                 bgra += 2 * bgraStride;
             }
         }
+
+        template <bool nv21, class T> void BgraToNv12(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * uv, size_t uvStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
+
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0, colBgra = 0; colY < width; colY += 2, colBgra += 8)
+                    BgraToYuv420p<T>(bgra + colBgra, bgraStride, y + colY, yStride, uv + colY + (nv21 ? 1 : 0), uv + colY + (nv21 ? 0 : 1));
+                y += 2 * yStride;
+                uv += uvStride;
+                bgra += 2 * bgraStride;
+            }
+        }
+
+        void BgraToNv12(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride)
+        {
+            BgraToNv12<false, Bt601>(bgra, width, height, bgraStride, y, yStride, uv, uvStride);
+        }
+
+        void BgraToNv12V2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgraToNv12<false, Bt601>(bgra, width, height, bgraStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt709: BgraToNv12<false, Bt709>(bgra, width, height, bgraStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt2020: BgraToNv12<false, Bt2020>(bgra, width, height, bgraStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt601Full: BgraToNv12<false, Bt601Full>(bgra, width, height, bgraStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt709Full: BgraToNv12<false, Bt709Full>(bgra, width, height, bgraStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt2020Full: BgraToNv12<false, Bt2020Full>(bgra, width, height, bgraStride, y, yStride, uv, uvStride); break;
+            default: assert(0);
+            }
+        }
+
+        void BgraToNv21(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * vu, size_t vuStride)
+        {
+            BgraToNv12<true, Bt601>(bgra, width, height, bgraStride, y, yStride, vu, vuStride);
+        }
+
+        void BgraToNv21V2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * vu, size_t vuStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgraToNv12<true, Bt601>(bgra, width, height, bgraStride, y, yStride, vu, vuStride); break;
+            case SimdYuvBt709: BgraToNv12<true, Bt709>(bgra, width, height, bgraStride, y, yStride, vu, vuStride); break;
+            case SimdYuvBt2020: BgraToNv12<true, Bt2020>(bgra, width, height, bgraStride, y, yStride, vu, vuStride); break;
+            case SimdYuvBt601Full: BgraToNv12<true, Bt601Full>(bgra, width, height, bgraStride, y, yStride, vu, vuStride); break;
+            case SimdYuvBt709Full: BgraToNv12<true, Bt709Full>(bgra, width, height, bgraStride, y, yStride, vu, vuStride); break;
+            case SimdYuvBt2020Full: BgraToNv12<true, Bt2020Full>(bgra, width, height, bgraStride, y, yStride, vu, vuStride); break;
+            default: assert(0);
+            }
+        }
     }
 }
@@ -25,10 +25,38 @@
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdBase.h"
 
+#include <atomic>
+
 namespace Simd
 {
     namespace Base
     {
+        static thread_local Array32f g_convolutionScratch;
+        static std::atomic<size_t> g_convolutionScratchPeak(0);
+
+        float * ConvolutionScratch(size_t size)
+        {
+            if (g_convolutionScratch.size < size)
+            {
+                g_convolutionScratch.Resize(size);
+                size_t peak = g_convolutionScratchPeak.load();
+                while (peak < size && !g_convolutionScratchPeak.compare_exchange_weak(peak, size));
+            }
+            return g_convolutionScratch.data;
+        }
+
+        size_t ConvolutionScratchPeak()
+        {
+            return g_convolutionScratchPeak.load();
+        }
+
+        void ConvolutionScratchRelease()
+        {
+            g_convolutionScratch.Resize(0);
+        }
+
+        //---------------------------------------------------------------------
+
         static void ConvolutionBiasAndActivation(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, SimdBool trans, float * dst)
         {
             if (activation == ::SimdConvolutionActivationIdentity)
@@ -148,6 +148,262 @@ namespace Simd
             const char * rect = "rect";
         }
 
+        static int HaarShift16i(const Data & data)
+        {
+            static const int SHIFT_MAX = 4;
+            if (!data.isStumpBased)
+                return -1;
+            for (size_t i = 0; i < data.nodes.size(); ++i)
+            {
+                if (Simd::Abs(data.nodes[i].threshold) >= 0.999f)
+                    return -1;
+            }
+            double bound = 255.0 * (data.origWinSize.x - 2) * (data.origWinSize.y - 2) / 2.0;
+            for (size_t i = 0; i < data.haarFeatures.size(); ++i)
+            {
+                const Data::HaarFeature & feature = data.haarFeatures[i];
+                double positive = 0, negative = 0;
+                for (int j = 0; j < Data::HaarFeature::RECT_NUM; ++j)
+                {
+                    const Data::WeightedRect & rect = feature.rect[j];
+                    if (rect.weight != float(Simd::Round(rect.weight)) || Simd::Abs(rect.weight) > 127.0f)
+                        return -1;
+                    double area = rect.r.width * rect.r.height * (feature.tilted ? 2.0 : 1.0);
+                    if (rect.weight > 0)
+                        positive += rect.weight * area;
+                    else
+                        negative -= rect.weight * area;
+                }
+                bound = Simd::Max(bound, 255.0 * Simd::Max(positive, negative));
+            }
+            int shift = 0;
+            while (bound / double(1 << shift) >= SHRT_MAX * 0.9)
+                shift++;
+            return shift <= SHIFT_MAX ? shift : -1;
+        }
+
+        namespace Binary
+        {
+            const char MAGIC[8] = { 'S', 'i', 'm', 'd', 'C', 'a', 's', 'c' };
+            const uint32_t VERSION = 1;
+            const size_t ALIGN = 16;
+
+            struct Header
+            {
+                char magic[8];
+                uint32_t version, size;
+                int32_t stageType, featureType, ncategories, width, height;
+                uint8_t isStumpBased, hasTilted, canInt16, reserved;
+                uint32_t count[7], item[7];
+            };
+
+            SIMD_INLINE bool IsBinary(const void * buffer, size_t size)
+            {
+                return size >= sizeof(Header) && memcmp(buffer, MAGIC, sizeof(MAGIC)) == 0;
+            }
+
+            template<class T> SIMD_INLINE size_t Size(const std::vector<T> & vector)
+            {
+                return AlignHi(vector.size() * sizeof(T), ALIGN);
+            }
+
+            template<class T> SIMD_INLINE void Set(const std::vector<T> & vector, size_t index, Header & header)
+            {
+                header.count[index] = (uint32_t)vector.size();
+                header.item[index] = (uint32_t)sizeof(T);
+            }
+
+            template<class T> SIMD_INLINE void Write(const std::vector<T> & vector, uint8_t * & dst)
+            {
+                if (vector.size())
+                    memcpy(dst, vector.data(), vector.size() * sizeof(T));
+                dst += Size(vector);
+            }
+
+            template<class T> SIMD_INLINE void Read(std::vector<T> & vector, const Header & header, size_t index, const uint8_t * & src, const uint8_t * end)
+            {
+                if (header.item[index] != sizeof(T))
+                    SIMD_EX("Invalid binary cascade item size!");
+                size_t size = header.count[index] * sizeof(T);
+                if (src + AlignHi(size, ALIGN) > end)
+                    SIMD_EX("Invalid binary cascade size!");
+                vector.resize(header.count[index]);
+                if (size)
+                    memcpy(vector.data(), src, size);
+                src += AlignHi(size, ALIGN);
+            }
+
+            SIMD_INLINE bool Inside(const Detection::Size & win, int64_t left, int64_t top, int64_t right, int64_t bottom)
+            {
+                return left >= 0 && top >= 0 && left <= right && top <= bottom && right <= win.x && bottom <= win.y;
+            }
+
+            static bool Valid(const Detection::Size & win, const Data::HaarFeature & feature)
+            {
+                for (int i = 0; i < Data::HaarFeature::RECT_NUM; ++i)
+                {
+                    const Data::Rect & r = feature.rect[i].r;
+                    int64_t x = r.x, y = r.y, w = r.width, h = r.height;
+                    if (x < 0 || y < 0 || w < 0 || h < 0)
+                        return false;
+                    if (feature.tilted)
+                    {
+                        if (!Inside(win, x - h, y, x + w, y + w + h))
+                            return false;
+                    }
+                    else
+                    {
+                        if (!Inside(win, x, y, x + w, y + h))
+                            return false;
+                    }
+                }
+                return true;
+            }
+
+            static bool Valid(const Detection::Size & win, const Data::LbpFeature & feature)
+            {
+                const Data::Rect & r = feature.rect;
+                int64_t x = r.x, y = r.y, w = r.width, h = r.height;
+                if (w <= 0 || h <= 0)
+                    return false;
+                return Inside(win, x, y, x + 3 * w, y + 3 * h);
+            }
+
+            SIMD_INLINE uint8_t Tilted(const Data::HaarFeature & feature)
+            {
+                uint8_t tilted;
+                memcpy(&tilted, &feature.tilted, sizeof(tilted));
+                return tilted;
+            }
+
+            static void Validate(const Data & data)
+            {
+                if (data.origWinSize.x <= 0 || data.origWinSize.y <= 0 || !data.isStumpBased)
+                    SIMD_EX("Invalid binary cascade parameters!");
+                if (data.featureType == SimdDetectionInfoFeatureLbp ? (data.ncategories < 256 || data.ncategories > 0x10000) : data.ncategories < 0)
+                    SIMD_EX("Invalid binary cascade categories!");
+                for (size_t i = 0; i < data.haarFeatures.size(); ++i)
+                {
+                    uint8_t tilted = Tilted(data.haarFeatures[i]);
+                    if (tilted > 1 || (tilted && !data.hasTilted) || !Valid(data.origWinSize, data.haarFeatures[i]))
+                        SIMD_EX("Invalid binary cascade HAAR feature!");
+                }
+                for (size_t i = 0; i < data.lbpFeatures.size(); ++i)
+                    if (!Valid(data.origWinSize, data.lbpFeatures[i]))
+                        SIMD_EX("Invalid binary cascade LBP feature!");
+                if (data.nodes.size() != data.classifiers.size() || data.leaves.size() != data.nodes.size() * 2)
+                    SIMD_EX("Invalid binary cascade nodes!");
+                for (size_t i = 0; i < data.stages.size(); ++i)
+                    if (data.stages[i].first < 0 || data.stages[i].ntrees < 0 || size_t(data.stages[i].first + data.stages[i].ntrees) > data.classifiers.size())
+                        SIMD_EX("Invalid binary cascade stages!");
+                size_t features = data.featureType == SimdDetectionInfoFeatureHaar ? data.haarFeatures.size() : data.lbpFeatures.size();
+                for (size_t i = 0; i < data.nodes.size(); ++i)
+                    if (data.nodes[i].featureIdx < 0 || size_t(data.nodes[i].featureIdx) >= features)
+                        SIMD_EX("Invalid binary cascade features!");
+                if (data.featureType == SimdDetectionInfoFeatureLbp && data.subsets.size() != data.nodes.size() * ((data.ncategories + 31) / 32))
+                    SIMD_EX("Invalid binary cascade subsets!");
+            }
+
+            static bool CanInt16(const Data & data)
+            {
+                if (data.featureType == SimdDetectionInfoFeatureHaar)
+                    return HaarShift16i(data) >= 0;
+                for (size_t i = 0; i < data.lbpFeatures.size(); ++i)
+                    if (int64_t(data.lbpFeatures[i].rect.width) * data.lbpFeatures[i].rect.height > 256)
+                        return false;
+                return true;
+            }
+        }
+
+        void * DetectionLoadBinary(const void * buffer, size_t size)
+        {
+            Data * data = NULL;
+            try
+            {
+                if (buffer == NULL || !Binary::IsBinary(buffer, size))
+                    SIMD_EX("Invalid binary cascade format!");
+                Binary::Header header;
+                memcpy(&header, buffer, sizeof(header));
+                if (header.version != Binary::VERSION || header.size > size)
+                    SIMD_EX("Unsupported binary cascade version or size!");
+                if (header.featureType != SimdDetectionInfoFeatureHaar && header.featureType != SimdDetectionInfoFeatureLbp)
+                    SIMD_EX("Invalid binary cascade feature type!");
+
+                data = new Data();
+                data->stageType = header.stageType;
+                data->featureType = (SimdDetectionInfoFlags)header.featureType;
+                data->ncategories = header.ncategories;
+                data->origWinSize = Size(header.width, header.height);
+                data->isStumpBased = header.isStumpBased != 0;
+                data->hasTilted = header.hasTilted != 0;
+
+                const uint8_t * src = (const uint8_t*)buffer + AlignHi(sizeof(header), Binary::ALIGN);
+                const uint8_t * end = (const uint8_t*)buffer + header.size;
+                Binary::Read(data->stages, header, 0, src, end);
+                Binary::Read(data->classifiers, header, 1, src, end);
+                Binary::Read(data->nodes, header, 2, src, end);
+                Binary::Read(data->leaves, header, 3, src, end);
+                Binary::Read(data->subsets, header, 4, src, end);
+                Binary::Read(data->haarFeatures, header, 5, src, end);
+                Binary::Read(data->lbpFeatures, header, 6, src, end);
+                Binary::Validate(*data);
+                data->canInt16 = header.canInt16 != 0 && Binary::CanInt16(*data);
+            }
+            catch (...)
+            {
+                delete data;
+                data = NULL;
+            }
+            return data;
+        }
+
+        size_t DetectionSaveBinary(const void * _data, void * buffer, size_t size)
+        {
+            const Data * data = (const Data*)_data;
+            if (data == NULL)
+                return 0;
+
+            Binary::Header header;
+            memset(&header, 0, sizeof(header));
+            memcpy(header.magic, Binary::MAGIC, sizeof(Binary::MAGIC));
+            header.version = Binary::VERSION;
+            header.stageType = data->stageType;
+            header.featureType = data->featureType;
+            header.ncategories = data->ncategories;
+            header.width = (int32_t)data->origWinSize.x;
+            header.height = (int32_t)data->origWinSize.y;
+            header.isStumpBased = data->isStumpBased ? 1 : 0;
+            header.hasTilted = data->hasTilted ? 1 : 0;
+            header.canInt16 = data->canInt16 ? 1 : 0;
+            Binary::Set(data->stages, 0, header);
+            Binary::Set(data->classifiers, 1, header);
+            Binary::Set(data->nodes, 2, header);
+            Binary::Set(data->leaves, 3, header);
+            Binary::Set(data->subsets, 4, header);
+            Binary::Set(data->haarFeatures, 5, header);
+            Binary::Set(data->lbpFeatures, 6, header);
+            size_t total = AlignHi(sizeof(header), Binary::ALIGN) + Binary::Size(data->stages) + Binary::Size(data->classifiers) +
+                Binary::Size(data->nodes) + Binary::Size(data->leaves) + Binary::Size(data->subsets) +
+                Binary::Size(data->haarFeatures) + Binary::Size(data->lbpFeatures);
+            header.size = (uint32_t)total;
+
+            if (buffer && size >= total)
+            {
+                uint8_t * dst = (uint8_t*)buffer;
+                memset(dst, 0, total);
+                memcpy(dst, &header, sizeof(header));
+                dst += AlignHi(sizeof(header), Binary::ALIGN);
+                Binary::Write(data->stages, dst);
+                Binary::Write(data->classifiers, dst);
+                Binary::Write(data->nodes, dst);
+                Binary::Write(data->leaves, dst);
+                Binary::Write(data->subsets, dst);
+                Binary::Write(data->haarFeatures, dst);
+                Binary::Write(data->lbpFeatures, dst);
+            }
+            return total;
+        }
+
         void * DetectionLoadA(const char * path)
         {
             static const float THRESHOLD_EPS = 1e-5f;
@@ -159,6 +415,9 @@ namespace Simd
                 if (!file.Open(path))
                     SIMD_EX("Can't load XML file '" << path << "'!");
 
+                if (Binary::IsBinary(file.Data(), file.Size() - 1))
+                    return DetectionLoadBinary(file.Data(), file.Size() - 1);
+
                 Xml::Document doc;
                 doc.Parse<0>(file.Data());
 
@@ -287,6 +546,7 @@ namespace Simd
                             data->hasTilted = true;
                         data->haarFeatures.push_back(feature);
                     }
+                    data->canInt16 = HaarShift16i(*data) >= 0;
                 }
 
                 if (data->featureType == SimdDetectionInfoFeatureLbp)
@@ -421,33 +681,31 @@ namespace Simd
             hid->tilted = tilted;
         }
 
-        template<class T> SIMD_INLINE void UpdateFeaturePtrs(HidHaarCascade * hid, const Data & data)
+        template<class T, class Feature> SIMD_INLINE void UpdateFeaturePtrs(const Data & data, const Image & sum, const Image & tilted, bool throughColumn, std::vector<Feature> & features)
         {
-            Image sum = hid->isThroughColumn ? hid->isum : hid->sum;
-            Image tilted = hid->isThroughColumn ? hid->itilted : hid->tilted;
-            for (size_t i = 0; i < hid->features.size(); i++)
+            for (size_t i = 0; i < features.size(); i++)
             {
                 const Data::HaarFeature & df = data.haarFeatures[i];
-                HidHaarCascade::Feature & hf = hid->features[i];
+                Feature & hf = features[i];
                 for (int j = 0; j < Data::HaarFeature::RECT_NUM; ++j)
                 {
                     const Data::Rect & dr = df.rect[j].r;
-                    WeightedRect & hr = hf.rect[j];
-                    if (hr.weight != 0.0)
+                    auto & hr = hf.rect[j];
+                    if (hr.weight != 0)
                     {
                         if (df.tilted)
                         {
-                            hr.p0 = SumElemPtr<T>(tilted, dr.y, dr.x, hid->isThroughColumn);
-                            hr.p1 = SumElemPtr<T>(tilted, dr.y + dr.height, dr.x - dr.height, hid->isThroughColumn);
-                            hr.p2 = SumElemPtr<T>(tilted, dr.y + dr.width, dr.x + dr.width, hid->isThroughColumn);
-                            hr.p3 = SumElemPtr<T>(tilted, dr.y + dr.width + dr.height, dr.x + dr.width - dr.height, hid->isThroughColumn);
+                            hr.p0 = SumElemPtr<T>(tilted, dr.y, dr.x, throughColumn);
+                            hr.p1 = SumElemPtr<T>(tilted, dr.y + dr.height, dr.x - dr.height, throughColumn);
+                            hr.p2 = SumElemPtr<T>(tilted, dr.y + dr.width, dr.x + dr.width, throughColumn);
+                            hr.p3 = SumElemPtr<T>(tilted, dr.y + dr.width + dr.height, dr.x + dr.width - dr.height, throughColumn);
                         }
                         else
                         {
-                            hr.p0 = SumElemPtr<T>(sum, dr.y, dr.x, hid->isThroughColumn);
-                            hr.p1 = SumElemPtr<T>(sum, dr.y, dr.x + dr.width, hid->isThroughColumn);
-                            hr.p2 = SumElemPtr<T>(sum, dr.y + dr.height, dr.x, hid->isThroughColumn);
-                            hr.p3 = SumElemPtr<T>(sum, dr.y + dr.height, dr.x + dr.width, hid->isThroughColumn);
+                            hr.p0 = SumElemPtr<T>(sum, dr.y, dr.x, throughColumn);
+                            hr.p1 = SumElemPtr<T>(sum, dr.y, dr.x + dr.width, throughColumn);
+                            hr.p2 = SumElemPtr<T>(sum, dr.y + dr.height, dr.x, throughColumn);
+                            hr.p3 = SumElemPtr<T>(sum, dr.y + dr.height, dr.x + dr.width, throughColumn);
                         }
                     }
                     else
@@ -461,13 +719,54 @@ namespace Simd
             }
         }
 
-        HidHaarCascade * InitHaar(const Data & data, const Image & sum, const Image & sqsum, const Image & tilted, bool throughColumn)
+        static void InitHaar16i(const Data & data, HidHaarCascade * hid)
+        {
+            hid->isInt16 = true;
+            hid->ishift = HaarShift16i(data);
+            hid->inorm = 1.0f / float(1 << hid->ishift);
+
+            hid->ileaves.resize(data.leaves.size());
+            for (size_t i = 0; i < data.stages.size(); ++i)
+            {
+                const Data::Stage & stage = data.stages[i];
+                float min = 0, max = 0;
+                for (int j = stage.first, n = stage.first + stage.ntrees; j < n; ++j)
+                {
+                    min += std::min(data.leaves[2 * j + 0], data.leaves[2 * j + 1]);
+                    max += std::max(data.leaves[2 * j + 0], data.leaves[2 * j + 1]);
+                }
+                float k = float(SHRT_MAX)*0.9f / Simd::Max(Simd::Abs(min), Simd::Abs(max));
+                hid->stages[i].ithreshold = Simd::RestrictRange(Simd::Round(stage.threshold*k), SHRT_MIN, SHRT_MAX);
+                for (int j = stage.first * 2, n = (stage.first + stage.ntrees) * 2; j < n; ++j)
+                    hid->ileaves[j] = Simd::Round(data.leaves[j] * k);
+            }
+
+            for (size_t i = 0; i < data.nodes.size(); ++i)
+                hid->nodes[i].ithreshold = Simd::Round(data.nodes[i].threshold * 32768.0f);
+
+            hid->ifeatures.resize(data.haarFeatures.size());
+            for (size_t i = 0; i < hid->ifeatures.size(); ++i)
+                for (int j = 0; j < Data::HaarFeature::RECT_NUM; ++j)
+                    hid->ifeatures[i].rect[j].weight = Simd::Round(data.haarFeatures[i].rect[j].weight);
+        }
+
+        HidHaarCascade * InitHaar(const Data & data, const Image & sum, const Image & sqsum, const Image & tilted, bool throughColumn, bool int16)
         {
             if (!data.isStumpBased)
                 SIMD_EX("Can't use tree classfier for vector haar classifier!");
 
             HidHaarCascade * hid = CreateHidHaar(data);
             InitBase(hid, sum, sqsum, tilted);
+            if (int16 && data.canInt16)
+            {
+                InitHaar16i(data, hid);
+                hid->isThroughColumn = throughColumn;
+                hid->isum.Recreate(sum.Size(), Image::Int16);
+                if (hid->hasTilted)
+                    hid->itilted.Recreate(tilted.Size(), Image::Int16);
+                UpdateFeaturePtrs<uint16_t>(data, hid->isum, hid->itilted, hid->isThroughColumn, hid->ifeatures);
+                return hid;
+            }
             if (throughColumn)
             {
                 hid->isThroughColumn = true;
@@ -475,7 +774,10 @@ namespace Simd
                 if (hid->hasTilted)
                     hid->itilted.Recreate(tilted.width, tilted.height, Image::Int32, NULL, Image::PixelSize(Image::Int32));
             }
-            UpdateFeaturePtrs<uint32_t>(hid, data);
+            if (hid->isThroughColumn)
+                UpdateFeaturePtrs<uint32_t>(data, hid->isum, hid->itilted, true, hid->features);
+            else
+                UpdateFeaturePtrs<uint32_t>(data, hid->sum, hid->tilted, false, hid->features);
             return hid;
         }
 
@@ -623,7 +925,8 @@ namespace Simd
                     Image(width, height, sumStride, Image::Int32, sum),
                     Image(width, height, sqsumStride, Image::Int32, sqsum),
                     Image(width, height, tiltedStride, Image::Int32, tilted),
-                    throughColumn != 0);
+                    throughColumn != 0,
+                    int16 != 0);
             case SimdDetectionInfoFeatureLbp:
                 return InitLbp(data,
                     Image(width, height, sumStride, Image::Int32, sum),
@@ -652,7 +955,7 @@ namespace Simd
             }
         }
 
-        void Prepare16i(const Image & src, bool throughColumn, Image & dst)
+        void Prepare16i(const Image & src, bool throughColumn, int shift, Image & dst)
         {
             assert(Simd::EqualSize(src, dst) && src.format == Image::Int32 && dst.format == Image::Int16);
 
@@ -664,11 +967,11 @@ namespace Simd
 
                     uint16_t * evenDst = &dst.At<uint16_t>(0, row);
                     for (size_t col = 0; col < src.width; col += 2)
-                        evenDst[col >> 1] = (uint16_t)s[col];
+                        evenDst[col >> 1] = (uint16_t)(s[col] >> shift);
 
                     uint16_t * oddDst = &dst.At<uint16_t>((dst.width + 1) >> 1, row);
                     for (size_t col = 1; col < src.width; col += 2)
-                        oddDst[col >> 1] = (uint16_t)s[col];
+                        oddDst[col >> 1] = (uint16_t)(s[col] >> shift);
                 }
             }
             else
@@ -678,7 +981,7 @@ namespace Simd
                     const uint32_t * s = &src.At<uint32_t>(0, row);
                     uint16_t * d = &dst.At<uint16_t>(0, row);
                     for (size_t col = 0; col < src.width; ++col)
-                        d[col] = (uint16_t)s[col];
+                        d[col] = (uint16_t)(s[col] >> shift);
                 }
             }
         }
@@ -686,7 +989,14 @@ namespace Simd
         void DetectionPrepare(void * _hid)
         {
             HidBase * hidBase = (HidBase*)_hid;
-            if (hidBase->featureType == SimdDetectionInfoFeatureHaar && hidBase->isThroughColumn)
+            if (hidBase->featureType == SimdDetectionInfoFeatureHaar && hidBase->isInt16)
+            {
+                HidHaarCascade * hid = (HidHaarCascade*)hidBase;
+                Prepare16i(hid->sum, hid->isThroughColumn, hid->ishift, hid->isum);
+                if (hid->hasTilted)
+                    Prepare16i(hid->tilted, hid->isThroughColumn, hid->ishift, hid->itilted);
+            }
+            else if (hidBase->featureType == SimdDetectionInfoFeatureHaar && hidBase->isThroughColumn)
             {
                 HidHaarCascade * hid = (HidHaarCascade*)hidBase;
                 PrepareThroughColumn32i(hid->sum, hid->isum);
@@ -698,7 +1008,7 @@ namespace Simd
                 if (hidBase->isInt16)
                 {
                     HidLbpCascade<int, short> * hid = (HidLbpCascade<int, short>*)hidBase;
-                    Prepare16i(hid->sum, hid->isThroughColumn, hid->isum);
+                    Prepare16i(hid->sum, hid->isThroughColumn, 0, hid->isum);
                 }
                 else if (hidBase->isThroughColumn)
                 {
@@ -803,6 +1113,87 @@ namespace Simd
                 Image(hid.sum.width - 1, hid.sum.height - 1, dstStride, Image::Gray8, dst).Ref());
         }
 
+        int Detect16i(const HidHaarCascade & hid, size_t offset, int startStage, int norm)
+        {
+            typedef HidHaarCascade Hid;
+            const Hid::Stage * stages = hid.stages.data();
+            if (startStage >= (int)hid.stages.size())
+                return 1;
+            const Hid::Node * node = hid.nodes.data() + stages[startStage].first;
+            const int * leaves = hid.ileaves.data() + stages[startStage].first * 2;
+            for (int i = startStage, n = (int)hid.stages.size(); i < n; ++i)
+            {
+                const Hid::Stage & stage = stages[i];
+                const Hid::Node * end = node + stage.ntrees;
+                int stageSum = 0;
+                for (; node < end; ++node, leaves += 2)
+                {
+                    const Hid::IFeature & feature = hid.ifeatures[node->featureIdx];
+                    int sum = WeightedSum16i(feature.rect[0], offset) + WeightedSum16i(feature.rect[1], offset);
+                    if (feature.rect[2].p0)
+                        sum += WeightedSum16i(feature.rect[2], offset);
+                    stageSum += leaves[int16_t(sum) >= Threshold16i(node->ithreshold, norm)];
+                }
+                if (stageSum < stage.ithreshold)
+                    return -i;
+            }
+            return 1;
+        }
+
+        void DetectionHaarDetect16ip(const HidHaarCascade & hid, const Image & mask, const Rect & rect, Image & dst)
+        {
+            for (ptrdiff_t row = rect.top; row < rect.bottom; row += 1)
+            {
+                size_t p_offset = row * hid.isum.stride / sizeof(uint16_t);
+                size_t pq_offset = row * hid.sqsum.stride / sizeof(uint32_t);
+                for (ptrdiff_t col = rect.left; col < rect.right; col += 1)
+                {
+                    if (mask.At<uint8_t>(col, row) == 0)
+                        continue;
+                    int norm = Norm16i(hid, pq_offset + col);
+                    if (Detect16i(hid, p_offset + col, 0, norm) > 0)
+                        dst.At<uint8_t>(col, row) = 1;
+                }
+            }
+        }
+
+        void DetectionHaarDetect16ip(const void * _hid, const uint8_t * mask, size_t maskStride,
+            ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
+        {
+            const HidHaarCascade & hid = *(HidHaarCascade*)_hid;
+            return DetectionHaarDetect16ip(hid,
+                Image(hid.sum.width - 1, hid.sum.height - 1, maskStride, Image::Gray8, (uint8_t*)mask),
+                Rect(left, top, right, bottom),
+                Image(hid.sum.width - 1, hid.sum.height - 1, dstStride, Image::Gray8, dst).Ref());
+        }
+
+        void DetectionHaarDetect16ii(const HidHaarCascade & hid, const Image & mask, const Rect & rect, Image & dst)
+        {
+            for (ptrdiff_t row = rect.top; row < rect.bottom; row += 2)
+            {
+                size_t p_offset = row * hid.isum.stride / sizeof(uint16_t);
+                size_t pq_offset = row * hid.sqsum.stride / sizeof(uint32_t);
+                for (ptrdiff_t col = rect.left; col < rect.right; col += 2)
+                {
+                    if (mask.At<uint8_t>(col, row) == 0)
+                        continue;
+                    int norm = Norm16i(hid, pq_offset + col);
+                    if (Detect16i(hid, p_offset + col / 2, 0, norm) > 0)
+                        dst.At<uint8_t>(col, row) = 1;
+                }
+            }
+        }
+
+        void DetectionHaarDetect16ii(const void * _hid, const uint8_t * mask, size_t maskStride,
+            ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
+        {
+            const HidHaarCascade & hid = *(HidHaarCascade*)_hid;
+            return DetectionHaarDetect16ii(hid,
+                Image(hid.sum.width - 1, hid.sum.height - 1, maskStride, Image::Gray8, (uint8_t*)mask),
+                Rect(left, top, right, bottom),
+                Image(hid.sum.width - 1, hid.sum.height - 1, dstStride, Image::Gray8, dst).Ref());
+        }
+
         void DetectionLbpDetect32fp(const HidLbpCascade<float, uint32_t> & hid, const Image & mask, const Rect & rect, Image & dst)
         {
             for (ptrdiff_t row = rect.top; row < rect.bottom; row += 1)
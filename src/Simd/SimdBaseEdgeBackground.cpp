@@ -140,5 +140,103 @@ namespace Simd
                 mask += maskStride;
             }
         }
+
+        void EdgeBackgroundPackedInit(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0, offset = 0; col < width; ++col, offset += 2)
+                {
+                    model[offset + 0] = value[col];
+                    model[offset + 1] = 0;
+                }
+                value += valueStride;
+                model += modelStride;
+            }
+        }
+
+        void EdgeBackgroundPackedUpdate(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * model, size_t modelStride, uint8_t threshold, int flags)
+        {
+            bool grow = (flags & SimdBackgroundUpdateGrowRange) != 0;
+            bool increment = (flags & SimdBackgroundUpdateIncrementCount) != 0;
+            bool adjust = (flags & SimdBackgroundUpdateAdjustRange) != 0;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0, offset = 0; col < width; ++col, offset += 2)
+                {
+                    uint8_t & background = model[offset + 0];
+                    uint8_t & count = model[offset + 1];
+                    if (grow)
+                        background = MaxU8(value[col], background);
+                    if (increment && value[col] > background && count < 0xFF)
+                        count++;
+                    if (adjust)
+                    {
+                        AdjustEdge(count, background, threshold);
+                        count = 0;
+                    }
+                }
+                value += valueStride;
+                model += modelStride;
+            }
+        }
+
+        void EdgeBackgroundPackedGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0, offset = 0; col < width; ++col, offset += 2)
+                {
+                    if (value[col] > model[offset])
+                        model[offset]++;
+                }
+                value += valueStride;
+                model += modelStride;
+            }
+        }
+
+        void EdgeBackgroundPackedAdjustRangeMasked(uint8_t * model, size_t modelStride, size_t width, size_t height,
+            uint8_t threshold, const uint8_t * mask, size_t maskStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0, offset = 0; col < width; ++col, offset += 2)
+                {
+                    if (mask[col])
+                        AdjustEdge(model[offset + 1], model[offset + 0], threshold);
+                    model[offset + 1] = 0;
+                }
+                model += modelStride;
+                mask += maskStride;
+            }
+        }
+
+        void EdgeBackgroundPackedShiftRange(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0, offset = 0; col < width; ++col, offset += 2)
+                    model[offset] = value[col];
+                value += valueStride;
+                model += modelStride;
+            }
+        }
+
+        void EdgeBackgroundPackedShiftRangeMasked(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * model, size_t modelStride, const uint8_t * mask, size_t maskStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0, offset = 0; col < width; ++col, offset += 2)
+                {
+                    if (mask[col])
+                        model[offset] = value[col];
+                }
+                value += valueStride;
+                model += modelStride;
+                mask += maskStride;
+            }
+        }
     }
 }
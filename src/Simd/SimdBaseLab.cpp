@@ -0,0 +1,111 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdLab.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        LabGamma::LabGamma()
+        {
+            for (int i = 0; i < 256; ++i)
+            {
+                double v = i / 255.0;
+                decode[i] = float(v <= 0.04045 ? v / 12.92 : ::pow((v + 0.055) / 1.055, 2.4));
+            }
+            for (int i = 0; i <= LAB_GAMMA_SIZE; ++i)
+            {
+                double v = double(i) / LAB_GAMMA_SIZE;
+                encode[i] = float(255.0 * (v <= 0.0031308 ? v * 12.92 : 1.055 * ::pow(v, 1.0 / 2.4) - 0.055));
+            }
+        }
+
+        const LabGamma & GetLabGamma()
+        {
+            static const LabGamma gamma;
+            return gamma;
+        }
+
+        void BgrToLab(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * lab, size_t labStride)
+        {
+            const LabGamma & gamma = GetLabGamma();
+            float _lab[3];
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t offset = 0, end = width * 3; offset < end; offset += 3)
+                {
+                    BgrToLab(bgr[offset + 0], bgr[offset + 1], bgr[offset + 2], gamma, _lab);
+                    lab[offset + 0] = RestrictRange(Round(_lab[0] * LAB_L_TO_8U));
+                    lab[offset + 1] = RestrictRange(Round(_lab[1] + LAB_AB_SHIFT));
+                    lab[offset + 2] = RestrictRange(Round(_lab[2] + LAB_AB_SHIFT));
+                }
+                bgr += bgrStride;
+                lab += labStride;
+            }
+        }
+
+        void BgrToLab32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * lab, size_t labStride)
+        {
+            const LabGamma & gamma = GetLabGamma();
+            for (size_t row = 0; row < height; ++row)
+            {
+                float * pLab = (float*)lab;
+                for (size_t offset = 0, end = width * 3; offset < end; offset += 3)
+                    BgrToLab(bgr[offset + 0], bgr[offset + 1], bgr[offset + 2], gamma, pLab + offset);
+                bgr += bgrStride;
+                lab += labStride;
+            }
+        }
+
+        void LabToBgr(const uint8_t * lab, size_t width, size_t height, size_t labStride, uint8_t * bgr, size_t bgrStride)
+        {
+            const LabGamma & gamma = GetLabGamma();
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t offset = 0, end = width * 3; offset < end; offset += 3)
+                {
+                    float l = float(lab[offset + 0]) * LAB_8U_TO_L;
+                    float a = float(lab[offset + 1]) - LAB_AB_SHIFT;
+                    float b = float(lab[offset + 2]) - LAB_AB_SHIFT;
+                    LabToBgr(l, a, b, gamma, bgr + offset);
+                }
+                lab += labStride;
+                bgr += bgrStride;
+            }
+        }
+
+        void Lab32fToBgr(const uint8_t * lab, size_t width, size_t height, size_t labStride, uint8_t * bgr, size_t bgrStride)
+        {
+            const LabGamma & gamma = GetLabGamma();
+            for (size_t row = 0; row < height; ++row)
+            {
+                const float * pLab = (const float*)lab;
+                for (size_t offset = 0, end = width * 3; offset < end; offset += 3)
+                    LabToBgr(pLab[offset + 0], pLab[offset + 1], pLab[offset + 2], gamma, bgr + offset);
+                lab += labStride;
+                bgr += bgrStride;
+            }
+        }
+    }
+}
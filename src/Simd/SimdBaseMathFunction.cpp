@@ -0,0 +1,98 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMathFunction.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        template<SimdMathFunctionType type> SIMD_INLINE float MathFunction(float value, const float * params);
+
+        template<> SIMD_INLINE float MathFunction<SimdMathFunctionExp>(float value, const float * params)
+        {
+            return ::expf(value);
+        }
+
+        template<> SIMD_INLINE float MathFunction<SimdMathFunctionLog>(float value, const float * params)
+        {
+            return ::logf(value);
+        }
+
+        template<> SIMD_INLINE float MathFunction<SimdMathFunctionPow>(float value, const float * params)
+        {
+            return ::powf(value, params[0]);
+        }
+
+        template<> SIMD_INLINE float MathFunction<SimdMathFunctionSigmoid>(float value, const float * params)
+        {
+            return 1.0f / (1.0f + ::expf(-value));
+        }
+
+        template<> SIMD_INLINE float MathFunction<SimdMathFunctionTanh>(float value, const float * params)
+        {
+            return ::tanhf(value);
+        }
+
+        template<> SIMD_INLINE float MathFunction<SimdMathFunctionGelu>(float value, const float * params)
+        {
+            return value * 0.5f * (1.0f + ::erff(value * float(M_SQRT1_2)));
+        }
+
+        template<> SIMD_INLINE float MathFunction<SimdMathFunctionErf>(float value, const float * params)
+        {
+            return ::erff(value);
+        }
+
+        template<> SIMD_INLINE float MathFunction<SimdMathFunctionSwish>(float value, const float * params)
+        {
+            return value / (1.0f + ::expf(-params[0] * value));
+        }
+
+        template<SimdMathFunctionType type> void MathFunction32f(const float * src, size_t size, const float * params, float * dst)
+        {
+            MathFunction32fParallel(src, size, dst, [params](const float * src, size_t size, float * dst)
+            {
+                for (size_t i = 0; i < size; ++i)
+                    dst[i] = MathFunction<type>(src[i], params);
+            });
+        }
+
+        void MathFunction32f(const float * src, size_t size, SimdMathFunctionType type, const float * params, SimdMathAccuracyType accuracy, float * dst)
+        {
+            switch (type)
+            {
+            case SimdMathFunctionExp: MathFunction32f<SimdMathFunctionExp>(src, size, params, dst); break;
+            case SimdMathFunctionLog: MathFunction32f<SimdMathFunctionLog>(src, size, params, dst); break;
+            case SimdMathFunctionPow: MathFunction32f<SimdMathFunctionPow>(src, size, params, dst); break;
+            case SimdMathFunctionSigmoid: MathFunction32f<SimdMathFunctionSigmoid>(src, size, params, dst); break;
+            case SimdMathFunctionTanh: MathFunction32f<SimdMathFunctionTanh>(src, size, params, dst); break;
+            case SimdMathFunctionGelu: MathFunction32f<SimdMathFunctionGelu>(src, size, params, dst); break;
+            case SimdMathFunctionErf: MathFunction32f<SimdMathFunctionErf>(src, size, params, dst); break;
+            case SimdMathFunctionSwish: MathFunction32f<SimdMathFunctionSwish>(src, size, params, dst); break;
+            default:
+                assert(0);
+            }
+        }
+    }
+}
@@ -57,13 +57,13 @@ namespace Simd
             };
         }
 
-        void EstimateAlphaIndex(size_t srcSize, size_t dstSize, int * indexes, int * alphas, size_t channelCount)
+        void EstimateAlphaIndex(size_t srcSize, size_t dstSize, int * indexes, int * alphas, size_t channelCount, float site)
         {
             float scale = (float)srcSize / dstSize;
 
             for (size_t i = 0; i < dstSize; ++i)
             {
-                float alpha = (float)((i + 0.5)*scale - 0.5);
+                float alpha = (float)((i + (double)site)*scale - site);
                 ptrdiff_t index = (ptrdiff_t)::floor(alpha);
                 alpha -= index;
 
@@ -88,9 +88,9 @@ namespace Simd
             }
         }
 
-        void ResizeBilinear(
+        void ResizeBilinearRows(
             const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
-            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
+            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount, float siteX, size_t dstRowBeg, size_t dstRowEnd)
         {
             assert(channelCount >= 1 && channelCount <= 4);
 
@@ -98,13 +98,14 @@ namespace Simd
 
             Buffer buffer(dstRowSize, dstHeight);
 
-            EstimateAlphaIndex(srcHeight, dstHeight, buffer.iy, buffer.ay, 1);
+            EstimateAlphaIndex(srcHeight, dstHeight, buffer.iy, buffer.ay, 1, 0.5f);
 
-            EstimateAlphaIndex(srcWidth, dstWidth, buffer.ix, buffer.ax, channelCount);
+            EstimateAlphaIndex(srcWidth, dstWidth, buffer.ix, buffer.ax, channelCount, siteX);
 
             ptrdiff_t previous = -2;
 
-            for (size_t yDst = 0; yDst < dstHeight; yDst++, dst += dstStride)
+            dst += dstRowBeg*dstStride;
+            for (size_t yDst = dstRowBeg; yDst < dstRowEnd; yDst++, dst += dstStride)
             {
                 int fy = buffer.ay[yDst];
                 ptrdiff_t sy = buffer.iy[yDst];
@@ -149,6 +150,13 @@ namespace Simd
                 }
             }
         }
+
+        void ResizeBilinear(
+            const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
+        {
+            ResizeBilinearRows(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount, 0.5f, 0, dstHeight);
+        }
     }
 }
 
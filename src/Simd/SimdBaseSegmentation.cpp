@@ -22,6 +22,11 @@
 * SOFTWARE.
 */
 #include "Simd/SimdDefs.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdCompare.h"
+#include "Simd/SimdSegmentation.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
 
 namespace Simd
 {
@@ -191,5 +196,216 @@ namespace Simd
                 }
             }
         }
+
+        namespace Ccl
+        {
+            const size_t STRIP = 64;
+
+            SIMD_INLINE uint32_t Find(uint32_t * parent, uint32_t i)
+            {
+                while (parent[i] != i)
+                {
+                    parent[i] = parent[parent[i]];
+                    i = parent[i];
+                }
+                return i;
+            }
+
+            SIMD_INLINE void Union(uint32_t * parent, uint32_t a, uint32_t b)
+            {
+                a = Find(parent, a);
+                b = Find(parent, b);
+                if (a < b)
+                    parent[b] = a;
+                else if (b < a)
+                    parent[a] = b;
+            }
+
+            SIMD_INLINE void LinkRows(const uint32_t * runs, uint32_t * parent, uint32_t prev, uint32_t prevEnd, uint32_t curr, uint32_t currEnd, uint32_t gap)
+            {
+                while (prev < prevEnd && curr < currEnd)
+                {
+                    const uint32_t * p = runs + 2 * prev;
+                    const uint32_t * c = runs + 2 * curr;
+                    if (p[0] < c[1] + gap && c[0] < p[1] + gap)
+                        Union(parent, prev, curr);
+                    if (p[1] < c[1])
+                        prev++;
+                    else
+                        curr++;
+                }
+            }
+
+            struct Strip
+            {
+                std::vector<uint32_t> runs, parent;
+            };
+        }
+
+        size_t SegmentationLabelComponents(const uint8_t * mask, size_t maskStride, size_t width, size_t height, uint8_t value, int connectivity,
+            uint32_t * labels, size_t labelsStride, SimdConnectedComponent * components, size_t capacity, SegmentationRowEdgesPtr rowEdges)
+        {
+            assert(connectivity == 4 || connectivity == 8);
+
+            const uint32_t gap = connectivity == 8 ? 1 : 0;
+            const size_t stripNumber = (height + Ccl::STRIP - 1) / Ccl::STRIP;
+            const size_t threadNumber = stripNumber > 1 ? GetThreadNumber() : 1;
+            std::vector<Ccl::Strip> strips(stripNumber);
+            std::vector<uint32_t> rowRuns(height + 1);
+
+            Parallel(0, stripNumber, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t s = begin; s < end; ++s)
+                {
+                    Ccl::Strip & strip = strips[s];
+                    size_t yBeg = s * Ccl::STRIP, yEnd = Simd::Min(yBeg + Ccl::STRIP, height), used = 0;
+                    for (size_t y = yBeg; y < yEnd; ++y)
+                    {
+                        if (strip.runs.size() < used + width + 2)
+                            strip.runs.resize(Simd::Max(strip.runs.size() * 2, used + width + 2));
+                        rowRuns[y] = uint32_t(used / 2);
+                        used += rowEdges(mask + y * maskStride, width, value, strip.runs.data() + used);
+                    }
+                    uint32_t count = uint32_t(used / 2);
+                    strip.runs.resize(used);
+                    strip.parent.resize(count);
+                    for (uint32_t i = 0; i < count; ++i)
+                        strip.parent[i] = i;
+                    for (size_t y = yBeg + 1; y < yEnd; ++y)
+                        Ccl::LinkRows(strip.runs.data(), strip.parent.data(), rowRuns[y - 1], rowRuns[y], rowRuns[y], y + 1 < yEnd ? rowRuns[y + 1] : count, gap);
+                }
+            }, threadNumber);
+
+            size_t total = 0;
+            for (size_t s = 0; s < stripNumber; ++s)
+                total += strips[s].parent.size();
+            std::vector<uint32_t> runs(total * 2), parent(total);
+            for (size_t s = 0, base = 0; s < stripNumber; ++s)
+            {
+                const Ccl::Strip & strip = strips[s];
+                std::copy(strip.runs.begin(), strip.runs.end(), runs.begin() + base * 2);
+                for (size_t i = 0; i < strip.parent.size(); ++i)
+                    parent[base + i] = uint32_t(base + strip.parent[i]);
+                for (size_t y = s * Ccl::STRIP, yEnd = Simd::Min(y + Ccl::STRIP, height); y < yEnd; ++y)
+                    rowRuns[y] += uint32_t(base);
+                base += strip.parent.size();
+            }
+            rowRuns[height] = uint32_t(total);
+            strips.clear();
+
+            for (size_t s = 1; s < stripNumber; ++s)
+            {
+                size_t y = s * Ccl::STRIP;
+                Ccl::LinkRows(runs.data(), parent.data(), rowRuns[y - 1], rowRuns[y], rowRuns[y], rowRuns[y + 1], gap);
+            }
+
+            std::vector<uint32_t> label(total);
+            uint32_t number = 0;
+            for (uint32_t i = 0; i < total; ++i)
+            {
+                uint32_t root = Ccl::Find(parent.data(), i);
+                label[i] = root == i ? ++number : label[root];
+            }
+
+            if (components && capacity)
+            {
+                size_t size = Simd::Min<size_t>(number, capacity);
+                std::vector<double> sums(size * 2, 0.0);
+                for (size_t i = 0; i < size; ++i)
+                {
+                    SimdConnectedComponent & c = components[i];
+                    c.area = 0;
+                    c.left = width;
+                    c.top = height;
+                    c.right = 0;
+                    c.bottom = 0;
+                }
+                for (size_t y = 0; y < height; ++y)
+                {
+                    for (size_t i = rowRuns[y], iEnd = rowRuns[y + 1]; i < iEnd; ++i)
+                    {
+                        size_t l = label[i] - 1;
+                        if (l >= size)
+                            continue;
+                        SimdConnectedComponent & c = components[l];
+                        ptrdiff_t b = runs[2 * i + 0], e = runs[2 * i + 1], n = e - b;
+                        c.area += n;
+                        c.left = Simd::Min(c.left, b);
+                        c.right = Simd::Max(c.right, e);
+                        c.top = Simd::Min(c.top, (ptrdiff_t)y);
+                        c.bottom = (ptrdiff_t)y + 1;
+                        sums[2 * l + 0] += double(b + e - 1) * n * 0.5;
+                        sums[2 * l + 1] += double(y) * n;
+                    }
+                }
+                for (size_t i = 0; i < size; ++i)
+                {
+                    SimdConnectedComponent & c = components[i];
+                    c.x = float(sums[2 * i + 0] / c.area);
+                    c.y = float(sums[2 * i + 1] / c.area);
+                }
+            }
+
+            if (labels)
+            {
+                Parallel(0, stripNumber, [&](size_t thread, size_t begin, size_t end)
+                {
+                    for (size_t y = begin * Ccl::STRIP, yEnd = Simd::Min(end * Ccl::STRIP, height); y < yEnd; ++y)
+                    {
+                        uint32_t * dst = (uint32_t*)((uint8_t*)labels + y * labelsStride);
+                        size_t col = 0;
+                        for (size_t i = rowRuns[y], iEnd = rowRuns[y + 1]; i < iEnd; ++i)
+                        {
+                            size_t b = runs[2 * i + 0], e = runs[2 * i + 1];
+                            for (; col < b; ++col)
+                                dst[col] = 0;
+                            for (uint32_t l = label[i]; col < e; ++col)
+                                dst[col] = l;
+                        }
+                        for (; col < width; ++col)
+                            dst[col] = 0;
+                    }
+                }, threadNumber);
+            }
+
+            return number;
+        }
+
+        template<SimdCompareType compareType> size_t SegmentationRowEdges(const uint8_t * mask, size_t width, uint8_t value, uint32_t * edges)
+        {
+            size_t count = 0;
+            bool last = false;
+            for (size_t col = 0; col < width; ++col)
+            {
+                bool curr = Compare8u<compareType>(mask[col], value);
+                if (curr != last)
+                {
+                    edges[count++] = (uint32_t)col;
+                    last = curr;
+                }
+            }
+            if (last)
+                edges[count++] = (uint32_t)width;
+            return count;
+        }
+
+        size_t SegmentationLabelComponents(const uint8_t * mask, size_t maskStride, size_t width, size_t height, SimdCompareType compareType, uint8_t value,
+            int connectivity, uint32_t * labels, size_t labelsStride, SimdConnectedComponent * components, size_t capacity)
+        {
+            SegmentationRowEdgesPtr rowEdges = NULL;
+            switch (compareType)
+            {
+            case SimdCompareEqual: rowEdges = SegmentationRowEdges<SimdCompareEqual>; break;
+            case SimdCompareNotEqual: rowEdges = SegmentationRowEdges<SimdCompareNotEqual>; break;
+            case SimdCompareGreater: rowEdges = SegmentationRowEdges<SimdCompareGreater>; break;
+            case SimdCompareGreaterOrEqual: rowEdges = SegmentationRowEdges<SimdCompareGreaterOrEqual>; break;
+            case SimdCompareLesser: rowEdges = SegmentationRowEdges<SimdCompareLesser>; break;
+            case SimdCompareLesserOrEqual: rowEdges = SegmentationRowEdges<SimdCompareLesserOrEqual>; break;
+            default:
+                assert(0);
+                return 0;
+            }
+            return SegmentationLabelComponents(mask, maskStride, width, height, value, connectivity, labels, labelsStride, components, capacity, rowEdges);
+        }
     }
 }
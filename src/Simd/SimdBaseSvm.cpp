@@ -22,6 +22,11 @@
 * SOFTWARE.
 */
 #include "Simd/SimdMemory.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdMathFunction.h"
+#include "Simd/SimdSvm.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -64,5 +69,166 @@ namespace Simd
             for (size_t i = 0; i < count; ++i)
                 *sum += buffer.sums[i] * weights[i];
         }
+
+        Svm::Svm(const float * svs, const float * weights, size_t length, size_t count, const float * bias, SimdSvmKernelType kernel, const float * params)
+            : _gemm(Base::Gemm32fNN)
+            , _productSum(Base::NeuralProductSum)
+            , _mathFunction(Base::MathFunction32f)
+            , _length(length)
+            , _count(count)
+            , _kernel(kernel)
+            , _gamma(1.0f)
+            , _coef0(0.0f)
+            , _bias(bias ? bias[0] : 0.0f)
+            , _degree(1)
+        {
+            if (_kernel != SimdSvmKernelLinear)
+                _gamma = params[0];
+            if (_kernel == SimdSvmKernelPolynomial || _kernel == SimdSvmKernelSigmoid)
+                _coef0 = params[1];
+            if (_kernel == SimdSvmKernelPolynomial)
+                _degree = size_t(params[2] + 0.5f);
+            if (_kernel == SimdSvmKernelLinear)
+            {
+                _weights.Resize(_length, true);
+                for (size_t i = 0; i < _count; ++i)
+                    for (size_t j = 0; j < _length; ++j)
+                        _weights[j] += weights[i] * svs[i * _length + j];
+            }
+            else
+            {
+                _weights.Resize(_count);
+                memcpy(_weights.data, weights, _count * sizeof(float));
+                _svs.Resize(_length * _count);
+                for (size_t i = 0; i < _count; ++i)
+                    for (size_t j = 0; j < _length; ++j)
+                        _svs[j * _count + i] = svs[i * _length + j];
+                if (_kernel == SimdSvmKernelRbf)
+                {
+                    _norms.Resize(_count);
+                    for (size_t i = 0; i < _count; ++i)
+                    {
+                        const float * sv = svs + i * _length;
+                        float sum = 0;
+                        for (size_t j = 0; j < _length; ++j)
+                            sum += sv[j] * sv[j];
+                        _norms[i] = sum;
+                    }
+                }
+            }
+        }
+
+        void Svm::Predict(const float * samples, size_t number, float * decisions) const
+        {
+            if (_kernel == SimdSvmKernelLinear)
+            {
+                size_t threadNumber = number * _length < 64 * 1024 ? 1 : GetThreadNumber();
+                Parallel(0, number, [&](size_t thread, size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        _productSum(samples + i * _length, _weights.data, _length, decisions + i);
+                        decisions[i] += _bias;
+                    }
+                }, threadNumber);
+            }
+            else
+            {
+                const size_t GEMM_THREAD_SIZE_MIN = 256 * 256 * 256 * 2;
+                size_t batch = Simd::RestrictRange<size_t>(64 * 1024 / _count, 1, 256);
+                size_t threadNumber = number * _count * _length < GEMM_THREAD_SIZE_MIN ? 1 : GetThreadNumber();
+                if (threadNumber > 1)
+                {
+                    // Every thread calls GEMM for its own batch: keep it small enough to be single-threaded.
+                    size_t batchMax = (GEMM_THREAD_SIZE_MIN - 1) / (_count * _length);
+                    if (batchMax)
+                        batch = Simd::Min(batch, batchMax);
+                    else
+                        threadNumber = 1;
+                }
+                Parallel(0, number, [&](size_t thread, size_t begin, size_t end)
+                {
+                    Array32f buffer(batch * _count);
+                    for (size_t i = begin; i < end; i += batch)
+                    {
+                        size_t size = Simd::Min(batch, end - i);
+                        PredictKernel(samples + i * _length, size, buffer.data, decisions + i, threadNumber > 1);
+                    }
+                }, threadNumber, batch);
+            }
+        }
+
+        void Svm::PredictKernel(const float * samples, size_t number, float * buffer, float * decisions, bool nested) const
+        {
+            float alpha, beta = 1.0f;
+            if (_kernel == SimdSvmKernelRbf)
+            {
+                for (size_t i = 0; i < number; ++i)
+                {
+                    float norm;
+                    _productSum(samples + i * _length, samples + i * _length, _length, &norm);
+                    float * dst = buffer + i * _count;
+                    for (size_t j = 0; j < _count; ++j)
+                        dst[j] = -_gamma * (norm + _norms[j]);
+                }
+                alpha = 2.0f * _gamma;
+            }
+            else
+            {
+                for (size_t i = 0, size = number * _count; i < size; ++i)
+                    buffer[i] = _coef0;
+                alpha = _gamma;
+            }
+            _gemm(number, _count, _length, &alpha, samples, _length, _svs.data, _count, &beta, buffer, _count);
+            size_t size = number * _count;
+            if (_kernel == SimdSvmKernelRbf || _kernel == SimdSvmKernelSigmoid)
+            {
+                SimdMathFunctionType type = _kernel == SimdSvmKernelRbf ? SimdMathFunctionExp : SimdMathFunctionTanh;
+                // MathFunction32f does not start threads for parts of MATH_FUNCTION_THREAD_SIZE_MIN.
+                size_t part = nested ? MATH_FUNCTION_THREAD_SIZE_MIN : size;
+                for (size_t i = 0; i < size; i += part)
+                    _mathFunction(buffer + i, Simd::Min(part, size - i), type, NULL, SimdMathAccuracyPrecise, buffer + i);
+            }
+            else if (_degree > 1)
+            {
+                for (size_t i = 0; i < size; ++i)
+                {
+                    float value = buffer[i], power = value;
+                    for (size_t d = 1; d < _degree; ++d)
+                        power *= value;
+                    buffer[i] = power;
+                }
+            }
+            for (size_t i = 0; i < number; ++i)
+            {
+                _productSum(buffer + i * _count, _weights.data, _count, decisions + i);
+                decisions[i] += _bias;
+            }
+        }
+
+        bool SvmValid(const float * svs, const float * weights, size_t length, size_t count, SimdSvmKernelType kernel, const float * params)
+        {
+            if (svs == NULL || weights == NULL || length == 0 || count == 0)
+                return false;
+            switch (kernel)
+            {
+            case SimdSvmKernelLinear:
+                return true;
+            case SimdSvmKernelPolynomial:
+                return params != NULL && params[2] >= 0.5f;
+            case SimdSvmKernelRbf:
+            case SimdSvmKernelSigmoid:
+                return params != NULL;
+            default:
+                return false;
+            }
+        }
+
+        void * SvmInit(const float * svs, const float * weights, size_t length, size_t count, const float * bias, SimdSvmKernelType kernel, const float * params)
+        {
+            if (!SvmValid(svs, weights, length, count, kernel, params))
+                return NULL;
+            return new Svm(svs, weights, length, count, bias, kernel, params);
+        }
     }
 }
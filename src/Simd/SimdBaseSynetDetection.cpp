@@ -0,0 +1,154 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdArray.h"
+#include "Simd/SimdSynet.h"
+
+#include <vector>
+#include <algorithm>
+
+namespace Simd
+{
+    namespace Base
+    {
+        void SynetDetectionDecode32f(const float * loc, const float * prior, size_t count, float * dst)
+        {
+            const float * variance = prior + count * 4;
+            for (size_t i = 0; i < count; ++i)
+            {
+                float priorW = prior[2] - prior[0];
+                float priorH = prior[3] - prior[1];
+                float priorX = (prior[0] + prior[2]) * 0.5f;
+                float priorY = (prior[1] + prior[3]) * 0.5f;
+                float centerX = variance[0] * loc[0] * priorW + priorX;
+                float centerY = variance[1] * loc[1] * priorH + priorY;
+                float halfW = ::exp(variance[2] * loc[2]) * priorW * 0.5f;
+                float halfH = ::exp(variance[3] * loc[3]) * priorH * 0.5f;
+                dst[0] = centerX - halfW;
+                dst[1] = centerY - halfH;
+                dst[2] = centerX + halfW;
+                dst[3] = centerY + halfH;
+                loc += 4;
+                prior += 4;
+                variance += 4;
+                dst += 4;
+            }
+        }
+
+        void SynetDetectionSuppress(const float * boxes, size_t current, size_t end, float threshold, uint32_t * suppressed)
+        {
+            SynetDetectionSuppress(boxes, current, current + 1, end, threshold, suppressed);
+        }
+
+        namespace
+        {
+            struct Candidate
+            {
+                float score;
+                uint32_t index, label;
+
+                SIMD_INLINE Candidate(float s, size_t i, size_t l)
+                    : score(s), index((uint32_t)i), label((uint32_t)l)
+                {
+                }
+
+                SIMD_INLINE bool operator < (const Candidate & other) const
+                {
+                    return score > other.score || (score == other.score && (index < other.index || (index == other.index && label < other.label)));
+                }
+            };
+            typedef std::vector<Candidate> Candidates;
+        }
+
+        size_t SynetDetectionNms32f(const float * boxes, const float * scores, size_t count, size_t classes, ptrdiff_t background, float scoreThreshold,
+            float nmsThreshold, size_t topK, size_t keepTopK, SimdBool classAware, float * dst, SynetDetectionSuppressPtr suppress)
+        {
+            Candidates candidates, kept;
+            candidates.reserve(count);
+            Array32f buffer;
+            Array32i suppressed;
+            size_t groups = classAware ? classes : 1;
+            for (size_t g = 0; g < groups; ++g)
+            {
+                if (classAware && (ptrdiff_t)g == background)
+                    continue;
+                size_t beg = classAware ? g : 0, end = classAware ? g + 1 : classes;
+                candidates.clear();
+                for (size_t i = 0; i < count; ++i)
+                {
+                    const float * score = scores + i * classes;
+                    for (size_t c = beg; c < end; ++c)
+                        if (score[c] > scoreThreshold && (ptrdiff_t)c != background)
+                            candidates.push_back(Candidate(score[c], i, c));
+                }
+                std::sort(candidates.begin(), candidates.end());
+                if (topK && candidates.size() > topK)
+                    candidates.erase(candidates.begin() + topK, candidates.end());
+
+                size_t size = candidates.size();
+                buffer.Resize(size * 5);
+                suppressed.Resize(size);
+                float * xMin = buffer.data, * yMin = xMin + size, * xMax = yMin + size, * yMax = xMax + size, * area = yMax + size;
+                for (size_t i = 0; i < size; ++i)
+                {
+                    const float * box = boxes + candidates[i].index * 4;
+                    xMin[i] = box[0];
+                    yMin[i] = box[1];
+                    xMax[i] = box[2];
+                    yMax[i] = box[3];
+                    area[i] = Simd::Max(box[2] - box[0], 0.0f) * Simd::Max(box[3] - box[1], 0.0f);
+                    suppressed[i] = 0;
+                }
+                for (size_t i = 0; i < size; ++i)
+                {
+                    if (suppressed[i])
+                        continue;
+                    kept.push_back(candidates[i]);
+                    suppress(buffer.data, i, size, nmsThreshold, (uint32_t*)suppressed.data);
+                }
+            }
+
+            std::sort(kept.begin(), kept.end());
+            if (kept.size() > keepTopK)
+                kept.erase(kept.begin() + keepTopK, kept.end());
+            for (size_t i = 0; i < kept.size(); ++i)
+            {
+                const float * box = boxes + kept[i].index * 4;
+                dst[0] = (float)kept[i].label;
+                dst[1] = kept[i].score;
+                dst[2] = box[0];
+                dst[3] = box[1];
+                dst[4] = box[2];
+                dst[5] = box[3];
+                dst += 6;
+            }
+            return kept.size();
+        }
+
+        size_t SynetDetectionNms32f(const float * boxes, const float * scores, size_t count, size_t classes, ptrdiff_t background, float scoreThreshold,
+            float nmsThreshold, size_t topK, size_t keepTopK, SimdBool classAware, float * dst)
+        {
+            return SynetDetectionNms32f(boxes, scores, count, classes, background, scoreThreshold, nmsThreshold, topK, keepTopK, classAware, dst, SynetDetectionSuppress);
+        }
+    }
+}
@@ -0,0 +1,77 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE void BgrToYCoCgR(int blue, int green, int red, uint8_t * y, int16_t * co, int16_t * cg)
+        {
+            int _co = red - blue;
+            int t = blue + (_co >> 1);
+            int _cg = green - t;
+            *y = uint8_t(t + (_cg >> 1));
+            *co = int16_t(_co);
+            *cg = int16_t(_cg);
+        }
+
+        void BgrToYCoCgR(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * co, size_t coStride, uint8_t * cg, size_t cgStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                int16_t * pCo = (int16_t*)co, * pCg = (int16_t*)cg;
+                for (size_t col = 0, offset = 0; col < width; ++col, offset += 3)
+                    BgrToYCoCgR(bgr[offset + 0], bgr[offset + 1], bgr[offset + 2], y + col, pCo + col, pCg + col);
+                bgr += bgrStride;
+                y += yStride;
+                co += coStride;
+                cg += cgStride;
+            }
+        }
+
+        SIMD_INLINE void YCoCgRToBgr(int y, int co, int cg, uint8_t * bgr)
+        {
+            int t = y - (cg >> 1);
+            int blue = t - (co >> 1);
+            bgr[0] = RestrictRange(blue);
+            bgr[1] = RestrictRange(cg + t);
+            bgr[2] = RestrictRange(blue + co);
+        }
+
+        void YCoCgRToBgr(const uint8_t * y, size_t yStride, const uint8_t * co, size_t coStride, const uint8_t * cg, size_t cgStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                const int16_t * pCo = (const int16_t*)co, * pCg = (const int16_t*)cg;
+                for (size_t col = 0, offset = 0; col < width; ++col, offset += 3)
+                    YCoCgRToBgr(y[col], pCo[col], pCg[col], bgr + offset);
+                y += yStride;
+                co += coStride;
+                cg += cgStride;
+                bgr += bgrStride;
+            }
+        }
+    }
+}
@@ -0,0 +1,300 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdArray.h"
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        static void Uint16ToGray(const uint16_t * src, size_t width, size_t row, size_t shift, SimdBool dither, uint8_t * dst)
+        {
+            uint16_t levels[4];
+            Uint16ToGrayLevels(row, shift, dither == SimdTrue, levels);
+            for (size_t col = 0; col < width; ++col)
+                dst[col] = Uint16ToGray(src[col], levels[col & 3], shift);
+        }
+
+        void Uint16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, size_t bitDepth, SimdBool dither, uint8_t * dst, size_t dstStride)
+        {
+            assert(bitDepth > 8 && bitDepth <= 16);
+
+            for (size_t row = 0; row < height; ++row)
+            {
+                Uint16ToGray((const uint16_t*)src, width, row, bitDepth - 8, dither, dst);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        void Uint16ToFloat32(const uint8_t * src, size_t width, size_t height, size_t srcStride, size_t bitDepth, uint8_t * dst, size_t dstStride)
+        {
+            assert(bitDepth > 8 && bitDepth <= 16);
+
+            float scale = 1.0f / float((1 << bitDepth) - 1);
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint16_t * s = (const uint16_t*)src;
+                float * d = (float*)dst;
+                for (size_t col = 0; col < width; ++col)
+                    d[col] = float(s[col]) * scale;
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE int ChangeBitDepth(int value, int shift, int max)
+        {
+            return shift < 0 ? value << -shift : Min((value + (1 << shift >> 1)) >> shift, max);
+        }
+
+        template<class S, class D> void ChangeBitDepth(const uint8_t * src, size_t width, size_t height, size_t srcStride, int shift, int max, uint8_t * dst, size_t dstStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                const S * s = (const S*)src;
+                D * d = (D*)dst;
+                for (size_t col = 0; col < width; ++col)
+                    d[col] = (D)ChangeBitDepth(s[col], shift, max);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        void ChangeBitDepth(const uint8_t * src, size_t width, size_t height, size_t srcStride, size_t srcBitDepth, size_t dstBitDepth, uint8_t * dst, size_t dstStride)
+        {
+            assert(srcBitDepth >= 8 && srcBitDepth <= 16 && dstBitDepth >= 8 && dstBitDepth <= 16);
+
+            int shift = int(srcBitDepth) - int(dstBitDepth), max = (1 << dstBitDepth) - 1;
+            if (srcBitDepth > 8)
+            {
+                if (dstBitDepth > 8)
+                    ChangeBitDepth<uint16_t, uint16_t>(src, width, height, srcStride, shift, max, dst, dstStride);
+                else
+                    ChangeBitDepth<uint16_t, uint8_t>(src, width, height, srcStride, shift, max, dst, dstStride);
+            }
+            else
+            {
+                if (dstBitDepth > 8)
+                    ChangeBitDepth<uint8_t, uint16_t>(src, width, height, srcStride, shift, max, dst, dstStride);
+                else
+                    ChangeBitDepth<uint8_t, uint8_t>(src, width, height, srcStride, shift, max, dst, dstStride);
+            }
+        }
+
+        template<class S, class D> void InterleaveUvBitDepth(const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, int shift, int max, uint8_t * uv, size_t uvStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                const S * su = (const S*)u, * sv = (const S*)v;
+                D * d = (D*)uv;
+                for (size_t col = 0; col < width; ++col)
+                {
+                    d[2 * col + 0] = (D)ChangeBitDepth(su[col], shift, max);
+                    d[2 * col + 1] = (D)ChangeBitDepth(sv[col], shift, max);
+                }
+                u += uStride;
+                v += vStride;
+                uv += uvStride;
+            }
+        }
+
+        void InterleaveUvBitDepth(const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height,
+            size_t srcBitDepth, size_t dstBitDepth, uint8_t * uv, size_t uvStride)
+        {
+            assert(srcBitDepth >= 8 && srcBitDepth <= 16 && dstBitDepth >= 8 && dstBitDepth <= 16);
+
+            int shift = int(srcBitDepth) - int(dstBitDepth), max = (1 << dstBitDepth) - 1;
+            if (srcBitDepth > 8)
+            {
+                if (dstBitDepth > 8)
+                    InterleaveUvBitDepth<uint16_t, uint16_t>(u, uStride, v, vStride, width, height, shift, max, uv, uvStride);
+                else
+                    InterleaveUvBitDepth<uint16_t, uint8_t>(u, uStride, v, vStride, width, height, shift, max, uv, uvStride);
+            }
+            else
+            {
+                if (dstBitDepth > 8)
+                    InterleaveUvBitDepth<uint8_t, uint16_t>(u, uStride, v, vStride, width, height, shift, max, uv, uvStride);
+                else
+                    InterleaveUvBitDepth<uint8_t, uint8_t>(u, uStride, v, vStride, width, height, shift, max, uv, uvStride);
+            }
+        }
+
+        template<class S, class D> void DeinterleaveUvBitDepth(const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            int shift, int max, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                const S * s = (const S*)uv;
+                D * du = (D*)u, * dv = (D*)v;
+                for (size_t col = 0; col < width; ++col)
+                {
+                    du[col] = (D)ChangeBitDepth(s[2 * col + 0], shift, max);
+                    dv[col] = (D)ChangeBitDepth(s[2 * col + 1], shift, max);
+                }
+                uv += uvStride;
+                u += uStride;
+                v += vStride;
+            }
+        }
+
+        void DeinterleaveUvBitDepth(const uint8_t * uv, size_t uvStride, size_t width, size_t height, size_t srcBitDepth, size_t dstBitDepth,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            assert(srcBitDepth >= 8 && srcBitDepth <= 16 && dstBitDepth >= 8 && dstBitDepth <= 16);
+
+            int shift = int(srcBitDepth) - int(dstBitDepth), max = (1 << dstBitDepth) - 1;
+            if (srcBitDepth > 8)
+            {
+                if (dstBitDepth > 8)
+                    DeinterleaveUvBitDepth<uint16_t, uint16_t>(uv, uvStride, width, height, shift, max, u, uStride, v, vStride);
+                else
+                    DeinterleaveUvBitDepth<uint16_t, uint8_t>(uv, uvStride, width, height, shift, max, u, uStride, v, vStride);
+            }
+            else
+            {
+                if (dstBitDepth > 8)
+                    DeinterleaveUvBitDepth<uint8_t, uint16_t>(uv, uvStride, width, height, shift, max, u, uStride, v, vStride);
+                else
+                    DeinterleaveUvBitDepth<uint8_t, uint8_t>(uv, uvStride, width, height, shift, max, u, uStride, v, vStride);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        struct Yuv16Buffer
+        {
+            Yuv16Buffer(size_t width, uint8_t * external)
+            {
+                if (external)
+                    y = external;
+                else
+                {
+                    _buffer.Resize(width * 3 + width / 2 * 2);
+                    y = _buffer.data;
+                }
+                uv = y + 2 * width;
+                u = uv + width;
+                v = u + width / 2;
+            }
+
+            uint8_t * y, * uv, * u, * v;
+        private:
+            Array8u _buffer;
+        };
+
+        size_t Yuv16BufferSize(size_t width, size_t align)
+        {
+            return AlignHi(width, align) * 3 + AlignHi(width / 2, align) * 2 + align;
+        }
+
+        static void Yuv420p16ToYuv420p(const uint8_t * y, size_t yStride, const uint8_t * u, const uint8_t * v,
+            size_t width, size_t row, size_t shift, SimdBool dither, Yuv16Buffer & buffer)
+        {
+            Uint16ToGray((const uint16_t*)y, width, row, shift, dither, buffer.y);
+            Uint16ToGray((const uint16_t*)(y + yStride), width, row + 1, shift, dither, buffer.y + width);
+            Uint16ToGray((const uint16_t*)u, width / 2, row / 2, shift, dither, buffer.u);
+            Uint16ToGray((const uint16_t*)v, width / 2, row / 2, shift, dither, buffer.v);
+        }
+
+        static void P016ToYuv420p(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t width, size_t row, SimdBool dither, Yuv16Buffer & buffer)
+        {
+            Uint16ToGray((const uint16_t*)y, width, row, 8, dither, buffer.y);
+            Uint16ToGray((const uint16_t*)(y + yStride), width, row + 1, 8, dither, buffer.y + width);
+            Uint16ToGray((const uint16_t*)uv, width, row / 2, 8, dither, buffer.uv);
+            DeinterleaveUv(buffer.uv, width, width / 2, 1, buffer.u, width / 2, buffer.v, width / 2);
+        }
+
+        void Yuv420p16ToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, size_t bitDepth, uint8_t * bgr, size_t bgrStride, SimdBool dither, SimdYuvType yuvType, uint8_t * buf)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && bitDepth > 8 && bitDepth <= 16);
+
+            Yuv16Buffer buffer(width, buf);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                Yuv420p16ToYuv420p(y, yStride, u, v, width, row, bitDepth - 8, dither, buffer);
+                Yuv420pToBgrV2(buffer.y, width, buffer.u, width / 2, buffer.v, width / 2, width, 2, bgr, bgrStride, yuvType);
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+                bgr += 2 * bgrStride;
+            }
+        }
+
+        void Yuv420p16ToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, size_t bitDepth, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdBool dither, SimdYuvType yuvType, uint8_t * buf)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && bitDepth > 8 && bitDepth <= 16);
+
+            Yuv16Buffer buffer(width, buf);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                Yuv420p16ToYuv420p(y, yStride, u, v, width, row, bitDepth - 8, dither, buffer);
+                Yuv420pToBgraV2(buffer.y, width, buffer.u, width / 2, buffer.v, width / 2, width, 2, bgra, bgraStride, alpha, yuvType);
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+                bgra += 2 * bgraStride;
+            }
+        }
+
+        void P016ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            uint8_t * bgr, size_t bgrStride, SimdBool dither, SimdYuvType yuvType, uint8_t * buf)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+
+            Yuv16Buffer buffer(width, buf);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                P016ToYuv420p(y, yStride, uv, width, row, dither, buffer);
+                Yuv420pToBgrV2(buffer.y, width, buffer.u, width / 2, buffer.v, width / 2, width, 2, bgr, bgrStride, yuvType);
+                y += 2 * yStride;
+                uv += uvStride;
+                bgr += 2 * bgrStride;
+            }
+        }
+
+        void P016ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdBool dither, SimdYuvType yuvType, uint8_t * buf)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+
+            Yuv16Buffer buffer(width, buf);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                P016ToYuv420p(y, yStride, uv, width, row, dither, buffer);
+                Yuv420pToBgraV2(buffer.y, width, buffer.u, width / 2, buffer.v, width / 2, width, 2, bgra, bgraStride, alpha, yuvType);
+                y += 2 * yStride;
+                uv += uvStride;
+                bgra += 2 * bgraStride;
+            }
+        }
+    }
+}
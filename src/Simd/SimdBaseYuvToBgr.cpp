@@ -27,13 +27,13 @@ namespace Simd
 {
     namespace Base
     {
-        SIMD_INLINE void Yuv422pToBgr(const uint8_t *y, int u, int v, uint8_t * bgr)
+        template <class T = Bt601> SIMD_INLINE void Yuv422pToBgr(const uint8_t *y, int u, int v, uint8_t * bgr)
         {
-            YuvToBgr(y[0], u, v, bgr);
-            YuvToBgr(y[1], u, v, bgr + 3);
+            YuvToBgr<T>(y[0], u, v, bgr);
+            YuvToBgr<T>(y[1], u, v, bgr + 3);
         }
 
-        void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
@@ -44,8 +44,8 @@ namespace Simd
                 {
                     int u_ = u[colUV];
                     int v_ = v[colUV];
-                    Yuv422pToBgr(y + colY, u_, v_, bgr + colBgr);
-                    Yuv422pToBgr(y + yStride + colY, u_, v_, bgr + bgrStride + colBgr);
+                    Yuv422pToBgr<T>(y + colY, u_, v_, bgr + colBgr);
+                    Yuv422pToBgr<T>(y + yStride + colY, u_, v_, bgr + bgrStride + colBgr);
                 }
                 y += 2 * yStride;
                 u += uStride;
@@ -54,7 +54,34 @@ namespace Simd
             }
         }
 
-        void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Yuv420pToBgr<Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv420pToBgr<Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Yuv420pToBgr<Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Yuv420pToBgr<Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt601Full: Yuv420pToBgr<Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Yuv420pToBgr<Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Yuv420pToBgr<Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            default: assert(0);
+            }
+        }
+
+        void Yuv420pToRgb(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+        {
+            Yuv420pToBgr<Rgb<Bt601>>(y, yStride, v, vStride, u, uStride, width, height, rgb, rgbStride);
+        }
+
+        template <class T> void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             assert((width % 2 == 0) && (width >= 2));
@@ -62,7 +89,7 @@ namespace Simd
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t colUV = 0, colY = 0, colBgr = 0; colY < width; colY += 2, colUV++, colBgr += 6)
-                    Yuv422pToBgr(y + colY, u[colUV], v[colUV], bgr + colBgr);
+                    Yuv422pToBgr<T>(y + colY, u[colUV], v[colUV], bgr + colBgr);
                 y += yStride;
                 u += uStride;
                 v += vStride;
@@ -70,18 +97,134 @@ namespace Simd
             }
         }
 
-        void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Yuv422pToBgr<Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv422pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv422pToBgr<Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Yuv422pToBgr<Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Yuv422pToBgr<Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt601Full: Yuv422pToBgr<Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Yuv422pToBgr<Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Yuv422pToBgr<Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            default: assert(0);
+            }
+        }
+
+        void Yuv422pToRgb(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+        {
+            Yuv422pToBgr<Rgb<Bt601>>(y, yStride, v, vStride, u, uStride, width, height, rgb, rgbStride);
+        }
+
+        template <class T> void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t col = 0, colBgr = 0; col < width; col++, colBgr += 3)
-                    YuvToBgr(y[col], u[col], v[col], bgr + colBgr);
+                    YuvToBgr<T>(y[col], u[col], v[col], bgr + colBgr);
                 y += yStride;
                 u += uStride;
                 v += vStride;
                 bgr += bgrStride;
             }
         }
+
+        void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Yuv444pToBgr<Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv444pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv444pToBgr<Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Yuv444pToBgr<Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Yuv444pToBgr<Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt601Full: Yuv444pToBgr<Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Yuv444pToBgr<Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Yuv444pToBgr<Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            default: assert(0);
+            }
+        }
+
+        void Yuv444pToRgb(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+        {
+            Yuv444pToBgr<Rgb<Bt601>>(y, yStride, v, vStride, u, uStride, width, height, rgb, rgbStride);
+        }
+
+        template <bool nv21, class T> void Nv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
+
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0, colBgr = 0; colY < width; colY += 2, colBgr += 6)
+                {
+                    int u_ = uv[colY + (nv21 ? 1 : 0)];
+                    int v_ = uv[colY + (nv21 ? 0 : 1)];
+                    Yuv422pToBgr<T>(y + colY, u_, v_, bgr + colBgr);
+                    Yuv422pToBgr<T>(y + yStride + colY, u_, v_, bgr + bgrStride + colBgr);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                bgr += 2 * bgrStride;
+            }
+        }
+
+        void Nv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Nv12ToBgr<false, Bt601>(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+        }
+
+        void Nv12ToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToBgr<false, Bt601>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Nv12ToBgr<false, Bt709>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Nv12ToBgr<false, Bt2020>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt601Full: Nv12ToBgr<false, Bt601Full>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Nv12ToBgr<false, Bt709Full>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Nv12ToBgr<false, Bt2020Full>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            default: assert(0);
+            }
+        }
+
+        void Nv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Nv12ToBgr<true, Bt601>(y, yStride, vu, vuStride, width, height, bgr, bgrStride);
+        }
+
+        void Nv21ToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToBgr<true, Bt601>(y, yStride, vu, vuStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Nv12ToBgr<true, Bt709>(y, yStride, vu, vuStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Nv12ToBgr<true, Bt2020>(y, yStride, vu, vuStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt601Full: Nv12ToBgr<true, Bt601Full>(y, yStride, vu, vuStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Nv12ToBgr<true, Bt709Full>(y, yStride, vu, vuStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Nv12ToBgr<true, Bt2020Full>(y, yStride, vu, vuStride, width, height, bgr, bgrStride); break;
+            default: assert(0);
+            }
+        }
     }
 }
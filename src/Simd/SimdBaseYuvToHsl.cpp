@@ -27,18 +27,39 @@ namespace Simd
 {
     namespace Base
     {
-        void Yuv444pToHsl(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv444pToHsl(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * hsl, size_t hslStride)
         {
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t col = 0, colHsl = 0; col < width; col++, colHsl += 3)
-                    YuvToHsl(y[col], u[col], v[col], hsl + colHsl);
+                    YuvToHsl<T>(y[col], u[col], v[col], hsl + colHsl);
                 y += yStride;
                 u += uStride;
                 v += vStride;
                 hsl += hslStride;
             }
         }
+
+        void Yuv444pToHsl(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsl, size_t hslStride)
+        {
+            Yuv444pToHsl<Bt601>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride);
+        }
+
+        void Yuv444pToHslV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsl, size_t hslStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv444pToHsl<Bt601>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride); break;
+            case SimdYuvBt709: Yuv444pToHsl<Bt709>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride); break;
+            case SimdYuvBt2020: Yuv444pToHsl<Bt2020>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride); break;
+            case SimdYuvBt601Full: Yuv444pToHsl<Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride); break;
+            case SimdYuvBt709Full: Yuv444pToHsl<Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride); break;
+            case SimdYuvBt2020Full: Yuv444pToHsl<Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride); break;
+            default: assert(0);
+            }
+        }
     }
 }
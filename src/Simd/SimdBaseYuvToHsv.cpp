@@ -27,18 +27,39 @@ namespace Simd
 {
     namespace Base
     {
-        void Yuv444pToHsv(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv444pToHsv(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * hsv, size_t hsvStride)
         {
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t col = 0, colHsv = 0; col < width; col++, colHsv += 3)
-                    YuvToHsv(y[col], u[col], v[col], hsv + colHsv);
+                    YuvToHsv<T>(y[col], u[col], v[col], hsv + colHsv);
                 y += yStride;
                 u += uStride;
                 v += vStride;
                 hsv += hsvStride;
             }
         }
+
+        void Yuv444pToHsv(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsv, size_t hsvStride)
+        {
+            Yuv444pToHsv<Bt601>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride);
+        }
+
+        void Yuv444pToHsvV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsv, size_t hsvStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv444pToHsv<Bt601>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride); break;
+            case SimdYuvBt709: Yuv444pToHsv<Bt709>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride); break;
+            case SimdYuvBt2020: Yuv444pToHsv<Bt2020>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride); break;
+            case SimdYuvBt601Full: Yuv444pToHsv<Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride); break;
+            case SimdYuvBt709Full: Yuv444pToHsv<Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride); break;
+            case SimdYuvBt2020Full: Yuv444pToHsv<Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride); break;
+            default: assert(0);
+            }
+        }
     }
 }
@@ -27,11 +27,11 @@ namespace Simd
 {
     namespace Base
     {
-        SIMD_INLINE int YuvToHue(int y, int u, int v)
+        template <class T> SIMD_INLINE int YuvToHue(int y, int u, int v)
         {
-            int red = YuvToRed(y, v);
-            int green = YuvToGreen(y, u, v);
-            int blue = YuvToBlue(y, u);
+            int red = YuvToRed<T>(y, v);
+            int green = YuvToGreen<T>(y, u, v);
+            int blue = YuvToBlue<T>(y, u);
 
             int max = Max(red, Max(green, blue));
             int min = Min(red, Min(green, blue));
@@ -57,7 +57,7 @@ namespace Simd
             return 0;
         }
 
-        void Yuv420pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv420pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * hue, size_t hueStride)
         {
             assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
@@ -68,10 +68,10 @@ namespace Simd
                 {
                     int u_ = u[col1];
                     int v_ = v[col1];
-                    hue[col2] = YuvToHue(y[col2], u_, v_);
-                    hue[col2 + 1] = YuvToHue(y[col2 + 1], u_, v_);
-                    hue[col2 + hueStride] = YuvToHue(y[col2 + yStride], u_, v_);
-                    hue[col2 + hueStride + 1] = YuvToHue(y[col2 + yStride + 1], u_, v_);
+                    hue[col2] = YuvToHue<T>(y[col2], u_, v_);
+                    hue[col2 + 1] = YuvToHue<T>(y[col2 + 1], u_, v_);
+                    hue[col2 + hueStride] = YuvToHue<T>(y[col2 + yStride], u_, v_);
+                    hue[col2 + hueStride + 1] = YuvToHue<T>(y[col2 + yStride + 1], u_, v_);
                 }
                 y += 2 * yStride;
                 u += uStride;
@@ -80,14 +80,35 @@ namespace Simd
             }
         }
 
-        void Yuv444pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        void Yuv420pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride)
+        {
+            Yuv420pToHue<Bt601>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+        }
+
+        void Yuv420pToHueV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv420pToHue<Bt601>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709: Yuv420pToHue<Bt709>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020: Yuv420pToHue<Bt2020>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt601Full: Yuv420pToHue<Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709Full: Yuv420pToHue<Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020Full: Yuv420pToHue<Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            default: assert(0);
+            }
+        }
+
+        template <class T> void Yuv444pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * hue, size_t hueStride)
         {
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t col = 0; col < width; ++col)
                 {
-                    hue[col] = YuvToHue(y[col], u[col], v[col]);
+                    hue[col] = YuvToHue<T>(y[col], u[col], v[col]);
                 }
                 y += yStride;
                 u += uStride;
@@ -95,5 +116,90 @@ namespace Simd
                 hue += hueStride;
             }
         }
+
+        void Yuv444pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride)
+        {
+            Yuv444pToHue<Bt601>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+        }
+
+        void Yuv444pToHueV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv444pToHue<Bt601>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709: Yuv444pToHue<Bt709>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020: Yuv444pToHue<Bt2020>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt601Full: Yuv444pToHue<Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709Full: Yuv444pToHue<Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020Full: Yuv444pToHue<Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            default: assert(0);
+            }
+        }
+
+        template <bool nv21, class T> void Nv12ToHue(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
+
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0; col < width; col += 2)
+                {
+                    int u_ = uv[col + (nv21 ? 1 : 0)];
+                    int v_ = uv[col + (nv21 ? 0 : 1)];
+                    hue[col] = YuvToHue<T>(y[col], u_, v_);
+                    hue[col + 1] = YuvToHue<T>(y[col + 1], u_, v_);
+                    hue[col + hueStride] = YuvToHue<T>(y[col + yStride], u_, v_);
+                    hue[col + hueStride + 1] = YuvToHue<T>(y[col + yStride + 1], u_, v_);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                hue += 2 * hueStride;
+            }
+        }
+
+        void Nv12ToHue(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride)
+        {
+            Nv12ToHue<false, Bt601>(y, yStride, uv, uvStride, width, height, hue, hueStride);
+        }
+
+        void Nv12ToHueV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToHue<false, Bt601>(y, yStride, uv, uvStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709: Nv12ToHue<false, Bt709>(y, yStride, uv, uvStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020: Nv12ToHue<false, Bt2020>(y, yStride, uv, uvStride, width, height, hue, hueStride); break;
+            case SimdYuvBt601Full: Nv12ToHue<false, Bt601Full>(y, yStride, uv, uvStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709Full: Nv12ToHue<false, Bt709Full>(y, yStride, uv, uvStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020Full: Nv12ToHue<false, Bt2020Full>(y, yStride, uv, uvStride, width, height, hue, hueStride); break;
+            default: assert(0);
+            }
+        }
+
+        void Nv21ToHue(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride)
+        {
+            Nv12ToHue<true, Bt601>(y, yStride, vu, vuStride, width, height, hue, hueStride);
+        }
+
+        void Nv21ToHueV2(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToHue<true, Bt601>(y, yStride, vu, vuStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709: Nv12ToHue<true, Bt709>(y, yStride, vu, vuStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020: Nv12ToHue<true, Bt2020>(y, yStride, vu, vuStride, width, height, hue, hueStride); break;
+            case SimdYuvBt601Full: Nv12ToHue<true, Bt601Full>(y, yStride, vu, vuStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709Full: Nv12ToHue<true, Bt709Full>(y, yStride, vu, vuStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020Full: Nv12ToHue<true, Bt2020Full>(y, yStride, vu, vuStride, width, height, hue, hueStride); break;
+            default: assert(0);
+            }
+        }
     }
 }
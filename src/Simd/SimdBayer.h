@@ -133,6 +133,104 @@ namespace Simd
             dst11[1] = BayerToGreen(src[3][col2], src[2][col3], src[3][col4], src[4][col3], src[3][col1], src[1][col3], src[3][col5], src[5][col3]);
             dst11[2] = src[3][col3];
         }
+
+        /* Malvar-He-Cutler demosaicing (high-quality linear interpolation with gradient correction by 5x5 kernels).
+           Every row of Bayer image contains green and one other color. The row info is a parity of green columns
+           and a flag that the other color is red. The image borders are extended with step 2 to keep Bayer pattern. */
+        SIMD_INLINE void BayerMhcRowInfo(SimdPixelFormatType bayerFormat, size_t row, size_t & greenOdd, bool & red)
+        {
+            bool odd = (row & 1) != 0;
+            greenOdd = (bayerFormat == SimdPixelFormatBayerRggb || bayerFormat == SimdPixelFormatBayerBggr) != odd ? 1 : 0;
+            red = (bayerFormat == SimdPixelFormatBayerGrbg || bayerFormat == SimdPixelFormatBayerRggb) != odd;
+        }
+
+        SIMD_INLINE ptrdiff_t BayerMhcReflect(ptrdiff_t index, ptrdiff_t size)
+        {
+            return index < 0 ? index + 2 : (index >= size ? index - 2 : index);
+        }
+
+        SIMD_INLINE void BayerMhcRows(const uint8_t * bayer, size_t height, size_t bayerStride, size_t row, const uint8_t * src[5])
+        {
+            for (ptrdiff_t i = 0; i < 5; ++i)
+                src[i] = bayer + BayerMhcReflect(row + i - 2, height) * bayerStride;
+        }
+
+        SIMD_INLINE void BayerMhc(const uint8_t * src[5], size_t col, size_t width, bool green, bool red, uint8_t bgr[3])
+        {
+            ptrdiff_t c0 = BayerMhcReflect(col - 2, width), c1 = BayerMhcReflect(col - 1, width);
+            ptrdiff_t c3 = BayerMhcReflect(col + 1, width), c4 = BayerMhcReflect(col + 2, width);
+            int center = src[2][col];
+            int vertical = src[1][col] + src[3][col];
+            int horizontal = src[2][c1] + src[2][c3];
+            int diagonal = src[1][c1] + src[1][c3] + src[3][c1] + src[3][c3];
+            int farVertical = src[0][col] + src[4][col];
+            int farHorizontal = src[2][c0] + src[2][c4];
+            int other, own;
+            if (green)
+            {
+                own = RestrictRange((10 * center + 8 * horizontal - 2 * (diagonal + farHorizontal) + farVertical + 8) >> 4);
+                bgr[1] = center;
+                other = RestrictRange((10 * center + 8 * vertical - 2 * (diagonal + farVertical) + farHorizontal + 8) >> 4);
+            }
+            else
+            {
+                own = center;
+                bgr[1] = RestrictRange((4 * center + 2 * (vertical + horizontal) - farVertical - farHorizontal + 4) >> 3);
+                other = RestrictRange((12 * center + 4 * diagonal - 3 * (farVertical + farHorizontal) + 8) >> 4);
+            }
+            bgr[red ? 2 : 0] = own;
+            bgr[red ? 0 : 2] = other;
+        }
+
+        template<size_t channels> SIMD_INLINE void BayerMhcStore(const uint8_t bgr[3], uint8_t alpha, uint8_t * dst);
+
+        template<> SIMD_INLINE void BayerMhcStore<1>(const uint8_t bgr[3], uint8_t alpha, uint8_t * dst)
+        {
+            dst[0] = (BLUE_TO_GRAY_WEIGHT * bgr[0] + GREEN_TO_GRAY_WEIGHT * bgr[1] + RED_TO_GRAY_WEIGHT * bgr[2] + BGR_TO_GRAY_ROUND_TERM) >> BGR_TO_GRAY_AVERAGING_SHIFT;
+        }
+
+        template<> SIMD_INLINE void BayerMhcStore<3>(const uint8_t bgr[3], uint8_t alpha, uint8_t * dst)
+        {
+            dst[0] = bgr[0];
+            dst[1] = bgr[1];
+            dst[2] = bgr[2];
+        }
+
+        template<> SIMD_INLINE void BayerMhcStore<4>(const uint8_t bgr[3], uint8_t alpha, uint8_t * dst)
+        {
+            dst[0] = bgr[0];
+            dst[1] = bgr[1];
+            dst[2] = bgr[2];
+            dst[3] = alpha;
+        }
+
+        template<size_t channels> SIMD_INLINE void BayerMhc(const uint8_t * src[5], size_t begin, size_t end, size_t width,
+            size_t greenOdd, bool red, uint8_t * dst, uint8_t alpha)
+        {
+            uint8_t bgr[3];
+            for (size_t col = begin; col < end; ++col)
+            {
+                BayerMhc(src, col, width, (col & 1) == greenOdd, red, bgr);
+                BayerMhcStore<channels>(bgr, alpha, dst + col * channels);
+            }
+        }
+
+        /* Indices of Bayer pattern colors in 2x2 quad (0 - top left, 1 - top right, 2 - bottom left, 3 - bottom right). */
+        template <SimdPixelFormatType bayerFormat> struct BayerHalf;
+
+        template <> struct BayerHalf<SimdPixelFormatBayerGrbg> { enum { B = 2, G0 = 0, G1 = 3, R = 1 }; };
+        template <> struct BayerHalf<SimdPixelFormatBayerGbrg> { enum { B = 1, G0 = 0, G1 = 3, R = 2 }; };
+        template <> struct BayerHalf<SimdPixelFormatBayerRggb> { enum { B = 3, G0 = 1, G1 = 2, R = 0 }; };
+        template <> struct BayerHalf<SimdPixelFormatBayerBggr> { enum { B = 0, G0 = 1, G1 = 2, R = 3 }; };
+
+        template <SimdPixelFormatType bayerFormat> SIMD_INLINE void BayerToBgrHalf(const uint8_t * src0, const uint8_t * src1, uint8_t * bgr)
+        {
+            typedef BayerHalf<bayerFormat> Half;
+            const uint8_t q[4] = { src0[0], src0[1], src1[0], src1[1] };
+            bgr[0] = q[Half::B];
+            bgr[1] = Average(q[Half::G0], q[Half::G1]);
+            bgr[2] = q[Half::R];
+        }
     }
 
 #ifdef SIMD_SSE2_ENABLE
@@ -236,6 +334,84 @@ namespace Simd
             d[4] = Merge16(Get<7, 0>(s), BayerToGreen(Get<7, 0>(s), Get<4, 1>(s), Get<8, 0>(s), Get<11, 0>(s), Get<6, 1>(s), Get<2, 0>(s), Get<8, 1>(s), Get<10, 1>(s)));
             d[5] = Merge16(_mm_avg_epu16(Get<6, 1>(s), Get<7, 1>(s)), Get<7, 1>(s));
         }
+
+        SIMD_INLINE void LoadBayerMhc(const uint8_t * src[5], size_t col, __m128i s[13])
+        {
+            s[0] = _mm_loadu_si128((__m128i*)(src[2] + col));
+            s[1] = _mm_loadu_si128((__m128i*)(src[1] + col));
+            s[2] = _mm_loadu_si128((__m128i*)(src[3] + col));
+            s[3] = _mm_loadu_si128((__m128i*)(src[2] + col - 1));
+            s[4] = _mm_loadu_si128((__m128i*)(src[2] + col + 1));
+            s[5] = _mm_loadu_si128((__m128i*)(src[1] + col - 1));
+            s[6] = _mm_loadu_si128((__m128i*)(src[1] + col + 1));
+            s[7] = _mm_loadu_si128((__m128i*)(src[3] + col - 1));
+            s[8] = _mm_loadu_si128((__m128i*)(src[3] + col + 1));
+            s[9] = _mm_loadu_si128((__m128i*)(src[0] + col));
+            s[10] = _mm_loadu_si128((__m128i*)(src[4] + col));
+            s[11] = _mm_loadu_si128((__m128i*)(src[2] + col - 2));
+            s[12] = _mm_loadu_si128((__m128i*)(src[2] + col + 2));
+        }
+
+        template<int part, bool green> SIMD_INLINE void BayerMhc(const __m128i s[13], __m128i dst[3])
+        {
+            __m128i center = U8To16<part>(s[0]);
+            __m128i vertical = _mm_add_epi16(U8To16<part>(s[1]), U8To16<part>(s[2]));
+            __m128i horizontal = _mm_add_epi16(U8To16<part>(s[3]), U8To16<part>(s[4]));
+            __m128i diagonal = _mm_add_epi16(_mm_add_epi16(U8To16<part>(s[5]), U8To16<part>(s[6])), _mm_add_epi16(U8To16<part>(s[7]), U8To16<part>(s[8])));
+            __m128i farVertical = _mm_add_epi16(U8To16<part>(s[9]), U8To16<part>(s[10]));
+            __m128i farHorizontal = _mm_add_epi16(U8To16<part>(s[11]), U8To16<part>(s[12]));
+            if (green)
+            {
+                __m128i center10 = _mm_add_epi16(_mm_slli_epi16(center, 3), _mm_slli_epi16(center, 1));
+                __m128i common = _mm_sub_epi16(_mm_add_epi16(center10, K16_0008), _mm_slli_epi16(diagonal, 1));
+                __m128i own = _mm_add_epi16(_mm_sub_epi16(_mm_slli_epi16(horizontal, 3), _mm_slli_epi16(farHorizontal, 1)), farVertical);
+                __m128i other = _mm_add_epi16(_mm_sub_epi16(_mm_slli_epi16(vertical, 3), _mm_slli_epi16(farVertical, 1)), farHorizontal);
+                dst[0] = _mm_srai_epi16(_mm_add_epi16(common, own), 4);
+                dst[1] = center;
+                dst[2] = _mm_srai_epi16(_mm_add_epi16(common, other), 4);
+            }
+            else
+            {
+                __m128i far = _mm_add_epi16(farVertical, farHorizontal);
+                __m128i green4 = _mm_slli_epi16(_mm_add_epi16(_mm_add_epi16(center, center), _mm_add_epi16(vertical, horizontal)), 1);
+                __m128i center12 = _mm_add_epi16(_mm_slli_epi16(center, 3), _mm_slli_epi16(center, 2));
+                __m128i other = _mm_add_epi16(_mm_add_epi16(center12, _mm_slli_epi16(diagonal, 2)), K16_0008);
+                dst[0] = center;
+                dst[1] = _mm_srai_epi16(_mm_sub_epi16(_mm_add_epi16(green4, K16_0004), far), 3);
+                dst[2] = _mm_srai_epi16(_mm_sub_epi16(other, _mm_add_epi16(_mm_add_epi16(far, far), far)), 4);
+            }
+        }
+
+        SIMD_INLINE __m128i BayerMhcPack(__m128i even, __m128i odd)
+        {
+            __m128i packed = _mm_packus_epi16(even, odd);
+            return _mm_unpacklo_epi8(packed, _mm_unpackhi_epi64(packed, packed));
+        }
+
+        template<bool greenOdd> SIMD_INLINE void BayerMhc(const uint8_t * src[5], size_t col, bool red, __m128i bgr[3])
+        {
+            __m128i s[13], even[3], odd[3];
+            LoadBayerMhc(src, col, s);
+            BayerMhc<0, !greenOdd>(s, even);
+            BayerMhc<1, greenOdd>(s, odd);
+            bgr[red ? 2 : 0] = BayerMhcPack(even[0], odd[0]);
+            bgr[1] = BayerMhcPack(even[1], odd[1]);
+            bgr[red ? 0 : 2] = BayerMhcPack(even[2], odd[2]);
+        }
+
+        template <SimdPixelFormatType bayerFormat> SIMD_INLINE void BayerToBgrHalf(const uint8_t * src0, const uint8_t * src1, __m128i bgr[3])
+        {
+            typedef Base::BayerHalf<bayerFormat> Half;
+            __m128i q[4], s00 = _mm_loadu_si128((__m128i*)src0 + 0), s01 = _mm_loadu_si128((__m128i*)src0 + 1);
+            __m128i s10 = _mm_loadu_si128((__m128i*)src1 + 0), s11 = _mm_loadu_si128((__m128i*)src1 + 1);
+            q[0] = _mm_packus_epi16(U8To16<0>(s00), U8To16<0>(s01));
+            q[1] = _mm_packus_epi16(U8To16<1>(s00), U8To16<1>(s01));
+            q[2] = _mm_packus_epi16(U8To16<0>(s10), U8To16<0>(s11));
+            q[3] = _mm_packus_epi16(U8To16<1>(s10), U8To16<1>(s11));
+            bgr[0] = q[Half::B];
+            bgr[1] = _mm_avg_epu8(q[Half::G0], q[Half::G1]);
+            bgr[2] = q[Half::R];
+        }
     }
 #endif//SIMD_SSE2_ENABLE
 
@@ -347,6 +523,84 @@ namespace Simd
             d[4] = Merge16(Get<7, 0>(s), BayerToGreen(Get<7, 0>(s), Get<4, 1>(s), Get<8, 0>(s), Get<11, 0>(s), Get<6, 1>(s), Get<2, 0>(s), Get<8, 1>(s), Get<10, 1>(s)));
             d[5] = Merge16(_mm256_avg_epu16(Get<6, 1>(s), Get<7, 1>(s)), Get<7, 1>(s));
         }
+
+        SIMD_INLINE void LoadBayerMhc(const uint8_t * src[5], size_t col, __m256i s[13])
+        {
+            s[0] = _mm256_loadu_si256((__m256i*)(src[2] + col));
+            s[1] = _mm256_loadu_si256((__m256i*)(src[1] + col));
+            s[2] = _mm256_loadu_si256((__m256i*)(src[3] + col));
+            s[3] = _mm256_loadu_si256((__m256i*)(src[2] + col - 1));
+            s[4] = _mm256_loadu_si256((__m256i*)(src[2] + col + 1));
+            s[5] = _mm256_loadu_si256((__m256i*)(src[1] + col - 1));
+            s[6] = _mm256_loadu_si256((__m256i*)(src[1] + col + 1));
+            s[7] = _mm256_loadu_si256((__m256i*)(src[3] + col - 1));
+            s[8] = _mm256_loadu_si256((__m256i*)(src[3] + col + 1));
+            s[9] = _mm256_loadu_si256((__m256i*)(src[0] + col));
+            s[10] = _mm256_loadu_si256((__m256i*)(src[4] + col));
+            s[11] = _mm256_loadu_si256((__m256i*)(src[2] + col - 2));
+            s[12] = _mm256_loadu_si256((__m256i*)(src[2] + col + 2));
+        }
+
+        template<int part, bool green> SIMD_INLINE void BayerMhc(const __m256i s[13], __m256i dst[3])
+        {
+            __m256i center = U8To16<part>(s[0]);
+            __m256i vertical = _mm256_add_epi16(U8To16<part>(s[1]), U8To16<part>(s[2]));
+            __m256i horizontal = _mm256_add_epi16(U8To16<part>(s[3]), U8To16<part>(s[4]));
+            __m256i diagonal = _mm256_add_epi16(_mm256_add_epi16(U8To16<part>(s[5]), U8To16<part>(s[6])), _mm256_add_epi16(U8To16<part>(s[7]), U8To16<part>(s[8])));
+            __m256i farVertical = _mm256_add_epi16(U8To16<part>(s[9]), U8To16<part>(s[10]));
+            __m256i farHorizontal = _mm256_add_epi16(U8To16<part>(s[11]), U8To16<part>(s[12]));
+            if (green)
+            {
+                __m256i center10 = _mm256_add_epi16(_mm256_slli_epi16(center, 3), _mm256_slli_epi16(center, 1));
+                __m256i common = _mm256_sub_epi16(_mm256_add_epi16(center10, K16_0008), _mm256_slli_epi16(diagonal, 1));
+                __m256i own = _mm256_add_epi16(_mm256_sub_epi16(_mm256_slli_epi16(horizontal, 3), _mm256_slli_epi16(farHorizontal, 1)), farVertical);
+                __m256i other = _mm256_add_epi16(_mm256_sub_epi16(_mm256_slli_epi16(vertical, 3), _mm256_slli_epi16(farVertical, 1)), farHorizontal);
+                dst[0] = _mm256_srai_epi16(_mm256_add_epi16(common, own), 4);
+                dst[1] = center;
+                dst[2] = _mm256_srai_epi16(_mm256_add_epi16(common, other), 4);
+            }
+            else
+            {
+                __m256i far = _mm256_add_epi16(farVertical, farHorizontal);
+                __m256i green4 = _mm256_slli_epi16(_mm256_add_epi16(_mm256_add_epi16(center, center), _mm256_add_epi16(vertical, horizontal)), 1);
+                __m256i center12 = _mm256_add_epi16(_mm256_slli_epi16(center, 3), _mm256_slli_epi16(center, 2));
+                __m256i other = _mm256_add_epi16(_mm256_add_epi16(center12, _mm256_slli_epi16(diagonal, 2)), K16_0008);
+                dst[0] = center;
+                dst[1] = _mm256_srai_epi16(_mm256_sub_epi16(_mm256_add_epi16(green4, K16_0004), far), 3);
+                dst[2] = _mm256_srai_epi16(_mm256_sub_epi16(other, _mm256_add_epi16(_mm256_add_epi16(far, far), far)), 4);
+            }
+        }
+
+        SIMD_INLINE __m256i BayerMhcPack(__m256i even, __m256i odd)
+        {
+            __m256i packed = _mm256_packus_epi16(even, odd);
+            return _mm256_unpacklo_epi8(packed, _mm256_unpackhi_epi64(packed, packed));
+        }
+
+        template<bool greenOdd> SIMD_INLINE void BayerMhc(const uint8_t * src[5], size_t col, bool red, __m256i bgr[3])
+        {
+            __m256i s[13], even[3], odd[3];
+            LoadBayerMhc(src, col, s);
+            BayerMhc<0, !greenOdd>(s, even);
+            BayerMhc<1, greenOdd>(s, odd);
+            bgr[red ? 2 : 0] = BayerMhcPack(even[0], odd[0]);
+            bgr[1] = BayerMhcPack(even[1], odd[1]);
+            bgr[red ? 0 : 2] = BayerMhcPack(even[2], odd[2]);
+        }
+
+        template <SimdPixelFormatType bayerFormat> SIMD_INLINE void BayerToBgrHalf(const uint8_t * src0, const uint8_t * src1, __m256i bgr[3])
+        {
+            typedef Base::BayerHalf<bayerFormat> Half;
+            __m256i q[4], s00 = _mm256_loadu_si256((__m256i*)src0 + 0), s01 = _mm256_loadu_si256((__m256i*)src0 + 1);
+            __m256i s10 = _mm256_loadu_si256((__m256i*)src1 + 0), s11 = _mm256_loadu_si256((__m256i*)src1 + 1);
+            q[0] = PackU16ToU8(U8To16<0>(s00), U8To16<0>(s01));
+            q[1] = PackU16ToU8(U8To16<1>(s00), U8To16<1>(s01));
+            q[2] = PackU16ToU8(U8To16<0>(s10), U8To16<0>(s11));
+            q[3] = PackU16ToU8(U8To16<1>(s10), U8To16<1>(s11));
+            bgr[0] = q[Half::B];
+            bgr[1] = _mm256_avg_epu8(q[Half::G0], q[Half::G1]);
+            bgr[2] = q[Half::R];
+        }
     }
 #endif//SIMD_AVX2_ENABLE
 
@@ -460,6 +714,89 @@ namespace Simd
             d[4] = Merge16(Get<7, 0>(s), BayerToGreen(Get<7, 0>(s), Get<4, 1>(s), Get<8, 0>(s), Get<11, 0>(s), Get<6, 1>(s), Get<2, 0>(s), Get<8, 1>(s), Get<10, 1>(s)));
             d[5] = Merge16(Average16(Get<6, 1>(s), Get<7, 1>(s)), Get<7, 1>(s));
         }
+
+        SIMD_INLINE void LoadBayerMhc(const uint8_t * src[5], size_t col, __m512i s[13])
+        {
+            s[0] = _mm512_loadu_si512((__m512i*)(src[2] + col));
+            s[1] = _mm512_loadu_si512((__m512i*)(src[1] + col));
+            s[2] = _mm512_loadu_si512((__m512i*)(src[3] + col));
+            s[3] = _mm512_loadu_si512((__m512i*)(src[2] + col - 1));
+            s[4] = _mm512_loadu_si512((__m512i*)(src[2] + col + 1));
+            s[5] = _mm512_loadu_si512((__m512i*)(src[1] + col - 1));
+            s[6] = _mm512_loadu_si512((__m512i*)(src[1] + col + 1));
+            s[7] = _mm512_loadu_si512((__m512i*)(src[3] + col - 1));
+            s[8] = _mm512_loadu_si512((__m512i*)(src[3] + col + 1));
+            s[9] = _mm512_loadu_si512((__m512i*)(src[0] + col));
+            s[10] = _mm512_loadu_si512((__m512i*)(src[4] + col));
+            s[11] = _mm512_loadu_si512((__m512i*)(src[2] + col - 2));
+            s[12] = _mm512_loadu_si512((__m512i*)(src[2] + col + 2));
+        }
+
+        template<int part, bool green> SIMD_INLINE void BayerMhc(const __m512i s[13], __m512i dst[3])
+        {
+            __m512i center = U8To16<part>(s[0]);
+            __m512i vertical = _mm512_add_epi16(U8To16<part>(s[1]), U8To16<part>(s[2]));
+            __m512i horizontal = _mm512_add_epi16(U8To16<part>(s[3]), U8To16<part>(s[4]));
+            __m512i diagonal = _mm512_add_epi16(_mm512_add_epi16(U8To16<part>(s[5]), U8To16<part>(s[6])), _mm512_add_epi16(U8To16<part>(s[7]), U8To16<part>(s[8])));
+            __m512i farVertical = _mm512_add_epi16(U8To16<part>(s[9]), U8To16<part>(s[10]));
+            __m512i farHorizontal = _mm512_add_epi16(U8To16<part>(s[11]), U8To16<part>(s[12]));
+            if (green)
+            {
+                __m512i center10 = _mm512_add_epi16(_mm512_slli_epi16(center, 3), _mm512_slli_epi16(center, 1));
+                __m512i common = _mm512_sub_epi16(_mm512_add_epi16(center10, K16_0008), _mm512_slli_epi16(diagonal, 1));
+                __m512i own = _mm512_add_epi16(_mm512_sub_epi16(_mm512_slli_epi16(horizontal, 3), _mm512_slli_epi16(farHorizontal, 1)), farVertical);
+                __m512i other = _mm512_add_epi16(_mm512_sub_epi16(_mm512_slli_epi16(vertical, 3), _mm512_slli_epi16(farVertical, 1)), farHorizontal);
+                dst[0] = _mm512_srai_epi16(_mm512_add_epi16(common, own), 4);
+                dst[1] = center;
+                dst[2] = _mm512_srai_epi16(_mm512_add_epi16(common, other), 4);
+            }
+            else
+            {
+                __m512i far = _mm512_add_epi16(farVertical, farHorizontal);
+                __m512i green4 = _mm512_slli_epi16(_mm512_add_epi16(_mm512_add_epi16(center, center), _mm512_add_epi16(vertical, horizontal)), 1);
+                __m512i center12 = _mm512_add_epi16(_mm512_slli_epi16(center, 3), _mm512_slli_epi16(center, 2));
+                __m512i other = _mm512_add_epi16(_mm512_add_epi16(center12, _mm512_slli_epi16(diagonal, 2)), K16_0008);
+                dst[0] = center;
+                dst[1] = _mm512_srai_epi16(_mm512_sub_epi16(_mm512_add_epi16(green4, K16_0004), far), 3);
+                dst[2] = _mm512_srai_epi16(_mm512_sub_epi16(other, _mm512_add_epi16(_mm512_add_epi16(far, far), far)), 4);
+            }
+        }
+
+        SIMD_INLINE __m512i BayerMhcPack(__m512i even, __m512i odd)
+        {
+            __m512i packed = _mm512_packus_epi16(even, odd);
+            return _mm512_unpacklo_epi8(packed, _mm512_unpackhi_epi64(packed, packed));
+        }
+
+        template<bool greenOdd> SIMD_INLINE void BayerMhc(const uint8_t * src[5], size_t col, bool red, __m512i bgr[3])
+        {
+            __m512i s[13], even[3], odd[3];
+            LoadBayerMhc(src, col, s);
+            BayerMhc<0, !greenOdd>(s, even);
+            BayerMhc<1, greenOdd>(s, odd);
+            bgr[red ? 2 : 0] = BayerMhcPack(even[0], odd[0]);
+            bgr[1] = BayerMhcPack(even[1], odd[1]);
+            bgr[red ? 0 : 2] = BayerMhcPack(even[2], odd[2]);
+        }
+
+        SIMD_INLINE __m512i BayerHalfPack(__m512i lo, __m512i hi)
+        {
+            return _mm512_permutexvar_epi64(K64_PERMUTE_FOR_PACK, _mm512_packus_epi16(lo, hi));
+        }
+
+        template <SimdPixelFormatType bayerFormat> SIMD_INLINE void BayerToBgrHalf(const uint8_t * src0, const uint8_t * src1, __m512i bgr[3])
+        {
+            typedef Base::BayerHalf<bayerFormat> Half;
+            __m512i q[4], s00 = _mm512_loadu_si512((__m512i*)src0 + 0), s01 = _mm512_loadu_si512((__m512i*)src0 + 1);
+            __m512i s10 = _mm512_loadu_si512((__m512i*)src1 + 0), s11 = _mm512_loadu_si512((__m512i*)src1 + 1);
+            q[0] = BayerHalfPack(U8To16<0>(s00), U8To16<0>(s01));
+            q[1] = BayerHalfPack(U8To16<1>(s00), U8To16<1>(s01));
+            q[2] = BayerHalfPack(U8To16<0>(s10), U8To16<0>(s11));
+            q[3] = BayerHalfPack(U8To16<1>(s10), U8To16<1>(s11));
+            bgr[0] = q[Half::B];
+            bgr[1] = _mm512_avg_epu8(q[Half::G0], q[Half::G1]);
+            bgr[2] = q[Half::R];
+        }
     }
 #endif//SIMD_AVX512BW_ENABLE
 
@@ -624,6 +961,86 @@ namespace Simd
             d[5].val[0] = Average(s[6].val[1], s[7].val[1]);
             d[5].val[1] = s[7].val[1];
         }
+
+        SIMD_INLINE void LoadBayerMhc(const uint8_t * src[5], size_t col, uint8x8x2_t s[13])
+        {
+            s[0] = LoadHalf2<false>(src[2] + col);
+            s[1] = LoadHalf2<false>(src[1] + col);
+            s[2] = LoadHalf2<false>(src[3] + col);
+            s[3] = LoadHalf2<false>(src[2] + col - 1);
+            s[4] = LoadHalf2<false>(src[2] + col + 1);
+            s[5] = LoadHalf2<false>(src[1] + col - 1);
+            s[6] = LoadHalf2<false>(src[1] + col + 1);
+            s[7] = LoadHalf2<false>(src[3] + col - 1);
+            s[8] = LoadHalf2<false>(src[3] + col + 1);
+            s[9] = LoadHalf2<false>(src[0] + col);
+            s[10] = LoadHalf2<false>(src[4] + col);
+            s[11] = LoadHalf2<false>(src[2] + col - 2);
+            s[12] = LoadHalf2<false>(src[2] + col + 2);
+        }
+
+        template<int part> SIMD_INLINE int16x8_t BayerMhcU8To16(const uint8x8x2_t & s)
+        {
+            return vreinterpretq_s16_u16(vmovl_u8(s.val[part]));
+        }
+
+        template<int part, bool green> SIMD_INLINE void BayerMhc(const uint8x8x2_t s[13], int16x8_t dst[3])
+        {
+            int16x8_t center = BayerMhcU8To16<part>(s[0]);
+            int16x8_t vertical = vaddq_s16(BayerMhcU8To16<part>(s[1]), BayerMhcU8To16<part>(s[2]));
+            int16x8_t horizontal = vaddq_s16(BayerMhcU8To16<part>(s[3]), BayerMhcU8To16<part>(s[4]));
+            int16x8_t diagonal = vaddq_s16(vaddq_s16(BayerMhcU8To16<part>(s[5]), BayerMhcU8To16<part>(s[6])), vaddq_s16(BayerMhcU8To16<part>(s[7]), BayerMhcU8To16<part>(s[8])));
+            int16x8_t farVertical = vaddq_s16(BayerMhcU8To16<part>(s[9]), BayerMhcU8To16<part>(s[10]));
+            int16x8_t farHorizontal = vaddq_s16(BayerMhcU8To16<part>(s[11]), BayerMhcU8To16<part>(s[12]));
+            if (green)
+            {
+                int16x8_t center10 = vaddq_s16(vshlq_n_s16(center, 3), vshlq_n_s16(center, 1));
+                int16x8_t common = vsubq_s16(vaddq_s16(center10, vdupq_n_s16(8)), vshlq_n_s16(diagonal, 1));
+                int16x8_t own = vaddq_s16(vsubq_s16(vshlq_n_s16(horizontal, 3), vshlq_n_s16(farHorizontal, 1)), farVertical);
+                int16x8_t other = vaddq_s16(vsubq_s16(vshlq_n_s16(vertical, 3), vshlq_n_s16(farVertical, 1)), farHorizontal);
+                dst[0] = vshrq_n_s16(vaddq_s16(common, own), 4);
+                dst[1] = center;
+                dst[2] = vshrq_n_s16(vaddq_s16(common, other), 4);
+            }
+            else
+            {
+                int16x8_t far = vaddq_s16(farVertical, farHorizontal);
+                int16x8_t green4 = vshlq_n_s16(vaddq_s16(vaddq_s16(center, center), vaddq_s16(vertical, horizontal)), 1);
+                int16x8_t center12 = vaddq_s16(vshlq_n_s16(center, 3), vshlq_n_s16(center, 2));
+                int16x8_t other = vaddq_s16(vaddq_s16(center12, vshlq_n_s16(diagonal, 2)), vdupq_n_s16(8));
+                dst[0] = center;
+                dst[1] = vshrq_n_s16(vsubq_s16(vaddq_s16(green4, vdupq_n_s16(4)), far), 3);
+                dst[2] = vshrq_n_s16(vsubq_s16(other, vaddq_s16(vaddq_s16(far, far), far)), 4);
+            }
+        }
+
+        SIMD_INLINE uint8x16_t BayerMhcPack(int16x8_t even, int16x8_t odd)
+        {
+            uint8x8x2_t packed = vzip_u8(vqmovun_s16(even), vqmovun_s16(odd));
+            return vcombine_u8(packed.val[0], packed.val[1]);
+        }
+
+        template<bool greenOdd> SIMD_INLINE void BayerMhc(const uint8_t * src[5], size_t col, bool red, uint8x16_t bgr[3])
+        {
+            uint8x8x2_t s[13];
+            int16x8_t even[3], odd[3];
+            LoadBayerMhc(src, col, s);
+            BayerMhc<0, !greenOdd>(s, even);
+            BayerMhc<1, greenOdd>(s, odd);
+            bgr[red ? 2 : 0] = BayerMhcPack(even[0], odd[0]);
+            bgr[1] = BayerMhcPack(even[1], odd[1]);
+            bgr[red ? 0 : 2] = BayerMhcPack(even[2], odd[2]);
+        }
+
+        template <SimdPixelFormatType bayerFormat> SIMD_INLINE void BayerToBgrHalf(const uint8_t * src0, const uint8_t * src1, uint8x16x3_t & bgr)
+        {
+            typedef Base::BayerHalf<bayerFormat> Half;
+            uint8x16x2_t s0 = Load2<false>(src0), s1 = Load2<false>(src1);
+            uint8x16_t q[4] = { s0.val[0], s0.val[1], s1.val[0], s1.val[1] };
+            bgr.val[0] = q[Half::B];
+            bgr.val[1] = vrhaddq_u8(q[Half::G0], q[Half::G1]);
+            bgr.val[2] = q[Half::R];
+        }
     }
 #endif//SIMD_NEON_ENABLE
 }
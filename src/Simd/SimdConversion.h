@@ -28,65 +28,202 @@
 #include "Simd/SimdConst.h"
 #include "Simd/SimdMath.h"
 #include "Simd/SimdLoad.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdSet.h"
 
 namespace Simd
 {
     namespace Base
     {
+        struct Bt601
+        {
+            static const int Y_ADJUST = Base::Y_ADJUST;
+            static const int Y_TO_RGB_WEIGHT = Base::Y_TO_RGB_WEIGHT;
+            static const int U_TO_BLUE_WEIGHT = Base::U_TO_BLUE_WEIGHT;
+            static const int U_TO_GREEN_WEIGHT = Base::U_TO_GREEN_WEIGHT;
+            static const int V_TO_GREEN_WEIGHT = Base::V_TO_GREEN_WEIGHT;
+            static const int V_TO_RED_WEIGHT = Base::V_TO_RED_WEIGHT;
+            static const int BLUE_TO_Y_WEIGHT = Base::BLUE_TO_Y_WEIGHT;
+            static const int GREEN_TO_Y_WEIGHT = Base::GREEN_TO_Y_WEIGHT;
+            static const int RED_TO_Y_WEIGHT = Base::RED_TO_Y_WEIGHT;
+            static const int BLUE_TO_U_WEIGHT = Base::BLUE_TO_U_WEIGHT;
+            static const int GREEN_TO_U_WEIGHT = Base::GREEN_TO_U_WEIGHT;
+            static const int RED_TO_U_WEIGHT = Base::RED_TO_U_WEIGHT;
+            static const int BLUE_TO_V_WEIGHT = Base::BLUE_TO_V_WEIGHT;
+            static const int GREEN_TO_V_WEIGHT = Base::GREEN_TO_V_WEIGHT;
+            static const int RED_TO_V_WEIGHT = Base::RED_TO_V_WEIGHT;
+        };
+
+        struct Bt709
+        {
+            static const int Y_ADJUST = 16;
+            static const int Y_TO_RGB_WEIGHT = int(1.1644*(1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int U_TO_BLUE_WEIGHT = int(2.1124*(1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int U_TO_GREEN_WEIGHT = -int(0.2132*(1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int V_TO_GREEN_WEIGHT = -int(0.5329*(1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int V_TO_RED_WEIGHT = int(1.7927*(1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int BLUE_TO_Y_WEIGHT = int(0.062*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int GREEN_TO_Y_WEIGHT = int(0.6142*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int RED_TO_Y_WEIGHT = int(0.1826*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int BLUE_TO_U_WEIGHT = int(0.4392*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int GREEN_TO_U_WEIGHT = -int(0.3386*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int RED_TO_U_WEIGHT = -int(0.1006*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int BLUE_TO_V_WEIGHT = -int(0.0403*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int GREEN_TO_V_WEIGHT = -int(0.3989*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int RED_TO_V_WEIGHT = int(0.4392*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+        };
+
+        struct Bt2020
+        {
+            static const int Y_ADJUST = 16;
+            static const int Y_TO_RGB_WEIGHT = int(1.1644*(1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int U_TO_BLUE_WEIGHT = int(2.1418*(1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int U_TO_GREEN_WEIGHT = -int(0.1873*(1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int V_TO_GREEN_WEIGHT = -int(0.6504*(1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int V_TO_RED_WEIGHT = int(1.6787*(1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int BLUE_TO_Y_WEIGHT = int(0.0509*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int GREEN_TO_Y_WEIGHT = int(0.5823*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int RED_TO_Y_WEIGHT = int(0.2256*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int BLUE_TO_U_WEIGHT = int(0.4392*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int GREEN_TO_U_WEIGHT = -int(0.3166*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int RED_TO_U_WEIGHT = -int(0.1227*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int BLUE_TO_V_WEIGHT = -int(0.0353*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int GREEN_TO_V_WEIGHT = -int(0.4039*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int RED_TO_V_WEIGHT = int(0.4392*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+        };
+
+        struct Bt601Full
+        {
+            static const int Y_ADJUST = 0;
+            static const int Y_TO_RGB_WEIGHT = int(1.0*(1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int U_TO_BLUE_WEIGHT = int(1.772*(1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int U_TO_GREEN_WEIGHT = -int(0.3441*(1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int V_TO_GREEN_WEIGHT = -int(0.7141*(1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int V_TO_RED_WEIGHT = int(1.402*(1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int BLUE_TO_Y_WEIGHT = int(0.114*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int GREEN_TO_Y_WEIGHT = int(0.587*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int RED_TO_Y_WEIGHT = int(0.299*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int BLUE_TO_U_WEIGHT = int(0.5*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int GREEN_TO_U_WEIGHT = -int(0.3313*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int RED_TO_U_WEIGHT = -int(0.1687*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int BLUE_TO_V_WEIGHT = -int(0.0813*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int GREEN_TO_V_WEIGHT = -int(0.4187*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int RED_TO_V_WEIGHT = int(0.5*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+        };
+
+        struct Bt709Full
+        {
+            static const int Y_ADJUST = 0;
+            static const int Y_TO_RGB_WEIGHT = int(1.0*(1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int U_TO_BLUE_WEIGHT = int(1.8556*(1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int U_TO_GREEN_WEIGHT = -int(0.1873*(1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int V_TO_GREEN_WEIGHT = -int(0.4681*(1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int V_TO_RED_WEIGHT = int(1.5748*(1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int BLUE_TO_Y_WEIGHT = int(0.0722*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int GREEN_TO_Y_WEIGHT = int(0.7152*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int RED_TO_Y_WEIGHT = int(0.2126*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int BLUE_TO_U_WEIGHT = int(0.5*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int GREEN_TO_U_WEIGHT = -int(0.3854*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int RED_TO_U_WEIGHT = -int(0.1146*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int BLUE_TO_V_WEIGHT = -int(0.0458*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int GREEN_TO_V_WEIGHT = -int(0.4542*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int RED_TO_V_WEIGHT = int(0.5*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+        };
+
+        struct Bt2020Full
+        {
+            static const int Y_ADJUST = 0;
+            static const int Y_TO_RGB_WEIGHT = int(1.0*(1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int U_TO_BLUE_WEIGHT = int(1.8814*(1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int U_TO_GREEN_WEIGHT = -int(0.1646*(1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int V_TO_GREEN_WEIGHT = -int(0.5714*(1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int V_TO_RED_WEIGHT = int(1.4746*(1 << YUV_TO_BGR_AVERAGING_SHIFT) + 0.5);
+            static const int BLUE_TO_Y_WEIGHT = int(0.0593*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int GREEN_TO_Y_WEIGHT = int(0.678*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int RED_TO_Y_WEIGHT = int(0.2627*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int BLUE_TO_U_WEIGHT = int(0.5*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int GREEN_TO_U_WEIGHT = -int(0.3604*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int RED_TO_U_WEIGHT = -int(0.1396*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int BLUE_TO_V_WEIGHT = -int(0.0402*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int GREEN_TO_V_WEIGHT = -int(0.4598*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+            static const int RED_TO_V_WEIGHT = int(0.5*(1 << BGR_TO_YUV_AVERAGING_SHIFT) + 0.5);
+        };
+
+        /* Red/blue swapped view of a color matrix: encoders read R, G, B in the slots of B, G, R,
+           decoders must be called with U and V planes exchanged and write R, G, B into the slots of B, G, R. */
+        template <class T> struct Rgb
+        {
+            static const int Y_ADJUST = T::Y_ADJUST;
+            static const int Y_TO_RGB_WEIGHT = T::Y_TO_RGB_WEIGHT;
+            static const int U_TO_BLUE_WEIGHT = T::V_TO_RED_WEIGHT;
+            static const int U_TO_GREEN_WEIGHT = T::V_TO_GREEN_WEIGHT;
+            static const int V_TO_GREEN_WEIGHT = T::U_TO_GREEN_WEIGHT;
+            static const int V_TO_RED_WEIGHT = T::U_TO_BLUE_WEIGHT;
+            static const int BLUE_TO_Y_WEIGHT = T::RED_TO_Y_WEIGHT;
+            static const int GREEN_TO_Y_WEIGHT = T::GREEN_TO_Y_WEIGHT;
+            static const int RED_TO_Y_WEIGHT = T::BLUE_TO_Y_WEIGHT;
+            static const int BLUE_TO_U_WEIGHT = T::RED_TO_U_WEIGHT;
+            static const int GREEN_TO_U_WEIGHT = T::GREEN_TO_U_WEIGHT;
+            static const int RED_TO_U_WEIGHT = T::BLUE_TO_U_WEIGHT;
+            static const int BLUE_TO_V_WEIGHT = T::RED_TO_V_WEIGHT;
+            static const int GREEN_TO_V_WEIGHT = T::GREEN_TO_V_WEIGHT;
+            static const int RED_TO_V_WEIGHT = T::BLUE_TO_V_WEIGHT;
+        };
+
         SIMD_INLINE int BgrToGray(int blue, int green, int red)
         {
             return (BLUE_TO_GRAY_WEIGHT*blue + GREEN_TO_GRAY_WEIGHT * green +
                 RED_TO_GRAY_WEIGHT * red + BGR_TO_GRAY_ROUND_TERM) >> BGR_TO_GRAY_AVERAGING_SHIFT;
         }
 
-        SIMD_INLINE int BgrToY(int blue, int green, int red)
+        template <class T = Bt601> SIMD_INLINE int BgrToY(int blue, int green, int red)
         {
-            return RestrictRange(((BLUE_TO_Y_WEIGHT*blue + GREEN_TO_Y_WEIGHT * green + RED_TO_Y_WEIGHT * red +
-                BGR_TO_YUV_ROUND_TERM) >> BGR_TO_YUV_AVERAGING_SHIFT) + Y_ADJUST);
+            return RestrictRange(((T::BLUE_TO_Y_WEIGHT*blue + T::GREEN_TO_Y_WEIGHT * green + T::RED_TO_Y_WEIGHT * red +
+                BGR_TO_YUV_ROUND_TERM) >> BGR_TO_YUV_AVERAGING_SHIFT) + T::Y_ADJUST);
         }
 
-        SIMD_INLINE int BgrToU(int blue, int green, int red)
+        template <class T = Bt601> SIMD_INLINE int BgrToU(int blue, int green, int red)
         {
-            return RestrictRange(((BLUE_TO_U_WEIGHT*blue + GREEN_TO_U_WEIGHT * green + RED_TO_U_WEIGHT * red +
+            return RestrictRange(((T::BLUE_TO_U_WEIGHT*blue + T::GREEN_TO_U_WEIGHT * green + T::RED_TO_U_WEIGHT * red +
                 BGR_TO_YUV_ROUND_TERM) >> BGR_TO_YUV_AVERAGING_SHIFT) + UV_ADJUST);
         }
 
-        SIMD_INLINE int BgrToV(int blue, int green, int red)
+        template <class T = Bt601> SIMD_INLINE int BgrToV(int blue, int green, int red)
         {
-            return RestrictRange(((BLUE_TO_V_WEIGHT*blue + GREEN_TO_V_WEIGHT * green + RED_TO_V_WEIGHT * red +
+            return RestrictRange(((T::BLUE_TO_V_WEIGHT*blue + T::GREEN_TO_V_WEIGHT * green + T::RED_TO_V_WEIGHT * red +
                 BGR_TO_YUV_ROUND_TERM) >> BGR_TO_YUV_AVERAGING_SHIFT) + UV_ADJUST);
         }
 
-        SIMD_INLINE int YuvToBlue(int y, int u)
+        template <class T = Bt601> SIMD_INLINE int YuvToBlue(int y, int u)
         {
-            return RestrictRange((Y_TO_RGB_WEIGHT*(y - Y_ADJUST) + U_TO_BLUE_WEIGHT * (u - UV_ADJUST) +
+            return RestrictRange((T::Y_TO_RGB_WEIGHT*(y - T::Y_ADJUST) + T::U_TO_BLUE_WEIGHT * (u - UV_ADJUST) +
                 YUV_TO_BGR_ROUND_TERM) >> YUV_TO_BGR_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE int YuvToGreen(int y, int u, int v)
+        template <class T = Bt601> SIMD_INLINE int YuvToGreen(int y, int u, int v)
         {
-            return RestrictRange((Y_TO_RGB_WEIGHT*(y - Y_ADJUST) + U_TO_GREEN_WEIGHT * (u - UV_ADJUST) +
-                V_TO_GREEN_WEIGHT * (v - UV_ADJUST) + YUV_TO_BGR_ROUND_TERM) >> YUV_TO_BGR_AVERAGING_SHIFT);
+            return RestrictRange((T::Y_TO_RGB_WEIGHT*(y - T::Y_ADJUST) + T::U_TO_GREEN_WEIGHT * (u - UV_ADJUST) +
+                T::V_TO_GREEN_WEIGHT * (v - UV_ADJUST) + YUV_TO_BGR_ROUND_TERM) >> YUV_TO_BGR_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE int YuvToRed(int y, int v)
+        template <class T = Bt601> SIMD_INLINE int YuvToRed(int y, int v)
         {
-            return RestrictRange((Y_TO_RGB_WEIGHT*(y - Y_ADJUST) + V_TO_RED_WEIGHT * (v - UV_ADJUST) +
+            return RestrictRange((T::Y_TO_RGB_WEIGHT*(y - T::Y_ADJUST) + T::V_TO_RED_WEIGHT * (v - UV_ADJUST) +
                 YUV_TO_BGR_ROUND_TERM) >> YUV_TO_BGR_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE void YuvToBgr(int y, int u, int v, uint8_t * bgr)
+        template <class T = Bt601> SIMD_INLINE void YuvToBgr(int y, int u, int v, uint8_t * bgr)
         {
-            bgr[0] = YuvToBlue(y, u);
-            bgr[1] = YuvToGreen(y, u, v);
-            bgr[2] = YuvToRed(y, v);
+            bgr[0] = YuvToBlue<T>(y, u);
+            bgr[1] = YuvToGreen<T>(y, u, v);
+            bgr[2] = YuvToRed<T>(y, v);
         }
 
-        SIMD_INLINE void YuvToBgra(int y, int u, int v, int alpha, uint8_t * bgra)
+        template <class T = Bt601> SIMD_INLINE void YuvToBgra(int y, int u, int v, int alpha, uint8_t * bgra)
         {
-            bgra[0] = YuvToBlue(y, u);
-            bgra[1] = YuvToGreen(y, u, v);
-            bgra[2] = YuvToRed(y, v);
+            bgra[0] = YuvToBlue<T>(y, u);
+            bgra[1] = YuvToGreen<T>(y, u, v);
+            bgra[2] = YuvToRed<T>(y, v);
             bgra[3] = alpha;
         }
 
@@ -117,11 +254,11 @@ namespace Simd
             hsv[2] = max;
         }
 
-        SIMD_INLINE void YuvToHsv(int y, int u, int v, uint8_t * hsv)
+        template <class T = Bt601> SIMD_INLINE void YuvToHsv(int y, int u, int v, uint8_t * hsv)
         {
-            int blue = YuvToBlue(y, u);
-            int green = YuvToGreen(y, u, v);
-            int red = YuvToRed(y, v);
+            int blue = YuvToBlue<T>(y, u);
+            int green = YuvToGreen<T>(y, u, v);
+            int red = YuvToRed<T>(y, v);
             BgrToHsv(blue, green, red, hsv);
         }
 
@@ -158,11 +295,11 @@ namespace Simd
             hsl[2] = sum / 2;
         }
 
-        SIMD_INLINE void YuvToHsl(int y, int u, int v, uint8_t * hsl)
+        template <class T = Bt601> SIMD_INLINE void YuvToHsl(int y, int u, int v, uint8_t * hsl)
         {
-            int blue = YuvToBlue(y, u);
-            int green = YuvToGreen(y, u, v);
-            int red = YuvToRed(y, v);
+            int blue = YuvToBlue<T>(y, u);
+            int green = YuvToGreen<T>(y, u, v);
+            int red = YuvToRed<T>(y, v);
             BgrToHsl(blue, green, red, hsl);
         }
 
@@ -177,6 +314,7 @@ namespace Simd
                 switch (sector)
                 {
                 case 0:
+                case 6:
                     bgr[0] = min;
                     bgr[1] = min + delta;
                     bgr[2] = value;
@@ -234,6 +372,7 @@ namespace Simd
                 switch (sector)
                 {
                 case 0:
+                case 6:
                     bgr[0] = min;
                     bgr[1] = min + delta;
                     bgr[2] = max;
@@ -274,14 +413,28 @@ namespace Simd
                 bgr[2] = lightness;
             }
         }
+
+        /* Levels added to 16-bit samples before their reduction to 8 bits: the half of a quantization step (rounding)
+           or the thresholds of 4x4 ordered dithering matrix. The levels depend on the row and repeat every 4 columns. */
+        SIMD_INLINE void Uint16ToGrayLevels(size_t row, size_t shift, bool dither, uint16_t levels[4])
+        {
+            static const int BAYER[4][4] = { { 0, 8, 2, 10 }, { 12, 4, 14, 6 }, { 3, 11, 1, 9 }, { 15, 7, 13, 5 } };
+            for (size_t i = 0; i < 4; ++i)
+                levels[i] = uint16_t(dither ? ((2 * BAYER[row & 3][i] + 1) << shift) >> 5 : (1 << shift) >> 1);
+        }
+
+        SIMD_INLINE int Uint16ToGray(int value, int level, size_t shift)
+        {
+            return Min(Min(value + level, 0xFFFF) >> shift, 0xFF);
+        }
     }
 
 #ifdef SIMD_SSE2_ENABLE    
     namespace Sse2
     {
-        SIMD_INLINE __m128i AdjustY16(__m128i y16)
+        template <class T = Base::Bt601> SIMD_INLINE __m128i AdjustY16(__m128i y16)
         {
-            return _mm_subs_epi16(y16, K16_Y_ADJUST);
+            return _mm_subs_epi16(y16, _mm_set1_epi16(T::Y_ADJUST));
         }
 
         SIMD_INLINE __m128i AdjustUV16(__m128i uv16)
@@ -289,138 +442,156 @@ namespace Simd
             return _mm_subs_epi16(uv16, K16_UV_ADJUST);
         }
 
-        SIMD_INLINE __m128i AdjustedYuvToRed32(__m128i y16_1, __m128i v16_0)
+        template <class T = Base::Bt601> SIMD_INLINE __m128i AdjustedYuvToRed32(__m128i y16_1, __m128i v16_0)
         {
-            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(y16_1, K16_YRGB_RT),
-                _mm_madd_epi16(v16_0, K16_VR_0)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(y16_1, SetInt16(T::Y_TO_RGB_WEIGHT, Base::YUV_TO_BGR_ROUND_TERM)),
+                _mm_madd_epi16(v16_0, SetInt16(T::V_TO_RED_WEIGHT, 0))), Base::YUV_TO_BGR_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m128i AdjustedYuvToRed16(__m128i y16, __m128i v16)
+        template <class T = Base::Bt601> SIMD_INLINE __m128i AdjustedYuvToRed16(__m128i y16, __m128i v16)
         {
             return SaturateI16ToU8(_mm_packs_epi32(
-                AdjustedYuvToRed32(_mm_unpacklo_epi16(y16, K16_0001), _mm_unpacklo_epi16(v16, K_ZERO)),
-                AdjustedYuvToRed32(_mm_unpackhi_epi16(y16, K16_0001), _mm_unpackhi_epi16(v16, K_ZERO))));
+                AdjustedYuvToRed32<T>(_mm_unpacklo_epi16(y16, K16_0001), _mm_unpacklo_epi16(v16, K_ZERO)),
+                AdjustedYuvToRed32<T>(_mm_unpackhi_epi16(y16, K16_0001), _mm_unpackhi_epi16(v16, K_ZERO))));
         }
 
-        SIMD_INLINE __m128i AdjustedYuvToGreen32(__m128i y16_1, __m128i u16_v16)
+        template <class T = Base::Bt601> SIMD_INLINE __m128i AdjustedYuvToGreen32(__m128i y16_1, __m128i u16_v16)
         {
-            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(y16_1, K16_YRGB_RT),
-                _mm_madd_epi16(u16_v16, K16_UG_VG)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(y16_1, SetInt16(T::Y_TO_RGB_WEIGHT, Base::YUV_TO_BGR_ROUND_TERM)),
+                _mm_madd_epi16(u16_v16, SetInt16(T::U_TO_GREEN_WEIGHT, T::V_TO_GREEN_WEIGHT))), Base::YUV_TO_BGR_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m128i AdjustedYuvToGreen16(__m128i y16, __m128i u16, __m128i v16)
+        template <class T = Base::Bt601> SIMD_INLINE __m128i AdjustedYuvToGreen16(__m128i y16, __m128i u16, __m128i v16)
         {
             return SaturateI16ToU8(_mm_packs_epi32(
-                AdjustedYuvToGreen32(_mm_unpacklo_epi16(y16, K16_0001), _mm_unpacklo_epi16(u16, v16)),
-                AdjustedYuvToGreen32(_mm_unpackhi_epi16(y16, K16_0001), _mm_unpackhi_epi16(u16, v16))));
+                AdjustedYuvToGreen32<T>(_mm_unpacklo_epi16(y16, K16_0001), _mm_unpacklo_epi16(u16, v16)),
+                AdjustedYuvToGreen32<T>(_mm_unpackhi_epi16(y16, K16_0001), _mm_unpackhi_epi16(u16, v16))));
         }
 
-        SIMD_INLINE __m128i AdjustedYuvToBlue32(__m128i y16_1, __m128i u16_0)
+        template <class T = Base::Bt601> SIMD_INLINE __m128i AdjustedYuvToBlue32(__m128i y16_1, __m128i u16_0)
         {
-            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(y16_1, K16_YRGB_RT),
-                _mm_madd_epi16(u16_0, K16_UB_0)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(y16_1, SetInt16(T::Y_TO_RGB_WEIGHT, Base::YUV_TO_BGR_ROUND_TERM)),
+                _mm_madd_epi16(u16_0, SetInt16(T::U_TO_BLUE_WEIGHT, 0))), Base::YUV_TO_BGR_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m128i AdjustedYuvToBlue16(__m128i y16, __m128i u16)
+        template <class T = Base::Bt601> SIMD_INLINE __m128i AdjustedYuvToBlue16(__m128i y16, __m128i u16)
         {
             return SaturateI16ToU8(_mm_packs_epi32(
-                AdjustedYuvToBlue32(_mm_unpacklo_epi16(y16, K16_0001), _mm_unpacklo_epi16(u16, K_ZERO)),
-                AdjustedYuvToBlue32(_mm_unpackhi_epi16(y16, K16_0001), _mm_unpackhi_epi16(u16, K_ZERO))));
+                AdjustedYuvToBlue32<T>(_mm_unpacklo_epi16(y16, K16_0001), _mm_unpacklo_epi16(u16, K_ZERO)),
+                AdjustedYuvToBlue32<T>(_mm_unpackhi_epi16(y16, K16_0001), _mm_unpackhi_epi16(u16, K_ZERO))));
         }
 
-        SIMD_INLINE __m128i YuvToRed(__m128i y, __m128i v)
+        template <class T = Base::Bt601> SIMD_INLINE __m128i YuvToRed(__m128i y, __m128i v)
         {
-            __m128i lo = AdjustedYuvToRed16(
-                AdjustY16(_mm_unpacklo_epi8(y, K_ZERO)),
+            __m128i lo = AdjustedYuvToRed16<T>(
+                AdjustY16<T>(_mm_unpacklo_epi8(y, K_ZERO)),
                 AdjustUV16(_mm_unpacklo_epi8(v, K_ZERO)));
-            __m128i hi = AdjustedYuvToRed16(
-                AdjustY16(_mm_unpackhi_epi8(y, K_ZERO)),
+            __m128i hi = AdjustedYuvToRed16<T>(
+                AdjustY16<T>(_mm_unpackhi_epi8(y, K_ZERO)),
                 AdjustUV16(_mm_unpackhi_epi8(v, K_ZERO)));
             return _mm_packus_epi16(lo, hi);
         }
 
-        SIMD_INLINE __m128i YuvToGreen(__m128i y, __m128i u, __m128i v)
+        template <class T = Base::Bt601> SIMD_INLINE __m128i YuvToGreen(__m128i y, __m128i u, __m128i v)
         {
-            __m128i lo = AdjustedYuvToGreen16(
-                AdjustY16(_mm_unpacklo_epi8(y, K_ZERO)),
+            __m128i lo = AdjustedYuvToGreen16<T>(
+                AdjustY16<T>(_mm_unpacklo_epi8(y, K_ZERO)),
                 AdjustUV16(_mm_unpacklo_epi8(u, K_ZERO)),
                 AdjustUV16(_mm_unpacklo_epi8(v, K_ZERO)));
-            __m128i hi = AdjustedYuvToGreen16(
-                AdjustY16(_mm_unpackhi_epi8(y, K_ZERO)),
+            __m128i hi = AdjustedYuvToGreen16<T>(
+                AdjustY16<T>(_mm_unpackhi_epi8(y, K_ZERO)),
                 AdjustUV16(_mm_unpackhi_epi8(u, K_ZERO)),
                 AdjustUV16(_mm_unpackhi_epi8(v, K_ZERO)));
             return _mm_packus_epi16(lo, hi);
         }
 
-        SIMD_INLINE __m128i YuvToBlue(__m128i y, __m128i u)
+        template <class T = Base::Bt601> SIMD_INLINE __m128i YuvToBlue(__m128i y, __m128i u)
         {
-            __m128i lo = AdjustedYuvToBlue16(
-                AdjustY16(_mm_unpacklo_epi8(y, K_ZERO)),
+            __m128i lo = AdjustedYuvToBlue16<T>(
+                AdjustY16<T>(_mm_unpacklo_epi8(y, K_ZERO)),
                 AdjustUV16(_mm_unpacklo_epi8(u, K_ZERO)));
-            __m128i hi = AdjustedYuvToBlue16(
-                AdjustY16(_mm_unpackhi_epi8(y, K_ZERO)),
+            __m128i hi = AdjustedYuvToBlue16<T>(
+                AdjustY16<T>(_mm_unpackhi_epi8(y, K_ZERO)),
                 AdjustUV16(_mm_unpackhi_epi8(u, K_ZERO)));
             return _mm_packus_epi16(lo, hi);
         }
 
-        SIMD_INLINE __m128i BgrToY32(__m128i b16_r16, __m128i g16_1)
+        template <class T = Base::Bt601> SIMD_INLINE __m128i BgrToY32(__m128i b16_r16, __m128i g16_1)
         {
-            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(b16_r16, K16_BY_RY),
-                _mm_madd_epi16(g16_1, K16_GY_RT)), Base::BGR_TO_YUV_AVERAGING_SHIFT);
+            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(b16_r16, SetInt16(T::BLUE_TO_Y_WEIGHT, T::RED_TO_Y_WEIGHT)),
+                _mm_madd_epi16(g16_1, SetInt16(T::GREEN_TO_Y_WEIGHT, Base::BGR_TO_YUV_ROUND_TERM))), Base::BGR_TO_YUV_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m128i BgrToY16(__m128i b16, __m128i g16, __m128i r16)
+        template <class T = Base::Bt601> SIMD_INLINE __m128i BgrToY16(__m128i b16, __m128i g16, __m128i r16)
         {
-            return SaturateI16ToU8(_mm_add_epi16(K16_Y_ADJUST, _mm_packs_epi32(
-                BgrToY32(_mm_unpacklo_epi16(b16, r16), _mm_unpacklo_epi16(g16, K16_0001)),
-                BgrToY32(_mm_unpackhi_epi16(b16, r16), _mm_unpackhi_epi16(g16, K16_0001)))));
+            return SaturateI16ToU8(_mm_add_epi16(_mm_set1_epi16(T::Y_ADJUST), _mm_packs_epi32(
+                BgrToY32<T>(_mm_unpacklo_epi16(b16, r16), _mm_unpacklo_epi16(g16, K16_0001)),
+                BgrToY32<T>(_mm_unpackhi_epi16(b16, r16), _mm_unpackhi_epi16(g16, K16_0001)))));
         }
 
-        SIMD_INLINE __m128i BgrToY8(__m128i b8, __m128i g8, __m128i r8)
+        template <class T = Base::Bt601> SIMD_INLINE __m128i BgrToY8(__m128i b8, __m128i g8, __m128i r8)
         {
             return _mm_packus_epi16(
-                BgrToY16(_mm_unpacklo_epi8(b8, K_ZERO), _mm_unpacklo_epi8(g8, K_ZERO), _mm_unpacklo_epi8(r8, K_ZERO)),
-                BgrToY16(_mm_unpackhi_epi8(b8, K_ZERO), _mm_unpackhi_epi8(g8, K_ZERO), _mm_unpackhi_epi8(r8, K_ZERO)));
+                BgrToY16<T>(_mm_unpacklo_epi8(b8, K_ZERO), _mm_unpacklo_epi8(g8, K_ZERO), _mm_unpacklo_epi8(r8, K_ZERO)),
+                BgrToY16<T>(_mm_unpackhi_epi8(b8, K_ZERO), _mm_unpackhi_epi8(g8, K_ZERO), _mm_unpackhi_epi8(r8, K_ZERO)));
         }
 
-        SIMD_INLINE __m128i BgrToU32(__m128i b16_r16, __m128i g16_1)
+        template <class T = Base::Bt601> SIMD_INLINE __m128i BgrToU32(__m128i b16_r16, __m128i g16_1)
         {
-            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(b16_r16, K16_BU_RU),
-                _mm_madd_epi16(g16_1, K16_GU_RT)), Base::BGR_TO_YUV_AVERAGING_SHIFT);
+            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(b16_r16, SetInt16(T::BLUE_TO_U_WEIGHT, T::RED_TO_U_WEIGHT)),
+                _mm_madd_epi16(g16_1, SetInt16(T::GREEN_TO_U_WEIGHT, Base::BGR_TO_YUV_ROUND_TERM))), Base::BGR_TO_YUV_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m128i BgrToU16(__m128i b16, __m128i g16, __m128i r16)
+        template <class T = Base::Bt601> SIMD_INLINE __m128i BgrToU16(__m128i b16, __m128i g16, __m128i r16)
         {
             return SaturateI16ToU8(_mm_add_epi16(K16_UV_ADJUST, _mm_packs_epi32(
-                BgrToU32(_mm_unpacklo_epi16(b16, r16), _mm_unpacklo_epi16(g16, K16_0001)),
-                BgrToU32(_mm_unpackhi_epi16(b16, r16), _mm_unpackhi_epi16(g16, K16_0001)))));
+                BgrToU32<T>(_mm_unpacklo_epi16(b16, r16), _mm_unpacklo_epi16(g16, K16_0001)),
+                BgrToU32<T>(_mm_unpackhi_epi16(b16, r16), _mm_unpackhi_epi16(g16, K16_0001)))));
         }
 
-        SIMD_INLINE __m128i BgrToU8(__m128i b8, __m128i g8, __m128i r8)
+        template <class T = Base::Bt601> SIMD_INLINE __m128i BgrToU8(__m128i b8, __m128i g8, __m128i r8)
         {
             return _mm_packus_epi16(
-                BgrToU16(_mm_unpacklo_epi8(b8, K_ZERO), _mm_unpacklo_epi8(g8, K_ZERO), _mm_unpacklo_epi8(r8, K_ZERO)),
-                BgrToU16(_mm_unpackhi_epi8(b8, K_ZERO), _mm_unpackhi_epi8(g8, K_ZERO), _mm_unpackhi_epi8(r8, K_ZERO)));
+                BgrToU16<T>(_mm_unpacklo_epi8(b8, K_ZERO), _mm_unpacklo_epi8(g8, K_ZERO), _mm_unpacklo_epi8(r8, K_ZERO)),
+                BgrToU16<T>(_mm_unpackhi_epi8(b8, K_ZERO), _mm_unpackhi_epi8(g8, K_ZERO), _mm_unpackhi_epi8(r8, K_ZERO)));
         }
 
-        SIMD_INLINE __m128i BgrToV32(__m128i b16_r16, __m128i g16_1)
+        template <class T = Base::Bt601> SIMD_INLINE __m128i BgrToV32(__m128i b16_r16, __m128i g16_1)
         {
-            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(b16_r16, K16_BV_RV),
-                _mm_madd_epi16(g16_1, K16_GV_RT)), Base::BGR_TO_YUV_AVERAGING_SHIFT);
+            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(b16_r16, SetInt16(T::BLUE_TO_V_WEIGHT, T::RED_TO_V_WEIGHT)),
+                _mm_madd_epi16(g16_1, SetInt16(T::GREEN_TO_V_WEIGHT, Base::BGR_TO_YUV_ROUND_TERM))), Base::BGR_TO_YUV_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m128i BgrToV16(__m128i b16, __m128i g16, __m128i r16)
+        template <class T = Base::Bt601> SIMD_INLINE __m128i BgrToV16(__m128i b16, __m128i g16, __m128i r16)
         {
             return SaturateI16ToU8(_mm_add_epi16(K16_UV_ADJUST, _mm_packs_epi32(
-                BgrToV32(_mm_unpacklo_epi16(b16, r16), _mm_unpacklo_epi16(g16, K16_0001)),
-                BgrToV32(_mm_unpackhi_epi16(b16, r16), _mm_unpackhi_epi16(g16, K16_0001)))));
+                BgrToV32<T>(_mm_unpacklo_epi16(b16, r16), _mm_unpacklo_epi16(g16, K16_0001)),
+                BgrToV32<T>(_mm_unpackhi_epi16(b16, r16), _mm_unpackhi_epi16(g16, K16_0001)))));
         }
 
-        SIMD_INLINE __m128i BgrToV8(__m128i b8, __m128i g8, __m128i r8)
+        template <class T = Base::Bt601> SIMD_INLINE __m128i BgrToV8(__m128i b8, __m128i g8, __m128i r8)
         {
             return _mm_packus_epi16(
-                BgrToV16(_mm_unpacklo_epi8(b8, K_ZERO), _mm_unpacklo_epi8(g8, K_ZERO), _mm_unpacklo_epi8(r8, K_ZERO)),
-                BgrToV16(_mm_unpackhi_epi8(b8, K_ZERO), _mm_unpackhi_epi8(g8, K_ZERO), _mm_unpackhi_epi8(r8, K_ZERO)));
+                BgrToV16<T>(_mm_unpacklo_epi8(b8, K_ZERO), _mm_unpacklo_epi8(g8, K_ZERO), _mm_unpacklo_epi8(r8, K_ZERO)),
+                BgrToV16<T>(_mm_unpackhi_epi8(b8, K_ZERO), _mm_unpackhi_epi8(g8, K_ZERO), _mm_unpackhi_epi8(r8, K_ZERO)));
+        }
+
+        template <bool align, bool nv21> SIMD_INLINE void LoadUv(const uint8_t * uv, __m128i & u, __m128i & v)
+        {
+            __m128i uv0 = Load<align>((__m128i*)uv + 0);
+            __m128i uv1 = Load<align>((__m128i*)uv + 1);
+            __m128i even = _mm_packus_epi16(_mm_and_si128(uv0, K16_00FF), _mm_and_si128(uv1, K16_00FF));
+            __m128i odd = _mm_packus_epi16(_mm_srli_epi16(uv0, 8), _mm_srli_epi16(uv1, 8));
+            u = nv21 ? odd : even;
+            v = nv21 ? even : odd;
+        }
+
+        template <bool align, bool nv21> SIMD_INLINE void StoreUv(uint8_t * uv, __m128i u, __m128i v)
+        {
+            __m128i even = nv21 ? v : u;
+            __m128i odd = nv21 ? u : v;
+            Store<align>((__m128i*)uv + 0, _mm_unpacklo_epi8(even, odd));
+            Store<align>((__m128i*)uv + 1, _mm_unpackhi_epi8(even, odd));
         }
     }
 #endif// SIMD_SSE2_ENABLE
@@ -483,9 +654,9 @@ namespace Simd
 #ifdef SIMD_AVX2_ENABLE    
     namespace Avx2
     {
-        SIMD_INLINE __m256i AdjustY16(__m256i y16)
+        template <class T = Base::Bt601> SIMD_INLINE __m256i AdjustY16(__m256i y16)
         {
-            return _mm256_subs_epi16(y16, K16_Y_ADJUST);
+            return _mm256_subs_epi16(y16, _mm256_set1_epi16(T::Y_ADJUST));
         }
 
         SIMD_INLINE __m256i AdjustUV16(__m256i uv16)
@@ -493,138 +664,138 @@ namespace Simd
             return _mm256_subs_epi16(uv16, K16_UV_ADJUST);
         }
 
-        SIMD_INLINE __m256i AdjustedYuvToRed32(__m256i y16_1, __m256i v16_0)
+        template <class T = Base::Bt601> SIMD_INLINE __m256i AdjustedYuvToRed32(__m256i y16_1, __m256i v16_0)
         {
-            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(y16_1, K16_YRGB_RT),
-                _mm256_madd_epi16(v16_0, K16_VR_0)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(y16_1, SetInt16(T::Y_TO_RGB_WEIGHT, Base::YUV_TO_BGR_ROUND_TERM)),
+                _mm256_madd_epi16(v16_0, SetInt16(T::V_TO_RED_WEIGHT, 0))), Base::YUV_TO_BGR_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m256i AdjustedYuvToRed16(__m256i y16, __m256i v16)
+        template <class T = Base::Bt601> SIMD_INLINE __m256i AdjustedYuvToRed16(__m256i y16, __m256i v16)
         {
             return SaturateI16ToU8(_mm256_packs_epi32(
-                AdjustedYuvToRed32(_mm256_unpacklo_epi16(y16, K16_0001), _mm256_unpacklo_epi16(v16, K_ZERO)),
-                AdjustedYuvToRed32(_mm256_unpackhi_epi16(y16, K16_0001), _mm256_unpackhi_epi16(v16, K_ZERO))));
+                AdjustedYuvToRed32<T>(_mm256_unpacklo_epi16(y16, K16_0001), _mm256_unpacklo_epi16(v16, K_ZERO)),
+                AdjustedYuvToRed32<T>(_mm256_unpackhi_epi16(y16, K16_0001), _mm256_unpackhi_epi16(v16, K_ZERO))));
         }
 
-        SIMD_INLINE __m256i AdjustedYuvToGreen32(__m256i y16_1, __m256i u16_v16)
+        template <class T = Base::Bt601> SIMD_INLINE __m256i AdjustedYuvToGreen32(__m256i y16_1, __m256i u16_v16)
         {
-            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(y16_1, K16_YRGB_RT),
-                _mm256_madd_epi16(u16_v16, K16_UG_VG)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(y16_1, SetInt16(T::Y_TO_RGB_WEIGHT, Base::YUV_TO_BGR_ROUND_TERM)),
+                _mm256_madd_epi16(u16_v16, SetInt16(T::U_TO_GREEN_WEIGHT, T::V_TO_GREEN_WEIGHT))), Base::YUV_TO_BGR_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m256i AdjustedYuvToGreen16(__m256i y16, __m256i u16, __m256i v16)
+        template <class T = Base::Bt601> SIMD_INLINE __m256i AdjustedYuvToGreen16(__m256i y16, __m256i u16, __m256i v16)
         {
             return SaturateI16ToU8(_mm256_packs_epi32(
-                AdjustedYuvToGreen32(_mm256_unpacklo_epi16(y16, K16_0001), _mm256_unpacklo_epi16(u16, v16)),
-                AdjustedYuvToGreen32(_mm256_unpackhi_epi16(y16, K16_0001), _mm256_unpackhi_epi16(u16, v16))));
+                AdjustedYuvToGreen32<T>(_mm256_unpacklo_epi16(y16, K16_0001), _mm256_unpacklo_epi16(u16, v16)),
+                AdjustedYuvToGreen32<T>(_mm256_unpackhi_epi16(y16, K16_0001), _mm256_unpackhi_epi16(u16, v16))));
         }
 
-        SIMD_INLINE __m256i AdjustedYuvToBlue32(__m256i y16_1, __m256i u16_0)
+        template <class T = Base::Bt601> SIMD_INLINE __m256i AdjustedYuvToBlue32(__m256i y16_1, __m256i u16_0)
         {
-            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(y16_1, K16_YRGB_RT),
-                _mm256_madd_epi16(u16_0, K16_UB_0)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(y16_1, SetInt16(T::Y_TO_RGB_WEIGHT, Base::YUV_TO_BGR_ROUND_TERM)),
+                _mm256_madd_epi16(u16_0, SetInt16(T::U_TO_BLUE_WEIGHT, 0))), Base::YUV_TO_BGR_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m256i AdjustedYuvToBlue16(__m256i y16, __m256i u16)
+        template <class T = Base::Bt601> SIMD_INLINE __m256i AdjustedYuvToBlue16(__m256i y16, __m256i u16)
         {
             return SaturateI16ToU8(_mm256_packs_epi32(
-                AdjustedYuvToBlue32(_mm256_unpacklo_epi16(y16, K16_0001), _mm256_unpacklo_epi16(u16, K_ZERO)),
-                AdjustedYuvToBlue32(_mm256_unpackhi_epi16(y16, K16_0001), _mm256_unpackhi_epi16(u16, K_ZERO))));
+                AdjustedYuvToBlue32<T>(_mm256_unpacklo_epi16(y16, K16_0001), _mm256_unpacklo_epi16(u16, K_ZERO)),
+                AdjustedYuvToBlue32<T>(_mm256_unpackhi_epi16(y16, K16_0001), _mm256_unpackhi_epi16(u16, K_ZERO))));
         }
 
-        SIMD_INLINE __m256i YuvToRed(__m256i y, __m256i v)
+        template <class T = Base::Bt601> SIMD_INLINE __m256i YuvToRed(__m256i y, __m256i v)
         {
-            __m256i lo = AdjustedYuvToRed16(
-                AdjustY16(_mm256_unpacklo_epi8(y, K_ZERO)),
+            __m256i lo = AdjustedYuvToRed16<T>(
+                AdjustY16<T>(_mm256_unpacklo_epi8(y, K_ZERO)),
                 AdjustUV16(_mm256_unpacklo_epi8(v, K_ZERO)));
-            __m256i hi = AdjustedYuvToRed16(
-                AdjustY16(_mm256_unpackhi_epi8(y, K_ZERO)),
+            __m256i hi = AdjustedYuvToRed16<T>(
+                AdjustY16<T>(_mm256_unpackhi_epi8(y, K_ZERO)),
                 AdjustUV16(_mm256_unpackhi_epi8(v, K_ZERO)));
             return _mm256_packus_epi16(lo, hi);
         }
 
-        SIMD_INLINE __m256i YuvToGreen(__m256i y, __m256i u, __m256i v)
+        template <class T = Base::Bt601> SIMD_INLINE __m256i YuvToGreen(__m256i y, __m256i u, __m256i v)
         {
-            __m256i lo = AdjustedYuvToGreen16(
-                AdjustY16(_mm256_unpacklo_epi8(y, K_ZERO)),
+            __m256i lo = AdjustedYuvToGreen16<T>(
+                AdjustY16<T>(_mm256_unpacklo_epi8(y, K_ZERO)),
                 AdjustUV16(_mm256_unpacklo_epi8(u, K_ZERO)),
                 AdjustUV16(_mm256_unpacklo_epi8(v, K_ZERO)));
-            __m256i hi = AdjustedYuvToGreen16(
-                AdjustY16(_mm256_unpackhi_epi8(y, K_ZERO)),
+            __m256i hi = AdjustedYuvToGreen16<T>(
+                AdjustY16<T>(_mm256_unpackhi_epi8(y, K_ZERO)),
                 AdjustUV16(_mm256_unpackhi_epi8(u, K_ZERO)),
                 AdjustUV16(_mm256_unpackhi_epi8(v, K_ZERO)));
             return _mm256_packus_epi16(lo, hi);
         }
 
-        SIMD_INLINE __m256i YuvToBlue(__m256i y, __m256i u)
+        template <class T = Base::Bt601> SIMD_INLINE __m256i YuvToBlue(__m256i y, __m256i u)
         {
-            __m256i lo = AdjustedYuvToBlue16(
-                AdjustY16(_mm256_unpacklo_epi8(y, K_ZERO)),
+            __m256i lo = AdjustedYuvToBlue16<T>(
+                AdjustY16<T>(_mm256_unpacklo_epi8(y, K_ZERO)),
                 AdjustUV16(_mm256_unpacklo_epi8(u, K_ZERO)));
-            __m256i hi = AdjustedYuvToBlue16(
-                AdjustY16(_mm256_unpackhi_epi8(y, K_ZERO)),
+            __m256i hi = AdjustedYuvToBlue16<T>(
+                AdjustY16<T>(_mm256_unpackhi_epi8(y, K_ZERO)),
                 AdjustUV16(_mm256_unpackhi_epi8(u, K_ZERO)));
             return _mm256_packus_epi16(lo, hi);
         }
 
-        SIMD_INLINE __m256i BgrToY32(__m256i b16_r16, __m256i g16_1)
+        template <class T = Base::Bt601> SIMD_INLINE __m256i BgrToY32(__m256i b16_r16, __m256i g16_1)
         {
-            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(b16_r16, K16_BY_RY),
-                _mm256_madd_epi16(g16_1, K16_GY_RT)), Base::BGR_TO_YUV_AVERAGING_SHIFT);
+            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(b16_r16, SetInt16(T::BLUE_TO_Y_WEIGHT, T::RED_TO_Y_WEIGHT)),
+                _mm256_madd_epi16(g16_1, SetInt16(T::GREEN_TO_Y_WEIGHT, Base::BGR_TO_YUV_ROUND_TERM))), Base::BGR_TO_YUV_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m256i BgrToY16(__m256i b16, __m256i g16, __m256i r16)
+        template <class T = Base::Bt601> SIMD_INLINE __m256i BgrToY16(__m256i b16, __m256i g16, __m256i r16)
         {
-            return SaturateI16ToU8(_mm256_add_epi16(K16_Y_ADJUST, _mm256_packs_epi32(
-                BgrToY32(_mm256_unpacklo_epi16(b16, r16), _mm256_unpacklo_epi16(g16, K16_0001)),
-                BgrToY32(_mm256_unpackhi_epi16(b16, r16), _mm256_unpackhi_epi16(g16, K16_0001)))));
+            return SaturateI16ToU8(_mm256_add_epi16(_mm256_set1_epi16(T::Y_ADJUST), _mm256_packs_epi32(
+                BgrToY32<T>(_mm256_unpacklo_epi16(b16, r16), _mm256_unpacklo_epi16(g16, K16_0001)),
+                BgrToY32<T>(_mm256_unpackhi_epi16(b16, r16), _mm256_unpackhi_epi16(g16, K16_0001)))));
         }
 
-        SIMD_INLINE __m256i BgrToY8(__m256i b8, __m256i g8, __m256i r8)
+        template <class T = Base::Bt601> SIMD_INLINE __m256i BgrToY8(__m256i b8, __m256i g8, __m256i r8)
         {
             return _mm256_packus_epi16(
-                BgrToY16(_mm256_unpacklo_epi8(b8, K_ZERO), _mm256_unpacklo_epi8(g8, K_ZERO), _mm256_unpacklo_epi8(r8, K_ZERO)),
-                BgrToY16(_mm256_unpackhi_epi8(b8, K_ZERO), _mm256_unpackhi_epi8(g8, K_ZERO), _mm256_unpackhi_epi8(r8, K_ZERO)));
+                BgrToY16<T>(_mm256_unpacklo_epi8(b8, K_ZERO), _mm256_unpacklo_epi8(g8, K_ZERO), _mm256_unpacklo_epi8(r8, K_ZERO)),
+                BgrToY16<T>(_mm256_unpackhi_epi8(b8, K_ZERO), _mm256_unpackhi_epi8(g8, K_ZERO), _mm256_unpackhi_epi8(r8, K_ZERO)));
         }
 
-        SIMD_INLINE __m256i BgrToU32(__m256i b16_r16, __m256i g16_1)
+        template <class T = Base::Bt601> SIMD_INLINE __m256i BgrToU32(__m256i b16_r16, __m256i g16_1)
         {
-            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(b16_r16, K16_BU_RU),
-                _mm256_madd_epi16(g16_1, K16_GU_RT)), Base::BGR_TO_YUV_AVERAGING_SHIFT);
+            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(b16_r16, SetInt16(T::BLUE_TO_U_WEIGHT, T::RED_TO_U_WEIGHT)),
+                _mm256_madd_epi16(g16_1, SetInt16(T::GREEN_TO_U_WEIGHT, Base::BGR_TO_YUV_ROUND_TERM))), Base::BGR_TO_YUV_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m256i BgrToU16(__m256i b16, __m256i g16, __m256i r16)
+        template <class T = Base::Bt601> SIMD_INLINE __m256i BgrToU16(__m256i b16, __m256i g16, __m256i r16)
         {
             return SaturateI16ToU8(_mm256_add_epi16(K16_UV_ADJUST, _mm256_packs_epi32(
-                BgrToU32(_mm256_unpacklo_epi16(b16, r16), _mm256_unpacklo_epi16(g16, K16_0001)),
-                BgrToU32(_mm256_unpackhi_epi16(b16, r16), _mm256_unpackhi_epi16(g16, K16_0001)))));
+                BgrToU32<T>(_mm256_unpacklo_epi16(b16, r16), _mm256_unpacklo_epi16(g16, K16_0001)),
+                BgrToU32<T>(_mm256_unpackhi_epi16(b16, r16), _mm256_unpackhi_epi16(g16, K16_0001)))));
         }
 
-        SIMD_INLINE __m256i BgrToU8(__m256i b8, __m256i g8, __m256i r8)
+        template <class T = Base::Bt601> SIMD_INLINE __m256i BgrToU8(__m256i b8, __m256i g8, __m256i r8)
         {
             return _mm256_packus_epi16(
-                BgrToU16(_mm256_unpacklo_epi8(b8, K_ZERO), _mm256_unpacklo_epi8(g8, K_ZERO), _mm256_unpacklo_epi8(r8, K_ZERO)),
-                BgrToU16(_mm256_unpackhi_epi8(b8, K_ZERO), _mm256_unpackhi_epi8(g8, K_ZERO), _mm256_unpackhi_epi8(r8, K_ZERO)));
+                BgrToU16<T>(_mm256_unpacklo_epi8(b8, K_ZERO), _mm256_unpacklo_epi8(g8, K_ZERO), _mm256_unpacklo_epi8(r8, K_ZERO)),
+                BgrToU16<T>(_mm256_unpackhi_epi8(b8, K_ZERO), _mm256_unpackhi_epi8(g8, K_ZERO), _mm256_unpackhi_epi8(r8, K_ZERO)));
         }
 
-        SIMD_INLINE __m256i BgrToV32(__m256i b16_r16, __m256i g16_1)
+        template <class T = Base::Bt601> SIMD_INLINE __m256i BgrToV32(__m256i b16_r16, __m256i g16_1)
         {
-            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(b16_r16, K16_BV_RV),
-                _mm256_madd_epi16(g16_1, K16_GV_RT)), Base::BGR_TO_YUV_AVERAGING_SHIFT);
+            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(b16_r16, SetInt16(T::BLUE_TO_V_WEIGHT, T::RED_TO_V_WEIGHT)),
+                _mm256_madd_epi16(g16_1, SetInt16(T::GREEN_TO_V_WEIGHT, Base::BGR_TO_YUV_ROUND_TERM))), Base::BGR_TO_YUV_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m256i BgrToV16(__m256i b16, __m256i g16, __m256i r16)
+        template <class T = Base::Bt601> SIMD_INLINE __m256i BgrToV16(__m256i b16, __m256i g16, __m256i r16)
         {
             return SaturateI16ToU8(_mm256_add_epi16(K16_UV_ADJUST, _mm256_packs_epi32(
-                BgrToV32(_mm256_unpacklo_epi16(b16, r16), _mm256_unpacklo_epi16(g16, K16_0001)),
-                BgrToV32(_mm256_unpackhi_epi16(b16, r16), _mm256_unpackhi_epi16(g16, K16_0001)))));
+                BgrToV32<T>(_mm256_unpacklo_epi16(b16, r16), _mm256_unpacklo_epi16(g16, K16_0001)),
+                BgrToV32<T>(_mm256_unpackhi_epi16(b16, r16), _mm256_unpackhi_epi16(g16, K16_0001)))));
         }
 
-        SIMD_INLINE __m256i BgrToV8(__m256i b8, __m256i g8, __m256i r8)
+        template <class T = Base::Bt601> SIMD_INLINE __m256i BgrToV8(__m256i b8, __m256i g8, __m256i r8)
         {
             return _mm256_packus_epi16(
-                BgrToV16(_mm256_unpacklo_epi8(b8, K_ZERO), _mm256_unpacklo_epi8(g8, K_ZERO), _mm256_unpacklo_epi8(r8, K_ZERO)),
-                BgrToV16(_mm256_unpackhi_epi8(b8, K_ZERO), _mm256_unpackhi_epi8(g8, K_ZERO), _mm256_unpackhi_epi8(r8, K_ZERO)));
+                BgrToV16<T>(_mm256_unpacklo_epi8(b8, K_ZERO), _mm256_unpacklo_epi8(g8, K_ZERO), _mm256_unpacklo_epi8(r8, K_ZERO)),
+                BgrToV16<T>(_mm256_unpackhi_epi8(b8, K_ZERO), _mm256_unpackhi_epi8(g8, K_ZERO), _mm256_unpackhi_epi8(r8, K_ZERO)));
         }
 
         template <int index> __m256i GrayToBgr(__m256i gray);
@@ -700,16 +871,28 @@ namespace Simd
                         _mm256_permute2x128_si256(r0, r2, 0x31)));
         }
 
-        template<bool tail> __m256i BgrToBgra(const __m256i & bgr, const __m256i & alpha);
+        template<bool tail, bool rgb = false> SIMD_INLINE __m256i BgrToBgra(const __m256i & bgr, const __m256i & alpha)
+        {
+            return _mm256_or_si256(_mm256_shuffle_epi8(_mm256_permute4x64_epi64(bgr, tail ? 0xE9 : 0x94),
+                rgb ? K8_BGR_TO_RGBA_SHUFFLE : K8_BGRA_TO_BGR_SHUFFLE), alpha);
+        }
 
-        template<> SIMD_INLINE __m256i BgrToBgra<false>(const __m256i & bgr, const __m256i & alpha)
+        template <bool align, bool nv21> SIMD_INLINE void LoadPermutedUv(const uint8_t * uv, __m256i & u, __m256i & v)
         {
-            return _mm256_or_si256(_mm256_shuffle_epi8(_mm256_permute4x64_epi64(bgr, 0x94), K8_BGRA_TO_BGR_SHUFFLE), alpha);
+            __m256i uv0 = Load<align>((__m256i*)uv + 0);
+            __m256i uv1 = Load<align>((__m256i*)uv + 1);
+            __m256i even = _mm256_packus_epi16(_mm256_and_si256(uv0, K16_00FF), _mm256_and_si256(uv1, K16_00FF));
+            __m256i odd = _mm256_packus_epi16(_mm256_srli_epi16(uv0, 8), _mm256_srli_epi16(uv1, 8));
+            u = nv21 ? odd : even;
+            v = nv21 ? even : odd;
         }
 
-        template<> SIMD_INLINE __m256i BgrToBgra<true>(const __m256i & bgr, const __m256i & alpha)
+        template <bool align, bool nv21> SIMD_INLINE void StoreUv(uint8_t * uv, __m256i u, __m256i v)
         {
-            return _mm256_or_si256(_mm256_shuffle_epi8(_mm256_permute4x64_epi64(bgr, 0xE9), K8_BGRA_TO_BGR_SHUFFLE), alpha);
+            __m256i even = _mm256_permute4x64_epi64(nv21 ? v : u, 0xD8);
+            __m256i odd = _mm256_permute4x64_epi64(nv21 ? u : v, 0xD8);
+            Store<align>((__m256i*)uv + 0, _mm256_unpacklo_epi8(even, odd));
+            Store<align>((__m256i*)uv + 1, _mm256_unpackhi_epi8(even, odd));
         }
     }
 #endif// SIMD_AVX2_ENABLE
@@ -717,9 +900,9 @@ namespace Simd
 #ifdef SIMD_AVX512BW_ENABLE    
     namespace Avx512bw
     {
-        SIMD_INLINE __m512i AdjustY16(__m512i y16)
+        template <class T = Base::Bt601> SIMD_INLINE __m512i AdjustY16(__m512i y16)
         {
-            return _mm512_subs_epi16(y16, K16_Y_ADJUST);
+            return _mm512_subs_epi16(y16, _mm512_set1_epi16(T::Y_ADJUST));
         }
 
         SIMD_INLINE __m512i AdjustUV16(__m512i uv16)
@@ -727,76 +910,76 @@ namespace Simd
             return _mm512_subs_epi16(uv16, K16_UV_ADJUST);
         }
 
-        SIMD_INLINE __m512i AdjustedYuvToRed32(__m512i y16_1, __m512i v16_0)
+        template <class T = Base::Bt601> SIMD_INLINE __m512i AdjustedYuvToRed32(__m512i y16_1, __m512i v16_0)
         {
-            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(y16_1, K16_YRGB_RT),
-                _mm512_madd_epi16(v16_0, K16_VR_0)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(y16_1, SetInt16(T::Y_TO_RGB_WEIGHT, Base::YUV_TO_BGR_ROUND_TERM)),
+                _mm512_madd_epi16(v16_0, SetInt16(T::V_TO_RED_WEIGHT, 0))), Base::YUV_TO_BGR_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m512i AdjustedYuvToRed16(__m512i y16, __m512i v16)
+        template <class T = Base::Bt601> SIMD_INLINE __m512i AdjustedYuvToRed16(__m512i y16, __m512i v16)
         {
             return SaturateI16ToU8(_mm512_packs_epi32(
-                AdjustedYuvToRed32(_mm512_unpacklo_epi16(y16, K16_0001), _mm512_unpacklo_epi16(v16, K_ZERO)),
-                AdjustedYuvToRed32(_mm512_unpackhi_epi16(y16, K16_0001), _mm512_unpackhi_epi16(v16, K_ZERO))));
+                AdjustedYuvToRed32<T>(_mm512_unpacklo_epi16(y16, K16_0001), _mm512_unpacklo_epi16(v16, K_ZERO)),
+                AdjustedYuvToRed32<T>(_mm512_unpackhi_epi16(y16, K16_0001), _mm512_unpackhi_epi16(v16, K_ZERO))));
         }
 
-        SIMD_INLINE __m512i AdjustedYuvToGreen32(__m512i y16_1, __m512i u16_v16)
+        template <class T = Base::Bt601> SIMD_INLINE __m512i AdjustedYuvToGreen32(__m512i y16_1, __m512i u16_v16)
         {
-            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(y16_1, K16_YRGB_RT),
-                _mm512_madd_epi16(u16_v16, K16_UG_VG)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(y16_1, SetInt16(T::Y_TO_RGB_WEIGHT, Base::YUV_TO_BGR_ROUND_TERM)),
+                _mm512_madd_epi16(u16_v16, SetInt16(T::U_TO_GREEN_WEIGHT, T::V_TO_GREEN_WEIGHT))), Base::YUV_TO_BGR_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m512i AdjustedYuvToGreen16(__m512i y16, __m512i u16, __m512i v16)
+        template <class T = Base::Bt601> SIMD_INLINE __m512i AdjustedYuvToGreen16(__m512i y16, __m512i u16, __m512i v16)
         {
             return SaturateI16ToU8(_mm512_packs_epi32(
-                AdjustedYuvToGreen32(_mm512_unpacklo_epi16(y16, K16_0001), _mm512_unpacklo_epi16(u16, v16)),
-                AdjustedYuvToGreen32(_mm512_unpackhi_epi16(y16, K16_0001), _mm512_unpackhi_epi16(u16, v16))));
+                AdjustedYuvToGreen32<T>(_mm512_unpacklo_epi16(y16, K16_0001), _mm512_unpacklo_epi16(u16, v16)),
+                AdjustedYuvToGreen32<T>(_mm512_unpackhi_epi16(y16, K16_0001), _mm512_unpackhi_epi16(u16, v16))));
         }
 
-        SIMD_INLINE __m512i AdjustedYuvToBlue32(__m512i y16_1, __m512i u16_0)
+        template <class T = Base::Bt601> SIMD_INLINE __m512i AdjustedYuvToBlue32(__m512i y16_1, __m512i u16_0)
         {
-            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(y16_1, K16_YRGB_RT),
-                _mm512_madd_epi16(u16_0, K16_UB_0)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(y16_1, SetInt16(T::Y_TO_RGB_WEIGHT, Base::YUV_TO_BGR_ROUND_TERM)),
+                _mm512_madd_epi16(u16_0, SetInt16(T::U_TO_BLUE_WEIGHT, 0))), Base::YUV_TO_BGR_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m512i AdjustedYuvToBlue16(__m512i y16, __m512i u16)
+        template <class T = Base::Bt601> SIMD_INLINE __m512i AdjustedYuvToBlue16(__m512i y16, __m512i u16)
         {
             return SaturateI16ToU8(_mm512_packs_epi32(
-                AdjustedYuvToBlue32(_mm512_unpacklo_epi16(y16, K16_0001), _mm512_unpacklo_epi16(u16, K_ZERO)),
-                AdjustedYuvToBlue32(_mm512_unpackhi_epi16(y16, K16_0001), _mm512_unpackhi_epi16(u16, K_ZERO))));
+                AdjustedYuvToBlue32<T>(_mm512_unpacklo_epi16(y16, K16_0001), _mm512_unpacklo_epi16(u16, K_ZERO)),
+                AdjustedYuvToBlue32<T>(_mm512_unpackhi_epi16(y16, K16_0001), _mm512_unpackhi_epi16(u16, K_ZERO))));
         }
 
-        SIMD_INLINE __m512i YuvToRed(__m512i y, __m512i v)
+        template <class T = Base::Bt601> SIMD_INLINE __m512i YuvToRed(__m512i y, __m512i v)
         {
-            __m512i lo = AdjustedYuvToRed16(
-                AdjustY16(_mm512_unpacklo_epi8(y, K_ZERO)),
+            __m512i lo = AdjustedYuvToRed16<T>(
+                AdjustY16<T>(_mm512_unpacklo_epi8(y, K_ZERO)),
                 AdjustUV16(_mm512_unpacklo_epi8(v, K_ZERO)));
-            __m512i hi = AdjustedYuvToRed16(
-                AdjustY16(_mm512_unpackhi_epi8(y, K_ZERO)),
+            __m512i hi = AdjustedYuvToRed16<T>(
+                AdjustY16<T>(_mm512_unpackhi_epi8(y, K_ZERO)),
                 AdjustUV16(_mm512_unpackhi_epi8(v, K_ZERO)));
             return _mm512_packus_epi16(lo, hi);
         }
 
-        SIMD_INLINE __m512i YuvToGreen(__m512i y, __m512i u, __m512i v)
+        template <class T = Base::Bt601> SIMD_INLINE __m512i YuvToGreen(__m512i y, __m512i u, __m512i v)
         {
-            __m512i lo = AdjustedYuvToGreen16(
-                AdjustY16(_mm512_unpacklo_epi8(y, K_ZERO)),
+            __m512i lo = AdjustedYuvToGreen16<T>(
+                AdjustY16<T>(_mm512_unpacklo_epi8(y, K_ZERO)),
                 AdjustUV16(_mm512_unpacklo_epi8(u, K_ZERO)),
                 AdjustUV16(_mm512_unpacklo_epi8(v, K_ZERO)));
-            __m512i hi = AdjustedYuvToGreen16(
-                AdjustY16(_mm512_unpackhi_epi8(y, K_ZERO)),
+            __m512i hi = AdjustedYuvToGreen16<T>(
+                AdjustY16<T>(_mm512_unpackhi_epi8(y, K_ZERO)),
                 AdjustUV16(_mm512_unpackhi_epi8(u, K_ZERO)),
                 AdjustUV16(_mm512_unpackhi_epi8(v, K_ZERO)));
             return _mm512_packus_epi16(lo, hi);
         }
 
-        SIMD_INLINE __m512i YuvToBlue(__m512i y, __m512i u)
+        template <class T = Base::Bt601> SIMD_INLINE __m512i YuvToBlue(__m512i y, __m512i u)
         {
-            __m512i lo = AdjustedYuvToBlue16(
-                AdjustY16(_mm512_unpacklo_epi8(y, K_ZERO)),
+            __m512i lo = AdjustedYuvToBlue16<T>(
+                AdjustY16<T>(_mm512_unpacklo_epi8(y, K_ZERO)),
                 AdjustUV16(_mm512_unpacklo_epi8(u, K_ZERO)));
-            __m512i hi = AdjustedYuvToBlue16(
-                AdjustY16(_mm512_unpackhi_epi8(y, K_ZERO)),
+            __m512i hi = AdjustedYuvToBlue16<T>(
+                AdjustY16<T>(_mm512_unpackhi_epi8(y, K_ZERO)),
                 AdjustUV16(_mm512_unpackhi_epi8(u, K_ZERO)));
             return _mm512_packus_epi16(lo, hi);
         }
@@ -818,22 +1001,22 @@ namespace Simd
             return _mm512_shuffle_epi8(_mm512_shuffle_i64x2(gray, gray, 0xFE), K8_SHUFFLE_GRAY_TO_BGR2);
         }
 
-        SIMD_INLINE __m512i BgrToY32(__m512i b16_r16, __m512i g16_1)
+        template <class T = Base::Bt601> SIMD_INLINE __m512i BgrToY32(__m512i b16_r16, __m512i g16_1)
         {
-            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(b16_r16, K16_BY_RY),
-                _mm512_madd_epi16(g16_1, K16_GY_RT)), Base::BGR_TO_YUV_AVERAGING_SHIFT);
+            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(b16_r16, SetInt16(T::BLUE_TO_Y_WEIGHT, T::RED_TO_Y_WEIGHT)),
+                _mm512_madd_epi16(g16_1, SetInt16(T::GREEN_TO_Y_WEIGHT, Base::BGR_TO_YUV_ROUND_TERM))), Base::BGR_TO_YUV_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m512i BgrToU32(__m512i b16_r16, __m512i g16_1)
+        template <class T = Base::Bt601> SIMD_INLINE __m512i BgrToU32(__m512i b16_r16, __m512i g16_1)
         {
-            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(b16_r16, K16_BU_RU),
-                _mm512_madd_epi16(g16_1, K16_GU_RT)), Base::BGR_TO_YUV_AVERAGING_SHIFT);
+            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(b16_r16, SetInt16(T::BLUE_TO_U_WEIGHT, T::RED_TO_U_WEIGHT)),
+                _mm512_madd_epi16(g16_1, SetInt16(T::GREEN_TO_U_WEIGHT, Base::BGR_TO_YUV_ROUND_TERM))), Base::BGR_TO_YUV_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m512i BgrToV32(__m512i b16_r16, __m512i g16_1)
+        template <class T = Base::Bt601> SIMD_INLINE __m512i BgrToV32(__m512i b16_r16, __m512i g16_1)
         {
-            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(b16_r16, K16_BV_RV),
-                _mm512_madd_epi16(g16_1, K16_GV_RT)), Base::BGR_TO_YUV_AVERAGING_SHIFT);
+            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(b16_r16, SetInt16(T::BLUE_TO_V_WEIGHT, T::RED_TO_V_WEIGHT)),
+                _mm512_madd_epi16(g16_1, SetInt16(T::GREEN_TO_V_WEIGHT, Base::BGR_TO_YUV_ROUND_TERM))), Base::BGR_TO_YUV_AVERAGING_SHIFT);
         }
 
         template <int index> __m512i InterleaveBgr(__m512i blue, __m512i green, __m512i red);
@@ -861,6 +1044,24 @@ namespace Simd
                     _mm512_or_si512(_mm512_shuffle_epi8(_mm512_permutexvar_epi32(K32_PERMUTE_COLOR_TO_BGR2, green), K8_SHUFFLE_GREEN_TO_BGR2),
                         _mm512_shuffle_epi8(_mm512_permutexvar_epi32(K32_PERMUTE_COLOR_TO_BGR2, red), K8_SHUFFLE_RED_TO_BGR2)));
         }
+
+        template <bool align, bool mask, bool nv21> SIMD_INLINE void LoadPermutedUv(const uint8_t * uv, __m512i & u, __m512i & v, __mmask64 m0, __mmask64 m1)
+        {
+            __m512i uv0 = Load<align, mask>(uv + 0, m0);
+            __m512i uv1 = Load<align, mask>(uv + A, m1);
+            __m512i even = _mm512_packus_epi16(_mm512_and_si512(uv0, K16_00FF), _mm512_and_si512(uv1, K16_00FF));
+            __m512i odd = _mm512_packus_epi16(_mm512_srli_epi16(uv0, 8), _mm512_srli_epi16(uv1, 8));
+            u = nv21 ? odd : even;
+            v = nv21 ? even : odd;
+        }
+
+        template <bool align, bool mask, bool nv21> SIMD_INLINE void StoreUv(uint8_t * uv, __m512i u, __m512i v, __mmask64 m0, __mmask64 m1)
+        {
+            __m512i even = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, nv21 ? v : u);
+            __m512i odd = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, nv21 ? u : v);
+            Store<align, mask>(uv + 0, _mm512_unpacklo_epi8(even, odd), m0);
+            Store<align, mask>(uv + A, _mm512_unpackhi_epi8(even, odd), m1);
+        }
     }
 #endif//SIMD_AVX512BW_ENABLE 
 
@@ -1039,63 +1240,63 @@ namespace Simd
             return PackU32(BgrToGray<0>(blue, green, red), BgrToGray<1>(blue, green, red));
         }
 
-        template <int part> SIMD_INLINE int32x4_t BgrToY(uint16x8_t blue, uint16x8_t green, uint16x8_t red)
+        template <int part, class T = Base::Bt601> SIMD_INLINE int32x4_t BgrToY(uint16x8_t blue, uint16x8_t green, uint16x8_t red)
         {
-            return vshrq_n_s32(vmlal_s16(vmlal_s16(vmlal_s16(K32_BGR_TO_YUV_ROUND_TERM, (int16x4_t)Half<part>(blue), K16_BLUE_TO_Y_WEIGHT),
-                (int16x4_t)Half<part>(green), K16_GREEN_TO_Y_WEIGHT), (int16x4_t)Half<part>(red), K16_RED_TO_Y_WEIGHT), Base::BGR_TO_YUV_AVERAGING_SHIFT);
+            return vshrq_n_s32(vmlal_s16(vmlal_s16(vmlal_s16(K32_BGR_TO_YUV_ROUND_TERM, (int16x4_t)Half<part>(blue), vdup_n_s16(T::BLUE_TO_Y_WEIGHT)),
+                (int16x4_t)Half<part>(green), vdup_n_s16(T::GREEN_TO_Y_WEIGHT)), (int16x4_t)Half<part>(red), vdup_n_s16(T::RED_TO_Y_WEIGHT)), Base::BGR_TO_YUV_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE int16x8_t BgrToY(uint16x8_t blue, uint16x8_t green, uint16x8_t red)
+        template <class T = Base::Bt601> SIMD_INLINE int16x8_t BgrToY(uint16x8_t blue, uint16x8_t green, uint16x8_t red)
         {
-            return vaddq_s16(K16_Y_ADJUST, PackI32(BgrToY<0>(blue, green, red), BgrToY<1>(blue, green, red)));
+            return vaddq_s16(vdupq_n_s16(T::Y_ADJUST), PackI32(BgrToY<0, T>(blue, green, red), BgrToY<1, T>(blue, green, red)));
         }
 
-        SIMD_INLINE uint8x16_t BgrToY(uint8x16_t blue, uint8x16_t green, uint8x16_t red)
+        template <class T = Base::Bt601> SIMD_INLINE uint8x16_t BgrToY(uint8x16_t blue, uint8x16_t green, uint8x16_t red)
         {
             return PackSaturatedI16(
-                BgrToY(UnpackU8<0>(blue), UnpackU8<0>(green), UnpackU8<0>(red)),
-                BgrToY(UnpackU8<1>(blue), UnpackU8<1>(green), UnpackU8<1>(red)));
+                BgrToY<T>(UnpackU8<0>(blue), UnpackU8<0>(green), UnpackU8<0>(red)),
+                BgrToY<T>(UnpackU8<1>(blue), UnpackU8<1>(green), UnpackU8<1>(red)));
         }
 
-        template <int part> SIMD_INLINE int32x4_t BgrToU(uint16x8_t blue, uint16x8_t green, uint16x8_t red)
+        template <int part, class T = Base::Bt601> SIMD_INLINE int32x4_t BgrToU(uint16x8_t blue, uint16x8_t green, uint16x8_t red)
         {
-            return vshrq_n_s32(vmlal_s16(vmlal_s16(vmlal_s16(K32_BGR_TO_YUV_ROUND_TERM, (int16x4_t)Half<part>(blue), K16_BLUE_TO_U_WEIGHT),
-                (int16x4_t)Half<part>(green), K16_GREEN_TO_U_WEIGHT), (int16x4_t)Half<part>(red), K16_RED_TO_U_WEIGHT), Base::BGR_TO_YUV_AVERAGING_SHIFT);
+            return vshrq_n_s32(vmlal_s16(vmlal_s16(vmlal_s16(K32_BGR_TO_YUV_ROUND_TERM, (int16x4_t)Half<part>(blue), vdup_n_s16(T::BLUE_TO_U_WEIGHT)),
+                (int16x4_t)Half<part>(green), vdup_n_s16(T::GREEN_TO_U_WEIGHT)), (int16x4_t)Half<part>(red), vdup_n_s16(T::RED_TO_U_WEIGHT)), Base::BGR_TO_YUV_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE int16x8_t BgrToU(uint16x8_t blue, uint16x8_t green, uint16x8_t red)
+        template <class T = Base::Bt601> SIMD_INLINE int16x8_t BgrToU(uint16x8_t blue, uint16x8_t green, uint16x8_t red)
         {
-            return vaddq_s16(K16_UV_ADJUST, PackI32(BgrToU<0>(blue, green, red), BgrToU<1>(blue, green, red)));
+            return vaddq_s16(K16_UV_ADJUST, PackI32(BgrToU<0, T>(blue, green, red), BgrToU<1, T>(blue, green, red)));
         }
 
-        SIMD_INLINE uint8x16_t BgrToU(uint8x16_t blue, uint8x16_t green, uint8x16_t red)
+        template <class T = Base::Bt601> SIMD_INLINE uint8x16_t BgrToU(uint8x16_t blue, uint8x16_t green, uint8x16_t red)
         {
             return PackSaturatedI16(
-                BgrToU(UnpackU8<0>(blue), UnpackU8<0>(green), UnpackU8<0>(red)),
-                BgrToU(UnpackU8<1>(blue), UnpackU8<1>(green), UnpackU8<1>(red)));
+                BgrToU<T>(UnpackU8<0>(blue), UnpackU8<0>(green), UnpackU8<0>(red)),
+                BgrToU<T>(UnpackU8<1>(blue), UnpackU8<1>(green), UnpackU8<1>(red)));
         }
 
-        template <int part> SIMD_INLINE int32x4_t BgrToV(uint16x8_t blue, uint16x8_t green, uint16x8_t red)
+        template <int part, class T = Base::Bt601> SIMD_INLINE int32x4_t BgrToV(uint16x8_t blue, uint16x8_t green, uint16x8_t red)
         {
-            return vshrq_n_s32(vmlal_s16(vmlal_s16(vmlal_s16(K32_BGR_TO_YUV_ROUND_TERM, (int16x4_t)Half<part>(blue), K16_BLUE_TO_V_WEIGHT),
-                (int16x4_t)Half<part>(green), K16_GREEN_TO_V_WEIGHT), (int16x4_t)Half<part>(red), K16_RED_TO_V_WEIGHT), Base::BGR_TO_YUV_AVERAGING_SHIFT);
+            return vshrq_n_s32(vmlal_s16(vmlal_s16(vmlal_s16(K32_BGR_TO_YUV_ROUND_TERM, (int16x4_t)Half<part>(blue), vdup_n_s16(T::BLUE_TO_V_WEIGHT)),
+                (int16x4_t)Half<part>(green), vdup_n_s16(T::GREEN_TO_V_WEIGHT)), (int16x4_t)Half<part>(red), vdup_n_s16(T::RED_TO_V_WEIGHT)), Base::BGR_TO_YUV_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE int16x8_t BgrToV(uint16x8_t blue, uint16x8_t green, uint16x8_t red)
+        template <class T = Base::Bt601> SIMD_INLINE int16x8_t BgrToV(uint16x8_t blue, uint16x8_t green, uint16x8_t red)
         {
-            return vaddq_s16(K16_UV_ADJUST, PackI32(BgrToV<0>(blue, green, red), BgrToV<1>(blue, green, red)));
+            return vaddq_s16(K16_UV_ADJUST, PackI32(BgrToV<0, T>(blue, green, red), BgrToV<1, T>(blue, green, red)));
         }
 
-        SIMD_INLINE uint8x16_t BgrToV(uint8x16_t blue, uint8x16_t green, uint8x16_t red)
+        template <class T = Base::Bt601> SIMD_INLINE uint8x16_t BgrToV(uint8x16_t blue, uint8x16_t green, uint8x16_t red)
         {
             return PackSaturatedI16(
-                BgrToV(UnpackU8<0>(blue), UnpackU8<0>(green), UnpackU8<0>(red)),
-                BgrToV(UnpackU8<1>(blue), UnpackU8<1>(green), UnpackU8<1>(red)));
+                BgrToV<T>(UnpackU8<0>(blue), UnpackU8<0>(green), UnpackU8<0>(red)),
+                BgrToV<T>(UnpackU8<1>(blue), UnpackU8<1>(green), UnpackU8<1>(red)));
         }
 
-        template <int part> SIMD_INLINE int16x8_t AdjustY(uint8x16_t y)
+        template <int part, class T = Base::Bt601> SIMD_INLINE int16x8_t AdjustY(uint8x16_t y)
         {
-            return vsubq_s16((int16x8_t)UnpackU8<part>(y), K16_Y_ADJUST);
+            return vsubq_s16((int16x8_t)UnpackU8<part>(y), vdupq_n_s16(T::Y_ADJUST));
         }
 
         template <int part> SIMD_INLINE int16x8_t AdjustUV(uint8x16_t uv)
@@ -1103,62 +1304,77 @@ namespace Simd
             return vsubq_s16((int16x8_t)UnpackU8<part>(uv), K16_UV_ADJUST);
         }
 
-        template <int part> SIMD_INLINE int32x4_t YuvToRed(int16x8_t y, int16x8_t v)
+        template <int part, class T = Base::Bt601> SIMD_INLINE int32x4_t YuvToRed(int16x8_t y, int16x8_t v)
+        {
+            return vshrq_n_s32(vmlal_s16(vmlal_s16(K32_YUV_TO_BGR_ROUND_TERM, Half<part>(y), vdup_n_s16(T::Y_TO_RGB_WEIGHT)),
+                Half<part>(v), vdup_n_s16(T::V_TO_RED_WEIGHT)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE int16x8_t YuvToRed(int16x8_t y, int16x8_t v)
+        {
+            return PackI32(YuvToRed<0, T>(y, v), YuvToRed<1, T>(y, v));
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE uint8x16_t YuvToRed(uint8x16_t y, uint8x16_t v)
         {
-            return vshrq_n_s32(vmlal_s16(vmlal_s16(K32_YUV_TO_BGR_ROUND_TERM, Half<part>(y), K16_Y_TO_RGB_WEIGHT),
-                Half<part>(v), K16_V_TO_RED_WEIGHT), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+            return PackSaturatedI16(YuvToRed<T>(AdjustY<0, T>(y), AdjustUV<0>(v)), YuvToRed<T>(AdjustY<1, T>(y), AdjustUV<1>(v)));
         }
 
-        SIMD_INLINE int16x8_t YuvToRed(int16x8_t y, int16x8_t v)
+        template <int part, class T = Base::Bt601> SIMD_INLINE int32x4_t YuvToGreen(int16x8_t y, int16x8_t u, int16x8_t v)
         {
-            return PackI32(YuvToRed<0>(y, v), YuvToRed<1>(y, v));
+            return vshrq_n_s32(vmlal_s16(vmlal_s16(vmlal_s16(K32_YUV_TO_BGR_ROUND_TERM, Half<part>(y), vdup_n_s16(T::Y_TO_RGB_WEIGHT)),
+                Half<part>(u), vdup_n_s16(T::U_TO_GREEN_WEIGHT)), Half<part>(v), vdup_n_s16(T::V_TO_GREEN_WEIGHT)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE uint8x16_t YuvToRed(uint8x16_t y, uint8x16_t v)
+        template <class T = Base::Bt601> SIMD_INLINE int16x8_t YuvToGreen(int16x8_t y, int16x8_t u, int16x8_t v)
         {
-            return PackSaturatedI16(YuvToRed(AdjustY<0>(y), AdjustUV<0>(v)), YuvToRed(AdjustY<1>(y), AdjustUV<1>(v)));
+            return PackI32(YuvToGreen<0, T>(y, u, v), YuvToGreen<1, T>(y, u, v));
         }
 
-        template <int part> SIMD_INLINE int32x4_t YuvToGreen(int16x8_t y, int16x8_t u, int16x8_t v)
+        template <class T = Base::Bt601> SIMD_INLINE uint8x16_t YuvToGreen(uint8x16_t y, uint8x16_t u, uint8x16_t v)
         {
-            return vshrq_n_s32(vmlal_s16(vmlal_s16(vmlal_s16(K32_YUV_TO_BGR_ROUND_TERM, Half<part>(y), K16_Y_TO_RGB_WEIGHT),
-                Half<part>(u), K16_U_TO_GREEN_WEIGHT), Half<part>(v), K16_V_TO_GREEN_WEIGHT), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+            return PackSaturatedI16(YuvToGreen<T>(AdjustY<0, T>(y), AdjustUV<0>(u), AdjustUV<0>(v)),
+                YuvToGreen<T>(AdjustY<1, T>(y), AdjustUV<1>(u), AdjustUV<1>(v)));
         }
 
-        SIMD_INLINE int16x8_t YuvToGreen(int16x8_t y, int16x8_t u, int16x8_t v)
+        template <int part, class T = Base::Bt601> SIMD_INLINE int32x4_t YuvToBlue(int16x8_t y, int16x8_t u)
         {
-            return PackI32(YuvToGreen<0>(y, u, v), YuvToGreen<1>(y, u, v));
+            return vshrq_n_s32(vmlal_s16(vmlal_s16(K32_YUV_TO_BGR_ROUND_TERM, Half<part>(y), vdup_n_s16(T::Y_TO_RGB_WEIGHT)),
+                Half<part>(u), vdup_n_s16(T::U_TO_BLUE_WEIGHT)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE uint8x16_t YuvToGreen(uint8x16_t y, uint8x16_t u, uint8x16_t v)
+        template <class T = Base::Bt601> SIMD_INLINE int16x8_t YuvToBlue(int16x8_t y, int16x8_t u)
         {
-            return PackSaturatedI16(YuvToGreen(AdjustY<0>(y), AdjustUV<0>(u), AdjustUV<0>(v)),
-                YuvToGreen(AdjustY<1>(y), AdjustUV<1>(u), AdjustUV<1>(v)));
+            return PackI32(YuvToBlue<0, T>(y, u), YuvToBlue<1, T>(y, u));
         }
 
-        template <int part> SIMD_INLINE int32x4_t YuvToBlue(int16x8_t y, int16x8_t u)
+        template <class T = Base::Bt601> SIMD_INLINE uint8x16_t YuvToBlue(uint8x16_t y, uint8x16_t u)
         {
-            return vshrq_n_s32(vmlal_s16(vmlal_s16(K32_YUV_TO_BGR_ROUND_TERM, Half<part>(y), K16_Y_TO_RGB_WEIGHT),
-                Half<part>(u), K16_U_TO_BLUE_WEIGHT), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+            return PackSaturatedI16(YuvToBlue<T>(AdjustY<0, T>(y), AdjustUV<0>(u)), YuvToBlue<T>(AdjustY<1, T>(y), AdjustUV<1>(u)));
         }
 
-        SIMD_INLINE int16x8_t YuvToBlue(int16x8_t y, int16x8_t u)
+        template <class T = Base::Bt601> SIMD_INLINE void YuvToBgr(uint8x16_t y, uint8x16_t u, uint8x16_t v, uint8x16x3_t & bgr)
         {
-            return PackI32(YuvToBlue<0>(y, u), YuvToBlue<1>(y, u));
+            int16x8_t yLo = AdjustY<0, T>(y), uLo = AdjustUV<0>(u), vLo = AdjustUV<0>(v);
+            int16x8_t yHi = AdjustY<1, T>(y), uHi = AdjustUV<1>(u), vHi = AdjustUV<1>(v);
+            bgr.val[0] = PackSaturatedI16(YuvToBlue<T>(yLo, uLo), YuvToBlue<T>(yHi, uHi));
+            bgr.val[1] = PackSaturatedI16(YuvToGreen<T>(yLo, uLo, vLo), YuvToGreen<T>(yHi, uHi, vHi));
+            bgr.val[2] = PackSaturatedI16(YuvToRed<T>(yLo, vLo), YuvToRed<T>(yHi, vHi));
         }
 
-        SIMD_INLINE uint8x16_t YuvToBlue(uint8x16_t y, uint8x16_t u)
+        template <bool align, bool nv21> SIMD_INLINE void LoadUv(const uint8_t * uv, uint8x16_t & u, uint8x16_t & v)
         {
-            return PackSaturatedI16(YuvToBlue(AdjustY<0>(y), AdjustUV<0>(u)), YuvToBlue(AdjustY<1>(y), AdjustUV<1>(u)));
+            uint8x16x2_t _uv = Load2<align>(uv);
+            u = _uv.val[nv21 ? 1 : 0];
+            v = _uv.val[nv21 ? 0 : 1];
         }
 
-        SIMD_INLINE void YuvToBgr(uint8x16_t y, uint8x16_t u, uint8x16_t v, uint8x16x3_t & bgr)
+        template <bool align, bool nv21> SIMD_INLINE void StoreUv(uint8_t * uv, uint8x16_t u, uint8x16_t v)
         {
-            int16x8_t yLo = AdjustY<0>(y), uLo = AdjustUV<0>(u), vLo = AdjustUV<0>(v);
-            int16x8_t yHi = AdjustY<1>(y), uHi = AdjustUV<1>(u), vHi = AdjustUV<1>(v);
-            bgr.val[0] = PackSaturatedI16(YuvToBlue(yLo, uLo), YuvToBlue(yHi, uHi));
-            bgr.val[1] = PackSaturatedI16(YuvToGreen(yLo, uLo, vLo), YuvToGreen(yHi, uHi, vHi));
-            bgr.val[2] = PackSaturatedI16(YuvToRed(yLo, vLo), YuvToRed(yHi, vHi));
+            uint8x16x2_t _uv;
+            _uv.val[nv21 ? 1 : 0] = u;
+            _uv.val[nv21 ? 0 : 1] = v;
+            Store2<align>(uv, _uv);
         }
     }
 #endif// SIMD_NEON_ENABLE
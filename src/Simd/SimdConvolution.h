@@ -110,6 +110,15 @@ namespace Simd
 #endif
     };
 
+    namespace Base
+    {
+        float * ConvolutionScratch(size_t size);
+
+        size_t ConvolutionScratchPeak();
+
+        void ConvolutionScratchRelease();
+    }
+
     class Convolution : public Deletable
     {
     public:
@@ -130,7 +139,7 @@ namespace Simd
 
         virtual size_t InternalBufferSize() const
         {
-            return _buffer.size + _nhwcWeight.size;
+            return _nhwcWeight.size;
         }
 
         virtual void SetParams(const float * weight, SimdBool trans, SimdBool * internal, const float * bias, const float * params)
@@ -150,10 +159,7 @@ namespace Simd
             if (buffer)
                 return buffer;
             else
-            {
-                _buffer.Resize(ExternalBufferSize());
-                return _buffer.data;
-            }
+                return Base::ConvolutionScratch(ExternalBufferSize());
         }
 
     protected:
@@ -162,7 +168,6 @@ namespace Simd
         typedef void(*BiasAndActivation)(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, SimdBool trans, float * dst);
 
         ConvParam _param;
-        Array32f _buffer;
         float _0, _1;
         const float * _weight, * _bias, * _params;
         RuntimeGemm _gemm;
@@ -132,11 +132,23 @@ namespace Simd
             WeightedRect rect[Data::HaarFeature::RECT_NUM];
         };
 
+        struct WeightedRect16i
+        {
+            uint16_t *p0, *p1, *p2, *p3;
+            int weight;
+        };
+
+        struct HidHaarFeature16i
+        {
+            WeightedRect16i rect[Data::HaarFeature::RECT_NUM];
+        };
+
         struct HidHaarStage
         {
             int first;
             int ntrees;
             float threshold;
+            int ithreshold;
             bool hasThree;
             bool canSkip;
         };
@@ -147,6 +159,7 @@ namespace Simd
             int left;
             int right;
             float threshold;
+            int ithreshold;
         };
 
         struct HidHaarCascade : public HidBase
@@ -172,14 +185,21 @@ namespace Simd
             typedef int ILeave;
             typedef std::vector<ILeave> ILeaves;
 
+            typedef HidHaarFeature16i IFeature;
+            typedef std::vector<IFeature> IFeatures;
+
             Nodes nodes;
             Trees trees;
             Stages stages;
             Leaves leaves;
             Features features;
 
+            ILeaves ileaves;
+            IFeatures ifeatures;
+            int ishift;
+            float inorm;
+
             float windowArea;
-            float invWinArea;
             uint32_t *pq[4];
             uint32_t *p[4];
 
@@ -284,7 +304,7 @@ namespace Simd
 
         SIMD_INLINE int Norm16i(const HidHaarCascade & hid, size_t offset)
         {
-            return Simd::Round(Norm32f(hid, offset)*hid.invWinArea);
+            return int(Norm32f(hid, offset)*hid.inorm + 0.5f);
         }
 
         SIMD_INLINE float WeightedSum32f(const WeightedRect & rect, size_t offset)
@@ -295,6 +315,18 @@ namespace Simd
 
         int Detect32f(const struct HidHaarCascade & hid, size_t offset, int startStage, float norm);
 
+        SIMD_INLINE int WeightedSum16i(const WeightedRect16i & rect, size_t offset)
+        {
+            return rect.weight*int16_t(rect.p0[offset] - rect.p1[offset] - rect.p2[offset] + rect.p3[offset]);
+        }
+
+        SIMD_INLINE int Threshold16i(int threshold, int norm)
+        {
+            return (threshold * norm + 0x4000) >> 15;
+        }
+
+        int Detect16i(const struct HidHaarCascade & hid, size_t offset, int startStage, int norm);
+
         template< class T> SIMD_INLINE T IntegralSum(const T * p0, const T * p1, const T * p2, const T * p3, ptrdiff_t offset)
         {
             return p0[offset] - p1[offset] - p2[offset] + p3[offset];
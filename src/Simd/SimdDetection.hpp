@@ -30,6 +30,7 @@
 #include <vector>
 #include <map>
 #include <memory>
+#include <atomic>
 
 #include <limits.h>
 
@@ -221,16 +222,22 @@ namespace Simd
         */
         bool Load(const std::string & path, Tag tag = UNDEFINED_OBJECT_TAG)
         {
-            Handle handle = ::SimdDetectionLoadA(path.c_str());
-            if (handle)
-            {
-                Data data;
-                data.handle = handle;
-                data.tag = tag;
-                ::SimdDetectionInfo(handle, (size_t*)&data.size.x, (size_t*)&data.size.y, &data.flags);
-                _data.push_back(data);
-            }
-            return handle != NULL;
+            return Insert(::SimdDetectionLoadA(path.c_str()), tag);
+        }
+
+        /*!
+            Loads classifier cascade from memory buffer with binary cascade format (See ::SimdDetectionSaveBinary).
+            It allows to avoid parsing of XML files. The buffer can point to memory mapped file.
+            You can call this function more than once if you want to use several object detectors at the same time.
+
+            \param [in] buffer - a pointer to buffer with binary cascade.
+            \param [in] size - a size of the buffer.
+            \param [in] tag - an user defined tag. This tag will be inserted in output Object structure.
+            \return a result of this operation.
+        */
+        bool Load(const void * buffer, size_t size, Tag tag = UNDEFINED_OBJECT_TAG)
+        {
+            return Insert(::SimdDetectionLoadBinary(buffer, size), tag);
         }
 
         /*!
@@ -244,14 +251,19 @@ namespace Simd
             \param [in] roi - a 8-bit image mask which defines Region Of Interest. User can restricts detection region with using this mask.
                               The mask affects to the center of detected object.
             \param [in] threadNumber - a number of work threads. It useful for multi core CPU. Use value -1 to auto choose of thread number.
+                              Pyramid levels, loaded cascades and row bands inside them are processed as independent tasks distributed between work threads.
+            \param [in] haarInt16 - a flag to use 16-bit integer evaluation (::SimdDetectionHaarDetect16ip, ::SimdDetectionHaarDetect16ii) for HAAR cascades
+                              which allow it (::SimdDetectionInfoCanInt16 flag). It is faster on AVX2 and AVX-512BW but its results can slightly differ
+                              from 32-bit float evaluation. There are no SSE4.1 and NEON optimizations of it. By default it is switched off.
             \return a result of this operation.
         */
         bool Init(const Size & imageSize, double scaleFactor = 1.1, const Size & sizeMin = Size(0, 0),
-            const Size & sizeMax = Size(INT_MAX, INT_MAX), const View & roi = View(), ptrdiff_t threadNumber = -1)
+            const Size & sizeMax = Size(INT_MAX, INT_MAX), const View & roi = View(), ptrdiff_t threadNumber = -1, bool haarInt16 = false)
         {
             if (_data.empty())
                 return false;
             _imageSize = imageSize;
+            _haarInt16 = haarInt16;
             ptrdiff_t threadNumberMax = std::thread::hardware_concurrency();
             _threadNumber = (threadNumber <= 0 || threadNumber > threadNumberMax) ? threadNumberMax : threadNumber;
             return InitLevels(scaleFactor, sizeMin, sizeMax, roi);
@@ -277,7 +289,14 @@ namespace Simd
             if (_levels.empty() || src.Size() != _imageSize)
                 return false;
 
-            FillLevels(src);
+            FillLevels(src, motionMask, motionRegions);
+
+            Tasks tasks;
+            CreateTasks(tasks);
+            Run(tasks.size(), [&](size_t i)
+            {
+                tasks[i].hid->Detect(tasks[i].top, tasks[i].bottom);
+            });
 
             typedef std::map<Tag, Objects> Candidates;
             Candidates candidates;
@@ -285,22 +304,12 @@ namespace Simd
             for (size_t i = 0; i < _levels.size(); ++i)
             {
                 Level & level = *_levels[i];
-                View mask = level.roi;
-                Rect rect = level.rect;
-                if (motionMask)
-                {
-                    FillMotionMask(motionRegions, level, rect);
-                    mask = level.mask;
-                }
-                if (rect.Empty())
+                if (level.active.Empty())
                     continue;
                 for (size_t j = 0; j < level.hids.size(); ++j)
                 {
                     Hid & hid = level.hids[j];
-
-                    hid.Detect(mask, rect, level.dst, _threadNumber, level.throughColumn);
-
-                    AddObjects(candidates[hid.data->tag], level.dst, rect, hid.data->size, level.scale,
+                    AddObjects(candidates[hid.data->tag], hid.dst, level.active, hid.data->size, level.scale,
                         level.throughColumn ? 2 : 1, hid.data->tag);
                 }
             }
@@ -325,7 +334,7 @@ namespace Simd
 
             bool Haar() const { return (flags&::SimdDetectionInfoFeatureMask) == ::SimdDetectionInfoFeatureHaar; }
             bool Tilted() const { return (flags&::SimdDetectionInfoHasTilted) != 0; }
-            bool Int16() const { return (flags&::SimdDetectionInfoCanInt16) != 0; }
+            bool Int16(bool haarInt16) const { return (flags&::SimdDetectionInfoCanInt16) != 0 && (haarInt16 || !Haar()); }
         };
 
         typedef void(*DetectPtr)(const void * hid, const uint8_t * mask, size_t maskStride,
@@ -341,24 +350,35 @@ namespace Simd
             Data * data;
             DetectPtr detect;
 
-            void Detect(const View & mask, const Rect & rect, View & dst, size_t threadNumber, bool throughColumn)
-            {
-                SIMD_CHECK_PERFORMANCE();
+            View dst;
+            View mask;
+            Rect rect;
 
+            void SetRegion(const View & m, const Rect & r)
+            {
                 Size s = dst.Size() - data->size;
-                View m = mask.Region(s, View::MiddleCenter);
-                Rect r = rect.Shifted(-data->size / 2).Intersection(Rect(s));
-                Simd::Fill(dst, 0);
-                ::SimdDetectionPrepare(handle);
+                mask = m.Region(s, View::MiddleCenter);
+                rect = r.Shifted(-data->size / 2).Intersection(Rect(s));
+                if (!rect.Empty())
+                    Simd::Fill(dst.Region(rect).Ref(), 0);
+            }
 
-                Parallel(r.top, r.bottom, [&](size_t thread, size_t begin, size_t end)
-                {
-                    detect(handle, m.data, m.stride, r.left, begin, r.right, end, dst.data, dst.stride);
-                }, rect.Area() >= (data->Haar() ? 10000 : 30000) ? threadNumber : 1, throughColumn ? 2 : 1);
+            void Detect(ptrdiff_t top, ptrdiff_t bottom)
+            {
+                SIMD_CHECK_PERFORMANCE();
+
+                detect(handle, mask.data, mask.stride, rect.left, top, rect.right, bottom, dst.data, dst.stride);
             }
         };
         typedef std::vector<Hid> Hids;
 
+        struct Task
+        {
+            Hid * hid;
+            ptrdiff_t top, bottom;
+        };
+        typedef std::vector<Task> Tasks;
+
         struct Level
         {
             Hids hids;
@@ -369,6 +389,7 @@ namespace Simd
             View mask;
 
             Rect rect;
+            Rect active;
 
             View sum;
             View sqsum;
@@ -393,8 +414,22 @@ namespace Simd
         Size _imageSize;
         bool _needNormalization;
         ptrdiff_t _threadNumber;
+        bool _haarInt16;
         LevelPtrs _levels;
 
+        bool Insert(Handle handle, Tag tag)
+        {
+            if (handle)
+            {
+                Data data;
+                data.handle = handle;
+                data.tag = tag;
+                ::SimdDetectionInfo(handle, (size_t*)&data.size.x, (size_t*)&data.size.y, &data.flags);
+                _data.push_back(data);
+            }
+            return handle != NULL;
+        }
+
         bool InitLevels(double scaleFactor, const Size & sizeMin, const Size & sizeMax, const View & roi)
         {
             _needNormalization = false;
@@ -436,25 +471,29 @@ namespace Simd
                     level.sqsum.Recreate(scaledSize + Size(1, 1), View::Int32);
                     level.tilted.Recreate(scaledSize + Size(1, 1), View::Int32);
 
-                    level.dst.Recreate(scaledSize, View::Gray8);
-
                     level.needSqsum = false, level.needTilted = false;
                     for (size_t i = 0; i < _data.size(); ++i)
                     {
                         if (!inserts[i])
                             continue;
+                        bool int16 = _data[i].Int16(_haarInt16);
                         Handle handle = ::SimdDetectionInit(_data[i].handle, level.sum.data, level.sum.stride, level.sum.width, level.sum.height,
-                            level.sqsum.data, level.sqsum.stride, level.tilted.data, level.tilted.stride, level.throughColumn, _data[i].Int16());
+                            level.sqsum.data, level.sqsum.stride, level.tilted.data, level.tilted.stride, level.throughColumn, int16);
                         if (handle)
                         {
                             Hid hid;
                             hid.handle = handle;
                             hid.data = &_data[i];
                             if (_data[i].Haar())
-                                hid.detect = level.throughColumn ? ::SimdDetectionHaarDetect32fi : ::SimdDetectionHaarDetect32fp;
+                            {
+                                if (int16)
+                                    hid.detect = level.throughColumn ? ::SimdDetectionHaarDetect16ii : ::SimdDetectionHaarDetect16ip;
+                                else
+                                    hid.detect = level.throughColumn ? ::SimdDetectionHaarDetect32fi : ::SimdDetectionHaarDetect32fp;
+                            }
                             else
                             {
-                                if (_data[i].Int16())
+                                if (int16)
                                     hid.detect = level.throughColumn ? ::SimdDetectionLbpDetect16ii : ::SimdDetectionLbpDetect16ip;
                                 else
                                     hid.detect = level.throughColumn ? ::SimdDetectionLbpDetect32fi : ::SimdDetectionLbpDetect32fp;
@@ -468,6 +507,10 @@ namespace Simd
                         _needNormalization = _needNormalization | _data[i].Haar();
                     }
 
+                    level.dst.Recreate(scaledSize.x, scaledSize.y * level.hids.size(), View::Gray8);
+                    for (size_t i = 0; i < level.hids.size(); ++i)
+                        level.hids[i].dst = level.dst.Region(0, scaledSize.y * i, scaledSize.x, scaledSize.y * (i + 1));
+
                     level.rect = Rect(level.roi.Size());
                     if (roi.format == View::None)
                         Simd::Fill(level.roi, 255);
@@ -483,7 +526,7 @@ namespace Simd
             return !_levels.empty();
         }
 
-        void FillLevels(View src)
+        void FillLevels(View src, bool motionMask, const Rects & motionRegions)
         {
             View gray;
             if (src.format != View::Gray8)
@@ -493,42 +536,143 @@ namespace Simd
                 src = gray;
             }
 
+            if (motionMask && motionRegions.empty())
+            {
+                for (size_t i = 0; i < _levels.size(); ++i)
+                    _levels[i]->active = Rect();
+                return;
+            }
+
             Simd::ResizeBilinear(src, _levels[0]->src);
             if (_needNormalization)
                 Simd::NormalizeHistogram(_levels[0]->src, _levels[0]->src);
-            EstimateIntegral(*_levels[0]);
-            for (size_t i = 1; i < _levels.size(); ++i)
+
+            Run(_levels.size(), [&](size_t i)
+            {
+                Level & level = *_levels[i];
+                View mask = level.roi;
+                level.active = level.rect;
+                if (motionMask)
+                {
+                    FillMotionMask(motionRegions, level, level.active);
+                    mask = level.mask;
+                }
+                if (level.active.Empty())
+                    return;
+
+                ptrdiff_t top = level.src.height, bottom = 0;
+                for (size_t j = 0; j < level.hids.size(); ++j)
+                {
+                    Hid & hid = level.hids[j];
+                    hid.SetRegion(mask, level.active);
+                    if (hid.rect.Empty())
+                        continue;
+                    top = std::min(top, hid.rect.top);
+                    bottom = std::max(bottom, hid.rect.bottom - 1 + hid.data->size.y);
+                }
+                if (top >= bottom)
+                    return;
+
+                if (i)
+                    Simd::ResizeBilinear(_levels[0]->src, level.src);
+                EstimateIntegral(level, top, bottom);
+                for (size_t j = 0; j < level.hids.size(); ++j)
+                    ::SimdDetectionPrepare(level.hids[j].handle);
+            });
+        }
+
+        void CreateTasks(Tasks & tasks)
+        {
+            const size_t TASKS_PER_THREAD = 4;
+            double total = 0;
+            for (size_t i = 0; i < _levels.size(); ++i)
             {
-                Simd::ResizeBilinear(_levels[0]->src, _levels[i]->src);
-                EstimateIntegral(*_levels[i]);
+                Level & level = *_levels[i];
+                if (level.active.Empty())
+                    continue;
+                for (size_t j = 0; j < level.hids.size(); ++j)
+                    total += Cost(level, level.hids[j], level.hids[j].rect.Height());
+            }
+            double cost = total / (_threadNumber * TASKS_PER_THREAD);
+            for (size_t i = 0; i < _levels.size(); ++i)
+            {
+                Level & level = *_levels[i];
+                if (level.active.Empty())
+                    continue;
+                ptrdiff_t step = level.throughColumn ? 2 : 1;
+                for (size_t j = 0; j < level.hids.size(); ++j)
+                {
+                    Hid & hid = level.hids[j];
+                    if (hid.rect.Empty())
+                        continue;
+                    double rowCost = Cost(level, hid, 1);
+                    ptrdiff_t height = std::max<ptrdiff_t>(ptrdiff_t(cost / rowCost), 1);
+                    height = (height + step - 1) / step * step;
+                    for (ptrdiff_t top = hid.rect.top; top < hid.rect.bottom; top += height)
+                    {
+                        Task task;
+                        task.hid = &hid;
+                        task.top = top;
+                        task.bottom = std::min(top + height, hid.rect.bottom);
+                        tasks.push_back(task);
+                    }
+                }
             }
         }
 
-        void EstimateIntegral(Level & level)
+        SIMD_INLINE double Cost(const Level & level, const Hid & hid, ptrdiff_t height) const
         {
+            return double(hid.rect.Width() * height) / (level.throughColumn ? 4.0 : 1.0) * (hid.data->Haar() ? 3.0 : 1.0);
+        }
+
+        template<class Function> void Run(size_t count, Function function)
+        {
+            std::atomic<size_t> next(0);
+            Parallel(0, _threadNumber, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t i = next++; i < count; i = next++)
+                    function(i);
+            }, std::min<size_t>(_threadNumber, count));
+        }
+
+        void EstimateIntegral(Level & level, ptrdiff_t top, ptrdiff_t bottom)
+        {
+            // Cascades use only differences of integral values inside of a window,
+            // so it is enough to estimate integrals for rows which are covered by windows.
+            View src = level.src.Region(0, top, level.src.width, bottom);
+            View sum = level.sum.Region(0, top, level.sum.width, bottom + 1);
             if (level.needSqsum)
             {
+                View sqsum = level.sqsum.Region(0, top, level.sqsum.width, bottom + 1);
                 if (level.needTilted)
-                    Simd::Integral(level.src, level.sum, level.sqsum, level.tilted);
+                {
+                    View tilted = level.tilted.Region(0, top, level.tilted.width, bottom + 1);
+                    Simd::Integral(src, sum, sqsum, tilted);
+                }
                 else
-                    Simd::Integral(level.src, level.sum, level.sqsum);
+                    Simd::Integral(src, sum, sqsum);
             }
             else
-                Simd::Integral(level.src, level.sum);
+                Simd::Integral(src, sum);
         }
 
         void FillMotionMask(const Rects & rects, Level & level, Rect & rect) const
         {
-            Simd::Fill(level.mask, 0);
             rect = Rect();
+            for (size_t i = 0; i < rects.size(); i++)
+                rect |= rects[i] / level.scale;
+            rect &= level.rect;
+            if (rect.Empty())
+                return;
+            View mask = level.mask.Region(rect);
+            Simd::Fill(mask, 0);
             for (size_t i = 0; i < rects.size(); i++)
             {
-                Rect r = rects[i] / level.scale;
-                rect |= r;
-                Simd::Fill(level.mask.Region(r).Ref(), 0xFF);
+                Rect r = (rects[i] / level.scale).Intersection(rect);
+                if (!r.Empty())
+                    Simd::Fill(level.mask.Region(r).Ref(), 0xFF);
             }
-            rect &= level.rect;
-            Simd::OperationBinary8u(level.mask, level.roi, level.mask, SimdOperationBinary8uAnd);
+            Simd::OperationBinary8u(mask, level.roi.Region(rect), mask, SimdOperationBinary8uAnd);
         }
 
         void AddObjects(Objects & objects, const View & dst, const Rect & rect, const Size & size, double scale, size_t step, Tag tag)
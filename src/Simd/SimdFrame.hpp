@@ -25,6 +25,7 @@
 #define __SimdFrame_hpp__
 
 #include "Simd/SimdLib.hpp"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -60,6 +61,16 @@ namespace Simd
             Bgr24,
             /*! One plane 8-bit gray pixel format. */
             Gray8,
+            /*! Three planes (16-bit full size Y plane, 16-bit half size U plane, 16-bit half size V plane) YUV420P10LE pixel format (10-bit samples are aligned to least significant bit). */
+            Yuv420p10,
+            /*! Three planes (16-bit full size Y plane, 16-bit half size U plane, 16-bit half size V plane) YUV420P12LE pixel format (12-bit samples are aligned to least significant bit). */
+            Yuv420p12,
+            /*! Three planes (16-bit full size Y plane, 16-bit half size U plane, 16-bit half size V plane) YUV420P16LE pixel format. */
+            Yuv420p16,
+            /*! Two planes (16-bit full size Y plane, 32-bit interlived half size UV plane) P010 pixel format (10-bit samples are aligned to most significant bit). */
+            P010,
+            /*! Two planes (16-bit full size Y plane, 32-bit interlived half size UV plane) P016 pixel format. */
+            P016,
         };
 
         const size_t width; /*!< \brief A width of the frame. */
@@ -273,6 +284,16 @@ namespace Simd
         */
         static size_t PlaneCount(Format format);
 
+        /*!
+            \fn size_t BitDepth(Format format);
+
+            Gets bit depth of samples in the frame planes for current pixel format.
+
+            \param [in] format - a pixel format.
+            \return - a bit depth of samples.
+        */
+        static size_t BitDepth(Format format);
+
         /*!
             Gets number of planes for current frame.
 
@@ -320,16 +341,75 @@ namespace Simd
 
     /*! @ingroup cpp_frame_functions
 
-        \fn template <template<class> class A> void Convert(const Frame<A> & src, Frame<A> & dst);
+        \fn template <template<class> class A> void Convert(const Frame<A> & src, Frame<A> & dst, Frame<A> * buffer = NULL);
 
         \short Converts one frame to another frame.
 
-        The frames must have the same width and height.
+        The frames must have the same width and height. Any pair of supported formats can be converted. When bit depth is reduced
+        the samples are rounded, when it is increased the samples are shifted to the left (P010 and P016 samples are aligned to most significant bit).
+        The frames are processed by bands of rows in parallel if thread number (see ::SimdSetThreadNumber) is greater than 1.
+
+        Conversion of Simd::Frame::Bgra32 and Simd::Frame::Bgr24 to high bit depth formats goes through an intermediate Simd::Frame::Yuv420p frame.
+        It is allocated for every call unless the caller passes it in the parameter buffer.
+
+        \param [in] src - an input frame.
+        \param [out] dst - an output frame.
+        \param [in, out] buffer - a pointer to an optional intermediate frame. It is recreated only when its size or format does not match. Can be NULL.
+    */
+    template <template<class> class A> void Convert(const Frame<A> & src, Frame<A> & dst, Frame<A> * buffer = NULL);
+
+    /*! @ingroup cpp_frame_functions
+
+        \fn template <template<class> class A> void Crop(const Frame<A> & src, const Rectangle<ptrdiff_t> & rect, Frame<A> & dst);
+
+        \short Copies a rectangular region of one frame to another frame.
+
+        The frames must have the same format. For multiplanar formats the region is expanded to even coordinates (see Simd::Frame::Region),
+        so chroma planes are cropped at the same position as the luma plane. The output frame must have the size of the expanded region.
+
+        \note All planes are processed in one multithreaded call (see functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] src - an input frame.
+        \param [in] rect - a region of the input frame.
+        \param [out] dst - an output frame.
+    */
+    template <template<class> class A> void Crop(const Frame<A> & src, const Rectangle<ptrdiff_t> & rect, Frame<A> & dst);
+
+    /*! @ingroup cpp_frame_functions
+
+        \fn template <template<class> class A> void ResizeBilinear(const Frame<A> & src, Frame<A> & dst, bool centerSitedChroma = false);
+
+        \short Performs resizing of input frame with using bilinear interpolation.
+
+        The frames must have the same 8-bit format (Simd::Frame::Nv12, Simd::Frame::Yuv420p, Simd::Frame::Bgra32, Simd::Frame::Bgr24 or Simd::Frame::Gray8).
+        Every plane is resized separately without conversion to BGR (see function ::SimdResizeBilinearRows). Chroma samples keep their position relative
+        to luma samples: by default they are co-sited with the left luma column (MPEG-2 siting, which is used by H.264 and HEVC),
+        and they are placed between luma columns for center-sited chroma (JPEG, MPEG-1).
+
+        \note Rows of all planes are split into bands which are processed in one multithreaded call (see functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] src - an original input frame.
+        \param [out] dst - a resized output frame.
+        \param [in] centerSitedChroma - a flag of center-sited chroma. By default it is false (MPEG-2 siting).
+    */
+    template <template<class> class A> void ResizeBilinear(const Frame<A> & src, Frame<A> & dst, bool centerSitedChroma = false);
+
+    /*! @ingroup cpp_frame_functions
+
+        \fn template <template<class> class A> void TransformImage(const Frame<A> & src, ::SimdTransformType transform, Frame<A> & dst);
+
+        \short Performs transformation (rotation by 90, 180, 270 degrees, transposition or mirroring) of input frame.
+
+        The frames must have the same format. The size of output frame must be equal to Simd::TransformSize(src.Size(), transform).
+        Every plane is transformed separately without conversion to BGR, so 2x2 chroma blocks of multiplanar formats stay bound to the same luma samples.
+
+        \note All planes are processed in one multithreaded call (see functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
 
         \param [in] src - an input frame.
+        \param [in] transform - a type of frame transformation.
         \param [out] dst - an output frame.
     */
-    template <template<class> class A> void Convert(const Frame<A> & src, Frame<A> & dst);
+    template <template<class> class A> void TransformImage(const Frame<A> & src, ::SimdTransformType transform, Frame<A> & dst);
 
     //-------------------------------------------------------------------------
 
@@ -425,6 +505,20 @@ namespace Simd
         case Gray8:
             planes[0] = View<A>(width, height, stride0, View<A>::Gray8, data0);
             break;
+        case Yuv420p10:
+        case Yuv420p12:
+        case Yuv420p16:
+            assert((width & 1) == 0 && (height & 1) == 0);
+            planes[0] = View<A>(width, height, stride0, View<A>::Int16, data0);
+            planes[1] = View<A>(width / 2, height / 2, stride1, View<A>::Int16, data1);
+            planes[2] = View<A>(width / 2, height / 2, stride2, View<A>::Int16, data2);
+            break;
+        case P010:
+        case P016:
+            assert((width & 1) == 0 && (height & 1) == 0);
+            planes[0] = View<A>(width, height, stride0, View<A>::Int16, data0);
+            planes[1] = View<A>(width / 2, height / 2, stride1, View<A>::Uv32, data1);
+            break;
         }
     }
 
@@ -492,6 +586,20 @@ namespace Simd
         case Gray8:
             planes[0].Recreate(width, height, View<A>::Gray8);
             break;
+        case Yuv420p10:
+        case Yuv420p12:
+        case Yuv420p16:
+            assert((width & 1) == 0 && (height & 1) == 0);
+            planes[0].Recreate(width, height, View<A>::Int16);
+            planes[1].Recreate(width / 2, height / 2, View<A>::Int16);
+            planes[2].Recreate(width / 2, height / 2, View<A>::Int16);
+            break;
+        case P010:
+        case P016:
+            assert((width & 1) == 0 && (height & 1) == 0);
+            planes[0].Recreate(width, height, View<A>::Int16);
+            planes[1].Recreate(width / 2, height / 2, View<A>::Uv32);
+            break;
         }
     }
 
@@ -515,7 +623,7 @@ namespace Simd
             right = std::min<ptrdiff_t>(std::max<ptrdiff_t>(right, 0), width);
             bottom = std::min<ptrdiff_t>(std::max<ptrdiff_t>(bottom, 0), height);
 
-            if (format == Nv12 || format == Yuv420p)
+            if (PlaneCount() > 1)
             {
                 left = left & ~1;
                 top = top & ~1;
@@ -532,10 +640,10 @@ namespace Simd
 
             frame.planes[0] = planes[0].Region(left, top, right, bottom);
 
-            if (format == Nv12 || format == Yuv420p)
+            if (PlaneCount() > 1)
                 frame.planes[1] = planes[1].Region(left / 2, top / 2, right / 2, bottom / 2);
 
-            if (format == Yuv420p)
+            if (PlaneCount() > 2)
                 frame.planes[2] = planes[2].Region(left / 2, top / 2, right / 2, bottom / 2);
 
             return frame;
@@ -599,16 +707,34 @@ namespace Simd
     {
         switch (format)
         {
-        case None:    return 0;
-        case Nv12:    return 2;
-        case Yuv420p: return 3;
-        case Bgra32:  return 1;
-        case Bgr24:   return 1;
-        case Gray8:   return 1;
+        case None:      return 0;
+        case Nv12:      return 2;
+        case Yuv420p:   return 3;
+        case Bgra32:    return 1;
+        case Bgr24:     return 1;
+        case Gray8:     return 1;
+        case Yuv420p10: return 3;
+        case Yuv420p12: return 3;
+        case Yuv420p16: return 3;
+        case P010:      return 2;
+        case P016:      return 2;
         default: assert(0); return 0;
         }
     }
 
+    template <template<class> class A> SIMD_INLINE size_t Frame<A>::BitDepth(Format format)
+    {
+        switch (format)
+        {
+        case Yuv420p10: return 10;
+        case Yuv420p12: return 12;
+        case Yuv420p16: return 16;
+        case P010:      return 10;
+        case P016:      return 16;
+        default:        return 8;
+        }
+    }
+
     template <template<class> class A> SIMD_INLINE size_t Frame<A>::PlaneCount() const
     {
         return PlaneCount(format);
@@ -641,13 +767,88 @@ namespace Simd
         }
     }
 
-    template <template<class> class A> SIMD_INLINE void Convert(const Frame<A> & src, Frame<A> & dst)
+    template <template<class> class A> SIMD_INLINE size_t SampleBitDepth(typename Frame<A>::Format format)
     {
-        assert(EqualSize(src, dst) && src.format && dst.format && src.flipped == dst.flipped);
+        return format == Frame<A>::P010 || format == Frame<A>::P016 ? 16 : Frame<A>::BitDepth(format);
+    }
 
-        if (src.format == dst.format)
+    template <template<class> class A> SIMD_INLINE bool IsYuv(typename Frame<A>::Format format)
+    {
+        return format != Frame<A>::Bgra32 && format != Frame<A>::Bgr24 && format != Frame<A>::Gray8;
+    }
+
+    template <template<class> class A> SIMD_INLINE void ConvertYuvToYuv(const Frame<A> & src, Frame<A> & dst)
+    {
+        size_t srcDepth = SampleBitDepth<A>(src.format), dstDepth = SampleBitDepth<A>(dst.format);
+        bool msb = dst.format == Frame<A>::P010 && srcDepth > 10;
+        if (msb)
+            dstDepth = 10;
+
+        if (srcDepth == dstDepth)
+            Copy(src.planes[0], dst.planes[0]);
+        else
+            ChangeBitDepth(src.planes[0], srcDepth, dst.planes[0], dstDepth);
+
+        if (src.PlaneCount() == dst.PlaneCount())
         {
-            Copy(src, dst);
+            for (size_t i = 1; i < src.PlaneCount(); ++i)
+            {
+                if (srcDepth == dstDepth)
+                    Copy(src.planes[i], dst.planes[i]);
+                else
+                    ChangeBitDepth(src.planes[i], srcDepth, dst.planes[i], dstDepth);
+            }
+        }
+        else if (src.PlaneCount() == 3)
+        {
+            if (srcDepth == 8 && dstDepth == 8)
+                InterleaveUv(src.planes[1], src.planes[2], dst.planes[1]);
+            else
+                InterleaveUvBitDepth(src.planes[1], src.planes[2], srcDepth, dst.planes[1], dstDepth);
+        }
+        else
+        {
+            if (srcDepth == 8 && dstDepth == 8)
+                DeinterleaveUv(src.planes[1], dst.planes[1], dst.planes[2]);
+            else
+                DeinterleaveUvBitDepth(src.planes[1], srcDepth, dst.planes[1], dst.planes[2], dstDepth);
+        }
+
+        if (msb)
+        {
+            for (size_t i = 0; i < dst.PlaneCount(); ++i)
+                ChangeBitDepth(dst.planes[i], 10, dst.planes[i], 16);
+        }
+    }
+
+    template <template<class> class A> SIMD_INLINE void ConvertGrayToYuv(const Frame<A> & src, Frame<A> & dst)
+    {
+        size_t depth = SampleBitDepth<A>(dst.format);
+        if (depth == 8)
+        {
+            Copy(src.planes[0], dst.planes[0]);
+            for (size_t i = 1; i < dst.PlaneCount(); ++i)
+                Fill(dst.planes[i], 128);
+        }
+        else
+        {
+            uint16_t value = uint16_t(128 << (depth - 8));
+            ChangeBitDepth(src.planes[0], 8, dst.planes[0], depth);
+            if (dst.PlaneCount() == 3)
+            {
+                FillPixel(dst.planes[1], value);
+                FillPixel(dst.planes[2], value);
+            }
+            else
+                FillPixel(dst.planes[1], uint32_t(value) | (uint32_t(value) << 16));
+        }
+    }
+
+    template <template<class> class A> SIMD_INLINE void ConvertBand(const Frame<A> & src, Frame<A> & dst, uint8_t * yuv16Buffer = NULL)
+    {
+        if (IsYuv<A>(src.format) && IsYuv<A>(dst.format))
+        {
+            ConvertYuvToYuv(src, dst);
             return;
         }
 
@@ -656,24 +857,12 @@ namespace Simd
         case Frame<A>::Nv12:
             switch (dst.format)
             {
-            case Frame<A>::Yuv420p:
-                Copy(src.planes[0], dst.planes[0]);
-                DeinterleaveUv(src.planes[1], dst.planes[1], dst.planes[2]);
-                break;
             case Frame<A>::Bgra32:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
-                Yuv420pToBgra(src.planes[0], u, v, dst.planes[0]);
+                Nv12ToBgra(src.planes[0], src.planes[1], dst.planes[0]);
                 break;
-            }
             case Frame<A>::Bgr24:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
-                Yuv420pToBgr(src.planes[0], u, v, dst.planes[0]);
+                Nv12ToBgr(src.planes[0], src.planes[1], dst.planes[0]);
                 break;
-            }
             case Frame<A>::Gray8:
                 Copy(src.planes[0], dst.planes[0]);
                 break;
@@ -685,10 +874,6 @@ namespace Simd
         case Frame<A>::Yuv420p:
             switch (dst.format)
             {
-            case Frame<A>::Nv12:
-                Copy(src.planes[0], dst.planes[0]);
-                InterleaveUv(src.planes[1], src.planes[2], dst.planes[1]);
-                break;
             case Frame<A>::Bgra32:
                 Yuv420pToBgra(src.planes[0], src.planes[1], src.planes[2], dst.planes[0]);
                 break;
@@ -707,12 +892,8 @@ namespace Simd
             switch (dst.format)
             {
             case Frame<A>::Nv12:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                BgraToYuv420p(src.planes[0], dst.planes[0], u, v);
-                InterleaveUv(u, v, dst.planes[1]);
+                BgraToNv12(src.planes[0], dst.planes[0], dst.planes[1]);
                 break;
-            }
             case Frame<A>::Yuv420p:
                 BgraToYuv420p(src.planes[0], dst.planes[0], dst.planes[1], dst.planes[2]);
                 break;
@@ -731,12 +912,8 @@ namespace Simd
             switch (dst.format)
             {
             case Frame<A>::Nv12:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                BgrToYuv420p(src.planes[0], dst.planes[0], u, v);
-                InterleaveUv(u, v, dst.planes[1]);
+                BgrToNv12(src.planes[0], dst.planes[0], dst.planes[1]);
                 break;
-            }
             case Frame<A>::Yuv420p:
                 BgrToYuv420p(src.planes[0], dst.planes[0], dst.planes[1], dst.planes[2]);
                 break;
@@ -754,20 +931,49 @@ namespace Simd
         case Frame<A>::Gray8:
             switch (dst.format)
             {
-            case Frame<A>::Nv12:
-                Copy(src.planes[0], dst.planes[0]);
-                Fill(dst.planes[1], 128);
-            case Frame<A>::Yuv420p:
-                Copy(src.planes[0], dst.planes[0]);
-                Fill(dst.planes[1], 128);
-                Fill(dst.planes[2], 128);
-                break;
             case Frame<A>::Bgra32:
                 GrayToBgra(src.planes[0], dst.planes[0]);
                 break;
             case Frame<A>::Bgr24:
                 GrayToBgr(src.planes[0], dst.planes[0]);
                 break;
+            default:
+                ConvertGrayToYuv(src, dst);
+            }
+            break;
+
+        case Frame<A>::Yuv420p10:
+        case Frame<A>::Yuv420p12:
+        case Frame<A>::Yuv420p16:
+            switch (dst.format)
+            {
+            case Frame<A>::Bgra32:
+                Yuv420p16ToBgra(src.planes[0], src.planes[1], src.planes[2], Frame<A>::BitDepth(src.format), dst.planes[0], 0xFF, false, SimdYuvBt601, yuv16Buffer);
+                break;
+            case Frame<A>::Bgr24:
+                Yuv420p16ToBgr(src.planes[0], src.planes[1], src.planes[2], Frame<A>::BitDepth(src.format), dst.planes[0], false, SimdYuvBt601, yuv16Buffer);
+                break;
+            case Frame<A>::Gray8:
+                Uint16ToGray(src.planes[0], Frame<A>::BitDepth(src.format), dst.planes[0]);
+                break;
+            default:
+                assert(0);
+            }
+            break;
+
+        case Frame<A>::P010:
+        case Frame<A>::P016:
+            switch (dst.format)
+            {
+            case Frame<A>::Bgra32:
+                P016ToBgra(src.planes[0], src.planes[1], dst.planes[0], 0xFF, false, SimdYuvBt601, yuv16Buffer);
+                break;
+            case Frame<A>::Bgr24:
+                P016ToBgr(src.planes[0], src.planes[1], dst.planes[0], false, SimdYuvBt601, yuv16Buffer);
+                break;
+            case Frame<A>::Gray8:
+                Uint16ToGray(src.planes[0], 16, dst.planes[0]);
+                break;
             default:
                 assert(0);
             }
@@ -777,6 +983,116 @@ namespace Simd
             assert(0);
         }
     }
+
+    template <template<class> class A> SIMD_INLINE void Convert(const Frame<A> & src, Frame<A> & dst, Frame<A> * buffer)
+    {
+        assert(EqualSize(src, dst) && src.format && dst.format && src.flipped == dst.flipped);
+
+        if (src.format == dst.format)
+        {
+            Copy(src, dst);
+            return;
+        }
+
+        Frame<A> local;
+        if ((src.format == Frame<A>::Bgra32 || src.format == Frame<A>::Bgr24) && Frame<A>::BitDepth(dst.format) > 8)
+        {
+            if (buffer == NULL)
+                buffer = &local;
+            if (buffer->format != Frame<A>::Yuv420p || !EqualSize(*buffer, src))
+                buffer->Recreate(src.width, src.height, Frame<A>::Yuv420p);
+        }
+        else
+            buffer = NULL;
+
+        const size_t threadNumber = SimdGetThreadNumber();
+        size_t yuv16Size = 0;
+        std::vector<uint8_t, A<uint8_t>> yuv16;
+        if (Frame<A>::BitDepth(src.format) > 8 && (dst.format == Frame<A>::Bgra32 || dst.format == Frame<A>::Bgr24))
+        {
+            yuv16Size = ::SimdYuv16BufferSize(src.width);
+            yuv16.resize(yuv16Size * threadNumber);
+        }
+
+        Parallel(0, (src.height + 1) / 2, [&](size_t thread, size_t begin, size_t end)
+        {
+            Rectangle<ptrdiff_t> band(0, begin * 2, src.width, std::min(end * 2, src.height));
+            Frame<A> s = src.Region(band), d = dst.Region(band);
+            if (buffer)
+            {
+                Frame<A> b = buffer->Region(band);
+                ConvertBand(s, b);
+                ConvertYuvToYuv(b, d);
+            }
+            else
+                ConvertBand(s, d, yuv16Size ? yuv16.data() + thread * yuv16Size : NULL);
+        }, threadNumber, 16);
+    }
+
+    template <template<class> class A, class Function> SIMD_INLINE void ForEachFrameBand(const Frame<A> & frame, Function function)
+    {
+        const size_t planeCount = frame.PlaneCount(), step = planeCount > 1 ? 2 : 1;
+        Parallel(0, (frame.height + step - 1) / step, [&](size_t thread, size_t begin, size_t end)
+        {
+            for (size_t i = 0; i < planeCount; ++i)
+            {
+                size_t scale = i ? 1 : step, height = frame.planes[i].height;
+                size_t rowBeg = std::min(begin * scale, height), rowEnd = std::min(end * scale, height);
+                if (rowBeg < rowEnd)
+                    function(i, rowBeg, rowEnd);
+            }
+        }, SimdGetThreadNumber(), 16);
+    }
+
+    template <template<class> class A> SIMD_INLINE void Crop(const Frame<A> & src, const Rectangle<ptrdiff_t> & rect, Frame<A> & dst)
+    {
+        Frame<A> region = src.Region(rect);
+        assert(Compatible(region, dst));
+
+        ForEachFrameBand(region, [&](size_t plane, size_t begin, size_t end)
+        {
+            const View<A> & s = region.planes[plane];
+            View<A> d = dst.planes[plane].Region(0, begin, s.width, end);
+            Simd::Copy(s.Region(0, begin, s.width, end), d);
+        });
+    }
+
+    template <template<class> class A> SIMD_INLINE void ResizeBilinear(const Frame<A> & src, Frame<A> & dst, bool centerSitedChroma)
+    {
+        assert(src.format == dst.format && src.flipped == dst.flipped && Frame<A>::BitDepth(src.format) == 8);
+
+        if (EqualSize(src, dst))
+        {
+            Copy(src, dst);
+            return;
+        }
+
+        ForEachFrameBand(dst, [&](size_t plane, size_t begin, size_t end)
+        {
+            const View<A> & s = src.planes[plane];
+            View<A> & d = dst.planes[plane];
+            float siteX = (plane && !centerSitedChroma) ? 0.25f : 0.5f;
+            ::SimdResizeBilinearRows(s.data, s.width, s.height, s.stride, d.data, d.width, d.height, d.stride, s.ChannelCount(), siteX, begin, end);
+        });
+    }
+
+    template <template<class> class A> SIMD_INLINE void TransformImage(const Frame<A> & src, ::SimdTransformType transform, Frame<A> & dst)
+    {
+        assert(src.format == dst.format && src.flipped == dst.flipped && TransformSize(src.Size(), transform) == dst.Size());
+
+        bool swap = transform == SimdTransformRotate90 || transform == SimdTransformRotate270 ||
+            transform == SimdTransformTransposeRotate0 || transform == SimdTransformTransposeRotate180;
+        bool flip = transform == SimdTransformRotate180 || transform == SimdTransformRotate270 ||
+            transform == SimdTransformTransposeRotate180 || transform == SimdTransformTransposeRotate270;
+
+        ForEachFrameBand(src, [&](size_t plane, size_t begin, size_t end)
+        {
+            const View<A> & s = src.planes[plane];
+            size_t dstBeg = flip ? s.height - end : begin, dstEnd = flip ? s.height - begin : end;
+            View<A> d = swap ? dst.planes[plane].Region(dstBeg, 0, dstEnd, s.width) : dst.planes[plane].Region(0, dstBeg, s.width, dstEnd);
+            Simd::TransformImage(s.Region(0, begin, s.width, end), transform, d);
+        });
+    }
 }
 
 #endif//__SimdFrame_hpp__
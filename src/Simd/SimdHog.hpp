@@ -0,0 +1,569 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdHog_hpp__
+#define __SimdHog_hpp__
+
+#include "Simd/SimdLib.hpp"
+#include "Simd/SimdParallel.hpp"
+
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <math.h>
+#include <limits.h>
+#include <string.h>
+
+namespace Simd
+{
+    /*! @ingroup cpp_hog
+
+        \short The HogLitePyramid structure provides extraction of lite HOG features for a pyramid of scales.
+
+        Features of every pyramid level are stored in one contiguous aligned buffer.
+        Only every interval-th level (exact level) is extracted from the scaled image: gradients and cell histograms are estimated once for it.
+        Features of intermediate levels are derived from the nearest greater exact level with using of ::SimdHogLiteResizeFeatures.
+        Exact levels and derived levels are processed in parallel.
+
+        Using example:
+        \verbatim
+        #include "Simd/SimdHog.hpp"
+
+        int main()
+        {
+            typedef Simd::HogLitePyramid<Simd::Allocator> Pyramid;
+
+            Pyramid::View image;
+            image.Load("../../data/image/face/lena.pgm");
+
+            Pyramid pyramid;
+            pyramid.Init(image.Size(), 8, 1.1, 4);
+
+            pyramid.Extract(image);
+
+            for (size_t i = 0; i < pyramid.Size(); ++i)
+            {
+                const Pyramid::Level & level = pyramid[i];
+                // Process level.features with size level.size and row size level.stride.
+            }
+
+            return 0;
+        }
+        \endverbatim
+    */
+    template <template<class> class A> struct HogLitePyramid
+    {
+        typedef Simd::View<A> View; /*!< An image type definition. */
+        typedef Simd::Point<ptrdiff_t> Point; /*!< A point type definition. */
+        typedef std::vector<float, A<float>> Buffer; /*!< A buffer with features type definition. */
+
+        static const size_t FEATURE_SIZE = 16; /*!< A number of features in the cell. */
+
+        /*!
+            \short The Level structure describes features of one level of the pyramid.
+        */
+        struct Level
+        {
+            double scale; /*!< \brief A ratio of the original image size to the size of the scaled image. */
+            Point size; /*!< \brief A size of 2D-array with features (in cells). */
+            size_t stride; /*!< \brief A row size of 2D-array with features (in floats). */
+            float * features; /*!< \brief A pointer to 2D-array with features. */
+            bool exact; /*!< \brief A flag of level which is extracted from the scaled image. */
+        };
+        typedef std::vector<Level> Levels; /*!< A vector of levels type definition. */
+
+        /*!
+            Prepares HogLitePyramid structure to work with image of given size.
+
+            \param [in] imageSize - a size of input image.
+            \param [in] cell - a size of cell. It must be 4 or 8.
+            \param [in] scaleFactor - a scale factor between neighboring levels. It must be greater than 1.
+            \param [in] interval - an interval between exact levels. Value 1 means that all levels are extracted from scaled images.
+                              Value 0 means that only first level is extracted from the image and features of all other levels are derived from it.
+            \param [in] sizeMin - a minimal size of 2D-array with features (in cells). It can't be less than 2x2.
+            \param [in] levelCountMax - a maximal number of levels.
+            \param [in] threadNumber - a number of work threads. Use value -1 to auto choose of thread number.
+            \return a result of this operation.
+        */
+        bool Init(const Point & imageSize, size_t cell = 8, double scaleFactor = 1.1, size_t interval = 4,
+            const Point & sizeMin = Point(2, 2), size_t levelCountMax = INT_MAX, ptrdiff_t threadNumber = -1)
+        {
+            _levels.clear();
+            _images.clear();
+            if ((cell != 4 && cell != 8) || scaleFactor <= 1.0)
+                return false;
+
+            ptrdiff_t threadNumberMax = std::thread::hardware_concurrency();
+            _threadNumber = (threadNumber <= 0 || threadNumber > threadNumberMax) ? threadNumberMax : threadNumber;
+            _imageSize = imageSize;
+            _cell = cell;
+
+            Point minimal(std::max<ptrdiff_t>(sizeMin.x, 2), std::max<ptrdiff_t>(sizeMin.y, 2));
+            size_t alignment = A<float>::Alignment() / sizeof(float), total = 0, exact = 0;
+            std::vector<size_t> offsets;
+            for (size_t i = 0; i < levelCountMax; ++i)
+            {
+                Level level;
+                level.scale = ::pow(scaleFactor, double(i));
+                level.exact = interval ? i % interval == 0 : i == 0;
+                Point scaled = ScaledSize(level.scale);
+                level.size = scaled / cell - Point(2, 2);
+                if (level.size.x < minimal.x || level.size.y < minimal.y)
+                    break;
+                level.stride = A<float>::Align(level.size.x*FEATURE_SIZE, alignment);
+                level.features = NULL;
+                offsets.push_back(total);
+                total += level.stride*level.size.y;
+                if (level.exact && i)
+                    exact++;
+                _levels.push_back(level);
+            }
+            if (_levels.empty())
+                return false;
+
+            _buffer.resize(total);
+            _images.resize(exact);
+            for (size_t i = 0, e = 0; i < _levels.size(); ++i)
+            {
+                Level & level = _levels[i];
+                level.features = _buffer.data() + offsets[i];
+                if (level.exact && i)
+                    _images[e++].Recreate(ScaledSize(level.scale), View::Gray8);
+            }
+            return true;
+        }
+
+        /*!
+            Extracts lite HOG features for all levels of the pyramid.
+
+            \param [in] src - an input image. It must have size which was used in Init. Non gray images are converted to gray.
+            \return a result of this operation.
+        */
+        bool Extract(View src)
+        {
+            if (_levels.empty() || src.Size() != _imageSize)
+                return false;
+
+            if (src.format != View::Gray8)
+            {
+                _gray.Recreate(src.Size(), View::Gray8);
+                Convert(src, _gray);
+                src = _gray;
+            }
+
+            std::vector<size_t> exact, derived;
+            for (size_t i = 0; i < _levels.size(); ++i)
+                (_levels[i].exact ? exact : derived).push_back(i);
+
+            Run(exact.size(), [&](size_t i)
+            {
+                Level & level = _levels[exact[i]];
+                if (i)
+                {
+                    View & image = _images[i - 1];
+                    Simd::ResizeBilinear(src, image);
+                    Simd::HogLiteExtractFeatures(image, _cell, level.features, level.stride);
+                }
+                else
+                    Simd::HogLiteExtractFeatures(src, _cell, level.features, level.stride);
+            });
+
+            Run(derived.size(), [&](size_t i)
+            {
+                Level & level = _levels[derived[i]];
+                const Level & base = Source(derived[i]);
+                ::SimdHogLiteResizeFeatures(base.features, base.stride, base.size.x, base.size.y, FEATURE_SIZE,
+                    level.features, level.stride, level.size.x, level.size.y);
+            });
+
+            return true;
+        }
+
+        /*!
+            Gets number of levels in the pyramid.
+
+            \return - number of levels in the pyramid.
+        */
+        size_t Size() const
+        {
+            return _levels.size();
+        }
+
+        /*!
+            Gets a description of given level of the pyramid.
+
+            \param [in] index - an index of the level.
+            \return - a constant reference to the level.
+        */
+        const Level & operator [] (size_t index) const
+        {
+            return _levels[index];
+        }
+
+        /*!
+            Gets the buffer which contains features of all levels of the pyramid.
+
+            \return - a constant reference to the buffer.
+        */
+        const Buffer & Features() const
+        {
+            return _buffer;
+        }
+
+    private:
+        Point _imageSize;
+        size_t _cell;
+        ptrdiff_t _threadNumber;
+        Levels _levels;
+        Buffer _buffer;
+        std::vector<View> _images;
+        View _gray;
+
+        SIMD_INLINE Point ScaledSize(double scale) const
+        {
+            return Point(ptrdiff_t(_imageSize.x / scale + 0.5), ptrdiff_t(_imageSize.y / scale + 0.5));
+        }
+
+        const Level & Source(size_t index) const
+        {
+            while (!_levels[index].exact)
+                index--;
+            return _levels[index];
+        }
+
+        template<class Function> void Run(size_t count, Function function)
+        {
+            std::atomic<size_t> next(0);
+            Parallel(0, _threadNumber, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t i = next++; i < count; i = next++)
+                    function(i);
+            }, std::min<size_t>(_threadNumber, count));
+        }
+    };
+
+    /*! @ingroup cpp_hog
+
+        \short The HogLiteFilterBank structure applies a set of filters to all levels of Simd::HogLitePyramid.
+
+        Every level of the pyramid is split into bands of rows. All filters are applied to a band at once, so the features of the band
+        are read from memory only once. Bands of all levels are processed in parallel.
+        Optionally one filter can be used as a root filter for early rejection: it is applied first, and all other filters are
+        evaluated only in neighborhood of positions where the root filter response is greater than a threshold (see ::SimdHogLiteCreateMask).
+        Rejected positions have response equal to -FLT_MAX.
+
+        Using example:
+        \verbatim
+        #include "Simd/SimdHog.hpp"
+
+        int main()
+        {
+            typedef Simd::HogLitePyramid<Simd::Allocator> Pyramid;
+            typedef Simd::HogLiteFilterBank<Simd::Allocator> FilterBank;
+
+            Pyramid::View image;
+            image.Load("../../data/image/face/lena.pgm");
+
+            Pyramid pyramid;
+            pyramid.Init(image.Size());
+            pyramid.Extract(image);
+
+            FilterBank bank;
+            size_t root = bank.Add(rootWeights, 8, 8);
+            for (size_t i = 0; i < 8; ++i)
+                bank.Add(partWeights[i], 4, 4);
+            bank.SetRejection(root, 0.5f, 7);
+
+            bank.Run(pyramid);
+
+            for (size_t level = 0; level < pyramid.Size(); ++level)
+            {
+                const FilterBank::Response & response = bank.At(level, root);
+                // Process response.data with size response.size and row size response.stride.
+            }
+
+            return 0;
+        }
+        \endverbatim
+    */
+    template <template<class> class A> struct HogLiteFilterBank
+    {
+        typedef Simd::HogLitePyramid<A> Pyramid; /*!< A pyramid of features type definition. */
+        typedef Simd::Point<ptrdiff_t> Point; /*!< A point type definition. */
+        typedef std::vector<float, A<float>> Buffer; /*!< A buffer with 32-bit float values type definition. */
+
+        /*!
+            \short The Response structure describes result of applying of one filter to one level of the pyramid.
+        */
+        struct Response
+        {
+            Point size; /*!< \brief A size of 2D-array with filter responses. It is empty if the filter is greater than the level. */
+            size_t stride; /*!< \brief A row size of 2D-array with filter responses (in floats). */
+            float * data; /*!< \brief A pointer to 2D-array with filter responses. */
+        };
+
+        /*!
+            Creates a new empty HogLiteFilterBank structure.
+        */
+        HogLiteFilterBank()
+            : _root(-1)
+            , _threshold(0)
+            , _neighborhood(0)
+        {
+        }
+
+        /*!
+            Adds a filter to the bank.
+
+            \param [in] weights - a pointer to the filter weights. It has the same layout as in ::SimdHogLiteFilterFeatures:
+                                  height rows with width*Pyramid::FEATURE_SIZE values.
+            \param [in] width - a width of the filter (in cells).
+            \param [in] height - a height of the filter (in cells).
+            \return an index of added filter.
+        */
+        size_t Add(const float * weights, size_t width, size_t height)
+        {
+            Filter filter;
+            filter.size = Point(width, height);
+            filter.weights.assign(weights, weights + width * height * Pyramid::FEATURE_SIZE);
+            _filters.push_back(filter);
+            return _filters.size() - 1;
+        }
+
+        /*!
+            Sets parameters of early rejection.
+
+            \param [in] root - an index of the root filter.
+            \param [in] threshold - a threshold of the root filter response.
+            \param [in] neighborhood - a size of neighborhood where other filters are evaluated (see ::SimdHogLiteCreateMask).
+        */
+        void SetRejection(size_t root, float threshold, size_t neighborhood)
+        {
+            _root = root < _filters.size() ? (ptrdiff_t)root : -1;
+            _threshold = threshold;
+            _neighborhood = std::max<size_t>(neighborhood, 1);
+        }
+
+        /*!
+            Gets number of filters in the bank.
+
+            \return - number of filters in the bank.
+        */
+        size_t Size() const
+        {
+            return _filters.size();
+        }
+
+        /*!
+            Applies all filters to all levels of the pyramid.
+
+            \param [in] pyramid - a pyramid with extracted features.
+            \param [in] threadNumber - a number of work threads. Use value -1 to auto choose of thread number.
+            \return a result of this operation.
+        */
+        bool Run(const Pyramid & pyramid, ptrdiff_t threadNumber = -1)
+        {
+            if (_filters.empty() || pyramid.Size() == 0)
+                return false;
+
+            ptrdiff_t threadNumberMax = std::thread::hardware_concurrency();
+            _threadNumber = (threadNumber <= 0 || threadNumber > threadNumberMax) ? threadNumberMax : threadNumber;
+
+            Allocate(pyramid);
+
+            Tasks tasks;
+            if (_root >= 0)
+            {
+                CreateTasks(pyramid, true, tasks);
+                RunTasks(tasks.size(), [&](size_t i)
+                {
+                    Apply(pyramid[tasks[i].level], tasks[i].level, _root, tasks[i].top, tasks[i].bottom);
+                });
+
+                RunTasks(pyramid.Size(), [&](size_t i)
+                {
+                    CreateMask(i);
+                });
+            }
+
+            CreateTasks(pyramid, false, tasks);
+            RunTasks(tasks.size(), [&](size_t i)
+            {
+                for (size_t f = 0; f < _filters.size(); ++f)
+                    if ((ptrdiff_t)f != _root)
+                        Apply(pyramid[tasks[i].level], tasks[i].level, f, tasks[i].top, tasks[i].bottom);
+            });
+
+            return true;
+        }
+
+        /*!
+            Gets result of applying of given filter to given level of the pyramid.
+
+            \param [in] level - an index of the pyramid level.
+            \param [in] filter - an index of the filter.
+            \return - a constant reference to the filter response.
+        */
+        const Response & At(size_t level, size_t filter) const
+        {
+            return _responses[level * _filters.size() + filter];
+        }
+
+    private:
+        struct Filter
+        {
+            Point size;
+            Buffer weights;
+        };
+        typedef std::vector<Filter> Filters;
+
+        struct Mask
+        {
+            Point size;
+            size_t stride;
+            uint32_t * data;
+        };
+
+        struct Task
+        {
+            size_t level;
+            ptrdiff_t top, bottom;
+        };
+        typedef std::vector<Task> Tasks;
+
+        Filters _filters;
+        ptrdiff_t _root, _threadNumber;
+        float _threshold;
+        size_t _neighborhood;
+        std::vector<Response> _responses;
+        std::vector<Mask> _masks;
+        Buffer _buffer;
+        std::vector<uint32_t, A<uint32_t>> _maskBuffer;
+
+        void Allocate(const Pyramid & pyramid)
+        {
+            size_t alignment = A<float>::Alignment() / sizeof(float), total = 0, maskTotal = 0;
+            _responses.resize(pyramid.Size() * _filters.size());
+            _masks.resize(pyramid.Size());
+            std::vector<size_t> offsets(_responses.size()), maskOffsets(_masks.size());
+            for (size_t l = 0; l < pyramid.Size(); ++l)
+            {
+                Mask & mask = _masks[l];
+                mask.size = Point();
+                for (size_t f = 0; f < _filters.size(); ++f)
+                {
+                    Response & response = _responses[l * _filters.size() + f];
+                    response.size = pyramid[l].size - _filters[f].size + Point(1, 1);
+                    if (response.size.x <= 0 || response.size.y <= 0)
+                        response.size = Point();
+                    response.stride = A<float>::Align(response.size.x, alignment);
+                    offsets[l * _filters.size() + f] = total;
+                    total += response.stride * response.size.y;
+                    if (_root >= 0)
+                    {
+                        Point size = response.size;
+                        if ((ptrdiff_t)f == _root && size.x)
+                            size += Point(_neighborhood - 1, _neighborhood - 1);
+                        mask.size = Point(std::max(mask.size.x, size.x), std::max(mask.size.y, size.y));
+                    }
+                }
+                mask.stride = A<uint32_t>::Align(mask.size.x, alignment);
+                maskOffsets[l] = maskTotal;
+                maskTotal += mask.stride * mask.size.y;
+            }
+            _buffer.resize(total);
+            _maskBuffer.resize(maskTotal);
+            for (size_t i = 0; i < _responses.size(); ++i)
+                _responses[i].data = _buffer.data() + offsets[i];
+            for (size_t i = 0; i < _masks.size(); ++i)
+                _masks[i].data = _maskBuffer.data() + maskOffsets[i];
+        }
+
+        void CreateTasks(const Pyramid & pyramid, bool root, Tasks & tasks) const
+        {
+            const size_t TASKS_PER_THREAD = 4;
+            tasks.clear();
+            double total = 0;
+            for (size_t l = 0; l < pyramid.Size(); ++l)
+                total += double(pyramid[l].size.x * pyramid[l].size.y);
+            double cost = total / (std::max<ptrdiff_t>(_threadNumber, 1) * TASKS_PER_THREAD);
+            for (size_t l = 0; l < pyramid.Size(); ++l)
+            {
+                ptrdiff_t height = 0;
+                for (size_t f = 0; f < _filters.size(); ++f)
+                    if (root == ((ptrdiff_t)f == _root))
+                        height = std::max(height, At(l, f).size.y);
+                ptrdiff_t step = std::max<ptrdiff_t>(ptrdiff_t(cost / pyramid[l].size.x), 1);
+                for (ptrdiff_t top = 0; top < height; top += step)
+                {
+                    Task task;
+                    task.level = l;
+                    task.top = top;
+                    task.bottom = std::min(top + step, height);
+                    tasks.push_back(task);
+                }
+            }
+        }
+
+        void Apply(const typename Pyramid::Level & level, size_t l, size_t f, ptrdiff_t top, ptrdiff_t bottom)
+        {
+            const Response & response = At(l, f);
+            bottom = std::min(bottom, response.size.y);
+            if (top >= bottom)
+                return;
+            const Filter & filter = _filters[f];
+            const uint32_t * mask = NULL;
+            size_t maskStride = 0;
+            if (_root >= 0 && (ptrdiff_t)f != _root)
+            {
+                maskStride = _masks[l].stride;
+                mask = _masks[l].data + top * maskStride;
+            }
+            ::SimdHogLiteFilterFeatures(level.features + top * level.stride, level.stride, level.size.x, bottom - top + filter.size.y - 1,
+                Pyramid::FEATURE_SIZE, filter.weights.data(), filter.size.x, filter.size.y, mask, maskStride,
+                response.data + top * response.stride, response.stride);
+        }
+
+        void CreateMask(size_t l)
+        {
+            const Mask & mask = _masks[l];
+            const Response & root = At(l, _root);
+            if (mask.size.y)
+                memset(mask.data, 0, mask.stride * mask.size.y * sizeof(uint32_t));
+            if (root.size.y)
+                ::SimdHogLiteCreateMask(root.data, root.stride, root.size.x, root.size.y, &_threshold, 1, _neighborhood, mask.data, mask.stride);
+        }
+
+        template<class Function> void RunTasks(size_t count, Function function)
+        {
+            std::atomic<size_t> next(0);
+            Parallel(0, _threadNumber, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t i = next++; i < count; i = next++)
+                    function(i);
+            }, std::min<size_t>(_threadNumber, count));
+        }
+    };
+}
+
+#endif//__SimdHog_hpp__
@@ -0,0 +1,196 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdLab_h__
+#define __SimdLab_h__
+
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        const float LAB_X_R = 0.412453f / 0.950456f;
+        const float LAB_X_G = 0.357580f / 0.950456f;
+        const float LAB_X_B = 0.180423f / 0.950456f;
+        const float LAB_Y_R = 0.212671f;
+        const float LAB_Y_G = 0.715160f;
+        const float LAB_Y_B = 0.072169f;
+        const float LAB_Z_R = 0.019334f / 1.088754f;
+        const float LAB_Z_G = 0.119193f / 1.088754f;
+        const float LAB_Z_B = 0.950227f / 1.088754f;
+
+        const float LAB_R_X = 3.240479f * 0.950456f;
+        const float LAB_R_Y = -1.537150f;
+        const float LAB_R_Z = -0.498535f * 1.088754f;
+        const float LAB_G_X = -0.969256f * 0.950456f;
+        const float LAB_G_Y = 1.875991f;
+        const float LAB_G_Z = 0.041556f * 1.088754f;
+        const float LAB_B_X = 0.055648f * 0.950456f;
+        const float LAB_B_Y = -0.204043f;
+        const float LAB_B_Z = 1.057311f * 1.088754f;
+
+        const float LAB_T_THRESHOLD = 0.008856f;
+        const float LAB_F_THRESHOLD = 6.0f / 29.0f;
+        const float LAB_SLOPE = 7.787f;
+        const float LAB_SLOPE_INV = 1.0f / 7.787f;
+        const float LAB_BIAS = 16.0f / 116.0f;
+        const int32_t LAB_CBRT_MAGIC = 709921077;
+
+        const float LAB_L_SCALE = 116.0f;
+        const float LAB_L_SHIFT = 16.0f;
+        const float LAB_A_SCALE = 500.0f;
+        const float LAB_B_SCALE = 200.0f;
+        const float LAB_L_SCALE_INV = 1.0f / 116.0f;
+        const float LAB_A_SCALE_INV = 1.0f / 500.0f;
+        const float LAB_B_SCALE_INV = 1.0f / 200.0f;
+
+        const float LAB_L_TO_8U = 255.0f / 100.0f;
+        const float LAB_8U_TO_L = 100.0f / 255.0f;
+        const float LAB_AB_SHIFT = 128.0f;
+
+        const int LAB_GAMMA_SIZE = 4096;
+
+        struct LabGamma
+        {
+            float decode[256];
+            float encode[LAB_GAMMA_SIZE + 1];
+
+            LabGamma();
+        };
+
+        const LabGamma & GetLabGamma();
+
+        SIMD_INLINE float LabCbrt(float x)
+        {
+            union { float f; int32_t i; } u;
+            u.f = x;
+            u.i = int32_t(float(u.i) * (1.0f / 3.0f)) + LAB_CBRT_MAGIC;
+            float y = u.f;
+            for (int i = 0; i < 3; ++i)
+                y = (y + y + x / (y * y)) * (1.0f / 3.0f);
+            return y;
+        }
+
+        SIMD_INLINE float LabF(float t)
+        {
+            return t > LAB_T_THRESHOLD ? LabCbrt(t) : t * LAB_SLOPE + LAB_BIAS;
+        }
+
+        SIMD_INLINE float LabFInv(float f)
+        {
+            return f > LAB_F_THRESHOLD ? f * f * f : (f - LAB_BIAS) * LAB_SLOPE_INV;
+        }
+
+        SIMD_INLINE void BgrToLab(int blue, int green, int red, const LabGamma & gamma, float * lab)
+        {
+            float b = gamma.decode[blue], g = gamma.decode[green], r = gamma.decode[red];
+            float fx = LabF(r * LAB_X_R + g * LAB_X_G + b * LAB_X_B);
+            float fy = LabF(r * LAB_Y_R + g * LAB_Y_G + b * LAB_Y_B);
+            float fz = LabF(r * LAB_Z_R + g * LAB_Z_G + b * LAB_Z_B);
+            lab[0] = fy * LAB_L_SCALE - LAB_L_SHIFT;
+            lab[1] = (fx - fy) * LAB_A_SCALE;
+            lab[2] = (fy - fz) * LAB_B_SCALE;
+        }
+
+        SIMD_INLINE int LabGammaEncode(float value, const LabGamma & gamma)
+        {
+            value = Simd::Min(Simd::Max(value, 0.0f), 1.0f) * float(LAB_GAMMA_SIZE);
+            int index = Simd::Min(int(value), LAB_GAMMA_SIZE - 1);
+            float lo = gamma.encode[index], hi = gamma.encode[index + 1];
+            return Round(lo + (hi - lo) * (value - float(index)));
+        }
+
+        SIMD_INLINE void LabToBgr(float l, float a, float b, const LabGamma & gamma, uint8_t * bgr)
+        {
+            float fy = (l + LAB_L_SHIFT) * LAB_L_SCALE_INV;
+            float fx = fy + a * LAB_A_SCALE_INV;
+            float fz = fy - b * LAB_B_SCALE_INV;
+            float x = LabFInv(fx), y = LabFInv(fy), z = LabFInv(fz);
+            bgr[0] = LabGammaEncode(x * LAB_B_X + y * LAB_B_Y + z * LAB_B_Z, gamma);
+            bgr[1] = LabGammaEncode(x * LAB_G_X + y * LAB_G_Y + z * LAB_G_Z, gamma);
+            bgr[2] = LabGammaEncode(x * LAB_R_X + y * LAB_R_Y + z * LAB_R_Z, gamma);
+        }
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        SIMD_INLINE void LoadLab32f(const float * src, __m128 lab[3])
+        {
+            __m128 s0 = _mm_loadu_ps(src + 0), s1 = _mm_loadu_ps(src + 4), s2 = _mm_loadu_ps(src + 8);
+            __m128 l = _mm_blend_ps(_mm_blend_ps(s0, s1, 0x4), s2, 0x2);
+            __m128 a = _mm_blend_ps(_mm_blend_ps(s0, s1, 0x9), s2, 0x4);
+            __m128 b = _mm_blend_ps(_mm_blend_ps(s0, s1, 0x2), s2, 0x9);
+            lab[0] = _mm_shuffle_ps(l, l, _MM_SHUFFLE(1, 2, 3, 0));
+            lab[1] = _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1));
+            lab[2] = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 1, 2));
+        }
+
+        SIMD_INLINE void StoreLab32f(const __m128 lab[3], float * dst)
+        {
+            __m128 l = _mm_shuffle_ps(lab[0], lab[0], _MM_SHUFFLE(1, 2, 3, 0));
+            __m128 a = _mm_shuffle_ps(lab[1], lab[1], _MM_SHUFFLE(2, 3, 0, 1));
+            __m128 b = _mm_shuffle_ps(lab[2], lab[2], _MM_SHUFFLE(3, 0, 1, 2));
+            _mm_storeu_ps(dst + 0, _mm_blend_ps(_mm_blend_ps(l, a, 0x2), b, 0x4));
+            _mm_storeu_ps(dst + 4, _mm_blend_ps(_mm_blend_ps(a, b, 0x2), l, 0x4));
+            _mm_storeu_ps(dst + 8, _mm_blend_ps(_mm_blend_ps(b, l, 0x2), a, 0x4));
+        }
+    }
+#endif// SIMD_SSE41_ENABLE
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        const __m512i K32_LAB_LOAD_L_0 = SIMD_MM512_SETR_EPI32(0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 0, 0, 0, 0, 0);
+        const __m512i K32_LAB_LOAD_L_1 = SIMD_MM512_SETR_EPI32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 17, 20, 23, 26, 29);
+        const __m512i K32_LAB_LOAD_A_0 = SIMD_MM512_SETR_EPI32(1, 4, 7, 10, 13, 16, 19, 22, 25, 28, 31, 0, 0, 0, 0, 0);
+        const __m512i K32_LAB_LOAD_A_1 = SIMD_MM512_SETR_EPI32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 18, 21, 24, 27, 30);
+        const __m512i K32_LAB_LOAD_B_0 = SIMD_MM512_SETR_EPI32(2, 5, 8, 11, 14, 17, 20, 23, 26, 29, 0, 0, 0, 0, 0, 0);
+        const __m512i K32_LAB_LOAD_B_1 = SIMD_MM512_SETR_EPI32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 16, 19, 22, 25, 28, 31);
+
+        const __m512i K32_LAB_STORE_0_0 = SIMD_MM512_SETR_EPI32(0, 16, 0, 1, 17, 0, 2, 18, 0, 3, 19, 0, 4, 20, 0, 5);
+        const __m512i K32_LAB_STORE_0_1 = SIMD_MM512_SETR_EPI32(0, 1, 16, 3, 4, 17, 6, 7, 18, 9, 10, 19, 12, 13, 20, 15);
+        const __m512i K32_LAB_STORE_1_0 = SIMD_MM512_SETR_EPI32(21, 0, 6, 22, 0, 7, 23, 0, 8, 24, 0, 9, 25, 0, 10, 26);
+        const __m512i K32_LAB_STORE_1_1 = SIMD_MM512_SETR_EPI32(0, 21, 2, 3, 22, 5, 6, 23, 8, 9, 24, 11, 12, 25, 14, 15);
+        const __m512i K32_LAB_STORE_2_0 = SIMD_MM512_SETR_EPI32(0, 11, 27, 0, 12, 28, 0, 13, 29, 0, 14, 30, 0, 15, 31, 0);
+        const __m512i K32_LAB_STORE_2_1 = SIMD_MM512_SETR_EPI32(26, 1, 2, 27, 4, 5, 28, 7, 8, 29, 10, 11, 30, 13, 14, 31);
+
+        SIMD_INLINE void LoadLab32f(const float * src, __m512 lab[3])
+        {
+            __m512 s0 = _mm512_loadu_ps(src + 0), s1 = _mm512_loadu_ps(src + 16), s2 = _mm512_loadu_ps(src + 32);
+            lab[0] = _mm512_permutex2var_ps(_mm512_permutex2var_ps(s0, K32_LAB_LOAD_L_0, s1), K32_LAB_LOAD_L_1, s2);
+            lab[1] = _mm512_permutex2var_ps(_mm512_permutex2var_ps(s0, K32_LAB_LOAD_A_0, s1), K32_LAB_LOAD_A_1, s2);
+            lab[2] = _mm512_permutex2var_ps(_mm512_permutex2var_ps(s0, K32_LAB_LOAD_B_0, s1), K32_LAB_LOAD_B_1, s2);
+        }
+
+        SIMD_INLINE void StoreLab32f(const __m512 lab[3], float * dst)
+        {
+            _mm512_storeu_ps(dst + 0, _mm512_permutex2var_ps(_mm512_permutex2var_ps(lab[0], K32_LAB_STORE_0_0, lab[1]), K32_LAB_STORE_0_1, lab[2]));
+            _mm512_storeu_ps(dst + 16, _mm512_permutex2var_ps(_mm512_permutex2var_ps(lab[0], K32_LAB_STORE_1_0, lab[1]), K32_LAB_STORE_1_1, lab[2]));
+            _mm512_storeu_ps(dst + 32, _mm512_permutex2var_ps(_mm512_permutex2var_ps(lab[0], K32_LAB_STORE_2_0, lab[1]), K32_LAB_STORE_2_1, lab[2]));
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
+#endif//__SimdLab_h__
@@ -55,6 +55,7 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdLog.h"
 
 #include "Simd/SimdResizer.h"
+#include "Simd/SimdSvm.h"
 #include "Simd/SimdConvolution.h"
 
 #include "Simd/SimdBase.h"
@@ -466,6 +467,133 @@ SIMD_API void SimdAlphaFilling(uint8_t * dst, size_t dstStride, size_t width, si
         Base::AlphaFilling(dst, dstStride, width, height, channel, channelCount, alpha, alphaStride);
 }
 
+SIMD_API void SimdAlphaPremultiply(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::AlphaPremultiply(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::F)
+        Avx2::AlphaPremultiply(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::F)
+        Sse41::AlphaPremultiply(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::AlphaPremultiply(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+        Base::AlphaPremultiply(src, srcStride, width, height, dst, dstStride);
+}
+
+SIMD_API void SimdAlphaUnpremultiply(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::AlphaUnpremultiply(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::F)
+        Avx2::AlphaUnpremultiply(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::F)
+        Sse41::AlphaUnpremultiply(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::AlphaUnpremultiply(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+        Base::AlphaUnpremultiply(src, srcStride, width, height, dst, dstStride);
+}
+
+SIMD_API void SimdAlphaBlendingBgraToBgra(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t alpha, SimdBool premultiplied, uint8_t * dst, size_t dstStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::AlphaBlendingBgraToBgra(src, srcStride, width, height, alpha, premultiplied, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::F)
+        Avx2::AlphaBlendingBgraToBgra(src, srcStride, width, height, alpha, premultiplied, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::F)
+        Sse41::AlphaBlendingBgraToBgra(src, srcStride, width, height, alpha, premultiplied, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::AlphaBlendingBgraToBgra(src, srcStride, width, height, alpha, premultiplied, dst, dstStride);
+    else
+#endif
+        Base::AlphaBlendingBgraToBgra(src, srcStride, width, height, alpha, premultiplied, dst, dstStride);
+}
+
+SIMD_API void SimdAlphaBlendingBgraToYuv420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t alpha,
+    uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::HA)
+        Avx512bw::AlphaBlendingBgraToYuv420p(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::AlphaBlendingBgraToYuv420p(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::AlphaBlendingBgraToYuv420p(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::AlphaBlendingBgraToYuv420p(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+        Base::AlphaBlendingBgraToYuv420p(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride, yuvType);
+}
+
+SIMD_API void SimdAlphaBlendingBgraToNv12(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t alpha,
+    uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::HA)
+        Avx512bw::AlphaBlendingBgraToNv12(bgra, bgraStride, width, height, alpha, y, yStride, uv, uvStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::AlphaBlendingBgraToNv12(bgra, bgraStride, width, height, alpha, y, yStride, uv, uvStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::AlphaBlendingBgraToNv12(bgra, bgraStride, width, height, alpha, y, yStride, uv, uvStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::AlphaBlendingBgraToNv12(bgra, bgraStride, width, height, alpha, y, yStride, uv, uvStride, yuvType);
+    else
+#endif
+        Base::AlphaBlendingBgraToNv12(bgra, bgraStride, width, height, alpha, y, yStride, uv, uvStride, yuvType);
+}
+
 SIMD_API void SimdBackgroundGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                           uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride)
 {
@@ -729,3066 +857,4737 @@ SIMD_API void SimdBackgroundInitMask(const uint8_t * src, size_t srcStride, size
         Base::BackgroundInitMask(src, srcStride, width, height, index, value, dst, dstStride);
 }
 
-SIMD_API void SimdBayerToBgr(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride)
+SIMD_API void SimdBackgroundUpdate(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+    uint8_t * loValue, size_t loValueStride, uint8_t * hiValue, size_t hiValueStride,
+    uint8_t * loCount, size_t loCountStride, uint8_t * hiCount, size_t hiCountStride, uint8_t threshold, int flags)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::A + 2)
-        Avx512bw::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
+    if (Avx512bw::Enable)
+        Avx512bw::BackgroundUpdate(value, valueStride, width, height, loValue, loValueStride, hiValue, hiValueStride, loCount, loCountStride, hiCount, hiCountStride, threshold, flags);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A + 2)
-        Avx2::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::BackgroundUpdate(value, valueStride, width, height, loValue, loValueStride, hiValue, hiValueStride, loCount, loCountStride, hiCount, hiCountStride, threshold, flags);
     else
 #endif
-#ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && width >= Ssse3::A + 2)
-        Ssse3::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::A)
+        Sse2::BackgroundUpdate(value, valueStride, width, height, loValue, loValueStride, hiValue, hiValueStride, loCount, loCountStride, hiCount, hiCountStride, threshold, flags);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A + 2)
-        Neon::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::BackgroundUpdate(value, valueStride, width, height, loValue, loValueStride, hiValue, hiValueStride, loCount, loCountStride, hiCount, hiCountStride, threshold, flags);
     else
 #endif
-        Base::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
+        Base::BackgroundUpdate(value, valueStride, width, height, loValue, loValueStride, hiValue, hiValueStride, loCount, loCountStride, hiCount, hiCountStride, threshold, flags);
 }
 
-SIMD_API void SimdBayerToBgra(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+SIMD_API void SimdBackgroundPackedInit(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::A + 2)
-        Avx512bw::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
+    if (Avx512bw::Enable)
+        Avx512bw::BackgroundPackedInit(value, valueStride, width, height, model, modelStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A + 2)
-        Avx2::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::BackgroundPackedInit(value, valueStride, width, height, model, modelStride);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A + 2)
-        Sse2::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
+    if (Sse2::Enable && width >= Sse2::A)
+        Sse2::BackgroundPackedInit(value, valueStride, width, height, model, modelStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A + 2)
-        Neon::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::BackgroundPackedInit(value, valueStride, width, height, model, modelStride);
     else
 #endif
-        Base::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
+        Base::BackgroundPackedInit(value, valueStride, width, height, model, modelStride);
 }
 
-SIMD_API void SimdBgraToBayer(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat)
+SIMD_API void SimdBackgroundPackedUpdate(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+    uint8_t * model, size_t modelStride, uint8_t threshold, int flags)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::BgraToBayer(bgra, width, height, bgraStride, bayer, bayerStride, bayerFormat);
+        Avx512bw::BackgroundPackedUpdate(value, valueStride, width, height, model, modelStride, threshold, flags);
     else
 #endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::BgraToBayer(bgra, width, height, bgraStride, bayer, bayerStride, bayerFormat);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::BackgroundPackedUpdate(value, valueStride, width, height, model, modelStride, threshold, flags);
     else
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgraToBayer(bgra, width, height, bgraStride, bayer, bayerStride, bayerFormat);
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::A)
+        Sse2::BackgroundPackedUpdate(value, valueStride, width, height, model, modelStride, threshold, flags);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::BgraToBayer(bgra, width, height, bgraStride, bayer, bayerStride, bayerFormat);
+        Neon::BackgroundPackedUpdate(value, valueStride, width, height, model, modelStride, threshold, flags);
     else
 #endif
-        Base::BgraToBayer(bgra, width, height, bgraStride, bayer, bayerStride, bayerFormat);
+        Base::BackgroundPackedUpdate(value, valueStride, width, height, model, modelStride, threshold, flags);
 }
 
-SIMD_API void SimdBgraToBgr(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bgr, size_t bgrStride)
+SIMD_API void SimdBackgroundPackedGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
+        Avx512bw::BackgroundPackedGrowRangeSlow(value, valueStride, width, height, model, modelStride);
     else
 #endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::BackgroundPackedGrowRangeSlow(value, valueStride, width, height, model, modelStride);
     else
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::A)
+        Sse2::BackgroundPackedGrowRangeSlow(value, valueStride, width, height, model, modelStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
+        Neon::BackgroundPackedGrowRangeSlow(value, valueStride, width, height, model, modelStride);
     else
 #endif
-        Base::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
+        Base::BackgroundPackedGrowRangeSlow(value, valueStride, width, height, model, modelStride);
 }
 
-SIMD_API void SimdBgraToGray(const uint8_t *bgra, size_t width, size_t height, size_t bgraStride, uint8_t *gray, size_t grayStride)
+SIMD_API void SimdBackgroundPackedAdjustRangeMasked(uint8_t * model, size_t modelStride, size_t width, size_t height,
+    uint8_t threshold, const uint8_t * mask, size_t maskStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
+        Avx512bw::BackgroundPackedAdjustRangeMasked(model, modelStride, width, height, threshold, mask, maskStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::BackgroundPackedAdjustRangeMasked(model, modelStride, width, height, threshold, mask, maskStride);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
+    if (Sse2::Enable && width >= Sse2::A)
+        Sse2::BackgroundPackedAdjustRangeMasked(model, modelStride, width, height, threshold, mask, maskStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::HA)
-        Neon::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::BackgroundPackedAdjustRangeMasked(model, modelStride, width, height, threshold, mask, maskStride);
     else
 #endif
-        Base::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
+        Base::BackgroundPackedAdjustRangeMasked(model, modelStride, width, height, threshold, mask, maskStride);
 }
 
-SIMD_API void SimdBgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+SIMD_API void SimdBackgroundPackedShiftRange(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        Avx512bw::BackgroundPackedShiftRange(value, valueStride, width, height, model, modelStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::DA)
-        Ssse3::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::BackgroundPackedShiftRange(value, valueStride, width, height, model, modelStride);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::DA)
-        Sse2::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+    if (Sse2::Enable && width >= Sse2::A)
+        Sse2::BackgroundPackedShiftRange(value, valueStride, width, height, model, modelStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::BackgroundPackedShiftRange(value, valueStride, width, height, model, modelStride);
     else
 #endif
-        Base::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        Base::BackgroundPackedShiftRange(value, valueStride, width, height, model, modelStride);
 }
 
-SIMD_API void SimdBgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+SIMD_API void SimdBackgroundPackedShiftRangeMasked(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+    uint8_t * model, size_t modelStride, const uint8_t * mask, size_t maskStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        Avx512bw::BackgroundPackedShiftRangeMasked(value, valueStride, width, height, model, modelStride, mask, maskStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::DA)
-        Ssse3::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::BackgroundPackedShiftRangeMasked(value, valueStride, width, height, model, modelStride, mask, maskStride);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::DA)
-        Sse2::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+    if (Sse2::Enable && width >= Sse2::A)
+        Sse2::BackgroundPackedShiftRangeMasked(value, valueStride, width, height, model, modelStride, mask, maskStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::BackgroundPackedShiftRangeMasked(value, valueStride, width, height, model, modelStride, mask, maskStride);
     else
 #endif
-        Base::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        Base::BackgroundPackedShiftRangeMasked(value, valueStride, width, height, model, modelStride, mask, maskStride);
 }
 
-SIMD_API void SimdBgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+SIMD_API void SimdBayerToBgr(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+    if (Avx512bw::Enable && width >= Avx512bw::A + 2)
+        Avx512bw::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+    if (Avx2::Enable && width >= Avx2::A + 2)
+        Avx2::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
     else
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::A + 2)
+        Ssse3::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+    if (Neon::Enable && width >= Neon::A + 2)
+        Neon::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
     else
 #endif
-        Base::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        Base::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
 }
 
-SIMD_API void SimdBgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, 
-    uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, uint8_t * a, size_t aStride)
+SIMD_API void SimdBayerToBgra(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgraToYuva420p(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
+    if (Avx512bw::Enable && width >= Avx512bw::A + 2)
+        Avx512bw::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::DA)
-        Avx2::BgraToYuva420p(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
+    if (Avx2::Enable && width >= Avx2::A + 2)
+        Avx2::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
     else
 #endif
-#ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && width >= Ssse3::DA)
-        Ssse3::BgraToYuva420p(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::DA)
-        Sse2::BgraToYuva420p(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::A + 2)
+        Sse2::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::BgraToYuva420p(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
+    if (Neon::Enable && width >= Neon::A + 2)
+        Neon::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
     else
 #endif
-        Base::BgraToYuva420p(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
+        Base::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
 }
 
-SIMD_API void SimdBgrToBayer(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat)
+SIMD_API void SimdBayerToBgrMhc(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgrToBayer(bgr, width, height, bgrStride, bayer, bayerStride, bayerFormat);
+    if (Avx512bw::Enable && width >= Avx512bw::A + 4)
+        Avx512bw::BayerToBgrMhc(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
     else
 #endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::BgrToBayer(bgr, width, height, bgrStride, bayer, bayerStride, bayerFormat);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A + 4)
+        Avx2::BayerToBgrMhc(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
     else
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgrToBayer(bgr, width, height, bgrStride, bayer, bayerStride, bayerFormat);
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::A + 4)
+        Ssse3::BayerToBgrMhc(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BgrToBayer(bgr, width, height, bgrStride, bayer, bayerStride, bayerFormat);
+    if (Neon::Enable && width >= Neon::A + 4)
+        Neon::BayerToBgrMhc(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
     else
 #endif
-        Base::BgrToBayer(bgr, width, height, bgrStride, bayer, bayerStride, bayerFormat);
+        Base::BayerToBgrMhc(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
 }
 
-SIMD_API void SimdBgrToBgra(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *bgra, size_t bgraStride, uint8_t alpha)
+SIMD_API void SimdBayerToBgraMhc(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
-    else
-#endif
-#if defined(SIMD_AVX2_ENABLE) && !defined(SIMD_CLANG_AVX2_BGR_TO_BGRA_ERROR)
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
+    if (Avx512bw::Enable && width >= Avx512bw::A + 4)
+        Avx512bw::BayerToBgraMhc(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
     else
 #endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A + 4)
+        Avx2::BayerToBgraMhc(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
     else
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::A + 4)
+        Sse2::BayerToBgraMhc(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
+    if (Neon::Enable && width >= Neon::A + 4)
+        Neon::BayerToBgraMhc(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
     else
 #endif
-        Base::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
+        Base::BayerToBgraMhc(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
 }
 
-SIMD_API void SimdBgr48pToBgra32(const uint8_t * blue, size_t blueStride, size_t width, size_t height,
-    const uint8_t * green, size_t greenStride, const uint8_t * red, size_t redStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+SIMD_API void SimdBayerToBgrHalf(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
+    if (Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::BayerToBgrHalf(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::HA)
-        Avx2::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::HA)
-        Sse2::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::BayerToBgrHalf(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
     else
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::HA)
-        Vmx::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BayerToBgrHalf(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::BayerToBgrHalf(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
     else
 #endif
-        Base::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
+        Base::BayerToBgrHalf(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
 }
 
-SIMD_API void SimdBgrToGray(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *gray, size_t grayStride)
+SIMD_API void SimdBayerToGray(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * gray, size_t grayStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
-    else
-#endif
-#if defined(SIMD_AVX2_ENABLE) && !defined(SIMD_CLANG_AVX2_BGR_TO_BGRA_ERROR)
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
+    if (Avx512bw::Enable && width >= Avx512bw::A + 4)
+        Avx512bw::BayerToGray(bayer, width, height, bayerStride, bayerFormat, gray, grayStride);
     else
 #endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A + 4)
+        Avx2::BayerToGray(bayer, width, height, bayerStride, bayerFormat, gray, grayStride);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
+    if (Sse2::Enable && width >= Sse2::A + 4)
+        Sse2::BayerToGray(bayer, width, height, bayerStride, bayerFormat, gray, grayStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
+    if (Neon::Enable && width >= Neon::A + 4)
+        Neon::BayerToGray(bayer, width, height, bayerStride, bayerFormat, gray, grayStride);
     else
 #endif
-        Base::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
-}
-
-SIMD_API void SimdBgrToHsl(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsl, size_t hslStride)
-{
-    Base::BgrToHsl(bgr, width, height, bgrStride, hsl, hslStride);
-}
-
-SIMD_API void SimdBgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride)
-{
-    Base::BgrToHsv(bgr, width, height, bgrStride, hsv, hsvStride);
+        Base::BayerToGray(bayer, width, height, bayerStride, bayerFormat, gray, grayStride);
 }
 
-SIMD_API void SimdBgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+SIMD_API void SimdBgraToBayer(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        Avx512bw::BgraToBayer(bgra, width, height, bgraStride, bayer, bayerStride, bayerFormat);
     else
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::DA)
-        Ssse3::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+    if(Ssse3::Enable && width >= Ssse3::A)
+        Ssse3::BgraToBayer(bgra, width, height, bgraStride, bayer, bayerStride, bayerFormat);
     else
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+    if(Vmx::Enable && width >= Vmx::A)
+        Vmx::BgraToBayer(bgra, width, height, bgraStride, bayer, bayerStride, bayerFormat);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::BgraToBayer(bgra, width, height, bgraStride, bayer, bayerStride, bayerFormat);
     else
 #endif
-        Base::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        Base::BgraToBayer(bgra, width, height, bgraStride, bayer, bayerStride, bayerFormat);
 }
 
-SIMD_API void SimdBgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+SIMD_API void SimdBgraToBgr(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bgr, size_t bgrStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        Avx512bw::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
     else
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::DA)
-        Ssse3::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+    if(Ssse3::Enable && width >= Ssse3::A)
+        Ssse3::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
     else
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+    if(Vmx::Enable && width >= Vmx::A)
+        Vmx::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
     else
 #endif
-        Base::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        Base::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
 }
 
-SIMD_API void SimdBgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+SIMD_API void SimdBgraToRgb(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * rgb, size_t rgbStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        Avx512bw::BgraToRgb(bgra, width, height, bgraStride, rgb, rgbStride);
     else
 #endif
 #ifdef SIMD_SSSE3_ENABLE
     if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        Ssse3::BgraToRgb(bgra, width, height, bgraStride, rgb, rgbStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        Neon::BgraToRgb(bgra, width, height, bgraStride, rgb, rgbStride);
     else
 #endif
-        Base::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        Base::BgraToRgb(bgra, width, height, bgraStride, rgb, rgbStride);
 }
 
-SIMD_API void SimdBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-                  uint8_t value, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride, SimdCompareType compareType)
+SIMD_API void SimdBgraToGray(const uint8_t *bgra, size_t width, size_t height, size_t bgraStride, uint8_t *gray, size_t grayStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
+        Avx512bw::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width >= Avx2::A)
-        Avx2::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
+        Avx2::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
     if(Sse2::Enable && width >= Sse2::A)
-        Sse2::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
+        Sse2::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
     else
 #endif
 #ifdef SIMD_VMX_ENABLE
     if(Vmx::Enable && width >= Vmx::A)
-        Vmx::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
+        Vmx::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
+    if (Neon::Enable && width >= Neon::HA)
+        Neon::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
     else
 #endif
-        Base::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
+        Base::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
 }
 
-SIMD_API void SimdAveragingBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-                           uint8_t value, size_t neighborhood, uint8_t threshold, uint8_t positive, uint8_t negative,
-                           uint8_t * dst, size_t dstStride, SimdCompareType compareType)
+SIMD_API void SimdBgraToNv12(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
+        Avx512bw::BgraToNv12(bgra, width, height, bgraStride, y, yStride, uv, uvStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgraToNv12(bgra, width, height, bgraStride, y, yStride, uv, uvStride);
     else
 #endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgraToNv12(bgra, width, height, bgraStride, y, yStride, uv, uvStride);
     else
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::BgraToNv12(bgra, width, height, bgraStride, y, yStride, uv, uvStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::BgraToNv12(bgra, width, height, bgraStride, y, yStride, uv, uvStride);
     else
 #endif
-        Base::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
+        Base::BgraToNv12(bgra, width, height, bgraStride, y, yStride, uv, uvStride);
 }
 
-SIMD_API void SimdConditionalCount8u(const uint8_t * src, size_t stride, size_t width, size_t height,
-                                   uint8_t value, SimdCompareType compareType, uint32_t * count)
+SIMD_API void SimdBgraToNv12V2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::ConditionalCount8u(src, stride, width, height, value, compareType, count);
+        Avx512bw::BgraToNv12V2(bgra, width, height, bgraStride, y, yStride, uv, uvStride, yuvType);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::ConditionalCount8u(src, stride, width, height, value, compareType, count);
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgraToNv12V2(bgra, width, height, bgraStride, y, yStride, uv, uvStride, yuvType);
     else
 #endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::ConditionalCount8u(src, stride, width, height, value, compareType, count);
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgraToNv12V2(bgra, width, height, bgraStride, y, yStride, uv, uvStride, yuvType);
     else
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::ConditionalCount8u(src, stride, width, height, value, compareType, count);
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::BgraToNv12V2(bgra, width, height, bgraStride, y, yStride, uv, uvStride, yuvType);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::ConditionalCount8u(src, stride, width, height, value, compareType, count);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::BgraToNv12V2(bgra, width, height, bgraStride, y, yStride, uv, uvStride, yuvType);
     else
 #endif
-        Base::ConditionalCount8u(src, stride, width, height, value, compareType, count);
+        Base::BgraToNv12V2(bgra, width, height, bgraStride, y, yStride, uv, uvStride, yuvType);
 }
 
-SIMD_API void SimdConditionalCount16i(const uint8_t * src, size_t stride, size_t width, size_t height,
-                                     int16_t value, SimdCompareType compareType, uint32_t * count)
+SIMD_API void SimdBgraToNv21(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * vu, size_t vuStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::ConditionalCount16i(src, stride, width, height, value, compareType, count);
+        Avx512bw::BgraToNv21(bgra, width, height, bgraStride, y, yStride, vu, vuStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::HA)
-        Avx2::ConditionalCount16i(src, stride, width, height, value, compareType, count);
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgraToNv21(bgra, width, height, bgraStride, y, yStride, vu, vuStride);
     else
 #endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::HA)
-        Sse2::ConditionalCount16i(src, stride, width, height, value, compareType, count);
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgraToNv21(bgra, width, height, bgraStride, y, yStride, vu, vuStride);
     else
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::HA)
-        Vmx::ConditionalCount16i(src, stride, width, height, value, compareType, count);
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::BgraToNv21(bgra, width, height, bgraStride, y, yStride, vu, vuStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::HA)
-        Neon::ConditionalCount16i(src, stride, width, height, value, compareType, count);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::BgraToNv21(bgra, width, height, bgraStride, y, yStride, vu, vuStride);
     else
 #endif
-        Base::ConditionalCount16i(src, stride, width, height, value, compareType, count);
+        Base::BgraToNv21(bgra, width, height, bgraStride, y, yStride, vu, vuStride);
 }
 
-SIMD_API void SimdConditionalSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-                                 const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum)
+SIMD_API void SimdBgraToNv21V2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * vu, size_t vuStride, SimdYuvType yuvType)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
+        Avx512bw::BgraToNv21V2(bgra, width, height, bgraStride, y, yStride, vu, vuStride, yuvType);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgraToNv21V2(bgra, width, height, bgraStride, y, yStride, vu, vuStride, yuvType);
     else
 #endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgraToNv21V2(bgra, width, height, bgraStride, y, yStride, vu, vuStride, yuvType);
     else
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::BgraToNv21V2(bgra, width, height, bgraStride, y, yStride, vu, vuStride, yuvType);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::BgraToNv21V2(bgra, width, height, bgraStride, y, yStride, vu, vuStride, yuvType);
     else
 #endif
-        Base::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
+        Base::BgraToNv21V2(bgra, width, height, bgraStride, y, yStride, vu, vuStride, yuvType);
 }
 
-SIMD_API void SimdConditionalSquareSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-                                       const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum)
+SIMD_API void SimdBgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
+        Avx512bw::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
+    if(Sse2::Enable && width >= Sse2::DA)
+        Sse2::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
+    if(Vmx::Enable && width >= Vmx::DA)
+        Vmx::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
-        Base::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
+        Base::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
 }
 
-SIMD_API void SimdConditionalSquareGradientSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-                                       const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum)
+SIMD_API void SimdBgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
+        Avx512bw::BgraToYuv420pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A + 2)
-        Avx2::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgraToYuv420pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
     else
 #endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A + 2)
-        Sse2::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgraToYuv420pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
     else
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A + 2)
-        Vmx::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::DA)
+        Sse2::BgraToYuv420pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A + 2)
-        Neon::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::BgraToYuv420pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
     else
 #endif
-        Base::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
+        Base::BgraToYuv420pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
 }
 
-SIMD_API void SimdConditionalFill(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t threshold, SimdCompareType compareType, uint8_t value, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdBgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
+        Avx512bw::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A)
-        Sse2::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
+    if(Sse2::Enable && width >= Sse2::DA)
+        Sse2::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if (Vmx::Enable && width >= Vmx::A)
-        Vmx::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
+    if(Vmx::Enable && width >= Vmx::DA)
+        Vmx::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
-        Base::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
-}
-
-SIMD_API void SimdCopy(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, uint8_t * dst, size_t dstStride)
-{
-    Base::Copy(src, srcStride, width, height, pixelSize, dst, dstStride);
-}
-
-SIMD_API void SimdCopyFrame(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize,
-                           size_t frameLeft, size_t frameTop, size_t frameRight, size_t frameBottom, uint8_t * dst, size_t dstStride)
-{
-    Base::CopyFrame(src, srcStride, width, height, pixelSize, frameLeft, frameTop, frameRight, frameBottom, dst, dstStride);
-}
-
-typedef void* (*SimdConvolutionInitPtr) (SimdBool trans, size_t batch, size_t srcC, size_t srcH, size_t srcW, size_t dstC,
-    size_t kernelY, size_t kernelX, size_t dilationY, size_t dilationX, size_t strideY, size_t strideX,
-    size_t padY, size_t padX, size_t padH, size_t padW, size_t group, SimdConvolutionActivationType activation, SimdGemm32fNNPtr gemm);
-
-SimdConvolutionInitPtr simdConvolutionInit = SIMD_FUNC6(ConvolutionInit, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE3_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void * SimdConvolutionInit(SimdBool trans, size_t batch, size_t srcC, size_t srcH, size_t srcW, size_t dstC,
-    size_t kernelY, size_t kernelX, size_t dilationY, size_t dilationX, size_t strideY, size_t strideX,
-    size_t padY, size_t padX, size_t padH, size_t padW, size_t group, SimdConvolutionActivationType activation, SimdGemm32fNNPtr gemm)
-{
-    return simdConvolutionInit(trans, batch, srcC, srcH, srcW, dstC, kernelY, kernelX, dilationY, dilationX, strideY, strideX, padY, padX, padH, padW, group, activation, gemm);
-}
-
-SIMD_API size_t SimdConvolutionExternalBufferSize(const void * convolution)
-{
-    return ((Convolution*)convolution)->ExternalBufferSize();
-}
-
-SIMD_API size_t SimdConvolutionInternalBufferSize(const void * convolution)
-{
-    return ((Convolution*)convolution)->InternalBufferSize();
-}
-
-SIMD_API void SimdConvolutionSetParams(void * convolution, const float * weight, SimdBool trans, SimdBool * internal, const float * bias, const float * params)
-{
-    ((Convolution*)convolution)->SetParams(weight, trans, internal, bias, params);
+        Base::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
 }
 
-SIMD_API void SimdConvolutionForward(void * convolution, const float * src, float * buf, float * dst)
+SIMD_API void SimdBgraToYuv422pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
 {
-    ((Convolution*)convolution)->Forward(src, buf, dst);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::BgraToYuv422pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgraToYuv422pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgraToYuv422pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::DA)
+        Sse2::BgraToYuv422pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::BgraToYuv422pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+        Base::BgraToYuv422pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
 }
 
-SIMD_API void SimdDeinterleaveUv(const uint8_t * uv, size_t uvStride, size_t width, size_t height,
-                    uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+SIMD_API void SimdBgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
+        Avx512bw::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width >= Avx2::A)
-        Avx2::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
+        Avx2::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
     if(Sse2::Enable && width >= Sse2::A)
-        Sse2::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
+        Sse2::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
 #ifdef SIMD_VMX_ENABLE
     if(Vmx::Enable && width >= Vmx::A)
-        Vmx::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
+        Vmx::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
+        Neon::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
-        Base::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
+        Base::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
 }
 
-SIMD_API void SimdDeinterleaveBgr(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height,
-    uint8_t * b, size_t bStride, uint8_t * g, size_t gStride, uint8_t * r, size_t rStride)
+SIMD_API void SimdBgraToYuv444pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::DeinterleaveBgr(bgr, bgrStride, width, height, b, bStride, g, gStride, r, rStride);
+        Avx512bw::BgraToYuv444pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DeinterleaveBgr(bgr, bgrStride, width, height, b, bStride, g, gStride, r, rStride);
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::BgraToYuv444pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
     else
 #endif
-#ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::DeinterleaveBgr(bgr, bgrStride, width, height, b, bStride, g, gStride, r, rStride);
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::BgraToYuv444pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::DeinterleaveBgr(bgr, bgrStride, width, height, b, bStride, g, gStride, r, rStride);
+        Neon::BgraToYuv444pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
     else
 #endif
-        Base::DeinterleaveBgr(bgr, bgrStride, width, height, b, bStride, g, gStride, r, rStride);
+        Base::BgraToYuv444pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
 }
 
-SIMD_API void SimdDeinterleaveBgra(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height,
-    uint8_t * b, size_t bStride, uint8_t * g, size_t gStride, uint8_t * r, size_t rStride, uint8_t * a, size_t aStride)
+SIMD_API void SimdBgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, 
+    uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, uint8_t * a, size_t aStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::DeinterleaveBgra(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
+        Avx512bw::BgraToYuva420p(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DeinterleaveBgra(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgraToYuva420p(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
     else
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::DeinterleaveBgra(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgraToYuva420p(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::BgraToYuva420p(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::DeinterleaveBgra(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::BgraToYuva420p(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
     else
 #endif
-        Base::DeinterleaveBgra(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
-}
-
-SIMD_API void * SimdDetectionLoadA(const char * path)
-{
-    return Base::DetectionLoadA(path);
-}
-
-SIMD_API void SimdDetectionInfo(const void * data, size_t * width, size_t * height, SimdDetectionInfoFlags * flags)
-{
-    Base::DetectionInfo(data, width, height, flags);
-}
-
-SIMD_API void * SimdDetectionInit(const void * data, uint8_t * sum, size_t sumStride, size_t width, size_t height,
-    uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride, int throughColumn, int int16)
-{
-    return Base::DetectionInit(data, sum, sumStride, width, height, sqsum, sqsumStride, tilted, tiltedStride, throughColumn, int16);
-}
-
-SIMD_API void SimdDetectionPrepare(void * hid)
-{
-    Base::DetectionPrepare(hid);
+        Base::BgraToYuva420p(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
 }
 
-SIMD_API void SimdDetectionHaarDetect32fp(const void * hid, const uint8_t * mask, size_t maskStride, 
-    ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdBgrToBayer(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat)
 {
-    size_t width = right - left;
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::DetectionHaarDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+        Avx512bw::BgrToBayer(bgr, width, height, bgrStride, bayer, bayerStride, bayerFormat);
     else
 #endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DetectionHaarDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::A)
+        Ssse3::BgrToBayer(bgr, width, height, bgrStride, bayer, bayerStride, bayerFormat);
     else
 #endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::DetectionHaarDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::A)
+        Vmx::BgrToBayer(bgr, width, height, bgrStride, bayer, bayerStride, bayerFormat);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::DetectionHaarDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+        Neon::BgrToBayer(bgr, width, height, bgrStride, bayer, bayerStride, bayerFormat);
     else
 #endif
-        Base::DetectionHaarDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+        Base::BgrToBayer(bgr, width, height, bgrStride, bayer, bayerStride, bayerFormat);
 }
 
-SIMD_API void SimdDetectionHaarDetect32fi(const void * hid, const uint8_t * mask, size_t maskStride,
-    ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdBgrToBgra(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *bgra, size_t bgraStride, uint8_t alpha)
 {
-    size_t width = right - left;
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::DetectionHaarDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+        Avx512bw::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
     else
 #endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DetectionHaarDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+#if defined(SIMD_AVX2_ENABLE) && !defined(SIMD_CLANG_AVX2_BGR_TO_BGRA_ERROR)
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
     else
 #endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::DetectionHaarDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::A)
+        Ssse3::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::A)
+        Vmx::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::DetectionHaarDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+        Neon::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
     else
 #endif
-        Base::DetectionHaarDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+        Base::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
 }
 
-SIMD_API void SimdDetectionLbpDetect32fp(const void * hid, const uint8_t * mask, size_t maskStride,
-    ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdBgrToRgba(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *rgba, size_t rgbaStride, uint8_t alpha)
 {
-    size_t width = right - left;
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::DetectionLbpDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+        Avx512bw::BgrToRgba(bgr, width, height, bgrStride, rgba, rgbaStride, alpha);
     else
 #endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DetectionLbpDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+#if defined(SIMD_AVX2_ENABLE) && !defined(SIMD_CLANG_AVX2_BGR_TO_BGRA_ERROR)
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::BgrToRgba(bgr, width, height, bgrStride, rgba, rgbaStride, alpha);
     else
 #endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::DetectionLbpDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::A)
+        Ssse3::BgrToRgba(bgr, width, height, bgrStride, rgba, rgbaStride, alpha);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::DetectionLbpDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+        Neon::BgrToRgba(bgr, width, height, bgrStride, rgba, rgbaStride, alpha);
     else
 #endif
-        Base::DetectionLbpDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+        Base::BgrToRgba(bgr, width, height, bgrStride, rgba, rgbaStride, alpha);
 }
 
-SIMD_API void SimdDetectionLbpDetect32fi(const void * hid, const uint8_t * mask, size_t maskStride,
-    ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdBgr48pToBgra32(const uint8_t * blue, size_t blueStride, size_t width, size_t height,
+    const uint8_t * green, size_t greenStride, const uint8_t * red, size_t redStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
-    size_t width = right - left;
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::DetectionLbpDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+        Avx512bw::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DetectionLbpDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+    if(Avx2::Enable && width >= Avx2::HA)
+        Avx2::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
     else
 #endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::DetectionLbpDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::HA)
+        Sse2::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::HA)
+        Vmx::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::DetectionLbpDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+        Neon::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
     else
 #endif
-        Base::DetectionLbpDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+        Base::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
 }
 
-SIMD_API void SimdDetectionLbpDetect16ip(const void * hid, const uint8_t * mask, size_t maskStride,
-    ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdBgrToGray(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *gray, size_t grayStride)
 {
-    size_t width = right - left;
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::DetectionLbpDetect16ip(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+        Avx512bw::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
     else
 #endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DetectionLbpDetect16ip(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+#if defined(SIMD_AVX2_ENABLE) && !defined(SIMD_CLANG_AVX2_BGR_TO_BGRA_ERROR)
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
     else
 #endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::DetectionLbpDetect16ip(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::A)
+        Ssse3::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::A)
+        Vmx::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::DetectionLbpDetect16ip(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+        Neon::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
     else
 #endif
-        Base::DetectionLbpDetect16ip(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+        Base::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
 }
 
-SIMD_API void SimdDetectionLbpDetect16ii(const void * hid, const uint8_t * mask, size_t maskStride,
-    ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdBgrToHsl(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsl, size_t hslStride)
 {
-    size_t width = right - left;
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+    if (Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::BgrToHsl(bgr, width, height, bgrStride, hsl, hslStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
     if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+        Avx2::BgrToHsl(bgr, width, height, bgrStride, hsl, hslStride);
     else
 #endif
 #ifdef SIMD_SSE41_ENABLE
     if (Sse41::Enable && width >= Sse41::A)
-        Sse41::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+        Sse41::BgrToHsl(bgr, width, height, bgrStride, hsl, hslStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+        Neon::BgrToHsl(bgr, width, height, bgrStride, hsl, hslStride);
     else
 #endif
-        Base::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+        Base::BgrToHsl(bgr, width, height, bgrStride, hsl, hslStride);
 }
 
-SIMD_API void SimdEdgeBackgroundGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height,
-                                 uint8_t * background, size_t backgroundStride)
+SIMD_API void SimdBgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
+    if (Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::BgrToHsv(bgr, width, height, bgrStride, hsv, hsvStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::BgrToHsv(bgr, width, height, bgrStride, hsv, hsvStride);
     else
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::BgrToHsv(bgr, width, height, bgrStride, hsv, hsvStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
+        Neon::BgrToHsv(bgr, width, height, bgrStride, hsv, hsvStride);
     else
 #endif
-        Base::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
+        Base::BgrToHsv(bgr, width, height, bgrStride, hsv, hsvStride);
 }
 
-SIMD_API void SimdEdgeBackgroundGrowRangeFast(const uint8_t * value, size_t valueStride, size_t width, size_t height,
-                                 uint8_t * background, size_t backgroundStride)
+SIMD_API void SimdBgrToHsvInRange(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, const uint8_t * lower, const uint8_t * upper, uint8_t * mask, size_t maskStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
+    if (Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::BgrToHsvInRange(bgr, width, height, bgrStride, lower, upper, mask, maskStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::BgrToHsvInRange(bgr, width, height, bgrStride, lower, upper, mask, maskStride);
     else
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::BgrToHsvInRange(bgr, width, height, bgrStride, lower, upper, mask, maskStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
+        Neon::BgrToHsvInRange(bgr, width, height, bgrStride, lower, upper, mask, maskStride);
     else
 #endif
-        Base::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
+        Base::BgrToHsvInRange(bgr, width, height, bgrStride, lower, upper, mask, maskStride);
 }
 
-SIMD_API void SimdEdgeBackgroundIncrementCount(const uint8_t * value, size_t valueStride, size_t width, size_t height,
-                                  const uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t * backgroundCount, size_t backgroundCountStride)
+SIMD_API void SimdBgrToLab(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * lab, size_t labStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
+    if (Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::BgrToLab(bgr, width, height, bgrStride, lab, labStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::BgrToLab(bgr, width, height, bgrStride, lab, labStride);
     else
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::BgrToLab(bgr, width, height, bgrStride, lab, labStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
+        Neon::BgrToLab(bgr, width, height, bgrStride, lab, labStride);
     else
 #endif
-        Base::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
+        Base::BgrToLab(bgr, width, height, bgrStride, lab, labStride);
 }
 
-SIMD_API void SimdEdgeBackgroundAdjustRange(uint8_t * backgroundCount, size_t backgroundCountStride, size_t width, size_t height,
-                               uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t threshold)
+SIMD_API void SimdBgrToLab32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * lab, size_t labStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
+    if (Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::BgrToLab32f(bgr, width, height, bgrStride, lab, labStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::BgrToLab32f(bgr, width, height, bgrStride, lab, labStride);
     else
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::BgrToLab32f(bgr, width, height, bgrStride, lab, labStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
+        Neon::BgrToLab32f(bgr, width, height, bgrStride, lab, labStride);
     else
 #endif
-        Base::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
+        Base::BgrToLab32f(bgr, width, height, bgrStride, lab, labStride);
 }
 
-SIMD_API void SimdEdgeBackgroundAdjustRangeMasked(uint8_t * backgroundCount, size_t backgroundCountStride, size_t width, size_t height,
-                               uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t threshold, const uint8_t * mask, size_t maskStride)
+SIMD_API void SimdBgrToYCoCgR(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * co, size_t coStride, uint8_t * cg, size_t cgStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
+    if (Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::BgrToYCoCgR(bgr, width, height, bgrStride, y, yStride, co, coStride, cg, cgStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::BgrToYCoCgR(bgr, width, height, bgrStride, y, yStride, co, coStride, cg, cgStride);
     else
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::BgrToYCoCgR(bgr, width, height, bgrStride, y, yStride, co, coStride, cg, cgStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
+        Neon::BgrToYCoCgR(bgr, width, height, bgrStride, y, yStride, co, coStride, cg, cgStride);
     else
 #endif
-        Base::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
-}
-
-SIMD_API void SimdEdgeBackgroundShiftRange(const uint8_t * value, size_t valueStride, size_t width, size_t height,
-                              uint8_t * background, size_t backgroundStride)
-{
-    Base::EdgeBackgroundShiftRange(value, valueStride, width, height, background, backgroundStride);
+        Base::BgrToYCoCgR(bgr, width, height, bgrStride, y, yStride, co, coStride, cg, cgStride);
 }
 
-SIMD_API void SimdEdgeBackgroundShiftRangeMasked(const uint8_t * value, size_t valueStride, size_t width, size_t height,
-                              uint8_t * background, size_t backgroundStride, const uint8_t * mask, size_t maskStride)
+SIMD_API void SimdBgrToNv12(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
+        Avx512bw::BgrToNv12(bgr, width, height, bgrStride, y, yStride, uv, uvStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgrToNv12(bgr, width, height, bgrStride, y, yStride, uv, uvStride);
     else
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgrToNv12(bgr, width, height, bgrStride, y, yStride, uv, uvStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::BgrToNv12(bgr, width, height, bgrStride, y, yStride, uv, uvStride);
     else
 #endif
-        Base::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
-}
-
-SIMD_API void SimdFill(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize, uint8_t value)
-{
-    Base::Fill(dst, stride, width, height, pixelSize, value);
-}
-
-SIMD_API void SimdFillFrame(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize,
-                           size_t frameLeft, size_t frameTop, size_t frameRight, size_t frameBottom, uint8_t value)
-{
-    Base::FillFrame(dst, stride, width, height, pixelSize, frameLeft, frameTop, frameRight, frameBottom, value);
+        Base::BgrToNv12(bgr, width, height, bgrStride, y, yStride, uv, uvStride);
 }
 
-SIMD_API void SimdFillBgr(uint8_t * dst, size_t stride, size_t width, size_t height, uint8_t blue, uint8_t green, uint8_t red)
+SIMD_API void SimdBgrToNv12V2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::FillBgr(dst, stride, width, height, blue, green, red);
+        Avx512bw::BgrToNv12V2(bgr, width, height, bgrStride, y, yStride, uv, uvStride, yuvType);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::FillBgr(dst, stride, width, height, blue, green, red);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::FillBgr(dst, stride, width, height, blue, green, red);
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgrToNv12V2(bgr, width, height, bgrStride, y, yStride, uv, uvStride, yuvType);
     else
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::FillBgr(dst, stride, width, height, blue, green, red);
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgrToNv12V2(bgr, width, height, bgrStride, y, yStride, uv, uvStride, yuvType);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::FillBgr(dst, stride, width, height, blue, green, red);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::BgrToNv12V2(bgr, width, height, bgrStride, y, yStride, uv, uvStride, yuvType);
     else
 #endif
-        Base::FillBgr(dst, stride, width, height, blue, green, red);
+        Base::BgrToNv12V2(bgr, width, height, bgrStride, y, yStride, uv, uvStride, yuvType);
 }
 
-SIMD_API void SimdFillBgra(uint8_t * dst, size_t stride, size_t width, size_t height, uint8_t blue, uint8_t green, uint8_t red, uint8_t alpha)
+SIMD_API void SimdBgrToNv21(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * vu, size_t vuStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::FillBgra(dst, stride, width, height, blue, green, red, alpha);
+        Avx512bw::BgrToNv21(bgr, width, height, bgrStride, y, yStride, vu, vuStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::F)
-        Avx2::FillBgra(dst, stride, width, height, blue, green, red, alpha);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::F)
-        Sse2::FillBgra(dst, stride, width, height, blue, green, red, alpha);
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgrToNv21(bgr, width, height, bgrStride, y, yStride, vu, vuStride);
     else
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::F)
-        Vmx::FillBgra(dst, stride, width, height, blue, green, red, alpha);
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgrToNv21(bgr, width, height, bgrStride, y, yStride, vu, vuStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::FillBgra(dst, stride, width, height, blue, green, red, alpha);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::BgrToNv21(bgr, width, height, bgrStride, y, yStride, vu, vuStride);
     else
 #endif
-        Base::FillBgra(dst, stride, width, height, blue, green, red, alpha);
+        Base::BgrToNv21(bgr, width, height, bgrStride, y, yStride, vu, vuStride);
 }
 
-SIMD_API void SimdFillPixel(uint8_t * dst, size_t stride, size_t width, size_t height, const uint8_t * pixel, size_t pixelSize)
+SIMD_API void SimdBgrToNv21V2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * vu, size_t vuStride, SimdYuvType yuvType)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::FillPixel(dst, stride, width, height, pixel, pixelSize);
+        Avx512bw::BgrToNv21V2(bgr, width, height, bgrStride, y, yStride, vu, vuStride, yuvType);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::FillPixel(dst, stride, width, height, pixel, pixelSize);
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgrToNv21V2(bgr, width, height, bgrStride, y, yStride, vu, vuStride, yuvType);
     else
 #endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A)
-        Sse2::FillPixel(dst, stride, width, height, pixel, pixelSize);
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgrToNv21V2(bgr, width, height, bgrStride, y, yStride, vu, vuStride, yuvType);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::FillPixel(dst, stride, width, height, pixel, pixelSize);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::BgrToNv21V2(bgr, width, height, bgrStride, y, yStride, vu, vuStride, yuvType);
     else
 #endif
-        Base::FillPixel(dst, stride, width, height, pixel, pixelSize);
-}
-
-typedef void(*SimdFill32fPtr) (float * dst, size_t size, const float * value);
-SimdFill32fPtr simdFill32f = SIMD_FUNC4(Fill32f, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdFill32f(float * dst, size_t size, const float * value)
-{
-    simdFill32f(dst, size, value);
+        Base::BgrToNv21V2(bgr, width, height, bgrStride, y, yStride, vu, vuStride, yuvType);
 }
 
-SIMD_API void SimdFloat32ToFloat16(const float * src, size_t size, uint16_t * dst)
+SIMD_API void SimdBgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::Float32ToFloat16(src, size, dst);
+        Avx512bw::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && size >= Avx2::F)
-        Avx2::Float32ToFloat16(src, size, dst);
-    else
-#endif
-#if defined(SIMD_NEON_ENABLE) && defined(SIMD_NEON_FP16_ENABLE)
-    if (Neon::Enable && size >= Neon::F)
-        Neon::Float32ToFloat16(src, size, dst);
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
-        Base::Float32ToFloat16(src, size, dst);
-}
-
-SIMD_API void SimdFloat16ToFloat32(const uint16_t * src, size_t size, float * dst)
-{
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::Float16ToFloat32(src, size, dst);
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && size >= Avx2::F)
-        Avx2::Float16ToFloat32(src, size, dst);
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::DA)
+        Vmx::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
-#if defined(SIMD_NEON_ENABLE) && defined(SIMD_NEON_FP16_ENABLE)
-    if (Neon::Enable && size >= Neon::F)
-        Neon::Float16ToFloat32(src, size, dst);
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
-        Base::Float16ToFloat32(src, size, dst);
+        Base::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
 }
 
-SIMD_API void SimdSquaredDifferenceSum16f(const uint16_t * a, const uint16_t * b, size_t size, float * sum)
+SIMD_API void SimdBgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::SquaredDifferenceSum16f(a, b, size, sum);
+        Avx512bw::BgrToYuv420pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && size >= Avx2::F)
-        Avx2::SquaredDifferenceSum16f(a, b, size, sum);
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgrToYuv420pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
     else
 #endif
-#if defined(SIMD_NEON_ENABLE) && defined(SIMD_NEON_FP16_ENABLE)
-    if (Neon::Enable && size >= Neon::F)
-        Neon::SquaredDifferenceSum16f(a, b, size, sum);
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgrToYuv420pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
     else
 #endif
-        Base::SquaredDifferenceSum16f(a, b, size, sum);
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::BgrToYuv420pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+        Base::BgrToYuv420pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
 }
 
-SIMD_API void SimdCosineDistance16f(const uint16_t * a, const uint16_t * b, size_t size, float * distance)
+SIMD_API void SimdBgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::CosineDistance16f(a, b, size, distance);
+        Avx512bw::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && size >= Avx2::F)
-        Avx2::CosineDistance16f(a, b, size, distance);
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
-#if defined(SIMD_NEON_ENABLE) && defined(SIMD_NEON_FP16_ENABLE)
-    if (Neon::Enable && size >= Neon::F)
-        Neon::CosineDistance16f(a, b, size, distance);
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
-        Base::CosineDistance16f(a, b, size, distance);
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::DA)
+        Vmx::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+        Base::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
 }
 
-SIMD_API void SimdCosineDistancesMxNa16f(size_t M, size_t N, size_t K, const uint16_t * const * A, const uint16_t * const * B, float * distances)
+SIMD_API void SimdBgrToYuv422pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && K >= Avx512bw::F)
-        Avx512bw::CosineDistancesMxNa16f(M, N, K, A, B, distances);
+    if (Avx512bw::Enable)
+        Avx512bw::BgrToYuv422pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && K >= Avx2::F)
-        Avx2::CosineDistancesMxNa16f(M, N, K, A, B, distances);
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgrToYuv422pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
     else
 #endif
-#if defined(SIMD_NEON_ENABLE) && defined(SIMD_NEON_FP16_ENABLE)
-    if (Neon::Enable && K >= Neon::F)
-        Neon::CosineDistancesMxNa16f(M, N, K, A, B, distances);
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgrToYuv422pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
     else
 #endif
-        Base::CosineDistancesMxNa16f(M, N, K, A, B, distances);
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::BgrToYuv422pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+        Base::BgrToYuv422pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
 }
 
-SIMD_API void SimdFloat32ToUint8(const float * src, size_t size, const float * lower, const float * upper, uint8_t * dst)
+SIMD_API void SimdBgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::Float32ToUint8(src, size, lower, upper, dst);
+        Avx512bw::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && size >= Avx2::A)
-        Avx2::Float32ToUint8(src, size, lower, upper, dst);
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && size >= Sse2::A)
-        Sse2::Float32ToUint8(src, size, lower, upper, dst);
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::A)
+        Ssse3::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::A)
+        Vmx::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && size >= Neon::A)
-        Neon::Float32ToUint8(src, size, lower, upper, dst);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
-        Base::Float32ToUint8(src, size, lower, upper, dst);
+        Base::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
 }
 
-SIMD_API void SimdUint8ToFloat32(const uint8_t * src, size_t size, const float * lower, const float * upper, float * dst)
+SIMD_API void SimdBgrToYuv444pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::Uint8ToFloat32(src, size, lower, upper, dst);
+        Avx512bw::BgrToYuv444pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && size >= Avx2::HA)
-        Avx2::Uint8ToFloat32(src, size, lower, upper, dst);
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::BgrToYuv444pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
     else
 #endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && size >= Sse2::A)
-        Sse2::Uint8ToFloat32(src, size, lower, upper, dst);
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::A)
+        Ssse3::BgrToYuv444pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && size >= Neon::A)
-        Neon::Uint8ToFloat32(src, size, lower, upper, dst);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::BgrToYuv444pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
     else
 #endif
-        Base::Uint8ToFloat32(src, size, lower, upper, dst);
-}
-
-typedef void(*SimdCosineDistance32fPtr) (const float * a, const float * b, size_t size, float * distance);
-SimdCosineDistance32fPtr simdCosineDistance32f = SIMD_FUNC5(CosineDistance32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdCosineDistance32f(const float * a, const float * b, size_t size, float * distance)
-{
-    simdCosineDistance32f(a, b, size, distance);
+        Base::BgrToYuv444pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
 }
 
-SIMD_API void SimdGaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-                     size_t channelCount, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+                  uint8_t value, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride, SimdCompareType compareType)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
-        Avx512bw::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    if (Avx512bw::Enable)
+        Avx512bw::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && (width - 1)*channelCount >= Avx2::A)
-        Avx2::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && (width - 1)*channelCount >= Ssse3::A)
-        Ssse3::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && (width - 1)*channelCount >= Sse2::A)
-        Sse2::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
     else
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && (width - 1)*channelCount >= Vmx::A)
-        Vmx::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    if(Vmx::Enable && width >= Vmx::A)
+        Vmx::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && (width - 1)*channelCount >= Neon::A)
-        Neon::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
     else
 #endif
-        Base::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-}
-
-typedef void(*SimdGemm32fPtr) (size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
-
-SimdGemm32fPtr simdGemm32fNN = SIMD_FUNC5(Gemm32fNN, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdGemm32fNN(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc)
-{
-    simdGemm32fNN(M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
-}
-
-SimdGemm32fPtr simdGemm32fNT = SIMD_FUNC5(Gemm32fNT, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE3_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdGemm32fNT(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc)
-{
-    simdGemm32fNT(M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+        Base::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
 }
 
-SIMD_API void SimdGrayToBgr(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgr, size_t bgrStride)
+SIMD_API void SimdAveragingBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+                           uint8_t value, size_t neighborhood, uint8_t threshold, uint8_t positive, uint8_t negative,
+                           uint8_t * dst, size_t dstStride, SimdCompareType compareType)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
+        Avx512bw::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width >= Avx2::A)
-        Avx2::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
+        Avx2::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
     else
 #endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
     else
 #endif
 #ifdef SIMD_VMX_ENABLE
     if(Vmx::Enable && width >= Vmx::A)
-        Vmx::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
+        Vmx::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
+        Neon::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
     else
 #endif
-        Base::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
+        Base::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
 }
 
-SIMD_API void SimdGrayToBgra(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+SIMD_API void SimdConditionalCount8u(const uint8_t * src, size_t stride, size_t width, size_t height,
+                                   uint8_t value, SimdCompareType compareType, uint32_t * count)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
+        Avx512bw::ConditionalCount8u(src, stride, width, height, value, compareType, count);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width >= Avx2::A)
-        Avx2::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
+        Avx2::ConditionalCount8u(src, stride, width, height, value, compareType, count);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
     if(Sse2::Enable && width >= Sse2::A)
-        Sse2::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
+        Sse2::ConditionalCount8u(src, stride, width, height, value, compareType, count);
     else
 #endif
 #ifdef SIMD_VMX_ENABLE
     if(Vmx::Enable && width >= Vmx::A)
-        Vmx::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
+        Vmx::ConditionalCount8u(src, stride, width, height, value, compareType, count);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
+        Neon::ConditionalCount8u(src, stride, width, height, value, compareType, count);
     else
 #endif
-        Base::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
+        Base::ConditionalCount8u(src, stride, width, height, value, compareType, count);
 }
 
-SIMD_API void SimdAbsSecondDerivativeHistogram(const uint8_t *src, size_t width, size_t height, size_t stride, size_t step, size_t indent, uint32_t * histogram)
+SIMD_API void SimdConditionalCount16i(const uint8_t * src, size_t stride, size_t width, size_t height,
+                                     int16_t value, SimdCompareType compareType, uint32_t * count)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::A + 2 * indent)
-        Avx512bw::AbsSecondDerivativeHistogram(src, width, height, stride, step, indent, histogram);
+    if (Avx512bw::Enable)
+        Avx512bw::ConditionalCount16i(src, stride, width, height, value, compareType, count);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A + 2*indent)
-        Avx2::AbsSecondDerivativeHistogram(src, width, height, stride, step, indent, histogram);
-    else
+    if(Avx2::Enable && width >= Avx2::HA)
+        Avx2::ConditionalCount16i(src, stride, width, height, value, compareType, count);
+    else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A + 2*indent)
-        Sse2::AbsSecondDerivativeHistogram(src, width, height, stride, step, indent, histogram);
+    if(Sse2::Enable && width >= Sse2::HA)
+        Sse2::ConditionalCount16i(src, stride, width, height, value, compareType, count);
     else
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A + 2*indent)
-        Vmx::AbsSecondDerivativeHistogram(src, width, height, stride, step, indent, histogram);
+    if(Vmx::Enable && width >= Vmx::HA)
+        Vmx::ConditionalCount16i(src, stride, width, height, value, compareType, count);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A + 2 * indent)
-        Neon::AbsSecondDerivativeHistogram(src, width, height, stride, step, indent, histogram);
+    if (Neon::Enable && width >= Neon::HA)
+        Neon::ConditionalCount16i(src, stride, width, height, value, compareType, count);
     else
 #endif
-        Base::AbsSecondDerivativeHistogram(src, width, height, stride, step, indent, histogram);
-}
-
-SIMD_API void SimdHistogram(const uint8_t *src, size_t width, size_t height, size_t stride, uint32_t * histogram)
-{
-    Base::Histogram(src, width, height, stride, histogram);
+        Base::ConditionalCount16i(src, stride, width, height, value, compareType, count);
 }
 
-SIMD_API void SimdHistogramMasked(const uint8_t *src, size_t srcStride, size_t width, size_t height, 
-                                  const uint8_t * mask, size_t maskStride, uint8_t index, uint32_t * histogram)
+SIMD_API void SimdConditionalSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+                                 const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
+        Avx512bw::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width >= Avx2::A)
-        Avx2::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
+        Avx2::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
     if(Sse2::Enable && width >= Sse2::A)
-        Sse2::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
+        Sse2::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
     else
 #endif
 #ifdef SIMD_VMX_ENABLE
     if(Vmx::Enable && width >= Vmx::A)
-        Vmx::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
+        Vmx::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
+        Neon::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
     else
 #endif
-        Base::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
+        Base::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
 }
 
-SIMD_API void SimdHistogramConditional(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-    const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint32_t * histogram)
+SIMD_API void SimdConditionalSquareSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+                                       const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::HistogramConditional(src, srcStride, width, height, mask, maskStride, value, compareType, histogram);
+        Avx512bw::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::HistogramConditional(src, srcStride, width, height, mask, maskStride, value, compareType, histogram);
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A)
-        Sse2::HistogramConditional(src, srcStride, width, height, mask, maskStride, value, compareType, histogram);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::HistogramConditional(src, srcStride, width, height, mask, maskStride, value, compareType, histogram);
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
     else
 #endif
-        Base::HistogramConditional(src, srcStride, width, height, mask, maskStride, value, compareType, histogram);
-}
-
-SIMD_API void SimdNormalizedColors(const uint32_t * histogram, uint8_t * colors)
-{
-    Base::NormalizedColors(histogram, colors);
-}
-
-SIMD_API void SimdChangeColors(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * colors, uint8_t * dst, size_t dstStride)
-{
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::HA)
-        Avx512bw::ChangeColors(src, srcStride, width, height, colors, dst, dstStride);
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::A)
+        Vmx::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
     else
 #endif
-        Base::ChangeColors(src, srcStride, width, height, colors, dst, dstStride);
-}
-
-SIMD_API void SimdNormalizeHistogram(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
-{
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::HA)
-        Avx512bw::NormalizeHistogram(src, srcStride, width, height, dst, dstStride);
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
     else
 #endif
-        Base::NormalizeHistogram(src, srcStride, width, height, dst, dstStride);
+        Base::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
 }
 
-SIMD_API void SimdHogDirectionHistograms(const uint8_t * src, size_t stride, size_t width, size_t height, 
-                                         size_t cellX, size_t cellY, size_t quantization, float * histograms)
+SIMD_API void SimdConditionalSquareGradientSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+                                       const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::HA + 2)
-        Avx512bw::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
+    if (Avx512bw::Enable)
+        Avx512bw::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width >= Avx2::A + 2)
-        Avx2::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A + 2)
-        Sse41::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
+        Avx2::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
     if(Sse2::Enable && width >= Sse2::A + 2)
-        Sse2::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
+        Sse2::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
     else
 #endif
-#ifdef SIMD_VSX_ENABLE
-    if(Vsx::Enable && width >= Vsx::A + 2)
-        Vsx::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::A + 2)
+        Vmx::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A + 2)
-        Neon::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
+        Neon::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
     else
 #endif
-        Base::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
+        Base::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
 }
 
-SIMD_API void SimdHogExtractFeatures(const uint8_t * src, size_t stride, size_t width, size_t height, float * features)
+SIMD_API void SimdConditionalFill(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t threshold, SimdCompareType compareType, uint8_t value, uint8_t * dst, size_t dstStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::HA + 2)
-        Avx512bw::HogExtractFeatures(src, stride, width, height, features);
+    if (Avx512bw::Enable)
+        Avx512bw::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::HA + 2)
-        Avx2::HogExtractFeatures(src, stride, width, height, features);
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
     else
 #endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A + 2)
-        Sse41::HogExtractFeatures(src, stride, width, height, features);
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::A)
+        Sse2::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if (Vmx::Enable && width >= Vmx::A)
+        Vmx::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A + 2)
-        Neon::HogExtractFeatures(src, stride, width, height, features);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
     else
 #endif
-        Base::HogExtractFeatures(src, stride, width, height, features);
+        Base::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
 }
 
-SIMD_API void SimdHogDeinterleave(const float * src, size_t srcStride, size_t width, size_t height, size_t count, float ** dst, size_t dstStride)
+SIMD_API void SimdCopy(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, uint8_t * dst, size_t dstStride)
+{
+    Base::Copy(src, srcStride, width, height, pixelSize, dst, dstStride);
+}
+
+SIMD_API void SimdCopyFrame(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize,
+                           size_t frameLeft, size_t frameTop, size_t frameRight, size_t frameBottom, uint8_t * dst, size_t dstStride)
+{
+    Base::CopyFrame(src, srcStride, width, height, pixelSize, frameLeft, frameTop, frameRight, frameBottom, dst, dstStride);
+}
+
+typedef void* (*SimdConvolutionInitPtr) (SimdBool trans, size_t batch, size_t srcC, size_t srcH, size_t srcW, size_t dstC,
+    size_t kernelY, size_t kernelX, size_t dilationY, size_t dilationX, size_t strideY, size_t strideX,
+    size_t padY, size_t padX, size_t padH, size_t padW, size_t group, SimdConvolutionActivationType activation, SimdGemm32fNNPtr gemm);
+
+SimdConvolutionInitPtr simdConvolutionInit = SIMD_FUNC6(ConvolutionInit, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE3_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void * SimdConvolutionInit(SimdBool trans, size_t batch, size_t srcC, size_t srcH, size_t srcW, size_t dstC,
+    size_t kernelY, size_t kernelX, size_t dilationY, size_t dilationX, size_t strideY, size_t strideX,
+    size_t padY, size_t padX, size_t padH, size_t padW, size_t group, SimdConvolutionActivationType activation, SimdGemm32fNNPtr gemm)
+{
+    return simdConvolutionInit(trans, batch, srcC, srcH, srcW, dstC, kernelY, kernelX, dilationY, dilationX, strideY, strideX, padY, padX, padH, padW, group, activation, gemm);
+}
+
+SIMD_API size_t SimdConvolutionExternalBufferSize(const void * convolution)
+{
+    return ((Convolution*)convolution)->ExternalBufferSize();
+}
+
+SIMD_API size_t SimdConvolutionInternalBufferSize(const void * convolution)
+{
+    return ((Convolution*)convolution)->InternalBufferSize();
+}
+
+SIMD_API void SimdConvolutionSetParams(void * convolution, const float * weight, SimdBool trans, SimdBool * internal, const float * bias, const float * params)
+{
+    ((Convolution*)convolution)->SetParams(weight, trans, internal, bias, params);
+}
+
+SIMD_API void SimdConvolutionForward(void * convolution, const float * src, float * buf, float * dst)
+{
+    ((Convolution*)convolution)->Forward(src, buf, dst);
+}
+
+SIMD_API size_t SimdConvolutionScratchPeak()
+{
+    return Base::ConvolutionScratchPeak();
+}
+
+SIMD_API void SimdConvolutionScratchRelease()
+{
+    Base::ConvolutionScratchRelease();
+}
+
+SIMD_API void SimdDeinterleaveUv(const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+                    uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::F && count >= Sse::F)
-        Avx512bw::HogDeinterleave(src, srcStride, width, height, count, dst, dstStride);
+    if (Avx512bw::Enable)
+        Avx512bw::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F && count >= Sse::F)
-        Avx2::HogDeinterleave(src, srcStride, width, height, count, dst, dstStride);
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
     else
 #endif
-#ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width >= Sse::F && count >= Sse::F)
-        Sse::HogDeinterleave(src, srcStride, width, height, count, dst, dstStride);
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::A)
+        Vmx::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F && count >= Neon::F)
-        Neon::HogDeinterleave(src, srcStride, width, height, count, dst, dstStride);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
     else
 #endif
-        Base::HogDeinterleave(src, srcStride, width, height, count, dst, dstStride);
+        Base::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
 }
 
-SIMD_API void SimdHogFilterSeparable(const float * src, size_t srcStride, size_t width, size_t height,
-    const float * rowFilter, size_t rowSize, const float * colFilter, size_t colSize, float * dst, size_t dstStride, int add)
+SIMD_API void SimdDeinterleaveBgr(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height,
+    uint8_t * b, size_t bStride, uint8_t * g, size_t gStride, uint8_t * r, size_t rStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::F + colSize - 1)
-        Avx512bw::HogFilterSeparable(src, srcStride, width, height, rowFilter, rowSize, colFilter, colSize, dst, dstStride, add);
+    if (Avx512bw::Enable)
+        Avx512bw::DeinterleaveBgr(bgr, bgrStride, width, height, b, bStride, g, gStride, r, rStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F + colSize - 1)
-        Avx2::HogFilterSeparable(src, srcStride, width, height, rowFilter, rowSize, colFilter, colSize, dst, dstStride, add);
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::DeinterleaveBgr(bgr, bgrStride, width, height, b, bStride, g, gStride, r, rStride);
     else
 #endif
-#ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width >= Sse::F + colSize - 1)
-        Sse::HogFilterSeparable(src, srcStride, width, height, rowFilter, rowSize, colFilter, colSize, dst, dstStride, add);
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::A)
+        Ssse3::DeinterleaveBgr(bgr, bgrStride, width, height, b, bStride, g, gStride, r, rStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F + colSize - 1)
-        Neon::HogFilterSeparable(src, srcStride, width, height, rowFilter, rowSize, colFilter, colSize, dst, dstStride, add);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::DeinterleaveBgr(bgr, bgrStride, width, height, b, bStride, g, gStride, r, rStride);
     else
 #endif
-        Base::HogFilterSeparable(src, srcStride, width, height, rowFilter, rowSize, colFilter, colSize, dst, dstStride, add);
+        Base::DeinterleaveBgr(bgr, bgrStride, width, height, b, bStride, g, gStride, r, rStride);
 }
 
-SIMD_API void SimdHogLiteExtractFeatures(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t cell, float * features, size_t featuresStride)
+SIMD_API void SimdDeinterleaveBgra(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height,
+    uint8_t * b, size_t bStride, uint8_t * g, size_t gStride, uint8_t * r, size_t rStride, uint8_t * a, size_t aStride)
 {
-#if defined(SIMD_AVX2_ENABLE) || defined(SIMD_SSE41_ENABLE) || defined(SIMD_NEON_ENABLE)
-    size_t size = (width / cell - 1)*cell;
-#endif
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::HogLiteExtractFeatures(src, srcStride, width, height, cell, features, featuresStride);
+        Avx512bw::DeinterleaveBgra(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && size >= Avx2::A)
-        Avx2::HogLiteExtractFeatures(src, srcStride, width, height, cell, features, featuresStride);
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::DeinterleaveBgra(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
     else
 #endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && size >= Sse41::A)
-        Sse41::HogLiteExtractFeatures(src, srcStride, width, height, cell, features, featuresStride);
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::A)
+        Ssse3::DeinterleaveBgra(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && size >= Neon::A)
-        Neon::HogLiteExtractFeatures(src, srcStride, width, height, cell, features, featuresStride);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::DeinterleaveBgra(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
     else
 #endif
-        Base::HogLiteExtractFeatures(src, srcStride, width, height, cell, features, featuresStride);
+        Base::DeinterleaveBgra(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
 }
 
-SIMD_API void SimdHogLiteFilterFeatures(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t featureSize, const float * filter, size_t filterWidth, size_t filterHeight, const uint32_t * mask, size_t maskStride, float * dst, size_t dstStride)
+SIMD_API void * SimdDetectionLoadA(const char * path)
+{
+    return Base::DetectionLoadA(path);
+}
+
+SIMD_API void * SimdDetectionLoadBinary(const void * buffer, size_t size)
+{
+    return Base::DetectionLoadBinary(buffer, size);
+}
+
+SIMD_API size_t SimdDetectionSaveBinary(const void * data, void * buffer, size_t size)
+{
+    return Base::DetectionSaveBinary(data, buffer, size);
+}
+
+SIMD_API void SimdDetectionInfo(const void * data, size_t * width, size_t * height, SimdDetectionInfoFlags * flags)
+{
+    Base::DetectionInfo(data, width, height, flags);
+}
+
+SIMD_API void * SimdDetectionInit(const void * data, uint8_t * sum, size_t sumStride, size_t width, size_t height,
+    uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride, int throughColumn, int int16)
+{
+    return Base::DetectionInit(data, sum, sumStride, width, height, sqsum, sqsumStride, tilted, tiltedStride, throughColumn, int16);
+}
+
+SIMD_API void SimdDetectionPrepare(void * hid)
+{
+    Base::DetectionPrepare(hid);
+}
+
+SIMD_API void SimdDetectionHaarDetect32fp(const void * hid, const uint8_t * mask, size_t maskStride, 
+    ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
+    size_t width = right - left;
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::HogLiteFilterFeatures(src, srcStride, srcWidth, srcHeight, featureSize, filter, filterWidth, filterHeight, mask, maskStride, dst, dstStride);
+        Avx512bw::DetectionHaarDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable)
-        Avx2::HogLiteFilterFeatures(src, srcStride, srcWidth, srcHeight, featureSize, filter, filterWidth, filterHeight, mask, maskStride, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable)
-        Avx::HogLiteFilterFeatures(src, srcStride, srcWidth, srcHeight, featureSize, filter, filterWidth, filterHeight, mask, maskStride, dst, dstStride);
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::DetectionHaarDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
     else
 #endif
 #ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable)
-        Sse41::HogLiteFilterFeatures(src, srcStride, srcWidth, srcHeight, featureSize, filter, filterWidth, filterHeight, mask, maskStride, dst, dstStride);
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::DetectionHaarDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable)
-        Neon::HogLiteFilterFeatures(src, srcStride, srcWidth, srcHeight, featureSize, filter, filterWidth, filterHeight, mask, maskStride, dst, dstStride);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::DetectionHaarDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
     else
 #endif
-        Base::HogLiteFilterFeatures(src, srcStride, srcWidth, srcHeight, featureSize, filter, filterWidth, filterHeight, mask, maskStride, dst, dstStride);
+        Base::DetectionHaarDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
-SIMD_API void SimdHogLiteResizeFeatures(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t featureSize, float * dst, size_t dstStride, size_t dstWidth, size_t dstHeight)
+SIMD_API void SimdDetectionHaarDetect32fi(const void * hid, const uint8_t * mask, size_t maskStride,
+    ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
+    size_t width = right - left;
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::HogLiteResizeFeatures(src, srcStride, srcWidth, srcHeight, featureSize, dst, dstStride, dstWidth, dstHeight);
+        Avx512bw::DetectionHaarDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable)
-        Avx2::HogLiteResizeFeatures(src, srcStride, srcWidth, srcHeight, featureSize, dst, dstStride, dstWidth, dstHeight);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable)
-        Avx::HogLiteResizeFeatures(src, srcStride, srcWidth, srcHeight, featureSize, dst, dstStride, dstWidth, dstHeight);
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::DetectionHaarDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
     else
 #endif
 #ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable)
-        Sse41::HogLiteResizeFeatures(src, srcStride, srcWidth, srcHeight, featureSize, dst, dstStride, dstWidth, dstHeight);
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::DetectionHaarDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable)
-        Neon::HogLiteResizeFeatures(src, srcStride, srcWidth, srcHeight, featureSize, dst, dstStride, dstWidth, dstHeight);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::DetectionHaarDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
     else
 #endif
-        Base::HogLiteResizeFeatures(src, srcStride, srcWidth, srcHeight, featureSize, dst, dstStride, dstWidth, dstHeight);
+        Base::DetectionHaarDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
-SIMD_API void SimdHogLiteCompressFeatures(const float * src, size_t srcStride, size_t width, size_t height, const float * pca, float * dst, size_t dstStride)
+SIMD_API void SimdDetectionHaarDetect16ip(const void * hid, const uint8_t * mask, size_t maskStride,
+    ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
+    size_t width = right - left;
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::HogLiteCompressFeatures(src, srcStride, width, height, pca, dst, dstStride);
+        Avx512bw::DetectionHaarDetect16ip(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable)
-        Avx2::HogLiteCompressFeatures(src, srcStride, width, height, pca, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable)
-        Avx::HogLiteCompressFeatures(src, srcStride, width, height, pca, dst, dstStride);
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::DetectionHaarDetect16ip(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
     else
 #endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable)
-        Sse41::HogLiteCompressFeatures(src, srcStride, width, height, pca, dst, dstStride);
+        Base::DetectionHaarDetect16ip(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+}
+
+SIMD_API void SimdDetectionHaarDetect16ii(const void * hid, const uint8_t * mask, size_t maskStride,
+    ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
+{
+    size_t width = right - left;
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::DetectionHaarDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
     else
 #endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable)
-        Neon::HogLiteCompressFeatures(src, srcStride, width, height, pca, dst, dstStride);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::DetectionHaarDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
     else
 #endif
-        Base::HogLiteCompressFeatures(src, srcStride, width, height, pca, dst, dstStride);
+        Base::DetectionHaarDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
-SIMD_API void SimdHogLiteFilterSeparable(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t featureSize, const float * hFilter, size_t hSize, const float * vFilter, size_t vSize, float * dst, size_t dstStride, int add)
+SIMD_API void SimdDetectionLbpDetect32fp(const void * hid, const uint8_t * mask, size_t maskStride,
+    ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
+    size_t width = right - left;
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::HogLiteFilterSeparable(src, srcStride, srcWidth, srcHeight, featureSize, hFilter, hSize, vFilter, vSize, dst, dstStride, add);
+        Avx512bw::DetectionLbpDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && srcWidth >= hSize - 1 + Avx2::F)
-        Avx2::HogLiteFilterSeparable(src, srcStride, srcWidth, srcHeight, featureSize, hFilter, hSize, vFilter, vSize, dst, dstStride, add);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && srcWidth >= hSize - 1 + Avx::F)
-        Avx::HogLiteFilterSeparable(src, srcStride, srcWidth, srcHeight, featureSize, hFilter, hSize, vFilter, vSize, dst, dstStride, add);
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::DetectionLbpDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
     else
 #endif
 #ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && srcWidth >= hSize - 1 + Sse41::F)
-        Sse41::HogLiteFilterSeparable(src, srcStride, srcWidth, srcHeight, featureSize, hFilter, hSize, vFilter, vSize, dst, dstStride, add);
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::DetectionLbpDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && srcWidth >= hSize - 1 + Neon::F)
-        Neon::HogLiteFilterSeparable(src, srcStride, srcWidth, srcHeight, featureSize, hFilter, hSize, vFilter, vSize, dst, dstStride, add);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::DetectionLbpDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
     else
 #endif
-        Base::HogLiteFilterSeparable(src, srcStride, srcWidth, srcHeight, featureSize, hFilter, hSize, vFilter, vSize, dst, dstStride, add);
-}
-
-typedef void(*SimdHogLiteFindMax7x7Ptr) (const float * a, size_t aStride, const float * b, size_t bStride, size_t height, float * value, size_t * col, size_t * row);
-SimdHogLiteFindMax7x7Ptr simdHogLiteFindMax7x7 = SIMD_FUNC3(HogLiteFindMax7x7, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdHogLiteFindMax7x7(const float * a, size_t aStride, const float * b, size_t bStride, size_t height, float * value, size_t * col, size_t * row)
-{
-    simdHogLiteFindMax7x7(a, aStride, b, bStride, height, value, col, row);
-}
-
-typedef void(*SimdHogLiteCreateMaskPtr) (const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const float * threshold, size_t scale, size_t size, uint32_t * dst, size_t dstStride);
-SimdHogLiteCreateMaskPtr simdHogLiteCreateMask = SIMD_FUNC4(HogLiteCreateMask, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdHogLiteCreateMask(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const float * threshold, size_t scale, size_t size, uint32_t * dst, size_t dstStride)
-{
-    simdHogLiteCreateMask(src, srcStride, srcWidth, srcHeight, threshold, scale, size, dst, dstStride);
+        Base::DetectionLbpDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
-SIMD_API void SimdInt16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdDetectionLbpDetect32fi(const void * hid, const uint8_t * mask, size_t maskStride,
+    ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
+    size_t width = right - left;
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::Int16ToGray(src, width, height, srcStride, dst, dstStride);
+        Avx512bw::DetectionLbpDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
     if (Avx2::Enable && width >= Avx2::A)
-        Avx2::Int16ToGray(src, width, height, srcStride, dst, dstStride);
+        Avx2::DetectionLbpDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
     else
 #endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A)
-        Sse2::Int16ToGray(src, width, height, srcStride, dst, dstStride);
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::DetectionLbpDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::HA)
-        Neon::Int16ToGray(src, width, height, srcStride, dst, dstStride);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::DetectionLbpDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
     else
 #endif
-        Base::Int16ToGray(src, width, height, srcStride, dst, dstStride);
+        Base::DetectionLbpDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
-SIMD_API void SimdIntegral(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-                      uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride,
-                      SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat)
+SIMD_API void SimdDetectionLbpDetect16ip(const void * hid, const uint8_t * mask, size_t maskStride,
+    ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
+    size_t width = right - left;
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
+        Avx512bw::DetectionLbpDetect16ip(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable)
-        Avx2::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::DetectionLbpDetect16ip(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
     else
 #endif
-        Base::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::DetectionLbpDetect16ip(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::DetectionLbpDetect16ip(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+    else
+#endif
+        Base::DetectionLbpDetect16ip(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
-SIMD_API void SimdInterferenceIncrement(uint8_t * statistic, size_t stride, size_t width, size_t height, uint8_t increment, int16_t saturation)
+SIMD_API void SimdDetectionLbpDetect16ii(const void * hid, const uint8_t * mask, size_t maskStride,
+    ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
+    size_t width = right - left;
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
+        Avx512bw::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::HA)
-        Avx2::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::HA)
-        Sse2::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
     else
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::HA)
-        Vmx::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::HA)
-        Neon::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
     else
 #endif
-        Base::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
+        Base::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
-SIMD_API void SimdInterferenceIncrementMasked(uint8_t * statistic, size_t statisticStride, size_t width, size_t height, 
-                                              uint8_t increment, int16_t saturation, const uint8_t * mask, size_t maskStride, uint8_t index)
+SIMD_API void SimdEdgeBackgroundGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+                                 uint8_t * background, size_t backgroundStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
+        Avx512bw::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width >= Avx2::A)
-        Avx2::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
+        Avx2::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
     if(Sse2::Enable && width >= Sse2::A)
-        Sse2::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
+        Sse2::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
     else
 #endif
 #ifdef SIMD_VMX_ENABLE
     if(Vmx::Enable && width >= Vmx::A)
-        Vmx::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
+        Vmx::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
+        Neon::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
     else
 #endif
-        Base::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
+        Base::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
 }
 
-SIMD_API void SimdInterferenceDecrement(uint8_t * statistic, size_t stride, size_t width, size_t height, uint8_t decrement, int16_t saturation)
+SIMD_API void SimdEdgeBackgroundGrowRangeFast(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+                                 uint8_t * background, size_t backgroundStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
+        Avx512bw::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::HA)
-        Avx2::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::HA)
-        Sse2::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
     else
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::HA)
-        Vmx::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
+    if(Vmx::Enable && width >= Vmx::A)
+        Vmx::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::HA)
-        Neon::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
     else
 #endif
-        Base::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
+        Base::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
 }
 
-SIMD_API void SimdInterferenceDecrementMasked(uint8_t * statistic, size_t statisticStride, size_t width, size_t height, 
-                                              uint8_t decrement, int16_t saturation, const uint8_t * mask, size_t maskStride, uint8_t index)
+SIMD_API void SimdEdgeBackgroundIncrementCount(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+                                  const uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t * backgroundCount, size_t backgroundCountStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
+        Avx512bw::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width >= Avx2::A)
-        Avx2::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
+        Avx2::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
     if(Sse2::Enable && width >= Sse2::A)
-        Sse2::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
+        Sse2::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
     else
 #endif
 #ifdef SIMD_VMX_ENABLE
     if(Vmx::Enable && width >= Vmx::A)
-        Vmx::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
+        Vmx::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
+        Neon::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
     else
 #endif
-        Base::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
+        Base::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
 }
 
-SIMD_API void SimdInterleaveUv(const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * uv, size_t uvStride)
+SIMD_API void SimdEdgeBackgroundAdjustRange(uint8_t * backgroundCount, size_t backgroundCountStride, size_t width, size_t height,
+                               uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t threshold)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
+        Avx512bw::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A)
-        Sse2::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
     else
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if (Vmx::Enable && width >= Vmx::A)
-        Vmx::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
+    if(Vmx::Enable && width >= Vmx::A)
+        Vmx::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
+        Neon::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
     else
 #endif
-        Base::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
+        Base::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
 }
 
-SIMD_API void SimdInterleaveBgr(const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride,
-    size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+SIMD_API void SimdEdgeBackgroundAdjustRangeMasked(uint8_t * backgroundCount, size_t backgroundCountStride, size_t width, size_t height,
+                               uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t threshold, const uint8_t * mask, size_t maskStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::InterleaveBgr(b, bStride, g, gStride, r, rStride, width, height, bgr, bgrStride);
+        Avx512bw::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::InterleaveBgr(b, bStride, g, gStride, r, rStride, width, height, bgr, bgrStride);
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
     else
 #endif
-#ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::InterleaveBgr(b, bStride, g, gStride, r, rStride, width, height, bgr, bgrStride);
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::A)
+        Vmx::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::InterleaveBgr(b, bStride, g, gStride, r, rStride, width, height, bgr, bgrStride);
+        Neon::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
     else
 #endif
-        Base::InterleaveBgr(b, bStride, g, gStride, r, rStride, width, height, bgr, bgrStride);
+        Base::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
 }
 
-SIMD_API void SimdInterleaveBgra(const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride, const uint8_t * a, size_t aStride,
-    size_t width, size_t height, uint8_t * bgra, size_t bgraStride)
+SIMD_API void SimdEdgeBackgroundShiftRange(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+                              uint8_t * background, size_t backgroundStride)
+{
+    Base::EdgeBackgroundShiftRange(value, valueStride, width, height, background, backgroundStride);
+}
+
+SIMD_API void SimdEdgeBackgroundShiftRangeMasked(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+                              uint8_t * background, size_t backgroundStride, const uint8_t * mask, size_t maskStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::InterleaveBgra(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
+        Avx512bw::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::InterleaveBgra(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
     else
 #endif
-#ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::InterleaveBgra(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::A)
+        Vmx::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::InterleaveBgra(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
+        Neon::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
     else
 #endif
-        Base::InterleaveBgra(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
+        Base::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
 }
 
-SIMD_API void SimdLaplace(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdEdgeBackgroundPackedInit(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::A)
-        Avx512bw::Laplace(src, srcStride, width, height, dst, dstStride);
+    if (Avx512bw::Enable)
+        Avx512bw::EdgeBackgroundPackedInit(value, valueStride, width, height, model, modelStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::Laplace(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width > Ssse3::A)
-        Ssse3::Laplace(src, srcStride, width, height, dst, dstStride);
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::EdgeBackgroundPackedInit(value, valueStride, width, height, model, modelStride);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width > Sse2::A)
-        Sse2::Laplace(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::Laplace(src, srcStride, width, height, dst, dstStride);
+    if (Sse2::Enable && width >= Sse2::A)
+        Sse2::EdgeBackgroundPackedInit(value, valueStride, width, height, model, modelStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::A)
-        Neon::Laplace(src, srcStride, width, height, dst, dstStride);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::EdgeBackgroundPackedInit(value, valueStride, width, height, model, modelStride);
     else
 #endif
-        Base::Laplace(src, srcStride, width, height, dst, dstStride);
+        Base::EdgeBackgroundPackedInit(value, valueStride, width, height, model, modelStride);
 }
 
-SIMD_API void SimdLaplaceAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdEdgeBackgroundPackedUpdate(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+    uint8_t * model, size_t modelStride, uint8_t threshold, int flags)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::A)
-        Avx512bw::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
+    if (Avx512bw::Enable)
+        Avx512bw::EdgeBackgroundPackedUpdate(value, valueStride, width, height, model, modelStride, threshold, flags);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width > Ssse3::A)
-        Ssse3::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::EdgeBackgroundPackedUpdate(value, valueStride, width, height, model, modelStride, threshold, flags);
     else
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::A)
+        Sse2::EdgeBackgroundPackedUpdate(value, valueStride, width, height, model, modelStride, threshold, flags);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::A)
-        Neon::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::EdgeBackgroundPackedUpdate(value, valueStride, width, height, model, modelStride, threshold, flags);
     else
 #endif
-        Base::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
+        Base::EdgeBackgroundPackedUpdate(value, valueStride, width, height, model, modelStride, threshold, flags);
 }
 
-SIMD_API void SimdLaplaceAbsSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
+SIMD_API void SimdEdgeBackgroundPackedGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::A)
-        Avx512bw::LaplaceAbsSum(src, stride, width, height, sum);
+    if (Avx512bw::Enable)
+        Avx512bw::EdgeBackgroundPackedGrowRangeSlow(value, valueStride, width, height, model, modelStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::LaplaceAbsSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width > Ssse3::A)
-        Ssse3::LaplaceAbsSum(src, stride, width, height, sum);
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::EdgeBackgroundPackedGrowRangeSlow(value, valueStride, width, height, model, modelStride);
     else
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::LaplaceAbsSum(src, stride, width, height, sum);
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::A)
+        Sse2::EdgeBackgroundPackedGrowRangeSlow(value, valueStride, width, height, model, modelStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::A)
-        Neon::LaplaceAbsSum(src, stride, width, height, sum);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::EdgeBackgroundPackedGrowRangeSlow(value, valueStride, width, height, model, modelStride);
     else
 #endif
-        Base::LaplaceAbsSum(src, stride, width, height, sum);
+        Base::EdgeBackgroundPackedGrowRangeSlow(value, valueStride, width, height, model, modelStride);
 }
 
-SIMD_API void SimdLbpEstimate(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdEdgeBackgroundPackedAdjustRangeMasked(uint8_t * model, size_t modelStride, size_t width, size_t height,
+    uint8_t threshold, const uint8_t * mask, size_t maskStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::A + 2)
-        Avx512bw::LbpEstimate(src, srcStride, width, height, dst, dstStride);
+    if (Avx512bw::Enable)
+        Avx512bw::EdgeBackgroundPackedAdjustRangeMasked(model, modelStride, width, height, threshold, mask, maskStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A + 2)
-        Avx2::LbpEstimate(src, srcStride, width, height, dst, dstStride);
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::EdgeBackgroundPackedAdjustRangeMasked(model, modelStride, width, height, threshold, mask, maskStride);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A + 2)
-        Sse2::LbpEstimate(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A + 2)
-        Vmx::LbpEstimate(src, srcStride, width, height, dst, dstStride);
+    if (Sse2::Enable && width >= Sse2::A)
+        Sse2::EdgeBackgroundPackedAdjustRangeMasked(model, modelStride, width, height, threshold, mask, maskStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A + 2)
-        Neon::LbpEstimate(src, srcStride, width, height, dst, dstStride);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::EdgeBackgroundPackedAdjustRangeMasked(model, modelStride, width, height, threshold, mask, maskStride);
     else
 #endif
-        Base::LbpEstimate(src, srcStride, width, height, dst, dstStride);
+        Base::EdgeBackgroundPackedAdjustRangeMasked(model, modelStride, width, height, threshold, mask, maskStride);
 }
 
-SIMD_API void SimdMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdEdgeBackgroundPackedShiftRange(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
-        Avx512bw::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    if (Avx512bw::Enable)
+        Avx512bw::EdgeBackgroundPackedShiftRange(value, valueStride, width, height, model, modelStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && (width - 1)*channelCount >= Avx2::A)
-        Avx2::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && (width - 1)*channelCount >= Ssse3::A)
-        Ssse3::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::EdgeBackgroundPackedShiftRange(value, valueStride, width, height, model, modelStride);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && (width - 1)*channelCount >= Sse2::A)
-        Sse2::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if (Vmx::Enable && (width - 1)*channelCount >= Vmx::A)
-        Vmx::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    if (Sse2::Enable && width >= Sse2::A)
+        Sse2::EdgeBackgroundPackedShiftRange(value, valueStride, width, height, model, modelStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && (width - 1)*channelCount >= Neon::A)
-        Neon::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::EdgeBackgroundPackedShiftRange(value, valueStride, width, height, model, modelStride);
     else
 #endif
-        Base::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+        Base::EdgeBackgroundPackedShiftRange(value, valueStride, width, height, model, modelStride);
 }
 
-SIMD_API void SimdMedianFilterRhomb3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdEdgeBackgroundPackedShiftRangeMasked(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+    uint8_t * model, size_t modelStride, const uint8_t * mask, size_t maskStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
-        Avx512bw::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    if (Avx512bw::Enable)
+        Avx512bw::EdgeBackgroundPackedShiftRangeMasked(value, valueStride, width, height, model, modelStride, mask, maskStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && (width - 1)*channelCount >= Avx2::A)
-        Avx2::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::EdgeBackgroundPackedShiftRangeMasked(value, valueStride, width, height, model, modelStride, mask, maskStride);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && (width - 1)*channelCount >= Sse2::A)
-        Sse2::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && (width - 1)*channelCount >= Vmx::A)
-        Vmx::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    if (Sse2::Enable && width >= Sse2::A)
+        Sse2::EdgeBackgroundPackedShiftRangeMasked(value, valueStride, width, height, model, modelStride, mask, maskStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && (width - 1)*channelCount >= Neon::A)
-        Neon::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::EdgeBackgroundPackedShiftRangeMasked(value, valueStride, width, height, model, modelStride, mask, maskStride);
     else
 #endif
-        Base::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+        Base::EdgeBackgroundPackedShiftRangeMasked(value, valueStride, width, height, model, modelStride, mask, maskStride);
 }
 
-SIMD_API void SimdMedianFilterRhomb5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdFill(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize, uint8_t value)
+{
+    Base::Fill(dst, stride, width, height, pixelSize, value);
+}
+
+SIMD_API void SimdFillFrame(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize,
+                           size_t frameLeft, size_t frameTop, size_t frameRight, size_t frameBottom, uint8_t value)
+{
+    Base::FillFrame(dst, stride, width, height, pixelSize, frameLeft, frameTop, frameRight, frameBottom, value);
+}
+
+SIMD_API void SimdFillBgr(uint8_t * dst, size_t stride, size_t width, size_t height, uint8_t blue, uint8_t green, uint8_t red)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && (width - 2)*channelCount >= Avx512bw::A)
-        Avx512bw::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
+    if (Avx512bw::Enable)
+        Avx512bw::FillBgr(dst, stride, width, height, blue, green, red);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && (width - 2)*channelCount >= Avx2::A)
-        Avx2::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::FillBgr(dst, stride, width, height, blue, green, red);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && (width - 2)*channelCount >= Sse2::A)
-        Sse2::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::FillBgr(dst, stride, width, height, blue, green, red);
     else
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && (width - 2)*channelCount >= Vmx::A)
-        Vmx::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
+    if(Vmx::Enable && width >= Vmx::A)
+        Vmx::FillBgr(dst, stride, width, height, blue, green, red);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && (width - 2)*channelCount >= Neon::A)
-        Neon::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::FillBgr(dst, stride, width, height, blue, green, red);
     else
 #endif
-        Base::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
+        Base::FillBgr(dst, stride, width, height, blue, green, red);
 }
 
-SIMD_API void SimdMedianFilterSquare3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdFillBgra(uint8_t * dst, size_t stride, size_t width, size_t height, uint8_t blue, uint8_t green, uint8_t red, uint8_t alpha)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
-        Avx512bw::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    if (Avx512bw::Enable)
+        Avx512bw::FillBgra(dst, stride, width, height, blue, green, red, alpha);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && (width - 1)*channelCount >= Avx2::A)
-        Avx2::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    if(Avx2::Enable && width >= Avx2::F)
+        Avx2::FillBgra(dst, stride, width, height, blue, green, red, alpha);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && (width - 1)*channelCount >= Sse2::A)
-        Sse2::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    if(Sse2::Enable && width >= Sse2::F)
+        Sse2::FillBgra(dst, stride, width, height, blue, green, red, alpha);
     else
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && (width - 1)*channelCount >= Vmx::A)
-        Vmx::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    if(Vmx::Enable && width >= Vmx::F)
+        Vmx::FillBgra(dst, stride, width, height, blue, green, red, alpha);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && (width - 1)*channelCount >= Neon::A)
-        Neon::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    if (Neon::Enable && width >= Neon::F)
+        Neon::FillBgra(dst, stride, width, height, blue, green, red, alpha);
     else
 #endif
-        Base::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+        Base::FillBgra(dst, stride, width, height, blue, green, red, alpha);
 }
 
-SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdFillPixel(uint8_t * dst, size_t stride, size_t width, size_t height, const uint8_t * pixel, size_t pixelSize)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && (width - 2)*channelCount >= Avx512bw::A)
-        Avx512bw::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
+    if (Avx512bw::Enable)
+        Avx512bw::FillPixel(dst, stride, width, height, pixel, pixelSize);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && (width - 2)*channelCount >= Avx2::A)
-        Avx2::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::FillPixel(dst, stride, width, height, pixel, pixelSize);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && (width - 2)*channelCount >= Sse2::A)
-        Sse2::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && (width - 2)*channelCount >= Vmx::A)
-        Vmx::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
+    if (Sse2::Enable && width >= Sse2::A)
+        Sse2::FillPixel(dst, stride, width, height, pixel, pixelSize);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && (width - 2)*channelCount >= Neon::A)
-        Neon::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::FillPixel(dst, stride, width, height, pixel, pixelSize);
     else
 #endif
-        Base::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
+        Base::FillPixel(dst, stride, width, height, pixel, pixelSize);
 }
 
-SIMD_API void SimdNeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion)
+typedef void(*SimdFill32fPtr) (float * dst, size_t size, const float * value);
+SimdFill32fPtr simdFill32f = SIMD_FUNC4(Fill32f, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdFill32f(float * dst, size_t size, const float * value)
+{
+    simdFill32f(dst, size, value);
+}
+
+SIMD_API void SimdFloat32ToFloat16(const float * src, size_t size, uint16_t * dst)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512f::F)
-        Avx512bw::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
+    if (Avx512bw::Enable)
+        Avx512bw::Float32ToFloat16(src, size, dst);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx::F)
-        Avx2::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
+    if (Avx2::Enable && size >= Avx2::F)
+        Avx2::Float32ToFloat16(src, size, dst);
     else
 #endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A)
-        Sse2::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
+#if defined(SIMD_NEON_ENABLE) && defined(SIMD_NEON_FP16_ENABLE)
+    if (Neon::Enable && size >= Neon::F)
+        Neon::Float32ToFloat16(src, size, dst);
     else
 #endif
-#ifdef SIMD_VSX_ENABLE
-    if (Vsx::Enable && width >= Vsx::A)
-        Vsx::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
+        Base::Float32ToFloat16(src, size, dst);
+}
+
+SIMD_API void SimdFloat16ToFloat32(const uint16_t * src, size_t size, float * dst)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Float16ToFloat32(src, size, dst);
     else
 #endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && size >= Avx2::F)
+        Avx2::Float16ToFloat32(src, size, dst);
     else
 #endif
-        Base::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
-}
-
-typedef void(*SimdNeuralProductSumPtr) (const float * a, const float * b, size_t size, float * sum);
-SimdNeuralProductSumPtr simdNeuralProductSum = SIMD_FUNC6(NeuralProductSum, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_VSX_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdNeuralProductSum(const float * a, const float * b, size_t size, float * sum)
-{
-    simdNeuralProductSum(a, b, size, sum);
+#if defined(SIMD_NEON_ENABLE) && defined(SIMD_NEON_FP16_ENABLE)
+    if (Neon::Enable && size >= Neon::F)
+        Neon::Float16ToFloat32(src, size, dst);
+    else
+#endif
+        Base::Float16ToFloat32(src, size, dst);
 }
 
-typedef void(*SimdNeuralAddVectorMultipliedByValuePtr) (const float * src, size_t size, const float * value, float * dst);
-SimdNeuralAddVectorMultipliedByValuePtr simdNeuralAddVectorMultipliedByValue = SIMD_FUNC5(NeuralAddVectorMultipliedByValue, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdNeuralAddVectorMultipliedByValue(const float * src, size_t size, const float * value, float * dst)
+SIMD_API void SimdSquaredDifferenceSum16f(const uint16_t * a, const uint16_t * b, size_t size, float * sum)
 {
-    simdNeuralAddVectorMultipliedByValue(src, size, value, dst);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::SquaredDifferenceSum16f(a, b, size, sum);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && size >= Avx2::F)
+        Avx2::SquaredDifferenceSum16f(a, b, size, sum);
+    else
+#endif
+#if defined(SIMD_NEON_ENABLE) && defined(SIMD_NEON_FP16_ENABLE)
+    if (Neon::Enable && size >= Neon::F)
+        Neon::SquaredDifferenceSum16f(a, b, size, sum);
+    else
+#endif
+        Base::SquaredDifferenceSum16f(a, b, size, sum);
 }
 
-typedef void(*SimdNeuralAddVectorPtr) (const float * src, size_t size, float * dst);
-SimdNeuralAddVectorPtr simdNeuralAddVector = SIMD_FUNC4(NeuralAddVector, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdNeuralAddVector(const float * src, size_t size, float * dst)
+SIMD_API void SimdCosineDistance16f(const uint16_t * a, const uint16_t * b, size_t size, float * distance)
 {
-    simdNeuralAddVector(src, size, dst);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::CosineDistance16f(a, b, size, distance);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && size >= Avx2::F)
+        Avx2::CosineDistance16f(a, b, size, distance);
+    else
+#endif
+#if defined(SIMD_NEON_ENABLE) && defined(SIMD_NEON_FP16_ENABLE)
+    if (Neon::Enable && size >= Neon::F)
+        Neon::CosineDistance16f(a, b, size, distance);
+    else
+#endif
+        Base::CosineDistance16f(a, b, size, distance);
 }
 
-typedef void(*SimdNeuralAddValuePtr) (const float * value, float * dst, size_t size);
-SimdNeuralAddValuePtr simdNeuralAddValue = SIMD_FUNC4(NeuralAddValue, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdNeuralAddValue(const float * value, float * dst, size_t size)
+SIMD_API void SimdCosineDistancesMxNa16f(size_t M, size_t N, size_t K, const uint16_t * const * A, const uint16_t * const * B, float * distances)
 {
-    simdNeuralAddValue(value, dst, size);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && K >= Avx512bw::F)
+        Avx512bw::CosineDistancesMxNa16f(M, N, K, A, B, distances);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && K >= Avx2::F)
+        Avx2::CosineDistancesMxNa16f(M, N, K, A, B, distances);
+    else
+#endif
+#if defined(SIMD_NEON_ENABLE) && defined(SIMD_NEON_FP16_ENABLE)
+    if (Neon::Enable && K >= Neon::F)
+        Neon::CosineDistancesMxNa16f(M, N, K, A, B, distances);
+    else
+#endif
+        Base::CosineDistancesMxNa16f(M, N, K, A, B, distances);
 }
 
-typedef void(*SimdNeuralSigmoidPtr) (const float * src, size_t size, const float * slope, float * dst);
-SimdNeuralSigmoidPtr simdNeuralSigmoid = SIMD_FUNC4(NeuralSigmoid, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdNeuralSigmoid(const float * src, size_t size, const float * slope, float * dst)
+SIMD_API void SimdFloat32ToUint8(const float * src, size_t size, const float * lower, const float * upper, uint8_t * dst)
 {
-    simdNeuralSigmoid(src, size, slope, dst);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Float32ToUint8(src, size, lower, upper, dst);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && size >= Avx2::A)
+        Avx2::Float32ToUint8(src, size, lower, upper, dst);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && size >= Sse2::A)
+        Sse2::Float32ToUint8(src, size, lower, upper, dst);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && size >= Neon::A)
+        Neon::Float32ToUint8(src, size, lower, upper, dst);
+    else
+#endif
+        Base::Float32ToUint8(src, size, lower, upper, dst);
 }
 
-typedef void(*SimdNeuralRoughSigmoidPtr) (const float * src, size_t size, const float * slope, float * dst);
-SimdNeuralRoughSigmoidPtr simdNeuralRoughSigmoid = SIMD_FUNC5(NeuralRoughSigmoid, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_VSX_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdNeuralRoughSigmoid(const float * src, size_t size, const float * slope, float * dst)
+SIMD_API void SimdUint8ToFloat32(const uint8_t * src, size_t size, const float * lower, const float * upper, float * dst)
 {
-    simdNeuralRoughSigmoid(src, size, slope, dst);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Uint8ToFloat32(src, size, lower, upper, dst);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && size >= Avx2::HA)
+        Avx2::Uint8ToFloat32(src, size, lower, upper, dst);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && size >= Sse2::A)
+        Sse2::Uint8ToFloat32(src, size, lower, upper, dst);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && size >= Neon::A)
+        Neon::Uint8ToFloat32(src, size, lower, upper, dst);
+    else
+#endif
+        Base::Uint8ToFloat32(src, size, lower, upper, dst);
 }
 
-typedef void(*SimdNeuralRoughSigmoid2Ptr) (const float * src, size_t size, const float * slope, float * dst);
-SimdNeuralRoughSigmoid2Ptr simdNeuralRoughSigmoid2 = SIMD_FUNC5(NeuralRoughSigmoid2, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+typedef void(*SimdCosineDistance32fPtr) (const float * a, const float * b, size_t size, float * distance);
+SimdCosineDistance32fPtr simdCosineDistance32f = SIMD_FUNC5(CosineDistance32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
-SIMD_API void SimdNeuralRoughSigmoid2(const float * src, size_t size, const float * slope, float * dst)
+SIMD_API void SimdCosineDistance32f(const float * a, const float * b, size_t size, float * distance)
 {
-    simdNeuralRoughSigmoid2(src, size, slope, dst);
+    simdCosineDistance32f(a, b, size, distance);
 }
 
-typedef void(*SimdNeuralDerivativeSigmoidPtr) (const float * src, size_t size, const float * slope, float * dst);
-SimdNeuralDerivativeSigmoidPtr simdNeuralDerivativeSigmoid = SIMD_FUNC4(NeuralDerivativeSigmoid, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdNeuralDerivativeSigmoid(const float * src, size_t size, const float * slope, float * dst)
+SIMD_API void SimdGaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+                     size_t channelCount, uint8_t * dst, size_t dstStride)
 {
-    simdNeuralDerivativeSigmoid(src, size, slope, dst);
-}
-
-typedef void(*SimdNeuralTanhPtr) (const float * src, size_t size, const float * slope, float * dst);
-SimdNeuralTanhPtr simdNeuralTanh = SIMD_FUNC4(NeuralTanh, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdNeuralTanh(const float * src, size_t size, const float * slope, float * dst)
-{
-    simdNeuralTanh(src, size, slope, dst);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
+        Avx512bw::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && (width - 1)*channelCount >= Avx2::A)
+        Avx2::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && (width - 1)*channelCount >= Ssse3::A)
+        Ssse3::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && (width - 1)*channelCount >= Sse2::A)
+        Sse2::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && (width - 1)*channelCount >= Vmx::A)
+        Vmx::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && (width - 1)*channelCount >= Neon::A)
+        Neon::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+        Base::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
-typedef void(*SimdNeuralRoughTanhPtr) (const float * src, size_t size, const float * slope, float * dst);
-SimdNeuralRoughTanhPtr simdNeuralRoughTanh = SIMD_FUNC4(NeuralRoughTanh, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+typedef void(*SimdGemm32fPtr) (size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
 
-SIMD_API void SimdNeuralRoughTanh(const float * src, size_t size, const float * slope, float * dst)
+SimdGemm32fPtr simdGemm32fNN = SIMD_FUNC5(Gemm32fNN, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdGemm32fNN(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc)
 {
-    simdNeuralRoughTanh(src, size, slope, dst);
+    simdGemm32fNN(M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
-typedef void(*SimdNeuralDerivativeTanhPtr) (const float * src, size_t size, const float * slope, float * dst);
-SimdNeuralDerivativeTanhPtr simdNeuralDerivativeTanh = SIMD_FUNC4(NeuralDerivativeTanh, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SimdGemm32fPtr simdGemm32fNT = SIMD_FUNC5(Gemm32fNT, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE3_FUNC, SIMD_NEON_FUNC);
 
-SIMD_API void SimdNeuralDerivativeTanh(const float * src, size_t size, const float * slope, float * dst)
+SIMD_API void SimdGemm32fNT(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc)
 {
-    simdNeuralDerivativeTanh(src, size, slope, dst);
+    simdGemm32fNT(M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
-typedef void(*SimdNeuralReluPtr) (const float * src, size_t size, const float * slope, float * dst);
-SimdNeuralReluPtr simdNeuralRelu = SIMD_FUNC4(NeuralRelu, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdNeuralRelu(const float * src, size_t size, const float * slope, float * dst)
+SIMD_API void SimdGrayToBgr(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgr, size_t bgrStride)
 {
-    simdNeuralRelu(src, size, slope, dst);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::A)
+        Ssse3::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::A)
+        Vmx::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
+    else
+#endif
+        Base::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
 }
 
-typedef void(*SimdNeuralDerivativeReluPtr) (const float * src, size_t size, const float * slope, float * dst);
-SimdNeuralDerivativeReluPtr simdNeuralDerivativeRelu = SIMD_FUNC4(NeuralDerivativeRelu, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SIMD_API void SimdGrayToBgra(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::A)
+        Vmx::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
+    else
+#endif
+        Base::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
+}
 
-SIMD_API void SimdNeuralDerivativeRelu(const float * src, size_t size, const float * slope, float * dst)
+SIMD_API void SimdAbsSecondDerivativeHistogram(const uint8_t *src, size_t width, size_t height, size_t stride, size_t step, size_t indent, uint32_t * histogram)
 {
-    simdNeuralDerivativeRelu(src, size, slope, dst);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::A + 2 * indent)
+        Avx512bw::AbsSecondDerivativeHistogram(src, width, height, stride, step, indent, histogram);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A + 2*indent)
+        Avx2::AbsSecondDerivativeHistogram(src, width, height, stride, step, indent, histogram);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A + 2*indent)
+        Sse2::AbsSecondDerivativeHistogram(src, width, height, stride, step, indent, histogram);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::A + 2*indent)
+        Vmx::AbsSecondDerivativeHistogram(src, width, height, stride, step, indent, histogram);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A + 2 * indent)
+        Neon::AbsSecondDerivativeHistogram(src, width, height, stride, step, indent, histogram);
+    else
+#endif
+        Base::AbsSecondDerivativeHistogram(src, width, height, stride, step, indent, histogram);
 }
 
-typedef void(*SimdNeuralPowPtr) (const float * src, size_t size, const float * exponent, float * dst);
-SimdNeuralPowPtr simdNeuralPow = SIMD_FUNC4(NeuralPow, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+SIMD_API void SimdHistogram(const uint8_t *src, size_t width, size_t height, size_t stride, uint32_t * histogram)
+{
+    Base::Histogram(src, width, height, stride, histogram);
+}
 
-SIMD_API void SimdNeuralPow(const float * src, size_t size, const float * exponent, float * dst)
+SIMD_API void SimdHistogramMasked(const uint8_t *src, size_t srcStride, size_t width, size_t height, 
+                                  const uint8_t * mask, size_t maskStride, uint8_t index, uint32_t * histogram)
 {
-    simdNeuralPow(src, size, exponent, dst);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::A)
+        Vmx::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
+    else
+#endif
+        Base::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
 }
 
-typedef void(*SimdNeuralUpdateWeightsPtr) (const float * x, size_t size, const float * a, const float * b, float * d, float * w);
-SimdNeuralUpdateWeightsPtr simdNeuralUpdateWeights = SIMD_FUNC4(NeuralUpdateWeights, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SIMD_API void SimdHistogramConditional(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+    const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint32_t * histogram)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::HistogramConditional(src, srcStride, width, height, mask, maskStride, value, compareType, histogram);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::HistogramConditional(src, srcStride, width, height, mask, maskStride, value, compareType, histogram);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::A)
+        Sse2::HistogramConditional(src, srcStride, width, height, mask, maskStride, value, compareType, histogram);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::HistogramConditional(src, srcStride, width, height, mask, maskStride, value, compareType, histogram);
+    else
+#endif
+        Base::HistogramConditional(src, srcStride, width, height, mask, maskStride, value, compareType, histogram);
+}
 
-SIMD_API void SimdNeuralUpdateWeights(const float * x, size_t size, const float * a, const float * b, float * d, float * w)
+SIMD_API void SimdNormalizedColors(const uint32_t * histogram, uint8_t * colors)
 {
-    simdNeuralUpdateWeights(x, size, a, b, d, w);
+    Base::NormalizedColors(histogram, colors);
 }
 
-typedef void(*SimdNeuralAdaptiveGradientUpdatePtr) (const float * delta, size_t size, size_t batch, const float * alpha, const float * epsilon, float * gradient, float * weight);
-SimdNeuralAdaptiveGradientUpdatePtr simdNeuralAdaptiveGradientUpdate = SIMD_FUNC4(NeuralAdaptiveGradientUpdate, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SIMD_API void SimdChangeColors(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * colors, uint8_t * dst, size_t dstStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::HA)
+        Avx512bw::ChangeColors(src, srcStride, width, height, colors, dst, dstStride);
+    else
+#endif
+        Base::ChangeColors(src, srcStride, width, height, colors, dst, dstStride);
+}
 
-SIMD_API void SimdNeuralAdaptiveGradientUpdate(const float * delta, size_t size, size_t batch, const float * alpha, const float * epsilon, float * gradient, float * weight)
+SIMD_API void SimdNormalizeHistogram(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
-    simdNeuralAdaptiveGradientUpdate(delta, size, batch, alpha, epsilon, gradient, weight);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::HA)
+        Avx512bw::NormalizeHistogram(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+        Base::NormalizeHistogram(src, srcStride, width, height, dst, dstStride);
 }
 
-SIMD_API void SimdNeuralAddConvolution2x2Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
+SIMD_API void SimdHogDirectionHistograms(const uint8_t * src, size_t stride, size_t width, size_t height, 
+                                         size_t cellX, size_t cellY, size_t quantization, float * histograms)
 {
-#ifdef SIMD_AVX512F_ENABLE
-    if (Avx512f::Enable && width >= Avx512f::F)
-        Avx512f::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::HA + 2)
+        Avx512bw::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A + 2)
+        Avx2::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A + 2)
+        Sse41::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A + 2)
+        Sse2::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
+    else
+#endif
+#ifdef SIMD_VSX_ENABLE
+    if(Vsx::Enable && width >= Vsx::A + 2)
+        Vsx::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A + 2)
+        Neon::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
+    else
+#endif
+        Base::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
+}
+
+SIMD_API void SimdHogExtractFeatures(const uint8_t * src, size_t stride, size_t width, size_t height, float * features)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::HA + 2)
+        Avx512bw::HogExtractFeatures(src, stride, width, height, features);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::HA + 2)
+        Avx2::HogExtractFeatures(src, stride, width, height, features);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A + 2)
+        Sse41::HogExtractFeatures(src, stride, width, height, features);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A + 2)
+        Neon::HogExtractFeatures(src, stride, width, height, features);
+    else
+#endif
+        Base::HogExtractFeatures(src, stride, width, height, features);
+}
+
+SIMD_API void SimdHogDeinterleave(const float * src, size_t srcStride, size_t width, size_t height, size_t count, float ** dst, size_t dstStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::F && count >= Sse::F)
+        Avx512bw::HogDeinterleave(src, srcStride, width, height, count, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::F && count >= Sse::F)
+        Avx2::HogDeinterleave(src, srcStride, width, height, count, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE_ENABLE
+    if (Sse::Enable && width >= Sse::F && count >= Sse::F)
+        Sse::HogDeinterleave(src, srcStride, width, height, count, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::F && count >= Neon::F)
+        Neon::HogDeinterleave(src, srcStride, width, height, count, dst, dstStride);
+    else
+#endif
+        Base::HogDeinterleave(src, srcStride, width, height, count, dst, dstStride);
+}
+
+SIMD_API void SimdHogFilterSeparable(const float * src, size_t srcStride, size_t width, size_t height,
+    const float * rowFilter, size_t rowSize, const float * colFilter, size_t colSize, float * dst, size_t dstStride, int add)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::F + colSize - 1)
+        Avx512bw::HogFilterSeparable(src, srcStride, width, height, rowFilter, rowSize, colFilter, colSize, dst, dstStride, add);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::F + colSize - 1)
+        Avx2::HogFilterSeparable(src, srcStride, width, height, rowFilter, rowSize, colFilter, colSize, dst, dstStride, add);
+    else
+#endif
+#ifdef SIMD_SSE_ENABLE
+    if (Sse::Enable && width >= Sse::F + colSize - 1)
+        Sse::HogFilterSeparable(src, srcStride, width, height, rowFilter, rowSize, colFilter, colSize, dst, dstStride, add);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::F + colSize - 1)
+        Neon::HogFilterSeparable(src, srcStride, width, height, rowFilter, rowSize, colFilter, colSize, dst, dstStride, add);
+    else
+#endif
+        Base::HogFilterSeparable(src, srcStride, width, height, rowFilter, rowSize, colFilter, colSize, dst, dstStride, add);
+}
+
+SIMD_API void SimdHogLiteExtractFeatures(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t cell, float * features, size_t featuresStride)
+{
+#if defined(SIMD_AVX2_ENABLE) || defined(SIMD_SSE41_ENABLE) || defined(SIMD_NEON_ENABLE)
+    size_t size = (width / cell - 1)*cell;
+#endif
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::HogLiteExtractFeatures(src, srcStride, width, height, cell, features, featuresStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && size >= Avx2::A)
+        Avx2::HogLiteExtractFeatures(src, srcStride, width, height, cell, features, featuresStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && size >= Sse41::A)
+        Sse41::HogLiteExtractFeatures(src, srcStride, width, height, cell, features, featuresStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && size >= Neon::A)
+        Neon::HogLiteExtractFeatures(src, srcStride, width, height, cell, features, featuresStride);
+    else
+#endif
+        Base::HogLiteExtractFeatures(src, srcStride, width, height, cell, features, featuresStride);
+}
+
+SIMD_API void SimdHogLiteFilterFeatures(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t featureSize, const float * filter, size_t filterWidth, size_t filterHeight, const uint32_t * mask, size_t maskStride, float * dst, size_t dstStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::HogLiteFilterFeatures(src, srcStride, srcWidth, srcHeight, featureSize, filter, filterWidth, filterHeight, mask, maskStride, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::HogLiteFilterFeatures(src, srcStride, srcWidth, srcHeight, featureSize, filter, filterWidth, filterHeight, mask, maskStride, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX_ENABLE
+    if (Avx::Enable)
+        Avx::HogLiteFilterFeatures(src, srcStride, srcWidth, srcHeight, featureSize, filter, filterWidth, filterHeight, mask, maskStride, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable)
+        Sse41::HogLiteFilterFeatures(src, srcStride, srcWidth, srcHeight, featureSize, filter, filterWidth, filterHeight, mask, maskStride, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable)
+        Neon::HogLiteFilterFeatures(src, srcStride, srcWidth, srcHeight, featureSize, filter, filterWidth, filterHeight, mask, maskStride, dst, dstStride);
+    else
+#endif
+        Base::HogLiteFilterFeatures(src, srcStride, srcWidth, srcHeight, featureSize, filter, filterWidth, filterHeight, mask, maskStride, dst, dstStride);
+}
+
+SIMD_API void SimdHogLiteResizeFeatures(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t featureSize, float * dst, size_t dstStride, size_t dstWidth, size_t dstHeight)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::HogLiteResizeFeatures(src, srcStride, srcWidth, srcHeight, featureSize, dst, dstStride, dstWidth, dstHeight);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::HogLiteResizeFeatures(src, srcStride, srcWidth, srcHeight, featureSize, dst, dstStride, dstWidth, dstHeight);
+    else
+#endif
+#ifdef SIMD_AVX_ENABLE
+    if (Avx::Enable)
+        Avx::HogLiteResizeFeatures(src, srcStride, srcWidth, srcHeight, featureSize, dst, dstStride, dstWidth, dstHeight);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable)
+        Sse41::HogLiteResizeFeatures(src, srcStride, srcWidth, srcHeight, featureSize, dst, dstStride, dstWidth, dstHeight);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable)
+        Neon::HogLiteResizeFeatures(src, srcStride, srcWidth, srcHeight, featureSize, dst, dstStride, dstWidth, dstHeight);
+    else
+#endif
+        Base::HogLiteResizeFeatures(src, srcStride, srcWidth, srcHeight, featureSize, dst, dstStride, dstWidth, dstHeight);
+}
+
+SIMD_API void SimdHogLiteCompressFeatures(const float * src, size_t srcStride, size_t width, size_t height, const float * pca, float * dst, size_t dstStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::HogLiteCompressFeatures(src, srcStride, width, height, pca, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::HogLiteCompressFeatures(src, srcStride, width, height, pca, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX_ENABLE
+    if (Avx::Enable)
+        Avx::HogLiteCompressFeatures(src, srcStride, width, height, pca, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable)
+        Sse41::HogLiteCompressFeatures(src, srcStride, width, height, pca, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable)
+        Neon::HogLiteCompressFeatures(src, srcStride, width, height, pca, dst, dstStride);
+    else
+#endif
+        Base::HogLiteCompressFeatures(src, srcStride, width, height, pca, dst, dstStride);
+}
+
+SIMD_API void SimdHogLiteFilterSeparable(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t featureSize, const float * hFilter, size_t hSize, const float * vFilter, size_t vSize, float * dst, size_t dstStride, int add)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::HogLiteFilterSeparable(src, srcStride, srcWidth, srcHeight, featureSize, hFilter, hSize, vFilter, vSize, dst, dstStride, add);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && srcWidth >= hSize - 1 + Avx2::F)
+        Avx2::HogLiteFilterSeparable(src, srcStride, srcWidth, srcHeight, featureSize, hFilter, hSize, vFilter, vSize, dst, dstStride, add);
+    else
+#endif
+#ifdef SIMD_AVX_ENABLE
+    if (Avx::Enable && srcWidth >= hSize - 1 + Avx::F)
+        Avx::HogLiteFilterSeparable(src, srcStride, srcWidth, srcHeight, featureSize, hFilter, hSize, vFilter, vSize, dst, dstStride, add);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && srcWidth >= hSize - 1 + Sse41::F)
+        Sse41::HogLiteFilterSeparable(src, srcStride, srcWidth, srcHeight, featureSize, hFilter, hSize, vFilter, vSize, dst, dstStride, add);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && srcWidth >= hSize - 1 + Neon::F)
+        Neon::HogLiteFilterSeparable(src, srcStride, srcWidth, srcHeight, featureSize, hFilter, hSize, vFilter, vSize, dst, dstStride, add);
+    else
+#endif
+        Base::HogLiteFilterSeparable(src, srcStride, srcWidth, srcHeight, featureSize, hFilter, hSize, vFilter, vSize, dst, dstStride, add);
+}
+
+typedef void(*SimdHogLiteFindMax7x7Ptr) (const float * a, size_t aStride, const float * b, size_t bStride, size_t height, float * value, size_t * col, size_t * row);
+SimdHogLiteFindMax7x7Ptr simdHogLiteFindMax7x7 = SIMD_FUNC3(HogLiteFindMax7x7, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdHogLiteFindMax7x7(const float * a, size_t aStride, const float * b, size_t bStride, size_t height, float * value, size_t * col, size_t * row)
+{
+    simdHogLiteFindMax7x7(a, aStride, b, bStride, height, value, col, row);
+}
+
+typedef void(*SimdHogLiteCreateMaskPtr) (const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const float * threshold, size_t scale, size_t size, uint32_t * dst, size_t dstStride);
+SimdHogLiteCreateMaskPtr simdHogLiteCreateMask = SIMD_FUNC4(HogLiteCreateMask, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdHogLiteCreateMask(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const float * threshold, size_t scale, size_t size, uint32_t * dst, size_t dstStride)
+{
+    simdHogLiteCreateMask(src, srcStride, srcWidth, srcHeight, threshold, scale, size, dst, dstStride);
+}
+
+SIMD_API void SimdHslToBgr(const uint8_t * hsl, size_t width, size_t height, size_t hslStride, uint8_t * bgr, size_t bgrStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::HslToBgr(hsl, width, height, hslStride, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::HslToBgr(hsl, width, height, hslStride, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::HslToBgr(hsl, width, height, hslStride, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::HslToBgr(hsl, width, height, hslStride, bgr, bgrStride);
+    else
+#endif
+        Base::HslToBgr(hsl, width, height, hslStride, bgr, bgrStride);
+}
+
+SIMD_API void SimdHsvToBgr(const uint8_t * hsv, size_t width, size_t height, size_t hsvStride, uint8_t * bgr, size_t bgrStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::HsvToBgr(hsv, width, height, hsvStride, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::HsvToBgr(hsv, width, height, hsvStride, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::HsvToBgr(hsv, width, height, hsvStride, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::HsvToBgr(hsv, width, height, hsvStride, bgr, bgrStride);
+    else
+#endif
+        Base::HsvToBgr(hsv, width, height, hsvStride, bgr, bgrStride);
+}
+
+SIMD_API void SimdLabToBgr(const uint8_t * lab, size_t width, size_t height, size_t labStride, uint8_t * bgr, size_t bgrStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::LabToBgr(lab, width, height, labStride, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::LabToBgr(lab, width, height, labStride, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::LabToBgr(lab, width, height, labStride, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::LabToBgr(lab, width, height, labStride, bgr, bgrStride);
+    else
+#endif
+        Base::LabToBgr(lab, width, height, labStride, bgr, bgrStride);
+}
+
+SIMD_API void SimdLab32fToBgr(const uint8_t * lab, size_t width, size_t height, size_t labStride, uint8_t * bgr, size_t bgrStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::Lab32fToBgr(lab, width, height, labStride, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Lab32fToBgr(lab, width, height, labStride, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::Lab32fToBgr(lab, width, height, labStride, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::Lab32fToBgr(lab, width, height, labStride, bgr, bgrStride);
+    else
+#endif
+        Base::Lab32fToBgr(lab, width, height, labStride, bgr, bgrStride);
+}
+
+SIMD_API void SimdYCoCgRToBgr(const uint8_t * y, size_t yStride, const uint8_t * co, size_t coStride, const uint8_t * cg, size_t cgStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::YCoCgRToBgr(y, yStride, co, coStride, cg, cgStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::YCoCgRToBgr(y, yStride, co, coStride, cg, cgStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::YCoCgRToBgr(y, yStride, co, coStride, cg, cgStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::YCoCgRToBgr(y, yStride, co, coStride, cg, cgStride, width, height, bgr, bgrStride);
+    else
+#endif
+        Base::YCoCgRToBgr(y, yStride, co, coStride, cg, cgStride, width, height, bgr, bgrStride);
+}
+
+SIMD_API void SimdInt16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Int16ToGray(src, width, height, srcStride, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Int16ToGray(src, width, height, srcStride, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::A)
+        Sse2::Int16ToGray(src, width, height, srcStride, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::HA)
+        Neon::Int16ToGray(src, width, height, srcStride, dst, dstStride);
+    else
+#endif
+        Base::Int16ToGray(src, width, height, srcStride, dst, dstStride);
+}
+
+SIMD_API void SimdUint16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, size_t bitDepth, SimdBool dither, uint8_t * dst, size_t dstStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Uint16ToGray(src, width, height, srcStride, bitDepth, dither, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Uint16ToGray(src, width, height, srcStride, bitDepth, dither, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::A)
+        Sse2::Uint16ToGray(src, width, height, srcStride, bitDepth, dither, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::Uint16ToGray(src, width, height, srcStride, bitDepth, dither, dst, dstStride);
+    else
+#endif
+        Base::Uint16ToGray(src, width, height, srcStride, bitDepth, dither, dst, dstStride);
+}
+
+SIMD_API void SimdUint16ToFloat32(const uint8_t * src, size_t width, size_t height, size_t srcStride, size_t bitDepth, uint8_t * dst, size_t dstStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Uint16ToFloat32(src, width, height, srcStride, bitDepth, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::HA)
+        Avx2::Uint16ToFloat32(src, width, height, srcStride, bitDepth, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::HA)
+        Sse2::Uint16ToFloat32(src, width, height, srcStride, bitDepth, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::HA)
+        Neon::Uint16ToFloat32(src, width, height, srcStride, bitDepth, dst, dstStride);
+    else
+#endif
+        Base::Uint16ToFloat32(src, width, height, srcStride, bitDepth, dst, dstStride);
+}
+
+SIMD_API void SimdChangeBitDepth(const uint8_t * src, size_t width, size_t height, size_t srcStride, size_t srcBitDepth, size_t dstBitDepth, uint8_t * dst, size_t dstStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::HA)
+        Avx512bw::ChangeBitDepth(src, width, height, srcStride, srcBitDepth, dstBitDepth, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::HA)
+        Avx2::ChangeBitDepth(src, width, height, srcStride, srcBitDepth, dstBitDepth, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::HA)
+        Sse2::ChangeBitDepth(src, width, height, srcStride, srcBitDepth, dstBitDepth, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::HA)
+        Neon::ChangeBitDepth(src, width, height, srcStride, srcBitDepth, dstBitDepth, dst, dstStride);
+    else
+#endif
+        Base::ChangeBitDepth(src, width, height, srcStride, srcBitDepth, dstBitDepth, dst, dstStride);
+}
+
+SIMD_API void SimdInterleaveUvBitDepth(const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height,
+    size_t srcBitDepth, size_t dstBitDepth, uint8_t * uv, size_t uvStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::HA)
+        Avx512bw::InterleaveUvBitDepth(u, uStride, v, vStride, width, height, srcBitDepth, dstBitDepth, uv, uvStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::HA)
+        Avx2::InterleaveUvBitDepth(u, uStride, v, vStride, width, height, srcBitDepth, dstBitDepth, uv, uvStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::HA)
+        Sse2::InterleaveUvBitDepth(u, uStride, v, vStride, width, height, srcBitDepth, dstBitDepth, uv, uvStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::HA)
+        Neon::InterleaveUvBitDepth(u, uStride, v, vStride, width, height, srcBitDepth, dstBitDepth, uv, uvStride);
+    else
+#endif
+        Base::InterleaveUvBitDepth(u, uStride, v, vStride, width, height, srcBitDepth, dstBitDepth, uv, uvStride);
+}
+
+SIMD_API void SimdDeinterleaveUvBitDepth(const uint8_t * uv, size_t uvStride, size_t width, size_t height, size_t srcBitDepth, size_t dstBitDepth,
+    uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::HA)
+        Avx512bw::DeinterleaveUvBitDepth(uv, uvStride, width, height, srcBitDepth, dstBitDepth, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::HA)
+        Avx2::DeinterleaveUvBitDepth(uv, uvStride, width, height, srcBitDepth, dstBitDepth, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::HA)
+        Sse2::DeinterleaveUvBitDepth(uv, uvStride, width, height, srcBitDepth, dstBitDepth, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::HA)
+        Neon::DeinterleaveUvBitDepth(uv, uvStride, width, height, srcBitDepth, dstBitDepth, u, uStride, v, vStride);
+    else
+#endif
+        Base::DeinterleaveUvBitDepth(uv, uvStride, width, height, srcBitDepth, dstBitDepth, u, uStride, v, vStride);
+}
+
+SIMD_API void SimdIntegral(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+                      uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride,
+                      SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
+    else
+#endif
+        Base::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
+}
+
+SIMD_API void SimdInterferenceIncrement(uint8_t * statistic, size_t stride, size_t width, size_t height, uint8_t increment, int16_t saturation)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::HA)
+        Avx2::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::HA)
+        Sse2::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::HA)
+        Vmx::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::HA)
+        Neon::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
+    else
+#endif
+        Base::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
+}
+
+SIMD_API void SimdInterferenceIncrementMasked(uint8_t * statistic, size_t statisticStride, size_t width, size_t height, 
+                                              uint8_t increment, int16_t saturation, const uint8_t * mask, size_t maskStride, uint8_t index)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::A)
+        Vmx::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
+    else
+#endif
+        Base::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
+}
+
+SIMD_API void SimdInterferenceDecrement(uint8_t * statistic, size_t stride, size_t width, size_t height, uint8_t decrement, int16_t saturation)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::HA)
+        Avx2::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::HA)
+        Sse2::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::HA)
+        Vmx::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::HA)
+        Neon::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
+    else
+#endif
+        Base::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
+}
+
+SIMD_API void SimdInterferenceDecrementMasked(uint8_t * statistic, size_t statisticStride, size_t width, size_t height, 
+                                              uint8_t decrement, int16_t saturation, const uint8_t * mask, size_t maskStride, uint8_t index)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::A)
+        Vmx::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
+    else
+#endif
+        Base::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
+}
+
+SIMD_API void SimdInterleaveUv(const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * uv, size_t uvStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::A)
+        Sse2::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if (Vmx::Enable && width >= Vmx::A)
+        Vmx::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
+    else
+#endif
+        Base::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
+}
+
+SIMD_API void SimdInterleaveBgr(const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride,
+    size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::InterleaveBgr(b, bStride, g, gStride, r, rStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::InterleaveBgr(b, bStride, g, gStride, r, rStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::A)
+        Ssse3::InterleaveBgr(b, bStride, g, gStride, r, rStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::InterleaveBgr(b, bStride, g, gStride, r, rStride, width, height, bgr, bgrStride);
+    else
+#endif
+        Base::InterleaveBgr(b, bStride, g, gStride, r, rStride, width, height, bgr, bgrStride);
+}
+
+SIMD_API void SimdInterleaveBgra(const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride, const uint8_t * a, size_t aStride,
+    size_t width, size_t height, uint8_t * bgra, size_t bgraStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::InterleaveBgra(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::InterleaveBgra(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::A)
+        Ssse3::InterleaveBgra(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::InterleaveBgra(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
+    else
+#endif
+        Base::InterleaveBgra(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
+}
+
+SIMD_API void SimdLaplace(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width > Avx512bw::A)
+        Avx512bw::Laplace(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width > Avx2::A)
+        Avx2::Laplace(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width > Ssse3::A)
+        Ssse3::Laplace(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width > Sse2::A)
+        Sse2::Laplace(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width > Vmx::A)
+        Vmx::Laplace(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width > Neon::A)
+        Neon::Laplace(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+        Base::Laplace(src, srcStride, width, height, dst, dstStride);
+}
+
+SIMD_API void SimdLaplaceAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width > Avx512bw::A)
+        Avx512bw::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width > Avx2::A)
+        Avx2::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width > Ssse3::A)
+        Ssse3::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width > Vmx::A)
+        Vmx::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width > Neon::A)
+        Neon::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+        Base::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
+}
+
+SIMD_API void SimdLaplaceAbsSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width > Avx512bw::A)
+        Avx512bw::LaplaceAbsSum(src, stride, width, height, sum);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width > Avx2::A)
+        Avx2::LaplaceAbsSum(src, stride, width, height, sum);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width > Ssse3::A)
+        Ssse3::LaplaceAbsSum(src, stride, width, height, sum);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width > Vmx::A)
+        Vmx::LaplaceAbsSum(src, stride, width, height, sum);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width > Neon::A)
+        Neon::LaplaceAbsSum(src, stride, width, height, sum);
+    else
+#endif
+        Base::LaplaceAbsSum(src, stride, width, height, sum);
+}
+
+SIMD_API void SimdLbpEstimate(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::A + 2)
+        Avx512bw::LbpEstimate(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A + 2)
+        Avx2::LbpEstimate(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A + 2)
+        Sse2::LbpEstimate(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::A + 2)
+        Vmx::LbpEstimate(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A + 2)
+        Neon::LbpEstimate(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+        Base::LbpEstimate(src, srcStride, width, height, dst, dstStride);
+}
+
+typedef void(*SimdMathFunction32fPtr) (const float * src, size_t size, SimdMathFunctionType type, const float * params, SimdMathAccuracyType accuracy, float * dst);
+SimdMathFunction32fPtr simdMathFunction32f = SIMD_FUNC4(MathFunction32f, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdMathFunction32f(const float * src, size_t size, SimdMathFunctionType type, const float * params, SimdMathAccuracyType accuracy, float * dst)
+{
+    simdMathFunction32f(src, size, type, params, accuracy, dst);
+}
+
+SIMD_API void SimdMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
+        Avx512bw::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && (width - 1)*channelCount >= Avx2::A)
+        Avx2::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && (width - 1)*channelCount >= Ssse3::A)
+        Ssse3::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && (width - 1)*channelCount >= Sse2::A)
+        Sse2::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if (Vmx::Enable && (width - 1)*channelCount >= Vmx::A)
+        Vmx::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && (width - 1)*channelCount >= Neon::A)
+        Neon::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+        Base::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+}
+
+SIMD_API void SimdMedianFilterRhomb3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
+        Avx512bw::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && (width - 1)*channelCount >= Avx2::A)
+        Avx2::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && (width - 1)*channelCount >= Sse2::A)
+        Sse2::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && (width - 1)*channelCount >= Vmx::A)
+        Vmx::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && (width - 1)*channelCount >= Neon::A)
+        Neon::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+        Base::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+}
+
+SIMD_API void SimdMedianFilterRhomb5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && (width - 2)*channelCount >= Avx512bw::A)
+        Avx512bw::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && (width - 2)*channelCount >= Avx2::A)
+        Avx2::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && (width - 2)*channelCount >= Sse2::A)
+        Sse2::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && (width - 2)*channelCount >= Vmx::A)
+        Vmx::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && (width - 2)*channelCount >= Neon::A)
+        Neon::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+        Base::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
+}
+
+SIMD_API void SimdMedianFilterSquare3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
+        Avx512bw::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && (width - 1)*channelCount >= Avx2::A)
+        Avx2::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && (width - 1)*channelCount >= Sse2::A)
+        Sse2::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && (width - 1)*channelCount >= Vmx::A)
+        Vmx::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && (width - 1)*channelCount >= Neon::A)
+        Neon::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+        Base::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+}
+
+SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && (width - 2)*channelCount >= Avx512bw::A)
+        Avx512bw::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && (width - 2)*channelCount >= Avx2::A)
+        Avx2::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && (width - 2)*channelCount >= Sse2::A)
+        Sse2::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && (width - 2)*channelCount >= Vmx::A)
+        Vmx::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && (width - 2)*channelCount >= Neon::A)
+        Neon::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
+        Base::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
+}
+
+SIMD_API void SimdNeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512f::F)
+        Avx512bw::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx::F)
+        Avx2::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::A)
+        Sse2::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
+    else
+#endif
+#ifdef SIMD_VSX_ENABLE
+    if (Vsx::Enable && width >= Vsx::A)
+        Vsx::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
+    else
+#endif
+        Base::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
+}
+
+typedef void(*SimdNeuralProductSumPtr) (const float * a, const float * b, size_t size, float * sum);
+SimdNeuralProductSumPtr simdNeuralProductSum = SIMD_FUNC6(NeuralProductSum, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_VSX_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdNeuralProductSum(const float * a, const float * b, size_t size, float * sum)
+{
+    simdNeuralProductSum(a, b, size, sum);
+}
+
+typedef void(*SimdNeuralAddVectorMultipliedByValuePtr) (const float * src, size_t size, const float * value, float * dst);
+SimdNeuralAddVectorMultipliedByValuePtr simdNeuralAddVectorMultipliedByValue = SIMD_FUNC5(NeuralAddVectorMultipliedByValue, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdNeuralAddVectorMultipliedByValue(const float * src, size_t size, const float * value, float * dst)
+{
+    simdNeuralAddVectorMultipliedByValue(src, size, value, dst);
+}
+
+typedef void(*SimdNeuralAddVectorPtr) (const float * src, size_t size, float * dst);
+SimdNeuralAddVectorPtr simdNeuralAddVector = SIMD_FUNC4(NeuralAddVector, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdNeuralAddVector(const float * src, size_t size, float * dst)
+{
+    simdNeuralAddVector(src, size, dst);
+}
+
+typedef void(*SimdNeuralAddValuePtr) (const float * value, float * dst, size_t size);
+SimdNeuralAddValuePtr simdNeuralAddValue = SIMD_FUNC4(NeuralAddValue, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdNeuralAddValue(const float * value, float * dst, size_t size)
+{
+    simdNeuralAddValue(value, dst, size);
+}
+
+typedef void(*SimdNeuralSigmoidPtr) (const float * src, size_t size, const float * slope, float * dst);
+SimdNeuralSigmoidPtr simdNeuralSigmoid = SIMD_FUNC4(NeuralSigmoid, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdNeuralSigmoid(const float * src, size_t size, const float * slope, float * dst)
+{
+    simdNeuralSigmoid(src, size, slope, dst);
+}
+
+typedef void(*SimdNeuralRoughSigmoidPtr) (const float * src, size_t size, const float * slope, float * dst);
+SimdNeuralRoughSigmoidPtr simdNeuralRoughSigmoid = SIMD_FUNC5(NeuralRoughSigmoid, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_VSX_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdNeuralRoughSigmoid(const float * src, size_t size, const float * slope, float * dst)
+{
+    simdNeuralRoughSigmoid(src, size, slope, dst);
+}
+
+typedef void(*SimdNeuralRoughSigmoid2Ptr) (const float * src, size_t size, const float * slope, float * dst);
+SimdNeuralRoughSigmoid2Ptr simdNeuralRoughSigmoid2 = SIMD_FUNC5(NeuralRoughSigmoid2, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdNeuralRoughSigmoid2(const float * src, size_t size, const float * slope, float * dst)
+{
+    simdNeuralRoughSigmoid2(src, size, slope, dst);
+}
+
+typedef void(*SimdNeuralDerivativeSigmoidPtr) (const float * src, size_t size, const float * slope, float * dst);
+SimdNeuralDerivativeSigmoidPtr simdNeuralDerivativeSigmoid = SIMD_FUNC4(NeuralDerivativeSigmoid, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdNeuralDerivativeSigmoid(const float * src, size_t size, const float * slope, float * dst)
+{
+    simdNeuralDerivativeSigmoid(src, size, slope, dst);
+}
+
+typedef void(*SimdNeuralTanhPtr) (const float * src, size_t size, const float * slope, float * dst);
+SimdNeuralTanhPtr simdNeuralTanh = SIMD_FUNC4(NeuralTanh, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdNeuralTanh(const float * src, size_t size, const float * slope, float * dst)
+{
+    simdNeuralTanh(src, size, slope, dst);
+}
+
+typedef void(*SimdNeuralRoughTanhPtr) (const float * src, size_t size, const float * slope, float * dst);
+SimdNeuralRoughTanhPtr simdNeuralRoughTanh = SIMD_FUNC4(NeuralRoughTanh, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdNeuralRoughTanh(const float * src, size_t size, const float * slope, float * dst)
+{
+    simdNeuralRoughTanh(src, size, slope, dst);
+}
+
+typedef void(*SimdNeuralDerivativeTanhPtr) (const float * src, size_t size, const float * slope, float * dst);
+SimdNeuralDerivativeTanhPtr simdNeuralDerivativeTanh = SIMD_FUNC4(NeuralDerivativeTanh, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdNeuralDerivativeTanh(const float * src, size_t size, const float * slope, float * dst)
+{
+    simdNeuralDerivativeTanh(src, size, slope, dst);
+}
+
+typedef void(*SimdNeuralReluPtr) (const float * src, size_t size, const float * slope, float * dst);
+SimdNeuralReluPtr simdNeuralRelu = SIMD_FUNC4(NeuralRelu, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdNeuralRelu(const float * src, size_t size, const float * slope, float * dst)
+{
+    simdNeuralRelu(src, size, slope, dst);
+}
+
+typedef void(*SimdNeuralDerivativeReluPtr) (const float * src, size_t size, const float * slope, float * dst);
+SimdNeuralDerivativeReluPtr simdNeuralDerivativeRelu = SIMD_FUNC4(NeuralDerivativeRelu, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdNeuralDerivativeRelu(const float * src, size_t size, const float * slope, float * dst)
+{
+    simdNeuralDerivativeRelu(src, size, slope, dst);
+}
+
+typedef void(*SimdNeuralPowPtr) (const float * src, size_t size, const float * exponent, float * dst);
+SimdNeuralPowPtr simdNeuralPow = SIMD_FUNC4(NeuralPow, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdNeuralPow(const float * src, size_t size, const float * exponent, float * dst)
+{
+    simdNeuralPow(src, size, exponent, dst);
+}
+
+typedef void(*SimdNeuralUpdateWeightsPtr) (const float * x, size_t size, const float * a, const float * b, float * d, float * w);
+SimdNeuralUpdateWeightsPtr simdNeuralUpdateWeights = SIMD_FUNC4(NeuralUpdateWeights, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdNeuralUpdateWeights(const float * x, size_t size, const float * a, const float * b, float * d, float * w)
+{
+    simdNeuralUpdateWeights(x, size, a, b, d, w);
+}
+
+typedef void(*SimdNeuralAdaptiveGradientUpdatePtr) (const float * delta, size_t size, size_t batch, const float * alpha, const float * epsilon, float * gradient, float * weight);
+SimdNeuralAdaptiveGradientUpdatePtr simdNeuralAdaptiveGradientUpdate = SIMD_FUNC4(NeuralAdaptiveGradientUpdate, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdNeuralAdaptiveGradientUpdate(const float * delta, size_t size, size_t batch, const float * alpha, const float * epsilon, float * gradient, float * weight)
+{
+    simdNeuralAdaptiveGradientUpdate(delta, size, batch, alpha, epsilon, gradient, weight);
+}
+
+SIMD_API void SimdNeuralAddConvolution2x2Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
+{
+#ifdef SIMD_AVX512F_ENABLE
+    if (Avx512f::Enable && width >= Avx512f::F)
+        Avx512f::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::F)
+        Avx2::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX_ENABLE
+    if (Avx::Enable && width >= Avx::F)
+        Avx::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE_ENABLE
+    if (Sse::Enable && width >= Sse::F)
+        Sse::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::F)
+        Neon::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
+    else
+#endif
+        Base::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
+}
+
+SIMD_API void SimdNeuralAddConvolution3x3Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
+{
+#ifdef SIMD_AVX512F_ENABLE
+    if (Avx512f::Enable && width >= Avx512f::F)
+        Avx512f::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::F)
+        Avx2::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX_ENABLE
+    if (Avx::Enable && width >= Avx::F)
+        Avx::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE_ENABLE
+    if (Sse::Enable && width >= Sse::F)
+        Sse::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::F)
+        Neon::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
+    else
+#endif
+        Base::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
+}
+
+SIMD_API void SimdNeuralAddConvolution4x4Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
+{
+#ifdef SIMD_AVX512F_ENABLE
+    if (Avx512f::Enable && width >= Avx512f::F)
+        Avx512f::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::F)
+        Avx2::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX_ENABLE
+    if (Avx::Enable && width >= Avx::F)
+        Avx::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE_ENABLE
+    if (Sse::Enable && width >= Sse::F)
+        Sse::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::F)
+        Neon::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
+    else
+#endif
+        Base::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
+}
+
+SIMD_API void SimdNeuralAddConvolution5x5Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
+{
+#ifdef SIMD_AVX512F_ENABLE
+    if (Avx512f::Enable && width >= Avx512f::F)
+        Avx512f::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::F)
+        Avx2::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX_ENABLE
+    if (Avx::Enable && width >= Avx::F)
+        Avx::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE_ENABLE
+    if (Sse::Enable && width >= Sse::F)
+        Sse::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::F)
+        Neon::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
+    else
+#endif
+        Base::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
+}
+
+typedef void(*SimdNeuralAddConvolution2x2BackwardPtr) (const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+SimdNeuralAddConvolution2x2BackwardPtr simdNeuralAddConvolution2x2Backward = SIMD_FUNC5(NeuralAddConvolution2x2Backward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdNeuralAddConvolution2x2Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
+{
+    simdNeuralAddConvolution2x2Backward(src, srcStride, width, height, weights, dst, dstStride);
+}
+
+typedef void(*SimdNeuralAddConvolution3x3BackwardPtr) (const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+SimdNeuralAddConvolution3x3BackwardPtr simdNeuralAddConvolution3x3Backward = SIMD_FUNC5(NeuralAddConvolution3x3Backward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdNeuralAddConvolution3x3Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
+{
+    simdNeuralAddConvolution3x3Backward(src, srcStride, width, height, weights, dst, dstStride);
+}
+
+typedef void(*SimdNeuralAddConvolution4x4BackwardPtr) (const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+SimdNeuralAddConvolution4x4BackwardPtr simdNeuralAddConvolution4x4Backward = SIMD_FUNC5(NeuralAddConvolution4x4Backward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdNeuralAddConvolution4x4Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
+{
+    simdNeuralAddConvolution4x4Backward(src, srcStride, width, height, weights, dst, dstStride);
+}
+
+typedef void(*SimdNeuralAddConvolution5x5BackwardPtr) (const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+SimdNeuralAddConvolution5x5BackwardPtr simdNeuralAddConvolution5x5Backward = SIMD_FUNC5(NeuralAddConvolution5x5Backward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdNeuralAddConvolution5x5Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
+{
+    simdNeuralAddConvolution5x5Backward(src, srcStride, width, height, weights, dst, dstStride);
+}
+
+SIMD_API void SimdNeuralAddConvolution2x2Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums)
+{
+#ifdef SIMD_AVX512F_ENABLE
+    if (Avx512f::Enable && width >= Avx512f::F)
+        Avx512f::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::F)
+        Avx2::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_AVX_ENABLE
+    if (Avx::Enable && width >= Avx::F)
+        Avx::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_SSE3_ENABLE
+    if (Sse3::Enable && width >= Sse3::F)
+        Sse3::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_SSE_ENABLE
+    if (Sse::Enable && width >= Sse::F)
+        Sse::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::F)
+        Neon::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
+    else
+#endif
+        Base::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
+}
+
+SIMD_API void SimdNeuralAddConvolution3x3Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums)
+{
+#ifdef SIMD_AVX512F_ENABLE
+    if (Avx512f::Enable && width >= Avx512f::F)
+        Avx512f::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::F)
+        Avx2::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_AVX_ENABLE
+    if (Avx::Enable && width >= Avx::F)
+        Avx::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_SSE3_ENABLE
+    if (Sse3::Enable && width >= Sse3::F)
+        Sse3::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_SSE_ENABLE
+    if (Sse::Enable && width >= Sse::F)
+        Sse::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::F)
+        Neon::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
+    else
+#endif
+        Base::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
+}
+
+SIMD_API void SimdNeuralAddConvolution4x4Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums)
+{
+#ifdef SIMD_AVX512F_ENABLE
+    if (Avx512f::Enable && width >= Avx512f::F)
+        Avx512f::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::F)
+        Avx2::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_AVX_ENABLE
+    if (Avx::Enable && width >= Avx::F)
+        Avx::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_SSE3_ENABLE
+    if (Sse3::Enable && width >= Sse3::F)
+        Sse3::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_SSE_ENABLE
+    if (Sse::Enable && width >= Sse::F)
+        Sse::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::F)
+        Neon::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
+    else
+#endif
+        Base::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
+}
+
+SIMD_API void SimdNeuralAddConvolution5x5Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums)
+{
+#ifdef SIMD_AVX512F_ENABLE
+    if (Avx512f::Enable && width >= Avx512f::F)
+        Avx512f::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::F)
+        Avx2::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_AVX_ENABLE
+    if (Avx::Enable && width >= Avx::F)
+        Avx::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_SSE3_ENABLE
+    if (Sse3::Enable && width >= Sse3::F)
+        Sse3::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_SSE_ENABLE
+    if (Sse::Enable && width >= Sse::F)
+        Sse::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::F)
+        Neon::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
+    else
+#endif
+        Base::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
+}
+
+SIMD_API void SimdNeuralPooling1x1Max3x3(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride)
+{
+#ifdef SIMD_AVX512F_ENABLE
+    if (Avx512f::Enable && width > Avx512f::F)
+        Avx512f::NeuralPooling1x1Max3x3(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width > Avx2::F)
+        Avx2::NeuralPooling1x1Max3x3(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE_ENABLE
+    if (Sse::Enable && width > Sse::F)
+        Sse::NeuralPooling1x1Max3x3(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width > Neon::F)
+        Neon::NeuralPooling1x1Max3x3(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+        Base::NeuralPooling1x1Max3x3(src, srcStride, width, height, dst, dstStride);
+}
+
+SIMD_API void SimdNeuralPooling2x2Max2x2(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride)
+{
+#ifdef SIMD_AVX512F_ENABLE
+    if (Avx512f::Enable && width >= Avx512f::DF)
+        Avx512f::NeuralPooling2x2Max2x2(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX_ENABLE
+    if (Avx::Enable && width >= Avx::DF)
+        Avx::NeuralPooling2x2Max2x2(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE_ENABLE
+    if (Sse::Enable && width >= Sse::DF)
+        Sse::NeuralPooling2x2Max2x2(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DF)
+        Neon::NeuralPooling2x2Max2x2(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+        Base::NeuralPooling2x2Max2x2(src, srcStride, width, height, dst, dstStride);
+}
+
+SIMD_API void SimdNeuralPooling2x2Max3x3(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride)
+{
+#ifdef SIMD_AVX512F_ENABLE
+    if (Avx512f::Enable && width > Avx512f::DF)
+        Avx512f::NeuralPooling2x2Max3x3(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width > Avx2::DF)
+        Avx2::NeuralPooling2x2Max3x3(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE_ENABLE
+    if (Sse::Enable && width > Sse::DF)
+        Sse::NeuralPooling2x2Max3x3(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width > Neon::DF)
+        Neon::NeuralPooling2x2Max3x3(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+        Base::NeuralPooling2x2Max3x3(src, srcStride, width, height, dst, dstStride);
+}
+
+typedef void(*SimdNeuralConvolutionForwardPtr) (const float * src, size_t srcWidth, size_t srcHeight, size_t srcDepth, 
+    const float * weight, size_t kernelX, size_t kernelY, size_t padX, size_t padY, size_t strideX, size_t strideY, size_t dilationX, size_t dilationY, 
+    void * buffer, size_t * size, float * dst, size_t dstWidth, size_t dstHeight, size_t dstDepth, int add);
+volatile SimdNeuralConvolutionForwardPtr simdNeuralConvolutionForward = SIMD_FUNC5(NeuralConvolutionForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE3_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, size_t srcHeight, size_t srcDepth, 
+    const float * weight, size_t kernelX, size_t kernelY, size_t padX, size_t padY, size_t strideX, size_t strideY, size_t dilationX, size_t dilationY, 
+    void * buffer, size_t * size, float * dst, size_t dstWidth, size_t dstHeight, size_t dstDepth, int add)
+{
+    simdNeuralConvolutionForward(src, srcWidth, srcHeight, srcDepth, weight, kernelX, kernelY, padX, padY, strideX, strideY, dilationX, dilationY, buffer, size, dst, dstWidth, dstHeight, dstDepth, add);
+}
+
+SIMD_API void SimdNv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+    size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+    else
+#endif
+        Base::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+}
+
+SIMD_API void SimdNv12ToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+    size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv12ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Nv12ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv12ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::Nv12ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdNv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+    size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
     else
 #endif
-#ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width >= Sse::F)
-        Sse::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
     else
 #endif
-        Base::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
+        Base::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
 }
 
-SIMD_API void SimdNeuralAddConvolution3x3Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
+SIMD_API void SimdNv12ToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+    size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
 {
-#ifdef SIMD_AVX512F_ENABLE
-    if (Avx512f::Enable && width >= Avx512f::F)
-        Avx512f::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv12ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
     else
 #endif
-#ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width >= Sse::F)
-        Sse::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::Nv12ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv12ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
     else
 #endif
-        Base::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
+        Base::Nv12ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
 }
 
-SIMD_API void SimdNeuralAddConvolution4x4Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
+SIMD_API void SimdNv12ToHue(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+    size_t width, size_t height, uint8_t * hue, size_t hueStride)
 {
-#ifdef SIMD_AVX512F_ENABLE
-    if (Avx512f::Enable && width >= Avx512f::F)
-        Avx512f::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv12ToHue(y, yStride, uv, uvStride, width, height, hue, hueStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToHue(y, yStride, uv, uvStride, width, height, hue, hueStride);
     else
 #endif
-#ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width >= Sse::F)
-        Sse::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::Nv12ToHue(y, yStride, uv, uvStride, width, height, hue, hueStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv12ToHue(y, yStride, uv, uvStride, width, height, hue, hueStride);
     else
 #endif
-        Base::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
+        Base::Nv12ToHue(y, yStride, uv, uvStride, width, height, hue, hueStride);
 }
 
-SIMD_API void SimdNeuralAddConvolution5x5Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
+SIMD_API void SimdNv12ToHueV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+    size_t width, size_t height, uint8_t * hue, size_t hueStride, SimdYuvType yuvType)
 {
-#ifdef SIMD_AVX512F_ENABLE
-    if (Avx512f::Enable && width >= Avx512f::F)
-        Avx512f::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv12ToHueV2(y, yStride, uv, uvStride, width, height, hue, hueStride, yuvType);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToHueV2(y, yStride, uv, uvStride, width, height, hue, hueStride, yuvType);
     else
 #endif
-#ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width >= Sse::F)
-        Sse::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::Nv12ToHueV2(y, yStride, uv, uvStride, width, height, hue, hueStride, yuvType);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv12ToHueV2(y, yStride, uv, uvStride, width, height, hue, hueStride, yuvType);
     else
 #endif
-        Base::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
-}
-
-typedef void(*SimdNeuralAddConvolution2x2BackwardPtr) (const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
-SimdNeuralAddConvolution2x2BackwardPtr simdNeuralAddConvolution2x2Backward = SIMD_FUNC5(NeuralAddConvolution2x2Backward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdNeuralAddConvolution2x2Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
-{
-    simdNeuralAddConvolution2x2Backward(src, srcStride, width, height, weights, dst, dstStride);
-}
-
-typedef void(*SimdNeuralAddConvolution3x3BackwardPtr) (const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
-SimdNeuralAddConvolution3x3BackwardPtr simdNeuralAddConvolution3x3Backward = SIMD_FUNC5(NeuralAddConvolution3x3Backward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdNeuralAddConvolution3x3Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
-{
-    simdNeuralAddConvolution3x3Backward(src, srcStride, width, height, weights, dst, dstStride);
-}
-
-typedef void(*SimdNeuralAddConvolution4x4BackwardPtr) (const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
-SimdNeuralAddConvolution4x4BackwardPtr simdNeuralAddConvolution4x4Backward = SIMD_FUNC5(NeuralAddConvolution4x4Backward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdNeuralAddConvolution4x4Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
-{
-    simdNeuralAddConvolution4x4Backward(src, srcStride, width, height, weights, dst, dstStride);
-}
-
-typedef void(*SimdNeuralAddConvolution5x5BackwardPtr) (const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
-SimdNeuralAddConvolution5x5BackwardPtr simdNeuralAddConvolution5x5Backward = SIMD_FUNC5(NeuralAddConvolution5x5Backward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdNeuralAddConvolution5x5Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
-{
-    simdNeuralAddConvolution5x5Backward(src, srcStride, width, height, weights, dst, dstStride);
+        Base::Nv12ToHueV2(y, yStride, uv, uvStride, width, height, hue, hueStride, yuvType);
 }
 
-SIMD_API void SimdNeuralAddConvolution2x2Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums)
+SIMD_API void SimdNv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+    size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
-#ifdef SIMD_AVX512F_ENABLE
-    if (Avx512f::Enable && width >= Avx512f::F)
-        Avx512f::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv21ToBgr(y, yStride, vu, vuStride, width, height, bgr, bgrStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_SSE3_ENABLE
-    if (Sse3::Enable && width >= Sse3::F)
-        Sse3::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv21ToBgr(y, yStride, vu, vuStride, width, height, bgr, bgrStride);
     else
 #endif
-#ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width >= Sse::F)
-        Sse::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Nv21ToBgr(y, yStride, vu, vuStride, width, height, bgr, bgrStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv21ToBgr(y, yStride, vu, vuStride, width, height, bgr, bgrStride);
     else
 #endif
-        Base::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
+        Base::Nv21ToBgr(y, yStride, vu, vuStride, width, height, bgr, bgrStride);
 }
 
-SIMD_API void SimdNeuralAddConvolution3x3Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums)
+SIMD_API void SimdNv21ToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+    size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
 {
-#ifdef SIMD_AVX512F_ENABLE
-    if (Avx512f::Enable && width >= Avx512f::F)
-        Avx512f::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv21ToBgrV2(y, yStride, vu, vuStride, width, height, bgr, bgrStride, yuvType);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_SSE3_ENABLE
-    if (Sse3::Enable && width >= Sse3::F)
-        Sse3::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv21ToBgrV2(y, yStride, vu, vuStride, width, height, bgr, bgrStride, yuvType);
     else
 #endif
-#ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width >= Sse::F)
-        Sse::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Nv21ToBgrV2(y, yStride, vu, vuStride, width, height, bgr, bgrStride, yuvType);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv21ToBgrV2(y, yStride, vu, vuStride, width, height, bgr, bgrStride, yuvType);
     else
 #endif
-        Base::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
+        Base::Nv21ToBgrV2(y, yStride, vu, vuStride, width, height, bgr, bgrStride, yuvType);
 }
 
-SIMD_API void SimdNeuralAddConvolution4x4Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums)
+SIMD_API void SimdNv21ToBgra(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+    size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
-#ifdef SIMD_AVX512F_ENABLE
-    if (Avx512f::Enable && width >= Avx512f::F)
-        Avx512f::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv21ToBgra(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_SSE3_ENABLE
-    if (Sse3::Enable && width >= Sse3::F)
-        Sse3::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv21ToBgra(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha);
     else
 #endif
-#ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width >= Sse::F)
-        Sse::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::Nv21ToBgra(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv21ToBgra(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha);
     else
 #endif
-        Base::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
+        Base::Nv21ToBgra(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha);
 }
 
-SIMD_API void SimdNeuralAddConvolution5x5Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums)
+SIMD_API void SimdNv21ToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+    size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
 {
-#ifdef SIMD_AVX512F_ENABLE
-    if (Avx512f::Enable && width >= Avx512f::F)
-        Avx512f::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv21ToBgraV2(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha, yuvType);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv21ToBgraV2(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha, yuvType);
     else
 #endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::Nv21ToBgraV2(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha, yuvType);
     else
 #endif
-#ifdef SIMD_SSE3_ENABLE
-    if (Sse3::Enable && width >= Sse3::F)
-        Sse3::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv21ToBgraV2(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha, yuvType);
     else
 #endif
-#ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width >= Sse::F)
-        Sse::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
+        Base::Nv21ToBgraV2(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdNv21ToHue(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+    size_t width, size_t height, uint8_t * hue, size_t hueStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv21ToHue(y, yStride, vu, vuStride, width, height, hue, hueStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv21ToHue(y, yStride, vu, vuStride, width, height, hue, hueStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::Nv21ToHue(y, yStride, vu, vuStride, width, height, hue, hueStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv21ToHue(y, yStride, vu, vuStride, width, height, hue, hueStride);
     else
 #endif
-        Base::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
+        Base::Nv21ToHue(y, yStride, vu, vuStride, width, height, hue, hueStride);
 }
 
-SIMD_API void SimdNeuralPooling1x1Max3x3(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride)
+SIMD_API void SimdNv21ToHueV2(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+    size_t width, size_t height, uint8_t * hue, size_t hueStride, SimdYuvType yuvType)
 {
-#ifdef SIMD_AVX512F_ENABLE
-    if (Avx512f::Enable && width > Avx512f::F)
-        Avx512f::NeuralPooling1x1Max3x3(src, srcStride, width, height, dst, dstStride);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv21ToHueV2(y, yStride, vu, vuStride, width, height, hue, hueStride, yuvType);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width > Avx2::F)
-        Avx2::NeuralPooling1x1Max3x3(src, srcStride, width, height, dst, dstStride);
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv21ToHueV2(y, yStride, vu, vuStride, width, height, hue, hueStride, yuvType);
     else
 #endif
-#ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width > Sse::F)
-        Sse::NeuralPooling1x1Max3x3(src, srcStride, width, height, dst, dstStride);
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::Nv21ToHueV2(y, yStride, vu, vuStride, width, height, hue, hueStride, yuvType);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::F)
-        Neon::NeuralPooling1x1Max3x3(src, srcStride, width, height, dst, dstStride);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv21ToHueV2(y, yStride, vu, vuStride, width, height, hue, hueStride, yuvType);
     else
 #endif
-        Base::NeuralPooling1x1Max3x3(src, srcStride, width, height, dst, dstStride);
+        Base::Nv21ToHueV2(y, yStride, vu, vuStride, width, height, hue, hueStride, yuvType);
 }
 
-SIMD_API void SimdNeuralPooling2x2Max2x2(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride)
+SIMD_API void SimdP016ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+    size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdBool dither, SimdYuvType yuvType, uint8_t * buffer)
 {
-#ifdef SIMD_AVX512F_ENABLE
-    if (Avx512f::Enable && width >= Avx512f::DF)
-        Avx512f::NeuralPooling2x2Max2x2(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::DF)
-        Avx::NeuralPooling2x2Max2x2(src, srcStride, width, height, dst, dstStride);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::P016ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride, dither, yuvType, buffer);
     else
 #endif
-#ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width >= Sse::DF)
-        Sse::NeuralPooling2x2Max2x2(src, srcStride, width, height, dst, dstStride);
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::P016ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride, dither, yuvType, buffer);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DF)
-        Neon::NeuralPooling2x2Max2x2(src, srcStride, width, height, dst, dstStride);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::P016ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride, dither, yuvType, buffer);
     else
 #endif
-        Base::NeuralPooling2x2Max2x2(src, srcStride, width, height, dst, dstStride);
+        Base::P016ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride, dither, yuvType, buffer);
 }
 
-SIMD_API void SimdNeuralPooling2x2Max3x3(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride)
+SIMD_API void SimdP016ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+    size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdBool dither, SimdYuvType yuvType, uint8_t * buffer)
 {
-#ifdef SIMD_AVX512F_ENABLE
-    if (Avx512f::Enable && width > Avx512f::DF)
-        Avx512f::NeuralPooling2x2Max3x3(src, srcStride, width, height, dst, dstStride);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::P016ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, dither, yuvType, buffer);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width > Avx2::DF)
-        Avx2::NeuralPooling2x2Max3x3(src, srcStride, width, height, dst, dstStride);
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::P016ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, dither, yuvType, buffer);
     else
 #endif
-#ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width > Sse::DF)
-        Sse::NeuralPooling2x2Max3x3(src, srcStride, width, height, dst, dstStride);
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::P016ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, dither, yuvType, buffer);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::DF)
-        Neon::NeuralPooling2x2Max3x3(src, srcStride, width, height, dst, dstStride);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::P016ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, dither, yuvType, buffer);
     else
 #endif
-        Base::NeuralPooling2x2Max3x3(src, srcStride, width, height, dst, dstStride);
-}
-
-typedef void(*SimdNeuralConvolutionForwardPtr) (const float * src, size_t srcWidth, size_t srcHeight, size_t srcDepth, 
-    const float * weight, size_t kernelX, size_t kernelY, size_t padX, size_t padY, size_t strideX, size_t strideY, size_t dilationX, size_t dilationY, 
-    void * buffer, size_t * size, float * dst, size_t dstWidth, size_t dstHeight, size_t dstDepth, int add);
-volatile SimdNeuralConvolutionForwardPtr simdNeuralConvolutionForward = SIMD_FUNC5(NeuralConvolutionForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE3_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, size_t srcHeight, size_t srcDepth, 
-    const float * weight, size_t kernelX, size_t kernelY, size_t padX, size_t padY, size_t strideX, size_t strideY, size_t dilationX, size_t dilationY, 
-    void * buffer, size_t * size, float * dst, size_t dstWidth, size_t dstHeight, size_t dstDepth, int add)
-{
-    simdNeuralConvolutionForward(src, srcWidth, srcHeight, srcDepth, weight, kernelX, kernelY, padX, padY, strideX, strideY, dilationX, dilationY, buffer, size, dst, dstWidth, dstHeight, dstDepth, add);
+        Base::P016ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, dither, yuvType, buffer);
 }
 
 SIMD_API void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
@@ -4196,42 +5995,293 @@ SIMD_API void SimdResizeBilinear(const uint8_t *src, size_t srcWidth, size_t src
         Neon::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
     else
 #endif
-        Base::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
+        Base::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
+}
+
+SIMD_API void SimdResizeBilinearRows(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+    uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount, float siteX, size_t dstRowBeg, size_t dstRowEnd)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && dstWidth >= Avx512bw::A)
+        Avx512bw::ResizeBilinearRows(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount, siteX, dstRowBeg, dstRowEnd);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && dstWidth >= Avx2::A)
+        Avx2::ResizeBilinearRows(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount, siteX, dstRowBeg, dstRowEnd);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && dstWidth >= Ssse3::A)
+        Ssse3::ResizeBilinearRows(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount, siteX, dstRowBeg, dstRowEnd);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && dstWidth >= Sse2::A)
+        Sse2::ResizeBilinearRows(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount, siteX, dstRowBeg, dstRowEnd);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if (Vmx::Enable && dstWidth >= Vmx::A)
+        Vmx::ResizeBilinearRows(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount, siteX, dstRowBeg, dstRowEnd);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && dstWidth >= Neon::A)
+        Neon::ResizeBilinearRows(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount, siteX, dstRowBeg, dstRowEnd);
+    else
+#endif
+        Base::ResizeBilinearRows(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount, siteX, dstRowBeg, dstRowEnd);
+}
+
+SIMD_API void * SimdResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+{
+#ifdef SIMD_AVX512F_ENABLE
+    if (Avx512f::Enable)
+        return Avx512f::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        return Avx2::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
+    else
+#endif
+#ifdef SIMD_AVX_ENABLE
+    if (Avx::Enable)
+        return Avx::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
+    else
+#endif
+#ifdef SIMD_SSE_ENABLE
+    if (Sse::Enable)
+        return Sse::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable)
+        return Neon::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
+    else
+#endif
+        return Base::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
+}
+
+SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+{
+    ((const Resizer*)resizer)->Run(src, srcStride, dst, dstStride);
+}
+
+SIMD_API void SimdRgbToGray(const uint8_t *rgb, size_t width, size_t height, size_t rgbStride, uint8_t *gray, size_t grayStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::RgbToGray(rgb, width, height, rgbStride, gray, grayStride);
+    else
+#endif
+#if defined(SIMD_AVX2_ENABLE) && !defined(SIMD_CLANG_AVX2_BGR_TO_BGRA_ERROR)
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::RgbToGray(rgb, width, height, rgbStride, gray, grayStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::A)
+        Ssse3::RgbToGray(rgb, width, height, rgbStride, gray, grayStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::RgbToGray(rgb, width, height, rgbStride, gray, grayStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::RgbToGray(rgb, width, height, rgbStride, gray, grayStride);
+    else
+#endif
+        Base::RgbToGray(rgb, width, height, rgbStride, gray, grayStride);
+}
+
+SIMD_API void SimdRgbToYuv420p(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::RgbToYuv420p(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::RgbToYuv420p(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::RgbToYuv420p(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::RgbToYuv420p(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+        Base::RgbToYuv420p(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride);
+}
+
+SIMD_API void SimdRgbToYuv422p(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::RgbToYuv422p(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::RgbToYuv422p(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::RgbToYuv422p(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::RgbToYuv422p(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+        Base::RgbToYuv422p(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride);
+}
+
+SIMD_API void SimdRgbToYuv444p(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::RgbToYuv444p(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::RgbToYuv444p(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::A)
+        Ssse3::RgbToYuv444p(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::RgbToYuv444p(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+        Base::RgbToYuv444p(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride);
+}
+
+SIMD_API void SimdRgbaToGray(const uint8_t *rgba, size_t width, size_t height, size_t rgbaStride, uint8_t *gray, size_t grayStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::RgbaToGray(rgba, width, height, rgbaStride, gray, grayStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::RgbaToGray(rgba, width, height, rgbaStride, gray, grayStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::RgbaToGray(rgba, width, height, rgbaStride, gray, grayStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::HA)
+        Neon::RgbaToGray(rgba, width, height, rgbaStride, gray, grayStride);
+    else
+#endif
+        Base::RgbaToGray(rgba, width, height, rgbaStride, gray, grayStride);
+}
+
+SIMD_API void SimdRgbaToYuv420p(const uint8_t * rgba, size_t width, size_t height, size_t rgbaStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::RgbaToYuv420p(rgba, width, height, rgbaStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::RgbaToYuv420p(rgba, width, height, rgbaStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::RgbaToYuv420p(rgba, width, height, rgbaStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::DA)
+        Sse2::RgbaToYuv420p(rgba, width, height, rgbaStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::RgbaToYuv420p(rgba, width, height, rgbaStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+        Base::RgbaToYuv420p(rgba, width, height, rgbaStride, y, yStride, u, uStride, v, vStride);
+}
+
+SIMD_API void SimdRgbaToYuv422p(const uint8_t * rgba, size_t width, size_t height, size_t rgbaStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::RgbaToYuv422p(rgba, width, height, rgbaStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::RgbaToYuv422p(rgba, width, height, rgbaStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::RgbaToYuv422p(rgba, width, height, rgbaStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::DA)
+        Sse2::RgbaToYuv422p(rgba, width, height, rgbaStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::RgbaToYuv422p(rgba, width, height, rgbaStride, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+        Base::RgbaToYuv422p(rgba, width, height, rgbaStride, y, yStride, u, uStride, v, vStride);
 }
 
-SIMD_API void * SimdResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+SIMD_API void SimdRgbaToYuv444p(const uint8_t * rgba, size_t width, size_t height, size_t rgbaStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
-#ifdef SIMD_AVX512F_ENABLE
-    if (Avx512f::Enable)
-        return Avx512f::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::RgbaToYuv444p(rgba, width, height, rgbaStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable)
-        return Avx2::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable)
-        return Avx::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::RgbaToYuv444p(rgba, width, height, rgbaStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
-#ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable)
-        return Sse::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::RgbaToYuv444p(rgba, width, height, rgbaStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable)
-        return Neon::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::RgbaToYuv444p(rgba, width, height, rgbaStride, y, yStride, u, uStride, v, vStride);
     else
 #endif
-        return Base::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
-}
-
-SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
-{
-    ((const Resizer*)resizer)->Run(src, srcStride, dst, dstStride);
+        Base::RgbaToYuv444p(rgba, width, height, rgbaStride, y, yStride, u, uStride, v, vStride);
 }
 
 SIMD_API void SimdSegmentationChangeIndex(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t oldIndex, uint8_t newIndex)
@@ -4294,6 +6344,27 @@ SIMD_API void SimdSegmentationFillSingleHoles(uint8_t * mask, size_t stride, siz
         Base::SegmentationFillSingleHoles(mask, stride, width, height, index);
 }
 
+SIMD_API size_t SimdSegmentationLabelComponents(const uint8_t * mask, size_t maskStride, size_t width, size_t height, SimdCompareType compareType, uint8_t value,
+    int connectivity, uint32_t * labels, size_t labelsStride, SimdConnectedComponent * components, size_t capacity)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        return Avx512bw::SegmentationLabelComponents(mask, maskStride, width, height, compareType, value, connectivity, labels, labelsStride, components, capacity);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        return Avx2::SegmentationLabelComponents(mask, maskStride, width, height, compareType, value, connectivity, labels, labelsStride, components, capacity);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::A)
+        return Sse2::SegmentationLabelComponents(mask, maskStride, width, height, compareType, value, connectivity, labels, labelsStride, components, capacity);
+    else
+#endif
+        return Base::SegmentationLabelComponents(mask, maskStride, width, height, compareType, value, connectivity, labels, labelsStride, components, capacity);
+}
+
 SIMD_API void SimdSegmentationPropagate2x2(const uint8_t * parent, size_t parentStride, size_t width, size_t height, 
                                            uint8_t * child, size_t childStride, const uint8_t * difference, size_t differenceStride, 
                                            uint8_t currentIndex, uint8_t invalidIndex, uint8_t emptyIndex, uint8_t differenceThreshold)
@@ -4775,886 +6846,1338 @@ SIMD_API void SimdGetStatistic(const uint8_t * src, size_t stride, size_t width,
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::GetStatistic(src, stride, width, height, min, max, average);
+        Avx512bw::GetStatistic(src, stride, width, height, min, max, average);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::GetStatistic(src, stride, width, height, min, max, average);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::GetStatistic(src, stride, width, height, min, max, average);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::A)
+        Vmx::GetStatistic(src, stride, width, height, min, max, average);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::GetStatistic(src, stride, width, height, min, max, average);
+    else
+#endif
+        Base::GetStatistic(src, stride, width, height, min, max, average);
+}
+
+SIMD_API void SimdGetMoments(const uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index,
+                uint64_t * area, uint64_t * x, uint64_t * y, uint64_t * xx, uint64_t * xy, uint64_t * yy)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width < SHRT_MAX && height < SHRT_MAX)
+        Avx512bw::GetMoments(mask, stride, width, height, index, area, x, y, xx, xy, yy);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A && width < SHRT_MAX && height < SHRT_MAX)
+        Avx2::GetMoments(mask, stride, width, height, index, area, x, y, xx, xy, yy);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A && width < SHRT_MAX && height < SHRT_MAX)
+        Sse2::GetMoments(mask, stride, width, height, index, area, x, y, xx, xy, yy);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::A && width < SHRT_MAX && height < SHRT_MAX)
+        Vmx::GetMoments(mask, stride, width, height, index, area, x, y, xx, xy, yy);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A && width < SHRT_MAX && height < SHRT_MAX)
+        Neon::GetMoments(mask, stride, width, height, index, area, x, y, xx, xy, yy);
+    else
+#endif
+        Base::GetMoments(mask, stride, width, height, index, area, x, y, xx, xy, yy);
+}
+
+SIMD_API void SimdGetRowSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::GetRowSums(src, stride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::GetRowSums(src, stride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::GetRowSums(src, stride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::A)
+        Vmx::GetRowSums(src, stride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::GetRowSums(src, stride, width, height, sums);
+    else
+#endif
+        Base::GetRowSums(src, stride, width, height, sums);
+}
+
+SIMD_API void SimdGetColSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::GetColSums(src, stride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::GetColSums(src, stride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::GetColSums(src, stride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::A)
+        Vmx::GetColSums(src, stride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::GetColSums(src, stride, width, height, sums);
+    else
+#endif
+        Base::GetColSums(src, stride, width, height, sums);
+}
+
+SIMD_API void SimdGetAbsDyRowSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::GetAbsDyRowSums(src, stride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::GetAbsDyRowSums(src, stride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::GetAbsDyRowSums(src, stride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::A)
+        Vmx::GetAbsDyRowSums(src, stride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::GetAbsDyRowSums(src, stride, width, height, sums);
+    else
+#endif
+        Base::GetAbsDyRowSums(src, stride, width, height, sums);
+}
+
+SIMD_API void SimdGetAbsDxColSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::GetAbsDxColSums(src, stride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::GetAbsDxColSums(src, stride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::GetAbsDxColSums(src, stride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::A)
+        Vmx::GetAbsDxColSums(src, stride, width, height, sums);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::GetAbsDxColSums(src, stride, width, height, sums);
+    else
+#endif
+        Base::GetAbsDxColSums(src, stride, width, height, sums);
+}
+
+SIMD_API void SimdValueSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::ValueSum(src, stride, width, height, sum);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::ValueSum(src, stride, width, height, sum);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::ValueSum(src, stride, width, height, sum);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::A)
+        Vmx::ValueSum(src, stride, width, height, sum);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::ValueSum(src, stride, width, height, sum);
+    else
+#endif
+        Base::ValueSum(src, stride, width, height, sum);
+}
+
+SIMD_API void SimdSquareSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::SquareSum(src, stride, width, height, sum);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width >= Avx2::A)
-        Avx2::GetStatistic(src, stride, width, height, min, max, average);
+        Avx2::SquareSum(src, stride, width, height, sum);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
     if(Sse2::Enable && width >= Sse2::A)
-        Sse2::GetStatistic(src, stride, width, height, min, max, average);
+        Sse2::SquareSum(src, stride, width, height, sum);
     else
 #endif
 #ifdef SIMD_VMX_ENABLE
     if(Vmx::Enable && width >= Vmx::A)
-        Vmx::GetStatistic(src, stride, width, height, min, max, average);
+        Vmx::SquareSum(src, stride, width, height, sum);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::GetStatistic(src, stride, width, height, min, max, average);
+        Neon::SquareSum(src, stride, width, height, sum);
     else
 #endif
-        Base::GetStatistic(src, stride, width, height, min, max, average);
+        Base::SquareSum(src, stride, width, height, sum);
 }
 
-SIMD_API void SimdGetMoments(const uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index,
-                uint64_t * area, uint64_t * x, uint64_t * y, uint64_t * xx, uint64_t * xy, uint64_t * yy)
+SIMD_API void SimdValueSquareSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * valueSum, uint64_t * squareSum)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width < SHRT_MAX && height < SHRT_MAX)
-        Avx512bw::GetMoments(mask, stride, width, height, index, area, x, y, xx, xy, yy);
+    if (Avx512bw::Enable)
+        Avx512bw::ValueSquareSum(src, stride, width, height, valueSum, squareSum);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A && width < SHRT_MAX && height < SHRT_MAX)
-        Avx2::GetMoments(mask, stride, width, height, index, area, x, y, xx, xy, yy);
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::ValueSquareSum(src, stride, width, height, valueSum, squareSum);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A && width < SHRT_MAX && height < SHRT_MAX)
-        Sse2::GetMoments(mask, stride, width, height, index, area, x, y, xx, xy, yy);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A && width < SHRT_MAX && height < SHRT_MAX)
-        Vmx::GetMoments(mask, stride, width, height, index, area, x, y, xx, xy, yy);
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::ValueSquareSum(src, stride, width, height, valueSum, squareSum);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A && width < SHRT_MAX && height < SHRT_MAX)
-        Neon::GetMoments(mask, stride, width, height, index, area, x, y, xx, xy, yy);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::ValueSquareSum(src, stride, width, height, valueSum, squareSum);
     else
 #endif
-        Base::GetMoments(mask, stride, width, height, index, area, x, y, xx, xy, yy);
+        Base::ValueSquareSum(src, stride, width, height, valueSum, squareSum);
 }
 
-SIMD_API void SimdGetRowSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums)
+SIMD_API void SimdCorrelationSum(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, uint64_t * sum)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::GetRowSums(src, stride, width, height, sums);
+        Avx512bw::CorrelationSum(a, aStride, b, bStride, width, height, sum);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width >= Avx2::A)
-        Avx2::GetRowSums(src, stride, width, height, sums);
+        Avx2::CorrelationSum(a, aStride, b, bStride, width, height, sum);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
     if(Sse2::Enable && width >= Sse2::A)
-        Sse2::GetRowSums(src, stride, width, height, sums);
+        Sse2::CorrelationSum(a, aStride, b, bStride, width, height, sum);
     else
 #endif
 #ifdef SIMD_VMX_ENABLE
     if(Vmx::Enable && width >= Vmx::A)
-        Vmx::GetRowSums(src, stride, width, height, sums);
+        Vmx::CorrelationSum(a, aStride, b, bStride, width, height, sum);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::GetRowSums(src, stride, width, height, sums);
+        Neon::CorrelationSum(a, aStride, b, bStride, width, height, sum);
     else
 #endif
-        Base::GetRowSums(src, stride, width, height, sums);
+        Base::CorrelationSum(a, aStride, b, bStride, width, height, sum);
 }
 
-SIMD_API void SimdGetColSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums)
+SIMD_API void SimdStretchGray2x2(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+                    uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::GetColSums(src, stride, width, height, sums);
+        Avx512bw::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::GetColSums(src, stride, width, height, sums);
+    if(Avx2::Enable && srcWidth >= Avx2::A)
+        Avx2::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::GetColSums(src, stride, width, height, sums);
+    if(Sse2::Enable && srcWidth >= Sse2::A)
+        Sse2::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
     else
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::GetColSums(src, stride, width, height, sums);
+    if(Vmx::Enable && srcWidth >= Vmx::A)
+        Vmx::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::GetColSums(src, stride, width, height, sums);
+    if (Neon::Enable && srcWidth >= Neon::A)
+        Neon::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
     else
 #endif
-        Base::GetColSums(src, stride, width, height, sums);
+        Base::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
 }
 
-SIMD_API void SimdGetAbsDyRowSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums)
+SIMD_API void SimdSvmSumLinear(const float * x, const float * svs, const float * weights, size_t length, size_t count, float * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::GetAbsDyRowSums(src, stride, width, height, sums);
+#ifdef SIMD_AVX512F_ENABLE
+    if (Avx512f::Enable)
+        Avx512f::SvmSumLinear(x, svs, weights, length, count, sum);
     else
 #endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::GetAbsDyRowSums(src, stride, width, height, sums);
+#ifdef SIMD_AVX_ENABLE
+    if(Avx::Enable)
+        Avx::SvmSumLinear(x, svs, weights, length, count, sum);
     else
 #endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::GetAbsDyRowSums(src, stride, width, height, sums);
+#ifdef SIMD_SSE_ENABLE
+    if(Sse::Enable)
+        Sse::SvmSumLinear(x, svs, weights, length, count, sum);
     else
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::GetAbsDyRowSums(src, stride, width, height, sums);
+#ifdef SIMD_VSX_ENABLE
+    if(Vsx::Enable)
+        Vsx::SvmSumLinear(x, svs, weights, length, count, sum);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::GetAbsDyRowSums(src, stride, width, height, sums);
+    if (Neon::Enable)
+        Neon::SvmSumLinear(x, svs, weights, length, count, sum);
     else
 #endif
-        Base::GetAbsDyRowSums(src, stride, width, height, sums);
+        Base::SvmSumLinear(x, svs, weights, length, count, sum);
 }
 
-SIMD_API void SimdGetAbsDxColSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums)
+SIMD_API void * SimdSvmInit(const float * svs, const float * weights, size_t length, size_t count, const float * bias, SimdSvmKernelType kernel, const float * params)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::GetAbsDxColSums(src, stride, width, height, sums);
+#ifdef SIMD_AVX512F_ENABLE
+    if (Avx512f::Enable)
+        return Avx512f::SvmInit(svs, weights, length, count, bias, kernel, params);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::GetAbsDxColSums(src, stride, width, height, sums);
+    if (Avx2::Enable)
+        return Avx2::SvmInit(svs, weights, length, count, bias, kernel, params);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::GetAbsDxColSums(src, stride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::GetAbsDxColSums(src, stride, width, height, sums);
+    if (Sse2::Enable)
+        return Sse2::SvmInit(svs, weights, length, count, bias, kernel, params);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::GetAbsDxColSums(src, stride, width, height, sums);
+    if (Neon::Enable)
+        return Neon::SvmInit(svs, weights, length, count, bias, kernel, params);
     else
 #endif
-        Base::GetAbsDxColSums(src, stride, width, height, sums);
+        return Base::SvmInit(svs, weights, length, count, bias, kernel, params);
 }
 
-SIMD_API void SimdValueSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
+SIMD_API void SimdSvmPredict(const void * svm, const float * samples, size_t number, float * decisions)
+{
+    ((const Svm*)svm)->Predict(samples, number, decisions);
+}
+
+typedef void(*SimdSynetAddBiasPtr) (const float * bias, size_t count, size_t size, float * dst, SimdBool trans);
+volatile SimdSynetAddBiasPtr simdSynetAddBias = SIMD_FUNC4(SynetAddBias, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdSynetAddBias(const float * bias, size_t count, size_t size, float * dst, SimdBool trans)
+{
+    simdSynetAddBias(bias, count, size, dst, trans);
+}
+
+typedef void(*SimdSynetDetectionDecode32fPtr) (const float * loc, const float * prior, size_t count, float * dst);
+volatile SimdSynetDetectionDecode32fPtr simdSynetDetectionDecode32f = SIMD_FUNC4(SynetDetectionDecode32f, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdSynetDetectionDecode32f(const float * loc, const float * prior, size_t count, float * dst)
+{
+    simdSynetDetectionDecode32f(loc, prior, count, dst);
+}
+
+typedef size_t(*SimdSynetDetectionNms32fPtr) (const float * boxes, const float * scores, size_t count, size_t classes, ptrdiff_t background, float scoreThreshold, 
+    float nmsThreshold, size_t topK, size_t keepTopK, SimdBool classAware, float * dst);
+volatile SimdSynetDetectionNms32fPtr simdSynetDetectionNms32f = SIMD_FUNC4(SynetDetectionNms32f, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API size_t SimdSynetDetectionNms32f(const float * boxes, const float * scores, size_t count, size_t classes, ptrdiff_t background, float scoreThreshold, 
+    float nmsThreshold, size_t topK, size_t keepTopK, SimdBool classAware, float * dst)
+{
+    return simdSynetDetectionNms32f(boxes, scores, count, classes, background, scoreThreshold, nmsThreshold, topK, keepTopK, classAware, dst);
+}
+
+typedef void(*SimdSynetEltwiseLayerForwardPtr) (float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst);
+volatile SimdSynetEltwiseLayerForwardPtr simdSynetEltwiseLayerForward = SIMD_FUNC5(SynetEltwiseLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdSynetEltwiseLayerForward(float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst)
+{
+    simdSynetEltwiseLayerForward(src, weight, count, size, type, dst);
+}
+
+typedef void(*SimdSynetFusedLayerForward0Ptr) (const float * src, const float * bias, const float * scale, size_t count, size_t size, float * dst, SimdBool trans);
+volatile SimdSynetFusedLayerForward0Ptr simdSynetFusedLayerForward0 = SIMD_FUNC4(SynetFusedLayerForward0, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdSynetFusedLayerForward0(const float * src, const float * bias, const float * scale, size_t count, size_t size, float * dst, SimdBool trans)
+{
+    simdSynetFusedLayerForward0(src, bias, scale, count, size, dst, trans);
+}
+
+typedef void(*SimdSynetFusedLayerForward1Ptr) (const float * src, const float * bias0, const float * scale1, const float * bias1, size_t count, size_t size, float * dst, SimdBool trans);
+volatile SimdSynetFusedLayerForward1Ptr simdSynetFusedLayerForward1 = SIMD_FUNC4(SynetFusedLayerForward1, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdSynetFusedLayerForward1(const float * src, const float * bias0, const float * scale1, const float * bias1, size_t count, size_t size, float * dst, SimdBool trans)
+{
+    simdSynetFusedLayerForward1(src, bias0, scale1, bias1, count, size, dst, trans);
+}
+
+typedef void(*SimdSynetFusedLayerForward2Ptr) (const float * src, const float * scale, const float * bias, size_t count, size_t size, const float * slope, float * dst, SimdBool trans);
+volatile SimdSynetFusedLayerForward2Ptr simdSynetFusedLayerForward2 = SIMD_FUNC4(SynetFusedLayerForward2, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdSynetFusedLayerForward2(const float * src, const float * scale, const float * bias, size_t count, size_t size, const float * slope, float * dst, SimdBool trans)
+{
+    simdSynetFusedLayerForward2(src, scale, bias, count, size, slope, dst, trans);
+}
+
+typedef void(*SimdSynetFusedLayerForward3Ptr) (const float * src, const float * bias, const float * scale, size_t count, size_t size, float * dst, SimdBool trans);
+volatile SimdSynetFusedLayerForward3Ptr simdSynetFusedLayerForward3 = SIMD_FUNC4(SynetFusedLayerForward3, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdSynetFusedLayerForward3(const float * src, const float * bias, const float * scale, size_t count, size_t size, float * dst, SimdBool trans)
+{
+    simdSynetFusedLayerForward3(src, bias, scale, count, size, dst, trans);
+}
+
+typedef void(*SimdSynetFusedLayerForward4Ptr) (const float * src, const float * bias0, const float * scale1, const float * bias1, size_t count, size_t size, float * dst, SimdBool trans);
+volatile SimdSynetFusedLayerForward4Ptr simdSynetFusedLayerForward4 = SIMD_FUNC4(SynetFusedLayerForward4, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdSynetFusedLayerForward4(const float * src, const float * bias0, const float * scale1, const float * bias1, size_t count, size_t size, float * dst, SimdBool trans)
+{
+    simdSynetFusedLayerForward4(src, bias0, scale1, bias1, count, size, dst, trans);
+}
+
+typedef void(*SimdSynetInnerProductLayerForwardPtr) (const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst);
+volatile SimdSynetInnerProductLayerForwardPtr simdSynetInnerProductLayerForward = SIMD_FUNC5(SynetInnerProductLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdSynetInnerProductLayerForward(const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst)
+{
+    simdSynetInnerProductLayerForward(src, weight, bias, count, size, dst);
+}
+
+typedef void(*SimdSynetLrnLayerCrossChannelsPtr) (const float * src, size_t half, size_t count, size_t size, const float * k, float * dst);
+volatile SimdSynetLrnLayerCrossChannelsPtr simdSynetLrnLayerCrossChannels = SIMD_FUNC4(SynetLrnLayerCrossChannels, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdSynetLrnLayerCrossChannels(const float * src, size_t half, size_t count, size_t size, const float * k, float * dst)
+{
+    simdSynetLrnLayerCrossChannels(src, half, count, size, k, dst);
+}
+
+typedef void(*SimdSynetPoolingForwardPtr) (const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+    size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdBool trans);
+
+volatile SimdSynetPoolingForwardPtr simdSynetPoolingForwardMax = SIMD_FUNC5(SynetPoolingForwardMax, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdSynetPoolingForwardMax(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+    size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdBool trans)
+{
+    simdSynetPoolingForwardMax(src, srcC, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, dst, dstH, dstW, trans);
+}
+
+typedef void(*SimdSynetPreluLayerForwardPtr) (const float * src, const float * slope, size_t count, size_t size, float * dst, SimdBool trans);
+volatile SimdSynetPreluLayerForwardPtr simdSynetPreluLayerForward = SIMD_FUNC4(SynetPreluLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdSynetPreluLayerForward(const float * src, const float * slope, size_t count, size_t size, float * dst, SimdBool trans)
+{
+    simdSynetPreluLayerForward(src, slope, count, size, dst, trans);
+}
+
+typedef void(*SimdSynetRestrictRangePtr) (const float * src, size_t size, const float * lower, const float * upper, float * dst);
+volatile SimdSynetRestrictRangePtr simdSynetRestrictRange = SIMD_FUNC4(SynetRestrictRange, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdSynetRestrictRange(const float * src, size_t size, const float * lower, const float * upper, float * dst)
+{
+    simdSynetRestrictRange(src, size, lower, upper, dst);
+}
+
+typedef void(*SimdSynetScaleLayerForwardPtr) (const float * src, const float * scale, const float * bias, size_t count, size_t size, float * dst, SimdBool trans);
+volatile SimdSynetScaleLayerForwardPtr simdSynetScaleLayerForward = SIMD_FUNC5(SynetScaleLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdSynetScaleLayerForward(const float * src, const float * scale, const float * bias, size_t count, size_t size, float * dst, SimdBool trans)
+{
+    simdSynetScaleLayerForward(src, scale, bias, count, size, dst, trans);
+}
+
+typedef void(*SimdSynetSoftmaxLayerForwardPtr) (const float * src, size_t outer, size_t count, size_t inner, float * dst);
+volatile SimdSynetSoftmaxLayerForwardPtr simdSynetSoftmaxLayerForward = SIMD_FUNC4(SynetSoftmaxLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+
+SIMD_API void SimdSynetSoftmaxLayerForward(const float * src, size_t outer, size_t count, size_t inner, float * dst)
+{
+    simdSynetSoftmaxLayerForward(src, outer, count, inner, dst);
+}
+
+SIMD_API void SimdTextureBoostedSaturatedGradient(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+                                     uint8_t saturation, uint8_t boost, uint8_t * dx, size_t dxStride, uint8_t * dy, size_t dyStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::ValueSum(src, stride, width, height, sum);
+        Avx512bw::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width >= Avx2::A)
-        Avx2::ValueSum(src, stride, width, height, sum);
+        Avx2::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::A)
+        Ssse3::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
     if(Sse2::Enable && width >= Sse2::A)
-        Sse2::ValueSum(src, stride, width, height, sum);
+        Sse2::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
     else
 #endif
 #ifdef SIMD_VMX_ENABLE
     if(Vmx::Enable && width >= Vmx::A)
-        Vmx::ValueSum(src, stride, width, height, sum);
+        Vmx::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::ValueSum(src, stride, width, height, sum);
+        Neon::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
     else
 #endif
-        Base::ValueSum(src, stride, width, height, sum);
+        Base::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
 }
 
-SIMD_API void SimdSquareSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
+SIMD_API void SimdTextureBoostedUv(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+                      uint8_t boost, uint8_t * dst, size_t dstStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::SquareSum(src, stride, width, height, sum);
+        Avx512bw::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width >= Avx2::A)
-        Avx2::SquareSum(src, stride, width, height, sum);
+        Avx2::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
     if(Sse2::Enable && width >= Sse2::A)
-        Sse2::SquareSum(src, stride, width, height, sum);
+        Sse2::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
     else
 #endif
 #ifdef SIMD_VMX_ENABLE
     if(Vmx::Enable && width >= Vmx::A)
-        Vmx::SquareSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::SquareSum(src, stride, width, height, sum);
-    else
-#endif
-        Base::SquareSum(src, stride, width, height, sum);
-}
-
-SIMD_API void SimdValueSquareSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * valueSum, uint64_t * squareSum)
-{
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::ValueSquareSum(src, stride, width, height, valueSum, squareSum);
-    else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::ValueSquareSum(src, stride, width, height, valueSum, squareSum);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::ValueSquareSum(src, stride, width, height, valueSum, squareSum);
+        Vmx::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::ValueSquareSum(src, stride, width, height, valueSum, squareSum);
+        Neon::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
     else
 #endif
-        Base::ValueSquareSum(src, stride, width, height, valueSum, squareSum);
+        Base::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
 }
 
-SIMD_API void SimdCorrelationSum(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, uint64_t * sum)
+SIMD_API void SimdTextureGetDifferenceSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+                             const uint8_t * lo, size_t loStride, const uint8_t * hi, size_t hiStride, int64_t * sum)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::CorrelationSum(a, aStride, b, bStride, width, height, sum);
+        Avx512bw::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width >= Avx2::A)
-        Avx2::CorrelationSum(a, aStride, b, bStride, width, height, sum);
+        Avx2::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
     if(Sse2::Enable && width >= Sse2::A)
-        Sse2::CorrelationSum(a, aStride, b, bStride, width, height, sum);
+        Sse2::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
     else
 #endif
 #ifdef SIMD_VMX_ENABLE
     if(Vmx::Enable && width >= Vmx::A)
-        Vmx::CorrelationSum(a, aStride, b, bStride, width, height, sum);
+        Vmx::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::CorrelationSum(a, aStride, b, bStride, width, height, sum);
+        Neon::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
     else
 #endif
-        Base::CorrelationSum(a, aStride, b, bStride, width, height, sum);
+        Base::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
 }
 
-SIMD_API void SimdStretchGray2x2(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
-                    uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
+SIMD_API void SimdTexturePerformCompensation(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+    int32_t shift, uint8_t * dst, size_t dstStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+        Avx512bw::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && srcWidth >= Avx2::A)
-        Avx2::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && srcWidth >= Sse2::A)
-        Sse2::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
     else
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && srcWidth >= Vmx::A)
-        Vmx::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+    if (Vmx::Enable && width >= Vmx::A)
+        Vmx::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && srcWidth >= Neon::A)
-        Neon::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
     else
 #endif
-        Base::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+        Base::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
 }
 
-SIMD_API void SimdSvmSumLinear(const float * x, const float * svs, const float * weights, size_t length, size_t count, float * sum)
+SIMD_API void SimdTransformImage(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, SimdTransformType transform, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512F_ENABLE
-    if (Avx512f::Enable)
-        Avx512f::SvmSumLinear(x, svs, weights, length, count, sum);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if(Avx::Enable)
-        Avx::SvmSumLinear(x, svs, weights, length, count, sum);
-    else
-#endif
-#ifdef SIMD_SSE_ENABLE
-    if(Sse::Enable)
-        Sse::SvmSumLinear(x, svs, weights, length, count, sum);
-    else
-#endif
-#ifdef SIMD_VSX_ENABLE
-    if(Vsx::Enable)
-        Vsx::SvmSumLinear(x, svs, weights, length, count, sum);
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::A)
+        Ssse3::TransformImage(src, srcStride, width, height, pixelSize, transform, dst, dstStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable)
-        Neon::SvmSumLinear(x, svs, weights, length, count, sum);
+    if (Neon::Enable && width >= Neon::HA)
+        Neon::TransformImage(src, srcStride, width, height, pixelSize, transform, dst, dstStride);
     else
 #endif
-        Base::SvmSumLinear(x, svs, weights, length, count, sum);
-}
-
-typedef void(*SimdSynetAddBiasPtr) (const float * bias, size_t count, size_t size, float * dst, SimdBool trans);
-volatile SimdSynetAddBiasPtr simdSynetAddBias = SIMD_FUNC4(SynetAddBias, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdSynetAddBias(const float * bias, size_t count, size_t size, float * dst, SimdBool trans)
-{
-    simdSynetAddBias(bias, count, size, dst, trans);
-}
-
-typedef void(*SimdSynetEltwiseLayerForwardPtr) (float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst);
-volatile SimdSynetEltwiseLayerForwardPtr simdSynetEltwiseLayerForward = SIMD_FUNC5(SynetEltwiseLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdSynetEltwiseLayerForward(float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst)
-{
-    simdSynetEltwiseLayerForward(src, weight, count, size, type, dst);
+        Base::TransformImage(src, srcStride, width, height, pixelSize, transform, dst, dstStride);
 }
 
-typedef void(*SimdSynetFusedLayerForward0Ptr) (const float * src, const float * bias, const float * scale, size_t count, size_t size, float * dst, SimdBool trans);
-volatile SimdSynetFusedLayerForward0Ptr simdSynetFusedLayerForward0 = SIMD_FUNC4(SynetFusedLayerForward0, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdSynetFusedLayerForward0(const float * src, const float * bias, const float * scale, size_t count, size_t size, float * dst, SimdBool trans)
-{
-    simdSynetFusedLayerForward0(src, bias, scale, count, size, dst, trans);
-}
+typedef void(*SimdWinogradSetFilterPtr) (const float * src, size_t size, float * dst, SimdBool trans);
+typedef void(*SimdWinogradSetInputPtr) (const float * src, size_t srcChannels, size_t srcHeight, size_t srcWidth, float * dst, size_t dstStride, SimdBool pad, SimdBool trans);
+typedef void(*SimdWinogradSetOutputPtr) (const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
 
-typedef void(*SimdSynetFusedLayerForward1Ptr) (const float * src, const float * bias0, const float * scale1, const float * bias1, size_t count, size_t size, float * dst, SimdBool trans);
-volatile SimdSynetFusedLayerForward1Ptr simdSynetFusedLayerForward1 = SIMD_FUNC4(SynetFusedLayerForward1, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+volatile SimdWinogradSetFilterPtr simdWinograd2x3SetFilter = SIMD_FUNC4(Winograd2x3SetFilter, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
-SIMD_API void SimdSynetFusedLayerForward1(const float * src, const float * bias0, const float * scale1, const float * bias1, size_t count, size_t size, float * dst, SimdBool trans)
+SIMD_API void SimdWinograd2x3SetFilter(const float * src, size_t size, float * dst, SimdBool trans)
 {
-    simdSynetFusedLayerForward1(src, bias0, scale1, bias1, count, size, dst, trans);
+    simdWinograd2x3SetFilter(src, size, dst, trans);
 }
 
-typedef void(*SimdSynetFusedLayerForward2Ptr) (const float * src, const float * scale, const float * bias, size_t count, size_t size, const float * slope, float * dst, SimdBool trans);
-volatile SimdSynetFusedLayerForward2Ptr simdSynetFusedLayerForward2 = SIMD_FUNC4(SynetFusedLayerForward2, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+volatile SimdWinogradSetInputPtr simdWinograd2x3SetInput = SIMD_FUNC4(Winograd2x3SetInput, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
-SIMD_API void SimdSynetFusedLayerForward2(const float * src, const float * scale, const float * bias, size_t count, size_t size, const float * slope, float * dst, SimdBool trans)
+SIMD_API void SimdWinograd2x3SetInput(const float * src, size_t srcChannels, size_t srcHeight, size_t srcWidth, float * dst, size_t dstStride, SimdBool pad, SimdBool trans)
 {
-    simdSynetFusedLayerForward2(src, scale, bias, count, size, slope, dst, trans);
+    simdWinograd2x3SetInput(src, srcChannels, srcHeight, srcWidth, dst, dstStride, pad, trans);
 }
 
-typedef void(*SimdSynetFusedLayerForward3Ptr) (const float * src, const float * bias, const float * scale, size_t count, size_t size, float * dst, SimdBool trans);
-volatile SimdSynetFusedLayerForward3Ptr simdSynetFusedLayerForward3 = SIMD_FUNC4(SynetFusedLayerForward3, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+volatile SimdWinogradSetOutputPtr simdWinograd2x3SetOutput = SIMD_FUNC4(Winograd2x3SetOutput, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
-SIMD_API void SimdSynetFusedLayerForward3(const float * src, const float * bias, const float * scale, size_t count, size_t size, float * dst, SimdBool trans)
+SIMD_API void SimdWinograd2x3SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans)
 {
-    simdSynetFusedLayerForward3(src, bias, scale, count, size, dst, trans);
+    simdWinograd2x3SetOutput(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
 }
 
-typedef void(*SimdSynetFusedLayerForward4Ptr) (const float * src, const float * bias0, const float * scale1, const float * bias1, size_t count, size_t size, float * dst, SimdBool trans);
-volatile SimdSynetFusedLayerForward4Ptr simdSynetFusedLayerForward4 = SIMD_FUNC4(SynetFusedLayerForward4, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+volatile SimdWinogradSetFilterPtr simdWinograd4x3SetFilter = SIMD_FUNC4(Winograd4x3SetFilter, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
-SIMD_API void SimdSynetFusedLayerForward4(const float * src, const float * bias0, const float * scale1, const float * bias1, size_t count, size_t size, float * dst, SimdBool trans)
+SIMD_API void SimdWinograd4x3SetFilter(const float * src, size_t size, float * dst, SimdBool trans)
 {
-    simdSynetFusedLayerForward4(src, bias0, scale1, bias1, count, size, dst, trans);
+    simdWinograd4x3SetFilter(src, size, dst, trans);
 }
 
-typedef void(*SimdSynetInnerProductLayerForwardPtr) (const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst);
-volatile SimdSynetInnerProductLayerForwardPtr simdSynetInnerProductLayerForward = SIMD_FUNC5(SynetInnerProductLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+volatile SimdWinogradSetInputPtr simdWinograd4x3SetInput = SIMD_FUNC4(Winograd4x3SetInput, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
-SIMD_API void SimdSynetInnerProductLayerForward(const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst)
+SIMD_API void SimdWinograd4x3SetInput(const float * src, size_t srcChannels, size_t srcHeight, size_t srcWidth, float * dst, size_t dstStride, SimdBool pad, SimdBool trans)
 {
-    simdSynetInnerProductLayerForward(src, weight, bias, count, size, dst);
+    simdWinograd4x3SetInput(src, srcChannels, srcHeight, srcWidth, dst, dstStride, pad, trans);
 }
 
-typedef void(*SimdSynetLrnLayerCrossChannelsPtr) (const float * src, size_t half, size_t count, size_t size, const float * k, float * dst);
-volatile SimdSynetLrnLayerCrossChannelsPtr simdSynetLrnLayerCrossChannels = SIMD_FUNC4(SynetLrnLayerCrossChannels, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
+volatile SimdWinogradSetOutputPtr simdWinograd4x3SetOutput = SIMD_FUNC4(Winograd4x3SetOutput, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
-SIMD_API void SimdSynetLrnLayerCrossChannels(const float * src, size_t half, size_t count, size_t size, const float * k, float * dst)
+SIMD_API void SimdWinograd4x3SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans)
 {
-    simdSynetLrnLayerCrossChannels(src, half, count, size, k, dst);
+    simdWinograd4x3SetOutput(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
 }
 
-typedef void(*SimdSynetPoolingForwardPtr) (const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
-    size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdBool trans);
-
-volatile SimdSynetPoolingForwardPtr simdSynetPoolingForwardMax = SIMD_FUNC5(SynetPoolingForwardMax, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdSynetPoolingForwardMax(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
-    size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdBool trans)
+SIMD_API void SimdYuva420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+    const uint8_t * a, size_t aStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride)
 {
-    simdSynetPoolingForwardMax(src, srcC, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, dst, dstH, dstW, trans);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuva420pToBgra(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuva420pToBgra(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::Yuva420pToBgra(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Yuva420pToBgra(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
+    else
+#endif
+        Base::Yuva420pToBgra(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
 }
 
-typedef void(*SimdSynetPreluLayerForwardPtr) (const float * src, const float * slope, size_t count, size_t size, float * dst, SimdBool trans);
-volatile SimdSynetPreluLayerForwardPtr simdSynetPreluLayerForward = SIMD_FUNC4(SynetPreluLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdSynetPreluLayerForward(const float * src, const float * slope, size_t count, size_t size, float * dst, SimdBool trans)
+SIMD_API void SimdYuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                 size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
-    simdSynetPreluLayerForward(src, slope, count, size, dst, trans);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::DA)
+        Vmx::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+    else
+#endif
+        Base::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
 }
 
-typedef void(*SimdSynetRestrictRangePtr) (const float * src, size_t size, const float * lower, const float * upper, float * dst);
-volatile SimdSynetRestrictRangePtr simdSynetRestrictRange = SIMD_FUNC4(SynetRestrictRange, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdSynetRestrictRange(const float * src, size_t size, const float * lower, const float * upper, float * dst)
+SIMD_API void SimdYuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                 size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
 {
-    simdSynetRestrictRange(src, size, lower, upper, dst);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv420pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv420pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Yuv420pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Yuv420pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::Yuv420pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
 }
 
-typedef void(*SimdSynetScaleLayerForwardPtr) (const float * src, const float * scale, const float * bias, size_t count, size_t size, float * dst, SimdBool trans);
-volatile SimdSynetScaleLayerForwardPtr simdSynetScaleLayerForward = SIMD_FUNC5(SynetScaleLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdSynetScaleLayerForward(const float * src, const float * scale, const float * bias, size_t count, size_t size, float * dst, SimdBool trans)
+SIMD_API void SimdYuv420pToRgb(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                 size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
 {
-    simdSynetScaleLayerForward(src, scale, bias, count, size, dst, trans);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv420pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv420pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Yuv420pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Yuv420pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+    else
+#endif
+        Base::Yuv420pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
 }
 
-typedef void(*SimdSynetSoftmaxLayerForwardPtr) (const float * src, size_t outer, size_t count, size_t inner, float * dst);
-volatile SimdSynetSoftmaxLayerForwardPtr simdSynetSoftmaxLayerForward = SIMD_FUNC4(SynetSoftmaxLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdSynetSoftmaxLayerForward(const float * src, size_t outer, size_t count, size_t inner, float * dst)
+SIMD_API void SimdYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                 size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
-    simdSynetSoftmaxLayerForward(src, outer, count, inner, dst);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::DA)
+        Vmx::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+    else
+#endif
+        Base::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
 }
 
-SIMD_API void SimdTextureBoostedSaturatedGradient(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-                                     uint8_t saturation, uint8_t boost, uint8_t * dx, size_t dxStride, uint8_t * dy, size_t dyStride)
+SIMD_API void SimdYuv422pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                 size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
+        Avx512bw::Yuv422pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv422pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
     else
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Yuv422pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
     else
 #endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Yuv422pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
     else
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
+        Base::Yuv422pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdYuv422pToRgb(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                 size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv422pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv422pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Yuv422pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Yuv422pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
     else
 #endif
-        Base::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
+        Base::Yuv422pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
 }
 
-SIMD_API void SimdTextureBoostedUv(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-                      uint8_t boost, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                               size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
+        Avx512bw::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width >= Avx2::A)
-        Avx2::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
+        Avx2::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
     else
 #endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::A)
+        Ssse3::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
     else
 #endif
 #ifdef SIMD_VMX_ENABLE
     if(Vmx::Enable && width >= Vmx::A)
-        Vmx::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
+        Vmx::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
+        Neon::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
     else
 #endif
-        Base::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
+        Base::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
 }
 
-SIMD_API void SimdTextureGetDifferenceSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-                             const uint8_t * lo, size_t loStride, const uint8_t * hi, size_t hiStride, int64_t * sum)
+SIMD_API void SimdYuv444pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                               size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
+        Avx512bw::Yuv444pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width >= Avx2::A)
-        Avx2::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
+        Avx2::Yuv444pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
     else
 #endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::A)
+        Ssse3::Yuv444pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
     else
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::Yuv444pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::Yuv444pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdYuv444pToRgb(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                               size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv444pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv444pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::A)
+        Ssse3::Yuv444pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
+        Neon::Yuv444pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
     else
 #endif
-        Base::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
+        Base::Yuv444pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
 }
 
-SIMD_API void SimdTexturePerformCompensation(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-    int32_t shift, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdYuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                  size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
+        Avx512bw::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
+    if(Sse2::Enable && width >= Sse2::DA)
+        Sse2::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
     else
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if (Vmx::Enable && width >= Vmx::A)
-        Vmx::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
+    if(Vmx::Enable && width >= Vmx::DA)
+        Vmx::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
     else
 #endif
-        Base::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
+        Base::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
 }
 
-SIMD_API void SimdTransformImage(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, SimdTransformType transform, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdYuv420pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                  size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
 {
-#ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::TransformImage(src, srcStride, width, height, pixelSize, transform, dst, dstStride);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv420pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv420pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::DA)
+        Sse2::Yuv420pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::HA)
-        Neon::TransformImage(src, srcStride, width, height, pixelSize, transform, dst, dstStride);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Yuv420pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
     else
 #endif
-        Base::TransformImage(src, srcStride, width, height, pixelSize, transform, dst, dstStride);
-}
-
-typedef void(*SimdWinogradSetFilterPtr) (const float * src, size_t size, float * dst, SimdBool trans);
-typedef void(*SimdWinogradSetInputPtr) (const float * src, size_t srcChannels, size_t srcHeight, size_t srcWidth, float * dst, size_t dstStride, SimdBool pad, SimdBool trans);
-typedef void(*SimdWinogradSetOutputPtr) (const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
-
-volatile SimdWinogradSetFilterPtr simdWinograd2x3SetFilter = SIMD_FUNC4(Winograd2x3SetFilter, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdWinograd2x3SetFilter(const float * src, size_t size, float * dst, SimdBool trans)
-{
-    simdWinograd2x3SetFilter(src, size, dst, trans);
-}
-
-volatile SimdWinogradSetInputPtr simdWinograd2x3SetInput = SIMD_FUNC4(Winograd2x3SetInput, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdWinograd2x3SetInput(const float * src, size_t srcChannels, size_t srcHeight, size_t srcWidth, float * dst, size_t dstStride, SimdBool pad, SimdBool trans)
-{
-    simdWinograd2x3SetInput(src, srcChannels, srcHeight, srcWidth, dst, dstStride, pad, trans);
-}
-
-volatile SimdWinogradSetOutputPtr simdWinograd2x3SetOutput = SIMD_FUNC4(Winograd2x3SetOutput, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdWinograd2x3SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans)
-{
-    simdWinograd2x3SetOutput(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
-}
-
-volatile SimdWinogradSetFilterPtr simdWinograd4x3SetFilter = SIMD_FUNC4(Winograd4x3SetFilter, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdWinograd4x3SetFilter(const float * src, size_t size, float * dst, SimdBool trans)
-{
-    simdWinograd4x3SetFilter(src, size, dst, trans);
-}
-
-volatile SimdWinogradSetInputPtr simdWinograd4x3SetInput = SIMD_FUNC4(Winograd4x3SetInput, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdWinograd4x3SetInput(const float * src, size_t srcChannels, size_t srcHeight, size_t srcWidth, float * dst, size_t dstStride, SimdBool pad, SimdBool trans)
-{
-    simdWinograd4x3SetInput(src, srcChannels, srcHeight, srcWidth, dst, dstStride, pad, trans);
-}
-
-volatile SimdWinogradSetOutputPtr simdWinograd4x3SetOutput = SIMD_FUNC4(Winograd4x3SetOutput, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
-
-SIMD_API void SimdWinograd4x3SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans)
-{
-    simdWinograd4x3SetOutput(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
+        Base::Yuv420pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
 }
 
-SIMD_API void SimdYuva420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
-    const uint8_t * a, size_t aStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride)
+SIMD_API void SimdYuv420pToRgba(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                  size_t width, size_t height, uint8_t * rgba, size_t rgbaStride, uint8_t alpha)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::Yuva420pToBgra(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
+        Avx512bw::Yuv420pToRgba(y, yStride, u, uStride, v, vStride, width, height, rgba, rgbaStride, alpha);
     else
 #endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::DA)
-        Avx2::Yuva420pToBgra(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv420pToRgba(y, yStride, u, uStride, v, vStride, width, height, rgba, rgbaStride, alpha);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::DA)
-        Sse2::Yuva420pToBgra(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
+    if(Sse2::Enable && width >= Sse2::DA)
+        Sse2::Yuv420pToRgba(y, yStride, u, uStride, v, vStride, width, height, rgba, rgbaStride, alpha);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::DA)
-        Neon::Yuva420pToBgra(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
+        Neon::Yuv420pToRgba(y, yStride, u, uStride, v, vStride, width, height, rgba, rgbaStride, alpha);
     else
 #endif
-        Base::Yuva420pToBgra(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
+        Base::Yuv420pToRgba(y, yStride, u, uStride, v, vStride, width, height, rgba, rgbaStride, alpha);
 }
 
-SIMD_API void SimdYuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
-                 size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+SIMD_API void SimdYuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                                size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        Avx512bw::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        Avx2::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
     else
 #endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::DA)
-        Ssse3::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::DA)
+        Sse2::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
     else
 #endif
 #ifdef SIMD_VMX_ENABLE
     if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        Vmx::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::DA)
-        Neon::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        Neon::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
     else
 #endif
-        Base::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        Base::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
 }
 
-SIMD_API void SimdYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
-                 size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+SIMD_API void SimdYuv422pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                                size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        Avx512bw::Yuv422pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::DA)
-        Ssse3::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        Avx2::Yuv422pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
     else
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::DA)
+        Sse2::Yuv422pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::DA)
-        Neon::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        Neon::Yuv422pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
     else
 #endif
-        Base::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        Base::Yuv422pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
 }
 
-SIMD_API void SimdYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
-                               size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+SIMD_API void SimdYuv422pToRgba(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                                size_t width, size_t height, uint8_t * rgba, size_t rgbaStride, uint8_t alpha)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        Avx512bw::Yuv422pToRgba(y, yStride, u, uStride, v, vStride, width, height, rgba, rgbaStride, alpha);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv422pToRgba(y, yStride, u, uStride, v, vStride, width, height, rgba, rgbaStride, alpha);
     else
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::DA)
+        Sse2::Yuv422pToRgba(y, yStride, u, uStride, v, vStride, width, height, rgba, rgbaStride, alpha);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Yuv422pToRgba(y, yStride, u, uStride, v, vStride, width, height, rgba, rgbaStride, alpha);
     else
 #endif
-        Base::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        Base::Yuv422pToRgba(y, yStride, u, uStride, v, vStride, width, height, rgba, rgbaStride, alpha);
 }
 
-SIMD_API void SimdYuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+SIMD_API void SimdYuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                   size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        Avx512bw::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::DA)
-        Sse2::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
     else
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+    if(Vmx::Enable && width >= Vmx::A)
+        Vmx::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
     else
 #endif
-        Base::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        Base::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
 }
 
-SIMD_API void SimdYuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
-                                size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+SIMD_API void SimdYuv444pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                  size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        Avx512bw::Yuv444pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv444pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::DA)
-        Sse2::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::Yuv444pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DA)
-        Neon::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+    if (Neon::Enable && width >= Neon::A)
+        Neon::Yuv444pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
     else
 #endif
-        Base::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        Base::Yuv444pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
 }
 
-SIMD_API void SimdYuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
-                  size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+SIMD_API void SimdYuv444pToRgba(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                  size_t width, size_t height, uint8_t * rgba, size_t rgbaStride, uint8_t alpha)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        Avx512bw::Yuv444pToRgba(y, yStride, u, uStride, v, vStride, width, height, rgba, rgbaStride, alpha);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width >= Avx2::A)
-        Avx2::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        Avx2::Yuv444pToRgba(y, yStride, u, uStride, v, vStride, width, height, rgba, rgbaStride, alpha);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
     if(Sse2::Enable && width >= Sse2::A)
-        Sse2::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        Sse2::Yuv444pToRgba(y, yStride, u, uStride, v, vStride, width, height, rgba, rgbaStride, alpha);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
     if (Neon::Enable && width >= Neon::A)
-        Neon::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        Neon::Yuv444pToRgba(y, yStride, u, uStride, v, vStride, width, height, rgba, rgbaStride, alpha);
     else
 #endif
-        Base::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        Base::Yuv444pToRgba(y, yStride, u, uStride, v, vStride, width, height, rgba, rgbaStride, alpha);
 }
 
 SIMD_API void SimdYuv444pToHsl(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                                size_t width, size_t height, uint8_t * hsl, size_t hslStride)
 {
-    Base::Yuv444pToHsl(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::Yuv444pToHsl(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv444pToHsl(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::Yuv444pToHsl(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::Yuv444pToHsl(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride);
+    else
+#endif
+        Base::Yuv444pToHsl(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride);
+}
+
+SIMD_API void SimdYuv444pToHslV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                               size_t width, size_t height, uint8_t * hsl, size_t hslStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::Yuv444pToHslV2(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv444pToHslV2(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::Yuv444pToHslV2(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::Yuv444pToHslV2(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride, yuvType);
+    else
+#endif
+        Base::Yuv444pToHslV2(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride, yuvType);
 }
 
 SIMD_API void SimdYuv444pToHsv(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                                size_t width, size_t height, uint8_t * hsv, size_t hsvStride)
 {
-    Base::Yuv444pToHsv(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::Yuv444pToHsv(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv444pToHsv(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::Yuv444pToHsv(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::Yuv444pToHsv(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride);
+    else
+#endif
+        Base::Yuv444pToHsv(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride);
+}
+
+SIMD_API void SimdYuv444pToHsvV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                               size_t width, size_t height, uint8_t * hsv, size_t hsvStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::Yuv444pToHsvV2(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv444pToHsvV2(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::Yuv444pToHsvV2(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::Yuv444pToHsvV2(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride, yuvType);
+    else
+#endif
+        Base::Yuv444pToHsvV2(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride, yuvType);
 }
 
 SIMD_API void SimdYuv420pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
@@ -5688,6 +8211,32 @@ SIMD_API void SimdYuv420pToHue(const uint8_t * y, size_t yStride, const uint8_t
         Base::Yuv420pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
 }
 
+SIMD_API void SimdYuv420pToHueV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                 size_t width, size_t height, uint8_t * hue, size_t hueStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv420pToHueV2(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv420pToHueV2(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::DA)
+        Sse2::Yuv420pToHueV2(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Yuv420pToHueV2(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride, yuvType);
+    else
+#endif
+        Base::Yuv420pToHueV2(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride, yuvType);
+}
+
 SIMD_API void SimdYuv444pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                  size_t width, size_t height, uint8_t * hue, size_t hueStride)
 {
@@ -5719,5 +8268,83 @@ SIMD_API void SimdYuv444pToHue(const uint8_t * y, size_t yStride, const uint8_t
         Base::Yuv444pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
 }
 
+SIMD_API void SimdYuv444pToHueV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                 size_t width, size_t height, uint8_t * hue, size_t hueStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv444pToHueV2(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv444pToHueV2(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::Yuv444pToHueV2(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::Yuv444pToHueV2(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride, yuvType);
+    else
+#endif
+        Base::Yuv444pToHueV2(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride, yuvType);
+}
+
+SIMD_API size_t SimdYuv16BufferSize(size_t width)
+{
+    return Base::Yuv16BufferSize(width, Simd::ALIGNMENT);
+}
+
+SIMD_API void SimdYuv420p16ToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+    size_t width, size_t height, size_t bitDepth, uint8_t * bgr, size_t bgrStride, SimdBool dither, SimdYuvType yuvType, uint8_t * buffer)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv420p16ToBgr(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgr, bgrStride, dither, yuvType, buffer);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv420p16ToBgr(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgr, bgrStride, dither, yuvType, buffer);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Yuv420p16ToBgr(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgr, bgrStride, dither, yuvType, buffer);
+    else
+#endif
+        Base::Yuv420p16ToBgr(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgr, bgrStride, dither, yuvType, buffer);
+}
+
+SIMD_API void SimdYuv420p16ToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+    size_t width, size_t height, size_t bitDepth, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdBool dither, SimdYuvType yuvType, uint8_t * buffer)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv420p16ToBgra(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgra, bgraStride, alpha, dither, yuvType, buffer);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv420p16ToBgra(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgra, bgraStride, alpha, dither, yuvType, buffer);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::Yuv420p16ToBgra(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgra, bgraStride, alpha, dither, yuvType, buffer);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Yuv420p16ToBgra(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgra, bgraStride, alpha, dither, yuvType, buffer);
+    else
+#endif
+        Base::Yuv420p16ToBgra(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgra, bgraStride, alpha, dither, yuvType, buffer);
+}
+
 
 
@@ -116,6 +116,20 @@ typedef enum
     SimdCompareLesserOrEqual,
 } SimdCompareType;
 
+/*! @ingroup c_types
+    Describes steps of background model update performed by functions ::SimdBackgroundUpdate, ::SimdBackgroundPackedUpdate and ::SimdEdgeBackgroundPackedUpdate.
+    The flags can be combined with bitwise OR.
+*/
+typedef enum
+{
+    /*! Fast growing of background range (see ::SimdBackgroundGrowRangeFast). */
+    SimdBackgroundUpdateGrowRange = 1,
+    /*! Incrementing of background statistic counters (see ::SimdBackgroundIncrementCount). */
+    SimdBackgroundUpdateIncrementCount = 2,
+    /*! Adjusting of background range and reset of statistic counters (see ::SimdBackgroundAdjustRange). */
+    SimdBackgroundUpdateAdjustRange = 4,
+} SimdBackgroundUpdateFlags;
+
 /*! @ingroup c_types
     Describes types of binary operation between two images performed by function ::SimdOperationBinary8u.
     Images must have the same format (unsigned 8-bit integer for every channel).
@@ -152,7 +166,7 @@ typedef enum
 
 /*! @ingroup c_types
     Describes pixel format types of an image.
-    In particular this type is used in functions ::SimdBayerToBgr, ::SimdBayerToBgra, ::SimdBgraToBayer and ::SimdBgrToBayer.
+    In particular this type is used in functions ::SimdBayerToBgr, ::SimdBayerToBgra, ::SimdBayerToBgrMhc, ::SimdBayerToBgraMhc, ::SimdBayerToBgrHalf, ::SimdBayerToGray, ::SimdBgraToBayer and ::SimdBgrToBayer.
     \note This type is corresponds to C++ type Simd::View::Format.
 */
 typedef enum
@@ -189,8 +203,37 @@ typedef enum
     SimdPixelFormatHsv24,
     /*! A 24-bit (3 8-bit channels) HSL (Hue, Saturation, Lightness) pixel format. */
     SimdPixelFormatHsl24,
+    /*! A 24-bit (3 8-bit channels) RGB (Red, Green, Blue) pixel format. */
+    SimdPixelFormatRgb24,
+    /*! A 32-bit (4 8-bit channels) RGBA (Red, Green, Blue, Alpha) pixel format. */
+    SimdPixelFormatRgba32,
+    /*! A 32-bit (2 16-bit channels) pixel format (UV plane of P016 (P010, P012) pixel format). */
+    SimdPixelFormatUv32,
+    /*! A 24-bit (3 8-bit channels) CIE Lab pixel format (L is scaled to [0..255], a and b are shifted by 128). */
+    SimdPixelFormatLab24,
 } SimdPixelFormatType;
 
+/*! @ingroup c_types
+    Describes YUV color matrix (and range of YUV components) used in conversions between YUV and BGR(A) images.
+    In particular this type is used in functions ::SimdYuv420pToBgrV2, ::SimdYuv420pToBgraV2, ::SimdBgrToYuv420pV2, ::SimdBgraToYuv420pV2,
+    ::SimdNv12ToBgrV2, ::SimdBgrToNv12V2, ::SimdYuv420pToHueV2 and ::SimdYuv444pToHsvV2.
+*/
+typedef enum
+{
+    /*! ITU-R BT.601 with limited range of components (Y in [16..235], U and V in [16..240]). It is used by all functions without YUV type parameter. */
+    SimdYuvBt601,
+    /*! ITU-R BT.709 with limited range of components (HDTV). */
+    SimdYuvBt709,
+    /*! ITU-R BT.2020 with limited range of components (UHDTV). */
+    SimdYuvBt2020,
+    /*! ITU-R BT.601 with full range of components [0..255] (JPEG, ITU-T T.871). */
+    SimdYuvBt601Full,
+    /*! ITU-R BT.709 with full range of components [0..255]. */
+    SimdYuvBt709Full,
+    /*! ITU-R BT.2020 with full range of components [0..255]. */
+    SimdYuvBt2020Full,
+} SimdYuvType;
+
 /*! @ingroup c_types
     Describes types and flags to get information about classifier cascade with using function ::SimdDetectionInfo.
     \note This type is used for implementation of Simd::Detection.
@@ -220,6 +263,20 @@ enum SimdReduceType
     SimdReduce5x5, /*!< Using of function ::SimdReduceGray5x5 for image reducing. */
 };
 
+/*! @ingroup c_types
+    Describes a connected component of segmentation mask (see function ::SimdSegmentationLabelComponents).
+*/
+typedef struct SimdConnectedComponent
+{
+    size_t area; /*!< A number of pixels of the component. */
+    ptrdiff_t left; /*!< A left side of the component bounding box. */
+    ptrdiff_t top; /*!< A top side of the component bounding box. */
+    ptrdiff_t right; /*!< A right side of the component bounding box (exclusive). */
+    ptrdiff_t bottom; /*!< A bottom side of the component bounding box (exclusive). */
+    float x; /*!< X coordinate of the component centroid. */
+    float y; /*!< Y coordinate of the component centroid. */
+} SimdConnectedComponent;
+
 #if defined(WIN32) && !defined(SIMD_STATIC)
 #  ifdef SIMD_EXPORTS
 #    define SIMD_API __declspec(dllexport)
@@ -619,6 +676,159 @@ extern "C"
     */
     SIMD_API void SimdAlphaFilling(uint8_t * dst, size_t dstStride, size_t width, size_t height, const uint8_t * channel, size_t channelCount, const uint8_t * alpha, size_t alphaStride);
 
+    /*! @ingroup drawing
+
+        \fn void SimdAlphaPremultiply(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+
+        \short Converts BGRA32 image with straight alpha to BGRA32 image with premultiplied alpha.
+
+        Both images must have the same width and height. The operation can be performed in-place (src == dst).
+
+        For every point:
+        \verbatim
+        dst[x, y, c] = src[x, y, c]*src[x, y, 3]/255, c = 0..2;
+        dst[x, y, 3] = src[x, y, 3];
+        \endverbatim
+
+        \note This function has a C++ wrapper Simd::AlphaPremultiply(const View<A>& src, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of input BGRA32 image with straight alpha.
+        \param [in] srcStride - a row size of the input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] dst - a pointer to pixels data of output BGRA32 image with premultiplied alpha.
+        \param [in] dstStride - a row size of the output image.
+    */
+    SIMD_API void SimdAlphaPremultiply(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup drawing
+
+        \fn void SimdAlphaUnpremultiply(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+
+        \short Converts BGRA32 image with premultiplied alpha to BGRA32 image with straight alpha.
+
+        Both images must have the same width and height. The operation can be performed in-place (src == dst).
+
+        For every point:
+        \verbatim
+        dst[x, y, c] = alpha ? Min((src[x, y, c]*255 + alpha/2)/alpha, 255) : 0, c = 0..2;
+        dst[x, y, 3] = alpha;
+        \endverbatim
+        where alpha = src[x, y, 3].
+
+        \note This function has a C++ wrapper Simd::AlphaUnpremultiply(const View<A>& src, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of input BGRA32 image with premultiplied alpha.
+        \param [in] srcStride - a row size of the input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] dst - a pointer to pixels data of output BGRA32 image with straight alpha.
+        \param [in] dstStride - a row size of the output image.
+    */
+    SIMD_API void SimdAlphaUnpremultiply(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup drawing
+
+        \fn void SimdAlphaBlendingBgraToBgra(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t alpha, SimdBool premultiplied, uint8_t * dst, size_t dstStride);
+
+        \short Composites BGRA32 image over BGRA32 image (Porter-Duff "over" operation) using alpha channel of the foreground image and global opacity.
+
+        Both images must have the same width and height. Both images must have the same alpha mode (straight or premultiplied).
+
+        For straight alpha, for every point:
+        \verbatim
+        sa = src[x, y, 3]*alpha/255;
+        da = dst[x, y, 3]*(255 - sa)/255;
+        dst[x, y, c] = (src[x, y, c]*sa + dst[x, y, c]*da)/(sa + da), c = 0..2;
+        dst[x, y, 3] = sa + da;
+        \endverbatim
+
+        For premultiplied alpha, for every point:
+        \verbatim
+        sa = src[x, y, 3]*alpha/255;
+        dst[x, y, c] = src[x, y, c]*alpha/255 + dst[x, y, c]*(255 - sa)/255, c = 0..3;
+        \endverbatim
+
+        This function is used for image drawing.
+
+        \note This function has a C++ wrapper Simd::AlphaBlendingBgraToBgra(const View<A>& src, uint8_t alpha, bool premultiplied, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of foreground BGRA32 image.
+        \param [in] srcStride - a row size of the foreground image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] alpha - a global opacity of the foreground image (255 - opaque).
+        \param [in] premultiplied - a flag of premultiplied alpha in both images.
+        \param [in, out] dst - a pointer to pixels data of background BGRA32 image.
+        \param [in] dstStride - a row size of the background image.
+    */
+    SIMD_API void SimdAlphaBlendingBgraToBgra(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t alpha, SimdBool premultiplied, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup drawing
+
+        \fn void SimdAlphaBlendingBgraToYuv420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t alpha, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+        \short Composites BGRA32 image with straight alpha over YUV420P image.
+
+        The input BGRA32 and output Y images must have the same width and height.
+        The U and V images must have the same width and height (half size relative to Y component).
+        The foreground color is converted with given YUV color matrix and blended with Y plane for every point
+        and with U and V planes using alpha averaged over 2x2 block, so the background image is never converted to BGRA32.
+
+        For every point:
+        \verbatim
+        sa = bgra[x, y, 3]*alpha/255;
+        y[x, y] = (Y(bgra[x, y])*sa + y[x, y]*(255 - sa))/255;
+        \endverbatim
+
+        This function is used for drawing of overlays (OSD, privacy masks, watermarks) on video frames.
+
+        \note This function has a C++ wrapper Simd::AlphaBlendingBgraToYuv420p(const View<A>& bgra, uint8_t alpha, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType).
+
+        \param [in] bgra - a pointer to pixels data of foreground BGRA32 image.
+        \param [in] bgraStride - a row size of the foreground image.
+        \param [in] width - an image width (must be even).
+        \param [in] height - an image height (must be even).
+        \param [in] alpha - a global opacity of the foreground image (255 - opaque).
+        \param [in, out] y - a pointer to pixels data of Y plane of background image.
+        \param [in] yStride - a row size of the Y plane.
+        \param [in, out] u - a pointer to pixels data of U plane of background image.
+        \param [in] uStride - a row size of the U plane.
+        \param [in, out] v - a pointer to pixels data of V plane of background image.
+        \param [in] vStride - a row size of the V plane.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
+    */
+    SIMD_API void SimdAlphaBlendingBgraToYuv420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t alpha,
+        uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+    /*! @ingroup drawing
+
+        \fn void SimdAlphaBlendingBgraToNv12(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t alpha, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType);
+
+        \short Composites BGRA32 image with straight alpha over NV12 image.
+
+        The input BGRA32 and output Y images must have the same width and height.
+        The UV image must have half size relative to Y component and interleaved U and V channels.
+        The blending is the same as in function ::SimdAlphaBlendingBgraToYuv420p.
+
+        This function is used for drawing of overlays (OSD, privacy masks, watermarks) on video frames.
+
+        \note This function has a C++ wrapper Simd::AlphaBlendingBgraToNv12(const View<A>& bgra, uint8_t alpha, View<A>& y, View<A>& uv, SimdYuvType yuvType).
+
+        \param [in] bgra - a pointer to pixels data of foreground BGRA32 image.
+        \param [in] bgraStride - a row size of the foreground image.
+        \param [in] width - an image width (must be even).
+        \param [in] height - an image height (must be even).
+        \param [in] alpha - a global opacity of the foreground image (255 - opaque).
+        \param [in, out] y - a pointer to pixels data of Y plane of background image.
+        \param [in] yStride - a row size of the Y plane.
+        \param [in, out] uv - a pointer to pixels data of interleaved UV plane of background image.
+        \param [in] uvStride - a row size of the UV plane.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
+    */
+    SIMD_API void SimdAlphaBlendingBgraToNv12(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t alpha,
+        uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType);
+
     /*! @ingroup background
 
         \fn void SimdBackgroundGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride);
@@ -906,5094 +1116,7528 @@ extern "C"
     SIMD_API void SimdBackgroundInitMask(const uint8_t * src, size_t srcStride, size_t width, size_t height,
         uint8_t index, uint8_t value, uint8_t * dst, size_t dstStride);
 
-    /*! @ingroup bayer_conversion
+    /*! @ingroup background
 
-        \fn void SimdBayerToBgr(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride);
+        \fn void SimdBackgroundUpdate(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * loValue, size_t loValueStride, uint8_t * hiValue, size_t hiValueStride, uint8_t * loCount, size_t loCountStride, uint8_t * hiCount, size_t hiCountStride, uint8_t threshold, int flags);
 
-        \short Converts 8-bit Bayer image to 24-bit BGR.
+        \short Performs several steps of background model update in one pass over the images.
 
-        All images must have the same width and height. The width and the height must be even.
+        All images must have the same width, height and format (8-bit gray).
 
-        \note This function has a C++ wrapper Simd::BayerToBgr(const View<A>& bayer, View<A>& bgr).
+        For every point the steps selected by flags are executed in the next order:
+        \verbatim
+        if(flags & SimdBackgroundUpdateGrowRange)
+        {
+            loValue[i] = min(loValue[i], value[i]);
+            hiValue[i] = max(hiValue[i], value[i]);
+        }
+        if(flags & SimdBackgroundUpdateIncrementCount)
+        {
+            if(value[i] < loValue[i] && loCount[i] < 255)
+                loCount[i]++;
+            if(value[i] > hiValue[i] && hiCount[i] < 255)
+                hiCount[i]++;
+        }
+        if(flags & SimdBackgroundUpdateAdjustRange)
+        {
+            if(loCount[i] > threshold)
+                loValue[i] = max(loValue[i] - 1, 0);
+            if(loCount[i] < threshold)
+                loValue[i] = min(loValue[i] + 1, 255);
+            if(hiCount[i] < threshold)
+                hiValue[i] = max(hiValue[i] - 1, 0);
+            if(hiCount[i] > threshold)
+                hiValue[i] = min(hiValue[i] + 1, 255);
+            loCount[i] = 0;
+            hiCount[i] = 0;
+        }
+        \endverbatim
 
-        \param [in] bayer - a pointer to pixels data of input 8-bit Bayer image.
+        The result is equal to sequential calls of ::SimdBackgroundGrowRangeFast, ::SimdBackgroundIncrementCount and ::SimdBackgroundAdjustRange,
+        but every image is loaded and stored only once. Counter images are not accessed if neither of last two steps is selected.
+        This function is used for background updating in motion detection algorithm.
+
+        \note This function has a C++ wrapper Simd::BackgroundUpdate(const View<A>& value, View<A>& loValue, View<A>& hiValue, View<A>& loCount, View<A>& hiCount, uint8_t threshold, int flags).
+
+        \param [in] value - a pointer to pixels data of current feature value.
+        \param [in] valueStride - a row size of the value image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] bayerStride - a row size of the bayer image.
-        \param [in] bayerFormat - a format of the input bayer image. It can be ::SimdPixelFormatBayerGrbg, ::SimdPixelFormatBayerGbrg, ::SimdPixelFormatBayerRggb or ::SimdPixelFormatBayerBggr.
-        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
-        \param [in] bgrStride - a row size of the bgr image.
+        \param [in, out] loValue - a pointer to pixels data of value of feature lower bound of dynamic background.
+        \param [in] loValueStride - a row size of the loValue image.
+        \param [in, out] hiValue - a pointer to pixels data of value of feature upper bound of dynamic background.
+        \param [in] hiValueStride - a row size of the hiValue image.
+        \param [in, out] loCount - a pointer to pixels data of count of feature lower bound of dynamic background.
+        \param [in] loCountStride - a row size of the loCount image.
+        \param [in, out] hiCount - a pointer to pixels data of count of feature upper bound of dynamic background.
+        \param [in] hiCountStride - a row size of the hiCount image.
+        \param [in] threshold - a count threshold (is used by ::SimdBackgroundUpdateAdjustRange step).
+        \param [in] flags - a combination of ::SimdBackgroundUpdateFlags.
     */
-    SIMD_API void SimdBayerToBgr(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride);
+    SIMD_API void SimdBackgroundUpdate(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+        uint8_t * loValue, size_t loValueStride, uint8_t * hiValue, size_t hiValueStride,
+        uint8_t * loCount, size_t loCountStride, uint8_t * hiCount, size_t hiCountStride, uint8_t threshold, int flags);
 
-    /*! @ingroup bayer_conversion
+    /*! @ingroup background
 
-        \fn void SimdBayerToBgra(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+        \fn void SimdBackgroundPackedInit(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride);
 
-        \short Converts 8-bit Bayer image to 32-bit BGRA.
+        \short Initializes background model in packed format.
 
-        All images must have the same width and height. The width and the height must be even.
+        In packed format the whole background model is stored in one image with 4 bytes per pixel:
+        {loValue, hiValue, loCount, hiCount}. In comparison with separate images (see ::SimdBackgroundUpdate)
+        the update of every pixel touches only one cache line of the model.
+        Conversion from/to separate images can be performed with using of ::SimdInterleaveBgra and ::SimdDeinterleaveBgra.
+        The packed model is processed by ::SimdBackgroundPackedUpdate, ::SimdBackgroundPackedGrowRangeSlow, ::SimdBackgroundPackedShiftRange,
+        ::SimdBackgroundPackedShiftRangeMasked and ::SimdBackgroundPackedAdjustRangeMasked without conversion to separate images.
+        Masks for the masked functions can be created by ::SimdBackgroundInitMask.
 
-        \note This function has a C++ wrapper Simd::BayerToBgra(const View<A>& bayer, View<A>& bgra, uint8_t alpha).
+        For every point:
+        \verbatim
+        model[4*i + 0] = value[i];
+        model[4*i + 1] = value[i];
+        model[4*i + 2] = 0;
+        model[4*i + 3] = 0;
+        \endverbatim
 
-        \param [in] bayer - a pointer to pixels data of input 8-bit Bayer image.
+        \note This function has a C++ wrapper Simd::BackgroundPackedInit(const View<A>& value, View<A>& model).
+
+        \param [in] value - a pointer to pixels data of current feature value (8-bit gray image).
+        \param [in] valueStride - a row size of the value image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] bayerStride - a row size of the bayer image.
-        \param [in] bayerFormat - a format of the input bayer image. It can be ::SimdPixelFormatBayerGrbg, ::SimdPixelFormatBayerGbrg, ::SimdPixelFormatBayerRggb or ::SimdPixelFormatBayerBggr.
-        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
-        \param [in] bgraStride - a row size of the bgra image.
-        \param [in] alpha - a value of alpha channel.
+        \param [out] model - a pointer to pixels data of packed background model (4 bytes per pixel).
+        \param [in] modelStride - a row size of the model image.
     */
-    SIMD_API void SimdBayerToBgra(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+    SIMD_API void SimdBackgroundPackedInit(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride);
 
-    /*! @ingroup bgra_conversion
+    /*! @ingroup background
 
-        \fn void SimdBgraToBayer(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat);
+        \fn void SimdBackgroundPackedUpdate(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride, uint8_t threshold, int flags);
 
-        \short Converts 32-bit BGRA image to 8-bit Bayer image.
+        \short Performs several steps of update of background model in packed format in one pass over the images.
 
-        All images must have the same width and height. The width and the height must be even.
+        The packed model has 4 bytes per pixel: {loValue, hiValue, loCount, hiCount} (see ::SimdBackgroundPackedInit).
+        The result is equal to the result of ::SimdBackgroundUpdate applied to separate images of the model.
 
-        \note This function has a C++ wrapper Simd::BgraToBayer(const View<A>& bgra, View<A>& bayer).
+        \note This function has a C++ wrapper Simd::BackgroundPackedUpdate(const View<A>& value, View<A>& model, uint8_t threshold, int flags).
 
-        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
+        \param [in] value - a pointer to pixels data of current feature value (8-bit gray image).
+        \param [in] valueStride - a row size of the value image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] bgraStride - a row size of the bgra image.
-        \param [out] bayer - a pointer to pixels data of output 8-bit Bayer image.
-        \param [in] bayerStride - a row size of the bayer image.
-        \param [in] bayerFormat - a format of the output bayer image. It can be ::SimdPixelFormatBayerGrbg, ::SimdPixelFormatBayerGbrg, ::SimdPixelFormatBayerRggb or ::SimdPixelFormatBayerBggr.
+        \param [in, out] model - a pointer to pixels data of packed background model (4 bytes per pixel).
+        \param [in] modelStride - a row size of the model image.
+        \param [in] threshold - a count threshold (is used by ::SimdBackgroundUpdateAdjustRange step).
+        \param [in] flags - a combination of ::SimdBackgroundUpdateFlags.
     */
-    SIMD_API void SimdBgraToBayer(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat);
+    SIMD_API void SimdBackgroundPackedUpdate(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+        uint8_t * model, size_t modelStride, uint8_t threshold, int flags);
 
-    /*! @ingroup bgra_conversion
+    /*! @ingroup background
 
-        \fn void SimdBgraToBgr(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bgr, size_t bgrStride);
+        \fn void SimdBackgroundPackedGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride);
 
-        \short Converts 32-bit BGRA image to 24-bit BGR image.
+        \short Performs background update (initial grow, slow mode) of background model in packed format.
 
-        All images must have the same width and height.
+        The packed model has 4 bytes per pixel: {loValue, hiValue, loCount, hiCount} (see ::SimdBackgroundPackedInit).
 
-        \note This function has a C++ wrapper Simd::BgraToBgr(const View<A>& bgra, View<A>& bgr).
+        For every point:
+        \verbatim
+        loValue[i] -= value[i] < loValue[i] ? 1 : 0;
+        hiValue[i] += value[i] > hiValue[i] ? 1 : 0;
+        \endverbatim
 
-        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
+        The result is equal to the result of ::SimdBackgroundGrowRangeSlow applied to separate images of the model.
+
+        \note This function has a C++ wrapper Simd::BackgroundPackedGrowRangeSlow(const View<A>& value, View<A>& model).
+
+        \param [in] value - a pointer to pixels data of current feature value (8-bit gray image).
+        \param [in] valueStride - a row size of the value image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] bgraStride - a row size of the bgra image.
-        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
-        \param [in] bgrStride - a row size of the bgr image.
+        \param [in, out] model - a pointer to pixels data of packed background model (4 bytes per pixel).
+        \param [in] modelStride - a row size of the model image.
     */
-    SIMD_API void SimdBgraToBgr(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bgr, size_t bgrStride);
+    SIMD_API void SimdBackgroundPackedGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride);
 
-    /*! @ingroup bgra_conversion
+    /*! @ingroup background
 
-        \fn void SimdBgraToGray(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * gray, size_t grayStride);
+        \fn void SimdBackgroundPackedAdjustRangeMasked(uint8_t * model, size_t modelStride, size_t width, size_t height, uint8_t threshold, const uint8_t * mask, size_t maskStride);
 
-        \short Converts 32-bit BGRA image to 8-bit gray image.
+        \short Performs adjustment of background range of background model in packed format with using adjust range mask.
 
-        All images must have the same width and height.
+        The packed model has 4 bytes per pixel: {loValue, hiValue, loCount, hiCount} (see ::SimdBackgroundPackedInit).
+        The mask is 8-bit gray image (it can be created by ::SimdBackgroundInitMask).
 
-        \note This function has a C++ wrapper Simd::BgraToGray(const View<A>& bgra, View<A>& gray).
+        For every point:
+        \verbatim
+        if(mask[i])
+        {
+            loValue[i] -= (loCount[i] > threshold && loValue[i] > 0) ? 1 : 0;
+            loValue[i] += (loCount[i] < threshold && loValue[i] < 255) ? 1 : 0;
+            hiValue[i] += (hiCount[i] > threshold && hiValue[i] < 255) ? 1 : 0;
+            hiValue[i] -= (hiCount[i] < threshold && hiValue[i] > 0) ? 1 : 0;
+        }
+        loCount[i] = 0;
+        hiCount[i] = 0;
+        \endverbatim
 
-        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
+        The result is equal to the result of ::SimdBackgroundAdjustRangeMasked applied to separate images of the model.
+
+        \note This function has a C++ wrapper Simd::BackgroundPackedAdjustRange(View<A>& model, uint8_t threshold, const View<A>& mask).
+
+        \param [in, out] model - a pointer to pixels data of packed background model (4 bytes per pixel).
+        \param [in] modelStride - a row size of the model image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] bgraStride - a row size of the bgra image.
-        \param [out] gray - a pointer to pixels data of output 8-bit gray image.
-        \param [in] grayStride - a row size of the gray image.
+        \param [in] threshold - a count threshold.
+        \param [in] mask - a pointer to pixels data of adjust range mask.
+        \param [in] maskStride - a row size of the mask image.
     */
-    SIMD_API void SimdBgraToGray(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * gray, size_t grayStride);
+    SIMD_API void SimdBackgroundPackedAdjustRangeMasked(uint8_t * model, size_t modelStride, size_t width, size_t height,
+        uint8_t threshold, const uint8_t * mask, size_t maskStride);
 
-    /*! @ingroup bgra_conversion
+    /*! @ingroup background
 
-        \fn void SimdBgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+        \fn void SimdBackgroundPackedShiftRange(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride);
 
-        \short Converts 32-bit BGRA image to YUV420P.
+        \short Shifts background range of background model in packed format.
 
-        The input BGRA and output Y images must have the same width and height.
-        The input U and V images must have the same width and height (half size relative to Y component).
+        The packed model has 4 bytes per pixel: {loValue, hiValue, loCount, hiCount} (see ::SimdBackgroundPackedInit).
+        The counters are not changed.
 
-        \note This function has a C++ wrapper Simd::BgraToYuv420p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v).
+        For every point:
+        \verbatim
+        if (value[i] > hiValue[i])
+        {
+            loValue[i] = min(loValue[i] + value[i] - hiValue[i], 255);
+            hiValue[i] = value[i];
+        }
+        if (loValue[i] > value[i])
+        {
+            loValue[i] = value[i];
+            hiValue[i] = max(hiValue[i] - loValue[i] + value[i], 0);
+        }
+        \endverbatim
 
-        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
+        The result is equal to the result of ::SimdBackgroundShiftRange applied to separate images of the model.
+
+        \note This function has a C++ wrapper Simd::BackgroundPackedShiftRange(const View<A>& value, View<A>& model).
+
+        \param [in] value - a pointer to pixels data of current feature value (8-bit gray image).
+        \param [in] valueStride - a row size of the value image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] bgraStride - a row size of the BGRA image.
-        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
-        \param [in] yStride - a row size of the y image.
-        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
-        \param [in] uStride - a row size of the u image.
-        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
-        \param [in] vStride - a row size of the v image.
+        \param [in, out] model - a pointer to pixels data of packed background model (4 bytes per pixel).
+        \param [in] modelStride - a row size of the model image.
     */
-    SIMD_API void SimdBgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+    SIMD_API void SimdBackgroundPackedShiftRange(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride);
 
-    /*! @ingroup bgra_conversion
+    /*! @ingroup background
 
-        \fn void SimdBgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+        \fn void SimdBackgroundPackedShiftRangeMasked(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride, const uint8_t * mask, size_t maskStride);
 
-        \short Converts 32-bit BGRA image to YUV422P.
+        \short Shifts background range of background model in packed format with using shift range mask.
 
-        The input BGRA and output Y images must have the same width and height.
-        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+        The packed model has 4 bytes per pixel: {loValue, hiValue, loCount, hiCount} (see ::SimdBackgroundPackedInit).
+        The mask is 8-bit gray image (it can be created by ::SimdBackgroundInitMask). The counters are not changed.
 
-        \note This function has a C++ wrapper Simd::BgraToYuv422p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v).
+        For every point:
+        \verbatim
+        if(mask[i])
+        {
+            if (value[i] > hiValue[i])
+            {
+                loValue[i] = min(loValue[i] + value[i] - hiValue[i], 255);
+                hiValue[i] = value[i];
+            }
+            if (loValue[i] > value[i])
+            {
+                loValue[i] = value[i];
+                hiValue[i] = max(hiValue[i] - loValue[i] + value[i], 0);
+            }
+        }
+        \endverbatim
 
-        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
+        The result is equal to the result of ::SimdBackgroundShiftRangeMasked applied to separate images of the model.
+
+        \note This function has a C++ wrapper Simd::BackgroundPackedShiftRange(const View<A>& value, View<A>& model, const View<A>& mask).
+
+        \param [in] value - a pointer to pixels data of current feature value (8-bit gray image).
+        \param [in] valueStride - a row size of the value image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] bgraStride - a row size of the BGRA image.
-        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
-        \param [in] yStride - a row size of the y image.
-        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
-        \param [in] uStride - a row size of the u image.
-        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
-        \param [in] vStride - a row size of the v image.
+        \param [in, out] model - a pointer to pixels data of packed background model (4 bytes per pixel).
+        \param [in] modelStride - a row size of the model image.
+        \param [in] mask - a pointer to pixels data of shift range mask.
+        \param [in] maskStride - a row size of the mask image.
     */
-    SIMD_API void SimdBgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+    SIMD_API void SimdBackgroundPackedShiftRangeMasked(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+        uint8_t * model, size_t modelStride, const uint8_t * mask, size_t maskStride);
 
-    /*! @ingroup bgra_conversion
+    /*! @ingroup bayer_conversion
 
-        \fn void SimdBgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+        \fn void SimdBayerToBgr(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride);
 
-        \short Converts 32-bit BGRA image to YUV444P.
+        \short Converts 8-bit Bayer image to 24-bit BGR.
 
-        The input BGRA and output Y, U and V images must have the same width and height.
+        All images must have the same width and height. The width and the height must be even.
 
-        \note This function has a C++ wrapper Simd::BgraToYuv444p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v).
+        \note This function has a C++ wrapper Simd::BayerToBgr(const View<A>& bayer, View<A>& bgr).
 
-        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
+        \param [in] bayer - a pointer to pixels data of input 8-bit Bayer image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] bgraStride - a row size of the BGRA image.
-        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
-        \param [in] yStride - a row size of the y image.
-        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
-        \param [in] uStride - a row size of the u image.
-        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
-        \param [in] vStride - a row size of the v image.
+        \param [in] bayerStride - a row size of the bayer image.
+        \param [in] bayerFormat - a format of the input bayer image. It can be ::SimdPixelFormatBayerGrbg, ::SimdPixelFormatBayerGbrg, ::SimdPixelFormatBayerRggb or ::SimdPixelFormatBayerBggr.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
     */
-    SIMD_API void SimdBgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+    SIMD_API void SimdBayerToBgr(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride);
 
-    /*! @ingroup bgra_conversion
+    /*! @ingroup bayer_conversion
 
-        \fn void SimdBgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, uint8_t * a, size_t aStride);
+        \fn void SimdBayerToBgra(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
-        \short Converts 32-bit BGRA image to YUVA420P.
+        \short Converts 8-bit Bayer image to 32-bit BGRA.
 
-        The input BGRA and output Y and A images must have the same width and height.
-        The input U and V images must have the same width and height (half size relative to Y component).
+        All images must have the same width and height. The width and the height must be even.
 
-        \note This function has a C++ wrapper Simd::BgraToYuva420p(const View<A> & bgra, View<A> & y, View<A> & u, View<A> & v, View<A> & a).
+        \note This function has a C++ wrapper Simd::BayerToBgra(const View<A>& bayer, View<A>& bgra, uint8_t alpha).
 
-        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
-        \param [in] bgraStride - a row size of the BGRA image.
+        \param [in] bayer - a pointer to pixels data of input 8-bit Bayer image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
-        \param [in] yStride - a row size of the y image.
-        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
-        \param [in] uStride - a row size of the u image.
-        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
-        \param [in] vStride - a row size of the v image.
-        \param [out] a - a pointer to pixels data of output 8-bit image with alpha plane.
-        \param [in] aStride - a row size of the a image.
+        \param [in] bayerStride - a row size of the bayer image.
+        \param [in] bayerFormat - a format of the input bayer image. It can be ::SimdPixelFormatBayerGrbg, ::SimdPixelFormatBayerGbrg, ::SimdPixelFormatBayerRggb or ::SimdPixelFormatBayerBggr.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
     */
-    SIMD_API void SimdBgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, 
-        uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, uint8_t * a, size_t aStride);
+    SIMD_API void SimdBayerToBgra(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
-    /*! @ingroup bgr_conversion
+    /*! @ingroup bayer_conversion
 
-        \fn void SimdBgrToBayer(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat);
+        \fn void SimdBayerToBgrMhc(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride);
 
-        \short Converts 24-bit BGR image to 8-bit Bayer image.
+        \short Converts 8-bit Bayer image to 24-bit BGR with using of gradient-corrected (Malvar-He-Cutler) interpolation.
 
+        It uses 5x5 gradient-corrected linear filters: missing color values are estimated with bilinear interpolation corrected by the Laplacian of the known channel.
+        It gives less color artifacts on edges than ::SimdBayerToBgr but is slower. Image borders are processed with mirror reflection.
         All images must have the same width and height. The width and the height must be even.
 
-        \note This function has a C++ wrapper Simd::BgrToBayer(const View<A>& bgr, View<A>& bayer).
+        \note This function has a C++ wrapper Simd::BayerToBgrMhc(const View<A>& bayer, View<A>& bgr).
 
-        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] bayer - a pointer to pixels data of input 8-bit Bayer image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] bgrStride - a row size of the bgr image.
-        \param [out] bayer - a pointer to pixels data of output 8-bit Bayer image.
         \param [in] bayerStride - a row size of the bayer image.
-        \param [in] bayerFormat - a format of the output bayer image. It can be ::SimdPixelFormatBayerGrbg, ::SimdPixelFormatBayerGbrg, ::SimdPixelFormatBayerRggb or ::SimdPixelFormatBayerBggr.
+        \param [in] bayerFormat - a format of the input bayer image. It can be ::SimdPixelFormatBayerGrbg, ::SimdPixelFormatBayerGbrg, ::SimdPixelFormatBayerRggb or ::SimdPixelFormatBayerBggr.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
     */
-    SIMD_API void SimdBgrToBayer(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat);
+    SIMD_API void SimdBayerToBgrMhc(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride);
 
-    /*! @ingroup bgr_conversion
+    /*! @ingroup bayer_conversion
 
-        \fn void SimdBgrToBgra(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+        \fn void SimdBayerToBgraMhc(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
-        \short Converts 24-bit BGR image to 32-bit BGRA image.
+        \short Converts 8-bit Bayer image to 32-bit BGRA with using of gradient-corrected (Malvar-He-Cutler) interpolation.
 
-        All images must have the same width and height.
+        The interpolation is the same as in ::SimdBayerToBgrMhc.
+        All images must have the same width and height. The width and the height must be even.
 
-        \note This function has a C++ wrapper Simd::BgrToBgra(const View<A>& bgr, View<A>& bgra, uint8_t alpha).
+        \note This function has a C++ wrapper Simd::BayerToBgraMhc(const View<A>& bayer, View<A>& bgra, uint8_t alpha).
 
-        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] bayer - a pointer to pixels data of input 8-bit Bayer image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] bayerStride - a row size of the bayer image.
+        \param [in] bayerFormat - a format of the input bayer image. It can be ::SimdPixelFormatBayerGrbg, ::SimdPixelFormatBayerGbrg, ::SimdPixelFormatBayerRggb or ::SimdPixelFormatBayerBggr.
         \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
         \param [in] bgraStride - a row size of the bgra image.
         \param [in] alpha - a value of alpha channel.
     */
-    SIMD_API void SimdBgrToBgra(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+    SIMD_API void SimdBayerToBgraMhc(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
-    /*! @ingroup other_conversion
+    /*! @ingroup bayer_conversion
 
-        \fn void SimdBgr48pToBgra32(const uint8_t * blue, size_t blueStride, size_t width, size_t height, const uint8_t * green, size_t greenStride, const uint8_t * red, size_t redStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+        \fn void SimdBayerToBgrHalf(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride);
 
-        \short Converts 48-bit planar BGR image to 32-bit BGRA image.
+        \short Converts 8-bit Bayer image to 24-bit BGR image of half size.
 
-        All images must have the same width and height.
+        Every 2x2 Bayer cell gives one output pixel: blue and red are copied, green is the average of two green values.
+        It is much faster than full resolution demosaicing followed by reduction.
+        The width and the height of the Bayer image must be even. The output BGR image must have size (width/2, height/2).
 
-        \note This function has a C++ wrapper Simd::Bgr48pToBgra32(const View<A>& blue, const View<A>& green, const View<A>& red, View<A>& bgra, uint8_t alpha).
+        \note This function has a C++ wrapper Simd::BayerToBgrHalf(const View<A>& bayer, View<A>& bgr).
 
-        \param [in] blue - a pointer to pixels data of input 16-bit image with blue color plane.
-        \param [in] blueStride - a row size of the blue image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [in] green - a pointer to pixels data of input 16-bit image with green color plane.
-        \param [in] greenStride - a row size of the blue image.
-        \param [in] red - a pointer to pixels data of input 16-bit image with red color plane.
-        \param [in] redStride - a row size of the red image.
-        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
-        \param [in] bgraStride - a row size of the bgra image.
-        \param [in] alpha - a value of alpha channel.
+        \param [in] bayer - a pointer to pixels data of input 8-bit Bayer image.
+        \param [in] width - a width of the Bayer image.
+        \param [in] height - a height of the Bayer image.
+        \param [in] bayerStride - a row size of the bayer image.
+        \param [in] bayerFormat - a format of the input bayer image. It can be ::SimdPixelFormatBayerGrbg, ::SimdPixelFormatBayerGbrg, ::SimdPixelFormatBayerRggb or ::SimdPixelFormatBayerBggr.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image of half size.
+        \param [in] bgrStride - a row size of the bgr image.
     */
-    SIMD_API void SimdBgr48pToBgra32(const uint8_t * blue, size_t blueStride, size_t width, size_t height,
-        const uint8_t * green, size_t greenStride, const uint8_t * red, size_t redStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+    SIMD_API void SimdBayerToBgrHalf(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride);
 
-    /*! @ingroup bgr_conversion
+    /*! @ingroup bayer_conversion
 
-        \fn void SimdBgrToGray(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * gray, size_t grayStride);
+        \fn void SimdBayerToGray(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * gray, size_t grayStride);
 
-        \short Converts 24-bit BGR image to 8-bit gray image.
+        \short Converts 8-bit Bayer image to 8-bit gray image.
 
-        All images must have the same width and height.
+        Color is reconstructed with gradient-corrected (Malvar-He-Cutler) interpolation (see ::SimdBayerToBgrMhc) and then converted to gray
+        with the same weights as in ::SimdBgrToGray. An intermediate BGR image is not created.
+        All images must have the same width and height. The width and the height must be even.
 
-        \note This function has a C++ wrapper Simd::BgrToGray(const View<A>& bgr, View<A>& gray).
+        \note This function has a C++ wrapper Simd::BayerToGray(const View<A>& bayer, View<A>& gray).
 
-        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] bayer - a pointer to pixels data of input 8-bit Bayer image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] bayerStride - a row size of the bayer image.
+        \param [in] bayerFormat - a format of the input bayer image. It can be ::SimdPixelFormatBayerGrbg, ::SimdPixelFormatBayerGbrg, ::SimdPixelFormatBayerRggb or ::SimdPixelFormatBayerBggr.
         \param [out] gray - a pointer to pixels data of output 8-bit gray image.
         \param [in] grayStride - a row size of the gray image.
     */
-    SIMD_API void SimdBgrToGray(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * gray, size_t grayStride);
+    SIMD_API void SimdBayerToGray(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * gray, size_t grayStride);
 
-    /*! @ingroup bgr_conversion
+    /*! @ingroup bgra_conversion
 
-        \fn void SimdBgrToHsl(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsl, size_t hslStride);
+        \fn void SimdBgraToBayer(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat);
 
-        \short Converts 24-bit BGR image to 24-bit HSL(Hue, Saturation, Lightness) image.
+        \short Converts 32-bit BGRA image to 8-bit Bayer image.
 
-        All images must have the same width and height.
+        All images must have the same width and height. The width and the height must be even.
 
-        \note This function has a C++ wrapper Simd::BgrToHsl(const View<A>& bgr, View<A>& hsl).
+        \note This function has a C++ wrapper Simd::BgraToBayer(const View<A>& bgra, View<A>& bayer).
 
-        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] bgrStride - a row size of the bgr image.
-        \param [out] hsl - a pointer to pixels data of output 24-bit HSL image.
-        \param [in] hslStride - a row size of the hsl image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [out] bayer - a pointer to pixels data of output 8-bit Bayer image.
+        \param [in] bayerStride - a row size of the bayer image.
+        \param [in] bayerFormat - a format of the output bayer image. It can be ::SimdPixelFormatBayerGrbg, ::SimdPixelFormatBayerGbrg, ::SimdPixelFormatBayerRggb or ::SimdPixelFormatBayerBggr.
     */
-    SIMD_API void SimdBgrToHsl(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsl, size_t hslStride);
+    SIMD_API void SimdBgraToBayer(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat);
 
-    /*! @ingroup bgr_conversion
+    /*! @ingroup bgra_conversion
 
-        \fn void SimdBgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride);
+        \fn void SimdBgraToBgr(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bgr, size_t bgrStride);
 
-        \short Converts 24-bit BGR image to 24-bit HSV(Hue, Saturation, Value) image.
+        \short Converts 32-bit BGRA image to 24-bit BGR image.
 
         All images must have the same width and height.
 
-        \note This function has a C++ wrapper Simd::BgrToHsv(const View<A>& bgr, View<A>& hsv).
+        \note This function has a C++ wrapper Simd::BgraToBgr(const View<A>& bgra, View<A>& bgr).
 
-        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
         \param [in] width - an image width.
         \param [in] height - an image height.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
         \param [in] bgrStride - a row size of the bgr image.
-        \param [out] hsv - a pointer to pixels data of output 24-bit HSV image.
-        \param [in] hsvStride - a row size of the hsv image.
     */
-    SIMD_API void SimdBgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride);
+    SIMD_API void SimdBgraToBgr(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bgr, size_t bgrStride);
 
-    /*! @ingroup bgr_conversion
+    /*! @ingroup bgra_conversion
 
-        \fn void SimdBgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+        \fn void SimdBgraToRgb(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * rgb, size_t rgbStride);
 
-        \short Converts 24-bit BGR image to YUV420P.
+        \short Converts 32-bit BGRA image to 24-bit RGB image.
 
-        The input BGR and output Y images must have the same width and height.
-        The input U and V images must have the same width and height (half size relative to Y component).
+        All images must have the same width and height. The function also converts 32-bit RGBA image to 24-bit BGR image.
 
-        \note This function has a C++ wrapper Simd::BgrToYuv420p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v).
+        \note This function has a C++ wrapper Simd::BgraToRgb(const View<A>& bgra, View<A>& rgb).
 
-        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] bgrStride - a row size of the BGR image.
-        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
-        \param [in] yStride - a row size of the y image.
-        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
-        \param [in] uStride - a row size of the u image.
-        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
-        \param [in] vStride - a row size of the v image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
     */
-    SIMD_API void SimdBgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+    SIMD_API void SimdBgraToRgb(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * rgb, size_t rgbStride);
 
-    /*! @ingroup bgr_conversion
+    /*! @ingroup bgra_conversion
 
-        \fn void SimdBgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+        \fn void SimdBgraToGray(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * gray, size_t grayStride);
 
-        \short Converts 24-bit BGR image to YUV422P.
+        \short Converts 32-bit BGRA image to 8-bit gray image.
 
-        The input BGR and output Y images must have the same width and height.
-        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+        All images must have the same width and height.
 
-        \note This function has a C++ wrapper Simd::BgrToYuv422p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v).
+        \note This function has a C++ wrapper Simd::BgraToGray(const View<A>& bgra, View<A>& gray).
 
-        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] bgrStride - a row size of the BGR image.
-        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
-        \param [in] yStride - a row size of the y image.
-        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
-        \param [in] uStride - a row size of the u image.
-        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
-        \param [in] vStride - a row size of the v image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [out] gray - a pointer to pixels data of output 8-bit gray image.
+        \param [in] grayStride - a row size of the gray image.
     */
-    SIMD_API void SimdBgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+    SIMD_API void SimdBgraToGray(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * gray, size_t grayStride);
 
-    /*! @ingroup bgr_conversion
+    /*! @ingroup bgra_conversion
 
-        \fn void SimdBgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+        \fn void SimdBgraToNv12(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride);
 
-        \short Converts 24-bit BGR image to YUV444P.
+        \short Converts 32-bit BGRA image to NV12.
 
-        The input BGR and output Y, U and V images must have the same width and height.
+        The input BGRA and output Y images must have the same width and height.
+        The output UV image has interleaved U and V components (16 bits per pixel) and half size relative to Y component.
 
-        \note This function has a C++ wrapper Simd::BgrToYuv444p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v).
+        \note This function has a C++ wrapper Simd::BgraToNv12(const View<A>& bgra, View<A>& y, View<A>& uv).
 
-        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] bgrStride - a row size of the BGR image.
+        \param [in] bgraStride - a row size of the BGRA image.
         \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
         \param [in] yStride - a row size of the y image.
-        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
-        \param [in] uStride - a row size of the u image.
-        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
-        \param [in] vStride - a row size of the v image.
+        \param [out] uv - a pointer to pixels data of output image with interleaved U and V color planes.
+        \param [in] uvStride - a row size of the uv image.
     */
-    SIMD_API void SimdBgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+    SIMD_API void SimdBgraToNv12(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride);
 
-    /*! @ingroup binarization
-
-        \fn void SimdBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t value, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride, SimdCompareType compareType);
+    /*! @ingroup bgra_conversion
 
-        \short Performs binarization of 8-bit gray image.
+        \fn void SimdBgraToNv12V2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType);
 
-        All images must have 8-bit gray format and must have the same width and height.
+        \short Converts 32-bit BGRA image to NV12 with using of given YUV color matrix.
 
-        For every point:
-        \verbatim
-        dst[i] = compare(src[i], value) ? positive : negative;
-        \endverbatim
-        where compare(a, b) depends from compareType (see ::SimdCompareType).
+        The input BGRA and output Y images must have the same width and height.
+        The output UV image has interleaved U and V components (16 bits per pixel) and half size relative to Y component.
 
-        \note This function has a C++ wrapper Simd::Binarization(const View<A>& src, uint8_t value, uint8_t positive, uint8_t negative, View<A>& dst, SimdCompareType compareType).
+        \note This function has a C++ wrapper Simd::BgraToNv12(const View<A>& bgra, View<A>& y, View<A>& uv, SimdYuvType yuvType).
 
-        \param [in] src - a pointer to pixels data of input 8-bit gray image (first value for compare operation).
-        \param [in] srcStride - a row size of the src image.
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] value - a second value for compare operation.
-        \param [in] positive - a destination value if comparison operation has a positive result.
-        \param [in] negative - a destination value if comparison operation has a negative result.
-        \param [out] dst - a pointer to pixels data of output 8-bit gray binarized image.
-        \param [in] dstStride - a row size of the dst image.
-        \param [in] compareType - a compare operation type (see ::SimdCompareType).
+        \param [in] bgraStride - a row size of the BGRA image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] uv - a pointer to pixels data of output image with interleaved U and V color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
     */
-    SIMD_API void SimdBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-        uint8_t value, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride, SimdCompareType compareType);
+    SIMD_API void SimdBgraToNv12V2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType);
 
-    /*! @ingroup binarization
+    /*! @ingroup bgra_conversion
 
-        \fn void SimdAveragingBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t value, size_t neighborhood, uint8_t threshold, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride, SimdCompareType compareType);
+        \fn void SimdBgraToNv21(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * vu, size_t vuStride);
 
-        \short Performs averaging binarization of 8-bit gray image.
+        \short Converts 32-bit BGRA image to NV21.
 
-        All images must have 8-bit gray format and must have the same width and height.
+        The input BGRA and output Y images must have the same width and height.
+        The output VU image has interleaved V and U components (16 bits per pixel) and half size relative to Y component.
 
-        For every point:
-        \verbatim
-        sum = 0; area = 0;
-        for(dy = -neighborhood; dy <= neighborhood; ++dy)
-        {
-            for(dx = -neighborhood; dx <= neighborhood; ++dx)
-            {
-                if(x + dx >= 0 && x + dx < width && y + dy >= 0 && y + dy < height)
-                {
-                    area++;
-                    if(compare(src[x + dx, x + dy], value))
-                        sum++;
-                }
-            }
-        }
-        dst[x, y] = sum*255 > area*threshold ? positive : negative;
-        \endverbatim
-        where compare(a, b) depends from compareType (see ::SimdCompareType).
+        \note This function has a C++ wrapper Simd::BgraToNv21(const View<A>& bgra, View<A>& y, View<A>& vu).
 
-        \note This function has a C++ wrapper Simd::AveragingBinarization(const View<A>& src, uint8_t value, size_t neighborhood, uint8_t threshold, uint8_t positive, uint8_t negative, View<A>& dst, SimdCompareType compareType).
-
-        \param [in] src - a pointer to pixels data of input 8-bit gray image (first value for compare operation).
-        \param [in] srcStride - a row size of the src image.
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] value - a second value for compare operation.
-        \param [in] neighborhood - an averaging neighborhood.
-        \param [in] threshold - a threshold value for binarization. It can range from 0 to 255.
-        \param [in] positive - a destination value if for neighborhood of this point number of positive comparison is greater then threshold.
-        \param [in] negative - a destination value if for neighborhood of this point number of positive comparison is lesser or equal then threshold.
-        \param [out] dst - a pointer to pixels data of output 8-bit gray binarized image.
-        \param [in] dstStride - a row size of the dst image.
-        \param [in] compareType - a compare operation type (see ::SimdCompareType).
+        \param [in] bgraStride - a row size of the BGRA image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] vu - a pointer to pixels data of output image with interleaved V and U color planes.
+        \param [in] vuStride - a row size of the vu image.
     */
-    SIMD_API void SimdAveragingBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-        uint8_t value, size_t neighborhood, uint8_t threshold, uint8_t positive, uint8_t negative,
-        uint8_t * dst, size_t dstStride, SimdCompareType compareType);
+    SIMD_API void SimdBgraToNv21(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * vu, size_t vuStride);
 
-    /*! @ingroup conditional
+    /*! @ingroup bgra_conversion
 
-        \fn void SimdConditionalCount8u(const uint8_t * src, size_t stride, size_t width, size_t height, uint8_t value, SimdCompareType compareType, uint32_t * count);
+        \fn void SimdBgraToNv21V2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * vu, size_t vuStride, SimdYuvType yuvType);
 
-        \short Calculates number of points satisfying certain condition for 8-bit gray image.
+        \short Converts 32-bit BGRA image to NV21 with using of given YUV color matrix.
 
-        For every point:
-        \verbatim
-        if(compare(src[i], value))
-            count++;
-        \endverbatim
-        where compare(a, b) depends from compareType (see ::SimdCompareType).
+        The input BGRA and output Y images must have the same width and height.
+        The output VU image has interleaved V and U components (16 bits per pixel) and half size relative to Y component.
 
-        \note This function has a C++ wrapper Simd::ConditionalCount8u(const View<A> & src, uint8_t value, SimdCompareType compareType, uint32_t & count).
+        \note This function has a C++ wrapper Simd::BgraToNv21(const View<A>& bgra, View<A>& y, View<A>& vu, SimdYuvType yuvType).
 
-        \param [in] src - a pointer to pixels data of input 8-bit gray image (first value for compare operation).
-        \param [in] stride - a row size of the src image.
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] value - a second value for compare operation.
-        \param [in] compareType - a compare operation type (see ::SimdCompareType).
-        \param [out] count - a pointer to result unsigned 32-bit value.
+        \param [in] bgraStride - a row size of the BGRA image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] vu - a pointer to pixels data of output image with interleaved V and U color planes.
+        \param [in] vuStride - a row size of the vu image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
     */
-    SIMD_API void SimdConditionalCount8u(const uint8_t * src, size_t stride, size_t width, size_t height,
-        uint8_t value, SimdCompareType compareType, uint32_t * count);
+    SIMD_API void SimdBgraToNv21V2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * vu, size_t vuStride, SimdYuvType yuvType);
 
-    /*! @ingroup conditional
+    /*! @ingroup bgra_conversion
 
-        \fn void SimdConditionalCount16i(const uint8_t * src, size_t stride, size_t width, size_t height, int16_t value, SimdCompareType compareType, uint32_t * count);
+        \fn void SimdBgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
-        \short Calculates number of points satisfying certain condition for 16-bit signed integer image.
+        \short Converts 32-bit BGRA image to YUV420P.
 
-        For every point:
-        \verbatim
-        if(compare(src[i], value))
-            count++;
-        \endverbatim
-        where compare(a, b) depends from compareType (see ::SimdCompareType).
+        The input BGRA and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
 
-        \note This function has a C++ wrapper Simd::ConditionalCount16i(const View<A> & src, int16_t value, SimdCompareType compareType, uint32_t & count).
+        \note This function has a C++ wrapper Simd::BgraToYuv420p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v).
 
-        \param [in] src - a pointer to pixels data of input 16-bit signed integer image (first value for compare operation).
-        \param [in] stride - a row size of the src image.
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] value - a second value for compare operation.
-        \param [in] compareType - a compare operation type (see ::SimdCompareType).
-        \param [out] count - a pointer to result unsigned 32-bit value.
+        \param [in] bgraStride - a row size of the BGRA image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
     */
-    SIMD_API void SimdConditionalCount16i(const uint8_t * src, size_t stride, size_t width, size_t height,
-        int16_t value, SimdCompareType compareType, uint32_t * count);
-
-    /*! @ingroup conditional
+    SIMD_API void SimdBgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
-        \fn void SimdConditionalSum(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum);
+    /*! @ingroup bgra_conversion
 
-        \short Calculates sum of image points when mask points satisfying certain condition.
+        \fn void SimdBgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
 
-        All images must have 8-bit gray format and must have the same width and height.
+        \short Converts 32-bit BGRA image to YUV420P with using of given YUV color matrix.
 
-        For every point:
-        \verbatim
-        if(compare(mask[i], value))
-            sum += src[i];
-        \endverbatim
-        where compare(a, b) depends from compareType (see ::SimdCompareType).
+        The input BGRA and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
 
-        \note This function has a C++ wrapper Simd::ConditionalSum(const View<A> & src, const View<A> & mask, uint8_t value, SimdCompareType compareType, uint64_t & sum).
+        \note This function has a C++ wrapper Simd::BgraToYuv420p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType).
 
-        \param [in] src - a pointer to pixels data of input 8-bit gray image.
-        \param [in] srcStride - a row size of the src image.
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] mask - a pointer to pixels data of 8-bit gray mask (first value for compare operation).
-        \param [in] maskStride - a row size of the mask image.
-        \param [in] value - a second value for compare operation.
-        \param [in] compareType - a compare operation type (see ::SimdCompareType).
-        \param [out] sum - a pointer to result unsigned 64-bit value.
+        \param [in] bgraStride - a row size of the BGRA image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
     */
-    SIMD_API void SimdConditionalSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-        const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum);
-
-    /*! @ingroup conditional
+    SIMD_API void SimdBgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
 
-        \fn void SimdConditionalSquareSum(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum);
+    /*! @ingroup bgra_conversion
 
-        \short Calculates sum of squared image points when mask points satisfying certain condition.
+        \fn void SimdBgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
-        All images must have 8-bit gray format and must have the same width and height.
+        \short Converts 32-bit BGRA image to YUV422P.
 
-        For every point:
-        \verbatim
-        if(compare(mask[i], value))
-            sum += src[i]*src[i];
-        \endverbatim
-        where compare(a, b) depends from compareType (see ::SimdCompareType).
+        The input BGRA and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
 
-        \note This function has a C++ wrapper Simd::ConditionalSquareSum(const View<A> & src, const View<A> & mask, uint8_t value, SimdCompareType compareType, uint64_t & sum).
+        \note This function has a C++ wrapper Simd::BgraToYuv422p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v).
 
-        \param [in] src - a pointer to pixels data of input 8-bit gray image.
-        \param [in] srcStride - a row size of the src image.
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] mask - a pointer to pixels data of 8-bit gray mask (first value for compare operation).
-        \param [in] maskStride - a row size of the mask image.
-        \param [in] value - a second value for compare operation.
-        \param [in] compareType - a compare operation type (see ::SimdCompareType).
-        \param [out] sum - a pointer to result unsigned 64-bit value.
+        \param [in] bgraStride - a row size of the BGRA image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
     */
-    SIMD_API void SimdConditionalSquareSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-        const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum);
-
-    /*! @ingroup conditional
+    SIMD_API void SimdBgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
-        \fn void SimdConditionalSquareGradientSum(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum);
+    /*! @ingroup bgra_conversion
 
-        \short Calculates sum of squared gradient of image points when mask points satisfying certain condition.
+        \fn void SimdBgraToYuv422pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
 
-        All images must have 8-bit gray format and must have the same width and height. The image height and width must be equal or greater 3.
+        \short Converts 32-bit BGRA image to YUV422P with using of given YUV color matrix.
 
-        For every point except border:
-        \verbatim
-        if(compare(mask[x, y], value))
-        {
-            dx = src[x + 1, y] - src[x - 1, y];
-            dy = src[x, y + 1] - src[x, y - 1];
-            sum += dx*dx + dy*dy;
-        }
-        \endverbatim
-        where compare(a, b) depends from compareType (see ::SimdCompareType).
+        The input BGRA and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
 
-        \note This function has a C++ wrapper Simd::ConditionalSquareGradientSum(const View<A> & src, const View<A> & mask, uint8_t value, SimdCompareType compareType, uint64_t & sum).
+        \note This function has a C++ wrapper Simd::BgraToYuv422p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType).
 
-        \param [in] src - a pointer to pixels data of input 8-bit gray image.
-        \param [in] srcStride - a row size of the src image.
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] mask - a pointer to pixels data of 8-bit gray mask (first value for compare operation).
-        \param [in] maskStride - a row size of the mask image.
-        \param [in] value - a second value for compare operation.
-        \param [in] compareType - a compare operation type (see ::SimdCompareType).
-        \param [out] sum - a pointer to result unsigned 64-bit value.
+        \param [in] bgraStride - a row size of the BGRA image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
     */
-    SIMD_API void SimdConditionalSquareGradientSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-        const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum);
-
-    /*! @ingroup conditional
+    SIMD_API void SimdBgraToYuv422pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
 
-        \fn void SimdConditionalFill(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t threshold, SimdCompareType compareType, uint8_t value, uint8_t * dst, size_t dstStride);
+    /*! @ingroup bgra_conversion
 
-        \short Fills pixels of 8-bit gray image by given value if corresponding pixels of input 8-bit gray image satisfy certain condition.
+        \fn void SimdBgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
-        All images must have the same width and height.
+        \short Converts 32-bit BGRA image to YUV444P.
 
-        For every point:
-        \verbatim
-        if(compare(src[i], threshold))
-            dst[i] = value;
-        \endverbatim
-        where compare(a, b) depends from compareType (see ::SimdCompareType).
+        The input BGRA and output Y, U and V images must have the same width and height.
 
-        \note This function has a C++ wrapper Simd::ConditionalFill(const View<A> & src, uint8_t threshold, SimdCompareType compareType, uint8_t value, View<A> & dst).
+        \note This function has a C++ wrapper Simd::BgraToYuv444p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v).
 
-        \param [in] src - a pointer to pixels data of input 8-bit gray image.
-        \param [in] srcStride - a row size of input image.
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] threshold - a second value for compare operation.
-        \param [in] compareType - a compare operation type (see ::SimdCompareType).
-        \param [in] value - a value for fill operation.
-        \param [in, out] dst - a pointer to pixels data of the output 8-bit gray image.
-        \param [in] dstStride - a row size of output image.
+        \param [in] bgraStride - a row size of the BGRA image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
     */
-    SIMD_API void SimdConditionalFill(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-        uint8_t threshold, SimdCompareType compareType, uint8_t value, uint8_t * dst, size_t dstStride);
+    SIMD_API void SimdBgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
-    /*! @ingroup copying
+    /*! @ingroup bgra_conversion
 
-        \fn void SimdCopy(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, uint8_t * dst, size_t dstStride);
+        \fn void SimdBgraToYuv444pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
 
-        \short Copies pixels data of image from source to destination.
+        \short Converts 32-bit BGRA image to YUV444P with using of given YUV color matrix.
 
-        All images must have the same width, height and format.
+        The input BGRA and output Y, U and V images must have the same width and height.
 
-        \note This function has a C++ wrapper Simd::Copy(const View<A> & src, View<B> & dst).
+        \note This function has a C++ wrapper Simd::BgraToYuv444p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType).
 
-        \param [in] src - a pointer to pixels data of source image.
-        \param [in] srcStride - a row size of the src image.
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] pixelSize - a size of the image pixel.
-        \param [out] dst - a pointer to pixels data of destination image.
-        \param [in] dstStride - a row size of the dst image.
+        \param [in] bgraStride - a row size of the BGRA image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
     */
-    SIMD_API void SimdCopy(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, uint8_t * dst, size_t dstStride);
+    SIMD_API void SimdBgraToYuv444pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
 
-    /*! @ingroup copying
+    /*! @ingroup bgra_conversion
 
-        \fn void SimdCopyFrame(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, size_t frameLeft, size_t frameTop, size_t frameRight, size_t frameBottom, uint8_t * dst, size_t dstStride);
+        \fn void SimdBgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, uint8_t * a, size_t aStride);
 
-        \short Copies pixels data of image from source to destination except for the portion bounded frame.
+        \short Converts 32-bit BGRA image to YUVA420P.
 
-        All images must have the same width, height and format.
+        The input BGRA and output Y and A images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
 
-        \note This function has a C++ wrapper Simd::CopyFrame(const View<A>& src, const Rectangle<ptrdiff_t> & frame, View<A>& dst).
+        \note This function has a C++ wrapper Simd::BgraToYuva420p(const View<A> & bgra, View<A> & y, View<A> & u, View<A> & v, View<A> & a).
 
-        \param [in] src - a pointer to pixels data of source image.
-        \param [in] srcStride - a row size of the src image.
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the BGRA image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] pixelSize - a size of the image pixel.
-        \param [in] frameLeft - a frame left side.
-        \param [in] frameTop - a frame top side.
-        \param [in] frameRight - a frame right side.
-        \param [in] frameBottom - a frame bottom side.
-        \param [out] dst - a pointer to pixels data of destination image.
-        \param [in] dstStride - a row size of the dst image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [out] a - a pointer to pixels data of output 8-bit image with alpha plane.
+        \param [in] aStride - a row size of the a image.
     */
-    SIMD_API void SimdCopyFrame(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize,
-        size_t frameLeft, size_t frameTop, size_t frameRight, size_t frameBottom, uint8_t * dst, size_t dstStride);
+    SIMD_API void SimdBgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, 
+        uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, uint8_t * a, size_t aStride);
 
-    /*! @ingroup synet
-        Describes type of activation function. It is used in ::SimdConvolutionInit and ::SimdConvolutionSetParams.
-    */
-    typedef enum
-    {
-        /*!
-            Identity (activation function is absent).
-        */
-        SimdConvolutionActivationIdentity = 0,
-        /*!
-            ReLU activation function.
-            \verbatim
-            dst[i] = Max(0, src[i]);
-            \endverbatim
-        */
-        SimdConvolutionActivationRelu,
-        /*!
-            Leaky ReLU activation function.
-            It has one parameter: slope (params[0]).
-            \verbatim
-            dst[i] = src[i] > 0 ? src[i] : slope*src[i];
-            \endverbatim
-        */
-        SimdConvolutionActivationLeakyRelu,
-        /*!
-            The activation function restricts range.
-            It has two parameters: lower (params[0]) and upper (params[1]) bound.
-            \verbatim
-            dst[i] = Min(Max(lower, src[i]), upper);
-            \endverbatim
-        */
-        SimdConvolutionActivationRestrictRange,
-        /*!
-            Leaky PReLU activation function.
-            It has m parameters: slopes[m] (m = dstC, n = dstH*dstW).
-            \verbatim
-            dst[i*n + j] = src[i*n + j] > 0 ? src[i*n + j] : slopes[i]*src[i*n + j];
-            \endverbatim
-        */
-        SimdConvolutionActivationPrelu,
-    } SimdConvolutionActivationType;
+    /*! @ingroup bgr_conversion
 
-    /*! @ingroup synet
+        \fn void SimdBgrToBayer(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat);
 
-        \brief Callback function type "SimdGemm32fNNPtr";
+        \short Converts 24-bit BGR image to 8-bit Bayer image.
 
-        The function has to perform general matrix multiplication (for 32-bit float numbers).
+        All images must have the same width and height. The width and the height must be even.
 
-        \verbatim
-        C(M, N) = alpha*A(M, K)*B(K, N) + beta*C(M, N);
-        \endverbatim
+        \note This function has a C++ wrapper Simd::BgrToBayer(const View<A>& bgr, View<A>& bayer).
 
-        \param [in] M - a height of A and height of C matrices.
-        \param [in] N - a width of B and width of C matrices.
-        \param [in] K - a width of A and height of B matrices.
-        \param [in] alpha - a pointer to multiplier of the first term.
-        \param [in] A - a pointer to input A matrix.
-        \param [in] lda - a leading dimension of A matrix.
-        \param [in] B - a pointer to input B matrix.
-        \param [in] ldb - a leading dimension of B matrix.
-        \param [in] beta - a pointer to multiplier of the second term.
-        \param [out] C - a pointer to output C matrix.
-        \param [in] ldc - a leading dimension of C matrix.
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [out] bayer - a pointer to pixels data of output 8-bit Bayer image.
+        \param [in] bayerStride - a row size of the bayer image.
+        \param [in] bayerFormat - a format of the output bayer image. It can be ::SimdPixelFormatBayerGrbg, ::SimdPixelFormatBayerGbrg, ::SimdPixelFormatBayerRggb or ::SimdPixelFormatBayerBggr.
     */
-    typedef void(*SimdGemm32fNNPtr)(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
-
-    /*! @ingroup synet
+    SIMD_API void SimdBgrToBayer(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat);
 
-        \fn void * SimdConvolutionInit(SimdBool trans, size_t batch, size_t srcC, size_t srcH, size_t srcW, size_t dstC, size_t kernelY, size_t kernelX, size_t dilationY, size_t dilationX, size_t strideY, size_t strideX, size_t padY, size_t padX, size_t padH, size_t padW, size_t group, SimdConvolutionActivationType activation, SimdGemm32fNNPtr gemm);
-        
-        \short Initilizes convolution algorithm.
+    /*! @ingroup bgr_conversion
 
-        \param [in] trans - a flag of transposed input and output data (::SimdFalse - NCHW order, ::SimdTrue - NHWC order).
-        \param [in] batch - a batch size.
-        \param [in] srcC - a number of input channels.
-        \param [in] srcH - an input height.
-        \param [in] srcW - an input width.
-        \param [in] dstC - a number of output channels.
-        \param [in] kernelY - a height of the convolution kernel.
-        \param [in] kernelX - a width of the convolution kernel.
-        \param [in] dilationY - a y-dilation of the convolution.
-        \param [in] dilationX - a x-dilation of the convolution.
-        \param [in] strideY - a y-stride of the convolution.
-        \param [in] strideX - a x-stride of the convolution.
-        \param [in] padY - a pad to the top of the input image.
-        \param [in] padX - a pad to the left of the input image.
-        \param [in] padH - a pad to the bottom of the input image.
-        \param [in] padW - a pad to the right of the input image.
-        \param [in] group - a size of convolution group.
-        \param [in] activation - a type of activation function (see ::SimdConvolutionActivationType).
-        \param [in] gemm - a pointer to external function of matrix multiplication. Can be NULL.
-        \return a pointer to convolution context. On error it returns NULL. It must be released with using of function ::SimdRelease.
-            This pointer is used in functions ::SimdConvolutionExternalBufferSize, ::SimdConvolutionInternalBufferSize, ::SimdConvolutionSetParams and ::SimdConvolutionForward.
-    */
-    SIMD_API void * SimdConvolutionInit(SimdBool trans, size_t batch, size_t srcC, size_t srcH, size_t srcW, size_t dstC,  
-        size_t kernelY, size_t kernelX, size_t dilationY, size_t dilationX, size_t strideY, size_t strideX, 
-        size_t padY, size_t padX, size_t padH, size_t padW, size_t group, SimdConvolutionActivationType activation, SimdGemm32fNNPtr gemm);
+        \fn void SimdBgrToBgra(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
-    /*! @ingroup synet
+        \short Converts 24-bit BGR image to 32-bit BGRA image.
 
-        \fn size_t SimdConvolutionExternalBufferSize(const void * convolution);
+        All images must have the same width and height.
 
-        \short Gets size of external temporary buffer required for convolution algorithm.
+        \note This function has a C++ wrapper Simd::BgrToBgra(const View<A>& bgr, View<A>& bgra, uint8_t alpha).
 
-        \param [in] convolution - a pointer to convolution context. It must be created by function ::SimdConvolutionInit and released by function ::SimdRelease. 
-        \return size of external temporary buffer required for convolution algorithm.
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
     */
-    SIMD_API size_t SimdConvolutionExternalBufferSize(const void * convolution);
+    SIMD_API void SimdBgrToBgra(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
-    /*! @ingroup synet
+    /*! @ingroup bgr_conversion
 
-        \fn size_t SimdConvolutionInternalBufferSize(const void * convolution);
+        \fn void SimdBgrToRgba(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * rgba, size_t rgbaStride, uint8_t alpha);
 
-        \short Gets size of internal buffer used inside convolution algorithm.
+        \short Converts 24-bit BGR image to 32-bit RGBA image.
 
-        \param [in] convolution - a pointer to convolution context. It must be created by function ::SimdConvolutionInit and released by function ::SimdRelease.
-        \return size of internal buffer used inside convolution algorithm.
-    */
-    SIMD_API size_t SimdConvolutionInternalBufferSize(const void * convolution);
+        All images must have the same width and height. The function also converts 24-bit RGB image to 32-bit BGRA image.
 
-    /*! @ingroup synet
+        \note This function has a C++ wrapper Simd::BgrToRgba(const View<A>& bgr, View<A>& rgba, uint8_t alpha).
 
-        \fn void SimdConvolutionSetParams(void * convolution, const float * weight, SimdBool trans, SimdBool * internal, const float * bias, const float * params);
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [out] rgba - a pointer to pixels data of output 32-bit RGBA image.
+        \param [in] rgbaStride - a row size of the rgba image.
+        \param [in] alpha - a value of alpha channel.
+    */
+    SIMD_API void SimdBgrToRgba(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * rgba, size_t rgbaStride, uint8_t alpha);
 
-        \short Sets weights, beases and parameters of activation function required for convolution algorithm.
+    /*! @ingroup other_conversion
 
-        \param [in, out] convolution - a pointer to convolution context. It must be created by function ::SimdConvolutionInit and released by function ::SimdRelease.
-        \param [in] weight - a pointer to convolution weights.
-        \param [in] trans - a flag of transposed weight data (::SimdFalse - DCHW order, ::SimdTrue - HWCD order).
-        \param [out] internal - a flag signalized that weight is stored in the internal buffer. Can be NULL.
-        \param [in] bias - a pointer to bias. Can be NULL.
-        \param [in] params - a pointer to parameters of activation functions (see ::SimdConvolutionActivationType). Can be NULL.
-    */
-    SIMD_API void SimdConvolutionSetParams(void * convolution, const float * weight, SimdBool trans, SimdBool * internal, const float * bias, const float * params);
+        \fn void SimdBgr48pToBgra32(const uint8_t * blue, size_t blueStride, size_t width, size_t height, const uint8_t * green, size_t greenStride, const uint8_t * red, size_t redStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
-    /*! @ingroup synet
+        \short Converts 48-bit planar BGR image to 32-bit BGRA image.
 
-        \fn void SimdConvolutionForward(void * convolution, const float * src, float * buf, float * dst);
+        All images must have the same width and height.
 
-        \short Performs forward propagation of convolution algorithm.
+        \note This function has a C++ wrapper Simd::Bgr48pToBgra32(const View<A>& blue, const View<A>& green, const View<A>& red, View<A>& bgra, uint8_t alpha).
 
-        \param [in] convolution - a pointer to convolution context. It must be created by function ::SimdConvolutionInit and released by function ::SimdRelease.
-        \param [in] src - a pointer to input image.
-        \param [out] buf - a pointer to external temporary buffer. The size of the external temporary buffer is determined by function ::SimdConvolutionExternalBufferSize. Can be NULL (it causes usage of internal buffer).
-        \param [out] dst - a pointer to output image.
+        \param [in] blue - a pointer to pixels data of input 16-bit image with blue color plane.
+        \param [in] blueStride - a row size of the blue image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] green - a pointer to pixels data of input 16-bit image with green color plane.
+        \param [in] greenStride - a row size of the blue image.
+        \param [in] red - a pointer to pixels data of input 16-bit image with red color plane.
+        \param [in] redStride - a row size of the red image.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
     */
-    SIMD_API void SimdConvolutionForward(void * convolution, const float * src, float * buf, float * dst);
+    SIMD_API void SimdBgr48pToBgra32(const uint8_t * blue, size_t blueStride, size_t width, size_t height,
+        const uint8_t * green, size_t greenStride, const uint8_t * red, size_t redStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
-    /*! @ingroup other_conversion
+    /*! @ingroup bgr_conversion
 
-        \fn void SimdDeinterleaveUv(const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+        \fn void SimdBgrToGray(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * gray, size_t grayStride);
 
-        \short Deinterleaves 16-bit UV interleaved image into separated 8-bit U and V planar images.
+        \short Converts 24-bit BGR image to 8-bit gray image.
 
         All images must have the same width and height.
-        This function used for NV12 to YUV420P conversion.
 
-        \note This function has a C++ wrapper Simd::DeinterleaveUv(const View<A>& uv, View<A>& u, View<A>& v).
+        \note This function has a C++ wrapper Simd::BgrToGray(const View<A>& bgr, View<A>& gray).
 
-        \param [in] uv - a pointer to pixels data of input 16-bit UV interleaved image.
-        \param [in] uvStride - a row size of the uv image.
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [out] u - a pointer to pixels data of 8-bit U planar image.
-        \param [in] uStride - a row size of the u image.
-        \param [out] v - a pointer to pixels data of 8-bit V planar image.
-        \param [in] vStride - a row size of the v image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [out] gray - a pointer to pixels data of output 8-bit gray image.
+        \param [in] grayStride - a row size of the gray image.
     */
-    SIMD_API void SimdDeinterleaveUv(const uint8_t * uv, size_t uvStride, size_t width, size_t height,
-        uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+    SIMD_API void SimdBgrToGray(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * gray, size_t grayStride);
 
-    /*! @ingroup other_conversion
+    /*! @ingroup bgr_conversion
 
-        \fn void SimdDeinterleaveBgr(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * b, size_t bStride, uint8_t * g, size_t gStride, uint8_t * r, size_t rStride);
+        \fn void SimdBgrToHsl(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsl, size_t hslStride);
 
-        \short Deinterleaves 24-bit BGR interleaved image into separated 8-bit Blue, Green and Red planar images.
+        \short Converts 24-bit BGR image to 24-bit HSL(Hue, Saturation, Lightness) image.
 
         All images must have the same width and height.
 
-        \note This function has a C++ wrapper Simd::DeinterleaveBgr(const View<A>& bgr, View<A>& b, View<A>& g, View<A>& r).
+        \note This function has a C++ wrapper Simd::BgrToHsl(const View<A>& bgr, View<A>& hsl).
 
-        \param [in] bgr - a pointer to pixels data of input 24-bit BGR interleaved image.
-        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [out] b - a pointer to pixels data of 8-bit Blue planar image.
-        \param [in] bStride - a row size of the b image.
-        \param [out] g - a pointer to pixels data of 8-bit Green planar image.
-        \param [in] gStride - a row size of the g image.
-        \param [out] r - a pointer to pixels data of 8-bit Red planar image.
-        \param [in] rStride - a row size of the r image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [out] hsl - a pointer to pixels data of output 24-bit HSL image.
+        \param [in] hslStride - a row size of the hsl image.
     */
-    SIMD_API void SimdDeinterleaveBgr(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height,
-        uint8_t * b, size_t bStride, uint8_t * g, size_t gStride, uint8_t * r, size_t rStride);
+    SIMD_API void SimdBgrToHsl(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsl, size_t hslStride);
 
-    /*! @ingroup other_conversion
+    /*! @ingroup bgr_conversion
 
-        \fn void SimdDeinterleaveBgra(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * b, size_t bStride, uint8_t * g, size_t gStride, uint8_t * r, size_t rStride, uint8_t * a, size_t aStride);
+        \fn void SimdBgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride);
 
-        \short Deinterleaves 32-bit BGRA interleaved image into separated 8-bit Blue, Green, Red and Alpha planar images.
+        \short Converts 24-bit BGR image to 24-bit HSV(Hue, Saturation, Value) image.
 
         All images must have the same width and height.
 
-        \note This function has a C++ wrapper Simd::DeinterleaveBgra(const View<A>& bgra, View<A>& b, View<A>& g, View<A>& r, View<A>& a).
+        \note This function has a C++ wrapper Simd::BgrToHsv(const View<A>& bgr, View<A>& hsv).
 
-        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA interleaved image.
-        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [out] b - a pointer to pixels data of 8-bit Blue planar image.
-        \param [in] bStride - a row size of the b image.
-        \param [out] g - a pointer to pixels data of 8-bit Green planar image.
-        \param [in] gStride - a row size of the g image.
-        \param [out] r - a pointer to pixels data of 8-bit Red planar image.
-        \param [in] rStride - a row size of the r image.
-        \param [out] a - a pointer to pixels data of 8-bit Alpha planar image.
-        \param [in] aStride - a row size of the a image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [out] hsv - a pointer to pixels data of output 24-bit HSV image.
+        \param [in] hsvStride - a row size of the hsv image.
     */
-    SIMD_API void SimdDeinterleaveBgra(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height,
-        uint8_t * b, size_t bStride, uint8_t * g, size_t gStride, uint8_t * r, size_t rStride, uint8_t * a, size_t aStride);
-
-    /*! @ingroup object_detection
-
-        \fn void * SimdDetectionLoadA(const char * path);
-
-        \short Loads a classifier cascade from file.
-
-        This function supports OpenCV HAAR and LBP cascades type.
-        Tree based cascades and old cascade formats are not supported.
+    SIMD_API void SimdBgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride);
 
-        \note This function is used for implementation of Simd::Detection.
+    /*! @ingroup bgr_conversion
 
-        \param [in] path - a path to cascade.
-        \return a pointer to loaded cascade. On error it returns NULL.
-                This pointer is used in functions ::SimdDetectionInfo and ::SimdDetectionInit, and must be released with using of function ::SimdRelease.
-    */
-    SIMD_API void * SimdDetectionLoadA(const char * path);
+        \fn void SimdBgrToHsvInRange(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, const uint8_t * lower, const uint8_t * upper, uint8_t * mask, size_t maskStride);
 
-    /*! @ingroup object_detection
+        \short Builds a mask of pixels of 24-bit BGR image which HSV values lie in the given range.
 
-        \fn void SimdDetectionInfo(const void * data, size_t * width, size_t * height, SimdDetectionInfoFlags * flags);
+        All images must have the same width and height. HSV values are the same as produced by function ::SimdBgrToHsv, but the HSV image is not stored.
 
-        \short Gets information about the classifier cascade.
+        For every point:
+        \verbatim
+        hsv = BgrToHsv(bgr[x, y]);
+        hue = lower[0] <= upper[0] ? (lower[0] <= hsv[0] && hsv[0] <= upper[0]) : (lower[0] <= hsv[0] || hsv[0] <= upper[0]);
+        mask[x, y] = hue && lower[1] <= hsv[1] && hsv[1] <= upper[1] && lower[2] <= hsv[2] && hsv[2] <= upper[2] ? 255 : 0;
+        \endverbatim
+        If lower[0] is greater than upper[0] the hue range wraps around red (value 0).
 
-        \note This function is used for implementation of Simd::Detection.
+        \note This function has a C++ wrapper Simd::BgrToHsvInRange(const View<A>& bgr, const uint8_t * lower, const uint8_t * upper, View<A>& mask).
 
-        \param [in] data - a pointer to cascade which was received with using of function ::SimdDetectionLoadA.
-        \param [out] width - a pointer to returned width of cascade window.
-        \param [out] height - a pointer to returned height of cascade window.
-        \param [out] flags - a pointer to flags with other information (See ::SimdDetectionInfoFlags).
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] lower - a pointer to 3 inclusive lower bounds of hue, saturation and value.
+        \param [in] upper - a pointer to 3 inclusive upper bounds of hue, saturation and value.
+        \param [out] mask - a pointer to pixels data of output 8-bit gray mask.
+        \param [in] maskStride - a row size of the mask image.
     */
-    SIMD_API void SimdDetectionInfo(const void * data, size_t * width, size_t * height, SimdDetectionInfoFlags * flags);
+    SIMD_API void SimdBgrToHsvInRange(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, const uint8_t * lower, const uint8_t * upper, uint8_t * mask, size_t maskStride);
 
-    /*! @ingroup object_detection
+    /*! @ingroup bgr_conversion
 
-        \fn void * SimdDetectionInit(const void * data, uint8_t * sum, size_t sumStride, size_t width, size_t height, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride, int throughColumn, int int16);
+        \fn void SimdBgrToLab(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * lab, size_t labStride);
 
-        \short Initializes hidden classifier cascade structure to work with given size of input 8-bit gray image.
+        \short Converts 24-bit BGR image to 24-bit CIE Lab image.
 
-        \note This function is used for implementation of Simd::Detection.
+        All images must have the same width and height. BGR values are treated as sRGB with D65 white point.
+        Output values are stored in the same way as OpenCV does it for 8-bit images:
+        \verbatim
+        lab[0] = L*255/100;
+        lab[1] = a + 128;
+        lab[2] = b + 128;
+        \endverbatim
+        sRGB gamma decoding uses a lookup table, cube root is computed with Newton iterations.
 
-        \param [in] data - a pointer to cascade which was received with using of function ::SimdDetectionLoadA.
-        \param [in] sum - a pointer to pixels data of 32-bit integer image with integral sum of given input 8-bit gray image.
-                          See function ::SimdIntegral in order to estimate this integral sum.
-        \param [in] sumStride - a row size of the sum image.
-        \param [in] width - a width of the sum image. It must be per unit greater than width of input 8-bit gray image.
-        \param [in] height - a height of the sum image. It must be per unit greater than height of input 8-bit gray image.
-        \param [in] sqsum - a pointer to pixels data of 32-bit integer image with squared integral sum of given input 8-bit gray image.
-                            Its size must be equal to sum image. See function ::SimdIntegral in order to estimate this squared integral sum. Its
-        \param [in] sqsumStride - a row size of the sqsum image.
-        \param [in] tilted - a pointer to pixels data of 32-bit integer image with tilted integral sum of given input 8-bit gray image.
-                             Its size must be equal to sum image. See function ::SimdIntegral in order to estimate this tilted integral sum.
-        \param [in] tiltedStride - a row size of the tilted image.
-        \param [in] throughColumn - a flag to detect objects only in even columns and rows (to increase performance).
-        \param [in] int16 - a flag use for 16-bit integer version of detection algorithm. (See ::SimdDetectionInfo).
-        \return a pointer to hidden cascade. On error it returns NULL.
-                This pointer is used in functions ::SimdDetectionPrepare, ::SimdDetectionHaarDetect32fp, ::SimdDetectionHaarDetect32fi,
-                ::SimdDetectionLbpDetect32fp, ::SimdDetectionLbpDetect32fi, ::SimdDetectionLbpDetect16ip and ::SimdDetectionLbpDetect16ii.
-                It must be released with using of function ::SimdRelease.
+        \note This function has a C++ wrapper Simd::BgrToLab(const View<A>& bgr, View<A>& lab).
+
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [out] lab - a pointer to pixels data of output 24-bit Lab image.
+        \param [in] labStride - a row size of the lab image.
     */
-    SIMD_API void * SimdDetectionInit(const void * data, uint8_t * sum, size_t sumStride, size_t width, size_t height,
-        uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride, int throughColumn, int int16);
+    SIMD_API void SimdBgrToLab(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * lab, size_t labStride);
 
-    /*! @ingroup object_detection
+    /*! @ingroup bgr_conversion
 
-        \fn void SimdDetectionPrepare(void * hid);
+        \fn void SimdBgrToLab32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * lab, size_t labStride);
 
-        \short Prepares hidden classifier cascade structure to work with given input 8-bit gray image.
+        \short Converts 24-bit BGR image to CIE Lab image with 32-bit float channels.
 
-        You must call this function before calling of functions ::SimdDetectionHaarDetect32fp, ::SimdDetectionHaarDetect32fi,
-         ::SimdDetectionLbpDetect32fp, ::SimdDetectionLbpDetect32fi, ::SimdDetectionLbpDetect16ip and ::SimdDetectionLbpDetect16ii.
+        All images must have the same width and height. The output image contains 3 interleaved float values (L, a, b) for every pixel,
+        L is in range [0..100]. The conversion is the same as in function ::SimdBgrToLab, but without scaling and rounding of output values.
 
-        \note This function is used for implementation of Simd::Detection.
+        \note This function has a C++ wrapper Simd::BgrToLab32f(const View<A>& bgr, View<A>& lab).
 
-        \param [in] hid - a pointer to hidden cascade which was received with using of function ::SimdDetectionInit.
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [out] lab - a pointer to pixels data of output 32-bit float Lab image.
+        \param [in] labStride - a row size of the lab image (in bytes).
     */
-    SIMD_API void SimdDetectionPrepare(void * hid);
+    SIMD_API void SimdBgrToLab32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * lab, size_t labStride);
 
-    /*! @ingroup object_detection
+    /*! @ingroup bgr_conversion
 
-        \fn void SimdDetectionHaarDetect32fp(const void * hid, const uint8_t * mask, size_t maskStride, ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
+        \fn void SimdBgrToYCoCgR(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * co, size_t coStride, uint8_t * cg, size_t cgStride);
 
-        \short Performs object detection with using of HAAR cascade classifier (uses 32-bit float numbers, processes all points).
+        \short Converts 24-bit BGR image to reversible YCoCg-R planes.
 
-        You must call function ::SimdDetectionPrepare before calling of this functions.
-        All restriction (input mask and bounding box) affects to left-top corner of scanning window.
+        All images must have the same width and height. Y plane has 8-bit unsigned values, Co and Cg planes have 16-bit signed values in range [-255..255].
+        The conversion uses integer lifting and is exactly inverted by function ::SimdYCoCgRToBgr:
+        \verbatim
+        co = red - blue;
+        t = blue + (co >> 1);
+        cg = green - t;
+        y = t + (cg >> 1);
+        \endverbatim
 
-        \note This function is used for implementation of Simd::Detection.
+        \note This function has a C++ wrapper Simd::BgrToYCoCgR(const View<A>& bgr, View<A>& y, View<A>& co, View<A>& cg).
 
-        \param [in] hid - a pointer to hidden cascade which was received with using of function ::SimdDetectionInit.
-        \param [in] mask - a pointer to pixels data of 8-bit image with mask. The mask restricts detection region.
-        \param [in] maskStride - a row size of the mask image.
-        \param [in] left - a left side of bounding box which restricts detection region.
-        \param [in] top - a top side of bounding box which restricts detection region.
-        \param [in] right - a right side of bounding box which restricts detection region.
-        \param [in] bottom - a bottom side of bounding box which restricts detection region.
-        \param [out] dst - a pointer to pixels data of 8-bit image with output result. None zero points refer to left-top corner of detected objects.
-        \param [in] dstStride - a row size of the dst image.
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [out] y - a pointer to pixels data of output 8-bit Y plane.
+        \param [in] yStride - a row size of the y plane.
+        \param [out] co - a pointer to pixels data of output 16-bit Co plane.
+        \param [in] coStride - a row size of the co plane (in bytes).
+        \param [out] cg - a pointer to pixels data of output 16-bit Cg plane.
+        \param [in] cgStride - a row size of the cg plane (in bytes).
     */
-    SIMD_API void SimdDetectionHaarDetect32fp(const void * hid, const uint8_t * mask, size_t maskStride,
-        ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
+    SIMD_API void SimdBgrToYCoCgR(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * co, size_t coStride, uint8_t * cg, size_t cgStride);
 
-    /*! @ingroup object_detection
+    /*! @ingroup bgr_conversion
 
-        \fn void SimdDetectionHaarDetect32fi(const void * hid, const uint8_t * mask, size_t maskStride, ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
+        \fn void SimdBgrToNv12(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride);
 
-        \short Performs object detection with using of HAAR cascade classifier (uses 32-bit float numbers, processes only even points).
+        \short Converts 24-bit BGR image to NV12.
 
-        You must call function ::SimdDetectionPrepare before calling of this functions.
-        All restriction (input mask and bounding box) affects to left-top corner of scanning window.
+        The input BGR and output Y images must have the same width and height.
+        The output UV image has interleaved U and V components (16 bits per pixel) and half size relative to Y component.
 
-        \note This function is used for implementation of Simd::Detection.
+        \note This function has a C++ wrapper Simd::BgrToNv12(const View<A>& bgr, View<A>& y, View<A>& uv).
 
-        \param [in] hid - a pointer to hidden cascade which was received with using of function ::SimdDetectionInit.
-        \param [in] mask - a pointer to pixels data of 8-bit image with mask. The mask restricts detection region.
-        \param [in] maskStride - a row size of the mask image.
-        \param [in] left - a left side of bounding box which restricts detection region.
-        \param [in] top - a top side of bounding box which restricts detection region.
-        \param [in] right - a right side of bounding box which restricts detection region.
-        \param [in] bottom - a bottom side of bounding box which restricts detection region.
-        \param [out] dst - a pointer to pixels data of 8-bit image with output result. None zero points refer to left-top corner of detected objects.
-        \param [in] dstStride - a row size of the dst image.
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the BGR image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] uv - a pointer to pixels data of output image with interleaved U and V color planes.
+        \param [in] uvStride - a row size of the uv image.
     */
-    SIMD_API void SimdDetectionHaarDetect32fi(const void * hid, const uint8_t * mask, size_t maskStride,
-        ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
+    SIMD_API void SimdBgrToNv12(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride);
 
-    /*! @ingroup object_detection
+    /*! @ingroup bgr_conversion
 
-        \fn void SimdDetectionLbpDetect32fp(const void * hid, const uint8_t * mask, size_t maskStride, ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
+        \fn void SimdBgrToNv12V2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType);
 
-        \short Performs object detection with using of LBP cascade classifier (uses 32-bit float numbers, processes all points).
+        \short Converts 24-bit BGR image to NV12 with using of given YUV color matrix.
 
-        You must call function ::SimdDetectionPrepare before calling of this functions.
-        All restriction (input mask and bounding box) affects to left-top corner of scanning window.
+        The input BGR and output Y images must have the same width and height.
+        The output UV image has interleaved U and V components (16 bits per pixel) and half size relative to Y component.
 
-        \note This function is used for implementation of Simd::Detection.
+        \note This function has a C++ wrapper Simd::BgrToNv12(const View<A>& bgr, View<A>& y, View<A>& uv, SimdYuvType yuvType).
 
-        \param [in] hid - a pointer to hidden cascade which was received with using of function ::SimdDetectionInit.
-        \param [in] mask - a pointer to pixels data of 8-bit image with mask. The mask restricts detection region.
-        \param [in] maskStride - a row size of the mask image.
-        \param [in] left - a left side of bounding box which restricts detection region.
-        \param [in] top - a top side of bounding box which restricts detection region.
-        \param [in] right - a right side of bounding box which restricts detection region.
-        \param [in] bottom - a bottom side of bounding box which restricts detection region.
-        \param [out] dst - a pointer to pixels data of 8-bit image with output result. None zero points refer to left-top corner of detected objects.
-        \param [in] dstStride - a row size of the dst image.
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the BGR image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] uv - a pointer to pixels data of output image with interleaved U and V color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
     */
-    SIMD_API void SimdDetectionLbpDetect32fp(const void * hid, const uint8_t * mask, size_t maskStride,
-        ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
+    SIMD_API void SimdBgrToNv12V2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType);
 
-    /*! @ingroup object_detection
+    /*! @ingroup bgr_conversion
 
-        \fn void SimdDetectionLbpDetect32fi(const void * hid, const uint8_t * mask, size_t maskStride, ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
+        \fn void SimdBgrToNv21(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * vu, size_t vuStride);
 
-        \short Performs object detection with using of LBP cascade classifier (uses 32-bit float numbers, processes only even points).
+        \short Converts 24-bit BGR image to NV21.
 
-        You must call function ::SimdDetectionPrepare before calling of this functions.
-        All restriction (input mask and bounding box) affects to left-top corner of scanning window.
+        The input BGR and output Y images must have the same width and height.
+        The output VU image has interleaved V and U components (16 bits per pixel) and half size relative to Y component.
 
-        \note This function is used for implementation of Simd::Detection.
+        \note This function has a C++ wrapper Simd::BgrToNv21(const View<A>& bgr, View<A>& y, View<A>& vu).
 
-        \param [in] hid - a pointer to hidden cascade which was received with using of function ::SimdDetectionInit.
-        \param [in] mask - a pointer to pixels data of 8-bit image with mask. The mask restricts detection region.
-        \param [in] maskStride - a row size of the mask image.
-        \param [in] left - a left side of bounding box which restricts detection region.
-        \param [in] top - a top side of bounding box which restricts detection region.
-        \param [in] right - a right side of bounding box which restricts detection region.
-        \param [in] bottom - a bottom side of bounding box which restricts detection region.
-        \param [out] dst - a pointer to pixels data of 8-bit image with output result. None zero points refer to left-top corner of detected objects.
-        \param [in] dstStride - a row size of the dst image.
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the BGR image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] vu - a pointer to pixels data of output image with interleaved V and U color planes.
+        \param [in] vuStride - a row size of the vu image.
     */
-    SIMD_API void SimdDetectionLbpDetect32fi(const void * hid, const uint8_t * mask, size_t maskStride,
-        ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
+    SIMD_API void SimdBgrToNv21(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * vu, size_t vuStride);
 
-    /*! @ingroup object_detection
+    /*! @ingroup bgr_conversion
 
-        \fn void SimdDetectionLbpDetect16ip(const void * hid, const uint8_t * mask, size_t maskStride, ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
+        \fn void SimdBgrToNv21V2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * vu, size_t vuStride, SimdYuvType yuvType);
 
-        \short Performs object detection with using of LBP cascade classifier (uses 16-bit integer numbers, processes all points).
+        \short Converts 24-bit BGR image to NV21 with using of given YUV color matrix.
 
-        You must call function ::SimdDetectionPrepare before calling of this functions.
-        All restriction (input mask and bounding box) affects to left-top corner of scanning window.
+        The input BGR and output Y images must have the same width and height.
+        The output VU image has interleaved V and U components (16 bits per pixel) and half size relative to Y component.
 
-        \note This function is used for implementation of Simd::Detection.
+        \note This function has a C++ wrapper Simd::BgrToNv21(const View<A>& bgr, View<A>& y, View<A>& vu, SimdYuvType yuvType).
 
-        \param [in] hid - a pointer to hidden cascade which was received with using of function ::SimdDetectionInit.
-        \param [in] mask - a pointer to pixels data of 8-bit image with mask. The mask restricts detection region.
-        \param [in] maskStride - a row size of the mask image.
-        \param [in] left - a left side of bounding box which restricts detection region.
-        \param [in] top - a top side of bounding box which restricts detection region.
-        \param [in] right - a right side of bounding box which restricts detection region.
-        \param [in] bottom - a bottom side of bounding box which restricts detection region.
-        \param [out] dst - a pointer to pixels data of 8-bit image with output result. None zero points refer to left-top corner of detected objects.
-        \param [in] dstStride - a row size of the dst image.
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the BGR image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] vu - a pointer to pixels data of output image with interleaved V and U color planes.
+        \param [in] vuStride - a row size of the vu image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
     */
-    SIMD_API void SimdDetectionLbpDetect16ip(const void * hid, const uint8_t * mask, size_t maskStride,
-        ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
+    SIMD_API void SimdBgrToNv21V2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * vu, size_t vuStride, SimdYuvType yuvType);
 
-    /*! @ingroup object_detection
+    /*! @ingroup bgr_conversion
 
-        \fn void SimdDetectionLbpDetect16ii(const void * hid, const uint8_t * mask, size_t maskStride, ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
+        \fn void SimdBgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
-        \short Performs object detection with using of LBP cascade classifier (uses 16-bit integer numbers, processes only even points).
+        \short Converts 24-bit BGR image to YUV420P.
 
-        You must call function ::SimdDetectionPrepare before calling of this functions.
-        All restriction (input mask and bounding box) affects to left-top corner of scanning window.
+        The input BGR and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
 
-        \note This function is used for implementation of Simd::Detection.
+        \note This function has a C++ wrapper Simd::BgrToYuv420p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v).
 
-        \param [in] hid - a pointer to hidden cascade which was received with using of function ::SimdDetectionInit.
-        \param [in] mask - a pointer to pixels data of 8-bit image with mask. The mask restricts detection region.
-        \param [in] maskStride - a row size of the mask image.
-        \param [in] left - a left side of bounding box which restricts detection region.
-        \param [in] top - a top side of bounding box which restricts detection region.
-        \param [in] right - a right side of bounding box which restricts detection region.
-        \param [in] bottom - a bottom side of bounding box which restricts detection region.
-        \param [out] dst - a pointer to pixels data of 8-bit image with output result. None zero points refer to left-top corner of detected objects.
-        \param [in] dstStride - a row size of the dst image.
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the BGR image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
     */
-    SIMD_API void SimdDetectionLbpDetect16ii(const void * hid, const uint8_t * mask, size_t maskStride,
-        ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
+    SIMD_API void SimdBgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
-    /*! @ingroup edge_background
+    /*! @ingroup bgr_conversion
 
-        \fn void SimdEdgeBackgroundGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * background, size_t backgroundStride);
+        \fn void SimdBgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
 
-        \short Performs edge background update (initial grow, slow mode).
+        \short Converts 24-bit BGR image to YUV420P with using of given YUV color matrix.
 
-        All images must have the same width, height and format (8-bit gray).
+        The input BGR and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
 
-        For every point:
-        \verbatim
-        background[i] += value[i] > background[i] ? 1 : 0;
-        \endverbatim
+        \note This function has a C++ wrapper Simd::BgrToYuv420p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType).
 
-        This function is used for edge background updating in motion detection algorithm.
-
-        \note This function has a C++ wrapper Simd::EdgeBackgroundGrowRangeSlow(const View<A>& value, View<A>& background).
-
-        \param [in] value - a pointer to pixels data of current feature value.
-        \param [in] valueStride - a row size of the value image.
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in, out] background - a pointer to pixels data of feature value of edge dynamic background.
-        \param [in] backgroundStride - a row size of the background image.
+        \param [in] bgrStride - a row size of the BGR image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
     */
-    SIMD_API void SimdEdgeBackgroundGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height,
-        uint8_t * background, size_t backgroundStride);
+    SIMD_API void SimdBgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
 
-    /*! @ingroup edge_background
+    /*! @ingroup bgr_conversion
 
-        \fn void SimdEdgeBackgroundGrowRangeFast(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * background, size_t backgroundStride);
+        \fn void SimdBgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
-        \short Performs edge background update (initial grow, fast mode).
+        \short Converts 24-bit BGR image to YUV422P.
 
-        All images must have the same width, height and format (8-bit gray).
+        The input BGR and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
 
-        For every point:
-        \verbatim
-        background[i] = value[i] > background[i] ? value[i] : background[i];
-        \endverbatim
+        \note This function has a C++ wrapper Simd::BgrToYuv422p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v).
 
-        This function is used for edge background updating in motion detection algorithm.
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the BGR image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+    */
+    SIMD_API void SimdBgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
-        \note This function has a C++ wrapper Simd::EdgeBackgroundGrowRangeFast(const View<A>& value, View<A>& background).
+    /*! @ingroup bgr_conversion
 
-        \param [in] value - a pointer to pixels data of current feature value.
-        \param [in] valueStride - a row size of the value image.
+        \fn void SimdBgrToYuv422pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+        \short Converts 24-bit BGR image to YUV422P with using of given YUV color matrix.
+
+        The input BGR and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \note This function has a C++ wrapper Simd::BgrToYuv422p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType).
+
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in, out] background - a pointer to pixels data of feature value of edge dynamic background.
-        \param [in] backgroundStride - a row size of the background image.
+        \param [in] bgrStride - a row size of the BGR image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
     */
-    SIMD_API void SimdEdgeBackgroundGrowRangeFast(const uint8_t * value, size_t valueStride, size_t width, size_t height,
-        uint8_t * background, size_t backgroundStride);
+    SIMD_API void SimdBgrToYuv422pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
 
-    /*! @ingroup edge_background
+    /*! @ingroup bgr_conversion
 
-        \fn void SimdEdgeBackgroundIncrementCount(const uint8_t * value, size_t valueStride, size_t width, size_t height, const uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t * backgroundCount, size_t backgroundCountStride);
+        \fn void SimdBgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
-        \short Performs collection of edge background statistic.
+        \short Converts 24-bit BGR image to YUV444P.
 
-        All images must have the same width, height and format (8-bit gray).
+        The input BGR and output Y, U and V images must have the same width and height.
 
-        Updates background statistic counters for every point:
-        \verbatim
-        backgroundCount[i] += (value[i] > backgroundValue[i] && backgroundCount[i] < 255) ? 1 : 0;
-        \endverbatim
+        \note This function has a C++ wrapper Simd::BgrToYuv444p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v).
 
-        This function is used for edge background updating in motion detection algorithm.
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the BGR image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+    */
+    SIMD_API void SimdBgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
-        \note This function has a C++ wrapper Simd::EdgeBackgroundIncrementCount(const View<A>& value, const View<A>& backgroundValue, View<A>& backgroundCount).
+    /*! @ingroup bgr_conversion
 
-        \param [in] value - a pointer to pixels data of current feature value.
-        \param [in] valueStride - a row size of the value image.
+        \fn void SimdBgrToYuv444pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+        \short Converts 24-bit BGR image to YUV444P with using of given YUV color matrix.
+
+        The input BGR and output Y, U and V images must have the same width and height.
+
+        \note This function has a C++ wrapper Simd::BgrToYuv444p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType).
+
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] backgroundValue - a pointer to pixels data of value of feature of edge dynamic background.
-        \param [in] backgroundValueStride - a row size of the backgroundValue image.
-        \param [in, out] backgroundCount - a pointer to pixels data of count of feature of edge dynamic background.
-        \param [in] backgroundCountStride - a row size of the backgroundCount image.
+        \param [in] bgrStride - a row size of the BGR image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
     */
-    SIMD_API void SimdEdgeBackgroundIncrementCount(const uint8_t * value, size_t valueStride, size_t width, size_t height,
-        const uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t * backgroundCount, size_t backgroundCountStride);
+    SIMD_API void SimdBgrToYuv444pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
 
-    /*! @ingroup edge_background
+    /*! @ingroup binarization
 
-        \fn void SimdEdgeBackgroundAdjustRange(uint8_t * backgroundCount, size_t backgroundCountStride, size_t width, size_t height, uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t threshold);
+        \fn void SimdBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t value, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride, SimdCompareType compareType);
 
-        \short Performs adjustment of edge background range.
+        \short Performs binarization of 8-bit gray image.
 
-        All images must have the same width, height and format (8-bit gray).
+        All images must have 8-bit gray format and must have the same width and height.
 
-        Adjusts edge background range for every point:
+        For every point:
         \verbatim
-        backgroundValue[i] += (backgroundCount[i] > threshold && backgroundValue[i] < 255) ? 1 : 0;
-        backgroundValue[i] -= (backgroundCount[i] < threshold && backgroundValue[i] > 0) ? 1 : 0;
-        backgroundCount[i] = 0;
+        dst[i] = compare(src[i], value) ? positive : negative;
         \endverbatim
+        where compare(a, b) depends from compareType (see ::SimdCompareType).
 
-        This function is used for edge background updating in motion detection algorithm.
-
-        \note This function has a C++ wrapper Simd::EdgeBackgroundAdjustRange(View<A>& backgroundCount, View<A>& backgroundValue, uint8_t threshold).
+        \note This function has a C++ wrapper Simd::Binarization(const View<A>& src, uint8_t value, uint8_t positive, uint8_t negative, View<A>& dst, SimdCompareType compareType).
 
-        \param [in, out] backgroundCount - a pointer to pixels data of count of feature of edge dynamic background.
-        \param [in] backgroundCountStride - a row size of the backgroundCount image.
+        \param [in] src - a pointer to pixels data of input 8-bit gray image (first value for compare operation).
+        \param [in] srcStride - a row size of the src image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in, out] backgroundValue - a pointer to pixels data of value of feature of edge dynamic background.
-        \param [in] backgroundValueStride - a row size of the backgroundValue image.
-        \param [in] threshold - a count threshold.
+        \param [in] value - a second value for compare operation.
+        \param [in] positive - a destination value if comparison operation has a positive result.
+        \param [in] negative - a destination value if comparison operation has a negative result.
+        \param [out] dst - a pointer to pixels data of output 8-bit gray binarized image.
+        \param [in] dstStride - a row size of the dst image.
+        \param [in] compareType - a compare operation type (see ::SimdCompareType).
     */
-    SIMD_API void SimdEdgeBackgroundAdjustRange(uint8_t * backgroundCount, size_t backgroundCountStride, size_t width, size_t height,
-        uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t threshold);
+    SIMD_API void SimdBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        uint8_t value, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride, SimdCompareType compareType);
 
-    /*! @ingroup edge_background
+    /*! @ingroup binarization
 
-        \fn void SimdEdgeBackgroundAdjustRangeMasked(uint8_t * backgroundCount, size_t backgroundCountStride, size_t width, size_t height, uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t threshold, const uint8_t * mask, size_t maskStride);
+        \fn void SimdAveragingBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t value, size_t neighborhood, uint8_t threshold, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride, SimdCompareType compareType);
 
-        \short Performs adjustment of edge background range with using adjust range mask.
+        \short Performs averaging binarization of 8-bit gray image.
 
-        All images must have the same width, height and format (8-bit gray).
+        All images must have 8-bit gray format and must have the same width and height.
 
-        Adjusts edge background range for every point:
+        For every point:
         \verbatim
-        if(mask[i])
+        sum = 0; area = 0;
+        for(dy = -neighborhood; dy <= neighborhood; ++dy)
         {
-            backgroundValue[i] += (backgroundCount[i] > threshold && backgroundValue[i] < 255) ? 1 : 0;
-            backgroundValue[i] -= (backgroundCount[i] < threshold && backgroundValue[i] > 0) ? 1 : 0;
-            backgroundCount[i] = 0;
+            for(dx = -neighborhood; dx <= neighborhood; ++dx)
+            {
+                if(x + dx >= 0 && x + dx < width && y + dy >= 0 && y + dy < height)
+                {
+                    area++;
+                    if(compare(src[x + dx, x + dy], value))
+                        sum++;
+                }
+            }
         }
+        dst[x, y] = sum*255 > area*threshold ? positive : negative;
         \endverbatim
+        where compare(a, b) depends from compareType (see ::SimdCompareType).
 
-        This function is used for edge background updating in motion detection algorithm.
-
-        \note This function has a C++ wrapper Simd::EdgeBackgroundAdjustRange(View<A>& backgroundCount, View<A>& backgroundValue, uint8_t threshold, const View<A>& mask).
+        \note This function has a C++ wrapper Simd::AveragingBinarization(const View<A>& src, uint8_t value, size_t neighborhood, uint8_t threshold, uint8_t positive, uint8_t negative, View<A>& dst, SimdCompareType compareType).
 
-        \param [in, out] backgroundCount - a pointer to pixels data of count of feature of edge dynamic background.
-        \param [in] backgroundCountStride - a row size of the backgroundCount image.
+        \param [in] src - a pointer to pixels data of input 8-bit gray image (first value for compare operation).
+        \param [in] srcStride - a row size of the src image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in, out] backgroundValue - a pointer to pixels data of value of feature of edge dynamic background.
-        \param [in] backgroundValueStride - a row size of the backgroundValue image.
-        \param [in] threshold - a count threshold.
-        \param [in] mask - a pointer to pixels data of adjust range mask.
-        \param [in] maskStride - a row size of the mask image.
+        \param [in] value - a second value for compare operation.
+        \param [in] neighborhood - an averaging neighborhood.
+        \param [in] threshold - a threshold value for binarization. It can range from 0 to 255.
+        \param [in] positive - a destination value if for neighborhood of this point number of positive comparison is greater then threshold.
+        \param [in] negative - a destination value if for neighborhood of this point number of positive comparison is lesser or equal then threshold.
+        \param [out] dst - a pointer to pixels data of output 8-bit gray binarized image.
+        \param [in] dstStride - a row size of the dst image.
+        \param [in] compareType - a compare operation type (see ::SimdCompareType).
     */
-    SIMD_API void SimdEdgeBackgroundAdjustRangeMasked(uint8_t * backgroundCount, size_t backgroundCountStride, size_t width, size_t height,
-        uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t threshold, const uint8_t * mask, size_t maskStride);
-
-    /*! @ingroup edge_background
+    SIMD_API void SimdAveragingBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        uint8_t value, size_t neighborhood, uint8_t threshold, uint8_t positive, uint8_t negative,
+        uint8_t * dst, size_t dstStride, SimdCompareType compareType);
 
-        \fn void SimdEdgeBackgroundShiftRange(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * background, size_t backgroundStride);
+    /*! @ingroup conditional
 
-        \short Shifts edge background range.
+        \fn void SimdConditionalCount8u(const uint8_t * src, size_t stride, size_t width, size_t height, uint8_t value, SimdCompareType compareType, uint32_t * count);
 
-        All images must have the same width, height and format (8-bit gray).
+        \short Calculates number of points satisfying certain condition for 8-bit gray image.
 
         For every point:
         \verbatim
-        background[i] = value[i];
+        if(compare(src[i], value))
+            count++;
         \endverbatim
+        where compare(a, b) depends from compareType (see ::SimdCompareType).
 
-        This function is used for fast edge background updating in motion detection algorithm.
-
-        \note This function has a C++ wrapper Simd::EdgeBackgroundShiftRange(const View<A>& value, View<A>& background).
+        \note This function has a C++ wrapper Simd::ConditionalCount8u(const View<A> & src, uint8_t value, SimdCompareType compareType, uint32_t & count).
 
-        \param [in] value - a pointer to pixels data of current feature value.
-        \param [in] valueStride - a row size of the value image.
+        \param [in] src - a pointer to pixels data of input 8-bit gray image (first value for compare operation).
+        \param [in] stride - a row size of the src image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in, out] background - a pointer to pixels data of feature of edge dynamic background.
-        \param [in] backgroundStride - a row size of the background image.
+        \param [in] value - a second value for compare operation.
+        \param [in] compareType - a compare operation type (see ::SimdCompareType).
+        \param [out] count - a pointer to result unsigned 32-bit value.
     */
-    SIMD_API void SimdEdgeBackgroundShiftRange(const uint8_t * value, size_t valueStride, size_t width, size_t height,
-        uint8_t * background, size_t backgroundStride);
-
-    /*! @ingroup edge_background
+    SIMD_API void SimdConditionalCount8u(const uint8_t * src, size_t stride, size_t width, size_t height,
+        uint8_t value, SimdCompareType compareType, uint32_t * count);
 
-        \fn void SimdEdgeBackgroundShiftRangeMasked(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * background, size_t backgroundStride, const uint8_t * mask, size_t maskStride);
+    /*! @ingroup conditional
 
-        \short Shifts edge background range with using shift range mask.
+        \fn void SimdConditionalCount16i(const uint8_t * src, size_t stride, size_t width, size_t height, int16_t value, SimdCompareType compareType, uint32_t * count);
 
-        All images must have the same width, height and format (8-bit gray).
+        \short Calculates number of points satisfying certain condition for 16-bit signed integer image.
 
         For every point:
         \verbatim
-        if(mask[i]])
-            background[i] = value[i];
+        if(compare(src[i], value))
+            count++;
         \endverbatim
+        where compare(a, b) depends from compareType (see ::SimdCompareType).
 
-        This function is used for fast edge background updating in motion detection algorithm.
-
-        \note This function has a C++ wrapper Simd::EdgeBackgroundShiftRange(const View<A>& value, View<A>& background, const View<A>& mask).
+        \note This function has a C++ wrapper Simd::ConditionalCount16i(const View<A> & src, int16_t value, SimdCompareType compareType, uint32_t & count).
 
-        \param [in] value - a pointer to pixels data of current feature value.
-        \param [in] valueStride - a row size of the value image.
+        \param [in] src - a pointer to pixels data of input 16-bit signed integer image (first value for compare operation).
+        \param [in] stride - a row size of the src image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in, out] background - a pointer to pixels data of feature of edge dynamic background.
-        \param [in] backgroundStride - a row size of the background image.
-        \param [in] mask - a pointer to pixels data of shift range mask.
-        \param [in] maskStride - a row size of the mask image.
+        \param [in] value - a second value for compare operation.
+        \param [in] compareType - a compare operation type (see ::SimdCompareType).
+        \param [out] count - a pointer to result unsigned 32-bit value.
     */
-    SIMD_API void SimdEdgeBackgroundShiftRangeMasked(const uint8_t * value, size_t valueStride, size_t width, size_t height,
-        uint8_t * background, size_t backgroundStride, const uint8_t * mask, size_t maskStride);
+    SIMD_API void SimdConditionalCount16i(const uint8_t * src, size_t stride, size_t width, size_t height,
+        int16_t value, SimdCompareType compareType, uint32_t * count);
 
-    /*! @ingroup filling
+    /*! @ingroup conditional
 
-        \fn void SimdFill(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize, uint8_t value);
+        \fn void SimdConditionalSum(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum);
 
-        \short Fills pixels data of image by given value.
+        \short Calculates sum of image points when mask points satisfying certain condition.
 
-        \note This function has a C++ wrapper Simd::Fill(View<A>& dst, uint8_t value).
+        All images must have 8-bit gray format and must have the same width and height.
 
-        \param [out] dst - a pointer to pixels data of destination image.
-        \param [in] stride - a row size of the dst image.
+        For every point:
+        \verbatim
+        if(compare(mask[i], value))
+            sum += src[i];
+        \endverbatim
+        where compare(a, b) depends from compareType (see ::SimdCompareType).
+
+        \note This function has a C++ wrapper Simd::ConditionalSum(const View<A> & src, const View<A> & mask, uint8_t value, SimdCompareType compareType, uint64_t & sum).
+
+        \param [in] src - a pointer to pixels data of input 8-bit gray image.
+        \param [in] srcStride - a row size of the src image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] pixelSize - a size of the image pixel.
-        \param [in] value - a value to fill image.
+        \param [in] mask - a pointer to pixels data of 8-bit gray mask (first value for compare operation).
+        \param [in] maskStride - a row size of the mask image.
+        \param [in] value - a second value for compare operation.
+        \param [in] compareType - a compare operation type (see ::SimdCompareType).
+        \param [out] sum - a pointer to result unsigned 64-bit value.
     */
-    SIMD_API void SimdFill(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize, uint8_t value);
+    SIMD_API void SimdConditionalSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum);
 
-    /*! @ingroup filling
+    /*! @ingroup conditional
 
-        \fn void SimdFillFrame(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize, size_t frameLeft, size_t frameTop, size_t frameRight, size_t frameBottom, uint8_t value);
+        \fn void SimdConditionalSquareSum(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum);
 
-        \short Fills pixels data of image except for the portion bounded frame by given value.
+        \short Calculates sum of squared image points when mask points satisfying certain condition.
 
-        \note This function has a C++ wrapper Simd::FillFrame(View<A>& dst, const Rectangle<ptrdiff_t> & frame, uint8_t value).
+        All images must have 8-bit gray format and must have the same width and height.
 
-        \param [out] dst - a pointer to pixels data of destination image.
-        \param [in] stride - a row size of the dst image.
+        For every point:
+        \verbatim
+        if(compare(mask[i], value))
+            sum += src[i]*src[i];
+        \endverbatim
+        where compare(a, b) depends from compareType (see ::SimdCompareType).
+
+        \note This function has a C++ wrapper Simd::ConditionalSquareSum(const View<A> & src, const View<A> & mask, uint8_t value, SimdCompareType compareType, uint64_t & sum).
+
+        \param [in] src - a pointer to pixels data of input 8-bit gray image.
+        \param [in] srcStride - a row size of the src image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] pixelSize - a size of the image pixel.
-        \param [in] frameLeft - a frame left side.
-        \param [in] frameTop - a frame top side.
-        \param [in] frameRight - a frame right side.
-        \param [in] frameBottom - a frame bottom side.
-        \param [in] value - a value to fill image.
+        \param [in] mask - a pointer to pixels data of 8-bit gray mask (first value for compare operation).
+        \param [in] maskStride - a row size of the mask image.
+        \param [in] value - a second value for compare operation.
+        \param [in] compareType - a compare operation type (see ::SimdCompareType).
+        \param [out] sum - a pointer to result unsigned 64-bit value.
     */
-    SIMD_API void SimdFillFrame(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize,
-        size_t frameLeft, size_t frameTop, size_t frameRight, size_t frameBottom, uint8_t value);
+    SIMD_API void SimdConditionalSquareSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum);
 
-    /*! @ingroup filling
+    /*! @ingroup conditional
 
-        \fn void SimdFillBgr(uint8_t * dst, size_t stride, size_t width, size_t height, uint8_t blue, uint8_t green, uint8_t red);
+        \fn void SimdConditionalSquareGradientSum(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum);
 
-        \short Fills pixels data of 24-bit BGR image by given color(blue, green, red).
+        \short Calculates sum of squared gradient of image points when mask points satisfying certain condition.
 
-        \note This function has a C++ wrapper Simd::FillBgr(View<A>& dst, uint8_t blue, uint8_t green, uint8_t red).
+        All images must have 8-bit gray format and must have the same width and height. The image height and width must be equal or greater 3.
 
-        \param [out] dst - a pointer to pixels data of destination image.
-        \param [in] stride - a row size of the dst image.
+        For every point except border:
+        \verbatim
+        if(compare(mask[x, y], value))
+        {
+            dx = src[x + 1, y] - src[x - 1, y];
+            dy = src[x, y + 1] - src[x, y - 1];
+            sum += dx*dx + dy*dy;
+        }
+        \endverbatim
+        where compare(a, b) depends from compareType (see ::SimdCompareType).
+
+        \note This function has a C++ wrapper Simd::ConditionalSquareGradientSum(const View<A> & src, const View<A> & mask, uint8_t value, SimdCompareType compareType, uint64_t & sum).
+
+        \param [in] src - a pointer to pixels data of input 8-bit gray image.
+        \param [in] srcStride - a row size of the src image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] blue - a blue channel of BGR to fill image.
-        \param [in] green - a green channel of BGR to fill image.
-        \param [in] red - a red channel of BGR to fill image.
+        \param [in] mask - a pointer to pixels data of 8-bit gray mask (first value for compare operation).
+        \param [in] maskStride - a row size of the mask image.
+        \param [in] value - a second value for compare operation.
+        \param [in] compareType - a compare operation type (see ::SimdCompareType).
+        \param [out] sum - a pointer to result unsigned 64-bit value.
     */
-    SIMD_API void SimdFillBgr(uint8_t * dst, size_t stride, size_t width, size_t height, uint8_t blue, uint8_t green, uint8_t red);
+    SIMD_API void SimdConditionalSquareGradientSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum);
 
-    /*! @ingroup filling
+    /*! @ingroup conditional
 
-        \fn void SimdFillBgra(uint8_t * dst, size_t stride, size_t width, size_t height, uint8_t blue, uint8_t green, uint8_t red, uint8_t alpha);
+        \fn void SimdConditionalFill(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t threshold, SimdCompareType compareType, uint8_t value, uint8_t * dst, size_t dstStride);
 
-        \short Fills pixels data of 32-bit BGRA image by given color(blue, green, red, alpha).
+        \short Fills pixels of 8-bit gray image by given value if corresponding pixels of input 8-bit gray image satisfy certain condition.
 
-        \note This function has a C++ wrapper Simd::FillBgra(View<A>& dst, uint8_t blue, uint8_t green, uint8_t red, uint8_t alpha).
+        All images must have the same width and height.
 
-        \param [out] dst - a pointer to pixels data of destination image.
-        \param [in] stride - a row size of the dst image.
+        For every point:
+        \verbatim
+        if(compare(src[i], threshold))
+            dst[i] = value;
+        \endverbatim
+        where compare(a, b) depends from compareType (see ::SimdCompareType).
+
+        \note This function has a C++ wrapper Simd::ConditionalFill(const View<A> & src, uint8_t threshold, SimdCompareType compareType, uint8_t value, View<A> & dst).
+
+        \param [in] src - a pointer to pixels data of input 8-bit gray image.
+        \param [in] srcStride - a row size of input image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] blue - a blue channel of BGRA to fill image.
-        \param [in] green - a green channel of BGRA to fill image.
-        \param [in] red - a red channel of BGRA to fill image.
-        \param [in] alpha - a alpha channel of BGRA to fill image.
+        \param [in] threshold - a second value for compare operation.
+        \param [in] compareType - a compare operation type (see ::SimdCompareType).
+        \param [in] value - a value for fill operation.
+        \param [in, out] dst - a pointer to pixels data of the output 8-bit gray image.
+        \param [in] dstStride - a row size of output image.
     */
-    SIMD_API void SimdFillBgra(uint8_t * dst, size_t stride, size_t width, size_t height,
-        uint8_t blue, uint8_t green, uint8_t red, uint8_t alpha);
+    SIMD_API void SimdConditionalFill(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        uint8_t threshold, SimdCompareType compareType, uint8_t value, uint8_t * dst, size_t dstStride);
 
-    /*! @ingroup filling
+    /*! @ingroup copying
 
-        \fn void SimdFillPixel(uint8_t * dst, size_t stride, size_t width, size_t height, const uint8_t * pixel, size_t pixelSize);
+        \fn void SimdCopy(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, uint8_t * dst, size_t dstStride);
 
-        \short Fills image by value of given pixel.
+        \short Copies pixels data of image from source to destination.
 
-        \note This function has a C++ wrapper Simd::FillPixel(View<A> & dst, const Pixel & pixel).
+        All images must have the same width, height and format.
 
-        \param [out] dst - a pointer to pixels data of destination image.
-        \param [in] stride - a row size of the dst image.
+        \note This function has a C++ wrapper Simd::Copy(const View<A> & src, View<B> & dst).
+
+        \param [in] src - a pointer to pixels data of source image.
+        \param [in] srcStride - a row size of the src image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] pixel - a pointer to pixel to fill.
-        \param [in] pixelSize - a size of the image pixel. Parameter is restricted by range [1, 4]. 
+        \param [in] pixelSize - a size of the image pixel.
+        \param [out] dst - a pointer to pixels data of destination image.
+        \param [in] dstStride - a row size of the dst image.
     */
-    SIMD_API void SimdFillPixel(uint8_t * dst, size_t stride, size_t width, size_t height, const uint8_t * pixel, size_t pixelSize);
-
-    /*! @ingroup filling
-
-        \fn void SimdFill32f(float * dst, size_t size, const float * value);
+    SIMD_API void SimdCopy(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, uint8_t * dst, size_t dstStride);
 
-        \short Fills 32-bit float array by given value.
+    /*! @ingroup copying
 
-        \param [out] dst - a pointer to 32-bit float array.
-        \param [in] size - a size of the array.
-        \param [in] value - a pointer to value to fill. Can be NULL (filling value is assumed to be equal to zero).
-    */
-    SIMD_API void SimdFill32f(float * dst, size_t size, const float * value);
+        \fn void SimdCopyFrame(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, size_t frameLeft, size_t frameTop, size_t frameRight, size_t frameBottom, uint8_t * dst, size_t dstStride);
 
-    /*! @ingroup float16
+        \short Copies pixels data of image from source to destination except for the portion bounded frame.
 
-        \fn void SimdFloat32ToFloat16(const float * src, size_t size, uint16_t * dst);
+        All images must have the same width, height and format.
 
-        \short Converts numbers in the array from 32-bit float to 16-bit float format.
+        \note This function has a C++ wrapper Simd::CopyFrame(const View<A>& src, const Rectangle<ptrdiff_t> & frame, View<A>& dst).
 
-        \param [in] src - a pointer to the input array with 32-bit float point numbers.
-        \param [in] size - a size of input and output array.
-        \param [out] dst - a pointer to the output array with 16-bit float point numbers.
+        \param [in] src - a pointer to pixels data of source image.
+        \param [in] srcStride - a row size of the src image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] pixelSize - a size of the image pixel.
+        \param [in] frameLeft - a frame left side.
+        \param [in] frameTop - a frame top side.
+        \param [in] frameRight - a frame right side.
+        \param [in] frameBottom - a frame bottom side.
+        \param [out] dst - a pointer to pixels data of destination image.
+        \param [in] dstStride - a row size of the dst image.
     */
-    SIMD_API void SimdFloat32ToFloat16(const float * src, size_t size, uint16_t * dst);
+    SIMD_API void SimdCopyFrame(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize,
+        size_t frameLeft, size_t frameTop, size_t frameRight, size_t frameBottom, uint8_t * dst, size_t dstStride);
 
-    /*! @ingroup float16
+    /*! @ingroup synet
+        Describes type of activation function. It is used in ::SimdConvolutionInit and ::SimdConvolutionSetParams.
+    */
+    typedef enum
+    {
+        /*!
+            Identity (activation function is absent).
+        */
+        SimdConvolutionActivationIdentity = 0,
+        /*!
+            ReLU activation function.
+            \verbatim
+            dst[i] = Max(0, src[i]);
+            \endverbatim
+        */
+        SimdConvolutionActivationRelu,
+        /*!
+            Leaky ReLU activation function.
+            It has one parameter: slope (params[0]).
+            \verbatim
+            dst[i] = src[i] > 0 ? src[i] : slope*src[i];
+            \endverbatim
+        */
+        SimdConvolutionActivationLeakyRelu,
+        /*!
+            The activation function restricts range.
+            It has two parameters: lower (params[0]) and upper (params[1]) bound.
+            \verbatim
+            dst[i] = Min(Max(lower, src[i]), upper);
+            \endverbatim
+        */
+        SimdConvolutionActivationRestrictRange,
+        /*!
+            Leaky PReLU activation function.
+            It has m parameters: slopes[m] (m = dstC, n = dstH*dstW).
+            \verbatim
+            dst[i*n + j] = src[i*n + j] > 0 ? src[i*n + j] : slopes[i]*src[i*n + j];
+            \endverbatim
+        */
+        SimdConvolutionActivationPrelu,
+    } SimdConvolutionActivationType;
 
-        \fn void SimdFloat16ToFloat32(const uint16_t* src, size_t size, float  * dst);
+    /*! @ingroup synet
 
-        \short Converts numbers in the array from 16-bit float to 32-bit float format.
+        \brief Callback function type "SimdGemm32fNNPtr";
 
-        \param [in] src - a pointer to the input array with 16-bit float point numbers.
-        \param [in] size - a size of input and output array.
-        \param [out] dst - a pointer to the output array with 32-bit float point numbers.
-    */
-    SIMD_API void SimdFloat16ToFloat32(const uint16_t * src, size_t size, float * dst);
+        The function has to perform general matrix multiplication (for 32-bit float numbers).
 
-    /*! @ingroup float16
-
-        \fn void SimdSquaredDifferenceSum16f(const uint16_t * a, const uint16_t * b, size_t size, float * sum);
+        \verbatim
+        C(M, N) = alpha*A(M, K)*B(K, N) + beta*C(M, N);
+        \endverbatim
 
-        \short Calculates sum of squared differences for two 16-bit float arrays.
+        \param [in] M - a height of A and height of C matrices.
+        \param [in] N - a width of B and width of C matrices.
+        \param [in] K - a width of A and height of B matrices.
+        \param [in] alpha - a pointer to multiplier of the first term.
+        \param [in] A - a pointer to input A matrix.
+        \param [in] lda - a leading dimension of A matrix.
+        \param [in] B - a pointer to input B matrix.
+        \param [in] ldb - a leading dimension of B matrix.
+        \param [in] beta - a pointer to multiplier of the second term.
+        \param [out] C - a pointer to output C matrix.
+        \param [in] ldc - a leading dimension of C matrix.
+    */
+    typedef void(*SimdGemm32fNNPtr)(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
 
-        All arrays must have the same size.
+    /*! @ingroup synet
 
-        For every element:
-        \verbatim
-        sum += (a[i] - b[i])*(a[i] - b[i]);
-        \endverbatim
+        \fn void * SimdConvolutionInit(SimdBool trans, size_t batch, size_t srcC, size_t srcH, size_t srcW, size_t dstC, size_t kernelY, size_t kernelX, size_t dilationY, size_t dilationX, size_t strideY, size_t strideX, size_t padY, size_t padX, size_t padH, size_t padW, size_t group, SimdConvolutionActivationType activation, SimdGemm32fNNPtr gemm);
+        
+        \short Initilizes convolution algorithm.
 
-        \param [in] a - a pointer to the first 16-bit float array.
-        \param [in] b - a pointer to the second 16-bit float array.
-        \param [in] size - a size of arrays.
-        \param [out] sum - a pointer to 32-bit float point sum of squared differences.
+        \param [in] trans - a flag of transposed input and output data (::SimdFalse - NCHW order, ::SimdTrue - NHWC order).
+        \param [in] batch - a batch size.
+        \param [in] srcC - a number of input channels.
+        \param [in] srcH - an input height.
+        \param [in] srcW - an input width.
+        \param [in] dstC - a number of output channels.
+        \param [in] kernelY - a height of the convolution kernel.
+        \param [in] kernelX - a width of the convolution kernel.
+        \param [in] dilationY - a y-dilation of the convolution.
+        \param [in] dilationX - a x-dilation of the convolution.
+        \param [in] strideY - a y-stride of the convolution.
+        \param [in] strideX - a x-stride of the convolution.
+        \param [in] padY - a pad to the top of the input image.
+        \param [in] padX - a pad to the left of the input image.
+        \param [in] padH - a pad to the bottom of the input image.
+        \param [in] padW - a pad to the right of the input image.
+        \param [in] group - a size of convolution group.
+        \param [in] activation - a type of activation function (see ::SimdConvolutionActivationType).
+        \param [in] gemm - a pointer to external function of matrix multiplication. Can be NULL.
+        \return a pointer to convolution context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in functions ::SimdConvolutionExternalBufferSize, ::SimdConvolutionInternalBufferSize, ::SimdConvolutionSetParams and ::SimdConvolutionForward.
     */
-    SIMD_API void SimdSquaredDifferenceSum16f(const uint16_t * a, const uint16_t * b, size_t size, float * sum);
+    SIMD_API void * SimdConvolutionInit(SimdBool trans, size_t batch, size_t srcC, size_t srcH, size_t srcW, size_t dstC,  
+        size_t kernelY, size_t kernelX, size_t dilationY, size_t dilationX, size_t strideY, size_t strideX, 
+        size_t padY, size_t padX, size_t padH, size_t padW, size_t group, SimdConvolutionActivationType activation, SimdGemm32fNNPtr gemm);
 
-    /*! @ingroup float16
+    /*! @ingroup synet
 
-        \fn void SimdCosineDistance16f(const uint16_t * a, const uint16_t * b, size_t size, float * distance);
+        \fn size_t SimdConvolutionExternalBufferSize(const void * convolution);
 
-        \short Calculates cosine distance of two 16-bit float arrays.
+        \short Gets size of external temporary buffer required for convolution algorithm.
 
-        All arrays must have the same size.
+        \param [in] convolution - a pointer to convolution context. It must be created by function ::SimdConvolutionInit and released by function ::SimdRelease. 
+        \return size of external temporary buffer required for convolution algorithm.
+    */
+    SIMD_API size_t SimdConvolutionExternalBufferSize(const void * convolution);
 
-        Algorithm description:
-        \verbatim
-        distance = 1 - Sum(a[i]*b[i])/Sqrt(Sum(a[i]*a[i])*Sum(b[i]*b[i]));
-        \endverbatim
+    /*! @ingroup synet
 
-        \param [in] a - a pointer to the first 16-bit float array.
-        \param [in] b - a pointer to the second 16-bit float array.
-        \param [in] size - a size of arrays.
-        \param [out] distance - a pointer to 32-bit float with cosine distance.
+        \fn size_t SimdConvolutionInternalBufferSize(const void * convolution);
+
+        \short Gets size of internal buffer used inside convolution algorithm.
+
+        \param [in] convolution - a pointer to convolution context. It must be created by function ::SimdConvolutionInit and released by function ::SimdRelease.
+        \return size of internal buffer used inside convolution algorithm.
     */
-    SIMD_API void SimdCosineDistance16f(const uint16_t * a, const uint16_t * b, size_t size, float * distance);
+    SIMD_API size_t SimdConvolutionInternalBufferSize(const void * convolution);
 
-    /*! @ingroup float16
+    /*! @ingroup synet
 
-        \fn void SimdCosineDistancesMxNa16f(size_t M, size_t N, size_t K, const uint16_t * const * A, const uint16_t * const * B, float * distances);
+        \fn void SimdConvolutionSetParams(void * convolution, const float * weight, SimdBool trans, SimdBool * internal, const float * bias, const float * params);
 
-        \short Calculates mutual cosine distance of two arrays of 16-bit float arrays.
+        \short Sets weights, beases and parameters of activation function required for convolution algorithm.
 
-        Algorithm description:
-        \verbatim
-        distances[i, j] = 1 - Sum(A[i][k]*B[j][k])/Sqrt(Sum(A[i][k]*A[i][k])*Sum(B[j][k]*B[j][k]));
-        \endverbatim
+        \param [in, out] convolution - a pointer to convolution context. It must be created by function ::SimdConvolutionInit and released by function ::SimdRelease.
+        \param [in] weight - a pointer to convolution weights.
+        \param [in] trans - a flag of transposed weight data (::SimdFalse - DCHW order, ::SimdTrue - HWCD order).
+        \param [out] internal - a flag signalized that weight is stored in the internal buffer. Can be NULL.
+        \param [in] bias - a pointer to bias. Can be NULL.
+        \param [in] params - a pointer to parameters of activation functions (see ::SimdConvolutionActivationType). Can be NULL.
+    */
+    SIMD_API void SimdConvolutionSetParams(void * convolution, const float * weight, SimdBool trans, SimdBool * internal, const float * bias, const float * params);
 
-        \param [in] M - a number of A arrays.
-        \param [in] N - a number of B arrays.
-        \param [in] K - a size of A and B arrays.
-        \param [in] A - a pointer to the first array with pointers to 16-bit float arrays.
-        \param [in] B - a pointer to the second array with pointers to 16-bit float arrays.
-        \param [out] distances - a pointer to result 32-bit float array with cosine distances. It size must be M*N.
+    /*! @ingroup synet
+
+        \fn void SimdConvolutionForward(void * convolution, const float * src, float * buf, float * dst);
+
+        \short Performs forward propagation of convolution algorithm.
+
+        \param [in] convolution - a pointer to convolution context. It must be created by function ::SimdConvolutionInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to input image.
+        \param [out] buf - a pointer to external temporary buffer. The size of the external temporary buffer is determined by function ::SimdConvolutionExternalBufferSize.
+            Can be NULL (it causes usage of thread-local scratch buffer which is shared between all convolutions, see ::SimdConvolutionScratchPeak).
+        \param [out] dst - a pointer to output image.
     */
-    SIMD_API void SimdCosineDistancesMxNa16f(size_t M, size_t N, size_t K, const uint16_t * const * A, const uint16_t * const * B, float * distances);
+    SIMD_API void SimdConvolutionForward(void * convolution, const float * src, float * buf, float * dst);
 
-    /*! @ingroup other_conversion
+    /*! @ingroup synet
 
-        \fn void SimdFloat32ToUint8(const float * src, size_t size, const float * lower, const float * upper, uint8_t * dst);
+        \fn size_t SimdConvolutionScratchPeak();
 
-        \short Converts numbers in the array from 32-bit float to 8-bit unsigned integer format.
+        \short Gets peak size of thread-local scratch buffer used by convolution algorithms.
 
-        For every element:
-        \verbatim
-        dst[i] = (min(max(src[i], lower), upper) - lower)*255/(upper - lower);
-        \endverbatim
+        The scratch buffer is used by ::SimdConvolutionForward when external temporary buffer is not set.
+        It is shared between all convolutions which are executed in the same thread. 
+        So a memory consumption of a network is determined by its largest layer instead of sum of all layers.
 
-        \param [in] src - a pointer to the input array with 32-bit float point numbers.
-        \param [in] size - a size of input and output array.
-        \param [in] lower - a pointer to lower saturated bound of the input array.
-        \param [in] upper - a pointer to upper saturated bound of the input array.
-        \param [out] dst - a pointer to the output array with 8-bit unsigned integer numbers.
+        \return peak size (in 32-bit floats) of scratch buffer over all threads.
     */
-    SIMD_API void SimdFloat32ToUint8(const float * src, size_t size, const float * lower, const float * upper, uint8_t * dst);
-
-    /*! @ingroup other_conversion
+    SIMD_API size_t SimdConvolutionScratchPeak();
 
-        \fn void SimdUint8ToFloat32(const uint8_t* src, size_t size, const float * lower, const float * upper, float * dst);
+    /*! @ingroup synet
 
-        \short Converts numbers in the array from 8-bit unsigned integer to 32-bit float format.
+        \fn void SimdConvolutionScratchRelease();
 
-        For every element:
-        \verbatim
-        dst[i] = src[i]*(upper - lower)/255 + lower;
-        \endverbatim
+        \short Releases thread-local scratch buffer of convolution algorithms for the current thread.
 
-        \param [in] src - a pointer to the input array with 8-bit unsigned integer numbers.
-        \param [in] size - a size of input and output array.
-        \param [in] lower - a pointer to lower bound of the output array.
-        \param [in] upper - a pointer to upper bound of the output array.
-        \param [out] dst - a pointer to the output array with 32-bit float point numbers.
+        The buffer will be allocated again by next call of ::SimdConvolutionForward with NULL external temporary buffer.
     */
-    SIMD_API void SimdUint8ToFloat32(const uint8_t * src, size_t size, const float * lower, const float * upper, float * dst);
+    SIMD_API void SimdConvolutionScratchRelease();
 
-    /*! @ingroup correlation
+    /*! @ingroup other_conversion
 
-        \fn void SimdCosineDistance32f(const float * a, const float * b, size_t size, float * distance);
+        \fn void SimdDeinterleaveUv(const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
-        \short Calculates cosine distance of two 32-bit float arrays.
+        \short Deinterleaves 16-bit UV interleaved image into separated 8-bit U and V planar images.
 
-        All arrays must have the same size.
+        All images must have the same width and height.
+        This function used for NV12 to YUV420P conversion.
 
-        Algorithm description:
-        \verbatim
-        distance = 1 - Sum(a[i]*b[i])/Sqrt(Sum(a[i]*a[i])*Sum(b[i]*b[i]));
-        \endverbatim
+        \note This function has a C++ wrapper Simd::DeinterleaveUv(const View<A>& uv, View<A>& u, View<A>& v).
 
-        \param [in] a - a pointer to the first 32-bit float array.
-        \param [in] b - a pointer to the second 32-bit float array.
-        \param [in] size - a size of arrays.
-        \param [out] distance - a pointer to 32-bit float with cosine distance.
+        \param [in] uv - a pointer to pixels data of input 16-bit UV interleaved image.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] u - a pointer to pixels data of 8-bit U planar image.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of 8-bit V planar image.
+        \param [in] vStride - a row size of the v image.
     */
-    SIMD_API void SimdCosineDistance32f(const float * a, const float * b, size_t size, float * distance);
-
-    /*! @ingroup other_filter
+    SIMD_API void SimdDeinterleaveUv(const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+        uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
-        \fn void SimdGaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
+    /*! @ingroup other_conversion
 
-        \short Performs Gaussian blur filtration with window 3x3.
+        \fn void SimdDeinterleaveBgr(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * b, size_t bStride, uint8_t * g, size_t gStride, uint8_t * r, size_t rStride);
 
-        For every point:
-        \verbatim
-        dst[x, y] = (src[x-1, y-1] + 2*src[x, y-1] + src[x+1, y-1] +
-                    2*(src[x-1, y] + 2*src[x, y] + src[x+1, y]) +
-                    src[x-1, y+1] + 2*src[x, y+1] + src[x+1, y+1] + 8) / 16;
-        \endverbatim
+        \short Deinterleaves 24-bit BGR interleaved image into separated 8-bit Blue, Green and Red planar images.
 
-        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+        All images must have the same width and height.
 
-        \note This function has a C++ wrapper Simd::GaussianBlur3x3(const View<A>& src, View<A>& dst).
+        \note This function has a C++ wrapper Simd::DeinterleaveBgr(const View<A>& bgr, View<A>& b, View<A>& g, View<A>& r).
 
-        \param [in] src - a pointer to pixels data of source image.
-        \param [in] srcStride - a row size of the src image.
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR interleaved image.
+        \param [in] bgrStride - a row size of the bgr image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] channelCount - a channel count.
-        \param [out] dst - a pointer to pixels data of destination image.
-        \param [in] dstStride - a row size of the dst image.
+        \param [out] b - a pointer to pixels data of 8-bit Blue planar image.
+        \param [in] bStride - a row size of the b image.
+        \param [out] g - a pointer to pixels data of 8-bit Green planar image.
+        \param [in] gStride - a row size of the g image.
+        \param [out] r - a pointer to pixels data of 8-bit Red planar image.
+        \param [in] rStride - a row size of the r image.
     */
-    SIMD_API void SimdGaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-        size_t channelCount, uint8_t * dst, size_t dstStride);
+    SIMD_API void SimdDeinterleaveBgr(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height,
+        uint8_t * b, size_t bStride, uint8_t * g, size_t gStride, uint8_t * r, size_t rStride);
 
-    /*! @ingroup matrix
+    /*! @ingroup other_conversion
 
-        \fn void SimdGemm32fNN(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
+        \fn void SimdDeinterleaveBgra(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * b, size_t bStride, uint8_t * g, size_t gStride, uint8_t * r, size_t rStride, uint8_t * a, size_t aStride);
 
-        \short Performs general matrix multiplication (for 32-bit float numbers).
+        \short Deinterleaves 32-bit BGRA interleaved image into separated 8-bit Blue, Green, Red and Alpha planar images.
 
-        \verbatim
-        C(M, N) = alpha*A(M, K)*B(K, N) + beta*C(M, N);
-        \endverbatim
+        All images must have the same width and height.
 
-        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+        \note This function has a C++ wrapper Simd::DeinterleaveBgra(const View<A>& bgra, View<A>& b, View<A>& g, View<A>& r, View<A>& a).
 
-        \param [in] M - a height of A and height of C matrices.
-        \param [in] N - a width of B and width of C matrices.
-        \param [in] K - a width of A and height of B matrices.
-        \param [in] alpha - a pointer to multiplier of the first term.
-        \param [in] A - a pointer to input A matrix.
-        \param [in] lda - a leading dimension of A matrix.
-        \param [in] B - a pointer to input B matrix.
-        \param [in] ldb - a leading dimension of B matrix.
-        \param [in] beta - a pointer to multiplier of the second term.
-        \param [out] C - a pointer to output C matrix.
-        \param [in] ldc - a leading dimension of C matrix.
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA interleaved image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] b - a pointer to pixels data of 8-bit Blue planar image.
+        \param [in] bStride - a row size of the b image.
+        \param [out] g - a pointer to pixels data of 8-bit Green planar image.
+        \param [in] gStride - a row size of the g image.
+        \param [out] r - a pointer to pixels data of 8-bit Red planar image.
+        \param [in] rStride - a row size of the r image.
+        \param [out] a - a pointer to pixels data of 8-bit Alpha planar image.
+        \param [in] aStride - a row size of the a image.
     */
-    SIMD_API void SimdGemm32fNN(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
+    SIMD_API void SimdDeinterleaveBgra(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height,
+        uint8_t * b, size_t bStride, uint8_t * g, size_t gStride, uint8_t * r, size_t rStride, uint8_t * a, size_t aStride);
 
-    /*! @ingroup matrix
+    /*! @ingroup object_detection
 
-        \fn void SimdGemm32fNT(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
+        \fn void * SimdDetectionLoadA(const char * path);
 
-        \short Performs general matrix multiplication (for 32-bit float numbers).
+        \short Loads a classifier cascade from file.
 
-        \verbatim
-        C(M, N) = alpha*A(M, K)*Trans(B(N, K)) + beta*C(M, N);
-        \endverbatim
+        This function supports OpenCV HAAR and LBP cascades type.
+        Tree based cascades and old cascade formats are not supported.
+        It also accepts files with binary cascade format which were created with using of function ::SimdDetectionSaveBinary.
 
-        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+        \note This function is used for implementation of Simd::Detection.
 
-        \param [in] M - a height of A and height of C matrices.
-        \param [in] N - a height of B and width of C matrices.
-        \param [in] K - a width of A and width of B matrices.
-        \param [in] alpha - a pointer to multiplier of the first term.
-        \param [in] A - a pointer to input A matrix.
-        \param [in] lda - a leading dimension of A matrix.
-        \param [in] B - a pointer to input B matrix.
-        \param [in] ldb - a leading dimension of B matrix.
-        \param [in] beta - a pointer to multiplier of the second term.
-        \param [out] C - a pointer to output C matrix.
-        \param [in] ldc - a leading dimension of C matrix.
+        \param [in] path - a path to cascade.
+        \return a pointer to loaded cascade. On error it returns NULL.
+                This pointer is used in functions ::SimdDetectionInfo and ::SimdDetectionInit, and must be released with using of function ::SimdRelease.
     */
-    SIMD_API void SimdGemm32fNT(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
+    SIMD_API void * SimdDetectionLoadA(const char * path);
 
-    /*! @ingroup gray_conversion
+    /*! @ingroup object_detection
 
-        \fn void SimdGrayToBgr(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgr, size_t bgrStride);
+        \fn void * SimdDetectionLoadBinary(const void * buffer, size_t size);
 
-        \short Converts 8-bit gray image to 24-bit BGR image.
+        \short Loads a classifier cascade from memory buffer with binary cascade format.
 
-        All images must have the same width and height.
+        The binary format keeps already parsed cascade data, so loading does not require XML parsing.
+        The buffer can point to memory mapped file. The data is copied, so the buffer can be released after the call.
 
-        \note This function has a C++ wrapper Simd::GrayToBgr(const View<A>& gray, View<A>& bgr).
+        \note This function is used for implementation of Simd::Detection.
 
-        \param [in] gray - a pointer to pixels data of input 8-bit gray image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [in] grayStride - a row size of the gray image.
-        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
-        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] buffer - a pointer to buffer with binary cascade which was created with using of function ::SimdDetectionSaveBinary.
+        \param [in] size - a size of the buffer.
+        \return a pointer to loaded cascade. On error (invalid format, version or cascade data, e.g. feature rectangles outside of the detection window) it returns NULL.
+                This pointer is used in functions ::SimdDetectionInfo and ::SimdDetectionInit, and must be released with using of function ::SimdRelease.
     */
-    SIMD_API void SimdGrayToBgr(const uint8_t *gray, size_t width, size_t height, size_t grayStride, uint8_t *bgr, size_t bgrStride);
+    SIMD_API void * SimdDetectionLoadBinary(const void * buffer, size_t size);
 
-    /*! @ingroup gray_conversion
+    /*! @ingroup object_detection
 
-        \fn void SimdGrayToBgra(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+        \fn size_t SimdDetectionSaveBinary(const void * data, void * buffer, size_t size);
 
-        \short Converts 8-bit gray image to 32-bit BGRA image.
+        \short Saves a classifier cascade to memory buffer with binary cascade format.
 
-        All images must have the same width and height.
+        The binary cascade consists of header and 16-byte aligned arrays of cascade data. It uses byte order of the current platform.
+        The result can be stored in file and loaded with using of functions ::SimdDetectionLoadA or ::SimdDetectionLoadBinary.
 
-        \note This function has a C++ wrapper Simd::GrayToBgra(const View<A>& gray, View<A>& bgra, uint8_t alpha).
+        \note This function is used for implementation of Simd::Detection.
 
-        \param [in] gray - a pointer to pixels data of input 8-bit gray image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [in] grayStride - a row size of the gray image.
-        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
-        \param [in] bgraStride - a row size of the bgra image.
-        \param [in] alpha - a value of alpha channel.
+        \param [in] data - a pointer to cascade which was received with using of function ::SimdDetectionLoadA or ::SimdDetectionLoadBinary.
+        \param [out] buffer - a pointer to output buffer. It can be NULL (to estimate required size of the buffer).
+        \param [in] size - a size of output buffer. If it is less then required size then nothing is written.
+        \return a required size of output buffer. On error it returns 0.
     */
-    SIMD_API void SimdGrayToBgra(const uint8_t *gray, size_t width, size_t height, size_t grayStride,
-        uint8_t *bgra, size_t bgraStride, uint8_t alpha);
-
-    /*! @ingroup histogram
+    SIMD_API size_t SimdDetectionSaveBinary(const void * data, void * buffer, size_t size);
 
-        \fn void SimdAbsSecondDerivativeHistogram(const uint8_t * src, size_t width, size_t height, size_t stride, size_t step, size_t indent, uint32_t * histogram);
+    /*! @ingroup object_detection
 
-        \short Calculates histogram of second derivative for 8-bit gray image.
+        \fn void SimdDetectionInfo(const void * data, size_t * width, size_t * height, SimdDetectionInfoFlags * flags);
 
-        For all points except the boundary (defined by parameter indent):
-        \verbatim
-        dx = abs(src[x, y] - average(src[x+step, y], src[x-step, y]));
-        dy = abs(src[x, y] - average(src[x, y+step], src[x, y-step]));
-        histogram[max(dx, dy)]++;
-        \endverbatim
+        \short Gets information about the classifier cascade.
 
-        \note This function has a C++ wrapper Simd::AbsSecondDerivativeHistogram(const View<A>& src, size_t step, size_t indent, uint32_t * histogram).
+        \note This function is used for implementation of Simd::Detection.
 
-        \param [in] src - a pointer to pixels data of input 8-bit gray image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [in] stride - a row size of the image.
-        \param [in] step - a step for second derivative calculation.
-        \param [in] indent - a indent from image boundary.
-        \param [out] histogram - a pointer to histogram (array of 256 unsigned 32-bit values).
+        \param [in] data - a pointer to cascade which was received with using of function ::SimdDetectionLoadA or ::SimdDetectionLoadBinary.
+        \param [out] width - a pointer to returned width of cascade window.
+        \param [out] height - a pointer to returned height of cascade window.
+        \param [out] flags - a pointer to flags with other information (See ::SimdDetectionInfoFlags).
     */
-    SIMD_API void SimdAbsSecondDerivativeHistogram(const uint8_t * src, size_t width, size_t height, size_t stride,
-        size_t step, size_t indent, uint32_t * histogram);
-
-    /*! @ingroup histogram
+    SIMD_API void SimdDetectionInfo(const void * data, size_t * width, size_t * height, SimdDetectionInfoFlags * flags);
 
-        \fn void SimdHistogram(const uint8_t * src, size_t width, size_t height, size_t stride, uint32_t * histogram);
+    /*! @ingroup object_detection
 
-        \short Calculates histogram for 8-bit gray image.
+        \fn void * SimdDetectionInit(const void * data, uint8_t * sum, size_t sumStride, size_t width, size_t height, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride, int throughColumn, int int16);
 
-        For all points:
-        \verbatim
-        histogram[src[i]]++.
-        \endverbatim
+        \short Initializes hidden classifier cascade structure to work with given size of input 8-bit gray image.
 
-        \note This function has a C++ wrapper Simd::Histogram(const View<A>& src, uint32_t * histogram).
+        \note This function is used for implementation of Simd::Detection.
 
-        \param [in] src - a pointer to pixels data of input 8-bit gray image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [in] stride - a row size of the image.
-        \param [out] histogram - a pointer to histogram (array of 256 unsigned 32-bit values).
+        \param [in] data - a pointer to cascade which was received with using of function ::SimdDetectionLoadA or ::SimdDetectionLoadBinary.
+        \param [in] sum - a pointer to pixels data of 32-bit integer image with integral sum of given input 8-bit gray image.
+                          See function ::SimdIntegral in order to estimate this integral sum.
+        \param [in] sumStride - a row size of the sum image.
+        \param [in] width - a width of the sum image. It must be per unit greater than width of input 8-bit gray image.
+        \param [in] height - a height of the sum image. It must be per unit greater than height of input 8-bit gray image.
+        \param [in] sqsum - a pointer to pixels data of 32-bit integer image with squared integral sum of given input 8-bit gray image.
+                            Its size must be equal to sum image. See function ::SimdIntegral in order to estimate this squared integral sum. Its
+        \param [in] sqsumStride - a row size of the sqsum image.
+        \param [in] tilted - a pointer to pixels data of 32-bit integer image with tilted integral sum of given input 8-bit gray image.
+                             Its size must be equal to sum image. See function ::SimdIntegral in order to estimate this tilted integral sum.
+        \param [in] tiltedStride - a row size of the tilted image.
+        \param [in] throughColumn - a flag to detect objects only in even columns and rows (to increase performance).
+        \param [in] int16 - a flag use for 16-bit integer version of detection algorithm. (See ::SimdDetectionInfo).
+                           For HAAR cascades it is applied only if all feature weights are small integers and node thresholds
+                           are less than 1 by absolute value (::SimdDetectionInfoCanInt16 flag).
+        \return a pointer to hidden cascade. On error it returns NULL.
+                This pointer is used in functions ::SimdDetectionPrepare, ::SimdDetectionHaarDetect32fp, ::SimdDetectionHaarDetect32fi,
+                ::SimdDetectionHaarDetect16ip, ::SimdDetectionHaarDetect16ii,
+                ::SimdDetectionLbpDetect32fp, ::SimdDetectionLbpDetect32fi, ::SimdDetectionLbpDetect16ip and ::SimdDetectionLbpDetect16ii.
+                It must be released with using of function ::SimdRelease.
     */
-    SIMD_API void SimdHistogram(const uint8_t * src, size_t width, size_t height, size_t stride, uint32_t * histogram);
+    SIMD_API void * SimdDetectionInit(const void * data, uint8_t * sum, size_t sumStride, size_t width, size_t height,
+        uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride, int throughColumn, int int16);
 
-    /*! @ingroup histogram
+    /*! @ingroup object_detection
 
-        \fn void SimdHistogramMasked(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * mask, size_t maskStride, uint8_t index, uint32_t * histogram);
+        \fn void SimdDetectionPrepare(void * hid);
 
-        \short Calculates histogram for 8-bit gray image with using mask.
+        \short Prepares hidden classifier cascade structure to work with given input 8-bit gray image.
 
-        For every point:
-        \verbatim
-        if(mask[i] == index)
-            histogram[src[i]]++.
-        \endverbatim
+        You must call this function before calling of functions ::SimdDetectionHaarDetect32fp, ::SimdDetectionHaarDetect32fi,
+         ::SimdDetectionLbpDetect32fp, ::SimdDetectionLbpDetect32fi, ::SimdDetectionLbpDetect16ip and ::SimdDetectionLbpDetect16ii.
 
-        \note This function has a C++ wrapper Simd::HistogramMasked(const View<A> & src, const View<A> & mask, uint8_t index, uint32_t * histogram).
+        \note This function is used for implementation of Simd::Detection.
 
-        \param [in] src - a pointer to pixels data of input 8-bit gray image.
-        \param [in] srcStride - a row size of the image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [in] mask - a pointer to pixels data of the mask 8-bit image.
-        \param [in] maskStride - a row size of the mask image.
-        \param [in] index - a mask index.
-        \param [out] histogram - a pointer to histogram (array of 256 unsigned 32-bit values).
+        \param [in] hid - a pointer to hidden cascade which was received with using of function ::SimdDetectionInit.
     */
-    SIMD_API void SimdHistogramMasked(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-        const uint8_t * mask, size_t maskStride, uint8_t index, uint32_t * histogram);
+    SIMD_API void SimdDetectionPrepare(void * hid);
 
-    /*! @ingroup histogram
+    /*! @ingroup object_detection
 
-        \fn void SimdHistogramConditional(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint32_t * histogram);
+        \fn void SimdDetectionHaarDetect32fp(const void * hid, const uint8_t * mask, size_t maskStride, ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
-        \short Calculates histogram of 8-bit gray image for those points when mask points satisfying certain condition.
+        \short Performs object detection with using of HAAR cascade classifier (uses 32-bit float numbers, processes all points).
 
-        For every point:
-        \verbatim
-        if(compare(mask[x, y], value))
-            histogram[src[x, y]]++.
-        \endverbatim
+        You must call function ::SimdDetectionPrepare before calling of this functions.
+        All restriction (input mask and bounding box) affects to left-top corner of scanning window.
 
-        \note This function has a C++ wrapper Simd::HistogramConditional(const View<A>& src, const View<A>& mask, uint8_t value, SimdCompareType compareType, uint32_t * histogram).
+        \note This function is used for implementation of Simd::Detection.
 
-        \param [in] src - a pointer to pixels data of input 8-bit gray image.
-        \param [in] srcStride - a row size of the image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [in] mask - a pointer to pixels data of the mask 8-bit image.
+        \param [in] hid - a pointer to hidden cascade which was received with using of function ::SimdDetectionInit.
+        \param [in] mask - a pointer to pixels data of 8-bit image with mask. The mask restricts detection region.
         \param [in] maskStride - a row size of the mask image.
-        \param [in] value - a second value for compare operation.
-        \param [in] compareType - a compare operation type (see ::SimdCompareType).
-        \param [out] histogram - a pointer to histogram (array of 256 unsigned 32-bit values).
+        \param [in] left - a left side of bounding box which restricts detection region.
+        \param [in] top - a top side of bounding box which restricts detection region.
+        \param [in] right - a right side of bounding box which restricts detection region.
+        \param [in] bottom - a bottom side of bounding box which restricts detection region.
+        \param [out] dst - a pointer to pixels data of 8-bit image with output result. None zero points refer to left-top corner of detected objects.
+        \param [in] dstStride - a row size of the dst image.
     */
-    SIMD_API void SimdHistogramConditional(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-        const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint32_t * histogram);
+    SIMD_API void SimdDetectionHaarDetect32fp(const void * hid, const uint8_t * mask, size_t maskStride,
+        ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
-    /*! @ingroup histogram
+    /*! @ingroup object_detection
 
-        \fn void SimdNormalizedColors(const uint32_t * histogram, uint8_t * colors);
+        \fn void SimdDetectionHaarDetect32fi(const void * hid, const uint8_t * mask, size_t maskStride, ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
-        \short Gets normalized color map for given histogram.
+        \short Performs object detection with using of HAAR cascade classifier (uses 32-bit float numbers, processes only even points).
 
-        \param [in] histogram - a pointer to histogram (array of 256 unsigned 32-bit values).
-        \param [out] colors - a pointer to the color map (array of 256 unsigned 8-bit values).
-    */
-    SIMD_API void SimdNormalizedColors(const uint32_t * histogram, uint8_t * colors);
+        You must call function ::SimdDetectionPrepare before calling of this functions.
+        All restriction (input mask and bounding box) affects to left-top corner of scanning window.
 
-    /*! @ingroup histogram
+        \note This function is used for implementation of Simd::Detection.
 
-        \fn void SimdChangeColors(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * colors, uint8_t * dst, size_t dstStride);
+        \param [in] hid - a pointer to hidden cascade which was received with using of function ::SimdDetectionInit.
+        \param [in] mask - a pointer to pixels data of 8-bit image with mask. The mask restricts detection region.
+        \param [in] maskStride - a row size of the mask image.
+        \param [in] left - a left side of bounding box which restricts detection region.
+        \param [in] top - a top side of bounding box which restricts detection region.
+        \param [in] right - a right side of bounding box which restricts detection region.
+        \param [in] bottom - a bottom side of bounding box which restricts detection region.
+        \param [out] dst - a pointer to pixels data of 8-bit image with output result. None zero points refer to left-top corner of detected objects.
+        \param [in] dstStride - a row size of the dst image.
+    */
+    SIMD_API void SimdDetectionHaarDetect32fi(const void * hid, const uint8_t * mask, size_t maskStride,
+        ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
-        \short Changes colors for 8-bit gray image with using of color map.
+    /*! @ingroup object_detection
 
-        The input and output 8-bit gray images must have the same size. 
+        \fn void SimdDetectionHaarDetect16ip(const void * hid, const uint8_t * mask, size_t maskStride, ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
-        \note This function has a C++ wrapper Simd::ChangeColors(const View<A> & src, const uint8_t * colors, View<A> & dst).
+        \short Performs object detection with using of HAAR cascade classifier (uses 16-bit integer numbers, processes all points).
 
-        \param [in] src - a pointer to pixels data of input 8-bit gray image.
-        \param [in] srcStride - a row size of the image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [in] colors - a pointer to the color map (array of 256 unsigned 8-bit values).
-        \param [out] dst - a pointer to pixels data of output 8-bit gray image.
-        \param [in] dstStride - a row size of the output gray image.
-    */
-    SIMD_API void SimdChangeColors(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * colors, uint8_t * dst, size_t dstStride);
+        You must call function ::SimdDetectionPrepare before calling of this functions.
+        All restriction (input mask and bounding box) affects to left-top corner of scanning window.
 
-    /*! @ingroup histogram
+        Rectangle sums are estimated with using of integral images which are scaled to 16-bit range, so results can slightly differ from ::SimdDetectionHaarDetect32fp.
 
-        \fn void SimdNormalizeHistogram(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+        \note This function is used for implementation of Simd::Detection.
 
-        \short Normalizes histogram for 8-bit gray image.
+        \param [in] hid - a pointer to hidden cascade which was received with using of function ::SimdDetectionInit.
+        \param [in] mask - a pointer to pixels data of 8-bit image with mask. The mask restricts detection region.
+        \param [in] maskStride - a row size of the mask image.
+        \param [in] left - a left side of bounding box which restricts detection region.
+        \param [in] top - a top side of bounding box which restricts detection region.
+        \param [in] right - a right side of bounding box which restricts detection region.
+        \param [in] bottom - a bottom side of bounding box which restricts detection region.
+        \param [out] dst - a pointer to pixels data of 8-bit image with output result. None zero points refer to left-top corner of detected objects.
+        \param [in] dstStride - a row size of the dst image.
+    */
+    SIMD_API void SimdDetectionHaarDetect16ip(const void * hid, const uint8_t * mask, size_t maskStride,
+        ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
-        The input and output 8-bit gray images must have the same size.
+    /*! @ingroup object_detection
 
-        \note This function has a C++ wrapper Simd::NormalizeHistogram(const View<A> & src, View<A> & dst).
+        \fn void SimdDetectionHaarDetect16ii(const void * hid, const uint8_t * mask, size_t maskStride, ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
-        \param [in] src - a pointer to pixels data of input 8-bit gray image.
-        \param [in] srcStride - a row size of the image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [out] dst - a pointer to pixels data of output 8-bit image with normalized histogram.
-        \param [in] dstStride - a row size of the output image.
-    */
-    SIMD_API void SimdNormalizeHistogram(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+        \short Performs object detection with using of HAAR cascade classifier (uses 16-bit integer numbers, processes only even points).
 
-    /*! @ingroup hog
+        You must call function ::SimdDetectionPrepare before calling of this functions.
+        All restriction (input mask and bounding box) affects to left-top corner of scanning window.
 
-        \fn void SimdHogDirectionHistograms(const uint8_t * src, size_t stride, size_t width, size_t height, size_t cellX, size_t cellY, size_t quantization, float * histograms);
+        Rectangle sums are estimated with using of integral images which are scaled to 16-bit range, so results can slightly differ from ::SimdDetectionHaarDetect32fi.
 
-        \short Calculates HOG direction histograms for 8-bit gray image.
+        \note This function is used for implementation of Simd::Detection.
 
-        Calculates HOG direction histogram for every cell of 8-bit gray image. This function is useful for face recognition.
-
-        \note This function has a C++ wrapper Simd::HogDirectionHistograms(const View<A> & src, const Point<ptrdiff_t> & cell, size_t quantization, float * histograms).
-
-        \param [in] src - a pointer to pixels data of input 8-bit gray image.
-        \param [in] stride - a row size of the image.
-        \param [in] width - an image width. It must be a multiple of cellX.
-        \param [in] height - an image height. It must be a multiple of cellY.
-        \param [in] cellX - a width of cell.
-        \param [in] cellY - a height of cell.
-        \param [in] quantization - a direction quantization. Must be even.
-        \param [out] histograms - a pointer to buffer with histograms. Array must has size grater or equal to (width/cellX)*(height/cellY)*quantization.
+        \param [in] hid - a pointer to hidden cascade which was received with using of function ::SimdDetectionInit.
+        \param [in] mask - a pointer to pixels data of 8-bit image with mask. The mask restricts detection region.
+        \param [in] maskStride - a row size of the mask image.
+        \param [in] left - a left side of bounding box which restricts detection region.
+        \param [in] top - a top side of bounding box which restricts detection region.
+        \param [in] right - a right side of bounding box which restricts detection region.
+        \param [in] bottom - a bottom side of bounding box which restricts detection region.
+        \param [out] dst - a pointer to pixels data of 8-bit image with output result. None zero points refer to left-top corner of detected objects.
+        \param [in] dstStride - a row size of the dst image.
     */
-    SIMD_API void SimdHogDirectionHistograms(const uint8_t * src, size_t stride, size_t width, size_t height,
-        size_t cellX, size_t cellY, size_t quantization, float * histograms);
+    SIMD_API void SimdDetectionHaarDetect16ii(const void * hid, const uint8_t * mask, size_t maskStride,
+        ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
-    /*! @ingroup hog
+    /*! @ingroup object_detection
 
-        \fn void SimdHogExtractFeatures(const uint8_t * src, size_t stride, size_t width, size_t height, float * features);
+        \fn void SimdDetectionLbpDetect32fp(const void * hid, const uint8_t * mask, size_t maskStride, ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
-        \short Extracts HOG features for 8-bit gray image.
+        \short Performs object detection with using of LBP cascade classifier (uses 32-bit float numbers, processes all points).
 
-        Extracts HOG features 8-bit gray image. 31 features are extracted for 8x8 cell size and 2x2 block size. This function is useful for face recognition.
+        You must call function ::SimdDetectionPrepare before calling of this functions.
+        All restriction (input mask and bounding box) affects to left-top corner of scanning window.
 
-        \note This function has a C++ wrapper Simd::HogExtractFeatures(const View<A> & src, float * features).
+        \note This function is used for implementation of Simd::Detection.
 
-        \param [in] src - a pointer to pixels data of input 8-bit gray image.
-        \param [in] stride - a row size of the image.
-        \param [in] width - an image width. It must be a multiple of 8. Its minimal value is 16.
-        \param [in] height - an image height. It must be a multiple of 8. Its minimal value is 16.
-        \param [out] features - a pointer to buffer with features. Array must has size grater or equal to (width/8)*(height/8)*31.
+        \param [in] hid - a pointer to hidden cascade which was received with using of function ::SimdDetectionInit.
+        \param [in] mask - a pointer to pixels data of 8-bit image with mask. The mask restricts detection region.
+        \param [in] maskStride - a row size of the mask image.
+        \param [in] left - a left side of bounding box which restricts detection region.
+        \param [in] top - a top side of bounding box which restricts detection region.
+        \param [in] right - a right side of bounding box which restricts detection region.
+        \param [in] bottom - a bottom side of bounding box which restricts detection region.
+        \param [out] dst - a pointer to pixels data of 8-bit image with output result. None zero points refer to left-top corner of detected objects.
+        \param [in] dstStride - a row size of the dst image.
     */
-    SIMD_API void SimdHogExtractFeatures(const uint8_t * src, size_t stride, size_t width, size_t height, float * features);
+    SIMD_API void SimdDetectionLbpDetect32fp(const void * hid, const uint8_t * mask, size_t maskStride,
+        ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
-    /*! @ingroup hog
+    /*! @ingroup object_detection
 
-        \fn void SimdHogDeinterleave(const float * src, size_t srcStride, size_t width, size_t height, size_t count, float ** dst, size_t dstStride);
+        \fn void SimdDetectionLbpDetect32fi(const void * hid, const uint8_t * mask, size_t maskStride, ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
-        \short Separates one interleaved 32-bit float point image to separate planes.
+        \short Performs object detection with using of LBP cascade classifier (uses 32-bit float numbers, processes only even points).
 
-        \param [in] src - a pointer to the input interleaved 32-bit float point image.
-        \param [in] srcStride - a row size of input image.
-        \param [in] width - a width of input and output images.
-        \param [in] height - a height of input and output images.
-        \param [in] count - the number of output planes.
-        \param [out] dst - a pointer to array with pointers to output planes.
-        \param [in] dstStride - a row size of output images.
+        You must call function ::SimdDetectionPrepare before calling of this functions.
+        All restriction (input mask and bounding box) affects to left-top corner of scanning window.
+
+        \note This function is used for implementation of Simd::Detection.
+
+        \param [in] hid - a pointer to hidden cascade which was received with using of function ::SimdDetectionInit.
+        \param [in] mask - a pointer to pixels data of 8-bit image with mask. The mask restricts detection region.
+        \param [in] maskStride - a row size of the mask image.
+        \param [in] left - a left side of bounding box which restricts detection region.
+        \param [in] top - a top side of bounding box which restricts detection region.
+        \param [in] right - a right side of bounding box which restricts detection region.
+        \param [in] bottom - a bottom side of bounding box which restricts detection region.
+        \param [out] dst - a pointer to pixels data of 8-bit image with output result. None zero points refer to left-top corner of detected objects.
+        \param [in] dstStride - a row size of the dst image.
     */
-    SIMD_API void SimdHogDeinterleave(const float * src, size_t srcStride, size_t width, size_t height, size_t count, float ** dst, size_t dstStride);
+    SIMD_API void SimdDetectionLbpDetect32fi(const void * hid, const uint8_t * mask, size_t maskStride,
+        ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
-    /*! @ingroup hog
+    /*! @ingroup object_detection
 
-        \fn void SimdHogFilterSeparable(const float * src, size_t srcStride, size_t width, size_t height, const float * rowFilter, size_t rowSize, const float * colFilter, size_t colSize, float * dst, size_t dstStride, int add);
+        \fn void SimdDetectionLbpDetect16ip(const void * hid, const uint8_t * mask, size_t maskStride, ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
-        \short Applies separable filter to given image of 32-bit float point format.
+        \short Performs object detection with using of LBP cascade classifier (uses 16-bit integer numbers, processes all points).
 
-        For every point (except border):
-        \verbatim
-        sum = 0;
-        for(dy = 0; dy < colSize; dy++)
-            for(dx = 0; dx < rowSize; dx++)
-                sum += src[x + dx, y + dy]*colFilter[dy]*rowFilter[dx];
-        if(add)
-            dst[x, y] += sum;
-        else
-            dst[x, y] = sum;
-        \endverbatim
+        You must call function ::SimdDetectionPrepare before calling of this functions.
+        All restriction (input mask and bounding box) affects to left-top corner of scanning window.
 
-        \note Input image has to have size at least not less then size of filter: (width <= rowSize and height <= colSize).
+        \note This function is used for implementation of Simd::Detection.
 
-        \param [in] src - a pointer to input 32-bit float point image.
-        \param [in] srcStride - a row size of input image.
-        \param [in] width - a width of input image. It must be not less then size of row filter.
-        \param [in] height - a height of input image. It must be not less then size of column filter.
-        \param [in] rowFilter - a pointer to 32-bit float point array with row filter.
-        \param [in] rowSize- a size of row filter.
-        \param [in] colFilter - a pointer to 32-bit float point array with column filter.
-        \param [in] colSize- a size of column filter.
-        \param [in, out] dst - a pointer to output 32-bit float point image.
-        \param [in] dstStride - a row size of output image.
-        \param [in] add - a flag which signalizes that result has to be added to existing image.
+        \param [in] hid - a pointer to hidden cascade which was received with using of function ::SimdDetectionInit.
+        \param [in] mask - a pointer to pixels data of 8-bit image with mask. The mask restricts detection region.
+        \param [in] maskStride - a row size of the mask image.
+        \param [in] left - a left side of bounding box which restricts detection region.
+        \param [in] top - a top side of bounding box which restricts detection region.
+        \param [in] right - a right side of bounding box which restricts detection region.
+        \param [in] bottom - a bottom side of bounding box which restricts detection region.
+        \param [out] dst - a pointer to pixels data of 8-bit image with output result. None zero points refer to left-top corner of detected objects.
+        \param [in] dstStride - a row size of the dst image.
     */
-    SIMD_API void SimdHogFilterSeparable(const float * src, size_t srcStride, size_t width, size_t height, const float * rowFilter, size_t rowSize, const float * colFilter, size_t colSize, float * dst, size_t dstStride, int add);
+    SIMD_API void SimdDetectionLbpDetect16ip(const void * hid, const uint8_t * mask, size_t maskStride,
+        ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
-    /*! @ingroup hog
+    /*! @ingroup object_detection
 
-        \fn void SimdHogLiteExtractFeatures(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t cell, float * features, size_t featuresStride);
+        \fn void SimdDetectionLbpDetect16ii(const void * hid, const uint8_t * mask, size_t maskStride, ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
-        \short Extracts lite HOG features for 8-bit gray image.
+        \short Performs object detection with using of LBP cascade classifier (uses 16-bit integer numbers, processes only even points).
 
-        Extracts lite (for 8 directions) HOG features 8-bit gray image. 16 features are extracted for 8x8 or 4x4 cell size and 2x2 block size. 
+        You must call function ::SimdDetectionPrepare before calling of this functions.
+        All restriction (input mask and bounding box) affects to left-top corner of scanning window.
 
-        \note This function has a C++ wrapper Simd::HogLiteExtractFeatures(const View<A> & src, size_t cell, float * features, size_t featuresStride).
+        \note This function is used for implementation of Simd::Detection.
 
-        \param [in] src - a pointer to pixels data of input 8-bit gray image.
-        \param [in] srcStride - a row size of the image.
-        \param [in] width - an image width. Its minimal value is cell*3.
-        \param [in] height - an image height. Its minimal value is cell*3.
-        \param [in] cell - a size of cell. It must be 4 or 8. 
-        \param [out] features - a pointer to buffer with features. Array must has size greater or equal to (height/cell - 2)*featuresStride.
-        \param [in] featuresStride - a row size of the buffer with features. It must be greater or equal to (width/cell - 2)*16.
+        \param [in] hid - a pointer to hidden cascade which was received with using of function ::SimdDetectionInit.
+        \param [in] mask - a pointer to pixels data of 8-bit image with mask. The mask restricts detection region.
+        \param [in] maskStride - a row size of the mask image.
+        \param [in] left - a left side of bounding box which restricts detection region.
+        \param [in] top - a top side of bounding box which restricts detection region.
+        \param [in] right - a right side of bounding box which restricts detection region.
+        \param [in] bottom - a bottom side of bounding box which restricts detection region.
+        \param [out] dst - a pointer to pixels data of 8-bit image with output result. None zero points refer to left-top corner of detected objects.
+        \param [in] dstStride - a row size of the dst image.
     */
-    SIMD_API void SimdHogLiteExtractFeatures(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t cell, float * features, size_t featuresStride);
+    SIMD_API void SimdDetectionLbpDetect16ii(const void * hid, const uint8_t * mask, size_t maskStride,
+        ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
-    /*! @ingroup hog
+    /*! @ingroup edge_background
 
-        \fn void SimdHogLiteFilterFeatures(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t featureSize, const float * filter, size_t filterWidth, size_t filterHeight, const uint32_t * mask, size_t maskStride, float * dst, size_t dstStride);
+        \fn void SimdEdgeBackgroundGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * background, size_t backgroundStride);
 
-        \short Applies filter to lite HOG features.
+        \short Performs edge background update (initial grow, slow mode).
 
-        Applies filter of square shape to lite HOG features. 
+        All images must have the same width, height and format (8-bit gray).
 
-        For every point of output image:
+        For every point:
         \verbatim
-        if(mask[x, y])
-            sum = 0;
-            for(dy = 0; dy < filterHeight; dy++)
-                for(dx = 0; dx < filterWidth*featureSize; dx++)
-                    sum += src[x*featureSize + dx, y + dy]*filter[dx, dy];
-            dst[x, y] = sum;
-        else
-            dst[x, y] = -FLT_MAX;
+        background[i] += value[i] > background[i] ? 1 : 0;
         \endverbatim
 
-        \param [in] src - a pointer to the input 32-bit float array with features.
-        \param [in] srcStride - a row size of input array with features.
-        \param [in] srcWidth - a width of input array with features. Its minimal value is filterSize.
-        \param [in] srcHeight - a height of input array with features. Its minimal value is filterSize.
-        \param [in] featureSize - a size of cell with features. It must be 8 or 16.
-        \param [in] filter - a pointer to the 32-bit float array with filter values. 
-                    Array must have size equal to filterSize*filterSize*featureSize.
-        \param [in] filterWidth - a width of used filter. 
-        \param [in] filterHeight - a height of used filter.
-        \param [in] mask - a pointer to the 32-bit integer array with mask (0 or -1).
-                    Pointer can be null otherwise the array must have size greater then (srcHeight - filterSize)*(srcWidth - filterSize).
-                    A function ::SimdHogLiteCreateMask is usefull in order to create this mask.
-        \param [in] maskStride - a row size of mask array. 
-        \param [out] dst - a pointer to output buffer with result of filtration. Array must have size greater then (srcHeight - filterSize)*(srcWidth - filterSize).
-        \param [in] dstStride - a row size of the output buffer with result of filtration.
-    */
-    SIMD_API void SimdHogLiteFilterFeatures(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t featureSize, const float * filter, size_t filterWidth, size_t filterHeight, const uint32_t * mask, size_t maskStride, float * dst, size_t dstStride);
+        This function is used for edge background updating in motion detection algorithm.
 
-    /*! @ingroup hog
+        \note This function has a C++ wrapper Simd::EdgeBackgroundGrowRangeSlow(const View<A>& value, View<A>& background).
 
-        \fn void SimdHogLiteResizeFeatures(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t featureSize, float * dst, size_t dstStride, size_t dstWidth, size_t dstHeight);
+        \param [in] value - a pointer to pixels data of current feature value.
+        \param [in] valueStride - a row size of the value image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in, out] background - a pointer to pixels data of feature value of edge dynamic background.
+        \param [in] backgroundStride - a row size of the background image.
+    */
+    SIMD_API void SimdEdgeBackgroundGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+        uint8_t * background, size_t backgroundStride);
 
-        \short Resizes 2D-array with lite HOG features.
+    /*! @ingroup edge_background
 
-        Resizes 2D-array with lite HOG features. It use method of bilinear interpolation.
+        \fn void SimdEdgeBackgroundGrowRangeFast(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * background, size_t backgroundStride);
 
-        \param [in] src - a pointer to the input 32-bit float array with features.
-        \param [in] srcStride - a row size of input array with features.
-        \param [in] srcWidth - a width of input array with features. 
-        \param [in] srcHeight - a height of input array with features. 
-        \param [in] featureSize - a size of cell with features. It must be 8 or 16.
-        \param [out] dst - a pointer to the output 32-bit float array with features.
-        \param [in] dstStride - a row size of output array with features.
-        \param [in] dstWidth - a width of output array with features.
-        \param [in] dstHeight - a height of output array with features.
-        */
-    SIMD_API void SimdHogLiteResizeFeatures(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t featureSize, float * dst, size_t dstStride, size_t dstWidth, size_t dstHeight);
+        \short Performs edge background update (initial grow, fast mode).
 
-    /*! @ingroup hog
+        All images must have the same width, height and format (8-bit gray).
 
-        \fn void SimdHogLiteCompressFeatures(const float * src, size_t srcStride, size_t width, size_t height, const float * pca, float * dst, size_t dstStride);
+        For every point:
+        \verbatim
+        background[i] = value[i] > background[i] ? value[i] : background[i];
+        \endverbatim
 
-        \short Compresses 16 features to 8 features for 2D-array.
+        This function is used for edge background updating in motion detection algorithm.
 
-        Compresses 16 features to 8 features for 2D-array. The method uses PCA.
+        \note This function has a C++ wrapper Simd::EdgeBackgroundGrowRangeFast(const View<A>& value, View<A>& background).
 
-        \param [in] src - a pointer to the input 32-bit float array with uncompessed features.
-        \param [in] srcStride - a row size of input array with uncompessed features.
-        \param [in] width - a width of 2D-array with features.
-        \param [in] height - a height of 2D-array with features.
-        \param [in] pca - a pointer to the PCA matrix with size 16x8.
-        \param [out] dst - a pointer to the output 32-bit float array with compessed features.
-        \param [in] dstStride - a row size of output array with compessed features.
+        \param [in] value - a pointer to pixels data of current feature value.
+        \param [in] valueStride - a row size of the value image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in, out] background - a pointer to pixels data of feature value of edge dynamic background.
+        \param [in] backgroundStride - a row size of the background image.
     */
-    SIMD_API void SimdHogLiteCompressFeatures(const float * src, size_t srcStride, size_t width, size_t height, const float * pca, float * dst, size_t dstStride);
+    SIMD_API void SimdEdgeBackgroundGrowRangeFast(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+        uint8_t * background, size_t backgroundStride);
 
-    /*! @ingroup hog
+    /*! @ingroup edge_background
 
-        \fn void SimdHogLiteFilterSeparable(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t featureSize, const float * hFilter, size_t hSize, const float * vFilter, size_t vSize, float * dst, size_t dstStride, int add);
+        \fn void SimdEdgeBackgroundIncrementCount(const uint8_t * value, size_t valueStride, size_t width, size_t height, const uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t * backgroundCount, size_t backgroundCountStride);
 
-        \short Applies separable filter to lite HOG features.
+        \short Performs collection of edge background statistic.
 
-        For every point (except border):
-        \verbatim
-        sum = 0;
-        for(dy = 0; dy < vSize; dy++)
-            for(dx = 0; dx < hSize*featureSize; dx++)
-                sum += src[x*featureSize + dx, y + dy]*vFilter[dy]*hFilter[dx];
-        if(add)
-            dst[x, y] += sum;
-        else
-            dst[x, y] = sum;
+        All images must have the same width, height and format (8-bit gray).
+
+        Updates background statistic counters for every point:
+        \verbatim
+        backgroundCount[i] += (value[i] > backgroundValue[i] && backgroundCount[i] < 255) ? 1 : 0;
         \endverbatim
 
-        \note Input image has to have size at least not less then size of filter: (srcWidth <= hSize and srcHeight <= vSize).
+        This function is used for edge background updating in motion detection algorithm.
 
-        \param [in] src - a pointer to the input 32-bit float array with features.
-        \param [in] srcStride - a row size of input array with features.
-        \param [in] srcWidth - a width of input array with features. Its minimal value is hSize.
-        \param [in] srcHeight - a height of input array with features. Its minimal value is vSize.
-        \param [in] featureSize - a size of cell with features. It must be 8 or 16.
-        \param [in] hFilter - a pointer to 32-bit float point array with horizontal filter.
-        \param [in] hSize - a size of horizontal filter (in featureSize). Total size of horizontal filter is hSize*featureSize.
-        \param [in] vFilter - a pointer to 32-bit float point array with vertical filter.
-        \param [in] vSize- a size of vertical filter.
-        \param [in, out] dst - a pointer to output 32-bit float point image.
-        \param [in] dstStride - a row size of output image.
-        \param [in] add - a flag which signalizes that result has to be added to existing image.
+        \note This function has a C++ wrapper Simd::EdgeBackgroundIncrementCount(const View<A>& value, const View<A>& backgroundValue, View<A>& backgroundCount).
+
+        \param [in] value - a pointer to pixels data of current feature value.
+        \param [in] valueStride - a row size of the value image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] backgroundValue - a pointer to pixels data of value of feature of edge dynamic background.
+        \param [in] backgroundValueStride - a row size of the backgroundValue image.
+        \param [in, out] backgroundCount - a pointer to pixels data of count of feature of edge dynamic background.
+        \param [in] backgroundCountStride - a row size of the backgroundCount image.
     */
-    SIMD_API void SimdHogLiteFilterSeparable(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t featureSize, const float * hFilter, size_t hSize, const float * vFilter, size_t vSize, float * dst, size_t dstStride, int add);
+    SIMD_API void SimdEdgeBackgroundIncrementCount(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+        const uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t * backgroundCount, size_t backgroundCountStride);
 
-    /*! @ingroup hog
+    /*! @ingroup edge_background
 
-        \fn void SimdHogLiteFindMax7x7(const float * a, size_t aStride, const float * b, size_t bStride, size_t height, float * value, size_t * col, size_t * row);
+        \fn void SimdEdgeBackgroundAdjustRange(uint8_t * backgroundCount, size_t backgroundCountStride, size_t width, size_t height, uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t threshold);
 
-        \short Adds two 32-bit float point 2D-array with size 7x7 and finds value and position of maximum in the result array.
+        \short Performs adjustment of edge background range.
 
-        Algorithm description:
+        All images must have the same width, height and format (8-bit gray).
+
+        Adjusts edge background range for every point:
         \verbatim
-        value = -FLT_MAX;
-        for (y = 0; y < height; ++y)
-        {
-            for (x = 0; x < 7; ++x)
-            {
-                v = a[x, y] + b[x, y];
-                if (v > value)
-                {
-                    value = v;
-                    col = x;
-                    row = y;
-                    break;
-                }
-            }
-        }
+        backgroundValue[i] += (backgroundCount[i] > threshold && backgroundValue[i] < 255) ? 1 : 0;
+        backgroundValue[i] -= (backgroundCount[i] < threshold && backgroundValue[i] > 0) ? 1 : 0;
+        backgroundCount[i] = 0;
         \endverbatim
 
-        \param [in] a - a pointer to the first input 32-bit float array with size 7x7.
-        \param [in] aStride - a row size of the first input array.
-        \param [in] b - a pointer to the second input 32-bit float array with size 7x7.
-        \param [in] bStride - a row size of the second input array.
-        \param [in] height - a height of the input arrays. It must be equal or less then 7.
-        \param [out] value - a pointer to the output 32-bit float value with maximum.
-        \param [out] col - a pointer to the output integer value with x-position of maximum.
-        \param [out] row - a pointer to the output integer value with y-position of maximum.
+        This function is used for edge background updating in motion detection algorithm.
+
+        \note This function has a C++ wrapper Simd::EdgeBackgroundAdjustRange(View<A>& backgroundCount, View<A>& backgroundValue, uint8_t threshold).
+
+        \param [in, out] backgroundCount - a pointer to pixels data of count of feature of edge dynamic background.
+        \param [in] backgroundCountStride - a row size of the backgroundCount image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in, out] backgroundValue - a pointer to pixels data of value of feature of edge dynamic background.
+        \param [in] backgroundValueStride - a row size of the backgroundValue image.
+        \param [in] threshold - a count threshold.
     */
-    SIMD_API void SimdHogLiteFindMax7x7(const float * a, size_t aStride, const float * b, size_t bStride, size_t height, float * value, size_t * col, size_t * row);
+    SIMD_API void SimdEdgeBackgroundAdjustRange(uint8_t * backgroundCount, size_t backgroundCountStride, size_t width, size_t height,
+        uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t threshold);
 
-    /*! @ingroup hog
+    /*! @ingroup edge_background
 
-        \fn void SimdHogLiteCreateMask(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const float * threshold, size_t scale, size_t size, uint32_t * dst, size_t dstStride);
+        \fn void SimdEdgeBackgroundAdjustRangeMasked(uint8_t * backgroundCount, size_t backgroundCountStride, size_t width, size_t height, uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t threshold, const uint8_t * mask, size_t maskStride);
 
-        \short Creates mask for function ::SimdHogLiteFilterFeatures.
+        \short Performs adjustment of edge background range with using adjust range mask.
 
-        Zeroes destination mask. Then for every source point:
+        All images must have the same width, height and format (8-bit gray).
+
+        Adjusts edge background range for every point:
         \verbatim
-        if(src[x, y] > threshold)
-            for (dy = 0; dy < size; ++dy)
-                for (dx = 0; dx < size; ++dx)
-                    dst[x*scale + dx, y*scale + dy] = -1;
+        if(mask[i])
+        {
+            backgroundValue[i] += (backgroundCount[i] > threshold && backgroundValue[i] < 255) ? 1 : 0;
+            backgroundValue[i] -= (backgroundCount[i] < threshold && backgroundValue[i] > 0) ? 1 : 0;
+            backgroundCount[i] = 0;
+        }
         \endverbatim
 
-        \param [in] src - a pointer to the input 32-bit float 2D array.
-        \param [in] srcStride - a row size of the input array.
-        \param [in] srcWidth - a width of input array.
-        \param [in] srcHeight - a height of input array.
-        \param [in] threshold - a pointer to 32-bit float threshold.
-        \param [in] scale - a scale coefficient between input and output array.
-        \param [in] size - a size of neighborhood.
-        \param [out] dst - a pointer to the output 32-bit integer array with mask (0 or -1).
-        \param [in] dstStride - a row size of the output array.
+        This function is used for edge background updating in motion detection algorithm.
+
+        \note This function has a C++ wrapper Simd::EdgeBackgroundAdjustRange(View<A>& backgroundCount, View<A>& backgroundValue, uint8_t threshold, const View<A>& mask).
+
+        \param [in, out] backgroundCount - a pointer to pixels data of count of feature of edge dynamic background.
+        \param [in] backgroundCountStride - a row size of the backgroundCount image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in, out] backgroundValue - a pointer to pixels data of value of feature of edge dynamic background.
+        \param [in] backgroundValueStride - a row size of the backgroundValue image.
+        \param [in] threshold - a count threshold.
+        \param [in] mask - a pointer to pixels data of adjust range mask.
+        \param [in] maskStride - a row size of the mask image.
     */
-    SIMD_API void SimdHogLiteCreateMask(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const float * threshold, size_t scale, size_t size, uint32_t * dst, size_t dstStride);
+    SIMD_API void SimdEdgeBackgroundAdjustRangeMasked(uint8_t * backgroundCount, size_t backgroundCountStride, size_t width, size_t height,
+        uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t threshold, const uint8_t * mask, size_t maskStride);
 
-    /*! @ingroup other_conversion
+    /*! @ingroup edge_background
 
-        \fn void SimdInt16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride);
+        \fn void SimdEdgeBackgroundShiftRange(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * background, size_t backgroundStride);
 
-        \short Converts 16-bit signed integer image to 8-bit gray image with saturation
+        \short Shifts edge background range.
 
-        All images must have the same width and height.
+        All images must have the same width, height and format (8-bit gray).
 
         For every point:
         \verbatim
-        dst[i] = Max(0, Min(255, src[i]));
+        background[i] = value[i];
         \endverbatim
 
-        \note This function has a C++ wrapper Simd::Int16ToGray(const View<A> & src, View<A> & dst).
+        This function is used for fast edge background updating in motion detection algorithm.
 
-        \param [in] src - a pointer to pixels data of input 16-bit signed integer image.
+        \note This function has a C++ wrapper Simd::EdgeBackgroundShiftRange(const View<A>& value, View<A>& background).
+
+        \param [in] value - a pointer to pixels data of current feature value.
+        \param [in] valueStride - a row size of the value image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] srcStride - a row size of the 16-bit signed integer image.
-        \param [out] dst - a pointer to pixels data of input 8-bit gray image.
-        \param [out] dstStride - a row size of the gray image.
+        \param [in, out] background - a pointer to pixels data of feature of edge dynamic background.
+        \param [in] backgroundStride - a row size of the background image.
     */
-    SIMD_API void SimdInt16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride);
+    SIMD_API void SimdEdgeBackgroundShiftRange(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+        uint8_t * background, size_t backgroundStride);
 
-    /*! @ingroup integral
+    /*! @ingroup edge_background
 
-        \fn void SimdIntegral(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride, SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat);
+        \fn void SimdEdgeBackgroundShiftRangeMasked(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * background, size_t backgroundStride, const uint8_t * mask, size_t maskStride);
 
-        \short Calculates integral images for input 8-bit gray image.
+        \short Shifts edge background range with using shift range mask.
 
-        The function can calculates sum integral image, square sum integral image (optionally) and tilted sum integral image (optionally).
-        A integral images must have width and height per unit greater than that of the input image.
+        All images must have the same width, height and format (8-bit gray).
 
-        \note This function has a C++ wrappers:
-        \n Simd::Integral(const View<A>& src, View<A>& sum),
-        \n Simd::Integral(const View<A>& src, View<A>& sum, View<A>& sqsum),
-        \n Simd::Integral(const View<A>& src, View<A>& sum, View<A>& sqsum, View<A>& tilted).
+        For every point:
+        \verbatim
+        if(mask[i]])
+            background[i] = value[i];
+        \endverbatim
 
-        \param [in] src - a pointer to pixels data of input 8-bit gray image.
-        \param [in] srcStride - a row size of src image.
+        This function is used for fast edge background updating in motion detection algorithm.
+
+        \note This function has a C++ wrapper Simd::EdgeBackgroundShiftRange(const View<A>& value, View<A>& background, const View<A>& mask).
+
+        \param [in] value - a pointer to pixels data of current feature value.
+        \param [in] valueStride - a row size of the value image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [out] sum - a pointer to pixels data of 32-bit integer sum image.
-        \param [in] sumStride - a row size of sum image (in bytes).
-        \param [out] sqsum - a pointer to pixels data of 32-bit integer or 64-bit float point square sum image. It can be NULL.
-        \param [in] sqsumStride - a row size of sqsum image (in bytes).
-        \param [out] tilted - a pointer to pixels data of 32-bit integer tilted sum image. It can be NULL.
-        \param [in] tiltedStride - a row size of tilted image (in bytes).
-        \param [in] sumFormat - a format of sum image and tilted image. It can be equal to ::SimdPixelFormatInt32.
-        \param [in] sqsumFormat - a format of sqsum image. It can be equal to ::SimdPixelFormatInt32 or ::SimdPixelFormatDouble.
+        \param [in, out] background - a pointer to pixels data of feature of edge dynamic background.
+        \param [in] backgroundStride - a row size of the background image.
+        \param [in] mask - a pointer to pixels data of shift range mask.
+        \param [in] maskStride - a row size of the mask image.
     */
-    SIMD_API void SimdIntegral(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-        uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride,
-        SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat);
+    SIMD_API void SimdEdgeBackgroundShiftRangeMasked(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+        uint8_t * background, size_t backgroundStride, const uint8_t * mask, size_t maskStride);
 
-    /*! @ingroup interference
+    /*! @ingroup edge_background
 
-        \fn void SimdInterferenceIncrement(uint8_t * statistic, size_t stride, size_t width, size_t height, uint8_t increment, int16_t saturation);
+        \fn void SimdEdgeBackgroundPackedInit(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride);
 
-        \short Increments statistic of interference detector.
+        \short Initializes edge background model in packed format.
+
+        In packed format the whole edge background model is stored in one image with 2 bytes per pixel: {background, count}.
+        Conversion from/to separate images can be performed with using of ::SimdInterleaveUv and ::SimdDeinterleaveUv.
+        The packed model is processed by ::SimdEdgeBackgroundPackedUpdate, ::SimdEdgeBackgroundPackedGrowRangeSlow, ::SimdEdgeBackgroundPackedShiftRange,
+        ::SimdEdgeBackgroundPackedShiftRangeMasked and ::SimdEdgeBackgroundPackedAdjustRangeMasked without conversion to separate images.
+        Masks for the masked functions can be created by ::SimdBackgroundInitMask.
 
         For every point:
         \verbatim
-        statistic[i] = min(statistic[i] + increment, saturation);
+        model[2*i + 0] = value[i];
+        model[2*i + 1] = 0;
         \endverbatim
 
-        This function is used for interference detection in motion detection algorithm.
-
-        \note This function has a C++ wrappers: Simd::InterferenceIncrement(View<A> & dst, uint8_t increment, int16_t saturation).
+        \note This function has a C++ wrapper Simd::EdgeBackgroundPackedInit(const View<A>& value, View<A>& model).
 
-        \param [in, out] statistic - a pointer to pixels data of 16-bit signed integer image with statistic.
-        \param [in] stride - a row size of statistic image.
+        \param [in] value - a pointer to pixels data of current feature value (8-bit gray image).
+        \param [in] valueStride - a row size of the value image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] increment - an increment of statistic.
-        \param [in] saturation - an upper saturation of statistic.
+        \param [out] model - a pointer to pixels data of packed edge background model (2 bytes per pixel).
+        \param [in] modelStride - a row size of the model image.
     */
-    SIMD_API void SimdInterferenceIncrement(uint8_t * statistic, size_t stride, size_t width, size_t height, uint8_t increment, int16_t saturation);
+    SIMD_API void SimdEdgeBackgroundPackedInit(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride);
 
-    /*! @ingroup interference
+    /*! @ingroup edge_background
 
-        \fn void SimdInterferenceIncrementMasked(uint8_t * statistic, size_t statisticStride, size_t width, size_t height, uint8_t increment, int16_t saturation, const uint8_t * mask, size_t maskStride, uint8_t index);
+        \fn void SimdEdgeBackgroundPackedUpdate(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride, uint8_t threshold, int flags);
 
-        \short Increments statistic of interference detector with using segmentation mask.
+        \short Performs several steps of update of edge background model in packed format in one pass over the images.
 
-        For every point:
+        The packed model has 2 bytes per pixel: {background, count} (see ::SimdEdgeBackgroundPackedInit).
+        For every point the steps selected by flags are executed in the next order:
         \verbatim
-        if(mask[i] == index)
-            statistic[i] = min(statistic[i] + increment, saturation);
+        if(flags & SimdBackgroundUpdateGrowRange)
+            background[i] = max(background[i], value[i]);
+        if(flags & SimdBackgroundUpdateIncrementCount)
+        {
+            if(value[i] > background[i] && count[i] < 255)
+                count[i]++;
+        }
+        if(flags & SimdBackgroundUpdateAdjustRange)
+        {
+            if(count[i] < threshold)
+                background[i] = max(background[i] - 1, 0);
+            if(count[i] > threshold)
+                background[i] = min(background[i] + 1, 255);
+            count[i] = 0;
+        }
         \endverbatim
+        The result is equal to sequential calls of ::SimdEdgeBackgroundGrowRangeFast, ::SimdEdgeBackgroundIncrementCount and ::SimdEdgeBackgroundAdjustRange
+        applied to separate images of the model.
 
-        All images must have the same width, height.
-        This function is used for interference detection in motion detection algorithm.
-
-        \note This function has a C++ wrappers: Simd::InterferenceIncrementMasked(View<A> & dst, uint8_t increment, int16_t saturation, const View<A>& mask, uint8_t index).
+        \note This function has a C++ wrapper Simd::EdgeBackgroundPackedUpdate(const View<A>& value, View<A>& model, uint8_t threshold, int flags).
 
-        \param [in, out] statistic - a pointer to pixels data of 16-bit signed integer image with statistic.
-        \param [in] statisticStride - a row size of statistic image.
+        \param [in] value - a pointer to pixels data of current feature value (8-bit gray image).
+        \param [in] valueStride - a row size of the value image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] increment - an increment of statistic.
-        \param [in] saturation - an upper saturation of statistic.
-        \param [in] mask - a pointer to pixels data of 8-bit gray image with mask.
-        \param [in] maskStride - a row size of mask image.
-        \param [in] index - an index of mask.
+        \param [in, out] model - a pointer to pixels data of packed edge background model (2 bytes per pixel).
+        \param [in] modelStride - a row size of the model image.
+        \param [in] threshold - a count threshold (is used by ::SimdBackgroundUpdateAdjustRange step).
+        \param [in] flags - a combination of ::SimdBackgroundUpdateFlags.
     */
-    SIMD_API void SimdInterferenceIncrementMasked(uint8_t * statistic, size_t statisticStride, size_t width, size_t height,
-        uint8_t increment, int16_t saturation, const uint8_t * mask, size_t maskStride, uint8_t index);
+    SIMD_API void SimdEdgeBackgroundPackedUpdate(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+        uint8_t * model, size_t modelStride, uint8_t threshold, int flags);
 
-    /*! @ingroup interference
+    /*! @ingroup edge_background
 
-        \fn void SimdInterferenceDecrement(uint8_t * statistic, size_t stride, size_t width, size_t height, uint8_t decrement, int16_t saturation);
+        \fn void SimdEdgeBackgroundPackedGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride);
 
-        \short Decrements statistic of interference detector.
+        \short Performs edge background update (initial grow, slow mode) of edge background model in packed format.
+
+        The packed model has 2 bytes per pixel: {background, count} (see ::SimdEdgeBackgroundPackedInit).
 
         For every point:
         \verbatim
-        statistic[i] = max(statistic[i] - decrement, saturation);
+        background[i] += value[i] > background[i] ? 1 : 0;
         \endverbatim
 
-        This function is used for interference detection in motion detection algorithm.
+        The result is equal to the result of ::SimdEdgeBackgroundGrowRangeSlow applied to separate images of the model.
 
-        \note This function has a C++ wrappers: Simd::InterferenceDecrement(View<A> & dst, uint8_t decrement, int16_t saturation).
+        \note This function has a C++ wrapper Simd::EdgeBackgroundPackedGrowRangeSlow(const View<A>& value, View<A>& model).
 
-        \param [in, out] statistic - a pointer to pixels data of 16-bit signed integer image with statistic.
-        \param [in] stride - a row size of statistic image.
+        \param [in] value - a pointer to pixels data of current feature value (8-bit gray image).
+        \param [in] valueStride - a row size of the value image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] decrement - a decrement of statistic.
-        \param [in] saturation - a lower saturation of statistic.
+        \param [in, out] model - a pointer to pixels data of packed edge background model (2 bytes per pixel).
+        \param [in] modelStride - a row size of the model image.
     */
-    SIMD_API void SimdInterferenceDecrement(uint8_t * statistic, size_t stride, size_t width, size_t height, uint8_t decrement, int16_t saturation);
+    SIMD_API void SimdEdgeBackgroundPackedGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride);
 
-    /*! @ingroup interference
+    /*! @ingroup edge_background
 
-        \fn void SimdInterferenceDecrementMasked(uint8_t * statistic, size_t statisticStride, size_t width, size_t height, uint8_t decrement, int16_t saturation, const uint8_t * mask, size_t maskStride, uint8_t index);
+        \fn void SimdEdgeBackgroundPackedAdjustRangeMasked(uint8_t * model, size_t modelStride, size_t width, size_t height, uint8_t threshold, const uint8_t * mask, size_t maskStride);
 
-        \short Decrements statistic of interference detector with using segmentation mask.
+        \short Performs adjustment of edge background range of edge background model in packed format with using adjust range mask.
+
+        The packed model has 2 bytes per pixel: {background, count} (see ::SimdEdgeBackgroundPackedInit).
+        The mask is 8-bit gray image (it can be created by ::SimdBackgroundInitMask).
 
         For every point:
         \verbatim
-        if(mask[i] == index)
-            statistic[i] = max(statistic[i] - decrement, saturation);
+        if(mask[i])
+        {
+            background[i] += (count[i] > threshold && background[i] < 255) ? 1 : 0;
+            background[i] -= (count[i] < threshold && background[i] > 0) ? 1 : 0;
+        }
+        count[i] = 0;
         \endverbatim
 
-        All images must have the same width, height.
-        This function is used for interference detection in motion detection algorithm.
+        The result is equal to the result of ::SimdEdgeBackgroundAdjustRangeMasked applied to separate images of the model.
 
-        \note This function has a C++ wrappers: Simd::InterferenceDecrementMasked(View<A> & dst, uint8_t decrement, int16_t saturation, const View<A>& mask, uint8_t index).
+        \note This function has a C++ wrapper Simd::EdgeBackgroundPackedAdjustRange(View<A>& model, uint8_t threshold, const View<A>& mask).
 
-        \param [in, out] statistic - a pointer to pixels data of 16-bit signed integer image with statistic.
-        \param [in] statisticStride - a row size of statistic image.
+        \param [in, out] model - a pointer to pixels data of packed edge background model (2 bytes per pixel).
+        \param [in] modelStride - a row size of the model image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] decrement - a decrement of statistic.
-        \param [in] saturation - a lower saturation of statistic.
-        \param [in] mask - a pointer to pixels data of 8-bit gray image with mask.
-        \param [in] maskStride - a row size of mask image.
-        \param [in] index - an index of mask.
+        \param [in] threshold - a count threshold.
+        \param [in] mask - a pointer to pixels data of adjust range mask.
+        \param [in] maskStride - a row size of the mask image.
     */
-    SIMD_API void SimdInterferenceDecrementMasked(uint8_t * statistic, size_t statisticStride, size_t width, size_t height,
-        uint8_t decrement, int16_t saturation, const uint8_t * mask, size_t maskStride, uint8_t index);
+    SIMD_API void SimdEdgeBackgroundPackedAdjustRangeMasked(uint8_t * model, size_t modelStride, size_t width, size_t height,
+        uint8_t threshold, const uint8_t * mask, size_t maskStride);
 
-    /*! @ingroup other_conversion
+    /*! @ingroup edge_background
 
-        \fn void SimdInterleaveUv(const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * uv, size_t uvStride);
+        \fn void SimdEdgeBackgroundPackedShiftRange(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride);
 
-        \short Interleaves 8-bit U and V planar images into one 16-bit UV interleaved image.
+        \short Shifts edge background range of edge background model in packed format.
 
-        All images must have the same width and height.
-        This function used for YUV420P to NV12 conversion.
+        The packed model has 2 bytes per pixel: {background, count} (see ::SimdEdgeBackgroundPackedInit).
+        The counters are not changed.
 
-        \note This function has a C++ wrapper Simd::InterleaveUv(const View<A>& u, const View<A>& v, View<A>& uv).
+        For every point:
+        \verbatim
+        background[i] = value[i];
+        \endverbatim
 
-        \param [in] u - a pointer to pixels data of input 8-bit U planar image.
-        \param [in] uStride - a row size of the u image.
-        \param [in] v - a pointer to pixels data of input 8-bit V planar image.
-        \param [in] vStride - a row size of the v image.
+        The result is equal to the result of ::SimdEdgeBackgroundShiftRange applied to separate images of the model.
+
+        \note This function has a C++ wrapper Simd::EdgeBackgroundPackedShiftRange(const View<A>& value, View<A>& model).
+
+        \param [in] value - a pointer to pixels data of current feature value (8-bit gray image).
+        \param [in] valueStride - a row size of the value image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [out] uv - a pointer to pixels data of output 16-bit UV interleaved image.
-        \param [in] uvStride - a row size of the uv image.
+        \param [in, out] model - a pointer to pixels data of packed edge background model (2 bytes per pixel).
+        \param [in] modelStride - a row size of the model image.
     */
-    SIMD_API void SimdInterleaveUv(const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * uv, size_t uvStride);
+    SIMD_API void SimdEdgeBackgroundPackedShiftRange(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride);
 
-    /*! @ingroup other_conversion
+    /*! @ingroup edge_background
 
-        \fn void SimdInterleaveBgr(const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+        \fn void SimdEdgeBackgroundPackedShiftRangeMasked(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride, const uint8_t * mask, size_t maskStride);
 
-        \short Interleaves 8-bit Blue, Green and Red planar images into one 24-bit BGR interleaved image.
+        \short Shifts edge background range of edge background model in packed format with using shift range mask.
 
-        All images must have the same width and height.
+        The packed model has 2 bytes per pixel: {background, count} (see ::SimdEdgeBackgroundPackedInit).
+        The mask is 8-bit gray image (it can be created by ::SimdBackgroundInitMask). The counters are not changed.
 
-        \note This function has a C++ wrapper Simd::InterleaveBgr(const View<A>& b, const View<A>& g, const View<A>& r, View<A>& bgr).
+        For every point:
+        \verbatim
+        if(mask[i])
+            background[i] = value[i];
+        \endverbatim
 
-        \param [in] b - a pointer to pixels data of input 8-bit Blue planar image.
-        \param [in] bStride - a row size of the b image.
-        \param [in] g - a pointer to pixels data of input 8-bit Green planar image.
-        \param [in] gStride - a row size of the g image.
-        \param [in] r - a pointer to pixels data of input 8-bit Red planar image.
-        \param [in] rStride - a row size of the r image.
+        The result is equal to the result of ::SimdEdgeBackgroundShiftRangeMasked applied to separate images of the model.
+
+        \note This function has a C++ wrapper Simd::EdgeBackgroundPackedShiftRange(const View<A>& value, View<A>& model, const View<A>& mask).
+
+        \param [in] value - a pointer to pixels data of current feature value (8-bit gray image).
+        \param [in] valueStride - a row size of the value image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [out] bgr - a pointer to pixels data of output 24-bit BGR interleaved image.
-        \param [in] bgrStride - a row size of the bgr image.
+        \param [in, out] model - a pointer to pixels data of packed edge background model (2 bytes per pixel).
+        \param [in] modelStride - a row size of the model image.
+        \param [in] mask - a pointer to pixels data of shift range mask.
+        \param [in] maskStride - a row size of the mask image.
     */
-    SIMD_API void SimdInterleaveBgr(const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride,
-        size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
-
-    /*! @ingroup other_conversion
+    SIMD_API void SimdEdgeBackgroundPackedShiftRangeMasked(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+        uint8_t * model, size_t modelStride, const uint8_t * mask, size_t maskStride);
 
-        \fn void SimdInterleaveBgra(const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride, const uint8_t * a, size_t aStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride);
+    /*! @ingroup filling
 
-        \short Interleaves 8-bit Blue, Green, Red and Alpha planar images into one 32-bit BGRA interleaved image.
+        \fn void SimdFill(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize, uint8_t value);
 
-        All images must have the same width and height.
+        \short Fills pixels data of image by given value.
 
-        \note This function has a C++ wrapper Simd::InterleaveBgra(const View<A>& b, const View<A>& g, const View<A>& r, const View<A>& a, View<A>& bgra).
+        \note This function has a C++ wrapper Simd::Fill(View<A>& dst, uint8_t value).
 
-        \param [in] b - a pointer to pixels data of input 8-bit Blue planar image.
-        \param [in] bStride - a row size of the b image.
-        \param [in] g - a pointer to pixels data of input 8-bit Green planar image.
-        \param [in] gStride - a row size of the g image.
-        \param [in] r - a pointer to pixels data of input 8-bit Red planar image.
-        \param [in] rStride - a row size of the r image.
-        \param [in] a - a pointer to pixels data of input 8-bit Alpha planar image.
-        \param [in] aStride - a row size of the a image.
+        \param [out] dst - a pointer to pixels data of destination image.
+        \param [in] stride - a row size of the dst image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA interleaved image.
-        \param [in] bgraStride - a row size of the bgr image.
+        \param [in] pixelSize - a size of the image pixel.
+        \param [in] value - a value to fill image.
     */
-    SIMD_API void SimdInterleaveBgra(const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride, const uint8_t * a, size_t aStride,
-        size_t width, size_t height, uint8_t * bgra, size_t bgraStride);
-
-    /*! @ingroup laplace_filter
-
-        \fn void SimdLaplace(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+    SIMD_API void SimdFill(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize, uint8_t value);
 
-        \short Calculates Laplace's filter.
+    /*! @ingroup filling
 
-        All images must have the same width and height. Input image must has 8-bit gray format, output image must has 16-bit integer format.
+        \fn void SimdFillFrame(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize, size_t frameLeft, size_t frameTop, size_t frameRight, size_t frameBottom, uint8_t value);
 
-        For every point:
-        \verbatim
-        dst[x, y] =
-            - src[x-1, y-1] -   src[x, y-1] - src[x+1, y-1]
-            - src[x-1, y]   + 8*src[x, y]   - src[x+1, y]
-            - src[x-1, y+1] -   src[x, y+1] - src[x+1, y+1].
-        \endverbatim
+        \short Fills pixels data of image except for the portion bounded frame by given value.
 
-        \note This function has a C++ wrappers: Simd::Laplace(const View<A>& src, View<A>& dst).
+        \note This function has a C++ wrapper Simd::FillFrame(View<A>& dst, const Rectangle<ptrdiff_t> & frame, uint8_t value).
 
-        \param [in] src - a pointer to pixels data of the input image.
-        \param [in] srcStride - a row size of the input image.
+        \param [out] dst - a pointer to pixels data of destination image.
+        \param [in] stride - a row size of the dst image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [out] dst - a pointer to pixels data of the output image.
-        \param [in] dstStride - a row size of the output image (in bytes).
+        \param [in] pixelSize - a size of the image pixel.
+        \param [in] frameLeft - a frame left side.
+        \param [in] frameTop - a frame top side.
+        \param [in] frameRight - a frame right side.
+        \param [in] frameBottom - a frame bottom side.
+        \param [in] value - a value to fill image.
     */
-    SIMD_API void SimdLaplace(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
-
-    /*! @ingroup laplace_filter
-
-        \fn void SimdLaplaceAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+    SIMD_API void SimdFillFrame(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize,
+        size_t frameLeft, size_t frameTop, size_t frameRight, size_t frameBottom, uint8_t value);
 
-        \short Calculates absolute value of Laplace's filter.
+    /*! @ingroup filling
 
-        All images must have the same width and height. Input image must has 8-bit gray format, output image must has 16-bit integer format.
+        \fn void SimdFillBgr(uint8_t * dst, size_t stride, size_t width, size_t height, uint8_t blue, uint8_t green, uint8_t red);
 
-        For every point:
-        \verbatim
-        dst[x, y] = abs(
-            - src[x-1, y-1] -   src[x, y-1] - src[x+1, y-1]
-            - src[x-1, y]   + 8*src[x, y]   - src[x+1, y]
-            - src[x-1, y+1] -   src[x, y+1] - src[x+1, y+1]).
-        \endverbatim
+        \short Fills pixels data of 24-bit BGR image by given color(blue, green, red).
 
-        \note This function has a C++ wrappers: Simd::LaplaceAbs(const View<A>& src, View<A>& dst).
+        \note This function has a C++ wrapper Simd::FillBgr(View<A>& dst, uint8_t blue, uint8_t green, uint8_t red).
 
-        \param [in] src - a pointer to pixels data of the input image.
-        \param [in] srcStride - a row size of the input image.
+        \param [out] dst - a pointer to pixels data of destination image.
+        \param [in] stride - a row size of the dst image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [out] dst - a pointer to pixels data of the output image.
-        \param [in] dstStride - a row size of the output image (in bytes).
+        \param [in] blue - a blue channel of BGR to fill image.
+        \param [in] green - a green channel of BGR to fill image.
+        \param [in] red - a red channel of BGR to fill image.
     */
-    SIMD_API void SimdLaplaceAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
-
-    /*! @ingroup other_statistic
-
-        \fn void SimdLaplaceAbsSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum);
+    SIMD_API void SimdFillBgr(uint8_t * dst, size_t stride, size_t width, size_t height, uint8_t blue, uint8_t green, uint8_t red);
 
-        \short Calculates sum of absolute value of Laplace's filter.
+    /*! @ingroup filling
 
-        Input image must has 8-bit gray format.
+        \fn void SimdFillBgra(uint8_t * dst, size_t stride, size_t width, size_t height, uint8_t blue, uint8_t green, uint8_t red, uint8_t alpha);
 
-        For every point:
-        \verbatim
-        sum += abs(
-            - src[x-1, y-1] -   src[x, y-1] - src[x+1, y-1]
-            - src[x-1, y]   + 8*src[x, y]   - src[x+1, y]
-            - src[x-1, y+1] -   src[x, y+1] - src[x+1, y+1]).
-        \endverbatim
+        \short Fills pixels data of 32-bit BGRA image by given color(blue, green, red, alpha).
 
-        \note This function has a C++ wrappers: Simd::LaplaceAbsSum(const View<A>& src, uint64_t & sum).
+        \note This function has a C++ wrapper Simd::FillBgra(View<A>& dst, uint8_t blue, uint8_t green, uint8_t red, uint8_t alpha).
 
-        \param [in] src - a pointer to pixels data of the input image.
-        \param [in] stride - a row size of the input image.
+        \param [out] dst - a pointer to pixels data of destination image.
+        \param [in] stride - a row size of the dst image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [out] sum - a pointer to result sum.
+        \param [in] blue - a blue channel of BGRA to fill image.
+        \param [in] green - a green channel of BGRA to fill image.
+        \param [in] red - a red channel of BGRA to fill image.
+        \param [in] alpha - a alpha channel of BGRA to fill image.
     */
-    SIMD_API void SimdLaplaceAbsSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum);
-
-    /*! @ingroup other_filter
+    SIMD_API void SimdFillBgra(uint8_t * dst, size_t stride, size_t width, size_t height,
+        uint8_t blue, uint8_t green, uint8_t red, uint8_t alpha);
 
-        \fn void SimdLbpEstimate(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+    /*! @ingroup filling
 
-        \short Calculates LBP (Local Binary Patterns) for 8-bit gray image.
+        \fn void SimdFillPixel(uint8_t * dst, size_t stride, size_t width, size_t height, const uint8_t * pixel, size_t pixelSize);
 
-        All images must have the same width and height.
+        \short Fills image by value of given pixel.
 
-        \note This function has a C++ wrappers: Simd::LbpEstimate(const View<A>& src, View<A>& dst).
+        \note This function has a C++ wrapper Simd::FillPixel(View<A> & dst, const Pixel & pixel).
 
-        \param [in] src - a pointer to pixels data of input 8-bit gray image.
-        \param [in] srcStride - a row size of src image.
+        \param [out] dst - a pointer to pixels data of destination image.
+        \param [in] stride - a row size of the dst image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [out] dst - a pointer to pixels data of output 8-bit gray image with LBP.
-        \param [in] dstStride - a row size of dst image.
+        \param [in] pixel - a pointer to pixel to fill.
+        \param [in] pixelSize - a size of the image pixel. Parameter is restricted by range [1, 4]. 
     */
-    SIMD_API void SimdLbpEstimate(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+    SIMD_API void SimdFillPixel(uint8_t * dst, size_t stride, size_t width, size_t height, const uint8_t * pixel, size_t pixelSize);
 
-    /*! @ingroup other_filter
+    /*! @ingroup filling
 
-        \fn void SimdMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
+        \fn void SimdFill32f(float * dst, size_t size, const float * value);
 
-        \short Performs an averaging with window 3x3.
+        \short Fills 32-bit float array by given value.
 
-        For every point:
-        \verbatim
-        dst[x, y] = (src[x-1, y-1] + src[x, y-1] + src[x+1, y-1] +
-                     src[x-1, y] + src[x, y] + src[x+1, y] +
-                     src[x-1, y+1] + src[x, y+1] + src[x+1, y+1] + 4) / 9;
-        \endverbatim
+        \param [out] dst - a pointer to 32-bit float array.
+        \param [in] size - a size of the array.
+        \param [in] value - a pointer to value to fill. Can be NULL (filling value is assumed to be equal to zero).
+    */
+    SIMD_API void SimdFill32f(float * dst, size_t size, const float * value);
 
-        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+    /*! @ingroup float16
 
-        \note This function has a C++ wrapper Simd::MeanFilter3x3(const View<A>& src, View<A>& dst).
+        \fn void SimdFloat32ToFloat16(const float * src, size_t size, uint16_t * dst);
 
-        \param [in] src - a pointer to pixels data of source image.
-        \param [in] srcStride - a row size of the src image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [in] channelCount - a channel count.
-        \param [out] dst - a pointer to pixels data of destination image.
-        \param [in] dstStride - a row size of the dst image.
+        \short Converts numbers in the array from 32-bit float to 16-bit float format.
+
+        \param [in] src - a pointer to the input array with 32-bit float point numbers.
+        \param [in] size - a size of input and output array.
+        \param [out] dst - a pointer to the output array with 16-bit float point numbers.
     */
-    SIMD_API void SimdMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-        size_t channelCount, uint8_t * dst, size_t dstStride);
+    SIMD_API void SimdFloat32ToFloat16(const float * src, size_t size, uint16_t * dst);
 
-    /*! @ingroup median_filter
+    /*! @ingroup float16
 
-        \fn void SimdMedianFilterRhomb3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
+        \fn void SimdFloat16ToFloat32(const uint16_t* src, size_t size, float  * dst);
 
-        \short Performs median filtration of input image (filter window is a rhomb 3x3).
+        \short Converts numbers in the array from 16-bit float to 32-bit float format.
 
-        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
-
-        \note This function has a C++ wrappers: Simd::MedianFilterRhomb3x3(const View<A>& src, View<A>& dst).
-
-        \param [in] src - a pointer to pixels data of original input image.
-        \param [in] srcStride - a row size of src image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [in] channelCount - a channel count.
-        \param [out] dst - a pointer to pixels data of filtered output image.
-        \param [in] dstStride - a row size of dst image.
+        \param [in] src - a pointer to the input array with 16-bit float point numbers.
+        \param [in] size - a size of input and output array.
+        \param [out] dst - a pointer to the output array with 32-bit float point numbers.
     */
-    SIMD_API void SimdMedianFilterRhomb3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-        size_t channelCount, uint8_t * dst, size_t dstStride);
+    SIMD_API void SimdFloat16ToFloat32(const uint16_t * src, size_t size, float * dst);
 
-    /*! @ingroup median_filter
+    /*! @ingroup float16
 
-        \fn void SimdMedianFilterRhomb5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
+        \fn void SimdSquaredDifferenceSum16f(const uint16_t * a, const uint16_t * b, size_t size, float * sum);
 
-        \short Performs median filtration of input image (filter window is a rhomb 5x5).
+        \short Calculates sum of squared differences for two 16-bit float arrays.
 
-        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+        All arrays must have the same size.
 
-        \note This function has a C++ wrappers: Simd::MedianFilterRhomb5x5(const View<A>& src, View<A>& dst).
+        For every element:
+        \verbatim
+        sum += (a[i] - b[i])*(a[i] - b[i]);
+        \endverbatim
 
-        \param [in] src - a pointer to pixels data of original input image.
-        \param [in] srcStride - a row size of src image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [in] channelCount - a channel count.
-        \param [out] dst - a pointer to pixels data of filtered output image.
-        \param [in] dstStride - a row size of dst image.
+        \param [in] a - a pointer to the first 16-bit float array.
+        \param [in] b - a pointer to the second 16-bit float array.
+        \param [in] size - a size of arrays.
+        \param [out] sum - a pointer to 32-bit float point sum of squared differences.
     */
-    SIMD_API void SimdMedianFilterRhomb5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-        size_t channelCount, uint8_t * dst, size_t dstStride);
+    SIMD_API void SimdSquaredDifferenceSum16f(const uint16_t * a, const uint16_t * b, size_t size, float * sum);
 
-    /*! @ingroup median_filter
+    /*! @ingroup float16
 
-        \fn void SimdMedianFilterSquare3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
+        \fn void SimdCosineDistance16f(const uint16_t * a, const uint16_t * b, size_t size, float * distance);
 
-        \short Performs median filtration of input image (filter window is a square 3x3).
+        \short Calculates cosine distance of two 16-bit float arrays.
 
-        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+        All arrays must have the same size.
 
-        \note This function has a C++ wrappers: Simd::MedianFilterSquare3x3(const View<A>& src, View<A>& dst).
+        Algorithm description:
+        \verbatim
+        distance = 1 - Sum(a[i]*b[i])/Sqrt(Sum(a[i]*a[i])*Sum(b[i]*b[i]));
+        \endverbatim
 
-        \param [in] src - a pointer to pixels data of original input image.
-        \param [in] srcStride - a row size of src image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [in] channelCount - a channel count.
-        \param [out] dst - a pointer to pixels data of filtered output image.
-        \param [in] dstStride - a row size of dst image.
+        \param [in] a - a pointer to the first 16-bit float array.
+        \param [in] b - a pointer to the second 16-bit float array.
+        \param [in] size - a size of arrays.
+        \param [out] distance - a pointer to 32-bit float with cosine distance.
     */
-    SIMD_API void SimdMedianFilterSquare3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-        size_t channelCount, uint8_t * dst, size_t dstStride);
-
-    /*! @ingroup median_filter
+    SIMD_API void SimdCosineDistance16f(const uint16_t * a, const uint16_t * b, size_t size, float * distance);
 
-        \fn void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
+    /*! @ingroup float16
 
-        \short Performs median filtration of input image (filter window is a square 5x5).
+        \fn void SimdCosineDistancesMxNa16f(size_t M, size_t N, size_t K, const uint16_t * const * A, const uint16_t * const * B, float * distances);
 
-        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+        \short Calculates mutual cosine distance of two arrays of 16-bit float arrays.
 
-        \note This function has a C++ wrappers: Simd::MedianFilterSquare5x5(const View<A>& src, View<A>& dst).
+        Algorithm description:
+        \verbatim
+        distances[i, j] = 1 - Sum(A[i][k]*B[j][k])/Sqrt(Sum(A[i][k]*A[i][k])*Sum(B[j][k]*B[j][k]));
+        \endverbatim
 
-        \param [in] src - a pointer to pixels data of original input image.
-        \param [in] srcStride - a row size of src image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [in] channelCount - a channel count.
-        \param [out] dst - a pointer to pixels data of filtered output image.
-        \param [in] dstStride - a row size of dst image.
+        \param [in] M - a number of A arrays.
+        \param [in] N - a number of B arrays.
+        \param [in] K - a size of A and B arrays.
+        \param [in] A - a pointer to the first array with pointers to 16-bit float arrays.
+        \param [in] B - a pointer to the second array with pointers to 16-bit float arrays.
+        \param [out] distances - a pointer to result 32-bit float array with cosine distances. It size must be M*N.
     */
-    SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-        size_t channelCount, uint8_t * dst, size_t dstStride);
-
-    /*! @ingroup neural
+    SIMD_API void SimdCosineDistancesMxNa16f(size_t M, size_t N, size_t K, const uint16_t * const * A, const uint16_t * const * B, float * distances);
 
-        \fn void SimdNeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion);
+    /*! @ingroup other_conversion
 
-        \short Converts a 8-bit gray image to the 32-bit float array.
+        \fn void SimdFloat32ToUint8(const float * src, size_t size, const float * lower, const float * upper, uint8_t * dst);
 
-        The length of output array must be equal to the area of input image.
+        \short Converts numbers in the array from 32-bit float to 8-bit unsigned integer format.
 
-        For every point:
+        For every element:
         \verbatim
-        dst[i] = inversion ? (255 - src[col]) / 255 : src[i]/255;
+        dst[i] = (min(max(src[i], lower), upper) - lower)*255/(upper - lower);
         \endverbatim
 
-        \note This function has a C++ wrapper Simd::NeuralConvert(const View<A>& src, float * dst, bool inversion).
-
-        \param [in] src - a pointer to pixels data of input image.
-        \param [in] srcStride - a row size (in bytes) of the image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [out] dst - a pointer to output array.
-        \param [in] dstStride - a row size of the output array.
-        \param [in] inversion - a flag of color inversion.
+        \param [in] src - a pointer to the input array with 32-bit float point numbers.
+        \param [in] size - a size of input and output array.
+        \param [in] lower - a pointer to lower saturated bound of the input array.
+        \param [in] upper - a pointer to upper saturated bound of the input array.
+        \param [out] dst - a pointer to the output array with 8-bit unsigned integer numbers.
     */
-    SIMD_API void SimdNeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion);
-
-    /*! @ingroup neural
+    SIMD_API void SimdFloat32ToUint8(const float * src, size_t size, const float * lower, const float * upper, uint8_t * dst);
 
-        \fn void SimdNeuralSigmoid(const float * src, size_t size, const float * slope, float * dst);
+    /*! @ingroup other_conversion
 
-        \short Calculates sigmoid for 32-bit float array.
+        \fn void SimdUint8ToFloat32(const uint8_t* src, size_t size, const float * lower, const float * upper, float * dst);
 
-        All arrays must have the same size.
+        \short Converts numbers in the array from 8-bit unsigned integer to 32-bit float format.
 
         For every element:
         \verbatim
-        dst[i] = 1/(1 + exp(-slope*src[i]));
+        dst[i] = src[i]*(upper - lower)/255 + lower;
         \endverbatim
 
-        \param [in] src - a pointer to the input array.
-        \param [in] size - a size of arrays.
-        \param [in] slope - a pointer to the slope parameter.
-        \param [out] dst - a pointer to output array.
+        \param [in] src - a pointer to the input array with 8-bit unsigned integer numbers.
+        \param [in] size - a size of input and output array.
+        \param [in] lower - a pointer to lower bound of the output array.
+        \param [in] upper - a pointer to upper bound of the output array.
+        \param [out] dst - a pointer to the output array with 32-bit float point numbers.
     */
-    SIMD_API void SimdNeuralSigmoid(const float * src, size_t size, const float * slope, float * dst);
+    SIMD_API void SimdUint8ToFloat32(const uint8_t * src, size_t size, const float * lower, const float * upper, float * dst);
 
-    /*! @ingroup neural
+    /*! @ingroup correlation
 
-        \fn void SimdNeuralRoughSigmoid(const float * src, size_t size, const float * slope, float * dst);
+        \fn void SimdCosineDistance32f(const float * a, const float * b, size_t size, float * distance);
 
-        \short Calculates rough sigmoid for 32-bit float array.
+        \short Calculates cosine distance of two 32-bit float arrays.
 
         All arrays must have the same size.
 
-        For every element:
-        \verbatim
-        x = ::abs(src[i]*slope);
-        e = 1 + x + x*x*0.5417 + x*x*x*x*0.1460;
-        dst[i] = 1 / (1 + (src[i] > 0 ? 1 / e : e));
-        \endverbatim
-        It is approximate way (maximal absolute error is 0.002294 (~0.23%) ) of sigmoid function (::SimdNeuralSigmoid) calculation:
+        Algorithm description:
         \verbatim
-        dst[i] = 1/(1 + exp(-slope*src[i]));
+        distance = 1 - Sum(a[i]*b[i])/Sqrt(Sum(a[i]*a[i])*Sum(b[i]*b[i]));
         \endverbatim
 
-        \note This function is used in Simd::Neural::Function.
-
-        \param [in] src - a pointer to the input array.
+        \param [in] a - a pointer to the first 32-bit float array.
+        \param [in] b - a pointer to the second 32-bit float array.
         \param [in] size - a size of arrays.
-        \param [in] slope - a pointer to the slope parameter.
-        \param [out] dst - a pointer to output array.
+        \param [out] distance - a pointer to 32-bit float with cosine distance.
     */
-    SIMD_API void SimdNeuralRoughSigmoid(const float * src, size_t size, const float * slope, float * dst);
-
-    /*! @ingroup neural
+    SIMD_API void SimdCosineDistance32f(const float * a, const float * b, size_t size, float * distance);
 
-        \fn void SimdNeuralRoughSigmoid2(const float * src, size_t size, const float * slope, float * dst);
+    /*! @ingroup other_filter
 
-        \short Calculates rough sigmoid for 32-bit float array.
+        \fn void SimdGaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
 
-        All arrays must have the same size.
+        \short Performs Gaussian blur filtration with window 3x3.
 
-        For every element:
-        \verbatim
-        x = -src[i]*slope;
-        e = max(1 + x/128, 0.5)^128;
-        dst[i] = 1 / (1 + e);
-        \endverbatim
-        It is approximate way (maximal absolute error is 0.001721 (~0.17%) ) of sigmoid function (::SimdNeuralSigmoid) calculation:
+        For every point:
         \verbatim
-        dst[i] = 1/(1 + exp(-slope*src[i]));
+        dst[x, y] = (src[x-1, y-1] + 2*src[x, y-1] + src[x+1, y-1] +
+                    2*(src[x-1, y] + 2*src[x, y] + src[x+1, y]) +
+                    src[x-1, y+1] + 2*src[x, y+1] + src[x+1, y+1] + 8) / 16;
         \endverbatim
 
-        \note This function is used in Simd::Neural::Function.
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
 
-        \param [in] src - a pointer to the input array.
-        \param [in] size - a size of arrays.
-        \param [in] slope - a pointer to the slope parameter.
-        \param [out] dst - a pointer to output array.
-    */
-    SIMD_API void SimdNeuralRoughSigmoid2(const float * src, size_t size, const float * slope, float * dst);
+        \note This function has a C++ wrapper Simd::GaussianBlur3x3(const View<A>& src, View<A>& dst).
 
-    /*! @ingroup neural
+        \param [in] src - a pointer to pixels data of source image.
+        \param [in] srcStride - a row size of the src image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] channelCount - a channel count.
+        \param [out] dst - a pointer to pixels data of destination image.
+        \param [in] dstStride - a row size of the dst image.
+    */
+    SIMD_API void SimdGaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        size_t channelCount, uint8_t * dst, size_t dstStride);
 
-        \fn void SimdNeuralDerivativeSigmoid(const float * src, size_t size, const float * slope, float * dst);
+    /*! @ingroup matrix
 
-        \short Multiplies output 32-bit float array by derivative of sigmoid from input 32-bit float array.
+        \fn void SimdGemm32fNN(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
 
-        All arrays must have the same size.
+        \short Performs general matrix multiplication (for 32-bit float numbers).
 
-        For every element:
         \verbatim
-        dst[i] *= slope*(1 - src[i])*src[i];
+        C(M, N) = alpha*A(M, K)*B(K, N) + beta*C(M, N);
         \endverbatim
 
-        \note This function is used in Simd::Neural::Function.
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
 
-        \param [in] src - a pointer to the input array.
-        \param [in] size - a size of arrays.
-        \param [in] slope - a pointer to the slope parameter.
-        \param [in, out] dst - a pointer to output array.
+        \param [in] M - a height of A and height of C matrices.
+        \param [in] N - a width of B and width of C matrices.
+        \param [in] K - a width of A and height of B matrices.
+        \param [in] alpha - a pointer to multiplier of the first term.
+        \param [in] A - a pointer to input A matrix.
+        \param [in] lda - a leading dimension of A matrix.
+        \param [in] B - a pointer to input B matrix.
+        \param [in] ldb - a leading dimension of B matrix.
+        \param [in] beta - a pointer to multiplier of the second term.
+        \param [out] C - a pointer to output C matrix.
+        \param [in] ldc - a leading dimension of C matrix.
     */
-    SIMD_API void SimdNeuralDerivativeSigmoid(const float * src, size_t size, const float * slope, float * dst);
-
-    /*! @ingroup neural
+    SIMD_API void SimdGemm32fNN(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
 
-        \fn void SimdNeuralTanh(const float * src, size_t size, const float * slope, float * dst);
+    /*! @ingroup matrix
 
-        \short Calculates hyperbolic tangent for 32-bit float array.
+        \fn void SimdGemm32fNT(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
 
-        All arrays must have the same size.
+        \short Performs general matrix multiplication (for 32-bit float numbers).
 
-        For every element:
         \verbatim
-        x = slope*src[i];
-        dst[i] = (exp(x) - exp(-x))/(exp(x) + exp(-x));
+        C(M, N) = alpha*A(M, K)*Trans(B(N, K)) + beta*C(M, N);
         \endverbatim
 
-        \param [in] src - a pointer to the input array.
-        \param [in] size - a size of arrays.
-        \param [in] slope - a pointer to the slope parameter.
-        \param [out] dst - a pointer to output array.
-    */
-    SIMD_API void SimdNeuralTanh(const float * src, size_t size, const float * slope, float * dst);
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
 
-    /*! @ingroup neural
+        \param [in] M - a height of A and height of C matrices.
+        \param [in] N - a height of B and width of C matrices.
+        \param [in] K - a width of A and width of B matrices.
+        \param [in] alpha - a pointer to multiplier of the first term.
+        \param [in] A - a pointer to input A matrix.
+        \param [in] lda - a leading dimension of A matrix.
+        \param [in] B - a pointer to input B matrix.
+        \param [in] ldb - a leading dimension of B matrix.
+        \param [in] beta - a pointer to multiplier of the second term.
+        \param [out] C - a pointer to output C matrix.
+        \param [in] ldc - a leading dimension of C matrix.
+    */
+    SIMD_API void SimdGemm32fNT(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
 
-        \fn void SimdNeuralRoughTanh(const float * src, size_t size, const float * slope, float * dst);
+    /*! @ingroup gray_conversion
 
-        \short Calculates rough hyperbolic tangent for 32-bit float array.
+        \fn void SimdGrayToBgr(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgr, size_t bgrStride);
 
-        All arrays must have the same size.
+        \short Converts 8-bit gray image to 24-bit BGR image.
 
-        For every element:
-        \verbatim
-        x = ::abs(src[i]*slope);
-        e = 1 + x + x*x*0.5658 + x*x*x*x*0.1430;
-        dst[i] = (src[i] > 0 ? 1 : -1)*(e - 1/e)/(e + 1/e);
-        \endverbatim
-        It is approximate way (maximal absolute error is 0.001514 (~0.15%) ) of hyperbolic tangent (::SimdNeuralTanh)  function calculation:
-        \verbatim
-        x = slope*src[i];
-        dst[i] = (exp(x) - exp(-x))/(exp(x) + exp(-x));
-        \endverbatim
+        All images must have the same width and height.
 
-        \note This function is used in Simd::Neural::Function.
+        \note This function has a C++ wrapper Simd::GrayToBgr(const View<A>& gray, View<A>& bgr).
 
-        \param [in] src - a pointer to the input array.
-        \param [in] size - a size of arrays.
-        \param [in] slope - a pointer to the slope parameter.
-        \param [out] dst - a pointer to output array.
+        \param [in] gray - a pointer to pixels data of input 8-bit gray image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] grayStride - a row size of the gray image.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
     */
-    SIMD_API void SimdNeuralRoughTanh(const float * src, size_t size, const float * slope, float * dst);
-
-    /*! @ingroup neural
+    SIMD_API void SimdGrayToBgr(const uint8_t *gray, size_t width, size_t height, size_t grayStride, uint8_t *bgr, size_t bgrStride);
 
-    \fn void SimdNeuralDerivativeTanh(const float * src, size_t size, const float * slope, float * dst);
+    /*! @ingroup gray_conversion
 
-        \short Multiplies output 32-bit float array by derivative of hyperbolic tangent from input 32-bit float array.
+        \fn void SimdGrayToBgra(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
-        All arrays must have the same size.
+        \short Converts 8-bit gray image to 32-bit BGRA image.
 
-        For every element:
-        \verbatim
-        dst[i] *= slope*(1 - src[i]*src[i]);
-        \endverbatim
+        All images must have the same width and height.
 
-        \note This function is used in Simd::Neural::Function.
+        \note This function has a C++ wrapper Simd::GrayToBgra(const View<A>& gray, View<A>& bgra, uint8_t alpha).
 
-        \param [in] src - a pointer to the input array.
-        \param [in] size - a size of arrays.
-        \param [in] slope - a pointer to the slope parameter.
-        \param [in, out] dst - a pointer to output array.
+        \param [in] gray - a pointer to pixels data of input 8-bit gray image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] grayStride - a row size of the gray image.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
     */
-    SIMD_API void SimdNeuralDerivativeTanh(const float * src, size_t size, const float * slope, float * dst);
-
-    /*! @ingroup neural
+    SIMD_API void SimdGrayToBgra(const uint8_t *gray, size_t width, size_t height, size_t grayStride,
+        uint8_t *bgra, size_t bgraStride, uint8_t alpha);
 
-        \fn void SimdNeuralRelu(const float * src, size_t size, const float * slope, float * dst);
+    /*! @ingroup histogram
 
-        \short Calculates Relu (rectified linear unit) function for 32-bit float array.
+        \fn void SimdAbsSecondDerivativeHistogram(const uint8_t * src, size_t width, size_t height, size_t stride, size_t step, size_t indent, uint32_t * histogram);
 
-        All arrays must have the same size.
+        \short Calculates histogram of second derivative for 8-bit gray image.
 
-        For every element:
+        For all points except the boundary (defined by parameter indent):
         \verbatim
-        dst[i] =  src[i] > 0 ? src[i] : slope*src[i];
+        dx = abs(src[x, y] - average(src[x+step, y], src[x-step, y]));
+        dy = abs(src[x, y] - average(src[x, y+step], src[x, y-step]));
+        histogram[max(dx, dy)]++;
         \endverbatim
 
-        \note This function is used in Simd::Neural::Function.
+        \note This function has a C++ wrapper Simd::AbsSecondDerivativeHistogram(const View<A>& src, size_t step, size_t indent, uint32_t * histogram).
 
-        \param [in] src - a pointer to the input array.
-        \param [in] size - a size of arrays.
-        \param [in] slope - a pointer to the slope parameter.
-        \param [out] dst - a pointer to output array.
+        \param [in] src - a pointer to pixels data of input 8-bit gray image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] stride - a row size of the image.
+        \param [in] step - a step for second derivative calculation.
+        \param [in] indent - a indent from image boundary.
+        \param [out] histogram - a pointer to histogram (array of 256 unsigned 32-bit values).
     */
-    SIMD_API void SimdNeuralRelu(const float * src, size_t size, const float * slope, float * dst);
-
-    /*! @ingroup neural
+    SIMD_API void SimdAbsSecondDerivativeHistogram(const uint8_t * src, size_t width, size_t height, size_t stride,
+        size_t step, size_t indent, uint32_t * histogram);
 
-        \fn void SimdNeuralDerivativeRelu(const float * src, size_t size, const float * slope, float * dst);
+    /*! @ingroup histogram
 
-        \short Multiplies output 32-bit float array by derivative of Relu (rectified linear unit) from input 32-bit float array.
+        \fn void SimdHistogram(const uint8_t * src, size_t width, size_t height, size_t stride, uint32_t * histogram);
 
-        All arrays must have the same size.
+        \short Calculates histogram for 8-bit gray image.
 
-        For every element:
+        For all points:
         \verbatim
-        dst[i] *=  src[i] > 0 ? 1 : slope;
+        histogram[src[i]]++.
         \endverbatim
 
-        \note This function is used in Simd::Neural::Function.
+        \note This function has a C++ wrapper Simd::Histogram(const View<A>& src, uint32_t * histogram).
 
-        \param [in] src - a pointer to the input array.
-        \param [in] size - a size of arrays.
-        \param [in] slope - a pointer to the slope parameter.
-        \param [in, out] dst - a pointer to output array.
+        \param [in] src - a pointer to pixels data of input 8-bit gray image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] stride - a row size of the image.
+        \param [out] histogram - a pointer to histogram (array of 256 unsigned 32-bit values).
     */
-    SIMD_API void SimdNeuralDerivativeRelu(const float * src, size_t size, const float * slope, float * dst);
-
-    /*! @ingroup neural
+    SIMD_API void SimdHistogram(const uint8_t * src, size_t width, size_t height, size_t stride, uint32_t * histogram);
 
-        \fn void SimdNeuralPow(const float * src, size_t size, const float * exponent, float * dst);
+    /*! @ingroup histogram
 
-        \short Calculates Pow function for 32-bit float array.
+        \fn void SimdHistogramMasked(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * mask, size_t maskStride, uint8_t index, uint32_t * histogram);
 
-        All arrays must have the same size.
+        \short Calculates histogram for 8-bit gray image with using mask.
 
-        For every element:
+        For every point:
         \verbatim
-        dst[i] =  Pow(src[i], exponent[0]);
+        if(mask[i] == index)
+            histogram[src[i]]++.
         \endverbatim
 
-        \note This function is used in Simd::Neural::Function.
+        \note This function has a C++ wrapper Simd::HistogramMasked(const View<A> & src, const View<A> & mask, uint8_t index, uint32_t * histogram).
 
-        \param [in] src - a pointer to the input array.
-        \param [in] size - a size of arrays.
-        \param [in] exponent - a pointer to exponent parameter.
-        \param [out] dst - a pointer to output array.
+        \param [in] src - a pointer to pixels data of input 8-bit gray image.
+        \param [in] srcStride - a row size of the image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] mask - a pointer to pixels data of the mask 8-bit image.
+        \param [in] maskStride - a row size of the mask image.
+        \param [in] index - a mask index.
+        \param [out] histogram - a pointer to histogram (array of 256 unsigned 32-bit values).
     */
-    SIMD_API void SimdNeuralPow(const float * src, size_t size, const float * exponent, float * dst);
-
-    /*! @ingroup neural
+    SIMD_API void SimdHistogramMasked(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        const uint8_t * mask, size_t maskStride, uint8_t index, uint32_t * histogram);
 
-        \fn void SimdNeuralProductSum(const float * a, const float * b, size_t size, float * sum);
+    /*! @ingroup histogram
 
-        \short Calculates sum of products for two 32-bit float arrays.
+        \fn void SimdHistogramConditional(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint32_t * histogram);
 
-        All arrays must have the same size.
+        \short Calculates histogram of 8-bit gray image for those points when mask points satisfying certain condition.
 
-        For every element:
+        For every point:
         \verbatim
-        sum += a[i]*b[i];
+        if(compare(mask[x, y], value))
+            histogram[src[x, y]]++.
         \endverbatim
 
-        \note This function is used in Simd::Neural.
+        \note This function has a C++ wrapper Simd::HistogramConditional(const View<A>& src, const View<A>& mask, uint8_t value, SimdCompareType compareType, uint32_t * histogram).
 
-        \param [in] a - a pointer to the first 32-bit float array.
-        \param [in] b - a pointer to the second 32-bit float array.
-        \param [in] size - a size of arrays.
-        \param [out] sum - a pointer to 32-bit float sum of products.
+        \param [in] src - a pointer to pixels data of input 8-bit gray image.
+        \param [in] srcStride - a row size of the image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] mask - a pointer to pixels data of the mask 8-bit image.
+        \param [in] maskStride - a row size of the mask image.
+        \param [in] value - a second value for compare operation.
+        \param [in] compareType - a compare operation type (see ::SimdCompareType).
+        \param [out] histogram - a pointer to histogram (array of 256 unsigned 32-bit values).
     */
-    SIMD_API void SimdNeuralProductSum(const float * a, const float * b, size_t size, float * sum);
-
-    /*! @ingroup neural
-
-        \fn void SimdNeuralAddVectorMultipliedByValue(const float * src, size_t size, const float * value, float * dst);
-
-        \short Adds the product of a vector and a scalar to given vector.
+    SIMD_API void SimdHistogramConditional(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint32_t * histogram);
 
-        All arrays must have the same size.
+    /*! @ingroup histogram
 
-        For every element:
-        \verbatim
-        dst[i] += src[i]*value[0];
-        \endverbatim
+        \fn void SimdNormalizedColors(const uint32_t * histogram, uint8_t * colors);
 
-        \note This function is used in Simd::Neural.
+        \short Gets normalized color map for given histogram.
 
-        \param [in] src - a pointer to the input 32-bit float array.
-        \param [in] size - a size of arrays.
-        \param [in] value - a pointer to the scalar 32-bit float value.
-        \param [in, out] dst - a pointer to cumulative 32-bit float array.
+        \param [in] histogram - a pointer to histogram (array of 256 unsigned 32-bit values).
+        \param [out] colors - a pointer to the color map (array of 256 unsigned 8-bit values).
     */
-    SIMD_API void SimdNeuralAddVectorMultipliedByValue(const float * src, size_t size, const float * value, float * dst);
-
-    /*! @ingroup neural
+    SIMD_API void SimdNormalizedColors(const uint32_t * histogram, uint8_t * colors);
 
-        \fn void SimdNeuralAddVector(const float * src, size_t size, float * dst);
+    /*! @ingroup histogram
 
-        \short Adds a vector to given vector.
+        \fn void SimdChangeColors(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * colors, uint8_t * dst, size_t dstStride);
 
-        All arrays must have the same size.
+        \short Changes colors for 8-bit gray image with using of color map.
 
-        For every element:
-        \verbatim
-        dst[i] += src[i];
-        \endverbatim
+        The input and output 8-bit gray images must have the same size. 
 
-        \note This function is used in Simd::Neural.
+        \note This function has a C++ wrapper Simd::ChangeColors(const View<A> & src, const uint8_t * colors, View<A> & dst).
 
-        \param [in] src - a pointer to the input 32-bit float array.
-        \param [in] size - a size of the arrays.
-        \param [in, out] dst - a pointer to cumulative 32-bit float array.
+        \param [in] src - a pointer to pixels data of input 8-bit gray image.
+        \param [in] srcStride - a row size of the image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] colors - a pointer to the color map (array of 256 unsigned 8-bit values).
+        \param [out] dst - a pointer to pixels data of output 8-bit gray image.
+        \param [in] dstStride - a row size of the output gray image.
     */
-    SIMD_API void SimdNeuralAddVector(const float * src, size_t size, float * dst);
+    SIMD_API void SimdChangeColors(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * colors, uint8_t * dst, size_t dstStride);
 
-    /*! @ingroup neural
+    /*! @ingroup histogram
 
-        \fn void SimdNeuralAddValue(const float * value, float * dst, size_t size);
+        \fn void SimdNormalizeHistogram(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
 
-        \short Adds a value to each elements of given vector.
+        \short Normalizes histogram for 8-bit gray image.
 
-        For every element:
-        \verbatim
-        dst[i] += value;
-        \endverbatim
+        The input and output 8-bit gray images must have the same size.
 
-        \note This function is used in Simd::Neural.
+        \note This function has a C++ wrapper Simd::NormalizeHistogram(const View<A> & src, View<A> & dst).
 
-        \param [in] value - a pointer to the scalar 32-bit float value.
-        \param [in, out] dst - a pointer to cumulative 32-bit float array.
-        \param [in] size - a size of the array.
+        \param [in] src - a pointer to pixels data of input 8-bit gray image.
+        \param [in] srcStride - a row size of the image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] dst - a pointer to pixels data of output 8-bit image with normalized histogram.
+        \param [in] dstStride - a row size of the output image.
     */
-    SIMD_API void SimdNeuralAddValue(const float * value, float * dst, size_t size);
+    SIMD_API void SimdNormalizeHistogram(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
 
-    /*! @ingroup neural
+    /*! @ingroup hog
 
-        \fn void SimdNeuralUpdateWeights(const float * x, size_t size, const float * a, const float * b, float * d, float * w);
+        \fn void SimdHogDirectionHistograms(const uint8_t * src, size_t stride, size_t width, size_t height, size_t cellX, size_t cellY, size_t quantization, float * histograms);
 
-        \short Updates ANN weights.
+        \short Calculates HOG direction histograms for 8-bit gray image.
 
-        All arrays must have the same size.
+        Calculates HOG direction histogram for every cell of 8-bit gray image. This function is useful for face recognition.
 
-        The algorithm performs:
-        \verbatim
-        for (size_t k = 0; k < size; ++k)
-        {
-            d[k] = a[0]*d[k] + b[0]*x[k];
-            w[k] += d[k];
-        }
-        \endverbatim
+        \note This function has a C++ wrapper Simd::HogDirectionHistograms(const View<A> & src, const Point<ptrdiff_t> & cell, size_t quantization, float * histograms).
 
-        \param [in] x - a pointer to the X array.
-        \param [in] size - a size of arrays.
-        \param [in] a - a pointer to the first parameter.
-        \param [in] b - a pointer to the second parameter.
-        \param [in, out] d - a pointer to the D array.
-        \param [in, out] w - a pointer to the W array.
+        \param [in] src - a pointer to pixels data of input 8-bit gray image.
+        \param [in] stride - a row size of the image.
+        \param [in] width - an image width. It must be a multiple of cellX.
+        \param [in] height - an image height. It must be a multiple of cellY.
+        \param [in] cellX - a width of cell.
+        \param [in] cellY - a height of cell.
+        \param [in] quantization - a direction quantization. Must be even.
+        \param [out] histograms - a pointer to buffer with histograms. Array must has size grater or equal to (width/cellX)*(height/cellY)*quantization.
     */
-    SIMD_API void SimdNeuralUpdateWeights(const float * x, size_t size, const float * a, const float * b, float * d, float * w);
-
-    /*! @ingroup neural
+    SIMD_API void SimdHogDirectionHistograms(const uint8_t * src, size_t stride, size_t width, size_t height,
+        size_t cellX, size_t cellY, size_t quantization, float * histograms);
 
-        \fn void SimdNeuralAdaptiveGradientUpdate(const float * delta, size_t size, size_t batch, const float * alpha, const float * epsilon, float * gradient, float * weight);
+    /*! @ingroup hog
 
-        \short Updates neural network weights with using of adaptive gradients method.
+        \fn void SimdHogExtractFeatures(const uint8_t * src, size_t stride, size_t width, size_t height, float * features);
 
-        Adaptive gradients method.
-        J Duchi, E Hazan and Y Singer,
-        "Adaptive subgradient methods for online learning and stochastic optimization"
-        The Journal of Machine Learning Research, pages 2121-2159, 2011.
+        \short Extracts HOG features for 8-bit gray image.
 
-        The algorithm performs:
-        \verbatim
-        for (i = 0; i < size; ++i)
-        {
-            d = delta[i]/batch;
-            gradient[i] += d*d;
-            weight[i] -= alpha * d / sqrt(gradient[i] + epsilon);
-        }
-        \endverbatim
+        Extracts HOG features 8-bit gray image. 31 features are extracted for 8x8 cell size and 2x2 block size. This function is useful for face recognition.
 
-        \note All arrays must have the same size. This function is used in Simd::Neural.
+        \note This function has a C++ wrapper Simd::HogExtractFeatures(const View<A> & src, float * features).
 
-        \param [in] delta - a pointer to the array with error (delta).
-        \param [in] size - a size of arrays.
-        \param [in] batch - a batch size.
-        \param [in] alpha - a pointer to alpha parameter (update speed).
-        \param [in] epsilon - a pointer to epsilon parameter (a small number used to avoid division by zero).
-        \param [in, out] gradient - a pointer to the array with gradients.
-        \param [in, out] weight - a pointer to the array with weights.
+        \param [in] src - a pointer to pixels data of input 8-bit gray image.
+        \param [in] stride - a row size of the image.
+        \param [in] width - an image width. It must be a multiple of 8. Its minimal value is 16.
+        \param [in] height - an image height. It must be a multiple of 8. Its minimal value is 16.
+        \param [out] features - a pointer to buffer with features. Array must has size grater or equal to (width/8)*(height/8)*31.
     */
-    SIMD_API void SimdNeuralAdaptiveGradientUpdate(const float * delta, size_t size, size_t batch, const float * alpha, const float * epsilon, float * gradient, float * weight);
-
-    /*! @ingroup neural
+    SIMD_API void SimdHogExtractFeatures(const uint8_t * src, size_t stride, size_t width, size_t height, float * features);
 
-        \fn void SimdNeuralAddConvolution2x2Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+    /*! @ingroup hog
 
-        \short Adds 2x2 convolution of 32-bit float image.
+        \fn void SimdHogDeinterleave(const float * src, size_t srcStride, size_t width, size_t height, size_t count, float ** dst, size_t dstStride);
 
-        \note This function is used in Simd::Neural.
+        \short Separates one interleaved 32-bit float point image to separate planes.
 
-        \param [in] src - a pointer to the input 32-bit float image.
-        \param [in] srcStride - a row size of the input image (in 32-float values).
-        \param [in] width - a width of the output image (input image width must be equal to output image width + 1).
-        \param [in] height - a height of the output image (input image height must be equal to output image height + 1).
-        \param [in] weights - a pointer to the array with weights (its size must be at least 4).
-        \param [in, out] dst - a pointer to the output 32-bit float image.
-        \param [in] dstStride - a row size of the output image (in 32-float values).
+        \param [in] src - a pointer to the input interleaved 32-bit float point image.
+        \param [in] srcStride - a row size of input image.
+        \param [in] width - a width of input and output images.
+        \param [in] height - a height of input and output images.
+        \param [in] count - the number of output planes.
+        \param [out] dst - a pointer to array with pointers to output planes.
+        \param [in] dstStride - a row size of output images.
     */
-    SIMD_API void SimdNeuralAddConvolution2x2Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+    SIMD_API void SimdHogDeinterleave(const float * src, size_t srcStride, size_t width, size_t height, size_t count, float ** dst, size_t dstStride);
 
-    /*! @ingroup neural
+    /*! @ingroup hog
 
-        \fn void SimdNeuralAddConvolution3x3Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+        \fn void SimdHogFilterSeparable(const float * src, size_t srcStride, size_t width, size_t height, const float * rowFilter, size_t rowSize, const float * colFilter, size_t colSize, float * dst, size_t dstStride, int add);
 
-        \short Adds 3x3 convolution of 32-bit float image.
+        \short Applies separable filter to given image of 32-bit float point format.
 
-        \note This function is used in Simd::Neural.
+        For every point (except border):
+        \verbatim
+        sum = 0;
+        for(dy = 0; dy < colSize; dy++)
+            for(dx = 0; dx < rowSize; dx++)
+                sum += src[x + dx, y + dy]*colFilter[dy]*rowFilter[dx];
+        if(add)
+            dst[x, y] += sum;
+        else
+            dst[x, y] = sum;
+        \endverbatim
 
-        \param [in] src - a pointer to the input 32-bit float image.
-        \param [in] srcStride - a row size of the input image (in 32-float values).
-        \param [in] width - a width of the output image (input image width must be equal to output image width + 2).
-        \param [in] height - a height of the output image (input image height must be equal to output image height + 2).
-        \param [in] weights - a pointer to the array with weights (its size must be at least 9).
-        \param [in, out] dst - a pointer to the output 32-bit float image.
-        \param [in] dstStride - a row size of the output image (in 32-float values).
+        \note Input image has to have size at least not less then size of filter: (width <= rowSize and height <= colSize).
+
+        \param [in] src - a pointer to input 32-bit float point image.
+        \param [in] srcStride - a row size of input image.
+        \param [in] width - a width of input image. It must be not less then size of row filter.
+        \param [in] height - a height of input image. It must be not less then size of column filter.
+        \param [in] rowFilter - a pointer to 32-bit float point array with row filter.
+        \param [in] rowSize- a size of row filter.
+        \param [in] colFilter - a pointer to 32-bit float point array with column filter.
+        \param [in] colSize- a size of column filter.
+        \param [in, out] dst - a pointer to output 32-bit float point image.
+        \param [in] dstStride - a row size of output image.
+        \param [in] add - a flag which signalizes that result has to be added to existing image.
     */
-    SIMD_API void SimdNeuralAddConvolution3x3Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+    SIMD_API void SimdHogFilterSeparable(const float * src, size_t srcStride, size_t width, size_t height, const float * rowFilter, size_t rowSize, const float * colFilter, size_t colSize, float * dst, size_t dstStride, int add);
 
-    /*! @ingroup neural
+    /*! @ingroup hog
 
-        \fn void SimdNeuralAddConvolution4x4Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+        \fn void SimdHogLiteExtractFeatures(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t cell, float * features, size_t featuresStride);
 
-        \short Adds 4x4 convolution of 32-bit float image.
+        \short Extracts lite HOG features for 8-bit gray image.
 
-        \note This function is used in Simd::Neural.
+        Extracts lite (for 8 directions) HOG features 8-bit gray image. 16 features are extracted for 8x8 or 4x4 cell size and 2x2 block size. 
 
-        \param [in] src - a pointer to the input 32-bit float image.
-        \param [in] srcStride - a row size of the input image (in 32-float values).
-        \param [in] width - a width of the output image (input image width must be equal to output image width + 3).
-        \param [in] height - a height of the output image (input image height must be equal to output image height + 3).
-        \param [in] weights - a pointer to the array with weights (its size must be at least 16).
-        \param [in, out] dst - a pointer to the output 32-bit float image.
-        \param [in] dstStride - a row size of the output image (in 32-float values).
+        \note This function has a C++ wrapper Simd::HogLiteExtractFeatures(const View<A> & src, size_t cell, float * features, size_t featuresStride).
+
+        \param [in] src - a pointer to pixels data of input 8-bit gray image.
+        \param [in] srcStride - a row size of the image.
+        \param [in] width - an image width. Its minimal value is cell*3.
+        \param [in] height - an image height. Its minimal value is cell*3.
+        \param [in] cell - a size of cell. It must be 4 or 8. 
+        \param [out] features - a pointer to buffer with features. Array must has size greater or equal to (height/cell - 2)*featuresStride.
+        \param [in] featuresStride - a row size of the buffer with features. It must be greater or equal to (width/cell - 2)*16.
     */
-    SIMD_API void SimdNeuralAddConvolution4x4Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+    SIMD_API void SimdHogLiteExtractFeatures(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t cell, float * features, size_t featuresStride);
 
+    /*! @ingroup hog
 
-    /*! @ingroup neural
+        \fn void SimdHogLiteFilterFeatures(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t featureSize, const float * filter, size_t filterWidth, size_t filterHeight, const uint32_t * mask, size_t maskStride, float * dst, size_t dstStride);
 
-        \fn void SimdNeuralAddConvolution5x5Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+        \short Applies filter to lite HOG features.
 
-        \short Adds 5x5 convolution of 32-bit float image (forward propagation).
+        Applies filter of square shape to lite HOG features. 
 
-        \note This function is used in Simd::Neural.
+        For every point of output image:
+        \verbatim
+        if(mask[x, y])
+            sum = 0;
+            for(dy = 0; dy < filterHeight; dy++)
+                for(dx = 0; dx < filterWidth*featureSize; dx++)
+                    sum += src[x*featureSize + dx, y + dy]*filter[dx, dy];
+            dst[x, y] = sum;
+        else
+            dst[x, y] = -FLT_MAX;
+        \endverbatim
 
-        \param [in] src - a pointer to the input 32-bit float image.
-        \param [in] srcStride - a row size of the input image (in 32-float values).
-        \param [in] width - a width of the output image (input image width must be equal to output image width + 4).
-        \param [in] height - a height of the output image (input image height must be equal to output image height + 4).
-        \param [in] weights - a pointer to the array with weights (its size must be at least 25).
-        \param [in, out] dst - a pointer to the output 32-bit float image.
-        \param [in] dstStride - a row size of the output image (in 32-float values).
+        \param [in] src - a pointer to the input 32-bit float array with features.
+        \param [in] srcStride - a row size of input array with features.
+        \param [in] srcWidth - a width of input array with features. Its minimal value is filterSize.
+        \param [in] srcHeight - a height of input array with features. Its minimal value is filterSize.
+        \param [in] featureSize - a size of cell with features. It must be 8 or 16.
+        \param [in] filter - a pointer to the 32-bit float array with filter values. 
+                    Array must have size equal to filterSize*filterSize*featureSize.
+        \param [in] filterWidth - a width of used filter. 
+        \param [in] filterHeight - a height of used filter.
+        \param [in] mask - a pointer to the 32-bit integer array with mask (0 or -1).
+                    Pointer can be null otherwise the array must have size greater then (srcHeight - filterSize)*(srcWidth - filterSize).
+                    A function ::SimdHogLiteCreateMask is usefull in order to create this mask.
+        \param [in] maskStride - a row size of mask array. 
+        \param [out] dst - a pointer to output buffer with result of filtration. Array must have size greater then (srcHeight - filterSize)*(srcWidth - filterSize).
+        \param [in] dstStride - a row size of the output buffer with result of filtration.
     */
-    SIMD_API void SimdNeuralAddConvolution5x5Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+    SIMD_API void SimdHogLiteFilterFeatures(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t featureSize, const float * filter, size_t filterWidth, size_t filterHeight, const uint32_t * mask, size_t maskStride, float * dst, size_t dstStride);
 
-    /*! @ingroup neural
+    /*! @ingroup hog
 
-        \fn void SimdNeuralAddConvolution2x2Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+        \fn void SimdHogLiteResizeFeatures(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t featureSize, float * dst, size_t dstStride, size_t dstWidth, size_t dstHeight);
 
-        \short Adds 2x2 convolution of 32-bit float image (backward propagation).
+        \short Resizes 2D-array with lite HOG features.
 
-        \note This function is used in Simd::Neural.
+        Resizes 2D-array with lite HOG features. It use method of bilinear interpolation.
 
-        \param [in] src - a pointer to the input 32-bit float image.
-        \param [in] srcStride - a row size of the input image (in 32-float values).
-        \param [in] width - a width of the input image (output image width must be equal to input image width + 1).
-        \param [in] height - a height of the input image (output image height must be equal to input image height + 1).
-        \param [in] weights - a pointer to the array with weights (its size must be at least 4).
-        \param [in, out] dst - a pointer to the output 32-bit float image.
-        \param [in] dstStride - a row size of the output image (in 32-float values).
-    */
-    SIMD_API void SimdNeuralAddConvolution2x2Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+        \param [in] src - a pointer to the input 32-bit float array with features.
+        \param [in] srcStride - a row size of input array with features.
+        \param [in] srcWidth - a width of input array with features. 
+        \param [in] srcHeight - a height of input array with features. 
+        \param [in] featureSize - a size of cell with features. It must be 8 or 16.
+        \param [out] dst - a pointer to the output 32-bit float array with features.
+        \param [in] dstStride - a row size of output array with features.
+        \param [in] dstWidth - a width of output array with features.
+        \param [in] dstHeight - a height of output array with features.
+        */
+    SIMD_API void SimdHogLiteResizeFeatures(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t featureSize, float * dst, size_t dstStride, size_t dstWidth, size_t dstHeight);
 
-    /*! @ingroup neural
+    /*! @ingroup hog
 
-        \fn void SimdNeuralAddConvolution3x3Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+        \fn void SimdHogLiteCompressFeatures(const float * src, size_t srcStride, size_t width, size_t height, const float * pca, float * dst, size_t dstStride);
 
-        \short Adds 3x3 convolution of 32-bit float image (backward propagation).
+        \short Compresses 16 features to 8 features for 2D-array.
 
-        \note This function is used in Simd::Neural.
+        Compresses 16 features to 8 features for 2D-array. The method uses PCA.
 
-        \param [in] src - a pointer to the input 32-bit float image.
-        \param [in] srcStride - a row size of the input image (in 32-float values).
-        \param [in] width - a width of the input image (output image width must be equal to input image width + 2).
-        \param [in] height - a height of the input image (output image height must be equal to input image height + 2).
-        \param [in] weights - a pointer to the array with weights (its size must be at least 9).
-        \param [in, out] dst - a pointer to the output 32-bit float image.
-        \param [in] dstStride - a row size of the output image (in 32-float values).
+        \param [in] src - a pointer to the input 32-bit float array with uncompessed features.
+        \param [in] srcStride - a row size of input array with uncompessed features.
+        \param [in] width - a width of 2D-array with features.
+        \param [in] height - a height of 2D-array with features.
+        \param [in] pca - a pointer to the PCA matrix with size 16x8.
+        \param [out] dst - a pointer to the output 32-bit float array with compessed features.
+        \param [in] dstStride - a row size of output array with compessed features.
     */
-    SIMD_API void SimdNeuralAddConvolution3x3Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+    SIMD_API void SimdHogLiteCompressFeatures(const float * src, size_t srcStride, size_t width, size_t height, const float * pca, float * dst, size_t dstStride);
 
-    /*! @ingroup neural
+    /*! @ingroup hog
 
-        \fn void SimdNeuralAddConvolution4x4Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+        \fn void SimdHogLiteFilterSeparable(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t featureSize, const float * hFilter, size_t hSize, const float * vFilter, size_t vSize, float * dst, size_t dstStride, int add);
 
-        \short Adds 4x4 convolution of 32-bit float image (backward propagation).
+        \short Applies separable filter to lite HOG features.
 
-        \note This function is used in Simd::Neural.
+        For every point (except border):
+        \verbatim
+        sum = 0;
+        for(dy = 0; dy < vSize; dy++)
+            for(dx = 0; dx < hSize*featureSize; dx++)
+                sum += src[x*featureSize + dx, y + dy]*vFilter[dy]*hFilter[dx];
+        if(add)
+            dst[x, y] += sum;
+        else
+            dst[x, y] = sum;
+        \endverbatim
 
-        \param [in] src - a pointer to the input 32-bit float image.
-        \param [in] srcStride - a row size of the input image (in 32-float values).
-        \param [in] width - a width of the input image (output image width must be equal to input image width + 3).
-        \param [in] height - a height of the input image (output image height must be equal to input image height + 3).
-        \param [in] weights - a pointer to the array with weights (its size must be at least 16).
-        \param [in, out] dst - a pointer to the output 32-bit float image.
-        \param [in] dstStride - a row size of the output image (in 32-float values).
+        \note Input image has to have size at least not less then size of filter: (srcWidth <= hSize and srcHeight <= vSize).
+
+        \param [in] src - a pointer to the input 32-bit float array with features.
+        \param [in] srcStride - a row size of input array with features.
+        \param [in] srcWidth - a width of input array with features. Its minimal value is hSize.
+        \param [in] srcHeight - a height of input array with features. Its minimal value is vSize.
+        \param [in] featureSize - a size of cell with features. It must be 8 or 16.
+        \param [in] hFilter - a pointer to 32-bit float point array with horizontal filter.
+        \param [in] hSize - a size of horizontal filter (in featureSize). Total size of horizontal filter is hSize*featureSize.
+        \param [in] vFilter - a pointer to 32-bit float point array with vertical filter.
+        \param [in] vSize- a size of vertical filter.
+        \param [in, out] dst - a pointer to output 32-bit float point image.
+        \param [in] dstStride - a row size of output image.
+        \param [in] add - a flag which signalizes that result has to be added to existing image.
     */
-    SIMD_API void SimdNeuralAddConvolution4x4Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+    SIMD_API void SimdHogLiteFilterSeparable(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t featureSize, const float * hFilter, size_t hSize, const float * vFilter, size_t vSize, float * dst, size_t dstStride, int add);
 
-    /*! @ingroup neural
+    /*! @ingroup hog
 
-        \fn void SimdNeuralAddConvolution5x5Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+        \fn void SimdHogLiteFindMax7x7(const float * a, size_t aStride, const float * b, size_t bStride, size_t height, float * value, size_t * col, size_t * row);
 
-        \short Adds 5x5 convolution of 32-bit float image (backward propagation).
+        \short Adds two 32-bit float point 2D-array with size 7x7 and finds value and position of maximum in the result array.
 
-         \note This function is used in Simd::Neural.
+        Algorithm description:
+        \verbatim
+        value = -FLT_MAX;
+        for (y = 0; y < height; ++y)
+        {
+            for (x = 0; x < 7; ++x)
+            {
+                v = a[x, y] + b[x, y];
+                if (v > value)
+                {
+                    value = v;
+                    col = x;
+                    row = y;
+                    break;
+                }
+            }
+        }
+        \endverbatim
 
-        \param [in] src - a pointer to the input 32-bit float image.
-        \param [in] srcStride - a row size of the input image (in 32-float values).
-        \param [in] width - a width of the input image (output image width must be equal to input image width + 4).
-        \param [in] height - a height of the input image (output image height must be equal to input image height + 4).
-        \param [in] weights - a pointer to the array with weights (its size must be at least 25).
-        \param [in, out] dst - a pointer to the output 32-bit float image.
-        \param [in] dstStride - a row size of the output image (in 32-float values).
+        \param [in] a - a pointer to the first input 32-bit float array with size 7x7.
+        \param [in] aStride - a row size of the first input array.
+        \param [in] b - a pointer to the second input 32-bit float array with size 7x7.
+        \param [in] bStride - a row size of the second input array.
+        \param [in] height - a height of the input arrays. It must be equal or less then 7.
+        \param [out] value - a pointer to the output 32-bit float value with maximum.
+        \param [out] col - a pointer to the output integer value with x-position of maximum.
+        \param [out] row - a pointer to the output integer value with y-position of maximum.
     */
-    SIMD_API void SimdNeuralAddConvolution5x5Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+    SIMD_API void SimdHogLiteFindMax7x7(const float * a, size_t aStride, const float * b, size_t bStride, size_t height, float * value, size_t * col, size_t * row);
 
-    /*! @ingroup neural
+    /*! @ingroup hog
 
-        \fn void SimdNeuralAddConvolution2x2Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums);
+        \fn void SimdHogLiteCreateMask(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const float * threshold, size_t scale, size_t size, uint32_t * dst, size_t dstStride);
 
-        \short Accumulates changes of weights for 2x2 convolution of 32-bit float image during backward propagation.
+        \short Creates mask for function ::SimdHogLiteFilterFeatures.
 
-        \note This function is used in Simd::Neural.
+        Zeroes destination mask. Then for every source point:
+        \verbatim
+        if(src[x, y] > threshold)
+            for (dy = 0; dy < size; ++dy)
+                for (dx = 0; dx < size; ++dx)
+                    dst[x*scale + dx, y*scale + dy] = -1;
+        \endverbatim
 
-        \param [in] src - a pointer to the input 32-bit float image.
-        \param [in] srcStride - a row size of the input image (in 32-float values).
-        \param [in] dst - a pointer to the output 32-bit float image.
-        \param [in] dstStride - a row size of the output image (in 32-float values).
-        \param [in] width - a width of the output image (input image width must be equal to output image width + 1).
-        \param [in] height - a height of the output image (input image height must be equal to output image height + 1).
-        \param [in, out] sums - a pointer to the array with changes of weights (its size must be at least 4).
+        \param [in] src - a pointer to the input 32-bit float 2D array.
+        \param [in] srcStride - a row size of the input array.
+        \param [in] srcWidth - a width of input array.
+        \param [in] srcHeight - a height of input array.
+        \param [in] threshold - a pointer to 32-bit float threshold.
+        \param [in] scale - a scale coefficient between input and output array.
+        \param [in] size - a size of neighborhood.
+        \param [out] dst - a pointer to the output 32-bit integer array with mask (0 or -1).
+        \param [in] dstStride - a row size of the output array.
     */
-    SIMD_API void SimdNeuralAddConvolution2x2Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums);
+    SIMD_API void SimdHogLiteCreateMask(const float * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const float * threshold, size_t scale, size_t size, uint32_t * dst, size_t dstStride);
 
-    /*! @ingroup neural
+    /*! @ingroup other_conversion
 
-        \fn void SimdNeuralAddConvolution3x3Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums);
+        \fn void SimdHslToBgr(const uint8_t * hsl, size_t width, size_t height, size_t hslStride, uint8_t * bgr, size_t bgrStride);
 
-        \short Accumulates changes of weights for 3x3 convolution of 32-bit float image during backward propagation.
+        \short Converts 24-bit HSL(Hue, Saturation, Lightness) image to 24-bit BGR image.
 
-        \note This function is used in Simd::Neural.
+        All images must have the same width and height. It is inverse conversion to function ::SimdBgrToHsl.
 
-        \param [in] src - a pointer to the input 32-bit float image.
-        \param [in] srcStride - a row size of the input image (in 32-float values).
-        \param [in] dst - a pointer to the output 32-bit float image.
-        \param [in] dstStride - a row size of the output image (in 32-float values).
-        \param [in] width - a width of the output image (input image width must be equal to output image width + 2).
-        \param [in] height - a height of the output image (input image height must be equal to output image height + 2).
-        \param [in, out] sums - a pointer to the array with changes of weights (its size must be at least 9).
+        \note This function has a C++ wrapper Simd::HslToBgr(const View<A>& hsl, View<A>& bgr).
+
+        \param [in] hsl - a pointer to pixels data of input 24-bit HSL image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] hslStride - a row size of the hsl image.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
     */
-    SIMD_API void SimdNeuralAddConvolution3x3Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums);
+    SIMD_API void SimdHslToBgr(const uint8_t * hsl, size_t width, size_t height, size_t hslStride, uint8_t * bgr, size_t bgrStride);
 
-    /*! @ingroup neural
+    /*! @ingroup other_conversion
 
-        \fn void SimdNeuralAddConvolution4x4Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums);
+        \fn void SimdHsvToBgr(const uint8_t * hsv, size_t width, size_t height, size_t hsvStride, uint8_t * bgr, size_t bgrStride);
 
-        \short Accumulates changes of weights for 4x4 convolution of 32-bit float image during backward propagation.
+        \short Converts 24-bit HSV(Hue, Saturation, Value) image to 24-bit BGR image.
 
-        \note This function is used in Simd::Neural.
+        All images must have the same width and height. It is inverse conversion to function ::SimdBgrToHsv.
 
-        \param [in] src - a pointer to the input 32-bit float image.
-        \param [in] srcStride - a row size of the input image (in 32-float values).
-        \param [in] dst - a pointer to the output 32-bit float image.
-        \param [in] dstStride - a row size of the output image (in 32-float values).
-        \param [in] width - a width of the output image (input image width must be equal to output image width + 3).
-        \param [in] height - a height of the output image (input image height must be equal to output image height + 3).
-        \param [in, out] sums - a pointer to the array with changes of weights (its size must be at least 16).
+        \note This function has a C++ wrapper Simd::HsvToBgr(const View<A>& hsv, View<A>& bgr).
+
+        \param [in] hsv - a pointer to pixels data of input 24-bit HSV image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] hsvStride - a row size of the hsv image.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
     */
-    SIMD_API void SimdNeuralAddConvolution4x4Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums);
+    SIMD_API void SimdHsvToBgr(const uint8_t * hsv, size_t width, size_t height, size_t hsvStride, uint8_t * bgr, size_t bgrStride);
 
-    /*! @ingroup neural
+    /*! @ingroup other_conversion
 
-        \fn void SimdNeuralAddConvolution5x5Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums);
+        \fn void SimdLabToBgr(const uint8_t * lab, size_t width, size_t height, size_t labStride, uint8_t * bgr, size_t bgrStride);
 
-        \short Accumulates changes of weights for 5x5 convolution of 32-bit float image during backward propagation.
+        \short Converts 24-bit CIE Lab image to 24-bit BGR image.
 
-        \note This function is used in Simd::Neural.
+        All images must have the same width and height. It is inverse conversion to function ::SimdBgrToLab.
+        sRGB gamma encoding uses a lookup table with linear interpolation. Colors which are out of sRGB gamut are clamped.
 
-        \param [in] src - a pointer to the input 32-bit float image.
-        \param [in] srcStride - a row size of the input image (in 32-float values).
-        \param [in] dst - a pointer to the output 32-bit float image.
-        \param [in] dstStride - a row size of the output image (in 32-float values).
-        \param [in] width - a width of the output image (input image width must be equal to output image width + 4).
-        \param [in] height - a height of the output image (input image height must be equal to output image height + 4).
-        \param [in, out] sums - a pointer to the array with changes of weights (its size must be at least 25).
+        \note This function has a C++ wrapper Simd::LabToBgr(const View<A>& lab, View<A>& bgr).
+
+        \param [in] lab - a pointer to pixels data of input 24-bit Lab image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] labStride - a row size of the lab image.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
     */
-    SIMD_API void SimdNeuralAddConvolution5x5Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums);
+    SIMD_API void SimdLabToBgr(const uint8_t * lab, size_t width, size_t height, size_t labStride, uint8_t * bgr, size_t bgrStride);
 
-    /*! @ingroup neural
+    /*! @ingroup other_conversion
 
-        \fn void SimdNeuralPooling1x1Max3x3(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride);
+        \fn void SimdLab32fToBgr(const uint8_t * lab, size_t width, size_t height, size_t labStride, uint8_t * bgr, size_t bgrStride);
 
-        \short Takes maximum value in 3x3 window of input 32-bit float image and copies to the output image.
+        \short Converts CIE Lab image with 32-bit float channels to 24-bit BGR image.
 
-        \note This function is used in Simd::Neural. Output image must have the same size.
+        All images must have the same width and height. It is inverse conversion to function ::SimdBgrToLab32f.
+        Colors which are out of sRGB gamut are clamped.
 
-        \param [in] src - a pointer to the input 32-bit float image.
-        \param [in] srcStride - a row size of the input image (in 32-float values).
-        \param [in] width - a width of the input image.
-        \param [in] height - a height of the input image.
-        \param [in, out] dst - a pointer to the output 32-bit float image.
-        \param [in] dstStride - a row size of the output image (in 32-float values).
+        \note This function has a C++ wrapper Simd::Lab32fToBgr(const View<A>& lab, View<A>& bgr).
+
+        \param [in] lab - a pointer to pixels data of input 32-bit float Lab image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] labStride - a row size of the lab image (in bytes).
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
     */
-    SIMD_API void SimdNeuralPooling1x1Max3x3(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride);
+    SIMD_API void SimdLab32fToBgr(const uint8_t * lab, size_t width, size_t height, size_t labStride, uint8_t * bgr, size_t bgrStride);
 
-    /*! @ingroup neural
+    /*! @ingroup other_conversion
 
-        \fn void SimdNeuralPooling2x2Max2x2(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride);
+        \fn void SimdYCoCgRToBgr(const uint8_t * y, size_t yStride, const uint8_t * co, size_t coStride, const uint8_t * cg, size_t cgStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
 
-        \short Reduces input 32-bit float image in two times (takes maximum value in 2x2 window and copies to the output image).
+        \short Converts reversible YCoCg-R planes to 24-bit BGR image.
 
-        \note This function is used in Simd::Neural.
+        All images must have the same width and height. It is exact inverse conversion to function ::SimdBgrToYCoCgR.
+        Co and Cg values must be in range [-255..255]; output values are saturated to [0..255].
 
-        \param [in] src - a pointer to the input 32-bit float image.
-        \param [in] srcStride - a row size of the input image (in 32-float values).
-        \param [in] width - a width of the input image (output image width must have size (width + 1)/2).
-        \param [in] height - a height of the input image (output image height must have size (height + 1)/2).
-        \param [in, out] dst - a pointer to the output 32-bit float image.
-        \param [in] dstStride - a row size of the output image (in 32-float values).
+        \note This function has a C++ wrapper Simd::YCoCgRToBgr(const View<A>& y, const View<A>& co, const View<A>& cg, View<A>& bgr).
+
+        \param [in] y - a pointer to pixels data of input 8-bit Y plane.
+        \param [in] yStride - a row size of the y plane.
+        \param [in] co - a pointer to pixels data of input 16-bit Co plane.
+        \param [in] coStride - a row size of the co plane (in bytes).
+        \param [in] cg - a pointer to pixels data of input 16-bit Cg plane.
+        \param [in] cgStride - a row size of the cg plane (in bytes).
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
     */
-    SIMD_API void SimdNeuralPooling2x2Max2x2(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride);
+    SIMD_API void SimdYCoCgRToBgr(const uint8_t * y, size_t yStride, const uint8_t * co, size_t coStride, const uint8_t * cg, size_t cgStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
 
-    /*! @ingroup neural
+    /*! @ingroup other_conversion
 
-        \fn void SimdNeuralPooling2x2Max3x3(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride);
+        \fn void SimdInt16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride);
 
-        \short Reduces input 32-bit float image in two times (takes maximum value in 3x3 window and copies to the output image).
+        \short Converts 16-bit signed integer image to 8-bit gray image with saturation
 
-        \note This function is used in Simd::Neural.
+        All images must have the same width and height.
 
-        \param [in] src - a pointer to the input 32-bit float image.
-        \param [in] srcStride - a row size of the input image (in 32-float values).
-        \param [in] width - a width of the input image (output image width must have size width/2).
-        \param [in] height - a height of the input image (output image height must have size height/2).
-        \param [in, out] dst - a pointer to the output 32-bit float image.
-        \param [in] dstStride - a row size of the output image (in 32-float values).
+        For every point:
+        \verbatim
+        dst[i] = Max(0, Min(255, src[i]));
+        \endverbatim
+
+        \note This function has a C++ wrapper Simd::Int16ToGray(const View<A> & src, View<A> & dst).
+
+        \param [in] src - a pointer to pixels data of input 16-bit signed integer image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] srcStride - a row size of the 16-bit signed integer image.
+        \param [out] dst - a pointer to pixels data of input 8-bit gray image.
+        \param [out] dstStride - a row size of the gray image.
     */
-    SIMD_API void SimdNeuralPooling2x2Max3x3(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride);
+    SIMD_API void SimdInt16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride);
 
-    /*! @ingroup neural
+    /*! @ingroup other_conversion
 
-        \fn void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, size_t srcHeight, size_t srcDepth, const float * weight, size_t kernelX, size_t kernelY, size_t padX, size_t padY, size_t strideX, size_t strideY, size_t dilationX, size_t dilationY, void * buffer, size_t * size, float * dst, size_t dstWidth, size_t dstHeight, size_t dstDepth, int add);
+        \fn void SimdUint16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, size_t bitDepth, SimdBool dither, uint8_t * dst, size_t dstStride);
 
-        \short Adds convolution of the input multichannel 32-bit float image to the output multichannel 32-bit float image.
+        \short Converts 16-bit unsigned integer image with given bit depth (10, 12, 16 etc.) to 8-bit gray image.
 
-        \note There is a restriction to the size of output image:
+        All images must have the same width and height. The samples of input image are aligned to least significant bit.
+
+        For every point:
         \verbatim
-        dstWidth = (srcWidth + 2 * padX - (dilationX * (kernelX - 1) + 1)) / strideX + 1.
-        dstHeight = (srcHeight + 2 * padY - (dilationY * (kernelY - 1) + 1)) / strideY + 1.
+        dst[i] = Min(255, (src[i] + level(x, y)) >> (bitDepth - 8));
         \endverbatim
+        where level(x, y) is equal to the half of quantization step (rounding) or is taken from 4x4 ordered dithering matrix.
 
-        \param [in] src - a pointer to the input multichannel 32-bit float image. Total size of the input image is equal to srcWidth*srcHeight*srcDepth.
-        \param [in] srcWidth - a width of the input image.
-        \param [in] srcHeight - a height of the input image.
-        \param [in] srcDepth - a number of channels in the input image.
-        \param [in] weight - a pointer to the convolution weights. Total size of the weights is equal to `kernelX*kernelY*srcDepth*dstDepth`.
-        \param [in] kernelX - a width of the convolution kernel.
-        \param [in] kernelY - a height of the convolution kernel.
-        \param [in] padX - a pad to the x-coordinate of the input image.
-        \param [in] padY - a pad to the y-coordinate of the input image.
-        \param [in] strideX - a x-stride of the convolution.
-        \param [in] strideY - a y-stride of the convolution.
-        \param [in] dilationX - a x-stride of the convolution.
-        \param [in] dilationY - a y-stride of the convolution.
-        \param [in, out] buffer - a pointer to the external temporal buffer used by the algorithm. Can be NULL (the algorithm uses internal buffer).
-        \param [in, out] size - a pointer to the size of the external temporal buffer. If the size is too small it will contain required value. Required size is approximately equal to `dstWidth*dstHeight*srcDepth*kernelX*kernelY*sizeof(float)`. Can be NULL.
-        \param [in, out] dst - a pointer to the output multichannel 32-bit float image. Total size of the output image is equal to `dstWidth*dstHeight*dstDepth`.
-        \param [in] dstWidth - a width of the output image.
-        \param [in] dstHeight - a height of the output image.
-        \param [in] dstDepth - a number of channels in the output image.
-        \param [in] add - a flag which signalizes that we want add or assign value of convolution to the output image.
+        \note This function has a C++ wrapper Simd::Uint16ToGray(const View<A> & src, size_t bitDepth, View<A> & dst, bool dither).
+
+        \param [in] src - a pointer to pixels data of input 16-bit unsigned integer image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] srcStride - a row size of the 16-bit unsigned integer image.
+        \param [in] bitDepth - a bit depth of input image. It must be in range (8, 16].
+        \param [in] dither - a flag of ordered dithering. If it is ::SimdFalse then rounding is used.
+        \param [out] dst - a pointer to pixels data of output 8-bit gray image.
+        \param [in] dstStride - a row size of the gray image.
     */
-    SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, size_t srcHeight, size_t srcDepth, const float * weight, size_t kernelX, size_t kernelY, size_t padX, size_t padY, size_t strideX, size_t strideY, size_t dilationX, size_t dilationY, void * buffer, size_t * size, float * dst, size_t dstWidth, size_t dstHeight, size_t dstDepth, int add);
+    SIMD_API void SimdUint16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, size_t bitDepth, SimdBool dither, uint8_t * dst, size_t dstStride);
 
-    /*! @ingroup operation
+    /*! @ingroup other_conversion
 
-        \fn void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type);
+        \fn void SimdUint16ToFloat32(const uint8_t * src, size_t width, size_t height, size_t srcStride, size_t bitDepth, uint8_t * dst, size_t dstStride);
 
-        \short Performs given operation between two images.
+        \short Converts 16-bit unsigned integer image with given bit depth (10, 12, 16 etc.) to 32-bit float image normalized to range [0, 1].
 
-        All images must have the same width, height and format (8-bit gray, 16-bit UV (UV plane of NV12 pixel format), 24-bit BGR or 32-bit BGRA).
+        All images must have the same width and height. The samples of input image are aligned to least significant bit.
 
-        \note This function has a C++ wrappers: Simd::OperationBinary8u(const View<A>& a, const View<A>& b, View<A>& dst, SimdOperationBinary8uType type).
+        For every point:
+        \verbatim
+        dst[i] = src[i] / ((1 << bitDepth) - 1);
+        \endverbatim
 
-        \param [in] a - a pointer to pixels data of the first input image.
-        \param [in] aStride - a row size of the first image.
-        \param [in] b - a pointer to pixels data of the second input image.
-        \param [in] bStride - a row size of the second image.
+        \note This function has a C++ wrapper Simd::Uint16ToFloat32(const View<A> & src, size_t bitDepth, View<A> & dst).
+
+        \param [in] src - a pointer to pixels data of input 16-bit unsigned integer image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] channelCount - a channel count.
-        \param [out] dst - a pointer to pixels data of output image.
-        \param [in] dstStride - a row size of dst image.
-        \param [in] type - a type of operation (see ::SimdOperationBinary8uType).
+        \param [in] srcStride - a row size of the 16-bit unsigned integer image.
+        \param [in] bitDepth - a bit depth of input image. It must be in range (8, 16].
+        \param [out] dst - a pointer to pixels data of output 32-bit float image.
+        \param [in] dstStride - a row size (in bytes) of the float image.
     */
-    SIMD_API void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
-        size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type);
+    SIMD_API void SimdUint16ToFloat32(const uint8_t * src, size_t width, size_t height, size_t srcStride, size_t bitDepth, uint8_t * dst, size_t dstStride);
 
-    /*! @ingroup operation
+    /*! @ingroup other_conversion
 
-        \fn void SimdOperationBinary16i(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, uint8_t * dst, size_t dstStride, SimdOperationBinary16iType type);
+        \fn void SimdChangeBitDepth(const uint8_t * src, size_t width, size_t height, size_t srcStride, size_t srcBitDepth, size_t dstBitDepth, uint8_t * dst, size_t dstStride);
 
-        \short Performs given operation between two images.
+        \short Changes bit depth of image samples (8-bit or 16-bit unsigned integers).
 
-        All images must have the same width, height and ::SimdPixelFormatInt16 pixel format.
+        Samples with bit depth 8 are stored as 8-bit unsigned integers, samples with bit depth in range (8, 16] are stored as 16-bit unsigned integers
+        aligned to least significant bit. Samples of P010/P016 planes (aligned to most significant bit) can be processed with bit depth 16.
+        Input samples must be in range [0, 2^srcBitDepth). All images must have the same width and height.
+        Input and output image can be the same if they have equal sample size.
 
-        \note This function has a C++ wrappers: Simd::OperationBinary16i(const View<A>& a, const View<A>& b, View<A>& dst, SimdOperationBinary16iType type).
+        For every point:
+        \verbatim
+        if(dstBitDepth >= srcBitDepth)
+            dst[i] = src[i] << (dstBitDepth - srcBitDepth);
+        else
+            dst[i] = Min((src[i] + (1 << (srcBitDepth - dstBitDepth - 1))) >> (srcBitDepth - dstBitDepth), (1 << dstBitDepth) - 1);
+        \endverbatim
 
-        \param [in] a - a pointer to pixels data of the first input image.
-        \param [in] aStride - a row size of the first image.
-        \param [in] b - a pointer to pixels data of the second input image.
-        \param [in] bStride - a row size of the second image.
-        \param [in] width - an image width.
+        \note This function has a C++ wrapper Simd::ChangeBitDepth(const View<A> & src, size_t srcBitDepth, View<A> & dst, size_t dstBitDepth).
+
+        \param [in] src - a pointer to pixels data of input image.
+        \param [in] width - a number of samples in image row.
         \param [in] height - an image height.
+        \param [in] srcStride - a row size (in bytes) of input image.
+        \param [in] srcBitDepth - a bit depth of input image. It must be in range [8, 16].
+        \param [in] dstBitDepth - a bit depth of output image. It must be in range [8, 16].
         \param [out] dst - a pointer to pixels data of output image.
-        \param [in] dstStride - a row size of dst image.
-        \param [in] type - a type of operation (see ::SimdOperationBinary16iType).
+        \param [in] dstStride - a row size (in bytes) of output image.
     */
-    SIMD_API void SimdOperationBinary16i(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
-        size_t width, size_t height, uint8_t * dst, size_t dstStride, SimdOperationBinary16iType type);
+    SIMD_API void SimdChangeBitDepth(const uint8_t * src, size_t width, size_t height, size_t srcStride, size_t srcBitDepth, size_t dstBitDepth, uint8_t * dst, size_t dstStride);
 
-    /*! @ingroup operation
+    /*! @ingroup other_conversion
 
-        \fn void SimdVectorProduct(const uint8_t * vertical, const uint8_t * horizontal, uint8_t * dst, size_t stride, size_t width, size_t height);
+        \fn void SimdInterleaveUvBitDepth(const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, size_t srcBitDepth, size_t dstBitDepth, uint8_t * uv, size_t uvStride);
 
-        \short Calculates result 8-bit gray image as product of two vectors.
+        \short Interleaves U and V planes into UV plane and changes bit depth of samples at the same time.
 
-        For all points:
-        \verbatim
-        dst[x, y] = horizontal[x]*vertical[y]/255;
-        \endverbatim
+        It is used to convert chroma planes of YUV420P (8-bit or high bit depth) image to UV plane of NV12 or P010/P016 image in one pass.
+        Sample storage and rounding rules are the same as in function ::SimdChangeBitDepth.
 
-        \note This function has a C++ wrappers: Simd::VectorProduct(const uint8_t * vertical, const uint8_t * horizontal, View<A>& dst).
+        \note This function has a C++ wrapper Simd::InterleaveUvBitDepth(const View<A> & u, const View<A> & v, size_t srcBitDepth, View<A> & uv, size_t dstBitDepth).
 
-        \param [in] vertical - a pointer to pixels data of vertical vector. It length is equal to result image height.
-        \param [in] horizontal - a pointer to pixels data of horizontal vector. It length is equal to result image width.
-        \param [out] dst - a pointer to pixels data of result image.
-        \param [in] stride - a row size of dst image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
+        \param [in] u - a pointer to pixels data of input U plane.
+        \param [in] uStride - a row size (in bytes) of input U plane.
+        \param [in] v - a pointer to pixels data of input V plane.
+        \param [in] vStride - a row size (in bytes) of input V plane.
+        \param [in] width - a width of input and output planes (in pixels).
+        \param [in] height - a height of input and output planes.
+        \param [in] srcBitDepth - a bit depth of input planes. It must be in range [8, 16].
+        \param [in] dstBitDepth - a bit depth of output plane. It must be in range [8, 16].
+        \param [out] uv - a pointer to pixels data of output UV plane.
+        \param [in] uvStride - a row size (in bytes) of output UV plane.
     */
-    SIMD_API void SimdVectorProduct(const uint8_t * vertical, const uint8_t * horizontal,
-        uint8_t * dst, size_t stride, size_t width, size_t height);
+    SIMD_API void SimdInterleaveUvBitDepth(const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height,
+        size_t srcBitDepth, size_t dstBitDepth, uint8_t * uv, size_t uvStride);
 
-    /*! @ingroup resizing
-
-        \fn void SimdReduceColor2x2(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount);
+    /*! @ingroup other_conversion
 
-        \short Performs reducing and Gaussian blurring (in two time) a 8-bit channel color image with using window 2x2.
+        \fn void SimdDeinterleaveUvBitDepth(const uint8_t * uv, size_t uvStride, size_t width, size_t height, size_t srcBitDepth, size_t dstBitDepth, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
-        For input and output image must be performed: dstWidth = (srcWidth + 1)/2,  dstHeight = (srcHeight + 1)/2.
+        \short Deinterleaves UV plane into U and V planes and changes bit depth of samples at the same time.
 
-        For all points:
-        \verbatim
-        dst[x, y, c] = (src[2*x, 2*y, c] + src[2*x, 2*y + 1, c] + src[2*x + 1, 2*y, c] + src[2*x + 1, 2*y + 1, c] + 2)/4;
-        \endverbatim
+        It is used to convert UV plane of NV12 or P010/P016 image to chroma planes of YUV420P (8-bit or high bit depth) image in one pass.
+        Sample storage and rounding rules are the same as in function ::SimdChangeBitDepth.
 
-        \note This function has a C++ wrappers: Simd::Reduce2x2(const View<A> & src, View<A> & dst).
+        \note This function has a C++ wrapper Simd::DeinterleaveUvBitDepth(const View<A> & uv, size_t srcBitDepth, View<A> & u, View<A> & v, size_t dstBitDepth).
 
-        \param [in] src - a pointer to pixels data of the original input image.
-        \param [in] srcWidth - a width of the input image.
-        \param [in] srcHeight - a height of the input image.
-        \param [in] srcStride - a row size of the input image.
-        \param [out] dst - a pointer to pixels data of the reduced output image.
-        \param [in] dstWidth - a width of the output image.
-        \param [in] dstHeight - a height of the output image.
-        \param [in] dstStride - a row size of the output image.
-        \param [in] channelCount - a nmber of channels for input and output images.
+        \param [in] uv - a pointer to pixels data of input UV plane.
+        \param [in] uvStride - a row size (in bytes) of input UV plane.
+        \param [in] width - a width of input and output planes (in pixels).
+        \param [in] height - a height of input and output planes.
+        \param [in] srcBitDepth - a bit depth of input plane. It must be in range [8, 16].
+        \param [in] dstBitDepth - a bit depth of output planes. It must be in range [8, 16].
+        \param [out] u - a pointer to pixels data of output U plane.
+        \param [in] uStride - a row size (in bytes) of output U plane.
+        \param [out] v - a pointer to pixels data of output V plane.
+        \param [in] vStride - a row size (in bytes) of output V plane.
     */
-    SIMD_API void SimdReduceColor2x2(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
-        uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount);
-
-    /*! @ingroup resizing
+    SIMD_API void SimdDeinterleaveUvBitDepth(const uint8_t * uv, size_t uvStride, size_t width, size_t height, size_t srcBitDepth, size_t dstBitDepth,
+        uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
-        \fn void SimdReduceGray2x2(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
+    /*! @ingroup integral
 
-        \short Performs reducing and Gaussian blurring (in two time) a 8-bit gray image with using window 2x2.
+        \fn void SimdIntegral(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride, SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat);
 
-        For input and output image must be performed: dstWidth = (srcWidth + 1)/2,  dstHeight = (srcHeight + 1)/2.
+        \short Calculates integral images for input 8-bit gray image.
 
-        For all points:
-        \verbatim
-        dst[x, y] = (src[2*x, 2*y] + src[2*x, 2*y + 1] + src[2*x + 1, 2*y] + src[2*x + 1, 2*y + 1] + 2)/4;
-        \endverbatim
+        The function can calculates sum integral image, square sum integral image (optionally) and tilted sum integral image (optionally).
+        A integral images must have width and height per unit greater than that of the input image.
 
-        \note This function has a C++ wrappers: Simd::ReduceGray2x2(const View<A>& src, View<A>& dst).
+        \note This function has a C++ wrappers:
+        \n Simd::Integral(const View<A>& src, View<A>& sum),
+        \n Simd::Integral(const View<A>& src, View<A>& sum, View<A>& sqsum),
+        \n Simd::Integral(const View<A>& src, View<A>& sum, View<A>& sqsum, View<A>& tilted).
 
-        \param [in] src - a pointer to pixels data of the original input image.
-        \param [in] srcWidth - a width of the input image.
-        \param [in] srcHeight - a height of the input image.
-        \param [in] srcStride - a row size of the input image.
-        \param [out] dst - a pointer to pixels data of the reduced output image.
-        \param [in] dstWidth - a width of the output image.
-        \param [in] dstHeight - a height of the output image.
-        \param [in] dstStride - a row size of the output image.
+        \param [in] src - a pointer to pixels data of input 8-bit gray image.
+        \param [in] srcStride - a row size of src image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] sum - a pointer to pixels data of 32-bit integer sum image.
+        \param [in] sumStride - a row size of sum image (in bytes).
+        \param [out] sqsum - a pointer to pixels data of 32-bit integer or 64-bit float point square sum image. It can be NULL.
+        \param [in] sqsumStride - a row size of sqsum image (in bytes).
+        \param [out] tilted - a pointer to pixels data of 32-bit integer tilted sum image. It can be NULL.
+        \param [in] tiltedStride - a row size of tilted image (in bytes).
+        \param [in] sumFormat - a format of sum image and tilted image. It can be equal to ::SimdPixelFormatInt32.
+        \param [in] sqsumFormat - a format of sqsum image. It can be equal to ::SimdPixelFormatInt32 or ::SimdPixelFormatDouble.
     */
-    SIMD_API void SimdReduceGray2x2(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
-        uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
-
-    /*! @ingroup resizing
+    SIMD_API void SimdIntegral(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride,
+        SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat);
 
-        \fn void SimdReduceGray3x3(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, int compensation);
+    /*! @ingroup interference
 
-        \short Performs reducing and Gaussian blurring (in two time) a 8-bit gray image with using window 3x3.
+        \fn void SimdInterferenceIncrement(uint8_t * statistic, size_t stride, size_t width, size_t height, uint8_t increment, int16_t saturation);
 
-        For input and output image must be performed: dstWidth = (srcWidth + 1)/2,  dstHeight = (srcHeight + 1)/2.
+        \short Increments statistic of interference detector.
 
         For every point:
         \verbatim
-        dst[x, y] = (src[2*x-1, 2*y-1] + 2*src[2*x, 2*y-1] + src[2*x+1, 2*y-1] +
-                  2*(src[2*x-1, 2*y]   + 2*src[2*x, 2*y]   + src[2*x+1, 2*y]) +
-                     src[2*x-1, 2*y+1] + 2*src[2*x, 2*y+1] + src[2*x+1, 2*y+1] + compensation ? 8 : 0) / 16;
+        statistic[i] = min(statistic[i] + increment, saturation);
         \endverbatim
 
-        \note This function has a C++ wrappers: Simd::ReduceGray3x3(const View<A>& src, View<A>& dst, bool compensation).
+        This function is used for interference detection in motion detection algorithm.
 
-        \param [in] src - a pointer to pixels data of the original input image.
-        \param [in] srcWidth - a width of the input image.
-        \param [in] srcHeight - a height of the input image.
-        \param [in] srcStride - a row size of the input image.
-        \param [out] dst - a pointer to pixels data of the reduced output image.
-        \param [in] dstWidth - a width of the output image.
-        \param [in] dstHeight - a height of the output image.
-        \param [in] dstStride - a row size of the output image.
-        \param [in] compensation - a flag of compensation of rounding.
-    */
-    SIMD_API void SimdReduceGray3x3(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
-        uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, int compensation);
+        \note This function has a C++ wrappers: Simd::InterferenceIncrement(View<A> & dst, uint8_t increment, int16_t saturation).
 
-    /*! @ingroup resizing
+        \param [in, out] statistic - a pointer to pixels data of 16-bit signed integer image with statistic.
+        \param [in] stride - a row size of statistic image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] increment - an increment of statistic.
+        \param [in] saturation - an upper saturation of statistic.
+    */
+    SIMD_API void SimdInterferenceIncrement(uint8_t * statistic, size_t stride, size_t width, size_t height, uint8_t increment, int16_t saturation);
 
-        \fn void SimdReduceGray4x4(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
+    /*! @ingroup interference
 
-        \short Performs reducing and Gaussian blurring (in two time) a 8-bit gray image with using window 4x4.
+        \fn void SimdInterferenceIncrementMasked(uint8_t * statistic, size_t statisticStride, size_t width, size_t height, uint8_t increment, int16_t saturation, const uint8_t * mask, size_t maskStride, uint8_t index);
 
-        For input and output image must be performed: dstWidth = (srcWidth + 1)/2,  dstHeight = (srcHeight + 1)/2.
+        \short Increments statistic of interference detector with using segmentation mask.
 
         For every point:
         \verbatim
-        dst[x, y] = (src[2*x-1, 2*y-1] + 3*src[2*x, 2*y-1] + 3*src[2*x+1, 2*y-1] + src[2*x+2, 2*y-1]
-                  3*(src[2*x-1, 2*y]   + 3*src[2*x, 2*y]   + 3*src[2*x+1, 2*y]   + src[2*x+2, 2*y]) +
-                  3*(src[2*x-1, 2*y+1] + 3*src[2*x, 2*y+1] + 3*src[2*x+1, 2*y+1] + src[2*x+2, 2*y+1]) +
-                     src[2*x-1, 2*y+2] + 3*src[2*x, 2*y+2] + 3*src[2*x+1, 2*y+2] + src[2*x+2, 2*y+2] + 32) / 64;
+        if(mask[i] == index)
+            statistic[i] = min(statistic[i] + increment, saturation);
         \endverbatim
 
-        \note This function has a C++ wrappers: Simd::ReduceGray4x4(const View<A>& src, View<A>& dst).
+        All images must have the same width, height.
+        This function is used for interference detection in motion detection algorithm.
 
-        \param [in] src - a pointer to pixels data of the original input image.
-        \param [in] srcWidth - a width of the input image.
-        \param [in] srcHeight - a height of the input image.
-        \param [in] srcStride - a row size of the input image.
-        \param [out] dst - a pointer to pixels data of the reduced output image.
-        \param [in] dstWidth - a width of the output image.
-        \param [in] dstHeight - a height of the output image.
-        \param [in] dstStride - a row size of the output image.
-    */
-    SIMD_API void SimdReduceGray4x4(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
-        uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
+        \note This function has a C++ wrappers: Simd::InterferenceIncrementMasked(View<A> & dst, uint8_t increment, int16_t saturation, const View<A>& mask, uint8_t index).
 
-    /*! @ingroup resizing
+        \param [in, out] statistic - a pointer to pixels data of 16-bit signed integer image with statistic.
+        \param [in] statisticStride - a row size of statistic image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] increment - an increment of statistic.
+        \param [in] saturation - an upper saturation of statistic.
+        \param [in] mask - a pointer to pixels data of 8-bit gray image with mask.
+        \param [in] maskStride - a row size of mask image.
+        \param [in] index - an index of mask.
+    */
+    SIMD_API void SimdInterferenceIncrementMasked(uint8_t * statistic, size_t statisticStride, size_t width, size_t height,
+        uint8_t increment, int16_t saturation, const uint8_t * mask, size_t maskStride, uint8_t index);
 
-        \fn void SimdReduceGray5x5(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, int compensation);
+    /*! @ingroup interference
 
-        \short Performs reducing and Gaussian blurring (in two time) a 8-bit gray image with using window 5x5.
+        \fn void SimdInterferenceDecrement(uint8_t * statistic, size_t stride, size_t width, size_t height, uint8_t decrement, int16_t saturation);
 
-        For input and output image must be performed: dstWidth = (srcWidth + 1)/2,  dstHeight = (srcHeight + 1)/2.
+        \short Decrements statistic of interference detector.
 
         For every point:
         \verbatim
-        dst[x, y] = (
-               src[2*x-2, 2*y-2] + 4*src[2*x-1, 2*y-2] + 6*src[2*x, 2*y-2] + 4*src[2*x+1, 2*y-2] + src[2*x+2, 2*y-2] +
-            4*(src[2*x-2, 2*y-1] + 4*src[2*x-1, 2*y-1] + 6*src[2*x, 2*y-1] + 4*src[2*x+1, 2*y-1] + src[2*x+2, 2*y-1]) +
-            6*(src[2*x-2, 2*y]   + 4*src[2*x-1, 2*y]   + 6*src[2*x, 2*y]   + 4*src[2*x+1, 2*y]   + src[2*x+2, 2*y]) +
-            4*(src[2*x-2, 2*y+1] + 4*src[2*x-1, 2*y+1] + 6*src[2*x, 2*y+1] + 4*src[2*x+1, 2*y+1] + src[2*x+2, 2*y+1]) +
-               src[2*x-2, 2*y+2] + 4*src[2*x-1, 2*y+2] + 6*src[2*x, 2*y+2] + 4*src[2*x+1, 2*y+2] + src[2*x+2, 2*y+2] +
-            compensation ? 128 : 0) / 256;
+        statistic[i] = max(statistic[i] - decrement, saturation);
         \endverbatim
 
-        \note This function has a C++ wrappers: Simd::ReduceGray5x5(const Viewc<A>& src, View<A>& dst, bool compensation).
+        This function is used for interference detection in motion detection algorithm.
 
-        \param [in] src - a pointer to pixels data of the original input image.
-        \param [in] srcWidth - a width of the input image.
-        \param [in] srcHeight - a height of the input image.
-        \param [in] srcStride - a row size of the input image.
-        \param [out] dst - a pointer to pixels data of the reduced output image.
-        \param [in] dstWidth - a width of the output image.
-        \param [in] dstHeight - a height of the output image.
-        \param [in] dstStride - a row size of the output image.
-        \param [in] compensation - a flag of compensation of rounding.
-    */
-    SIMD_API void SimdReduceGray5x5(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
-        uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, int compensation);
+        \note This function has a C++ wrappers: Simd::InterferenceDecrement(View<A> & dst, uint8_t decrement, int16_t saturation).
 
-    /*! @ingroup reordering
+        \param [in, out] statistic - a pointer to pixels data of 16-bit signed integer image with statistic.
+        \param [in] stride - a row size of statistic image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] decrement - a decrement of statistic.
+        \param [in] saturation - a lower saturation of statistic.
+    */
+    SIMD_API void SimdInterferenceDecrement(uint8_t * statistic, size_t stride, size_t width, size_t height, uint8_t decrement, int16_t saturation);
 
-        \fn void SimdReorder16bit(const uint8_t * src, size_t size, uint8_t * dst);
+    /*! @ingroup interference
 
-        \short Performs bytes reordering for data array.
+        \fn void SimdInterferenceDecrementMasked(uint8_t * statistic, size_t statisticStride, size_t width, size_t height, uint8_t decrement, int16_t saturation, const uint8_t * mask, size_t maskStride, uint8_t index);
 
-        For every 2 bytes:
+        \short Decrements statistic of interference detector with using segmentation mask.
+
+        For every point:
         \verbatim
-        dst[2*i + 0] = src[2*i + 1];
-        dst[2*i + 1] = src[2*i + 0];
+        if(mask[i] == index)
+            statistic[i] = max(statistic[i] - decrement, saturation);
         \endverbatim
 
-        The data size must be a multiple of 2.
+        All images must have the same width, height.
+        This function is used for interference detection in motion detection algorithm.
 
-        \param [in] src - a pointer to the input data.
-        \param [in] size - a size of input and output data.
-        \param [out] dst - a pointer to the output data.
+        \note This function has a C++ wrappers: Simd::InterferenceDecrementMasked(View<A> & dst, uint8_t decrement, int16_t saturation, const View<A>& mask, uint8_t index).
+
+        \param [in, out] statistic - a pointer to pixels data of 16-bit signed integer image with statistic.
+        \param [in] statisticStride - a row size of statistic image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] decrement - a decrement of statistic.
+        \param [in] saturation - a lower saturation of statistic.
+        \param [in] mask - a pointer to pixels data of 8-bit gray image with mask.
+        \param [in] maskStride - a row size of mask image.
+        \param [in] index - an index of mask.
     */
-    SIMD_API void SimdReorder16bit(const uint8_t * src, size_t size, uint8_t * dst);
+    SIMD_API void SimdInterferenceDecrementMasked(uint8_t * statistic, size_t statisticStride, size_t width, size_t height,
+        uint8_t decrement, int16_t saturation, const uint8_t * mask, size_t maskStride, uint8_t index);
 
-    /*! @ingroup reordering
+    /*! @ingroup other_conversion
 
-        \fn void SimdReorder32bit(const uint8_t * src, size_t size, uint8_t * dst);
+        \fn void SimdInterleaveUv(const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * uv, size_t uvStride);
 
-        \short Performs bytes reordering for data array.
+        \short Interleaves 8-bit U and V planar images into one 16-bit UV interleaved image.
 
-        For every 4 bytes:
-        \verbatim
-        dst[4*i + 0] = src[4*i + 3];
-        dst[4*i + 1] = src[4*i + 2];
-        dst[4*i + 2] = src[4*i + 1];
-        dst[4*i + 3] = src[4*i + 0];
-        \endverbatim
+        All images must have the same width and height.
+        This function used for YUV420P to NV12 conversion.
 
-        The data size must be a multiple of 4.
+        \note This function has a C++ wrapper Simd::InterleaveUv(const View<A>& u, const View<A>& v, View<A>& uv).
 
-        \param [in] src - a pointer to the input data.
-        \param [in] size - a size of input and output data.
-        \param [out] dst - a pointer to the output data.
+        \param [in] u - a pointer to pixels data of input 8-bit U planar image.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit V planar image.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] uv - a pointer to pixels data of output 16-bit UV interleaved image.
+        \param [in] uvStride - a row size of the uv image.
     */
-    SIMD_API void SimdReorder32bit(const uint8_t * src, size_t size, uint8_t * dst);
+    SIMD_API void SimdInterleaveUv(const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * uv, size_t uvStride);
 
-    /*! @ingroup reordering
+    /*! @ingroup other_conversion
 
-        \fn void SimdReorder64bit(const uint8_t * src, size_t size, uint8_t * dst);
+        \fn void SimdInterleaveBgr(const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
 
-        \short Performs bytes reordering for data array.
+        \short Interleaves 8-bit Blue, Green and Red planar images into one 24-bit BGR interleaved image.
 
-        For every 8 bytes:
-        \verbatim
-        dst[8*i + 0] = src[8*i + 7];
-        dst[8*i + 1] = src[8*i + 6];
-        dst[8*i + 2] = src[8*i + 5];
-        dst[8*i + 3] = src[8*i + 4];
-        dst[8*i + 4] = src[8*i + 3];
-        dst[8*i + 5] = src[8*i + 2];
-        dst[8*i + 6] = src[8*i + 1];
-        dst[8*i + 7] = src[8*i + 0];
-        \endverbatim
+        All images must have the same width and height.
 
-        The data size must be a multiple of 8.
+        \note This function has a C++ wrapper Simd::InterleaveBgr(const View<A>& b, const View<A>& g, const View<A>& r, View<A>& bgr).
 
-        \param [in] src - a pointer to the input data.
-        \param [in] size - a size of input and output data.
-        \param [out] dst - a pointer to the output data.
+        \param [in] b - a pointer to pixels data of input 8-bit Blue planar image.
+        \param [in] bStride - a row size of the b image.
+        \param [in] g - a pointer to pixels data of input 8-bit Green planar image.
+        \param [in] gStride - a row size of the g image.
+        \param [in] r - a pointer to pixels data of input 8-bit Red planar image.
+        \param [in] rStride - a row size of the r image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR interleaved image.
+        \param [in] bgrStride - a row size of the bgr image.
     */
-    SIMD_API void SimdReorder64bit(const uint8_t * src, size_t size, uint8_t * dst);
-
-    /*! @ingroup resizing
-
-        \fn void SimdResizeBilinear(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount);
+    SIMD_API void SimdInterleaveBgr(const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
 
-        \short Performs resizing of input image with using bilinear interpolation.
+    /*! @ingroup other_conversion
 
-        All images must have the same format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+        \fn void SimdInterleaveBgra(const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride, const uint8_t * a, size_t aStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride);
 
-        \note This function has a C++ wrappers: Simd::ResizeBilinear(const View<A>& src, View<A>& dst).
+        \short Interleaves 8-bit Blue, Green, Red and Alpha planar images into one 32-bit BGRA interleaved image.
 
-        \param [in] src - a pointer to pixels data of the original input image.
-        \param [in] srcWidth - a width of the input image.
-        \param [in] srcHeight - a height of the input image.
-        \param [in] srcStride - a row size of the input image.
-        \param [out] dst - a pointer to pixels data of the reduced output image.
-        \param [in] dstWidth - a width of the output image.
-        \param [in] dstHeight - a height of the output image.
-        \param [in] dstStride - a row size of the output image.
-        \param [in] channelCount - a channel count.
-    */
-    SIMD_API void SimdResizeBilinear(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
-        uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount);
+        All images must have the same width and height.
 
-    /*! @ingroup resizing
-        Describes resized image channel types.
-    */
-    typedef enum
-    {
-        /*! 8-bit integer channel type.  */
-        SimdResizeChannelByte,
-        /*! 32-bit float channel type.  */
-        SimdResizeChannelFloat,
-    } SimdResizeChannelType;
+        \note This function has a C++ wrapper Simd::InterleaveBgra(const View<A>& b, const View<A>& g, const View<A>& r, const View<A>& a, View<A>& bgra).
 
-    /*! @ingroup resizing
-        Describes methods used in oreder to resize image.
+        \param [in] b - a pointer to pixels data of input 8-bit Blue planar image.
+        \param [in] bStride - a row size of the b image.
+        \param [in] g - a pointer to pixels data of input 8-bit Green planar image.
+        \param [in] gStride - a row size of the g image.
+        \param [in] r - a pointer to pixels data of input 8-bit Red planar image.
+        \param [in] rStride - a row size of the r image.
+        \param [in] a - a pointer to pixels data of input 8-bit Alpha planar image.
+        \param [in] aStride - a row size of the a image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA interleaved image.
+        \param [in] bgraStride - a row size of the bgr image.
     */
-    typedef enum
-    {
-        /*! Bilinear method. */
-        SimdResizeMethodBilinear,
-        /*! caffe::interp compatible method. */
-        SimdResizeMethodCaffeInterp,
-    } SimdResizeMethodType;
-
-    /*! @ingroup resizing
+    SIMD_API void SimdInterleaveBgra(const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride, const uint8_t * a, size_t aStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride);
 
-        \fn void * SimdResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+    /*! @ingroup laplace_filter
 
-        \short Creates resize context.
+        \fn void SimdLaplace(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
 
-        \param [in] srcX - a width of the input image.
-        \param [in] srcY - a height of the input image.
-        \param [in] dstX - a width of the output image.
-        \param [in] dstY - a height of the output image.
-        \param [in] channels - a channel number of input and output image.
-        \param [in] type - a type of input and output image channel.
-        \param [in] method - a method used in order to resize image.
-        \return a pointer to resize context. On error it returns NULL. 
-                This pointer is used in functions ::SimdResizerRun. 
-                It must be released with using of function ::SimdRelease.
-    */
-    SIMD_API void * SimdResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+        \short Calculates Laplace's filter.
 
-    /*! @ingroup resizing
+        All images must have the same width and height. Input image must has 8-bit gray format, output image must has 16-bit integer format.
 
-        \fn void SimdResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+        For every point:
+        \verbatim
+        dst[x, y] =
+            - src[x-1, y-1] -   src[x, y-1] - src[x+1, y-1]
+            - src[x-1, y]   + 8*src[x, y]   - src[x+1, y]
+            - src[x-1, y+1] -   src[x, y+1] - src[x+1, y+1].
+        \endverbatim
 
-        \short Performs image resizing.
+        \note This function has a C++ wrappers: Simd::Laplace(const View<A>& src, View<A>& dst).
 
-        \param [in] resizer - a resize context. It must be created by function ::SimdResizerInit and released by function ::SimdRelease.
-        \param [in] src - a pointer to pixels data of the original input image.
-        \param [in] srcStride - a row size (in bytes) of the input image.
-        \param [out] dst - a pointer to pixels data of the resized output image.
-        \param [in] dstStride - a row size (in bytes) of the output image.
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] dst - a pointer to pixels data of the output image.
+        \param [in] dstStride - a row size of the output image (in bytes).
     */
-    SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+    SIMD_API void SimdLaplace(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
 
-    /*! @ingroup segmentation
+    /*! @ingroup laplace_filter
 
-        \fn void SimdSegmentationChangeIndex(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t oldIndex, uint8_t newIndex);
+        \fn void SimdLaplaceAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
 
-        \short Changes certain index in mask.
+        \short Calculates absolute value of Laplace's filter.
 
-        Mask must has 8-bit gray pixel format.
+        All images must have the same width and height. Input image must has 8-bit gray format, output image must has 16-bit integer format.
 
         For every point:
         \verbatim
-        if(mask[i] == oldIndex)
-            mask[i] = newIndex;
+        dst[x, y] = abs(
+            - src[x-1, y-1] -   src[x, y-1] - src[x+1, y-1]
+            - src[x-1, y]   + 8*src[x, y]   - src[x+1, y]
+            - src[x-1, y+1] -   src[x, y+1] - src[x+1, y+1]).
         \endverbatim
 
-        \note This function has a C++ wrappers: Simd::SegmentationChangeIndex(View<A> & mask, uint8_t oldIndex, uint8_t newIndex).
+        \note This function has a C++ wrappers: Simd::LaplaceAbs(const View<A>& src, View<A>& dst).
 
-        \param [in, out] mask - a pointer to pixels data of 8-bit gray mask image.
-        \param [in] stride - a row size of the mask image.
-        \param [in] width - a mask width.
-        \param [in] height - a mask height.
-        \param [in] oldIndex - a mask old index.
-        \param [in] newIndex - a mask new index.
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] dst - a pointer to pixels data of the output image.
+        \param [in] dstStride - a row size of the output image (in bytes).
     */
-    SIMD_API void SimdSegmentationChangeIndex(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t oldIndex, uint8_t newIndex);
+    SIMD_API void SimdLaplaceAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
 
-    /*! @ingroup segmentation
+    /*! @ingroup other_statistic
 
-        \fn void SimdSegmentationFillSingleHoles(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index);
+        \fn void SimdLaplaceAbsSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum);
 
-        \short Fill single holes in mask.
+        \short Calculates sum of absolute value of Laplace's filter.
 
-        Mask must has 8-bit gray pixel format.
+        Input image must has 8-bit gray format.
 
-        \note This function has a C++ wrappers: Simd::SegmentationFillSingleHoles(View<A> & mask, uint8_t index).
+        For every point:
+        \verbatim
+        sum += abs(
+            - src[x-1, y-1] -   src[x, y-1] - src[x+1, y-1]
+            - src[x-1, y]   + 8*src[x, y]   - src[x+1, y]
+            - src[x-1, y+1] -   src[x, y+1] - src[x+1, y+1]).
+        \endverbatim
 
-        \param [in, out] mask - a pointer to pixels data of 8-bit gray mask image.
-        \param [in] stride - a row size of the mask image.
-        \param [in] width - an mask width.
-        \param [in] height - an mask height.
-        \param [in] index - a mask index.
+        \note This function has a C++ wrappers: Simd::LaplaceAbsSum(const View<A>& src, uint64_t & sum).
+
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] stride - a row size of the input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] sum - a pointer to result sum.
     */
-    SIMD_API void SimdSegmentationFillSingleHoles(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index);
+    SIMD_API void SimdLaplaceAbsSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum);
 
-    /*! @ingroup segmentation
+    /*! @ingroup other_filter
 
-        \fn void SimdSegmentationPropagate2x2(const uint8_t * parent, size_t parentStride, size_t width, size_t height, uint8_t * child, size_t childStride, const uint8_t * difference, size_t differenceStride, uint8_t currentIndex, uint8_t invalidIndex, uint8_t emptyIndex, uint8_t differenceThreshold);
+        \fn void SimdLbpEstimate(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
 
-        \short Propagates mask index from parent (upper) to child (lower) level of mask pyramid with using 2x2 scan window.
+        \short Calculates LBP (Local Binary Patterns) for 8-bit gray image.
 
-        For parent and child image must be performed: parentWidth = (childWidth + 1)/2, parentHeight = (childHeight + 1)/2.
-        All images must have 8-bit gray pixel format. Size of different image is equal to child image.
+        All images must have the same width and height.
 
-        \note This function has a C++ wrappers: Simd::SegmentationPropagate2x2(const View<A> & parent, View<A> & child, const View<A> & difference, uint8_t currentIndex, uint8_t invalidIndex, uint8_t emptyIndex, uint8_t thresholdDifference).
+        \note This function has a C++ wrappers: Simd::LbpEstimate(const View<A>& src, View<A>& dst).
 
-        \param [in] parent - a pointer to pixels data of 8-bit gray parent mask image.
-        \param [in] parentStride - a row size of the parent mask image.
-        \param [in] width - a parent mask width.
-        \param [in] height - a parent mask height.
-        \param [in, out] child - a pointer to pixels data of 8-bit gray child mask image.
-        \param [in] childStride - a row size of the child mask image.
-        \param [in] difference - a pointer to pixels data of 8-bit gray difference image.
-        \param [in] differenceStride - a row size of the difference image.
-        \param [in] currentIndex - propagated mask index.
-        \param [in] invalidIndex - invalid mask index.
-        \param [in] emptyIndex - empty mask index.
-        \param [in] differenceThreshold - a difference threshold for conditional index propagating.
+        \param [in] src - a pointer to pixels data of input 8-bit gray image.
+        \param [in] srcStride - a row size of src image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] dst - a pointer to pixels data of output 8-bit gray image with LBP.
+        \param [in] dstStride - a row size of dst image.
     */
-    SIMD_API void SimdSegmentationPropagate2x2(const uint8_t * parent, size_t parentStride, size_t width, size_t height,
-        uint8_t * child, size_t childStride, const uint8_t * difference, size_t differenceStride,
-        uint8_t currentIndex, uint8_t invalidIndex, uint8_t emptyIndex, uint8_t differenceThreshold);
+    SIMD_API void SimdLbpEstimate(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
 
-    /*! @ingroup segmentation
+    /*! @ingroup math
+        Describes type of elementary function. It is used in ::SimdMathFunction32f.
+    */
+    typedef enum
+    {
+        /*!
+            Exponent.
+            \verbatim
+            dst[i] = exp(src[i]);
+            \endverbatim
+        */
+        SimdMathFunctionExp,
+        /*!
+            Natural logarithm (src[i] must be positive).
+            \verbatim
+            dst[i] = log(src[i]);
+            \endverbatim
+        */
+        SimdMathFunctionLog,
+        /*!
+            Power function (src[i] must be positive).
+            It has one parameter: exponent (params[0]).
+            \verbatim
+            dst[i] = pow(src[i], exponent);
+            \endverbatim
+        */
+        SimdMathFunctionPow,
+        /*!
+            Sigmoid (logistic) function.
+            \verbatim
+            dst[i] = 1/(1 + exp(-src[i]));
+            \endverbatim
+        */
+        SimdMathFunctionSigmoid,
+        /*!
+            Hyperbolic tangent.
+            \verbatim
+            dst[i] = tanh(src[i]);
+            \endverbatim
+        */
+        SimdMathFunctionTanh,
+        /*!
+            Gaussian error linear unit (exact form).
+            \verbatim
+            dst[i] = src[i]*(1 + erf(src[i]/sqrt(2)))/2;
+            \endverbatim
+        */
+        SimdMathFunctionGelu,
+        /*!
+            Gauss error function.
+            \verbatim
+            dst[i] = erf(src[i]);
+            \endverbatim
+        */
+        SimdMathFunctionErf,
+        /*!
+            Swish function.
+            It has one parameter: beta (params[0]).
+            \verbatim
+            dst[i] = src[i]/(1 + exp(-beta*src[i]));
+            \endverbatim
+        */
+        SimdMathFunctionSwish,
+    } SimdMathFunctionType;
 
-        \fn void SimdSegmentationShrinkRegion(const uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index, ptrdiff_t * left, ptrdiff_t * top, ptrdiff_t * right, ptrdiff_t * bottom);
+    /*! @ingroup math
+        Describes required accuracy of elementary function approximation. It is used in ::SimdMathFunction32f.
+    */
+    typedef enum
+    {
+        /*!
+            Fast approximation (relative error is about 1e-5 - 1e-6, absolute error is about 1e-5 near zeros of the function). It uses the same polynomials as ::SimdNeuralSigmoid, ::SimdNeuralTanh and ::SimdNeuralPow.
+        */
+        SimdMathAccuracyFast,
+        /*!
+            Precise approximation (relative error is about 1e-6 - 1e-7, that is comparable with standard C library).
+        */
+        SimdMathAccuracyPrecise,
+    } SimdMathAccuracyType;
 
-        \short Finds actual region of mask index location.
+    /*! @ingroup math
 
-        Mask must has 8-bit gray pixel format.
+        \fn void SimdMathFunction32f(const float * src, size_t size, SimdMathFunctionType type, const float * params, SimdMathAccuracyType accuracy, float * dst);
 
-        \note This function has a C++ wrappers: Simd::SegmentationShrinkRegion(const View<A> & mask, uint8_t index, Rectangle<ptrdiff_t> & rect).
+        \short Calculates given elementary function for 32-bit float array.
 
-        \param [in] mask - a pointer to pixels data of 8-bit gray mask image.
-        \param [in] stride - a row size of the mask image.
-        \param [in] width - an mask width.
-        \param [in] height - an mask height.
-        \param [in] index - a mask index.
-        \param [in, out] left - a pointer to left side.
-        \param [in, out] top - a pointer to top side.
-        \param [in, out] right - a pointer to right side.
-        \param [in, out] bottom - a pointer to bottom side.
+        All arrays must have the same size. Input and output arrays can be the same.
+
+        \note This function supports multithreading for large arrays (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] src - a pointer to the input array.
+        \param [in] size - a size of arrays.
+        \param [in] type - a type of elementary function (see ::SimdMathFunctionType).
+        \param [in] params - a pointer to parameters of the function (see ::SimdMathFunctionType). Can be NULL for functions without parameters.
+        \param [in] accuracy - a required accuracy of approximation (see ::SimdMathAccuracyType).
+        \param [out] dst - a pointer to the output array.
     */
-    SIMD_API void SimdSegmentationShrinkRegion(const uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index,
-        ptrdiff_t * left, ptrdiff_t * top, ptrdiff_t * right, ptrdiff_t * bottom);
+    SIMD_API void SimdMathFunction32f(const float * src, size_t size, SimdMathFunctionType type, const float * params, SimdMathAccuracyType accuracy, float * dst);
 
-    /*! @ingroup shifting
+    /*! @ingroup other_filter
 
-        \fn void SimdShiftBilinear(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, const uint8_t * bkg, size_t bkgStride, const double * shiftX, const double * shiftY, size_t cropLeft, size_t cropTop, size_t cropRight, size_t cropBottom, uint8_t * dst, size_t dstStride);
+        \fn void SimdMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
 
-        \short Performs shifting of input image with using bilinear interpolation.
+        \short Performs an averaging with window 3x3.
+
+        For every point:
+        \verbatim
+        dst[x, y] = (src[x-1, y-1] + src[x, y-1] + src[x+1, y-1] +
+                     src[x-1, y] + src[x, y] + src[x+1, y] +
+                     src[x-1, y+1] + src[x, y+1] + src[x+1, y+1] + 4) / 9;
+        \endverbatim
 
         All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
 
-        \note This function has a C++ wrappers: Simd::ShiftBilinear(const View<A> & src, const View<A> & bkg, const Point<double> & shift, const Rectangle<ptrdiff_t> & crop, View<A> & dst).
+        \note This function has a C++ wrapper Simd::MeanFilter3x3(const View<A>& src, View<A>& dst).
 
-        \param [in] src - a pointer to pixels data of the foreground input image.
-        \param [in] srcStride - a row size of the input image.
+        \param [in] src - a pointer to pixels data of source image.
+        \param [in] srcStride - a row size of the src image.
         \param [in] width - an image width.
         \param [in] height - an image height.
         \param [in] channelCount - a channel count.
-        \param [in] bkg - a pointer to pixels data of the background input image.
-        \param [in] bkgStride - a row size of the background image.
-        \param [in] shiftX - an image shift along x axis.
-        \param [in] shiftY - an image shift along y axis.
-        \param [in] cropLeft - a crop left side.
-        \param [in] cropTop - a crop top side.
-        \param [in] cropRight - a crop right side.
-        \param [in] cropBottom - a crop bottom side.
-        \param [out] dst - a pointer to pixels data of the output image.
-        \param [in] dstStride - a row size of the output image.
+        \param [out] dst - a pointer to pixels data of destination image.
+        \param [in] dstStride - a row size of the dst image.
     */
-    SIMD_API void SimdShiftBilinear(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount,
-        const uint8_t * bkg, size_t bkgStride, const double * shiftX, const double * shiftY,
-        size_t cropLeft, size_t cropTop, size_t cropRight, size_t cropBottom, uint8_t * dst, size_t dstStride);
-
-    /*! @ingroup sobel_filter
+    SIMD_API void SimdMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        size_t channelCount, uint8_t * dst, size_t dstStride);
 
-        \fn void SimdSobelDx(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+    /*! @ingroup median_filter
 
-        \short Calculates Sobel's filter along x axis.
+        \fn void SimdMedianFilterRhomb3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
 
-        All images must have the same width and height. Input image must has 8-bit gray format, output image must has 16-bit integer format.
+        \short Performs median filtration of input image (filter window is a rhomb 3x3).
 
-        For every point:
-        \n dst[x, y] = (src[x+1,y-1] + 2*src[x+1, y] + src[x+1, y+1]) - (src[x-1,y-1] + 2*src[x-1, y] + src[x-1, y+1]).
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
 
-        \note This function has a C++ wrappers: Simd::SobelDx(const View<A>& src, View<A>& dst).
+        \note This function has a C++ wrappers: Simd::MedianFilterRhomb3x3(const View<A>& src, View<A>& dst).
 
-        \param [in] src - a pointer to pixels data of the input image.
-        \param [in] srcStride - a row size of the input image.
+        \param [in] src - a pointer to pixels data of original input image.
+        \param [in] srcStride - a row size of src image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [out] dst - a pointer to pixels data of the output image.
-        \param [in] dstStride - a row size of the output image (in bytes).
+        \param [in] channelCount - a channel count.
+        \param [out] dst - a pointer to pixels data of filtered output image.
+        \param [in] dstStride - a row size of dst image.
     */
-    SIMD_API void SimdSobelDx(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
-
-    /*! @ingroup sobel_filter
+    SIMD_API void SimdMedianFilterRhomb3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        size_t channelCount, uint8_t * dst, size_t dstStride);
 
-        \fn void SimdSobelDxAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+    /*! @ingroup median_filter
 
-        \short Calculates absolute value of Sobel's filter along x axis.
+        \fn void SimdMedianFilterRhomb5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
 
-        All images must have the same width and height. Input image must has 8-bit gray format, output image must has 16-bit integer format.
+        \short Performs median filtration of input image (filter window is a rhomb 5x5).
 
-        For every point:
-        \verbatim
-        dst[x, y] = (src[x+1,y-1] + 2*src[x+1, y] + src[x+1, y+1]) - (src[x-1,y-1] + 2*src[x-1, y] + src[x-1, y+1]).
-        \endverbatim
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
 
-        \note This function has a C++ wrappers: Simd::SobelDxAbs(const View<A>& src, View<A>& dst).
+        \note This function has a C++ wrappers: Simd::MedianFilterRhomb5x5(const View<A>& src, View<A>& dst).
 
-        \param [in] src - a pointer to pixels data of the input image.
-        \param [in] srcStride - a row size of the input image.
+        \param [in] src - a pointer to pixels data of original input image.
+        \param [in] srcStride - a row size of src image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [out] dst - a pointer to pixels data of the output image.
-        \param [in] dstStride - a row size of the output image (in bytes).
+        \param [in] channelCount - a channel count.
+        \param [out] dst - a pointer to pixels data of filtered output image.
+        \param [in] dstStride - a row size of dst image.
     */
-    SIMD_API void SimdSobelDxAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
-
-    /*! @ingroup sobel_statistic
+    SIMD_API void SimdMedianFilterRhomb5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        size_t channelCount, uint8_t * dst, size_t dstStride);
 
-        \fn void SimdSobelDxAbsSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum);
+    /*! @ingroup median_filter
 
-        \short Calculates sum of absolute value of Sobel's filter along x axis.
+        \fn void SimdMedianFilterSquare3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
 
-        Input image must has 8-bit gray format.
+        \short Performs median filtration of input image (filter window is a square 3x3).
 
-        For every point:
-        \verbatim
-        dst[x, y] = abs((src[x+1,y-1] + 2*src[x+1, y] + src[x+1, y+1]) - (src[x-1,y-1] + 2*src[x-1, y] + src[x-1, y+1])).
-        \endverbatim
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
 
-        \note This function has a C++ wrappers: Simd::SobelDxAbsSum(const View<A>& src, uint64_t & sum).
+        \note This function has a C++ wrappers: Simd::MedianFilterSquare3x3(const View<A>& src, View<A>& dst).
 
-        \param [in] src - a pointer to pixels data of the input image.
-        \param [in] stride - a row size of the input image.
+        \param [in] src - a pointer to pixels data of original input image.
+        \param [in] srcStride - a row size of src image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [out] sum - a pointer to unsigned 64-bit integer value with result sum.
+        \param [in] channelCount - a channel count.
+        \param [out] dst - a pointer to pixels data of filtered output image.
+        \param [in] dstStride - a row size of dst image.
     */
-    SIMD_API void SimdSobelDxAbsSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum);
-
-    /*! @ingroup sobel_filter
+    SIMD_API void SimdMedianFilterSquare3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        size_t channelCount, uint8_t * dst, size_t dstStride);
 
-        \fn void SimdSobelDy(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+    /*! @ingroup median_filter
 
-        \short Calculates Sobel's filter along y axis.
+        \fn void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
 
-        All images must have the same width and height. Input image must has 8-bit gray format, output image must has 16-bit integer format.
+        \short Performs median filtration of input image (filter window is a square 5x5).
 
-        For every point:
-        \verbatim
-        dst[x, y] = (src[x-1,y+1] + 2*src[x, y+1] + src[x+1, y+1]) - (src[x-1,y-1] + 2*src[x, y-1] + src[x+1, y-1]);
-        \endverbatim
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
 
-        \note This function has a C++ wrappers: Simd::SobelDy(const View<A>& src, View<A>& dst).
+        \note This function has a C++ wrappers: Simd::MedianFilterSquare5x5(const View<A>& src, View<A>& dst).
 
-        \param [in] src - a pointer to pixels data of the input image.
-        \param [in] srcStride - a row size of the input image.
+        \param [in] src - a pointer to pixels data of original input image.
+        \param [in] srcStride - a row size of src image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [out] dst - a pointer to pixels data of the output image.
-        \param [in] dstStride - a row size of the output image (in bytes).
+        \param [in] channelCount - a channel count.
+        \param [out] dst - a pointer to pixels data of filtered output image.
+        \param [in] dstStride - a row size of dst image.
     */
-    SIMD_API void SimdSobelDy(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+    SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        size_t channelCount, uint8_t * dst, size_t dstStride);
 
-    /*! @ingroup sobel_filter
+    /*! @ingroup neural
 
-        \fn void SimdSobelDyAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+        \fn void SimdNeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion);
 
-        \short Calculates absolute value of Sobel's filter along y axis.
+        \short Converts a 8-bit gray image to the 32-bit float array.
 
-        All images must have the same width and height. Input image must has 8-bit gray format, output image must has 16-bit integer format.
+        The length of output array must be equal to the area of input image.
 
         For every point:
         \verbatim
-        dst[x, y] = abs((src[x-1,y+1] + 2*src[x, y+1] + src[x+1, y+1]) - (src[x-1,y-1] + 2*src[x, y-1] + src[x+1, y-1]));
+        dst[i] = inversion ? (255 - src[col]) / 255 : src[i]/255;
         \endverbatim
 
-        \note This function has a C++ wrappers: Simd::SobelDyAbs(const View<A>& src, View<A>& dst).
+        \note This function has a C++ wrapper Simd::NeuralConvert(const View<A>& src, float * dst, bool inversion).
 
-        \param [in] src - a pointer to pixels data of the input image.
-        \param [in] srcStride - a row size of the input image.
+        \param [in] src - a pointer to pixels data of input image.
+        \param [in] srcStride - a row size (in bytes) of the image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [out] dst - a pointer to pixels data of the output image.
-        \param [in] dstStride - a row size of the output image (in bytes).
+        \param [out] dst - a pointer to output array.
+        \param [in] dstStride - a row size of the output array.
+        \param [in] inversion - a flag of color inversion.
     */
-    SIMD_API void SimdSobelDyAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+    SIMD_API void SimdNeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion);
 
-    /*! @ingroup sobel_statistic
+    /*! @ingroup neural
 
-        \fn void SimdSobelDyAbsSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum);
+        \fn void SimdNeuralSigmoid(const float * src, size_t size, const float * slope, float * dst);
 
-        \short Calculates sum of absolute value of Sobel's filter along y axis.
+        \short Calculates sigmoid for 32-bit float array.
 
-        Input image must has 8-bit gray format.
+        All arrays must have the same size.
 
-        For every point:
+        For every element:
         \verbatim
-        sum += abs((src[x-1,y+1] + 2*src[x, y+1] + src[x+1, y+1]) - (src[x-1,y-1] + 2*src[x, y-1] + src[x+1, y-1]));
+        dst[i] = 1/(1 + exp(-slope*src[i]));
         \endverbatim
 
-        \note This function has a C++ wrappers: Simd::SobelDyAbsSum(const View<A>& src, uint64_t & sum).
-
-        \param [in] src - a pointer to pixels data of the input image.
-        \param [in] stride - a row size of the input image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [out] sum - a pointer to unsigned 64-bit integer value with result sum.
+        \param [in] src - a pointer to the input array.
+        \param [in] size - a size of arrays.
+        \param [in] slope - a pointer to the slope parameter.
+        \param [out] dst - a pointer to output array.
     */
-    SIMD_API void SimdSobelDyAbsSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum);
+    SIMD_API void SimdNeuralSigmoid(const float * src, size_t size, const float * slope, float * dst);
 
-    /*! @ingroup contour
+    /*! @ingroup neural
 
-        \fn void SimdContourMetrics(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+        \fn void SimdNeuralRoughSigmoid(const float * src, size_t size, const float * slope, float * dst);
 
-        \short Calculates contour metrics based on absolute value and direction of Sobel's filter along y and y axis.
+        \short Calculates rough sigmoid for 32-bit float array.
 
-        All images must have the same width and height. Input image must has 8-bit gray format, output image must has 16-bit integer format.
-        This function is used for contour extraction.
+        All arrays must have the same size.
 
-        For every point:
+        For every element:
         \verbatim
-        dy = abs((src[x-1,y+1] + 2*src[x, y+1] + src[x+1, y+1]) - (src[x-1,y-1] + 2*src[x, y-1] + src[x+1, y-1]));
-        dx = abs((src[x+1,y-1] + 2*src[x+1, y] + src[x+1, y+1]) - (src[x-1,y-1] + 2*src[x-1, y] + src[x-1, y+1]));
-        dst[x, y] = (dx + dy)*2 + (dx >= dy ? 0 : 1);
+        x = ::abs(src[i]*slope);
+        e = 1 + x + x*x*0.5417 + x*x*x*x*0.1460;
+        dst[i] = 1 / (1 + (src[i] > 0 ? 1 / e : e));
+        \endverbatim
+        It is approximate way (maximal absolute error is 0.002294 (~0.23%) ) of sigmoid function (::SimdNeuralSigmoid) calculation:
+        \verbatim
+        dst[i] = 1/(1 + exp(-slope*src[i]));
         \endverbatim
 
-        \note This function has a C++ wrappers: Simd::ContourMetrics(const View<A>& src, View<A>& dst).
+        \note This function is used in Simd::Neural::Function.
 
-        \param [in] src - a pointer to pixels data of the gray 8-bit input image.
-        \param [in] srcStride - a row size of the input image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [out] dst - a pointer to pixels data of the output 16-bit image.
-        \param [in] dstStride - a row size of the output image (in bytes).
+        \param [in] src - a pointer to the input array.
+        \param [in] size - a size of arrays.
+        \param [in] slope - a pointer to the slope parameter.
+        \param [out] dst - a pointer to output array.
     */
-    SIMD_API void SimdContourMetrics(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+    SIMD_API void SimdNeuralRoughSigmoid(const float * src, size_t size, const float * slope, float * dst);
 
-    /*! @ingroup contour
+    /*! @ingroup neural
 
-        \fn void SimdContourMetricsMasked(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * mask, size_t maskStride, uint8_t indexMin, uint8_t * dst, size_t dstStride)
+        \fn void SimdNeuralRoughSigmoid2(const float * src, size_t size, const float * slope, float * dst);
 
-        \short Calculates contour metrics based on absolute value and direction of Sobel's filter along y and y axis with using mask.
+        \short Calculates rough sigmoid for 32-bit float array.
 
-        All images must have the same width and height. Input image must has 8-bit gray format, output image must has 16-bit integer format.
-        This function is used for contour extraction.
+        All arrays must have the same size.
 
-        For every point:
+        For every element:
         \verbatim
-        dy = abs((src[x-1,y+1] + 2*src[x, y+1] + src[x+1, y+1]) - (src[x-1,y-1] + 2*src[x, y-1] + src[x+1, y-1]));
-        dx = abs((src[x+1,y-1] + 2*src[x+1, y] + src[x+1, y+1]) - (src[x-1,y-1] + 2*src[x-1, y] + src[x-1, y+1]));
-        dst[x, y] = mask[x, y] < indexMin ? 0 : (dx + dy)*2 + (dx >= dy ? 0 : 1);
+        x = -src[i]*slope;
+        e = max(1 + x/128, 0.5)^128;
+        dst[i] = 1 / (1 + e);
+        \endverbatim
+        It is approximate way (maximal absolute error is 0.001721 (~0.17%) ) of sigmoid function (::SimdNeuralSigmoid) calculation:
+        \verbatim
+        dst[i] = 1/(1 + exp(-slope*src[i]));
         \endverbatim
 
-        \note This function has a C++ wrappers: Simd::ContourMetrics(const View<A>& src, const View<A>& mask, uint8_t indexMin, View<A>& dst).
+        \note This function is used in Simd::Neural::Function.
 
-        \param [in] src - a pointer to pixels data of the gray 8-bit input image.
-        \param [in] srcStride - a row size of the input image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [in] mask - a pointer to pixels data of the mask 8-bit image.
-        \param [in] maskStride - a row size of the mask image.
-        \param [in] indexMin - a mask minimal permissible index.
-        \param [out] dst - a pointer to pixels data of the output 16-bit image.
-        \param [in] dstStride - a row size of the output image (in bytes).
+        \param [in] src - a pointer to the input array.
+        \param [in] size - a size of arrays.
+        \param [in] slope - a pointer to the slope parameter.
+        \param [out] dst - a pointer to output array.
     */
-    SIMD_API void SimdContourMetricsMasked(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-        const uint8_t * mask, size_t maskStride, uint8_t indexMin, uint8_t * dst, size_t dstStride);
+    SIMD_API void SimdNeuralRoughSigmoid2(const float * src, size_t size, const float * slope, float * dst);
 
-    /*! @ingroup contour
+    /*! @ingroup neural
 
-        \fn void SimdContourAnchors(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t step, int16_t threshold, uint8_t * dst, size_t dstStride);
+        \fn void SimdNeuralDerivativeSigmoid(const float * src, size_t size, const float * slope, float * dst);
 
-        \short Extract contour anchors from contour metrics.
+        \short Multiplies output 32-bit float array by derivative of sigmoid from input 32-bit float array.
 
-        All images must have the same width and height. Input image must has 16-bit integer format, output image must has 8-bit gray format.
-        Input image with metrics can be estimated by using ::SimdContourMetrics or ::SimdContourMetricsMasked functions.
-        This function is used for contour extraction.
+        All arrays must have the same size.
 
-        For every point (except border):
+        For every element:
         \verbatim
-        a[x, y] = src[x, y] >> 1.
-        if(src[x, y] & 1)
-            dst[x, y] = a[x, y] > 0 && (a[x, y] - a[x + 1, y] >= threshold) && (a[x, y] - a[x - 1, y] >= threshold) ? 255 : 0;
-        else
-            dst[x, y] = a[x, y] > 0 && (a[x, y] - a[x, y + 1] >= threshold) && (a[x, y] - a[x, y - 1] >= threshold) ? 255 : 0;
+        dst[i] *= slope*(1 - src[i])*src[i];
         \endverbatim
 
-        \note This function has a C++ wrappers: Simd::ContourAnchors(const View<A>& src, size_t step, int16_t threshold, View<A>& dst).
+        \note This function is used in Simd::Neural::Function.
 
-        \param [in] src - a pointer to pixels data of the 16-bit input image.
-        \param [in] srcStride - a row size of the input image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [in] step - a row step (to skip some rows).
-        \param [in] threshold - a threshold of anchor creation.
-        \param [out] dst - a pointer to pixels data of the output 8-bit gray image.
-        \param [in] dstStride - a row size of the output image (in bytes).
+        \param [in] src - a pointer to the input array.
+        \param [in] size - a size of arrays.
+        \param [in] slope - a pointer to the slope parameter.
+        \param [in, out] dst - a pointer to output array.
     */
-    SIMD_API void SimdContourAnchors(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t step, int16_t threshold, uint8_t * dst, size_t dstStride);
+    SIMD_API void SimdNeuralDerivativeSigmoid(const float * src, size_t size, const float * slope, float * dst);
 
-    /*! @ingroup correlation
+    /*! @ingroup neural
 
-        \fn void SimdSquaredDifferenceSum(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, uint64_t * sum);
+        \fn void SimdNeuralTanh(const float * src, size_t size, const float * slope, float * dst);
 
-        \short Calculates sum of squared differences for two 8-bit gray images.
+        \short Calculates hyperbolic tangent for 32-bit float array.
 
-        All images must have the same width and height.
+        All arrays must have the same size.
 
-        For every point:
+        For every element:
         \verbatim
-        sum += (a[i] - b[i])*(a[i] - b[i]);
+        x = slope*src[i];
+        dst[i] = (exp(x) - exp(-x))/(exp(x) + exp(-x));
         \endverbatim
 
-        \note This function has a C++ wrappers: Simd::SquaredDifferenceSum(const View<A>& a, const View<A>& b, uint64_t & sum).
-
-        \param [in] a - a pointer to pixels data of the first image.
-        \param [in] aStride - a row size of the first image.
-        \param [in] b - a pointer to pixels data of the second image.
-        \param [in] bStride - a row size of the second image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [out] sum - a pointer to unsigned 64-bit integer value with result sum.
+        \param [in] src - a pointer to the input array.
+        \param [in] size - a size of arrays.
+        \param [in] slope - a pointer to the slope parameter.
+        \param [out] dst - a pointer to output array.
     */
-    SIMD_API void SimdSquaredDifferenceSum(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
-        size_t width, size_t height, uint64_t * sum);
+    SIMD_API void SimdNeuralTanh(const float * src, size_t size, const float * slope, float * dst);
 
-    /*! @ingroup correlation
+    /*! @ingroup neural
 
-        \fn void SimdSquaredDifferenceSumMasked(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, const uint8_t * mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sum);
+        \fn void SimdNeuralRoughTanh(const float * src, size_t size, const float * slope, float * dst);
 
-        \short Calculates sum of squared differences for two images with using mask.
+        \short Calculates rough hyperbolic tangent for 32-bit float array.
 
-        All images must have the same width, height and format (8-bit gray).
+        All arrays must have the same size.
 
-        For every point:
+        For every element:
         \verbatim
-        if(mask[i] == index)
-            sum += (a[i] - b[i])*(a[i] - b[i]);
+        x = ::abs(src[i]*slope);
+        e = 1 + x + x*x*0.5658 + x*x*x*x*0.1430;
+        dst[i] = (src[i] > 0 ? 1 : -1)*(e - 1/e)/(e + 1/e);
+        \endverbatim
+        It is approximate way (maximal absolute error is 0.001514 (~0.15%) ) of hyperbolic tangent (::SimdNeuralTanh)  function calculation:
+        \verbatim
+        x = slope*src[i];
+        dst[i] = (exp(x) - exp(-x))/(exp(x) + exp(-x));
         \endverbatim
 
-        \note This function has a C++ wrappers: Simd::SquaredDifferenceSum(const View<A>& a, const View<A>& b, const View<A>& mask, uint8_t index, uint64_t & sum).
+        \note This function is used in Simd::Neural::Function.
 
-        \param [in] a - a pointer to pixels data of the first image.
-        \param [in] aStride - a row size of the first image.
-        \param [in] b - a pointer to pixels data of the second image.
-        \param [in] bStride - a row size of the second image.
-        \param [in] mask - a pointer to pixels data of the mask image.
-        \param [in] maskStride - a row size of the mask image.
-        \param [in] index - a mask index.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [out] sum - a pointer to unsigned 64-bit integer value with result sum.
+        \param [in] src - a pointer to the input array.
+        \param [in] size - a size of arrays.
+        \param [in] slope - a pointer to the slope parameter.
+        \param [out] dst - a pointer to output array.
     */
-    SIMD_API void SimdSquaredDifferenceSumMasked(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
-        const uint8_t * mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sum);
+    SIMD_API void SimdNeuralRoughTanh(const float * src, size_t size, const float * slope, float * dst);
 
-    /*! @ingroup correlation
+    /*! @ingroup neural
 
-        \fn void SimdSquaredDifferenceSum32f(const float * a, const float * b, size_t size, float * sum);
+    \fn void SimdNeuralDerivativeTanh(const float * src, size_t size, const float * slope, float * dst);
 
-        \short Calculates sum of squared differences for two 32-bit float arrays.
+        \short Multiplies output 32-bit float array by derivative of hyperbolic tangent from input 32-bit float array.
 
         All arrays must have the same size.
 
         For every element:
         \verbatim
-        sum += (a[i] - b[i])*(a[i] - b[i]);
+        dst[i] *= slope*(1 - src[i]*src[i]);
         \endverbatim
 
-        \param [in] a - a pointer to the first array.
-        \param [in] b - a pointer to the second array.
+        \note This function is used in Simd::Neural::Function.
+
+        \param [in] src - a pointer to the input array.
         \param [in] size - a size of arrays.
-        \param [out] sum - a sum of squared differences.
+        \param [in] slope - a pointer to the slope parameter.
+        \param [in, out] dst - a pointer to output array.
     */
-    SIMD_API void SimdSquaredDifferenceSum32f(const float * a, const float * b, size_t size, float * sum);
+    SIMD_API void SimdNeuralDerivativeTanh(const float * src, size_t size, const float * slope, float * dst);
 
-    /*! @ingroup correlation
+    /*! @ingroup neural
 
-        \fn void SimdSquaredDifferenceKahanSum32f(const float * a, const float * b, size_t size, float * sum);
+        \fn void SimdNeuralRelu(const float * src, size_t size, const float * slope, float * dst);
 
-        \short Calculates sum of squared differences for two 32-bit float arrays with using Kahan summation algorithm.
+        \short Calculates Relu (rectified linear unit) function for 32-bit float array.
 
         All arrays must have the same size.
 
-        Algorithm pseudo code:
+        For every element:
         \verbatim
-        sum = 0; corr = 0;
-        for(i = 0; i < size; ++i)
-        {
-            diff = (a[i] - b[i])*(a[i] - b[i]) - corr;
-            temp = sum + diff;
-            corr = (temp - sum) - diff;
-            sum = temp;
-        }
+        dst[i] =  src[i] > 0 ? src[i] : slope*src[i];
         \endverbatim
 
-        \param [in] a - a pointer to the first array.
-        \param [in] b - a pointer to the second array.
+        \note This function is used in Simd::Neural::Function.
+
+        \param [in] src - a pointer to the input array.
         \param [in] size - a size of arrays.
-        \param [out] sum - a sum of squared differences.
+        \param [in] slope - a pointer to the slope parameter.
+        \param [out] dst - a pointer to output array.
     */
-    SIMD_API void SimdSquaredDifferenceKahanSum32f(const float * a, const float * b, size_t size, float * sum);
+    SIMD_API void SimdNeuralRelu(const float * src, size_t size, const float * slope, float * dst);
 
-    /*! @ingroup other_statistic
+    /*! @ingroup neural
 
-        \fn void SimdGetStatistic(const uint8_t * src, size_t stride, size_t width, size_t height, uint8_t * min, uint8_t * max, uint8_t * average);
+        \fn void SimdNeuralDerivativeRelu(const float * src, size_t size, const float * slope, float * dst);
 
-        \short Finds minimal, maximal and average pixel values for given image.
+        \short Multiplies output 32-bit float array by derivative of Relu (rectified linear unit) from input 32-bit float array.
 
-        The image must has 8-bit gray format.
+        All arrays must have the same size.
 
-        \note This function has a C++ wrappers: Simd::GetStatistic(const View<A>& src, uint8_t & min, uint8_t & max, uint8_t & average).
+        For every element:
+        \verbatim
+        dst[i] *=  src[i] > 0 ? 1 : slope;
+        \endverbatim
 
-        \param [in] src - a pointer to pixels data of the input image.
-        \param [in] stride - a row size of the image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [out] min - a pointer to unsigned 8-bit integer value with found minimal pixel value.
-        \param [out] max - a pointer to unsigned 8-bit integer value with found maximal pixel value.
-        \param [out] average - a pointer to unsigned 8-bit integer value with found average pixel value.
+        \note This function is used in Simd::Neural::Function.
+
+        \param [in] src - a pointer to the input array.
+        \param [in] size - a size of arrays.
+        \param [in] slope - a pointer to the slope parameter.
+        \param [in, out] dst - a pointer to output array.
     */
-    SIMD_API void SimdGetStatistic(const uint8_t * src, size_t stride, size_t width, size_t height,
-        uint8_t * min, uint8_t * max, uint8_t * average);
+    SIMD_API void SimdNeuralDerivativeRelu(const float * src, size_t size, const float * slope, float * dst);
 
-    /*! @ingroup other_statistic
+    /*! @ingroup neural
 
-        \fn void SimdGetMoments(const uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index, uint64_t * area, uint64_t * x, uint64_t * y, uint64_t * xx, uint64_t * xy, uint64_t * yy);
+        \fn void SimdNeuralPow(const float * src, size_t size, const float * exponent, float * dst);
 
-        \short Calculate statistical characteristics (moments) of pixels with given index.
+        \short Calculates Pow function for 32-bit float array.
 
-        The image must has 8-bit gray format.
+        All arrays must have the same size.
 
-        For every point:
+        For every element:
         \verbatim
-        if(mask[X, Y] == index)
-        {
-            area += 1.
-            x += X.
-            y += Y.
-            xx += X*X.
-            xy += X*Y.
-            yy += Y*Y.
-        }
+        dst[i] =  Pow(src[i], exponent[0]);
         \endverbatim
 
-        \note This function has a C++ wrappers: Simd::GetMoments(const View<A>& mask, uint8_t index, uint64_t & area, uint64_t & x, uint64_t & y, uint64_t & xx, uint64_t & xy, uint64_t & yy).
+        \note This function is used in Simd::Neural::Function.
 
-        \param [in] mask - a pointer to pixels data of the mask image.
-        \param [in] stride - a row size of the mask image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [in] index - a mask index.
-        \param [out] area - a pointer to unsigned 64-bit integer value with found area (number of pixels with given index).
-        \param [out] x - a pointer to unsigned 64-bit integer value with found first-order moment x.
-        \param [out] y - a pointer to unsigned 64-bit integer value with found first-order moment y.
-        \param [out] xx - a pointer to unsigned 64-bit integer value with found second-order moment xx.
-        \param [out] xy - a pointer to unsigned 64-bit integer value with found second-order moment xy.
-        \param [out] yy - a pointer to unsigned 64-bit integer value with found second-order moment yy.
+        \param [in] src - a pointer to the input array.
+        \param [in] size - a size of arrays.
+        \param [in] exponent - a pointer to exponent parameter.
+        \param [out] dst - a pointer to output array.
     */
-    SIMD_API void SimdGetMoments(const uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index,
-        uint64_t * area, uint64_t * x, uint64_t * y, uint64_t * xx, uint64_t * xy, uint64_t * yy);
+    SIMD_API void SimdNeuralPow(const float * src, size_t size, const float * exponent, float * dst);
 
-    /*! @ingroup row_statistic
+    /*! @ingroup neural
 
-        \fn void SimdGetRowSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums);
+        \fn void SimdNeuralProductSum(const float * a, const float * b, size_t size, float * sum);
 
-        \short Calculate sums of rows for given 8-bit gray image.
+        \short Calculates sum of products for two 32-bit float arrays.
 
-        For all rows:
+        All arrays must have the same size.
+
+        For every element:
         \verbatim
-        for(x = 0; x < width; ++x)
-            sums[y] += src[x, y];
+        sum += a[i]*b[i];
         \endverbatim
 
-        \note This function has a C++ wrappers: Simd::GetRowSums(const View<A>& src, uint32_t * sums).
+        \note This function is used in Simd::Neural.
 
-        \param [in] src - a pointer to pixels data of the input image.
-        \param [in] stride - a row size of the input image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [out] sums - a pointer to array of unsigned 32-bit integers result sums of rows. It length must be equal to image height.
+        \param [in] a - a pointer to the first 32-bit float array.
+        \param [in] b - a pointer to the second 32-bit float array.
+        \param [in] size - a size of arrays.
+        \param [out] sum - a pointer to 32-bit float sum of products.
     */
-    SIMD_API void SimdGetRowSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums);
+    SIMD_API void SimdNeuralProductSum(const float * a, const float * b, size_t size, float * sum);
 
-    /*! @ingroup col_statistic
+    /*! @ingroup neural
 
-        \fn void SimdGetColSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums);
+        \fn void SimdNeuralAddVectorMultipliedByValue(const float * src, size_t size, const float * value, float * dst);
 
-        \short Calculate sums of columns for given 8-bit gray image.
+        \short Adds the product of a vector and a scalar to given vector.
 
-        For all columns:
+        All arrays must have the same size.
+
+        For every element:
         \verbatim
-        for(y = 0; y < height; ++y)
-            sums[x] += src[x, y];
+        dst[i] += src[i]*value[0];
         \endverbatim
 
-        \note This function has a C++ wrappers: Simd::GetColSums(const View<A>& src, uint32_t * sums).
+        \note This function is used in Simd::Neural.
 
-        \param [in] src - a pointer to pixels data of the input image.
-        \param [in] stride - a row size of the input image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [out] sums - a pointer to array of unsigned 32-bit integers result sums of columns. It length must be equal to image width.
+        \param [in] src - a pointer to the input 32-bit float array.
+        \param [in] size - a size of arrays.
+        \param [in] value - a pointer to the scalar 32-bit float value.
+        \param [in, out] dst - a pointer to cumulative 32-bit float array.
     */
-    SIMD_API void SimdGetColSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums);
+    SIMD_API void SimdNeuralAddVectorMultipliedByValue(const float * src, size_t size, const float * value, float * dst);
 
-    /*! @ingroup row_statistic
+    /*! @ingroup neural
 
-        \fn void SimdGetAbsDyRowSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums);
+        \fn void SimdNeuralAddVector(const float * src, size_t size, float * dst);
 
-        \short Calculate sums of absolute derivate along y axis for rows for given 8-bit gray image.
+        \short Adds a vector to given vector.
 
-        For all rows except the last:
-        \verbatim
-        for(x = 0; x < width; ++x)
-            sums[y] += abs(src[x, y+1] - src[x, y]);
-        \endverbatim
-        For the last row:
+        All arrays must have the same size.
+
+        For every element:
         \verbatim
-        sums[height-1] = 0;
+        dst[i] += src[i];
         \endverbatim
 
-        \note This function has a C++ wrappers: Simd::GetAbsDyRowSums(const View<A>& src, uint32_t * sums).
+        \note This function is used in Simd::Neural.
 
-        \param [in] src - a pointer to pixels data of the input image.
-        \param [in] stride - a row size of the input image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [out] sums - a pointer to array of unsigned 32-bit integers result sums. It length must be equal to image height.
+        \param [in] src - a pointer to the input 32-bit float array.
+        \param [in] size - a size of the arrays.
+        \param [in, out] dst - a pointer to cumulative 32-bit float array.
     */
-    SIMD_API void SimdGetAbsDyRowSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums);
+    SIMD_API void SimdNeuralAddVector(const float * src, size_t size, float * dst);
 
-    /*! @ingroup col_statistic
+    /*! @ingroup neural
 
-        \fn void SimdGetAbsDxColSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums);
+        \fn void SimdNeuralAddValue(const float * value, float * dst, size_t size);
 
-        \short Calculate sums of absolute derivate along x axis for columns for given 8-bit gray image.
+        \short Adds a value to each elements of given vector.
 
-        For all columns except the last:
-        \verbatim
-        for(y = 0; y < height; ++y)
-            sums[y] += abs(src[x+1, y] - src[x, y]);
-        \endverbatim
-        For the last column:
+        For every element:
         \verbatim
-        sums[width-1] = 0;
+        dst[i] += value;
         \endverbatim
 
-        \note This function has a C++ wrappers: Simd::GetAbsDxColSums(const View<A>& src, uint32_t * sums).
+        \note This function is used in Simd::Neural.
 
-        \param [in] src - a pointer to pixels data of the input image.
-        \param [in] stride - a row size of the input image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [out] sums - a pointer to array of unsigned 32-bit integers result columns. It length must be equal to image width.
+        \param [in] value - a pointer to the scalar 32-bit float value.
+        \param [in, out] dst - a pointer to cumulative 32-bit float array.
+        \param [in] size - a size of the array.
     */
-    SIMD_API void SimdGetAbsDxColSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums);
+    SIMD_API void SimdNeuralAddValue(const float * value, float * dst, size_t size);
 
-    /*! @ingroup other_statistic
+    /*! @ingroup neural
 
-        \fn void SimdValueSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum);
+        \fn void SimdNeuralUpdateWeights(const float * x, size_t size, const float * a, const float * b, float * d, float * w);
 
-        \short Gets sum of value of pixels for gray 8-bit image.
+        \short Updates ANN weights.
 
-        \note This function has a C++ wrappers: Simd::ValueSum(const View<A>& src, uint64_t & sum).
+        All arrays must have the same size.
 
-        \param [in] src - a pointer to pixels data of the image.
-        \param [in] stride - a row size of the image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [out] sum - the result sum.
+        The algorithm performs:
+        \verbatim
+        for (size_t k = 0; k < size; ++k)
+        {
+            d[k] = a[0]*d[k] + b[0]*x[k];
+            w[k] += d[k];
+        }
+        \endverbatim
+
+        \param [in] x - a pointer to the X array.
+        \param [in] size - a size of arrays.
+        \param [in] a - a pointer to the first parameter.
+        \param [in] b - a pointer to the second parameter.
+        \param [in, out] d - a pointer to the D array.
+        \param [in, out] w - a pointer to the W array.
     */
-    SIMD_API void SimdValueSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum);
+    SIMD_API void SimdNeuralUpdateWeights(const float * x, size_t size, const float * a, const float * b, float * d, float * w);
 
-    /*! @ingroup other_statistic
+    /*! @ingroup neural
 
-        \fn void SimdSquareSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum);
+        \fn void SimdNeuralAdaptiveGradientUpdate(const float * delta, size_t size, size_t batch, const float * alpha, const float * epsilon, float * gradient, float * weight);
 
-        \short Gets sum of squared value of pixels for gray 8-bit image .
+        \short Updates neural network weights with using of adaptive gradients method.
 
-        \note This function has a C++ wrappers: Simd::SquareSum(const View<A>& src, uint64_t & sum).
+        Adaptive gradients method.
+        J Duchi, E Hazan and Y Singer,
+        "Adaptive subgradient methods for online learning and stochastic optimization"
+        The Journal of Machine Learning Research, pages 2121-2159, 2011.
 
-        \param [in] src - a pointer to pixels data of the image.
-        \param [in] stride - a row size of the image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [out] sum - the result sum.
-    */
-	
-    SIMD_API void SimdSquareSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum);
-	
-	    /*! @ingroup other_statistic
+        The algorithm performs:
+        \verbatim
+        for (i = 0; i < size; ++i)
+        {
+            d = delta[i]/batch;
+            gradient[i] += d*d;
+            weight[i] -= alpha * d / sqrt(gradient[i] + epsilon);
+        }
+        \endverbatim
 
-        \fn void SimdValueSquareSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * valueSum, uint64_t * squareSum);
+        \note All arrays must have the same size. This function is used in Simd::Neural.
 
-        \short Gets sum and squared sum of value of pixels for gray 8-bit image.
+        \param [in] delta - a pointer to the array with error (delta).
+        \param [in] size - a size of arrays.
+        \param [in] batch - a batch size.
+        \param [in] alpha - a pointer to alpha parameter (update speed).
+        \param [in] epsilon - a pointer to epsilon parameter (a small number used to avoid division by zero).
+        \param [in, out] gradient - a pointer to the array with gradients.
+        \param [in, out] weight - a pointer to the array with weights.
+    */
+    SIMD_API void SimdNeuralAdaptiveGradientUpdate(const float * delta, size_t size, size_t batch, const float * alpha, const float * epsilon, float * gradient, float * weight);
 
-        \note This function has a C++ wrappers: Simd::ValueSquareSum(const View<A>& src, uint64_t & valueSum, uint64_t & squareSum).
+    /*! @ingroup neural
+
+        \fn void SimdNeuralAddConvolution2x2Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+
+        \short Adds 2x2 convolution of 32-bit float image.
+
+        \note This function is used in Simd::Neural.
+
+        \param [in] src - a pointer to the input 32-bit float image.
+        \param [in] srcStride - a row size of the input image (in 32-float values).
+        \param [in] width - a width of the output image (input image width must be equal to output image width + 1).
+        \param [in] height - a height of the output image (input image height must be equal to output image height + 1).
+        \param [in] weights - a pointer to the array with weights (its size must be at least 4).
+        \param [in, out] dst - a pointer to the output 32-bit float image.
+        \param [in] dstStride - a row size of the output image (in 32-float values).
+    */
+    SIMD_API void SimdNeuralAddConvolution2x2Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+
+    /*! @ingroup neural
+
+        \fn void SimdNeuralAddConvolution3x3Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+
+        \short Adds 3x3 convolution of 32-bit float image.
+
+        \note This function is used in Simd::Neural.
+
+        \param [in] src - a pointer to the input 32-bit float image.
+        \param [in] srcStride - a row size of the input image (in 32-float values).
+        \param [in] width - a width of the output image (input image width must be equal to output image width + 2).
+        \param [in] height - a height of the output image (input image height must be equal to output image height + 2).
+        \param [in] weights - a pointer to the array with weights (its size must be at least 9).
+        \param [in, out] dst - a pointer to the output 32-bit float image.
+        \param [in] dstStride - a row size of the output image (in 32-float values).
+    */
+    SIMD_API void SimdNeuralAddConvolution3x3Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+
+    /*! @ingroup neural
+
+        \fn void SimdNeuralAddConvolution4x4Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+
+        \short Adds 4x4 convolution of 32-bit float image.
+
+        \note This function is used in Simd::Neural.
+
+        \param [in] src - a pointer to the input 32-bit float image.
+        \param [in] srcStride - a row size of the input image (in 32-float values).
+        \param [in] width - a width of the output image (input image width must be equal to output image width + 3).
+        \param [in] height - a height of the output image (input image height must be equal to output image height + 3).
+        \param [in] weights - a pointer to the array with weights (its size must be at least 16).
+        \param [in, out] dst - a pointer to the output 32-bit float image.
+        \param [in] dstStride - a row size of the output image (in 32-float values).
+    */
+    SIMD_API void SimdNeuralAddConvolution4x4Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+
+
+    /*! @ingroup neural
+
+        \fn void SimdNeuralAddConvolution5x5Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+
+        \short Adds 5x5 convolution of 32-bit float image (forward propagation).
+
+        \note This function is used in Simd::Neural.
+
+        \param [in] src - a pointer to the input 32-bit float image.
+        \param [in] srcStride - a row size of the input image (in 32-float values).
+        \param [in] width - a width of the output image (input image width must be equal to output image width + 4).
+        \param [in] height - a height of the output image (input image height must be equal to output image height + 4).
+        \param [in] weights - a pointer to the array with weights (its size must be at least 25).
+        \param [in, out] dst - a pointer to the output 32-bit float image.
+        \param [in] dstStride - a row size of the output image (in 32-float values).
+    */
+    SIMD_API void SimdNeuralAddConvolution5x5Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+
+    /*! @ingroup neural
+
+        \fn void SimdNeuralAddConvolution2x2Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+
+        \short Adds 2x2 convolution of 32-bit float image (backward propagation).
+
+        \note This function is used in Simd::Neural.
+
+        \param [in] src - a pointer to the input 32-bit float image.
+        \param [in] srcStride - a row size of the input image (in 32-float values).
+        \param [in] width - a width of the input image (output image width must be equal to input image width + 1).
+        \param [in] height - a height of the input image (output image height must be equal to input image height + 1).
+        \param [in] weights - a pointer to the array with weights (its size must be at least 4).
+        \param [in, out] dst - a pointer to the output 32-bit float image.
+        \param [in] dstStride - a row size of the output image (in 32-float values).
+    */
+    SIMD_API void SimdNeuralAddConvolution2x2Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+
+    /*! @ingroup neural
+
+        \fn void SimdNeuralAddConvolution3x3Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+
+        \short Adds 3x3 convolution of 32-bit float image (backward propagation).
+
+        \note This function is used in Simd::Neural.
+
+        \param [in] src - a pointer to the input 32-bit float image.
+        \param [in] srcStride - a row size of the input image (in 32-float values).
+        \param [in] width - a width of the input image (output image width must be equal to input image width + 2).
+        \param [in] height - a height of the input image (output image height must be equal to input image height + 2).
+        \param [in] weights - a pointer to the array with weights (its size must be at least 9).
+        \param [in, out] dst - a pointer to the output 32-bit float image.
+        \param [in] dstStride - a row size of the output image (in 32-float values).
+    */
+    SIMD_API void SimdNeuralAddConvolution3x3Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+
+    /*! @ingroup neural
+
+        \fn void SimdNeuralAddConvolution4x4Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+
+        \short Adds 4x4 convolution of 32-bit float image (backward propagation).
+
+        \note This function is used in Simd::Neural.
+
+        \param [in] src - a pointer to the input 32-bit float image.
+        \param [in] srcStride - a row size of the input image (in 32-float values).
+        \param [in] width - a width of the input image (output image width must be equal to input image width + 3).
+        \param [in] height - a height of the input image (output image height must be equal to input image height + 3).
+        \param [in] weights - a pointer to the array with weights (its size must be at least 16).
+        \param [in, out] dst - a pointer to the output 32-bit float image.
+        \param [in] dstStride - a row size of the output image (in 32-float values).
+    */
+    SIMD_API void SimdNeuralAddConvolution4x4Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+
+    /*! @ingroup neural
+
+        \fn void SimdNeuralAddConvolution5x5Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+
+        \short Adds 5x5 convolution of 32-bit float image (backward propagation).
+
+         \note This function is used in Simd::Neural.
+
+        \param [in] src - a pointer to the input 32-bit float image.
+        \param [in] srcStride - a row size of the input image (in 32-float values).
+        \param [in] width - a width of the input image (output image width must be equal to input image width + 4).
+        \param [in] height - a height of the input image (output image height must be equal to input image height + 4).
+        \param [in] weights - a pointer to the array with weights (its size must be at least 25).
+        \param [in, out] dst - a pointer to the output 32-bit float image.
+        \param [in] dstStride - a row size of the output image (in 32-float values).
+    */
+    SIMD_API void SimdNeuralAddConvolution5x5Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+
+    /*! @ingroup neural
+
+        \fn void SimdNeuralAddConvolution2x2Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums);
+
+        \short Accumulates changes of weights for 2x2 convolution of 32-bit float image during backward propagation.
+
+        \note This function is used in Simd::Neural.
+
+        \param [in] src - a pointer to the input 32-bit float image.
+        \param [in] srcStride - a row size of the input image (in 32-float values).
+        \param [in] dst - a pointer to the output 32-bit float image.
+        \param [in] dstStride - a row size of the output image (in 32-float values).
+        \param [in] width - a width of the output image (input image width must be equal to output image width + 1).
+        \param [in] height - a height of the output image (input image height must be equal to output image height + 1).
+        \param [in, out] sums - a pointer to the array with changes of weights (its size must be at least 4).
+    */
+    SIMD_API void SimdNeuralAddConvolution2x2Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums);
+
+    /*! @ingroup neural
+
+        \fn void SimdNeuralAddConvolution3x3Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums);
+
+        \short Accumulates changes of weights for 3x3 convolution of 32-bit float image during backward propagation.
+
+        \note This function is used in Simd::Neural.
+
+        \param [in] src - a pointer to the input 32-bit float image.
+        \param [in] srcStride - a row size of the input image (in 32-float values).
+        \param [in] dst - a pointer to the output 32-bit float image.
+        \param [in] dstStride - a row size of the output image (in 32-float values).
+        \param [in] width - a width of the output image (input image width must be equal to output image width + 2).
+        \param [in] height - a height of the output image (input image height must be equal to output image height + 2).
+        \param [in, out] sums - a pointer to the array with changes of weights (its size must be at least 9).
+    */
+    SIMD_API void SimdNeuralAddConvolution3x3Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums);
+
+    /*! @ingroup neural
+
+        \fn void SimdNeuralAddConvolution4x4Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums);
+
+        \short Accumulates changes of weights for 4x4 convolution of 32-bit float image during backward propagation.
+
+        \note This function is used in Simd::Neural.
+
+        \param [in] src - a pointer to the input 32-bit float image.
+        \param [in] srcStride - a row size of the input image (in 32-float values).
+        \param [in] dst - a pointer to the output 32-bit float image.
+        \param [in] dstStride - a row size of the output image (in 32-float values).
+        \param [in] width - a width of the output image (input image width must be equal to output image width + 3).
+        \param [in] height - a height of the output image (input image height must be equal to output image height + 3).
+        \param [in, out] sums - a pointer to the array with changes of weights (its size must be at least 16).
+    */
+    SIMD_API void SimdNeuralAddConvolution4x4Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums);
+
+    /*! @ingroup neural
+
+        \fn void SimdNeuralAddConvolution5x5Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums);
+
+        \short Accumulates changes of weights for 5x5 convolution of 32-bit float image during backward propagation.
+
+        \note This function is used in Simd::Neural.
+
+        \param [in] src - a pointer to the input 32-bit float image.
+        \param [in] srcStride - a row size of the input image (in 32-float values).
+        \param [in] dst - a pointer to the output 32-bit float image.
+        \param [in] dstStride - a row size of the output image (in 32-float values).
+        \param [in] width - a width of the output image (input image width must be equal to output image width + 4).
+        \param [in] height - a height of the output image (input image height must be equal to output image height + 4).
+        \param [in, out] sums - a pointer to the array with changes of weights (its size must be at least 25).
+    */
+    SIMD_API void SimdNeuralAddConvolution5x5Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums);
+
+    /*! @ingroup neural
+
+        \fn void SimdNeuralPooling1x1Max3x3(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride);
+
+        \short Takes maximum value in 3x3 window of input 32-bit float image and copies to the output image.
+
+        \note This function is used in Simd::Neural. Output image must have the same size.
+
+        \param [in] src - a pointer to the input 32-bit float image.
+        \param [in] srcStride - a row size of the input image (in 32-float values).
+        \param [in] width - a width of the input image.
+        \param [in] height - a height of the input image.
+        \param [in, out] dst - a pointer to the output 32-bit float image.
+        \param [in] dstStride - a row size of the output image (in 32-float values).
+    */
+    SIMD_API void SimdNeuralPooling1x1Max3x3(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride);
+
+    /*! @ingroup neural
+
+        \fn void SimdNeuralPooling2x2Max2x2(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride);
+
+        \short Reduces input 32-bit float image in two times (takes maximum value in 2x2 window and copies to the output image).
+
+        \note This function is used in Simd::Neural.
+
+        \param [in] src - a pointer to the input 32-bit float image.
+        \param [in] srcStride - a row size of the input image (in 32-float values).
+        \param [in] width - a width of the input image (output image width must have size (width + 1)/2).
+        \param [in] height - a height of the input image (output image height must have size (height + 1)/2).
+        \param [in, out] dst - a pointer to the output 32-bit float image.
+        \param [in] dstStride - a row size of the output image (in 32-float values).
+    */
+    SIMD_API void SimdNeuralPooling2x2Max2x2(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride);
+
+    /*! @ingroup neural
+
+        \fn void SimdNeuralPooling2x2Max3x3(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride);
+
+        \short Reduces input 32-bit float image in two times (takes maximum value in 3x3 window and copies to the output image).
+
+        \note This function is used in Simd::Neural.
+
+        \param [in] src - a pointer to the input 32-bit float image.
+        \param [in] srcStride - a row size of the input image (in 32-float values).
+        \param [in] width - a width of the input image (output image width must have size width/2).
+        \param [in] height - a height of the input image (output image height must have size height/2).
+        \param [in, out] dst - a pointer to the output 32-bit float image.
+        \param [in] dstStride - a row size of the output image (in 32-float values).
+    */
+    SIMD_API void SimdNeuralPooling2x2Max3x3(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride);
+
+    /*! @ingroup neural
+
+        \fn void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, size_t srcHeight, size_t srcDepth, const float * weight, size_t kernelX, size_t kernelY, size_t padX, size_t padY, size_t strideX, size_t strideY, size_t dilationX, size_t dilationY, void * buffer, size_t * size, float * dst, size_t dstWidth, size_t dstHeight, size_t dstDepth, int add);
+
+        \short Adds convolution of the input multichannel 32-bit float image to the output multichannel 32-bit float image.
+
+        \note There is a restriction to the size of output image:
+        \verbatim
+        dstWidth = (srcWidth + 2 * padX - (dilationX * (kernelX - 1) + 1)) / strideX + 1.
+        dstHeight = (srcHeight + 2 * padY - (dilationY * (kernelY - 1) + 1)) / strideY + 1.
+        \endverbatim
+
+        \param [in] src - a pointer to the input multichannel 32-bit float image. Total size of the input image is equal to srcWidth*srcHeight*srcDepth.
+        \param [in] srcWidth - a width of the input image.
+        \param [in] srcHeight - a height of the input image.
+        \param [in] srcDepth - a number of channels in the input image.
+        \param [in] weight - a pointer to the convolution weights. Total size of the weights is equal to `kernelX*kernelY*srcDepth*dstDepth`.
+        \param [in] kernelX - a width of the convolution kernel.
+        \param [in] kernelY - a height of the convolution kernel.
+        \param [in] padX - a pad to the x-coordinate of the input image.
+        \param [in] padY - a pad to the y-coordinate of the input image.
+        \param [in] strideX - a x-stride of the convolution.
+        \param [in] strideY - a y-stride of the convolution.
+        \param [in] dilationX - a x-stride of the convolution.
+        \param [in] dilationY - a y-stride of the convolution.
+        \param [in, out] buffer - a pointer to the external temporal buffer used by the algorithm. Can be NULL (the algorithm uses internal buffer).
+        \param [in, out] size - a pointer to the size of the external temporal buffer. If the size is too small it will contain required value. Required size is approximately equal to `dstWidth*dstHeight*srcDepth*kernelX*kernelY*sizeof(float)`. Can be NULL.
+        \param [in, out] dst - a pointer to the output multichannel 32-bit float image. Total size of the output image is equal to `dstWidth*dstHeight*dstDepth`.
+        \param [in] dstWidth - a width of the output image.
+        \param [in] dstHeight - a height of the output image.
+        \param [in] dstDepth - a number of channels in the output image.
+        \param [in] add - a flag which signalizes that we want add or assign value of convolution to the output image.
+    */
+    SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, size_t srcHeight, size_t srcDepth, const float * weight, size_t kernelX, size_t kernelY, size_t padX, size_t padY, size_t strideX, size_t strideY, size_t dilationX, size_t dilationY, void * buffer, size_t * size, float * dst, size_t dstWidth, size_t dstHeight, size_t dstDepth, int add);
+
+    /*! @ingroup operation
+
+        \fn void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type);
+
+        \short Performs given operation between two images.
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV (UV plane of NV12 pixel format), 24-bit BGR or 32-bit BGRA).
+
+        \note This function has a C++ wrappers: Simd::OperationBinary8u(const View<A>& a, const View<A>& b, View<A>& dst, SimdOperationBinary8uType type).
+
+        \param [in] a - a pointer to pixels data of the first input image.
+        \param [in] aStride - a row size of the first image.
+        \param [in] b - a pointer to pixels data of the second input image.
+        \param [in] bStride - a row size of the second image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] channelCount - a channel count.
+        \param [out] dst - a pointer to pixels data of output image.
+        \param [in] dstStride - a row size of dst image.
+        \param [in] type - a type of operation (see ::SimdOperationBinary8uType).
+    */
+    SIMD_API void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
+        size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type);
+
+    /*! @ingroup operation
+
+        \fn void SimdOperationBinary16i(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, uint8_t * dst, size_t dstStride, SimdOperationBinary16iType type);
+
+        \short Performs given operation between two images.
+
+        All images must have the same width, height and ::SimdPixelFormatInt16 pixel format.
+
+        \note This function has a C++ wrappers: Simd::OperationBinary16i(const View<A>& a, const View<A>& b, View<A>& dst, SimdOperationBinary16iType type).
+
+        \param [in] a - a pointer to pixels data of the first input image.
+        \param [in] aStride - a row size of the first image.
+        \param [in] b - a pointer to pixels data of the second input image.
+        \param [in] bStride - a row size of the second image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] dst - a pointer to pixels data of output image.
+        \param [in] dstStride - a row size of dst image.
+        \param [in] type - a type of operation (see ::SimdOperationBinary16iType).
+    */
+    SIMD_API void SimdOperationBinary16i(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
+        size_t width, size_t height, uint8_t * dst, size_t dstStride, SimdOperationBinary16iType type);
+
+    /*! @ingroup operation
+
+        \fn void SimdVectorProduct(const uint8_t * vertical, const uint8_t * horizontal, uint8_t * dst, size_t stride, size_t width, size_t height);
+
+        \short Calculates result 8-bit gray image as product of two vectors.
+
+        For all points:
+        \verbatim
+        dst[x, y] = horizontal[x]*vertical[y]/255;
+        \endverbatim
+
+        \note This function has a C++ wrappers: Simd::VectorProduct(const uint8_t * vertical, const uint8_t * horizontal, View<A>& dst).
+
+        \param [in] vertical - a pointer to pixels data of vertical vector. It length is equal to result image height.
+        \param [in] horizontal - a pointer to pixels data of horizontal vector. It length is equal to result image width.
+        \param [out] dst - a pointer to pixels data of result image.
+        \param [in] stride - a row size of dst image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+    */
+    SIMD_API void SimdVectorProduct(const uint8_t * vertical, const uint8_t * horizontal,
+        uint8_t * dst, size_t stride, size_t width, size_t height);
+
+    /*! @ingroup resizing
+
+        \fn void SimdReduceColor2x2(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount);
+
+        \short Performs reducing and Gaussian blurring (in two time) a 8-bit channel color image with using window 2x2.
+
+        For input and output image must be performed: dstWidth = (srcWidth + 1)/2,  dstHeight = (srcHeight + 1)/2.
+
+        For all points:
+        \verbatim
+        dst[x, y, c] = (src[2*x, 2*y, c] + src[2*x, 2*y + 1, c] + src[2*x + 1, 2*y, c] + src[2*x + 1, 2*y + 1, c] + 2)/4;
+        \endverbatim
+
+        \note This function has a C++ wrappers: Simd::Reduce2x2(const View<A> & src, View<A> & dst).
+
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] srcWidth - a width of the input image.
+        \param [in] srcHeight - a height of the input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [out] dst - a pointer to pixels data of the reduced output image.
+        \param [in] dstWidth - a width of the output image.
+        \param [in] dstHeight - a height of the output image.
+        \param [in] dstStride - a row size of the output image.
+        \param [in] channelCount - a nmber of channels for input and output images.
+    */
+    SIMD_API void SimdReduceColor2x2(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+        uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount);
+
+    /*! @ingroup resizing
+
+        \fn void SimdReduceGray2x2(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
+
+        \short Performs reducing and Gaussian blurring (in two time) a 8-bit gray image with using window 2x2.
+
+        For input and output image must be performed: dstWidth = (srcWidth + 1)/2,  dstHeight = (srcHeight + 1)/2.
+
+        For all points:
+        \verbatim
+        dst[x, y] = (src[2*x, 2*y] + src[2*x, 2*y + 1] + src[2*x + 1, 2*y] + src[2*x + 1, 2*y + 1] + 2)/4;
+        \endverbatim
+
+        \note This function has a C++ wrappers: Simd::ReduceGray2x2(const View<A>& src, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] srcWidth - a width of the input image.
+        \param [in] srcHeight - a height of the input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [out] dst - a pointer to pixels data of the reduced output image.
+        \param [in] dstWidth - a width of the output image.
+        \param [in] dstHeight - a height of the output image.
+        \param [in] dstStride - a row size of the output image.
+    */
+    SIMD_API void SimdReduceGray2x2(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+        uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
+
+    /*! @ingroup resizing
+
+        \fn void SimdReduceGray3x3(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, int compensation);
+
+        \short Performs reducing and Gaussian blurring (in two time) a 8-bit gray image with using window 3x3.
+
+        For input and output image must be performed: dstWidth = (srcWidth + 1)/2,  dstHeight = (srcHeight + 1)/2.
+
+        For every point:
+        \verbatim
+        dst[x, y] = (src[2*x-1, 2*y-1] + 2*src[2*x, 2*y-1] + src[2*x+1, 2*y-1] +
+                  2*(src[2*x-1, 2*y]   + 2*src[2*x, 2*y]   + src[2*x+1, 2*y]) +
+                     src[2*x-1, 2*y+1] + 2*src[2*x, 2*y+1] + src[2*x+1, 2*y+1] + compensation ? 8 : 0) / 16;
+        \endverbatim
+
+        \note This function has a C++ wrappers: Simd::ReduceGray3x3(const View<A>& src, View<A>& dst, bool compensation).
+
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] srcWidth - a width of the input image.
+        \param [in] srcHeight - a height of the input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [out] dst - a pointer to pixels data of the reduced output image.
+        \param [in] dstWidth - a width of the output image.
+        \param [in] dstHeight - a height of the output image.
+        \param [in] dstStride - a row size of the output image.
+        \param [in] compensation - a flag of compensation of rounding.
+    */
+    SIMD_API void SimdReduceGray3x3(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+        uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, int compensation);
+
+    /*! @ingroup resizing
+
+        \fn void SimdReduceGray4x4(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
+
+        \short Performs reducing and Gaussian blurring (in two time) a 8-bit gray image with using window 4x4.
+
+        For input and output image must be performed: dstWidth = (srcWidth + 1)/2,  dstHeight = (srcHeight + 1)/2.
+
+        For every point:
+        \verbatim
+        dst[x, y] = (src[2*x-1, 2*y-1] + 3*src[2*x, 2*y-1] + 3*src[2*x+1, 2*y-1] + src[2*x+2, 2*y-1]
+                  3*(src[2*x-1, 2*y]   + 3*src[2*x, 2*y]   + 3*src[2*x+1, 2*y]   + src[2*x+2, 2*y]) +
+                  3*(src[2*x-1, 2*y+1] + 3*src[2*x, 2*y+1] + 3*src[2*x+1, 2*y+1] + src[2*x+2, 2*y+1]) +
+                     src[2*x-1, 2*y+2] + 3*src[2*x, 2*y+2] + 3*src[2*x+1, 2*y+2] + src[2*x+2, 2*y+2] + 32) / 64;
+        \endverbatim
+
+        \note This function has a C++ wrappers: Simd::ReduceGray4x4(const View<A>& src, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] srcWidth - a width of the input image.
+        \param [in] srcHeight - a height of the input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [out] dst - a pointer to pixels data of the reduced output image.
+        \param [in] dstWidth - a width of the output image.
+        \param [in] dstHeight - a height of the output image.
+        \param [in] dstStride - a row size of the output image.
+    */
+    SIMD_API void SimdReduceGray4x4(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+        uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
+
+    /*! @ingroup resizing
+
+        \fn void SimdReduceGray5x5(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, int compensation);
+
+        \short Performs reducing and Gaussian blurring (in two time) a 8-bit gray image with using window 5x5.
+
+        For input and output image must be performed: dstWidth = (srcWidth + 1)/2,  dstHeight = (srcHeight + 1)/2.
+
+        For every point:
+        \verbatim
+        dst[x, y] = (
+               src[2*x-2, 2*y-2] + 4*src[2*x-1, 2*y-2] + 6*src[2*x, 2*y-2] + 4*src[2*x+1, 2*y-2] + src[2*x+2, 2*y-2] +
+            4*(src[2*x-2, 2*y-1] + 4*src[2*x-1, 2*y-1] + 6*src[2*x, 2*y-1] + 4*src[2*x+1, 2*y-1] + src[2*x+2, 2*y-1]) +
+            6*(src[2*x-2, 2*y]   + 4*src[2*x-1, 2*y]   + 6*src[2*x, 2*y]   + 4*src[2*x+1, 2*y]   + src[2*x+2, 2*y]) +
+            4*(src[2*x-2, 2*y+1] + 4*src[2*x-1, 2*y+1] + 6*src[2*x, 2*y+1] + 4*src[2*x+1, 2*y+1] + src[2*x+2, 2*y+1]) +
+               src[2*x-2, 2*y+2] + 4*src[2*x-1, 2*y+2] + 6*src[2*x, 2*y+2] + 4*src[2*x+1, 2*y+2] + src[2*x+2, 2*y+2] +
+            compensation ? 128 : 0) / 256;
+        \endverbatim
+
+        \note This function has a C++ wrappers: Simd::ReduceGray5x5(const Viewc<A>& src, View<A>& dst, bool compensation).
+
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] srcWidth - a width of the input image.
+        \param [in] srcHeight - a height of the input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [out] dst - a pointer to pixels data of the reduced output image.
+        \param [in] dstWidth - a width of the output image.
+        \param [in] dstHeight - a height of the output image.
+        \param [in] dstStride - a row size of the output image.
+        \param [in] compensation - a flag of compensation of rounding.
+    */
+    SIMD_API void SimdReduceGray5x5(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+        uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, int compensation);
+
+    /*! @ingroup reordering
+
+        \fn void SimdReorder16bit(const uint8_t * src, size_t size, uint8_t * dst);
+
+        \short Performs bytes reordering for data array.
+
+        For every 2 bytes:
+        \verbatim
+        dst[2*i + 0] = src[2*i + 1];
+        dst[2*i + 1] = src[2*i + 0];
+        \endverbatim
+
+        The data size must be a multiple of 2.
+
+        \param [in] src - a pointer to the input data.
+        \param [in] size - a size of input and output data.
+        \param [out] dst - a pointer to the output data.
+    */
+    SIMD_API void SimdReorder16bit(const uint8_t * src, size_t size, uint8_t * dst);
+
+    /*! @ingroup reordering
+
+        \fn void SimdReorder32bit(const uint8_t * src, size_t size, uint8_t * dst);
+
+        \short Performs bytes reordering for data array.
+
+        For every 4 bytes:
+        \verbatim
+        dst[4*i + 0] = src[4*i + 3];
+        dst[4*i + 1] = src[4*i + 2];
+        dst[4*i + 2] = src[4*i + 1];
+        dst[4*i + 3] = src[4*i + 0];
+        \endverbatim
+
+        The data size must be a multiple of 4.
+
+        \param [in] src - a pointer to the input data.
+        \param [in] size - a size of input and output data.
+        \param [out] dst - a pointer to the output data.
+    */
+    SIMD_API void SimdReorder32bit(const uint8_t * src, size_t size, uint8_t * dst);
+
+    /*! @ingroup reordering
+
+        \fn void SimdReorder64bit(const uint8_t * src, size_t size, uint8_t * dst);
+
+        \short Performs bytes reordering for data array.
+
+        For every 8 bytes:
+        \verbatim
+        dst[8*i + 0] = src[8*i + 7];
+        dst[8*i + 1] = src[8*i + 6];
+        dst[8*i + 2] = src[8*i + 5];
+        dst[8*i + 3] = src[8*i + 4];
+        dst[8*i + 4] = src[8*i + 3];
+        dst[8*i + 5] = src[8*i + 2];
+        dst[8*i + 6] = src[8*i + 1];
+        dst[8*i + 7] = src[8*i + 0];
+        \endverbatim
+
+        The data size must be a multiple of 8.
+
+        \param [in] src - a pointer to the input data.
+        \param [in] size - a size of input and output data.
+        \param [out] dst - a pointer to the output data.
+    */
+    SIMD_API void SimdReorder64bit(const uint8_t * src, size_t size, uint8_t * dst);
+
+    /*! @ingroup resizing
+
+        \fn void SimdResizeBilinear(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount);
+
+        \short Performs resizing of input image with using bilinear interpolation.
+
+        All images must have the same format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        \note This function has a C++ wrappers: Simd::ResizeBilinear(const View<A>& src, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] srcWidth - a width of the input image.
+        \param [in] srcHeight - a height of the input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [out] dst - a pointer to pixels data of the reduced output image.
+        \param [in] dstWidth - a width of the output image.
+        \param [in] dstHeight - a height of the output image.
+        \param [in] dstStride - a row size of the output image.
+        \param [in] channelCount - a channel count.
+    */
+    SIMD_API void SimdResizeBilinear(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+        uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount);
+
+    /*! @ingroup resizing
+
+        \fn void SimdResizeBilinearRows(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount, float siteX, size_t dstRowBeg, size_t dstRowEnd);
+
+        \short Performs resizing of input image with using bilinear interpolation for a band of output rows.
+
+        It calculates only rows [dstRowBeg, dstRowEnd) of the output image, so the image can be resized by independent bands in several threads.
+        The rows are the same as rows of the whole image resized at once. For siteX = 0.5 the result is equal to the result of ::SimdResizeBilinear.
+
+        Parameter siteX defines horizontal position of the sample inside of the pixel (in pixel units) which is kept at the same place after resizing:
+        0.5 for samples placed in pixel centers, 0.25 for chroma samples of 4:2:0 and 4:2:2 formats with MPEG-2 (H.264, HEVC) siting,
+        which are co-sited with left luma column.
+
+        All images must have the same format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] srcWidth - a width of the input image.
+        \param [in] srcHeight - a height of the input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [out] dst - a pointer to pixels data of the whole output image (not to the first row of the band).
+        \param [in] dstWidth - a width of the output image.
+        \param [in] dstHeight - a height of the output image.
+        \param [in] dstStride - a row size of the output image.
+        \param [in] channelCount - a channel count.
+        \param [in] siteX - a horizontal position of the sample inside of the pixel.
+        \param [in] dstRowBeg - a first calculated row of the output image.
+        \param [in] dstRowEnd - a row after the last calculated row of the output image. It must not be greater than dstHeight.
+    */
+    SIMD_API void SimdResizeBilinearRows(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+        uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount, float siteX, size_t dstRowBeg, size_t dstRowEnd);
+
+    /*! @ingroup resizing
+        Describes resized image channel types.
+    */
+    typedef enum
+    {
+        /*! 8-bit integer channel type.  */
+        SimdResizeChannelByte,
+        /*! 32-bit float channel type.  */
+        SimdResizeChannelFloat,
+    } SimdResizeChannelType;
+
+    /*! @ingroup resizing
+        Describes methods used in oreder to resize image.
+    */
+    typedef enum
+    {
+        /*! Bilinear method. */
+        SimdResizeMethodBilinear,
+        /*! caffe::interp compatible method. */
+        SimdResizeMethodCaffeInterp,
+    } SimdResizeMethodType;
+
+    /*! @ingroup resizing
+
+        \fn void * SimdResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        \short Creates resize context.
+
+        \param [in] srcX - a width of the input image.
+        \param [in] srcY - a height of the input image.
+        \param [in] dstX - a width of the output image.
+        \param [in] dstY - a height of the output image.
+        \param [in] channels - a channel number of input and output image.
+        \param [in] type - a type of input and output image channel.
+        \param [in] method - a method used in order to resize image.
+        \return a pointer to resize context. On error it returns NULL. 
+                This pointer is used in functions ::SimdResizerRun. 
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+    /*! @ingroup resizing
+
+        \fn void SimdResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        \short Performs image resizing.
+
+        \param [in] resizer - a resize context. It must be created by function ::SimdResizerInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to pixels data of the resized output image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup rgb_conversion
+
+        \fn void SimdRgbToGray(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * gray, size_t grayStride);
+
+        \short Converts 24-bit RGB image to 8-bit gray image.
+
+        All images must have the same width and height.
+
+        \note This function has a C++ wrapper Simd::RgbToGray(const View<A>& rgb, View<A>& gray).
+
+        \param [in] rgb - a pointer to pixels data of input 24-bit RGB image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] rgbStride - a row size of the rgb image.
+        \param [out] gray - a pointer to pixels data of output 8-bit gray image.
+        \param [in] grayStride - a row size of the gray image.
+    */
+    SIMD_API void SimdRgbToGray(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * gray, size_t grayStride);
+
+    /*! @ingroup rgb_conversion
+
+        \fn void SimdRgbToYuv420p(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+
+        \short Converts 24-bit RGB image to YUV420P.
+
+        The input RGB and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function has a C++ wrapper Simd::RgbToYuv420p(const View<A>& rgb, View<A>& y, View<A>& u, View<A>& v).
+
+        \param [in] rgb - a pointer to pixels data of input 24-bit RGB image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] rgbStride - a row size of the RGB image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+    */
+    SIMD_API void SimdRgbToYuv420p(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+
+    /*! @ingroup rgb_conversion
+
+        \fn void SimdRgbToYuv422p(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+
+        \short Converts 24-bit RGB image to YUV422P.
+
+        The input RGB and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \note This function has a C++ wrapper Simd::RgbToYuv422p(const View<A>& rgb, View<A>& y, View<A>& u, View<A>& v).
+
+        \param [in] rgb - a pointer to pixels data of input 24-bit RGB image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] rgbStride - a row size of the RGB image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+    */
+    SIMD_API void SimdRgbToYuv422p(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+
+    /*! @ingroup rgb_conversion
+
+        \fn void SimdRgbToYuv444p(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+
+        \short Converts 24-bit RGB image to YUV444P.
+
+        The input RGB and output Y, U and V images must have the same width and height.
+
+        \note This function has a C++ wrapper Simd::RgbToYuv444p(const View<A>& rgb, View<A>& y, View<A>& u, View<A>& v).
+
+        \param [in] rgb - a pointer to pixels data of input 24-bit RGB image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] rgbStride - a row size of the RGB image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+    */
+    SIMD_API void SimdRgbToYuv444p(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+
+    /*! @ingroup rgba_conversion
+
+        \fn void SimdRgbaToGray(const uint8_t * rgba, size_t width, size_t height, size_t rgbaStride, uint8_t * gray, size_t grayStride);
+
+        \short Converts 32-bit RGBA image to 8-bit gray image.
+
+        All images must have the same width and height.
+
+        \note This function has a C++ wrapper Simd::RgbaToGray(const View<A>& rgba, View<A>& gray).
+
+        \param [in] rgba - a pointer to pixels data of input 32-bit RGBA image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] rgbaStride - a row size of the rgba image.
+        \param [out] gray - a pointer to pixels data of output 8-bit gray image.
+        \param [in] grayStride - a row size of the gray image.
+    */
+    SIMD_API void SimdRgbaToGray(const uint8_t * rgba, size_t width, size_t height, size_t rgbaStride, uint8_t * gray, size_t grayStride);
+
+    /*! @ingroup rgba_conversion
+
+        \fn void SimdRgbaToYuv420p(const uint8_t * rgba, size_t width, size_t height, size_t rgbaStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+
+        \short Converts 32-bit RGBA image to YUV420P.
+
+        The input RGBA and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function has a C++ wrapper Simd::RgbaToYuv420p(const View<A>& rgba, View<A>& y, View<A>& u, View<A>& v).
+
+        \param [in] rgba - a pointer to pixels data of input 32-bit RGBA image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] rgbaStride - a row size of the RGBA image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+    */
+    SIMD_API void SimdRgbaToYuv420p(const uint8_t * rgba, size_t width, size_t height, size_t rgbaStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+
+    /*! @ingroup rgba_conversion
+
+        \fn void SimdRgbaToYuv422p(const uint8_t * rgba, size_t width, size_t height, size_t rgbaStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+
+        \short Converts 32-bit RGBA image to YUV422P.
+
+        The input RGBA and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \note This function has a C++ wrapper Simd::RgbaToYuv422p(const View<A>& rgba, View<A>& y, View<A>& u, View<A>& v).
+
+        \param [in] rgba - a pointer to pixels data of input 32-bit RGBA image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] rgbaStride - a row size of the RGBA image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+    */
+    SIMD_API void SimdRgbaToYuv422p(const uint8_t * rgba, size_t width, size_t height, size_t rgbaStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+
+    /*! @ingroup rgba_conversion
+
+        \fn void SimdRgbaToYuv444p(const uint8_t * rgba, size_t width, size_t height, size_t rgbaStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+
+        \short Converts 32-bit RGBA image to YUV444P.
+
+        The input RGBA and output Y, U and V images must have the same width and height.
+
+        \note This function has a C++ wrapper Simd::RgbaToYuv444p(const View<A>& rgba, View<A>& y, View<A>& u, View<A>& v).
+
+        \param [in] rgba - a pointer to pixels data of input 32-bit RGBA image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] rgbaStride - a row size of the RGBA image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+    */
+    SIMD_API void SimdRgbaToYuv444p(const uint8_t * rgba, size_t width, size_t height, size_t rgbaStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+
+    /*! @ingroup segmentation
+
+        \fn void SimdSegmentationChangeIndex(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t oldIndex, uint8_t newIndex);
+
+        \short Changes certain index in mask.
+
+        Mask must has 8-bit gray pixel format.
+
+        For every point:
+        \verbatim
+        if(mask[i] == oldIndex)
+            mask[i] = newIndex;
+        \endverbatim
+
+        \note This function has a C++ wrappers: Simd::SegmentationChangeIndex(View<A> & mask, uint8_t oldIndex, uint8_t newIndex).
+
+        \param [in, out] mask - a pointer to pixels data of 8-bit gray mask image.
+        \param [in] stride - a row size of the mask image.
+        \param [in] width - a mask width.
+        \param [in] height - a mask height.
+        \param [in] oldIndex - a mask old index.
+        \param [in] newIndex - a mask new index.
+    */
+    SIMD_API void SimdSegmentationChangeIndex(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t oldIndex, uint8_t newIndex);
+
+    /*! @ingroup segmentation
+
+        \fn void SimdSegmentationFillSingleHoles(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index);
+
+        \short Fill single holes in mask.
+
+        Mask must has 8-bit gray pixel format.
+
+        \note This function has a C++ wrappers: Simd::SegmentationFillSingleHoles(View<A> & mask, uint8_t index).
+
+        \param [in, out] mask - a pointer to pixels data of 8-bit gray mask image.
+        \param [in] stride - a row size of the mask image.
+        \param [in] width - an mask width.
+        \param [in] height - an mask height.
+        \param [in] index - a mask index.
+    */
+    SIMD_API void SimdSegmentationFillSingleHoles(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index);
+
+    /*! @ingroup segmentation
+
+        \fn size_t SimdSegmentationLabelComponents(const uint8_t * mask, size_t maskStride, size_t width, size_t height, SimdCompareType compareType, uint8_t value, int connectivity, uint32_t * labels, size_t labelsStride, SimdConnectedComponent * components, size_t capacity);
+
+        \short Finds connected components of the mask and labels them.
+
+        A pixel of the mask belongs to foreground if compare(mask[x, y], value) is true.
+        For binary masks use ::SimdCompareGreater and value = 0, for indexed masks use ::SimdCompareEqual and value = index.
+        Foreground pixels are grouped in connected components with using of 4-connectivity or 8-connectivity.
+        Components are numbered from 1 in order of their first pixel in raster scan order.
+        The image is processed in horizontal strips (in parallel if it is allowed, see ::SimdSetThreadNumber) which are merged after that.
+
+        Mask must has 8-bit gray pixel format. Labels image must has 32-bit integer format and the same size as mask.
+
+        \note This function has a C++ wrappers: Simd::SegmentationLabelComponents(const View<A> & mask, SimdCompareType compareType, uint8_t value, int connectivity, View<A> & labels, std::vector<SimdConnectedComponent> & components).
+
+        \param [in] mask - a pointer to pixels data of 8-bit gray mask image.
+        \param [in] maskStride - a row size of the mask image.
+        \param [in] width - a mask width.
+        \param [in] height - a mask height.
+        \param [in] compareType - a compare operation type (see ::SimdCompareType) which defines foreground pixels.
+        \param [in] value - a second argument of compare operation.
+        \param [in] connectivity - a connectivity of components (4 or 8).
+        \param [out] labels - a pointer to pixels data of output 32-bit labels image. Background pixels are set to 0. Can be NULL.
+        \param [in] labelsStride - a row size of the labels image (in bytes).
+        \param [out] components - a pointer to array of components. Element i describes component with label i + 1. Can be NULL.
+        \param [in] capacity - a size of components array. If it is less than number of components only first capacity components are stored.
+        \return a total number of found components.
+    */
+    SIMD_API size_t SimdSegmentationLabelComponents(const uint8_t * mask, size_t maskStride, size_t width, size_t height, SimdCompareType compareType, uint8_t value,
+        int connectivity, uint32_t * labels, size_t labelsStride, SimdConnectedComponent * components, size_t capacity);
+
+    /*! @ingroup segmentation
+
+        \fn void SimdSegmentationPropagate2x2(const uint8_t * parent, size_t parentStride, size_t width, size_t height, uint8_t * child, size_t childStride, const uint8_t * difference, size_t differenceStride, uint8_t currentIndex, uint8_t invalidIndex, uint8_t emptyIndex, uint8_t differenceThreshold);
+
+        \short Propagates mask index from parent (upper) to child (lower) level of mask pyramid with using 2x2 scan window.
+
+        For parent and child image must be performed: parentWidth = (childWidth + 1)/2, parentHeight = (childHeight + 1)/2.
+        All images must have 8-bit gray pixel format. Size of different image is equal to child image.
+
+        \note This function has a C++ wrappers: Simd::SegmentationPropagate2x2(const View<A> & parent, View<A> & child, const View<A> & difference, uint8_t currentIndex, uint8_t invalidIndex, uint8_t emptyIndex, uint8_t thresholdDifference).
+
+        \param [in] parent - a pointer to pixels data of 8-bit gray parent mask image.
+        \param [in] parentStride - a row size of the parent mask image.
+        \param [in] width - a parent mask width.
+        \param [in] height - a parent mask height.
+        \param [in, out] child - a pointer to pixels data of 8-bit gray child mask image.
+        \param [in] childStride - a row size of the child mask image.
+        \param [in] difference - a pointer to pixels data of 8-bit gray difference image.
+        \param [in] differenceStride - a row size of the difference image.
+        \param [in] currentIndex - propagated mask index.
+        \param [in] invalidIndex - invalid mask index.
+        \param [in] emptyIndex - empty mask index.
+        \param [in] differenceThreshold - a difference threshold for conditional index propagating.
+    */
+    SIMD_API void SimdSegmentationPropagate2x2(const uint8_t * parent, size_t parentStride, size_t width, size_t height,
+        uint8_t * child, size_t childStride, const uint8_t * difference, size_t differenceStride,
+        uint8_t currentIndex, uint8_t invalidIndex, uint8_t emptyIndex, uint8_t differenceThreshold);
+
+    /*! @ingroup segmentation
+
+        \fn void SimdSegmentationShrinkRegion(const uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index, ptrdiff_t * left, ptrdiff_t * top, ptrdiff_t * right, ptrdiff_t * bottom);
+
+        \short Finds actual region of mask index location.
+
+        Mask must has 8-bit gray pixel format.
+
+        \note This function has a C++ wrappers: Simd::SegmentationShrinkRegion(const View<A> & mask, uint8_t index, Rectangle<ptrdiff_t> & rect).
+
+        \param [in] mask - a pointer to pixels data of 8-bit gray mask image.
+        \param [in] stride - a row size of the mask image.
+        \param [in] width - an mask width.
+        \param [in] height - an mask height.
+        \param [in] index - a mask index.
+        \param [in, out] left - a pointer to left side.
+        \param [in, out] top - a pointer to top side.
+        \param [in, out] right - a pointer to right side.
+        \param [in, out] bottom - a pointer to bottom side.
+    */
+    SIMD_API void SimdSegmentationShrinkRegion(const uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index,
+        ptrdiff_t * left, ptrdiff_t * top, ptrdiff_t * right, ptrdiff_t * bottom);
+
+    /*! @ingroup shifting
+
+        \fn void SimdShiftBilinear(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, const uint8_t * bkg, size_t bkgStride, const double * shiftX, const double * shiftY, size_t cropLeft, size_t cropTop, size_t cropRight, size_t cropBottom, uint8_t * dst, size_t dstStride);
+
+        \short Performs shifting of input image with using bilinear interpolation.
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        \note This function has a C++ wrappers: Simd::ShiftBilinear(const View<A> & src, const View<A> & bkg, const Point<double> & shift, const Rectangle<ptrdiff_t> & crop, View<A> & dst).
+
+        \param [in] src - a pointer to pixels data of the foreground input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] channelCount - a channel count.
+        \param [in] bkg - a pointer to pixels data of the background input image.
+        \param [in] bkgStride - a row size of the background image.
+        \param [in] shiftX - an image shift along x axis.
+        \param [in] shiftY - an image shift along y axis.
+        \param [in] cropLeft - a crop left side.
+        \param [in] cropTop - a crop top side.
+        \param [in] cropRight - a crop right side.
+        \param [in] cropBottom - a crop bottom side.
+        \param [out] dst - a pointer to pixels data of the output image.
+        \param [in] dstStride - a row size of the output image.
+    */
+    SIMD_API void SimdShiftBilinear(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount,
+        const uint8_t * bkg, size_t bkgStride, const double * shiftX, const double * shiftY,
+        size_t cropLeft, size_t cropTop, size_t cropRight, size_t cropBottom, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup sobel_filter
+
+        \fn void SimdSobelDx(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+
+        \short Calculates Sobel's filter along x axis.
+
+        All images must have the same width and height. Input image must has 8-bit gray format, output image must has 16-bit integer format.
+
+        For every point:
+        \n dst[x, y] = (src[x+1,y-1] + 2*src[x+1, y] + src[x+1, y+1]) - (src[x-1,y-1] + 2*src[x-1, y] + src[x-1, y+1]).
+
+        \note This function has a C++ wrappers: Simd::SobelDx(const View<A>& src, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] dst - a pointer to pixels data of the output image.
+        \param [in] dstStride - a row size of the output image (in bytes).
+    */
+    SIMD_API void SimdSobelDx(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup sobel_filter
+
+        \fn void SimdSobelDxAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+
+        \short Calculates absolute value of Sobel's filter along x axis.
+
+        All images must have the same width and height. Input image must has 8-bit gray format, output image must has 16-bit integer format.
+
+        For every point:
+        \verbatim
+        dst[x, y] = (src[x+1,y-1] + 2*src[x+1, y] + src[x+1, y+1]) - (src[x-1,y-1] + 2*src[x-1, y] + src[x-1, y+1]).
+        \endverbatim
+
+        \note This function has a C++ wrappers: Simd::SobelDxAbs(const View<A>& src, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] dst - a pointer to pixels data of the output image.
+        \param [in] dstStride - a row size of the output image (in bytes).
+    */
+    SIMD_API void SimdSobelDxAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup sobel_statistic
+
+        \fn void SimdSobelDxAbsSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum);
+
+        \short Calculates sum of absolute value of Sobel's filter along x axis.
+
+        Input image must has 8-bit gray format.
+
+        For every point:
+        \verbatim
+        dst[x, y] = abs((src[x+1,y-1] + 2*src[x+1, y] + src[x+1, y+1]) - (src[x-1,y-1] + 2*src[x-1, y] + src[x-1, y+1])).
+        \endverbatim
+
+        \note This function has a C++ wrappers: Simd::SobelDxAbsSum(const View<A>& src, uint64_t & sum).
+
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] stride - a row size of the input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] sum - a pointer to unsigned 64-bit integer value with result sum.
+    */
+    SIMD_API void SimdSobelDxAbsSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum);
+
+    /*! @ingroup sobel_filter
+
+        \fn void SimdSobelDy(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+
+        \short Calculates Sobel's filter along y axis.
+
+        All images must have the same width and height. Input image must has 8-bit gray format, output image must has 16-bit integer format.
+
+        For every point:
+        \verbatim
+        dst[x, y] = (src[x-1,y+1] + 2*src[x, y+1] + src[x+1, y+1]) - (src[x-1,y-1] + 2*src[x, y-1] + src[x+1, y-1]);
+        \endverbatim
+
+        \note This function has a C++ wrappers: Simd::SobelDy(const View<A>& src, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] dst - a pointer to pixels data of the output image.
+        \param [in] dstStride - a row size of the output image (in bytes).
+    */
+    SIMD_API void SimdSobelDy(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup sobel_filter
+
+        \fn void SimdSobelDyAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+
+        \short Calculates absolute value of Sobel's filter along y axis.
+
+        All images must have the same width and height. Input image must has 8-bit gray format, output image must has 16-bit integer format.
+
+        For every point:
+        \verbatim
+        dst[x, y] = abs((src[x-1,y+1] + 2*src[x, y+1] + src[x+1, y+1]) - (src[x-1,y-1] + 2*src[x, y-1] + src[x+1, y-1]));
+        \endverbatim
+
+        \note This function has a C++ wrappers: Simd::SobelDyAbs(const View<A>& src, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] dst - a pointer to pixels data of the output image.
+        \param [in] dstStride - a row size of the output image (in bytes).
+    */
+    SIMD_API void SimdSobelDyAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup sobel_statistic
+
+        \fn void SimdSobelDyAbsSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum);
+
+        \short Calculates sum of absolute value of Sobel's filter along y axis.
+
+        Input image must has 8-bit gray format.
+
+        For every point:
+        \verbatim
+        sum += abs((src[x-1,y+1] + 2*src[x, y+1] + src[x+1, y+1]) - (src[x-1,y-1] + 2*src[x, y-1] + src[x+1, y-1]));
+        \endverbatim
+
+        \note This function has a C++ wrappers: Simd::SobelDyAbsSum(const View<A>& src, uint64_t & sum).
+
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] stride - a row size of the input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] sum - a pointer to unsigned 64-bit integer value with result sum.
+    */
+    SIMD_API void SimdSobelDyAbsSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum);
+
+    /*! @ingroup contour
+
+        \fn void SimdContourMetrics(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+
+        \short Calculates contour metrics based on absolute value and direction of Sobel's filter along y and y axis.
+
+        All images must have the same width and height. Input image must has 8-bit gray format, output image must has 16-bit integer format.
+        This function is used for contour extraction.
+
+        For every point:
+        \verbatim
+        dy = abs((src[x-1,y+1] + 2*src[x, y+1] + src[x+1, y+1]) - (src[x-1,y-1] + 2*src[x, y-1] + src[x+1, y-1]));
+        dx = abs((src[x+1,y-1] + 2*src[x+1, y] + src[x+1, y+1]) - (src[x-1,y-1] + 2*src[x-1, y] + src[x-1, y+1]));
+        dst[x, y] = (dx + dy)*2 + (dx >= dy ? 0 : 1);
+        \endverbatim
+
+        \note This function has a C++ wrappers: Simd::ContourMetrics(const View<A>& src, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of the gray 8-bit input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] dst - a pointer to pixels data of the output 16-bit image.
+        \param [in] dstStride - a row size of the output image (in bytes).
+    */
+    SIMD_API void SimdContourMetrics(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup contour
+
+        \fn void SimdContourMetricsMasked(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * mask, size_t maskStride, uint8_t indexMin, uint8_t * dst, size_t dstStride)
+
+        \short Calculates contour metrics based on absolute value and direction of Sobel's filter along y and y axis with using mask.
+
+        All images must have the same width and height. Input image must has 8-bit gray format, output image must has 16-bit integer format.
+        This function is used for contour extraction.
+
+        For every point:
+        \verbatim
+        dy = abs((src[x-1,y+1] + 2*src[x, y+1] + src[x+1, y+1]) - (src[x-1,y-1] + 2*src[x, y-1] + src[x+1, y-1]));
+        dx = abs((src[x+1,y-1] + 2*src[x+1, y] + src[x+1, y+1]) - (src[x-1,y-1] + 2*src[x-1, y] + src[x-1, y+1]));
+        dst[x, y] = mask[x, y] < indexMin ? 0 : (dx + dy)*2 + (dx >= dy ? 0 : 1);
+        \endverbatim
+
+        \note This function has a C++ wrappers: Simd::ContourMetrics(const View<A>& src, const View<A>& mask, uint8_t indexMin, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of the gray 8-bit input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] mask - a pointer to pixels data of the mask 8-bit image.
+        \param [in] maskStride - a row size of the mask image.
+        \param [in] indexMin - a mask minimal permissible index.
+        \param [out] dst - a pointer to pixels data of the output 16-bit image.
+        \param [in] dstStride - a row size of the output image (in bytes).
+    */
+    SIMD_API void SimdContourMetricsMasked(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        const uint8_t * mask, size_t maskStride, uint8_t indexMin, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup contour
+
+        \fn void SimdContourAnchors(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t step, int16_t threshold, uint8_t * dst, size_t dstStride);
+
+        \short Extract contour anchors from contour metrics.
+
+        All images must have the same width and height. Input image must has 16-bit integer format, output image must has 8-bit gray format.
+        Input image with metrics can be estimated by using ::SimdContourMetrics or ::SimdContourMetricsMasked functions.
+        This function is used for contour extraction.
+
+        For every point (except border):
+        \verbatim
+        a[x, y] = src[x, y] >> 1.
+        if(src[x, y] & 1)
+            dst[x, y] = a[x, y] > 0 && (a[x, y] - a[x + 1, y] >= threshold) && (a[x, y] - a[x - 1, y] >= threshold) ? 255 : 0;
+        else
+            dst[x, y] = a[x, y] > 0 && (a[x, y] - a[x, y + 1] >= threshold) && (a[x, y] - a[x, y - 1] >= threshold) ? 255 : 0;
+        \endverbatim
+
+        \note This function has a C++ wrappers: Simd::ContourAnchors(const View<A>& src, size_t step, int16_t threshold, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of the 16-bit input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] step - a row step (to skip some rows).
+        \param [in] threshold - a threshold of anchor creation.
+        \param [out] dst - a pointer to pixels data of the output 8-bit gray image.
+        \param [in] dstStride - a row size of the output image (in bytes).
+    */
+    SIMD_API void SimdContourAnchors(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t step, int16_t threshold, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup correlation
+
+        \fn void SimdSquaredDifferenceSum(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, uint64_t * sum);
+
+        \short Calculates sum of squared differences for two 8-bit gray images.
+
+        All images must have the same width and height.
+
+        For every point:
+        \verbatim
+        sum += (a[i] - b[i])*(a[i] - b[i]);
+        \endverbatim
+
+        \note This function has a C++ wrappers: Simd::SquaredDifferenceSum(const View<A>& a, const View<A>& b, uint64_t & sum).
+
+        \param [in] a - a pointer to pixels data of the first image.
+        \param [in] aStride - a row size of the first image.
+        \param [in] b - a pointer to pixels data of the second image.
+        \param [in] bStride - a row size of the second image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] sum - a pointer to unsigned 64-bit integer value with result sum.
+    */
+    SIMD_API void SimdSquaredDifferenceSum(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
+        size_t width, size_t height, uint64_t * sum);
+
+    /*! @ingroup correlation
+
+        \fn void SimdSquaredDifferenceSumMasked(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, const uint8_t * mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sum);
+
+        \short Calculates sum of squared differences for two images with using mask.
+
+        All images must have the same width, height and format (8-bit gray).
+
+        For every point:
+        \verbatim
+        if(mask[i] == index)
+            sum += (a[i] - b[i])*(a[i] - b[i]);
+        \endverbatim
+
+        \note This function has a C++ wrappers: Simd::SquaredDifferenceSum(const View<A>& a, const View<A>& b, const View<A>& mask, uint8_t index, uint64_t & sum).
+
+        \param [in] a - a pointer to pixels data of the first image.
+        \param [in] aStride - a row size of the first image.
+        \param [in] b - a pointer to pixels data of the second image.
+        \param [in] bStride - a row size of the second image.
+        \param [in] mask - a pointer to pixels data of the mask image.
+        \param [in] maskStride - a row size of the mask image.
+        \param [in] index - a mask index.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] sum - a pointer to unsigned 64-bit integer value with result sum.
+    */
+    SIMD_API void SimdSquaredDifferenceSumMasked(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
+        const uint8_t * mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sum);
+
+    /*! @ingroup correlation
+
+        \fn void SimdSquaredDifferenceSum32f(const float * a, const float * b, size_t size, float * sum);
+
+        \short Calculates sum of squared differences for two 32-bit float arrays.
+
+        All arrays must have the same size.
+
+        For every element:
+        \verbatim
+        sum += (a[i] - b[i])*(a[i] - b[i]);
+        \endverbatim
+
+        \param [in] a - a pointer to the first array.
+        \param [in] b - a pointer to the second array.
+        \param [in] size - a size of arrays.
+        \param [out] sum - a sum of squared differences.
+    */
+    SIMD_API void SimdSquaredDifferenceSum32f(const float * a, const float * b, size_t size, float * sum);
+
+    /*! @ingroup correlation
+
+        \fn void SimdSquaredDifferenceKahanSum32f(const float * a, const float * b, size_t size, float * sum);
+
+        \short Calculates sum of squared differences for two 32-bit float arrays with using Kahan summation algorithm.
+
+        All arrays must have the same size.
+
+        Algorithm pseudo code:
+        \verbatim
+        sum = 0; corr = 0;
+        for(i = 0; i < size; ++i)
+        {
+            diff = (a[i] - b[i])*(a[i] - b[i]) - corr;
+            temp = sum + diff;
+            corr = (temp - sum) - diff;
+            sum = temp;
+        }
+        \endverbatim
+
+        \param [in] a - a pointer to the first array.
+        \param [in] b - a pointer to the second array.
+        \param [in] size - a size of arrays.
+        \param [out] sum - a sum of squared differences.
+    */
+    SIMD_API void SimdSquaredDifferenceKahanSum32f(const float * a, const float * b, size_t size, float * sum);
+
+    /*! @ingroup other_statistic
+
+        \fn void SimdGetStatistic(const uint8_t * src, size_t stride, size_t width, size_t height, uint8_t * min, uint8_t * max, uint8_t * average);
+
+        \short Finds minimal, maximal and average pixel values for given image.
+
+        The image must has 8-bit gray format.
+
+        \note This function has a C++ wrappers: Simd::GetStatistic(const View<A>& src, uint8_t & min, uint8_t & max, uint8_t & average).
+
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] stride - a row size of the image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] min - a pointer to unsigned 8-bit integer value with found minimal pixel value.
+        \param [out] max - a pointer to unsigned 8-bit integer value with found maximal pixel value.
+        \param [out] average - a pointer to unsigned 8-bit integer value with found average pixel value.
+    */
+    SIMD_API void SimdGetStatistic(const uint8_t * src, size_t stride, size_t width, size_t height,
+        uint8_t * min, uint8_t * max, uint8_t * average);
+
+    /*! @ingroup other_statistic
+
+        \fn void SimdGetMoments(const uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index, uint64_t * area, uint64_t * x, uint64_t * y, uint64_t * xx, uint64_t * xy, uint64_t * yy);
+
+        \short Calculate statistical characteristics (moments) of pixels with given index.
+
+        The image must has 8-bit gray format.
+
+        For every point:
+        \verbatim
+        if(mask[X, Y] == index)
+        {
+            area += 1.
+            x += X.
+            y += Y.
+            xx += X*X.
+            xy += X*Y.
+            yy += Y*Y.
+        }
+        \endverbatim
+
+        \note This function has a C++ wrappers: Simd::GetMoments(const View<A>& mask, uint8_t index, uint64_t & area, uint64_t & x, uint64_t & y, uint64_t & xx, uint64_t & xy, uint64_t & yy).
+
+        \param [in] mask - a pointer to pixels data of the mask image.
+        \param [in] stride - a row size of the mask image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] index - a mask index.
+        \param [out] area - a pointer to unsigned 64-bit integer value with found area (number of pixels with given index).
+        \param [out] x - a pointer to unsigned 64-bit integer value with found first-order moment x.
+        \param [out] y - a pointer to unsigned 64-bit integer value with found first-order moment y.
+        \param [out] xx - a pointer to unsigned 64-bit integer value with found second-order moment xx.
+        \param [out] xy - a pointer to unsigned 64-bit integer value with found second-order moment xy.
+        \param [out] yy - a pointer to unsigned 64-bit integer value with found second-order moment yy.
+    */
+    SIMD_API void SimdGetMoments(const uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index,
+        uint64_t * area, uint64_t * x, uint64_t * y, uint64_t * xx, uint64_t * xy, uint64_t * yy);
+
+    /*! @ingroup row_statistic
+
+        \fn void SimdGetRowSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums);
+
+        \short Calculate sums of rows for given 8-bit gray image.
+
+        For all rows:
+        \verbatim
+        for(x = 0; x < width; ++x)
+            sums[y] += src[x, y];
+        \endverbatim
+
+        \note This function has a C++ wrappers: Simd::GetRowSums(const View<A>& src, uint32_t * sums).
+
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] stride - a row size of the input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] sums - a pointer to array of unsigned 32-bit integers result sums of rows. It length must be equal to image height.
+    */
+    SIMD_API void SimdGetRowSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums);
+
+    /*! @ingroup col_statistic
+
+        \fn void SimdGetColSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums);
+
+        \short Calculate sums of columns for given 8-bit gray image.
+
+        For all columns:
+        \verbatim
+        for(y = 0; y < height; ++y)
+            sums[x] += src[x, y];
+        \endverbatim
+
+        \note This function has a C++ wrappers: Simd::GetColSums(const View<A>& src, uint32_t * sums).
+
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] stride - a row size of the input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] sums - a pointer to array of unsigned 32-bit integers result sums of columns. It length must be equal to image width.
+    */
+    SIMD_API void SimdGetColSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums);
+
+    /*! @ingroup row_statistic
+
+        \fn void SimdGetAbsDyRowSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums);
+
+        \short Calculate sums of absolute derivate along y axis for rows for given 8-bit gray image.
+
+        For all rows except the last:
+        \verbatim
+        for(x = 0; x < width; ++x)
+            sums[y] += abs(src[x, y+1] - src[x, y]);
+        \endverbatim
+        For the last row:
+        \verbatim
+        sums[height-1] = 0;
+        \endverbatim
+
+        \note This function has a C++ wrappers: Simd::GetAbsDyRowSums(const View<A>& src, uint32_t * sums).
+
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] stride - a row size of the input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] sums - a pointer to array of unsigned 32-bit integers result sums. It length must be equal to image height.
+    */
+    SIMD_API void SimdGetAbsDyRowSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums);
+
+    /*! @ingroup col_statistic
+
+        \fn void SimdGetAbsDxColSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums);
+
+        \short Calculate sums of absolute derivate along x axis for columns for given 8-bit gray image.
+
+        For all columns except the last:
+        \verbatim
+        for(y = 0; y < height; ++y)
+            sums[y] += abs(src[x+1, y] - src[x, y]);
+        \endverbatim
+        For the last column:
+        \verbatim
+        sums[width-1] = 0;
+        \endverbatim
+
+        \note This function has a C++ wrappers: Simd::GetAbsDxColSums(const View<A>& src, uint32_t * sums).
+
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] stride - a row size of the input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] sums - a pointer to array of unsigned 32-bit integers result columns. It length must be equal to image width.
+    */
+    SIMD_API void SimdGetAbsDxColSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums);
+
+    /*! @ingroup other_statistic
+
+        \fn void SimdValueSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum);
+
+        \short Gets sum of value of pixels for gray 8-bit image.
+
+        \note This function has a C++ wrappers: Simd::ValueSum(const View<A>& src, uint64_t & sum).
+
+        \param [in] src - a pointer to pixels data of the image.
+        \param [in] stride - a row size of the image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] sum - the result sum.
+    */
+    SIMD_API void SimdValueSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum);
+
+    /*! @ingroup other_statistic
+
+        \fn void SimdSquareSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum);
+
+        \short Gets sum of squared value of pixels for gray 8-bit image .
+
+        \note This function has a C++ wrappers: Simd::SquareSum(const View<A>& src, uint64_t & sum).
+
+        \param [in] src - a pointer to pixels data of the image.
+        \param [in] stride - a row size of the image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] sum - the result sum.
+    */
+	
+    SIMD_API void SimdSquareSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum);
+	
+	    /*! @ingroup other_statistic
+
+        \fn void SimdValueSquareSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * valueSum, uint64_t * squareSum);
+
+        \short Gets sum and squared sum of value of pixels for gray 8-bit image.
+
+        \note This function has a C++ wrappers: Simd::ValueSquareSum(const View<A>& src, uint64_t & valueSum, uint64_t & squareSum).
 
         \param [in] src - a pointer to pixels data of the image.
         \param [in] stride - a row size of the image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [out] valueSum - the result value sum.
-		\param [out] squareSum - the result square sum.
+        \param [out] valueSum - the result value sum.
+		\param [out] squareSum - the result square sum.
+    */
+    SIMD_API void SimdValueSquareSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * valueSum, uint64_t * squareSum);
+	
+    /*! @ingroup other_statistic
+
+        \fn void SimdCorrelationSum(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, uint64_t * sum);
+
+        \short Gets sum of pixel correlation for two gray 8-bit images.
+
+        For all points:
+        \verbatim
+        sum += a[i]*b[i];
+        \endverbatim
+
+        All images must have the same width and height and 8-bit gray pixel format.
+
+        \note This function has a C++ wrappers: Simd::CorrelationSum(const View<A> & a, const View<A> & b, uint64_t & sum).
+
+        \param [in] a - a pointer to pixels data of the first image.
+        \param [in] aStride - a row size of the first image.
+        \param [in] b - a pointer to pixels data of the second image.
+        \param [in] bStride - a row size of the second image.
+        \param [in] width - an images width.
+        \param [in] height - an images height.
+        \param [out] sum - a pointer to result sum.
+    */
+    SIMD_API void SimdCorrelationSum(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, uint64_t * sum);
+
+    /*! @ingroup resizing
+
+        \fn void SimdStretchGray2x2(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
+
+        \short Stretches input 8-bit gray image in two times.
+
+        \note This function has a C++ wrappers: Simd::StretchGray2x2(const View<A>& src, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] srcWidth - a width of the input image.
+        \param [in] srcHeight - a height of the input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [out] dst - a pointer to pixels data of the stretched output image.
+        \param [in] dstWidth - a width of the output image.
+        \param [in] dstHeight - a height of the output image.
+        \param [in] dstStride - a row size of the output image.
+    */
+    SIMD_API void SimdStretchGray2x2(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+        uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
+
+    /*! @ingroup svm
+
+        \fn void SimdSvmSumLinear(const float * x, const float * svs, const float * weights, size_t length, size_t count, float * sum);
+
+        \short It is a part of linear SVM (Support Vector Machine) prediction algorithm.
+
+        Algorithm's details:
+        \verbatim
+        sum = 0;
+        for(i = 0; i < count; ++i)
+            for(j = 0; j < length; ++j)
+                sum += x[j]*svs[j][i]*weight[i];
+        \endverbatim
+
+        \note The array with support vectors must has following structure: svs[length][count].
+
+        \param [in] x - a vector of features which need to predict with using SVM.
+        \param [in] svs - an array with support vectors.
+        \param [in] weights - a weight coefficient of each support vector.
+        \param [in] length - a length of these current and support vectors.
+        \param [in] count - a count of support vectors.
+        \param [out] sum - a pointer to result sum.
+    */
+    SIMD_API void SimdSvmSumLinear(const float * x, const float * svs, const float * weights, size_t length, size_t count, float * sum);
+
+    /*! @ingroup svm
+        Describes type of SVM (Support Vector Machine) kernel. It is used in function ::SimdSvmInit.
+    */
+    typedef enum
+    {
+        /*!
+            Linear kernel. It has no parameters.
+            \verbatim
+            K(x, sv) = x*sv;
+            \endverbatim
+        */
+        SimdSvmKernelLinear,
+        /*!
+            Polynomial kernel. It has three parameters: gamma (params[0]), coef0 (params[1]) and degree (params[2]).
+            \verbatim
+            K(x, sv) = pow(gamma*x*sv + coef0, degree);
+            \endverbatim
+        */
+        SimdSvmKernelPolynomial,
+        /*!
+            Radial basis function (RBF) kernel. It has one parameter: gamma (params[0]).
+            \verbatim
+            K(x, sv) = exp(-gamma*|x - sv|^2);
+            \endverbatim
+        */
+        SimdSvmKernelRbf,
+        /*!
+            Sigmoid kernel. It has two parameters: gamma (params[0]) and coef0 (params[1]).
+            \verbatim
+            K(x, sv) = tanh(gamma*x*sv + coef0);
+            \endverbatim
+        */
+        SimdSvmKernelSigmoid,
+    } SimdSvmKernelType;
+
+    /*! @ingroup svm
+
+        \fn void * SimdSvmInit(const float * svs, const float * weights, size_t length, size_t count, const float * bias, SimdSvmKernelType kernel, const float * params);
+
+        \short Creates SVM (Support Vector Machine) prediction context.
+
+        The decision function of the model:
+        \verbatim
+        decision = bias;
+        for(i = 0; i < count; ++i)
+            decision += weights[i]*K(x, svs[i]);
+        \endverbatim
+
+        For linear kernel all support vectors are collapsed into one weight vector during initialization.
+        For other kernels the support vectors are stored in form suitable for matrix multiplication of sample batches.
+
+        \note The array with support vectors must has following structure: svs[count][length].
+
+        \param [in] svs - an array with support vectors.
+        \param [in] weights - a weight coefficient of each support vector.
+        \param [in] length - a length of sample and support vectors.
+        \param [in] count - a count of support vectors.
+        \param [in] bias - a pointer to bias of decision function. Can be NULL (zero bias).
+        \param [in] kernel - a type of SVM kernel (see ::SimdSvmKernelType).
+        \param [in] params - a pointer to parameters of the kernel (see ::SimdSvmKernelType). Can be NULL for linear kernel.
+        \return a pointer to SVM context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in function ::SimdSvmPredict.
+    */
+    SIMD_API void * SimdSvmInit(const float * svs, const float * weights, size_t length, size_t count, const float * bias, SimdSvmKernelType kernel, const float * params);
+
+    /*! @ingroup svm
+
+        \fn void SimdSvmPredict(const void * svm, const float * samples, size_t number, float * decisions);
+
+        \short Calculates SVM decision function for a batch of samples.
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] svm - a pointer to SVM context. It must be created by function ::SimdSvmInit and released by function ::SimdRelease.
+        \param [in] samples - a pointer to array with samples. Its size must be equal to number*length.
+        \param [in] number - a number of samples.
+        \param [out] decisions - a pointer to output array with decisions. Its size must be equal to number.
+    */
+    SIMD_API void SimdSvmPredict(const void * svm, const float * samples, size_t number, float * decisions);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetAddBias(const float * bias, size_t count, size_t size, float * dst, SimdBool trans);
+
+        \short Adds a bias to given vector.
+
+        Algorithm's details:
+        \verbatim
+        for(i = 0; i < count; ++i)
+            for(j = 0; j < size; ++j)
+                if(trans)
+                    dst[i + j*count] += bias[i];
+                else
+                    dst[i*size + j] += bias[i];
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] bias - a pointer to the 32-bit float array with bias coefficients.
+        \param [in] count - a size of bias array.
+        \param [in] size - an internal size of bias addition.
+        \param [in, out] dst - a pointer to cumulative 32-bit float array. The size of the array must be equal to count*size.
+        \param [in] trans - a flag of transposed data.
+    */
+    SIMD_API void SimdSynetAddBias(const float * bias, size_t count, size_t size, float * dst, SimdBool trans);
+
+    /*! @ingroup synet
+        Describes operation type used in function ::SimdSynetEltwiseLayerForward.
+    */
+    typedef enum
+    {
+        SimdSynetEltwiseOperationProduct, /*!< Product. */
+        SimdSynetEltwiseOperationSum, /*!< Weighted sum. */
+        SimdSynetEltwiseOperationMax, /*!< Maximum. */
+        SimdSynetEltwiseOperationMin, /*!< Minimum. */
+    } SimdSynetEltwiseOperationType;
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetDetectionDecode32f(const float * loc, const float * prior, size_t count, float * dst);
+
+        \short Decodes bounding boxes of SSD-like detector (CENTER_SIZE code type of DetectionOutputLayer).
+
+        Algorithm's details (for every box):
+        \verbatim
+        priorW = prior[2] - prior[0];
+        priorH = prior[3] - prior[1];
+        centerX = variance[0]*loc[0]*priorW + (prior[0] + prior[2])/2;
+        centerY = variance[1]*loc[1]*priorH + (prior[1] + prior[3])/2;
+        halfW = exp(variance[2]*loc[2])*priorW/2;
+        halfH = exp(variance[3]*loc[3])*priorH/2;
+        dst[0] = centerX - halfW;
+        dst[1] = centerY - halfH;
+        dst[2] = centerX + halfW;
+        dst[3] = centerY + halfH;
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] loc - a pointer to the 32-bit float array with box regressions. The size of the array must be equal to 4*count.
+        \param [in] prior - a pointer to the 32-bit float array with prior boxes (xmin, ymin, xmax, ymax) followed by their variances (as output of PriorBoxLayer). The size of the array must be equal to 8*count.
+        \param [in] count - a number of boxes.
+        \param [out] dst - a pointer to the output 32-bit float array with decoded boxes (xmin, ymin, xmax, ymax). The size of the array must be equal to 4*count.
+    */
+    SIMD_API void SimdSynetDetectionDecode32f(const float * loc, const float * prior, size_t count, float * dst);
+
+    /*! @ingroup synet
+
+        \fn size_t SimdSynetDetectionNms32f(const float * boxes, const float * scores, size_t count, size_t classes, ptrdiff_t background, float scoreThreshold, float nmsThreshold, size_t topK, size_t keepTopK, SimdBool classAware, float * dst);
+
+        \short Selects detections with help of score thresholding and non-maximum suppression (NMS).
+
+        For every class (or for all classes together if classAware is ::SimdFalse) the function selects boxes with score greater than scoreThreshold,
+        sorts them in descending order of score, keeps first topK of them and greedily suppresses boxes which have IoU (intersection over union)
+        with already kept boxes greater than nmsThreshold. After that it keeps first keepTopK detections with the highest score.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] boxes - a pointer to the 32-bit float array with boxes (xmin, ymin, xmax, ymax) (see ::SimdSynetDetectionDecode32f). The size of the array must be equal to 4*count.
+        \param [in] scores - a pointer to the 32-bit float array with scores of boxes (for example output of ::SimdSynetSoftmaxLayerForward). The size of the array must be equal to count*classes.
+        \param [in] count - a number of boxes.
+        \param [in] classes - a number of classes.
+        \param [in] background - an index of background class. It is ignored if it is negative.
+        \param [in] scoreThreshold - a minimal score of selected boxes.
+        \param [in] nmsThreshold - a IoU threshold of non-maximum suppression.
+        \param [in] topK - a maximal number of boxes per class which participate in non-maximum suppression. Zero value means no restriction.
+        \param [in] keepTopK - a maximal number of output detections.
+        \param [in] classAware - a flag of class-aware non-maximum suppression. If it is ::SimdFalse then boxes of different classes suppress each other.
+        \param [out] dst - a pointer to the output 32-bit float array with detections (label, score, xmin, ymin, xmax, ymax) sorted in descending order of score. The size of the array must be at least 6*keepTopK.
+        \return a number of output detections.
+    */
+    SIMD_API size_t SimdSynetDetectionNms32f(const float * boxes, const float * scores, size_t count, size_t classes, ptrdiff_t background, float scoreThreshold, 
+        float nmsThreshold, size_t topK, size_t keepTopK, SimdBool classAware, float * dst);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetEltwiseLayerForward(float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst);
+
+        \short This function is used for forward propagation of EltwiseLayer.
+
+        Algorithm's details for ::SimdSynetEltwiseOperationProduct:
+        \verbatim
+        for(j = 0; j < size; ++j)
+            dst[j] = 1;
+        for(i = 0; i < count; ++i)
+            for(j = 0; j < size; ++j)
+                dst[j] *= src[i][j];
+        \endverbatim
+
+        Algorithm's details for ::SimdSynetEltwiseOperationSum:
+        \verbatim
+        for(j = 0; j < size; ++j)
+            dst[j] = 0;
+        for(i = 0; i < count; ++i)
+            for(j = 0; j < size; ++j)
+                dst[j] += src[i][j]*weight[i];
+        \endverbatim
+
+        Algorithm's details for ::SimdSynetEltwiseOperationMax:
+        \verbatim
+        for(j = 0; j < size; ++j)
+            dst[j] = -FLT_MAX;
+        for(i = 0; i < count; ++i)
+            for(j = 0; j < size; ++j)
+                dst[j] = max(dst[j], src[i][j]);
+        \endverbatim
+
+        Algorithm's details for ::SimdSynetEltwiseOperationMin:
+        \verbatim
+        for(j = 0; j < size; ++j)
+            dst[j] = FLT_MAX;
+        for(i = 0; i < count; ++i)
+            for(j = 0; j < size; ++j)
+                dst[j] = min(dst[j], src[i][j]);
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to poitres to the input 32-bit float arrays. 
+        \param [in] weight - a pointer to the 32-bit float array with sum coefficients. It is need only for ::SimdSynetEltwiseOperationSum operation type otherwise it can be NULL.
+        \param [in] count - a count of input arrays. Must be at least 2.
+        \param [in] size - a size of the input and output arrays.
+        \param [in] type - a type of operation (see ::SimdSynetEltwiseOperationType).
+        \param [out] dst - a pointer to the output 32-bit float array.
+    */
+    SIMD_API void SimdSynetEltwiseLayerForward(float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetFusedLayerForward0(const float * src, const float * bias, const float * scale, size_t count, size_t size, float * dst, SimdBool trans);
+
+        \short This function is used for forward propagation of FusedLayer (type 0).
+
+        Algorithm's details:
+        \verbatim
+        for(i = 0; i < count; ++i)
+            for(j = 0; j < size; ++j)
+            {
+                if(trans)
+                    o = i + j*count;
+                else
+                    o = i*size + j;
+                x = src[o] + bias[i];
+                dst[o] = (x - abs(x))*scale[i] + max(0, x);
+            }
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to count*size.
+        \param [in] bias - a pointer to the 32-bit float array with bias coefficients.
+        \param [in] scale - a pointer to the 32-bit float array with scale coefficients.
+        \param [in] count - a size of bias and scale arrays.
+        \param [in] size - an internal size of the operation.
+        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to count*size.
+        \param [in] trans - a flag of transposed data.
+    */
+    SIMD_API void SimdSynetFusedLayerForward0(const float * src, const float * bias, const float * scale, size_t count, size_t size, float * dst, SimdBool trans);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetFusedLayerForward1(const float * src, const float * bias0, const float * scale1, const float * bias1, size_t count, size_t size, float * dst, SimdBool trans);
+
+        \short This function is used for forward propagation of FusedLayer (type 1).
+
+        Algorithm's details:
+        \verbatim
+        for(i = 0; i < count; ++i)
+            for(j = 0; j < size; ++j)
+            {
+                if(trans)
+                    o = i + j*count;
+                else
+                    o = i*size + j;
+                x = src[o] + bias0[i];
+                dst[o] = max(0, -x)*scale1[i] + bias1[i] + max(0, x);
+            }
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to count*size.
+        \param [in] bias0 - a pointer to the 32-bit float array with bias0 coefficients.
+        \param [in] scale1 - a pointer to the 32-bit float array with scale1 coefficients.
+        \param [in] bias1 - a pointer to the 32-bit float array with bias1 coefficients.
+        \param [in] count - a size of bias and scale arrays.
+        \param [in] size - an internal size of the operation.
+        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to count*size.
+        \param [in] trans - a flag of transposed data.
+    */
+    SIMD_API void SimdSynetFusedLayerForward1(const float * src, const float * bias0, const float * scale1, const float * bias1, size_t count, size_t size, float * dst, SimdBool trans);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetFusedLayerForward2(const float * src, const float * scale, const float * bias, size_t count, size_t size, const float * slope, float * dst, SimdBool trans);
+
+        \short This function is used for forward propagation of FusedLayer (type 2).
+
+        Algorithm's details:
+        \verbatim
+        for(i = 0; i < count; ++i)
+            for(j = 0; j < size; ++j)
+            {
+                if(trans)
+                    o = i + j*count;
+                else
+                    o = i*size + j;
+                x = src[o]*scale[i]  + bias[i];
+                dst[o] = max(0, x) + min(0, x)*slope[0];
+            }
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to count*size.
+        \param [in] scale - a pointer to the 32-bit float array with scale coefficients.
+        \param [in] bias - a pointer to the 32-bit float array with bias coefficients.
+        \param [in] count - a size of bias and scale arrays.
+        \param [in] size - an internal size of the operation.
+        \param [in] slope - a pointer to the 32-bit float slope coefficient.
+        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to count*size.
+        \param [in] trans - a flag of transposed data.
+    */
+    SIMD_API void SimdSynetFusedLayerForward2(const float * src, const float * scale, const float * bias, size_t count, size_t size, const float * slope, float * dst, SimdBool trans);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetFusedLayerForward3(const float * src, const float * bias, const float * scale, size_t count, size_t size, float * dst, SimdBool trans);
+
+        \short This function is used for forward propagation of FusedLayer (type 3).
+
+        Algorithm's details:
+        \verbatim
+        for(i = 0; i < count; ++i)
+            for(j = 0; j < size; ++j)
+            {
+                if(trans)
+                    o = i + j*count;
+                else
+                    o = i*size + j;
+                x = src[o] + bias[i];
+                dst[o] = max(0, x) + min(0, x)*scale[i];
+            }
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to count*size.
+        \param [in] bias - a pointer to the 32-bit float array with bias coefficients.
+        \param [in] scale - a pointer to the 32-bit float array with scale coefficients.
+        \param [in] count - a size of bias and scale arrays.
+        \param [in] size - an internal size of the operation.
+        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to count*size.
+        \param [in] trans - a flag of transposed data.
+    */
+    SIMD_API void SimdSynetFusedLayerForward3(const float * src, const float * bias, const float * scale, size_t count, size_t size, float * dst, SimdBool trans);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetFusedLayerForward4(const float * src, const float * bias0, const float * scale1, const float * bias1, size_t count, size_t size, float * dst, SimdBool trans);
+
+        \short This function is used for forward propagation of FusedLayer (type 4).
+
+        Algorithm's details:
+        \verbatim
+        if(trans)
+            for(j = 0; j < size; ++j)
+                for(i = 0; i < count; ++i)
+                {
+                    x = src[i + j*count] + bias0[i];
+                    dst[i + count*2*j] = std::max((T)0, x);
+                    dst[i + count*2*j + count] = std::max((T)0, x*scale1[0] + bias1[0]);
+                }
+        else
+            for(i = 0; i < count; ++i)
+                for(j = 0; j < size; ++j)
+                {
+                    x = src[i*size + j] + bias0[i];
+                    dst[i*size + j] = std::max((T)0, x);
+                    dst[i*size + j + size*count] = std::max((T)0, x*scale1[0] + bias1[0]);
+                }
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to count*size.
+        \param [in] bias0 - a pointer to the 32-bit float array with bias0 coefficients.
+        \param [in] scale1 - a pointer to the 32-bit float array with scale1 coefficients.
+        \param [in] bias1 - a pointer to the 32-bit float array with bias1 coefficients.
+        \param [in] count - a size of bias and scale arrays.
+        \param [in] size - an internal size of the operation.
+        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to 2*count*size.
+        \param [in] trans - a flag of transposed data.
+    */
+    SIMD_API void SimdSynetFusedLayerForward4(const float * src, const float * bias0, const float * scale1, const float * bias1, size_t count, size_t size, float * dst, SimdBool trans);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetInnerProductLayerForward(const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst);
+
+        \short This function is used for forward propagation of InnerProductLayer.
+
+        Algorithm's details:
+        \verbatim
+        for(i = 0; i < count; ++i)
+        {
+            dst[i] = (bias ? bias[i] : 0);
+            for(j = 0; j < size; ++j)
+               dst[i] += src[j]*weight[i*size + j];
+        }
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to size.
+        \param [in] weight - a pointer to the 32-bit float array with weight coefficients. The size of the array must be equal to count*size.
+        \param [in] bias - a pointer to the 32-bit float array with bias coefficients. The size of the array must be equal to count. Can be NULL. 
+        \param [in] count - a size of output array.
+        \param [in] size - a size of input array.
+        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to count.
+    */
+    SIMD_API void SimdSynetInnerProductLayerForward(const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetLrnLayerCrossChannels(const float * src, size_t half, size_t count, size_t size, const float * k, float * dst);
+
+        \short This function is used for forward propagation of LrnLayer (cross channels normalization).
+
+        Algorithm's details:
+        \verbatim
+        for(i = 0; i < count; ++i)
+            for(j = 0; j < size; ++j)
+            {
+                lo = Max(0, i - half);
+                ln = Min(count, i + half + 1);
+                sum = 0;
+                for(l = lo; l < ln; ++l)
+                    sum += Square(src[l*size + j]);
+                dst[i*size + j] = src[i*size + j]*Pow(k[0] + sum*k[1], k[2]);
+            }
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to count*size.
+        \param [in] half - a local normalization half size.
+        \param [in] count - a channels count.
+        \param [in] size - an internal size of the operation.
+        \param [in] k - a pointer to the 32-bit float array with 3 coefficients (see algorithm details). 
+        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to count*size.
+    */
+    SIMD_API void SimdSynetLrnLayerCrossChannels(const float * src, size_t half, size_t count, size_t size, const float * k, float * dst);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetPoolingForwardMax(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX, size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdBool trans);
+
+        \short This function is used for forward propagation of PoolingLayer (MaxPooling).
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to srcC*srcH*srcW.
+        \param [in] srcC - a number of input and output channels.
+        \param [in] srcH - an input height.
+        \param [in] srcW - an input width.
+        \param [in] kernelY - a height of the pooling kernel.
+        \param [in] kernelX - a width of the pooling kernel.
+        \param [in] strideY - a y-stride of the pooling.
+        \param [in] strideX - a x-stride of the pooling.
+        \param [in] padY - a pad to the top of the input image.
+        \param [in] padX - a pad to the left of the input image.
+        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to srcC*dstH*dstW.
+        \param [in] dstH - an output height.
+        \param [in] dstW - an output width.
+        \param [in] trans - a flag of transposed input and output data (::SimdFalse - CHW order, ::SimdTrue - HWC order).
+    */
+    SIMD_API void SimdSynetPoolingForwardMax(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX, 
+        size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdBool trans);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetPreluLayerForward(const float * src, const float * slope, size_t count, size_t size, float * dst, SimdBool trans);
+
+        \short This function is used for forward propagation of PreluLayer (PReLU).
+
+        Algorithm's details:
+        \verbatim
+        for(i = 0; i < count; ++i)
+            for(j = 0; j < size; ++j)
+                if(trans)
+                    o = i + j*count;
+                else
+                    o = i*size + j;
+                dst[o] = src[o] > 0 ? src[o] : slope[i]*src[o];
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to count*size.
+        \param [in] slope - a pointer to the 32-bit float array with slope coefficients.
+        \param [in] count - a size of bias array.
+        \param [in] size - an internal size of bias addition.
+        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to count*size.
+        \param [in] trans - a flag of transposed data.
+    */
+    SIMD_API void SimdSynetPreluLayerForward(const float * src, const float * slope, size_t count, size_t size, float * dst, SimdBool trans);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetRestrictRange(const float * src, size_t size, const float * lower, const float * upper, float * dst);
+
+        \short This function is used in order to restrict range for given array.
+
+        Algorithm's details:
+        \verbatim
+        for(i = 0; i < size; ++i)
+            dst[i] = Min(Max(lower, src[i]), upper);
+        }
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array.
+        \param [in] size - a size of input and output arrays.
+        \param [in] lower - a pointer to lower restrict bound.
+        \param [in] upper - a pointer to upper restrict bound.
+        \param [out] dst - a pointer to the output 32-bit float array.
+    */
+    SIMD_API void SimdSynetRestrictRange(const float * src, size_t size, const float * lower, const float * upper, float * dst);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetScaleLayerForward(const float * src, const float * scale, const float * bias, size_t count, size_t size, float * dst, SimdBool trans);
+
+        \short This function is used for forward propagation of ScaleLayer.
+
+        Algorithm's details:
+        \verbatim
+        for(i = 0; i < count; ++i)
+            for(j = 0; j < size; ++j)
+                if(trans)
+                    dst[i + j*count] = src[i + j*count]*scale[i] + (bias ? bias[i] : 0);
+                else
+                    dst[i*size + j] = src[i*size + j]*scale[i] + (bias ? bias[i] : 0);
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to count*size.
+        \param [in] scale - a pointer to the 32-bit float array with scale coefficients.
+        \param [in] bias - a pointer to the 32-bit float array with bias coefficients. Can be NULL.
+        \param [in] count - a size of scale and bias arrays.
+        \param [in] size - an internal size of the operation.
+        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to count*size.
+        \param [in] trans - a flag of transposed data.
+    */
+    SIMD_API void SimdSynetScaleLayerForward(const float * src, const float * scale, const float * bias, size_t count, size_t size, float * dst, SimdBool trans);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetSoftmaxLayerForward(const float * src, size_t outer, size_t count, size_t inner, float * dst);
+
+        \short This function is used for forward propagation of SoftmaxLayer.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to outer*count*inner.
+        \param [in] outer - an outer size of input and output arrays.
+        \param [in] count - a size of softmax dimmension.
+        \param [in] inner - an inner size of input and output arrays.
+        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to outer*count*inner.
+    */
+    SIMD_API void SimdSynetSoftmaxLayerForward(const float * src, size_t outer, size_t count, size_t inner, float * dst);
+
+    /*! @ingroup texture_estimation
+
+        \fn void SimdTextureBoostedSaturatedGradient(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t saturation, uint8_t boost, uint8_t * dx, size_t dxStride, uint8_t * dy, size_t dyStride);
+
+        \short Calculates boosted saturated gradients for given input image.
+
+        All images must have the same width, height and format (8-bit gray).
+
+        For border pixels:
+        \verbatim
+        dx[x, y] = 0;
+        dy[x, y] = 0;
+        \endverbatim
+        For other pixels:
+        \verbatim
+        dx[x, y] = (saturation + max(-saturation, min(saturation, (src[x + 1, y] - src[x - 1, y]))))*boost;
+        dy[x, y] = (saturation + max(-saturation, min(saturation, (src[x, y + 1] - src[x, y - 1]))))*boost;
+        \endverbatim
+
+        \note This function has a C++ wrappers: Simd::TextureBoostedSaturatedGradient(const View<A>& src, uint8_t saturation, uint8_t boost, View<A>& dx, View<A>& dy).
+
+        \param [in] src - a pointer to pixels data of source 8-bit gray image.
+        \param [in] srcStride - a row size of source image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] saturation - a saturation of gradient.
+        \param [in] boost - a boost coefficient.
+        \param [out] dx - a pointer to pixels data of image with boosted saturated gradient along x axis.
+        \param [in] dxStride - a row size of dx image.
+        \param [out] dy - a pointer to pixels data of image with boosted saturated gradient along y axis.
+        \param [in] dyStride - a row size of dy image.
     */
-    SIMD_API void SimdValueSquareSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * valueSum, uint64_t * squareSum);
-	
-    /*! @ingroup other_statistic
+    SIMD_API void SimdTextureBoostedSaturatedGradient(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        uint8_t saturation, uint8_t boost, uint8_t * dx, size_t dxStride, uint8_t * dy, size_t dyStride);
 
-        \fn void SimdCorrelationSum(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, uint64_t * sum);
+    /*! @ingroup texture_estimation
 
-        \short Gets sum of pixel correlation for two gray 8-bit images.
+        \fn void SimdTextureBoostedUv(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t boost, uint8_t * dst, size_t dstStride);
 
-        For all points:
+        \short Calculates boosted colorized texture feature of input image (actual for U and V components of YUV format).
+
+        All images must have the same width, height and format (8-bit gray).
+
+        For every pixel:
         \verbatim
-        sum += a[i]*b[i];
+        lo = 128 - (128/boost);
+        hi = 255 - lo;
+        dst[x, y] = max(lo, min(hi, src[i]))*boost;
         \endverbatim
 
-        All images must have the same width and height and 8-bit gray pixel format.
-
-        \note This function has a C++ wrappers: Simd::CorrelationSum(const View<A> & a, const View<A> & b, uint64_t & sum).
+        \note This function has a C++ wrappers: Simd::TextureBoostedUv(const View<A>& src, uint8_t boost, View<A>& dst).
 
-        \param [in] a - a pointer to pixels data of the first image.
-        \param [in] aStride - a row size of the first image.
-        \param [in] b - a pointer to pixels data of the second image.
-        \param [in] bStride - a row size of the second image.
-        \param [in] width - an images width.
-        \param [in] height - an images height.
-        \param [out] sum - a pointer to result sum.
+        \param [in] src - a pointer to pixels data of source 8-bit gray image.
+        \param [in] srcStride - a row size of source image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] boost - a boost coefficient.
+        \param [out] dst - a pointer to pixels data of result image.
+        \param [in] dstStride - a row size of destination image.
     */
-    SIMD_API void SimdCorrelationSum(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, uint64_t * sum);
+    SIMD_API void SimdTextureBoostedUv(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        uint8_t boost, uint8_t * dst, size_t dstStride);
 
-    /*! @ingroup resizing
+    /*! @ingroup texture_estimation
 
-        \fn void SimdStretchGray2x2(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
+        \fn void SimdTextureGetDifferenceSum(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * lo, size_t loStride, const uint8_t * hi, size_t hiStride, int64_t * sum);
 
-        \short Stretches input 8-bit gray image in two times.
+        \short Calculates difference between current image and background.
 
-        \note This function has a C++ wrappers: Simd::StretchGray2x2(const View<A>& src, View<A>& dst).
+        All images must have the same width, height and format (8-bit gray).
 
-        \param [in] src - a pointer to pixels data of the original input image.
-        \param [in] srcWidth - a width of the input image.
-        \param [in] srcHeight - a height of the input image.
-        \param [in] srcStride - a row size of the input image.
-        \param [out] dst - a pointer to pixels data of the stretched output image.
-        \param [in] dstWidth - a width of the output image.
-        \param [in] dstHeight - a height of the output image.
-        \param [in] dstStride - a row size of the output image.
+        For every pixel:
+        \verbatim
+        sum += current - average(lo[i], hi[i]);
+        \endverbatim
+
+        \note This function has a C++ wrappers: Simd::TextureGetDifferenceSum(const View<A>& src, const View<A>& lo, const View<A>& hi, int64_t & sum).
+
+        \param [in] src - a pointer to pixels data of current image.
+        \param [in] srcStride - a row size of current image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] lo - a pointer to pixels data of image with lower bound of background feature.
+        \param [in] loStride - a row size of lo image.
+        \param [in] hi - a pointer to pixels data of image with upper bound of background feature.
+        \param [in] hiStride - a row size of hi image.
+        \param [out] sum - a pointer to 64-bit integer with result sum.
     */
-    SIMD_API void SimdStretchGray2x2(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
-        uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
+    SIMD_API void SimdTextureGetDifferenceSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        const uint8_t * lo, size_t loStride, const uint8_t * hi, size_t hiStride, int64_t * sum);
 
-    /*! @ingroup svm
+    /*! @ingroup texture_estimation
 
-        \fn void SimdSvmSumLinear(const float * x, const float * svs, const float * weights, size_t length, size_t count, float * sum);
+        \fn void SimdTexturePerformCompensation(const uint8_t * src, size_t srcStride, size_t width, size_t height, int32_t shift, uint8_t * dst, size_t dstStride);
 
-        \short It is a part of linear SVM (Support Vector Machine) prediction algorithm.
+        \short Performs brightness compensation of input image.
 
-        Algorithm's details:
+        All images must have the same width, height and format (8-bit gray).
+
+        For every pixel:
         \verbatim
-        sum = 0;
-        for(i = 0; i < count; ++i)
-            for(j = 0; j < length; ++j)
-                sum += x[j]*svs[j][i]*weight[i];
+        dst[i] = max(0, min(255, src[i] + shift));
         \endverbatim
 
-        \note The array with support vectors must has following structure: svs[length][count].
+        \note This function has a C++ wrappers: Simd::TexturePerformCompensation(const View<A>& src, int shift, View<A>& dst).
 
-        \param [in] x - a vector of features which need to predict with using SVM.
-        \param [in] svs - an array with support vectors.
-        \param [in] weights - a weight coefficient of each support vector.
-        \param [in] length - a length of these current and support vectors.
-        \param [in] count - a count of support vectors.
-        \param [out] sum - a pointer to result sum.
+        \param [in] src - a pointer to pixels data of input image.
+        \param [in] srcStride - a row size of input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] shift - a compensation shift.
+        \param [out] dst - a pointer to pixels data of output image.
+        \param [in] dstStride - a row size of output image.
     */
-    SIMD_API void SimdSvmSumLinear(const float * x, const float * svs, const float * weights, size_t length, size_t count, float * sum);
+    SIMD_API void SimdTexturePerformCompensation(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        int32_t shift, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup transform
+        Describes transform type used in function ::SimdTransformImage in order to describe result of transformation.
+    */
+    typedef enum
+    {
+        SimdTransformRotate0 = 0, /*!< An original image. The output image has the same size as input image.*/
+        SimdTransformRotate90, /*!< Image rotated 90 degrees counterclockwise. The output width and height are equal to the input height and widht. */
+        SimdTransformRotate180, /*!< Image rotated 180 degrees counterclockwise. The output image has the same size as input image. */
+        SimdTransformRotate270, /*!< Image rotated 270 degrees counterclockwise. The output width and height are equal to the input height and widht. */
+        SimdTransformTransposeRotate0, /*!< Transposed image. The output width and height are equal to the input height and widht. */
+        SimdTransformTransposeRotate90, /*!< Image transposed and rotated 90 degrees counterclockwise. It is equal to horizontal mirroring of image. The output image has the same size as input image.*/
+        SimdTransformTransposeRotate180, /*!< Image transposed and rotated 180 degrees counterclockwise. The output width and height are equal to the input height and widht. */
+        SimdTransformTransposeRotate270, /*!< Image transposed and rotated 270 degrees counterclockwise. It is equal to vertical mirroring of image. The output image has the same size as input image.*/
+    } SimdTransformType;
+
+    /*! @ingroup transform
+
+        \fn void SimdTransformImage(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, SimdTransformType transform, uint8_t * dst, size_t dstStride);
+
+        \short Performs transformation of input image. The type of transformation is defined by ::SimdTransformType enumeration.
+
+        \note This function has a C++ wrappers: Simd::TransformImage(const View<A> & src, ::SimdTransformType transform, View<A> & dst).
+
+        \param [in] src - a pointer to pixels data of input image.
+        \param [in] srcStride - a row size of input image.
+        \param [in] width - an input image width. 
+        \param [in] height - an input image height.
+        \param [in] pixelSize - a pixel size in input and output images. It can be 1, 2, 3, 4.
+        \param [in] transform - a type of image transformation.
+        \param [out] dst - a pointer to pixels data of output image.
+        \param [in] dstStride - a row size of output image.
+    */
+    SIMD_API void SimdTransformImage(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, SimdTransformType transform, uint8_t * dst, size_t dstStride);
 
     /*! @ingroup synet
 
-        \fn void SimdSynetAddBias(const float * bias, size_t count, size_t size, float * dst, SimdBool trans);
+        \fn void SimdWinograd2x3SetFilter(const float * src, size_t size, float * dst, SimdBool trans);
 
-        \short Adds a bias to given vector.
+        \short This function is used for filter conversion in Winograd 2x3 convolution algorithm.
 
-        Algorithm's details:
-        \verbatim
-        for(i = 0; i < count; ++i)
-            for(j = 0; j < size; ++j)
-                if(trans)
-                    dst[i + j*count] += bias[i];
-                else
-                    dst[i*size + j] += bias[i];
-        \endverbatim
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array with filter weights.
+        \param [in] size - (number of input channels)*(number of output channels).
+        \param [out] dst - a pointer to the output 32-bit float array with filter weights.
+        \param [in] trans - a flag of transposed data.
+    */
+    SIMD_API void SimdWinograd2x3SetFilter(const float * src, size_t size, float * dst, SimdBool trans);
+
+    /*! @ingroup synet
+
+        \fn void SimdWinograd2x3SetInput(const float * src, size_t srcChannels, size_t srcHeight, size_t srcWidth, float * dst, size_t dstStride, SimdBool pad, SimdBool trans);
+
+        \short This function is used for input image conversion in Winograd 2x3 convolution algorithm.
 
         \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
 
-        \param [in] bias - a pointer to the 32-bit float array with bias coefficients.
-        \param [in] count - a size of bias array.
-        \param [in] size - an internal size of bias addition.
-        \param [in, out] dst - a pointer to cumulative 32-bit float array. The size of the array must be equal to count*size.
+        \param [in] src - a pointer to the input image.
+        \param [in] srcChannels - a number of input channels.
+        \param [in] srcHeight - a height of input image.
+        \param [in] srcWidth - a width of input image.
+        \param [out] dst - a pointer to the output array with converted image.
+        \param [in] dstStride - a stride of output image.
+        \param [in] pad - a flag to signalize padding.
+        \param [in] trans - a flag of transposed data.
+    */
+    SIMD_API void SimdWinograd2x3SetInput(const float * src, size_t srcChannels, size_t srcHeight, size_t srcWidth, float * dst, size_t dstStride, SimdBool pad, SimdBool trans);
+
+    /*! @ingroup synet
+
+        \fn void SimdWinograd2x3SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
+
+        \short This function is used for output image conversion in Winograd 2x3 convolution algorithm.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input image.
+        \param [in] srcStride - a stride of input image.
+        \param [out] dst - a pointer to the output image.
+        \param [in] dstChannels - a number of output channels.
+        \param [in] dstHeight - a height of output image.
+        \param [in] dstWidth - a width of output image.
+        \param [in] trans - a flag of transposed data.
+    */
+    SIMD_API void SimdWinograd2x3SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
+
+    /*! @ingroup synet
+
+        \fn void SimdWinograd4x3SetFilter(const float * src, size_t size, float * dst);
+
+        \short This function is used for filter conversion in Winograd 4x3 convolution algorithm.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array with filter weights.
+        \param [in] size - (number of input channels)*(number of output channels).
+        \param [out] dst - a pointer to the output 32-bit float array with filter weights.
         \param [in] trans - a flag of transposed data.
     */
-    SIMD_API void SimdSynetAddBias(const float * bias, size_t count, size_t size, float * dst, SimdBool trans);
+    SIMD_API void SimdWinograd4x3SetFilter(const float * src, size_t size, float * dst, SimdBool trans);
 
     /*! @ingroup synet
-        Describes operation type used in function ::SimdSynetEltwiseLayerForward.
-    */
-    typedef enum
-    {
-        SimdSynetEltwiseOperationProduct, /*!< Product. */
-        SimdSynetEltwiseOperationSum, /*!< Weighted sum. */
-        SimdSynetEltwiseOperationMax, /*!< Maximum. */
-        SimdSynetEltwiseOperationMin, /*!< Minimum. */
-    } SimdSynetEltwiseOperationType;
 
-    /*! @ingroup synet
+        \fn void SimdWinograd4x3SetInput(const float * src, size_t srcChannels, size_t srcHeight, size_t srcWidth, float * dst, size_t dstStride, SimdBool pad, SimdBool trans);
 
-        \fn void SimdSynetEltwiseLayerForward(float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst);
+        \short This function is used for input image conversion in Winograd 4x3 convolution algorithm.
 
-        \short This function is used for forward propagation of EltwiseLayer.
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
 
-        Algorithm's details for ::SimdSynetEltwiseOperationProduct:
-        \verbatim
-        for(j = 0; j < size; ++j)
-            dst[j] = 1;
-        for(i = 0; i < count; ++i)
-            for(j = 0; j < size; ++j)
-                dst[j] *= src[i][j];
-        \endverbatim
+        \param [in] src - a pointer to the input image.
+        \param [in] srcChannels - a number of input channels.
+        \param [in] srcHeight - a height of input image.
+        \param [in] srcWidth - a width of input image.
+        \param [out] dst - a pointer to the output array with converted image.
+        \param [in] dstStride - a stride of output image.
+        \param [in] pad - a flag to signalize padding.
+        \param [in] trans - a flag of transposed data.
+    */
+    SIMD_API void SimdWinograd4x3SetInput(const float * src, size_t srcChannels, size_t srcHeight, size_t srcWidth, float * dst, size_t dstStride, SimdBool pad, SimdBool trans);
 
-        Algorithm's details for ::SimdSynetEltwiseOperationSum:
-        \verbatim
-        for(j = 0; j < size; ++j)
-            dst[j] = 0;
-        for(i = 0; i < count; ++i)
-            for(j = 0; j < size; ++j)
-                dst[j] += src[i][j]*weight[i];
-        \endverbatim
+    /*! @ingroup synet
 
-        Algorithm's details for ::SimdSynetEltwiseOperationMax:
-        \verbatim
-        for(j = 0; j < size; ++j)
-            dst[j] = -FLT_MAX;
-        for(i = 0; i < count; ++i)
-            for(j = 0; j < size; ++j)
-                dst[j] = max(dst[j], src[i][j]);
-        \endverbatim
+        \fn void SimdWinograd4x3SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
 
-        Algorithm's details for ::SimdSynetEltwiseOperationMin:
-        \verbatim
-        for(j = 0; j < size; ++j)
-            dst[j] = FLT_MAX;
-        for(i = 0; i < count; ++i)
-            for(j = 0; j < size; ++j)
-                dst[j] = min(dst[j], src[i][j]);
-        \endverbatim
+        \short This function is used for output image conversion in Winograd 4x3 convolution algorithm.
 
         \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
 
-        \param [in] src - a pointer to poitres to the input 32-bit float arrays. 
-        \param [in] weight - a pointer to the 32-bit float array with sum coefficients. It is need only for ::SimdSynetEltwiseOperationSum operation type otherwise it can be NULL.
-        \param [in] count - a count of input arrays. Must be at least 2.
-        \param [in] size - a size of the input and output arrays.
-        \param [in] type - a type of operation (see ::SimdSynetEltwiseOperationType).
-        \param [out] dst - a pointer to the output 32-bit float array.
+        \param [in] src - a pointer to the input image.
+        \param [in] srcStride - a stride of input image.
+        \param [out] dst - a pointer to the output image.
+        \param [in] dstChannels - a number of output channels.
+        \param [in] dstHeight - a height of output image.
+        \param [in] dstWidth - a width of output image.
+        \param [in] trans - a flag of transposed data.
     */
-    SIMD_API void SimdSynetEltwiseLayerForward(float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst);
+    SIMD_API void SimdWinograd4x3SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
 
-    /*! @ingroup synet
+    /*! @ingroup yuv_conversion
 
-        \fn void SimdSynetFusedLayerForward0(const float * src, const float * bias, const float * scale, size_t count, size_t size, float * dst, SimdBool trans);
+        \fn void SimdNv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
 
-        \short This function is used for forward propagation of FusedLayer (type 0).
+        \short Converts NV12 image to 24-bit BGR image.
 
-        Algorithm's details:
-        \verbatim
-        for(i = 0; i < count; ++i)
-            for(j = 0; j < size; ++j)
-            {
-                if(trans)
-                    o = i + j*count;
-                else
-                    o = i*size + j;
-                x = src[o] + bias[i];
-                dst[o] = (x - abs(x))*scale[i] + max(0, x);
-            }
-        \endverbatim
+        The input Y and output BGR images must have the same width and height.
+        The input UV image has interleaved U and V components (16 bits per pixel) and half size relative to Y component.
 
-        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+        \note This function has a C++ wrapper Simd::Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr).
 
-        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to count*size.
-        \param [in] bias - a pointer to the 32-bit float array with bias coefficients.
-        \param [in] scale - a pointer to the 32-bit float array with scale coefficients.
-        \param [in] count - a size of bias and scale arrays.
-        \param [in] size - an internal size of the operation.
-        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to count*size.
-        \param [in] trans - a flag of transposed data.
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input image with interleaved U and V color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
     */
-    SIMD_API void SimdSynetFusedLayerForward0(const float * src, const float * bias, const float * scale, size_t count, size_t size, float * dst, SimdBool trans);
+    SIMD_API void SimdNv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
 
-    /*! @ingroup synet
+    /*! @ingroup yuv_conversion
 
-        \fn void SimdSynetFusedLayerForward1(const float * src, const float * bias0, const float * scale1, const float * bias1, size_t count, size_t size, float * dst, SimdBool trans);
+        \fn void SimdNv12ToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
 
-        \short This function is used for forward propagation of FusedLayer (type 1).
+        \short Converts NV12 image to 24-bit BGR image with using of given YUV color matrix.
 
-        Algorithm's details:
-        \verbatim
-        for(i = 0; i < count; ++i)
-            for(j = 0; j < size; ++j)
-            {
-                if(trans)
-                    o = i + j*count;
-                else
-                    o = i*size + j;
-                x = src[o] + bias0[i];
-                dst[o] = max(0, -x)*scale1[i] + bias1[i] + max(0, x);
-            }
-        \endverbatim
+        The input Y and output BGR images must have the same width and height.
+        The input UV image has interleaved U and V components (16 bits per pixel) and half size relative to Y component.
 
-        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+        \note This function has a C++ wrapper Simd::Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType).
 
-        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to count*size.
-        \param [in] bias0 - a pointer to the 32-bit float array with bias0 coefficients.
-        \param [in] scale1 - a pointer to the 32-bit float array with scale1 coefficients.
-        \param [in] bias1 - a pointer to the 32-bit float array with bias1 coefficients.
-        \param [in] count - a size of bias and scale arrays.
-        \param [in] size - an internal size of the operation.
-        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to count*size.
-        \param [in] trans - a flag of transposed data.
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input image with interleaved U and V color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
     */
-    SIMD_API void SimdSynetFusedLayerForward1(const float * src, const float * bias0, const float * scale1, const float * bias1, size_t count, size_t size, float * dst, SimdBool trans);
+    SIMD_API void SimdNv12ToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
 
-    /*! @ingroup synet
+    /*! @ingroup yuv_conversion
 
-        \fn void SimdSynetFusedLayerForward2(const float * src, const float * scale, const float * bias, size_t count, size_t size, const float * slope, float * dst, SimdBool trans);
+        \fn void SimdNv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
-        \short This function is used for forward propagation of FusedLayer (type 2).
+        \short Converts NV12 image to 32-bit BGRA image.
 
-        Algorithm's details:
-        \verbatim
-        for(i = 0; i < count; ++i)
-            for(j = 0; j < size; ++j)
-            {
-                if(trans)
-                    o = i + j*count;
-                else
-                    o = i*size + j;
-                x = src[o]*scale[i]  + bias[i];
-                dst[o] = max(0, x) + min(0, x)*slope[0];
-            }
-        \endverbatim
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image has interleaved U and V components (16 bits per pixel) and half size relative to Y component.
 
-        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+        \note This function has a C++ wrapper Simd::Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha).
 
-        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to count*size.
-        \param [in] scale - a pointer to the 32-bit float array with scale coefficients.
-        \param [in] bias - a pointer to the 32-bit float array with bias coefficients.
-        \param [in] count - a size of bias and scale arrays.
-        \param [in] size - an internal size of the operation.
-        \param [in] slope - a pointer to the 32-bit float slope coefficient.
-        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to count*size.
-        \param [in] trans - a flag of transposed data.
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input image with interleaved U and V color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
     */
-    SIMD_API void SimdSynetFusedLayerForward2(const float * src, const float * scale, const float * bias, size_t count, size_t size, const float * slope, float * dst, SimdBool trans);
+    SIMD_API void SimdNv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
-    /*! @ingroup synet
+    /*! @ingroup yuv_conversion
 
-        \fn void SimdSynetFusedLayerForward3(const float * src, const float * bias, const float * scale, size_t count, size_t size, float * dst, SimdBool trans);
+        \fn void SimdNv12ToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
 
-        \short This function is used for forward propagation of FusedLayer (type 3).
+        \short Converts NV12 image to 32-bit BGRA image with using of given YUV color matrix.
 
-        Algorithm's details:
-        \verbatim
-        for(i = 0; i < count; ++i)
-            for(j = 0; j < size; ++j)
-            {
-                if(trans)
-                    o = i + j*count;
-                else
-                    o = i*size + j;
-                x = src[o] + bias[i];
-                dst[o] = max(0, x) + min(0, x)*scale[i];
-            }
-        \endverbatim
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image has interleaved U and V components (16 bits per pixel) and half size relative to Y component.
 
-        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+        \note This function has a C++ wrapper Simd::Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha, SimdYuvType yuvType).
 
-        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to count*size.
-        \param [in] bias - a pointer to the 32-bit float array with bias coefficients.
-        \param [in] scale - a pointer to the 32-bit float array with scale coefficients.
-        \param [in] count - a size of bias and scale arrays.
-        \param [in] size - an internal size of the operation.
-        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to count*size.
-        \param [in] trans - a flag of transposed data.
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input image with interleaved U and V color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
     */
-    SIMD_API void SimdSynetFusedLayerForward3(const float * src, const float * bias, const float * scale, size_t count, size_t size, float * dst, SimdBool trans);
+    SIMD_API void SimdNv12ToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
 
-    /*! @ingroup synet
+    /*! @ingroup yuv_conversion
 
-        \fn void SimdSynetFusedLayerForward4(const float * src, const float * bias0, const float * scale1, const float * bias1, size_t count, size_t size, float * dst, SimdBool trans);
+        \fn void SimdNv12ToHue(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * hue, size_t hueStride);
 
-        \short This function is used for forward propagation of FusedLayer (type 4).
+        \short Converts NV12 image to 8-bit image with Hue component of HSV or HSL color space.
 
-        Algorithm's details:
-        \verbatim
-        if(trans)
-            for(j = 0; j < size; ++j)
-                for(i = 0; i < count; ++i)
-                {
-                    x = src[i + j*count] + bias0[i];
-                    dst[i + count*2*j] = std::max((T)0, x);
-                    dst[i + count*2*j + count] = std::max((T)0, x*scale1[0] + bias1[0]);
-                }
-        else
-            for(i = 0; i < count; ++i)
-                for(j = 0; j < size; ++j)
-                {
-                    x = src[i*size + j] + bias0[i];
-                    dst[i*size + j] = std::max((T)0, x);
-                    dst[i*size + j + size*count] = std::max((T)0, x*scale1[0] + bias1[0]);
-                }
-        \endverbatim
+        The input Y and output Hue images must have the same width and height.
+        The input UV image has interleaved U and V components (16 bits per pixel) and half size relative to Y component.
+
+        \note This function has a C++ wrapper Simd::Nv12ToHue(const View<A>& y, const View<A>& uv, View<A>& hue).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input image with interleaved U and V color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] hue - a pointer to pixels data of output 8-bit Hue image.
+        \param [in] hueStride - a row size of the hue image.
+    */
+    SIMD_API void SimdNv12ToHue(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+        size_t width, size_t height, uint8_t * hue, size_t hueStride);
+
+    /*! @ingroup yuv_conversion
 
-        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+        \fn void SimdNv12ToHueV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * hue, size_t hueStride, SimdYuvType yuvType);
 
-        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to count*size.
-        \param [in] bias0 - a pointer to the 32-bit float array with bias0 coefficients.
-        \param [in] scale1 - a pointer to the 32-bit float array with scale1 coefficients.
-        \param [in] bias1 - a pointer to the 32-bit float array with bias1 coefficients.
-        \param [in] count - a size of bias and scale arrays.
-        \param [in] size - an internal size of the operation.
-        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to 2*count*size.
-        \param [in] trans - a flag of transposed data.
+        \short Converts NV12 image to 8-bit image with Hue component of HSV or HSL color space with using of given YUV color matrix.
+
+        The input Y and output Hue images must have the same width and height.
+        The input UV image has interleaved U and V components (16 bits per pixel) and half size relative to Y component.
+
+        \note This function has a C++ wrapper Simd::Nv12ToHue(const View<A>& y, const View<A>& uv, View<A>& hue, SimdYuvType yuvType).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input image with interleaved U and V color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] hue - a pointer to pixels data of output 8-bit Hue image.
+        \param [in] hueStride - a row size of the hue image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
     */
-    SIMD_API void SimdSynetFusedLayerForward4(const float * src, const float * bias0, const float * scale1, const float * bias1, size_t count, size_t size, float * dst, SimdBool trans);
+    SIMD_API void SimdNv12ToHueV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+        size_t width, size_t height, uint8_t * hue, size_t hueStride, SimdYuvType yuvType);
 
-    /*! @ingroup synet
+    /*! @ingroup yuv_conversion
 
-        \fn void SimdSynetInnerProductLayerForward(const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst);
+        \fn void SimdNv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
 
-        \short This function is used for forward propagation of InnerProductLayer.
+        \short Converts NV21 image to 24-bit BGR image.
 
-        Algorithm's details:
-        \verbatim
-        for(i = 0; i < count; ++i)
-        {
-            dst[i] = (bias ? bias[i] : 0);
-            for(j = 0; j < size; ++j)
-               dst[i] += src[j]*weight[i*size + j];
-        }
-        \endverbatim
+        The input Y and output BGR images must have the same width and height.
+        The input VU image has interleaved V and U components (16 bits per pixel) and half size relative to Y component.
 
-        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+        \note This function has a C++ wrapper Simd::Nv21ToBgr(const View<A>& y, const View<A>& vu, View<A>& bgr).
 
-        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to size.
-        \param [in] weight - a pointer to the 32-bit float array with weight coefficients. The size of the array must be equal to count*size.
-        \param [in] bias - a pointer to the 32-bit float array with bias coefficients. The size of the array must be equal to count. Can be NULL. 
-        \param [in] count - a size of output array.
-        \param [in] size - a size of input array.
-        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to count.
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] vu - a pointer to pixels data of input image with interleaved V and U color planes.
+        \param [in] vuStride - a row size of the vu image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
     */
-    SIMD_API void SimdSynetInnerProductLayerForward(const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst);
+    SIMD_API void SimdNv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
 
-    /*! @ingroup synet
+    /*! @ingroup yuv_conversion
 
-        \fn void SimdSynetLrnLayerCrossChannels(const float * src, size_t half, size_t count, size_t size, const float * k, float * dst);
+        \fn void SimdNv21ToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
 
-        \short This function is used for forward propagation of LrnLayer (cross channels normalization).
+        \short Converts NV21 image to 24-bit BGR image with using of given YUV color matrix.
 
-        Algorithm's details:
-        \verbatim
-        for(i = 0; i < count; ++i)
-            for(j = 0; j < size; ++j)
-            {
-                lo = Max(0, i - half);
-                ln = Min(count, i + half + 1);
-                sum = 0;
-                for(l = lo; l < ln; ++l)
-                    sum += Square(src[l*size + j]);
-                dst[i*size + j] = src[i*size + j]*Pow(k[0] + sum*k[1], k[2]);
-            }
-        \endverbatim
+        The input Y and output BGR images must have the same width and height.
+        The input VU image has interleaved V and U components (16 bits per pixel) and half size relative to Y component.
 
-        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+        \note This function has a C++ wrapper Simd::Nv21ToBgr(const View<A>& y, const View<A>& vu, View<A>& bgr, SimdYuvType yuvType).
 
-        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to count*size.
-        \param [in] half - a local normalization half size.
-        \param [in] count - a channels count.
-        \param [in] size - an internal size of the operation.
-        \param [in] k - a pointer to the 32-bit float array with 3 coefficients (see algorithm details). 
-        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to count*size.
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] vu - a pointer to pixels data of input image with interleaved V and U color planes.
+        \param [in] vuStride - a row size of the vu image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
     */
-    SIMD_API void SimdSynetLrnLayerCrossChannels(const float * src, size_t half, size_t count, size_t size, const float * k, float * dst);
+    SIMD_API void SimdNv21ToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
 
-    /*! @ingroup synet
+    /*! @ingroup yuv_conversion
 
-        \fn void SimdSynetPoolingForwardMax(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX, size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdBool trans);
+        \fn void SimdNv21ToBgra(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
-        \short This function is used for forward propagation of PoolingLayer (MaxPooling).
+        \short Converts NV21 image to 32-bit BGRA image.
 
-        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+        The input Y and output BGRA images must have the same width and height.
+        The input VU image has interleaved V and U components (16 bits per pixel) and half size relative to Y component.
 
-        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to srcC*srcH*srcW.
-        \param [in] srcC - a number of input and output channels.
-        \param [in] srcH - an input height.
-        \param [in] srcW - an input width.
-        \param [in] kernelY - a height of the pooling kernel.
-        \param [in] kernelX - a width of the pooling kernel.
-        \param [in] strideY - a y-stride of the pooling.
-        \param [in] strideX - a x-stride of the pooling.
-        \param [in] padY - a pad to the top of the input image.
-        \param [in] padX - a pad to the left of the input image.
-        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to srcC*dstH*dstW.
-        \param [in] dstH - an output height.
-        \param [in] dstW - an output width.
-        \param [in] trans - a flag of transposed input and output data (::SimdFalse - CHW order, ::SimdTrue - HWC order).
+        \note This function has a C++ wrapper Simd::Nv21ToBgra(const View<A>& y, const View<A>& vu, View<A>& bgra, uint8_t alpha).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] vu - a pointer to pixels data of input image with interleaved V and U color planes.
+        \param [in] vuStride - a row size of the vu image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
     */
-    SIMD_API void SimdSynetPoolingForwardMax(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX, 
-        size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdBool trans);
+    SIMD_API void SimdNv21ToBgra(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
-    /*! @ingroup synet
+    /*! @ingroup yuv_conversion
 
-        \fn void SimdSynetPreluLayerForward(const float * src, const float * slope, size_t count, size_t size, float * dst, SimdBool trans);
+        \fn void SimdNv21ToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
 
-        \short This function is used for forward propagation of PreluLayer (PReLU).
+        \short Converts NV21 image to 32-bit BGRA image with using of given YUV color matrix.
 
-        Algorithm's details:
-        \verbatim
-        for(i = 0; i < count; ++i)
-            for(j = 0; j < size; ++j)
-                if(trans)
-                    o = i + j*count;
-                else
-                    o = i*size + j;
-                dst[o] = src[o] > 0 ? src[o] : slope[i]*src[o];
-        \endverbatim
+        The input Y and output BGRA images must have the same width and height.
+        The input VU image has interleaved V and U components (16 bits per pixel) and half size relative to Y component.
 
-        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+        \note This function has a C++ wrapper Simd::Nv21ToBgra(const View<A>& y, const View<A>& vu, View<A>& bgra, uint8_t alpha, SimdYuvType yuvType).
 
-        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to count*size.
-        \param [in] slope - a pointer to the 32-bit float array with slope coefficients.
-        \param [in] count - a size of bias array.
-        \param [in] size - an internal size of bias addition.
-        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to count*size.
-        \param [in] trans - a flag of transposed data.
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] vu - a pointer to pixels data of input image with interleaved V and U color planes.
+        \param [in] vuStride - a row size of the vu image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
     */
-    SIMD_API void SimdSynetPreluLayerForward(const float * src, const float * slope, size_t count, size_t size, float * dst, SimdBool trans);
+    SIMD_API void SimdNv21ToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
 
-    /*! @ingroup synet
+    /*! @ingroup yuv_conversion
 
-        \fn void SimdSynetRestrictRange(const float * src, size_t size, const float * lower, const float * upper, float * dst);
+        \fn void SimdNv21ToHue(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height, uint8_t * hue, size_t hueStride);
 
-        \short This function is used in order to restrict range for given array.
+        \short Converts NV21 image to 8-bit image with Hue component of HSV or HSL color space.
 
-        Algorithm's details:
-        \verbatim
-        for(i = 0; i < size; ++i)
-            dst[i] = Min(Max(lower, src[i]), upper);
-        }
-        \endverbatim
+        The input Y and output Hue images must have the same width and height.
+        The input VU image has interleaved V and U components (16 bits per pixel) and half size relative to Y component.
 
-        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+        \note This function has a C++ wrapper Simd::Nv21ToHue(const View<A>& y, const View<A>& vu, View<A>& hue).
 
-        \param [in] src - a pointer to the input 32-bit float array.
-        \param [in] size - a size of input and output arrays.
-        \param [in] lower - a pointer to lower restrict bound.
-        \param [in] upper - a pointer to upper restrict bound.
-        \param [out] dst - a pointer to the output 32-bit float array.
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] vu - a pointer to pixels data of input image with interleaved V and U color planes.
+        \param [in] vuStride - a row size of the vu image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] hue - a pointer to pixels data of output 8-bit Hue image.
+        \param [in] hueStride - a row size of the hue image.
     */
-    SIMD_API void SimdSynetRestrictRange(const float * src, size_t size, const float * lower, const float * upper, float * dst);
+    SIMD_API void SimdNv21ToHue(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+        size_t width, size_t height, uint8_t * hue, size_t hueStride);
 
-    /*! @ingroup synet
+    /*! @ingroup yuv_conversion
 
-        \fn void SimdSynetScaleLayerForward(const float * src, const float * scale, const float * bias, size_t count, size_t size, float * dst, SimdBool trans);
+        \fn void SimdNv21ToHueV2(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height, uint8_t * hue, size_t hueStride, SimdYuvType yuvType);
 
-        \short This function is used for forward propagation of ScaleLayer.
+        \short Converts NV21 image to 8-bit image with Hue component of HSV or HSL color space with using of given YUV color matrix.
 
-        Algorithm's details:
-        \verbatim
-        for(i = 0; i < count; ++i)
-            for(j = 0; j < size; ++j)
-                if(trans)
-                    dst[i + j*count] = src[i + j*count]*scale[i] + (bias ? bias[i] : 0);
-                else
-                    dst[i*size + j] = src[i*size + j]*scale[i] + (bias ? bias[i] : 0);
-        \endverbatim
+        The input Y and output Hue images must have the same width and height.
+        The input VU image has interleaved V and U components (16 bits per pixel) and half size relative to Y component.
 
-        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+        \note This function has a C++ wrapper Simd::Nv21ToHue(const View<A>& y, const View<A>& vu, View<A>& hue, SimdYuvType yuvType).
 
-        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to count*size.
-        \param [in] scale - a pointer to the 32-bit float array with scale coefficients.
-        \param [in] bias - a pointer to the 32-bit float array with bias coefficients. Can be NULL.
-        \param [in] count - a size of scale and bias arrays.
-        \param [in] size - an internal size of the operation.
-        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to count*size.
-        \param [in] trans - a flag of transposed data.
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] vu - a pointer to pixels data of input image with interleaved V and U color planes.
+        \param [in] vuStride - a row size of the vu image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] hue - a pointer to pixels data of output 8-bit Hue image.
+        \param [in] hueStride - a row size of the hue image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
     */
-    SIMD_API void SimdSynetScaleLayerForward(const float * src, const float * scale, const float * bias, size_t count, size_t size, float * dst, SimdBool trans);
+    SIMD_API void SimdNv21ToHueV2(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+        size_t width, size_t height, uint8_t * hue, size_t hueStride, SimdYuvType yuvType);
 
-    /*! @ingroup synet
+    /*! @ingroup yuv_conversion
 
-        \fn void SimdSynetSoftmaxLayerForward(const float * src, size_t outer, size_t count, size_t inner, float * dst);
+        \fn void SimdP016ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdBool dither, SimdYuvType yuvType, uint8_t * buffer);
 
-        \short This function is used for forward propagation of SoftmaxLayer.
+        \short Converts P016 (P010, P012) image to 24-bit BGR image.
 
-        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+        The input Y and output BGR images must have the same width and height.
+        The input UV image has interleaved U and V components (2 x 16 bits per pixel) and half size relative to Y component.
+        The samples of P010, P012 and P016 images are aligned to most significant bit so they are converted in the same way.
 
-        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to outer*count*inner.
-        \param [in] outer - an outer size of input and output arrays.
-        \param [in] count - a size of softmax dimmension.
-        \param [in] inner - an inner size of input and output arrays.
-        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to outer*count*inner.
-    */
-    SIMD_API void SimdSynetSoftmaxLayerForward(const float * src, size_t outer, size_t count, size_t inner, float * dst);
+        \note This function has a C++ wrapper Simd::P016ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, bool dither, SimdYuvType yuvType, uint8_t * buffer).
 
-    /*! @ingroup texture_estimation
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved U and V color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] dither - a flag of ordered dithering. If it is ::SimdFalse then rounding is used.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
+        \param [in, out] buffer - a pointer to external temporary buffer of size ::SimdYuv16BufferSize(width). Can be NULL (the function allocates internal buffer).
+    */
+    SIMD_API void SimdP016ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdBool dither, SimdYuvType yuvType, uint8_t * buffer);
 
-        \fn void SimdTextureBoostedSaturatedGradient(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t saturation, uint8_t boost, uint8_t * dx, size_t dxStride, uint8_t * dy, size_t dyStride);
+    /*! @ingroup yuv_conversion
 
-        \short Calculates boosted saturated gradients for given input image.
+        \fn void SimdP016ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdBool dither, SimdYuvType yuvType, uint8_t * buffer);
 
-        All images must have the same width, height and format (8-bit gray).
+        \short Converts P016 (P010, P012) image to 32-bit BGRA image.
 
-        For border pixels:
-        \verbatim
-        dx[x, y] = 0;
-        dy[x, y] = 0;
-        \endverbatim
-        For other pixels:
-        \verbatim
-        dx[x, y] = (saturation + max(-saturation, min(saturation, (src[x + 1, y] - src[x - 1, y]))))*boost;
-        dy[x, y] = (saturation + max(-saturation, min(saturation, (src[x, y + 1] - src[x, y - 1]))))*boost;
-        \endverbatim
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image has interleaved U and V components (2 x 16 bits per pixel) and half size relative to Y component.
+        The samples of P010, P012 and P016 images are aligned to most significant bit so they are converted in the same way.
 
-        \note This function has a C++ wrappers: Simd::TextureBoostedSaturatedGradient(const View<A>& src, uint8_t saturation, uint8_t boost, View<A>& dx, View<A>& dy).
+        \note This function has a C++ wrapper Simd::P016ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha, bool dither, SimdYuvType yuvType, uint8_t * buffer).
 
-        \param [in] src - a pointer to pixels data of source 8-bit gray image.
-        \param [in] srcStride - a row size of source image.
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved U and V color planes.
+        \param [in] uvStride - a row size of the uv image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] saturation - a saturation of gradient.
-        \param [in] boost - a boost coefficient.
-        \param [out] dx - a pointer to pixels data of image with boosted saturated gradient along x axis.
-        \param [in] dxStride - a row size of dx image.
-        \param [out] dy - a pointer to pixels data of image with boosted saturated gradient along y axis.
-        \param [in] dyStride - a row size of dy image.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] dither - a flag of ordered dithering. If it is ::SimdFalse then rounding is used.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
+        \param [in, out] buffer - a pointer to external temporary buffer of size ::SimdYuv16BufferSize(width). Can be NULL (the function allocates internal buffer).
     */
-    SIMD_API void SimdTextureBoostedSaturatedGradient(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-        uint8_t saturation, uint8_t boost, uint8_t * dx, size_t dxStride, uint8_t * dy, size_t dyStride);
-
-    /*! @ingroup texture_estimation
+    SIMD_API void SimdP016ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdBool dither, SimdYuvType yuvType, uint8_t * buffer);
 
-        \fn void SimdTextureBoostedUv(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t boost, uint8_t * dst, size_t dstStride);
+    /*! @ingroup yuv_conversion
 
-        \short Calculates boosted colorized texture feature of input image (actual for U and V components of YUV format).
+        \fn void SimdYuva420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, const uint8_t * a, size_t aStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride);
 
-        All images must have the same width, height and format (8-bit gray).
+        \short Converts YUVA420P image to 32-bit BGRA image.
 
-        For every pixel:
-        \verbatim
-        lo = 128 - (128/boost);
-        hi = 255 - lo;
-        dst[x, y] = max(lo, min(hi, src[i]))*boost;
-        \endverbatim
+        The input Y, A and output BGRA images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
 
-        \note This function has a C++ wrappers: Simd::TextureBoostedUv(const View<A>& src, uint8_t boost, View<A>& dst).
+        \note This function has a C++ wrappers: Simd::Yuva420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, const View<A> & a, View<A>& bgra).
 
-        \param [in] src - a pointer to pixels data of source 8-bit gray image.
-        \param [in] srcStride - a row size of source image.
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] a - a pointer to pixels data of input 8-bit image with alpha channel.
+        \param [in] aStride - a row size of the a image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] boost - a boost coefficient.
-        \param [out] dst - a pointer to pixels data of result image.
-        \param [in] dstStride - a row size of destination image.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
     */
-    SIMD_API void SimdTextureBoostedUv(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-        uint8_t boost, uint8_t * dst, size_t dstStride);
-
-    /*! @ingroup texture_estimation
+    SIMD_API void SimdYuva420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, 
+        const uint8_t * a, size_t aStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride);
 
-        \fn void SimdTextureGetDifferenceSum(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * lo, size_t loStride, const uint8_t * hi, size_t hiStride, int64_t * sum);
+    /*! @ingroup yuv_conversion
 
-        \short Calculates difference between current image and background.
+        \fn void SimdYuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
 
-        All images must have the same width, height and format (8-bit gray).
+        \short Converts YUV420P image to 24-bit BGR image.
 
-        For every pixel:
-        \verbatim
-        sum += current - average(lo[i], hi[i]);
-        \endverbatim
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
 
-        \note This function has a C++ wrappers: Simd::TextureGetDifferenceSum(const View<A>& src, const View<A>& lo, const View<A>& hi, int64_t & sum).
+        \note This function has a C++ wrappers: Simd::Yuv420pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr);
 
-        \param [in] src - a pointer to pixels data of current image.
-        \param [in] srcStride - a row size of current image.
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] lo - a pointer to pixels data of image with lower bound of background feature.
-        \param [in] loStride - a row size of lo image.
-        \param [in] hi - a pointer to pixels data of image with upper bound of background feature.
-        \param [in] hiStride - a row size of hi image.
-        \param [out] sum - a pointer to 64-bit integer with result sum.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
     */
-    SIMD_API void SimdTextureGetDifferenceSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-        const uint8_t * lo, size_t loStride, const uint8_t * hi, size_t hiStride, int64_t * sum);
-
-    /*! @ingroup texture_estimation
+    SIMD_API void SimdYuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
 
-        \fn void SimdTexturePerformCompensation(const uint8_t * src, size_t srcStride, size_t width, size_t height, int32_t shift, uint8_t * dst, size_t dstStride);
+    /*! @ingroup yuv_conversion
 
-        \short Performs brightness compensation of input image.
+        \fn void SimdYuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
 
-        All images must have the same width, height and format (8-bit gray).
+        \short Converts YUV420P image to 24-bit BGR image with using of given YUV color matrix.
 
-        For every pixel:
-        \verbatim
-        dst[i] = max(0, min(255, src[i] + shift));
-        \endverbatim
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
 
-        \note This function has a C++ wrappers: Simd::TexturePerformCompensation(const View<A>& src, int shift, View<A>& dst).
+        \note This function has a C++ wrappers: Simd::Yuv420pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType);
 
-        \param [in] src - a pointer to pixels data of input image.
-        \param [in] srcStride - a row size of input image.
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] shift - a compensation shift.
-        \param [out] dst - a pointer to pixels data of output image.
-        \param [in] dstStride - a row size of output image.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
     */
-    SIMD_API void SimdTexturePerformCompensation(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-        int32_t shift, uint8_t * dst, size_t dstStride);
+    SIMD_API void SimdYuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
 
-    /*! @ingroup transform
-        Describes transform type used in function ::SimdTransformImage in order to describe result of transformation.
-    */
-    typedef enum
-    {
-        SimdTransformRotate0 = 0, /*!< An original image. The output image has the same size as input image.*/
-        SimdTransformRotate90, /*!< Image rotated 90 degrees counterclockwise. The output width and height are equal to the input height and widht. */
-        SimdTransformRotate180, /*!< Image rotated 180 degrees counterclockwise. The output image has the same size as input image. */
-        SimdTransformRotate270, /*!< Image rotated 270 degrees counterclockwise. The output width and height are equal to the input height and widht. */
-        SimdTransformTransposeRotate0, /*!< Transposed image. The output width and height are equal to the input height and widht. */
-        SimdTransformTransposeRotate90, /*!< Image transposed and rotated 90 degrees counterclockwise. It is equal to horizontal mirroring of image. The output image has the same size as input image.*/
-        SimdTransformTransposeRotate180, /*!< Image transposed and rotated 180 degrees counterclockwise. The output width and height are equal to the input height and widht. */
-        SimdTransformTransposeRotate270, /*!< Image transposed and rotated 270 degrees counterclockwise. It is equal to vertical mirroring of image. The output image has the same size as input image.*/
-    } SimdTransformType;
+    /*! @ingroup yuv_conversion
 
-    /*! @ingroup transform
+        \fn void SimdYuv420pToRgb(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride);
 
-        \fn void SimdTransformImage(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, SimdTransformType transform, uint8_t * dst, size_t dstStride);
+        \short Converts YUV420P image to 24-bit RGB image.
 
-        \short Performs transformation of input image. The type of transformation is defined by ::SimdTransformType enumeration.
+        The input Y and output RGB images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
 
-        \note This function has a C++ wrappers: Simd::TransformImage(const View<A> & src, ::SimdTransformType transform, View<A> & dst).
+        \note This function has a C++ wrappers: Simd::Yuv420pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb);
 
-        \param [in] src - a pointer to pixels data of input image.
-        \param [in] srcStride - a row size of input image.
-        \param [in] width - an input image width. 
-        \param [in] height - an input image height.
-        \param [in] pixelSize - a pixel size in input and output images. It can be 1, 2, 3, 4.
-        \param [in] transform - a type of image transformation.
-        \param [out] dst - a pointer to pixels data of output image.
-        \param [in] dstStride - a row size of output image.
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
     */
-    SIMD_API void SimdTransformImage(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, SimdTransformType transform, uint8_t * dst, size_t dstStride);
+    SIMD_API void SimdYuv420pToRgb(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * rgb, size_t rgbStride);
 
-    /*! @ingroup synet
+    /*! @ingroup yuv_conversion
 
-        \fn void SimdWinograd2x3SetFilter(const float * src, size_t size, float * dst, SimdBool trans);
+        \fn void SimdYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
 
-        \short This function is used for filter conversion in Winograd 2x3 convolution algorithm.
+        \short Converts YUV422P image to 24-bit BGR image.
 
-        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
 
-        \param [in] src - a pointer to the input 32-bit float array with filter weights.
-        \param [in] size - (number of input channels)*(number of output channels).
-        \param [out] dst - a pointer to the output 32-bit float array with filter weights.
-        \param [in] trans - a flag of transposed data.
+        \note This function has a C++ wrappers: Simd::Yuv422pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr);
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
     */
-    SIMD_API void SimdWinograd2x3SetFilter(const float * src, size_t size, float * dst, SimdBool trans);
+    SIMD_API void SimdYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
 
-    /*! @ingroup synet
+    /*! @ingroup yuv_conversion
 
-        \fn void SimdWinograd2x3SetInput(const float * src, size_t srcChannels, size_t srcHeight, size_t srcWidth, float * dst, size_t dstStride, SimdBool pad, SimdBool trans);
+        \fn void SimdYuv422pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
 
-        \short This function is used for input image conversion in Winograd 2x3 convolution algorithm.
+        \short Converts YUV422P image to 24-bit BGR image with using of given YUV color matrix.
 
-        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
 
-        \param [in] src - a pointer to the input image.
-        \param [in] srcChannels - a number of input channels.
-        \param [in] srcHeight - a height of input image.
-        \param [in] srcWidth - a width of input image.
-        \param [out] dst - a pointer to the output array with converted image.
-        \param [in] dstStride - a stride of output image.
-        \param [in] pad - a flag to signalize padding.
-        \param [in] trans - a flag of transposed data.
+        \note This function has a C++ wrappers: Simd::Yuv422pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType);
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
     */
-    SIMD_API void SimdWinograd2x3SetInput(const float * src, size_t srcChannels, size_t srcHeight, size_t srcWidth, float * dst, size_t dstStride, SimdBool pad, SimdBool trans);
+    SIMD_API void SimdYuv422pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
 
-    /*! @ingroup synet
+    /*! @ingroup yuv_conversion
 
-        \fn void SimdWinograd2x3SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
+        \fn void SimdYuv422pToRgb(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride);
 
-        \short This function is used for output image conversion in Winograd 2x3 convolution algorithm.
+        \short Converts YUV422P image to 24-bit RGB image.
 
-        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+        The input Y and output RGB images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
 
-        \param [in] src - a pointer to the input image.
-        \param [in] srcStride - a stride of input image.
-        \param [out] dst - a pointer to the output image.
-        \param [in] dstChannels - a number of output channels.
-        \param [in] dstHeight - a height of output image.
-        \param [in] dstWidth - a width of output image.
-        \param [in] trans - a flag of transposed data.
+        \note This function has a C++ wrappers: Simd::Yuv422pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb);
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
     */
-    SIMD_API void SimdWinograd2x3SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
+    SIMD_API void SimdYuv422pToRgb(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * rgb, size_t rgbStride);
 
-    /*! @ingroup synet
+    /*! @ingroup yuv_conversion
 
-        \fn void SimdWinograd4x3SetFilter(const float * src, size_t size, float * dst);
+        \fn void SimdYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
 
-        \short This function is used for filter conversion in Winograd 4x3 convolution algorithm.
+        \short Converts YUV444P image to 24-bit BGR image.
 
-        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+        The input Y, U, V and output BGR images must have the same width and height.
 
-        \param [in] src - a pointer to the input 32-bit float array with filter weights.
-        \param [in] size - (number of input channels)*(number of output channels).
-        \param [out] dst - a pointer to the output 32-bit float array with filter weights.
-        \param [in] trans - a flag of transposed data.
+        \note This function has a C++ wrappers: Simd::Yuv444pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr);
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
     */
-    SIMD_API void SimdWinograd4x3SetFilter(const float * src, size_t size, float * dst, SimdBool trans);
+    SIMD_API void SimdYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
 
-    /*! @ingroup synet
+    /*! @ingroup yuv_conversion
 
-        \fn void SimdWinograd4x3SetInput(const float * src, size_t srcChannels, size_t srcHeight, size_t srcWidth, float * dst, size_t dstStride, SimdBool pad, SimdBool trans);
+        \fn void SimdYuv444pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
 
-        \short This function is used for input image conversion in Winograd 4x3 convolution algorithm.
+        \short Converts YUV444P image to 24-bit BGR image with using of given YUV color matrix.
 
-        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+        The input Y, U, V and output BGR images must have the same width and height.
 
-        \param [in] src - a pointer to the input image.
-        \param [in] srcChannels - a number of input channels.
-        \param [in] srcHeight - a height of input image.
-        \param [in] srcWidth - a width of input image.
-        \param [out] dst - a pointer to the output array with converted image.
-        \param [in] dstStride - a stride of output image.
-        \param [in] pad - a flag to signalize padding.
-        \param [in] trans - a flag of transposed data.
+        \note This function has a C++ wrappers: Simd::Yuv444pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType);
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
     */
-    SIMD_API void SimdWinograd4x3SetInput(const float * src, size_t srcChannels, size_t srcHeight, size_t srcWidth, float * dst, size_t dstStride, SimdBool pad, SimdBool trans);
+    SIMD_API void SimdYuv444pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
 
-    /*! @ingroup synet
+    /*! @ingroup yuv_conversion
 
-        \fn void SimdWinograd4x3SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
+        \fn void SimdYuv444pToRgb(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride);
 
-        \short This function is used for output image conversion in Winograd 4x3 convolution algorithm.
+        \short Converts YUV444P image to 24-bit RGB image.
 
-        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+        The input Y, U, V and output RGB images must have the same width and height.
 
-        \param [in] src - a pointer to the input image.
-        \param [in] srcStride - a stride of input image.
-        \param [out] dst - a pointer to the output image.
-        \param [in] dstChannels - a number of output channels.
-        \param [in] dstHeight - a height of output image.
-        \param [in] dstWidth - a width of output image.
-        \param [in] trans - a flag of transposed data.
+        \note This function has a C++ wrappers: Simd::Yuv444pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb);
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
     */
-    SIMD_API void SimdWinograd4x3SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
+    SIMD_API void SimdYuv444pToRgb(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * rgb, size_t rgbStride);
 
     /*! @ingroup yuv_conversion
 
-        \fn void SimdYuva420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, const uint8_t * a, size_t aStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride);
+        \fn void SimdYuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
-        \short Converts YUVA420P image to 32-bit BGRA image.
+        \short Converts YUV420P image to 32-bit BGRA image.
 
-        The input Y, A and output BGRA images must have the same width and height.
+        The input Y and output BGRA images must have the same width and height.
         The input U and V images must have the same width and height (half size relative to Y component).
 
-        \note This function has a C++ wrappers: Simd::Yuva420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, const View<A> & a, View<A>& bgra).
+        \note This function has a C++ wrappers: Simd::Yuv420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha).
 
         \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
         \param [in] yStride - a row size of the y image.
@@ -6001,26 +8645,25 @@ extern "C"
         \param [in] uStride - a row size of the u image.
         \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
         \param [in] vStride - a row size of the v image.
-        \param [in] a - a pointer to pixels data of input 8-bit image with alpha channel.
-        \param [in] aStride - a row size of the a image.
         \param [in] width - an image width.
         \param [in] height - an image height.
         \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
         \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
     */
-    SIMD_API void SimdYuva420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, 
-        const uint8_t * a, size_t aStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride);
+    SIMD_API void SimdYuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
     /*! @ingroup yuv_conversion
 
-        \fn void SimdYuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+        \fn void SimdYuv420pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
 
-        \short Converts YUV420P image to 24-bit BGR image.
+        \short Converts YUV420P image to 32-bit BGRA image with using of given YUV color matrix.
 
-        The input Y and output BGR images must have the same width and height.
+        The input Y and output BGRA images must have the same width and height.
         The input U and V images must have the same width and height (half size relative to Y component).
 
-        \note This function has a C++ wrappers: Simd::Yuv420pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr);
+        \note This function has a C++ wrappers: Simd::Yuv420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha, SimdYuvType yuvType).
 
         \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
         \param [in] yStride - a row size of the y image.
@@ -6030,22 +8673,24 @@ extern "C"
         \param [in] vStride - a row size of the v image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
-        \param [in] bgrStride - a row size of the bgr image.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
     */
-    SIMD_API void SimdYuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
-        size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+    SIMD_API void SimdYuv420pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
 
     /*! @ingroup yuv_conversion
 
-        \fn void SimdYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+        \fn void SimdYuv420pToRgba(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * rgba, size_t rgbaStride, uint8_t alpha);
 
-        \short Converts YUV422P image to 24-bit BGR image.
+        \short Converts YUV420P image to 32-bit RGBA image.
 
-        The input Y and output BGR images must have the same width and height.
-        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+        The input Y and output RGBA images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
 
-        \note This function has a C++ wrappers: Simd::Yuv422pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr);
+        \note This function has a C++ wrappers: Simd::Yuv420pToRgba(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgba, uint8_t alpha).
 
         \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
         \param [in] yStride - a row size of the y image.
@@ -6055,21 +8700,23 @@ extern "C"
         \param [in] vStride - a row size of the v image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
-        \param [in] bgrStride - a row size of the bgr image.
+        \param [out] rgba - a pointer to pixels data of output 32-bit RGBA image.
+        \param [in] rgbaStride - a row size of the rgba image.
+        \param [in] alpha - a value of alpha channel.
     */
-    SIMD_API void SimdYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
-        size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+    SIMD_API void SimdYuv420pToRgba(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * rgba, size_t rgbaStride, uint8_t alpha);
 
     /*! @ingroup yuv_conversion
 
-        \fn void SimdYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+        \fn void SimdYuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
-        \short Converts YUV444P image to 24-bit BGR image.
+        \short Converts YUV422P image to 32-bit BGRA image.
 
-        The input Y, U, V and output BGR images must have the same width and height.
+        The input Y and output BGRA images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
 
-        \note This function has a C++ wrappers: Simd::Yuv444pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr);
+        \note This function has a C++ wrappers: Simd::Yuv422pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha).
 
         \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
         \param [in] yStride - a row size of the y image.
@@ -6079,22 +8726,23 @@ extern "C"
         \param [in] vStride - a row size of the v image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
-        \param [in] bgrStride - a row size of the bgr image.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
     */
-    SIMD_API void SimdYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
-        size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+    SIMD_API void SimdYuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
     /*! @ingroup yuv_conversion
 
-        \fn void SimdYuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+        \fn void SimdYuv422pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
 
-        \short Converts YUV420P image to 32-bit BGRA image.
+        \short Converts YUV422P image to 32-bit BGRA image with using of given YUV color matrix.
 
         The input Y and output BGRA images must have the same width and height.
-        The input U and V images must have the same width and height (half size relative to Y component).
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
 
-        \note This function has a C++ wrappers: Simd::Yuv420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha).
+        \note This function has a C++ wrappers: Simd::Yuv422pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha, SimdYuvType yuvType).
 
         \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
         \param [in] yStride - a row size of the y image.
@@ -6107,20 +8755,21 @@ extern "C"
         \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
         \param [in] bgraStride - a row size of the bgra image.
         \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
     */
-    SIMD_API void SimdYuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
-        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+    SIMD_API void SimdYuv422pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
 
     /*! @ingroup yuv_conversion
 
-        \fn void SimdYuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+        \fn void SimdYuv422pToRgba(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * rgba, size_t rgbaStride, uint8_t alpha);
 
-        \short Converts YUV422P image to 32-bit BGRA image.
+        \short Converts YUV422P image to 32-bit RGBA image.
 
-        The input Y and output BGRA images must have the same width and height.
+        The input Y and output RGBA images must have the same width and height.
         The input U and V images must have the same width and height (their width is equal to half width of Y component).
 
-        \note This function has a C++ wrappers: Simd::Yuv422pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha).
+        \note This function has a C++ wrappers: Simd::Yuv422pToRgba(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgba, uint8_t alpha).
 
         \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
         \param [in] yStride - a row size of the y image.
@@ -6130,12 +8779,12 @@ extern "C"
         \param [in] vStride - a row size of the v image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
-        \param [in] bgraStride - a row size of the bgra image.
+        \param [out] rgba - a pointer to pixels data of output 32-bit RGBA image.
+        \param [in] rgbaStride - a row size of the rgba image.
         \param [in] alpha - a value of alpha channel.
     */
-    SIMD_API void SimdYuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
-        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+    SIMD_API void SimdYuv422pToRgba(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * rgba, size_t rgbaStride, uint8_t alpha);
 
     /*! @ingroup yuv_conversion
 
@@ -6162,6 +8811,57 @@ extern "C"
     SIMD_API void SimdYuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
         size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv444pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts YUV444P image to 32-bit BGRA image with using of given YUV color matrix.
+
+        The input Y, U, V and output BGRA images must have the same width and height.
+
+        \note This function has a C++ wrappers: Simd::Yuv444pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha, SimdYuvType yuvType).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv444pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv444pToRgba(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * rgba, size_t rgbaStride, uint8_t alpha);
+
+        \short Converts YUV444P image to 32-bit RGBA image.
+
+        The input Y, U, V and output RGBA images must have the same width and height.
+
+        \note This function has a C++ wrappers: Simd::Yuv444pToRgba(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgba, uint8_t alpha).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgba - a pointer to pixels data of output 32-bit RGBA image.
+        \param [in] rgbaStride - a row size of the rgba image.
+        \param [in] alpha - a value of alpha channel.
+    */
+    SIMD_API void SimdYuv444pToRgba(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * rgba, size_t rgbaStride, uint8_t alpha);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv444pToHsl(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * hsl, size_t hslStride);
@@ -6186,6 +8886,31 @@ extern "C"
     SIMD_API void SimdYuv444pToHsl(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
         size_t width, size_t height, uint8_t * hsl, size_t hslStride);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv444pToHslV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * hsl, size_t hslStride, SimdYuvType yuvType);
+
+        \short Converts YUV444P image to 24-bit HSL(Hue, Saturation, Lightness) image with using of given YUV color matrix.
+
+        The input Y, U, V and output HSL images must have the same width and height.
+
+        \note This function has a C++ wrappers: Simd::Yuv444pToHsl(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& hsl, SimdYuvType yuvType).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] hsl - a pointer to pixels data of output 24-bit HSL image.
+        \param [in] hslStride - a row size of the hsl image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv444pToHslV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * hsl, size_t hslStride, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv444pToHsv(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * hsv, size_t hsvStride);
@@ -6210,6 +8935,31 @@ extern "C"
     SIMD_API void SimdYuv444pToHsv(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
         size_t width, size_t height, uint8_t * hsv, size_t hsvStride);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv444pToHsvV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * hsv, size_t hsvStride, SimdYuvType yuvType);
+
+        \short Converts YUV444P image to 24-bit HSV(Hue, Saturation, Value) image with using of given YUV color matrix.
+
+        The input Y, U, V and output HSV images must have the same width and height.
+
+        \note This function has a C++ wrappers: Simd::Yuv444pToHsv(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& hsv, SimdYuvType yuvType).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] hsv - a pointer to pixels data of output 24-bit HSV image.
+        \param [in] hsvStride - a row size of the hsv image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv444pToHsvV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * hsv, size_t hsvStride, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv420pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * hue, size_t hueStride);
@@ -6235,6 +8985,32 @@ extern "C"
     SIMD_API void SimdYuv420pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
         size_t width, size_t height, uint8_t * hue, size_t hueStride);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv420pToHueV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * hue, size_t hueStride, SimdYuvType yuvType);
+
+        \short Converts YUV420P image to 8-bit image with Hue component of HSV or HSL color space with using of given YUV color matrix.
+
+        The input Y and output Hue images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function has a C++ wrappers: Simd::Yuv420pToHue(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& hue, SimdYuvType yuvType).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] hue - a pointer to pixels data of output 8-bit Hue image.
+        \param [in] hueStride - a row size of the hue image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv420pToHueV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * hue, size_t hueStride, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv444pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * hue, size_t hueStride);
@@ -6259,6 +9035,106 @@ extern "C"
     SIMD_API void SimdYuv444pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
         size_t width, size_t height, uint8_t * hue, size_t hueStride);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv444pToHueV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * hue, size_t hueStride, SimdYuvType yuvType);
+
+        \short Converts YUV444P image to 8-bit image with Hue component of HSV or HSL color space with using of given YUV color matrix.
+
+        The input Y, U, V and output Hue images must have the same width and height.
+
+        \note This function has a C++ wrappers: Simd::Yuv444pToHue(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& hue, SimdYuvType yuvType).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] hue - a pointer to pixels data of output 8-bit Hue image.
+        \param [in] hueStride - a row size of the hue image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv444pToHueV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * hue, size_t hueStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn size_t SimdYuv16BufferSize(size_t width);
+
+        \short Gets size of external temporary buffer required for conversion of high bit depth YUV images.
+
+        The buffer is used by functions ::SimdYuv420p16ToBgr, ::SimdYuv420p16ToBgra, ::SimdP016ToBgr and ::SimdP016ToBgra.
+        It lets to avoid memory allocation at every call when an image is converted repeatedly or by bands.
+
+        \param [in] width - an image width.
+        \return size of external temporary buffer.
+    */
+    SIMD_API size_t SimdYuv16BufferSize(size_t width);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv420p16ToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, size_t bitDepth, uint8_t * bgr, size_t bgrStride, SimdBool dither, SimdYuvType yuvType, uint8_t * buffer);
+
+        \short Converts high bit depth YUV420P image (YUV420P10LE, YUV420P12LE, YUV420P16LE) to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+        The samples of input images are aligned to least significant bit.
+
+        \note This function has a C++ wrapper Simd::Yuv420p16ToBgr(const View<A>& y, const View<A>& u, const View<A>& v, size_t bitDepth, View<A>& bgr, bool dither, SimdYuvType yuvType, uint8_t * buffer).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 16-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 16-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bitDepth - a bit depth of input images. It must be in range (8, 16].
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] dither - a flag of ordered dithering. If it is ::SimdFalse then rounding is used.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
+        \param [in, out] buffer - a pointer to external temporary buffer of size ::SimdYuv16BufferSize(width). Can be NULL (the function allocates internal buffer).
+    */
+    SIMD_API void SimdYuv420p16ToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, size_t bitDepth, uint8_t * bgr, size_t bgrStride, SimdBool dither, SimdYuvType yuvType, uint8_t * buffer);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv420p16ToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, size_t bitDepth, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdBool dither, SimdYuvType yuvType, uint8_t * buffer);
+
+        \short Converts high bit depth YUV420P image (YUV420P10LE, YUV420P12LE, YUV420P16LE) to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+        The samples of input images are aligned to least significant bit.
+
+        \note This function has a C++ wrapper Simd::Yuv420p16ToBgra(const View<A>& y, const View<A>& u, const View<A>& v, size_t bitDepth, View<A>& bgra, uint8_t alpha, bool dither, SimdYuvType yuvType, uint8_t * buffer).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 16-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 16-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bitDepth - a bit depth of input images. It must be in range (8, 16].
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] dither - a flag of ordered dithering. If it is ::SimdFalse then rounding is used.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
+        \param [in, out] buffer - a pointer to external temporary buffer of size ::SimdYuv16BufferSize(width). Can be NULL (the function allocates internal buffer).
+    */
+    SIMD_API void SimdYuv420p16ToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, size_t bitDepth, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdBool dither, SimdYuvType yuvType, uint8_t * buffer);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -248,6 +248,122 @@ namespace Simd
         SimdAlphaFilling(dst.data, dst.stride, dst.width, dst.height, (uint8_t*)&pixel, sizeof(Pixel), alpha.data, alpha.stride);
     }
 
+    /*! @ingroup drawing
+
+        \fn void AlphaPremultiply(const View<A>& src, View<A>& dst)
+
+        \short Converts BGRA32 image with straight alpha to BGRA32 image with premultiplied alpha.
+
+        Both images must have the same width, height and BGRA32 format. The operation can be performed in-place (src == dst).
+
+        \note This function is a C++ wrapper for function ::SimdAlphaPremultiply.
+
+        \param [in] src - an input BGRA32 image with straight alpha.
+        \param [out] dst - an output BGRA32 image with premultiplied alpha.
+    */
+    template<template<class> class A> SIMD_INLINE void AlphaPremultiply(const View<A>& src, View<A>& dst)
+    {
+        assert(Compatible(src, dst) && src.format == View<A>::Bgra32);
+
+        SimdAlphaPremultiply(src.data, src.stride, src.width, src.height, dst.data, dst.stride);
+    }
+
+    /*! @ingroup drawing
+
+        \fn void AlphaUnpremultiply(const View<A>& src, View<A>& dst)
+
+        \short Converts BGRA32 image with premultiplied alpha to BGRA32 image with straight alpha.
+
+        Both images must have the same width, height and BGRA32 format. The operation can be performed in-place (src == dst).
+
+        \note This function is a C++ wrapper for function ::SimdAlphaUnpremultiply.
+
+        \param [in] src - an input BGRA32 image with premultiplied alpha.
+        \param [out] dst - an output BGRA32 image with straight alpha.
+    */
+    template<template<class> class A> SIMD_INLINE void AlphaUnpremultiply(const View<A>& src, View<A>& dst)
+    {
+        assert(Compatible(src, dst) && src.format == View<A>::Bgra32);
+
+        SimdAlphaUnpremultiply(src.data, src.stride, src.width, src.height, dst.data, dst.stride);
+    }
+
+    /*! @ingroup drawing
+
+        \fn void AlphaBlendingBgraToBgra(const View<A>& src, uint8_t alpha, bool premultiplied, View<A>& dst)
+
+        \short Composites BGRA32 image over BGRA32 image (Porter-Duff "over" operation) using alpha channel of the foreground image and global opacity.
+
+        Both images must have the same width, height and BGRA32 format.
+
+        \note This function is a C++ wrapper for function ::SimdAlphaBlendingBgraToBgra.
+
+        \param [in] src - a foreground BGRA32 image.
+        \param [in] alpha - a global opacity of the foreground image (255 - opaque).
+        \param [in] premultiplied - a flag of premultiplied alpha in both images.
+        \param [in, out] dst - a background BGRA32 image.
+    */
+    template<template<class> class A> SIMD_INLINE void AlphaBlendingBgraToBgra(const View<A>& src, uint8_t alpha, bool premultiplied, View<A>& dst)
+    {
+        assert(Compatible(src, dst) && src.format == View<A>::Bgra32);
+
+        SimdAlphaBlendingBgraToBgra(src.data, src.stride, src.width, src.height, alpha, premultiplied ? SimdTrue : SimdFalse, dst.data, dst.stride);
+    }
+
+    /*! @ingroup drawing
+
+        \fn void AlphaBlendingBgraToYuv420p(const View<A>& bgra, uint8_t alpha, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Composites BGRA32 image with straight alpha over YUV420P image.
+
+        The input BGRA32 and output Y images must have the same width and height.
+        The U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdAlphaBlendingBgraToYuv420p.
+
+        \param [in] bgra - a foreground BGRA32 image.
+        \param [in] alpha - a global opacity of the foreground image (255 - opaque).
+        \param [in, out] y - a Y plane of background image.
+        \param [in, out] u - a U plane of background image.
+        \param [in, out] v - a V plane of background image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void AlphaBlendingBgraToYuv420p(const View<A>& bgra, uint8_t alpha, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
+        assert(y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
+
+        SimdAlphaBlendingBgraToYuv420p(bgra.data, bgra.stride, bgra.width, bgra.height, alpha, y.data, y.stride, u.data, u.stride, v.data, v.stride, yuvType);
+    }
+
+    /*! @ingroup drawing
+
+        \fn void AlphaBlendingBgraToNv12(const View<A>& bgra, uint8_t alpha, View<A>& y, View<A>& uv, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Composites BGRA32 image with straight alpha over NV12 image.
+
+        The input BGRA32 and output Y images must have the same width and height.
+        The UV image must have half size relative to Y component and interleaved U and V channels.
+
+        \note This function is a C++ wrapper for function ::SimdAlphaBlendingBgraToNv12.
+
+        \param [in] bgra - a foreground BGRA32 image.
+        \param [in] alpha - a global opacity of the foreground image (255 - opaque).
+        \param [in, out] y - a Y plane of background image.
+        \param [in, out] uv - an interleaved UV plane of background image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void AlphaBlendingBgraToNv12(const View<A>& bgra, uint8_t alpha, View<A>& y, View<A>& uv, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height);
+        assert(y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && bgra.format == View<A>::Bgra32);
+
+        SimdAlphaBlendingBgraToNv12(bgra.data, bgra.stride, bgra.width, bgra.height, alpha, y.data, y.stride, uv.data, uv.stride, yuvType);
+    }
+
     /*! @ingroup background
 
         \fn void BackgroundGrowRangeSlow(const View<A>& value, View<A>& lo, View<A>& hi)
@@ -525,6 +641,157 @@ namespace Simd
         SimdBackgroundInitMask(src.data, src.stride, src.width, src.height, index, value, dst.data, dst.stride);
     }
 
+    /*! @ingroup background
+
+        \fn void BackgroundUpdate(const View<A>& value, View<A>& loValue, View<A>& hiValue, View<A>& loCount, View<A>& hiCount, uint8_t threshold, int flags);
+
+        \short Performs several steps of background model update in one pass over the images.
+
+        All images must have the same width, height and format (8-bit gray).
+
+        \note This function is a C++ wrapper for function ::SimdBackgroundUpdate.
+
+        \param [in] value - a current feature value.
+        \param [in, out] loValue - a value of feature lower bound of dynamic background.
+        \param [in, out] hiValue - a value of feature upper bound of dynamic background.
+        \param [in, out] loCount - a count of feature lower bound of dynamic background.
+        \param [in, out] hiCount - a count of feature upper bound of dynamic background.
+        \param [in] threshold - a count threshold.
+        \param [in] flags - a combination of ::SimdBackgroundUpdateFlags.
+    */
+    template<template<class> class A> SIMD_INLINE void BackgroundUpdate(const View<A>& value, View<A>& loValue, View<A>& hiValue,
+        View<A>& loCount, View<A>& hiCount, uint8_t threshold, int flags)
+    {
+        assert(Compatible(value, loValue, hiValue, loCount, hiCount) && value.format == View<A>::Gray8);
+
+        SimdBackgroundUpdate(value.data, value.stride, value.width, value.height, loValue.data, loValue.stride, hiValue.data, hiValue.stride,
+            loCount.data, loCount.stride, hiCount.data, hiCount.stride, threshold, flags);
+    }
+
+    /*! @ingroup background
+
+        \fn void BackgroundPackedInit(const View<A>& value, View<A>& model);
+
+        \short Initializes background model in packed format.
+
+        Value must be 8-bit gray image, model must have Bgra32 format (4 bytes per pixel) and the same size.
+
+        \note This function is a C++ wrapper for function ::SimdBackgroundPackedInit.
+
+        \param [in] value - a current feature value.
+        \param [out] model - a packed background model.
+    */
+    template<template<class> class A> SIMD_INLINE void BackgroundPackedInit(const View<A>& value, View<A>& model)
+    {
+        assert(EqualSize(value, model) && value.format == View<A>::Gray8 && model.format == View<A>::Bgra32);
+
+        SimdBackgroundPackedInit(value.data, value.stride, value.width, value.height, model.data, model.stride);
+    }
+
+    /*! @ingroup background
+
+        \fn void BackgroundPackedUpdate(const View<A>& value, View<A>& model, uint8_t threshold, int flags);
+
+        \short Performs several steps of update of background model in packed format in one pass over the images.
+
+        Value must be 8-bit gray image, model must have Bgra32 format (4 bytes per pixel) and the same size.
+
+        \note This function is a C++ wrapper for function ::SimdBackgroundPackedUpdate.
+
+        \param [in] value - a current feature value.
+        \param [in, out] model - a packed background model.
+        \param [in] threshold - a count threshold.
+        \param [in] flags - a combination of ::SimdBackgroundUpdateFlags.
+    */
+    template<template<class> class A> SIMD_INLINE void BackgroundPackedUpdate(const View<A>& value, View<A>& model, uint8_t threshold, int flags)
+    {
+        assert(EqualSize(value, model) && value.format == View<A>::Gray8 && model.format == View<A>::Bgra32);
+
+        SimdBackgroundPackedUpdate(value.data, value.stride, value.width, value.height, model.data, model.stride, threshold, flags);
+    }
+
+    /*! @ingroup background
+
+        \fn void BackgroundPackedGrowRangeSlow(const View<A>& value, View<A>& model);
+
+        \short Performs background update (initial grow, slow mode) of background model in packed format.
+
+        Value must be 8-bit gray image, model must have Bgra32 format (4 bytes per pixel) and the same size.
+
+        \note This function is a C++ wrapper for function ::SimdBackgroundPackedGrowRangeSlow.
+
+        \param [in] value - a current feature value.
+        \param [in, out] model - a packed background model.
+    */
+    template<template<class> class A> SIMD_INLINE void BackgroundPackedGrowRangeSlow(const View<A>& value, View<A>& model)
+    {
+        assert(EqualSize(value, model) && value.format == View<A>::Gray8 && model.format == View<A>::Bgra32);
+
+        SimdBackgroundPackedGrowRangeSlow(value.data, value.stride, value.width, value.height, model.data, model.stride);
+    }
+
+    /*! @ingroup background
+
+        \fn void BackgroundPackedAdjustRange(View<A>& model, uint8_t threshold, const View<A>& mask);
+
+        \short Performs adjustment of background range of background model in packed format with using adjust range mask.
+
+        Mask must be 8-bit gray image, model must have Bgra32 format (4 bytes per pixel) and the same size.
+
+        \note This function is a C++ wrapper for function ::SimdBackgroundPackedAdjustRangeMasked.
+
+        \param [in, out] model - a packed background model.
+        \param [in] threshold - a count threshold.
+        \param [in] mask - an adjust range mask.
+    */
+    template<template<class> class A> SIMD_INLINE void BackgroundPackedAdjustRange(View<A>& model, uint8_t threshold, const View<A>& mask)
+    {
+        assert(EqualSize(model, mask) && mask.format == View<A>::Gray8 && model.format == View<A>::Bgra32);
+
+        SimdBackgroundPackedAdjustRangeMasked(model.data, model.stride, model.width, model.height, threshold, mask.data, mask.stride);
+    }
+
+    /*! @ingroup background
+
+        \fn void BackgroundPackedShiftRange(const View<A>& value, View<A>& model);
+
+        \short Shifts background range of background model in packed format.
+
+        Value must be 8-bit gray image, model must have Bgra32 format (4 bytes per pixel) and the same size.
+
+        \note This function is a C++ wrapper for function ::SimdBackgroundPackedShiftRange.
+
+        \param [in] value - a current feature value.
+        \param [in, out] model - a packed background model.
+    */
+    template<template<class> class A> SIMD_INLINE void BackgroundPackedShiftRange(const View<A>& value, View<A>& model)
+    {
+        assert(EqualSize(value, model) && value.format == View<A>::Gray8 && model.format == View<A>::Bgra32);
+
+        SimdBackgroundPackedShiftRange(value.data, value.stride, value.width, value.height, model.data, model.stride);
+    }
+
+    /*! @ingroup background
+
+        \fn void BackgroundPackedShiftRange(const View<A>& value, View<A>& model, const View<A>& mask);
+
+        \short Shifts background range of background model in packed format with using shift range mask.
+
+        Value and mask must be 8-bit gray images, model must have Bgra32 format (4 bytes per pixel). All images must have the same size.
+
+        \note This function is a C++ wrapper for function ::SimdBackgroundPackedShiftRangeMasked.
+
+        \param [in] value - a current feature value.
+        \param [in, out] model - a packed background model.
+        \param [in] mask - a shift range mask.
+    */
+    template<template<class> class A> SIMD_INLINE void BackgroundPackedShiftRange(const View<A>& value, View<A>& model, const View<A>& mask)
+    {
+        assert(EqualSize(value, model, mask) && value.format == View<A>::Gray8 && mask.format == View<A>::Gray8 && model.format == View<A>::Bgra32);
+
+        SimdBackgroundPackedShiftRangeMasked(value.data, value.stride, value.width, value.height, model.data, model.stride, mask.data, mask.stride);
+    }
+
     /*! @ingroup bayer_conversion
 
         \fn void BayerToBgr(const View<A>& bayer, View<A>& bgr);
@@ -570,6 +837,94 @@ namespace Simd
         SimdBayerToBgra(bayer.data, bayer.width, bayer.height, bayer.stride, (SimdPixelFormatType)bayer.format, bgra.data, bgra.stride, alpha);
     }
 
+    /*! @ingroup bayer_conversion
+
+        \fn void BayerToBgrMhc(const View<A>& bayer, View<A>& bgr);
+
+        \short Converts 8-bit Bayer image to 24-bit BGR with using of gradient-corrected (Malvar-He-Cutler) interpolation.
+
+        All images must have the same width and height. The width and the height must be even.
+
+        \note This function is a C++ wrapper for function ::SimdBayerToBgrMhc.
+
+        \param [in] bayer - an input 8-bit Bayer image.
+        \param [out] bgr - an output 24-bit BGR image.
+    */
+    template<template<class> class A> SIMD_INLINE void BayerToBgrMhc(const View<A>& bayer, View<A>& bgr)
+    {
+        assert(EqualSize(bgr, bayer) && bgr.format == View<A>::Bgr24);
+        assert(bayer.format >= View<A>::BayerGrbg && bayer.format <= View<A>::BayerBggr);
+        assert((bayer.width % 2 == 0) && (bayer.height % 2 == 0));
+
+        SimdBayerToBgrMhc(bayer.data, bayer.width, bayer.height, bayer.stride, (SimdPixelFormatType)bayer.format, bgr.data, bgr.stride);
+    }
+
+    /*! @ingroup bayer_conversion
+
+        \fn void BayerToBgraMhc(const View<A>& bayer, View<A>& bgra, uint8_t alpha = 0xFF);
+
+        \short Converts 8-bit Bayer image to 32-bit BGRA with using of gradient-corrected (Malvar-He-Cutler) interpolation.
+
+        All images must have the same width and height. The width and the height must be even.
+
+        \note This function is a C++ wrapper for function ::SimdBayerToBgraMhc.
+
+        \param [in] bayer - an input 8-bit Bayer image.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 256 by default.
+    */
+    template<template<class> class A> SIMD_INLINE void BayerToBgraMhc(const View<A>& bayer, View<A>& bgra, uint8_t alpha = 0xFF)
+    {
+        assert(EqualSize(bgra, bayer) && bgra.format == View<A>::Bgra32);
+        assert(bayer.format >= View<A>::BayerGrbg && bayer.format <= View<A>::BayerBggr);
+        assert((bayer.width % 2 == 0) && (bayer.height % 2 == 0));
+
+        SimdBayerToBgraMhc(bayer.data, bayer.width, bayer.height, bayer.stride, (SimdPixelFormatType)bayer.format, bgra.data, bgra.stride, alpha);
+    }
+
+    /*! @ingroup bayer_conversion
+
+        \fn void BayerToBgrHalf(const View<A>& bayer, View<A>& bgr);
+
+        \short Converts 8-bit Bayer image to 24-bit BGR image of half size.
+
+        The width and the height of the Bayer image must be even. The output BGR image must have size (bayer.width/2, bayer.height/2).
+
+        \note This function is a C++ wrapper for function ::SimdBayerToBgrHalf.
+
+        \param [in] bayer - an input 8-bit Bayer image.
+        \param [out] bgr - an output 24-bit BGR image of half size.
+    */
+    template<template<class> class A> SIMD_INLINE void BayerToBgrHalf(const View<A>& bayer, View<A>& bgr)
+    {
+        assert(bgr.width * 2 == bayer.width && bgr.height * 2 == bayer.height && bgr.format == View<A>::Bgr24);
+        assert(bayer.format >= View<A>::BayerGrbg && bayer.format <= View<A>::BayerBggr);
+
+        SimdBayerToBgrHalf(bayer.data, bayer.width, bayer.height, bayer.stride, (SimdPixelFormatType)bayer.format, bgr.data, bgr.stride);
+    }
+
+    /*! @ingroup bayer_conversion
+
+        \fn void BayerToGray(const View<A>& bayer, View<A>& gray);
+
+        \short Converts 8-bit Bayer image to 8-bit gray image.
+
+        All images must have the same width and height. The width and the height must be even.
+
+        \note This function is a C++ wrapper for function ::SimdBayerToGray.
+
+        \param [in] bayer - an input 8-bit Bayer image.
+        \param [out] gray - an output 8-bit gray image.
+    */
+    template<template<class> class A> SIMD_INLINE void BayerToGray(const View<A>& bayer, View<A>& gray)
+    {
+        assert(EqualSize(gray, bayer) && gray.format == View<A>::Gray8);
+        assert(bayer.format >= View<A>::BayerGrbg && bayer.format <= View<A>::BayerBggr);
+        assert((bayer.width % 2 == 0) && (bayer.height % 2 == 0));
+
+        SimdBayerToGray(bayer.data, bayer.width, bayer.height, bayer.stride, (SimdPixelFormatType)bayer.format, gray.data, gray.stride);
+    }
+
     /*! @ingroup bgra_conversion
 
         \fn void BgraToBayer(const View<A>& bgra, View<A>& bayer)
@@ -612,6 +967,26 @@ namespace Simd
         SimdBgraToBgr(bgra.data, bgra.width, bgra.height, bgra.stride, bgr.data, bgr.stride);
     }
 
+    /*! @ingroup bgra_conversion
+
+        \fn void BgraToRgb(const View<A>& bgra, View<A>& rgb)
+
+        \short Converts 32-bit BGRA image to 24-bit RGB image.
+
+        All images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdBgraToRgb.
+
+        \param [in] bgra - an input 32-bit BGRA image.
+        \param [out] rgb - an output 24-bit RGB image.
+    */
+    template<template<class> class A> SIMD_INLINE void BgraToRgb(const View<A>& bgra, View<A>& rgb)
+    {
+        assert(EqualSize(bgra, rgb) && bgra.format == View<A>::Bgra32 && rgb.format == View<A>::Rgb24);
+
+        SimdBgraToRgb(bgra.data, bgra.width, bgra.height, bgra.stride, rgb.data, rgb.stride);
+    }
+
     /*! @ingroup bgra_conversion
 
         \fn void BgraToGray(const View<A>& bgra, View<A>& gray)
@@ -634,63 +1009,215 @@ namespace Simd
 
     /*! @ingroup bgra_conversion
 
-        \fn void BgraToYuv420p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v)
+        \fn void BgraToNv12(const View<A>& bgra, View<A>& y, View<A>& uv)
 
-        \short Converts 32-bit BGRA image to YUV420P.
+        \short Converts 32-bit BGRA image to NV12.
 
         The input BGRA and output Y images must have the same width and height.
-        The input U and V images must have the same width and height (half size relative to Y component).
+        The output UV image has interleaved U and V components (16 bits per pixel) and half size relative to Y component.
 
-        \note This function is a C++ wrapper for function ::SimdBgraToYuv420p.
+        \note This function is a C++ wrapper for function ::SimdBgraToNv12.
 
         \param [in] bgra - an input 32-bit BGRA image.
         \param [out] y - an output 8-bit image with Y color plane.
-        \param [out] u - an output 8-bit image with U color plane.
-        \param [out] v - an output 8-bit image with V color plane.
+        \param [out] uv - an output 16-bit image with interleaved U and V color planes.
     */
-    template<template<class> class A> SIMD_INLINE void BgraToYuv420p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v)
+    template<template<class> class A> SIMD_INLINE void BgraToNv12(const View<A>& bgra, View<A>& y, View<A>& uv)
     {
-        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
-        assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height);
         assert(y.width == bgra.width && y.height == bgra.height);
-        assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && bgra.format == View<A>::Bgra32);
 
-        SimdBgraToYuv420p(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+        SimdBgraToNv12(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, uv.data, uv.stride);
     }
 
     /*! @ingroup bgra_conversion
 
-        \fn void BgraToYuv422p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v)
+        \fn void BgraToNv12(const View<A>& bgra, View<A>& y, View<A>& uv, SimdYuvType yuvType)
 
-        \short Converts 32-bit BGRA image to YUV422P.
+        \short Converts 32-bit BGRA image to NV12 with using of given YUV color matrix.
 
         The input BGRA and output Y images must have the same width and height.
-        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+        The output UV image has interleaved U and V components (16 bits per pixel) and half size relative to Y component.
 
-        \note This function is a C++ wrapper for function ::SimdBgraToYuv422p.
+        \note This function is a C++ wrapper for function ::SimdBgraToNv12V2.
 
         \param [in] bgra - an input 32-bit BGRA image.
         \param [out] y - an output 8-bit image with Y color plane.
-        \param [out] u - an output 8-bit image with U color plane.
-        \param [out] v - an output 8-bit image with V color plane.
+        \param [out] uv - an output 16-bit image with interleaved U and V color planes.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
     */
-    template<template<class> class A> SIMD_INLINE void BgraToYuv422p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v)
+    template<template<class> class A> SIMD_INLINE void BgraToNv12(const View<A>& bgra, View<A>& y, View<A>& uv, SimdYuvType yuvType)
     {
-        assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
-        assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height);
         assert(y.width == bgra.width && y.height == bgra.height);
-        assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && bgra.format == View<A>::Bgra32);
 
-        SimdBgraToYuv422p(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+        SimdBgraToNv12V2(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, uv.data, uv.stride, yuvType);
     }
 
     /*! @ingroup bgra_conversion
 
-        \fn void BgraToYuv444p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v)
+        \fn void BgraToNv21(const View<A>& bgra, View<A>& y, View<A>& vu)
 
-        \short Converts 32-bit BGRA image to YUV444P.
+        \short Converts 32-bit BGRA image to NV21.
 
-        The input BGRA and output Y, U and V images must have the same width and height.
+        The input BGRA and output Y images must have the same width and height.
+        The output VU image has interleaved V and U components (16 bits per pixel) and half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdBgraToNv21.
+
+        \param [in] bgra - an input 32-bit BGRA image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] vu - an output 16-bit image with interleaved V and U color planes.
+    */
+    template<template<class> class A> SIMD_INLINE void BgraToNv21(const View<A>& bgra, View<A>& y, View<A>& vu)
+    {
+        assert(y.width == 2 * vu.width && y.height == 2 * vu.height);
+        assert(y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && vu.format == View<A>::Uv16 && bgra.format == View<A>::Bgra32);
+
+        SimdBgraToNv21(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, vu.data, vu.stride);
+    }
+
+    /*! @ingroup bgra_conversion
+
+        \fn void BgraToNv21(const View<A>& bgra, View<A>& y, View<A>& vu, SimdYuvType yuvType)
+
+        \short Converts 32-bit BGRA image to NV21 with using of given YUV color matrix.
+
+        The input BGRA and output Y images must have the same width and height.
+        The output VU image has interleaved V and U components (16 bits per pixel) and half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdBgraToNv21V2.
+
+        \param [in] bgra - an input 32-bit BGRA image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] vu - an output 16-bit image with interleaved V and U color planes.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
+    */
+    template<template<class> class A> SIMD_INLINE void BgraToNv21(const View<A>& bgra, View<A>& y, View<A>& vu, SimdYuvType yuvType)
+    {
+        assert(y.width == 2 * vu.width && y.height == 2 * vu.height);
+        assert(y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && vu.format == View<A>::Uv16 && bgra.format == View<A>::Bgra32);
+
+        SimdBgraToNv21V2(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, vu.data, vu.stride, yuvType);
+    }
+
+    /*! @ingroup bgra_conversion
+
+        \fn void BgraToYuv420p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v)
+
+        \short Converts 32-bit BGRA image to YUV420P.
+
+        The input BGRA and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdBgraToYuv420p.
+
+        \param [in] bgra - an input 32-bit BGRA image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] u - an output 8-bit image with U color plane.
+        \param [out] v - an output 8-bit image with V color plane.
+    */
+    template<template<class> class A> SIMD_INLINE void BgraToYuv420p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
+        assert(y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
+
+        SimdBgraToYuv420p(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+    }
+
+    /*! @ingroup bgra_conversion
+
+        \fn void BgraToYuv420p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType)
+
+        \short Converts 32-bit BGRA image to YUV420P with using of given YUV color matrix.
+
+        The input BGRA and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdBgraToYuv420pV2.
+
+        \param [in] bgra - an input 32-bit BGRA image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] u - an output 8-bit image with U color plane.
+        \param [out] v - an output 8-bit image with V color plane.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
+    */
+    template<template<class> class A> SIMD_INLINE void BgraToYuv420p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
+        assert(y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
+
+        SimdBgraToYuv420pV2(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride, yuvType);
+    }
+
+    /*! @ingroup bgra_conversion
+
+        \fn void BgraToYuv422p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v)
+
+        \short Converts 32-bit BGRA image to YUV422P.
+
+        The input BGRA and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \note This function is a C++ wrapper for function ::SimdBgraToYuv422p.
+
+        \param [in] bgra - an input 32-bit BGRA image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] u - an output 8-bit image with U color plane.
+        \param [out] v - an output 8-bit image with V color plane.
+    */
+    template<template<class> class A> SIMD_INLINE void BgraToYuv422p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v)
+    {
+        assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
+        assert(y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
+
+        SimdBgraToYuv422p(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+    }
+
+    /*! @ingroup bgra_conversion
+
+        \fn void BgraToYuv422p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType)
+
+        \short Converts 32-bit BGRA image to YUV422P with using of given YUV color matrix.
+
+        The input BGRA and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \note This function is a C++ wrapper for function ::SimdBgraToYuv422pV2.
+
+        \param [in] bgra - an input 32-bit BGRA image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] u - an output 8-bit image with U color plane.
+        \param [out] v - an output 8-bit image with V color plane.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
+    */
+    template<template<class> class A> SIMD_INLINE void BgraToYuv422p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType)
+    {
+        assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
+        assert(y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
+
+        SimdBgraToYuv422pV2(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride, yuvType);
+    }
+
+    /*! @ingroup bgra_conversion
+
+        \fn void BgraToYuv444p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v)
+
+        \short Converts 32-bit BGRA image to YUV444P.
+
+        The input BGRA and output Y, U and V images must have the same width and height.
 
         \note This function is a C++ wrapper for function ::SimdBgraToYuv444p.
 
@@ -707,6 +1234,30 @@ namespace Simd
         SimdBgraToYuv444p(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
     }
 
+    /*! @ingroup bgra_conversion
+
+        \fn void BgraToYuv444p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType)
+
+        \short Converts 32-bit BGRA image to YUV444P with using of given YUV color matrix.
+
+        The input BGRA and output Y, U and V images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdBgraToYuv444pV2.
+
+        \param [in] bgra - an input 32-bit BGRA image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] u - an output 8-bit image with U color plane.
+        \param [out] v - an output 8-bit image with V color plane.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
+    */
+    template<template<class> class A> SIMD_INLINE void BgraToYuv444p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType)
+    {
+        assert(EqualSize(bgra, y) && Compatible(y, u, v));
+        assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
+
+        SimdBgraToYuv444pV2(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride, yuvType);
+    }
+
     /*! @ingroup bgra_conversion
 
         \fn void BgraToYuva420p(const View<A> & bgra, View<A> & y, View<A> & u, View<A> & v, View<A> & a)
@@ -776,6 +1327,27 @@ namespace Simd
         SimdBgrToBgra(bgr.data, bgr.width, bgr.height, bgr.stride, bgra.data, bgra.stride, alpha);
     }
 
+    /*! @ingroup bgr_conversion
+
+        \fn void BgrToRgba(const View<A>& bgr, View<A>& rgba, uint8_t alpha = 0xFF)
+
+        \short Converts 24-bit BGR image to 32-bit RGBA image.
+
+        All images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdBgrToRgba.
+
+        \param [in] bgr - an input 24-bit BGR image.
+        \param [out] rgba - an output 32-bit RGBA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 256 by default.
+    */
+    template<template<class> class A> SIMD_INLINE void BgrToRgba(const View<A>& bgr, View<A>& rgba, uint8_t alpha = 0xFF)
+    {
+        assert(EqualSize(bgr, rgba) && rgba.format == View<A>::Rgba32 && bgr.format == View<A>::Bgr24);
+
+        SimdBgrToRgba(bgr.data, bgr.width, bgr.height, bgr.stride, rgba.data, rgba.stride, alpha);
+    }
+
     /*! @ingroup other_conversion
 
         \fn void Bgr48pToBgra32(const View<A>& blue, const View<A>& green, const View<A>& red, View<A>& bgra, uint8_t alpha = 0xFF)
@@ -861,141 +1433,401 @@ namespace Simd
 
     /*! @ingroup bgr_conversion
 
-        \fn void BgrToYuv420p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v)
+        \fn void BgrToHsvInRange(const View<A> & bgr, const uint8_t * lower, const uint8_t * upper, View<A> & mask)
 
-        \short Converts 24-bit BGR image to YUV420P.
+        \short Builds a mask of pixels of 24-bit BGR image which HSV values lie in the given range.
 
-        The input BGR and output Y images must have the same width and height.
-        The input U and V images must have the same width and height (half size relative to Y component).
+        All images must have the same width and height.
 
-        \note This function is a C++ wrapper for function ::SimdBgrToYuv420p.
+        \note This function is a C++ wrapper for function ::SimdBgrToHsvInRange.
 
         \param [in] bgr - an input 24-bit BGR image.
-        \param [out] y - an output 8-bit image with Y color plane.
-        \param [out] u - an output 8-bit image with U color plane.
-        \param [out] v - an output 8-bit image with V color plane.
+        \param [in] lower - a pointer to 3 inclusive lower bounds of hue, saturation and value.
+        \param [in] upper - a pointer to 3 inclusive upper bounds of hue, saturation and value.
+        \param [out] mask - an output 8-bit gray mask.
     */
-    template<template<class> class A> SIMD_INLINE void BgrToYuv420p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v)
+    template<template<class> class A> SIMD_INLINE void BgrToHsvInRange(const View<A> & bgr, const uint8_t * lower, const uint8_t * upper, View<A> & mask)
     {
-        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
-        assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
-        assert(y.width == bgr.width && y.height == bgr.height);
-        assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+        assert(EqualSize(bgr, mask) && bgr.format == View<A>::Bgr24 && mask.format == View<A>::Gray8);
 
-        SimdBgrToYuv420p(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+        SimdBgrToHsvInRange(bgr.data, bgr.width, bgr.height, bgr.stride, lower, upper, mask.data, mask.stride);
     }
 
     /*! @ingroup bgr_conversion
 
-        \fn void BgrToYuv422p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v)
+        \fn void BgrToLab(const View<A> & bgr, View<A> & lab)
 
-        \short Converts 24-bit BGR image to YUV422P.
+        \short Converts 24-bit BGR image to 24-bit CIE Lab image.
 
-        The input BGR and output Y images must have the same width and height.
-        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+        All images must have the same width and height.
 
-        \note This function is a C++ wrapper for function ::SimdBgrToYuv422p.
+        \note This function is a C++ wrapper for function ::SimdBgrToLab.
 
         \param [in] bgr - an input 24-bit BGR image.
-        \param [out] y - an output 8-bit image with Y color plane.
-        \param [out] u - an output 8-bit image with U color plane.
-        \param [out] v - an output 8-bit image with V color plane.
+        \param [out] lab - an output 24-bit Lab image.
     */
-    template<template<class> class A> SIMD_INLINE void BgrToYuv422p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v)
+    template<template<class> class A> SIMD_INLINE void BgrToLab(const View<A> & bgr, View<A> & lab)
     {
-        assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
-        assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
-        assert(y.width == bgr.width && y.height == bgr.height);
-        assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+        assert(EqualSize(bgr, lab) && bgr.format == View<A>::Bgr24 && lab.format == View<A>::Lab24);
 
-        SimdBgrToYuv422p(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+        SimdBgrToLab(bgr.data, bgr.width, bgr.height, bgr.stride, lab.data, lab.stride);
     }
 
     /*! @ingroup bgr_conversion
 
-        \fn void BgrToYuv444p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v)
+        \fn void BgrToLab32f(const View<A> & bgr, View<A> & lab)
 
-        \short Converts 24-bit BGR image to YUV444P.
+        \short Converts 24-bit BGR image to CIE Lab image with 32-bit float channels.
 
-        The input BGR and output Y, U and V images must have the same width and height.
+        The output image must have ::SimdPixelFormatFloat format, the same height and 3 times bigger width than the input image.
 
-        \note This function is a C++ wrapper for function ::SimdBgrToYuv444p.
+        \note This function is a C++ wrapper for function ::SimdBgrToLab32f.
 
         \param [in] bgr - an input 24-bit BGR image.
-        \param [out] y - an output 8-bit image with Y color plane.
-        \param [out] u - an output 8-bit image with U color plane.
-        \param [out] v - an output 8-bit image with V color plane.
+        \param [out] lab - an output 32-bit float Lab image (3 interleaved channels).
     */
-    template<template<class> class A> SIMD_INLINE void BgrToYuv444p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v)
+    template<template<class> class A> SIMD_INLINE void BgrToLab32f(const View<A> & bgr, View<A> & lab)
     {
-        assert(EqualSize(bgr, y) && Compatible(y, u, v));
-        assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+        assert(bgr.width * 3 == lab.width && bgr.height == lab.height && bgr.format == View<A>::Bgr24 && lab.format == View<A>::Float);
 
-        SimdBgrToYuv444p(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+        SimdBgrToLab32f(bgr.data, bgr.width, bgr.height, bgr.stride, lab.data, lab.stride);
     }
 
-    /*! @ingroup binarization
-
-        \fn void Binarization(const View<A>& src, uint8_t value, uint8_t positive, uint8_t negative, View<A>& dst, SimdCompareType compareType)
+    /*! @ingroup bgr_conversion
 
-        \short Performs binarization of 8-bit gray image.
+        \fn void BgrToYCoCgR(const View<A> & bgr, View<A> & y, View<A> & co, View<A> & cg)
 
-        All images must have 8-bit gray format and must have the same width and height.
+        \short Converts 24-bit BGR image to reversible YCoCg-R planes.
 
-        For every point:
-        \verbatim
-        dst[i] = compare(src[i], value) ? positive : negative;
-        \endverbatim
-        where compare(a, b) depends from compareType (see ::SimdCompareType).
+        All images must have the same width and height.
 
-        \note This function is a C++ wrapper for function ::SimdBinarization.
+        \note This function is a C++ wrapper for function ::SimdBgrToYCoCgR.
 
-        \param [in] src - an input 8-bit gray image (first value for compare operation).
-        \param [in] value - a second value for compare operation.
-        \param [in] positive - a destination value if comparison operation has a positive result.
-        \param [in] negative - a destination value if comparison operation has a negative result.
-        \param [out] dst - an output 8-bit gray binarized image.
-        \param [in] compareType - a compare operation type (see ::SimdCompareType).
+        \param [in] bgr - an input 24-bit BGR image.
+        \param [out] y - an output 8-bit Y plane.
+        \param [out] co - an output 16-bit signed Co plane.
+        \param [out] cg - an output 16-bit signed Cg plane.
     */
-    template<template<class> class A> SIMD_INLINE void Binarization(const View<A>& src, uint8_t value, uint8_t positive, uint8_t negative, View<A>& dst, SimdCompareType compareType)
+    template<template<class> class A> SIMD_INLINE void BgrToYCoCgR(const View<A> & bgr, View<A> & y, View<A> & co, View<A> & cg)
     {
-        assert(Compatible(src, dst) && src.format == View<A>::Gray8);
+        assert(EqualSize(bgr, y) && Compatible(co, cg) && EqualSize(y, co) && bgr.format == View<A>::Bgr24 && y.format == View<A>::Gray8 && co.format == View<A>::Int16);
 
-        SimdBinarization(src.data, src.stride, src.width, src.height, value, positive, negative, dst.data, dst.stride, compareType);
+        SimdBgrToYCoCgR(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, co.data, co.stride, cg.data, cg.stride);
     }
 
-    /*! @ingroup binarization
+    /*! @ingroup bgr_conversion
 
-        \fn void AveragingBinarization(const View<A>& src, uint8_t value, size_t neighborhood, uint8_t threshold, uint8_t positive, uint8_t negative, View<A>& dst, SimdCompareType compareType)
+        \fn void BgrToNv12(const View<A>& bgr, View<A>& y, View<A>& uv)
 
-        \short Performs averaging binarization of 8-bit gray image.
+        \short Converts 24-bit BGR image to NV12.
 
-        All images must have 8-bit gray format and must have the same width and height.
+        The input BGR and output Y images must have the same width and height.
+        The output UV image has interleaved U and V components (16 bits per pixel) and half size relative to Y component.
 
-        For every point:
-        \verbatim
-        sum = 0; area = 0;
-        for(dy = -neighborhood; dy <= neighborhood; ++dy)
-        {
-            for(dx = -neighborhood; dx <= neighborhood; ++dx)
-            {
-                if(x + dx >= 0 && x + dx < width && y + dy >= 0 && y + dy < height)
-                {
-                    area++;
-                    if(compare(src[x + dx, x + dy], value))
-                        sum++;
-                }
-            }
-        }
-        dst[x, y] = sum*255 > area*threshold ? positive : negative;
-        \endverbatim
-        where compare(a, b) depends from compareType (see ::SimdCompareType).
+        \note This function is a C++ wrapper for function ::SimdBgrToNv12.
 
-        \note This function is a C++ wrapper for function ::SimdAveragingBinarization.
+        \param [in] bgr - an input 24-bit BGR image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] uv - an output 16-bit image with interleaved U and V color planes.
+    */
+    template<template<class> class A> SIMD_INLINE void BgrToNv12(const View<A>& bgr, View<A>& y, View<A>& uv)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height);
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && bgr.format == View<A>::Bgr24);
 
-        \param [in] src - an input 8-bit gray image (first value for compare operation).
-        \param [in] value - a second value for compare operation.
-        \param [in] neighborhood - an averaging neighborhood.
+        SimdBgrToNv12(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, uv.data, uv.stride);
+    }
+
+    /*! @ingroup bgr_conversion
+
+        \fn void BgrToNv12(const View<A>& bgr, View<A>& y, View<A>& uv, SimdYuvType yuvType)
+
+        \short Converts 24-bit BGR image to NV12 with using of given YUV color matrix.
+
+        The input BGR and output Y images must have the same width and height.
+        The output UV image has interleaved U and V components (16 bits per pixel) and half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdBgrToNv12V2.
+
+        \param [in] bgr - an input 24-bit BGR image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] uv - an output 16-bit image with interleaved U and V color planes.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
+    */
+    template<template<class> class A> SIMD_INLINE void BgrToNv12(const View<A>& bgr, View<A>& y, View<A>& uv, SimdYuvType yuvType)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height);
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && bgr.format == View<A>::Bgr24);
+
+        SimdBgrToNv12V2(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, uv.data, uv.stride, yuvType);
+    }
+
+    /*! @ingroup bgr_conversion
+
+        \fn void BgrToNv21(const View<A>& bgr, View<A>& y, View<A>& vu)
+
+        \short Converts 24-bit BGR image to NV21.
+
+        The input BGR and output Y images must have the same width and height.
+        The output VU image has interleaved V and U components (16 bits per pixel) and half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdBgrToNv21.
+
+        \param [in] bgr - an input 24-bit BGR image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] vu - an output 16-bit image with interleaved V and U color planes.
+    */
+    template<template<class> class A> SIMD_INLINE void BgrToNv21(const View<A>& bgr, View<A>& y, View<A>& vu)
+    {
+        assert(y.width == 2 * vu.width && y.height == 2 * vu.height);
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && vu.format == View<A>::Uv16 && bgr.format == View<A>::Bgr24);
+
+        SimdBgrToNv21(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, vu.data, vu.stride);
+    }
+
+    /*! @ingroup bgr_conversion
+
+        \fn void BgrToNv21(const View<A>& bgr, View<A>& y, View<A>& vu, SimdYuvType yuvType)
+
+        \short Converts 24-bit BGR image to NV21 with using of given YUV color matrix.
+
+        The input BGR and output Y images must have the same width and height.
+        The output VU image has interleaved V and U components (16 bits per pixel) and half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdBgrToNv21V2.
+
+        \param [in] bgr - an input 24-bit BGR image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] vu - an output 16-bit image with interleaved V and U color planes.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
+    */
+    template<template<class> class A> SIMD_INLINE void BgrToNv21(const View<A>& bgr, View<A>& y, View<A>& vu, SimdYuvType yuvType)
+    {
+        assert(y.width == 2 * vu.width && y.height == 2 * vu.height);
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && vu.format == View<A>::Uv16 && bgr.format == View<A>::Bgr24);
+
+        SimdBgrToNv21V2(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, vu.data, vu.stride, yuvType);
+    }
+
+    /*! @ingroup bgr_conversion
+
+        \fn void BgrToYuv420p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v)
+
+        \short Converts 24-bit BGR image to YUV420P.
+
+        The input BGR and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdBgrToYuv420p.
+
+        \param [in] bgr - an input 24-bit BGR image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] u - an output 8-bit image with U color plane.
+        \param [out] v - an output 8-bit image with V color plane.
+    */
+    template<template<class> class A> SIMD_INLINE void BgrToYuv420p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+
+        SimdBgrToYuv420p(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+    }
+
+    /*! @ingroup bgr_conversion
+
+        \fn void BgrToYuv420p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType)
+
+        \short Converts 24-bit BGR image to YUV420P with using of given YUV color matrix.
+
+        The input BGR and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdBgrToYuv420pV2.
+
+        \param [in] bgr - an input 24-bit BGR image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] u - an output 8-bit image with U color plane.
+        \param [out] v - an output 8-bit image with V color plane.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
+    */
+    template<template<class> class A> SIMD_INLINE void BgrToYuv420p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+
+        SimdBgrToYuv420pV2(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride, yuvType);
+    }
+
+    /*! @ingroup bgr_conversion
+
+        \fn void BgrToYuv422p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v)
+
+        \short Converts 24-bit BGR image to YUV422P.
+
+        The input BGR and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \note This function is a C++ wrapper for function ::SimdBgrToYuv422p.
+
+        \param [in] bgr - an input 24-bit BGR image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] u - an output 8-bit image with U color plane.
+        \param [out] v - an output 8-bit image with V color plane.
+    */
+    template<template<class> class A> SIMD_INLINE void BgrToYuv422p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v)
+    {
+        assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+
+        SimdBgrToYuv422p(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+    }
+
+    /*! @ingroup bgr_conversion
+
+        \fn void BgrToYuv422p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType)
+
+        \short Converts 24-bit BGR image to YUV422P with using of given YUV color matrix.
+
+        The input BGR and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \note This function is a C++ wrapper for function ::SimdBgrToYuv422pV2.
+
+        \param [in] bgr - an input 24-bit BGR image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] u - an output 8-bit image with U color plane.
+        \param [out] v - an output 8-bit image with V color plane.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
+    */
+    template<template<class> class A> SIMD_INLINE void BgrToYuv422p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType)
+    {
+        assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+
+        SimdBgrToYuv422pV2(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride, yuvType);
+    }
+
+    /*! @ingroup bgr_conversion
+
+        \fn void BgrToYuv444p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v)
+
+        \short Converts 24-bit BGR image to YUV444P.
+
+        The input BGR and output Y, U and V images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdBgrToYuv444p.
+
+        \param [in] bgr - an input 24-bit BGR image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] u - an output 8-bit image with U color plane.
+        \param [out] v - an output 8-bit image with V color plane.
+    */
+    template<template<class> class A> SIMD_INLINE void BgrToYuv444p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v)
+    {
+        assert(EqualSize(bgr, y) && Compatible(y, u, v));
+        assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+
+        SimdBgrToYuv444p(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+    }
+
+    /*! @ingroup bgr_conversion
+
+        \fn void BgrToYuv444p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType)
+
+        \short Converts 24-bit BGR image to YUV444P with using of given YUV color matrix.
+
+        The input BGR and output Y, U and V images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdBgrToYuv444pV2.
+
+        \param [in] bgr - an input 24-bit BGR image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] u - an output 8-bit image with U color plane.
+        \param [out] v - an output 8-bit image with V color plane.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
+    */
+    template<template<class> class A> SIMD_INLINE void BgrToYuv444p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType)
+    {
+        assert(EqualSize(bgr, y) && Compatible(y, u, v));
+        assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+
+        SimdBgrToYuv444pV2(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride, yuvType);
+    }
+
+    /*! @ingroup binarization
+
+        \fn void Binarization(const View<A>& src, uint8_t value, uint8_t positive, uint8_t negative, View<A>& dst, SimdCompareType compareType)
+
+        \short Performs binarization of 8-bit gray image.
+
+        All images must have 8-bit gray format and must have the same width and height.
+
+        For every point:
+        \verbatim
+        dst[i] = compare(src[i], value) ? positive : negative;
+        \endverbatim
+        where compare(a, b) depends from compareType (see ::SimdCompareType).
+
+        \note This function is a C++ wrapper for function ::SimdBinarization.
+
+        \param [in] src - an input 8-bit gray image (first value for compare operation).
+        \param [in] value - a second value for compare operation.
+        \param [in] positive - a destination value if comparison operation has a positive result.
+        \param [in] negative - a destination value if comparison operation has a negative result.
+        \param [out] dst - an output 8-bit gray binarized image.
+        \param [in] compareType - a compare operation type (see ::SimdCompareType).
+    */
+    template<template<class> class A> SIMD_INLINE void Binarization(const View<A>& src, uint8_t value, uint8_t positive, uint8_t negative, View<A>& dst, SimdCompareType compareType)
+    {
+        assert(Compatible(src, dst) && src.format == View<A>::Gray8);
+
+        SimdBinarization(src.data, src.stride, src.width, src.height, value, positive, negative, dst.data, dst.stride, compareType);
+    }
+
+    /*! @ingroup binarization
+
+        \fn void AveragingBinarization(const View<A>& src, uint8_t value, size_t neighborhood, uint8_t threshold, uint8_t positive, uint8_t negative, View<A>& dst, SimdCompareType compareType)
+
+        \short Performs averaging binarization of 8-bit gray image.
+
+        All images must have 8-bit gray format and must have the same width and height.
+
+        For every point:
+        \verbatim
+        sum = 0; area = 0;
+        for(dy = -neighborhood; dy <= neighborhood; ++dy)
+        {
+            for(dx = -neighborhood; dx <= neighborhood; ++dx)
+            {
+                if(x + dx >= 0 && x + dx < width && y + dy >= 0 && y + dy < height)
+                {
+                    area++;
+                    if(compare(src[x + dx, x + dy], value))
+                        sum++;
+                }
+            }
+        }
+        dst[x, y] = sum*255 > area*threshold ? positive : negative;
+        \endverbatim
+        where compare(a, b) depends from compareType (see ::SimdCompareType).
+
+        \note This function is a C++ wrapper for function ::SimdAveragingBinarization.
+
+        \param [in] src - an input 8-bit gray image (first value for compare operation).
+        \param [in] value - a second value for compare operation.
+        \param [in] neighborhood - an averaging neighborhood.
         \param [in] threshold - a threshold value for binarization. It can range from 0 to 255.
         \param [in] positive - a destination value if for neighborhood of this point number of positive comparison is greater then threshold.
         \param [in] negative - a destination value if for neighborhood of this point number of positive comparison is lesser or equal then threshold.
@@ -1507,20 +2339,144 @@ namespace Simd
             background.data, background.stride, mask.data, mask.stride);
     }
 
-    /*! @ingroup filling
+    /*! @ingroup edge_background
 
-        \fn void Fill(View<A>& dst, uint8_t value)
+        \fn void EdgeBackgroundPackedInit(const View<A>& value, View<A>& model);
 
-        \short Fills pixels data of image by given value.
+        \short Initializes edge background model in packed format.
 
-        \note This function is a C++ wrapper for function ::SimdFill.
+        Value must be 8-bit gray image, model must have Uv16 format (2 bytes per pixel) and the same size.
 
-        \param [out] dst - a destination image.
-        \param [in] value - a value to fill image.
+        \note This function is a C++ wrapper for function ::SimdEdgeBackgroundPackedInit.
+
+        \param [in] value - a current feature value.
+        \param [out] model - a packed edge background model.
     */
-    template<template<class> class A> SIMD_INLINE void Fill(View<A>& dst, uint8_t value)
+    template<template<class> class A> SIMD_INLINE void EdgeBackgroundPackedInit(const View<A>& value, View<A>& model)
     {
-        SimdFill(dst.data, dst.stride, dst.width, dst.height, dst.PixelSize(), value);
+        assert(EqualSize(value, model) && value.format == View<A>::Gray8 && model.format == View<A>::Uv16);
+
+        SimdEdgeBackgroundPackedInit(value.data, value.stride, value.width, value.height, model.data, model.stride);
+    }
+
+    /*! @ingroup edge_background
+
+        \fn void EdgeBackgroundPackedUpdate(const View<A>& value, View<A>& model, uint8_t threshold, int flags);
+
+        \short Performs several steps of update of edge background model in packed format in one pass over the images.
+
+        Value must be 8-bit gray image, model must have Uv16 format (2 bytes per pixel) and the same size.
+
+        \note This function is a C++ wrapper for function ::SimdEdgeBackgroundPackedUpdate.
+
+        \param [in] value - a current feature value.
+        \param [in, out] model - a packed edge background model.
+        \param [in] threshold - a count threshold.
+        \param [in] flags - a combination of ::SimdBackgroundUpdateFlags.
+    */
+    template<template<class> class A> SIMD_INLINE void EdgeBackgroundPackedUpdate(const View<A>& value, View<A>& model, uint8_t threshold, int flags)
+    {
+        assert(EqualSize(value, model) && value.format == View<A>::Gray8 && model.format == View<A>::Uv16);
+
+        SimdEdgeBackgroundPackedUpdate(value.data, value.stride, value.width, value.height, model.data, model.stride, threshold, flags);
+    }
+
+    /*! @ingroup edge_background
+
+        \fn void EdgeBackgroundPackedGrowRangeSlow(const View<A>& value, View<A>& model);
+
+        \short Performs edge background update (initial grow, slow mode) of edge background model in packed format.
+
+        Value must be 8-bit gray image, model must have Uv16 format (2 bytes per pixel) and the same size.
+
+        \note This function is a C++ wrapper for function ::SimdEdgeBackgroundPackedGrowRangeSlow.
+
+        \param [in] value - a current feature value.
+        \param [in, out] model - a packed edge background model.
+    */
+    template<template<class> class A> SIMD_INLINE void EdgeBackgroundPackedGrowRangeSlow(const View<A>& value, View<A>& model)
+    {
+        assert(EqualSize(value, model) && value.format == View<A>::Gray8 && model.format == View<A>::Uv16);
+
+        SimdEdgeBackgroundPackedGrowRangeSlow(value.data, value.stride, value.width, value.height, model.data, model.stride);
+    }
+
+    /*! @ingroup edge_background
+
+        \fn void EdgeBackgroundPackedAdjustRange(View<A>& model, uint8_t threshold, const View<A>& mask);
+
+        \short Performs adjustment of edge background range of edge background model in packed format with using adjust range mask.
+
+        Mask must be 8-bit gray image, model must have Uv16 format (2 bytes per pixel) and the same size.
+
+        \note This function is a C++ wrapper for function ::SimdEdgeBackgroundPackedAdjustRangeMasked.
+
+        \param [in, out] model - a packed edge background model.
+        \param [in] threshold - a count threshold.
+        \param [in] mask - an adjust range mask.
+    */
+    template<template<class> class A> SIMD_INLINE void EdgeBackgroundPackedAdjustRange(View<A>& model, uint8_t threshold, const View<A>& mask)
+    {
+        assert(EqualSize(model, mask) && mask.format == View<A>::Gray8 && model.format == View<A>::Uv16);
+
+        SimdEdgeBackgroundPackedAdjustRangeMasked(model.data, model.stride, model.width, model.height, threshold, mask.data, mask.stride);
+    }
+
+    /*! @ingroup edge_background
+
+        \fn void EdgeBackgroundPackedShiftRange(const View<A>& value, View<A>& model);
+
+        \short Shifts edge background range of edge background model in packed format.
+
+        Value must be 8-bit gray image, model must have Uv16 format (2 bytes per pixel) and the same size.
+
+        \note This function is a C++ wrapper for function ::SimdEdgeBackgroundPackedShiftRange.
+
+        \param [in] value - a current feature value.
+        \param [in, out] model - a packed edge background model.
+    */
+    template<template<class> class A> SIMD_INLINE void EdgeBackgroundPackedShiftRange(const View<A>& value, View<A>& model)
+    {
+        assert(EqualSize(value, model) && value.format == View<A>::Gray8 && model.format == View<A>::Uv16);
+
+        SimdEdgeBackgroundPackedShiftRange(value.data, value.stride, value.width, value.height, model.data, model.stride);
+    }
+
+    /*! @ingroup edge_background
+
+        \fn void EdgeBackgroundPackedShiftRange(const View<A>& value, View<A>& model, const View<A>& mask);
+
+        \short Shifts edge background range of edge background model in packed format with using shift range mask.
+
+        Value and mask must be 8-bit gray images, model must have Uv16 format (2 bytes per pixel). All images must have the same size.
+
+        \note This function is a C++ wrapper for function ::SimdEdgeBackgroundPackedShiftRangeMasked.
+
+        \param [in] value - a current feature value.
+        \param [in, out] model - a packed edge background model.
+        \param [in] mask - a shift range mask.
+    */
+    template<template<class> class A> SIMD_INLINE void EdgeBackgroundPackedShiftRange(const View<A>& value, View<A>& model, const View<A>& mask)
+    {
+        assert(EqualSize(value, model, mask) && value.format == View<A>::Gray8 && mask.format == View<A>::Gray8 && model.format == View<A>::Uv16);
+
+        SimdEdgeBackgroundPackedShiftRangeMasked(value.data, value.stride, value.width, value.height, model.data, model.stride, mask.data, mask.stride);
+    }
+
+    /*! @ingroup filling
+
+        \fn void Fill(View<A>& dst, uint8_t value)
+
+        \short Fills pixels data of image by given value.
+
+        \note This function is a C++ wrapper for function ::SimdFill.
+
+        \param [out] dst - a destination image.
+        \param [in] value - a value to fill image.
+    */
+    template<template<class> class A> SIMD_INLINE void Fill(View<A>& dst, uint8_t value)
+    {
+        SimdFill(dst.data, dst.stride, dst.width, dst.height, dst.PixelSize(), value);
     }
 
     /*! @ingroup filling
@@ -1876,6 +2832,108 @@ namespace Simd
         SimdHogLiteExtractFeatures(src.data, src.stride, src.width, src.height, cell, features, featuresStride);
     }
 
+    /*! @ingroup other_conversion
+
+        \fn void HslToBgr(const View<A> & hsl, View<A> & bgr)
+
+        \short Converts 24-bit HSL(Hue, Saturation, Lightness) image to 24-bit BGR image.
+
+        All images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdHslToBgr.
+
+        \param [in] hsl - an input 24-bit HSL image.
+        \param [out] bgr - an output 24-bit BGR image.
+    */
+    template<template<class> class A> SIMD_INLINE void HslToBgr(const View<A> & hsl, View<A> & bgr)
+    {
+        assert(EqualSize(hsl, bgr) && hsl.format == View<A>::Hsl24 && bgr.format == View<A>::Bgr24);
+
+        SimdHslToBgr(hsl.data, hsl.width, hsl.height, hsl.stride, bgr.data, bgr.stride);
+    }
+
+    /*! @ingroup other_conversion
+
+        \fn void HsvToBgr(const View<A> & hsv, View<A> & bgr)
+
+        \short Converts 24-bit HSV(Hue, Saturation, Value) image to 24-bit BGR image.
+
+        All images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdHsvToBgr.
+
+        \param [in] hsv - an input 24-bit HSV image.
+        \param [out] bgr - an output 24-bit BGR image.
+    */
+    template<template<class> class A> SIMD_INLINE void HsvToBgr(const View<A> & hsv, View<A> & bgr)
+    {
+        assert(EqualSize(hsv, bgr) && hsv.format == View<A>::Hsv24 && bgr.format == View<A>::Bgr24);
+
+        SimdHsvToBgr(hsv.data, hsv.width, hsv.height, hsv.stride, bgr.data, bgr.stride);
+    }
+
+    /*! @ingroup other_conversion
+
+        \fn void LabToBgr(const View<A> & lab, View<A> & bgr)
+
+        \short Converts 24-bit CIE Lab image to 24-bit BGR image.
+
+        All images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdLabToBgr.
+
+        \param [in] lab - an input 24-bit Lab image.
+        \param [out] bgr - an output 24-bit BGR image.
+    */
+    template<template<class> class A> SIMD_INLINE void LabToBgr(const View<A> & lab, View<A> & bgr)
+    {
+        assert(EqualSize(lab, bgr) && lab.format == View<A>::Lab24 && bgr.format == View<A>::Bgr24);
+
+        SimdLabToBgr(lab.data, lab.width, lab.height, lab.stride, bgr.data, bgr.stride);
+    }
+
+    /*! @ingroup other_conversion
+
+        \fn void Lab32fToBgr(const View<A> & lab, View<A> & bgr)
+
+        \short Converts CIE Lab image with 32-bit float channels to 24-bit BGR image.
+
+        The input image must have ::SimdPixelFormatFloat format, the same height and 3 times bigger width than the output image.
+
+        \note This function is a C++ wrapper for function ::SimdLab32fToBgr.
+
+        \param [in] lab - an input 32-bit float Lab image (3 interleaved channels).
+        \param [out] bgr - an output 24-bit BGR image.
+    */
+    template<template<class> class A> SIMD_INLINE void Lab32fToBgr(const View<A> & lab, View<A> & bgr)
+    {
+        assert(lab.width == bgr.width * 3 && lab.height == bgr.height && lab.format == View<A>::Float && bgr.format == View<A>::Bgr24);
+
+        SimdLab32fToBgr(lab.data, bgr.width, bgr.height, lab.stride, bgr.data, bgr.stride);
+    }
+
+    /*! @ingroup other_conversion
+
+        \fn void YCoCgRToBgr(const View<A> & y, const View<A> & co, const View<A> & cg, View<A> & bgr)
+
+        \short Converts reversible YCoCg-R planes to 24-bit BGR image.
+
+        All images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdYCoCgRToBgr.
+
+        \param [in] y - an input 8-bit Y plane.
+        \param [in] co - an input 16-bit signed Co plane.
+        \param [in] cg - an input 16-bit signed Cg plane.
+        \param [out] bgr - an output 24-bit BGR image.
+    */
+    template<template<class> class A> SIMD_INLINE void YCoCgRToBgr(const View<A> & y, const View<A> & co, const View<A> & cg, View<A> & bgr)
+    {
+        assert(EqualSize(y, bgr) && Compatible(co, cg) && EqualSize(y, co) && y.format == View<A>::Gray8 && co.format == View<A>::Int16 && bgr.format == View<A>::Bgr24);
+
+        SimdYCoCgRToBgr(y.data, y.stride, co.data, co.stride, cg.data, cg.stride, y.width, y.height, bgr.data, bgr.stride);
+    }
+
     /*! @ingroup other_conversion
 
         \fn void Int16ToGray(const View<A> & src, View<A> & dst)
@@ -1901,6 +2959,141 @@ namespace Simd
         SimdInt16ToGray(src.data, src.width, src.height, src.stride, dst.data, dst.stride);
     }
 
+    /*! @ingroup other_conversion
+
+        \fn void Uint16ToGray(const View<A> & src, size_t bitDepth, View<A> & dst, bool dither = false)
+
+        \short Converts 16-bit unsigned integer image with given bit depth (10, 12, 16 etc.) to 8-bit gray image.
+
+        All images must have the same width and height. Input image can be also UV plane of P016 image (::SimdPixelFormatUv32),
+        in this case output image must be UV plane of NV12 image (::SimdPixelFormatUv16).
+
+        For every point:
+        \verbatim
+        dst[i] = Min(255, (src[i] + level(x, y)) >> (bitDepth - 8));
+        \endverbatim
+        where level(x, y) is equal to the half of quantization step (rounding) or is taken from 4x4 ordered dithering matrix.
+
+        \note This function is a C++ wrapper for function ::SimdUint16ToGray.
+
+        \param [in] src - an input 16-bit unsigned integer image.
+        \param [in] bitDepth - a bit depth of input image. It must be in range (8, 16].
+        \param [out] dst - an output 8-bit gray image.
+        \param [in] dither - a flag of ordered dithering. By default rounding is used.
+    */
+    template<template<class> class A> SIMD_INLINE void Uint16ToGray(const View<A> & src, size_t bitDepth, View<A> & dst, bool dither = false)
+    {
+        assert(EqualSize(src, dst) && ((src.format == View<A>::Int16 && dst.format == View<A>::Gray8) || (src.format == View<A>::Uv32 && dst.format == View<A>::Uv16)));
+
+        SimdUint16ToGray(src.data, src.width*src.ChannelCount(), src.height, src.stride, bitDepth, dither ? SimdTrue : SimdFalse, dst.data, dst.stride);
+    }
+
+    /*! @ingroup other_conversion
+
+        \fn void Uint16ToFloat32(const View<A> & src, size_t bitDepth, View<A> & dst)
+
+        \short Converts 16-bit unsigned integer image with given bit depth (10, 12, 16 etc.) to 32-bit float image normalized to range [0, 1].
+
+        All images must have the same width and height.
+
+        For every point:
+        \verbatim
+        dst[i] = src[i] / ((1 << bitDepth) - 1);
+        \endverbatim
+
+        \note This function is a C++ wrapper for function ::SimdUint16ToFloat32.
+
+        \param [in] src - an input 16-bit unsigned integer image.
+        \param [in] bitDepth - a bit depth of input image. It must be in range (8, 16].
+        \param [out] dst - an output 32-bit float image.
+    */
+    template<template<class> class A> SIMD_INLINE void Uint16ToFloat32(const View<A> & src, size_t bitDepth, View<A> & dst)
+    {
+        assert(EqualSize(src, dst) && src.format == View<A>::Int16 && dst.format == View<A>::Float);
+
+        SimdUint16ToFloat32(src.data, src.width, src.height, src.stride, bitDepth, dst.data, dst.stride);
+    }
+
+    /*! @ingroup other_conversion
+
+        \fn void ChangeBitDepth(const View<A> & src, size_t srcBitDepth, View<A> & dst, size_t dstBitDepth)
+
+        \short Changes bit depth of image samples (8-bit or 16-bit unsigned integers).
+
+        All images must have the same width, height and channel count. Samples with bit depth 8 are stored in 8-bit channels
+        (::SimdPixelFormatGray8, ::SimdPixelFormatUv16), samples with bit depth in range (8, 16] are stored in 16-bit channels
+        (::SimdPixelFormatInt16, ::SimdPixelFormatUv32) and are aligned to least significant bit.
+
+        For every point:
+        \verbatim
+        if(dstBitDepth >= srcBitDepth)
+            dst[i] = src[i] << (dstBitDepth - srcBitDepth);
+        else
+            dst[i] = Min((src[i] + (1 << (srcBitDepth - dstBitDepth - 1))) >> (srcBitDepth - dstBitDepth), (1 << dstBitDepth) - 1);
+        \endverbatim
+
+        \note This function is a C++ wrapper for function ::SimdChangeBitDepth.
+
+        \param [in] src - an input image.
+        \param [in] srcBitDepth - a bit depth of input image. It must be in range [8, 16].
+        \param [out] dst - an output image.
+        \param [in] dstBitDepth - a bit depth of output image. It must be in range [8, 16].
+    */
+    template<template<class> class A> SIMD_INLINE void ChangeBitDepth(const View<A> & src, size_t srcBitDepth, View<A> & dst, size_t dstBitDepth)
+    {
+        assert(EqualSize(src, dst) && src.ChannelCount() == dst.ChannelCount() && src.ChannelSize() == (srcBitDepth > 8 ? 2 : 1) && dst.ChannelSize() == (dstBitDepth > 8 ? 2 : 1));
+
+        SimdChangeBitDepth(src.data, src.width*src.ChannelCount(), src.height, src.stride, srcBitDepth, dstBitDepth, dst.data, dst.stride);
+    }
+
+    /*! @ingroup other_conversion
+
+        \fn void InterleaveUvBitDepth(const View<A> & u, const View<A> & v, size_t srcBitDepth, View<A> & uv, size_t dstBitDepth)
+
+        \short Interleaves U and V planes into UV plane and changes bit depth of samples at the same time.
+
+        All images must have the same width and height. Input planes must have format ::SimdPixelFormatGray8 (bit depth 8) or ::SimdPixelFormatInt16.
+        Output plane must have format ::SimdPixelFormatUv16 (bit depth 8) or ::SimdPixelFormatUv32.
+
+        \note This function is a C++ wrapper for function ::SimdInterleaveUvBitDepth.
+
+        \param [in] u - an input U plane.
+        \param [in] v - an input V plane.
+        \param [in] srcBitDepth - a bit depth of input planes. It must be in range [8, 16].
+        \param [out] uv - an output UV plane.
+        \param [in] dstBitDepth - a bit depth of output plane. It must be in range [8, 16].
+    */
+    template<template<class> class A> SIMD_INLINE void InterleaveUvBitDepth(const View<A> & u, const View<A> & v, size_t srcBitDepth, View<A> & uv, size_t dstBitDepth)
+    {
+        assert(EqualSize(u, uv) && Compatible(u, v) && u.format == (srcBitDepth > 8 ? View<A>::Int16 : View<A>::Gray8) && uv.format == (dstBitDepth > 8 ? View<A>::Uv32 : View<A>::Uv16));
+
+        SimdInterleaveUvBitDepth(u.data, u.stride, v.data, v.stride, u.width, u.height, srcBitDepth, dstBitDepth, uv.data, uv.stride);
+    }
+
+    /*! @ingroup other_conversion
+
+        \fn void DeinterleaveUvBitDepth(const View<A> & uv, size_t srcBitDepth, View<A> & u, View<A> & v, size_t dstBitDepth)
+
+        \short Deinterleaves UV plane into U and V planes and changes bit depth of samples at the same time.
+
+        All images must have the same width and height. Input plane must have format ::SimdPixelFormatUv16 (bit depth 8) or ::SimdPixelFormatUv32.
+        Output planes must have format ::SimdPixelFormatGray8 (bit depth 8) or ::SimdPixelFormatInt16.
+
+        \note This function is a C++ wrapper for function ::SimdDeinterleaveUvBitDepth.
+
+        \param [in] uv - an input UV plane.
+        \param [in] srcBitDepth - a bit depth of input plane. It must be in range [8, 16].
+        \param [out] u - an output U plane.
+        \param [out] v - an output V plane.
+        \param [in] dstBitDepth - a bit depth of output planes. It must be in range [8, 16].
+    */
+    template<template<class> class A> SIMD_INLINE void DeinterleaveUvBitDepth(const View<A> & uv, size_t srcBitDepth, View<A> & u, View<A> & v, size_t dstBitDepth)
+    {
+        assert(EqualSize(uv, u) && Compatible(u, v) && uv.format == (srcBitDepth > 8 ? View<A>::Uv32 : View<A>::Uv16) && u.format == (dstBitDepth > 8 ? View<A>::Int16 : View<A>::Gray8));
+
+        SimdDeinterleaveUvBitDepth(uv.data, uv.stride, uv.width, uv.height, srcBitDepth, dstBitDepth, u.data, u.stride, v.data, v.stride);
+    }
+
     /*! @ingroup integral
 
         \fn void Integral(const View<A>& src, View<A>& sum)
@@ -2184,210 +3377,612 @@ namespace Simd
 
         \fn void LaplaceAbs(const View<A>& src, View<A>& dst)
 
-        \short Calculates absolute value of Laplace's filter.
+        \short Calculates absolute value of Laplace's filter.
+
+        All images must have the same width and height. Input image must has 8-bit gray format, output image must has 16-bit integer format.
+
+        For every point:
+        \verbatim
+        dst[x, y] = abs(
+            - src[x-1, y-1] -   src[x, y-1] - src[x+1, y-1]
+            - src[x-1, y]   + 8*src[x, y]   - src[x+1, y]
+            - src[x-1, y+1] -   src[x, y+1] - src[x+1, y+1]).
+        \endverbatim
+
+        \note This function is a C++ wrapper for function ::SimdLaplaceAbs.
+
+        \param [in] src - an input image.
+        \param [out] dst - an output image.
+    */
+    template<template<class> class A> SIMD_INLINE void LaplaceAbs(const View<A>& src, View<A>& dst)
+    {
+        assert(EqualSize(src, dst) && src.format == View<A>::Gray8 && dst.format == View<A>::Int16);
+
+        SimdLaplaceAbs(src.data, src.stride, src.width, src.height, dst.data, dst.stride);
+    }
+
+    /*! @ingroup other_statistic
+
+        \fn void LaplaceAbsSum(const View<A>& src, uint64_t & sum)
+
+        \short Calculates sum of absolute value of Laplace's filter.
+
+        Input image must has 8-bit gray format.
+
+        For every point:
+        \verbatim
+        sum += abs(
+            - src[x-1, y-1] -   src[x, y-1] - src[x+1, y-1]
+            - src[x-1, y]   + 8*src[x, y]   - src[x+1, y]
+            - src[x-1, y+1] -   src[x, y+1] - src[x+1, y+1]).
+        \endverbatim
+
+        \note This function is a C++ wrapper for function ::SimdLaplaceAbsSum.
+
+        \param [in] src - an input image.
+        \param [out] sum - a result sum.
+    */
+    template<template<class> class A> SIMD_INLINE void LaplaceAbsSum(const View<A> & src, uint64_t & sum)
+    {
+        assert(src.format == View<A>::Gray8);
+
+        SimdLaplaceAbsSum(src.data, src.stride, src.width, src.height, &sum);
+    }
+
+    /*! @ingroup other_filter
+
+        \fn void LbpEstimate(const View<A>& src, View<A>& dst)
+
+        \short Calculates LBP (Local Binary Patterns) for 8-bit gray image.
+
+        All images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdLbpEstimate.
+
+        \param [in] src - an input 8-bit gray image.
+        \param [out] dst - an output 8-bit gray image with LBP.
+    */
+    template<template<class> class A> SIMD_INLINE void LbpEstimate(const View<A>& src, View<A>& dst)
+    {
+        assert(Compatible(src, dst) && src.format == View<A>::Gray8);
+
+        SimdLbpEstimate(src.data, src.stride, src.width, src.height, dst.data, dst.stride);
+    }
+
+    /*! @ingroup other_filter
+
+        \fn void MeanFilter3x3(const View<A>& src, View<A>& dst)
+
+        \short Performs an averaging with window 3x3.
+
+        For every point:
+        \verbatim
+        dst[x, y] = (src[x-1, y-1] + src[x, y-1] + src[x+1, y-1] +
+                     src[x-1, y] + src[x, y] + src[x+1, y] +
+                     src[x-1, y+1] + src[x, y+1] + src[x+1, y+1] + 4) / 9;
+        \endverbatim
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        \note This function is a C++ wrapper for function ::SimdMeanFilter3x3.
+
+        \param [in] src - a source image.
+        \param [out] dst - a destination image.
+    */
+    template<template<class> class A> SIMD_INLINE void MeanFilter3x3(const View<A>& src, View<A>& dst)
+    {
+        assert(Compatible(src, dst) && src.ChannelSize() == 1);
+
+        SimdMeanFilter3x3(src.data, src.stride, src.width, src.height, src.ChannelCount(), dst.data, dst.stride);
+    }
+
+    /*! @ingroup median_filter
+
+        \fn void MedianFilterRhomb3x3(const View<A>& src, View<A>& dst)
+
+        \short Performs median filtration of input image (filter window is a rhomb 3x3).
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        \note This function is a C++ wrapper for function ::SimdMedianFilterRhomb3x3.
+
+        \param [in] src - an original input image.
+        \param [out] dst - a filtered output image.
+    */
+    template<template<class> class A> SIMD_INLINE void MedianFilterRhomb3x3(const View<A>& src, View<A>& dst)
+    {
+        assert(Compatible(src, dst) && src.ChannelSize() == 1);
+
+        SimdMedianFilterRhomb3x3(src.data, src.stride, src.width, src.height, src.ChannelCount(), dst.data, dst.stride);
+    }
+
+    /*! @ingroup median_filter
+
+        \fn void MedianFilterRhomb5x5(const View<A>& src, View<A>& dst)
+
+        \short Performs median filtration of input image (filter window is a rhomb 5x5).
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        \note This function is a C++ wrapper for function ::SimdMedianFilterRhomb5x5.
+
+        \param [in] src - an original input image.
+        \param [out] dst - a filtered output image.
+    */
+    template<template<class> class A> SIMD_INLINE void MedianFilterRhomb5x5(const View<A>& src, View<A>& dst)
+    {
+        assert(Compatible(src, dst) && src.ChannelSize() == 1);
+
+        SimdMedianFilterRhomb5x5(src.data, src.stride, src.width, src.height, src.ChannelCount(), dst.data, dst.stride);
+    }
+
+    /*! @ingroup median_filter
+
+        \fn void MedianFilterSquare3x3(const View<A>& src, View<A>& dst)
+
+        \short Performs median filtration of input image (filter window is a square 3x3).
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        \note This function is a C++ wrapper for function ::SimdMedianFilterSquare3x3.
+
+        \param [in] src - an original input image.
+        \param [out] dst - a filtered output image.
+    */
+    template<template<class> class A> SIMD_INLINE void MedianFilterSquare3x3(const View<A>& src, View<A>& dst)
+    {
+        assert(Compatible(src, dst) && src.ChannelSize() == 1);
+
+        SimdMedianFilterSquare3x3(src.data, src.stride, src.width, src.height, src.ChannelCount(), dst.data, dst.stride);
+    }
+
+    /*! @ingroup median_filter
+
+        \fn void MedianFilterSquare5x5(const View<A>& src, View<A>& dst)
+
+        \short Performs median filtration of input image (filter window is a square 5x5).
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        \note This function is a C++ wrapper for function ::SimdMedianFilterSquare5x5.
+
+        \param [in] src - an original input image.
+        \param [out] dst - a filtered output image.
+    */
+    template<template<class> class A> SIMD_INLINE void MedianFilterSquare5x5(const View<A>& src, View<A>& dst)
+    {
+        assert(Compatible(src, dst) && src.ChannelSize() == 1);
+
+        SimdMedianFilterSquare5x5(src.data, src.stride, src.width, src.height, src.ChannelCount(), dst.data, dst.stride);
+    }
+
+    /*! @ingroup neural
+
+        \fn void NeuralConvert(const View<A> & src, float * dst, size_t stride, bool inversion)
+
+        \short Converts a 8-bit gray image to the 32-bit float array.
+
+        The length of output array must be equal to the area of input image.
+
+        For every point:
+        \verbatim
+        dst[i] = inversion ? (255 - src[col]) / 255 : src[i]/255;
+        \endverbatim
+
+        \note This function is a C++ wrapper for function ::SimdNeuralConvert.
+
+        \param [in] src - an input image.
+        \param [out] dst - a pointer to output array.
+        \param [in] stride - a row size of the output array.
+        \param [in] inversion - a flag of color inversion.
+    */
+    template<template<class> class A> SIMD_INLINE void NeuralConvert(const View<A> & src, float * dst, size_t stride, bool inversion)
+    {
+        assert(src.format == View<A>::Gray8);
+
+        SimdNeuralConvert(src.data, src.stride, src.width, src.height, dst, stride, inversion ? 1 : 0);
+    }
+
+    /*! @ingroup synet
+
+        \short Describes a detection of SSD-like detector. It is used in function Simd::SynetDetectionOutput.
+    */
+    struct SynetDetection
+    {
+        size_t label; /*!< An index of detected class. */
+        float score; /*!< A score of detection. */
+        Rectangle<float> rect; /*!< A bounding box of detection. */
+    };
+
+    /*! @ingroup synet
+
+        \fn void SynetDetectionOutput(const float * loc, const float * conf, const float * prior, size_t count, size_t classes, ptrdiff_t background, float scoreThreshold, float nmsThreshold, size_t topK, size_t keepTopK, bool classAware, std::vector<SynetDetection> & detections)
+
+        \short Performs post-processing of SSD-like detector output: decodes boxes, selects them with score thresholding and non-maximum suppression.
+
+        \note This function is a C++ wrapper for functions ::SimdSynetDetectionDecode32f and ::SimdSynetDetectionNms32f.
+
+        \param [in] loc - a pointer to the 32-bit float array with box regressions. The size of the array must be equal to 4*count.
+        \param [in] conf - a pointer to the 32-bit float array with scores of boxes. The size of the array must be equal to count*classes.
+        \param [in] prior - a pointer to the 32-bit float array with prior boxes followed by their variances. The size of the array must be equal to 8*count.
+        \param [in] count - a number of boxes.
+        \param [in] classes - a number of classes.
+        \param [in] background - an index of background class. It is ignored if it is negative.
+        \param [in] scoreThreshold - a minimal score of selected boxes.
+        \param [in] nmsThreshold - a IoU threshold of non-maximum suppression.
+        \param [in] topK - a maximal number of boxes per class which participate in non-maximum suppression. Zero value means no restriction.
+        \param [in] keepTopK - a maximal number of output detections.
+        \param [in] classAware - a flag of class-aware non-maximum suppression.
+        \param [out] detections - a list of output detections sorted in descending order of score.
+    */
+    SIMD_INLINE void SynetDetectionOutput(const float * loc, const float * conf, const float * prior, size_t count, size_t classes, ptrdiff_t background, 
+        float scoreThreshold, float nmsThreshold, size_t topK, size_t keepTopK, bool classAware, std::vector<SynetDetection> & detections)
+    {
+        std::vector<float> boxes(count * 4), buffer(keepTopK * 6);
+        SimdSynetDetectionDecode32f(loc, prior, count, boxes.data());
+        size_t size = SimdSynetDetectionNms32f(boxes.data(), conf, count, classes, background, scoreThreshold, 
+            nmsThreshold, topK, keepTopK, classAware ? SimdTrue : SimdFalse, buffer.data());
+        detections.resize(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            const float * src = buffer.data() + i * 6;
+            detections[i].label = (size_t)src[0];
+            detections[i].score = src[1];
+            detections[i].rect = Rectangle<float>(src[2], src[3], src[4], src[5]);
+        }
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr)
+
+        \short Converts NV12 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input UV image has interleaved U and V components (16 bits per pixel) and half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToBgr.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved U and V color planes.
+        \param [out] bgr - an output 24-bit BGR image.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height);
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && bgr.format == View<A>::Bgr24);
+
+        SimdNv12ToBgr(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgr.data, bgr.stride);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType)
+
+        \short Converts NV12 image to 24-bit BGR image with using of given YUV color matrix.
+
+        The input Y and output BGR images must have the same width and height.
+        The input UV image has interleaved U and V components (16 bits per pixel) and half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToBgrV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved U and V color planes.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height);
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && bgr.format == View<A>::Bgr24);
+
+        SimdNv12ToBgrV2(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF)
+
+        \short Converts NV12 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image has interleaved U and V components (16 bits per pixel) and half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToBgra.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved U and V color planes.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height);
+        assert(y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && bgra.format == View<A>::Bgra32);
+
+        SimdNv12ToBgra(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgra.data, bgra.stride, alpha);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha, SimdYuvType yuvType)
+
+        \short Converts NV12 image to 32-bit BGRA image with using of given YUV color matrix.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image has interleaved U and V components (16 bits per pixel) and half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToBgraV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved U and V color planes.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha, SimdYuvType yuvType)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height);
+        assert(y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && bgra.format == View<A>::Bgra32);
+
+        SimdNv12ToBgraV2(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToHue(const View<A>& y, const View<A>& uv, View<A>& hue)
+
+        \short Converts NV12 image to 8-bit image with Hue component of HSV or HSL color space.
+
+        The input Y and output Hue images must have the same width and height.
+        The input UV image has interleaved U and V components (16 bits per pixel) and half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToHue.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved U and V color planes.
+        \param [out] hue - an output 8-bit Hue image.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToHue(const View<A>& y, const View<A>& uv, View<A>& hue)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height);
+        assert(y.width == hue.width && y.height == hue.height);
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && hue.format == View<A>::Gray8);
+
+        SimdNv12ToHue(y.data, y.stride, uv.data, uv.stride, y.width, y.height, hue.data, hue.stride);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToHue(const View<A>& y, const View<A>& uv, View<A>& hue, SimdYuvType yuvType)
 
-        All images must have the same width and height. Input image must has 8-bit gray format, output image must has 16-bit integer format.
+        \short Converts NV12 image to 8-bit image with Hue component of HSV or HSL color space with using of given YUV color matrix.
 
-        For every point:
-        \verbatim
-        dst[x, y] = abs(
-            - src[x-1, y-1] -   src[x, y-1] - src[x+1, y-1]
-            - src[x-1, y]   + 8*src[x, y]   - src[x+1, y]
-            - src[x-1, y+1] -   src[x, y+1] - src[x+1, y+1]).
-        \endverbatim
+        The input Y and output Hue images must have the same width and height.
+        The input UV image has interleaved U and V components (16 bits per pixel) and half size relative to Y component.
 
-        \note This function is a C++ wrapper for function ::SimdLaplaceAbs.
+        \note This function is a C++ wrapper for function ::SimdNv12ToHueV2.
 
-        \param [in] src - an input image.
-        \param [out] dst - an output image.
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved U and V color planes.
+        \param [out] hue - an output 8-bit Hue image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
     */
-    template<template<class> class A> SIMD_INLINE void LaplaceAbs(const View<A>& src, View<A>& dst)
+    template<template<class> class A> SIMD_INLINE void Nv12ToHue(const View<A>& y, const View<A>& uv, View<A>& hue, SimdYuvType yuvType)
     {
-        assert(EqualSize(src, dst) && src.format == View<A>::Gray8 && dst.format == View<A>::Int16);
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height);
+        assert(y.width == hue.width && y.height == hue.height);
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && hue.format == View<A>::Gray8);
 
-        SimdLaplaceAbs(src.data, src.stride, src.width, src.height, dst.data, dst.stride);
+        SimdNv12ToHueV2(y.data, y.stride, uv.data, uv.stride, y.width, y.height, hue.data, hue.stride, yuvType);
     }
 
-    /*! @ingroup other_statistic
-
-        \fn void LaplaceAbsSum(const View<A>& src, uint64_t & sum)
+    /*! @ingroup yuv_conversion
 
-        \short Calculates sum of absolute value of Laplace's filter.
+        \fn void Nv21ToBgr(const View<A>& y, const View<A>& vu, View<A>& bgr)
 
-        Input image must has 8-bit gray format.
+        \short Converts NV21 image to 24-bit BGR image.
 
-        For every point:
-        \verbatim
-        sum += abs(
-            - src[x-1, y-1] -   src[x, y-1] - src[x+1, y-1]
-            - src[x-1, y]   + 8*src[x, y]   - src[x+1, y]
-            - src[x-1, y+1] -   src[x, y+1] - src[x+1, y+1]).
-        \endverbatim
+        The input Y and output BGR images must have the same width and height.
+        The input VU image has interleaved V and U components (16 bits per pixel) and half size relative to Y component.
 
-        \note This function is a C++ wrapper for function ::SimdLaplaceAbsSum.
+        \note This function is a C++ wrapper for function ::SimdNv21ToBgr.
 
-        \param [in] src - an input image.
-        \param [out] sum - a result sum.
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] vu - an input 16-bit image with interleaved V and U color planes.
+        \param [out] bgr - an output 24-bit BGR image.
     */
-    template<template<class> class A> SIMD_INLINE void LaplaceAbsSum(const View<A> & src, uint64_t & sum)
+    template<template<class> class A> SIMD_INLINE void Nv21ToBgr(const View<A>& y, const View<A>& vu, View<A>& bgr)
     {
-        assert(src.format == View<A>::Gray8);
+        assert(y.width == 2 * vu.width && y.height == 2 * vu.height);
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && vu.format == View<A>::Uv16 && bgr.format == View<A>::Bgr24);
 
-        SimdLaplaceAbsSum(src.data, src.stride, src.width, src.height, &sum);
+        SimdNv21ToBgr(y.data, y.stride, vu.data, vu.stride, y.width, y.height, bgr.data, bgr.stride);
     }
 
-    /*! @ingroup other_filter
+    /*! @ingroup yuv_conversion
 
-        \fn void LbpEstimate(const View<A>& src, View<A>& dst)
+        \fn void Nv21ToBgr(const View<A>& y, const View<A>& vu, View<A>& bgr, SimdYuvType yuvType)
 
-        \short Calculates LBP (Local Binary Patterns) for 8-bit gray image.
+        \short Converts NV21 image to 24-bit BGR image with using of given YUV color matrix.
 
-        All images must have the same width and height.
+        The input Y and output BGR images must have the same width and height.
+        The input VU image has interleaved V and U components (16 bits per pixel) and half size relative to Y component.
 
-        \note This function is a C++ wrapper for function ::SimdLbpEstimate.
+        \note This function is a C++ wrapper for function ::SimdNv21ToBgrV2.
 
-        \param [in] src - an input 8-bit gray image.
-        \param [out] dst - an output 8-bit gray image with LBP.
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] vu - an input 16-bit image with interleaved V and U color planes.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
     */
-    template<template<class> class A> SIMD_INLINE void LbpEstimate(const View<A>& src, View<A>& dst)
+    template<template<class> class A> SIMD_INLINE void Nv21ToBgr(const View<A>& y, const View<A>& vu, View<A>& bgr, SimdYuvType yuvType)
     {
-        assert(Compatible(src, dst) && src.format == View<A>::Gray8);
+        assert(y.width == 2 * vu.width && y.height == 2 * vu.height);
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && vu.format == View<A>::Uv16 && bgr.format == View<A>::Bgr24);
 
-        SimdLbpEstimate(src.data, src.stride, src.width, src.height, dst.data, dst.stride);
+        SimdNv21ToBgrV2(y.data, y.stride, vu.data, vu.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
     }
 
-    /*! @ingroup other_filter
-
-        \fn void MeanFilter3x3(const View<A>& src, View<A>& dst)
+    /*! @ingroup yuv_conversion
 
-        \short Performs an averaging with window 3x3.
+        \fn void Nv21ToBgra(const View<A>& y, const View<A>& vu, View<A>& bgra, uint8_t alpha = 0xFF)
 
-        For every point:
-        \verbatim
-        dst[x, y] = (src[x-1, y-1] + src[x, y-1] + src[x+1, y-1] +
-                     src[x-1, y] + src[x, y] + src[x+1, y] +
-                     src[x-1, y+1] + src[x, y+1] + src[x+1, y+1] + 4) / 9;
-        \endverbatim
+        \short Converts NV21 image to 32-bit BGRA image.
 
-        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+        The input Y and output BGRA images must have the same width and height.
+        The input VU image has interleaved V and U components (16 bits per pixel) and half size relative to Y component.
 
-        \note This function is a C++ wrapper for function ::SimdMeanFilter3x3.
+        \note This function is a C++ wrapper for function ::SimdNv21ToBgra.
 
-        \param [in] src - a source image.
-        \param [out] dst - a destination image.
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] vu - an input 16-bit image with interleaved V and U color planes.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
     */
-    template<template<class> class A> SIMD_INLINE void MeanFilter3x3(const View<A>& src, View<A>& dst)
+    template<template<class> class A> SIMD_INLINE void Nv21ToBgra(const View<A>& y, const View<A>& vu, View<A>& bgra, uint8_t alpha = 0xFF)
     {
-        assert(Compatible(src, dst) && src.ChannelSize() == 1);
+        assert(y.width == 2 * vu.width && y.height == 2 * vu.height);
+        assert(y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && vu.format == View<A>::Uv16 && bgra.format == View<A>::Bgra32);
 
-        SimdMeanFilter3x3(src.data, src.stride, src.width, src.height, src.ChannelCount(), dst.data, dst.stride);
+        SimdNv21ToBgra(y.data, y.stride, vu.data, vu.stride, y.width, y.height, bgra.data, bgra.stride, alpha);
     }
 
-    /*! @ingroup median_filter
+    /*! @ingroup yuv_conversion
 
-        \fn void MedianFilterRhomb3x3(const View<A>& src, View<A>& dst)
+        \fn void Nv21ToBgra(const View<A>& y, const View<A>& vu, View<A>& bgra, uint8_t alpha, SimdYuvType yuvType)
 
-        \short Performs median filtration of input image (filter window is a rhomb 3x3).
+        \short Converts NV21 image to 32-bit BGRA image with using of given YUV color matrix.
 
-        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+        The input Y and output BGRA images must have the same width and height.
+        The input VU image has interleaved V and U components (16 bits per pixel) and half size relative to Y component.
 
-        \note This function is a C++ wrapper for function ::SimdMedianFilterRhomb3x3.
+        \note This function is a C++ wrapper for function ::SimdNv21ToBgraV2.
 
-        \param [in] src - an original input image.
-        \param [out] dst - a filtered output image.
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] vu - an input 16-bit image with interleaved V and U color planes.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
     */
-    template<template<class> class A> SIMD_INLINE void MedianFilterRhomb3x3(const View<A>& src, View<A>& dst)
+    template<template<class> class A> SIMD_INLINE void Nv21ToBgra(const View<A>& y, const View<A>& vu, View<A>& bgra, uint8_t alpha, SimdYuvType yuvType)
     {
-        assert(Compatible(src, dst) && src.ChannelSize() == 1);
+        assert(y.width == 2 * vu.width && y.height == 2 * vu.height);
+        assert(y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && vu.format == View<A>::Uv16 && bgra.format == View<A>::Bgra32);
 
-        SimdMedianFilterRhomb3x3(src.data, src.stride, src.width, src.height, src.ChannelCount(), dst.data, dst.stride);
+        SimdNv21ToBgraV2(y.data, y.stride, vu.data, vu.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
     }
 
-    /*! @ingroup median_filter
+    /*! @ingroup yuv_conversion
 
-        \fn void MedianFilterRhomb5x5(const View<A>& src, View<A>& dst)
+        \fn void Nv21ToHue(const View<A>& y, const View<A>& vu, View<A>& hue)
 
-        \short Performs median filtration of input image (filter window is a rhomb 5x5).
+        \short Converts NV21 image to 8-bit image with Hue component of HSV or HSL color space.
 
-        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+        The input Y and output Hue images must have the same width and height.
+        The input VU image has interleaved V and U components (16 bits per pixel) and half size relative to Y component.
 
-        \note This function is a C++ wrapper for function ::SimdMedianFilterRhomb5x5.
+        \note This function is a C++ wrapper for function ::SimdNv21ToHue.
 
-        \param [in] src - an original input image.
-        \param [out] dst - a filtered output image.
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] vu - an input 16-bit image with interleaved V and U color planes.
+        \param [out] hue - an output 8-bit Hue image.
     */
-    template<template<class> class A> SIMD_INLINE void MedianFilterRhomb5x5(const View<A>& src, View<A>& dst)
+    template<template<class> class A> SIMD_INLINE void Nv21ToHue(const View<A>& y, const View<A>& vu, View<A>& hue)
     {
-        assert(Compatible(src, dst) && src.ChannelSize() == 1);
+        assert(y.width == 2 * vu.width && y.height == 2 * vu.height);
+        assert(y.width == hue.width && y.height == hue.height);
+        assert(y.format == View<A>::Gray8 && vu.format == View<A>::Uv16 && hue.format == View<A>::Gray8);
 
-        SimdMedianFilterRhomb5x5(src.data, src.stride, src.width, src.height, src.ChannelCount(), dst.data, dst.stride);
+        SimdNv21ToHue(y.data, y.stride, vu.data, vu.stride, y.width, y.height, hue.data, hue.stride);
     }
 
-    /*! @ingroup median_filter
+    /*! @ingroup yuv_conversion
 
-        \fn void MedianFilterSquare3x3(const View<A>& src, View<A>& dst)
+        \fn void Nv21ToHue(const View<A>& y, const View<A>& vu, View<A>& hue, SimdYuvType yuvType)
 
-        \short Performs median filtration of input image (filter window is a square 3x3).
+        \short Converts NV21 image to 8-bit image with Hue component of HSV or HSL color space with using of given YUV color matrix.
 
-        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+        The input Y and output Hue images must have the same width and height.
+        The input VU image has interleaved V and U components (16 bits per pixel) and half size relative to Y component.
 
-        \note This function is a C++ wrapper for function ::SimdMedianFilterSquare3x3.
+        \note This function is a C++ wrapper for function ::SimdNv21ToHueV2.
 
-        \param [in] src - an original input image.
-        \param [out] dst - a filtered output image.
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] vu - an input 16-bit image with interleaved V and U color planes.
+        \param [out] hue - an output 8-bit Hue image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
     */
-    template<template<class> class A> SIMD_INLINE void MedianFilterSquare3x3(const View<A>& src, View<A>& dst)
+    template<template<class> class A> SIMD_INLINE void Nv21ToHue(const View<A>& y, const View<A>& vu, View<A>& hue, SimdYuvType yuvType)
     {
-        assert(Compatible(src, dst) && src.ChannelSize() == 1);
+        assert(y.width == 2 * vu.width && y.height == 2 * vu.height);
+        assert(y.width == hue.width && y.height == hue.height);
+        assert(y.format == View<A>::Gray8 && vu.format == View<A>::Uv16 && hue.format == View<A>::Gray8);
 
-        SimdMedianFilterSquare3x3(src.data, src.stride, src.width, src.height, src.ChannelCount(), dst.data, dst.stride);
+        SimdNv21ToHueV2(y.data, y.stride, vu.data, vu.stride, y.width, y.height, hue.data, hue.stride, yuvType);
     }
 
-    /*! @ingroup median_filter
+    /*! @ingroup yuv_conversion
 
-        \fn void MedianFilterSquare5x5(const View<A>& src, View<A>& dst)
+        \fn void P016ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, bool dither = false, SimdYuvType yuvType = SimdYuvBt601, uint8_t * buffer = NULL)
 
-        \short Performs median filtration of input image (filter window is a square 5x5).
+        \short Converts P016 (P010, P012) image to 24-bit BGR image.
 
-        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+        The input Y and output BGR images must have the same width and height.
+        The input UV image has interleaved U and V components (2 x 16 bits per pixel) and half size relative to Y component.
 
-        \note This function is a C++ wrapper for function ::SimdMedianFilterSquare5x5.
+        \note This function is a C++ wrapper for function ::SimdP016ToBgr.
 
-        \param [in] src - an original input image.
-        \param [out] dst - a filtered output image.
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] uv - an input 32-bit image with interleaved U and V color planes.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] dither - a flag of ordered dithering. By default rounding is used.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType). By default it is BT.601.
+        \param [in, out] buffer - a pointer to external temporary buffer of size ::SimdYuv16BufferSize(y.width). By default it is NULL (internal buffer is used).
     */
-    template<template<class> class A> SIMD_INLINE void MedianFilterSquare5x5(const View<A>& src, View<A>& dst)
+    template<template<class> class A> SIMD_INLINE void P016ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, bool dither = false, SimdYuvType yuvType = SimdYuvBt601, uint8_t * buffer = NULL)
     {
-        assert(Compatible(src, dst) && src.ChannelSize() == 1);
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height);
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Int16 && uv.format == View<A>::Uv32 && bgr.format == View<A>::Bgr24);
 
-        SimdMedianFilterSquare5x5(src.data, src.stride, src.width, src.height, src.ChannelCount(), dst.data, dst.stride);
+        SimdP016ToBgr(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgr.data, bgr.stride, dither ? SimdTrue : SimdFalse, yuvType, buffer);
     }
 
-    /*! @ingroup neural
-
-        \fn void NeuralConvert(const View<A> & src, float * dst, size_t stride, bool inversion)
+    /*! @ingroup yuv_conversion
 
-        \short Converts a 8-bit gray image to the 32-bit float array.
+        \fn void P016ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, bool dither = false, SimdYuvType yuvType = SimdYuvBt601, uint8_t * buffer = NULL)
 
-        The length of output array must be equal to the area of input image.
+        \short Converts P016 (P010, P012) image to 32-bit BGRA image.
 
-        For every point:
-        \verbatim
-        dst[i] = inversion ? (255 - src[col]) / 255 : src[i]/255;
-        \endverbatim
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image has interleaved U and V components (2 x 16 bits per pixel) and half size relative to Y component.
 
-        \note This function is a C++ wrapper for function ::SimdNeuralConvert.
+        \note This function is a C++ wrapper for function ::SimdP016ToBgra.
 
-        \param [in] src - an input image.
-        \param [out] dst - a pointer to output array.
-        \param [in] stride - a row size of the output array.
-        \param [in] inversion - a flag of color inversion.
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] uv - an input 32-bit image with interleaved U and V color planes.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] dither - a flag of ordered dithering. By default rounding is used.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType). By default it is BT.601.
+        \param [in, out] buffer - a pointer to external temporary buffer of size ::SimdYuv16BufferSize(y.width). By default it is NULL (internal buffer is used).
     */
-    template<template<class> class A> SIMD_INLINE void NeuralConvert(const View<A> & src, float * dst, size_t stride, bool inversion)
+    template<template<class> class A> SIMD_INLINE void P016ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, bool dither = false, SimdYuvType yuvType = SimdYuvBt601, uint8_t * buffer = NULL)
     {
-        assert(src.format == View<A>::Gray8);
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height);
+        assert(y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Int16 && uv.format == View<A>::Uv32 && bgra.format == View<A>::Bgra32);
 
-        SimdNeuralConvert(src.data, src.stride, src.width, src.height, dst, stride, inversion ? 1 : 0);
+        SimdP016ToBgra(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgra.data, bgra.stride, alpha, dither ? SimdTrue : SimdFalse, yuvType, buffer);
     }
 
     /*! @ingroup operation
@@ -2732,6 +4327,196 @@ namespace Simd
         }
     }
 
+    /*! @ingroup rgb_conversion
+
+        \fn void RgbToGray(const View<A>& rgb, View<A>& gray)
+
+        \short Converts 24-bit RGB image to 8-bit gray image.
+
+        All images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdRgbToGray.
+
+        \param [in] rgb - an input 24-bit RGB image.
+        \param [out] gray - an output 8-bit gray image.
+    */
+    template<template<class> class A> SIMD_INLINE void RgbToGray(const View<A>& rgb, View<A>& gray)
+    {
+        assert(EqualSize(rgb, gray) && rgb.format == View<A>::Rgb24 && gray.format == View<A>::Gray8);
+
+        SimdRgbToGray(rgb.data, rgb.width, rgb.height, rgb.stride, gray.data, gray.stride);
+    }
+
+    /*! @ingroup rgb_conversion
+
+        \fn void RgbToYuv420p(const View<A>& rgb, View<A>& y, View<A>& u, View<A>& v)
+
+        \short Converts 24-bit RGB image to YUV420P.
+
+        The input RGB and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdRgbToYuv420p.
+
+        \param [in] rgb - an input 24-bit RGB image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] u - an output 8-bit image with U color plane.
+        \param [out] v - an output 8-bit image with V color plane.
+    */
+    template<template<class> class A> SIMD_INLINE void RgbToYuv420p(const View<A>& rgb, View<A>& y, View<A>& u, View<A>& v)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
+        assert(y.width == rgb.width && y.height == rgb.height);
+        assert(y.format == View<A>::Gray8 && rgb.format == View<A>::Rgb24);
+
+        SimdRgbToYuv420p(rgb.data, rgb.width, rgb.height, rgb.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+    }
+
+    /*! @ingroup rgb_conversion
+
+        \fn void RgbToYuv422p(const View<A>& rgb, View<A>& y, View<A>& u, View<A>& v)
+
+        \short Converts 24-bit RGB image to YUV422P.
+
+        The input RGB and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \note This function is a C++ wrapper for function ::SimdRgbToYuv422p.
+
+        \param [in] rgb - an input 24-bit RGB image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] u - an output 8-bit image with U color plane.
+        \param [out] v - an output 8-bit image with V color plane.
+    */
+    template<template<class> class A> SIMD_INLINE void RgbToYuv422p(const View<A>& rgb, View<A>& y, View<A>& u, View<A>& v)
+    {
+        assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
+        assert(y.width == rgb.width && y.height == rgb.height);
+        assert(y.format == View<A>::Gray8 && rgb.format == View<A>::Rgb24);
+
+        SimdRgbToYuv422p(rgb.data, rgb.width, rgb.height, rgb.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+    }
+
+    /*! @ingroup rgb_conversion
+
+        \fn void RgbToYuv444p(const View<A>& rgb, View<A>& y, View<A>& u, View<A>& v)
+
+        \short Converts 24-bit RGB image to YUV444P.
+
+        The input RGB and output Y, U and V images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdRgbToYuv444p.
+
+        \param [in] rgb - an input 24-bit RGB image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] u - an output 8-bit image with U color plane.
+        \param [out] v - an output 8-bit image with V color plane.
+    */
+    template<template<class> class A> SIMD_INLINE void RgbToYuv444p(const View<A>& rgb, View<A>& y, View<A>& u, View<A>& v)
+    {
+        assert(EqualSize(rgb, y) && Compatible(y, u, v));
+        assert(y.format == View<A>::Gray8 && rgb.format == View<A>::Rgb24);
+
+        SimdRgbToYuv444p(rgb.data, rgb.width, rgb.height, rgb.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+    }
+
+    /*! @ingroup rgba_conversion
+
+        \fn void RgbaToGray(const View<A>& rgba, View<A>& gray)
+
+        \short Converts 32-bit RGBA image to 8-bit gray image.
+
+        All images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdRgbaToGray.
+
+        \param [in] rgba - an input 32-bit RGBA image.
+        \param [out] gray - an output 8-bit gray image.
+    */
+    template<template<class> class A> SIMD_INLINE void RgbaToGray(const View<A>& rgba, View<A>& gray)
+    {
+        assert(EqualSize(rgba, gray) && rgba.format == View<A>::Rgba32 && gray.format == View<A>::Gray8);
+
+        SimdRgbaToGray(rgba.data, rgba.width, rgba.height, rgba.stride, gray.data, gray.stride);
+    }
+
+    /*! @ingroup rgba_conversion
+
+        \fn void RgbaToYuv420p(const View<A>& rgba, View<A>& y, View<A>& u, View<A>& v)
+
+        \short Converts 32-bit RGBA image to YUV420P.
+
+        The input RGBA and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdRgbaToYuv420p.
+
+        \param [in] rgba - an input 32-bit RGBA image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] u - an output 8-bit image with U color plane.
+        \param [out] v - an output 8-bit image with V color plane.
+    */
+    template<template<class> class A> SIMD_INLINE void RgbaToYuv420p(const View<A>& rgba, View<A>& y, View<A>& u, View<A>& v)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
+        assert(y.width == rgba.width && y.height == rgba.height);
+        assert(y.format == View<A>::Gray8 && rgba.format == View<A>::Rgba32);
+
+        SimdRgbaToYuv420p(rgba.data, rgba.width, rgba.height, rgba.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+    }
+
+    /*! @ingroup rgba_conversion
+
+        \fn void RgbaToYuv422p(const View<A>& rgba, View<A>& y, View<A>& u, View<A>& v)
+
+        \short Converts 32-bit RGBA image to YUV422P.
+
+        The input RGBA and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \note This function is a C++ wrapper for function ::SimdRgbaToYuv422p.
+
+        \param [in] rgba - an input 32-bit RGBA image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] u - an output 8-bit image with U color plane.
+        \param [out] v - an output 8-bit image with V color plane.
+    */
+    template<template<class> class A> SIMD_INLINE void RgbaToYuv422p(const View<A>& rgba, View<A>& y, View<A>& u, View<A>& v)
+    {
+        assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
+        assert(y.width == rgba.width && y.height == rgba.height);
+        assert(y.format == View<A>::Gray8 && rgba.format == View<A>::Rgba32);
+
+        SimdRgbaToYuv422p(rgba.data, rgba.width, rgba.height, rgba.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+    }
+
+    /*! @ingroup rgba_conversion
+
+        \fn void RgbaToYuv444p(const View<A>& rgba, View<A>& y, View<A>& u, View<A>& v)
+
+        \short Converts 32-bit RGBA image to YUV444P.
+
+        The input RGBA and output Y, U and V images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdRgbaToYuv444p.
+
+        \param [in] rgba - an input 32-bit RGBA image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] u - an output 8-bit image with U color plane.
+        \param [out] v - an output 8-bit image with V color plane.
+    */
+    template<template<class> class A> SIMD_INLINE void RgbaToYuv444p(const View<A>& rgba, View<A>& y, View<A>& u, View<A>& v)
+    {
+        assert(EqualSize(rgba, y) && Compatible(y, u, v));
+        assert(y.format == View<A>::Gray8 && rgba.format == View<A>::Rgba32);
+
+        SimdRgbaToYuv444p(rgba.data, rgba.width, rgba.height, rgba.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+    }
+
     /*! @ingroup segmentation
 
         \fn void SegmentationChangeIndex(View<A> & mask, uint8_t oldIndex, uint8_t newIndex)
@@ -2779,6 +4564,42 @@ namespace Simd
         SimdSegmentationFillSingleHoles(mask.data, mask.stride, mask.width, mask.height, index);
     }
 
+    /*! @ingroup segmentation
+
+        \fn size_t SegmentationLabelComponents(const View<A> & mask, SimdCompareType compareType, uint8_t value, int connectivity, View<A> & labels, std::vector<SimdConnectedComponent> & components)
+
+        \short Finds connected components of the mask and labels them.
+
+        Mask must has 8-bit gray pixel format. Labels image must has 32-bit integer format and the same size as mask.
+
+        \note This function is a C++ wrapper for function ::SimdSegmentationLabelComponents.
+
+        \param [in] mask - a 8-bit gray mask image.
+        \param [in] compareType - a compare operation type (see ::SimdCompareType) which defines foreground pixels.
+        \param [in] value - a second argument of compare operation.
+        \param [in] connectivity - a connectivity of components (4 or 8).
+        \param [out] labels - an output 32-bit labels image.
+        \param [out] components - a vector with found components (element i describes component with label i + 1).
+        \return a number of found components.
+    */
+    template<template<class> class A> SIMD_INLINE size_t SegmentationLabelComponents(const View<A> & mask, SimdCompareType compareType, uint8_t value, int connectivity,
+        View<A> & labels, std::vector<SimdConnectedComponent> & components)
+    {
+        assert(mask.format == View<A>::Gray8 && labels.format == View<A>::Int32 && EqualSize(mask, labels));
+
+        components.resize(256);
+        size_t count = SimdSegmentationLabelComponents(mask.data, mask.stride, mask.width, mask.height, compareType, value, connectivity,
+            (uint32_t*)labels.data, labels.stride, components.data(), components.size());
+        if (count > components.size())
+        {
+            components.resize(count);
+            SimdSegmentationLabelComponents(mask.data, mask.stride, mask.width, mask.height, compareType, value, connectivity,
+                NULL, 0, components.data(), components.size());
+        }
+        components.resize(count);
+        return count;
+    }
+
     /*! @ingroup segmentation
 
         \fn void SegmentationPropagate2x2(const View<A> & parent, View<A> & child, const View<A> & difference, uint8_t currentIndex, uint8_t invalidIndex, uint8_t emptyIndex, uint8_t differenceThreshold)
@@ -3540,198 +5361,459 @@ namespace Simd
         \param [in] transform - a type of image transformation.
         \return - the size of transformed image.
     */
-    SIMD_INLINE Point<ptrdiff_t> TransformSize(const Point<ptrdiff_t> & size, ::SimdTransformType transform)
+    SIMD_INLINE Point<ptrdiff_t> TransformSize(const Point<ptrdiff_t> & size, ::SimdTransformType transform)
+    {
+        switch (transform)
+        {
+        case ::SimdTransformRotate0:
+        case ::SimdTransformRotate180:
+        case ::SimdTransformTransposeRotate90:
+        case ::SimdTransformTransposeRotate270:
+            return size;
+        case ::SimdTransformRotate90:
+        case ::SimdTransformRotate270:
+        case ::SimdTransformTransposeRotate0:
+        case ::SimdTransformTransposeRotate180:
+            return Point<ptrdiff_t>(size.y, size.x);
+        default:
+            assert(0);
+            return Point<ptrdiff_t>();
+        }
+    }
+
+    /*! @ingroup transform
+
+        \fn void TransformImage(const View<A> & src, ::SimdTransformType transform, View<A> & dst);
+
+        \short Performs transformation of input image. The type of transformation is defined by ::SimdTransformType enumeration.
+
+        \note This function is a C++ wrapper for function ::SimdTransformImage.
+
+        \param [in] src - an input image.
+        \param [in] transform - a type of image transformation.
+        \param [out] dst - an output image.
+    */
+    template<template<class> class A> SIMD_INLINE void TransformImage(const View<A> & src, ::SimdTransformType transform, View<A> & dst)
+    {
+        assert(src.format == dst.format && TransformSize(src.Size(), transform) == dst.Size());
+
+        SimdTransformImage(src.data, src.stride, src.width, src.height, src.PixelSize(), transform, dst.data, dst.stride);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuva420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, const View<A>& a, View<A>& bgra)
+
+        \short Converts YUVA420P image to 32-bit BGRA image.
+
+        The input Y, A and output BGRA images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdYuva420pToBgra.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane.
+        \param [in] v - an input 8-bit image with V color plane.
+        \param [in] a - an input 8-bit image with alpha channel.
+        \param [out] bgra - an output 32-bit BGRA image.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuva420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, const View<A>& a, View<A>& bgra)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
+        assert(Compatible(y, a) && EqualSize(y, bgra));
+        assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
+
+        SimdYuva420pToBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, a.data, a.stride, y.width, y.height, bgra.data, bgra.stride);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv420pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
+
+        \short Converts YUV420P image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdYuv420pToBgr.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane.
+        \param [in] v - an input 8-bit image with V color plane.
+        \param [out] bgr - an output 24-bit BGR image.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv420pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+
+        SimdYuv420pToBgr(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv420pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType)
+
+        \short Converts YUV420P image to 24-bit BGR image with using of given YUV color matrix.
+
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdYuv420pToBgrV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane.
+        \param [in] v - an input 8-bit image with V color plane.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv420pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+
+        SimdYuv420pToBgrV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv420pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb)
+
+        \short Converts YUV420P image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdYuv420pToRgb.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane.
+        \param [in] v - an input 8-bit image with V color plane.
+        \param [out] rgb - an output 24-bit RGB image.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv420pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
+        assert(y.width == rgb.width && y.height == rgb.height);
+        assert(y.format == View<A>::Gray8 && rgb.format == View<A>::Rgb24);
+
+        SimdYuv420pToRgb(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, rgb.data, rgb.stride);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv422pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
+
+        \short Converts YUV422P image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \note This function is a C++ wrapper for function ::SimdYuv422pToBgr.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane.
+        \param [in] v - an input 8-bit image with V color plane.
+        \param [out] bgr - an output 24-bit BGR image.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv422pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
+    {
+        assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+
+        SimdYuv422pToBgr(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv422pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType)
+
+        \short Converts YUV422P image to 24-bit BGR image with using of given YUV color matrix.
+
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \note This function is a C++ wrapper for function ::SimdYuv422pToBgrV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane.
+        \param [in] v - an input 8-bit image with V color plane.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv422pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType)
+    {
+        assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+
+        SimdYuv422pToBgrV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv422pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb)
+
+        \short Converts YUV422P image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \note This function is a C++ wrapper for function ::SimdYuv422pToRgb.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane.
+        \param [in] v - an input 8-bit image with V color plane.
+        \param [out] rgb - an output 24-bit RGB image.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv422pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb)
+    {
+        assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
+        assert(y.width == rgb.width && y.height == rgb.height);
+        assert(y.format == View<A>::Gray8 && rgb.format == View<A>::Rgb24);
+
+        SimdYuv422pToRgb(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, rgb.data, rgb.stride);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv444pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
+
+        \short Converts YUV444P image to 24-bit BGR image.
+
+        The input Y, U, V and output BGR images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdYuv444pToBgr.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane.
+        \param [in] v - an input 8-bit image with V color plane.
+        \param [out] bgr - an output 24-bit BGR image.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv444pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
+    {
+        assert(Compatible(y, u, v) && EqualSize(y, bgr) && y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+
+        SimdYuv444pToBgr(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv444pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType)
+
+        \short Converts YUV444P image to 24-bit BGR image with using of given YUV color matrix.
+
+        The input Y, U, V and output BGR images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdYuv444pToBgrV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane.
+        \param [in] v - an input 8-bit image with V color plane.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv444pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType)
     {
-        switch (transform)
-        {
-        case ::SimdTransformRotate0:
-        case ::SimdTransformRotate180:
-        case ::SimdTransformTransposeRotate90:
-        case ::SimdTransformTransposeRotate270:
-            return size;
-        case ::SimdTransformRotate90:
-        case ::SimdTransformRotate270:
-        case ::SimdTransformTransposeRotate0:
-        case ::SimdTransformTransposeRotate180:
-            return Point<ptrdiff_t>(size.y, size.x);
-        default:
-            assert(0);
-            return Point<ptrdiff_t>();
-        }
+        assert(Compatible(y, u, v) && EqualSize(y, bgr) && y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+
+        SimdYuv444pToBgrV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
     }
 
-    /*! @ingroup transform
+    /*! @ingroup yuv_conversion
 
-        \fn void TransformImage(const View<A> & src, ::SimdTransformType transform, View<A> & dst);
+        \fn void Yuv444pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb)
 
-        \short Performs transformation of input image. The type of transformation is defined by ::SimdTransformType enumeration.
+        \short Converts YUV444P image to 24-bit RGB image.
 
-        \note This function is a C++ wrapper for function ::SimdTransformImage.
+        The input Y, U, V and output RGB images must have the same width and height.
 
-        \param [in] src - an input image.
-        \param [in] transform - a type of image transformation.
-        \param [out] dst - an output image.
+        \note This function is a C++ wrapper for function ::SimdYuv444pToRgb.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane.
+        \param [in] v - an input 8-bit image with V color plane.
+        \param [out] rgb - an output 24-bit RGB image.
     */
-    template<template<class> class A> SIMD_INLINE void TransformImage(const View<A> & src, ::SimdTransformType transform, View<A> & dst)
+    template<template<class> class A> SIMD_INLINE void Yuv444pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb)
     {
-        assert(src.format == dst.format && TransformSize(src.Size(), transform) == dst.Size());
+        assert(Compatible(y, u, v) && EqualSize(y, rgb) && y.format == View<A>::Gray8 && rgb.format == View<A>::Rgb24);
 
-        SimdTransformImage(src.data, src.stride, src.width, src.height, src.PixelSize(), transform, dst.data, dst.stride);
+        SimdYuv444pToRgb(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, rgb.data, rgb.stride);
     }
 
     /*! @ingroup yuv_conversion
 
-        \fn void Yuva420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, const View<A>& a, View<A>& bgra)
+        \fn void Yuv420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF)
 
-        \short Converts YUVA420P image to 32-bit BGRA image.
+        \short Converts YUV420P image to 32-bit BGRA image.
 
-        The input Y, A and output BGRA images must have the same width and height.
+        The input Y and output BGRA images must have the same width and height.
         The input U and V images must have the same width and height (half size relative to Y component).
 
-        \note This function is a C++ wrapper for function ::SimdYuva420pToBgra.
+        \note This function is a C++ wrapper for function ::SimdYuv420pToBgra.
 
         \param [in] y - an input 8-bit image with Y color plane.
         \param [in] u - an input 8-bit image with U color plane.
         \param [in] v - an input 8-bit image with V color plane.
-        \param [in] a - an input 8-bit image with alpha channel.
         \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
     */
-    template<template<class> class A> SIMD_INLINE void Yuva420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, const View<A>& a, View<A>& bgra)
+    template<template<class> class A> SIMD_INLINE void Yuv420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF)
     {
         assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
         assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
-        assert(Compatible(y, a) && EqualSize(y, bgra));
+        assert(y.width == bgra.width && y.height == bgra.height);
         assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
 
-        SimdYuva420pToBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, a.data, a.stride, y.width, y.height, bgra.data, bgra.stride);
+        SimdYuv420pToBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha);
     }
 
     /*! @ingroup yuv_conversion
 
-        \fn void Yuv420pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
+        \fn void Yuv420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha, SimdYuvType yuvType)
 
-        \short Converts YUV420P image to 24-bit BGR image.
+        \short Converts YUV420P image to 32-bit BGRA image with using of given YUV color matrix.
 
-        The input Y and output BGR images must have the same width and height.
+        The input Y and output BGRA images must have the same width and height.
         The input U and V images must have the same width and height (half size relative to Y component).
 
-        \note This function is a C++ wrapper for function ::SimdYuv420pToBgr.
+        \note This function is a C++ wrapper for function ::SimdYuv420pToBgraV2.
 
         \param [in] y - an input 8-bit image with Y color plane.
         \param [in] u - an input 8-bit image with U color plane.
         \param [in] v - an input 8-bit image with V color plane.
-        \param [out] bgr - an output 24-bit BGR image.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
     */
-    template<template<class> class A> SIMD_INLINE void Yuv420pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
+    template<template<class> class A> SIMD_INLINE void Yuv420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha, SimdYuvType yuvType)
     {
         assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
         assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
-        assert(y.width == bgr.width && y.height == bgr.height);
-        assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+        assert(y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
 
-        SimdYuv420pToBgr(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride);
+        SimdYuv420pToBgraV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
     }
 
     /*! @ingroup yuv_conversion
 
-        \fn void Yuv422pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
+        \fn void Yuv420pToRgba(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgba, uint8_t alpha = 0xFF)
 
-        \short Converts YUV422P image to 24-bit BGR image.
+        \short Converts YUV420P image to 32-bit RGBA image.
 
-        The input Y and output BGR images must have the same width and height.
-        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+        The input Y and output RGBA images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
 
-        \note This function is a C++ wrapper for function ::SimdYuv422pToBgr.
+        \note This function is a C++ wrapper for function ::SimdYuv420pToRgba.
 
         \param [in] y - an input 8-bit image with Y color plane.
         \param [in] u - an input 8-bit image with U color plane.
         \param [in] v - an input 8-bit image with V color plane.
-        \param [out] bgr - an output 24-bit BGR image.
+        \param [out] rgba - an output 32-bit RGBA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
     */
-    template<template<class> class A> SIMD_INLINE void Yuv422pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
+    template<template<class> class A> SIMD_INLINE void Yuv420pToRgba(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgba, uint8_t alpha = 0xFF)
     {
-        assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
-        assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
-        assert(y.width == bgr.width && y.height == bgr.height);
-        assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
+        assert(y.width == rgba.width && y.height == rgba.height);
+        assert(y.format == View<A>::Gray8 && rgba.format == View<A>::Rgba32);
 
-        SimdYuv422pToBgr(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride);
+        SimdYuv420pToRgba(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, rgba.data, rgba.stride, alpha);
     }
 
     /*! @ingroup yuv_conversion
 
-        \fn void Yuv444pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
+        \fn void Yuv422pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF)
 
-        \short Converts YUV444P image to 24-bit BGR image.
+        \short Converts YUV422P image to 32-bit BGRA image.
 
-        The input Y, U, V and output BGR images must have the same width and height.
+        The input Y and output BGRA images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
 
-        \note This function is a C++ wrapper for function ::SimdYuv444pToBgr.
+        \note This function is a C++ wrapper for function ::SimdYuv422pToBgra.
 
         \param [in] y - an input 8-bit image with Y color plane.
         \param [in] u - an input 8-bit image with U color plane.
         \param [in] v - an input 8-bit image with V color plane.
-        \param [out] bgr - an output 24-bit BGR image.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
     */
-    template<template<class> class A> SIMD_INLINE void Yuv444pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
+    template<template<class> class A> SIMD_INLINE void Yuv422pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF)
     {
-        assert(Compatible(y, u, v) && EqualSize(y, bgr) && y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+        assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
+        assert(y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
 
-        SimdYuv444pToBgr(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride);
+        SimdYuv422pToBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha);
     }
 
     /*! @ingroup yuv_conversion
 
-        \fn void Yuv420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF)
+        \fn void Yuv422pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha, SimdYuvType yuvType)
 
-        \short Converts YUV420P image to 32-bit BGRA image.
+        \short Converts YUV422P image to 32-bit BGRA image with using of given YUV color matrix.
 
         The input Y and output BGRA images must have the same width and height.
-        The input U and V images must have the same width and height (half size relative to Y component).
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
 
-        \note This function is a C++ wrapper for function ::SimdYuv420pToBgra.
+        \note This function is a C++ wrapper for function ::SimdYuv422pToBgraV2.
 
         \param [in] y - an input 8-bit image with Y color plane.
         \param [in] u - an input 8-bit image with U color plane.
         \param [in] v - an input 8-bit image with V color plane.
         \param [out] bgra - an output 32-bit BGRA image.
         \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
     */
-    template<template<class> class A> SIMD_INLINE void Yuv420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF)
+    template<template<class> class A> SIMD_INLINE void Yuv422pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha, SimdYuvType yuvType)
     {
-        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
-        assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
+        assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
         assert(y.width == bgra.width && y.height == bgra.height);
         assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
 
-        SimdYuv420pToBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha);
+        SimdYuv422pToBgraV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
     }
 
     /*! @ingroup yuv_conversion
 
-        \fn void Yuv422pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF)
+        \fn void Yuv422pToRgba(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgba, uint8_t alpha = 0xFF)
 
-        \short Converts YUV422P image to 32-bit BGRA image.
+        \short Converts YUV422P image to 32-bit RGBA image.
 
-        The input Y and output BGRA images must have the same width and height.
+        The input Y and output RGBA images must have the same width and height.
         The input U and V images must have the same width and height (their width is equal to half width of Y component).
 
-        \note This function is a C++ wrapper for function ::SimdYuv422pToBgra.
+        \note This function is a C++ wrapper for function ::SimdYuv422pToRgba.
 
         \param [in] y - an input 8-bit image with Y color plane.
         \param [in] u - an input 8-bit image with U color plane.
         \param [in] v - an input 8-bit image with V color plane.
-        \param [out] bgra - an output 32-bit BGRA image.
+        \param [out] rgba - an output 32-bit RGBA image.
         \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
     */
-    template<template<class> class A> SIMD_INLINE void Yuv422pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF)
+    template<template<class> class A> SIMD_INLINE void Yuv422pToRgba(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgba, uint8_t alpha = 0xFF)
     {
         assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
         assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
-        assert(y.width == bgra.width && y.height == bgra.height);
-        assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
+        assert(y.width == rgba.width && y.height == rgba.height);
+        assert(y.format == View<A>::Gray8 && rgba.format == View<A>::Rgba32);
 
-        SimdYuv422pToBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha);
+        SimdYuv422pToRgba(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, rgba.data, rgba.stride, alpha);
     }
 
     /*! @ingroup yuv_conversion
@@ -3757,6 +5839,53 @@ namespace Simd
         SimdYuv444pToBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha);
     }
 
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv444pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha, SimdYuvType yuvType)
+
+        \short Converts YUV444P image to 32-bit BGRA image with using of given YUV color matrix.
+
+        The input Y, U, V and output BGRA images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdYuv444pToBgraV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane.
+        \param [in] v - an input 8-bit image with V color plane.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv444pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha, SimdYuvType yuvType)
+    {
+        assert(Compatible(y, u, v) && EqualSize(y, bgra) && y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
+
+        SimdYuv444pToBgraV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv444pToRgba(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgba, uint8_t alpha = 0xFF)
+
+        \short Converts YUV444P image to 32-bit RGBA image.
+
+        The input Y, U, V and output RGBA images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdYuv444pToRgba.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane.
+        \param [in] v - an input 8-bit image with V color plane.
+        \param [out] rgba - an output 32-bit RGBA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv444pToRgba(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgba, uint8_t alpha = 0xFF)
+    {
+        assert(Compatible(y, u, v) && EqualSize(y, rgba) && y.format == View<A>::Gray8 && rgba.format == View<A>::Rgba32);
+
+        SimdYuv444pToRgba(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, rgba.data, rgba.stride, alpha);
+    }
+
     /*! @ingroup yuv_conversion
 
         \fn void Yuv444pToHsl(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& hsl)
@@ -3779,6 +5908,29 @@ namespace Simd
         SimdYuv444pToHsl(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, hsl.data, hsl.stride);
     }
 
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv444pToHsl(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& hsl, SimdYuvType yuvType)
+
+        \short Converts YUV444P image to 24-bit HSL(Hue, Saturation, Lightness) image with using of given YUV color matrix.
+
+        The input Y, U, V and output HSL images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdYuv444pToHslV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane.
+        \param [in] v - an input 8-bit image with V color plane.
+        \param [out] hsl - an output 24-bit HSL image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv444pToHsl(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& hsl, SimdYuvType yuvType)
+    {
+        assert(Compatible(y, u, v) && EqualSize(y, hsl) && y.format == View<A>::Gray8 && hsl.format == View<A>::Hsl24);
+
+        SimdYuv444pToHslV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, hsl.data, hsl.stride, yuvType);
+    }
+
     /*! @ingroup yuv_conversion
 
        \fn void Yuv444pToHsv(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& hsv)
@@ -3801,6 +5953,29 @@ namespace Simd
         SimdYuv444pToHsv(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, hsv.data, hsv.stride);
     }
 
+    /*! @ingroup yuv_conversion
+
+       \fn void Yuv444pToHsv(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& hsv, SimdYuvType yuvType)
+
+       \short Converts YUV444P image to 24-bit HSV(Hue, Saturation, Value) image with using of given YUV color matrix.
+
+       The input Y, U, V and output HSV images must have the same width and height.
+
+       \note This function is a C++ wrapper for function ::SimdYuv444pToHsvV2.
+
+       \param [in] y - an input 8-bit image with Y color plane.
+       \param [in] u - an input 8-bit image with U color plane.
+       \param [in] v - an input 8-bit image with V color plane.
+       \param [out] hsv - an output 24-bit HSV image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
+   */
+    template<template<class> class A> SIMD_INLINE void Yuv444pToHsv(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& hsv, SimdYuvType yuvType)
+    {
+        assert(Compatible(y, u, v) && EqualSize(y, hsv) && y.format == View<A>::Gray8 && hsv.format == View<A>::Hsv24);
+
+        SimdYuv444pToHsvV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, hsv.data, hsv.stride, yuvType);
+    }
+
     /*! @ingroup yuv_conversion
 
         \fn void Yuv420pToHue(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& hue)
@@ -3826,6 +6001,32 @@ namespace Simd
         SimdYuv420pToHue(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, hue.data, hue.stride);
     }
 
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv420pToHue(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& hue, SimdYuvType yuvType)
+
+        \short Converts YUV420P image to 8-bit image with Hue component of HSV or HSL color space with using of given YUV color matrix.
+
+        The input Y and output Hue images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdYuv420pToHueV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane.
+        \param [in] v - an input 8-bit image with V color plane.
+        \param [out] hue - an output 8-bit Hue image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv420pToHue(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& hue, SimdYuvType yuvType)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
+        assert(Compatible(y, hue) && y.format == View<A>::Gray8);
+
+        SimdYuv420pToHueV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, hue.data, hue.stride, yuvType);
+    }
+
     /*! @ingroup yuv_conversion
 
         \fn void Yuv444pToHue(const View<A> & y, const View<A> & u, const View<A> & v, View<A> & hue)
@@ -3848,6 +6049,88 @@ namespace Simd
         SimdYuv444pToHue(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, hue.data, hue.stride);
     }
 
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv444pToHue(const View<A> & y, const View<A> & u, const View<A> & v, View<A> & hue, SimdYuvType yuvType)
+
+        \short Converts YUV444P image to 8-bit image with Hue component of HSV or HSL color space with using of given YUV color matrix.
+
+        The input Y, U, V and output Hue images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdYuv444pToHueV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane.
+        \param [in] v - an input 8-bit image with V color plane.
+        \param [out] hue - an output 8-bit Hue image.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType).
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv444pToHue(const View<A> & y, const View<A> & u, const View<A> & v, View<A> & hue, SimdYuvType yuvType)
+    {
+        assert(Compatible(y, u, v, hue) && y.format == View<A>::Gray8);
+
+        SimdYuv444pToHueV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, hue.data, hue.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv420p16ToBgr(const View<A>& y, const View<A>& u, const View<A>& v, size_t bitDepth, View<A>& bgr, bool dither = false, SimdYuvType yuvType = SimdYuvBt601, uint8_t * buffer = NULL)
+
+        \short Converts high bit depth YUV420P image (YUV420P10LE, YUV420P12LE, YUV420P16LE) to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdYuv420p16ToBgr.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] u - an input 16-bit image with U color plane.
+        \param [in] v - an input 16-bit image with V color plane.
+        \param [in] bitDepth - a bit depth of input images. It must be in range (8, 16].
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] dither - a flag of ordered dithering. By default rounding is used.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType). By default it is BT.601.
+        \param [in, out] buffer - a pointer to external temporary buffer of size ::SimdYuv16BufferSize(y.width). By default it is NULL (internal buffer is used).
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv420p16ToBgr(const View<A>& y, const View<A>& u, const View<A>& v, size_t bitDepth, View<A>& bgr, bool dither = false, SimdYuvType yuvType = SimdYuvBt601, uint8_t * buffer = NULL)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && EqualSize(u, v));
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Int16 && u.format == View<A>::Int16 && v.format == View<A>::Int16 && bgr.format == View<A>::Bgr24);
+
+        SimdYuv420p16ToBgr(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bitDepth, bgr.data, bgr.stride, dither ? SimdTrue : SimdFalse, yuvType, buffer);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv420p16ToBgra(const View<A>& y, const View<A>& u, const View<A>& v, size_t bitDepth, View<A>& bgra, uint8_t alpha = 0xFF, bool dither = false, SimdYuvType yuvType = SimdYuvBt601, uint8_t * buffer = NULL)
+
+        \short Converts high bit depth YUV420P image (YUV420P10LE, YUV420P12LE, YUV420P16LE) to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdYuv420p16ToBgra.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] u - an input 16-bit image with U color plane.
+        \param [in] v - an input 16-bit image with V color plane.
+        \param [in] bitDepth - a bit depth of input images. It must be in range (8, 16].
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] dither - a flag of ordered dithering. By default rounding is used.
+        \param [in] yuvType - a type of YUV color matrix (see ::SimdYuvType). By default it is BT.601.
+        \param [in, out] buffer - a pointer to external temporary buffer of size ::SimdYuv16BufferSize(y.width). By default it is NULL (internal buffer is used).
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv420p16ToBgra(const View<A>& y, const View<A>& u, const View<A>& v, size_t bitDepth, View<A>& bgra, uint8_t alpha = 0xFF, bool dither = false, SimdYuvType yuvType = SimdYuvBt601, uint8_t * buffer = NULL)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && EqualSize(u, v));
+        assert(y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Int16 && u.format == View<A>::Int16 && v.format == View<A>::Int16 && bgra.format == View<A>::Bgra32);
+
+        SimdYuv420p16ToBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bitDepth, bgra.data, bgra.stride, alpha, dither ? SimdTrue : SimdFalse, yuvType, buffer);
+    }
+
     /*! @ingroup universal_conversion
 
         \fn void Convert(const View<A> & src, View<A> & dst)
@@ -1468,6 +1468,13 @@ namespace Simd
             return vld1q_f32(c);
         };
 
+        SIMD_INLINE uint32x4_t Divide(uint32x4_t dividend, uint32x4_t divisor)
+        {
+            uint32x4_t quotient = vcvtq_u32_f32(Div<1>(vcvtq_f32_u32(dividend), vcvtq_f32_u32(divisor)));
+            quotient = vaddq_u32(quotient, vcgtq_u32(vmulq_u32(quotient, divisor), dividend));
+            return vsubq_u32(quotient, vcleq_u32(vmulq_u32(vaddq_u32(quotient, vdupq_n_u32(1)), divisor), dividend));
+        }
+
         template <int iter> SIMD_INLINE float32x4_t ReciprocalSqrt(const float32x4_t & a);
 
         template <> SIMD_INLINE float32x4_t ReciprocalSqrt<-1>(const float32x4_t & a)
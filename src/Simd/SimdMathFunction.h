@@ -0,0 +1,48 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdMathFunction_h__
+#define __SimdMathFunction_h__
+
+#include "Simd/SimdMath.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
+
+namespace Simd
+{
+    namespace Base
+    {
+        const size_t MATH_FUNCTION_THREAD_SIZE_MIN = 64 * 1024;
+
+        template<class Function> SIMD_INLINE void MathFunction32fParallel(const float * src, size_t size, float * dst, Function function)
+        {
+            size_t threadNumber = Simd::Max<size_t>(1, Simd::Min(GetThreadNumber(), size / MATH_FUNCTION_THREAD_SIZE_MIN));
+            Simd::Parallel(0, size, [&](size_t thread, size_t begin, size_t end)
+            {
+                function(src + begin, end - begin, dst + begin);
+            }, threadNumber, 64);
+        }
+    }
+}
+
+#endif//__SimdMathFunction_h__
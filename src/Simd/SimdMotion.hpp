@@ -29,10 +29,16 @@
 #include "Simd/SimdFrame.hpp"
 #include "Simd/SimdDrawing.hpp"
 #include "Simd/SimdFont.hpp"
+#include "Simd/SimdParallel.hpp"
 
 #include <vector>
 #include <stack>
+#include <deque>
 #include <sstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
 
 #ifndef SIMD_CHECK_PERFORMANCE
 #define SIMD_CHECK_PERFORMANCE()
@@ -433,13 +439,15 @@ namespace Simd
         */
         struct Options
         {
+            int ThreadNumber; /*!< \brief A number of work threads used by motion detector to process a frame. Use value -1 to auto choose of thread number. By default it is equal to 1. */
+
             int CalibrationScaleLevelMax;  /*!< \brief A maximum scale of input frame. By default it is equal to 3 (maximum scale in 8 times). */ 
 
             int DifferenceGrayFeatureWeight; /*!< \brief A weight of gray feature for difference estimation. By default it is equal to 18. */ 
             int DifferenceDxFeatureWeight; /*!< \brief A weight of X-gradient feature for difference estimation. By default it is equal to 18. */ 
             int DifferenceDyFeatureWeight; /*!< \brief A weight of Y-gradient feature for difference estimation. By default it is equal to 18. */ 
             bool DifferencePropagateForward; /*!< \brief An additional boosting of estimated difference. By default it is true. */ 
-            bool DifferenceRoiMaskEnable; /*!< \brief A flag to restrict difference estimation by ROI. By default it is true. */ 
+            bool DifferenceRoiMaskEnable; /*!< \brief A flag to restrict difference estimation by ROI. Textures, difference and background model are also processed only in 32x32 tiles which influence ROI. By default it is true. */ 
 
             double BackgroundGrowTime; /*!< \brief Initial time (in seconds) of updated background in fast mode. By default it is equal to 1 second. */ 
             double BackgroundIncrementTime; /*!< \brief Background update speed (in seconds) in normal mode. By default it is equal to 1 second. */ 
@@ -469,6 +477,8 @@ namespace Simd
             */
             Options()
             {
+                ThreadNumber = 1;
+
                 CalibrationScaleLevelMax = 3;
 
                 DifferenceGrayFeatureWeight = 18;
@@ -852,6 +862,19 @@ namespace Simd
                 }
             };
 
+            struct Band
+            {
+                size_t level;
+                Rect rect;
+
+                Band(size_t level_, const Rect & rect_)
+                    : level(level_)
+                    , rect(rect_)
+                {
+                }
+            };
+            typedef std::vector<Band> Bands;
+
             struct Scene
             {
                 Frame input, * output;
@@ -876,8 +899,17 @@ namespace Simd
 
                 Classification classification;
 
+                size_t threadNumber;
+                Bands bands;
+                bool tiled;
+                std::vector<View> dxBuffers, dyBuffers;
+
                 void Create(const Options & options)
                 {
+                    ptrdiff_t threadNumberMax = std::thread::hardware_concurrency();
+                    threadNumber = (options.ThreadNumber <= 0 || options.ThreadNumber > threadNumberMax) ? threadNumberMax : options.ThreadNumber;
+                    threadNumber = std::max<size_t>(threadNumber, 1);
+
                     scaled.Recreate(model.originalFrameSize, model.scaleLevel + 1);
                     font.Resize(model.originalFrameSize.y / 32);
                     buffer.Recreate(model.frameSize, model.levelCount);
@@ -891,6 +923,113 @@ namespace Simd
 
                     classification.squareShiftMin = ptrdiff_t(Simd::SquaredDistance(model.frameSize, Point())*
                         options.ClassificationShiftMin*options.ClassificationShiftMin);
+
+                    CreateBands(options);
+                    CreateBuffers();
+                }
+
+                void CreateBands(const Options & options)
+                {
+                    static const size_t BANDS_PER_THREAD = 4;
+                    bands.clear();
+                    tiled = options.DifferenceRoiMaskEnable;
+                    if (tiled)
+                    {
+                        CreateTileBands(options);
+                        Simd::Fill(texture.dx.value, 0);
+                        Simd::Fill(texture.dy.value, 0);
+                        return;
+                    }
+                    size_t total = 0;
+                    for (size_t level = 0; level < difference.Size(); ++level)
+                        total += difference[level].Area();
+                    size_t bandArea = threadNumber > 1 ? total / (threadNumber * BANDS_PER_THREAD) + 1 : total;
+                    for (size_t level = 0; level < difference.Size(); ++level)
+                    {
+                        const View & view = difference[level];
+                        size_t bandHeight = std::max<size_t>(bandArea / std::max<size_t>(view.width, 1), 1);
+                        for (size_t top = 0; top < view.height; top += bandHeight)
+                            bands.push_back(Band(level, Rect(0, top, view.width, std::min(top + bandHeight, view.height))));
+                    }
+                }
+
+                /*
+                    Restricts bands to non-empty 32x32 tiles of area which influences difference inside of ROI:
+                    ROI mask itself and (if difference is propagated forward) 4x4 reduction windows of this area on the previous pyramid level.
+                */
+                void CreateTileBands(const Options & options)
+                {
+                    static const ptrdiff_t TILE_SIZE = 32;
+                    Pyramid needed(model.frameSize, model.levelCount);
+                    for (ptrdiff_t level = (ptrdiff_t)needed.Size() - 1; level >= 0; --level)
+                    {
+                        View & dst = needed[level];
+                        Simd::Copy(model.roiMask[level], dst);
+                        if (options.DifferencePropagateForward && level + 1 < (ptrdiff_t)needed.Size())
+                        {
+                            const View & src = needed[level + 1];
+                            for (ptrdiff_t y = 0; y < (ptrdiff_t)src.height; ++y)
+                            {
+                                for (ptrdiff_t x = 0; x < (ptrdiff_t)src.width; ++x)
+                                {
+                                    if (src.At<uint8_t>(x, y))
+                                    {
+                                        Rect window(2 * x - 1, 2 * y - 1, 2 * x + 3, 2 * y + 3);
+                                        window &= Rect(dst.Size());
+                                        Simd::Fill(dst.Region(window).Ref(), 0xFF);
+                                    }
+                                }
+                            }
+                        }
+                    }
+                    for (size_t level = 0; level < needed.Size(); ++level)
+                    {
+                        const View & view = needed[level];
+                        for (ptrdiff_t top = 0; top < (ptrdiff_t)view.height; top += TILE_SIZE)
+                        {
+                            ptrdiff_t bottom = std::min(top + TILE_SIZE, (ptrdiff_t)view.height);
+                            for (ptrdiff_t left = 0; left < (ptrdiff_t)view.width;)
+                            {
+                                ptrdiff_t right = left;
+                                while (right < (ptrdiff_t)view.width && !IsEmptyTile(view, Rect(right, top, right + TILE_SIZE, bottom)))
+                                    right = std::min(right + TILE_SIZE, (ptrdiff_t)view.width);
+                                if (right > left)
+                                {
+                                    bands.push_back(Band(level, Rect(left, top, right, bottom)));
+                                    left = right;
+                                }
+                                else
+                                    left += TILE_SIZE;
+                            }
+                        }
+                    }
+                }
+
+                static bool IsEmptyTile(const View & view, Rect tile)
+                {
+                    uint32_t count;
+                    tile &= Rect(view.Size());
+                    Simd::ConditionalCount8u(view.Region(tile), 0, SimdCompareGreater, count);
+                    return count == 0;
+                }
+
+                void CreateBuffers()
+                {
+                    Size size;
+                    for (size_t i = 0; i < bands.size(); ++i)
+                    {
+                        size.x = std::max(size.x, bands[i].rect.Width() + 2);
+                        size.y = std::max(size.y, bands[i].rect.Height() + 2);
+                    }
+                    dxBuffers.clear();
+                    dyBuffers.clear();
+                    dxBuffers.resize(threadNumber);
+                    dyBuffers.resize(threadNumber);
+                    for (size_t i = 0; i < threadNumber; ++i)
+                    {
+                        dxBuffers[i].Recreate(size, View::Gray8);
+                        dyBuffers[i].Recreate(size, View::Gray8);
+                    }
                 }
             };
             Scene _scene;
@@ -1023,12 +1162,33 @@ namespace Simd
                 Texture & texture = _scene.texture;
                 Simd::Copy(_scene.scaled.Top(), texture.gray.value[0]);
                 Simd::Build(texture.gray.value, SimdReduce4x4);
-                for (size_t i = 0; i < texture.gray.value.Size(); ++i)
+                const Bands & bands = _scene.bands;
+                Parallel(0, bands.size(), [&](size_t thread, size_t begin, size_t end)
                 {
-                    Simd::TextureBoostedSaturatedGradient(texture.gray.value[i],
-                        _options.TextureGradientSaturation, _options.TextureGradientBoost,
-                        texture.dx.value[i], texture.dy.value[i]);
-                }
+                    View & dxBuffer = _scene.dxBuffers[thread];
+                    View & dyBuffer = _scene.dyBuffers[thread];
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        const Band & band = bands[i];
+                        const View & gray = texture.gray.value[band.level];
+                        Rect rect = band.rect;
+                        rect.AddBorder(1);
+                        rect &= Rect(gray.Size());
+                        if (rect == band.rect)
+                        {
+                            Simd::TextureBoostedSaturatedGradient(gray, _options.TextureGradientSaturation, _options.TextureGradientBoost,
+                                texture.dx.value[band.level], texture.dy.value[band.level]);
+                            continue;
+                        }
+                        View dx = dxBuffer.Region(Rect(rect.Size()));
+                        View dy = dyBuffer.Region(Rect(rect.Size()));
+                        Simd::TextureBoostedSaturatedGradient(gray.Region(rect),
+                            _options.TextureGradientSaturation, _options.TextureGradientBoost, dx, dy);
+                        Rect inner = band.rect.Shifted(-rect.TopLeft());
+                        Simd::Copy(dx.Region(inner), texture.dx.value[band.level].Region(band.rect).Ref());
+                        Simd::Copy(dy.Region(inner), texture.dy.value[band.level].Region(band.rect).Ref());
+                    }
+                }, _scene.threadNumber);
             }
 
             void EstimateDifference()
@@ -1038,15 +1198,25 @@ namespace Simd
                 const Texture & texture = _scene.texture;
                 Pyramid & difference = _scene.difference;
                 Pyramid & buffer = _scene.buffer;
-                for (size_t i = 0; i < difference.Size(); ++i)
+                const Bands & bands = _scene.bands;
+                if (_scene.tiled)
+                    Simd::Fill(difference, 0);
+                Parallel(0, bands.size(), [&](size_t thread, size_t begin, size_t end)
                 {
-                    Simd::Fill(difference[i], 0);
-                    for (size_t j = 0; j < texture.features.size(); ++j)
+                    for (size_t i = begin; i < end; ++i)
                     {
-                        const Texture::Feature & feature = *texture.features[j];
-                        Simd::AddFeatureDifference(feature.value[i], feature.lo.value[i], feature.hi.value[i], feature.weight, difference[i]);
+                        const Band & band = bands[i];
+                        View dst = difference[band.level].Region(band.rect);
+                        if (!_scene.tiled)
+                            Simd::Fill(dst, 0);
+                        for (size_t j = 0; j < texture.features.size(); ++j)
+                        {
+                            const Texture::Feature & feature = *texture.features[j];
+                            Simd::AddFeatureDifference(feature.value[band.level].Region(band.rect), feature.lo.value[band.level].Region(band.rect), 
+                                feature.hi.value[band.level].Region(band.rect), feature.weight, dst);
+                        }
                     }
-                }
+                }, _scene.threadNumber);
                 if (_options.DifferencePropagateForward)
                 {
                     for (size_t i = 1; i < difference.Size(); ++i)
@@ -1428,40 +1598,38 @@ namespace Simd
                 }
             };
 
-            struct GrowRangeUpdater
+            struct BackgroundUpdater
             {
-                void operator()(View & value, View & loValue, View & loCount, View & hiValue, View & hiCount) const
-                {
-                    Simd::BackgroundGrowRangeFast(value, loValue, hiValue);
-                }
-            };
+                int flags;
 
-            struct IncrementCountUpdater
-            {
-                void operator()(View & value, View & loValue, View & loCount, View & hiValue, View & hiCount) const
-                {
-                    Simd::BackgroundIncrementCount(value, loValue, hiValue, loCount, hiCount);
-                }
-            };
+                BackgroundUpdater(int f) : flags(f) {}
 
-            struct AdjustRangeUpdater
-            {
                 void operator()(View & value, View & loValue, View & loCount, View & hiValue, View & hiCount) const
                 {
-                    Simd::BackgroundAdjustRange(loCount, loValue, hiCount, hiValue, 1);
+                    Simd::BackgroundUpdate(value, loValue, hiValue, loCount, hiCount, 1, flags);
                 }
             };
 
             template <typename Updater> void Apply(Texture::Features & features, const Updater & updater)
             {
-                for (size_t i = 0; i < features.size(); ++i)
+                const Bands & bands = _scene.bands;
+                Parallel(0, bands.size(), [&](size_t thread, size_t begin, size_t end)
                 {
-                    Texture::Feature & feature = *features[i];
-                    for (size_t j = 0; j < feature.value.Size(); ++j)
+                    for (size_t i = begin; i < end; ++i)
                     {
-                        updater(feature.value[j], feature.lo.value[j], feature.lo.count[j], feature.hi.value[j], feature.hi.count[j]);
+                        const Band & band = bands[i];
+                        for (size_t j = 0; j < features.size(); ++j)
+                        {
+                            Texture::Feature & feature = *features[j];
+                            View value = feature.value[band.level].Region(band.rect);
+                            View loValue = feature.lo.value[band.level].Region(band.rect);
+                            View loCount = feature.lo.count[band.level].Region(band.rect);
+                            View hiValue = feature.hi.value[band.level].Region(band.rect);
+                            View hiCount = feature.hi.count[band.level].Region(band.rect);
+                            updater(value, loValue, loCount, hiValue, hiCount);
+                        }
                     }
-                }
+                }, _scene.threadNumber);
             }
 
             void UpdateBackground()
@@ -1477,15 +1645,16 @@ namespace Simd
                     switch (stability)
                     {
                     case Stability::Stable:
-                        Apply(_scene.texture.features, IncrementCountUpdater());
                         ++background.count;
                         background.incrementCounterTime += time - background.lastFrameTime;
                         if (background.count >= CHAR_MAX || (background.incrementCounterTime > _options.BackgroundIncrementTime && background.count >= 8))
                         {
-                            Apply(_scene.texture.features, AdjustRangeUpdater());
+                            Apply(_scene.texture.features, BackgroundUpdater(SimdBackgroundUpdateIncrementCount | SimdBackgroundUpdateAdjustRange));
                             background.incrementCounterTime = 0;
                             background.count = 0;
                         }
+                        else
+                            Apply(_scene.texture.features, BackgroundUpdater(SimdBackgroundUpdateIncrementCount));
                         break;
                     case Stability::Sabotage:
                         background.sabotageCounter++;
@@ -1503,7 +1672,7 @@ namespace Simd
                         InitBackground();
                     else
                     {
-                        Apply(_scene.texture.features, GrowRangeUpdater());
+                        Apply(_scene.texture.features, BackgroundUpdater(SimdBackgroundUpdateGrowRange));
                         if (stability != Stability::Stable)
                             background.growEndTime = time + _options.BackgroundGrowTime;
                         if (background.growEndTime < time)
@@ -1630,6 +1799,201 @@ namespace Simd
                 }
             }
         };
+
+        /*! @ingroup cpp_motion
+
+            \short Class Scheduler.
+
+            Processes frames of many video streams (one Simd::Motion::Detector per stream) with using of shared pool of work threads.
+            Frames of a stream are processed sequentially in order of their addition. 
+            Streams with queued frames are served in round-robin order, so a stream with high frame rate can't starve other streams.
+
+            \note Detectors used with scheduler should have Simd::Motion::Options::ThreadNumber equal to 1.
+        */
+        class Scheduler
+        {
+        public:
+
+            /*!
+                Creates scheduler and starts its work threads.
+
+                \param [in] threadNumber - a number of work threads. Use value -1 to auto choose of thread number.
+            */
+            Scheduler(ptrdiff_t threadNumber = -1)
+                : _next(0)
+                , _pending(0)
+                , _stop(false)
+            {
+#ifndef SIMD_FUTURE_DISABLE
+                ptrdiff_t threadNumberMax = std::thread::hardware_concurrency();
+                threadNumber = (threadNumber <= 0 || threadNumber > threadNumberMax) ? threadNumberMax : threadNumber;
+                for (ptrdiff_t i = 0; i < threadNumber; ++i)
+                    _threads.push_back(std::thread(&Scheduler::Run, this));
+#endif
+            }
+
+            /*!
+                Waits for end of processing of all queued frames and stops work threads.
+            */
+            ~Scheduler()
+            {
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    while (_pending)
+                        _done.wait(lock);
+                    _stop = true;
+                }
+                _work.notify_all();
+                for (size_t i = 0; i < _threads.size(); ++i)
+                    _threads[i].join();
+            }
+
+            /*!
+                Adds a new video stream.
+
+                \param [in] detector - a motion detector of the stream. It must exist until the scheduler is destroyed.
+                \return an index of the stream.
+            */
+            size_t AddStream(Detector & detector)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _streams.push_back(Stream(&detector));
+                return _streams.size() - 1;
+            }
+
+            /*!
+                Adds next frame of the stream to the processing queue. 
+                The frame is processed by Simd::Motion::Detector::NextFrame of the stream detector.
+
+                \param [in] stream - an index of the stream (see Simd::Motion::Scheduler::AddStream).
+                \param [in] input - a current input frame. Its pixel data must be valid until the frame is processed.
+                \param [out] metadata - a metadata of the frame. It must be valid until the frame is processed.
+                \param [out] output - a pointer to output frame with debug annotation. Can be NULL.
+                \return a result of the operation.
+            */
+            bool Push(size_t stream, const Frame & input, Metadata & metadata, Frame * output = NULL)
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                if (stream >= _streams.size())
+                    return false;
+                if (_threads.empty())
+                {
+                    Detector * detector = _streams[stream].detector;
+                    lock.unlock();
+                    return detector->NextFrame(input, metadata, output);
+                }
+                _streams[stream].jobs.push_back(Job(input, &metadata, output));
+                _pending++;
+                lock.unlock();
+                _work.notify_one();
+                return true;
+            }
+
+            /*!
+                Waits for end of processing of all queued frames.
+                If Simd::Motion::Detector::NextFrame throws an exception in a work thread, the first such exception is rethrown here.
+            */
+            void Wait()
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                while (_pending)
+                    _done.wait(lock);
+                if (_error)
+                {
+                    std::exception_ptr error = _error;
+                    _error = nullptr;
+                    std::rethrow_exception(error);
+                }
+            }
+
+        private:
+            struct Job
+            {
+                Frame input, * output;
+                Metadata * metadata;
+
+                Job(const Frame & input_, Metadata * metadata_, Frame * output_)
+                    : input(input_)
+                    , output(output_)
+                    , metadata(metadata_)
+                {
+                }
+            };
+
+            struct Stream
+            {
+                Detector * detector;
+                std::deque<Job> jobs;
+                bool busy;
+
+                Stream(Detector * detector_)
+                    : detector(detector_)
+                    , busy(false)
+                {
+                }
+            };
+
+            std::vector<Stream> _streams;
+            size_t _next, _pending;
+            bool _stop;
+            std::mutex _mutex;
+            std::condition_variable _work, _done;
+            std::vector<std::thread> _threads;
+            std::exception_ptr _error;
+
+            bool Select(size_t & index)
+            {
+                for (size_t i = 0, n = _streams.size(); i < n; ++i)
+                {
+                    size_t stream = (_next + i) % n;
+                    if (!_streams[stream].busy && _streams[stream].jobs.size())
+                    {
+                        index = stream;
+                        _next = stream + 1;
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            void Run()
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                for (;;)
+                {
+                    size_t index = 0;
+                    while (!_stop && !Select(index))
+                        _work.wait(lock);
+                    if (_stop)
+                        return;
+                    Stream & stream = _streams[index];
+                    Detector * detector = stream.detector;
+                    Job job = stream.jobs.front();
+                    stream.jobs.pop_front();
+                    stream.busy = true;
+                    lock.unlock();
+
+                    std::exception_ptr error;
+                    try
+                    {
+                        detector->NextFrame(job.input, *job.metadata, job.output);
+                    }
+                    catch (...)
+                    {
+                        error = std::current_exception();
+                    }
+
+                    lock.lock();
+                    if (error && !_error)
+                        _error = error;
+                    _streams[index].busy = false;
+                    if (--_pending == 0)
+                        _done.notify_all();
+                    if (_streams[index].jobs.size())
+                        _work.notify_one();
+                }
+            }
+        };
     }
 }
 
@@ -0,0 +1,313 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdLoad.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        template <int part> SIMD_INLINE uint8x8_t AlphaPremultiply(uint8x16_t value, uint8x16_t alpha)
+        {
+            return vmovn_u16(DivideI16By255(vmull_u8(Half<part>(value), Half<part>(alpha))));
+        }
+
+        SIMD_INLINE void AlphaPremultiply(const uint8_t * src, uint8_t * dst)
+        {
+            uint8x16x4_t bgra = Load4<false>(src);
+            for (size_t c = 0; c < 3; ++c)
+                bgra.val[c] = vcombine_u8(AlphaPremultiply<0>(bgra.val[c], bgra.val[3]), AlphaPremultiply<1>(bgra.val[c], bgra.val[3]));
+            Store4<false>(dst, bgra);
+        }
+
+        void AlphaPremultiply(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+        {
+            assert(width >= A);
+
+            size_t widthA = AlignLo(width, A);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                    AlphaPremultiply(src + col * 4, dst + col * 4);
+                src += srcStride;
+                dst += dstStride;
+            }
+            if (widthA < width)
+                Base::AlphaPremultiply(src - height * srcStride + widthA * 4, srcStride, width - widthA, height, dst - height * dstStride + widthA * 4, dstStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        template <int part> SIMD_INLINE uint8x8_t AlphaUnpremultiply(uint8x16_t value, uint8x16_t alpha)
+        {
+            uint16x8_t _alpha = UnpackU8<part>(alpha);
+            uint16x8_t dividend = vaddq_u16(vmull_u8(Half<part>(value), vdup_n_u8(0xFF)), vshrq_n_u16(_alpha, 1));
+            uint16x8_t divisor = vmaxq_u16(_alpha, K16_0001);
+            uint32x4_t lo = Divide(vmovl_u16(Half<0>(dividend)), vmovl_u16(Half<0>(divisor)));
+            uint32x4_t hi = Divide(vmovl_u16(Half<1>(dividend)), vmovl_u16(Half<1>(divisor)));
+            return vqmovn_u16(vbicq_u16(vcombine_u16(vqmovn_u32(lo), vqmovn_u32(hi)), vceqq_u16(_alpha, K16_0000)));
+        }
+
+        SIMD_INLINE void AlphaUnpremultiply(const uint8_t * src, uint8_t * dst)
+        {
+            uint8x16x4_t bgra = Load4<false>(src);
+            for (size_t c = 0; c < 3; ++c)
+                bgra.val[c] = vcombine_u8(AlphaUnpremultiply<0>(bgra.val[c], bgra.val[3]), AlphaUnpremultiply<1>(bgra.val[c], bgra.val[3]));
+            Store4<false>(dst, bgra);
+        }
+
+        void AlphaUnpremultiply(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+        {
+            assert(width >= A);
+
+            size_t widthA = AlignLo(width, A);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                    AlphaUnpremultiply(src + col * 4, dst + col * 4);
+                src += srcStride;
+                dst += dstStride;
+            }
+            if (widthA < width)
+                Base::AlphaUnpremultiply(src - height * srcStride + widthA * 4, srcStride, width - widthA, height, dst - height * dstStride + widthA * 4, dstStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        template <int part> SIMD_INLINE uint16x4_t AlphaBlendingBgraToBgra(uint16x8_t src, uint16x8_t srcAlpha, uint16x8_t dst, uint16x8_t dstAlpha, uint16x8_t half, uint16x8_t divisor)
+        {
+            uint32x4_t dividend = vmlal_u16(vmlal_u16(vmovl_u16(Half<part>(half)), Half<part>(src), Half<part>(srcAlpha)), Half<part>(dst), Half<part>(dstAlpha));
+            return vmovn_u32(Divide(dividend, vmovl_u16(Half<part>(divisor))));
+        }
+
+        template <int part> SIMD_INLINE void AlphaBlendingBgraToBgra(const uint8x16x4_t & src, uint8x8_t alpha, uint8x16x4_t & dst, uint8x8_t out[4])
+        {
+            uint16x8_t srcAlpha = DivideI16By255(vmull_u8(Half<part>(src.val[3]), alpha));
+            uint16x8_t dstAlpha = DivideI16By255(vmulq_u16(UnpackU8<part>(dst.val[3]), vsubq_u16(K16_00FF, srcAlpha)));
+            uint16x8_t sumAlpha = vaddq_u16(srcAlpha, dstAlpha);
+            uint16x8_t half = vshrq_n_u16(sumAlpha, 1);
+            uint16x8_t divisor = vmaxq_u16(sumAlpha, K16_0001);
+            for (size_t c = 0; c < 3; ++c)
+            {
+                uint16x8_t _src = UnpackU8<part>(src.val[c]), _dst = UnpackU8<part>(dst.val[c]);
+                out[c] = vmovn_u16(vcombine_u16(
+                    AlphaBlendingBgraToBgra<0>(_src, srcAlpha, _dst, dstAlpha, half, divisor),
+                    AlphaBlendingBgraToBgra<1>(_src, srcAlpha, _dst, dstAlpha, half, divisor)));
+            }
+            out[3] = vmovn_u16(sumAlpha);
+        }
+
+        template <int part> SIMD_INLINE void AlphaBlendingPremultipliedBgraToBgra(const uint8x16x4_t & src, uint8x8_t alpha, uint8x16x4_t & dst, uint8x8_t out[4])
+        {
+            uint16x8_t srcAlpha = DivideI16By255(vmull_u8(Half<part>(src.val[3]), alpha));
+            uint16x8_t inverse = vsubq_u16(K16_00FF, srcAlpha);
+            for (size_t c = 0; c < 3; ++c)
+            {
+                uint16x8_t _src = DivideI16By255(vmull_u8(Half<part>(src.val[c]), alpha));
+                out[c] = vqmovn_u16(vaddq_u16(_src, DivideI16By255(vmulq_u16(UnpackU8<part>(dst.val[c]), inverse))));
+            }
+            out[3] = vqmovn_u16(vaddq_u16(srcAlpha, DivideI16By255(vmulq_u16(UnpackU8<part>(dst.val[3]), inverse))));
+        }
+
+        template <bool premultiplied, int part> SIMD_INLINE void AlphaBlendingBgraToBgra(const uint8x16x4_t & src, uint8x8_t alpha, uint8x16x4_t & dst, uint8x8_t out[4])
+        {
+            if (premultiplied)
+                AlphaBlendingPremultipliedBgraToBgra<part>(src, alpha, dst, out);
+            else
+                AlphaBlendingBgraToBgra<part>(src, alpha, dst, out);
+        }
+
+        template <bool premultiplied> SIMD_INLINE void AlphaBlendingBgraToBgra(const uint8_t * src, uint8x8_t alpha, uint8_t * dst)
+        {
+            uint8x16x4_t _src = Load4<false>(src);
+            uint8x16x4_t _dst = Load4<false>(dst);
+            uint8x8_t lo[4], hi[4];
+            AlphaBlendingBgraToBgra<premultiplied, 0>(_src, alpha, _dst, lo);
+            AlphaBlendingBgraToBgra<premultiplied, 1>(_src, alpha, _dst, hi);
+            for (size_t c = 0; c < 4; ++c)
+                _dst.val[c] = vcombine_u8(lo[c], hi[c]);
+            Store4<false>(dst, _dst);
+        }
+
+        template <bool premultiplied> void AlphaBlendingBgraToBgra(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t alpha, uint8_t * dst, size_t dstStride)
+        {
+            size_t widthA = AlignLo(width, A);
+            uint8x8_t _alpha = vdup_n_u8(alpha);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                    AlphaBlendingBgraToBgra<premultiplied>(src + col * 4, _alpha, dst + col * 4);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        void AlphaBlendingBgraToBgra(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t alpha, SimdBool premultiplied, uint8_t * dst, size_t dstStride)
+        {
+            assert(width >= A);
+
+            if (premultiplied)
+                AlphaBlendingBgraToBgra<true>(src, srcStride, width, height, alpha, dst, dstStride);
+            else
+                AlphaBlendingBgraToBgra<false>(src, srcStride, width, height, alpha, dst, dstStride);
+            size_t widthA = AlignLo(width, A);
+            if (widthA < width)
+                Base::AlphaBlendingBgraToBgra(src + widthA * 4, srcStride, width - widthA, height, alpha, premultiplied, dst + widthA * 4, dstStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE uint16x8_t PairSum16(uint16x8_t lo, uint16x8_t hi)
+        {
+            return vcombine_u16(vmovn_u32(vpaddlq_u16(lo)), vmovn_u32(vpaddlq_u16(hi)));
+        }
+
+        template <int part> SIMD_INLINE uint16x8_t AlphaBlendingBgraToYuv(uint8x16_t value, uint8x16_t dst, uint16x8_t alpha)
+        {
+            return DivideI16By255(vaddq_u16(vmulq_u16(UnpackU8<part>(value), alpha), vmulq_u16(UnpackU8<part>(dst), vsubq_u16(K16_00FF, alpha))));
+        }
+
+        template <class T> SIMD_INLINE void AlphaBlendingBgraToYuv(const uint8_t * bgra, uint8x8_t alpha, uint8_t * y, uint16x8_t & a, uint16x8_t & u, uint16x8_t & v)
+        {
+            uint8x16x4_t _bgra = Load4<false>(bgra);
+            uint8x16_t _y = BgrToY<T>(_bgra.val[0], _bgra.val[1], _bgra.val[2]);
+            uint8x16_t _u = BgrToU<T>(_bgra.val[0], _bgra.val[1], _bgra.val[2]);
+            uint8x16_t _v = BgrToV<T>(_bgra.val[0], _bgra.val[1], _bgra.val[2]);
+            uint16x8_t lo = DivideI16By255(vmull_u8(Half<0>(_bgra.val[3]), alpha));
+            uint16x8_t hi = DivideI16By255(vmull_u8(Half<1>(_bgra.val[3]), alpha));
+            uint8x16_t dst = Load<false>(y);
+            Store<false>(y, vcombine_u8(vmovn_u16(AlphaBlendingBgraToYuv<0>(_y, dst, lo)), vmovn_u16(AlphaBlendingBgraToYuv<1>(_y, dst, hi))));
+            a = vaddq_u16(a, PairSum16(lo, hi));
+            u = vaddq_u16(u, PairSum16(DivideI16By255(vmulq_u16(UnpackU8<0>(_u), lo)), DivideI16By255(vmulq_u16(UnpackU8<1>(_u), hi))));
+            v = vaddq_u16(v, PairSum16(DivideI16By255(vmulq_u16(UnpackU8<0>(_v), lo)), DivideI16By255(vmulq_u16(UnpackU8<1>(_v), hi))));
+        }
+
+        template <bool nv12> SIMD_INLINE void LoadChroma(const uint8_t * u, const uint8_t * v, uint8x8_t & _u, uint8x8_t & _v)
+        {
+            if (nv12)
+            {
+                uint8x8x2_t uv = vld2_u8(u);
+                _u = uv.val[0];
+                _v = uv.val[1];
+            }
+            else
+            {
+                _u = vld1_u8(u);
+                _v = vld1_u8(v);
+            }
+        }
+
+        template <bool nv12> SIMD_INLINE void StoreChroma(uint8x8_t _u, uint8x8_t _v, uint8_t * u, uint8_t * v)
+        {
+            if (nv12)
+            {
+                uint8x8x2_t uv;
+                uv.val[0] = _u;
+                uv.val[1] = _v;
+                Store2<false>(u, uv);
+            }
+            else
+            {
+                Store<false>(u, _u);
+                Store<false>(v, _v);
+            }
+        }
+
+        template <class T, bool nv12> SIMD_INLINE void AlphaBlendingBgraToYuv420(const uint8_t * bgra, size_t bgraStride, uint8x8_t alpha, uint8_t * y, size_t yStride, uint8_t * u, uint8_t * v)
+        {
+            uint16x8_t a = K16_0000, _u = K16_0000, _v = K16_0000;
+            AlphaBlendingBgraToYuv<T>(bgra, alpha, y, a, _u, _v);
+            AlphaBlendingBgraToYuv<T>(bgra + bgraStride, alpha, y + yStride, a, _u, _v);
+            uint8x8_t u8, v8;
+            LoadChroma<nv12>(u, v, u8, v8);
+            uint16x8_t inverse = vsubq_u16(K16_00FF, vrshrq_n_u16(a, 2));
+            u8 = vmovn_u16(vaddq_u16(vrshrq_n_u16(_u, 2), DivideI16By255(vmulq_u16(vmovl_u8(u8), inverse))));
+            v8 = vmovn_u16(vaddq_u16(vrshrq_n_u16(_v, 2), DivideI16By255(vmulq_u16(vmovl_u8(v8), inverse))));
+            StoreChroma<nv12>(u8, v8, u, v);
+        }
+
+        template <class T, bool nv12> void AlphaBlendingBgraToYuv420(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t alpha,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            size_t widthA = AlignLo(width, A);
+            uint8x8_t _alpha = vdup_n_u8(alpha);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0; colY < widthA; colY += A)
+                {
+                    size_t colUV = nv12 ? colY : colY / 2;
+                    AlphaBlendingBgraToYuv420<T, nv12>(bgra + colY * 4, bgraStride, _alpha, y + colY, yStride, u + colUV, v + colUV);
+                }
+                bgra += 2 * bgraStride;
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+            }
+        }
+
+        template <bool nv12> void AlphaBlendingBgraToYuv420(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t alpha,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: AlphaBlendingBgraToYuv420<Base::Bt601, nv12>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: AlphaBlendingBgraToYuv420<Base::Bt709, nv12>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: AlphaBlendingBgraToYuv420<Base::Bt2020, nv12>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: AlphaBlendingBgraToYuv420<Base::Bt601Full, nv12>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: AlphaBlendingBgraToYuv420<Base::Bt709Full, nv12>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: AlphaBlendingBgraToYuv420<Base::Bt2020Full, nv12>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride); break;
+            default: assert(0);
+            }
+        }
+
+        void AlphaBlendingBgraToYuv420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t alpha,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            assert(width >= A && (width % 2 == 0) && (height % 2 == 0));
+
+            AlphaBlendingBgraToYuv420<false>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride, yuvType);
+            size_t widthA = AlignLo(width, A);
+            if (widthA < width)
+                Base::AlphaBlendingBgraToYuv420p(bgra + widthA * 4, bgraStride, width - widthA, height, alpha,
+                    y + widthA, yStride, u + widthA / 2, uStride, v + widthA / 2, vStride, yuvType);
+        }
+
+        void AlphaBlendingBgraToNv12(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t alpha,
+            uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            assert(width >= A && (width % 2 == 0) && (height % 2 == 0));
+
+            AlphaBlendingBgraToYuv420<true>(bgra, bgraStride, width, height, alpha, y, yStride, uv, uvStride, uv, uvStride, yuvType);
+            size_t widthA = AlignLo(width, A);
+            if (widthA < width)
+                Base::AlphaBlendingBgraToNv12(bgra + widthA * 4, bgraStride, width - widthA, height, alpha, y + widthA, yStride, uv + widthA, uvStride, yuvType);
+        }
+    }
+#endif// SIMD_NEON_ENABLE
+}
@@ -427,6 +427,338 @@ namespace Simd
             else
                 BackgroundInitMask<false>(src, srcStride, width, height, index, value, dst, dstStride);
         }
+
+        template <bool align, bool grow, bool increment, bool adjust> SIMD_INLINE void BackgroundUpdate(const uint8_t * value, uint8_t * loValue, uint8_t * hiValue,
+            uint8_t * loCount, uint8_t * hiCount, size_t offset, const uint8x16_t & threshold, const uint8x16_t & mask)
+        {
+            const uint8x16_t _value = Load<align>(value + offset);
+            uint8x16_t _loValue = Load<align>(loValue + offset);
+            uint8x16_t _hiValue = Load<align>(hiValue + offset);
+            if (grow)
+            {
+                _loValue = vqsubq_u8(_loValue, vandq_u8(mask, vqsubq_u8(_loValue, _value)));
+                _hiValue = vqaddq_u8(_hiValue, vandq_u8(mask, vqsubq_u8(_value, _hiValue)));
+            }
+            if (increment || adjust)
+            {
+                const uint8x16_t one = vandq_u8(mask, K8_01);
+                uint8x16_t _loCount = Load<align>(loCount + offset);
+                uint8x16_t _hiCount = Load<align>(hiCount + offset);
+                if (increment)
+                {
+                    _loCount = vqaddq_u8(_loCount, vandq_u8(one, vcltq_u8(_value, _loValue)));
+                    _hiCount = vqaddq_u8(_hiCount, vandq_u8(one, vcgtq_u8(_value, _hiValue)));
+                }
+                if (adjust)
+                {
+                    _loValue = AdjustLo(_loCount, _loValue, one, threshold);
+                    _hiValue = AdjustHi(_hiCount, _hiValue, one, threshold);
+                    _loCount = vbicq_u8(_loCount, mask);
+                    _hiCount = vbicq_u8(_hiCount, mask);
+                }
+                Store<align>(loCount + offset, _loCount);
+                Store<align>(hiCount + offset, _hiCount);
+            }
+            if (grow || adjust)
+            {
+                Store<align>(loValue + offset, _loValue);
+                Store<align>(hiValue + offset, _hiValue);
+            }
+        }
+
+        template <bool align, bool grow, bool increment, bool adjust> void BackgroundUpdate(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * loValue, size_t loValueStride, uint8_t * hiValue, size_t hiValueStride,
+            uint8_t * loCount, size_t loCountStride, uint8_t * hiCount, size_t hiCountStride, uint8_t threshold)
+        {
+            assert(width >= A);
+            if (align)
+            {
+                assert(Aligned(value) && Aligned(valueStride));
+                assert(Aligned(loValue) && Aligned(loValueStride) && Aligned(hiValue) && Aligned(hiValueStride));
+                assert(Aligned(loCount) && Aligned(loCountStride) && Aligned(hiCount) && Aligned(hiCountStride));
+            }
+
+            const uint8x16_t _threshold = vld1q_dup_u8(&threshold);
+            size_t alignedWidth = AlignLo(width, A);
+            uint8x16_t tailMask = ShiftLeft(K8_FF, A - width + alignedWidth);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < alignedWidth; col += A)
+                    BackgroundUpdate<align, grow, increment, adjust>(value, loValue, hiValue, loCount, hiCount, col, _threshold, K8_FF);
+                if (alignedWidth != width)
+                    BackgroundUpdate<false, grow, increment, adjust>(value, loValue, hiValue, loCount, hiCount, width - A, _threshold, tailMask);
+                value += valueStride;
+                loValue += loValueStride;
+                hiValue += hiValueStride;
+                loCount += loCountStride;
+                hiCount += hiCountStride;
+            }
+        }
+
+        typedef void(*BackgroundUpdatePtr)(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * loValue, size_t loValueStride, uint8_t * hiValue, size_t hiValueStride,
+            uint8_t * loCount, size_t loCountStride, uint8_t * hiCount, size_t hiCountStride, uint8_t threshold);
+
+        template <bool align, bool grow, bool increment> BackgroundUpdatePtr GetBackgroundUpdate(int flags)
+        {
+            if (flags & SimdBackgroundUpdateAdjustRange)
+                return BackgroundUpdate<align, grow, increment, true>;
+            else
+                return BackgroundUpdate<align, grow, increment, false>;
+        }
+
+        template <bool align, bool grow> BackgroundUpdatePtr GetBackgroundUpdate(int flags)
+        {
+            if (flags & SimdBackgroundUpdateIncrementCount)
+                return GetBackgroundUpdate<align, grow, true>(flags);
+            else
+                return GetBackgroundUpdate<align, grow, false>(flags);
+        }
+
+        template <bool align> BackgroundUpdatePtr GetBackgroundUpdate(int flags)
+        {
+            if (flags & SimdBackgroundUpdateGrowRange)
+                return GetBackgroundUpdate<align, true>(flags);
+            else
+                return GetBackgroundUpdate<align, false>(flags);
+        }
+
+        void BackgroundUpdate(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * loValue, size_t loValueStride, uint8_t * hiValue, size_t hiValueStride,
+            uint8_t * loCount, size_t loCountStride, uint8_t * hiCount, size_t hiCountStride, uint8_t threshold, int flags)
+        {
+            if ((flags & (SimdBackgroundUpdateGrowRange | SimdBackgroundUpdateIncrementCount | SimdBackgroundUpdateAdjustRange)) == 0)
+                return;
+            BackgroundUpdatePtr backgroundUpdate;
+            if (Aligned(value) && Aligned(valueStride) &&
+                Aligned(loValue) && Aligned(loValueStride) && Aligned(hiValue) && Aligned(hiValueStride) &&
+                Aligned(loCount) && Aligned(loCountStride) && Aligned(hiCount) && Aligned(hiCountStride))
+                backgroundUpdate = GetBackgroundUpdate<true>(flags);
+            else
+                backgroundUpdate = GetBackgroundUpdate<false>(flags);
+            backgroundUpdate(value, valueStride, width, height, loValue, loValueStride, hiValue, hiValueStride,
+                loCount, loCountStride, hiCount, hiCountStride, threshold);
+        }
+
+        template <bool align> SIMD_INLINE void BackgroundPackedInit(const uint8_t * value, uint8_t * model)
+        {
+            uint8x16x4_t _model;
+            _model.val[0] = Load<align>(value);
+            _model.val[1] = _model.val[0];
+            _model.val[2] = K8_00;
+            _model.val[3] = K8_00;
+            Store4<align>(model, _model);
+        }
+
+        template <bool align> void BackgroundPackedInit(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
+        {
+            assert(width >= A);
+            if (align)
+                assert(Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride));
+
+            size_t alignedWidth = AlignLo(width, A);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < alignedWidth; col += A)
+                    BackgroundPackedInit<align>(value + col, model + 4 * col);
+                if (alignedWidth != width)
+                    BackgroundPackedInit<false>(value + width - A, model + 4 * (width - A));
+                value += valueStride;
+                model += modelStride;
+            }
+        }
+
+        void BackgroundPackedInit(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
+        {
+            if (Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride))
+                BackgroundPackedInit<true>(value, valueStride, width, height, model, modelStride);
+            else
+                BackgroundPackedInit<false>(value, valueStride, width, height, model, modelStride);
+        }
+
+        template <bool align, bool grow, bool increment, bool adjust> SIMD_INLINE void BackgroundPackedUpdate(const uint8_t * value, uint8_t * model,
+            const uint8x16_t & threshold, const uint8x16_t & mask)
+        {
+            const uint8x16_t _value = Load<align>(value);
+            uint8x16x4_t _model = Load4<align>(model);
+            if (grow)
+            {
+                _model.val[0] = vqsubq_u8(_model.val[0], vandq_u8(mask, vqsubq_u8(_model.val[0], _value)));
+                _model.val[1] = vqaddq_u8(_model.val[1], vandq_u8(mask, vqsubq_u8(_value, _model.val[1])));
+            }
+            const uint8x16_t one = vandq_u8(mask, K8_01);
+            if (increment)
+            {
+                _model.val[2] = vqaddq_u8(_model.val[2], vandq_u8(one, vcltq_u8(_value, _model.val[0])));
+                _model.val[3] = vqaddq_u8(_model.val[3], vandq_u8(one, vcgtq_u8(_value, _model.val[1])));
+            }
+            if (adjust)
+            {
+                _model.val[0] = AdjustLo(_model.val[2], _model.val[0], one, threshold);
+                _model.val[1] = AdjustHi(_model.val[3], _model.val[1], one, threshold);
+                _model.val[2] = vbicq_u8(_model.val[2], mask);
+                _model.val[3] = vbicq_u8(_model.val[3], mask);
+            }
+            Store4<align>(model, _model);
+        }
+
+        template <bool align, bool grow, bool increment, bool adjust> void BackgroundPackedUpdate(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * model, size_t modelStride, uint8_t threshold)
+        {
+            assert(width >= A);
+            if (align)
+                assert(Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride));
+
+            const uint8x16_t _threshold = vld1q_dup_u8(&threshold);
+            size_t alignedWidth = AlignLo(width, A);
+            uint8x16_t tailMask = ShiftLeft(K8_FF, A - width + alignedWidth);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < alignedWidth; col += A)
+                    BackgroundPackedUpdate<align, grow, increment, adjust>(value + col, model + 4 * col, _threshold, K8_FF);
+                if (alignedWidth != width)
+                    BackgroundPackedUpdate<false, grow, increment, adjust>(value + width - A, model + 4 * (width - A), _threshold, tailMask);
+                value += valueStride;
+                model += modelStride;
+            }
+        }
+
+        typedef void(*BackgroundPackedUpdatePtr)(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * model, size_t modelStride, uint8_t threshold);
+
+        template <bool align, bool grow, bool increment> BackgroundPackedUpdatePtr GetBackgroundPackedUpdate(int flags)
+        {
+            if (flags & SimdBackgroundUpdateAdjustRange)
+                return BackgroundPackedUpdate<align, grow, increment, true>;
+            else
+                return BackgroundPackedUpdate<align, grow, increment, false>;
+        }
+
+        template <bool align, bool grow> BackgroundPackedUpdatePtr GetBackgroundPackedUpdate(int flags)
+        {
+            if (flags & SimdBackgroundUpdateIncrementCount)
+                return GetBackgroundPackedUpdate<align, grow, true>(flags);
+            else
+                return GetBackgroundPackedUpdate<align, grow, false>(flags);
+        }
+
+        template <bool align> BackgroundPackedUpdatePtr GetBackgroundPackedUpdate(int flags)
+        {
+            if (flags & SimdBackgroundUpdateGrowRange)
+                return GetBackgroundPackedUpdate<align, true>(flags);
+            else
+                return GetBackgroundPackedUpdate<align, false>(flags);
+        }
+
+        void BackgroundPackedUpdate(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * model, size_t modelStride, uint8_t threshold, int flags)
+        {
+            if ((flags & (SimdBackgroundUpdateGrowRange | SimdBackgroundUpdateIncrementCount | SimdBackgroundUpdateAdjustRange)) == 0)
+                return;
+            BackgroundPackedUpdatePtr backgroundPackedUpdate;
+            if (Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride))
+                backgroundPackedUpdate = GetBackgroundPackedUpdate<true>(flags);
+            else
+                backgroundPackedUpdate = GetBackgroundPackedUpdate<false>(flags);
+            backgroundPackedUpdate(value, valueStride, width, height, model, modelStride, threshold);
+        }
+
+        SIMD_INLINE void BackgroundPackedGrowRangeSlow(uint8x16x4_t & model, const uint8x16_t & value, const uint8x16_t & mask, const uint8x16_t & threshold)
+        {
+            const uint8x16_t one = vandq_u8(mask, K8_01);
+            model.val[0] = vqsubq_u8(model.val[0], vandq_u8(one, vcltq_u8(value, model.val[0])));
+            model.val[1] = vqaddq_u8(model.val[1], vandq_u8(one, vcgtq_u8(value, model.val[1])));
+        }
+
+        SIMD_INLINE void BackgroundPackedShiftRange(uint8x16x4_t & model, const uint8x16_t & value, const uint8x16_t & mask, const uint8x16_t & threshold)
+        {
+            const uint8x16_t add = vandq_u8(mask, vqsubq_u8(value, model.val[1]));
+            const uint8x16_t sub = vandq_u8(mask, vqsubq_u8(model.val[0], value));
+            model.val[0] = vqsubq_u8(vqaddq_u8(model.val[0], add), sub);
+            model.val[1] = vqsubq_u8(vqaddq_u8(model.val[1], add), sub);
+        }
+
+        SIMD_INLINE void BackgroundPackedAdjustRangeMasked(uint8x16x4_t & model, const uint8x16_t & value, const uint8x16_t & mask, const uint8x16_t & threshold)
+        {
+            const uint8x16_t one = vandq_u8(vandq_u8(mask, vtstq_u8(value, value)), K8_01);
+            model.val[0] = AdjustLo(model.val[2], model.val[0], one, threshold);
+            model.val[1] = AdjustHi(model.val[3], model.val[1], one, threshold);
+            model.val[2] = vbicq_u8(model.val[2], mask);
+            model.val[3] = vbicq_u8(model.val[3], mask);
+        }
+
+        typedef void(*BackgroundPackedKernelPtr)(uint8x16x4_t & model, const uint8x16_t & value, const uint8x16_t & mask, const uint8x16_t & threshold);
+
+        template <BackgroundPackedKernelPtr kernel, bool align, bool masked> SIMD_INLINE void BackgroundPackedApply(const uint8_t * value,
+            const uint8_t * mask, uint8_t * model, const uint8x16_t & threshold, const uint8x16_t & tailMask)
+        {
+            const uint8x16_t _value = Load<align>(value);
+            uint8x16x4_t _model = Load4<align>(model);
+            if (masked)
+            {
+                const uint8x16_t _mask = Load<align>(mask);
+                kernel(_model, _value, vandq_u8(tailMask, vtstq_u8(_mask, _mask)), threshold);
+            }
+            else
+                kernel(_model, _value, tailMask, threshold);
+            Store4<align>(model, _model);
+        }
+
+        template <BackgroundPackedKernelPtr kernel, bool align, bool masked> void BackgroundPackedApply(const uint8_t * value, size_t valueStride,
+            size_t width, size_t height, uint8_t * model, size_t modelStride, uint8_t threshold, const uint8_t * mask, size_t maskStride)
+        {
+            assert(width >= A);
+            if (align)
+                assert(Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride) && (!masked || (Aligned(mask) && Aligned(maskStride))));
+
+            const uint8x16_t _threshold = vld1q_dup_u8(&threshold);
+            size_t alignedWidth = AlignLo(width, A);
+            uint8x16_t tailMask = ShiftLeft(K8_FF, A - width + alignedWidth);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < alignedWidth; col += A)
+                    BackgroundPackedApply<kernel, align, masked>(value + col, mask + col, model + 4 * col, _threshold, K8_FF);
+                if (alignedWidth != width)
+                    BackgroundPackedApply<kernel, false, masked>(value + width - A, mask + width - A, model + 4 * (width - A), _threshold, tailMask);
+                value += valueStride;
+                model += modelStride;
+                mask += maskStride;
+            }
+        }
+
+        void BackgroundPackedGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
+        {
+            if (Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride))
+                BackgroundPackedApply<BackgroundPackedGrowRangeSlow, true, false>(value, valueStride, width, height, model, modelStride, 0, value, valueStride);
+            else
+                BackgroundPackedApply<BackgroundPackedGrowRangeSlow, false, false>(value, valueStride, width, height, model, modelStride, 0, value, valueStride);
+        }
+
+        void BackgroundPackedAdjustRangeMasked(uint8_t * model, size_t modelStride, size_t width, size_t height,
+            uint8_t threshold, const uint8_t * mask, size_t maskStride)
+        {
+            if (Aligned(model) && Aligned(modelStride) && Aligned(mask) && Aligned(maskStride))
+                BackgroundPackedApply<BackgroundPackedAdjustRangeMasked, true, false>(mask, maskStride, width, height, model, modelStride, threshold, mask, maskStride);
+            else
+                BackgroundPackedApply<BackgroundPackedAdjustRangeMasked, false, false>(mask, maskStride, width, height, model, modelStride, threshold, mask, maskStride);
+        }
+
+        void BackgroundPackedShiftRange(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
+        {
+            if (Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride))
+                BackgroundPackedApply<BackgroundPackedShiftRange, true, false>(value, valueStride, width, height, model, modelStride, 0, value, valueStride);
+            else
+                BackgroundPackedApply<BackgroundPackedShiftRange, false, false>(value, valueStride, width, height, model, modelStride, 0, value, valueStride);
+        }
+
+        void BackgroundPackedShiftRangeMasked(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * model, size_t modelStride, const uint8_t * mask, size_t maskStride)
+        {
+            if (Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride) && Aligned(mask) && Aligned(maskStride))
+                BackgroundPackedApply<BackgroundPackedShiftRange, true, true>(value, valueStride, width, height, model, modelStride, 0, mask, maskStride);
+            else
+                BackgroundPackedApply<BackgroundPackedShiftRange, false, true>(value, valueStride, width, height, model, modelStride, 0, mask, maskStride);
+        }
     }
 #endif// SIMD_NEON_ENABLE
 }
@@ -0,0 +1,161 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBayer.h"
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+#ifdef SIMD_NEON_ENABLE  
+    namespace Neon
+    {
+        template<size_t channels> SIMD_INLINE void BayerMhcStore(const uint8x16_t bgr[3], const uint8x16_t & alpha, uint8_t * dst);
+
+        template<> SIMD_INLINE void BayerMhcStore<1>(const uint8x16_t bgr[3], const uint8x16_t & alpha, uint8_t * dst)
+        {
+            uint16x8_t lo = BgrToGray(vmovl_u8(vget_low_u8(bgr[0])), vmovl_u8(vget_low_u8(bgr[1])), vmovl_u8(vget_low_u8(bgr[2])));
+            uint16x8_t hi = BgrToGray(vmovl_u8(vget_high_u8(bgr[0])), vmovl_u8(vget_high_u8(bgr[1])), vmovl_u8(vget_high_u8(bgr[2])));
+            Store<false>(dst, vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)));
+        }
+
+        template<> SIMD_INLINE void BayerMhcStore<3>(const uint8x16_t bgr[3], const uint8x16_t & alpha, uint8_t * dst)
+        {
+            uint8x16x3_t _bgr;
+            _bgr.val[0] = bgr[0];
+            _bgr.val[1] = bgr[1];
+            _bgr.val[2] = bgr[2];
+            Store3<false>(dst, _bgr);
+        }
+
+        template<> SIMD_INLINE void BayerMhcStore<4>(const uint8x16_t bgr[3], const uint8x16_t & alpha, uint8_t * dst)
+        {
+            uint8x16x4_t _bgra;
+            _bgra.val[0] = bgr[0];
+            _bgra.val[1] = bgr[1];
+            _bgra.val[2] = bgr[2];
+            _bgra.val[3] = alpha;
+            Store4<false>(dst, _bgra);
+        }
+
+        template<size_t channels, bool greenOdd> SIMD_INLINE void BayerMhcBody(const uint8_t * src[5], size_t width, bool red, const uint8x16_t & alpha, uint8_t * dst)
+        {
+            size_t body = AlignLo(width - 4, A) + 2, tail = width - 2 - A;
+            uint8x16_t bgr[3];
+            for (size_t col = 2; col < body; col += A)
+            {
+                BayerMhc<greenOdd>(src, col, red, bgr);
+                BayerMhcStore<channels>(bgr, alpha, dst + col * channels);
+            }
+            if (body < width - 2)
+            {
+                BayerMhc<greenOdd>(src, tail, red, bgr);
+                BayerMhcStore<channels>(bgr, alpha, dst + tail * channels);
+            }
+        }
+
+        template<size_t channels> void BayerMhc(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && width >= A + 4);
+
+            const uint8_t * src[5];
+            size_t greenOdd;
+            bool red;
+            uint8x16_t _alpha = vdupq_n_u8(alpha);
+            for (size_t row = 0; row < height; ++row)
+            {
+                Base::BayerMhcRows(bayer, height, bayerStride, row, src);
+                Base::BayerMhcRowInfo(bayerFormat, row, greenOdd, red);
+                Base::BayerMhc<channels>(src, 0, 2, width, greenOdd, red, dst, alpha);
+                if (greenOdd)
+                    BayerMhcBody<channels, true>(src, width, red, _alpha, dst);
+                else
+                    BayerMhcBody<channels, false>(src, width, red, _alpha, dst);
+                Base::BayerMhc<channels>(src, width - 2, width, width, greenOdd, red, dst, alpha);
+                dst += dstStride;
+            }
+        }
+
+        void BayerToBgrMhc(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride)
+        {
+            BayerMhc<3>(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride, 0);
+        }
+
+        void BayerToBgraMhc(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            BayerMhc<4>(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
+        }
+
+        void BayerToGray(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * gray, size_t grayStride)
+        {
+            BayerMhc<1>(bayer, width, height, bayerStride, bayerFormat, gray, grayStride, 0);
+        }
+
+        template <SimdPixelFormatType bayerFormat> void BayerToBgrHalf(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, uint8_t * bgr, size_t bgrStride)
+        {
+            size_t widthDA = AlignLo(width, DA);
+            uint8x16x3_t _bgr;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0; col < widthDA; col += DA)
+                {
+                    BayerToBgrHalf<bayerFormat>(bayer + col, bayer + bayerStride + col, _bgr);
+                    Store3<false>(bgr + col / 2 * 3, _bgr);
+                }
+                if (widthDA != width)
+                {
+                    size_t col = width - DA;
+                    BayerToBgrHalf<bayerFormat>(bayer + col, bayer + bayerStride + col, _bgr);
+                    Store3<false>(bgr + col / 2 * 3, _bgr);
+                }
+                bayer += 2 * bayerStride;
+                bgr += bgrStride;
+            }
+        }
+
+        void BayerToBgrHalf(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && width >= DA);
+
+            switch (bayerFormat)
+            {
+            case SimdPixelFormatBayerGrbg:
+                BayerToBgrHalf<SimdPixelFormatBayerGrbg>(bayer, width, height, bayerStride, bgr, bgrStride);
+                break;
+            case SimdPixelFormatBayerGbrg:
+                BayerToBgrHalf<SimdPixelFormatBayerGbrg>(bayer, width, height, bayerStride, bgr, bgrStride);
+                break;
+            case SimdPixelFormatBayerRggb:
+                BayerToBgrHalf<SimdPixelFormatBayerRggb>(bayer, width, height, bayerStride, bgr, bgrStride);
+                break;
+            case SimdPixelFormatBayerBggr:
+                BayerToBgrHalf<SimdPixelFormatBayerBggr>(bayer, width, height, bayerStride, bgr, bgrStride);
+                break;
+            default:
+                assert(0);
+            }
+        }
+    }
+#endif// SIMD_NEON_ENABLE
+}
@@ -74,6 +74,45 @@ namespace Simd
                 BgrToBgra<false>(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
         }
 
+        template <bool align> SIMD_INLINE void BgrToRgba(const uint8_t * bgr, uint8_t * rgba, uint8x16x4_t & _rgba)
+        {
+            uint8x16x3_t _bgr = Load3<align>(bgr);
+            _rgba.val[0] = _bgr.val[2];
+            _rgba.val[1] = _bgr.val[1];
+            _rgba.val[2] = _bgr.val[0];
+            Store4<align>(rgba, _rgba);
+        }
+
+        template <bool align> void BgrToRgba(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * rgba, size_t rgbaStride, uint8_t alpha)
+        {
+            assert(width >= A);
+            if (align)
+                assert(Aligned(rgba) && Aligned(rgbaStride) && Aligned(bgr) && Aligned(bgrStride));
+
+            size_t alignedWidth = AlignLo(width, A);
+
+            uint8x16x4_t _rgba;
+            _rgba.val[3] = vdupq_n_u8(alpha);
+
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0, colRgba = 0, colBgr = 0; col < alignedWidth; col += A, colRgba += A4, colBgr += A3)
+                    BgrToRgba<align>(bgr + colBgr, rgba + colRgba, _rgba);
+                if (width != alignedWidth)
+                    BgrToRgba<false>(bgr + 3 * (width - A), rgba + 4 * (width - A), _rgba);
+                bgr += bgrStride;
+                rgba += rgbaStride;
+            }
+        }
+
+        void BgrToRgba(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * rgba, size_t rgbaStride, uint8_t alpha)
+        {
+            if (Aligned(rgba) && Aligned(rgbaStride) && Aligned(bgr) && Aligned(bgrStride))
+                BgrToRgba<true>(bgr, width, height, bgrStride, rgba, rgbaStride, alpha);
+            else
+                BgrToRgba<false>(bgr, width, height, bgrStride, rgba, rgbaStride, alpha);
+        }
+
         template <bool align> SIMD_INLINE void Bgr48pToBgra32(uint8_t * bgra,
             const uint8_t * blue, const uint8_t * green, const uint8_t * red, size_t offset, const uint8x16_t & alpha)
         {
@@ -30,12 +30,12 @@ namespace Simd
 #ifdef SIMD_NEON_ENABLE    
     namespace Neon
     {
-        SIMD_INLINE uint8x8_t BgrToGray(uint8x8x3_t bgr)
+        template <bool rgb> SIMD_INLINE uint8x8_t BgrToGray(uint8x8x3_t bgr)
         {
-            return vmovn_u16(BgrToGray(vmovl_u8(bgr.val[0]), vmovl_u8(bgr.val[1]), vmovl_u8(bgr.val[2])));
+            return vmovn_u16(BgrToGray(vmovl_u8(bgr.val[rgb ? 2 : 0]), vmovl_u8(bgr.val[1]), vmovl_u8(bgr.val[rgb ? 0 : 2])));
         }
 
-        template <bool align> void BgrToGray(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * gray, size_t grayStride)
+        template <bool align, bool rgb> void BgrToGray(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * gray, size_t grayStride)
         {
             assert(width >= HA);
             if (align)
@@ -47,12 +47,12 @@ namespace Simd
                 for (size_t col = 0; col < alignedWidth; col += HA)
                 {
                     uint8x8x3_t _bgr = LoadHalf3<align>(bgr + 3 * col);
-                    Store<align>(gray + col, BgrToGray(_bgr));
+                    Store<align>(gray + col, BgrToGray<rgb>(_bgr));
                 }
                 if (alignedWidth != width)
                 {
                     uint8x8x3_t _bgr = LoadHalf3<false>(bgr + 3 * (width - HA));
-                    Store<false>(gray + width - HA, BgrToGray(_bgr));
+                    Store<false>(gray + width - HA, BgrToGray<rgb>(_bgr));
                 }
                 bgr += bgrStride;
                 gray += grayStride;
@@ -62,9 +62,17 @@ namespace Simd
         void BgrToGray(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * gray, size_t grayStride)
         {
             if (Aligned(bgr) && Aligned(gray) && Aligned(bgrStride) && Aligned(grayStride))
-                BgrToGray<true>(bgr, width, height, bgrStride, gray, grayStride);
+                BgrToGray<true, false>(bgr, width, height, bgrStride, gray, grayStride);
             else
-                BgrToGray<false>(bgr, width, height, bgrStride, gray, grayStride);
+                BgrToGray<false, false>(bgr, width, height, bgrStride, gray, grayStride);
+        }
+
+        void RgbToGray(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * gray, size_t grayStride)
+        {
+            if (Aligned(rgb) && Aligned(gray) && Aligned(rgbStride) && Aligned(grayStride))
+                BgrToGray<true, true>(rgb, width, height, rgbStride, gray, grayStride);
+            else
+                BgrToGray<false, true>(rgb, width, height, rgbStride, gray, grayStride);
         }
     }
 #endif// SIMD_NEON_ENABLE
@@ -0,0 +1,222 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdLoad.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        SIMD_INLINE uint16x8_t BgrToHue16(uint16x8_t blue, uint16x8_t green, uint16x8_t red, uint16x8_t max, uint16x8_t range)
+        {
+            uint16x8_t dividend = vaddq_u16(vsubq_u16(red, green), vshlq_n_u16(range, 2));
+            dividend = vbslq_u16(vceqq_u16(green, max), vaddq_u16(vsubq_u16(blue, red), vshlq_n_u16(range, 1)), dividend);
+            dividend = vbslq_u16(vceqq_u16(red, max), vaddq_u16(vsubq_u16(green, blue), vmulq_u16(range, K16_0006)), dividend);
+            uint32x4_t lo = Divide(vmull_n_u16(vget_low_u16(dividend), 85), vshll_n_u16(vget_low_u16(range), 1));
+            uint32x4_t hi = Divide(vmull_n_u16(vget_high_u16(dividend), 85), vshll_n_u16(vget_high_u16(range), 1));
+            uint16x8_t hue = vandq_u16(vcombine_u16(vmovn_u32(lo), vmovn_u32(hi)), K16_00FF);
+            return vbicq_u16(hue, vceqq_u16(range, K16_0000));
+        }
+
+        SIMD_INLINE uint16x8_t Saturation16(uint16x8_t range, uint16x8_t divisor)
+        {
+            uint32x4_t lo = Divide(vmull_n_u16(vget_low_u16(range), 255), vmovl_u16(vget_low_u16(divisor)));
+            uint32x4_t hi = Divide(vmull_n_u16(vget_high_u16(range), 255), vmovl_u16(vget_high_u16(divisor)));
+            return vbicq_u16(vcombine_u16(vmovn_u32(lo), vmovn_u32(hi)), vceqq_u16(divisor, K16_0000));
+        }
+
+        template<bool hsl> SIMD_INLINE void BgrToHsx(uint8x8_t blue, uint8x8_t green, uint8x8_t red, uint8x8_t & hue, uint8x8_t & saturation, uint8x8_t & third)
+        {
+            uint8x8_t max = vmax_u8(vmax_u8(blue, green), red);
+            uint8x8_t min = vmin_u8(vmin_u8(blue, green), red);
+            uint16x8_t _max = vmovl_u8(max), _min = vmovl_u8(min), range = vsubq_u16(_max, _min);
+            hue = vmovn_u16(BgrToHue16(vmovl_u8(blue), vmovl_u8(green), vmovl_u8(red), _max, range));
+            if (hsl)
+            {
+                uint16x8_t sum = vaddq_u16(_max, _min);
+                saturation = vmovn_u16(Saturation16(range, vminq_u16(sum, vsubq_u16(vdupq_n_u16(510), sum))));
+                third = vshrn_n_u16(sum, 1);
+            }
+            else
+            {
+                saturation = vmovn_u16(Saturation16(range, _max));
+                third = max;
+            }
+        }
+
+        template<bool hsl> SIMD_INLINE void BgrToHsx(uint8x16_t blue, uint8x16_t green, uint8x16_t red, uint8x16x3_t & hsx)
+        {
+            uint8x8_t lo[3], hi[3];
+            BgrToHsx<hsl>(vget_low_u8(blue), vget_low_u8(green), vget_low_u8(red), lo[0], lo[1], lo[2]);
+            BgrToHsx<hsl>(vget_high_u8(blue), vget_high_u8(green), vget_high_u8(red), hi[0], hi[1], hi[2]);
+            hsx.val[0] = vcombine_u8(lo[0], hi[0]);
+            hsx.val[1] = vcombine_u8(lo[1], hi[1]);
+            hsx.val[2] = vcombine_u8(lo[2], hi[2]);
+        }
+
+        template<bool hsl> SIMD_INLINE void BgrToHsx(const uint8_t * bgr, uint8_t * hsx)
+        {
+            uint8x16x3_t _bgr = Load3<false>(bgr), _hsx;
+            BgrToHsx<hsl>(_bgr.val[0], _bgr.val[1], _bgr.val[2], _hsx);
+            Store3<false>(hsx, _hsx);
+        }
+
+        template<bool hsl> void BgrToHsx(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsx, size_t hsxStride)
+        {
+            assert(width >= A);
+
+            size_t widthA = AlignLo(width, A), tail = (width - A) * 3;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA * 3; col += A * 3)
+                    BgrToHsx<hsl>(bgr + col, hsx + col);
+                if (widthA < width)
+                    BgrToHsx<hsl>(bgr + tail, hsx + tail);
+                bgr += bgrStride;
+                hsx += hsxStride;
+            }
+        }
+
+        void BgrToHsl(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsl, size_t hslStride)
+        {
+            BgrToHsx<true>(bgr, width, height, bgrStride, hsl, hslStride);
+        }
+
+        void BgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride)
+        {
+            BgrToHsx<false>(bgr, width, height, bgrStride, hsv, hsvStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        template<bool hsl, class T> SIMD_INLINE void Yuv444pToHsx(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * hsx)
+        {
+            uint8x16_t _y = Load<false>(y), _u = Load<false>(u), _v = Load<false>(v);
+            uint8x16x3_t _hsx;
+            BgrToHsx<hsl>(YuvToBlue<T>(_y, _u), YuvToGreen<T>(_y, _u, _v), YuvToRed<T>(_y, _v), _hsx);
+            Store3<false>(hsx, _hsx);
+        }
+
+        template<bool hsl, class T> void Yuv444pToHsx(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsx, size_t hsxStride)
+        {
+            assert(width >= A);
+
+            size_t widthA = AlignLo(width, A), tail = width - A;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                    Yuv444pToHsx<hsl, T>(y + col, u + col, v + col, hsx + col * 3);
+                if (widthA < width)
+                    Yuv444pToHsx<hsl, T>(y + tail, u + tail, v + tail, hsx + tail * 3);
+                y += yStride;
+                u += uStride;
+                v += vStride;
+                hsx += hsxStride;
+            }
+        }
+
+        void Yuv444pToHsl(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsl, size_t hslStride)
+        {
+            Yuv444pToHsx<true, Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride);
+        }
+
+        void Yuv444pToHslV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsl, size_t hslStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv444pToHsx<true, Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride); break;
+            case SimdYuvBt709: Yuv444pToHsx<true, Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride); break;
+            case SimdYuvBt2020: Yuv444pToHsx<true, Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride); break;
+            case SimdYuvBt601Full: Yuv444pToHsx<true, Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride); break;
+            case SimdYuvBt709Full: Yuv444pToHsx<true, Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride); break;
+            case SimdYuvBt2020Full: Yuv444pToHsx<true, Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride); break;
+            default: assert(0);
+            }
+        }
+
+        void Yuv444pToHsv(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsv, size_t hsvStride)
+        {
+            Yuv444pToHsx<false, Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride);
+        }
+
+        void Yuv444pToHsvV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsv, size_t hsvStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv444pToHsx<false, Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride); break;
+            case SimdYuvBt709: Yuv444pToHsx<false, Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride); break;
+            case SimdYuvBt2020: Yuv444pToHsx<false, Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride); break;
+            case SimdYuvBt601Full: Yuv444pToHsx<false, Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride); break;
+            case SimdYuvBt709Full: Yuv444pToHsx<false, Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride); break;
+            case SimdYuvBt2020Full: Yuv444pToHsx<false, Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride); break;
+            default: assert(0);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void BgrToHsvInRange(const uint8_t * bgr, const uint8x16_t lower[3], const uint8x16_t upper[3], const uint8x16_t & wrap, uint8_t * mask)
+        {
+            uint8x16x3_t _bgr = Load3<false>(bgr), hsv;
+            BgrToHsx<false>(_bgr.val[0], _bgr.val[1], _bgr.val[2], hsv);
+            uint8x16_t hueLower = vcgeq_u8(hsv.val[0], lower[0]), hueUpper = vcleq_u8(hsv.val[0], upper[0]);
+            uint8x16_t hue = vbslq_u8(wrap, vorrq_u8(hueLower, hueUpper), vandq_u8(hueLower, hueUpper));
+            uint8x16_t saturation = vandq_u8(vcgeq_u8(hsv.val[1], lower[1]), vcleq_u8(hsv.val[1], upper[1]));
+            uint8x16_t value = vandq_u8(vcgeq_u8(hsv.val[2], lower[2]), vcleq_u8(hsv.val[2], upper[2]));
+            Store<false>(mask, vandq_u8(hue, vandq_u8(saturation, value)));
+        }
+
+        void BgrToHsvInRange(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, const uint8_t * lower, const uint8_t * upper, uint8_t * mask, size_t maskStride)
+        {
+            assert(width >= A);
+
+            uint8x16_t _lower[3], _upper[3];
+            for (size_t c = 0; c < 3; ++c)
+            {
+                _lower[c] = vdupq_n_u8(lower[c]);
+                _upper[c] = vdupq_n_u8(upper[c]);
+            }
+            uint8x16_t wrap = vdupq_n_u8(lower[0] > upper[0] ? 0xFF : 0);
+            size_t widthA = AlignLo(width, A), tail = width - A;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                    BgrToHsvInRange(bgr + col * 3, _lower, _upper, wrap, mask + col);
+                if (widthA < width)
+                    BgrToHsvInRange(bgr + tail * 3, _lower, _upper, wrap, mask + tail);
+                bgr += bgrStride;
+                mask += maskStride;
+            }
+        }
+    }
+#endif// SIMD_NEON_ENABLE
+}
@@ -40,22 +40,22 @@ namespace Simd
             return vshrq_n_u16(vpadalq_u8(vpadalq_u8(K16_0002, a), b), 2);
         }
 
-        template <bool align> SIMD_INLINE void BgrToYuv420p(const uint8_t * bgr0, size_t bgrStride, uint8_t * y0, size_t yStride, uint8_t * u, uint8_t * v)
+        template <bool align, class T = Base::Bt601> SIMD_INLINE void BgrToYuv420p(const uint8_t * bgr0, size_t bgrStride, uint8_t * y0, size_t yStride, uint8x16_t & u, uint8x16_t & v)
         {
             const uint8_t * bgr1 = bgr0 + bgrStride;
             uint8_t * y1 = y0 + yStride;
 
             uint8x16x3_t bgr00 = Load3<align>(bgr0);
-            Store<align>(y0 + 0, BgrToY(bgr00.val[0], bgr00.val[1], bgr00.val[2]));
+            Store<align>(y0 + 0, BgrToY<T>(bgr00.val[0], bgr00.val[1], bgr00.val[2]));
 
             uint8x16x3_t bgr01 = Load3<align>(bgr0 + A3);
-            Store<align>(y0 + A, BgrToY(bgr01.val[0], bgr01.val[1], bgr01.val[2]));
+            Store<align>(y0 + A, BgrToY<T>(bgr01.val[0], bgr01.val[1], bgr01.val[2]));
 
             uint8x16x3_t bgr10 = Load3<align>(bgr1);
-            Store<align>(y1 + 0, BgrToY(bgr10.val[0], bgr10.val[1], bgr10.val[2]));
+            Store<align>(y1 + 0, BgrToY<T>(bgr10.val[0], bgr10.val[1], bgr10.val[2]));
 
             uint8x16x3_t bgr11 = Load3<align>(bgr1 + A3);
-            Store<align>(y1 + A, BgrToY(bgr11.val[0], bgr11.val[1], bgr11.val[2]));
+            Store<align>(y1 + A, BgrToY<T>(bgr11.val[0], bgr11.val[1], bgr11.val[2]));
 
             uint16x8_t b0 = Average(bgr00.val[0], bgr10.val[0]);
             uint16x8_t g0 = Average(bgr00.val[1], bgr10.val[1]);
@@ -65,11 +65,19 @@ namespace Simd
             uint16x8_t g1 = Average(bgr01.val[1], bgr11.val[1]);
             uint16x8_t r1 = Average(bgr01.val[2], bgr11.val[2]);
 
-            Store<align>(u, PackSaturatedI16(BgrToU(b0, g0, r0), BgrToU(b1, g1, r1)));
-            Store<align>(v, PackSaturatedI16(BgrToV(b0, g0, r0), BgrToV(b1, g1, r1)));
+            u = PackSaturatedI16(BgrToU<T>(b0, g0, r0), BgrToU<T>(b1, g1, r1));
+            v = PackSaturatedI16(BgrToV<T>(b0, g0, r0), BgrToV<T>(b1, g1, r1));
         }
 
-        template <bool align> void BgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+        template <bool align, class T = Base::Bt601> SIMD_INLINE void BgrToYuv420p(const uint8_t * bgr0, size_t bgrStride, uint8_t * y0, size_t yStride, uint8_t * u, uint8_t * v)
+        {
+            uint8x16_t _u, _v;
+            BgrToYuv420p<align, T>(bgr0, bgrStride, y0, yStride, _u, _v);
+            Store<align>(u, _u);
+            Store<align>(v, _v);
+        }
+
+        template <bool align, class T = Base::Bt601> void BgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
@@ -83,11 +91,11 @@ namespace Simd
             for (size_t row = 0; row < height; row += 2)
             {
                 for (size_t colUV = 0, colY = 0, colBgr = 0; colY < alignedWidth; colY += DA, colUV += A, colBgr += A6)
-                    BgrToYuv420p<align>(bgr + colBgr, bgrStride, y + colY, yStride, u + colUV, v + colUV);
+                    BgrToYuv420p<align, T>(bgr + colBgr, bgrStride, y + colY, yStride, u + colUV, v + colUV);
                 if (width != alignedWidth)
                 {
                     size_t offset = width - DA;
-                    BgrToYuv420p<false>(bgr + offset * 3, bgrStride, y + offset, yStride, u + offset / 2, v + offset / 2);
+                    BgrToYuv420p<false, T>(bgr + offset * 3, bgrStride, y + offset, yStride, u + offset / 2, v + offset / 2);
                 }
                 y += 2 * yStride;
                 u += uStride;
@@ -96,14 +104,41 @@ namespace Simd
             }
         }
 
-        void BgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+        template <class T> void BgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
-                BgrToYuv420p<true>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+                BgrToYuv420p<true, T>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
             else
-                BgrToYuv420p<false>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+                BgrToYuv420p<false, T>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgrToYuv420p<Base::Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToYuv420p<Base::Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgrToYuv420p<Base::Bt709>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgrToYuv420p<Base::Bt2020>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: BgrToYuv420p<Base::Bt601Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: BgrToYuv420p<Base::Bt709Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: BgrToYuv420p<Base::Bt2020Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            default: assert(0);
+            }
+        }
+
+        void RgbToYuv420p(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgrToYuv420p<Base::Rgb<Base::Bt601>>(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride);
         }
 
         SIMD_INLINE uint16x8_t Average(uint8x16_t value)
@@ -111,27 +146,27 @@ namespace Simd
             return vshrq_n_u16(vpadalq_u8(K16_0001, value), 1);
         }
 
-        template <bool align> SIMD_INLINE void BgrToYuv422p(const uint8_t * bgr, uint8_t * y, uint8_t * u, uint8_t * v)
+        template <bool align, class T = Base::Bt601> SIMD_INLINE void BgrToYuv422p(const uint8_t * bgr, uint8_t * y, uint8_t * u, uint8_t * v)
         {
             uint8x16x3_t bgr0 = Load3<align>(bgr);
-            Store<align>(y + 0, BgrToY(bgr0.val[0], bgr0.val[1], bgr0.val[2]));
+            Store<align>(y + 0, BgrToY<T>(bgr0.val[0], bgr0.val[1], bgr0.val[2]));
 
             uint16x8_t b0 = Average(bgr0.val[0]);
             uint16x8_t g0 = Average(bgr0.val[1]);
             uint16x8_t r0 = Average(bgr0.val[2]);
 
             uint8x16x3_t bgr1 = Load3<align>(bgr + A3);
-            Store<align>(y + A, BgrToY(bgr1.val[0], bgr1.val[1], bgr1.val[2]));
+            Store<align>(y + A, BgrToY<T>(bgr1.val[0], bgr1.val[1], bgr1.val[2]));
 
             uint16x8_t b1 = Average(bgr1.val[0]);
             uint16x8_t g1 = Average(bgr1.val[1]);
             uint16x8_t r1 = Average(bgr1.val[2]);
 
-            Store<align>(u, PackSaturatedI16(BgrToU(b0, g0, r0), BgrToU(b1, g1, r1)));
-            Store<align>(v, PackSaturatedI16(BgrToV(b0, g0, r0), BgrToV(b1, g1, r1)));
+            Store<align>(u, PackSaturatedI16(BgrToU<T>(b0, g0, r0), BgrToU<T>(b1, g1, r1)));
+            Store<align>(v, PackSaturatedI16(BgrToV<T>(b0, g0, r0), BgrToV<T>(b1, g1, r1)));
         }
 
-        template <bool align> void BgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+        template <bool align, class T = Base::Bt601> void BgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             assert((width % 2 == 0) && (width >= DA));
@@ -145,11 +180,11 @@ namespace Simd
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t colUV = 0, colY = 0, colBgr = 0; colY < alignedWidth; colY += DA, colUV += A, colBgr += A6)
-                    BgrToYuv422p<align>(bgr + colBgr, y + colY, u + colUV, v + colUV);
+                    BgrToYuv422p<align, T>(bgr + colBgr, y + colY, u + colUV, v + colUV);
                 if (width != alignedWidth)
                 {
                     size_t offset = width - DA;
-                    BgrToYuv422p<false>(bgr + offset * 3, y + offset, u + offset / 2, v + offset / 2);
+                    BgrToYuv422p<false, T>(bgr + offset * 3, y + offset, u + offset / 2, v + offset / 2);
                 }
                 y += yStride;
                 u += uStride;
@@ -158,26 +193,53 @@ namespace Simd
             }
         }
 
-        void BgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+        template <class T> void BgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
-                BgrToYuv422p<true>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+                BgrToYuv422p<true, T>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
             else
-                BgrToYuv422p<false>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+                BgrToYuv422p<false, T>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
         }
 
+        void BgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgrToYuv422p<Base::Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        }
 
-        template <bool align> SIMD_INLINE void BgrToYuv444p(const uint8_t * bgr, uint8_t * y, uint8_t * u, uint8_t * v)
+        void BgrToYuv422pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToYuv422p<Base::Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgrToYuv422p<Base::Bt709>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgrToYuv422p<Base::Bt2020>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: BgrToYuv422p<Base::Bt601Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: BgrToYuv422p<Base::Bt709Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: BgrToYuv422p<Base::Bt2020Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            default: assert(0);
+            }
+        }
+
+        void RgbToYuv422p(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgrToYuv422p<Base::Rgb<Base::Bt601>>(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride);
+        }
+
+
+        template <bool align, class T = Base::Bt601> SIMD_INLINE void BgrToYuv444p(const uint8_t * bgr, uint8_t * y, uint8_t * u, uint8_t * v)
         {
             uint8x16x3_t _bgr = Load3<align>(bgr);
-            Store<align>(y, BgrToY(_bgr.val[0], _bgr.val[1], _bgr.val[2]));
-            Store<align>(u, BgrToU(_bgr.val[0], _bgr.val[1], _bgr.val[2]));
-            Store<align>(v, BgrToV(_bgr.val[0], _bgr.val[1], _bgr.val[2]));
+            Store<align>(y, BgrToY<T>(_bgr.val[0], _bgr.val[1], _bgr.val[2]));
+            Store<align>(u, BgrToU<T>(_bgr.val[0], _bgr.val[1], _bgr.val[2]));
+            Store<align>(v, BgrToV<T>(_bgr.val[0], _bgr.val[1], _bgr.val[2]));
         }
 
-        template <bool align> void BgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+        template <bool align, class T = Base::Bt601> void BgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             assert(width >= A);
@@ -191,11 +253,11 @@ namespace Simd
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t col = 0, colBgr = 0; col < alignedWidth; col += A, colBgr += A3)
-                    BgrToYuv444p<align>(bgr + colBgr, y + col, u + col, v + col);
+                    BgrToYuv444p<align, T>(bgr + colBgr, y + col, u + col, v + col);
                 if (width != alignedWidth)
                 {
                     size_t offset = width - A;
-                    BgrToYuv444p<false>(bgr + offset * 3, y + offset, u + offset, v + offset);
+                    BgrToYuv444p<false, T>(bgr + offset * 3, y + offset, u + offset, v + offset);
                 }
                 y += yStride;
                 u += uStride;
@@ -204,14 +266,120 @@ namespace Simd
             }
         }
 
-        void BgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+        template <class T> void BgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
-                BgrToYuv444p<true>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+                BgrToYuv444p<true, T>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
             else
-                BgrToYuv444p<false>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+                BgrToYuv444p<false, T>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgrToYuv444p<Base::Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgrToYuv444pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToYuv444p<Base::Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgrToYuv444p<Base::Bt709>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgrToYuv444p<Base::Bt2020>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: BgrToYuv444p<Base::Bt601Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: BgrToYuv444p<Base::Bt709Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: BgrToYuv444p<Base::Bt2020Full>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            default: assert(0);
+            }
+        }
+
+        void RgbToYuv444p(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgrToYuv444p<Base::Rgb<Base::Bt601>>(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        template <bool align, bool nv21, class T> SIMD_INLINE void BgrToNv12(const uint8_t * bgr0, size_t bgrStride, uint8_t * y0, size_t yStride, uint8_t * uv)
+        {
+            uint8x16_t u, v;
+            BgrToYuv420p<align, T>(bgr0, bgrStride, y0, yStride, u, v);
+            StoreUv<align, nv21>(uv, u, v);
+        }
+
+        template <bool align, bool nv21, class T> void BgrToNv12(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * uv, size_t uvStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
+            if (align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride));
+                assert(Aligned(bgr) && Aligned(bgrStride));
+            }
+
+            size_t alignedWidth = AlignLo(width, DA);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0, colBgr = 0; colY < alignedWidth; colY += DA, colBgr += A6)
+                    BgrToNv12<align, nv21, T>(bgr + colBgr, bgrStride, y + colY, yStride, uv + colY);
+                if (width != alignedWidth)
+                {
+                    size_t offset = width - DA;
+                    BgrToNv12<false, nv21, T>(bgr + offset * 3, bgrStride, y + offset, yStride, uv + offset);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                bgr += 2 * bgrStride;
+            }
+        }
+
+        template <bool nv21, class T> void BgrToNv12(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(bgr) && Aligned(bgrStride))
+                BgrToNv12<true, nv21, T>(bgr, width, height, bgrStride, y, yStride, uv, uvStride);
+            else
+                BgrToNv12<false, nv21, T>(bgr, width, height, bgrStride, y, yStride, uv, uvStride);
+        }
+
+        void BgrToNv12(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride)
+        {
+            BgrToNv12<false, Base::Bt601>(bgr, width, height, bgrStride, y, yStride, uv, uvStride);
+        }
+
+        void BgrToNv12V2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToNv12<false, Base::Bt601>(bgr, width, height, bgrStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt709: BgrToNv12<false, Base::Bt709>(bgr, width, height, bgrStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt2020: BgrToNv12<false, Base::Bt2020>(bgr, width, height, bgrStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt601Full: BgrToNv12<false, Base::Bt601Full>(bgr, width, height, bgrStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt709Full: BgrToNv12<false, Base::Bt709Full>(bgr, width, height, bgrStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt2020Full: BgrToNv12<false, Base::Bt2020Full>(bgr, width, height, bgrStride, y, yStride, uv, uvStride); break;
+            default: assert(0);
+            }
+        }
+
+        void BgrToNv21(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * vu, size_t vuStride)
+        {
+            BgrToNv12<true, Base::Bt601>(bgr, width, height, bgrStride, y, yStride, vu, vuStride);
+        }
+
+        void BgrToNv21V2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * vu, size_t vuStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToNv12<true, Base::Bt601>(bgr, width, height, bgrStride, y, yStride, vu, vuStride); break;
+            case SimdYuvBt709: BgrToNv12<true, Base::Bt709>(bgr, width, height, bgrStride, y, yStride, vu, vuStride); break;
+            case SimdYuvBt2020: BgrToNv12<true, Base::Bt2020>(bgr, width, height, bgrStride, y, yStride, vu, vuStride); break;
+            case SimdYuvBt601Full: BgrToNv12<true, Base::Bt601Full>(bgr, width, height, bgrStride, y, yStride, vu, vuStride); break;
+            case SimdYuvBt709Full: BgrToNv12<true, Base::Bt709Full>(bgr, width, height, bgrStride, y, yStride, vu, vuStride); break;
+            case SimdYuvBt2020Full: BgrToNv12<true, Base::Bt2020Full>(bgr, width, height, bgrStride, y, yStride, vu, vuStride); break;
+            default: assert(0);
+            }
         }
     }
 #endif// SIMD_NEON_ENABLE
@@ -32,13 +32,19 @@ namespace Simd
         const size_t A3 = A * 3;
         const size_t A4 = A * 4;
 
-        template <bool align> SIMD_INLINE void BgraToBgr(const uint8_t * bgra, uint8_t * bgr)
+        template <bool align, bool rgb> SIMD_INLINE void BgraToBgr(const uint8_t * bgra, uint8_t * bgr)
         {
             uint8x16x4_t _bgra = Load4<align>(bgra);
+            if (rgb)
+            {
+                uint8x16_t blue = _bgra.val[0];
+                _bgra.val[0] = _bgra.val[2];
+                _bgra.val[2] = blue;
+            }
             Store3<align>(bgr, *(uint8x16x3_t*)&_bgra);
         }
 
-        template <bool align> void BgraToBgr(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bgr, size_t bgrStride)
+        template <bool align, bool rgb> void BgraToBgr(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bgr, size_t bgrStride)
         {
             assert(width >= A);
             if (align)
@@ -51,9 +57,9 @@ namespace Simd
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t col = 0, colBgra = 0, colBgr = 0; col < alignedWidth; col += A, colBgra += A4, colBgr += A3)
-                    BgraToBgr<align>(bgra + colBgra, bgr + colBgr);
+                    BgraToBgr<align, rgb>(bgra + colBgra, bgr + colBgr);
                 if (width != alignedWidth)
-                    BgraToBgr<false>(bgra + 4 * (width - A), bgr + 3 * (width - A));
+                    BgraToBgr<false, rgb>(bgra + 4 * (width - A), bgr + 3 * (width - A));
                 bgra += bgraStride;
                 bgr += bgrStride;
             }
@@ -62,9 +68,17 @@ namespace Simd
         void BgraToBgr(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bgr, size_t bgrStride)
         {
             if (Aligned(bgra) && Aligned(bgraStride) && Aligned(bgr) && Aligned(bgrStride))
-                BgraToBgr<true>(bgra, width, height, bgraStride, bgr, bgrStride);
+                BgraToBgr<true, false>(bgra, width, height, bgraStride, bgr, bgrStride);
+            else
+                BgraToBgr<false, false>(bgra, width, height, bgraStride, bgr, bgrStride);
+        }
+
+        void BgraToRgb(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * rgb, size_t rgbStride)
+        {
+            if (Aligned(bgra) && Aligned(bgraStride) && Aligned(rgb) && Aligned(rgbStride))
+                BgraToBgr<true, true>(bgra, width, height, bgraStride, rgb, rgbStride);
             else
-                BgraToBgr<false>(bgra, width, height, bgraStride, bgr, bgrStride);
+                BgraToBgr<false, true>(bgra, width, height, bgraStride, rgb, rgbStride);
         }
     }
 #endif// SIMD_NEON_ENABLE
@@ -30,12 +30,12 @@ namespace Simd
 #ifdef SIMD_NEON_ENABLE    
     namespace Neon
     {
-        SIMD_INLINE uint8x8_t BgraToGray(uint8x8x4_t bgra)
+        template <bool rgb> SIMD_INLINE uint8x8_t BgraToGray(uint8x8x4_t bgra)
         {
-            return vmovn_u16(BgrToGray(vmovl_u8(bgra.val[0]), vmovl_u8(bgra.val[1]), vmovl_u8(bgra.val[2])));
+            return vmovn_u16(BgrToGray(vmovl_u8(bgra.val[rgb ? 2 : 0]), vmovl_u8(bgra.val[1]), vmovl_u8(bgra.val[rgb ? 0 : 2])));
         }
 
-        template <bool align> void BgraToGray(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * gray, size_t grayStride)
+        template <bool align, bool rgb> void BgraToGray(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * gray, size_t grayStride)
         {
             assert(width >= HA);
             if (align)
@@ -47,12 +47,12 @@ namespace Simd
                 for (size_t col = 0; col < alignedWidth; col += HA)
                 {
                     uint8x8x4_t _bgra = LoadHalf4<align>(bgra + 4 * col);
-                    Store<align>(gray + col, BgraToGray(_bgra));
+                    Store<align>(gray + col, BgraToGray<rgb>(_bgra));
                 }
                 if (alignedWidth != width)
                 {
                     uint8x8x4_t _bgra = LoadHalf4<false>(bgra + 4 * (width - HA));
-                    Store<false>(gray + width - HA, BgraToGray(_bgra));
+                    Store<false>(gray + width - HA, BgraToGray<rgb>(_bgra));
                 }
                 bgra += bgraStride;
                 gray += grayStride;
@@ -62,9 +62,17 @@ namespace Simd
         void BgraToGray(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * gray, size_t grayStride)
         {
             if (Aligned(bgra) && Aligned(gray) && Aligned(bgraStride) && Aligned(grayStride))
-                BgraToGray<true>(bgra, width, height, bgraStride, gray, grayStride);
+                BgraToGray<true, false>(bgra, width, height, bgraStride, gray, grayStride);
             else
-                BgraToGray<false>(bgra, width, height, bgraStride, gray, grayStride);
+                BgraToGray<false, false>(bgra, width, height, bgraStride, gray, grayStride);
+        }
+
+        void RgbaToGray(const uint8_t * rgba, size_t width, size_t height, size_t rgbaStride, uint8_t * gray, size_t grayStride)
+        {
+            if (Aligned(rgba) && Aligned(gray) && Aligned(rgbaStride) && Aligned(grayStride))
+                BgraToGray<true, true>(rgba, width, height, rgbaStride, gray, grayStride);
+            else
+                BgraToGray<false, true>(rgba, width, height, rgbaStride, gray, grayStride);
         }
     }
 #endif// SIMD_NEON_ENABLE
@@ -37,22 +37,22 @@ namespace Simd
             return vshrq_n_u16(vpadalq_u8(vpadalq_u8(K16_0002, a), b), 2);
         }
 
-        template <bool align> SIMD_INLINE void BgraToYuv420p(const uint8_t * bgra0, size_t bgraStride, uint8_t * y0, size_t yStride, uint8_t * u, uint8_t * v)
+        template <bool align, class T = Base::Bt601> SIMD_INLINE void BgraToYuv420p(const uint8_t * bgra0, size_t bgraStride, uint8_t * y0, size_t yStride, uint8x16_t & u, uint8x16_t & v)
         {
             const uint8_t * bgra1 = bgra0 + bgraStride;
             uint8_t * y1 = y0 + yStride;
 
             uint8x16x4_t bgra00 = Load4<align>(bgra0);
-            Store<align>(y0 + 0, BgrToY(bgra00.val[0], bgra00.val[1], bgra00.val[2]));
+            Store<align>(y0 + 0, BgrToY<T>(bgra00.val[0], bgra00.val[1], bgra00.val[2]));
 
             uint8x16x4_t bgra01 = Load4<align>(bgra0 + QA);
-            Store<align>(y0 + A, BgrToY(bgra01.val[0], bgra01.val[1], bgra01.val[2]));
+            Store<align>(y0 + A, BgrToY<T>(bgra01.val[0], bgra01.val[1], bgra01.val[2]));
 
             uint8x16x4_t bgra10 = Load4<align>(bgra1);
-            Store<align>(y1 + 0, BgrToY(bgra10.val[0], bgra10.val[1], bgra10.val[2]));
+            Store<align>(y1 + 0, BgrToY<T>(bgra10.val[0], bgra10.val[1], bgra10.val[2]));
 
             uint8x16x4_t bgra11 = Load4<align>(bgra1 + QA);
-            Store<align>(y1 + A, BgrToY(bgra11.val[0], bgra11.val[1], bgra11.val[2]));
+            Store<align>(y1 + A, BgrToY<T>(bgra11.val[0], bgra11.val[1], bgra11.val[2]));
 
             uint16x8_t b0 = Average(bgra00.val[0], bgra10.val[0]);
             uint16x8_t g0 = Average(bgra00.val[1], bgra10.val[1]);
@@ -62,11 +62,19 @@ namespace Simd
             uint16x8_t g1 = Average(bgra01.val[1], bgra11.val[1]);
             uint16x8_t r1 = Average(bgra01.val[2], bgra11.val[2]);
 
-            Store<align>(u, PackSaturatedI16(BgrToU(b0, g0, r0), BgrToU(b1, g1, r1)));
-            Store<align>(v, PackSaturatedI16(BgrToV(b0, g0, r0), BgrToV(b1, g1, r1)));
+            u = PackSaturatedI16(BgrToU<T>(b0, g0, r0), BgrToU<T>(b1, g1, r1));
+            v = PackSaturatedI16(BgrToV<T>(b0, g0, r0), BgrToV<T>(b1, g1, r1));
         }
 
-        template <bool align> void BgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+        template <bool align, class T = Base::Bt601> SIMD_INLINE void BgraToYuv420p(const uint8_t * bgra0, size_t bgraStride, uint8_t * y0, size_t yStride, uint8_t * u, uint8_t * v)
+        {
+            uint8x16_t _u, _v;
+            BgraToYuv420p<align, T>(bgra0, bgraStride, y0, yStride, _u, _v);
+            Store<align>(u, _u);
+            Store<align>(v, _v);
+        }
+
+        template <bool align, class T = Base::Bt601> void BgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
@@ -81,11 +89,11 @@ namespace Simd
             for (size_t row = 0; row < height; row += 2)
             {
                 for (size_t colUV = 0, colY = 0, colBgra = 0; colY < alignedWidth; colY += DA, colUV += A, colBgra += A8)
-                    BgraToYuv420p<align>(bgra + colBgra, bgraStride, y + colY, yStride, u + colUV, v + colUV);
+                    BgraToYuv420p<align, T>(bgra + colBgra, bgraStride, y + colY, yStride, u + colUV, v + colUV);
                 if (width != alignedWidth)
                 {
                     size_t offset = width - DA;
-                    BgraToYuv420p<false>(bgra + offset * 4, bgraStride, y + offset, yStride, u + offset / 2, v + offset / 2);
+                    BgraToYuv420p<false, T>(bgra + offset * 4, bgraStride, y + offset, yStride, u + offset / 2, v + offset / 2);
                 }
                 y += 2 * yStride;
                 u += uStride;
@@ -94,14 +102,41 @@ namespace Simd
             }
         }
 
-        void BgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+        template <class T> void BgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride))
-                BgraToYuv420p<true>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+                BgraToYuv420p<true, T>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
             else
-                BgraToYuv420p<false>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+                BgraToYuv420p<false, T>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgraToYuv420p<Base::Bt601>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgraToYuv420p<Base::Bt601>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgraToYuv420p<Base::Bt709>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgraToYuv420p<Base::Bt2020>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: BgraToYuv420p<Base::Bt601Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: BgraToYuv420p<Base::Bt709Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: BgraToYuv420p<Base::Bt2020Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            default: assert(0);
+            }
+        }
+
+        void RgbaToYuv420p(const uint8_t * rgba, size_t width, size_t height, size_t rgbaStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgraToYuv420p<Base::Rgb<Base::Bt601>>(rgba, width, height, rgbaStride, y, yStride, u, uStride, v, vStride);
         }
 
         SIMD_INLINE uint16x8_t Average(uint8x16_t value)
@@ -109,27 +144,27 @@ namespace Simd
             return vshrq_n_u16(vpadalq_u8(K16_0001, value), 1);
         }
 
-        template <bool align> SIMD_INLINE void BgraToYuv422p(const uint8_t * bgra, uint8_t * y, uint8_t * u, uint8_t * v)
+        template <bool align, class T = Base::Bt601> SIMD_INLINE void BgraToYuv422p(const uint8_t * bgra, uint8_t * y, uint8_t * u, uint8_t * v)
         {
             uint8x16x4_t bgra0 = Load4<align>(bgra);
-            Store<align>(y + 0, BgrToY(bgra0.val[0], bgra0.val[1], bgra0.val[2]));
+            Store<align>(y + 0, BgrToY<T>(bgra0.val[0], bgra0.val[1], bgra0.val[2]));
 
             uint16x8_t b0 = Average(bgra0.val[0]);
             uint16x8_t g0 = Average(bgra0.val[1]);
             uint16x8_t r0 = Average(bgra0.val[2]);
 
             uint8x16x4_t bgra1 = Load4<align>(bgra + QA);
-            Store<align>(y + A, BgrToY(bgra1.val[0], bgra1.val[1], bgra1.val[2]));
+            Store<align>(y + A, BgrToY<T>(bgra1.val[0], bgra1.val[1], bgra1.val[2]));
 
             uint16x8_t b1 = Average(bgra1.val[0]);
             uint16x8_t g1 = Average(bgra1.val[1]);
             uint16x8_t r1 = Average(bgra1.val[2]);
 
-            Store<align>(u, PackSaturatedI16(BgrToU(b0, g0, r0), BgrToU(b1, g1, r1)));
-            Store<align>(v, PackSaturatedI16(BgrToV(b0, g0, r0), BgrToV(b1, g1, r1)));
+            Store<align>(u, PackSaturatedI16(BgrToU<T>(b0, g0, r0), BgrToU<T>(b1, g1, r1)));
+            Store<align>(v, PackSaturatedI16(BgrToV<T>(b0, g0, r0), BgrToV<T>(b1, g1, r1)));
         }
 
-        template <bool align> void BgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+        template <bool align, class T = Base::Bt601> void BgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             assert((width % 2 == 0) && (width >= DA));
@@ -144,11 +179,11 @@ namespace Simd
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t colUV = 0, colY = 0, colBgra = 0; colY < alignedWidth; colY += DA, colUV += A, colBgra += A8)
-                    BgraToYuv422p<align>(bgra + colBgra, y + colY, u + colUV, v + colUV);
+                    BgraToYuv422p<align, T>(bgra + colBgra, y + colY, u + colUV, v + colUV);
                 if (width != alignedWidth)
                 {
                     size_t offset = width - DA;
-                    BgraToYuv422p<false>(bgra + offset * 4, y + offset, u + offset / 2, v + offset / 2);
+                    BgraToYuv422p<false, T>(bgra + offset * 4, y + offset, u + offset / 2, v + offset / 2);
                 }
                 y += yStride;
                 u += uStride;
@@ -157,25 +192,52 @@ namespace Simd
             }
         }
 
-        void BgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+        template <class T> void BgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride))
-                BgraToYuv422p<true>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+                BgraToYuv422p<true, T>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
             else
-                BgraToYuv422p<false>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+                BgraToYuv422p<false, T>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgraToYuv422p<Base::Bt601>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgraToYuv422pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgraToYuv422p<Base::Bt601>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgraToYuv422p<Base::Bt709>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgraToYuv422p<Base::Bt2020>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: BgraToYuv422p<Base::Bt601Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: BgraToYuv422p<Base::Bt709Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: BgraToYuv422p<Base::Bt2020Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            default: assert(0);
+            }
         }
 
-        template <bool align> SIMD_INLINE void BgraToYuv444p(const uint8_t * bgra, uint8_t * y, uint8_t * u, uint8_t * v)
+        void RgbaToYuv422p(const uint8_t * rgba, size_t width, size_t height, size_t rgbaStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgraToYuv422p<Base::Rgb<Base::Bt601>>(rgba, width, height, rgbaStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        template <bool align, class T = Base::Bt601> SIMD_INLINE void BgraToYuv444p(const uint8_t * bgra, uint8_t * y, uint8_t * u, uint8_t * v)
         {
             uint8x16x4_t _bgra = Load4<align>(bgra);
-            Store<align>(y, BgrToY(_bgra.val[0], _bgra.val[1], _bgra.val[2]));
-            Store<align>(u, BgrToU(_bgra.val[0], _bgra.val[1], _bgra.val[2]));
-            Store<align>(v, BgrToV(_bgra.val[0], _bgra.val[1], _bgra.val[2]));
+            Store<align>(y, BgrToY<T>(_bgra.val[0], _bgra.val[1], _bgra.val[2]));
+            Store<align>(u, BgrToU<T>(_bgra.val[0], _bgra.val[1], _bgra.val[2]));
+            Store<align>(v, BgrToV<T>(_bgra.val[0], _bgra.val[1], _bgra.val[2]));
         }
 
-        template <bool align> void BgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+        template <bool align, class T = Base::Bt601> void BgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             assert(width >= A);
@@ -189,11 +251,11 @@ namespace Simd
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t col = 0, colBgra = 0; col < alignedWidth; col += A, colBgra += QA)
-                    BgraToYuv444p<align>(bgra + colBgra, y + col, u + col, v + col);
+                    BgraToYuv444p<align, T>(bgra + colBgra, y + col, u + col, v + col);
                 if (width != alignedWidth)
                 {
                     size_t offset = width - A;
-                    BgraToYuv444p<false>(bgra + offset * 4, y + offset, u + offset, v + offset);
+                    BgraToYuv444p<false, T>(bgra + offset * 4, y + offset, u + offset, v + offset);
                 }
                 y += yStride;
                 u += uStride;
@@ -202,14 +264,41 @@ namespace Simd
             }
         }
 
-        void BgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+        template <class T> void BgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
             uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride))
-                BgraToYuv444p<true>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+                BgraToYuv444p<true, T>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
             else
-                BgraToYuv444p<false>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+                BgraToYuv444p<false, T>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgraToYuv444p<Base::Bt601>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgraToYuv444pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgraToYuv444p<Base::Bt601>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgraToYuv444p<Base::Bt709>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgraToYuv444p<Base::Bt2020>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: BgraToYuv444p<Base::Bt601Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: BgraToYuv444p<Base::Bt709Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: BgraToYuv444p<Base::Bt2020Full>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            default: assert(0);
+            }
+        }
+
+        void RgbaToYuv444p(const uint8_t * rgba, size_t width, size_t height, size_t rgbaStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            BgraToYuv444p<Base::Rgb<Base::Bt601>>(rgba, width, height, rgbaStride, y, yStride, u, uStride, v, vStride);
         }
 
         template <bool align> SIMD_INLINE void BgraToYuva420p(const uint8_t * bgra0, size_t bgraStride, uint8_t * y0, size_t yStride, uint8_t * u, uint8_t * v, uint8_t * a0, size_t aStride)
@@ -284,6 +373,86 @@ namespace Simd
             else
                 BgraToYuva420p<false>(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
         }
+
+        template <bool align, bool nv21, class T> SIMD_INLINE void BgraToNv12(const uint8_t * bgra0, size_t bgraStride, uint8_t * y0, size_t yStride, uint8_t * uv)
+        {
+            uint8x16_t u, v;
+            BgraToYuv420p<align, T>(bgra0, bgraStride, y0, yStride, u, v);
+            StoreUv<align, nv21>(uv, u, v);
+        }
+
+        template <bool align, bool nv21, class T> void BgraToNv12(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * uv, size_t uvStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
+            if (align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride));
+                assert(Aligned(bgra) && Aligned(bgraStride));
+            }
+
+            size_t alignedWidth = AlignLo(width, DA);
+            const size_t A8 = A * 8;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0, colBgra = 0; colY < alignedWidth; colY += DA, colBgra += A8)
+                    BgraToNv12<align, nv21, T>(bgra + colBgra, bgraStride, y + colY, yStride, uv + colY);
+                if (width != alignedWidth)
+                {
+                    size_t offset = width - DA;
+                    BgraToNv12<false, nv21, T>(bgra + offset * 4, bgraStride, y + offset, yStride, uv + offset);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                bgra += 2 * bgraStride;
+            }
+        }
+
+        template <bool nv21, class T> void BgraToNv12(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(bgra) && Aligned(bgraStride))
+                BgraToNv12<true, nv21, T>(bgra, width, height, bgraStride, y, yStride, uv, uvStride);
+            else
+                BgraToNv12<false, nv21, T>(bgra, width, height, bgraStride, y, yStride, uv, uvStride);
+        }
+
+        void BgraToNv12(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride)
+        {
+            BgraToNv12<false, Base::Bt601>(bgra, width, height, bgraStride, y, yStride, uv, uvStride);
+        }
+
+        void BgraToNv12V2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgraToNv12<false, Base::Bt601>(bgra, width, height, bgraStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt709: BgraToNv12<false, Base::Bt709>(bgra, width, height, bgraStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt2020: BgraToNv12<false, Base::Bt2020>(bgra, width, height, bgraStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt601Full: BgraToNv12<false, Base::Bt601Full>(bgra, width, height, bgraStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt709Full: BgraToNv12<false, Base::Bt709Full>(bgra, width, height, bgraStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt2020Full: BgraToNv12<false, Base::Bt2020Full>(bgra, width, height, bgraStride, y, yStride, uv, uvStride); break;
+            default: assert(0);
+            }
+        }
+
+        void BgraToNv21(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * vu, size_t vuStride)
+        {
+            BgraToNv12<true, Base::Bt601>(bgra, width, height, bgraStride, y, yStride, vu, vuStride);
+        }
+
+        void BgraToNv21V2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * vu, size_t vuStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgraToNv12<true, Base::Bt601>(bgra, width, height, bgraStride, y, yStride, vu, vuStride); break;
+            case SimdYuvBt709: BgraToNv12<true, Base::Bt709>(bgra, width, height, bgraStride, y, yStride, vu, vuStride); break;
+            case SimdYuvBt2020: BgraToNv12<true, Base::Bt2020>(bgra, width, height, bgraStride, y, yStride, vu, vuStride); break;
+            case SimdYuvBt601Full: BgraToNv12<true, Base::Bt601Full>(bgra, width, height, bgraStride, y, yStride, vu, vuStride); break;
+            case SimdYuvBt709Full: BgraToNv12<true, Base::Bt709Full>(bgra, width, height, bgraStride, y, yStride, vu, vuStride); break;
+            case SimdYuvBt2020Full: BgraToNv12<true, Base::Bt2020Full>(bgra, width, height, bgraStride, y, yStride, vu, vuStride); break;
+            default: assert(0);
+            }
+        }
     }
 #endif// SIMD_NEON_ENABLE
 }
@@ -289,6 +289,209 @@ namespace Simd
             else
                 EdgeBackgroundShiftRangeMasked<false>(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
         }
+
+        template <bool align> SIMD_INLINE void EdgeBackgroundPackedInit(const uint8_t * value, uint8_t * model)
+        {
+            uint8x16x2_t _model;
+            _model.val[0] = Load<align>(value);
+            _model.val[1] = K8_00;
+            Store2<align>(model, _model);
+        }
+
+        template <bool align> void EdgeBackgroundPackedInit(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
+        {
+            assert(width >= A);
+            if (align)
+                assert(Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride));
+
+            size_t alignedWidth = AlignLo(width, A);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < alignedWidth; col += A)
+                    EdgeBackgroundPackedInit<align>(value + col, model + 2 * col);
+                if (alignedWidth != width)
+                    EdgeBackgroundPackedInit<false>(value + width - A, model + 2 * (width - A));
+                value += valueStride;
+                model += modelStride;
+            }
+        }
+
+        void EdgeBackgroundPackedInit(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
+        {
+            if (Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride))
+                EdgeBackgroundPackedInit<true>(value, valueStride, width, height, model, modelStride);
+            else
+                EdgeBackgroundPackedInit<false>(value, valueStride, width, height, model, modelStride);
+        }
+
+        template <bool align, bool grow, bool increment, bool adjust> SIMD_INLINE void EdgeBackgroundPackedUpdate(const uint8_t * value, uint8_t * model,
+            const uint8x16_t & threshold, const uint8x16_t & mask)
+        {
+            const uint8x16_t _value = Load<align>(value);
+            uint8x16x2_t _model = Load2<align>(model);
+            if (grow)
+                _model.val[0] = vqaddq_u8(_model.val[0], vandq_u8(mask, vqsubq_u8(_value, _model.val[0])));
+            const uint8x16_t one = vandq_u8(mask, K8_01);
+            if (increment)
+                _model.val[1] = vqaddq_u8(_model.val[1], vandq_u8(one, vcgtq_u8(_value, _model.val[0])));
+            if (adjust)
+            {
+                _model.val[0] = AdjustEdge(_model.val[1], _model.val[0], one, threshold);
+                _model.val[1] = vbicq_u8(_model.val[1], mask);
+            }
+            Store2<align>(model, _model);
+        }
+
+        template <bool align, bool grow, bool increment, bool adjust> void EdgeBackgroundPackedUpdate(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * model, size_t modelStride, uint8_t threshold)
+        {
+            assert(width >= A);
+            if (align)
+                assert(Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride));
+
+            const uint8x16_t _threshold = vld1q_dup_u8(&threshold);
+            size_t alignedWidth = AlignLo(width, A);
+            uint8x16_t tailMask = ShiftLeft(K8_FF, A - width + alignedWidth);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < alignedWidth; col += A)
+                    EdgeBackgroundPackedUpdate<align, grow, increment, adjust>(value + col, model + 2 * col, _threshold, K8_FF);
+                if (alignedWidth != width)
+                    EdgeBackgroundPackedUpdate<false, grow, increment, adjust>(value + width - A, model + 2 * (width - A), _threshold, tailMask);
+                value += valueStride;
+                model += modelStride;
+            }
+        }
+
+        typedef void(*EdgeBackgroundPackedUpdatePtr)(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * model, size_t modelStride, uint8_t threshold);
+
+        template <bool align, bool grow, bool increment> EdgeBackgroundPackedUpdatePtr GetEdgeBackgroundPackedUpdate(int flags)
+        {
+            if (flags & SimdBackgroundUpdateAdjustRange)
+                return EdgeBackgroundPackedUpdate<align, grow, increment, true>;
+            else
+                return EdgeBackgroundPackedUpdate<align, grow, increment, false>;
+        }
+
+        template <bool align, bool grow> EdgeBackgroundPackedUpdatePtr GetEdgeBackgroundPackedUpdate(int flags)
+        {
+            if (flags & SimdBackgroundUpdateIncrementCount)
+                return GetEdgeBackgroundPackedUpdate<align, grow, true>(flags);
+            else
+                return GetEdgeBackgroundPackedUpdate<align, grow, false>(flags);
+        }
+
+        template <bool align> EdgeBackgroundPackedUpdatePtr GetEdgeBackgroundPackedUpdate(int flags)
+        {
+            if (flags & SimdBackgroundUpdateGrowRange)
+                return GetEdgeBackgroundPackedUpdate<align, true>(flags);
+            else
+                return GetEdgeBackgroundPackedUpdate<align, false>(flags);
+        }
+
+        void EdgeBackgroundPackedUpdate(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * model, size_t modelStride, uint8_t threshold, int flags)
+        {
+            if ((flags & (SimdBackgroundUpdateGrowRange | SimdBackgroundUpdateIncrementCount | SimdBackgroundUpdateAdjustRange)) == 0)
+                return;
+            EdgeBackgroundPackedUpdatePtr edgeBackgroundPackedUpdate;
+            if (Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride))
+                edgeBackgroundPackedUpdate = GetEdgeBackgroundPackedUpdate<true>(flags);
+            else
+                edgeBackgroundPackedUpdate = GetEdgeBackgroundPackedUpdate<false>(flags);
+            edgeBackgroundPackedUpdate(value, valueStride, width, height, model, modelStride, threshold);
+        }
+
+        SIMD_INLINE void EdgeBackgroundPackedGrowRangeSlow(uint8x16x2_t & model, const uint8x16_t & value, const uint8x16_t & mask, const uint8x16_t & threshold)
+        {
+            model.val[0] = vqaddq_u8(model.val[0], vandq_u8(vandq_u8(mask, K8_01), vcgtq_u8(value, model.val[0])));
+        }
+
+        SIMD_INLINE void EdgeBackgroundPackedShiftRange(uint8x16x2_t & model, const uint8x16_t & value, const uint8x16_t & mask, const uint8x16_t & threshold)
+        {
+            model.val[0] = vbslq_u8(mask, value, model.val[0]);
+        }
+
+        SIMD_INLINE void EdgeBackgroundPackedAdjustRangeMasked(uint8x16x2_t & model, const uint8x16_t & value, const uint8x16_t & mask, const uint8x16_t & threshold)
+        {
+            const uint8x16_t one = vandq_u8(vandq_u8(mask, vtstq_u8(value, value)), K8_01);
+            model.val[0] = AdjustEdge(model.val[1], model.val[0], one, threshold);
+            model.val[1] = vbicq_u8(model.val[1], mask);
+        }
+
+        typedef void(*EdgeBackgroundPackedKernelPtr)(uint8x16x2_t & model, const uint8x16_t & value, const uint8x16_t & mask, const uint8x16_t & threshold);
+
+        template <EdgeBackgroundPackedKernelPtr kernel, bool align, bool masked> SIMD_INLINE void EdgeBackgroundPackedApply(const uint8_t * value,
+            const uint8_t * mask, uint8_t * model, const uint8x16_t & threshold, const uint8x16_t & tailMask)
+        {
+            const uint8x16_t _value = Load<align>(value);
+            uint8x16x2_t _model = Load2<align>(model);
+            if (masked)
+            {
+                const uint8x16_t _mask = Load<align>(mask);
+                kernel(_model, _value, vandq_u8(tailMask, vtstq_u8(_mask, _mask)), threshold);
+            }
+            else
+                kernel(_model, _value, tailMask, threshold);
+            Store2<align>(model, _model);
+        }
+
+        template <EdgeBackgroundPackedKernelPtr kernel, bool align, bool masked> void EdgeBackgroundPackedApply(const uint8_t * value, size_t valueStride,
+            size_t width, size_t height, uint8_t * model, size_t modelStride, uint8_t threshold, const uint8_t * mask, size_t maskStride)
+        {
+            assert(width >= A);
+            if (align)
+                assert(Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride) && (!masked || (Aligned(mask) && Aligned(maskStride))));
+
+            const uint8x16_t _threshold = vld1q_dup_u8(&threshold);
+            size_t alignedWidth = AlignLo(width, A);
+            uint8x16_t tailMask = ShiftLeft(K8_FF, A - width + alignedWidth);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < alignedWidth; col += A)
+                    EdgeBackgroundPackedApply<kernel, align, masked>(value + col, mask + col, model + 2 * col, _threshold, K8_FF);
+                if (alignedWidth != width)
+                    EdgeBackgroundPackedApply<kernel, false, masked>(value + width - A, mask + width - A, model + 2 * (width - A), _threshold, tailMask);
+                value += valueStride;
+                model += modelStride;
+                mask += maskStride;
+            }
+        }
+
+        void EdgeBackgroundPackedGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
+        {
+            if (Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride))
+                EdgeBackgroundPackedApply<EdgeBackgroundPackedGrowRangeSlow, true, false>(value, valueStride, width, height, model, modelStride, 0, value, valueStride);
+            else
+                EdgeBackgroundPackedApply<EdgeBackgroundPackedGrowRangeSlow, false, false>(value, valueStride, width, height, model, modelStride, 0, value, valueStride);
+        }
+
+        void EdgeBackgroundPackedAdjustRangeMasked(uint8_t * model, size_t modelStride, size_t width, size_t height,
+            uint8_t threshold, const uint8_t * mask, size_t maskStride)
+        {
+            if (Aligned(model) && Aligned(modelStride) && Aligned(mask) && Aligned(maskStride))
+                EdgeBackgroundPackedApply<EdgeBackgroundPackedAdjustRangeMasked, true, false>(mask, maskStride, width, height, model, modelStride, threshold, mask, maskStride);
+            else
+                EdgeBackgroundPackedApply<EdgeBackgroundPackedAdjustRangeMasked, false, false>(mask, maskStride, width, height, model, modelStride, threshold, mask, maskStride);
+        }
+
+        void EdgeBackgroundPackedShiftRange(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride)
+        {
+            if (Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride))
+                EdgeBackgroundPackedApply<EdgeBackgroundPackedShiftRange, true, false>(value, valueStride, width, height, model, modelStride, 0, value, valueStride);
+            else
+                EdgeBackgroundPackedApply<EdgeBackgroundPackedShiftRange, false, false>(value, valueStride, width, height, model, modelStride, 0, value, valueStride);
+        }
+
+        void EdgeBackgroundPackedShiftRangeMasked(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+            uint8_t * model, size_t modelStride, const uint8_t * mask, size_t maskStride)
+        {
+            if (Aligned(value) && Aligned(valueStride) && Aligned(model) && Aligned(modelStride) && Aligned(mask) && Aligned(maskStride))
+                EdgeBackgroundPackedApply<EdgeBackgroundPackedShiftRange, true, true>(value, valueStride, width, height, model, modelStride, 0, mask, maskStride);
+            else
+                EdgeBackgroundPackedApply<EdgeBackgroundPackedShiftRange, false, true>(value, valueStride, width, height, model, modelStride, 0, mask, maskStride);
+        }
     }
 #endif// SIMD_NEON_ENABLE
 }
@@ -0,0 +1,115 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdLoad.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        SIMD_INLINE uint16x8_t DivideBy255(uint16x8_t value)
+        {
+            uint32x4_t lo = vmull_u16(vget_low_u16(value), vdup_n_u16(0x8081));
+            uint32x4_t hi = vmull_u16(vget_high_u16(value), vdup_n_u16(0x8081));
+            return vshrq_n_u16(vcombine_u16(vshrn_n_u32(lo, 16), vshrn_n_u32(hi, 16)), 7);
+        }
+
+        SIMD_INLINE void HueToBgr16(uint16x8_t hue, uint16x8_t min, uint16x8_t max, uint16x8_t bgr[3])
+        {
+            uint16x8_t hue6 = vmulq_u16(hue, K16_0006);
+            uint16x8_t sector = DivideBy255(hue6);
+            uint16x8_t delta = DivideBy255(vmulq_u16(vsubq_u16(max, min), vsubq_u16(hue6, vmulq_u16(sector, K16_00FF))));
+            uint16x8_t rising = vaddq_u16(min, delta);
+            uint16x8_t falling = vsubq_u16(max, delta);
+            uint16x8_t s0 = vorrq_u16(vceqq_u16(sector, K16_0000), vceqq_u16(sector, K16_0006));
+            uint16x8_t s1 = vceqq_u16(sector, K16_0001);
+            uint16x8_t s2 = vceqq_u16(sector, K16_0002);
+            uint16x8_t s3 = vceqq_u16(sector, K16_0003);
+            uint16x8_t s4 = vceqq_u16(sector, K16_0004);
+            uint16x8_t s5 = vceqq_u16(sector, K16_0005);
+            bgr[0] = vbslq_u16(s5, falling, vbslq_u16(vorrq_u16(s3, s4), max, vbslq_u16(s2, rising, min)));
+            bgr[1] = vbslq_u16(s3, falling, vbslq_u16(vorrq_u16(s1, s2), max, vbslq_u16(s0, rising, min)));
+            bgr[2] = vbslq_u16(s4, rising, vbslq_u16(s1, falling, vbslq_u16(vorrq_u16(s0, s5), max, min)));
+        }
+
+        template<bool hsl> SIMD_INLINE void HsxToBgr(uint8x8_t hue, uint8x8_t saturation, uint8x8_t third, uint8x8_t bgr[3])
+        {
+            uint16x8_t _hue = vmovl_u8(hue), _saturation = vmovl_u8(saturation), max = vmovl_u8(third), _bgr[3];
+            if (hsl)
+            {
+                uint16x8_t lightness = max;
+                uint16x8_t dark = DivideBy255(vmulq_u16(lightness, vaddq_u16(K16_00FF, _saturation)));
+                uint16x8_t light = DivideBy255(vaddq_u16(vmulq_u16(vsubq_u16(K16_00FF, lightness), _saturation), vmulq_u16(lightness, K16_00FF)));
+                max = vbslq_u16(vcgtq_u16(lightness, K16_0080), light, dark);
+            }
+            uint16x8_t min = DivideBy255(vmulq_u16(vsubq_u16(K16_00FF, _saturation), max));
+            HueToBgr16(_hue, min, max, _bgr);
+            bgr[0] = vmovn_u16(_bgr[0]);
+            bgr[1] = vmovn_u16(_bgr[1]);
+            bgr[2] = vmovn_u16(_bgr[2]);
+        }
+
+        template<bool hsl> SIMD_INLINE void HsxToBgr(const uint8_t * hsx, uint8_t * bgr)
+        {
+            uint8x16x3_t _hsx = Load3<false>(hsx), _bgr;
+            uint8x8_t lo[3], hi[3];
+            HsxToBgr<hsl>(vget_low_u8(_hsx.val[0]), vget_low_u8(_hsx.val[1]), vget_low_u8(_hsx.val[2]), lo);
+            HsxToBgr<hsl>(vget_high_u8(_hsx.val[0]), vget_high_u8(_hsx.val[1]), vget_high_u8(_hsx.val[2]), hi);
+            _bgr.val[0] = vcombine_u8(lo[0], hi[0]);
+            _bgr.val[1] = vcombine_u8(lo[1], hi[1]);
+            _bgr.val[2] = vcombine_u8(lo[2], hi[2]);
+            Store3<false>(bgr, _bgr);
+        }
+
+        template<bool hsl> void HsxToBgr(const uint8_t * hsx, size_t width, size_t height, size_t hsxStride, uint8_t * bgr, size_t bgrStride)
+        {
+            assert(width >= A);
+
+            size_t widthA = AlignLo(width, A), tail = (width - A) * 3;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA * 3; col += A * 3)
+                    HsxToBgr<hsl>(hsx + col, bgr + col);
+                if (widthA < width)
+                    HsxToBgr<hsl>(hsx + tail, bgr + tail);
+                hsx += hsxStride;
+                bgr += bgrStride;
+            }
+        }
+
+        void HslToBgr(const uint8_t * hsl, size_t width, size_t height, size_t hslStride, uint8_t * bgr, size_t bgrStride)
+        {
+            HsxToBgr<true>(hsl, width, height, hslStride, bgr, bgrStride);
+        }
+
+        void HsvToBgr(const uint8_t * hsv, size_t width, size_t height, size_t hsvStride, uint8_t * bgr, size_t bgrStride)
+        {
+            HsxToBgr<false>(hsv, width, height, hsvStride, bgr, bgrStride);
+        }
+    }
+#endif// SIMD_NEON_ENABLE
+}
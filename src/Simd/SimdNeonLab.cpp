@@ -0,0 +1,260 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdLoad.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdLab.h"
+
+namespace Simd
+{
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        SIMD_INLINE float32x4_t LabCbrt(float32x4_t x)
+        {
+            float32x4_t k = vdupq_n_f32(1.0f / 3.0f);
+            int32x4_t i = vcvtq_s32_f32(vmulq_f32(vcvtq_f32_s32(vreinterpretq_s32_f32(x)), k));
+            float32x4_t y = vreinterpretq_f32_s32(vaddq_s32(i, vdupq_n_s32(Base::LAB_CBRT_MAGIC)));
+            for (int n = 0; n < 3; ++n)
+                y = vmulq_f32(vaddq_f32(vaddq_f32(y, y), Div<SIMD_NEON_RCP_ITER>(x, vmulq_f32(y, y))), k);
+            return y;
+        }
+
+        SIMD_INLINE float32x4_t LabF(float32x4_t t)
+        {
+            float32x4_t linear = vaddq_f32(vmulq_f32(t, vdupq_n_f32(Base::LAB_SLOPE)), vdupq_n_f32(Base::LAB_BIAS));
+            return vbslq_f32(vcgtq_f32(t, vdupq_n_f32(Base::LAB_T_THRESHOLD)), LabCbrt(t), linear);
+        }
+
+        SIMD_INLINE float32x4_t LabFInv(float32x4_t f)
+        {
+            float32x4_t linear = vmulq_f32(vsubq_f32(f, vdupq_n_f32(Base::LAB_BIAS)), vdupq_n_f32(Base::LAB_SLOPE_INV));
+            return vbslq_f32(vcgtq_f32(f, vdupq_n_f32(Base::LAB_F_THRESHOLD)), vmulq_f32(vmulq_f32(f, f), f), linear);
+        }
+
+        SIMD_INLINE float32x4_t Combine(float32x4_t a, float32x4_t b, float32x4_t c, float ka, float kb, float kc)
+        {
+            return vaddq_f32(vaddq_f32(vmulq_f32(a, vdupq_n_f32(ka)), vmulq_f32(b, vdupq_n_f32(kb))), vmulq_f32(c, vdupq_n_f32(kc)));
+        }
+
+        SIMD_INLINE float32x4_t LabDecode(const uint8_t * bgr, const float * decode)
+        {
+            float values[4] = { decode[bgr[0]], decode[bgr[3]], decode[bgr[6]], decode[bgr[9]] };
+            return vld1q_f32(values);
+        }
+
+        SIMD_INLINE float32x4x3_t BgrToLab(const uint8_t * bgr, const float * decode)
+        {
+            float32x4_t b = LabDecode(bgr + 0, decode), g = LabDecode(bgr + 1, decode), r = LabDecode(bgr + 2, decode);
+            float32x4_t fx = LabF(Combine(r, g, b, Base::LAB_X_R, Base::LAB_X_G, Base::LAB_X_B));
+            float32x4_t fy = LabF(Combine(r, g, b, Base::LAB_Y_R, Base::LAB_Y_G, Base::LAB_Y_B));
+            float32x4_t fz = LabF(Combine(r, g, b, Base::LAB_Z_R, Base::LAB_Z_G, Base::LAB_Z_B));
+            float32x4x3_t lab;
+            lab.val[0] = vsubq_f32(vmulq_f32(fy, vdupq_n_f32(Base::LAB_L_SCALE)), vdupq_n_f32(Base::LAB_L_SHIFT));
+            lab.val[1] = vmulq_f32(vsubq_f32(fx, fy), vdupq_n_f32(Base::LAB_A_SCALE));
+            lab.val[2] = vmulq_f32(vsubq_f32(fy, fz), vdupq_n_f32(Base::LAB_B_SCALE));
+            return lab;
+        }
+
+        SIMD_INLINE uint32x4_t RoundU32(float32x4_t value)
+        {
+            return vcvtq_u32_f32(vaddq_f32(vmaxq_f32(value, vdupq_n_f32(0.0f)), vdupq_n_f32(0.5f)));
+        }
+
+        SIMD_INLINE uint32x4_t LabEncode(float32x4_t value, const float * encode)
+        {
+            value = vmulq_f32(vminq_f32(vmaxq_f32(value, vdupq_n_f32(0.0f)), vdupq_n_f32(1.0f)), vdupq_n_f32(float(Base::LAB_GAMMA_SIZE)));
+            int32x4_t index = vminq_s32(vcvtq_s32_f32(value), vdupq_n_s32(Base::LAB_GAMMA_SIZE - 1));
+            int32_t i[4];
+            vst1q_s32(i, index);
+            float lo[4] = { encode[i[0]], encode[i[1]], encode[i[2]], encode[i[3]] };
+            float hi[4] = { encode[i[0] + 1], encode[i[1] + 1], encode[i[2] + 1], encode[i[3] + 1] };
+            float32x4_t _lo = vld1q_f32(lo), _hi = vld1q_f32(hi);
+            return RoundU32(vaddq_f32(_lo, vmulq_f32(vsubq_f32(_hi, _lo), vsubq_f32(value, vcvtq_f32_s32(index)))));
+        }
+
+        SIMD_INLINE void LabToBgr(float32x4_t l, float32x4_t a, float32x4_t b, const float * encode, uint32x4_t bgr[3])
+        {
+            float32x4_t fy = vmulq_f32(vaddq_f32(l, vdupq_n_f32(Base::LAB_L_SHIFT)), vdupq_n_f32(Base::LAB_L_SCALE_INV));
+            float32x4_t fx = vaddq_f32(fy, vmulq_f32(a, vdupq_n_f32(Base::LAB_A_SCALE_INV)));
+            float32x4_t fz = vsubq_f32(fy, vmulq_f32(b, vdupq_n_f32(Base::LAB_B_SCALE_INV)));
+            float32x4_t x = LabFInv(fx), y = LabFInv(fy), z = LabFInv(fz);
+            bgr[0] = LabEncode(Combine(x, y, z, Base::LAB_B_X, Base::LAB_B_Y, Base::LAB_B_Z), encode);
+            bgr[1] = LabEncode(Combine(x, y, z, Base::LAB_G_X, Base::LAB_G_Y, Base::LAB_G_Z), encode);
+            bgr[2] = LabEncode(Combine(x, y, z, Base::LAB_R_X, Base::LAB_R_Y, Base::LAB_R_Z), encode);
+        }
+
+        SIMD_INLINE uint8x16_t PackU32ToU8(const uint32x4_t src[4])
+        {
+            uint16x8_t lo = vcombine_u16(vqmovn_u32(src[0]), vqmovn_u32(src[1]));
+            uint16x8_t hi = vcombine_u16(vqmovn_u32(src[2]), vqmovn_u32(src[3]));
+            return vcombine_u8(vqmovn_u16(lo), vqmovn_u16(hi));
+        }
+
+        template<int part> SIMD_INLINE float32x4_t LoadU8ToF32(uint8x16_t value)
+        {
+            return vcvtq_f32_u32(vmovl_u16(Half<part & 1>(vmovl_u8(Half<part >> 1>(value)))));
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void BgrToLab(const uint8_t * bgr, const float * decode, uint8_t * lab)
+        {
+            uint32x4_t l[4], a[4], b[4];
+            for (size_t i = 0; i < 4; ++i)
+            {
+                float32x4x3_t _lab = BgrToLab(bgr + i * 12, decode);
+                l[i] = RoundU32(vmulq_f32(_lab.val[0], vdupq_n_f32(Base::LAB_L_TO_8U)));
+                a[i] = RoundU32(vaddq_f32(_lab.val[1], vdupq_n_f32(Base::LAB_AB_SHIFT)));
+                b[i] = RoundU32(vaddq_f32(_lab.val[2], vdupq_n_f32(Base::LAB_AB_SHIFT)));
+            }
+            uint8x16x3_t _lab;
+            _lab.val[0] = PackU32ToU8(l);
+            _lab.val[1] = PackU32ToU8(a);
+            _lab.val[2] = PackU32ToU8(b);
+            Store3<false>(lab, _lab);
+        }
+
+        void BgrToLab(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * lab, size_t labStride)
+        {
+            assert(width >= A);
+
+            const float * decode = Base::GetLabGamma().decode;
+            size_t widthA = AlignLo(width, A), tail = (width - A) * 3;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA * 3; col += A * 3)
+                    BgrToLab(bgr + col, decode, lab + col);
+                if (widthA < width)
+                    BgrToLab(bgr + tail, decode, lab + tail);
+                bgr += bgrStride;
+                lab += labStride;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void BgrToLab32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * lab, size_t labStride)
+        {
+            assert(width >= F);
+
+            const float * decode = Base::GetLabGamma().decode;
+            size_t widthF = AlignLo(width, F), tail = (width - F) * 3;
+            for (size_t row = 0; row < height; ++row)
+            {
+                float * pLab = (float*)lab;
+                for (size_t col = 0; col < widthF * 3; col += F * 3)
+                    Store3<false>(pLab + col, BgrToLab(bgr + col, decode));
+                if (widthF < width)
+                    Store3<false>(pLab + tail, BgrToLab(bgr + tail, decode));
+                bgr += bgrStride;
+                lab += labStride;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        template<int part> SIMD_INLINE void LabToBgr(const uint8x16x3_t & lab, const float * encode, uint32x4_t blue[4], uint32x4_t green[4], uint32x4_t red[4])
+        {
+            float32x4_t l = vmulq_f32(LoadU8ToF32<part>(lab.val[0]), vdupq_n_f32(Base::LAB_8U_TO_L));
+            float32x4_t a = vsubq_f32(LoadU8ToF32<part>(lab.val[1]), vdupq_n_f32(Base::LAB_AB_SHIFT));
+            float32x4_t b = vsubq_f32(LoadU8ToF32<part>(lab.val[2]), vdupq_n_f32(Base::LAB_AB_SHIFT));
+            uint32x4_t bgr[3];
+            LabToBgr(l, a, b, encode, bgr);
+            blue[part] = bgr[0];
+            green[part] = bgr[1];
+            red[part] = bgr[2];
+        }
+
+        SIMD_INLINE void LabToBgr(const uint8_t * lab, const float * encode, uint8_t * bgr)
+        {
+            uint8x16x3_t _lab = Load3<false>(lab), _bgr;
+            uint32x4_t blue[4], green[4], red[4];
+            LabToBgr<0>(_lab, encode, blue, green, red);
+            LabToBgr<1>(_lab, encode, blue, green, red);
+            LabToBgr<2>(_lab, encode, blue, green, red);
+            LabToBgr<3>(_lab, encode, blue, green, red);
+            _bgr.val[0] = PackU32ToU8(blue);
+            _bgr.val[1] = PackU32ToU8(green);
+            _bgr.val[2] = PackU32ToU8(red);
+            Store3<false>(bgr, _bgr);
+        }
+
+        void LabToBgr(const uint8_t * lab, size_t width, size_t height, size_t labStride, uint8_t * bgr, size_t bgrStride)
+        {
+            assert(width >= A);
+
+            const float * encode = Base::GetLabGamma().encode;
+            size_t widthA = AlignLo(width, A), tail = (width - A) * 3;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA * 3; col += A * 3)
+                    LabToBgr(lab + col, encode, bgr + col);
+                if (widthA < width)
+                    LabToBgr(lab + tail, encode, bgr + tail);
+                lab += labStride;
+                bgr += bgrStride;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void Lab32fToBgr(const float * lab, const float * encode, uint8_t * bgr)
+        {
+            uint32x4_t blue[4], green[4], red[4], _bgr[3];
+            for (size_t i = 0; i < 4; ++i)
+            {
+                float32x4x3_t _lab = Load3<false>(lab + i * 12);
+                LabToBgr(_lab.val[0], _lab.val[1], _lab.val[2], encode, _bgr);
+                blue[i] = _bgr[0];
+                green[i] = _bgr[1];
+                red[i] = _bgr[2];
+            }
+            uint8x16x3_t dst;
+            dst.val[0] = PackU32ToU8(blue);
+            dst.val[1] = PackU32ToU8(green);
+            dst.val[2] = PackU32ToU8(red);
+            Store3<false>(bgr, dst);
+        }
+
+        void Lab32fToBgr(const uint8_t * lab, size_t width, size_t height, size_t labStride, uint8_t * bgr, size_t bgrStride)
+        {
+            assert(width >= A);
+
+            const float * encode = Base::GetLabGamma().encode;
+            size_t widthA = AlignLo(width, A), tail = (width - A) * 3;
+            for (size_t row = 0; row < height; ++row)
+            {
+                const float * pLab = (const float*)lab;
+                for (size_t col = 0; col < widthA * 3; col += A * 3)
+                    Lab32fToBgr(pLab + col, encode, bgr + col);
+                if (widthA < width)
+                    Lab32fToBgr(pLab + tail, encode, bgr + tail);
+                lab += labStride;
+                bgr += bgrStride;
+            }
+        }
+    }
+#endif// SIMD_NEON_ENABLE
+}
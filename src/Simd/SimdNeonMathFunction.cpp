@@ -0,0 +1,279 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdLoad.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdMathFunction.h"
+#include "Simd/SimdExp.h"
+#include "Simd/SimdPow.h"
+
+namespace Simd
+{
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        SIMD_INLINE float32x4_t Sign(float32x4_t value)
+        {
+            return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(value), vdupq_n_u32(0x80000000)));
+        }
+
+        SIMD_INLINE int32x4_t Round(float32x4_t value)
+        {
+            return vcvtq_s32_f32(vaddq_f32(value, Or(Sign(value), vdupq_n_f32(0.5f))));
+        }
+
+        class MathFast
+        {
+            Exp _exp;
+            Pow _pow;
+
+        public:
+            SIMD_INLINE MathFast()
+                : _exp(1.0f)
+            {
+            }
+
+            SIMD_INLINE float32x4_t Exponent(float32x4_t x)
+            {
+                return _exp.Exponent(x);
+            }
+
+            SIMD_INLINE float32x4_t Log(float32x4_t x)
+            {
+                return vmulq_f32(_pow.Log2(x), vdupq_n_f32(0.693147181f));
+            }
+
+            SIMD_INLINE float32x4_t Tanh(float32x4_t x)
+            {
+                x = vminq_f32(vmaxq_f32(x, vdupq_n_f32(-9.0f)), vdupq_n_f32(9.0f));
+                float32x4_t e = _exp.Exponent(vmulq_f32(x, vdupq_n_f32(-2.0f)));
+                return Div<1>(vsubq_f32(vdupq_n_f32(1.0f), e), vaddq_f32(vdupq_n_f32(1.0f), e));
+            }
+
+            SIMD_INLINE float32x4_t Erf(float32x4_t x)
+            {
+                float32x4_t a = vabsq_f32(x);
+                float32x4_t t = Reciprocal<1>(vmlaq_f32(vdupq_n_f32(1.0f), a, vdupq_n_f32(0.3275911f)));
+                float32x4_t p = vmlaq_f32(vdupq_n_f32(-1.453152027f), t, vdupq_n_f32(1.061405429f));
+                p = vmlaq_f32(vdupq_n_f32(1.421413741f), t, p);
+                p = vmlaq_f32(vdupq_n_f32(-0.284496736f), t, p);
+                p = vmlaq_f32(vdupq_n_f32(0.254829592f), t, p);
+                float32x4_t e = _exp.Exponent(vnegq_f32(vmulq_f32(a, a)));
+                float32x4_t r = vmlsq_f32(vdupq_n_f32(1.0f), vmulq_f32(p, t), e);
+                return Or(r, Sign(x));
+            }
+        };
+
+        class MathPrecise
+        {
+        public:
+            SIMD_INLINE float32x4_t Exponent(float32x4_t x)
+            {
+                x = vmaxq_f32(vminq_f32(x, vdupq_n_f32(88.37f)), vdupq_n_f32(-87.33654f));
+                int32x4_t n = Round(vmulq_f32(x, vdupq_n_f32(1.44269504f)));
+                float32x4_t fn = vcvtq_f32_s32(n);
+                x = vsubq_f32(x, vmulq_f32(fn, vdupq_n_f32(0.693359375f)));
+                x = vsubq_f32(x, vmulq_f32(fn, vdupq_n_f32(-2.12194440e-4f)));
+                float32x4_t p = vmlaq_f32(vdupq_n_f32(1.3981999507e-3f), x, vdupq_n_f32(1.9875691500e-4f));
+                p = vmlaq_f32(vdupq_n_f32(8.3334519073e-3f), x, p);
+                p = vmlaq_f32(vdupq_n_f32(4.1665795894e-2f), x, p);
+                p = vmlaq_f32(vdupq_n_f32(1.6666665459e-1f), x, p);
+                p = vmlaq_f32(vdupq_n_f32(5.0000001201e-1f), x, p);
+                p = vmlaq_f32(vaddq_f32(x, vdupq_n_f32(1.0f)), vmulq_f32(x, x), p);
+                return vmulq_f32(p, vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(n, vdupq_n_s32(127)), 23)));
+            }
+
+            SIMD_INLINE float32x4_t Log(float32x4_t x)
+            {
+                int32x4_t i = vreinterpretq_s32_f32(vmaxq_f32(x, vreinterpretq_f32_s32(vdupq_n_s32(0x00800000))));
+                float32x4_t e = vcvtq_f32_s32(vsubq_s32(vshrq_n_s32(i, 23), vdupq_n_s32(126)));
+                float32x4_t m = Or(vreinterpretq_f32_s32(vandq_s32(i, vdupq_n_s32(0x007FFFFF))), vdupq_n_f32(0.5f));
+                float32x4_t mask = vreinterpretq_f32_u32(vcltq_f32(m, vdupq_n_f32(0.707106781f)));
+                e = vsubq_f32(e, And(mask, vdupq_n_f32(1.0f)));
+                m = vaddq_f32(vsubq_f32(m, vdupq_n_f32(1.0f)), And(mask, m));
+                float32x4_t z = vmulq_f32(m, m);
+                float32x4_t p = vmlaq_f32(vdupq_n_f32(-1.1514610310e-1f), m, vdupq_n_f32(7.0376836292e-2f));
+                p = vmlaq_f32(vdupq_n_f32(1.1676998740e-1f), m, p);
+                p = vmlaq_f32(vdupq_n_f32(-1.2420140846e-1f), m, p);
+                p = vmlaq_f32(vdupq_n_f32(1.4249322787e-1f), m, p);
+                p = vmlaq_f32(vdupq_n_f32(-1.6668057665e-1f), m, p);
+                p = vmlaq_f32(vdupq_n_f32(2.0000714765e-1f), m, p);
+                p = vmlaq_f32(vdupq_n_f32(-2.4999993993e-1f), m, p);
+                p = vmlaq_f32(vdupq_n_f32(3.3333331174e-1f), m, p);
+                p = vmulq_f32(vmulq_f32(p, m), z);
+                p = vmlaq_f32(p, e, vdupq_n_f32(-2.12194440e-4f));
+                p = vmlaq_f32(p, z, vdupq_n_f32(-0.5f));
+                return vmlaq_f32(vaddq_f32(m, p), e, vdupq_n_f32(0.693359375f));
+            }
+
+            SIMD_INLINE float32x4_t Tanh(float32x4_t x)
+            {
+                float32x4_t a = vabsq_f32(x);
+                float32x4_t e = Exponent(vminq_f32(vaddq_f32(a, a), vdupq_n_f32(18.0f)));
+                float32x4_t large = vsubq_f32(vdupq_n_f32(1.0f), Div<2>(vdupq_n_f32(2.0f), vaddq_f32(e, vdupq_n_f32(1.0f))));
+                float32x4_t z = vmulq_f32(a, a);
+                float32x4_t p = vmlaq_f32(vdupq_n_f32(2.06390887954e-2f), z, vdupq_n_f32(-5.70498872745e-3f));
+                p = vmlaq_f32(vdupq_n_f32(-5.37397155531e-2f), z, p);
+                p = vmlaq_f32(vdupq_n_f32(1.33314422036e-1f), z, p);
+                p = vmlaq_f32(vdupq_n_f32(-3.33332819422e-1f), z, p);
+                float32x4_t small = vmlaq_f32(a, vmulq_f32(p, z), a);
+                return Or(vbslq_f32(vcgtq_f32(a, vdupq_n_f32(0.625f)), large, small), Sign(x));
+            }
+
+            SIMD_INLINE float32x4_t Erf(float32x4_t x)
+            {
+                float32x4_t a = vabsq_f32(x);
+                float32x4_t t = Reciprocal<2>(vmlaq_f32(vdupq_n_f32(1.0f), a, vdupq_n_f32(0.3275911f)));
+                float32x4_t p = vmlaq_f32(vdupq_n_f32(-1.453152027f), t, vdupq_n_f32(1.061405429f));
+                p = vmlaq_f32(vdupq_n_f32(1.421413741f), t, p);
+                p = vmlaq_f32(vdupq_n_f32(-0.284496736f), t, p);
+                p = vmlaq_f32(vdupq_n_f32(0.254829592f), t, p);
+                float32x4_t z = vmulq_f32(a, a);
+                float32x4_t large = vmlsq_f32(vdupq_n_f32(1.0f), vmulq_f32(p, t), Exponent(vnegq_f32(z)));
+                float32x4_t s = vmlaq_f32(vdupq_n_f32(5.223977e-3f), z, vdupq_n_f32(-8.548327e-4f));
+                s = vmlaq_f32(vdupq_n_f32(-2.686617e-2f), z, s);
+                s = vmlaq_f32(vdupq_n_f32(1.128379e-1f), z, s);
+                s = vmlaq_f32(vdupq_n_f32(-3.761264e-1f), z, s);
+                s = vmlaq_f32(vdupq_n_f32(1.128379167f), z, s);
+                float32x4_t small = vmulq_f32(s, a);
+                return Or(vbslq_f32(vcltq_f32(a, vdupq_n_f32(0.5f)), small, large), Sign(x));
+            }
+        };
+
+        template<SimdMathFunctionType type> struct MathFunction;
+
+        template<> struct MathFunction<SimdMathFunctionExp>
+        {
+            template<class M> static SIMD_INLINE float32x4_t Run(M & m, float32x4_t x, float32x4_t param)
+            {
+                return m.Exponent(x);
+            }
+        };
+
+        template<> struct MathFunction<SimdMathFunctionLog>
+        {
+            template<class M> static SIMD_INLINE float32x4_t Run(M & m, float32x4_t x, float32x4_t param)
+            {
+                return m.Log(x);
+            }
+        };
+
+        template<> struct MathFunction<SimdMathFunctionPow>
+        {
+            template<class M> static SIMD_INLINE float32x4_t Run(M & m, float32x4_t x, float32x4_t param)
+            {
+                return m.Exponent(vmulq_f32(m.Log(x), param));
+            }
+        };
+
+        template<> struct MathFunction<SimdMathFunctionSigmoid>
+        {
+            template<class M> static SIMD_INLINE float32x4_t Run(M & m, float32x4_t x, float32x4_t param)
+            {
+                return Reciprocal<2>(vaddq_f32(vdupq_n_f32(1.0f), m.Exponent(vnegq_f32(x))));
+            }
+        };
+
+        template<> struct MathFunction<SimdMathFunctionTanh>
+        {
+            template<class M> static SIMD_INLINE float32x4_t Run(M & m, float32x4_t x, float32x4_t param)
+            {
+                return m.Tanh(x);
+            }
+        };
+
+        template<> struct MathFunction<SimdMathFunctionGelu>
+        {
+            template<class M> static SIMD_INLINE float32x4_t Run(M & m, float32x4_t x, float32x4_t param)
+            {
+                float32x4_t erf = m.Erf(vmulq_f32(x, vdupq_n_f32(0.707106781f)));
+                return vmulq_f32(vmulq_f32(x, vdupq_n_f32(0.5f)), vaddq_f32(vdupq_n_f32(1.0f), erf));
+            }
+        };
+
+        template<> struct MathFunction<SimdMathFunctionErf>
+        {
+            template<class M> static SIMD_INLINE float32x4_t Run(M & m, float32x4_t x, float32x4_t param)
+            {
+                return m.Erf(x);
+            }
+        };
+
+        template<> struct MathFunction<SimdMathFunctionSwish>
+        {
+            template<class M> static SIMD_INLINE float32x4_t Run(M & m, float32x4_t x, float32x4_t param)
+            {
+                return Div<2>(x, vaddq_f32(vdupq_n_f32(1.0f), m.Exponent(vnegq_f32(vmulq_f32(param, x)))));
+            }
+        };
+
+        template<SimdMathFunctionType type, class M> void MathFunction32f(const float * src, size_t size, const float * params, float * dst)
+        {
+            M m;
+            float32x4_t param = vdupq_n_f32(params ? params[0] : 0.0f);
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+                Store<false>(dst + i, MathFunction<type>::Run(m, Load<false>(src + i), param));
+            if (i < size)
+            {
+                float tail[F] = { 1.0f, 1.0f, 1.0f, 1.0f };
+                for (size_t j = 0; i + j < size; ++j)
+                    tail[j] = src[i + j];
+                Store<false>(tail, MathFunction<type>::Run(m, Load<false>(tail), param));
+                for (size_t j = 0; i + j < size; ++j)
+                    dst[i + j] = tail[j];
+            }
+        }
+
+        template<class M> void MathFunction32f(const float * src, size_t size, SimdMathFunctionType type, const float * params, float * dst)
+        {
+            switch (type)
+            {
+            case SimdMathFunctionExp: MathFunction32f<SimdMathFunctionExp, M>(src, size, params, dst); break;
+            case SimdMathFunctionLog: MathFunction32f<SimdMathFunctionLog, M>(src, size, params, dst); break;
+            case SimdMathFunctionPow: MathFunction32f<SimdMathFunctionPow, M>(src, size, params, dst); break;
+            case SimdMathFunctionSigmoid: MathFunction32f<SimdMathFunctionSigmoid, M>(src, size, params, dst); break;
+            case SimdMathFunctionTanh: MathFunction32f<SimdMathFunctionTanh, M>(src, size, params, dst); break;
+            case SimdMathFunctionGelu: MathFunction32f<SimdMathFunctionGelu, M>(src, size, params, dst); break;
+            case SimdMathFunctionErf: MathFunction32f<SimdMathFunctionErf, M>(src, size, params, dst); break;
+            case SimdMathFunctionSwish: MathFunction32f<SimdMathFunctionSwish, M>(src, size, params, dst); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void MathFunction32f(const float * src, size_t size, SimdMathFunctionType type, const float * params, SimdMathAccuracyType accuracy, float * dst)
+        {
+            Base::MathFunction32fParallel(src, size, dst, [=](const float * src, size_t size, float * dst)
+            {
+                if (accuracy == SimdMathAccuracyFast)
+                    MathFunction32f<MathFast>(src, size, type, params, dst);
+                else
+                    MathFunction32f<MathPrecise>(src, size, type, params, dst);
+            });
+        }
+    }
+#endif// SIMD_NEON_ENABLE
+}
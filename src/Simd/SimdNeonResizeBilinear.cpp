@@ -95,13 +95,13 @@ namespace Simd
 
         }
 
-        template <size_t channelCount> void EstimateAlphaIndexX(size_t srcSize, size_t dstSize, int * indexes, uint8_t * alphas)
+        template <size_t channelCount> void EstimateAlphaIndexX(size_t srcSize, size_t dstSize, int * indexes, uint8_t * alphas, float site)
         {
             float scale = (float)srcSize / dstSize;
 
             for (size_t i = 0; i < dstSize; ++i)
             {
-                float alpha = (float)((i + 0.5)*scale - 0.5);
+                float alpha = (float)((i + (double)site)*scale - site);
                 ptrdiff_t index = (ptrdiff_t)::floor(alpha);
                 alpha -= index;
 
@@ -126,7 +126,7 @@ namespace Simd
             }
         }
 
-        void EstimateAlphaIndexX(int srcSize, int dstSize, Index * indexes, uint8_t * alphas, size_t & blockCount)
+        void EstimateAlphaIndexX(int srcSize, int dstSize, Index * indexes, uint8_t * alphas, size_t & blockCount, float site)
         {
             float scale = (float)srcSize / dstSize;
             int block = 0;
@@ -134,7 +134,7 @@ namespace Simd
             indexes[0].dst = 0;
             for (int dstIndex = 0; dstIndex < dstSize; ++dstIndex)
             {
-                float alpha = (float)((dstIndex + 0.5)*scale - 0.5);
+                float alpha = (float)((dstIndex + (double)site)*scale - site);
                 int srcIndex = (int)::floor(alpha);
                 alpha -= srcIndex;
 
@@ -246,7 +246,7 @@ namespace Simd
 
         template <size_t channelCount> void ResizeBilinear(
             const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
-            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
+            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, float siteX, size_t dstRowBeg, size_t dstRowEnd)
         {
             assert(dstWidth >= A);
 
@@ -260,15 +260,17 @@ namespace Simd
 
             Buffer buffer(bufferSize, dstWidth, dstHeight);
 
-            Base::EstimateAlphaIndex(srcHeight, dstHeight, buffer.iy, buffer.ay, 1);
+            Base::EstimateAlphaIndex(srcHeight, dstHeight, buffer.iy, buffer.ay, 1, 0.5f);
 
-            EstimateAlphaIndexX<channelCount>(srcWidth, dstWidth, buffer.ix, buffer.ax);
+            EstimateAlphaIndexX<channelCount>(srcWidth, dstWidth, buffer.ix, buffer.ax, siteX);
 
             ptrdiff_t previous = -2;
 
             uint16x8_t a[2];
 
-            for (size_t yDst = 0; yDst < dstHeight; yDst++, dst += dstStride)
+            dst += dstRowBeg*dstStride;
+
+            for (size_t yDst = dstRowBeg; yDst < dstRowEnd; yDst++, dst += dstStride)
             {
                 a[0] = vdupq_n_u16(Base::FRACTION_RANGE - buffer.ay[yDst]);
                 a[1] = vdupq_n_u16(buffer.ay[yDst]);
@@ -326,7 +328,7 @@ namespace Simd
 
         void ResizeBilinearGray(
             const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
-            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
+            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, float siteX, size_t dstRowBeg, size_t dstRowEnd)
         {
             assert(dstWidth >= A);
 
@@ -338,15 +340,17 @@ namespace Simd
 
             BufferG buffer(bufferWidth, blockCount, dstHeight);
 
-            Base::EstimateAlphaIndex(srcHeight, dstHeight, buffer.iy, buffer.ay, 1);
+            Base::EstimateAlphaIndex(srcHeight, dstHeight, buffer.iy, buffer.ay, 1, 0.5f);
 
-            EstimateAlphaIndexX((int)srcWidth, (int)dstWidth, buffer.ix, buffer.ax, blockCount);
+            EstimateAlphaIndexX((int)srcWidth, (int)dstWidth, buffer.ix, buffer.ax, blockCount, siteX);
 
             ptrdiff_t previous = -2;
 
             uint16x8_t a[2];
 
-            for (size_t yDst = 0; yDst < dstHeight; yDst++, dst += dstStride)
+            dst += dstRowBeg*dstStride;
+
+            for (size_t yDst = dstRowBeg; yDst < dstRowEnd; yDst++, dst += dstStride)
             {
                 a[0] = vdupq_n_u16(Base::FRACTION_RANGE - buffer.ay[yDst]);
                 a[1] = vdupq_n_u16(buffer.ay[yDst]);
@@ -383,31 +387,38 @@ namespace Simd
             }
         }
 
-        void ResizeBilinear(
+        void ResizeBilinearRows(
             const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
-            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
+            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount, float siteX, size_t dstRowBeg, size_t dstRowEnd)
         {
             switch (channelCount)
             {
             case 1:
                 if (srcWidth >= A && srcWidth < 4 * dstWidth)
-                    ResizeBilinearGray(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                    ResizeBilinearGray(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, siteX, dstRowBeg, dstRowEnd);
                 else
-                    ResizeBilinear<1>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                    ResizeBilinear<1>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, siteX, dstRowBeg, dstRowEnd);
                 break;
             case 2:
-                ResizeBilinear<2>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                ResizeBilinear<2>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, siteX, dstRowBeg, dstRowEnd);
                 break;
             case 3:
-                ResizeBilinear<3>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                ResizeBilinear<3>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, siteX, dstRowBeg, dstRowEnd);
                 break;
             case 4:
-                ResizeBilinear<4>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                ResizeBilinear<4>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, siteX, dstRowBeg, dstRowEnd);
                 break;
             default:
-                Base::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
+                Base::ResizeBilinearRows(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount, siteX, dstRowBeg, dstRowEnd);
             }
         }
+
+        void ResizeBilinear(
+            const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
+        {
+            ResizeBilinearRows(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount, 0.5f, 0, dstHeight);
+        }
     }
 #endif
 }
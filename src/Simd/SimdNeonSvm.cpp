@@ -24,6 +24,8 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
 #include "Simd/SimdExtract.h"
+#include "Simd/SimdSvm.h"
+#include "Simd/SimdNeon.h"
 
 namespace Simd
 {
@@ -86,6 +88,21 @@ namespace Simd
             for (; i < count; ++i)
                 *sum += buffer.sums[i] * weights[i];
         }
+
+        Svm::Svm(const float * svs, const float * weights, size_t length, size_t count, const float * bias, SimdSvmKernelType kernel, const float * params)
+            : Base::Svm(svs, weights, length, count, bias, kernel, params)
+        {
+            _gemm = Gemm32fNN;
+            _productSum = NeuralProductSum;
+            _mathFunction = MathFunction32f;
+        }
+
+        void * SvmInit(const float * svs, const float * weights, size_t length, size_t count, const float * bias, SimdSvmKernelType kernel, const float * params)
+        {
+            if (!Base::SvmValid(svs, weights, length, count, kernel, params))
+                return NULL;
+            return new Svm(svs, weights, length, count, bias, kernel, params);
+        }
     }
 #endif// SIMD_NEON_ENABLE
 }
@@ -0,0 +1,88 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdLoad.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdExp.h"
+
+namespace Simd
+{
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        SIMD_INLINE void SynetDetectionDecode32f(const float * loc, const float * prior, const float * variance, const float32x4_t & sign, Exp & exp, float * dst)
+        {
+            float32x4_t _prior = Load<false>(prior);
+            float32x4_t lo = vcombine_f32(vget_low_f32(_prior), vget_low_f32(_prior));
+            float32x4_t hi = vcombine_f32(vget_high_f32(_prior), vget_high_f32(_prior));
+            float32x4_t size = vsubq_f32(hi, lo);
+            float32x4_t center = vmulq_f32(vaddq_f32(lo, hi), vdupq_n_f32(0.5f));
+            float32x4_t delta = vmulq_f32(Load<false>(variance), Load<false>(loc));
+            center = vmlaq_f32(center, vcombine_f32(vget_low_f32(delta), vget_low_f32(delta)), size);
+            size = vmulq_f32(exp.Exponent(vcombine_f32(vget_high_f32(delta), vget_high_f32(delta))), size);
+            Store<false>(dst, vmlaq_f32(center, size, sign));
+        }
+
+        void SynetDetectionDecode32f(const float * loc, const float * prior, size_t count, float * dst)
+        {
+            const float * variance = prior + count * 4;
+            const float _sign[4] = { -0.5f, -0.5f, 0.5f, 0.5f };
+            float32x4_t sign = Load<false>(_sign);
+            Exp exp;
+            for (size_t i = 0; i < count; ++i, loc += 4, prior += 4, variance += 4, dst += 4)
+                SynetDetectionDecode32f(loc, prior, variance, sign, exp, dst);
+        }
+
+        void SynetDetectionSuppress(const float * boxes, size_t current, size_t end, float threshold, uint32_t * suppressed)
+        {
+            const float * xMin = boxes, *yMin = xMin + end, *xMax = yMin + end, *yMax = xMax + end, *area = yMax + end;
+            float32x4_t _xMin = vdupq_n_f32(xMin[current]);
+            float32x4_t _yMin = vdupq_n_f32(yMin[current]);
+            float32x4_t _xMax = vdupq_n_f32(xMax[current]);
+            float32x4_t _yMax = vdupq_n_f32(yMax[current]);
+            float32x4_t _area = vdupq_n_f32(area[current]);
+            float32x4_t _threshold = vdupq_n_f32(threshold);
+            size_t i = current + 1, endF = i + AlignLo(end - i, F);
+            for (; i < endF; i += F)
+            {
+                float32x4_t w = vmaxq_f32(vsubq_f32(vminq_f32(_xMax, Load<false>(xMax + i)), vmaxq_f32(_xMin, Load<false>(xMin + i))), vdupq_n_f32(0.0f));
+                float32x4_t h = vmaxq_f32(vsubq_f32(vminq_f32(_yMax, Load<false>(yMax + i)), vmaxq_f32(_yMin, Load<false>(yMin + i))), vdupq_n_f32(0.0f));
+                float32x4_t intersection = vmulq_f32(w, h);
+                float32x4_t junction = vsubq_f32(vaddq_f32(_area, Load<false>(area + i)), intersection);
+                uint32x4_t mask = vcgtq_f32(intersection, vmulq_f32(_threshold, junction));
+                vst1q_u32(suppressed + i, vorrq_u32(vld1q_u32(suppressed + i), mask));
+            }
+            if (i < end)
+                Base::SynetDetectionSuppress(boxes, current, i, end, threshold, suppressed);
+        }
+
+        size_t SynetDetectionNms32f(const float * boxes, const float * scores, size_t count, size_t classes, ptrdiff_t background, float scoreThreshold,
+            float nmsThreshold, size_t topK, size_t keepTopK, SimdBool classAware, float * dst)
+        {
+            return Base::SynetDetectionNms32f(boxes, scores, count, classes, background, scoreThreshold, nmsThreshold, topK, keepTopK, classAware, dst, SynetDetectionSuppress);
+        }
+    }
+#endif// SIMD_NEON_ENABLE
+}
@@ -0,0 +1,121 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdLoad.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        template<int part> SIMD_INLINE int16x8_t Widen(uint8x16_t value)
+        {
+            return vreinterpretq_s16_u16(vmovl_u8(Half<part>(value)));
+        }
+
+        template<int part> SIMD_INLINE int16x8_t BgrToYCoCgR(const uint8x16x3_t & bgr, int16_t * co, int16_t * cg)
+        {
+            int16x8_t blue = Widen<part>(bgr.val[0]), green = Widen<part>(bgr.val[1]), red = Widen<part>(bgr.val[2]);
+            int16x8_t _co = vsubq_s16(red, blue);
+            int16x8_t t = vaddq_s16(blue, vshrq_n_s16(_co, 1));
+            int16x8_t _cg = vsubq_s16(green, t);
+            vst1q_s16(co + part * HA, _co);
+            vst1q_s16(cg + part * HA, _cg);
+            return vaddq_s16(t, vshrq_n_s16(_cg, 1));
+        }
+
+        SIMD_INLINE void BgrToYCoCgR(const uint8_t * bgr, uint8_t * y, int16_t * co, int16_t * cg)
+        {
+            uint8x16x3_t _bgr = Load3<false>(bgr);
+            int16x8_t lo = BgrToYCoCgR<0>(_bgr, co, cg);
+            int16x8_t hi = BgrToYCoCgR<1>(_bgr, co, cg);
+            Store<false>(y, vcombine_u8(vqmovun_s16(lo), vqmovun_s16(hi)));
+        }
+
+        void BgrToYCoCgR(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * co, size_t coStride, uint8_t * cg, size_t cgStride)
+        {
+            assert(width >= A);
+
+            size_t widthA = AlignLo(width, A), tail = width - A;
+            for (size_t row = 0; row < height; ++row)
+            {
+                int16_t * pCo = (int16_t*)co, * pCg = (int16_t*)cg;
+                for (size_t col = 0; col < widthA; col += A)
+                    BgrToYCoCgR(bgr + col * 3, y + col, pCo + col, pCg + col);
+                if (widthA < width)
+                    BgrToYCoCgR(bgr + tail * 3, y + tail, pCo + tail, pCg + tail);
+                bgr += bgrStride;
+                y += yStride;
+                co += coStride;
+                cg += cgStride;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        template<int part> SIMD_INLINE void YCoCgRToBgr(uint8x16_t y, const int16_t * co, const int16_t * cg, int16x8_t blue[2], int16x8_t green[2], int16x8_t red[2])
+        {
+            int16x8_t _co = vld1q_s16(co + part * HA);
+            int16x8_t _cg = vld1q_s16(cg + part * HA);
+            int16x8_t t = vsubq_s16(Widen<part>(y), vshrq_n_s16(_cg, 1));
+            blue[part] = vsubq_s16(t, vshrq_n_s16(_co, 1));
+            green[part] = vaddq_s16(_cg, t);
+            red[part] = vaddq_s16(blue[part], _co);
+        }
+
+        SIMD_INLINE void YCoCgRToBgr(const uint8_t * y, const int16_t * co, const int16_t * cg, uint8_t * bgr)
+        {
+            uint8x16_t _y = Load<false>(y);
+            int16x8_t blue[2], green[2], red[2];
+            YCoCgRToBgr<0>(_y, co, cg, blue, green, red);
+            YCoCgRToBgr<1>(_y, co, cg, blue, green, red);
+            uint8x16x3_t _bgr;
+            _bgr.val[0] = vcombine_u8(vqmovun_s16(blue[0]), vqmovun_s16(blue[1]));
+            _bgr.val[1] = vcombine_u8(vqmovun_s16(green[0]), vqmovun_s16(green[1]));
+            _bgr.val[2] = vcombine_u8(vqmovun_s16(red[0]), vqmovun_s16(red[1]));
+            Store3<false>(bgr, _bgr);
+        }
+
+        void YCoCgRToBgr(const uint8_t * y, size_t yStride, const uint8_t * co, size_t coStride, const uint8_t * cg, size_t cgStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            assert(width >= A);
+
+            size_t widthA = AlignLo(width, A), tail = width - A;
+            for (size_t row = 0; row < height; ++row)
+            {
+                const int16_t * pCo = (const int16_t*)co, * pCg = (const int16_t*)cg;
+                for (size_t col = 0; col < widthA; col += A)
+                    YCoCgRToBgr(y + col, pCo + col, pCg + col, bgr + col * 3);
+                if (widthA < width)
+                    YCoCgRToBgr(y + tail, pCo + tail, pCg + tail, bgr + tail * 3);
+                y += yStride;
+                co += coStride;
+                cg += cgStride;
+                bgr += bgrStride;
+            }
+        }
+    }
+#endif// SIMD_NEON_ENABLE
+}
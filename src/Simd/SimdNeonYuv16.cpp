@@ -0,0 +1,394 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdArray.h"
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdNeon.h"
+
+namespace Simd
+{
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        SIMD_INLINE uint8x8_t Uint16ToGray(const uint16_t * src, uint16x8_t level, int16x8_t shift)
+        {
+            return vqmovn_u16(vshlq_u16(vqaddq_u16(vld1q_u16(src), level), shift));
+        }
+
+        static void Uint16ToGray(const uint16_t * src, size_t width, size_t row, size_t shift, SimdBool dither, uint8_t * dst)
+        {
+            uint16_t levels[4];
+            Base::Uint16ToGrayLevels(row, shift, dither == SimdTrue, levels);
+            uint16x4_t level = vld1_u16(levels);
+            uint16x8_t _level = vcombine_u16(level, level);
+            int16x8_t _shift = vdupq_n_s16(-(int16_t)shift);
+            size_t alignedWidth = AlignLo(width, A), col = 0;
+            for (; col < alignedWidth; col += A)
+                vst1q_u8(dst + col, vcombine_u8(Uint16ToGray(src + col, _level, _shift), Uint16ToGray(src + col + HA, _level, _shift)));
+            for (; col < width; ++col)
+                dst[col] = Base::Uint16ToGray(src[col], levels[col & 3], shift);
+        }
+
+        void Uint16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, size_t bitDepth, SimdBool dither, uint8_t * dst, size_t dstStride)
+        {
+            assert(bitDepth > 8 && bitDepth <= 16);
+
+            for (size_t row = 0; row < height; ++row)
+            {
+                Uint16ToGray((const uint16_t*)src, width, row, bitDepth - 8, dither, dst);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        SIMD_INLINE void Uint16ToFloat32(const uint16_t * src, float32x4_t scale, float * dst)
+        {
+            uint16x8_t value = vld1q_u16(src);
+            vst1q_f32(dst + 0, vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(value))), scale));
+            vst1q_f32(dst + F, vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(value))), scale));
+        }
+
+        void Uint16ToFloat32(const uint8_t * src, size_t width, size_t height, size_t srcStride, size_t bitDepth, uint8_t * dst, size_t dstStride)
+        {
+            assert(bitDepth > 8 && bitDepth <= 16);
+
+            float scale = 1.0f / float((1 << bitDepth) - 1);
+            float32x4_t _scale = vdupq_n_f32(scale);
+            size_t alignedWidth = AlignLo(width, HA);
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint16_t * s = (const uint16_t*)src;
+                float * d = (float*)dst;
+                size_t col = 0;
+                for (; col < alignedWidth; col += HA)
+                    Uint16ToFloat32(s + col, _scale, d + col);
+                for (; col < width; ++col)
+                    d[col] = float(s[col]) * scale;
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        template<class T> SIMD_INLINE uint16x8_t LoadSamples(const T * src);
+
+        template<> SIMD_INLINE uint16x8_t LoadSamples<uint8_t>(const uint8_t * src)
+        {
+            return vmovl_u8(vld1_u8(src));
+        }
+
+        template<> SIMD_INLINE uint16x8_t LoadSamples<uint16_t>(const uint16_t * src)
+        {
+            return vld1q_u16(src);
+        }
+
+        template<class T> SIMD_INLINE void StoreSamples(T * dst, uint16x8_t value);
+
+        template<> SIMD_INLINE void StoreSamples<uint8_t>(uint8_t * dst, uint16x8_t value)
+        {
+            vst1_u8(dst, vqmovn_u16(value));
+        }
+
+        template<> SIMD_INLINE void StoreSamples<uint16_t>(uint16_t * dst, uint16x8_t value)
+        {
+            vst1q_u16(dst, value);
+        }
+
+        struct BitDepthConverter
+        {
+            BitDepthConverter(size_t srcBitDepth, size_t dstBitDepth)
+            {
+                int shift = int(srcBitDepth) - int(dstBitDepth);
+                _up = vdupq_n_s16(shift < 0 ? -shift : 0);
+                _down = vdupq_n_s16(shift > 0 ? -shift : 0);
+                _max = vdupq_n_u16((1 << dstBitDepth) - 1);
+            }
+
+            SIMD_INLINE uint16x8_t operator()(uint16x8_t value) const
+            {
+                return vminq_u16(vrshlq_u16(vshlq_u16(value, _up), _down), _max);
+            }
+
+        private:
+            int16x8_t _up, _down;
+            uint16x8_t _max;
+        };
+
+        SIMD_INLINE void InterleaveUv16(uint16x8_t u, uint16x8_t v, uint16x8_t uv[2])
+        {
+            uint16x8x2_t _uv = vzipq_u16(u, v);
+            uv[0] = _uv.val[0];
+            uv[1] = _uv.val[1];
+        }
+
+        SIMD_INLINE void DeinterleaveUv16(uint16x8_t uv0, uint16x8_t uv1, uint16x8_t & u, uint16x8_t & v)
+        {
+            uint16x8x2_t _uv = vuzpq_u16(uv0, uv1);
+            u = _uv.val[0];
+            v = _uv.val[1];
+        }
+
+        template<class S, class D> void ChangeBitDepth(const uint8_t * src, size_t width, size_t height, size_t srcStride,
+            const BitDepthConverter & converter, uint8_t * dst, size_t dstStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                const S * s = (const S*)src;
+                D * d = (D*)dst;
+                for (size_t col = 0; col < width; col += HA)
+                    StoreSamples(d + col, converter(LoadSamples(s + col)));
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        void ChangeBitDepth(const uint8_t * src, size_t width, size_t height, size_t srcStride, size_t srcBitDepth, size_t dstBitDepth, uint8_t * dst, size_t dstStride)
+        {
+            assert(srcBitDepth >= 8 && srcBitDepth <= 16 && dstBitDepth >= 8 && dstBitDepth <= 16 && width >= HA);
+
+            BitDepthConverter converter(srcBitDepth, dstBitDepth);
+            size_t widthHA = AlignLo(width, HA), srcSize = srcBitDepth > 8 ? 2 : 1, dstSize = dstBitDepth > 8 ? 2 : 1;
+            if (srcSize == 2)
+            {
+                if (dstSize == 2)
+                    ChangeBitDepth<uint16_t, uint16_t>(src, widthHA, height, srcStride, converter, dst, dstStride);
+                else
+                    ChangeBitDepth<uint16_t, uint8_t>(src, widthHA, height, srcStride, converter, dst, dstStride);
+            }
+            else
+            {
+                if (dstSize == 2)
+                    ChangeBitDepth<uint8_t, uint16_t>(src, widthHA, height, srcStride, converter, dst, dstStride);
+                else
+                    ChangeBitDepth<uint8_t, uint8_t>(src, widthHA, height, srcStride, converter, dst, dstStride);
+            }
+            if (widthHA < width)
+                Base::ChangeBitDepth(src + widthHA * srcSize, width - widthHA, height, srcStride, srcBitDepth, dstBitDepth, dst + widthHA * dstSize, dstStride);
+        }
+
+        template<class S, class D> void InterleaveUvBitDepth(const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, const BitDepthConverter & converter, uint8_t * uv, size_t uvStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                const S * su = (const S*)u, * sv = (const S*)v;
+                D * d = (D*)uv;
+                for (size_t col = 0; col < width; col += HA)
+                {
+                    uint16x8_t _uv[2];
+                    InterleaveUv16(converter(LoadSamples(su + col)), converter(LoadSamples(sv + col)), _uv);
+                    StoreSamples(d + 2 * col + 0, _uv[0]);
+                    StoreSamples(d + 2 * col + HA, _uv[1]);
+                }
+                u += uStride;
+                v += vStride;
+                uv += uvStride;
+            }
+        }
+
+        void InterleaveUvBitDepth(const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height,
+            size_t srcBitDepth, size_t dstBitDepth, uint8_t * uv, size_t uvStride)
+        {
+            assert(srcBitDepth >= 8 && srcBitDepth <= 16 && dstBitDepth >= 8 && dstBitDepth <= 16 && width >= HA);
+
+            BitDepthConverter converter(srcBitDepth, dstBitDepth);
+            size_t widthHA = AlignLo(width, HA), srcSize = srcBitDepth > 8 ? 2 : 1, dstSize = dstBitDepth > 8 ? 2 : 1;
+            if (srcSize == 2)
+            {
+                if (dstSize == 2)
+                    InterleaveUvBitDepth<uint16_t, uint16_t>(u, uStride, v, vStride, widthHA, height, converter, uv, uvStride);
+                else
+                    InterleaveUvBitDepth<uint16_t, uint8_t>(u, uStride, v, vStride, widthHA, height, converter, uv, uvStride);
+            }
+            else
+            {
+                if (dstSize == 2)
+                    InterleaveUvBitDepth<uint8_t, uint16_t>(u, uStride, v, vStride, widthHA, height, converter, uv, uvStride);
+                else
+                    InterleaveUvBitDepth<uint8_t, uint8_t>(u, uStride, v, vStride, widthHA, height, converter, uv, uvStride);
+            }
+            if (widthHA < width)
+                Base::InterleaveUvBitDepth(u + widthHA * srcSize, uStride, v + widthHA * srcSize, vStride, width - widthHA, height,
+                    srcBitDepth, dstBitDepth, uv + 2 * widthHA * dstSize, uvStride);
+        }
+
+        template<class S, class D> void DeinterleaveUvBitDepth(const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            const BitDepthConverter & converter, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                const S * s = (const S*)uv;
+                D * du = (D*)u, * dv = (D*)v;
+                for (size_t col = 0; col < width; col += HA)
+                {
+                    uint16x8_t _u, _v;
+                    DeinterleaveUv16(converter(LoadSamples(s + 2 * col + 0)), converter(LoadSamples(s + 2 * col + HA)), _u, _v);
+                    StoreSamples(du + col, _u);
+                    StoreSamples(dv + col, _v);
+                }
+                uv += uvStride;
+                u += uStride;
+                v += vStride;
+            }
+        }
+
+        void DeinterleaveUvBitDepth(const uint8_t * uv, size_t uvStride, size_t width, size_t height, size_t srcBitDepth, size_t dstBitDepth,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            assert(srcBitDepth >= 8 && srcBitDepth <= 16 && dstBitDepth >= 8 && dstBitDepth <= 16 && width >= HA);
+
+            BitDepthConverter converter(srcBitDepth, dstBitDepth);
+            size_t widthHA = AlignLo(width, HA), srcSize = srcBitDepth > 8 ? 2 : 1, dstSize = dstBitDepth > 8 ? 2 : 1;
+            if (srcSize == 2)
+            {
+                if (dstSize == 2)
+                    DeinterleaveUvBitDepth<uint16_t, uint16_t>(uv, uvStride, widthHA, height, converter, u, uStride, v, vStride);
+                else
+                    DeinterleaveUvBitDepth<uint16_t, uint8_t>(uv, uvStride, widthHA, height, converter, u, uStride, v, vStride);
+            }
+            else
+            {
+                if (dstSize == 2)
+                    DeinterleaveUvBitDepth<uint8_t, uint16_t>(uv, uvStride, widthHA, height, converter, u, uStride, v, vStride);
+                else
+                    DeinterleaveUvBitDepth<uint8_t, uint8_t>(uv, uvStride, widthHA, height, converter, u, uStride, v, vStride);
+            }
+            if (widthHA < width)
+                Base::DeinterleaveUvBitDepth(uv + 2 * widthHA * srcSize, uvStride, width - widthHA, height, srcBitDepth, dstBitDepth,
+                    u + widthHA * dstSize, uStride, v + widthHA * dstSize, vStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        struct Yuv16Buffer
+        {
+            Yuv16Buffer(size_t width, uint8_t * external)
+            {
+                yStride = AlignHi(width, A);
+                uvStride = AlignHi(width / 2, A);
+                if (external)
+                    y = (uint8_t*)AlignHi(external, A);
+                else
+                {
+                    _buffer.Resize(yStride * 3 + uvStride * 2);
+                    y = _buffer.data;
+                }
+                uv = y + 2 * yStride;
+                u = uv + yStride;
+                v = u + uvStride;
+            }
+
+            uint8_t * y, * uv, * u, * v;
+            size_t yStride, uvStride;
+        private:
+            Array8u _buffer;
+        };
+
+        static void Yuv420p16ToYuv420p(const uint8_t * y, size_t yStride, const uint8_t * u, const uint8_t * v,
+            size_t width, size_t row, size_t shift, SimdBool dither, Yuv16Buffer & buffer)
+        {
+            Uint16ToGray((const uint16_t*)y, width, row, shift, dither, buffer.y);
+            Uint16ToGray((const uint16_t*)(y + yStride), width, row + 1, shift, dither, buffer.y + buffer.yStride);
+            Uint16ToGray((const uint16_t*)u, width / 2, row / 2, shift, dither, buffer.u);
+            Uint16ToGray((const uint16_t*)v, width / 2, row / 2, shift, dither, buffer.v);
+        }
+
+        static void P016ToYuv420p(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t width, size_t row, SimdBool dither, Yuv16Buffer & buffer)
+        {
+            Uint16ToGray((const uint16_t*)y, width, row, 8, dither, buffer.y);
+            Uint16ToGray((const uint16_t*)(y + yStride), width, row + 1, 8, dither, buffer.y + buffer.yStride);
+            Uint16ToGray((const uint16_t*)uv, width, row / 2, 8, dither, buffer.uv);
+            DeinterleaveUv(buffer.uv, buffer.yStride, width / 2, 1, buffer.u, buffer.uvStride, buffer.v, buffer.uvStride);
+        }
+
+        void Yuv420p16ToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, size_t bitDepth, uint8_t * bgr, size_t bgrStride, SimdBool dither, SimdYuvType yuvType, uint8_t * buf)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && bitDepth > 8 && bitDepth <= 16);
+
+            Yuv16Buffer buffer(width, buf);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                Yuv420p16ToYuv420p(y, yStride, u, v, width, row, bitDepth - 8, dither, buffer);
+                Yuv420pToBgrV2(buffer.y, buffer.yStride, buffer.u, buffer.uvStride, buffer.v, buffer.uvStride, width, 2, bgr, bgrStride, yuvType);
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+                bgr += 2 * bgrStride;
+            }
+        }
+
+        void Yuv420p16ToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, size_t bitDepth, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdBool dither, SimdYuvType yuvType, uint8_t * buf)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && bitDepth > 8 && bitDepth <= 16);
+
+            Yuv16Buffer buffer(width, buf);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                Yuv420p16ToYuv420p(y, yStride, u, v, width, row, bitDepth - 8, dither, buffer);
+                Yuv420pToBgraV2(buffer.y, buffer.yStride, buffer.u, buffer.uvStride, buffer.v, buffer.uvStride, width, 2, bgra, bgraStride, alpha, yuvType);
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+                bgra += 2 * bgraStride;
+            }
+        }
+
+        void P016ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            uint8_t * bgr, size_t bgrStride, SimdBool dither, SimdYuvType yuvType, uint8_t * buf)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA));
+
+            Yuv16Buffer buffer(width, buf);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                P016ToYuv420p(y, yStride, uv, width, row, dither, buffer);
+                Yuv420pToBgrV2(buffer.y, buffer.yStride, buffer.u, buffer.uvStride, buffer.v, buffer.uvStride, width, 2, bgr, bgrStride, yuvType);
+                y += 2 * yStride;
+                uv += uvStride;
+                bgr += 2 * bgrStride;
+            }
+        }
+
+        void P016ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdBool dither, SimdYuvType yuvType, uint8_t * buf)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA));
+
+            Yuv16Buffer buffer(width, buf);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                P016ToYuv420p(y, yStride, uv, width, row, dither, buffer);
+                Yuv420pToBgraV2(buffer.y, buffer.yStride, buffer.u, buffer.uvStride, buffer.v, buffer.uvStride, width, 2, bgra, bgraStride, alpha, yuvType);
+                y += 2 * yStride;
+                uv += uvStride;
+                bgra += 2 * bgraStride;
+            }
+        }
+    }
+#endif// SIMD_NEON_ENABLE
+}
@@ -33,20 +33,20 @@ namespace Simd
         const size_t A3 = A * 3;
         const size_t A6 = A * 6;
 
-        template <bool align> SIMD_INLINE void YuvToBgr(const uint8x16_t & y, const uint8x16_t & u, const uint8x16_t & v, uint8_t * bgr)
+        template <bool align, class T = Base::Bt601> SIMD_INLINE void YuvToBgr(const uint8x16_t & y, const uint8x16_t & u, const uint8x16_t & v, uint8_t * bgr)
         {
             uint8x16x3_t _bgr;
-            YuvToBgr(y, u, v, _bgr);
+            YuvToBgr<T>(y, u, v, _bgr);
             Store3<align>(bgr, _bgr);
         }
 
-        template <bool align> SIMD_INLINE void Yuv422pToBgr(const uint8_t * y, const uint8x16x2_t & u, const uint8x16x2_t & v, uint8_t * bgr)
+        template <bool align, class T = Base::Bt601> SIMD_INLINE void Yuv422pToBgr(const uint8_t * y, const uint8x16x2_t & u, const uint8x16x2_t & v, uint8_t * bgr)
         {
-            YuvToBgr<align>(Load<align>(y + 0), u.val[0], v.val[0], bgr + 0);
-            YuvToBgr<align>(Load<align>(y + A), u.val[1], v.val[1], bgr + A3);
+            YuvToBgr<align, T>(Load<align>(y + 0), u.val[0], v.val[0], bgr + 0);
+            YuvToBgr<align, T>(Load<align>(y + A), u.val[1], v.val[1], bgr + A3);
         }
 
-        template <bool align> void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <bool align, class T = Base::Bt601> void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
@@ -67,8 +67,8 @@ namespace Simd
                     _u = vzipq_u8(_u.val[0], _u.val[1]);
                     _v.val[1] = _v.val[0] = Load<align>(v + colUV);
                     _v = vzipq_u8(_v.val[0], _v.val[1]);
-                    Yuv422pToBgr<align>(y + colY, _u, _v, bgr + colBgr);
-                    Yuv422pToBgr<align>(y + colY + yStride, _u, _v, bgr + colBgr + bgrStride);
+                    Yuv422pToBgr<align, T>(y + colY, _u, _v, bgr + colBgr);
+                    Yuv422pToBgr<align, T>(y + colY + yStride, _u, _v, bgr + colBgr + bgrStride);
                 }
                 if (tail)
                 {
@@ -77,8 +77,8 @@ namespace Simd
                     _u = vzipq_u8(_u.val[0], _u.val[1]);
                     _v.val[1] = _v.val[0] = Load<false>(v + offset / 2);
                     _v = vzipq_u8(_v.val[0], _v.val[1]);
-                    Yuv422pToBgr<false>(y + offset, _u, _v, bgr + 3 * offset);
-                    Yuv422pToBgr<false>(y + offset + yStride, _u, _v, bgr + 3 * offset + bgrStride);
+                    Yuv422pToBgr<false, T>(y + offset, _u, _v, bgr + 3 * offset);
+                    Yuv422pToBgr<false, T>(y + offset + yStride, _u, _v, bgr + 3 * offset + bgrStride);
                 }
                 y += 2 * yStride;
                 u += uStride;
@@ -87,17 +87,44 @@ namespace Simd
             }
         }
 
-        void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
-                Yuv420pToBgr<true>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv420pToBgr<true, T>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
             else
-                Yuv420pToBgr<false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv420pToBgr<false, T>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Yuv420pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv420pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Yuv420pToBgr<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Yuv420pToBgr<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt601Full: Yuv420pToBgr<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Yuv420pToBgr<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Yuv420pToBgr<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            default: assert(0);
+            }
         }
 
-        template <bool align> void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        void Yuv420pToRgb(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+        {
+            Yuv420pToBgr<Base::Rgb<Base::Bt601>>(y, yStride, v, vStride, u, uStride, width, height, rgb, rgbStride);
+        }
+
+        template <bool align, class T = Base::Bt601> void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             assert((width % 2 == 0) && (width >= DA));
@@ -118,7 +145,7 @@ namespace Simd
                     _u = vzipq_u8(_u.val[0], _u.val[1]);
                     _v.val[1] = _v.val[0] = Load<align>(v + colUV);
                     _v = vzipq_u8(_v.val[0], _v.val[1]);
-                    Yuv422pToBgr<align>(y + colY, _u, _v, bgr + colBgr);
+                    Yuv422pToBgr<align, T>(y + colY, _u, _v, bgr + colBgr);
                 }
                 if (tail)
                 {
@@ -127,7 +154,7 @@ namespace Simd
                     _u = vzipq_u8(_u.val[0], _u.val[1]);
                     _v.val[1] = _v.val[0] = Load<false>(v + offset / 2);
                     _v = vzipq_u8(_v.val[0], _v.val[1]);
-                    Yuv422pToBgr<false>(y + offset, _u, _v, bgr + 3 * offset);
+                    Yuv422pToBgr<false, T>(y + offset, _u, _v, bgr + 3 * offset);
                 }
                 y += yStride;
                 u += uStride;
@@ -136,17 +163,44 @@ namespace Simd
             }
         }
 
-        void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
-                Yuv422pToBgr<true>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv422pToBgr<true, T>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
             else
-                Yuv422pToBgr<false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv422pToBgr<false, T>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Yuv422pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv422pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv422pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Yuv422pToBgr<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Yuv422pToBgr<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt601Full: Yuv422pToBgr<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Yuv422pToBgr<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Yuv422pToBgr<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            default: assert(0);
+            }
+        }
+
+        void Yuv422pToRgb(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+        {
+            Yuv422pToBgr<Base::Rgb<Base::Bt601>>(y, yStride, v, vStride, u, uStride, width, height, rgb, rgbStride);
         }
 
-        template <bool align> void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <bool align, class T = Base::Bt601> void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             assert(width >= A);
@@ -165,7 +219,7 @@ namespace Simd
                     uint8x16_t _y = Load<align>(y + col);
                     uint8x16_t _u = Load<align>(u + col);
                     uint8x16_t _v = Load<align>(v + col);
-                    YuvToBgr<align>(_y, _u, _v, bgr + colBgr);
+                    YuvToBgr<align, T>(_y, _u, _v, bgr + colBgr);
                 }
                 if (tail)
                 {
@@ -173,7 +227,7 @@ namespace Simd
                     uint8x16_t _y = Load<false>(y + col);
                     uint8x16_t _u = Load<false>(u + col);
                     uint8x16_t _v = Load<false>(v + col);
-                    YuvToBgr<false>(_y, _u, _v, bgr + 3 * col);
+                    YuvToBgr<false, T>(_y, _u, _v, bgr + 3 * col);
                 }
                 y += yStride;
                 u += uStride;
@@ -182,14 +236,131 @@ namespace Simd
             }
         }
 
-        void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
-                Yuv444pToBgr<true>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv444pToBgr<true, T>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+            else
+                Yuv444pToBgr<false, T>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Yuv444pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv444pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv444pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Yuv444pToBgr<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Yuv444pToBgr<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt601Full: Yuv444pToBgr<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Yuv444pToBgr<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Yuv444pToBgr<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            default: assert(0);
+            }
+        }
+
+        void Yuv444pToRgb(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+        {
+            Yuv444pToBgr<Base::Rgb<Base::Bt601>>(y, yStride, v, vStride, u, uStride, width, height, rgb, rgbStride);
+        }
+
+        template <bool align, bool nv21, class T> void Nv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
+            if (align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride));
+                assert(Aligned(bgr) && Aligned(bgrStride));
+            }
+
+            size_t bodyWidth = AlignLo(width, DA);
+            size_t tail = width - bodyWidth;
+            size_t A6 = A * 6;
+            uint8x16x2_t _u, _v;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0, colBgr = 0; colY < bodyWidth; colY += DA, colBgr += A6)
+                {
+                    LoadUv<align, nv21>(uv + colY, _u.val[0], _v.val[0]);
+                    _u = vzipq_u8(_u.val[0], _u.val[0]);
+                    _v = vzipq_u8(_v.val[0], _v.val[0]);
+                    Yuv422pToBgr<align, T>(y + colY, _u, _v, bgr + colBgr);
+                    Yuv422pToBgr<align, T>(y + colY + yStride, _u, _v, bgr + colBgr + bgrStride);
+                }
+                if (tail)
+                {
+                    size_t offset = width - DA;
+                    LoadUv<false, nv21>(uv + offset, _u.val[0], _v.val[0]);
+                    _u = vzipq_u8(_u.val[0], _u.val[0]);
+                    _v = vzipq_u8(_v.val[0], _v.val[0]);
+                    Yuv422pToBgr<false, T>(y + offset, _u, _v, bgr + 3 * offset);
+                    Yuv422pToBgr<false, T>(y + offset + yStride, _u, _v, bgr + 3 * offset + bgrStride);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                bgr += 2 * bgrStride;
+            }
+        }
+
+        template <bool nv21, class T> void Nv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(bgr) && Aligned(bgrStride))
+                Nv12ToBgr<true, nv21, T>(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
             else
-                Yuv444pToBgr<false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Nv12ToBgr<false, nv21, T>(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+        }
+
+        void Nv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Nv12ToBgr<false, Base::Bt601>(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+        }
+
+        void Nv12ToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToBgr<false, Base::Bt601>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Nv12ToBgr<false, Base::Bt709>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Nv12ToBgr<false, Base::Bt2020>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt601Full: Nv12ToBgr<false, Base::Bt601Full>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Nv12ToBgr<false, Base::Bt709Full>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Nv12ToBgr<false, Base::Bt2020Full>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            default: assert(0);
+            }
+        }
+
+        void Nv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Nv12ToBgr<true, Base::Bt601>(y, yStride, vu, vuStride, width, height, bgr, bgrStride);
+        }
+
+        void Nv21ToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToBgr<true, Base::Bt601>(y, yStride, vu, vuStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Nv12ToBgr<true, Base::Bt709>(y, yStride, vu, vuStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Nv12ToBgr<true, Base::Bt2020>(y, yStride, vu, vuStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt601Full: Nv12ToBgr<true, Base::Bt601Full>(y, yStride, vu, vuStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Nv12ToBgr<true, Base::Bt709Full>(y, yStride, vu, vuStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Nv12ToBgr<true, Base::Bt2020Full>(y, yStride, vu, vuStride, width, height, bgr, bgrStride); break;
+            default: assert(0);
+            }
         }
     }
 #endif// SIMD_NEON_ENABLE
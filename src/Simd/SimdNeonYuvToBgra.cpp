@@ -30,10 +30,10 @@ namespace Simd
 #ifdef SIMD_NEON_ENABLE    
     namespace Neon
     {
-        template <bool align> SIMD_INLINE void YuvToBgra(const uint8x16_t & y, const uint8x16_t & u, const uint8x16_t & v, const uint8x16_t & a, uint8_t * bgra)
+        template <bool align, class T = Base::Bt601> SIMD_INLINE void YuvToBgra(const uint8x16_t & y, const uint8x16_t & u, const uint8x16_t & v, const uint8x16_t & a, uint8_t * bgra)
         {
             uint8x16x4_t _bgra;
-            YuvToBgr(y, u, v, *(uint8x16x3_t*)&_bgra);
+            YuvToBgr<T>(y, u, v, *(uint8x16x3_t*)&_bgra);
             _bgra.val[3] = a;
             Store4<align>(bgra, _bgra);
         }
@@ -96,13 +96,13 @@ namespace Simd
                 Yuva420pToBgra<false>(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
         }
 
-        template <bool align> SIMD_INLINE void Yuv422pToBgra(const uint8_t * y, const uint8x16x2_t & u, const uint8x16x2_t & v, const uint8x16_t & alpha, uint8_t * bgra)
+        template <bool align, class T = Base::Bt601> SIMD_INLINE void Yuv422pToBgra(const uint8_t * y, const uint8x16x2_t & u, const uint8x16x2_t & v, const uint8x16_t & alpha, uint8_t * bgra)
         {
-            YuvToBgra<align>(Load<align>(y + 0), u.val[0], v.val[0], alpha, bgra + 0);
-            YuvToBgra<align>(Load<align>(y + A), u.val[1], v.val[1], alpha, bgra + QA);
+            YuvToBgra<align, T>(Load<align>(y + 0), u.val[0], v.val[0], alpha, bgra + 0);
+            YuvToBgra<align, T>(Load<align>(y + A), u.val[1], v.val[1], alpha, bgra + QA);
         }
 
-        template <bool align> void Yuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <bool align, class T = Base::Bt601> void Yuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
         {
             assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
@@ -124,8 +124,8 @@ namespace Simd
                     _u = vzipq_u8(_u.val[0], _u.val[1]);
                     _v.val[1] = _v.val[0] = Load<align>(v + colUV);
                     _v = vzipq_u8(_v.val[0], _v.val[1]);
-                    Yuv422pToBgra<align>(y + colY, _u, _v, _alpha, bgra + colBgra);
-                    Yuv422pToBgra<align>(y + colY + yStride, _u, _v, _alpha, bgra + colBgra + bgraStride);
+                    Yuv422pToBgra<align, T>(y + colY, _u, _v, _alpha, bgra + colBgra);
+                    Yuv422pToBgra<align, T>(y + colY + yStride, _u, _v, _alpha, bgra + colBgra + bgraStride);
                 }
                 if (tail)
                 {
@@ -134,8 +134,8 @@ namespace Simd
                     _u = vzipq_u8(_u.val[0], _u.val[1]);
                     _v.val[1] = _v.val[0] = Load<false>(v + offset / 2);
                     _v = vzipq_u8(_v.val[0], _v.val[1]);
-                    Yuv422pToBgra<false>(y + offset, _u, _v, _alpha, bgra + 4 * offset);
-                    Yuv422pToBgra<false>(y + offset + yStride, _u, _v, _alpha, bgra + 4 * offset + bgraStride);
+                    Yuv422pToBgra<false, T>(y + offset, _u, _v, _alpha, bgra + 4 * offset);
+                    Yuv422pToBgra<false, T>(y + offset + yStride, _u, _v, _alpha, bgra + 4 * offset + bgraStride);
                 }
                 y += 2 * yStride;
                 u += uStride;
@@ -144,17 +144,44 @@ namespace Simd
             }
         }
 
-        void Yuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride))
-                Yuv420pToBgra<true>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+                Yuv420pToBgra<true, T>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
             else
-                Yuv420pToBgra<false>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+                Yuv420pToBgra<false, T>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
         }
 
-        template <bool align> void Yuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        void Yuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            Yuv420pToBgra<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        }
+
+        void Yuv420pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv420pToBgra<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709: Yuv420pToBgra<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020: Yuv420pToBgra<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt601Full: Yuv420pToBgra<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709Full: Yuv420pToBgra<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020Full: Yuv420pToBgra<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            default: assert(0);
+            }
+        }
+
+        void Yuv420pToRgba(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgba, size_t rgbaStride, uint8_t alpha)
+        {
+            Yuv420pToBgra<Base::Rgb<Base::Bt601>>(y, yStride, v, vStride, u, uStride, width, height, rgba, rgbaStride, alpha);
+        }
+
+        template <bool align, class T = Base::Bt601> void Yuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
         {
             assert((width % 2 == 0) && (width >= DA));
@@ -176,7 +203,7 @@ namespace Simd
                     _u = vzipq_u8(_u.val[0], _u.val[1]);
                     _v.val[1] = _v.val[0] = Load<align>(v + colUV);
                     _v = vzipq_u8(_v.val[0], _v.val[1]);
-                    Yuv422pToBgra<align>(y + colY, _u, _v, _alpha, bgra + colBgra);
+                    Yuv422pToBgra<align, T>(y + colY, _u, _v, _alpha, bgra + colBgra);
                 }
                 if (tail)
                 {
@@ -185,7 +212,7 @@ namespace Simd
                     _u = vzipq_u8(_u.val[0], _u.val[1]);
                     _v.val[1] = _v.val[0] = Load<false>(v + offset / 2);
                     _v = vzipq_u8(_v.val[0], _v.val[1]);
-                    Yuv422pToBgra<false>(y + offset, _u, _v, _alpha, bgra + 4 * offset);
+                    Yuv422pToBgra<false, T>(y + offset, _u, _v, _alpha, bgra + 4 * offset);
                 }
                 y += yStride;
                 u += uStride;
@@ -194,17 +221,44 @@ namespace Simd
             }
         }
 
-        void Yuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride))
-                Yuv422pToBgra<true>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+                Yuv422pToBgra<true, T>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
             else
-                Yuv422pToBgra<false>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+                Yuv422pToBgra<false, T>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
         }
 
-        template <bool align> void Yuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        void Yuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            Yuv422pToBgra<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        }
+
+        void Yuv422pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv422pToBgra<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709: Yuv422pToBgra<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020: Yuv422pToBgra<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt601Full: Yuv422pToBgra<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709Full: Yuv422pToBgra<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020Full: Yuv422pToBgra<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            default: assert(0);
+            }
+        }
+
+        void Yuv422pToRgba(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgba, size_t rgbaStride, uint8_t alpha)
+        {
+            Yuv422pToBgra<Base::Rgb<Base::Bt601>>(y, yStride, v, vStride, u, uStride, width, height, rgba, rgbaStride, alpha);
+        }
+
+        template <bool align, class T = Base::Bt601> void Yuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
         {
             assert(width >= A);
@@ -224,7 +278,7 @@ namespace Simd
                     uint8x16_t _y = Load<align>(y + col);
                     uint8x16_t _u = Load<align>(u + col);
                     uint8x16_t _v = Load<align>(v + col);
-                    YuvToBgra<align>(_y, _u, _v, _alpha, bgra + colBgra);
+                    YuvToBgra<align, T>(_y, _u, _v, _alpha, bgra + colBgra);
                 }
                 if (tail)
                 {
@@ -232,7 +286,7 @@ namespace Simd
                     uint8x16_t _y = Load<false>(y + col);
                     uint8x16_t _u = Load<false>(u + col);
                     uint8x16_t _v = Load<false>(v + col);
-                    YuvToBgra<false>(_y, _u, _v, _alpha, bgra + 4 * col);
+                    YuvToBgra<false, T>(_y, _u, _v, _alpha, bgra + 4 * col);
                 }
                 y += yStride;
                 u += uStride;
@@ -241,14 +295,131 @@ namespace Simd
             }
         }
 
-        void Yuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride))
-                Yuv444pToBgra<true>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+                Yuv444pToBgra<true, T>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
             else
-                Yuv444pToBgra<false>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+                Yuv444pToBgra<false, T>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        }
+
+        void Yuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            Yuv444pToBgra<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        }
+
+        void Yuv444pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv444pToBgra<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709: Yuv444pToBgra<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020: Yuv444pToBgra<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt601Full: Yuv444pToBgra<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709Full: Yuv444pToBgra<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020Full: Yuv444pToBgra<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            default: assert(0);
+            }
+        }
+
+        void Yuv444pToRgba(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgba, size_t rgbaStride, uint8_t alpha)
+        {
+            Yuv444pToBgra<Base::Rgb<Base::Bt601>>(y, yStride, v, vStride, u, uStride, width, height, rgba, rgbaStride, alpha);
+        }
+
+        template <bool align, bool nv21, class T> void Nv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
+            if (align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride));
+                assert(Aligned(bgra) && Aligned(bgraStride));
+            }
+
+            uint8x16_t _alpha = vdupq_n_u8(alpha);
+            size_t bodyWidth = AlignLo(width, DA);
+            size_t tail = width - bodyWidth;
+            uint8x16x2_t _u, _v;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0, colBgra = 0; colY < bodyWidth; colY += DA, colBgra += OA)
+                {
+                    LoadUv<align, nv21>(uv + colY, _u.val[0], _v.val[0]);
+                    _u = vzipq_u8(_u.val[0], _u.val[0]);
+                    _v = vzipq_u8(_v.val[0], _v.val[0]);
+                    Yuv422pToBgra<align, T>(y + colY, _u, _v, _alpha, bgra + colBgra);
+                    Yuv422pToBgra<align, T>(y + colY + yStride, _u, _v, _alpha, bgra + colBgra + bgraStride);
+                }
+                if (tail)
+                {
+                    size_t offset = width - DA;
+                    LoadUv<false, nv21>(uv + offset, _u.val[0], _v.val[0]);
+                    _u = vzipq_u8(_u.val[0], _u.val[0]);
+                    _v = vzipq_u8(_v.val[0], _v.val[0]);
+                    Yuv422pToBgra<false, T>(y + offset, _u, _v, _alpha, bgra + 4 * offset);
+                    Yuv422pToBgra<false, T>(y + offset + yStride, _u, _v, _alpha, bgra + 4 * offset + bgraStride);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                bgra += 2 * bgraStride;
+            }
+        }
+
+        template <bool nv21, class T> void Nv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(bgra) && Aligned(bgraStride))
+                Nv12ToBgra<true, nv21, T>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+            else
+                Nv12ToBgra<false, nv21, T>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+        }
+
+        void Nv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            Nv12ToBgra<false, Base::Bt601>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+        }
+
+        void Nv12ToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToBgra<false, Base::Bt601>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709: Nv12ToBgra<false, Base::Bt709>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020: Nv12ToBgra<false, Base::Bt2020>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt601Full: Nv12ToBgra<false, Base::Bt601Full>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709Full: Nv12ToBgra<false, Base::Bt709Full>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020Full: Nv12ToBgra<false, Base::Bt2020Full>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha); break;
+            default: assert(0);
+            }
+        }
+
+        void Nv21ToBgra(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            Nv12ToBgra<true, Base::Bt601>(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha);
+        }
+
+        void Nv21ToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToBgra<true, Base::Bt601>(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709: Nv12ToBgra<true, Base::Bt709>(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020: Nv12ToBgra<true, Base::Bt2020>(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt601Full: Nv12ToBgra<true, Base::Bt601Full>(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709Full: Nv12ToBgra<true, Base::Bt709Full>(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020Full: Nv12ToBgra<true, Base::Bt2020Full>(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha); break;
+            default: assert(0);
+            }
         }
     }
 #endif// SIMD_NEON_ENABLE
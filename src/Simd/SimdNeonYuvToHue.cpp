@@ -44,11 +44,11 @@ namespace Simd
             return PackI32(lo, hi);
         }
 
-        SIMD_INLINE int16x8_t YuvToHue(const int16x8_t & y, const int16x8_t & u, const int16x8_t & v, const float32x4_t & KF_255_DIV_6)
+        template <class T> SIMD_INLINE int16x8_t YuvToHue(const int16x8_t & y, const int16x8_t & u, const int16x8_t & v, const float32x4_t & KF_255_DIV_6)
         {
-            int16x8_t red = SaturateByU8(YuvToRed(y, v));
-            int16x8_t blue = SaturateByU8(YuvToBlue(y, u));
-            int16x8_t green = SaturateByU8(YuvToGreen(y, u, v));
+            int16x8_t red = SaturateByU8(YuvToRed<T>(y, v));
+            int16x8_t blue = SaturateByU8(YuvToBlue<T>(y, u));
+            int16x8_t green = SaturateByU8(YuvToGreen<T>(y, u, v));
             int16x8_t max = vmaxq_s16(blue, vmaxq_s16(green, red));
             int16x8_t min = vminq_s16(blue, vminq_s16(green, red));
             int16x8_t range = vsubq_s16(max, min);
@@ -66,20 +66,20 @@ namespace Simd
             return vandq_s16(vmvnq_s16((int16x8_t)vceqq_s16(range, (int16x8_t)K16_0000)), vandq_s16(MulDiv(dividend, range, KF_255_DIV_6), (int16x8_t)K16_00FF));
         }
 
-        SIMD_INLINE uint8x16_t YuvToHue(const uint8x16_t & y, const uint8x16_t & u, const uint8x16_t & v, const float32x4_t & KF_255_DIV_6)
+        template <class T> SIMD_INLINE uint8x16_t YuvToHue(const uint8x16_t & y, const uint8x16_t & u, const uint8x16_t & v, const float32x4_t & KF_255_DIV_6)
         {
-            uint16x8_t lo = (uint16x8_t)YuvToHue(AdjustY<0>(y), AdjustUV<0>(u), AdjustUV<0>(v), KF_255_DIV_6);
-            uint16x8_t hi = (uint16x8_t)YuvToHue(AdjustY<1>(y), AdjustUV<1>(u), AdjustUV<1>(v), KF_255_DIV_6);
+            uint16x8_t lo = (uint16x8_t)YuvToHue<T>(AdjustY<0, T>(y), AdjustUV<0>(u), AdjustUV<0>(v), KF_255_DIV_6);
+            uint16x8_t hi = (uint16x8_t)YuvToHue<T>(AdjustY<1, T>(y), AdjustUV<1>(u), AdjustUV<1>(v), KF_255_DIV_6);
             return PackU16(lo, hi);
         }
 
-        template <bool align> SIMD_INLINE void Yuv420pToHue(const uint8_t * y, const uint8x16x2_t & u, const uint8x16x2_t & v, uint8_t * hue, const float32x4_t & KF_255_DIV_6)
+        template <bool align, class T> SIMD_INLINE void Yuv420pToHue(const uint8_t * y, const uint8x16x2_t & u, const uint8x16x2_t & v, uint8_t * hue, const float32x4_t & KF_255_DIV_6)
         {
-            Store<align>(hue + 0, YuvToHue(Load<align>(y + 0), u.val[0], v.val[0], KF_255_DIV_6));
-            Store<align>(hue + A, YuvToHue(Load<align>(y + A), u.val[1], v.val[1], KF_255_DIV_6));
+            Store<align>(hue + 0, YuvToHue<T>(Load<align>(y + 0), u.val[0], v.val[0], KF_255_DIV_6));
+            Store<align>(hue + A, YuvToHue<T>(Load<align>(y + A), u.val[1], v.val[1], KF_255_DIV_6));
         }
 
-        template <bool align> void Yuv420pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <bool align, class T> void Yuv420pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * hue, size_t hueStride)
         {
             assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
@@ -101,8 +101,8 @@ namespace Simd
                     _u = vzipq_u8(_u.val[0], _u.val[1]);
                     _v.val[1] = _v.val[0] = Load<align>(v + colUV);
                     _v = vzipq_u8(_v.val[0], _v.val[1]);
-                    Yuv420pToHue<align>(y + col, _u, _v, hue + col, KF_255_DIV_6);
-                    Yuv420pToHue<align>(y + yStride + col, _u, _v, hue + hueStride + col, KF_255_DIV_6);
+                    Yuv420pToHue<align, T>(y + col, _u, _v, hue + col, KF_255_DIV_6);
+                    Yuv420pToHue<align, T>(y + yStride + col, _u, _v, hue + hueStride + col, KF_255_DIV_6);
                 }
                 if (tail)
                 {
@@ -111,8 +111,8 @@ namespace Simd
                     _u = vzipq_u8(_u.val[0], _u.val[1]);
                     _v.val[1] = _v.val[0] = Load<false>(v + col / 2);
                     _v = vzipq_u8(_v.val[0], _v.val[1]);
-                    Yuv420pToHue<false>(y + col, _u, _v, hue + col, KF_255_DIV_6);
-                    Yuv420pToHue<false>(y + yStride + col, _u, _v, hue + hueStride + col, KF_255_DIV_6);
+                    Yuv420pToHue<false, T>(y + col, _u, _v, hue + col, KF_255_DIV_6);
+                    Yuv420pToHue<false, T>(y + yStride + col, _u, _v, hue + hueStride + col, KF_255_DIV_6);
                 }
                 y += 2 * yStride;
                 u += uStride;
@@ -121,16 +121,37 @@ namespace Simd
             }
         }
 
-        void Yuv420pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv420pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * hue, size_t hueStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride) && Aligned(v) && Aligned(vStride) && Aligned(hue) && Aligned(hueStride))
-                Yuv420pToHue<true>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+                Yuv420pToHue<true, T>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
             else
-                Yuv420pToHue<false>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+                Yuv420pToHue<false, T>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
         }
 
-        template <bool align> void Yuv444pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        void Yuv420pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride)
+        {
+            Yuv420pToHue<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+        }
+
+        void Yuv420pToHueV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv420pToHue<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709: Yuv420pToHue<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020: Yuv420pToHue<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt601Full: Yuv420pToHue<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709Full: Yuv420pToHue<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020Full: Yuv420pToHue<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            default: assert(0);
+            }
+        }
+
+        template <bool align, class T> void Yuv444pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * hue, size_t hueStride)
         {
             assert(width >= A);
@@ -146,11 +167,11 @@ namespace Simd
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t col = 0; col < bodyWidth; col += A)
-                    Store<align>(hue + col, YuvToHue(Load<align>(y + col), Load<align>(u + col), Load<align>(v + col), KF_255_DIV_6));
+                    Store<align>(hue + col, YuvToHue<T>(Load<align>(y + col), Load<align>(u + col), Load<align>(v + col), KF_255_DIV_6));
                 if (tail)
                 {
                     size_t col = width - A;
-                    Store<false>(hue + col, YuvToHue(Load<false>(y + col), Load<false>(u + col), Load<false>(v + col), KF_255_DIV_6));
+                    Store<false>(hue + col, YuvToHue<T>(Load<false>(y + col), Load<false>(u + col), Load<false>(v + col), KF_255_DIV_6));
                 }
                 y += yStride;
                 u += uStride;
@@ -159,13 +180,124 @@ namespace Simd
             }
         }
 
-        void Yuv444pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv444pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * hue, size_t hueStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride) && Aligned(v) && Aligned(vStride) && Aligned(hue) && Aligned(hueStride))
-                Yuv444pToHue<true>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+                Yuv444pToHue<true, T>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+            else
+                Yuv444pToHue<false, T>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+        }
+
+        void Yuv444pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride)
+        {
+            Yuv444pToHue<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+        }
+
+        void Yuv444pToHueV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv444pToHue<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709: Yuv444pToHue<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020: Yuv444pToHue<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt601Full: Yuv444pToHue<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709Full: Yuv444pToHue<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020Full: Yuv444pToHue<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            default: assert(0);
+            }
+        }
+
+        template <bool align, bool nv21, class T> void Nv12ToHue(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
+            if (align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride));
+                assert(Aligned(hue) && Aligned(hueStride));
+            }
+
+            const float32x4_t KF_255_DIV_6 = vdupq_n_f32(Base::KF_255_DIV_6);
+            size_t bodyWidth = AlignLo(width, DA);
+            size_t tail = width - bodyWidth;
+            uint8x16x2_t _u, _v;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0; col < bodyWidth; col += DA)
+                {
+                    LoadUv<align, nv21>(uv + col, _u.val[0], _v.val[0]);
+                    _u = vzipq_u8(_u.val[0], _u.val[0]);
+                    _v = vzipq_u8(_v.val[0], _v.val[0]);
+                    Yuv420pToHue<align, T>(y + col, _u, _v, hue + col, KF_255_DIV_6);
+                    Yuv420pToHue<align, T>(y + yStride + col, _u, _v, hue + hueStride + col, KF_255_DIV_6);
+                }
+                if (tail)
+                {
+                    size_t offset = width - DA;
+                    LoadUv<false, nv21>(uv + offset, _u.val[0], _v.val[0]);
+                    _u = vzipq_u8(_u.val[0], _u.val[0]);
+                    _v = vzipq_u8(_v.val[0], _v.val[0]);
+                    Yuv420pToHue<false, T>(y + offset, _u, _v, hue + offset, KF_255_DIV_6);
+                    Yuv420pToHue<false, T>(y + yStride + offset, _u, _v, hue + hueStride + offset, KF_255_DIV_6);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                hue += 2 * hueStride;
+            }
+        }
+
+        template <bool nv21, class T> void Nv12ToHue(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(hue) && Aligned(hueStride))
+                Nv12ToHue<true, nv21, T>(y, yStride, uv, uvStride, width, height, hue, hueStride);
             else
-                Yuv444pToHue<false>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+                Nv12ToHue<false, nv21, T>(y, yStride, uv, uvStride, width, height, hue, hueStride);
+        }
+
+        void Nv12ToHue(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride)
+        {
+            Nv12ToHue<false, Base::Bt601>(y, yStride, uv, uvStride, width, height, hue, hueStride);
+        }
+
+        void Nv12ToHueV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToHue<false, Base::Bt601>(y, yStride, uv, uvStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709: Nv12ToHue<false, Base::Bt709>(y, yStride, uv, uvStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020: Nv12ToHue<false, Base::Bt2020>(y, yStride, uv, uvStride, width, height, hue, hueStride); break;
+            case SimdYuvBt601Full: Nv12ToHue<false, Base::Bt601Full>(y, yStride, uv, uvStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709Full: Nv12ToHue<false, Base::Bt709Full>(y, yStride, uv, uvStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020Full: Nv12ToHue<false, Base::Bt2020Full>(y, yStride, uv, uvStride, width, height, hue, hueStride); break;
+            default: assert(0);
+            }
+        }
+
+        void Nv21ToHue(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride)
+        {
+            Nv12ToHue<true, Base::Bt601>(y, yStride, vu, vuStride, width, height, hue, hueStride);
+        }
+
+        void Nv21ToHueV2(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToHue<true, Base::Bt601>(y, yStride, vu, vuStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709: Nv12ToHue<true, Base::Bt709>(y, yStride, vu, vuStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020: Nv12ToHue<true, Base::Bt2020>(y, yStride, vu, vuStride, width, height, hue, hueStride); break;
+            case SimdYuvBt601Full: Nv12ToHue<true, Base::Bt601Full>(y, yStride, vu, vuStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709Full: Nv12ToHue<true, Base::Bt709Full>(y, yStride, vu, vuStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020Full: Nv12ToHue<true, Base::Bt2020Full>(y, yStride, vu, vuStride, width, height, hue, hueStride); break;
+            default: assert(0);
+            }
         }
     }
 #endif// SIMD_NEON_ENABLE
@@ -55,6 +55,7 @@ namespace Simd
                 return p;
             }
 
+        public:
             SIMD_INLINE __m128 Exp2(__m128 x) const
             {
                 x = _mm_max_ps(_mm_min_ps(x, _mm_set1_ps(129.00000f)), _mm_set1_ps(-126.99999f));
@@ -74,8 +75,6 @@ namespace Simd
                 return _mm_add_ps(_mm_mul_ps(p, _mm_sub_ps(m, _one)), e);
             }
 
-        public:
-
             SIMD_INLINE Pow()
             {
                 _exponent = _mm_set1_epi32(0x7F800000);
@@ -110,6 +109,7 @@ namespace Simd
                 return p;
             }
 
+        public:
             SIMD_INLINE __m256 Exp2(__m256 x) const
             {
                 x = _mm256_max_ps(_mm256_min_ps(x, _mm256_set1_ps(129.00000f)), _mm256_set1_ps(-126.99999f));
@@ -129,8 +129,6 @@ namespace Simd
                 return _mm256_fmadd_ps(p, _mm256_sub_ps(m, _one), e);
             }
 
-        public:
-
             SIMD_INLINE Pow()
             {
                 _exponent = _mm256_set1_epi32(0x7F800000);
@@ -165,6 +163,7 @@ namespace Simd
                 return p;
             }
 
+        public:
             SIMD_INLINE __m512 Exp2(__m512 x) const
             {
                 x = _mm512_max_ps(_mm512_min_ps(x, _mm512_set1_ps(129.00000f)), _mm512_set1_ps(-126.99999f));
@@ -184,8 +183,6 @@ namespace Simd
                 return _mm512_fmadd_ps(p, _mm512_sub_ps(m, _one), e);
             }
 
-        public:
-
             SIMD_INLINE Pow()
             {
                 _exponent = _mm512_set1_epi32(0x7F800000);
@@ -220,6 +217,7 @@ namespace Simd
                 return p;
             }
 
+        public:
             SIMD_INLINE float32x4_t Exp2(float32x4_t x) const
             {
                 x = vmaxq_f32(vminq_f32(x, vdupq_n_f32(129.00000f)), vdupq_n_f32(-126.99999f));
@@ -239,8 +237,6 @@ namespace Simd
                 return vaddq_f32(vmulq_f32(p, vsubq_f32(m, _one)), e);
             }
 
-        public:
-
             SIMD_INLINE Pow()
             {
                 _exponent = vdupq_n_s32(0x7F800000);
@@ -0,0 +1,79 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSegmentation_h__
+#define __SimdSegmentation_h__
+
+#include "Simd/SimdDefs.h"
+
+#if defined(_MSC_VER) && defined(SIMD_X64_ENABLE)
+#include <intrin.h>
+#endif
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE uint32_t FirstBit64(uint64_t value)
+        {
+            assert(value);
+#if defined(_MSC_VER) && defined(SIMD_X64_ENABLE)
+            unsigned long index;
+            _BitScanForward64(&index, value);
+            return (uint32_t)index;
+#elif defined(__GNUC__)
+            return (uint32_t)__builtin_ctzll(value);
+#else
+            uint32_t index = 0;
+            while ((value & 1) == 0)
+            {
+                value >>= 1;
+                index++;
+            }
+            return index;
+#endif
+        }
+
+        /* Converts 'size' bits of row mask (bit i corresponds to column offset + i) into run edges. 
+           'last' keeps the value of the previous column. Even edges are run begins, odd edges are run ends. */
+        SIMD_INLINE void SegmentationMaskToEdges(uint64_t bits, size_t size, uint32_t offset, uint64_t & last, uint32_t * edges, size_t & count)
+        {
+            uint64_t edge = bits ^ ((bits << 1) | last);
+            if (size < 64)
+                edge &= (uint64_t(1) << size) - 1;
+            last = (bits >> (size - 1)) & 1;
+            while (edge)
+            {
+                edges[count++] = offset + FirstBit64(edge);
+                edge &= edge - 1;
+            }
+        }
+
+        typedef size_t(*SegmentationRowEdgesPtr)(const uint8_t * mask, size_t width, uint8_t value, uint32_t * edges);
+
+        size_t SegmentationLabelComponents(const uint8_t * mask, size_t maskStride, size_t width, size_t height, uint8_t value, int connectivity,
+            uint32_t * labels, size_t labelsStride, SimdConnectedComponent * components, size_t capacity, SegmentationRowEdgesPtr rowEdges);
+    }
+}
+
+#endif//__SimdSegmentation_h__
@@ -39,7 +39,7 @@ namespace Simd
 
         SIMD_INLINE __m128i SetInt16(short a0, short a1)
         {
-            return _mm_unpacklo_epi16(_mm_set1_epi16(a0), _mm_set1_epi16(a1));
+            return _mm_set1_epi32(int32_t(uint16_t(a0)) | int32_t(uint32_t(uint16_t(a1)) << 16));
         }
 
         SIMD_INLINE __m128i SetInt32(int a0, int a1)
@@ -74,7 +74,7 @@ namespace Simd
 
         SIMD_INLINE __m256i SetInt16(short a0, short a1)
         {
-            return _mm256_unpacklo_epi16(_mm256_set1_epi16(a0), _mm256_set1_epi16(a1));
+            return _mm256_set1_epi32(int32_t(uint16_t(a0)) | int32_t(uint32_t(uint16_t(a1)) << 16));
         }
 
         SIMD_INLINE __m256i SetInt32(int a0, int a1)
@@ -111,7 +111,7 @@ namespace Simd
 
         SIMD_INLINE __m512i SetInt16(short a0, short a1)
         {
-            return _mm512_unpacklo_epi16(_mm512_set1_epi16(a0), _mm512_set1_epi16(a1));
+            return _mm512_set1_epi32(int32_t(uint16_t(a0)) | int32_t(uint32_t(uint16_t(a1)) << 16));
         }
     }
 #endif// SIMD_AVX512BW_ENABLE
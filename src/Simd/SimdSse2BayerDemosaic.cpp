@@ -0,0 +1,113 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdStore.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdBayer.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        const __m128i K16_BLUE_RED = SIMD_MM_SET2_EPI16(Base::BLUE_TO_GRAY_WEIGHT, Base::RED_TO_GRAY_WEIGHT);
+        const __m128i K16_GREEN_ROUND = SIMD_MM_SET2_EPI16(Base::GREEN_TO_GRAY_WEIGHT, Base::BGR_TO_GRAY_ROUND_TERM);
+
+        SIMD_INLINE __m128i BgrToGray16(__m128i blue, __m128i green, __m128i red)
+        {
+            __m128i lo = _mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(blue, red), K16_BLUE_RED), _mm_madd_epi16(_mm_unpacklo_epi16(green, K16_0001), K16_GREEN_ROUND));
+            __m128i hi = _mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(blue, red), K16_BLUE_RED), _mm_madd_epi16(_mm_unpackhi_epi16(green, K16_0001), K16_GREEN_ROUND));
+            return _mm_packs_epi32(_mm_srli_epi32(lo, Base::BGR_TO_GRAY_AVERAGING_SHIFT), _mm_srli_epi32(hi, Base::BGR_TO_GRAY_AVERAGING_SHIFT));
+        }
+
+        template<size_t channels> SIMD_INLINE void BayerMhcStore(const __m128i bgr[3], const __m128i & alpha, uint8_t * dst);
+
+        template<> SIMD_INLINE void BayerMhcStore<1>(const __m128i bgr[3], const __m128i & alpha, uint8_t * dst)
+        {
+            __m128i even = BgrToGray16(U8To16<0>(bgr[0]), U8To16<0>(bgr[1]), U8To16<0>(bgr[2]));
+            __m128i odd = BgrToGray16(U8To16<1>(bgr[0]), U8To16<1>(bgr[1]), U8To16<1>(bgr[2]));
+            _mm_storeu_si128((__m128i*)dst, _mm_or_si128(even, _mm_slli_epi16(odd, 8)));
+        }
+
+        template<> SIMD_INLINE void BayerMhcStore<4>(const __m128i bgr[3], const __m128i & alpha, uint8_t * dst)
+        {
+            __m128i bgLo = _mm_unpacklo_epi8(bgr[0], bgr[1]);
+            __m128i bgHi = _mm_unpackhi_epi8(bgr[0], bgr[1]);
+            __m128i raLo = _mm_unpacklo_epi8(bgr[2], alpha);
+            __m128i raHi = _mm_unpackhi_epi8(bgr[2], alpha);
+            _mm_storeu_si128((__m128i*)dst + 0, _mm_unpacklo_epi16(bgLo, raLo));
+            _mm_storeu_si128((__m128i*)dst + 1, _mm_unpackhi_epi16(bgLo, raLo));
+            _mm_storeu_si128((__m128i*)dst + 2, _mm_unpacklo_epi16(bgHi, raHi));
+            _mm_storeu_si128((__m128i*)dst + 3, _mm_unpackhi_epi16(bgHi, raHi));
+        }
+
+        template<size_t channels, bool greenOdd> SIMD_INLINE void BayerMhcBody(const uint8_t * src[5], size_t width, bool red, const __m128i & alpha, uint8_t * dst)
+        {
+            size_t body = AlignLo(width - 4, A) + 2, tail = width - 2 - A;
+            __m128i bgr[3];
+            for (size_t col = 2; col < body; col += A)
+            {
+                BayerMhc<greenOdd>(src, col, red, bgr);
+                BayerMhcStore<channels>(bgr, alpha, dst + col * channels);
+            }
+            if (body < width - 2)
+            {
+                BayerMhc<greenOdd>(src, tail, red, bgr);
+                BayerMhcStore<channels>(bgr, alpha, dst + tail * channels);
+            }
+        }
+
+        template<size_t channels> void BayerMhc(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && width >= A + 4);
+
+            const uint8_t * src[5];
+            size_t greenOdd;
+            bool red;
+            __m128i _alpha = _mm_set1_epi8((char)alpha);
+            for (size_t row = 0; row < height; ++row)
+            {
+                Base::BayerMhcRows(bayer, height, bayerStride, row, src);
+                Base::BayerMhcRowInfo(bayerFormat, row, greenOdd, red);
+                Base::BayerMhc<channels>(src, 0, 2, width, greenOdd, red, dst, alpha);
+                if (greenOdd)
+                    BayerMhcBody<channels, true>(src, width, red, _alpha, dst);
+                else
+                    BayerMhcBody<channels, false>(src, width, red, _alpha, dst);
+                Base::BayerMhc<channels>(src, width - 2, width, width, greenOdd, red, dst, alpha);
+                dst += dstStride;
+            }
+        }
+
+        void BayerToBgraMhc(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            BayerMhc<4>(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
+        }
+
+        void BayerToGray(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * gray, size_t grayStride)
+        {
+            BayerMhc<1>(bayer, width, height, bayerStride, bayerFormat, gray, grayStride, 0);
+        }
+    }
+#endif// SIMD_SSE2_ENABLE
+}
@@ -67,6 +67,23 @@ namespace Simd
             Base::BgrToBgra(bgr, width, buffer.bgra, false, true, 0xFF);
             Sse2::BgraToGray(buffer.bgra, width, 1, 4 * width, gray, width);
         }
+
+        void RgbToGray(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * gray, size_t grayStride)
+        {
+            assert(width >= A);
+
+            Buffer buffer(width);
+
+            for (size_t row = 1; row < height; ++row)
+            {
+                Base::BgrToBgra(rgb, width, buffer.bgra, false, false, 0xFF);
+                Sse2::RgbaToGray(buffer.bgra, width, 1, 4 * width, gray, width);
+                rgb += rgbStride;
+                gray += grayStride;
+            }
+            Base::BgrToBgra(rgb, width, buffer.bgra, false, true, 0xFF);
+            Sse2::RgbaToGray(buffer.bgra, width, 1, 4 * width, gray, width);
+        }
     }
 #endif//SIMD_SSE2_ENABLE
 }
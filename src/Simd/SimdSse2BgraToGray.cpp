@@ -30,21 +30,22 @@ namespace Simd
     namespace Sse2
     {
         const __m128i K16_BLUE_RED = SIMD_MM_SET2_EPI16(Base::BLUE_TO_GRAY_WEIGHT, Base::RED_TO_GRAY_WEIGHT);
+        const __m128i K16_RED_BLUE = SIMD_MM_SET2_EPI16(Base::RED_TO_GRAY_WEIGHT, Base::BLUE_TO_GRAY_WEIGHT);
         const __m128i K16_GREEN_0000 = SIMD_MM_SET2_EPI16(Base::GREEN_TO_GRAY_WEIGHT, 0x0000);
         const __m128i K32_ROUND_TERM = SIMD_MM_SET1_EPI32(Base::BGR_TO_GRAY_ROUND_TERM);
 
-        SIMD_INLINE __m128i BgraToGray32(__m128i bgra)
+        template <bool rgb> SIMD_INLINE __m128i BgraToGray32(__m128i bgra)
         {
             const __m128i g0a0 = _mm_and_si128(_mm_srli_si128(bgra, 1), K16_00FF);
             const __m128i b0r0 = _mm_and_si128(bgra, K16_00FF);
-            const __m128i weightedSum = _mm_add_epi32(_mm_madd_epi16(g0a0, K16_GREEN_0000), _mm_madd_epi16(b0r0, K16_BLUE_RED));
+            const __m128i weightedSum = _mm_add_epi32(_mm_madd_epi16(g0a0, K16_GREEN_0000), _mm_madd_epi16(b0r0, rgb ? K16_RED_BLUE : K16_BLUE_RED));
             return _mm_srli_epi32(_mm_add_epi32(weightedSum, K32_ROUND_TERM), Base::BGR_TO_GRAY_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m128i BgraToGray(__m128i bgra[4])
+        template <bool rgb> SIMD_INLINE __m128i BgraToGray(__m128i bgra[4])
         {
-            const __m128i lo = _mm_packs_epi32(BgraToGray32(bgra[0]), BgraToGray32(bgra[1]));
-            const __m128i hi = _mm_packs_epi32(BgraToGray32(bgra[2]), BgraToGray32(bgra[3]));
+            const __m128i lo = _mm_packs_epi32(BgraToGray32<rgb>(bgra[0]), BgraToGray32<rgb>(bgra[1]));
+            const __m128i hi = _mm_packs_epi32(BgraToGray32<rgb>(bgra[2]), BgraToGray32<rgb>(bgra[3]));
             return _mm_packus_epi16(lo, hi);
         }
 
@@ -56,7 +57,7 @@ namespace Simd
             a[3] = Load<align>((__m128i*)p + 3);
         }
 
-        template <bool align> void BgraToGray(const uint8_t *bgra, size_t width, size_t height, size_t bgraStride, uint8_t *gray, size_t grayStride)
+        template <bool align, bool rgb> void BgraToGray(const uint8_t *bgra, size_t width, size_t height, size_t bgraStride, uint8_t *gray, size_t grayStride)
         {
             assert(width >= A);
             if (align)
@@ -69,12 +70,12 @@ namespace Simd
                 for (size_t col = 0; col < alignedWidth; col += A)
                 {
                     Load<align>(bgra + 4 * col, a);
-                    Store<align>((__m128i*)(gray + col), BgraToGray(a));
+                    Store<align>((__m128i*)(gray + col), BgraToGray<rgb>(a));
                 }
                 if (alignedWidth != width)
                 {
                     Load<false>(bgra + 4 * (width - A), a);
-                    Store<false>((__m128i*)(gray + width - A), BgraToGray(a));
+                    Store<false>((__m128i*)(gray + width - A), BgraToGray<rgb>(a));
                 }
                 bgra += bgraStride;
                 gray += grayStride;
@@ -84,9 +85,17 @@ namespace Simd
         void BgraToGray(const uint8_t *bgra, size_t width, size_t height, size_t bgraStride, uint8_t *gray, size_t grayStride)
         {
             if (Aligned(bgra) && Aligned(gray) && Aligned(bgraStride) && Aligned(grayStride))
-                BgraToGray<true>(bgra, width, height, bgraStride, gray, grayStride);
+                BgraToGray<true, false>(bgra, width, height, bgraStride, gray, grayStride);
             else
-                BgraToGray<false>(bgra, width, height, bgraStride, gray, grayStride);
+                BgraToGray<false, false>(bgra, width, height, bgraStride, gray, grayStride);
+        }
+
+        void RgbaToGray(const uint8_t * rgba, size_t width, size_t height, size_t rgbaStride, uint8_t * gray, size_t grayStride)
+        {
+            if (Aligned(rgba) && Aligned(gray) && Aligned(rgbaStride) && Aligned(grayStride))
+                BgraToGray<true, true>(rgba, width, height, rgbaStride, gray, grayStride);
+            else
+                BgraToGray<false, true>(rgba, width, height, rgbaStride, gray, grayStride);
         }
     }
 #endif// SIMD_SSE2_ENABLE
@@ -60,13 +60,13 @@ namespace Simd
             };
         }
 
-        void EstimateAlphaIndexX(size_t srcSize, size_t dstSize, int * indexes, int16_t * alphas)
+        void EstimateAlphaIndexX(size_t srcSize, size_t dstSize, int * indexes, int16_t * alphas, float site)
         {
             float scale = (float)srcSize / dstSize;
 
             for (size_t i = 0; i < dstSize; ++i)
             {
-                float alpha = (float)((i + 0.5)*scale - 0.5);
+                float alpha = (float)((i + (double)site)*scale - site);
                 ptrdiff_t index = (ptrdiff_t)::floor(alpha);
                 alpha -= index;
 
@@ -137,7 +137,7 @@ namespace Simd
 
         template <size_t channelCount> void ResizeBilinear(
             const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
-            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
+            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, float siteX, size_t dstRowBeg, size_t dstRowEnd)
         {
             assert(dstWidth >= A);
 
@@ -153,15 +153,17 @@ namespace Simd
             const size_t stepA = DA / channelCount;
             size_t bufferWidth = AlignHi(dstWidth, stepB);
 
-            Base::EstimateAlphaIndex(srcHeight, dstHeight, buffer.iy, buffer.ay, 1);
+            Base::EstimateAlphaIndex(srcHeight, dstHeight, buffer.iy, buffer.ay, 1, 0.5f);
 
-            EstimateAlphaIndexX(srcWidth, dstWidth, buffer.ix, buffer.ax);
+            EstimateAlphaIndexX(srcWidth, dstWidth, buffer.ix, buffer.ax, siteX);
 
             ptrdiff_t previous = -2;
 
             __m128i a[2];
 
-            for (size_t yDst = 0; yDst < dstHeight; yDst++, dst += dstStride)
+            dst += dstRowBeg*dstStride;
+
+            for (size_t yDst = dstRowBeg; yDst < dstRowEnd; yDst++, dst += dstStride)
             {
                 a[0] = _mm_set1_epi16(int16_t(Base::FRACTION_RANGE - buffer.ay[yDst]));
                 a[1] = _mm_set1_epi16(int16_t(buffer.ay[yDst]));
@@ -197,22 +199,29 @@ namespace Simd
             }
         }
 
-        void ResizeBilinear(
+        void ResizeBilinearRows(
             const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
-            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
+            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount, float siteX, size_t dstRowBeg, size_t dstRowEnd)
         {
             switch (channelCount)
             {
             case 1:
-                ResizeBilinear<1>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                ResizeBilinear<1>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, siteX, dstRowBeg, dstRowEnd);
                 break;
             case 2:
-                ResizeBilinear<2>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                ResizeBilinear<2>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, siteX, dstRowBeg, dstRowEnd);
                 break;
             default:
-                Base::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
+                Base::ResizeBilinearRows(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount, siteX, dstRowBeg, dstRowEnd);
             }
         }
+
+        void ResizeBilinear(
+            const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
+        {
+            ResizeBilinearRows(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount, 0.5f, 0, dstHeight);
+        }
     }
 #endif//SIMD_SSE2_ENABLE
 }
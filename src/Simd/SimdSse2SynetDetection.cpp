@@ -0,0 +1,86 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdExp.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        SIMD_INLINE void SynetDetectionDecode32f(const float * loc, const float * prior, const float * variance, const __m128 & sign, Exp & exp, float * dst)
+        {
+            __m128 _prior = _mm_loadu_ps(prior);
+            __m128 lo = _mm_shuffle_ps(_prior, _prior, 0x44);
+            __m128 hi = _mm_shuffle_ps(_prior, _prior, 0xEE);
+            __m128 size = _mm_sub_ps(hi, lo);
+            __m128 center = _mm_mul_ps(_mm_add_ps(lo, hi), _mm_set1_ps(0.5f));
+            __m128 delta = _mm_mul_ps(_mm_loadu_ps(variance), _mm_loadu_ps(loc));
+            center = _mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(delta, delta, 0x44), size), center);
+            size = _mm_mul_ps(exp.Exponent(_mm_shuffle_ps(delta, delta, 0xEE)), size);
+            _mm_storeu_ps(dst, _mm_add_ps(center, _mm_mul_ps(size, sign)));
+        }
+
+        void SynetDetectionDecode32f(const float * loc, const float * prior, size_t count, float * dst)
+        {
+            const float * variance = prior + count * 4;
+            __m128 sign = _mm_setr_ps(-0.5f, -0.5f, 0.5f, 0.5f);
+            Exp exp;
+            for (size_t i = 0; i < count; ++i, loc += 4, prior += 4, variance += 4, dst += 4)
+                SynetDetectionDecode32f(loc, prior, variance, sign, exp, dst);
+        }
+
+        void SynetDetectionSuppress(const float * boxes, size_t current, size_t end, float threshold, uint32_t * suppressed)
+        {
+            const float * xMin = boxes, *yMin = xMin + end, *xMax = yMin + end, *yMax = xMax + end, *area = yMax + end;
+            __m128 _xMin = _mm_set1_ps(xMin[current]);
+            __m128 _yMin = _mm_set1_ps(yMin[current]);
+            __m128 _xMax = _mm_set1_ps(xMax[current]);
+            __m128 _yMax = _mm_set1_ps(yMax[current]);
+            __m128 _area = _mm_set1_ps(area[current]);
+            __m128 _threshold = _mm_set1_ps(threshold);
+            size_t i = current + 1, endF = i + AlignLo(end - i, F);
+            for (; i < endF; i += F)
+            {
+                __m128 w = _mm_max_ps(_mm_sub_ps(_mm_min_ps(_xMax, _mm_loadu_ps(xMax + i)), _mm_max_ps(_xMin, _mm_loadu_ps(xMin + i))), _mm_setzero_ps());
+                __m128 h = _mm_max_ps(_mm_sub_ps(_mm_min_ps(_yMax, _mm_loadu_ps(yMax + i)), _mm_max_ps(_yMin, _mm_loadu_ps(yMin + i))), _mm_setzero_ps());
+                __m128 intersection = _mm_mul_ps(w, h);
+                __m128 junction = _mm_sub_ps(_mm_add_ps(_area, _mm_loadu_ps(area + i)), intersection);
+                __m128i mask = _mm_castps_si128(_mm_cmpgt_ps(intersection, _mm_mul_ps(_threshold, junction)));
+                __m128i * dst = (__m128i*)(suppressed + i);
+                _mm_storeu_si128(dst, _mm_or_si128(_mm_loadu_si128(dst), mask));
+            }
+            if (i < end)
+                Base::SynetDetectionSuppress(boxes, current, i, end, threshold, suppressed);
+        }
+
+        size_t SynetDetectionNms32f(const float * boxes, const float * scores, size_t count, size_t classes, ptrdiff_t background, float scoreThreshold,
+            float nmsThreshold, size_t topK, size_t keepTopK, SimdBool classAware, float * dst)
+        {
+            return Base::SynetDetectionNms32f(boxes, scores, count, classes, background, scoreThreshold, nmsThreshold, topK, keepTopK, classAware, dst, SynetDetectionSuppress);
+        }
+    }
+#endif// SIMD_SSE2_ENABLE
+}
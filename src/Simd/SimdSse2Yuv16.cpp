@@ -0,0 +1,370 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdArray.h"
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdSse2.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        SIMD_INLINE __m128i Uint16ToGray(const uint16_t * src, __m128i level, __m128i shift)
+        {
+            __m128i lo = _mm_srl_epi16(_mm_adds_epu16(Load<false>((__m128i*)src + 0), level), shift);
+            __m128i hi = _mm_srl_epi16(_mm_adds_epu16(Load<false>((__m128i*)src + 1), level), shift);
+            return _mm_packus_epi16(lo, hi);
+        }
+
+        static void Uint16ToGray(const uint16_t * src, size_t width, size_t row, size_t shift, SimdBool dither, uint8_t * dst)
+        {
+            uint16_t levels[4];
+            Base::Uint16ToGrayLevels(row, shift, dither == SimdTrue, levels);
+            __m128i _level = _mm_setr_epi16(levels[0], levels[1], levels[2], levels[3], levels[0], levels[1], levels[2], levels[3]);
+            __m128i _shift = _mm_cvtsi32_si128((int)shift);
+            size_t alignedWidth = AlignLo(width, A), col = 0;
+            for (; col < alignedWidth; col += A)
+                Store<false>((__m128i*)(dst + col), Uint16ToGray(src + col, _level, _shift));
+            for (; col < width; ++col)
+                dst[col] = Base::Uint16ToGray(src[col], levels[col & 3], shift);
+        }
+
+        void Uint16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, size_t bitDepth, SimdBool dither, uint8_t * dst, size_t dstStride)
+        {
+            assert(bitDepth > 8 && bitDepth <= 16);
+
+            for (size_t row = 0; row < height; ++row)
+            {
+                Uint16ToGray((const uint16_t*)src, width, row, bitDepth - 8, dither, dst);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        SIMD_INLINE void Uint16ToFloat32(const uint16_t * src, __m128 scale, float * dst)
+        {
+            __m128i value = Load<false>((__m128i*)src);
+            _mm_storeu_ps(dst + 0, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(value, K_ZERO)), scale));
+            _mm_storeu_ps(dst + F, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(value, K_ZERO)), scale));
+        }
+
+        void Uint16ToFloat32(const uint8_t * src, size_t width, size_t height, size_t srcStride, size_t bitDepth, uint8_t * dst, size_t dstStride)
+        {
+            assert(bitDepth > 8 && bitDepth <= 16);
+
+            float scale = 1.0f / float((1 << bitDepth) - 1);
+            __m128 _scale = _mm_set1_ps(scale);
+            size_t alignedWidth = AlignLo(width, HA);
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint16_t * s = (const uint16_t*)src;
+                float * d = (float*)dst;
+                size_t col = 0;
+                for (; col < alignedWidth; col += HA)
+                    Uint16ToFloat32(s + col, _scale, d + col);
+                for (; col < width; ++col)
+                    d[col] = float(s[col]) * scale;
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        template<class T> SIMD_INLINE __m128i LoadSamples(const T * src);
+
+        template<> SIMD_INLINE __m128i LoadSamples<uint8_t>(const uint8_t * src)
+        {
+            return _mm_unpacklo_epi8(_mm_loadl_epi64((__m128i*)src), K_ZERO);
+        }
+
+        template<> SIMD_INLINE __m128i LoadSamples<uint16_t>(const uint16_t * src)
+        {
+            return _mm_loadu_si128((__m128i*)src);
+        }
+
+        template<class T> SIMD_INLINE void StoreSamples(T * dst, __m128i value);
+
+        template<> SIMD_INLINE void StoreSamples<uint8_t>(uint8_t * dst, __m128i value)
+        {
+            _mm_storel_epi64((__m128i*)dst, _mm_packus_epi16(value, K_ZERO));
+        }
+
+        template<> SIMD_INLINE void StoreSamples<uint16_t>(uint16_t * dst, __m128i value)
+        {
+            _mm_storeu_si128((__m128i*)dst, value);
+        }
+
+        struct BitDepthConverter
+        {
+            BitDepthConverter(size_t srcBitDepth, size_t dstBitDepth)
+            {
+                int shift = int(srcBitDepth) - int(dstBitDepth);
+                _up = _mm_cvtsi32_si128(shift < 0 ? -shift : 0);
+                _down = _mm_cvtsi32_si128(shift > 0 ? shift : 0);
+                _round = _mm_set1_epi16(shift > 0 ? 1 << (shift - 1) : 0);
+                _max = _mm_set1_epi16((1 << dstBitDepth) - 1);
+                _clamp = shift > 0 && dstBitDepth > 8;
+            }
+
+            SIMD_INLINE __m128i operator()(__m128i value) const
+            {
+                value = _mm_srl_epi16(_mm_adds_epu16(_mm_sll_epi16(value, _up), _round), _down);
+                return _clamp ? _mm_min_epi16(value, _max) : value;
+            }
+
+        private:
+            __m128i _up, _down, _round, _max;
+            bool _clamp;
+        };
+
+        SIMD_INLINE void InterleaveUv16(__m128i u, __m128i v, __m128i uv[2])
+        {
+            uv[0] = _mm_unpacklo_epi16(u, v);
+            uv[1] = _mm_unpackhi_epi16(u, v);
+        }
+
+        SIMD_INLINE __m128i DeinterleaveUv16(__m128i uv)
+        {
+            return _mm_shuffle_epi32(_mm_shufflehi_epi16(_mm_shufflelo_epi16(uv, 0xD8), 0xD8), 0xD8);
+        }
+
+        SIMD_INLINE void DeinterleaveUv16(__m128i uv0, __m128i uv1, __m128i & u, __m128i & v)
+        {
+            uv0 = DeinterleaveUv16(uv0);
+            uv1 = DeinterleaveUv16(uv1);
+            u = _mm_unpacklo_epi64(uv0, uv1);
+            v = _mm_unpackhi_epi64(uv0, uv1);
+        }
+
+        template<class S, class D> void ChangeBitDepth(const uint8_t * src, size_t width, size_t height, size_t srcStride,
+            const BitDepthConverter & converter, uint8_t * dst, size_t dstStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                const S * s = (const S*)src;
+                D * d = (D*)dst;
+                for (size_t col = 0; col < width; col += HA)
+                    StoreSamples(d + col, converter(LoadSamples(s + col)));
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        void ChangeBitDepth(const uint8_t * src, size_t width, size_t height, size_t srcStride, size_t srcBitDepth, size_t dstBitDepth, uint8_t * dst, size_t dstStride)
+        {
+            assert(srcBitDepth >= 8 && srcBitDepth <= 16 && dstBitDepth >= 8 && dstBitDepth <= 16 && width >= HA);
+
+            BitDepthConverter converter(srcBitDepth, dstBitDepth);
+            size_t widthHA = AlignLo(width, HA), srcSize = srcBitDepth > 8 ? 2 : 1, dstSize = dstBitDepth > 8 ? 2 : 1;
+            if (srcSize == 2)
+            {
+                if (dstSize == 2)
+                    ChangeBitDepth<uint16_t, uint16_t>(src, widthHA, height, srcStride, converter, dst, dstStride);
+                else
+                    ChangeBitDepth<uint16_t, uint8_t>(src, widthHA, height, srcStride, converter, dst, dstStride);
+            }
+            else
+            {
+                if (dstSize == 2)
+                    ChangeBitDepth<uint8_t, uint16_t>(src, widthHA, height, srcStride, converter, dst, dstStride);
+                else
+                    ChangeBitDepth<uint8_t, uint8_t>(src, widthHA, height, srcStride, converter, dst, dstStride);
+            }
+            if (widthHA < width)
+                Base::ChangeBitDepth(src + widthHA * srcSize, width - widthHA, height, srcStride, srcBitDepth, dstBitDepth, dst + widthHA * dstSize, dstStride);
+        }
+
+        template<class S, class D> void InterleaveUvBitDepth(const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, const BitDepthConverter & converter, uint8_t * uv, size_t uvStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                const S * su = (const S*)u, * sv = (const S*)v;
+                D * d = (D*)uv;
+                for (size_t col = 0; col < width; col += HA)
+                {
+                    __m128i _uv[2];
+                    InterleaveUv16(converter(LoadSamples(su + col)), converter(LoadSamples(sv + col)), _uv);
+                    StoreSamples(d + 2 * col + 0, _uv[0]);
+                    StoreSamples(d + 2 * col + HA, _uv[1]);
+                }
+                u += uStride;
+                v += vStride;
+                uv += uvStride;
+            }
+        }
+
+        void InterleaveUvBitDepth(const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height,
+            size_t srcBitDepth, size_t dstBitDepth, uint8_t * uv, size_t uvStride)
+        {
+            assert(srcBitDepth >= 8 && srcBitDepth <= 16 && dstBitDepth >= 8 && dstBitDepth <= 16 && width >= HA);
+
+            BitDepthConverter converter(srcBitDepth, dstBitDepth);
+            size_t widthHA = AlignLo(width, HA), srcSize = srcBitDepth > 8 ? 2 : 1, dstSize = dstBitDepth > 8 ? 2 : 1;
+            if (srcSize == 2)
+            {
+                if (dstSize == 2)
+                    InterleaveUvBitDepth<uint16_t, uint16_t>(u, uStride, v, vStride, widthHA, height, converter, uv, uvStride);
+                else
+                    InterleaveUvBitDepth<uint16_t, uint8_t>(u, uStride, v, vStride, widthHA, height, converter, uv, uvStride);
+            }
+            else
+            {
+                if (dstSize == 2)
+                    InterleaveUvBitDepth<uint8_t, uint16_t>(u, uStride, v, vStride, widthHA, height, converter, uv, uvStride);
+                else
+                    InterleaveUvBitDepth<uint8_t, uint8_t>(u, uStride, v, vStride, widthHA, height, converter, uv, uvStride);
+            }
+            if (widthHA < width)
+                Base::InterleaveUvBitDepth(u + widthHA * srcSize, uStride, v + widthHA * srcSize, vStride, width - widthHA, height,
+                    srcBitDepth, dstBitDepth, uv + 2 * widthHA * dstSize, uvStride);
+        }
+
+        template<class S, class D> void DeinterleaveUvBitDepth(const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            const BitDepthConverter & converter, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                const S * s = (const S*)uv;
+                D * du = (D*)u, * dv = (D*)v;
+                for (size_t col = 0; col < width; col += HA)
+                {
+                    __m128i _u, _v;
+                    DeinterleaveUv16(converter(LoadSamples(s + 2 * col + 0)), converter(LoadSamples(s + 2 * col + HA)), _u, _v);
+                    StoreSamples(du + col, _u);
+                    StoreSamples(dv + col, _v);
+                }
+                uv += uvStride;
+                u += uStride;
+                v += vStride;
+            }
+        }
+
+        void DeinterleaveUvBitDepth(const uint8_t * uv, size_t uvStride, size_t width, size_t height, size_t srcBitDepth, size_t dstBitDepth,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            assert(srcBitDepth >= 8 && srcBitDepth <= 16 && dstBitDepth >= 8 && dstBitDepth <= 16 && width >= HA);
+
+            BitDepthConverter converter(srcBitDepth, dstBitDepth);
+            size_t widthHA = AlignLo(width, HA), srcSize = srcBitDepth > 8 ? 2 : 1, dstSize = dstBitDepth > 8 ? 2 : 1;
+            if (srcSize == 2)
+            {
+                if (dstSize == 2)
+                    DeinterleaveUvBitDepth<uint16_t, uint16_t>(uv, uvStride, widthHA, height, converter, u, uStride, v, vStride);
+                else
+                    DeinterleaveUvBitDepth<uint16_t, uint8_t>(uv, uvStride, widthHA, height, converter, u, uStride, v, vStride);
+            }
+            else
+            {
+                if (dstSize == 2)
+                    DeinterleaveUvBitDepth<uint8_t, uint16_t>(uv, uvStride, widthHA, height, converter, u, uStride, v, vStride);
+                else
+                    DeinterleaveUvBitDepth<uint8_t, uint8_t>(uv, uvStride, widthHA, height, converter, u, uStride, v, vStride);
+            }
+            if (widthHA < width)
+                Base::DeinterleaveUvBitDepth(uv + 2 * widthHA * srcSize, uvStride, width - widthHA, height, srcBitDepth, dstBitDepth,
+                    u + widthHA * dstSize, uStride, v + widthHA * dstSize, vStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        struct Yuv16Buffer
+        {
+            Yuv16Buffer(size_t width, uint8_t * external)
+            {
+                yStride = AlignHi(width, A);
+                uvStride = AlignHi(width / 2, A);
+                if (external)
+                    y = (uint8_t*)AlignHi(external, A);
+                else
+                {
+                    _buffer.Resize(yStride * 3 + uvStride * 2);
+                    y = _buffer.data;
+                }
+                uv = y + 2 * yStride;
+                u = uv + yStride;
+                v = u + uvStride;
+            }
+
+            uint8_t * y, * uv, * u, * v;
+            size_t yStride, uvStride;
+        private:
+            Array8u _buffer;
+        };
+
+        static void Yuv420p16ToYuv420p(const uint8_t * y, size_t yStride, const uint8_t * u, const uint8_t * v,
+            size_t width, size_t row, size_t shift, SimdBool dither, Yuv16Buffer & buffer)
+        {
+            Uint16ToGray((const uint16_t*)y, width, row, shift, dither, buffer.y);
+            Uint16ToGray((const uint16_t*)(y + yStride), width, row + 1, shift, dither, buffer.y + buffer.yStride);
+            Uint16ToGray((const uint16_t*)u, width / 2, row / 2, shift, dither, buffer.u);
+            Uint16ToGray((const uint16_t*)v, width / 2, row / 2, shift, dither, buffer.v);
+        }
+
+        static void P016ToYuv420p(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t width, size_t row, SimdBool dither, Yuv16Buffer & buffer)
+        {
+            Uint16ToGray((const uint16_t*)y, width, row, 8, dither, buffer.y);
+            Uint16ToGray((const uint16_t*)(y + yStride), width, row + 1, 8, dither, buffer.y + buffer.yStride);
+            Uint16ToGray((const uint16_t*)uv, width, row / 2, 8, dither, buffer.uv);
+            DeinterleaveUv(buffer.uv, buffer.yStride, width / 2, 1, buffer.u, buffer.uvStride, buffer.v, buffer.uvStride);
+        }
+
+        void Yuv420p16ToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, size_t bitDepth, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdBool dither, SimdYuvType yuvType, uint8_t * buf)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && bitDepth > 8 && bitDepth <= 16);
+
+            Yuv16Buffer buffer(width, buf);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                Yuv420p16ToYuv420p(y, yStride, u, v, width, row, bitDepth - 8, dither, buffer);
+                Yuv420pToBgraV2(buffer.y, buffer.yStride, buffer.u, buffer.uvStride, buffer.v, buffer.uvStride, width, 2, bgra, bgraStride, alpha, yuvType);
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+                bgra += 2 * bgraStride;
+            }
+        }
+
+        void P016ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdBool dither, SimdYuvType yuvType, uint8_t * buf)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA));
+
+            Yuv16Buffer buffer(width, buf);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                P016ToYuv420p(y, yStride, uv, width, row, dither, buffer);
+                Yuv420pToBgraV2(buffer.y, buffer.yStride, buffer.u, buffer.uvStride, buffer.v, buffer.uvStride, width, 2, bgra, bgraStride, alpha, yuvType);
+                y += 2 * yStride;
+                uv += uvStride;
+                bgra += 2 * bgraStride;
+            }
+        }
+    }
+#endif// SIMD_SSE2_ENABLE
+}
@@ -42,11 +42,11 @@ namespace Simd
             return _mm_packs_epi32(quotientLo, quotientHi);
         }
 
-        SIMD_INLINE __m128i AdjustedYuvToHue16(__m128i y, __m128i u, __m128i v, const __m128 & KF_255_DIV_6)
+        template <class T> SIMD_INLINE __m128i AdjustedYuvToHue16(__m128i y, __m128i u, __m128i v, const __m128 & KF_255_DIV_6)
         {
-            const __m128i red = AdjustedYuvToRed16(y, v);
-            const __m128i green = AdjustedYuvToGreen16(y, u, v);
-            const __m128i blue = AdjustedYuvToBlue16(y, u);
+            const __m128i red = AdjustedYuvToRed16<T>(y, v);
+            const __m128i green = AdjustedYuvToGreen16<T>(y, u, v);
+            const __m128i blue = AdjustedYuvToBlue16<T>(y, u);
             const __m128i max = MaxI16(red, green, blue);
             const __m128i range = _mm_subs_epi16(max, MinI16(red, green, blue));
 
@@ -66,25 +66,25 @@ namespace Simd
             return _mm_andnot_si128(_mm_cmpeq_epi16(range, K_ZERO), _mm_and_si128(MulDiv16(dividend, range, KF_255_DIV_6), K16_00FF));
         }
 
-        SIMD_INLINE __m128i YuvToHue16(__m128i y, __m128i u, __m128i v, const __m128 & KF_255_DIV_6)
+        template <class T> SIMD_INLINE __m128i YuvToHue16(__m128i y, __m128i u, __m128i v, const __m128 & KF_255_DIV_6)
         {
-            return AdjustedYuvToHue16(AdjustY16(y), AdjustUV16(u), AdjustUV16(v), KF_255_DIV_6);
+            return AdjustedYuvToHue16<T>(AdjustY16<T>(y), AdjustUV16(u), AdjustUV16(v), KF_255_DIV_6);
         }
 
-        SIMD_INLINE __m128i YuvToHue8(__m128i y, __m128i u, __m128i v, const __m128 & KF_255_DIV_6)
+        template <class T> SIMD_INLINE __m128i YuvToHue8(__m128i y, __m128i u, __m128i v, const __m128 & KF_255_DIV_6)
         {
             return _mm_packus_epi16(
-                YuvToHue16(_mm_unpacklo_epi8(y, K_ZERO), _mm_unpacklo_epi8(u, K_ZERO), _mm_unpacklo_epi8(v, K_ZERO), KF_255_DIV_6),
-                YuvToHue16(_mm_unpackhi_epi8(y, K_ZERO), _mm_unpackhi_epi8(u, K_ZERO), _mm_unpackhi_epi8(v, K_ZERO), KF_255_DIV_6));
+                YuvToHue16<T>(_mm_unpacklo_epi8(y, K_ZERO), _mm_unpacklo_epi8(u, K_ZERO), _mm_unpacklo_epi8(v, K_ZERO), KF_255_DIV_6),
+                YuvToHue16<T>(_mm_unpackhi_epi8(y, K_ZERO), _mm_unpackhi_epi8(u, K_ZERO), _mm_unpackhi_epi8(v, K_ZERO), KF_255_DIV_6));
         }
 
-        template <bool align> SIMD_INLINE void Yuv420pToHue(const uint8_t * y, __m128i u, __m128i v, uint8_t * hue, const __m128 & KF_255_DIV_6)
+        template <bool align, class T> SIMD_INLINE void Yuv420pToHue(const uint8_t * y, __m128i u, __m128i v, uint8_t * hue, const __m128 & KF_255_DIV_6)
         {
-            Store<align>((__m128i*)(hue), YuvToHue8(Load<align>((__m128i*)(y)), _mm_unpacklo_epi8(u, u), _mm_unpacklo_epi8(v, v), KF_255_DIV_6));
-            Store<align>((__m128i*)(hue + A), YuvToHue8(Load<align>((__m128i*)(y + A)), _mm_unpackhi_epi8(u, u), _mm_unpackhi_epi8(v, v), KF_255_DIV_6));
+            Store<align>((__m128i*)(hue), YuvToHue8<T>(Load<align>((__m128i*)(y)), _mm_unpacklo_epi8(u, u), _mm_unpacklo_epi8(v, v), KF_255_DIV_6));
+            Store<align>((__m128i*)(hue + A), YuvToHue8<T>(Load<align>((__m128i*)(y + A)), _mm_unpackhi_epi8(u, u), _mm_unpackhi_epi8(v, v), KF_255_DIV_6));
         }
 
-        template <bool align> void Yuv420pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <bool align, class T> void Yuv420pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * hue, size_t hueStride)
         {
             assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
@@ -104,16 +104,16 @@ namespace Simd
                 {
                     __m128i u_ = Load<align>((__m128i*)(u + colUV));
                     __m128i v_ = Load<align>((__m128i*)(v + colUV));
-                    Yuv420pToHue<align>(y + colY, u_, v_, hue + col_hue, KF_255_DIV_6);
-                    Yuv420pToHue<align>(y + yStride + colY, u_, v_, hue + hueStride + col_hue, KF_255_DIV_6);
+                    Yuv420pToHue<align, T>(y + colY, u_, v_, hue + col_hue, KF_255_DIV_6);
+                    Yuv420pToHue<align, T>(y + yStride + colY, u_, v_, hue + hueStride + col_hue, KF_255_DIV_6);
                 }
                 if (tail)
                 {
                     size_t offset = width - DA;
                     __m128i u_ = Load<false>((__m128i*)(u + offset / 2));
                     __m128i v_ = Load<false>((__m128i*)(v + offset / 2));
-                    Yuv420pToHue<false>(y + offset, u_, v_, hue + offset, KF_255_DIV_6);
-                    Yuv420pToHue<false>(y + yStride + offset, u_, v_, hue + hueStride + offset, KF_255_DIV_6);
+                    Yuv420pToHue<false, T>(y + offset, u_, v_, hue + offset, KF_255_DIV_6);
+                    Yuv420pToHue<false, T>(y + yStride + offset, u_, v_, hue + hueStride + offset, KF_255_DIV_6);
                 }
                 y += 2 * yStride;
                 u += uStride;
@@ -122,7 +122,7 @@ namespace Simd
             }
         }
 
-        template <bool align> void Yuv444pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <bool align, class T> void Yuv444pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * hue, size_t hueStride)
         {
             assert(width >= A);
@@ -140,13 +140,13 @@ namespace Simd
             {
                 for (size_t col = 0; col < bodyWidth; col += A)
                 {
-                    Store<align>((__m128i*)(hue + col), YuvToHue8(Load<align>((__m128i*)(y + col)),
+                    Store<align>((__m128i*)(hue + col), YuvToHue8<T>(Load<align>((__m128i*)(y + col)),
                         Load<align>((__m128i*)(u + col)), Load<align>((__m128i*)(v + col)), KF_255_DIV_6));
                 }
                 if (tail)
                 {
                     size_t offset = width - A;
-                    Store<false>((__m128i*)(hue + offset), YuvToHue8(Load<false>((__m128i*)(y + offset)),
+                    Store<false>((__m128i*)(hue + offset), YuvToHue8<T>(Load<false>((__m128i*)(y + offset)),
                         Load<false>((__m128i*)(u + offset)), Load<false>((__m128i*)(v + offset)), KF_255_DIV_6));
                 }
                 y += yStride;
@@ -156,22 +156,152 @@ namespace Simd
             }
         }
 
+        template <class T> void Yuv420pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride) && Aligned(v) && Aligned(vStride) && Aligned(hue) && Aligned(hueStride))
+                Yuv420pToHue<true, T>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+            else
+                Yuv420pToHue<false, T>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+        }
+
         void Yuv420pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * hue, size_t hueStride)
+        {
+            Yuv420pToHue<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+        }
+
+        void Yuv420pToHueV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv420pToHue<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709: Yuv420pToHue<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020: Yuv420pToHue<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt601Full: Yuv420pToHue<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709Full: Yuv420pToHue<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020Full: Yuv420pToHue<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            default: assert(0);
+            }
+        }
+
+        template <class T> void Yuv444pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride) && Aligned(v) && Aligned(vStride) && Aligned(hue) && Aligned(hueStride))
-                Yuv420pToHue<true>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+                Yuv444pToHue<true, T>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
             else
-                Yuv420pToHue<false>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+                Yuv444pToHue<false, T>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
         }
 
         void Yuv444pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * hue, size_t hueStride)
         {
-            if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride) && Aligned(v) && Aligned(vStride) && Aligned(hue) && Aligned(hueStride))
-                Yuv444pToHue<true>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+            Yuv444pToHue<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+        }
+
+        void Yuv444pToHueV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv444pToHue<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709: Yuv444pToHue<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020: Yuv444pToHue<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt601Full: Yuv444pToHue<Base::Bt601Full>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709Full: Yuv444pToHue<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020Full: Yuv444pToHue<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride); break;
+            default: assert(0);
+            }
+        }
+
+        template <bool align, bool nv21, class T> void Nv12ToHue(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
+            if (align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride));
+                assert(Aligned(hue) && Aligned(hueStride));
+            }
+
+            const __m128 KF_255_DIV_6 = _mm_set_ps1(Base::KF_255_DIV_6);
+
+            size_t bodyWidth = AlignLo(width, DA);
+            size_t tail = width - bodyWidth;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0; col < bodyWidth; col += DA)
+                {
+                    __m128i u_, v_;
+                    LoadUv<align, nv21>(uv + col, u_, v_);
+                    Yuv420pToHue<align, T>(y + col, u_, v_, hue + col, KF_255_DIV_6);
+                    Yuv420pToHue<align, T>(y + yStride + col, u_, v_, hue + hueStride + col, KF_255_DIV_6);
+                }
+                if (tail)
+                {
+                    size_t offset = width - DA;
+                    __m128i u_, v_;
+                    LoadUv<false, nv21>(uv + offset, u_, v_);
+                    Yuv420pToHue<false, T>(y + offset, u_, v_, hue + offset, KF_255_DIV_6);
+                    Yuv420pToHue<false, T>(y + yStride + offset, u_, v_, hue + hueStride + offset, KF_255_DIV_6);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                hue += 2 * hueStride;
+            }
+        }
+
+        template <bool nv21, class T> void Nv12ToHue(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(hue) && Aligned(hueStride))
+                Nv12ToHue<true, nv21, T>(y, yStride, uv, uvStride, width, height, hue, hueStride);
             else
-                Yuv444pToHue<false>(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+                Nv12ToHue<false, nv21, T>(y, yStride, uv, uvStride, width, height, hue, hueStride);
+        }
+
+        void Nv12ToHue(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride)
+        {
+            Nv12ToHue<false, Base::Bt601>(y, yStride, uv, uvStride, width, height, hue, hueStride);
+        }
+
+        void Nv12ToHueV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToHue<false, Base::Bt601>(y, yStride, uv, uvStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709: Nv12ToHue<false, Base::Bt709>(y, yStride, uv, uvStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020: Nv12ToHue<false, Base::Bt2020>(y, yStride, uv, uvStride, width, height, hue, hueStride); break;
+            case SimdYuvBt601Full: Nv12ToHue<false, Base::Bt601Full>(y, yStride, uv, uvStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709Full: Nv12ToHue<false, Base::Bt709Full>(y, yStride, uv, uvStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020Full: Nv12ToHue<false, Base::Bt2020Full>(y, yStride, uv, uvStride, width, height, hue, hueStride); break;
+            default: assert(0);
+            }
+        }
+
+        void Nv21ToHue(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride)
+        {
+            Nv12ToHue<true, Base::Bt601>(y, yStride, vu, vuStride, width, height, hue, hueStride);
+        }
+
+        void Nv21ToHueV2(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+            size_t width, size_t height, uint8_t * hue, size_t hueStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToHue<true, Base::Bt601>(y, yStride, vu, vuStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709: Nv12ToHue<true, Base::Bt709>(y, yStride, vu, vuStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020: Nv12ToHue<true, Base::Bt2020>(y, yStride, vu, vuStride, width, height, hue, hueStride); break;
+            case SimdYuvBt601Full: Nv12ToHue<true, Base::Bt601Full>(y, yStride, vu, vuStride, width, height, hue, hueStride); break;
+            case SimdYuvBt709Full: Nv12ToHue<true, Base::Bt709Full>(y, yStride, vu, vuStride, width, height, hue, hueStride); break;
+            case SimdYuvBt2020Full: Nv12ToHue<true, Base::Bt2020Full>(y, yStride, vu, vuStride, width, height, hue, hueStride); break;
+            default: assert(0);
+            }
         }
     }
 #endif// SIMD_SSE2_ENABLE
@@ -0,0 +1,321 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        SIMD_INLINE __m128i BroadcastAlpha16(__m128i bgra16)
+        {
+            return _mm_shufflehi_epi16(_mm_shufflelo_epi16(bgra16, 0xFF), 0xFF);
+        }
+
+        SIMD_INLINE __m128i AlphaPremultiply16(__m128i bgra16)
+        {
+            return DivideI16By255(_mm_mullo_epi16(bgra16, _mm_blend_epi16(BroadcastAlpha16(bgra16), K16_00FF, 0x88)));
+        }
+
+        SIMD_INLINE void AlphaPremultiply(const uint8_t * src, uint8_t * dst)
+        {
+            __m128i bgra = _mm_loadu_si128((__m128i*)src);
+            __m128i lo = AlphaPremultiply16(_mm_unpacklo_epi8(bgra, K_ZERO));
+            __m128i hi = AlphaPremultiply16(_mm_unpackhi_epi8(bgra, K_ZERO));
+            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(lo, hi));
+        }
+
+        void AlphaPremultiply(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+        {
+            assert(width >= F);
+
+            size_t widthF = AlignLo(width, F);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthF; col += F)
+                    AlphaPremultiply(src + col * 4, dst + col * 4);
+                src += srcStride;
+                dst += dstStride;
+            }
+            if (widthF < width)
+                Base::AlphaPremultiply(src - height * srcStride + widthF * 4, srcStride, width - widthF, height, dst - height * dstStride + widthF * 4, dstStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE __m128i AlphaUnpremultiply32(__m128i bgra32)
+        {
+            __m128i alpha = _mm_shuffle_epi32(bgra32, 0xFF);
+            __m128 dividend = _mm_cvtepi32_ps(_mm_add_epi32(_mm_mullo_epi16(bgra32, K32_000000FF), _mm_srli_epi32(alpha, 1)));
+            __m128i value = _mm_cvttps_epi32(_mm_div_ps(dividend, _mm_cvtepi32_ps(_mm_max_epi32(alpha, K32_00000001))));
+            return _mm_blend_epi16(_mm_andnot_si128(_mm_cmpeq_epi32(alpha, K_ZERO), value), alpha, 0xC0);
+        }
+
+        SIMD_INLINE __m128i AlphaUnpremultiply16(__m128i bgra16)
+        {
+            __m128i lo = AlphaUnpremultiply32(_mm_unpacklo_epi16(bgra16, K_ZERO));
+            __m128i hi = AlphaUnpremultiply32(_mm_unpackhi_epi16(bgra16, K_ZERO));
+            return _mm_packs_epi32(lo, hi);
+        }
+
+        SIMD_INLINE void AlphaUnpremultiply(const uint8_t * src, uint8_t * dst)
+        {
+            __m128i bgra = _mm_loadu_si128((__m128i*)src);
+            __m128i lo = AlphaUnpremultiply16(_mm_unpacklo_epi8(bgra, K_ZERO));
+            __m128i hi = AlphaUnpremultiply16(_mm_unpackhi_epi8(bgra, K_ZERO));
+            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(lo, hi));
+        }
+
+        void AlphaUnpremultiply(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+        {
+            assert(width >= F);
+
+            size_t widthF = AlignLo(width, F);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthF; col += F)
+                    AlphaUnpremultiply(src + col * 4, dst + col * 4);
+                src += srcStride;
+                dst += dstStride;
+            }
+            if (widthF < width)
+                Base::AlphaUnpremultiply(src - height * srcStride + widthF * 4, srcStride, width - widthF, height, dst - height * dstStride + widthF * 4, dstStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE __m128i AlphaBlendingBgraToBgra32(__m128i srcDst, __m128i weight, __m128i half, __m128i divisor)
+        {
+            __m128 dividend = _mm_cvtepi32_ps(_mm_add_epi32(_mm_madd_epi16(srcDst, weight), half));
+            return _mm_cvttps_epi32(_mm_div_ps(dividend, _mm_cvtepi32_ps(divisor)));
+        }
+
+        SIMD_INLINE __m128i AlphaBlendingBgraToBgra16(__m128i src, __m128i dst, __m128i alpha)
+        {
+            __m128i srcAlpha = DivideI16By255(_mm_mullo_epi16(BroadcastAlpha16(src), alpha));
+            __m128i dstAlpha = DivideI16By255(_mm_mullo_epi16(BroadcastAlpha16(dst), _mm_sub_epi16(K16_00FF, srcAlpha)));
+            __m128i sumAlpha = _mm_add_epi16(srcAlpha, dstAlpha);
+            __m128i half = _mm_srli_epi16(sumAlpha, 1);
+            __m128i divisor = _mm_max_epi16(sumAlpha, K16_0001);
+            __m128i lo = AlphaBlendingBgraToBgra32(_mm_unpacklo_epi16(src, dst), _mm_unpacklo_epi16(srcAlpha, dstAlpha),
+                _mm_unpacklo_epi16(half, K_ZERO), _mm_unpacklo_epi16(divisor, K_ZERO));
+            __m128i hi = AlphaBlendingBgraToBgra32(_mm_unpackhi_epi16(src, dst), _mm_unpackhi_epi16(srcAlpha, dstAlpha),
+                _mm_unpackhi_epi16(half, K_ZERO), _mm_unpackhi_epi16(divisor, K_ZERO));
+            return _mm_blend_epi16(_mm_packs_epi32(lo, hi), sumAlpha, 0x88);
+        }
+
+        SIMD_INLINE __m128i AlphaBlendingPremultipliedBgraToBgra16(__m128i src, __m128i dst, __m128i alpha)
+        {
+            src = DivideI16By255(_mm_mullo_epi16(src, alpha));
+            return _mm_add_epi16(src, DivideI16By255(_mm_mullo_epi16(dst, _mm_sub_epi16(K16_00FF, BroadcastAlpha16(src)))));
+        }
+
+        template<bool premultiplied> SIMD_INLINE __m128i AlphaBlendingBgraToBgra16(__m128i src, __m128i dst, __m128i alpha)
+        {
+            return premultiplied ? AlphaBlendingPremultipliedBgraToBgra16(src, dst, alpha) : AlphaBlendingBgraToBgra16(src, dst, alpha);
+        }
+
+        template<bool premultiplied> SIMD_INLINE void AlphaBlendingBgraToBgra(const uint8_t * src, __m128i alpha, uint8_t * dst)
+        {
+            __m128i _src = _mm_loadu_si128((__m128i*)src);
+            __m128i _dst = _mm_loadu_si128((__m128i*)dst);
+            __m128i lo = AlphaBlendingBgraToBgra16<premultiplied>(_mm_unpacklo_epi8(_src, K_ZERO), _mm_unpacklo_epi8(_dst, K_ZERO), alpha);
+            __m128i hi = AlphaBlendingBgraToBgra16<premultiplied>(_mm_unpackhi_epi8(_src, K_ZERO), _mm_unpackhi_epi8(_dst, K_ZERO), alpha);
+            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(lo, hi));
+        }
+
+        template<bool premultiplied> void AlphaBlendingBgraToBgra(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t alpha, uint8_t * dst, size_t dstStride)
+        {
+            size_t widthF = AlignLo(width, F);
+            __m128i _alpha = _mm_set1_epi16(alpha);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthF; col += F)
+                    AlphaBlendingBgraToBgra<premultiplied>(src + col * 4, _alpha, dst + col * 4);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        void AlphaBlendingBgraToBgra(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t alpha, SimdBool premultiplied, uint8_t * dst, size_t dstStride)
+        {
+            assert(width >= F);
+
+            if (premultiplied)
+                AlphaBlendingBgraToBgra<true>(src, srcStride, width, height, alpha, dst, dstStride);
+            else
+                AlphaBlendingBgraToBgra<false>(src, srcStride, width, height, alpha, dst, dstStride);
+            size_t widthF = AlignLo(width, F);
+            if (widthF < width)
+                Base::AlphaBlendingBgraToBgra(src + widthF * 4, srcStride, width - widthF, height, alpha, premultiplied, dst + widthF * 4, dstStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE __m128i RestrictRange32(__m128i value)
+        {
+            return _mm_min_epi32(_mm_max_epi32(value, K_ZERO), K32_000000FF);
+        }
+
+        SIMD_INLINE __m128i Average32(__m128i sum)
+        {
+            return _mm_srli_epi32(_mm_add_epi32(sum, K32_00000002), 2);
+        }
+
+        template <class T> SIMD_INLINE __m128i AlphaBlendingBgraToYuv32(__m128i bgra, __m128i alpha, __m128i y, __m128i & a, __m128i & u, __m128i & v)
+        {
+            __m128i b16_r16 = _mm_and_si128(bgra, K16_00FF);
+            __m128i g16_1 = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(bgra, 8), K32_000000FF), K32_00010000);
+            a = DivideI16By255(_mm_mullo_epi16(_mm_srli_epi32(bgra, 24), alpha));
+            u = DivideI16By255(_mm_mullo_epi16(RestrictRange32(_mm_add_epi32(BgrToU32<T>(b16_r16, g16_1), _mm_set1_epi32(Base::UV_ADJUST))), a));
+            v = DivideI16By255(_mm_mullo_epi16(RestrictRange32(_mm_add_epi32(BgrToV32<T>(b16_r16, g16_1), _mm_set1_epi32(Base::UV_ADJUST))), a));
+            __m128i _y = RestrictRange32(_mm_add_epi32(BgrToY32<T>(b16_r16, g16_1), _mm_set1_epi32(T::Y_ADJUST)));
+            return DivideI16By255(_mm_add_epi16(_mm_mullo_epi16(_y, a), _mm_mullo_epi16(y, _mm_sub_epi16(K32_000000FF, a))));
+        }
+
+        template <class T> SIMD_INLINE void AlphaBlendingBgraToYuv(const uint8_t * bgra, __m128i alpha, uint8_t * y, __m128i a[2], __m128i u[2], __m128i v[2])
+        {
+            __m128i _y = _mm_loadu_si128((__m128i*)y), _a[4], _u[4], _v[4], y32[4];
+            for (size_t i = 0; i < 4; ++i)
+                y32[i] = AlphaBlendingBgraToYuv32<T>(_mm_loadu_si128((__m128i*)bgra + i), alpha, _mm_cvtepu8_epi32(_mm_srli_si128(_y, 4 * i)), _a[i], _u[i], _v[i]);
+            _mm_storeu_si128((__m128i*)y, _mm_packus_epi16(_mm_packs_epi32(y32[0], y32[1]), _mm_packs_epi32(y32[2], y32[3])));
+            for (size_t i = 0; i < 2; ++i)
+            {
+                a[i] = _mm_add_epi32(a[i], _mm_hadd_epi32(_a[2 * i], _a[2 * i + 1]));
+                u[i] = _mm_add_epi32(u[i], _mm_hadd_epi32(_u[2 * i], _u[2 * i + 1]));
+                v[i] = _mm_add_epi32(v[i], _mm_hadd_epi32(_v[2 * i], _v[2 * i + 1]));
+            }
+        }
+
+        template <bool nv12> SIMD_INLINE void LoadChroma(const uint8_t * u, const uint8_t * v, __m128i u32[2], __m128i v32[2])
+        {
+            if (nv12)
+            {
+                __m128i uv = _mm_loadu_si128((__m128i*)u);
+                __m128i _u = _mm_and_si128(uv, K16_00FF), _v = _mm_srli_epi16(uv, 8);
+                u32[0] = _mm_cvtepu16_epi32(_u);
+                u32[1] = _mm_cvtepu16_epi32(_mm_srli_si128(_u, 8));
+                v32[0] = _mm_cvtepu16_epi32(_v);
+                v32[1] = _mm_cvtepu16_epi32(_mm_srli_si128(_v, 8));
+            }
+            else
+            {
+                __m128i _u = _mm_loadl_epi64((__m128i*)u), _v = _mm_loadl_epi64((__m128i*)v);
+                u32[0] = _mm_cvtepu8_epi32(_u);
+                u32[1] = _mm_cvtepu8_epi32(_mm_srli_si128(_u, 4));
+                v32[0] = _mm_cvtepu8_epi32(_v);
+                v32[1] = _mm_cvtepu8_epi32(_mm_srli_si128(_v, 4));
+            }
+        }
+
+        template <bool nv12> SIMD_INLINE void StoreChroma(const __m128i u32[2], const __m128i v32[2], uint8_t * u, uint8_t * v)
+        {
+            __m128i _u = _mm_packs_epi32(u32[0], u32[1]), _v = _mm_packs_epi32(v32[0], v32[1]);
+            if (nv12)
+                _mm_storeu_si128((__m128i*)u, _mm_or_si128(_u, _mm_slli_epi16(_v, 8)));
+            else
+            {
+                _mm_storel_epi64((__m128i*)u, _mm_packus_epi16(_u, K_ZERO));
+                _mm_storel_epi64((__m128i*)v, _mm_packus_epi16(_v, K_ZERO));
+            }
+        }
+
+        template <class T, bool nv12> SIMD_INLINE void AlphaBlendingBgraToYuv420(const uint8_t * bgra, size_t bgraStride, __m128i alpha, uint8_t * y, size_t yStride, uint8_t * u, uint8_t * v)
+        {
+            __m128i a[2] = { K_ZERO, K_ZERO }, _u[2] = { K_ZERO, K_ZERO }, _v[2] = { K_ZERO, K_ZERO }, u32[2], v32[2];
+            AlphaBlendingBgraToYuv<T>(bgra, alpha, y, a, _u, _v);
+            AlphaBlendingBgraToYuv<T>(bgra + bgraStride, alpha, y + yStride, a, _u, _v);
+            LoadChroma<nv12>(u, v, u32, v32);
+            for (size_t i = 0; i < 2; ++i)
+            {
+                __m128i inverse = _mm_sub_epi32(K32_000000FF, Average32(a[i]));
+                u32[i] = _mm_add_epi32(Average32(_u[i]), DivideI16By255(_mm_mullo_epi16(u32[i], inverse)));
+                v32[i] = _mm_add_epi32(Average32(_v[i]), DivideI16By255(_mm_mullo_epi16(v32[i], inverse)));
+            }
+            StoreChroma<nv12>(u32, v32, u, v);
+        }
+
+        template <class T, bool nv12> void AlphaBlendingBgraToYuv420(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t alpha,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            size_t widthA = AlignLo(width, A);
+            __m128i _alpha = _mm_set1_epi32(alpha);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0; colY < widthA; colY += A)
+                {
+                    size_t colUV = nv12 ? colY : colY / 2;
+                    AlphaBlendingBgraToYuv420<T, nv12>(bgra + colY * 4, bgraStride, _alpha, y + colY, yStride, u + colUV, v + colUV);
+                }
+                bgra += 2 * bgraStride;
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+            }
+        }
+
+        template <bool nv12> void AlphaBlendingBgraToYuv420(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t alpha,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: AlphaBlendingBgraToYuv420<Base::Bt601, nv12>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: AlphaBlendingBgraToYuv420<Base::Bt709, nv12>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: AlphaBlendingBgraToYuv420<Base::Bt2020, nv12>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: AlphaBlendingBgraToYuv420<Base::Bt601Full, nv12>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: AlphaBlendingBgraToYuv420<Base::Bt709Full, nv12>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: AlphaBlendingBgraToYuv420<Base::Bt2020Full, nv12>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride); break;
+            default: assert(0);
+            }
+        }
+
+        void AlphaBlendingBgraToYuv420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t alpha,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            assert(width >= A && (width % 2 == 0) && (height % 2 == 0));
+
+            AlphaBlendingBgraToYuv420<false>(bgra, bgraStride, width, height, alpha, y, yStride, u, uStride, v, vStride, yuvType);
+            size_t widthA = AlignLo(width, A);
+            if (widthA < width)
+                Base::AlphaBlendingBgraToYuv420p(bgra + widthA * 4, bgraStride, width - widthA, height, alpha,
+                    y + widthA, yStride, u + widthA / 2, uStride, v + widthA / 2, vStride, yuvType);
+        }
+
+        void AlphaBlendingBgraToNv12(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t alpha,
+            uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            assert(width >= A && (width % 2 == 0) && (height % 2 == 0));
+
+            AlphaBlendingBgraToYuv420<true>(bgra, bgraStride, width, height, alpha, y, yStride, uv, uvStride, uv, uvStride, yuvType);
+            size_t widthA = AlignLo(width, A);
+            if (widthA < width)
+                Base::AlphaBlendingBgraToNv12(bgra + widthA * 4, bgraStride, width - widthA, height, alpha, y + widthA, yStride, uv + widthA, uvStride, yuvType);
+        }
+    }
+#endif// SIMD_SSE41_ENABLE
+}
@@ -0,0 +1,122 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        const __m128i K16_8081 = SIMD_MM_SET1_EPI16(0x8081);
+
+        SIMD_INLINE __m128i DivideBy255(__m128i value)
+        {
+            return _mm_srli_epi16(_mm_mulhi_epu16(value, K16_8081), 7);
+        }
+
+        SIMD_INLINE void HueToBgr16(__m128i hue, __m128i min, __m128i max, __m128i bgr[3])
+        {
+            __m128i hue6 = _mm_mullo_epi16(hue, K16_0006);
+            __m128i sector = DivideBy255(hue6);
+            __m128i delta = DivideBy255(_mm_mullo_epi16(_mm_sub_epi16(max, min), _mm_sub_epi16(hue6, _mm_mullo_epi16(sector, K16_00FF))));
+            __m128i rising = _mm_add_epi16(min, delta);
+            __m128i falling = _mm_sub_epi16(max, delta);
+            __m128i s0 = _mm_or_si128(_mm_cmpeq_epi16(sector, K_ZERO), _mm_cmpeq_epi16(sector, K16_0006));
+            __m128i s1 = _mm_cmpeq_epi16(sector, K16_0001);
+            __m128i s2 = _mm_cmpeq_epi16(sector, K16_0002);
+            __m128i s3 = _mm_cmpeq_epi16(sector, K16_0003);
+            __m128i s4 = _mm_cmpeq_epi16(sector, K16_0004);
+            __m128i s5 = _mm_cmpeq_epi16(sector, K16_0005);
+            bgr[0] = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_or_si128(s0, s1), min), _mm_and_si128(s2, rising)),
+                _mm_or_si128(_mm_and_si128(_mm_or_si128(s3, s4), max), _mm_and_si128(s5, falling)));
+            bgr[1] = _mm_or_si128(_mm_or_si128(_mm_and_si128(s0, rising), _mm_and_si128(_mm_or_si128(s1, s2), max)),
+                _mm_or_si128(_mm_and_si128(s3, falling), _mm_and_si128(_mm_or_si128(s4, s5), min)));
+            bgr[2] = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_or_si128(s0, s5), max), _mm_and_si128(s1, falling)),
+                _mm_or_si128(_mm_and_si128(_mm_or_si128(s2, s3), min), _mm_and_si128(s4, rising)));
+        }
+
+        template<bool hsl, int part> SIMD_INLINE void HsxToBgr16(const __m128i hsx[3], __m128i bgr[3])
+        {
+            __m128i hue = UnpackU8<part>(hsx[0]);
+            __m128i saturation = UnpackU8<part>(hsx[1]);
+            __m128i max = UnpackU8<part>(hsx[2]);
+            if (hsl)
+            {
+                __m128i lightness = max;
+                __m128i dark = DivideBy255(_mm_mullo_epi16(lightness, _mm_add_epi16(K16_00FF, saturation)));
+                __m128i light = DivideBy255(_mm_add_epi16(_mm_mullo_epi16(_mm_sub_epi16(K16_00FF, lightness), saturation), _mm_mullo_epi16(lightness, K16_00FF)));
+                max = _mm_blendv_epi8(dark, light, _mm_cmpgt_epi16(lightness, K16_0080));
+            }
+            __m128i min = DivideBy255(_mm_mullo_epi16(_mm_sub_epi16(K16_00FF, saturation), max));
+            HueToBgr16(hue, min, max, bgr);
+        }
+
+        template<bool hsl> SIMD_INLINE void HsxToBgr(const uint8_t * hsx, uint8_t * bgr)
+        {
+            __m128i src[3], planar[3], lo[3], hi[3];
+            src[0] = _mm_loadu_si128((__m128i*)hsx + 0);
+            src[1] = _mm_loadu_si128((__m128i*)hsx + 1);
+            src[2] = _mm_loadu_si128((__m128i*)hsx + 2);
+            planar[0] = BgrToBlue(src);
+            planar[1] = BgrToGreen(src);
+            planar[2] = BgrToRed(src);
+            HsxToBgr16<hsl, 0>(planar, lo);
+            HsxToBgr16<hsl, 1>(planar, hi);
+            __m128i blue = _mm_packus_epi16(lo[0], hi[0]);
+            __m128i green = _mm_packus_epi16(lo[1], hi[1]);
+            __m128i red = _mm_packus_epi16(lo[2], hi[2]);
+            _mm_storeu_si128((__m128i*)bgr + 0, InterleaveBgr<0>(blue, green, red));
+            _mm_storeu_si128((__m128i*)bgr + 1, InterleaveBgr<1>(blue, green, red));
+            _mm_storeu_si128((__m128i*)bgr + 2, InterleaveBgr<2>(blue, green, red));
+        }
+
+        template<bool hsl> void HsxToBgr(const uint8_t * hsx, size_t width, size_t height, size_t hsxStride, uint8_t * bgr, size_t bgrStride)
+        {
+            assert(width >= A);
+
+            size_t widthA = AlignLo(width, A), tail = (width - A) * 3;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA * 3; col += A * 3)
+                    HsxToBgr<hsl>(hsx + col, bgr + col);
+                if (widthA < width)
+                    HsxToBgr<hsl>(hsx + tail, bgr + tail);
+                hsx += hsxStride;
+                bgr += bgrStride;
+            }
+        }
+
+        void HslToBgr(const uint8_t * hsl, size_t width, size_t height, size_t hslStride, uint8_t * bgr, size_t bgrStride)
+        {
+            HsxToBgr<true>(hsl, width, height, hslStride, bgr, bgrStride);
+        }
+
+        void HsvToBgr(const uint8_t * hsv, size_t width, size_t height, size_t hsvStride, uint8_t * bgr, size_t bgrStride)
+        {
+            HsxToBgr<false>(hsv, width, height, hsvStride, bgr, bgrStride);
+        }
+    }
+#endif// SIMD_SSE41_ENABLE
+}
@@ -0,0 +1,266 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdLab.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        SIMD_INLINE __m128 LabCbrt(__m128 x)
+        {
+            __m128 k = _mm_set1_ps(1.0f / 3.0f);
+            __m128i i = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(_mm_castps_si128(x)), k));
+            __m128 y = _mm_castsi128_ps(_mm_add_epi32(i, _mm_set1_epi32(Base::LAB_CBRT_MAGIC)));
+            for (int n = 0; n < 3; ++n)
+                y = _mm_mul_ps(_mm_add_ps(_mm_add_ps(y, y), _mm_div_ps(x, _mm_mul_ps(y, y))), k);
+            return y;
+        }
+
+        SIMD_INLINE __m128 LabF(__m128 t)
+        {
+            __m128 linear = _mm_add_ps(_mm_mul_ps(t, _mm_set1_ps(Base::LAB_SLOPE)), _mm_set1_ps(Base::LAB_BIAS));
+            return _mm_blendv_ps(linear, LabCbrt(t), _mm_cmpgt_ps(t, _mm_set1_ps(Base::LAB_T_THRESHOLD)));
+        }
+
+        SIMD_INLINE __m128 LabFInv(__m128 f)
+        {
+            __m128 linear = _mm_mul_ps(_mm_sub_ps(f, _mm_set1_ps(Base::LAB_BIAS)), _mm_set1_ps(Base::LAB_SLOPE_INV));
+            return _mm_blendv_ps(linear, _mm_mul_ps(_mm_mul_ps(f, f), f), _mm_cmpgt_ps(f, _mm_set1_ps(Base::LAB_F_THRESHOLD)));
+        }
+
+        SIMD_INLINE __m128 Combine(__m128 a, __m128 b, __m128 c, float ka, float kb, float kc)
+        {
+            return _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, _mm_set1_ps(ka)), _mm_mul_ps(b, _mm_set1_ps(kb))), _mm_mul_ps(c, _mm_set1_ps(kc)));
+        }
+
+        SIMD_INLINE __m128 LabDecode(const uint8_t * bgr, const float * decode)
+        {
+            return _mm_setr_ps(decode[bgr[0]], decode[bgr[3]], decode[bgr[6]], decode[bgr[9]]);
+        }
+
+        SIMD_INLINE void BgrToLab(const uint8_t * bgr, const float * decode, __m128 lab[3])
+        {
+            __m128 b = LabDecode(bgr + 0, decode), g = LabDecode(bgr + 1, decode), r = LabDecode(bgr + 2, decode);
+            __m128 fx = LabF(Combine(r, g, b, Base::LAB_X_R, Base::LAB_X_G, Base::LAB_X_B));
+            __m128 fy = LabF(Combine(r, g, b, Base::LAB_Y_R, Base::LAB_Y_G, Base::LAB_Y_B));
+            __m128 fz = LabF(Combine(r, g, b, Base::LAB_Z_R, Base::LAB_Z_G, Base::LAB_Z_B));
+            lab[0] = _mm_sub_ps(_mm_mul_ps(fy, _mm_set1_ps(Base::LAB_L_SCALE)), _mm_set1_ps(Base::LAB_L_SHIFT));
+            lab[1] = _mm_mul_ps(_mm_sub_ps(fx, fy), _mm_set1_ps(Base::LAB_A_SCALE));
+            lab[2] = _mm_mul_ps(_mm_sub_ps(fy, fz), _mm_set1_ps(Base::LAB_B_SCALE));
+        }
+
+        SIMD_INLINE __m128i LabEncode(__m128 value, const float * encode)
+        {
+            value = _mm_mul_ps(_mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(1.0f)), _mm_set1_ps(float(Base::LAB_GAMMA_SIZE)));
+            __m128i index = _mm_min_epi32(_mm_cvttps_epi32(value), _mm_set1_epi32(Base::LAB_GAMMA_SIZE - 1));
+            SIMD_ALIGNED(16) int32_t i[4];
+            _mm_store_si128((__m128i*)i, index);
+            __m128 lo = _mm_setr_ps(encode[i[0]], encode[i[1]], encode[i[2]], encode[i[3]]);
+            __m128 hi = _mm_setr_ps(encode[i[0] + 1], encode[i[1] + 1], encode[i[2] + 1], encode[i[3] + 1]);
+            return _mm_cvtps_epi32(_mm_add_ps(lo, _mm_mul_ps(_mm_sub_ps(hi, lo), _mm_sub_ps(value, _mm_cvtepi32_ps(index)))));
+        }
+
+        SIMD_INLINE void LabToBgr(__m128 l, __m128 a, __m128 b, const float * encode, __m128i bgr[3])
+        {
+            __m128 fy = _mm_mul_ps(_mm_add_ps(l, _mm_set1_ps(Base::LAB_L_SHIFT)), _mm_set1_ps(Base::LAB_L_SCALE_INV));
+            __m128 fx = _mm_add_ps(fy, _mm_mul_ps(a, _mm_set1_ps(Base::LAB_A_SCALE_INV)));
+            __m128 fz = _mm_sub_ps(fy, _mm_mul_ps(b, _mm_set1_ps(Base::LAB_B_SCALE_INV)));
+            __m128 x = LabFInv(fx), y = LabFInv(fy), z = LabFInv(fz);
+            bgr[0] = LabEncode(Combine(x, y, z, Base::LAB_B_X, Base::LAB_B_Y, Base::LAB_B_Z), encode);
+            bgr[1] = LabEncode(Combine(x, y, z, Base::LAB_G_X, Base::LAB_G_Y, Base::LAB_G_Z), encode);
+            bgr[2] = LabEncode(Combine(x, y, z, Base::LAB_R_X, Base::LAB_R_Y, Base::LAB_R_Z), encode);
+        }
+
+        SIMD_INLINE __m128i PackI32ToU8(const __m128i src[4])
+        {
+            return _mm_packus_epi16(_mm_packs_epi32(src[0], src[1]), _mm_packs_epi32(src[2], src[3]));
+        }
+
+        SIMD_INLINE void StoreBgr(const __m128i blue[4], const __m128i green[4], const __m128i red[4], uint8_t * dst)
+        {
+            __m128i b = PackI32ToU8(blue), g = PackI32ToU8(green), r = PackI32ToU8(red);
+            _mm_storeu_si128((__m128i*)dst + 0, InterleaveBgr<0>(b, g, r));
+            _mm_storeu_si128((__m128i*)dst + 1, InterleaveBgr<1>(b, g, r));
+            _mm_storeu_si128((__m128i*)dst + 2, InterleaveBgr<2>(b, g, r));
+        }
+
+        SIMD_INLINE void LoadBgr(const uint8_t * src, __m128i & blue, __m128i & green, __m128i & red)
+        {
+            __m128i _src[3];
+            _src[0] = _mm_loadu_si128((__m128i*)src + 0);
+            _src[1] = _mm_loadu_si128((__m128i*)src + 1);
+            _src[2] = _mm_loadu_si128((__m128i*)src + 2);
+            blue = BgrToBlue(_src);
+            green = BgrToGreen(_src);
+            red = BgrToRed(_src);
+        }
+
+        template<int part> SIMD_INLINE __m128 LoadU8ToF32(__m128i value)
+        {
+            return _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(value, part * 4)));
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void BgrToLab(const uint8_t * bgr, const float * decode, uint8_t * lab)
+        {
+            __m128i l[4], a[4], b[4];
+            for (size_t i = 0; i < 4; ++i)
+            {
+                __m128 _lab[3];
+                BgrToLab(bgr + i * 12, decode, _lab);
+                l[i] = _mm_cvtps_epi32(_mm_mul_ps(_lab[0], _mm_set1_ps(Base::LAB_L_TO_8U)));
+                a[i] = _mm_cvtps_epi32(_mm_add_ps(_lab[1], _mm_set1_ps(Base::LAB_AB_SHIFT)));
+                b[i] = _mm_cvtps_epi32(_mm_add_ps(_lab[2], _mm_set1_ps(Base::LAB_AB_SHIFT)));
+            }
+            StoreBgr(l, a, b, lab);
+        }
+
+        void BgrToLab(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * lab, size_t labStride)
+        {
+            assert(width >= A);
+
+            const float * decode = Base::GetLabGamma().decode;
+            size_t widthA = AlignLo(width, A), tail = (width - A) * 3;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA * 3; col += A * 3)
+                    BgrToLab(bgr + col, decode, lab + col);
+                if (widthA < width)
+                    BgrToLab(bgr + tail, decode, lab + tail);
+                bgr += bgrStride;
+                lab += labStride;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void BgrToLab32f(const uint8_t * bgr, const float * decode, float * lab)
+        {
+            __m128 _lab[3];
+            BgrToLab(bgr, decode, _lab);
+            StoreLab32f(_lab, lab);
+        }
+
+        void BgrToLab32f(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * lab, size_t labStride)
+        {
+            assert(width >= F);
+
+            const float * decode = Base::GetLabGamma().decode;
+            size_t widthF = AlignLo(width, F), tail = (width - F) * 3;
+            for (size_t row = 0; row < height; ++row)
+            {
+                float * pLab = (float*)lab;
+                for (size_t col = 0; col < widthF * 3; col += F * 3)
+                    BgrToLab32f(bgr + col, decode, pLab + col);
+                if (widthF < width)
+                    BgrToLab32f(bgr + tail, decode, pLab + tail);
+                bgr += bgrStride;
+                lab += labStride;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        template<int part> SIMD_INLINE void LabToBgr(__m128i l, __m128i a, __m128i b, const float * encode, __m128i blue[4], __m128i green[4], __m128i red[4])
+        {
+            __m128 _l = _mm_mul_ps(LoadU8ToF32<part>(l), _mm_set1_ps(Base::LAB_8U_TO_L));
+            __m128 _a = _mm_sub_ps(LoadU8ToF32<part>(a), _mm_set1_ps(Base::LAB_AB_SHIFT));
+            __m128 _b = _mm_sub_ps(LoadU8ToF32<part>(b), _mm_set1_ps(Base::LAB_AB_SHIFT));
+            __m128i bgr[3];
+            LabToBgr(_l, _a, _b, encode, bgr);
+            blue[part] = bgr[0];
+            green[part] = bgr[1];
+            red[part] = bgr[2];
+        }
+
+        SIMD_INLINE void LabToBgr(const uint8_t * lab, const float * encode, uint8_t * bgr)
+        {
+            __m128i l, a, b, blue[4], green[4], red[4];
+            LoadBgr(lab, l, a, b);
+            LabToBgr<0>(l, a, b, encode, blue, green, red);
+            LabToBgr<1>(l, a, b, encode, blue, green, red);
+            LabToBgr<2>(l, a, b, encode, blue, green, red);
+            LabToBgr<3>(l, a, b, encode, blue, green, red);
+            StoreBgr(blue, green, red, bgr);
+        }
+
+        void LabToBgr(const uint8_t * lab, size_t width, size_t height, size_t labStride, uint8_t * bgr, size_t bgrStride)
+        {
+            assert(width >= A);
+
+            const float * encode = Base::GetLabGamma().encode;
+            size_t widthA = AlignLo(width, A), tail = (width - A) * 3;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA * 3; col += A * 3)
+                    LabToBgr(lab + col, encode, bgr + col);
+                if (widthA < width)
+                    LabToBgr(lab + tail, encode, bgr + tail);
+                lab += labStride;
+                bgr += bgrStride;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void Lab32fToBgr(const float * lab, const float * encode, uint8_t * bgr)
+        {
+            __m128i blue[4], green[4], red[4];
+            for (size_t i = 0; i < 4; ++i)
+            {
+                __m128 _lab[3];
+                __m128i _bgr[3];
+                LoadLab32f(lab + i * 12, _lab);
+                LabToBgr(_lab[0], _lab[1], _lab[2], encode, _bgr);
+                blue[i] = _bgr[0];
+                green[i] = _bgr[1];
+                red[i] = _bgr[2];
+            }
+            StoreBgr(blue, green, red, bgr);
+        }
+
+        void Lab32fToBgr(const uint8_t * lab, size_t width, size_t height, size_t labStride, uint8_t * bgr, size_t bgrStride)
+        {
+            assert(width >= A);
+
+            const float * encode = Base::GetLabGamma().encode;
+            size_t widthA = AlignLo(width, A), tail = (width - A) * 3;
+            for (size_t row = 0; row < height; ++row)
+            {
+                const float * pLab = (const float*)lab;
+                for (size_t col = 0; col < widthA * 3; col += A * 3)
+                    Lab32fToBgr(pLab + col, encode, bgr + col);
+                if (widthA < width)
+                    Lab32fToBgr(pLab + tail, encode, bgr + tail);
+                lab += labStride;
+                bgr += bgrStride;
+            }
+        }
+    }
+#endif// SIMD_SSE41_ENABLE
+}
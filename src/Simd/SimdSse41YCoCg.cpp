@@ -0,0 +1,118 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        SIMD_INLINE __m128i BgrToYCoCgR(__m128i blue, __m128i green, __m128i red, int16_t * co, int16_t * cg)
+        {
+            __m128i _co = _mm_sub_epi16(red, blue);
+            __m128i t = _mm_add_epi16(blue, _mm_srai_epi16(_co, 1));
+            __m128i _cg = _mm_sub_epi16(green, t);
+            _mm_storeu_si128((__m128i*)co, _co);
+            _mm_storeu_si128((__m128i*)cg, _cg);
+            return _mm_add_epi16(t, _mm_srai_epi16(_cg, 1));
+        }
+
+        SIMD_INLINE void BgrToYCoCgR(const uint8_t * bgr, uint8_t * y, int16_t * co, int16_t * cg)
+        {
+            __m128i _bgr[3];
+            _bgr[0] = _mm_loadu_si128((__m128i*)bgr + 0);
+            _bgr[1] = _mm_loadu_si128((__m128i*)bgr + 1);
+            _bgr[2] = _mm_loadu_si128((__m128i*)bgr + 2);
+            __m128i blue = BgrToBlue(_bgr), green = BgrToGreen(_bgr), red = BgrToRed(_bgr);
+            __m128i lo = BgrToYCoCgR(UnpackU8<0>(blue), UnpackU8<0>(green), UnpackU8<0>(red), co + 0, cg + 0);
+            __m128i hi = BgrToYCoCgR(UnpackU8<1>(blue), UnpackU8<1>(green), UnpackU8<1>(red), co + HA, cg + HA);
+            _mm_storeu_si128((__m128i*)y, _mm_packus_epi16(lo, hi));
+        }
+
+        void BgrToYCoCgR(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * co, size_t coStride, uint8_t * cg, size_t cgStride)
+        {
+            assert(width >= A);
+
+            size_t widthA = AlignLo(width, A), tail = width - A;
+            for (size_t row = 0; row < height; ++row)
+            {
+                int16_t * pCo = (int16_t*)co, * pCg = (int16_t*)cg;
+                for (size_t col = 0; col < widthA; col += A)
+                    BgrToYCoCgR(bgr + col * 3, y + col, pCo + col, pCg + col);
+                if (widthA < width)
+                    BgrToYCoCgR(bgr + tail * 3, y + tail, pCo + tail, pCg + tail);
+                bgr += bgrStride;
+                y += yStride;
+                co += coStride;
+                cg += cgStride;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void YCoCgRToBgr(__m128i y, const int16_t * co, const int16_t * cg, __m128i & blue, __m128i & green, __m128i & red)
+        {
+            __m128i _co = _mm_loadu_si128((__m128i*)co);
+            __m128i _cg = _mm_loadu_si128((__m128i*)cg);
+            __m128i t = _mm_sub_epi16(y, _mm_srai_epi16(_cg, 1));
+            blue = _mm_sub_epi16(t, _mm_srai_epi16(_co, 1));
+            green = _mm_add_epi16(_cg, t);
+            red = _mm_add_epi16(blue, _co);
+        }
+
+        SIMD_INLINE void YCoCgRToBgr(const uint8_t * y, const int16_t * co, const int16_t * cg, uint8_t * bgr)
+        {
+            __m128i _y = _mm_loadu_si128((__m128i*)y), blue[2], green[2], red[2];
+            YCoCgRToBgr(UnpackU8<0>(_y), co + 0, cg + 0, blue[0], green[0], red[0]);
+            YCoCgRToBgr(UnpackU8<1>(_y), co + HA, cg + HA, blue[1], green[1], red[1]);
+            __m128i b = _mm_packus_epi16(blue[0], blue[1]);
+            __m128i g = _mm_packus_epi16(green[0], green[1]);
+            __m128i r = _mm_packus_epi16(red[0], red[1]);
+            _mm_storeu_si128((__m128i*)bgr + 0, InterleaveBgr<0>(b, g, r));
+            _mm_storeu_si128((__m128i*)bgr + 1, InterleaveBgr<1>(b, g, r));
+            _mm_storeu_si128((__m128i*)bgr + 2, InterleaveBgr<2>(b, g, r));
+        }
+
+        void YCoCgRToBgr(const uint8_t * y, size_t yStride, const uint8_t * co, size_t coStride, const uint8_t * cg, size_t cgStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            assert(width >= A);
+
+            size_t widthA = AlignLo(width, A), tail = width - A;
+            for (size_t row = 0; row < height; ++row)
+            {
+                const int16_t * pCo = (const int16_t*)co, * pCg = (const int16_t*)cg;
+                for (size_t col = 0; col < widthA; col += A)
+                    YCoCgRToBgr(y + col, pCo + col, pCg + col, bgr + col * 3);
+                if (widthA < width)
+                    YCoCgRToBgr(y + tail, pCo + tail, pCg + tail, bgr + tail * 3);
+                y += yStride;
+                co += coStride;
+                cg += cgStride;
+                bgr += bgrStride;
+            }
+        }
+    }
+#endif// SIMD_SSE41_ENABLE
+}
@@ -0,0 +1,124 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdStore.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdBayer.h"
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSSE3_ENABLE    
+    namespace Ssse3
+    {
+        SIMD_INLINE void BayerMhcStore(const __m128i bgr[3], uint8_t * dst)
+        {
+            _mm_storeu_si128((__m128i*)dst + 0, InterleaveBgr<0>(bgr[0], bgr[1], bgr[2]));
+            _mm_storeu_si128((__m128i*)dst + 1, InterleaveBgr<1>(bgr[0], bgr[1], bgr[2]));
+            _mm_storeu_si128((__m128i*)dst + 2, InterleaveBgr<2>(bgr[0], bgr[1], bgr[2]));
+        }
+
+        template<bool greenOdd> SIMD_INLINE void BayerMhcBody(const uint8_t * src[5], size_t width, bool red, uint8_t * bgr)
+        {
+            size_t body = AlignLo(width - 4, A) + 2, tail = width - 2 - A;
+            __m128i _bgr[3];
+            for (size_t col = 2; col < body; col += A)
+            {
+                Sse2::BayerMhc<greenOdd>(src, col, red, _bgr);
+                BayerMhcStore(_bgr, bgr + col * 3);
+            }
+            if (body < width - 2)
+            {
+                Sse2::BayerMhc<greenOdd>(src, tail, red, _bgr);
+                BayerMhcStore(_bgr, bgr + tail * 3);
+            }
+        }
+
+        void BayerToBgrMhc(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && width >= A + 4);
+
+            const uint8_t * src[5];
+            size_t greenOdd;
+            bool red;
+            for (size_t row = 0; row < height; ++row)
+            {
+                Base::BayerMhcRows(bayer, height, bayerStride, row, src);
+                Base::BayerMhcRowInfo(bayerFormat, row, greenOdd, red);
+                Base::BayerMhc<3>(src, 0, 2, width, greenOdd, red, bgr, 0);
+                if (greenOdd)
+                    BayerMhcBody<true>(src, width, red, bgr);
+                else
+                    BayerMhcBody<false>(src, width, red, bgr);
+                Base::BayerMhc<3>(src, width - 2, width, width, greenOdd, red, bgr, 0);
+                bgr += bgrStride;
+            }
+        }
+
+        template <SimdPixelFormatType bayerFormat> void BayerToBgrHalf(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, uint8_t * bgr, size_t bgrStride)
+        {
+            size_t widthDA = AlignLo(width, DA);
+            __m128i _bgr[3];
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0; col < widthDA; col += DA)
+                {
+                    Sse2::BayerToBgrHalf<bayerFormat>(bayer + col, bayer + bayerStride + col, _bgr);
+                    BayerMhcStore(_bgr, bgr + col / 2 * 3);
+                }
+                if (widthDA != width)
+                {
+                    size_t col = width - DA;
+                    Sse2::BayerToBgrHalf<bayerFormat>(bayer + col, bayer + bayerStride + col, _bgr);
+                    BayerMhcStore(_bgr, bgr + col / 2 * 3);
+                }
+                bayer += 2 * bayerStride;
+                bgr += bgrStride;
+            }
+        }
+
+        void BayerToBgrHalf(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && width >= DA);
+
+            switch (bayerFormat)
+            {
+            case SimdPixelFormatBayerGrbg:
+                BayerToBgrHalf<SimdPixelFormatBayerGrbg>(bayer, width, height, bayerStride, bgr, bgrStride);
+                break;
+            case SimdPixelFormatBayerGbrg:
+                BayerToBgrHalf<SimdPixelFormatBayerGbrg>(bayer, width, height, bayerStride, bgr, bgrStride);
+                break;
+            case SimdPixelFormatBayerRggb:
+                BayerToBgrHalf<SimdPixelFormatBayerRggb>(bayer, width, height, bayerStride, bgr, bgrStride);
+                break;
+            case SimdPixelFormatBayerBggr:
+                BayerToBgrHalf<SimdPixelFormatBayerBggr>(bayer, width, height, bayerStride, bgr, bgrStride);
+                break;
+            default:
+                assert(0);
+            }
+        }
+    }
+#endif// SIMD_SSSE3_ENABLE
+}
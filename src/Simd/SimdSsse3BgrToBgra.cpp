@@ -37,7 +37,7 @@ namespace Simd
             Store<align>((__m128i*)bgra + 3, _mm_or_si128(alpha, _mm_shuffle_epi8(_mm_srli_si128(Load<align>((__m128i*)(bgr + 32)), 4), shuffle)));
         }
 
-        template <bool align> void BgrToBgra(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        template <bool align, bool rgb> void BgrToBgra(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
         {
             assert(width >= A);
             if (align)
@@ -46,7 +46,8 @@ namespace Simd
             size_t alignedWidth = AlignLo(width, A);
 
             __m128i _alpha = _mm_slli_si128(_mm_set1_epi32(alpha), 3);
-            __m128i _shuffle = _mm_setr_epi8(0x0, 0x1, 0x2, -1, 0x3, 0x4, 0x5, -1, 0x6, 0x7, 0x8, -1, 0x9, 0xA, 0xB, -1);
+            __m128i _shuffle = rgb ? _mm_setr_epi8(0x2, 0x1, 0x0, -1, 0x5, 0x4, 0x3, -1, 0x8, 0x7, 0x6, -1, 0xB, 0xA, 0x9, -1) :
+                _mm_setr_epi8(0x0, 0x1, 0x2, -1, 0x3, 0x4, 0x5, -1, 0x6, 0x7, 0x8, -1, 0x9, 0xA, 0xB, -1);
 
             for (size_t row = 0; row < height; ++row)
             {
@@ -62,9 +63,17 @@ namespace Simd
         void BgrToBgra(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
         {
             if (Aligned(bgra) && Aligned(bgraStride) && Aligned(bgr) && Aligned(bgrStride))
-                BgrToBgra<true>(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
+                BgrToBgra<true, false>(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
             else
-                BgrToBgra<false>(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
+                BgrToBgra<false, false>(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
+        }
+
+        void BgrToRgba(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * rgba, size_t rgbaStride, uint8_t alpha)
+        {
+            if (Aligned(rgba) && Aligned(rgbaStride) && Aligned(bgr) && Aligned(bgrStride))
+                BgrToBgra<true, true>(bgr, width, height, bgrStride, rgba, rgbaStride, alpha);
+            else
+                BgrToBgra<false, true>(bgr, width, height, bgrStride, rgba, rgbaStride, alpha);
         }
     }
 #endif// SIMD_SSSE3_ENABLE
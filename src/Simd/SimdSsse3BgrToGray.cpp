@@ -30,34 +30,35 @@ namespace Simd
     namespace Ssse3
     {
         const __m128i K16_BLUE_RED = SIMD_MM_SET2_EPI16(Base::BLUE_TO_GRAY_WEIGHT, Base::RED_TO_GRAY_WEIGHT);
+        const __m128i K16_RED_BLUE = SIMD_MM_SET2_EPI16(Base::RED_TO_GRAY_WEIGHT, Base::BLUE_TO_GRAY_WEIGHT);
         const __m128i K16_GREEN_ROUND = SIMD_MM_SET2_EPI16(Base::GREEN_TO_GRAY_WEIGHT, Base::BGR_TO_GRAY_ROUND_TERM);
 
-        SIMD_INLINE __m128i BgraToGray32(__m128i bgra)
+        template <bool rgb> SIMD_INLINE __m128i BgraToGray32(__m128i bgra)
         {
             const __m128i g0a0 = _mm_and_si128(_mm_srli_si128(bgra, 1), K16_00FF);
             const __m128i b0r0 = _mm_and_si128(bgra, K16_00FF);
-            const __m128i weightedSum = _mm_add_epi32(_mm_madd_epi16(g0a0, K16_GREEN_ROUND), _mm_madd_epi16(b0r0, K16_BLUE_RED));
+            const __m128i weightedSum = _mm_add_epi32(_mm_madd_epi16(g0a0, K16_GREEN_ROUND), _mm_madd_epi16(b0r0, rgb ? K16_RED_BLUE : K16_BLUE_RED));
             return _mm_srli_epi32(weightedSum, Base::BGR_TO_GRAY_AVERAGING_SHIFT);
         }
 
-        SIMD_INLINE __m128i BgraToGray(__m128i bgra[4])
+        template <bool rgb> SIMD_INLINE __m128i BgraToGray(__m128i bgra[4])
         {
-            const __m128i lo = _mm_packs_epi32(BgraToGray32(bgra[0]), BgraToGray32(bgra[1]));
-            const __m128i hi = _mm_packs_epi32(BgraToGray32(bgra[2]), BgraToGray32(bgra[3]));
+            const __m128i lo = _mm_packs_epi32(BgraToGray32<rgb>(bgra[0]), BgraToGray32<rgb>(bgra[1]));
+            const __m128i hi = _mm_packs_epi32(BgraToGray32<rgb>(bgra[2]), BgraToGray32<rgb>(bgra[3]));
             return _mm_packus_epi16(lo, hi);
         }
 
-        template <bool align> SIMD_INLINE __m128i BgrToGray(const uint8_t * bgr, __m128i shuffle)
+        template <bool align, bool rgb> SIMD_INLINE __m128i BgrToGray(const uint8_t * bgr, __m128i shuffle)
         {
             __m128i bgra[4];
             bgra[0] = _mm_or_si128(K32_01000000, _mm_shuffle_epi8(Load<align>((__m128i*)(bgr + 0)), shuffle));
             bgra[1] = _mm_or_si128(K32_01000000, _mm_shuffle_epi8(Load<false>((__m128i*)(bgr + 12)), shuffle));
             bgra[2] = _mm_or_si128(K32_01000000, _mm_shuffle_epi8(Load<false>((__m128i*)(bgr + 24)), shuffle));
             bgra[3] = _mm_or_si128(K32_01000000, _mm_shuffle_epi8(_mm_srli_si128(Load<align>((__m128i*)(bgr + 32)), 4), shuffle));
-            return BgraToGray(bgra);
+            return BgraToGray<rgb>(bgra);
         }
 
-        template <bool align> void BgrToGray(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * gray, size_t grayStride)
+        template <bool align, bool rgb> void BgrToGray(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * gray, size_t grayStride)
         {
             assert(width >= A);
             if (align)
@@ -70,9 +71,9 @@ namespace Simd
             for (size_t row = 0; row < height; ++row)
             {
                 for (size_t col = 0; col < alignedWidth; col += A)
-                    Store<align>((__m128i*)(gray + col), BgrToGray<align>(bgr + 3 * col, _shuffle));
+                    Store<align>((__m128i*)(gray + col), BgrToGray<align, rgb>(bgr + 3 * col, _shuffle));
                 if (width != alignedWidth)
-                    Store<false>((__m128i*)(gray + width - A), BgrToGray<false>(bgr + 3 * (width - A), _shuffle));
+                    Store<false>((__m128i*)(gray + width - A), BgrToGray<false, rgb>(bgr + 3 * (width - A), _shuffle));
                 bgr += bgrStride;
                 gray += grayStride;
             }
@@ -81,9 +82,17 @@ namespace Simd
         void BgrToGray(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * gray, size_t grayStride)
         {
             if (Aligned(gray) && Aligned(grayStride) && Aligned(bgr) && Aligned(bgrStride))
-                BgrToGray<true>(bgr, width, height, bgrStride, gray, grayStride);
+                BgrToGray<true, false>(bgr, width, height, bgrStride, gray, grayStride);
             else
-                BgrToGray<false>(bgr, width, height, bgrStride, gray, grayStride);
+                BgrToGray<false, false>(bgr, width, height, bgrStride, gray, grayStride);
+        }
+
+        void RgbToGray(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * gray, size_t grayStride)
+        {
+            if (Aligned(gray) && Aligned(grayStride) && Aligned(rgb) && Aligned(rgbStride))
+                BgrToGray<true, true>(rgb, width, height, rgbStride, gray, grayStride);
+            else
+                BgrToGray<false, true>(rgb, width, height, rgbStride, gray, grayStride);
         }
     }
 #endif// SIMD_SSSE3_ENABLE
@@ -0,0 +1,123 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSvm_h__
+#define __SimdSvm_h__
+
+#include "Simd/SimdArray.h"
+
+namespace Simd
+{
+    class Svm : public Deletable
+    {
+    public:
+        virtual void Predict(const float * samples, size_t number, float * decisions) const = 0;
+    };
+
+    namespace Base
+    {
+        class Svm : public Simd::Svm
+        {
+        public:
+            Svm(const float * svs, const float * weights, size_t length, size_t count, const float * bias, SimdSvmKernelType kernel, const float * params);
+
+            virtual void Predict(const float * samples, size_t number, float * decisions) const;
+
+        protected:
+            typedef void(*GemmPtr)(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
+            typedef void(*ProductSumPtr)(const float * a, const float * b, size_t size, float * sum);
+            typedef void(*MathFunctionPtr)(const float * src, size_t size, SimdMathFunctionType type, const float * params, SimdMathAccuracyType accuracy, float * dst);
+
+            GemmPtr _gemm;
+            ProductSumPtr _productSum;
+            MathFunctionPtr _mathFunction;
+
+        private:
+            size_t _length, _count;
+            SimdSvmKernelType _kernel;
+            float _gamma, _coef0, _bias;
+            size_t _degree;
+            Array32f _svs, _weights, _norms;
+
+            void PredictKernel(const float * samples, size_t number, float * buffer, float * decisions, bool nested) const;
+        };
+
+        bool SvmValid(const float * svs, const float * weights, size_t length, size_t count, SimdSvmKernelType kernel, const float * params);
+
+        void * SvmInit(const float * svs, const float * weights, size_t length, size_t count, const float * bias, SimdSvmKernelType kernel, const float * params);
+    }
+
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        class Svm : public Base::Svm
+        {
+        public:
+            Svm(const float * svs, const float * weights, size_t length, size_t count, const float * bias, SimdSvmKernelType kernel, const float * params);
+        };
+
+        void * SvmInit(const float * svs, const float * weights, size_t length, size_t count, const float * bias, SimdSvmKernelType kernel, const float * params);
+    }
+#endif//SIMD_SSE2_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class Svm : public Base::Svm
+        {
+        public:
+            Svm(const float * svs, const float * weights, size_t length, size_t count, const float * bias, SimdSvmKernelType kernel, const float * params);
+        };
+
+        void * SvmInit(const float * svs, const float * weights, size_t length, size_t count, const float * bias, SimdSvmKernelType kernel, const float * params);
+    }
+#endif//SIMD_AVX2_ENABLE
+
+#ifdef SIMD_AVX512F_ENABLE    
+    namespace Avx512f
+    {
+        class Svm : public Base::Svm
+        {
+        public:
+            Svm(const float * svs, const float * weights, size_t length, size_t count, const float * bias, SimdSvmKernelType kernel, const float * params);
+        };
+
+        void * SvmInit(const float * svs, const float * weights, size_t length, size_t count, const float * bias, SimdSvmKernelType kernel, const float * params);
+    }
+#endif//SIMD_AVX512F_ENABLE
+
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        class Svm : public Base::Svm
+        {
+        public:
+            Svm(const float * svs, const float * weights, size_t length, size_t count, const float * bias, SimdSvmKernelType kernel, const float * params);
+        };
+
+        void * SvmInit(const float * svs, const float * weights, size_t length, size_t count, const float * bias, SimdSvmKernelType kernel, const float * params);
+    }
+#endif//SIMD_NEON_ENABLE
+}
+
+#endif//__SimdSvm_h__
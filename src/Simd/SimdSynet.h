@@ -79,6 +79,24 @@ namespace Simd
         {
             return Simd::Max(0.0f, value) + slope*Simd::Min(value, 0.0f);
         }
+
+        typedef void(*SynetDetectionSuppressPtr)(const float * boxes, size_t current, size_t end, float threshold, uint32_t * suppressed);
+
+        SIMD_INLINE void SynetDetectionSuppress(const float * boxes, size_t current, size_t begin, size_t end, float threshold, uint32_t * suppressed)
+        {
+            const float * xMin = boxes, * yMin = xMin + end, * xMax = yMin + end, * yMax = xMax + end, * area = yMax + end;
+            for (size_t i = begin; i < end; ++i)
+            {
+                float w = Simd::Max(Simd::Min(xMax[current], xMax[i]) - Simd::Max(xMin[current], xMin[i]), 0.0f);
+                float h = Simd::Max(Simd::Min(yMax[current], yMax[i]) - Simd::Max(yMin[current], yMin[i]), 0.0f);
+                float intersection = w * h;
+                if (intersection > threshold * (area[current] + area[i] - intersection))
+                    suppressed[i] = 0xFFFFFFFF;
+            }
+        }
+
+        size_t SynetDetectionNms32f(const float * boxes, const float * scores, size_t count, size_t classes, ptrdiff_t background, float scoreThreshold,
+            float nmsThreshold, size_t topK, size_t keepTopK, SimdBool classAware, float * dst, SynetDetectionSuppressPtr suppress);
     }
 
 #ifdef SIMD_SSE_ENABLE
@@ -105,6 +105,14 @@ namespace Simd
             Hsv24,
             /*! A 24-bit (3 8-bit channels) HSL (Hue, Saturation, Lightness) pixel format. */
             Hsl24,
+            /*! A 24-bit (3 8-bit channels) RGB (Red, Green, Blue) pixel format. */
+            Rgb24,
+            /*! A 32-bit (4 8-bit channels) RGBA (Red, Green, Blue, Alpha) pixel format. */
+            Rgba32,
+            /*! A 32-bit (2 16-bit channels) pixel format (UV plane of P016 (P010, P012) pixel format). */
+            Uv32,
+            /*! A 24-bit (3 8-bit channels) CIE Lab pixel format (L is scaled to [0..255], a and b are shifted by 128). */
+            Lab24,
         };
 
         /*!
@@ -1000,6 +1008,10 @@ namespace Simd
         case BayerBggr: return 1;
         case Hsv24:     return 3;
         case Hsl24:     return 3;
+        case Rgb24:     return 3;
+        case Rgba32:    return 4;
+        case Uv32:      return 4;
+        case Lab24:     return 3;
         default: assert(0); return 0;
         }
     }
@@ -1029,6 +1041,10 @@ namespace Simd
         case BayerBggr: return 1;
         case Hsv24:     return 1;
         case Hsl24:     return 1;
+        case Rgb24:     return 1;
+        case Rgba32:    return 1;
+        case Uv32:      return 2;
+        case Lab24:     return 1;
         default: assert(0); return 0;
         }
     }
@@ -1058,6 +1074,10 @@ namespace Simd
         case BayerBggr: return 1;
         case Hsv24:     return 3;
         case Hsl24:     return 3;
+        case Rgb24:     return 3;
+        case Rgba32:    return 4;
+        case Uv32:      return 2;
+        case Lab24:     return 3;
         default: assert(0); return 0;
         }
     }
@@ -1080,6 +1100,7 @@ namespace Simd
         case Int32:     return CV_32SC1;
         case Float:     return CV_32FC1;
         case Double:    return CV_64FC1;
+        case Uv32:      return CV_16UC2;
         default: assert(0); return 0;
         }
     }
@@ -1096,6 +1117,7 @@ namespace Simd
         case CV_32SC1:  return Int32;
         case CV_32FC1:  return Float;
         case CV_64FC1:  return Double;
+        case CV_16UC2:  return Uv32;
         default: assert(0); return None;
         }
     }
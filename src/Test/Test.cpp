@@ -85,26 +85,67 @@ namespace Test
     TEST_ADD_GROUP_AD0(AddFeatureDifference);
 
     TEST_ADD_GROUP_AD0(BgraToBgr);
+    TEST_ADD_GROUP_A00(BgraToRgb);
     TEST_ADD_GROUP_AD0(BgraToGray);
+    TEST_ADD_GROUP_A00(RgbaToGray);
     TEST_ADD_GROUP_AD0(BgrToGray);
+    TEST_ADD_GROUP_A00(RgbToGray);
     TEST_ADD_GROUP_AD0(BgrToHsl);
     TEST_ADD_GROUP_AD0(BgrToHsv);
+    TEST_ADD_GROUP_A00(BgrToHsvInRange);
+    TEST_ADD_GROUP_AD0(HslToBgr);
+    TEST_ADD_GROUP_AD0(HsvToBgr);
+    TEST_ADD_GROUP_A00(BgrToLab);
+    TEST_ADD_GROUP_A00(BgrToLab32f);
+    TEST_ADD_GROUP_A00(LabToBgr);
+    TEST_ADD_GROUP_A00(Lab32fToBgr);
+    TEST_ADD_GROUP_A00(BgrToLabReference);
+    TEST_ADD_GROUP_A00(LabRoundTrip);
+    TEST_ADD_GROUP_A00(BgrToYCoCgR);
+    TEST_ADD_GROUP_A00(YCoCgRToBgr);
     TEST_ADD_GROUP_AD0(GrayToBgr);
     TEST_ADD_GROUP_AD0(Int16ToGray);
+    TEST_ADD_GROUP_A00(Uint16ToGray);
+    TEST_ADD_GROUP_A00(Uint16ToFloat32);
+    TEST_ADD_GROUP_A00(ChangeBitDepth);
+    TEST_ADD_GROUP_A00(InterleaveUvBitDepth);
+    TEST_ADD_GROUP_A00(DeinterleaveUvBitDepth);
 
     TEST_ADD_GROUP_AD0(BgraToBayer);
     TEST_ADD_GROUP_AD0(BgrToBayer);
 
     TEST_ADD_GROUP_AD0(BgrToBgra);
+    TEST_ADD_GROUP_A00(BgrToRgba);
     TEST_ADD_GROUP_AD0(GrayToBgra);
 
     TEST_ADD_GROUP_AD0(BgraToYuv420p);
+    TEST_ADD_GROUP_A00(RgbaToYuv420p);
     TEST_ADD_GROUP_AD0(BgraToYuv422p);
+    TEST_ADD_GROUP_A00(RgbaToYuv422p);
     TEST_ADD_GROUP_AD0(BgraToYuv444p);
+    TEST_ADD_GROUP_A00(RgbaToYuv444p);
     TEST_ADD_GROUP_AD0(BgrToYuv420p);
+    TEST_ADD_GROUP_A00(RgbToYuv420p);
     TEST_ADD_GROUP_AD0(BgrToYuv422p);
+    TEST_ADD_GROUP_A00(RgbToYuv422p);
     TEST_ADD_GROUP_AD0(BgrToYuv444p);
+    TEST_ADD_GROUP_A00(RgbToYuv444p);
+    TEST_ADD_GROUP_A00(BgraToYuv420pV2);
+    TEST_ADD_GROUP_A00(BgraToYuv422pV2);
+    TEST_ADD_GROUP_A00(BgraToYuv444pV2);
+    TEST_ADD_GROUP_A00(BgrToYuv420pV2);
+    TEST_ADD_GROUP_A00(BgrToYuv422pV2);
+    TEST_ADD_GROUP_A00(BgrToYuv444pV2);
     TEST_ADD_GROUP_A00(BgraToYuva420p);
+    TEST_ADD_GROUP_A00(BgraToNv12);
+    TEST_ADD_GROUP_A00(BgraToNv21);
+    TEST_ADD_GROUP_A00(BgrToNv12);
+    TEST_ADD_GROUP_A00(BgrToNv21);
+    TEST_ADD_GROUP_A00(BgraToNv12V2);
+    TEST_ADD_GROUP_A00(BgraToNv21V2);
+    TEST_ADD_GROUP_A00(BgrToNv12V2);
+    TEST_ADD_GROUP_A00(BgrToNv21V2);
+    TEST_ADD_GROUP_A00(BgrToYuvV2Reference);
 
     TEST_ADD_GROUP_AD0(BackgroundGrowRangeSlow);
     TEST_ADD_GROUP_AD0(BackgroundGrowRangeFast);
@@ -114,11 +155,22 @@ namespace Test
     TEST_ADD_GROUP_AD0(BackgroundShiftRange);
     TEST_ADD_GROUP_AD0(BackgroundShiftRangeMasked);
     TEST_ADD_GROUP_AD0(BackgroundInitMask);
+    TEST_ADD_GROUP_A00(BackgroundUpdate);
+    TEST_ADD_GROUP_A00(BackgroundPackedUpdate);
+    TEST_ADD_GROUP_A00(BackgroundPackedGrowRangeSlow);
+    TEST_ADD_GROUP_A00(BackgroundPackedAdjustRangeMasked);
+    TEST_ADD_GROUP_A00(BackgroundPackedShiftRange);
+    TEST_ADD_GROUP_A00(BackgroundPackedShiftRangeMasked);
 
     TEST_ADD_GROUP_AD0(BayerToBgr);
 
     TEST_ADD_GROUP_AD0(BayerToBgra);
 
+    TEST_ADD_GROUP_A00(BayerToBgrMhc);
+    TEST_ADD_GROUP_A00(BayerToBgraMhc);
+    TEST_ADD_GROUP_A00(BayerToBgrHalf);
+    TEST_ADD_GROUP_A00(BayerToGray);
+
     TEST_ADD_GROUP_AD0(Bgr48pToBgra32);
 
     TEST_ADD_GROUP_AD0(Binarization);
@@ -139,6 +191,7 @@ namespace Test
     TEST_ADD_GROUP_AD0(CopyFrame);
 
     TEST_ADD_GROUP_A00(ConvolutionForward);
+    TEST_ADD_GROUP_A00(ConvolutionScratch);
 
     TEST_ADD_GROUP_AD0(Crc32c);
 
@@ -148,14 +201,23 @@ namespace Test
 
     TEST_ADD_GROUP_AD0(DetectionHaarDetect32fp);
     TEST_ADD_GROUP_AD0(DetectionHaarDetect32fi);
+    TEST_ADD_GROUP_AD0(DetectionHaarDetect16ip);
+    TEST_ADD_GROUP_AD0(DetectionHaarDetect16ii);
     TEST_ADD_GROUP_AD0(DetectionLbpDetect32fp);
     TEST_ADD_GROUP_AD0(DetectionLbpDetect32fi);
     TEST_ADD_GROUP_AD0(DetectionLbpDetect16ip);
     TEST_ADD_GROUP_AD0(DetectionLbpDetect16ii);
+    TEST_ADD_GROUP_A00(DetectionBinary);
+    TEST_ADD_GROUP_A00(DetectionHaarInt16);
     TEST_ADD_GROUP_00S(Detection);
 
     TEST_ADD_GROUP_AD0(AlphaBlending);
     TEST_ADD_GROUP_AD0(AlphaFilling);
+    TEST_ADD_GROUP_A00(AlphaPremultiply);
+    TEST_ADD_GROUP_A00(AlphaUnpremultiply);
+    TEST_ADD_GROUP_A00(AlphaBlendingBgraToBgra);
+    TEST_ADD_GROUP_A00(AlphaBlendingBgraToYuv420p);
+    TEST_ADD_GROUP_A00(AlphaBlendingBgraToNv12);
     TEST_ADD_GROUP_00S(DrawLine);
     TEST_ADD_GROUP_00S(DrawRectangle);
     TEST_ADD_GROUP_00S(DrawFilledRectangle);
@@ -173,6 +235,11 @@ namespace Test
     TEST_ADD_GROUP_AD0(EdgeBackgroundAdjustRangeMasked);
     TEST_ADD_GROUP_AD0(EdgeBackgroundShiftRange);
     TEST_ADD_GROUP_AD0(EdgeBackgroundShiftRangeMasked);
+    TEST_ADD_GROUP_A00(EdgeBackgroundPackedUpdate);
+    TEST_ADD_GROUP_A00(EdgeBackgroundPackedGrowRangeSlow);
+    TEST_ADD_GROUP_A00(EdgeBackgroundPackedAdjustRangeMasked);
+    TEST_ADD_GROUP_A00(EdgeBackgroundPackedShiftRange);
+    TEST_ADD_GROUP_A00(EdgeBackgroundPackedShiftRangeMasked);
 
     TEST_ADD_GROUP_AD0(Fill);
     TEST_ADD_GROUP_AD0(FillFrame);
@@ -190,6 +257,11 @@ namespace Test
     TEST_ADD_GROUP_AD0(Float32ToUint8);
     TEST_ADD_GROUP_AD0(Uint8ToFloat32);
 
+    TEST_ADD_GROUP_A00(FrameConvert);
+    TEST_ADD_GROUP_A00(FrameCrop);
+    TEST_ADD_GROUP_A00(FrameResizeBilinear);
+    TEST_ADD_GROUP_A00(FrameTransformImage);
+
     TEST_ADD_GROUP_A00(Gemm32fNN);
     TEST_ADD_GROUP_A00(Gemm32fNT);
 
@@ -228,6 +300,8 @@ namespace Test
     TEST_ADD_GROUP_AD0(HogLiteFilterSeparable);
     TEST_ADD_GROUP_AD0(HogLiteFindMax7x7);
     TEST_ADD_GROUP_AD0(HogLiteCreateMask);
+    TEST_ADD_GROUP_00S(HogLiteFilterBank);
+    TEST_ADD_GROUP_00S(HogLitePyramid);
 
     TEST_ADD_GROUP_00S(ImageMatcher);
 
@@ -259,6 +333,7 @@ namespace Test
     TEST_ADD_GROUP_AD0(NeuralRelu);
     TEST_ADD_GROUP_AD0(NeuralDerivativeRelu);
     TEST_ADD_GROUP_AD0(NeuralPow);
+    TEST_ADD_GROUP_A00(MathFunction32f);
     TEST_ADD_GROUP_AD0(NeuralUpdateWeights);
     TEST_ADD_GROUP_AD0(NeuralAdaptiveGradientUpdate);
     TEST_ADD_GROUP_AD0(NeuralAddConvolution2x2Forward);
@@ -295,12 +370,14 @@ namespace Test
     TEST_ADD_GROUP_AD0(Reorder64bit);
 
     TEST_ADD_GROUP_ADS(ResizeBilinear);
+    TEST_ADD_GROUP_A00(ResizeBilinearRows);
     TEST_ADD_GROUP_A00(Resizer);
 
     TEST_ADD_GROUP_AD0(SegmentationShrinkRegion);
     TEST_ADD_GROUP_AD0(SegmentationFillSingleHoles);
     TEST_ADD_GROUP_AD0(SegmentationChangeIndex);
     TEST_ADD_GROUP_AD0(SegmentationPropagate2x2);
+    TEST_ADD_GROUP_A00(SegmentationLabelComponents);
 
     TEST_ADD_GROUP_AD0(ShiftBilinear);
     TEST_ADD_GROUP_00S(ShiftDetectorRand);
@@ -323,8 +400,11 @@ namespace Test
     TEST_ADD_GROUP_AD0(StretchGray2x2);
 
     TEST_ADD_GROUP_AD0(SvmSumLinear);
+    TEST_ADD_GROUP_A00(SvmPredict);
 
     TEST_ADD_GROUP_AD0(SynetAddBias);
+    TEST_ADD_GROUP_A00(SynetDetectionDecode32f);
+    TEST_ADD_GROUP_A00(SynetDetectionNms32f);
     TEST_ADD_GROUP_AD0(SynetEltwiseLayerForward);
     TEST_ADD_GROUP_A00(SynetFusedLayerForward0);
     TEST_ADD_GROUP_A00(SynetFusedLayerForward1);
@@ -354,17 +434,50 @@ namespace Test
     TEST_ADD_GROUP_A00(Winograd4x3SetOutput);
 
     TEST_ADD_GROUP_AD0(Yuv444pToBgr);
+    TEST_ADD_GROUP_A00(Yuv444pToRgb);
     TEST_ADD_GROUP_AD0(Yuv422pToBgr);
+    TEST_ADD_GROUP_A00(Yuv422pToRgb);
     TEST_ADD_GROUP_AD0(Yuv420pToBgr);
+    TEST_ADD_GROUP_A00(Yuv420pToRgb);
+    TEST_ADD_GROUP_A00(Yuv444pToBgrV2);
+    TEST_ADD_GROUP_A00(Yuv422pToBgrV2);
+    TEST_ADD_GROUP_A00(Yuv420pToBgrV2);
     TEST_ADD_GROUP_AD0(Yuv444pToHsl);
     TEST_ADD_GROUP_AD0(Yuv444pToHsv);
     TEST_ADD_GROUP_AD0(Yuv444pToHue);
     TEST_ADD_GROUP_AD0(Yuv420pToHue);
+    TEST_ADD_GROUP_A00(Yuv444pToHslV2);
+    TEST_ADD_GROUP_A00(Yuv444pToHsvV2);
+    TEST_ADD_GROUP_A00(Yuv444pToHueV2);
+    TEST_ADD_GROUP_A00(Yuv420pToHueV2);
+    TEST_ADD_GROUP_A00(Nv12ToBgr);
+    TEST_ADD_GROUP_A00(Nv21ToBgr);
+    TEST_ADD_GROUP_A00(Nv12ToHue);
+    TEST_ADD_GROUP_A00(Nv21ToHue);
+    TEST_ADD_GROUP_A00(Nv12ToBgrV2);
+    TEST_ADD_GROUP_A00(Nv21ToBgrV2);
+    TEST_ADD_GROUP_A00(Nv12ToHueV2);
+    TEST_ADD_GROUP_A00(Nv21ToHueV2);
+    TEST_ADD_GROUP_A00(YuvToBgrV2Reference);
 
     TEST_ADD_GROUP_A00(Yuva420pToBgra);
     TEST_ADD_GROUP_AD0(Yuv444pToBgra);
+    TEST_ADD_GROUP_A00(Yuv444pToRgba);
     TEST_ADD_GROUP_AD0(Yuv422pToBgra);
+    TEST_ADD_GROUP_A00(Yuv422pToRgba);
     TEST_ADD_GROUP_AD0(Yuv420pToBgra);
+    TEST_ADD_GROUP_A00(Yuv420pToRgba);
+    TEST_ADD_GROUP_A00(Yuv444pToBgraV2);
+    TEST_ADD_GROUP_A00(Yuv422pToBgraV2);
+    TEST_ADD_GROUP_A00(Yuv420pToBgraV2);
+    TEST_ADD_GROUP_A00(Nv12ToBgra);
+    TEST_ADD_GROUP_A00(Nv21ToBgra);
+    TEST_ADD_GROUP_A00(Nv12ToBgraV2);
+    TEST_ADD_GROUP_A00(Nv21ToBgraV2);
+    TEST_ADD_GROUP_A00(Yuv420p16ToBgr);
+    TEST_ADD_GROUP_A00(Yuv420p16ToBgra);
+    TEST_ADD_GROUP_A00(P016ToBgr);
+    TEST_ADD_GROUP_A00(P016ToBgra);
 
     class Task
     {
@@ -108,6 +108,30 @@ namespace Test
         return result;
     }
 
+    bool BgraToRgbAutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToAnyAutoTest(View::Bgra32, View::Rgb24, FUNC(Simd::Base::BgraToRgb), FUNC(SimdBgraToRgb));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable && W >= Simd::Ssse3::A)
+            result = result && AnyToAnyAutoTest(View::Bgra32, View::Rgb24, FUNC(Simd::Ssse3::BgraToRgb), FUNC(SimdBgraToRgb));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToAnyAutoTest(View::Bgra32, View::Rgb24, FUNC(Simd::Avx512bw::BgraToRgb), FUNC(SimdBgraToRgb));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && AnyToAnyAutoTest(View::Bgra32, View::Rgb24, FUNC(Simd::Neon::BgraToRgb), FUNC(SimdBgraToRgb));
+#endif 
+
+        return result;
+    }
+
     bool BgraToGrayAutoTest()
     {
         bool result = true;
@@ -142,6 +166,35 @@ namespace Test
         return result;
     }
 
+    bool RgbaToGrayAutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToAnyAutoTest(View::Rgba32, View::Gray8, FUNC(Simd::Base::RgbaToGray), FUNC(SimdRgbaToGray));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::A)
+            result = result && AnyToAnyAutoTest(View::Rgba32, View::Gray8, FUNC(Simd::Sse2::RgbaToGray), FUNC(SimdRgbaToGray));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && AnyToAnyAutoTest(View::Rgba32, View::Gray8, FUNC(Simd::Avx2::RgbaToGray), FUNC(SimdRgbaToGray));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToAnyAutoTest(View::Rgba32, View::Gray8, FUNC(Simd::Avx512bw::RgbaToGray), FUNC(SimdRgbaToGray));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && AnyToAnyAutoTest(View::Rgba32, View::Gray8, FUNC(Simd::Neon::RgbaToGray), FUNC(SimdRgbaToGray));
+#endif 
+
+        return result;
+    }
+
     bool BgrToGrayAutoTest()
     {
         bool result = true;
@@ -181,12 +234,66 @@ namespace Test
         return result;
     }
 
+    bool RgbToGrayAutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToAnyAutoTest(View::Rgb24, View::Gray8, FUNC(Simd::Base::RgbToGray), FUNC(SimdRgbToGray));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::A)
+            result = result && AnyToAnyAutoTest(View::Rgb24, View::Gray8, FUNC(Simd::Sse2::RgbToGray), FUNC(SimdRgbToGray));
+#endif 
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable && W >= Simd::Ssse3::A)
+            result = result && AnyToAnyAutoTest(View::Rgb24, View::Gray8, FUNC(Simd::Ssse3::RgbToGray), FUNC(SimdRgbToGray));
+#endif 
+
+#if defined(SIMD_AVX2_ENABLE) && !defined(SIMD_CLANG_AVX2_BGR_TO_BGRA_ERROR)
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && AnyToAnyAutoTest(View::Rgb24, View::Gray8, FUNC(Simd::Avx2::RgbToGray), FUNC(SimdRgbToGray));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToAnyAutoTest(View::Rgb24, View::Gray8, FUNC(Simd::Avx512bw::RgbToGray), FUNC(SimdRgbToGray));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && AnyToAnyAutoTest(View::Rgb24, View::Gray8, FUNC(Simd::Neon::RgbToGray), FUNC(SimdRgbToGray));
+#endif
+
+        return result;
+    }
+
     bool BgrToHslAutoTest()
     {
         bool result = true;
 
         result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsl24, FUNC(Simd::Base::BgrToHsl), FUNC(SimdBgrToHsl));
 
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsl24, FUNC(Simd::Sse41::BgrToHsl), FUNC(SimdBgrToHsl));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsl24, FUNC(Simd::Avx2::BgrToHsl), FUNC(SimdBgrToHsl));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsl24, FUNC(Simd::Avx512bw::BgrToHsl), FUNC(SimdBgrToHsl));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsl24, FUNC(Simd::Neon::BgrToHsl), FUNC(SimdBgrToHsl));
+#endif 
+
         return result;
     }
 
@@ -196,6 +303,84 @@ namespace Test
 
         result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsv24, FUNC(Simd::Base::BgrToHsv), FUNC(SimdBgrToHsv));
 
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsv24, FUNC(Simd::Sse41::BgrToHsv), FUNC(SimdBgrToHsv));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsv24, FUNC(Simd::Avx2::BgrToHsv), FUNC(SimdBgrToHsv));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsv24, FUNC(Simd::Avx512bw::BgrToHsv), FUNC(SimdBgrToHsv));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsv24, FUNC(Simd::Neon::BgrToHsv), FUNC(SimdBgrToHsv));
+#endif 
+
+        return result;
+    }
+
+    bool HslToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToAnyAutoTest(View::Hsl24, View::Bgr24, FUNC(Simd::Base::HslToBgr), FUNC(SimdHslToBgr));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && AnyToAnyAutoTest(View::Hsl24, View::Bgr24, FUNC(Simd::Sse41::HslToBgr), FUNC(SimdHslToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && AnyToAnyAutoTest(View::Hsl24, View::Bgr24, FUNC(Simd::Avx2::HslToBgr), FUNC(SimdHslToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && AnyToAnyAutoTest(View::Hsl24, View::Bgr24, FUNC(Simd::Avx512bw::HslToBgr), FUNC(SimdHslToBgr));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && AnyToAnyAutoTest(View::Hsl24, View::Bgr24, FUNC(Simd::Neon::HslToBgr), FUNC(SimdHslToBgr));
+#endif 
+
+        return result;
+    }
+
+    bool HsvToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToAnyAutoTest(View::Hsv24, View::Bgr24, FUNC(Simd::Base::HsvToBgr), FUNC(SimdHsvToBgr));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && AnyToAnyAutoTest(View::Hsv24, View::Bgr24, FUNC(Simd::Sse41::HsvToBgr), FUNC(SimdHsvToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && AnyToAnyAutoTest(View::Hsv24, View::Bgr24, FUNC(Simd::Avx2::HsvToBgr), FUNC(SimdHsvToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && AnyToAnyAutoTest(View::Hsv24, View::Bgr24, FUNC(Simd::Avx512bw::HsvToBgr), FUNC(SimdHsvToBgr));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && AnyToAnyAutoTest(View::Hsv24, View::Bgr24, FUNC(Simd::Neon::HsvToBgr), FUNC(SimdHsvToBgr));
+#endif 
+
         return result;
     }
 
@@ -348,6 +533,24 @@ namespace Test
         return result;
     }
 
+    bool HslToBgrDataTest(bool create)
+    {
+        bool result = true;
+
+        result = result && AnyToAnyDataTest(create, DW, DH, View::Hsl24, View::Bgr24, FUNC(SimdHslToBgr));
+
+        return result;
+    }
+
+    bool HsvToBgrDataTest(bool create)
+    {
+        bool result = true;
+
+        result = result && AnyToAnyDataTest(create, DW, DH, View::Hsv24, View::Bgr24, FUNC(SimdHsvToBgr));
+
+        return result;
+    }
+
     bool GrayToBgrDataTest(bool create)
     {
         bool result = true;
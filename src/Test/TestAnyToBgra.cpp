@@ -114,6 +114,35 @@ namespace Test
         return result;
     }
 
+    bool BgrToRgbaAutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToBgraAutoTest(View::Bgr24, FUNC(Simd::Base::BgrToRgba), FUNC(SimdBgrToRgba));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable && W >= Simd::Ssse3::A)
+            result = result && AnyToBgraAutoTest(View::Bgr24, FUNC(Simd::Ssse3::BgrToRgba), FUNC(SimdBgrToRgba));
+#endif 
+
+#if defined(SIMD_AVX2_ENABLE) && !defined(SIMD_CLANG_AVX2_BGR_TO_BGRA_ERROR)
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && AnyToBgraAutoTest(View::Bgr24, FUNC(Simd::Avx2::BgrToRgba), FUNC(SimdBgrToRgba));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToBgraAutoTest(View::Bgr24, FUNC(Simd::Avx512bw::BgrToRgba), FUNC(SimdBgrToRgba));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && AnyToBgraAutoTest(View::Bgr24, FUNC(Simd::Neon::BgrToRgba), FUNC(SimdBgrToRgba));
+#endif 
+
+        return result;
+    }
+
     bool GrayToBgraAutoTest()
     {
         bool result = true;
@@ -34,21 +34,30 @@ namespace Test
         {
             typedef void(*FuncPtr)(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
                 uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+            typedef void(*FuncV2Ptr)(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+                uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
 
             FuncPtr func;
+            FuncV2Ptr funcV2;
+            SimdYuvType yuvType;
             String description;
 
-            FuncYuv(const FuncPtr & f, const String & d) : func(f), description(d) {}
+            FuncYuv(const FuncPtr & f, const String & d) : func(f), funcV2(NULL), yuvType(SimdYuvBt601), description(d) {}
+            FuncYuv(const FuncV2Ptr & f, const String & d, SimdYuvType t) : func(NULL), funcV2(f), yuvType(t), description(d + "<" + ToString(t) + ">") {}
 
             void Call(const View & bgr, View & y, View & u, View & v) const
             {
                 TEST_PERFORMANCE_TEST(description);
-                func(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+                if (funcV2)
+                    funcV2(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride, yuvType);
+                else
+                    func(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
             }
         };
     }
 
 #define FUNC_YUV(function) FuncYuv(function, #function)
+#define FUNC_YUV_V2(function, yuvType) FuncYuv(function, #function, yuvType)
 
     bool AnyToYuvAutoTest(int width, int height, View::Format srcType, int dx, int dy, const FuncYuv & f1, const FuncYuv & f2)
     {
@@ -129,6 +138,79 @@ namespace Test
         return result;
     }
 
+    bool RgbaToYuv420pAutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToYuvAutoTest(View::Rgba32, 2, 2, FUNC_YUV(Simd::Base::RgbaToYuv420p), FUNC_YUV(SimdRgbaToYuv420p));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::DA)
+            result = result && AnyToYuvAutoTest(View::Rgba32, 2, 2, FUNC_YUV(Simd::Sse2::RgbaToYuv420p), FUNC_YUV(SimdRgbaToYuv420p));
+#endif 
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable && W >= Simd::Ssse3::DA)
+            result = result && AnyToYuvAutoTest(View::Rgba32, 2, 2, FUNC_YUV(Simd::Ssse3::RgbaToYuv420p), FUNC_YUV(SimdRgbaToYuv420p));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToYuvAutoTest(View::Rgba32, 2, 2, FUNC_YUV(Simd::Avx2::RgbaToYuv420p), FUNC_YUV(SimdRgbaToYuv420p));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToYuvAutoTest(View::Rgba32, 2, 2, FUNC_YUV(Simd::Avx512bw::RgbaToYuv420p), FUNC_YUV(SimdRgbaToYuv420p));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::DA)
+            result = result && AnyToYuvAutoTest(View::Rgba32, 2, 2, FUNC_YUV(Simd::Neon::RgbaToYuv420p), FUNC_YUV(SimdRgbaToYuv420p));
+#endif
+
+        return result;
+    }
+
+    bool BgraToYuv420pV2AutoTest()
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            SimdYuvType yuvType = (SimdYuvType)type;
+
+            result = result && AnyToYuvAutoTest(View::Bgra32, 2, 2, FUNC_YUV_V2(Simd::Base::BgraToYuv420pV2, yuvType), FUNC_YUV_V2(SimdBgraToYuv420pV2, yuvType));
+
+#ifdef SIMD_SSE2_ENABLE
+            if (Simd::Sse2::Enable && W >= Simd::Sse2::DA)
+                result = result && AnyToYuvAutoTest(View::Bgra32, 2, 2, FUNC_YUV_V2(Simd::Sse2::BgraToYuv420pV2, yuvType), FUNC_YUV_V2(SimdBgraToYuv420pV2, yuvType));
+#endif 
+
+#ifdef SIMD_SSSE3_ENABLE
+            if (Simd::Ssse3::Enable && W >= Simd::Ssse3::DA)
+                result = result && AnyToYuvAutoTest(View::Bgra32, 2, 2, FUNC_YUV_V2(Simd::Ssse3::BgraToYuv420pV2, yuvType), FUNC_YUV_V2(SimdBgraToYuv420pV2, yuvType));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+                result = result && AnyToYuvAutoTest(View::Bgra32, 2, 2, FUNC_YUV_V2(Simd::Avx2::BgraToYuv420pV2, yuvType), FUNC_YUV_V2(SimdBgraToYuv420pV2, yuvType));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && AnyToYuvAutoTest(View::Bgra32, 2, 2, FUNC_YUV_V2(Simd::Avx512bw::BgraToYuv420pV2, yuvType), FUNC_YUV_V2(SimdBgraToYuv420pV2, yuvType));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+            if (Simd::Neon::Enable && W >= Simd::Neon::DA)
+                result = result && AnyToYuvAutoTest(View::Bgra32, 2, 2, FUNC_YUV_V2(Simd::Neon::BgraToYuv420pV2, yuvType), FUNC_YUV_V2(SimdBgraToYuv420pV2, yuvType));
+#endif
+        }
+
+        return result;
+    }
+
     bool BgraToYuv422pAutoTest()
     {
         bool result = true;
@@ -168,6 +250,79 @@ namespace Test
         return result;
     }
 
+    bool RgbaToYuv422pAutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToYuvAutoTest(View::Rgba32, 2, 1, FUNC_YUV(Simd::Base::RgbaToYuv422p), FUNC_YUV(SimdRgbaToYuv422p));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::DA)
+            result = result && AnyToYuvAutoTest(View::Rgba32, 2, 1, FUNC_YUV(Simd::Sse2::RgbaToYuv422p), FUNC_YUV(SimdRgbaToYuv422p));
+#endif 
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable && W >= Simd::Ssse3::DA)
+            result = result && AnyToYuvAutoTest(View::Rgba32, 2, 1, FUNC_YUV(Simd::Ssse3::RgbaToYuv422p), FUNC_YUV(SimdRgbaToYuv422p));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToYuvAutoTest(View::Rgba32, 2, 1, FUNC_YUV(Simd::Avx2::RgbaToYuv422p), FUNC_YUV(SimdRgbaToYuv422p));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToYuvAutoTest(View::Rgba32, 2, 1, FUNC_YUV(Simd::Avx512bw::RgbaToYuv422p), FUNC_YUV(SimdRgbaToYuv422p));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::DA)
+            result = result && AnyToYuvAutoTest(View::Rgba32, 2, 1, FUNC_YUV(Simd::Neon::RgbaToYuv422p), FUNC_YUV(SimdRgbaToYuv422p));
+#endif
+
+        return result;
+    }
+
+    bool BgraToYuv422pV2AutoTest()
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            SimdYuvType yuvType = (SimdYuvType)type;
+
+            result = result && AnyToYuvAutoTest(View::Bgra32, 2, 1, FUNC_YUV_V2(Simd::Base::BgraToYuv422pV2, yuvType), FUNC_YUV_V2(SimdBgraToYuv422pV2, yuvType));
+
+#ifdef SIMD_SSE2_ENABLE
+            if (Simd::Sse2::Enable && W >= Simd::Sse2::DA)
+                result = result && AnyToYuvAutoTest(View::Bgra32, 2, 1, FUNC_YUV_V2(Simd::Sse2::BgraToYuv422pV2, yuvType), FUNC_YUV_V2(SimdBgraToYuv422pV2, yuvType));
+#endif 
+
+#ifdef SIMD_SSSE3_ENABLE
+            if (Simd::Ssse3::Enable && W >= Simd::Ssse3::DA)
+                result = result && AnyToYuvAutoTest(View::Bgra32, 2, 1, FUNC_YUV_V2(Simd::Ssse3::BgraToYuv422pV2, yuvType), FUNC_YUV_V2(SimdBgraToYuv422pV2, yuvType));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+                result = result && AnyToYuvAutoTest(View::Bgra32, 2, 1, FUNC_YUV_V2(Simd::Avx2::BgraToYuv422pV2, yuvType), FUNC_YUV_V2(SimdBgraToYuv422pV2, yuvType));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && AnyToYuvAutoTest(View::Bgra32, 2, 1, FUNC_YUV_V2(Simd::Avx512bw::BgraToYuv422pV2, yuvType), FUNC_YUV_V2(SimdBgraToYuv422pV2, yuvType));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+            if (Simd::Neon::Enable && W >= Simd::Neon::DA)
+                result = result && AnyToYuvAutoTest(View::Bgra32, 2, 1, FUNC_YUV_V2(Simd::Neon::BgraToYuv422pV2, yuvType), FUNC_YUV_V2(SimdBgraToYuv422pV2, yuvType));
+#endif
+        }
+
+        return result;
+    }
+
     bool BgraToYuv444pAutoTest()
     {
         bool result = true;
@@ -202,6 +357,69 @@ namespace Test
         return result;
     }
 
+    bool RgbaToYuv444pAutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToYuvAutoTest(View::Rgba32, 1, 1, FUNC_YUV(Simd::Base::RgbaToYuv444p), FUNC_YUV(SimdRgbaToYuv444p));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::A)
+            result = result && AnyToYuvAutoTest(View::Rgba32, 1, 1, FUNC_YUV(Simd::Sse2::RgbaToYuv444p), FUNC_YUV(SimdRgbaToYuv444p));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && AnyToYuvAutoTest(View::Rgba32, 1, 1, FUNC_YUV(Simd::Avx2::RgbaToYuv444p), FUNC_YUV(SimdRgbaToYuv444p));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToYuvAutoTest(View::Rgba32, 1, 1, FUNC_YUV(Simd::Avx512bw::RgbaToYuv444p), FUNC_YUV(SimdRgbaToYuv444p));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && AnyToYuvAutoTest(View::Rgba32, 1, 1, FUNC_YUV(Simd::Neon::RgbaToYuv444p), FUNC_YUV(SimdRgbaToYuv444p));
+#endif
+
+        return result;
+    }
+
+    bool BgraToYuv444pV2AutoTest()
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            SimdYuvType yuvType = (SimdYuvType)type;
+
+            result = result && AnyToYuvAutoTest(View::Bgra32, 1, 1, FUNC_YUV_V2(Simd::Base::BgraToYuv444pV2, yuvType), FUNC_YUV_V2(SimdBgraToYuv444pV2, yuvType));
+
+#ifdef SIMD_SSE2_ENABLE
+            if (Simd::Sse2::Enable && W >= Simd::Sse2::A)
+                result = result && AnyToYuvAutoTest(View::Bgra32, 1, 1, FUNC_YUV_V2(Simd::Sse2::BgraToYuv444pV2, yuvType), FUNC_YUV_V2(SimdBgraToYuv444pV2, yuvType));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+                result = result && AnyToYuvAutoTest(View::Bgra32, 1, 1, FUNC_YUV_V2(Simd::Avx2::BgraToYuv444pV2, yuvType), FUNC_YUV_V2(SimdBgraToYuv444pV2, yuvType));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && AnyToYuvAutoTest(View::Bgra32, 1, 1, FUNC_YUV_V2(Simd::Avx512bw::BgraToYuv444pV2, yuvType), FUNC_YUV_V2(SimdBgraToYuv444pV2, yuvType));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+            if (Simd::Neon::Enable && W >= Simd::Neon::A)
+                result = result && AnyToYuvAutoTest(View::Bgra32, 1, 1, FUNC_YUV_V2(Simd::Neon::BgraToYuv444pV2, yuvType), FUNC_YUV_V2(SimdBgraToYuv444pV2, yuvType));
+#endif
+        }
+
+        return result;
+    }
+
     bool BgrToYuv420pAutoTest()
     {
         bool result = true;
@@ -236,6 +454,69 @@ namespace Test
         return result;
     }
 
+    bool RgbToYuv420pAutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToYuvAutoTest(View::Rgb24, 2, 2, FUNC_YUV(Simd::Base::RgbToYuv420p), FUNC_YUV(SimdRgbToYuv420p));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable && W >= Simd::Ssse3::DA)
+            result = result && AnyToYuvAutoTest(View::Rgb24, 2, 2, FUNC_YUV(Simd::Ssse3::RgbToYuv420p), FUNC_YUV(SimdRgbToYuv420p));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToYuvAutoTest(View::Rgb24, 2, 2, FUNC_YUV(Simd::Avx2::RgbToYuv420p), FUNC_YUV(SimdRgbToYuv420p));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToYuvAutoTest(View::Rgb24, 2, 2, FUNC_YUV(Simd::Avx512bw::RgbToYuv420p), FUNC_YUV(SimdRgbToYuv420p));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::DA)
+            result = result && AnyToYuvAutoTest(View::Rgb24, 2, 2, FUNC_YUV(Simd::Neon::RgbToYuv420p), FUNC_YUV(SimdRgbToYuv420p));
+#endif
+
+        return result;
+    }
+
+    bool BgrToYuv420pV2AutoTest()
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            SimdYuvType yuvType = (SimdYuvType)type;
+
+            result = result && AnyToYuvAutoTest(View::Bgr24, 2, 2, FUNC_YUV_V2(Simd::Base::BgrToYuv420pV2, yuvType), FUNC_YUV_V2(SimdBgrToYuv420pV2, yuvType));
+
+#ifdef SIMD_SSSE3_ENABLE
+            if (Simd::Ssse3::Enable && W >= Simd::Ssse3::DA)
+                result = result && AnyToYuvAutoTest(View::Bgr24, 2, 2, FUNC_YUV_V2(Simd::Ssse3::BgrToYuv420pV2, yuvType), FUNC_YUV_V2(SimdBgrToYuv420pV2, yuvType));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+                result = result && AnyToYuvAutoTest(View::Bgr24, 2, 2, FUNC_YUV_V2(Simd::Avx2::BgrToYuv420pV2, yuvType), FUNC_YUV_V2(SimdBgrToYuv420pV2, yuvType));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && AnyToYuvAutoTest(View::Bgr24, 2, 2, FUNC_YUV_V2(Simd::Avx512bw::BgrToYuv420pV2, yuvType), FUNC_YUV_V2(SimdBgrToYuv420pV2, yuvType));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+            if (Simd::Neon::Enable && W >= Simd::Neon::DA)
+                result = result && AnyToYuvAutoTest(View::Bgr24, 2, 2, FUNC_YUV_V2(Simd::Neon::BgrToYuv420pV2, yuvType), FUNC_YUV_V2(SimdBgrToYuv420pV2, yuvType));
+#endif
+        }
+
+        return result;
+    }
+
     bool BgrToYuv422pAutoTest()
     {
         bool result = true;
@@ -270,6 +551,69 @@ namespace Test
         return result;
     }
 
+    bool RgbToYuv422pAutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToYuvAutoTest(View::Rgb24, 2, 1, FUNC_YUV(Simd::Base::RgbToYuv422p), FUNC_YUV(SimdRgbToYuv422p));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable && W >= Simd::Ssse3::DA)
+            result = result && AnyToYuvAutoTest(View::Rgb24, 2, 1, FUNC_YUV(Simd::Ssse3::RgbToYuv422p), FUNC_YUV(SimdRgbToYuv422p));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToYuvAutoTest(View::Rgb24, 2, 1, FUNC_YUV(Simd::Avx2::RgbToYuv422p), FUNC_YUV(SimdRgbToYuv422p));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToYuvAutoTest(View::Rgb24, 2, 1, FUNC_YUV(Simd::Avx512bw::RgbToYuv422p), FUNC_YUV(SimdRgbToYuv422p));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::DA)
+            result = result && AnyToYuvAutoTest(View::Rgb24, 2, 1, FUNC_YUV(Simd::Neon::RgbToYuv422p), FUNC_YUV(SimdRgbToYuv422p));
+#endif
+
+        return result;
+    }
+
+    bool BgrToYuv422pV2AutoTest()
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            SimdYuvType yuvType = (SimdYuvType)type;
+
+            result = result && AnyToYuvAutoTest(View::Bgr24, 2, 1, FUNC_YUV_V2(Simd::Base::BgrToYuv422pV2, yuvType), FUNC_YUV_V2(SimdBgrToYuv422pV2, yuvType));
+
+#ifdef SIMD_SSSE3_ENABLE
+            if (Simd::Ssse3::Enable && W >= Simd::Ssse3::DA)
+                result = result && AnyToYuvAutoTest(View::Bgr24, 2, 1, FUNC_YUV_V2(Simd::Ssse3::BgrToYuv422pV2, yuvType), FUNC_YUV_V2(SimdBgrToYuv422pV2, yuvType));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+                result = result && AnyToYuvAutoTest(View::Bgr24, 2, 1, FUNC_YUV_V2(Simd::Avx2::BgrToYuv422pV2, yuvType), FUNC_YUV_V2(SimdBgrToYuv422pV2, yuvType));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && AnyToYuvAutoTest(View::Bgr24, 2, 1, FUNC_YUV_V2(Simd::Avx512bw::BgrToYuv422pV2, yuvType), FUNC_YUV_V2(SimdBgrToYuv422pV2, yuvType));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+            if (Simd::Neon::Enable && W >= Simd::Neon::DA)
+                result = result && AnyToYuvAutoTest(View::Bgr24, 2, 1, FUNC_YUV_V2(Simd::Neon::BgrToYuv422pV2, yuvType), FUNC_YUV_V2(SimdBgrToYuv422pV2, yuvType));
+#endif
+        }
+
+        return result;
+    }
+
     bool BgrToYuv444pAutoTest()
     {
         bool result = true;
@@ -304,23 +648,86 @@ namespace Test
         return result;
     }
 
-    namespace
+    bool RgbToYuv444pAutoTest()
     {
-        struct FuncYuva
-        {
-            typedef void(*FuncPtr)(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * y, size_t yStride,
-                uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, uint8_t * a, size_t aStride);
+        bool result = true;
 
-            FuncPtr func;
-            String description;
+        result = result && AnyToYuvAutoTest(View::Rgb24, 1, 1, FUNC_YUV(Simd::Base::RgbToYuv444p), FUNC_YUV(SimdRgbToYuv444p));
 
-            FuncYuva(const FuncPtr & f, const String & d) : func(f), description(d) {}
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable && W >= Simd::Ssse3::A)
+            result = result && AnyToYuvAutoTest(View::Rgb24, 1, 1, FUNC_YUV(Simd::Ssse3::RgbToYuv444p), FUNC_YUV(SimdRgbToYuv444p));
+#endif 
 
-            void Call(const View & bgra, View & y, View & u, View & v, View & a) const
-            {
-                TEST_PERFORMANCE_TEST(description);
-                func(bgra.data, bgra.stride, bgra.width, bgra.height, y.data, y.stride, u.data, u.stride, v.data, v.stride, a.data, a.stride);
-            }
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && AnyToYuvAutoTest(View::Rgb24, 1, 1, FUNC_YUV(Simd::Avx2::RgbToYuv444p), FUNC_YUV(SimdRgbToYuv444p));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToYuvAutoTest(View::Rgb24, 1, 1, FUNC_YUV(Simd::Avx512bw::RgbToYuv444p), FUNC_YUV(SimdRgbToYuv444p));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && AnyToYuvAutoTest(View::Rgb24, 1, 1, FUNC_YUV(Simd::Neon::RgbToYuv444p), FUNC_YUV(SimdRgbToYuv444p));
+#endif
+
+        return result;
+    }
+
+    bool BgrToYuv444pV2AutoTest()
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            SimdYuvType yuvType = (SimdYuvType)type;
+
+            result = result && AnyToYuvAutoTest(View::Bgr24, 1, 1, FUNC_YUV_V2(Simd::Base::BgrToYuv444pV2, yuvType), FUNC_YUV_V2(SimdBgrToYuv444pV2, yuvType));
+
+#ifdef SIMD_SSSE3_ENABLE
+            if (Simd::Ssse3::Enable && W >= Simd::Ssse3::A)
+                result = result && AnyToYuvAutoTest(View::Bgr24, 1, 1, FUNC_YUV_V2(Simd::Ssse3::BgrToYuv444pV2, yuvType), FUNC_YUV_V2(SimdBgrToYuv444pV2, yuvType));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+                result = result && AnyToYuvAutoTest(View::Bgr24, 1, 1, FUNC_YUV_V2(Simd::Avx2::BgrToYuv444pV2, yuvType), FUNC_YUV_V2(SimdBgrToYuv444pV2, yuvType));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && AnyToYuvAutoTest(View::Bgr24, 1, 1, FUNC_YUV_V2(Simd::Avx512bw::BgrToYuv444pV2, yuvType), FUNC_YUV_V2(SimdBgrToYuv444pV2, yuvType));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+            if (Simd::Neon::Enable && W >= Simd::Neon::A)
+                result = result && AnyToYuvAutoTest(View::Bgr24, 1, 1, FUNC_YUV_V2(Simd::Neon::BgrToYuv444pV2, yuvType), FUNC_YUV_V2(SimdBgrToYuv444pV2, yuvType));
+#endif
+        }
+
+        return result;
+    }
+
+    namespace
+    {
+        struct FuncYuva
+        {
+            typedef void(*FuncPtr)(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * y, size_t yStride,
+                uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, uint8_t * a, size_t aStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncYuva(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & bgra, View & y, View & u, View & v, View & a) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(bgra.data, bgra.stride, bgra.width, bgra.height, y.data, y.stride, u.data, u.stride, v.data, v.stride, a.data, a.stride);
+            }
         };
     }
 
@@ -403,6 +810,489 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncNv
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * y, size_t yStride,
+                uint8_t * uv, size_t uvStride);
+            typedef void(*FuncV2Ptr)(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * y, size_t yStride,
+                uint8_t * uv, size_t uvStride, SimdYuvType yuvType);
+
+            FuncPtr func;
+            FuncV2Ptr funcV2;
+            SimdYuvType yuvType;
+            String description;
+
+            FuncNv(const FuncPtr & f, const String & d) : func(f), funcV2(NULL), yuvType(SimdYuvBt601), description(d) {}
+            FuncNv(const FuncV2Ptr & f, const String & d, SimdYuvType t) : func(NULL), funcV2(f), yuvType(t), description(d + "<" + ToString(t) + ">") {}
+
+            void Call(const View & src, View & y, View & uv) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                if (funcV2)
+                    funcV2(src.data, src.width, src.height, src.stride, y.data, y.stride, uv.data, uv.stride, yuvType);
+                else
+                    func(src.data, src.width, src.height, src.stride, y.data, y.stride, uv.data, uv.stride);
+            }
+        };
+    }
+
+#define FUNC_NV(function) FuncNv(function, #function)
+#define FUNC_NV_V2(function, yuvType) FuncNv(function, #function, yuvType)
+
+    bool AnyToNvAutoTest(int width, int height, View::Format srcType, const FuncNv & f1, const FuncNv & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View src(width, height, srcType, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View y1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View uv1(width / 2, height / 2, View::Uv16, NULL, TEST_ALIGN(width));
+
+        View y2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View uv2(width / 2, height / 2, View::Uv16, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, y1, uv1));
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, y2, uv2));
+
+        result = result && Compare(y1, y2, 0, true, 64, 0, "y");
+        result = result && Compare(uv1, uv2, 0, true, 64, 0, "uv");
+
+        return result;
+    }
+
+    bool AnyToNvAutoTest(View::Format srcType, const FuncNv & f1, const FuncNv & f2)
+    {
+        bool result = true;
+
+        result = result && AnyToNvAutoTest(W, H, srcType, f1, f2);
+        result = result && AnyToNvAutoTest(W + O * 2, H - O * 2, srcType, f1, f2);
+
+        return result;
+    }
+
+    bool BgraToNv12AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToNvAutoTest(View::Bgra32, FUNC_NV(Simd::Base::BgraToNv12), FUNC_NV(SimdBgraToNv12));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::DA)
+            result = result && AnyToNvAutoTest(View::Bgra32, FUNC_NV(Simd::Sse2::BgraToNv12), FUNC_NV(SimdBgraToNv12));
+#endif
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable && W >= Simd::Ssse3::DA)
+            result = result && AnyToNvAutoTest(View::Bgra32, FUNC_NV(Simd::Ssse3::BgraToNv12), FUNC_NV(SimdBgraToNv12));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToNvAutoTest(View::Bgra32, FUNC_NV(Simd::Avx2::BgraToNv12), FUNC_NV(SimdBgraToNv12));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToNvAutoTest(View::Bgra32, FUNC_NV(Simd::Avx512bw::BgraToNv12), FUNC_NV(SimdBgraToNv12));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::DA)
+            result = result && AnyToNvAutoTest(View::Bgra32, FUNC_NV(Simd::Neon::BgraToNv12), FUNC_NV(SimdBgraToNv12));
+#endif
+
+        return result;
+    }
+
+    bool BgraToNv12V2AutoTest()
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            SimdYuvType yuvType = (SimdYuvType)type;
+
+            result = result && AnyToNvAutoTest(View::Bgra32, FUNC_NV_V2(Simd::Base::BgraToNv12V2, yuvType), FUNC_NV_V2(SimdBgraToNv12V2, yuvType));
+
+#ifdef SIMD_SSE2_ENABLE
+            if (Simd::Sse2::Enable && W >= Simd::Sse2::DA)
+                result = result && AnyToNvAutoTest(View::Bgra32, FUNC_NV_V2(Simd::Sse2::BgraToNv12V2, yuvType), FUNC_NV_V2(SimdBgraToNv12V2, yuvType));
+#endif
+
+#ifdef SIMD_SSSE3_ENABLE
+            if (Simd::Ssse3::Enable && W >= Simd::Ssse3::DA)
+                result = result && AnyToNvAutoTest(View::Bgra32, FUNC_NV_V2(Simd::Ssse3::BgraToNv12V2, yuvType), FUNC_NV_V2(SimdBgraToNv12V2, yuvType));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+                result = result && AnyToNvAutoTest(View::Bgra32, FUNC_NV_V2(Simd::Avx2::BgraToNv12V2, yuvType), FUNC_NV_V2(SimdBgraToNv12V2, yuvType));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && AnyToNvAutoTest(View::Bgra32, FUNC_NV_V2(Simd::Avx512bw::BgraToNv12V2, yuvType), FUNC_NV_V2(SimdBgraToNv12V2, yuvType));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+            if (Simd::Neon::Enable && W >= Simd::Neon::DA)
+                result = result && AnyToNvAutoTest(View::Bgra32, FUNC_NV_V2(Simd::Neon::BgraToNv12V2, yuvType), FUNC_NV_V2(SimdBgraToNv12V2, yuvType));
+#endif
+        }
+
+        return result;
+    }
+
+    bool BgraToNv21AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToNvAutoTest(View::Bgra32, FUNC_NV(Simd::Base::BgraToNv21), FUNC_NV(SimdBgraToNv21));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::DA)
+            result = result && AnyToNvAutoTest(View::Bgra32, FUNC_NV(Simd::Sse2::BgraToNv21), FUNC_NV(SimdBgraToNv21));
+#endif
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable && W >= Simd::Ssse3::DA)
+            result = result && AnyToNvAutoTest(View::Bgra32, FUNC_NV(Simd::Ssse3::BgraToNv21), FUNC_NV(SimdBgraToNv21));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToNvAutoTest(View::Bgra32, FUNC_NV(Simd::Avx2::BgraToNv21), FUNC_NV(SimdBgraToNv21));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToNvAutoTest(View::Bgra32, FUNC_NV(Simd::Avx512bw::BgraToNv21), FUNC_NV(SimdBgraToNv21));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::DA)
+            result = result && AnyToNvAutoTest(View::Bgra32, FUNC_NV(Simd::Neon::BgraToNv21), FUNC_NV(SimdBgraToNv21));
+#endif
+
+        return result;
+    }
+
+    bool BgraToNv21V2AutoTest()
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            SimdYuvType yuvType = (SimdYuvType)type;
+
+            result = result && AnyToNvAutoTest(View::Bgra32, FUNC_NV_V2(Simd::Base::BgraToNv21V2, yuvType), FUNC_NV_V2(SimdBgraToNv21V2, yuvType));
+
+#ifdef SIMD_SSE2_ENABLE
+            if (Simd::Sse2::Enable && W >= Simd::Sse2::DA)
+                result = result && AnyToNvAutoTest(View::Bgra32, FUNC_NV_V2(Simd::Sse2::BgraToNv21V2, yuvType), FUNC_NV_V2(SimdBgraToNv21V2, yuvType));
+#endif
+
+#ifdef SIMD_SSSE3_ENABLE
+            if (Simd::Ssse3::Enable && W >= Simd::Ssse3::DA)
+                result = result && AnyToNvAutoTest(View::Bgra32, FUNC_NV_V2(Simd::Ssse3::BgraToNv21V2, yuvType), FUNC_NV_V2(SimdBgraToNv21V2, yuvType));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+                result = result && AnyToNvAutoTest(View::Bgra32, FUNC_NV_V2(Simd::Avx2::BgraToNv21V2, yuvType), FUNC_NV_V2(SimdBgraToNv21V2, yuvType));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && AnyToNvAutoTest(View::Bgra32, FUNC_NV_V2(Simd::Avx512bw::BgraToNv21V2, yuvType), FUNC_NV_V2(SimdBgraToNv21V2, yuvType));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+            if (Simd::Neon::Enable && W >= Simd::Neon::DA)
+                result = result && AnyToNvAutoTest(View::Bgra32, FUNC_NV_V2(Simd::Neon::BgraToNv21V2, yuvType), FUNC_NV_V2(SimdBgraToNv21V2, yuvType));
+#endif
+        }
+
+        return result;
+    }
+
+    bool BgrToNv12AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToNvAutoTest(View::Bgr24, FUNC_NV(Simd::Base::BgrToNv12), FUNC_NV(SimdBgrToNv12));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable && W >= Simd::Ssse3::DA)
+            result = result && AnyToNvAutoTest(View::Bgr24, FUNC_NV(Simd::Ssse3::BgrToNv12), FUNC_NV(SimdBgrToNv12));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToNvAutoTest(View::Bgr24, FUNC_NV(Simd::Avx2::BgrToNv12), FUNC_NV(SimdBgrToNv12));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToNvAutoTest(View::Bgr24, FUNC_NV(Simd::Avx512bw::BgrToNv12), FUNC_NV(SimdBgrToNv12));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::DA)
+            result = result && AnyToNvAutoTest(View::Bgr24, FUNC_NV(Simd::Neon::BgrToNv12), FUNC_NV(SimdBgrToNv12));
+#endif
+
+        return result;
+    }
+
+    bool BgrToNv12V2AutoTest()
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            SimdYuvType yuvType = (SimdYuvType)type;
+
+            result = result && AnyToNvAutoTest(View::Bgr24, FUNC_NV_V2(Simd::Base::BgrToNv12V2, yuvType), FUNC_NV_V2(SimdBgrToNv12V2, yuvType));
+
+#ifdef SIMD_SSSE3_ENABLE
+            if (Simd::Ssse3::Enable && W >= Simd::Ssse3::DA)
+                result = result && AnyToNvAutoTest(View::Bgr24, FUNC_NV_V2(Simd::Ssse3::BgrToNv12V2, yuvType), FUNC_NV_V2(SimdBgrToNv12V2, yuvType));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+                result = result && AnyToNvAutoTest(View::Bgr24, FUNC_NV_V2(Simd::Avx2::BgrToNv12V2, yuvType), FUNC_NV_V2(SimdBgrToNv12V2, yuvType));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && AnyToNvAutoTest(View::Bgr24, FUNC_NV_V2(Simd::Avx512bw::BgrToNv12V2, yuvType), FUNC_NV_V2(SimdBgrToNv12V2, yuvType));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+            if (Simd::Neon::Enable && W >= Simd::Neon::DA)
+                result = result && AnyToNvAutoTest(View::Bgr24, FUNC_NV_V2(Simd::Neon::BgrToNv12V2, yuvType), FUNC_NV_V2(SimdBgrToNv12V2, yuvType));
+#endif
+        }
+
+        return result;
+    }
+
+    bool BgrToNv21AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToNvAutoTest(View::Bgr24, FUNC_NV(Simd::Base::BgrToNv21), FUNC_NV(SimdBgrToNv21));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable && W >= Simd::Ssse3::DA)
+            result = result && AnyToNvAutoTest(View::Bgr24, FUNC_NV(Simd::Ssse3::BgrToNv21), FUNC_NV(SimdBgrToNv21));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToNvAutoTest(View::Bgr24, FUNC_NV(Simd::Avx2::BgrToNv21), FUNC_NV(SimdBgrToNv21));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToNvAutoTest(View::Bgr24, FUNC_NV(Simd::Avx512bw::BgrToNv21), FUNC_NV(SimdBgrToNv21));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::DA)
+            result = result && AnyToNvAutoTest(View::Bgr24, FUNC_NV(Simd::Neon::BgrToNv21), FUNC_NV(SimdBgrToNv21));
+#endif
+
+        return result;
+    }
+
+    bool BgrToNv21V2AutoTest()
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            SimdYuvType yuvType = (SimdYuvType)type;
+
+            result = result && AnyToNvAutoTest(View::Bgr24, FUNC_NV_V2(Simd::Base::BgrToNv21V2, yuvType), FUNC_NV_V2(SimdBgrToNv21V2, yuvType));
+
+#ifdef SIMD_SSSE3_ENABLE
+            if (Simd::Ssse3::Enable && W >= Simd::Ssse3::DA)
+                result = result && AnyToNvAutoTest(View::Bgr24, FUNC_NV_V2(Simd::Ssse3::BgrToNv21V2, yuvType), FUNC_NV_V2(SimdBgrToNv21V2, yuvType));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+                result = result && AnyToNvAutoTest(View::Bgr24, FUNC_NV_V2(Simd::Avx2::BgrToNv21V2, yuvType), FUNC_NV_V2(SimdBgrToNv21V2, yuvType));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && AnyToNvAutoTest(View::Bgr24, FUNC_NV_V2(Simd::Avx512bw::BgrToNv21V2, yuvType), FUNC_NV_V2(SimdBgrToNv21V2, yuvType));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+            if (Simd::Neon::Enable && W >= Simd::Neon::DA)
+                result = result && AnyToNvAutoTest(View::Bgr24, FUNC_NV_V2(Simd::Neon::BgrToNv21V2, yuvType), FUNC_NV_V2(SimdBgrToNv21V2, yuvType));
+#endif
+        }
+
+        return result;
+    }
+
+    namespace
+    {
+        struct BgrSample
+        {
+            uint8_t b, g, r;
+        };
+
+        const BgrSample BGR_SAMPLES[] = { { 0, 0, 0 }, { 255, 255, 255 }, { 0, 0, 255 }, { 0, 255, 0 }, { 255, 0, 0 },
+            { 40, 200, 120 }, { 200, 30, 90 }, { 128, 128, 128 }, { 16, 64, 235 } };
+        const size_t BGR_SAMPLES_SIZE = sizeof(BGR_SAMPLES) / sizeof(BGR_SAMPLES[0]);
+
+        SIMD_INLINE const BgrSample & BgrSampleAt(size_t col)
+        {
+            return BGR_SAMPLES[col / 2 % BGR_SAMPLES_SIZE];
+        }
+
+        void ReferenceBgrToYuv(const BgrSample & bgr, SimdYuvType yuvType, int * yuv)
+        {
+            double kr, kb;
+            bool fullRange;
+            YuvTypeCoefficients(yuvType, kr, kb, fullRange);
+            double y = kr * bgr.r + (1.0 - kr - kb) * bgr.g + kb * bgr.b;
+            double u = (bgr.b - y) / (2.0 * (1.0 - kb));
+            double v = (bgr.r - y) / (2.0 * (1.0 - kr));
+            if (fullRange)
+            {
+                yuv[0] = RoundAndRestrict(y);
+                yuv[1] = RoundAndRestrict(128.0 + u);
+                yuv[2] = RoundAndRestrict(128.0 + v);
+            }
+            else
+            {
+                yuv[0] = RoundAndRestrict(16.0 + y * 219.0 / 255.0);
+                yuv[1] = RoundAndRestrict(128.0 + u * 224.0 / 255.0);
+                yuv[2] = RoundAndRestrict(128.0 + v * 224.0 / 255.0);
+            }
+        }
+    }
+
+    const int YUV_REFERENCE_ERROR = 2;
+
+    bool BgrToYuvV2ReferenceCheck(const View & y, const View & u, const View & v, SimdYuvType yuvType, const String & description)
+    {
+        const size_t dx = y.width / u.width, dy = y.height / u.height;
+        for (size_t row = 0; row < y.height; ++row)
+        {
+            for (size_t col = 0; col < y.width; ++col)
+            {
+                int ref[3], val[3];
+                ReferenceBgrToYuv(BgrSampleAt(col), yuvType, ref);
+                val[0] = y.At<uint8_t>(col, row);
+                val[1] = u.At<uint8_t>(col / dx, row / dy);
+                val[2] = v.At<uint8_t>(col / dx, row / dy);
+                if (std::abs(val[0] - ref[0]) > YUV_REFERENCE_ERROR || std::abs(val[1] - ref[1]) > YUV_REFERENCE_ERROR ||
+                    std::abs(val[2] - ref[2]) > YUV_REFERENCE_ERROR)
+                {
+                    TEST_LOG_SS(Error, description << "<" << ToString(yuvType) << "> : pixel [" << col << ", " << row << "] = {"
+                        << val[0] << ", " << val[1] << ", " << val[2] << "}, reference = {"
+                        << ref[0] << ", " << ref[1] << ", " << ref[2] << "}.");
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    bool BgrToYuvV2ReferenceCheck(const View & y, const View & uv, bool nv21, SimdYuvType yuvType, const String & description)
+    {
+        View u(uv.width, uv.height, View::Gray8, NULL, TEST_ALIGN(uv.width));
+        View v(uv.width, uv.height, View::Gray8, NULL, TEST_ALIGN(uv.width));
+        SimdDeinterleaveUv(uv.data, uv.stride, uv.width, uv.height, (nv21 ? v : u).data, u.stride, (nv21 ? u : v).data, v.stride);
+        return BgrToYuvV2ReferenceCheck(y, u, v, yuvType, description);
+    }
+
+    bool BgrToYuvV2ReferenceAutoTest(int width, int height, SimdYuvType yuvType)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test BGR to YUV conversions with " << ToString(yuvType) << " matrix against reference values [" << width << ", " << height << "].");
+
+        View bgr(width, height, View::Bgr24, NULL, TEST_ALIGN(width));
+        View bgra(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        for (size_t row = 0; row < (size_t)height; ++row)
+        {
+            for (size_t col = 0; col < (size_t)width; ++col)
+            {
+                const BgrSample & s = BgrSampleAt(col);
+                uint8_t * pBgr = bgr.data + row * bgr.stride + col * 3;
+                pBgr[0] = s.b;
+                pBgr[1] = s.g;
+                pBgr[2] = s.r;
+                uint8_t * pBgra = bgra.data + row * bgra.stride + col * 4;
+                pBgra[0] = s.b;
+                pBgra[1] = s.g;
+                pBgra[2] = s.r;
+                pBgra[3] = 0xFF;
+            }
+        }
+
+        View y(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View u444(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View v444(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View u420(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+        View v420(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+        View uv(width / 2, height / 2, View::Uv16, NULL, TEST_ALIGN(width));
+
+        SimdBgrToYuv444pV2(bgr.data, width, height, bgr.stride, y.data, y.stride, u444.data, u444.stride, v444.data, v444.stride, yuvType);
+        result = result && BgrToYuvV2ReferenceCheck(y, u444, v444, yuvType, "SimdBgrToYuv444pV2");
+
+        SimdBgraToYuv444pV2(bgra.data, width, height, bgra.stride, y.data, y.stride, u444.data, u444.stride, v444.data, v444.stride, yuvType);
+        result = result && BgrToYuvV2ReferenceCheck(y, u444, v444, yuvType, "SimdBgraToYuv444pV2");
+
+        SimdBgrToYuv420pV2(bgr.data, width, height, bgr.stride, y.data, y.stride, u420.data, u420.stride, v420.data, v420.stride, yuvType);
+        result = result && BgrToYuvV2ReferenceCheck(y, u420, v420, yuvType, "SimdBgrToYuv420pV2");
+
+        SimdBgraToYuv420pV2(bgra.data, width, height, bgra.stride, y.data, y.stride, u420.data, u420.stride, v420.data, v420.stride, yuvType);
+        result = result && BgrToYuvV2ReferenceCheck(y, u420, v420, yuvType, "SimdBgraToYuv420pV2");
+
+        SimdBgrToNv12V2(bgr.data, width, height, bgr.stride, y.data, y.stride, uv.data, uv.stride, yuvType);
+        result = result && BgrToYuvV2ReferenceCheck(y, uv, false, yuvType, "SimdBgrToNv12V2");
+
+        SimdBgrToNv21V2(bgr.data, width, height, bgr.stride, y.data, y.stride, uv.data, uv.stride, yuvType);
+        result = result && BgrToYuvV2ReferenceCheck(y, uv, true, yuvType, "SimdBgrToNv21V2");
+
+        SimdBgraToNv12V2(bgra.data, width, height, bgra.stride, y.data, y.stride, uv.data, uv.stride, yuvType);
+        result = result && BgrToYuvV2ReferenceCheck(y, uv, false, yuvType, "SimdBgraToNv12V2");
+
+        SimdBgraToNv21V2(bgra.data, width, height, bgra.stride, y.data, y.stride, uv.data, uv.stride, yuvType);
+        result = result && BgrToYuvV2ReferenceCheck(y, uv, true, yuvType, "SimdBgraToNv21V2");
+
+        return result;
+    }
+
+    bool BgrToYuvV2ReferenceAutoTest()
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            result = result && BgrToYuvV2ReferenceAutoTest(W, H, (SimdYuvType)type);
+            result = result && BgrToYuvV2ReferenceAutoTest(W + O * 2, H - O * 2, (SimdYuvType)type);
+        }
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     bool AnyToYuvDataTest(bool create, int width, int height, View::Format srcType, int dx, int dy, const FuncYuv & f)
@@ -436,6 +436,408 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct Func7
+        {
+            typedef void(*FuncPtr)(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+                uint8_t * loValue, size_t loValueStride, uint8_t * hiValue, size_t hiValueStride,
+                uint8_t * loCount, size_t loCountStride, uint8_t * hiCount, size_t hiCountStride, uint8_t threshold, int flags);
+
+            FuncPtr func;
+            String description;
+            int flags;
+
+            Func7(const FuncPtr & f, const String & d, int fl) : func(f), description(d + "[" + char('0' + fl) + "]"), flags(fl) {}
+
+            void Call(const View & value, const View & loValueSrc, const View & hiValueSrc, const View & loCountSrc, const View & hiCountSrc,
+                View & loValueDst, View & hiValueDst, View & loCountDst, View & hiCountDst, uint8_t threshold) const
+            {
+                Simd::Copy(loValueSrc, loValueDst);
+                Simd::Copy(hiValueSrc, hiValueDst);
+                Simd::Copy(loCountSrc, loCountDst);
+                Simd::Copy(hiCountSrc, hiCountDst);
+                TEST_PERFORMANCE_TEST(description);
+                func(value.data, value.stride, value.width, value.height, loValueDst.data, loValueDst.stride, hiValueDst.data, hiValueDst.stride,
+                    loCountDst.data, loCountDst.stride, hiCountDst.data, hiCountDst.stride, threshold, flags);
+            }
+        };
+    }
+
+#define FUNC7(function) function, std::string(#function)
+
+    bool BackgroundUpdateAutoTest(int width, int height, const Func7 & f1, const Func7 & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View value(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(value);
+        View loValueSrc(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(loValueSrc);
+        View hiValueSrc(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(hiValueSrc);
+        View loCountSrc(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(loCountSrc);
+        View hiCountSrc(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(hiCountSrc);
+
+        View loValueDst1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View hiValueDst1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View loCountDst1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View hiCountDst1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View loValueDst2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View hiValueDst2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View loCountDst2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View hiCountDst2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(value, loValueSrc, hiValueSrc, loCountSrc, hiCountSrc,
+            loValueDst1, hiValueDst1, loCountDst1, hiCountDst1, 0x80));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(value, loValueSrc, hiValueSrc, loCountSrc, hiCountSrc,
+            loValueDst2, hiValueDst2, loCountDst2, hiCountDst2, 0x80));
+
+        result = result && Compare(loValueDst1, loValueDst2, 0, true, 32, 0, "loValue");
+        result = result && Compare(hiValueDst1, hiValueDst2, 0, true, 32, 0, "hiValue");
+        result = result && Compare(loCountDst1, loCountDst2, 0, true, 32, 0, "loCount");
+        result = result && Compare(hiCountDst1, hiCountDst2, 0, true, 32, 0, "hiCount");
+
+        if (result)
+        {
+            View loValue(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            View hiValue(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            View loCount(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            View hiCount(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            Simd::Copy(loValueSrc, loValue);
+            Simd::Copy(hiValueSrc, hiValue);
+            Simd::Copy(loCountSrc, loCount);
+            Simd::Copy(hiCountSrc, hiCount);
+            if (f1.flags & SimdBackgroundUpdateGrowRange)
+                Simd::BackgroundGrowRangeFast(value, loValue, hiValue);
+            if (f1.flags & SimdBackgroundUpdateIncrementCount)
+                Simd::BackgroundIncrementCount(value, loValue, hiValue, loCount, hiCount);
+            if (f1.flags & SimdBackgroundUpdateAdjustRange)
+                Simd::BackgroundAdjustRange(loCount, loValue, hiCount, hiValue, 0x80);
+
+            result = result && Compare(loValue, loValueDst1, 0, true, 32, 0, "loValue");
+            result = result && Compare(hiValue, hiValueDst1, 0, true, 32, 0, "hiValue");
+            result = result && Compare(loCount, loCountDst1, 0, true, 32, 0, "loCount");
+            result = result && Compare(hiCount, hiCountDst1, 0, true, 32, 0, "hiCount");
+        }
+
+        return result;
+    }
+
+    bool BackgroundUpdateAutoTest(const Func7::FuncPtr & f1, const String & d1, const Func7::FuncPtr & f2, const String & d2)
+    {
+        bool result = true;
+
+        const int flags[] = { 1, 2, 3, 4, 6, 7 };
+        for (size_t i = 0; i < sizeof(flags) / sizeof(flags[0]); ++i)
+        {
+            Func7 _f1(f1, d1, flags[i]), _f2(f2, d2, flags[i]);
+            result = result && BackgroundUpdateAutoTest(W, H, _f1, _f2);
+            result = result && BackgroundUpdateAutoTest(W + O, H - O, _f1, _f2);
+            result = result && BackgroundUpdateAutoTest(W - O, H + O, _f1, _f2);
+        }
+
+        return result;
+    }
+
+    namespace
+    {
+        struct Func8
+        {
+            typedef void(*FuncInitPtr)(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride);
+            typedef void(*FuncUpdatePtr)(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+                uint8_t * model, size_t modelStride, uint8_t threshold, int flags);
+
+            FuncInitPtr init;
+            FuncUpdatePtr update;
+            String description;
+            int flags;
+
+            Func8(const FuncInitPtr & i, const FuncUpdatePtr & u, const String & d, int f) : init(i), update(u), description(d + "[" + char('0' + f) + "]"), flags(f) {}
+
+            void Init(const View & value, View & model) const
+            {
+                init(value.data, value.stride, value.width, value.height, model.data, model.stride);
+            }
+
+            void Update(const View & value, const View & modelSrc, View & modelDst, uint8_t threshold) const
+            {
+                Simd::Copy(modelSrc, modelDst);
+                TEST_PERFORMANCE_TEST(description);
+                update(value.data, value.stride, value.width, value.height, modelDst.data, modelDst.stride, threshold, flags);
+            }
+        };
+    }
+
+#define FUNC8(prefix) prefix##Init, prefix##Update, std::string(#prefix "Update")
+
+    bool BackgroundPackedUpdateAutoTest(int width, int height, const Func8 & f1, const Func8 & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View value(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(value);
+        View modelSrc(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        View modelDst1(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        View modelDst2(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+
+        f1.Init(value, modelDst1);
+        f2.Init(value, modelDst2);
+        result = result && Compare(modelDst1, modelDst2, 0, true, 32, 0, "init");
+
+        FillRandom(modelSrc);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Update(value, modelSrc, modelDst1, 0x80));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Update(value, modelSrc, modelDst2, 0x80));
+
+        result = result && Compare(modelDst1, modelDst2, 0, true, 32, 0, "update");
+
+        if (result)
+        {
+            View loValue(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            View hiValue(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            View loCount(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            View hiCount(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            View model(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+            Simd::DeinterleaveBgra(modelSrc, loValue, hiValue, loCount, hiCount);
+            Simd::BackgroundUpdate(value, loValue, hiValue, loCount, hiCount, 0x80, f1.flags);
+            Simd::InterleaveBgra(loValue, hiValue, loCount, hiCount, model);
+
+            result = result && Compare(model, modelDst1, 0, true, 32, 0, "reference");
+        }
+
+        return result;
+    }
+
+    bool BackgroundPackedUpdateAutoTest(const Func8::FuncInitPtr & i1, const Func8::FuncUpdatePtr & u1, const String & d1,
+        const Func8::FuncInitPtr & i2, const Func8::FuncUpdatePtr & u2, const String & d2)
+    {
+        bool result = true;
+
+        const int flags[] = { 1, 2, 3, 4, 6, 7 };
+        for (size_t i = 0; i < sizeof(flags) / sizeof(flags[0]); ++i)
+        {
+            Func8 f1(i1, u1, d1, flags[i]), f2(i2, u2, d2, flags[i]);
+            result = result && BackgroundPackedUpdateAutoTest(W, H, f1, f2);
+            result = result && BackgroundPackedUpdateAutoTest(W + O, H - O, f1, f2);
+            result = result && BackgroundPackedUpdateAutoTest(W - O, H + O, f1, f2);
+        }
+
+        return result;
+    }
+
+    namespace
+    {
+        struct Func9
+        {
+            typedef void(*FuncPtr)(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride);
+
+            FuncPtr func;
+            String description;
+
+            Func9(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & value, const View & modelSrc, View & modelDst) const
+            {
+                Simd::Copy(modelSrc, modelDst);
+                TEST_PERFORMANCE_TEST(description);
+                func(value.data, value.stride, value.width, value.height, modelDst.data, modelDst.stride);
+            }
+        };
+
+        struct Func10
+        {
+            typedef void(*FuncPtr)(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+                uint8_t * model, size_t modelStride, const uint8_t * mask, size_t maskStride);
+
+            FuncPtr func;
+            String description;
+
+            Func10(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & value, const View & modelSrc, View & modelDst, const View & mask) const
+            {
+                Simd::Copy(modelSrc, modelDst);
+                TEST_PERFORMANCE_TEST(description);
+                func(value.data, value.stride, value.width, value.height, modelDst.data, modelDst.stride, mask.data, mask.stride);
+            }
+        };
+
+        struct Func11
+        {
+            typedef void(*FuncPtr)(uint8_t * model, size_t modelStride, size_t width, size_t height,
+                uint8_t threshold, const uint8_t * mask, size_t maskStride);
+
+            FuncPtr func;
+            String description;
+
+            Func11(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & modelSrc, View & modelDst, uint8_t threshold, const View & mask) const
+            {
+                Simd::Copy(modelSrc, modelDst);
+                TEST_PERFORMANCE_TEST(description);
+                func(modelDst.data, modelDst.stride, modelDst.width, modelDst.height, threshold, mask.data, mask.stride);
+            }
+        };
+    }
+
+#define FUNC9(function) Func9(function, std::string(#function))
+#define FUNC10(function) Func10(function, std::string(#function))
+#define FUNC11(function) Func11(function, std::string(#function))
+
+    bool BackgroundPackedChangeRangeAutoTest(int width, int height, const Func9 & f1, const Func9 & f2, Func1::FuncPtr reference)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View value(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(value);
+        View modelSrc(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        FillRandom(modelSrc);
+        View modelDst1(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        View modelDst2(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(value, modelSrc, modelDst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(value, modelSrc, modelDst2));
+
+        result = result && Compare(modelDst1, modelDst2, 0, true, 32);
+
+        if (result)
+        {
+            View loValue(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            View hiValue(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            View loCount(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            View hiCount(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            View model(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+            Simd::DeinterleaveBgra(modelSrc, loValue, hiValue, loCount, hiCount);
+            reference(value.data, value.stride, width, height, loValue.data, loValue.stride, hiValue.data, hiValue.stride);
+            Simd::InterleaveBgra(loValue, hiValue, loCount, hiCount, model);
+
+            result = result && Compare(model, modelDst1, 0, true, 32, 0, "reference");
+        }
+
+        return result;
+    }
+
+    bool BackgroundPackedChangeRangeAutoTest(const Func9 & f1, const Func9 & f2, Func1::FuncPtr reference)
+    {
+        bool result = true;
+
+        result = result && BackgroundPackedChangeRangeAutoTest(W, H, f1, f2, reference);
+        result = result && BackgroundPackedChangeRangeAutoTest(W + O, H - O, f1, f2, reference);
+        result = result && BackgroundPackedChangeRangeAutoTest(W - O, H + O, f1, f2, reference);
+
+        return result;
+    }
+
+    bool BackgroundPackedShiftRangeMaskedAutoTest(int width, int height, const Func10 & f1, const Func10 & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View value(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(value);
+        View mask(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandomMask(mask, 0xFF);
+        View modelSrc(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        FillRandom(modelSrc);
+        View modelDst1(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        View modelDst2(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(value, modelSrc, modelDst1, mask));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(value, modelSrc, modelDst2, mask));
+
+        result = result && Compare(modelDst1, modelDst2, 0, true, 32);
+
+        if (result)
+        {
+            View loValue(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            View hiValue(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            View loCount(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            View hiCount(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            View model(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+            Simd::DeinterleaveBgra(modelSrc, loValue, hiValue, loCount, hiCount);
+            SimdBackgroundShiftRangeMasked(value.data, value.stride, width, height, loValue.data, loValue.stride, hiValue.data, hiValue.stride, mask.data, mask.stride);
+            Simd::InterleaveBgra(loValue, hiValue, loCount, hiCount, model);
+
+            result = result && Compare(model, modelDst1, 0, true, 32, 0, "reference");
+        }
+
+        return result;
+    }
+
+    bool BackgroundPackedShiftRangeMaskedAutoTest(const Func10 & f1, const Func10 & f2)
+    {
+        bool result = true;
+
+        result = result && BackgroundPackedShiftRangeMaskedAutoTest(W, H, f1, f2);
+        result = result && BackgroundPackedShiftRangeMaskedAutoTest(W + O, H - O, f1, f2);
+        result = result && BackgroundPackedShiftRangeMaskedAutoTest(W - O, H + O, f1, f2);
+
+        return result;
+    }
+
+    bool BackgroundPackedAdjustRangeMaskedAutoTest(int width, int height, const Func11 & f1, const Func11 & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View mask(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandomMask(mask, 0xFF);
+        View modelSrc(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        FillRandom(modelSrc);
+        View modelDst1(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        View modelDst2(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        const uint8_t threshold = 0x80;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(modelSrc, modelDst1, threshold, mask));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(modelSrc, modelDst2, threshold, mask));
+
+        result = result && Compare(modelDst1, modelDst2, 0, true, 32);
+
+        if (result)
+        {
+            View loValue(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            View hiValue(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            View loCount(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            View hiCount(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            View model(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+            Simd::DeinterleaveBgra(modelSrc, loValue, hiValue, loCount, hiCount);
+            SimdBackgroundAdjustRangeMasked(loCount.data, loCount.stride, width, height, loValue.data, loValue.stride, hiCount.data, hiCount.stride, hiValue.data, hiValue.stride, threshold, mask.data, mask.stride);
+            Simd::InterleaveBgra(loValue, hiValue, loCount, hiCount, model);
+
+            result = result && Compare(model, modelDst1, 0, true, 32, 0, "reference");
+        }
+
+        return result;
+    }
+
+    bool BackgroundPackedAdjustRangeMaskedAutoTest(const Func11 & f1, const Func11 & f2)
+    {
+        bool result = true;
+
+        result = result && BackgroundPackedAdjustRangeMaskedAutoTest(W, H, f1, f2);
+        result = result && BackgroundPackedAdjustRangeMaskedAutoTest(W + O, H - O, f1, f2);
+        result = result && BackgroundPackedAdjustRangeMaskedAutoTest(W - O, H + O, f1, f2);
+
+        return result;
+    }
+
     bool BackgroundGrowRangeSlowAutoTest()
     {
         bool result = true;
@@ -706,6 +1108,180 @@ namespace Test
         return result;
     }
 
+    bool BackgroundUpdateAutoTest()
+    {
+        bool result = true;
+
+        result = result && BackgroundUpdateAutoTest(FUNC7(Simd::Base::BackgroundUpdate), FUNC7(SimdBackgroundUpdate));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W - O >= Simd::Sse2::A)
+            result = result && BackgroundUpdateAutoTest(FUNC7(Simd::Sse2::BackgroundUpdate), FUNC7(SimdBackgroundUpdate));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W - O >= Simd::Avx2::A)
+            result = result && BackgroundUpdateAutoTest(FUNC7(Simd::Avx2::BackgroundUpdate), FUNC7(SimdBackgroundUpdate));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && BackgroundUpdateAutoTest(FUNC7(Simd::Avx512bw::BackgroundUpdate), FUNC7(SimdBackgroundUpdate));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W - O >= Simd::Neon::A)
+            result = result && BackgroundUpdateAutoTest(FUNC7(Simd::Neon::BackgroundUpdate), FUNC7(SimdBackgroundUpdate));
+#endif 
+
+        return result;
+    }
+
+    bool BackgroundPackedUpdateAutoTest()
+    {
+        bool result = true;
+
+        result = result && BackgroundPackedUpdateAutoTest(FUNC8(Simd::Base::BackgroundPacked), FUNC8(SimdBackgroundPacked));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W - O >= Simd::Sse2::A)
+            result = result && BackgroundPackedUpdateAutoTest(FUNC8(Simd::Sse2::BackgroundPacked), FUNC8(SimdBackgroundPacked));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W - O >= Simd::Avx2::A)
+            result = result && BackgroundPackedUpdateAutoTest(FUNC8(Simd::Avx2::BackgroundPacked), FUNC8(SimdBackgroundPacked));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && BackgroundPackedUpdateAutoTest(FUNC8(Simd::Avx512bw::BackgroundPacked), FUNC8(SimdBackgroundPacked));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W - O >= Simd::Neon::A)
+            result = result && BackgroundPackedUpdateAutoTest(FUNC8(Simd::Neon::BackgroundPacked), FUNC8(SimdBackgroundPacked));
+#endif 
+
+        return result;
+    }
+
+    bool BackgroundPackedGrowRangeSlowAutoTest()
+    {
+        bool result = true;
+
+        result = result && BackgroundPackedChangeRangeAutoTest(FUNC9(Simd::Base::BackgroundPackedGrowRangeSlow), FUNC9(SimdBackgroundPackedGrowRangeSlow), SimdBackgroundGrowRangeSlow);
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W - O >= Simd::Sse2::A)
+            result = result && BackgroundPackedChangeRangeAutoTest(FUNC9(Simd::Sse2::BackgroundPackedGrowRangeSlow), FUNC9(SimdBackgroundPackedGrowRangeSlow), SimdBackgroundGrowRangeSlow);
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W - O >= Simd::Avx2::A)
+            result = result && BackgroundPackedChangeRangeAutoTest(FUNC9(Simd::Avx2::BackgroundPackedGrowRangeSlow), FUNC9(SimdBackgroundPackedGrowRangeSlow), SimdBackgroundGrowRangeSlow);
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && BackgroundPackedChangeRangeAutoTest(FUNC9(Simd::Avx512bw::BackgroundPackedGrowRangeSlow), FUNC9(SimdBackgroundPackedGrowRangeSlow), SimdBackgroundGrowRangeSlow);
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W - O >= Simd::Neon::A)
+            result = result && BackgroundPackedChangeRangeAutoTest(FUNC9(Simd::Neon::BackgroundPackedGrowRangeSlow), FUNC9(SimdBackgroundPackedGrowRangeSlow), SimdBackgroundGrowRangeSlow);
+#endif 
+
+        return result;
+    }
+
+    bool BackgroundPackedShiftRangeAutoTest()
+    {
+        bool result = true;
+
+        result = result && BackgroundPackedChangeRangeAutoTest(FUNC9(Simd::Base::BackgroundPackedShiftRange), FUNC9(SimdBackgroundPackedShiftRange), SimdBackgroundShiftRange);
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W - O >= Simd::Sse2::A)
+            result = result && BackgroundPackedChangeRangeAutoTest(FUNC9(Simd::Sse2::BackgroundPackedShiftRange), FUNC9(SimdBackgroundPackedShiftRange), SimdBackgroundShiftRange);
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W - O >= Simd::Avx2::A)
+            result = result && BackgroundPackedChangeRangeAutoTest(FUNC9(Simd::Avx2::BackgroundPackedShiftRange), FUNC9(SimdBackgroundPackedShiftRange), SimdBackgroundShiftRange);
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && BackgroundPackedChangeRangeAutoTest(FUNC9(Simd::Avx512bw::BackgroundPackedShiftRange), FUNC9(SimdBackgroundPackedShiftRange), SimdBackgroundShiftRange);
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W - O >= Simd::Neon::A)
+            result = result && BackgroundPackedChangeRangeAutoTest(FUNC9(Simd::Neon::BackgroundPackedShiftRange), FUNC9(SimdBackgroundPackedShiftRange), SimdBackgroundShiftRange);
+#endif 
+
+        return result;
+    }
+
+    bool BackgroundPackedShiftRangeMaskedAutoTest()
+    {
+        bool result = true;
+
+        result = result && BackgroundPackedShiftRangeMaskedAutoTest(FUNC10(Simd::Base::BackgroundPackedShiftRangeMasked), FUNC10(SimdBackgroundPackedShiftRangeMasked));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W - O >= Simd::Sse2::A)
+            result = result && BackgroundPackedShiftRangeMaskedAutoTest(FUNC10(Simd::Sse2::BackgroundPackedShiftRangeMasked), FUNC10(SimdBackgroundPackedShiftRangeMasked));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W - O >= Simd::Avx2::A)
+            result = result && BackgroundPackedShiftRangeMaskedAutoTest(FUNC10(Simd::Avx2::BackgroundPackedShiftRangeMasked), FUNC10(SimdBackgroundPackedShiftRangeMasked));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && BackgroundPackedShiftRangeMaskedAutoTest(FUNC10(Simd::Avx512bw::BackgroundPackedShiftRangeMasked), FUNC10(SimdBackgroundPackedShiftRangeMasked));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W - O >= Simd::Neon::A)
+            result = result && BackgroundPackedShiftRangeMaskedAutoTest(FUNC10(Simd::Neon::BackgroundPackedShiftRangeMasked), FUNC10(SimdBackgroundPackedShiftRangeMasked));
+#endif 
+
+        return result;
+    }
+
+    bool BackgroundPackedAdjustRangeMaskedAutoTest()
+    {
+        bool result = true;
+
+        result = result && BackgroundPackedAdjustRangeMaskedAutoTest(FUNC11(Simd::Base::BackgroundPackedAdjustRangeMasked), FUNC11(SimdBackgroundPackedAdjustRangeMasked));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W - O >= Simd::Sse2::A)
+            result = result && BackgroundPackedAdjustRangeMaskedAutoTest(FUNC11(Simd::Sse2::BackgroundPackedAdjustRangeMasked), FUNC11(SimdBackgroundPackedAdjustRangeMasked));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W - O >= Simd::Avx2::A)
+            result = result && BackgroundPackedAdjustRangeMaskedAutoTest(FUNC11(Simd::Avx2::BackgroundPackedAdjustRangeMasked), FUNC11(SimdBackgroundPackedAdjustRangeMasked));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && BackgroundPackedAdjustRangeMaskedAutoTest(FUNC11(Simd::Avx512bw::BackgroundPackedAdjustRangeMasked), FUNC11(SimdBackgroundPackedAdjustRangeMasked));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W - O >= Simd::Neon::A)
+            result = result && BackgroundPackedAdjustRangeMaskedAutoTest(FUNC11(Simd::Neon::BackgroundPackedAdjustRangeMasked), FUNC11(SimdBackgroundPackedAdjustRangeMasked));
+#endif 
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     bool BackgroundChangeRangeDataTest(bool create, int width, int height, const Func1 & f)
@@ -0,0 +1,216 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct Func
+        {
+            typedef void(*FuncPtr)(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * dst, size_t dstStride);
+            FuncPtr func;
+            String description;
+
+            Func(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & src, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.width, src.height, src.stride, (SimdPixelFormatType)src.format, dst.data, dst.stride);
+            }
+        };
+
+        struct FuncA
+        {
+            typedef void(*FuncPtr)(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+            FuncPtr func;
+            String description;
+
+            FuncA(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & src, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.width, src.height, src.stride, (SimdPixelFormatType)src.format, dst.data, dst.stride, 0xFF);
+            }
+        };
+    }
+
+#define FUNC(func) Func(func, #func)
+#define FUNC_A(func) FuncA(func, #func)
+
+    template<class F> bool BayerDemosaicAutoTest(int width, int height, View::Format srcFormat, View::Format dstFormat, size_t scale, const F & f1, const F & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "] of " << FormatDescription(srcFormat) << ".");
+
+        View s(width, height, srcFormat, NULL, TEST_ALIGN(width));
+        FillRandom(s);
+
+        View d1(width / scale, height / scale, dstFormat, NULL, TEST_ALIGN(width));
+        View d2(width / scale, height / scale, dstFormat, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, d2));
+
+        result = result && Compare(d1, d2, 0, true, 32);
+
+        return result;
+    }
+
+    template<class F> bool BayerDemosaicAutoTest(View::Format dstFormat, size_t scale, const F & f1, const F & f2)
+    {
+        bool result = true;
+
+        for (View::Format format = View::BayerGrbg; format <= View::BayerBggr; format = View::Format(format + 1))
+        {
+            result = result && BayerDemosaicAutoTest(W, H, format, dstFormat, scale, f1, f2);
+            result = result && BayerDemosaicAutoTest(W + E, H - E, format, dstFormat, scale, f1, f2);
+            result = result && BayerDemosaicAutoTest(W - E, H + E, format, dstFormat, scale, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool BayerToBgrMhcAutoTest()
+    {
+        bool result = true;
+
+        result = result && BayerDemosaicAutoTest(View::Bgr24, 1, FUNC(Simd::Base::BayerToBgrMhc), FUNC(SimdBayerToBgrMhc));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable && W >= Simd::Ssse3::A + 4)
+            result = result && BayerDemosaicAutoTest(View::Bgr24, 1, FUNC(Simd::Ssse3::BayerToBgrMhc), FUNC(SimdBayerToBgrMhc));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A + 4)
+            result = result && BayerDemosaicAutoTest(View::Bgr24, 1, FUNC(Simd::Avx2::BayerToBgrMhc), FUNC(SimdBayerToBgrMhc));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A + 4)
+            result = result && BayerDemosaicAutoTest(View::Bgr24, 1, FUNC(Simd::Avx512bw::BayerToBgrMhc), FUNC(SimdBayerToBgrMhc));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A + 4)
+            result = result && BayerDemosaicAutoTest(View::Bgr24, 1, FUNC(Simd::Neon::BayerToBgrMhc), FUNC(SimdBayerToBgrMhc));
+#endif 
+
+        return result;
+    }
+
+    bool BayerToBgraMhcAutoTest()
+    {
+        bool result = true;
+
+        result = result && BayerDemosaicAutoTest(View::Bgra32, 1, FUNC_A(Simd::Base::BayerToBgraMhc), FUNC_A(SimdBayerToBgraMhc));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::A + 4)
+            result = result && BayerDemosaicAutoTest(View::Bgra32, 1, FUNC_A(Simd::Sse2::BayerToBgraMhc), FUNC_A(SimdBayerToBgraMhc));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A + 4)
+            result = result && BayerDemosaicAutoTest(View::Bgra32, 1, FUNC_A(Simd::Avx2::BayerToBgraMhc), FUNC_A(SimdBayerToBgraMhc));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A + 4)
+            result = result && BayerDemosaicAutoTest(View::Bgra32, 1, FUNC_A(Simd::Avx512bw::BayerToBgraMhc), FUNC_A(SimdBayerToBgraMhc));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A + 4)
+            result = result && BayerDemosaicAutoTest(View::Bgra32, 1, FUNC_A(Simd::Neon::BayerToBgraMhc), FUNC_A(SimdBayerToBgraMhc));
+#endif 
+
+        return result;
+    }
+
+    bool BayerToBgrHalfAutoTest()
+    {
+        bool result = true;
+
+        result = result && BayerDemosaicAutoTest(View::Bgr24, 2, FUNC(Simd::Base::BayerToBgrHalf), FUNC(SimdBayerToBgrHalf));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable && W >= Simd::Ssse3::DA)
+            result = result && BayerDemosaicAutoTest(View::Bgr24, 2, FUNC(Simd::Ssse3::BayerToBgrHalf), FUNC(SimdBayerToBgrHalf));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && BayerDemosaicAutoTest(View::Bgr24, 2, FUNC(Simd::Avx2::BayerToBgrHalf), FUNC(SimdBayerToBgrHalf));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::DA)
+            result = result && BayerDemosaicAutoTest(View::Bgr24, 2, FUNC(Simd::Avx512bw::BayerToBgrHalf), FUNC(SimdBayerToBgrHalf));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::DA)
+            result = result && BayerDemosaicAutoTest(View::Bgr24, 2, FUNC(Simd::Neon::BayerToBgrHalf), FUNC(SimdBayerToBgrHalf));
+#endif 
+
+        return result;
+    }
+
+    bool BayerToGrayAutoTest()
+    {
+        bool result = true;
+
+        result = result && BayerDemosaicAutoTest(View::Gray8, 1, FUNC(Simd::Base::BayerToGray), FUNC(SimdBayerToGray));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::A + 4)
+            result = result && BayerDemosaicAutoTest(View::Gray8, 1, FUNC(Simd::Sse2::BayerToGray), FUNC(SimdBayerToGray));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A + 4)
+            result = result && BayerDemosaicAutoTest(View::Gray8, 1, FUNC(Simd::Avx2::BayerToGray), FUNC(SimdBayerToGray));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A + 4)
+            result = result && BayerDemosaicAutoTest(View::Gray8, 1, FUNC(Simd::Avx512bw::BayerToGray), FUNC(SimdBayerToGray));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A + 4)
+            result = result && BayerDemosaicAutoTest(View::Gray8, 1, FUNC(Simd::Neon::BayerToGray), FUNC(SimdBayerToGray));
+#endif 
+
+        return result;
+    }
+}
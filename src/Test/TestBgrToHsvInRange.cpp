@@ -0,0 +1,113 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct Func
+        {
+            typedef void(*FuncPtr)(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, const uint8_t * lower, const uint8_t * upper, uint8_t * mask, size_t maskStride);
+            FuncPtr func;
+            String description;
+
+            Func(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & bgr, const uint8_t * lower, const uint8_t * upper, View & mask) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(bgr.data, bgr.width, bgr.height, bgr.stride, lower, upper, mask.data, mask.stride);
+            }
+        };
+    }
+
+#define FUNC(func) Func(func, #func)
+
+    bool BgrToHsvInRangeAutoTest(int width, int height, const uint8_t * lower, const uint8_t * upper, const Func & f1, const Func & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "] and hue range [" << int(lower[0]) << "," << int(upper[0]) << "].");
+
+        View bgr(width, height, View::Bgr24, NULL, TEST_ALIGN(width));
+        FillRandom(bgr);
+
+        View mask1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View mask2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(bgr, lower, upper, mask1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(bgr, lower, upper, mask2));
+
+        result = result && Compare(mask1, mask2, 0, true, 64);
+
+        return result;
+    }
+
+    bool BgrToHsvInRangeAutoTest(const Func & f1, const Func & f2)
+    {
+        bool result = true;
+
+        const uint8_t lower[2][3] = { { 20, 40, 60 }, { 230, 30, 30 } };
+        const uint8_t upper[2][3] = { { 120, 220, 250 }, { 25, 255, 200 } };
+        for (size_t i = 0; i < 2; ++i)
+        {
+            result = result && BgrToHsvInRangeAutoTest(W, H, lower[i], upper[i], f1, f2);
+            result = result && BgrToHsvInRangeAutoTest(W + O, H - O, lower[i], upper[i], f1, f2);
+        }
+
+        return result;
+    }
+
+    bool BgrToHsvInRangeAutoTest()
+    {
+        bool result = true;
+
+        result = result && BgrToHsvInRangeAutoTest(FUNC(Simd::Base::BgrToHsvInRange), FUNC(SimdBgrToHsvInRange));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && BgrToHsvInRangeAutoTest(FUNC(Simd::Sse41::BgrToHsvInRange), FUNC(SimdBgrToHsvInRange));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && BgrToHsvInRangeAutoTest(FUNC(Simd::Avx2::BgrToHsvInRange), FUNC(SimdBgrToHsvInRange));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && BgrToHsvInRangeAutoTest(FUNC(Simd::Avx512bw::BgrToHsvInRange), FUNC(SimdBgrToHsvInRange));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && BgrToHsvInRangeAutoTest(FUNC(Simd::Neon::BgrToHsvInRange), FUNC(SimdBgrToHsvInRange));
+#endif 
+
+        return result;
+    }
+}
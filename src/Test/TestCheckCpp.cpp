@@ -99,6 +99,14 @@ namespace Test
         Frame fs(2, 2, Frame::Yuv420p);
         Frame fd(2, 2, Frame::Bgr24);
         Simd::Convert(fs, fd);
+
+        Frame fp(2, 2, Frame::P010), buffer;
+        Simd::Convert(fd, fp, &buffer);
+
+        Frame fc(4, 2, Frame::Nv12), fr(8, 6, Frame::Nv12), ft(2, 4, Frame::Nv12);
+        Simd::Crop(fr, Simd::Rectangle<ptrdiff_t>(2, 2, 6, 4), fc);
+        Simd::ResizeBilinear(fc, fr);
+        Simd::TransformImage(fc, ::SimdTransformRotate90, ft);
     }
 
     static void TestPyramid()
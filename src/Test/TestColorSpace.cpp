@@ -0,0 +1,662 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncLab
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride);
+            FuncPtr func;
+            String description;
+
+            FuncLab(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & src, View & dst, size_t width) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, width, src.height, src.stride, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_LAB(function) FuncLab(function, #function)
+
+    static void FillRandomLab32f(View & lab)
+    {
+        assert(lab.format == View::Float && lab.width % 3 == 0);
+
+        for (size_t row = 0; row < lab.height; ++row)
+        {
+            float * data = (float*)(lab.data + row * lab.stride);
+            for (size_t col = 0; col < lab.width; col += 3)
+            {
+                data[col + 0] = float(Random() * 100.0);
+                data[col + 1] = float(Random() * 256.0 - 128.0);
+                data[col + 2] = float(Random() * 256.0 - 128.0);
+            }
+        }
+    }
+
+    bool BgrToLabAutoTest(int width, int height, View::Format dstType, const FuncLab & f1, const FuncLab & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View src(width, height, View::Bgr24, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        size_t dstWidth = dstType == View::Float ? width * 3 : width;
+        View dst1(dstWidth, height, dstType, NULL, TEST_ALIGN(width));
+        View dst2(dstWidth, height, dstType, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1, width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2, width));
+
+        if (dstType == View::Float)
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+        else
+            result = result && Compare(dst1, dst2, 1, true, 64);
+
+        return result;
+    }
+
+    bool BgrToLabAutoTest(View::Format dstType, const FuncLab & f1, const FuncLab & f2)
+    {
+        bool result = true;
+
+        result = result && BgrToLabAutoTest(W, H, dstType, f1, f2);
+        result = result && BgrToLabAutoTest(W + O, H - O, dstType, f1, f2);
+
+        return result;
+    }
+
+    bool BgrToLabAutoTest()
+    {
+        bool result = true;
+
+        result = result && BgrToLabAutoTest(View::Lab24, FUNC_LAB(Simd::Base::BgrToLab), FUNC_LAB(SimdBgrToLab));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && BgrToLabAutoTest(View::Lab24, FUNC_LAB(Simd::Sse41::BgrToLab), FUNC_LAB(SimdBgrToLab));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && BgrToLabAutoTest(View::Lab24, FUNC_LAB(Simd::Avx2::BgrToLab), FUNC_LAB(SimdBgrToLab));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && BgrToLabAutoTest(View::Lab24, FUNC_LAB(Simd::Avx512bw::BgrToLab), FUNC_LAB(SimdBgrToLab));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && BgrToLabAutoTest(View::Lab24, FUNC_LAB(Simd::Neon::BgrToLab), FUNC_LAB(SimdBgrToLab));
+#endif 
+
+        return result;
+    }
+
+    bool BgrToLab32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && BgrToLabAutoTest(View::Float, FUNC_LAB(Simd::Base::BgrToLab32f), FUNC_LAB(SimdBgrToLab32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && BgrToLabAutoTest(View::Float, FUNC_LAB(Simd::Sse41::BgrToLab32f), FUNC_LAB(SimdBgrToLab32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && BgrToLabAutoTest(View::Float, FUNC_LAB(Simd::Avx2::BgrToLab32f), FUNC_LAB(SimdBgrToLab32f));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && BgrToLabAutoTest(View::Float, FUNC_LAB(Simd::Avx512bw::BgrToLab32f), FUNC_LAB(SimdBgrToLab32f));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && BgrToLabAutoTest(View::Float, FUNC_LAB(Simd::Neon::BgrToLab32f), FUNC_LAB(SimdBgrToLab32f));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    bool LabToBgrAutoTest(int width, int height, View::Format srcType, const FuncLab & f1, const FuncLab & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View src;
+        if (srcType == View::Float)
+        {
+            src.Recreate(width * 3, height, View::Float, NULL, TEST_ALIGN(width));
+            FillRandomLab32f(src);
+        }
+        else
+        {
+            src.Recreate(width, height, View::Lab24, NULL, TEST_ALIGN(width));
+            FillRandom(src);
+        }
+
+        View dst1(width, height, View::Bgr24, NULL, TEST_ALIGN(width));
+        View dst2(width, height, View::Bgr24, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1, width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2, width));
+
+        result = result && Compare(dst1, dst2, 1, true, 64);
+
+        return result;
+    }
+
+    bool LabToBgrAutoTest(View::Format srcType, const FuncLab & f1, const FuncLab & f2)
+    {
+        bool result = true;
+
+        result = result && LabToBgrAutoTest(W, H, srcType, f1, f2);
+        result = result && LabToBgrAutoTest(W + O, H - O, srcType, f1, f2);
+
+        return result;
+    }
+
+    bool LabToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && LabToBgrAutoTest(View::Lab24, FUNC_LAB(Simd::Base::LabToBgr), FUNC_LAB(SimdLabToBgr));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && LabToBgrAutoTest(View::Lab24, FUNC_LAB(Simd::Sse41::LabToBgr), FUNC_LAB(SimdLabToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && LabToBgrAutoTest(View::Lab24, FUNC_LAB(Simd::Avx2::LabToBgr), FUNC_LAB(SimdLabToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && LabToBgrAutoTest(View::Lab24, FUNC_LAB(Simd::Avx512bw::LabToBgr), FUNC_LAB(SimdLabToBgr));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && LabToBgrAutoTest(View::Lab24, FUNC_LAB(Simd::Neon::LabToBgr), FUNC_LAB(SimdLabToBgr));
+#endif 
+
+        return result;
+    }
+
+    bool Lab32fToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && LabToBgrAutoTest(View::Float, FUNC_LAB(Simd::Base::Lab32fToBgr), FUNC_LAB(SimdLab32fToBgr));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && LabToBgrAutoTest(View::Float, FUNC_LAB(Simd::Sse41::Lab32fToBgr), FUNC_LAB(SimdLab32fToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && LabToBgrAutoTest(View::Float, FUNC_LAB(Simd::Avx2::Lab32fToBgr), FUNC_LAB(SimdLab32fToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && LabToBgrAutoTest(View::Float, FUNC_LAB(Simd::Avx512bw::Lab32fToBgr), FUNC_LAB(SimdLab32fToBgr));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && LabToBgrAutoTest(View::Float, FUNC_LAB(Simd::Neon::Lab32fToBgr), FUNC_LAB(SimdLab32fToBgr));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct LabSample
+        {
+            uint8_t bgr[3];
+            float lab[3];
+        };
+
+        // CIE Lab values of sRGB colors (D65 white point).
+        const LabSample LAB_SAMPLES[] = {
+            { { 0, 0, 0 }, { 0.00f, 0.00f, 0.00f } },
+            { { 255, 255, 255 }, { 100.00f, 0.00f, 0.00f } },
+            { { 0, 0, 255 }, { 53.24f, 80.09f, 67.20f } },
+            { { 0, 255, 0 }, { 87.74f, -86.18f, 83.18f } },
+            { { 255, 0, 0 }, { 32.30f, 79.19f, -107.86f } },
+            { { 0, 255, 255 }, { 97.14f, -21.55f, 94.48f } },
+            { { 255, 255, 0 }, { 91.11f, -48.09f, -14.13f } },
+            { { 255, 0, 255 }, { 60.32f, 98.24f, -60.83f } },
+            { { 128, 128, 128 }, { 53.59f, 0.00f, 0.00f } },
+            { { 10, 10, 10 }, { 2.74f, 0.00f, 0.00f } },
+            { { 40, 200, 120 }, { 73.19f, -48.67f, 65.81f } },
+            { { 200, 30, 90 }, { 32.42f, 62.12f, -76.04f } },
+            { { 16, 64, 235 }, { 53.35f, 63.47f, 61.18f } } };
+        const size_t LAB_SAMPLES_SIZE = sizeof(LAB_SAMPLES) / sizeof(LAB_SAMPLES[0]);
+    }
+
+    const int LAB_REFERENCE_ERROR_8U = 1;
+    const float LAB_REFERENCE_ERROR_32F = 0.05f;
+
+    bool BgrToLabReferenceAutoTest(int width, int height, const FuncLab & f8u, const FuncLab & f32f)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f8u.description << " & " << f32f.description << " against reference values [" << width << ", " << height << "].");
+
+        View bgr(width, height, View::Bgr24, NULL, TEST_ALIGN(width));
+        for (size_t row = 0; row < (size_t)height; ++row)
+            for (size_t col = 0; col < (size_t)width; ++col)
+                memcpy(bgr.data + row * bgr.stride + col * 3, LAB_SAMPLES[col % LAB_SAMPLES_SIZE].bgr, 3);
+
+        View lab8u(width, height, View::Lab24, NULL, TEST_ALIGN(width));
+        View lab32f(width * 3, height, View::Float, NULL, TEST_ALIGN(width));
+
+        f8u.Call(bgr, lab8u, width);
+        f32f.Call(bgr, lab32f, width);
+
+        for (size_t row = 0; row < (size_t)height && result; ++row)
+        {
+            const uint8_t * p8u = lab8u.data + row * lab8u.stride;
+            const float * p32f = (const float*)(lab32f.data + row * lab32f.stride);
+            for (size_t col = 0; col < (size_t)width && result; ++col, p8u += 3, p32f += 3)
+            {
+                const float * ref = LAB_SAMPLES[col % LAB_SAMPLES_SIZE].lab;
+                int ref8u[3] = { RoundAndRestrict(ref[0] * 255.0 / 100.0), RoundAndRestrict(ref[1] + 128.0), RoundAndRestrict(ref[2] + 128.0) };
+                if (std::abs(p8u[0] - ref8u[0]) > LAB_REFERENCE_ERROR_8U || std::abs(p8u[1] - ref8u[1]) > LAB_REFERENCE_ERROR_8U ||
+                    std::abs(p8u[2] - ref8u[2]) > LAB_REFERENCE_ERROR_8U)
+                {
+                    TEST_LOG_SS(Error, f8u.description << " : pixel [" << col << ", " << row << "] = {" << (int)p8u[0] << ", "
+                        << (int)p8u[1] << ", " << (int)p8u[2] << "}, reference = {" << ref8u[0] << ", " << ref8u[1] << ", " << ref8u[2] << "}.");
+                    result = false;
+                }
+                if (std::abs(p32f[0] - ref[0]) > LAB_REFERENCE_ERROR_32F || std::abs(p32f[1] - ref[1]) > LAB_REFERENCE_ERROR_32F ||
+                    std::abs(p32f[2] - ref[2]) > LAB_REFERENCE_ERROR_32F)
+                {
+                    TEST_LOG_SS(Error, f32f.description << " : pixel [" << col << ", " << row << "] = {" << p32f[0] << ", "
+                        << p32f[1] << ", " << p32f[2] << "}, reference = {" << ref[0] << ", " << ref[1] << ", " << ref[2] << "}.");
+                    result = false;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    bool BgrToLabReferenceAutoTest(const FuncLab & f8u, const FuncLab & f32f)
+    {
+        bool result = true;
+
+        result = result && BgrToLabReferenceAutoTest(W, H, f8u, f32f);
+        result = result && BgrToLabReferenceAutoTest(W + O, H - O, f8u, f32f);
+
+        return result;
+    }
+
+    bool BgrToLabReferenceAutoTest()
+    {
+        bool result = true;
+
+        result = result && BgrToLabReferenceAutoTest(FUNC_LAB(Simd::Base::BgrToLab), FUNC_LAB(Simd::Base::BgrToLab32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && BgrToLabReferenceAutoTest(FUNC_LAB(Simd::Sse41::BgrToLab), FUNC_LAB(Simd::Sse41::BgrToLab32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && BgrToLabReferenceAutoTest(FUNC_LAB(Simd::Avx2::BgrToLab), FUNC_LAB(Simd::Avx2::BgrToLab32f));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && BgrToLabReferenceAutoTest(FUNC_LAB(Simd::Avx512bw::BgrToLab), FUNC_LAB(Simd::Avx512bw::BgrToLab32f));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && BgrToLabReferenceAutoTest(FUNC_LAB(Simd::Neon::BgrToLab), FUNC_LAB(Simd::Neon::BgrToLab32f));
+#endif 
+
+        return result;
+    }
+
+    // Lab24 stores a and b as integers, so a single channel can be restored with a large error
+    // in saturated colors, but the average error must stay small.
+    const int LAB_ROUND_TRIP_ERROR_MAX_8U = 26;
+    const double LAB_ROUND_TRIP_ERROR_MEAN_8U = 1.0;
+    const int LAB_ROUND_TRIP_ERROR_MAX_32F = 1;
+    const double LAB_ROUND_TRIP_ERROR_MEAN_32F = 0.1;
+
+    bool LabRoundTripAutoTest(int width, int height, View::Format labType, const FuncLab & forward, const FuncLab & inverse)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << forward.description << " -> " << inverse.description << " round trip [" << width << ", " << height << "].");
+
+        View src(width, height, View::Bgr24, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        size_t labWidth = labType == View::Float ? width * 3 : width;
+        View lab(labWidth, height, labType, NULL, TEST_ALIGN(width));
+        View dst(width, height, View::Bgr24, NULL, TEST_ALIGN(width));
+
+        forward.Call(src, lab, width);
+        inverse.Call(lab, dst, width);
+
+        int errorMax = 0;
+        double errorSum = 0;
+        for (size_t row = 0; row < (size_t)height; ++row)
+        {
+            const uint8_t * s = src.data + row * src.stride;
+            const uint8_t * d = dst.data + row * dst.stride;
+            for (size_t i = 0, n = width * 3; i < n; ++i)
+            {
+                int error = std::abs(s[i] - d[i]);
+                errorMax = std::max(errorMax, error);
+                errorSum += error;
+            }
+        }
+        double errorMean = errorSum / (width * height * 3);
+
+        int allowedMax = labType == View::Float ? LAB_ROUND_TRIP_ERROR_MAX_32F : LAB_ROUND_TRIP_ERROR_MAX_8U;
+        double allowedMean = labType == View::Float ? LAB_ROUND_TRIP_ERROR_MEAN_32F : LAB_ROUND_TRIP_ERROR_MEAN_8U;
+        if (errorMax > allowedMax || errorMean > allowedMean)
+        {
+            TEST_LOG_SS(Error, forward.description << " -> " << inverse.description << " : error max = " << errorMax
+                << " (allowed " << allowedMax << "), error mean = " << errorMean << " (allowed " << allowedMean << ").");
+            result = false;
+        }
+
+        return result;
+    }
+
+    bool LabRoundTripAutoTest(const FuncLab & forward8u, const FuncLab & inverse8u, const FuncLab & forward32f, const FuncLab & inverse32f)
+    {
+        bool result = true;
+
+        result = result && LabRoundTripAutoTest(W, H, View::Lab24, forward8u, inverse8u);
+        result = result && LabRoundTripAutoTest(W + O, H - O, View::Lab24, forward8u, inverse8u);
+        result = result && LabRoundTripAutoTest(W, H, View::Float, forward32f, inverse32f);
+        result = result && LabRoundTripAutoTest(W + O, H - O, View::Float, forward32f, inverse32f);
+
+        return result;
+    }
+
+    bool LabRoundTripAutoTest()
+    {
+        bool result = true;
+
+        result = result && LabRoundTripAutoTest(FUNC_LAB(Simd::Base::BgrToLab), FUNC_LAB(Simd::Base::LabToBgr),
+            FUNC_LAB(Simd::Base::BgrToLab32f), FUNC_LAB(Simd::Base::Lab32fToBgr));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && LabRoundTripAutoTest(FUNC_LAB(Simd::Sse41::BgrToLab), FUNC_LAB(Simd::Sse41::LabToBgr),
+                FUNC_LAB(Simd::Sse41::BgrToLab32f), FUNC_LAB(Simd::Sse41::Lab32fToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && LabRoundTripAutoTest(FUNC_LAB(Simd::Avx2::BgrToLab), FUNC_LAB(Simd::Avx2::LabToBgr),
+                FUNC_LAB(Simd::Avx2::BgrToLab32f), FUNC_LAB(Simd::Avx2::Lab32fToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && LabRoundTripAutoTest(FUNC_LAB(Simd::Avx512bw::BgrToLab), FUNC_LAB(Simd::Avx512bw::LabToBgr),
+                FUNC_LAB(Simd::Avx512bw::BgrToLab32f), FUNC_LAB(Simd::Avx512bw::Lab32fToBgr));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && LabRoundTripAutoTest(FUNC_LAB(Simd::Neon::BgrToLab), FUNC_LAB(Simd::Neon::LabToBgr),
+                FUNC_LAB(Simd::Neon::BgrToLab32f), FUNC_LAB(Simd::Neon::Lab32fToBgr));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncYCoCg
+        {
+            typedef void(*FuncPtr)(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * co, size_t coStride, uint8_t * cg, size_t cgStride);
+            FuncPtr func;
+            String description;
+
+            FuncYCoCg(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & bgr, View & y, View & co, View & cg) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, co.data, co.stride, cg.data, cg.stride);
+            }
+        };
+    }
+
+#define FUNC_YCOCG(function) FuncYCoCg(function, #function)
+
+    bool BgrToYCoCgRAutoTest(int width, int height, const FuncYCoCg & f1, const FuncYCoCg & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View bgr(width, height, View::Bgr24, NULL, TEST_ALIGN(width));
+        FillRandom(bgr);
+
+        View y1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View co1(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        View cg1(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        View y2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View co2(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        View cg2(width, height, View::Int16, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(bgr, y1, co1, cg1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(bgr, y2, co2, cg2));
+
+        result = result && Compare(y1, y2, 0, true, 64, 0, "y");
+        result = result && Compare(co1, co2, 0, true, 64, 0, "co");
+        result = result && Compare(cg1, cg2, 0, true, 64, 0, "cg");
+
+        if (result)
+        {
+            View restored(width, height, View::Bgr24, NULL, TEST_ALIGN(width));
+            Simd::YCoCgRToBgr(y2, co2, cg2, restored);
+            result = result && Compare(bgr, restored, 0, true, 64, 0, "restored");
+        }
+
+        return result;
+    }
+
+    bool BgrToYCoCgRAutoTest(const FuncYCoCg & f1, const FuncYCoCg & f2)
+    {
+        bool result = true;
+
+        result = result && BgrToYCoCgRAutoTest(W, H, f1, f2);
+        result = result && BgrToYCoCgRAutoTest(W + O, H - O, f1, f2);
+
+        return result;
+    }
+
+    bool BgrToYCoCgRAutoTest()
+    {
+        bool result = true;
+
+        result = result && BgrToYCoCgRAutoTest(FUNC_YCOCG(Simd::Base::BgrToYCoCgR), FUNC_YCOCG(SimdBgrToYCoCgR));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && BgrToYCoCgRAutoTest(FUNC_YCOCG(Simd::Sse41::BgrToYCoCgR), FUNC_YCOCG(SimdBgrToYCoCgR));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && BgrToYCoCgRAutoTest(FUNC_YCOCG(Simd::Avx2::BgrToYCoCgR), FUNC_YCOCG(SimdBgrToYCoCgR));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && BgrToYCoCgRAutoTest(FUNC_YCOCG(Simd::Avx512bw::BgrToYCoCgR), FUNC_YCOCG(SimdBgrToYCoCgR));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && BgrToYCoCgRAutoTest(FUNC_YCOCG(Simd::Neon::BgrToYCoCgR), FUNC_YCOCG(SimdBgrToYCoCgR));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncYCoCgInv
+        {
+            typedef void(*FuncPtr)(const uint8_t * y, size_t yStride, const uint8_t * co, size_t coStride, const uint8_t * cg, size_t cgStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+            FuncPtr func;
+            String description;
+
+            FuncYCoCgInv(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & y, const View & co, const View & cg, View & bgr) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, co.data, co.stride, cg.data, cg.stride, y.width, y.height, bgr.data, bgr.stride);
+            }
+        };
+    }
+
+#define FUNC_YCOCG_INV(function) FuncYCoCgInv(function, #function)
+
+    static void FillRandomChroma(View & view)
+    {
+        assert(view.format == View::Int16);
+
+        for (size_t row = 0; row < view.height; ++row)
+        {
+            int16_t * data = (int16_t*)(view.data + row * view.stride);
+            for (size_t col = 0; col < view.width; ++col)
+                data[col] = int16_t(Random(510) - 255);
+        }
+    }
+
+    bool YCoCgRToBgrAutoTest(int width, int height, const FuncYCoCgInv & f1, const FuncYCoCgInv & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View y(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View co(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        View cg(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom(y);
+        FillRandomChroma(co);
+        FillRandomChroma(cg);
+
+        View bgr1(width, height, View::Bgr24, NULL, TEST_ALIGN(width));
+        View bgr2(width, height, View::Bgr24, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, co, cg, bgr1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, co, cg, bgr2));
+
+        result = result && Compare(bgr1, bgr2, 0, true, 64);
+
+        return result;
+    }
+
+    bool YCoCgRToBgrAutoTest(const FuncYCoCgInv & f1, const FuncYCoCgInv & f2)
+    {
+        bool result = true;
+
+        result = result && YCoCgRToBgrAutoTest(W, H, f1, f2);
+        result = result && YCoCgRToBgrAutoTest(W + O, H - O, f1, f2);
+
+        return result;
+    }
+
+    bool YCoCgRToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && YCoCgRToBgrAutoTest(FUNC_YCOCG_INV(Simd::Base::YCoCgRToBgr), FUNC_YCOCG_INV(SimdYCoCgRToBgr));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && YCoCgRToBgrAutoTest(FUNC_YCOCG_INV(Simd::Sse41::YCoCgRToBgr), FUNC_YCOCG_INV(SimdYCoCgRToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && YCoCgRToBgrAutoTest(FUNC_YCOCG_INV(Simd::Avx2::YCoCgRToBgr), FUNC_YCOCG_INV(SimdYCoCgRToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A)
+            result = result && YCoCgRToBgrAutoTest(FUNC_YCOCG_INV(Simd::Avx512bw::YCoCgRToBgr), FUNC_YCOCG_INV(SimdYCoCgRToBgr));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && YCoCgRToBgrAutoTest(FUNC_YCOCG_INV(Simd::Neon::YCoCgRToBgr), FUNC_YCOCG_INV(SimdYCoCgRToBgr));
+#endif 
+
+        return result;
+    }
+}
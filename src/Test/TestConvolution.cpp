@@ -438,4 +438,65 @@ namespace Test
 
         return result;
     }
+
+    //-----------------------------------------------------------------------
+
+    bool ConvolutionScratchAutoTest(const Param & p, size_t & maxSize)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SimdConvolutionScratchPeak [" << p.batch << "x" << p.srcC << "x" << p.srcH << "x" << p.srcW 
+            << "-" << p.dstC << "x" << p.kernelY << "x" << p.kernelX << "-" << p.group << "-" << p.trans << "].");
+
+        void * convolution = ::SimdConvolutionInit(p.trans, p.batch, p.srcC, p.srcH, p.srcW, p.dstC, p.kernelY, p.kernelX,
+            p.dilationY, p.dilationX, p.strideY, p.strideX, p.padY, p.padX, p.padH, p.padW, p.group, p.activation, NULL);
+        size_t size = ::SimdConvolutionExternalBufferSize(convolution);
+        maxSize = Simd::Max(maxSize, size);
+
+        Tensor32f src({ p.batch, p.trans ? p.srcH : p.srcC, p.trans ? p.srcW : p.srcH, p.trans ? p.srcC : p.srcW });
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+        Tensor32f weight({ p.trans ? p.kernelY : p.dstC, p.trans ? p.kernelX : p.srcC / p.group,
+            p.trans ? p.srcC / p.group : p.kernelY, p.trans ? p.dstC : p.kernelX });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        Tensor32f bias({ p.dstC });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+
+        size_t dstH = (p.srcH + p.padY + p.padH - (p.dilationY * (p.kernelY - 1) + 1)) / p.strideY + 1;
+        size_t dstW = (p.srcW + p.padX + p.padW - (p.dilationX * (p.kernelX - 1) + 1)) / p.strideX + 1;
+        Tensor32f dst1({ p.batch, p.trans ? dstH : p.dstC, p.trans ? dstW : dstH, p.trans ? p.dstC : dstW });
+        Tensor32f dst2({ p.batch, p.trans ? dstH : p.dstC, p.trans ? dstW : dstH, p.trans ? p.dstC : dstW });
+        Tensor32f buf({ size });
+
+        ::SimdConvolutionSetParams(convolution, weight.Data(), p.trans, NULL, bias.Data(), NULL);
+        ::SimdConvolutionForward(convolution, src.Data(), buf.Data(), dst1.Data());
+        ::SimdConvolutionForward(convolution, src.Data(), NULL, dst2.Data());
+        ::SimdRelease(convolution);
+
+        result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+
+        if (::SimdConvolutionScratchPeak() < maxSize)
+        {
+            TEST_LOG_SS(Error, "Scratch peak " << ::SimdConvolutionScratchPeak() << " is less than required size " << maxSize << "!");
+            result = false;
+        }
+
+        return result;
+    }
+
+    bool ConvolutionScratchAutoTest()
+    {
+        bool result = true;
+
+        const ::SimdConvolutionActivationType a = ::SimdConvolutionActivationRelu;
+        Size _1(1, 1), _3(3, 3), _0(0, 0);
+        size_t maxSize = 0;
+
+        result = result && ConvolutionScratchAutoTest(Param(1, 64, 38, 38, 64, _3, _1, _1, _1, _1, 1, a, ::SimdFalse), maxSize);
+        result = result && ConvolutionScratchAutoTest(Param(1, 128, 19, 19, 256, _3, _1, _1, _1, _1, 1, a, ::SimdTrue), maxSize);
+        result = result && ConvolutionScratchAutoTest(Param(1, 32, 76, 76, 16, _3, _1, _1, _0, _0, 1, a, ::SimdFalse), maxSize);
+
+        ::SimdConvolutionScratchRelease();
+
+        return result;
+    }
 }
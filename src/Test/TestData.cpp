@@ -542,6 +542,14 @@ namespace Test
             return "_Hsv24";
         case View::Hsl24:
             return "_Hsl24";
+        case View::Rgb24:
+            return "_Rgb24";
+        case View::Rgba32:
+            return "_Rgba32";
+        case View::Uv32:
+            return "_Uv32";
+        case View::Lab24:
+            return "_Lab24";
         }
         assert(0);
         return "_Unknown";
@@ -29,7 +29,7 @@
 
 namespace Test
 {
-    typedef std::map<size_t, View> Samples;
+    typedef std::map<std::pair<size_t, bool>, View> Samples;
     std::recursive_mutex g_mutex;
     Samples g_samples;
 
@@ -39,7 +39,7 @@ namespace Test
 
         TEST_ALIGN(size.x);
 
-        View & dst = g_samples[size.x];
+        View & dst = g_samples[std::make_pair(size_t(size.x), large)];
         if (dst.format == View::Gray8)
             return dst;
 
@@ -309,6 +309,44 @@ namespace Test
         return result;
     }
 
+    bool DetectionHaarDetect16ipAutoTest()
+    {
+        bool result = true;
+
+        result = result && DetectionDetectAutoTest(0, 0, 1, FUNC_D(Simd::Base::DetectionHaarDetect16ip), FUNC_D(SimdDetectionHaarDetect16ip));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && DetectionDetectAutoTest(0, 0, 1, FUNC_D(Simd::Avx2::DetectionHaarDetect16ip), FUNC_D(SimdDetectionHaarDetect16ip));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && DetectionDetectAutoTest(0, 0, 1, FUNC_D(Simd::Avx512bw::DetectionHaarDetect16ip), FUNC_D(SimdDetectionHaarDetect16ip));
+#endif
+
+        return result;
+    }
+
+    bool DetectionHaarDetect16iiAutoTest()
+    {
+        bool result = true;
+
+        result = result && DetectionDetectAutoTest(0, 1, 1, FUNC_D(Simd::Base::DetectionHaarDetect16ii), FUNC_D(SimdDetectionHaarDetect16ii));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && DetectionDetectAutoTest(0, 1, 1, FUNC_D(Simd::Avx2::DetectionHaarDetect16ii), FUNC_D(SimdDetectionHaarDetect16ii));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && DetectionDetectAutoTest(0, 1, 1, FUNC_D(Simd::Avx512bw::DetectionHaarDetect16ii), FUNC_D(SimdDetectionHaarDetect16ii));
+#endif
+
+        return result;
+    }
+
     bool DetectionLbpDetect32fpAutoTest()
     {
         bool result = true;
@@ -425,6 +463,174 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        // Offsets in binary cascade header (see Simd::Base::Binary::Header).
+        const size_t BIN_NCATEGORIES = 24, BIN_WIDTH = 28, BIN_CAN_INT16 = 38, BIN_COUNT = 40, BIN_ITEM = 68, BIN_HEADER = 96;
+
+        SIMD_INLINE size_t BinarySection(const std::vector<uint8_t> & buffer, size_t index)
+        {
+            size_t offset = BIN_HEADER;
+            for (size_t i = 0; i < index; ++i)
+            {
+                uint32_t count, item;
+                memcpy(&count, buffer.data() + BIN_COUNT + i * 4, 4);
+                memcpy(&item, buffer.data() + BIN_ITEM + i * 4, 4);
+                offset += Simd::AlignHi(count * item, 16);
+            }
+            return offset;
+        }
+
+        bool DetectionBinaryCorruptTest(const std::vector<uint8_t> & buffer, size_t offset, int32_t value, const String & description)
+        {
+            std::vector<uint8_t> corrupt(buffer);
+            memcpy(corrupt.data() + offset, &value, 4);
+            void * bad = SimdDetectionLoadBinary(corrupt.data(), corrupt.size());
+            if (bad)
+            {
+                TEST_LOG_SS(Error, "Corrupted binary cascade (" << description << ") must not be loaded!");
+                SimdRelease(bad);
+                return false;
+            }
+            return true;
+        }
+    }
+
+    bool DetectionBinaryAutoTest(const String & path, int index)
+    {
+        bool result = true;
+
+        String suffix = "[" + ToString(index) + "]";
+        TEST_LOG_SS(Info, "Test Simd::Base::DetectionLoadBinary & SimdDetectionLoadBinary for cascade '" << path << "'.");
+
+        void * xml = NULL;
+        {
+            TEST_PERFORMANCE_TEST("SimdDetectionLoadA" + suffix);
+            xml = SimdDetectionLoadA(path.c_str());
+        }
+        if (xml == NULL)
+        {
+            TEST_LOG_SS(Error, "Can't load cascade '" << path << "' !");
+            return false;
+        }
+
+        size_t size = SimdDetectionSaveBinary(xml, NULL, 0);
+        std::vector<uint8_t> buffer0(size), buffer1(size), buffer2(size);
+        if (size == 0 || SimdDetectionSaveBinary(xml, buffer0.data(), size) != size)
+        {
+            TEST_LOG_SS(Error, "Can't save binary cascade!");
+            SimdRelease(xml);
+            return false;
+        }
+
+        void * bin1 = NULL, * bin2 = NULL;
+        {
+            TEST_PERFORMANCE_TEST("Simd::Base::DetectionLoadBinary" + suffix);
+            bin1 = Simd::Base::DetectionLoadBinary(buffer0.data(), size);
+        }
+        {
+            TEST_PERFORMANCE_TEST("SimdDetectionLoadBinary" + suffix);
+            bin2 = SimdDetectionLoadBinary(buffer0.data(), size);
+        }
+        if (bin1 == NULL || bin2 == NULL)
+        {
+            TEST_LOG_SS(Error, "Can't load binary cascade!");
+            result = false;
+        }
+        else
+        {
+            if (SimdDetectionSaveBinary(bin1, buffer1.data(), size) != size || memcmp(buffer0.data(), buffer1.data(), size) != 0 ||
+                SimdDetectionSaveBinary(bin2, buffer2.data(), size) != size || memcmp(buffer0.data(), buffer2.data(), size) != 0)
+            {
+                TEST_LOG_SS(Error, "Binary cascade is changed after loading!");
+                result = false;
+            }
+
+            size_t w0, h0, w1, h1;
+            SimdDetectionInfoFlags f0, f1;
+            SimdDetectionInfo(xml, &w0, &h0, &f0);
+            SimdDetectionInfo(bin1, &w1, &h1, &f1);
+            if (w0 != w1 || h0 != h1 || f0 != f1)
+            {
+                TEST_LOG_SS(Error, "Binary cascade has another parameters: [" << w0 << ", " << h0 << ", " << f0 << "] != [" << w1 << ", " << h1 << ", " << f1 << "]!");
+                result = false;
+            }
+        }
+
+        void * bad = SimdDetectionLoadBinary(buffer0.data(), size / 2);
+        if (bad)
+        {
+            TEST_LOG_SS(Error, "Truncated binary cascade must not be loaded!");
+            SimdRelease(bad);
+            result = false;
+        }
+
+        if (index < 2)
+        {
+            // A node threshold out of int16 range must disable int16 evaluation whatever the header says.
+            std::vector<uint8_t> hinted(buffer0);
+            float threshold = 1.0f;
+            memcpy(hinted.data() + BinarySection(buffer0, 2) + 4, &threshold, 4);
+            hinted[BIN_CAN_INT16] = 1;
+            void * bin3 = SimdDetectionLoadBinary(hinted.data(), size);
+            if (bin3 == NULL)
+            {
+                TEST_LOG_SS(Error, "Can't load binary cascade with changed node threshold!");
+                result = false;
+            }
+            else
+            {
+                size_t w3, h3;
+                SimdDetectionInfoFlags f3;
+                SimdDetectionInfo(bin3, &w3, &h3, &f3);
+                if (f3 & SimdDetectionInfoCanInt16)
+                {
+                    TEST_LOG_SS(Error, "Binary cascade must not trust canInt16 flag of header!");
+                    result = false;
+                }
+                SimdRelease(bin3);
+            }
+        }
+
+        int32_t width;
+        memcpy(&width, buffer0.data() + BIN_WIDTH, 4);
+        if (index < 2)
+        {
+            size_t rect = BinarySection(buffer0, 5) + 4;
+            result = result && DetectionBinaryCorruptTest(buffer0, BIN_NCATEGORIES, -1, "negative ncategories");
+            result = result && DetectionBinaryCorruptTest(buffer0, rect - 4, 2, "invalid HAAR tilted flag");
+            result = result && DetectionBinaryCorruptTest(buffer0, rect + 0, -1, "negative HAAR rect x");
+            result = result && DetectionBinaryCorruptTest(buffer0, rect + 4, -1, "negative HAAR rect y");
+            result = result && DetectionBinaryCorruptTest(buffer0, rect + 8, width + 1, "HAAR rect outside of window");
+            result = result && DetectionBinaryCorruptTest(buffer0, rect + 12, INT32_MAX, "HAAR rect outside of window");
+        }
+        else
+        {
+            size_t rect = BinarySection(buffer0, 6);
+            result = result && DetectionBinaryCorruptTest(buffer0, BIN_NCATEGORIES, 0, "zero ncategories");
+            result = result && DetectionBinaryCorruptTest(buffer0, rect + 0, -1, "negative LBP rect x");
+            result = result && DetectionBinaryCorruptTest(buffer0, rect + 8, width, "LBP rect outside of window");
+            result = result && DetectionBinaryCorruptTest(buffer0, rect + 12, 0, "empty LBP rect");
+        }
+
+        SimdRelease(bin2);
+        SimdRelease(bin1);
+        SimdRelease(xml);
+
+        return result;
+    }
+
+    bool DetectionBinaryAutoTest()
+    {
+        bool result = true;
+
+        result = result && DetectionBinaryAutoTest(ROOT_PATH + "/data/cascade/haar_face_0.xml", 0);
+        result = result && DetectionBinaryAutoTest(ROOT_PATH + "/data/cascade/haar_face_1.xml", 1);
+        result = result && DetectionBinaryAutoTest(ROOT_PATH + "/data/cascade/lbp_face.xml", 2);
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     bool DetectionDetectDataTest(bool create, const String & path, int width, int height, int throughColumn, int int16, const FuncD & f)
@@ -531,6 +737,16 @@ namespace Test
         return DetectionDetectDataTest(create, 0, 1, 0, FUNC_D(SimdDetectionHaarDetect32fi));
     }
 
+    bool DetectionHaarDetect16ipDataTest(bool create)
+    {
+        return DetectionDetectDataTest(create, 0, 0, 1, FUNC_D(SimdDetectionHaarDetect16ip));
+    }
+
+    bool DetectionHaarDetect16iiDataTest(bool create)
+    {
+        return DetectionDetectDataTest(create, 0, 1, 1, FUNC_D(SimdDetectionHaarDetect16ii));
+    }
+
     bool DetectionLbpDetect32fpDataTest(bool create)
     {
         return DetectionDetectDataTest(create, 1, 0, 0, FUNC_D(SimdDetectionLbpDetect32fp));
@@ -658,5 +874,86 @@ namespace Test
 
         return result;
     }
+
+    static size_t DetectionMatchCount(const Objects & a, const Objects & b, double overlapMin, int weightMin, size_t & total)
+    {
+        size_t count = 0;
+        total = 0;
+        for (size_t i = 0; i < a.size(); ++i)
+        {
+            if (a[i].weight < weightMin)
+                continue;
+            total++;
+            for (size_t j = 0; j < b.size(); ++j)
+            {
+                double intersection = (double)a[i].rect.Intersection(b[j].rect).Area();
+                double joint = (double)(a[i].rect.Area() + b[j].rect.Area()) - intersection;
+                if (joint > 0 && intersection / joint >= overlapMin)
+                {
+                    count++;
+                    break;
+                }
+            }
+        }
+        return count;
+    }
+
+    static bool DetectionHaarInt16AutoTest(const String & path)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test Simd::Detection HAAR 16i & 32f for cascade '" << path << "'.");
+
+        View src = GetSample(Size(W, H), true);
+
+        Detection d32, d16;
+        if (!d32.Load(path) || !d16.Load(path))
+        {
+            TEST_LOG_SS(Error, "Can't load cascade '" << path << "' !");
+            return false;
+        }
+        d32.Init(src.Size(), 1.1, Size(), Size(INT_MAX, INT_MAX), View(), 1, false);
+        d16.Init(src.Size(), 1.1, Size(), Size(INT_MAX, INT_MAX), View(), 1, true);
+
+        Objects o32, o16;
+        {
+            TEST_PERFORMANCE_TEST("SimdDetectionHaar32f");
+            d32.Detect(src, o32);
+        }
+        {
+            TEST_PERFORMANCE_TEST("SimdDetectionHaar16i");
+            d16.Detect(src, o16);
+        }
+
+        const double overlapMin = 0.7;
+        // Weak groups near the minimal group size can appear or vanish because of int16 rounding, so only confident ones must match.
+        const int confident = 8;
+        size_t n32, n16, c32, c16;
+        size_t m32 = DetectionMatchCount(o32, o16, overlapMin, 0, n32), m16 = DetectionMatchCount(o16, o32, overlapMin, 0, n16);
+        size_t s32 = DetectionMatchCount(o32, o16, overlapMin, confident, c32), s16 = DetectionMatchCount(o16, o32, overlapMin, confident, c16);
+        TEST_LOG_SS(Info, "Objects: 32f = " << n32 << ", 16i = " << n16 << ", matched = " << m32 << " / " << m16 
+            << "; confident: 32f = " << c32 << ", 16i = " << c16 << ", matched = " << s32 << " / " << s16 << ".");
+        if (c32 == 0 || s32 < c32 || s16 < c16 || m32 * 4 < n32 * 3 || m16 * 4 < n16 * 3)
+        {
+            TEST_LOG_SS(Error, "HAAR 16i detections do not match 32f detections!");
+            for (size_t i = 0; i < o32.size(); ++i)
+                TEST_LOG_SS(Error, "32f: (" << o32[i].rect.left << ", " << o32[i].rect.top << ", " << o32[i].rect.right << ", " << o32[i].rect.bottom << ") - " << o32[i].weight);
+            for (size_t i = 0; i < o16.size(); ++i)
+                TEST_LOG_SS(Error, "16i: (" << o16[i].rect.left << ", " << o16[i].rect.top << ", " << o16[i].rect.right << ", " << o16[i].rect.bottom << ") - " << o16[i].weight);
+            result = false;
+        }
+
+        return result;
+    }
+
+    bool DetectionHaarInt16AutoTest()
+    {
+        bool result = true;
+
+        result = result && DetectionHaarInt16AutoTest(ROOT_PATH + "/data/cascade/haar_face_0.xml");
+        result = result && DetectionHaarInt16AutoTest(ROOT_PATH + "/data/cascade/haar_face_1.xml");
+
+        return result;
+    }
 }
 
@@ -226,6 +226,355 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncAP
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+            FuncPtr func;
+            String description;
+
+            FuncAP(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & src, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.stride, src.width, src.height, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_AP(func) FuncAP(func, #func)
+
+    bool AlphaPremultiplyAutoTest(int width, int height, const FuncAP & f1, const FuncAP & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "].");
+
+        View s(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        FillRandom(s);
+
+        View d1(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        View d2(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, d2));
+
+        result = result && Compare(d1, d2, 0, true, 64);
+
+        return result;
+    }
+
+    bool AlphaPremultiplyAutoTest(const FuncAP & f1, const FuncAP & f2)
+    {
+        bool result = true;
+
+        result = result && AlphaPremultiplyAutoTest(W, H, f1, f2);
+        result = result && AlphaPremultiplyAutoTest(W + O, H - O, f1, f2);
+
+        return result;
+    }
+
+    bool AlphaPremultiplyAutoTest()
+    {
+        bool result = true;
+
+        result = result && AlphaPremultiplyAutoTest(FUNC_AP(Simd::Base::AlphaPremultiply), FUNC_AP(SimdAlphaPremultiply));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::F)
+            result = result && AlphaPremultiplyAutoTest(FUNC_AP(Simd::Sse41::AlphaPremultiply), FUNC_AP(SimdAlphaPremultiply));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::F)
+            result = result && AlphaPremultiplyAutoTest(FUNC_AP(Simd::Avx2::AlphaPremultiply), FUNC_AP(SimdAlphaPremultiply));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AlphaPremultiplyAutoTest(FUNC_AP(Simd::Avx512bw::AlphaPremultiply), FUNC_AP(SimdAlphaPremultiply));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && AlphaPremultiplyAutoTest(FUNC_AP(Simd::Neon::AlphaPremultiply), FUNC_AP(SimdAlphaPremultiply));
+#endif
+
+        return result;
+    }
+
+    bool AlphaUnpremultiplyAutoTest()
+    {
+        bool result = true;
+
+        result = result && AlphaPremultiplyAutoTest(FUNC_AP(Simd::Base::AlphaUnpremultiply), FUNC_AP(SimdAlphaUnpremultiply));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::F)
+            result = result && AlphaPremultiplyAutoTest(FUNC_AP(Simd::Sse41::AlphaUnpremultiply), FUNC_AP(SimdAlphaUnpremultiply));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::F)
+            result = result && AlphaPremultiplyAutoTest(FUNC_AP(Simd::Avx2::AlphaUnpremultiply), FUNC_AP(SimdAlphaUnpremultiply));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AlphaPremultiplyAutoTest(FUNC_AP(Simd::Avx512bw::AlphaUnpremultiply), FUNC_AP(SimdAlphaUnpremultiply));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && AlphaPremultiplyAutoTest(FUNC_AP(Simd::Neon::AlphaUnpremultiply), FUNC_AP(SimdAlphaUnpremultiply));
+#endif
+
+        return result;
+    }
+
+    namespace
+    {
+        struct FuncABB
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t alpha, SimdBool premultiplied, uint8_t * dst, size_t dstStride);
+            FuncPtr func;
+            String description;
+
+            FuncABB(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & src, uint8_t alpha, SimdBool premultiplied, const View & dstSrc, View & dstDst) const
+            {
+                Simd::Copy(dstSrc, dstDst);
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.stride, src.width, src.height, alpha, premultiplied, dstDst.data, dstDst.stride);
+            }
+        };
+    }
+
+#define FUNC_ABB(func) FuncABB(func, #func)
+
+    bool AlphaBlendingBgraToBgraAutoTest(int width, int height, uint8_t alpha, SimdBool premultiplied, const FuncABB & f1, const FuncABB & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "].");
+
+        View s(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        FillRandom(s);
+        View b(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        FillRandom(b);
+
+        View d1(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        View d2(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, alpha, premultiplied, b, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, alpha, premultiplied, b, d2));
+
+        result = result && Compare(d1, d2, 0, true, 64);
+
+        return result;
+    }
+
+    bool AlphaBlendingBgraToBgraAutoTest(const FuncABB & f1, const FuncABB & f2)
+    {
+        bool result = true;
+
+        for (int premultiplied = 0; premultiplied <= 1; ++premultiplied)
+        {
+            for (int alpha = 127; alpha <= 255; alpha += 128)
+            {
+                String suffix = String(premultiplied ? "<premultiplied," : "<straight,") + ToString(alpha) + ">";
+                FuncABB f1c = FuncABB(f1.func, f1.description + suffix);
+                FuncABB f2c = FuncABB(f2.func, f2.description + suffix);
+
+                result = result && AlphaBlendingBgraToBgraAutoTest(W, H, (uint8_t)alpha, (SimdBool)premultiplied, f1c, f2c);
+                result = result && AlphaBlendingBgraToBgraAutoTest(W + O, H - O, (uint8_t)alpha, (SimdBool)premultiplied, f1c, f2c);
+            }
+        }
+
+        return result;
+    }
+
+    bool AlphaBlendingBgraToBgraAutoTest()
+    {
+        bool result = true;
+
+        result = result && AlphaBlendingBgraToBgraAutoTest(FUNC_ABB(Simd::Base::AlphaBlendingBgraToBgra), FUNC_ABB(SimdAlphaBlendingBgraToBgra));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::F)
+            result = result && AlphaBlendingBgraToBgraAutoTest(FUNC_ABB(Simd::Sse41::AlphaBlendingBgraToBgra), FUNC_ABB(SimdAlphaBlendingBgraToBgra));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::F)
+            result = result && AlphaBlendingBgraToBgraAutoTest(FUNC_ABB(Simd::Avx2::AlphaBlendingBgraToBgra), FUNC_ABB(SimdAlphaBlendingBgraToBgra));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AlphaBlendingBgraToBgraAutoTest(FUNC_ABB(Simd::Avx512bw::AlphaBlendingBgraToBgra), FUNC_ABB(SimdAlphaBlendingBgraToBgra));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && AlphaBlendingBgraToBgraAutoTest(FUNC_ABB(Simd::Neon::AlphaBlendingBgraToBgra), FUNC_ABB(SimdAlphaBlendingBgraToBgra));
+#endif
+
+        return result;
+    }
+
+    namespace
+    {
+        struct FuncABY
+        {
+            typedef void(*FuncPtr)(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t alpha,
+                uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+            typedef void(*FuncNv12Ptr)(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t alpha,
+                uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType);
+            FuncPtr func;
+            FuncNv12Ptr funcNv12;
+            SimdYuvType yuvType;
+            String description;
+
+            FuncABY(const FuncPtr & f, const String & d) : func(f), funcNv12(NULL), yuvType(SimdYuvBt601), description(d) {}
+            FuncABY(const FuncNv12Ptr & f, const String & d) : func(NULL), funcNv12(f), yuvType(SimdYuvBt601), description(d) {}
+            FuncABY(const FuncABY & f, SimdYuvType t) : func(f.func), funcNv12(f.funcNv12), yuvType(t), description(f.description + "<" + ToString(t) + ">") {}
+
+            void Call(const View & bgra, uint8_t alpha, const View & ySrc, const View & uSrc, const View & vSrc, View & yDst, View & uDst, View & vDst) const
+            {
+                Simd::Copy(ySrc, yDst);
+                Simd::Copy(uSrc, uDst);
+                if (func)
+                {
+                    Simd::Copy(vSrc, vDst);
+                    TEST_PERFORMANCE_TEST(description);
+                    func(bgra.data, bgra.stride, bgra.width, bgra.height, alpha, yDst.data, yDst.stride, uDst.data, uDst.stride, vDst.data, vDst.stride, yuvType);
+                }
+                else
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    funcNv12(bgra.data, bgra.stride, bgra.width, bgra.height, alpha, yDst.data, yDst.stride, uDst.data, uDst.stride, yuvType);
+                }
+            }
+        };
+    }
+
+#define FUNC_ABY(func) FuncABY(func, #func)
+
+    bool AlphaBlendingBgraToYuvAutoTest(int width, int height, uint8_t alpha, const FuncABY & f1, const FuncABY & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "].");
+
+        View::Format uvFormat = f1.func ? View::Gray8 : View::Uv16;
+        View bgra(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        FillRandom(bgra);
+        View y(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(y);
+        View u(width / 2, height / 2, uvFormat, NULL, TEST_ALIGN(width));
+        FillRandom(u);
+        View v(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(v);
+
+        View y1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View u1(width / 2, height / 2, uvFormat, NULL, TEST_ALIGN(width));
+        View v1(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+        View y2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View u2(width / 2, height / 2, uvFormat, NULL, TEST_ALIGN(width));
+        View v2(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(bgra, alpha, y, u, v, y1, u1, v1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(bgra, alpha, y, u, v, y2, u2, v2));
+
+        result = result && Compare(y1, y2, 0, true, 64, 0, "y");
+        result = result && Compare(u1, u2, 0, true, 64, 0, "u");
+        if (f1.func)
+            result = result && Compare(v1, v2, 0, true, 64, 0, "v");
+
+        return result;
+    }
+
+    bool AlphaBlendingBgraToYuvAutoTest(const FuncABY & f1, const FuncABY & f2)
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            FuncABY f1c = FuncABY(f1, (SimdYuvType)type);
+            FuncABY f2c = FuncABY(f2, (SimdYuvType)type);
+
+            result = result && AlphaBlendingBgraToYuvAutoTest(W, H, 255, f1c, f2c);
+            result = result && AlphaBlendingBgraToYuvAutoTest(W + E, H - E, 127, f1c, f2c);
+        }
+
+        return result;
+    }
+
+    bool AlphaBlendingBgraToYuv420pAutoTest()
+    {
+        bool result = true;
+
+        result = result && AlphaBlendingBgraToYuvAutoTest(FUNC_ABY(Simd::Base::AlphaBlendingBgraToYuv420p), FUNC_ABY(SimdAlphaBlendingBgraToYuv420p));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && AlphaBlendingBgraToYuvAutoTest(FUNC_ABY(Simd::Sse41::AlphaBlendingBgraToYuv420p), FUNC_ABY(SimdAlphaBlendingBgraToYuv420p));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && AlphaBlendingBgraToYuvAutoTest(FUNC_ABY(Simd::Avx2::AlphaBlendingBgraToYuv420p), FUNC_ABY(SimdAlphaBlendingBgraToYuv420p));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::HA)
+            result = result && AlphaBlendingBgraToYuvAutoTest(FUNC_ABY(Simd::Avx512bw::AlphaBlendingBgraToYuv420p), FUNC_ABY(SimdAlphaBlendingBgraToYuv420p));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && AlphaBlendingBgraToYuvAutoTest(FUNC_ABY(Simd::Neon::AlphaBlendingBgraToYuv420p), FUNC_ABY(SimdAlphaBlendingBgraToYuv420p));
+#endif
+
+        return result;
+    }
+
+    bool AlphaBlendingBgraToNv12AutoTest()
+    {
+        bool result = true;
+
+        result = result && AlphaBlendingBgraToYuvAutoTest(FUNC_ABY(Simd::Base::AlphaBlendingBgraToNv12), FUNC_ABY(SimdAlphaBlendingBgraToNv12));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && AlphaBlendingBgraToYuvAutoTest(FUNC_ABY(Simd::Sse41::AlphaBlendingBgraToNv12), FUNC_ABY(SimdAlphaBlendingBgraToNv12));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && AlphaBlendingBgraToYuvAutoTest(FUNC_ABY(Simd::Avx2::AlphaBlendingBgraToNv12), FUNC_ABY(SimdAlphaBlendingBgraToNv12));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::HA)
+            result = result && AlphaBlendingBgraToYuvAutoTest(FUNC_ABY(Simd::Avx512bw::AlphaBlendingBgraToNv12), FUNC_ABY(SimdAlphaBlendingBgraToNv12));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && AlphaBlendingBgraToYuvAutoTest(FUNC_ABY(Simd::Neon::AlphaBlendingBgraToNv12), FUNC_ABY(SimdAlphaBlendingBgraToNv12));
+#endif
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     bool AlphaBlendingDataTest(bool create, View::Format format, int width, int height, const FuncAB & f)
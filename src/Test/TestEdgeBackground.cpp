@@ -327,6 +327,296 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct Func6
+        {
+            typedef void(*FuncInitPtr)(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride);
+            typedef void(*FuncUpdatePtr)(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+                uint8_t * model, size_t modelStride, uint8_t threshold, int flags);
+
+            FuncInitPtr init;
+            FuncUpdatePtr update;
+            String description;
+            int flags;
+
+            Func6(const FuncInitPtr & i, const FuncUpdatePtr & u, const String & d, int f) : init(i), update(u), description(d + "[" + char('0' + f) + "]"), flags(f) {}
+
+            void Init(const View & value, View & model) const
+            {
+                init(value.data, value.stride, value.width, value.height, model.data, model.stride);
+            }
+
+            void Update(const View & value, const View & modelSrc, View & modelDst, uint8_t threshold) const
+            {
+                Simd::Copy(modelSrc, modelDst);
+                TEST_PERFORMANCE_TEST(description);
+                update(value.data, value.stride, value.width, value.height, modelDst.data, modelDst.stride, threshold, flags);
+            }
+        };
+    }
+
+#define FUNC6(prefix) prefix##Init, prefix##Update, std::string(#prefix "Update")
+
+    bool EdgeBackgroundPackedUpdateAutoTest(int width, int height, const Func6 & f1, const Func6 & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View value(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(value);
+        View modelSrc(width, height, View::Uv16, NULL, TEST_ALIGN(width));
+        View modelDst1(width, height, View::Uv16, NULL, TEST_ALIGN(width));
+        View modelDst2(width, height, View::Uv16, NULL, TEST_ALIGN(width));
+
+        f1.Init(value, modelDst1);
+        f2.Init(value, modelDst2);
+        result = result && Compare(modelDst1, modelDst2, 0, true, 32, 0, "init");
+
+        FillRandom(modelSrc);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Update(value, modelSrc, modelDst1, 0x80));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Update(value, modelSrc, modelDst2, 0x80));
+
+        result = result && Compare(modelDst1, modelDst2, 0, true, 32, 0, "update");
+
+        if (result)
+        {
+            View background(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            View count(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            View model(width, height, View::Uv16, NULL, TEST_ALIGN(width));
+            Simd::DeinterleaveUv(modelSrc, background, count);
+            if (f1.flags & SimdBackgroundUpdateGrowRange)
+                Simd::EdgeBackgroundGrowRangeFast(value, background);
+            if (f1.flags & SimdBackgroundUpdateIncrementCount)
+                Simd::EdgeBackgroundIncrementCount(value, background, count);
+            if (f1.flags & SimdBackgroundUpdateAdjustRange)
+                Simd::EdgeBackgroundAdjustRange(count, background, 0x80);
+            Simd::InterleaveUv(background, count, model);
+
+            result = result && Compare(model, modelDst1, 0, true, 32, 0, "reference");
+        }
+
+        return result;
+    }
+
+    bool EdgeBackgroundPackedUpdateAutoTest(const Func6::FuncInitPtr & i1, const Func6::FuncUpdatePtr & u1, const String & d1,
+        const Func6::FuncInitPtr & i2, const Func6::FuncUpdatePtr & u2, const String & d2)
+    {
+        bool result = true;
+
+        const int flags[] = { 1, 2, 3, 4, 6, 7 };
+        for (size_t i = 0; i < sizeof(flags) / sizeof(flags[0]); ++i)
+        {
+            Func6 f1(i1, u1, d1, flags[i]), f2(i2, u2, d2, flags[i]);
+            result = result && EdgeBackgroundPackedUpdateAutoTest(W, H, f1, f2);
+            result = result && EdgeBackgroundPackedUpdateAutoTest(W + O, H - O, f1, f2);
+            result = result && EdgeBackgroundPackedUpdateAutoTest(W - O, H + O, f1, f2);
+        }
+
+        return result;
+    }
+
+    namespace
+    {
+        struct Func7
+        {
+            typedef void(*FuncPtr)(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * model, size_t modelStride);
+
+            FuncPtr func;
+            String description;
+
+            Func7(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & value, const View & modelSrc, View & modelDst) const
+            {
+                Simd::Copy(modelSrc, modelDst);
+                TEST_PERFORMANCE_TEST(description);
+                func(value.data, value.stride, value.width, value.height, modelDst.data, modelDst.stride);
+            }
+        };
+
+        struct Func8
+        {
+            typedef void(*FuncPtr)(const uint8_t * value, size_t valueStride, size_t width, size_t height,
+                uint8_t * model, size_t modelStride, const uint8_t * mask, size_t maskStride);
+
+            FuncPtr func;
+            String description;
+
+            Func8(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & value, const View & modelSrc, View & modelDst, const View & mask) const
+            {
+                Simd::Copy(modelSrc, modelDst);
+                TEST_PERFORMANCE_TEST(description);
+                func(value.data, value.stride, value.width, value.height, modelDst.data, modelDst.stride, mask.data, mask.stride);
+            }
+        };
+
+        struct Func9
+        {
+            typedef void(*FuncPtr)(uint8_t * model, size_t modelStride, size_t width, size_t height,
+                uint8_t threshold, const uint8_t * mask, size_t maskStride);
+
+            FuncPtr func;
+            String description;
+
+            Func9(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & modelSrc, View & modelDst, uint8_t threshold, const View & mask) const
+            {
+                Simd::Copy(modelSrc, modelDst);
+                TEST_PERFORMANCE_TEST(description);
+                func(modelDst.data, modelDst.stride, modelDst.width, modelDst.height, threshold, mask.data, mask.stride);
+            }
+        };
+    }
+
+#define FUNC7(function) Func7(function, std::string(#function))
+#define FUNC8(function) Func8(function, std::string(#function))
+#define FUNC9(function) Func9(function, std::string(#function))
+
+    bool EdgeBackgroundPackedChangeRangeAutoTest(int width, int height, const Func7 & f1, const Func7 & f2, Func1::FuncPtr reference)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View value(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(value);
+        View modelSrc(width, height, View::Uv16, NULL, TEST_ALIGN(width));
+        FillRandom(modelSrc);
+        View modelDst1(width, height, View::Uv16, NULL, TEST_ALIGN(width));
+        View modelDst2(width, height, View::Uv16, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(value, modelSrc, modelDst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(value, modelSrc, modelDst2));
+
+        result = result && Compare(modelDst1, modelDst2, 0, true, 32);
+
+        if (result)
+        {
+            View background(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            View count(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            View model(width, height, View::Uv16, NULL, TEST_ALIGN(width));
+            Simd::DeinterleaveUv(modelSrc, background, count);
+            reference(value.data, value.stride, width, height, background.data, background.stride);
+            Simd::InterleaveUv(background, count, model);
+
+            result = result && Compare(model, modelDst1, 0, true, 32, 0, "reference");
+        }
+
+        return result;
+    }
+
+    bool EdgeBackgroundPackedChangeRangeAutoTest(const Func7 & f1, const Func7 & f2, Func1::FuncPtr reference)
+    {
+        bool result = true;
+
+        result = result && EdgeBackgroundPackedChangeRangeAutoTest(W, H, f1, f2, reference);
+        result = result && EdgeBackgroundPackedChangeRangeAutoTest(W + O, H - O, f1, f2, reference);
+        result = result && EdgeBackgroundPackedChangeRangeAutoTest(W - O, H + O, f1, f2, reference);
+
+        return result;
+    }
+
+    bool EdgeBackgroundPackedShiftRangeMaskedAutoTest(int width, int height, const Func8 & f1, const Func8 & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View value(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(value);
+        View mask(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandomMask(mask, 0xFF);
+        View modelSrc(width, height, View::Uv16, NULL, TEST_ALIGN(width));
+        FillRandom(modelSrc);
+        View modelDst1(width, height, View::Uv16, NULL, TEST_ALIGN(width));
+        View modelDst2(width, height, View::Uv16, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(value, modelSrc, modelDst1, mask));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(value, modelSrc, modelDst2, mask));
+
+        result = result && Compare(modelDst1, modelDst2, 0, true, 32);
+
+        if (result)
+        {
+            View background(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            View count(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            View model(width, height, View::Uv16, NULL, TEST_ALIGN(width));
+            Simd::DeinterleaveUv(modelSrc, background, count);
+            SimdEdgeBackgroundShiftRangeMasked(value.data, value.stride, width, height, background.data, background.stride, mask.data, mask.stride);
+            Simd::InterleaveUv(background, count, model);
+
+            result = result && Compare(model, modelDst1, 0, true, 32, 0, "reference");
+        }
+
+        return result;
+    }
+
+    bool EdgeBackgroundPackedShiftRangeMaskedAutoTest(const Func8 & f1, const Func8 & f2)
+    {
+        bool result = true;
+
+        result = result && EdgeBackgroundPackedShiftRangeMaskedAutoTest(W, H, f1, f2);
+        result = result && EdgeBackgroundPackedShiftRangeMaskedAutoTest(W + O, H - O, f1, f2);
+        result = result && EdgeBackgroundPackedShiftRangeMaskedAutoTest(W - O, H + O, f1, f2);
+
+        return result;
+    }
+
+    bool EdgeBackgroundPackedAdjustRangeMaskedAutoTest(int width, int height, const Func9 & f1, const Func9 & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View mask(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandomMask(mask, 0xFF);
+        View modelSrc(width, height, View::Uv16, NULL, TEST_ALIGN(width));
+        FillRandom(modelSrc);
+        View modelDst1(width, height, View::Uv16, NULL, TEST_ALIGN(width));
+        View modelDst2(width, height, View::Uv16, NULL, TEST_ALIGN(width));
+        const uint8_t threshold = 0x80;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(modelSrc, modelDst1, threshold, mask));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(modelSrc, modelDst2, threshold, mask));
+
+        result = result && Compare(modelDst1, modelDst2, 0, true, 32);
+
+        if (result)
+        {
+            View background(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            View count(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            View model(width, height, View::Uv16, NULL, TEST_ALIGN(width));
+            Simd::DeinterleaveUv(modelSrc, background, count);
+            SimdEdgeBackgroundAdjustRangeMasked(count.data, count.stride, width, height, background.data, background.stride, threshold, mask.data, mask.stride);
+            Simd::InterleaveUv(background, count, model);
+
+            result = result && Compare(model, modelDst1, 0, true, 32, 0, "reference");
+        }
+
+        return result;
+    }
+
+    bool EdgeBackgroundPackedAdjustRangeMaskedAutoTest(const Func9 & f1, const Func9 & f2)
+    {
+        bool result = true;
+
+        result = result && EdgeBackgroundPackedAdjustRangeMaskedAutoTest(W, H, f1, f2);
+        result = result && EdgeBackgroundPackedAdjustRangeMaskedAutoTest(W + O, H - O, f1, f2);
+        result = result && EdgeBackgroundPackedAdjustRangeMaskedAutoTest(W - O, H + O, f1, f2);
+
+        return result;
+    }
+
     bool EdgeBackgroundGrowRangeSlowAutoTest()
     {
         bool result = true;
@@ -540,6 +830,151 @@ namespace Test
         return result;
     }
 
+    bool EdgeBackgroundPackedUpdateAutoTest()
+    {
+        bool result = true;
+
+        result = result && EdgeBackgroundPackedUpdateAutoTest(FUNC6(Simd::Base::EdgeBackgroundPacked), FUNC6(SimdEdgeBackgroundPacked));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W - O >= Simd::Sse2::A)
+            result = result && EdgeBackgroundPackedUpdateAutoTest(FUNC6(Simd::Sse2::EdgeBackgroundPacked), FUNC6(SimdEdgeBackgroundPacked));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W - O >= Simd::Avx2::A)
+            result = result && EdgeBackgroundPackedUpdateAutoTest(FUNC6(Simd::Avx2::EdgeBackgroundPacked), FUNC6(SimdEdgeBackgroundPacked));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && EdgeBackgroundPackedUpdateAutoTest(FUNC6(Simd::Avx512bw::EdgeBackgroundPacked), FUNC6(SimdEdgeBackgroundPacked));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W - O >= Simd::Neon::A)
+            result = result && EdgeBackgroundPackedUpdateAutoTest(FUNC6(Simd::Neon::EdgeBackgroundPacked), FUNC6(SimdEdgeBackgroundPacked));
+#endif 
+
+        return result;
+    }
+
+    bool EdgeBackgroundPackedGrowRangeSlowAutoTest()
+    {
+        bool result = true;
+
+        result = result && EdgeBackgroundPackedChangeRangeAutoTest(FUNC7(Simd::Base::EdgeBackgroundPackedGrowRangeSlow), FUNC7(SimdEdgeBackgroundPackedGrowRangeSlow), SimdEdgeBackgroundGrowRangeSlow);
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W - O >= Simd::Sse2::A)
+            result = result && EdgeBackgroundPackedChangeRangeAutoTest(FUNC7(Simd::Sse2::EdgeBackgroundPackedGrowRangeSlow), FUNC7(SimdEdgeBackgroundPackedGrowRangeSlow), SimdEdgeBackgroundGrowRangeSlow);
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W - O >= Simd::Avx2::A)
+            result = result && EdgeBackgroundPackedChangeRangeAutoTest(FUNC7(Simd::Avx2::EdgeBackgroundPackedGrowRangeSlow), FUNC7(SimdEdgeBackgroundPackedGrowRangeSlow), SimdEdgeBackgroundGrowRangeSlow);
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && EdgeBackgroundPackedChangeRangeAutoTest(FUNC7(Simd::Avx512bw::EdgeBackgroundPackedGrowRangeSlow), FUNC7(SimdEdgeBackgroundPackedGrowRangeSlow), SimdEdgeBackgroundGrowRangeSlow);
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W - O >= Simd::Neon::A)
+            result = result && EdgeBackgroundPackedChangeRangeAutoTest(FUNC7(Simd::Neon::EdgeBackgroundPackedGrowRangeSlow), FUNC7(SimdEdgeBackgroundPackedGrowRangeSlow), SimdEdgeBackgroundGrowRangeSlow);
+#endif 
+
+        return result;
+    }
+
+    bool EdgeBackgroundPackedShiftRangeAutoTest()
+    {
+        bool result = true;
+
+        result = result && EdgeBackgroundPackedChangeRangeAutoTest(FUNC7(Simd::Base::EdgeBackgroundPackedShiftRange), FUNC7(SimdEdgeBackgroundPackedShiftRange), SimdEdgeBackgroundShiftRange);
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W - O >= Simd::Sse2::A)
+            result = result && EdgeBackgroundPackedChangeRangeAutoTest(FUNC7(Simd::Sse2::EdgeBackgroundPackedShiftRange), FUNC7(SimdEdgeBackgroundPackedShiftRange), SimdEdgeBackgroundShiftRange);
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W - O >= Simd::Avx2::A)
+            result = result && EdgeBackgroundPackedChangeRangeAutoTest(FUNC7(Simd::Avx2::EdgeBackgroundPackedShiftRange), FUNC7(SimdEdgeBackgroundPackedShiftRange), SimdEdgeBackgroundShiftRange);
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && EdgeBackgroundPackedChangeRangeAutoTest(FUNC7(Simd::Avx512bw::EdgeBackgroundPackedShiftRange), FUNC7(SimdEdgeBackgroundPackedShiftRange), SimdEdgeBackgroundShiftRange);
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W - O >= Simd::Neon::A)
+            result = result && EdgeBackgroundPackedChangeRangeAutoTest(FUNC7(Simd::Neon::EdgeBackgroundPackedShiftRange), FUNC7(SimdEdgeBackgroundPackedShiftRange), SimdEdgeBackgroundShiftRange);
+#endif 
+
+        return result;
+    }
+
+    bool EdgeBackgroundPackedShiftRangeMaskedAutoTest()
+    {
+        bool result = true;
+
+        result = result && EdgeBackgroundPackedShiftRangeMaskedAutoTest(FUNC8(Simd::Base::EdgeBackgroundPackedShiftRangeMasked), FUNC8(SimdEdgeBackgroundPackedShiftRangeMasked));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W - O >= Simd::Sse2::A)
+            result = result && EdgeBackgroundPackedShiftRangeMaskedAutoTest(FUNC8(Simd::Sse2::EdgeBackgroundPackedShiftRangeMasked), FUNC8(SimdEdgeBackgroundPackedShiftRangeMasked));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W - O >= Simd::Avx2::A)
+            result = result && EdgeBackgroundPackedShiftRangeMaskedAutoTest(FUNC8(Simd::Avx2::EdgeBackgroundPackedShiftRangeMasked), FUNC8(SimdEdgeBackgroundPackedShiftRangeMasked));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && EdgeBackgroundPackedShiftRangeMaskedAutoTest(FUNC8(Simd::Avx512bw::EdgeBackgroundPackedShiftRangeMasked), FUNC8(SimdEdgeBackgroundPackedShiftRangeMasked));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W - O >= Simd::Neon::A)
+            result = result && EdgeBackgroundPackedShiftRangeMaskedAutoTest(FUNC8(Simd::Neon::EdgeBackgroundPackedShiftRangeMasked), FUNC8(SimdEdgeBackgroundPackedShiftRangeMasked));
+#endif 
+
+        return result;
+    }
+
+    bool EdgeBackgroundPackedAdjustRangeMaskedAutoTest()
+    {
+        bool result = true;
+
+        result = result && EdgeBackgroundPackedAdjustRangeMaskedAutoTest(FUNC9(Simd::Base::EdgeBackgroundPackedAdjustRangeMasked), FUNC9(SimdEdgeBackgroundPackedAdjustRangeMasked));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W - O >= Simd::Sse2::A)
+            result = result && EdgeBackgroundPackedAdjustRangeMaskedAutoTest(FUNC9(Simd::Sse2::EdgeBackgroundPackedAdjustRangeMasked), FUNC9(SimdEdgeBackgroundPackedAdjustRangeMasked));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W - O >= Simd::Avx2::A)
+            result = result && EdgeBackgroundPackedAdjustRangeMaskedAutoTest(FUNC9(Simd::Avx2::EdgeBackgroundPackedAdjustRangeMasked), FUNC9(SimdEdgeBackgroundPackedAdjustRangeMasked));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && EdgeBackgroundPackedAdjustRangeMaskedAutoTest(FUNC9(Simd::Avx512bw::EdgeBackgroundPackedAdjustRangeMasked), FUNC9(SimdEdgeBackgroundPackedAdjustRangeMasked));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W - O >= Simd::Neon::A)
+            result = result && EdgeBackgroundPackedAdjustRangeMaskedAutoTest(FUNC9(Simd::Neon::EdgeBackgroundPackedAdjustRangeMasked), FUNC9(SimdEdgeBackgroundPackedAdjustRangeMasked));
+#endif 
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     bool EdgeBackgroundChangeRangeDataTest(bool create, int width, int height, const Func1 & f)
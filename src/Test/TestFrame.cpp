@@ -0,0 +1,337 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+
+#include "Simd/SimdFrame.hpp"
+
+namespace Test
+{
+    typedef Simd::Frame<Simd::Allocator> Frame;
+
+    String ToString(Frame::Format format)
+    {
+        switch (format)
+        {
+        case Frame::Nv12: return "Nv12";
+        case Frame::Yuv420p: return "Yuv420p";
+        case Frame::Bgra32: return "Bgra32";
+        case Frame::Bgr24: return "Bgr24";
+        case Frame::Gray8: return "Gray8";
+        case Frame::Yuv420p10: return "Yuv420p10";
+        case Frame::Yuv420p12: return "Yuv420p12";
+        case Frame::Yuv420p16: return "Yuv420p16";
+        case Frame::P010: return "P010";
+        case Frame::P016: return "P016";
+        default: assert(0); return "";
+        }
+    }
+
+    static void FillRandom(Frame & frame)
+    {
+        size_t depth = Frame::BitDepth(frame.format);
+        for (size_t i = 0; i < frame.PlaneCount(); ++i)
+        {
+            View & plane = frame.planes[i];
+            FillRandom(plane);
+            if (depth == 8 || frame.format == Frame::P016)
+                continue;
+            for (size_t row = 0; row < plane.height; ++row)
+            {
+                uint16_t * data = (uint16_t*)(plane.data + row * plane.stride);
+                for (size_t col = 0, size = plane.width * plane.ChannelCount(); col < size; ++col)
+                {
+                    if (frame.format == Frame::P010)
+                        data[col] &= 0xFFC0;
+                    else
+                        data[col] &= (1 << depth) - 1;
+                }
+            }
+        }
+    }
+
+    static bool Compare(const Frame & a, const Frame & b, int differenceMax, const String & description)
+    {
+        bool result = a.PlaneCount() == b.PlaneCount();
+        for (size_t i = 0; i < a.PlaneCount() && result; ++i)
+        {
+            std::stringstream ss;
+            ss << description << " plane " << i;
+            result = result && Compare(a.planes[i], b.planes[i], differenceMax, true, 64, 0, ss.str());
+        }
+        return result;
+    }
+
+    static Frame Source(Frame & owner, size_t width, size_t height, Frame::Format format, bool flipped)
+    {
+        owner.Recreate(width, height, format);
+        FillRandom(owner);
+        return flipped ? owner.Flipped() : owner;
+    }
+
+    //-----------------------------------------------------------------------
+
+    static Frame::Format ConvertIntermediate(Frame::Format src, Frame::Format dst)
+    {
+        bool srcYuv = Simd::IsYuv<Simd::Allocator>(src), dstYuv = Simd::IsYuv<Simd::Allocator>(dst);
+        if (!srcYuv && !dstYuv)
+            return Frame::Bgra32;
+        if (!dstYuv || !srcYuv)
+            return Frame::Yuv420p;
+        switch (dst)
+        {
+        case Frame::P010: return Frame::Yuv420p10;
+        case Frame::P016: return Frame::Yuv420p16;
+        case Frame::Nv12: return Frame::Yuv420p;
+        default: return dst;
+        }
+    }
+
+    bool FrameConvertAutoTest(Frame::Format srcFormat, Frame::Format dstFormat, int width, int height)
+    {
+        bool result = true;
+
+        Frame::Format itmFormat = ConvertIntermediate(srcFormat, dstFormat);
+
+        TEST_LOG_SS(Info, "Test Simd::Convert(Frame) for " << ToString(srcFormat) << " -> " << ToString(dstFormat) 
+            << " (" << ToString(itmFormat) << ") [" << width << ", " << height << "].");
+
+        Frame owner, src = Source(owner, width, height, srcFormat, false);
+
+        Frame dst1(width, height, dstFormat), dst2(width, height, dstFormat), itm(width, height, itmFormat);
+
+        {
+            TEST_PERFORMANCE_TEST("SimdFrameConvert");
+            Simd::Convert(src, dst1);
+        }
+
+        size_t threadNumber = SimdGetThreadNumber();
+        SimdSetThreadNumber(1);
+        Simd::Convert(src, itm);
+        Simd::Convert(itm, dst2);
+        SimdSetThreadNumber(threadNumber);
+
+        result = result && Compare(dst1, dst2, 0, "Convert");
+
+        return result;
+    }
+
+    bool FrameConvertAutoTest()
+    {
+        bool result = true;
+
+        size_t threadNumber = SimdGetThreadNumber();
+        for (size_t threads = 1; threads <= 3; threads += 2)
+        {
+            SimdSetThreadNumber(threads);
+            for (Frame::Format src = Frame::Nv12; src <= Frame::P016; src = Frame::Format(src + 1))
+            {
+                for (Frame::Format dst = Frame::Nv12; dst <= Frame::P016; dst = Frame::Format(dst + 1))
+                {
+                    if (src == dst)
+                        continue;
+                    bool odd = !Simd::IsYuv<Simd::Allocator>(src) && !Simd::IsYuv<Simd::Allocator>(dst);
+                    result = result && FrameConvertAutoTest(src, dst, W, H);
+                    if (odd)
+                        result = result && FrameConvertAutoTest(src, dst, W + O, H - O);
+                    else
+                        result = result && FrameConvertAutoTest(src, dst, W + 2 * O, H - 2 * O);
+                }
+            }
+        }
+        SimdSetThreadNumber(threadNumber);
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    bool FrameCropAutoTest(Frame::Format format, int width, int height, bool flipped, const Rect & rect)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test Simd::Crop(Frame) for " << ToString(format) << (flipped ? " flipped" : "") << " [" << width << ", " << height << "] -> ["
+            << rect.left << ", " << rect.top << ", " << rect.right << ", " << rect.bottom << "].");
+
+        Frame owner, src = Source(owner, width, height, format, flipped);
+
+        Rect r(rect);
+        if (src.PlaneCount() > 1)
+            r = Rect(r.left & ~1, r.top & ~1, (r.right + 1) & ~1, (r.bottom + 1) & ~1);
+
+        Frame dst1(r.Width(), r.Height(), format, flipped), dst2(r.Width(), r.Height(), format, flipped);
+
+        {
+            TEST_PERFORMANCE_TEST("SimdFrameCrop");
+            Simd::Crop(src, rect, dst1);
+        }
+
+        for (size_t i = 0; i < src.PlaneCount(); ++i)
+        {
+            ptrdiff_t scale = i ? 2 : 1;
+            Simd::Copy(src.planes[i].Region(r.left / scale, r.top / scale, r.right / scale, r.bottom / scale), dst2.planes[i]);
+        }
+
+        result = result && Compare(dst1, dst2, 0, "Crop");
+
+        return result;
+    }
+
+    bool FrameCropAutoTest()
+    {
+        bool result = true;
+
+        size_t threadNumber = SimdGetThreadNumber();
+        for (size_t threads = 1; threads <= 3; threads += 2)
+        {
+            SimdSetThreadNumber(threads);
+            for (Frame::Format format = Frame::Nv12; format <= Frame::P016; format = Frame::Format(format + 1))
+            {
+                for (int flipped = 0; flipped < 2; ++flipped)
+                {
+                    result = result && FrameCropAutoTest(format, W, H, flipped != 0, Rect(0, 0, W, H));
+                    result = result && FrameCropAutoTest(format, W + 2 * O, H - 2 * O, flipped != 0, Rect(O, O + 2, W / 2 + 1, H - 3 * O));
+                }
+            }
+        }
+        SimdSetThreadNumber(threadNumber);
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    bool FrameResizeBilinearAutoTest(Frame::Format format, int width, int height, double k, bool flipped, bool centerSitedChroma)
+    {
+        bool result = true;
+
+        size_t dstW = size_t(width * k) & ~1, dstH = size_t(height * k) & ~1;
+
+        TEST_LOG_SS(Info, "Test Simd::ResizeBilinear(Frame) for " << ToString(format) << (flipped ? " flipped" : "") 
+            << (centerSitedChroma ? " center-sited" : "") << " [" << width << ", " << height << "] -> [" << dstW << ", " << dstH << "].");
+
+        Frame owner, src = Source(owner, width, height, format, flipped);
+
+        Frame dst1(dstW, dstH, format, flipped), dst2(dstW, dstH, format, flipped);
+
+        {
+            TEST_PERFORMANCE_TEST("SimdFrameResizeBilinear");
+            Simd::ResizeBilinear(src, dst1, centerSitedChroma);
+        }
+
+        for (size_t i = 0; i < src.PlaneCount(); ++i)
+        {
+            if (i == 0 || centerSitedChroma)
+                Simd::ResizeBilinear(src.planes[i], dst2.planes[i]);
+            else
+            {
+                const View & s = src.planes[i];
+                View & d = dst2.planes[i];
+                ::SimdResizeBilinearRows(s.data, s.width, s.height, s.stride, d.data, d.width, d.height, d.stride, s.ChannelCount(), 0.25f, 0, d.height);
+            }
+        }
+
+        result = result && Compare(dst1, dst2, 0, "ResizeBilinear");
+
+        return result;
+    }
+
+    bool FrameResizeBilinearAutoTest()
+    {
+        bool result = true;
+
+        size_t threadNumber = SimdGetThreadNumber();
+        for (size_t threads = 1; threads <= 3; threads += 2)
+        {
+            SimdSetThreadNumber(threads);
+            for (Frame::Format format = Frame::Nv12; format <= Frame::Gray8; format = Frame::Format(format + 1))
+            {
+                for (int flipped = 0; flipped < 2; ++flipped)
+                {
+                    for (int sited = 0; sited < 2; ++sited)
+                    {
+                        result = result && FrameResizeBilinearAutoTest(format, W, H, 0.7, flipped != 0, sited != 0);
+                        result = result && FrameResizeBilinearAutoTest(format, W + 2 * O, H - 2 * O, 1.3, flipped != 0, sited != 0);
+                    }
+                }
+            }
+        }
+        SimdSetThreadNumber(threadNumber);
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    bool FrameTransformImageAutoTest(Frame::Format format, int width, int height, ::SimdTransformType transform, bool flipped)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test Simd::TransformImage(Frame) for " << ToString(format) << (flipped ? " flipped" : "") 
+            << " transform " << int(transform) << " [" << width << ", " << height << "].");
+
+        Frame owner, src = Source(owner, width, height, format, flipped);
+
+        Size size = Simd::TransformSize(src.Size(), transform);
+        Frame dst1(size, format, flipped), dst2(size, format, flipped);
+
+        {
+            TEST_PERFORMANCE_TEST("SimdFrameTransformImage");
+            Simd::TransformImage(src, transform, dst1);
+        }
+
+        for (size_t i = 0; i < src.PlaneCount(); ++i)
+            Simd::TransformImage(src.planes[i], transform, dst2.planes[i]);
+
+        result = result && Compare(dst1, dst2, 0, "TransformImage");
+
+        return result;
+    }
+
+    bool FrameTransformImageAutoTest()
+    {
+        bool result = true;
+
+        size_t threadNumber = SimdGetThreadNumber();
+        for (size_t threads = 1; threads <= 3; threads += 2)
+        {
+            SimdSetThreadNumber(threads);
+            for (Frame::Format format = Frame::Nv12; format <= Frame::P016; format = Frame::Format(format + 1))
+            {
+                for (int transform = ::SimdTransformRotate0; transform <= ::SimdTransformTransposeRotate270; ++transform)
+                {
+                    for (int flipped = 0; flipped < 2; ++flipped)
+                    {
+                        result = result && FrameTransformImageAutoTest(format, W, H, (::SimdTransformType)transform, flipped != 0);
+                        result = result && FrameTransformImageAutoTest(format, W + 2 * O, H - 2 * O, (::SimdTransformType)transform, flipped != 0);
+                    }
+                }
+            }
+        }
+        SimdSetThreadNumber(threadNumber);
+
+        return result;
+    }
+}
@@ -25,6 +25,8 @@
 #include "Test/TestPerformance.h"
 #include "Test/TestData.h"
 
+#include "Simd/SimdHog.hpp"
+
 namespace Test
 {
     void FillCircle(View & view)
@@ -1131,4 +1133,151 @@ namespace Test
     {
         return HogLiteCreateMaskDataTest(create, DW, DH, 7, 2, 0.5f, FUNC_HLCM(SimdHogLiteCreateMask));
     }
+
+    //-----------------------------------------------------------------------
+
+    bool HogLitePyramidSpecialTest()
+    {
+        typedef Simd::HogLitePyramid<Simd::Allocator> Pyramid;
+
+        bool result = true;
+
+        String path = ROOT_PATH + "/data/image/face/lena.pgm";
+        View image;
+        if (!image.Load(path))
+        {
+            TEST_LOG_SS(Error, "Can't load test image '" << path << "' !");
+            return false;
+        }
+        View src(W, H, View::Gray8, NULL, TEST_ALIGN(W));
+        Simd::ResizeBilinear(image, src);
+
+        Pyramid exact, fast;
+        exact.Init(src.Size(), 8, 1.1, 1, Point(2, 2), INT_MAX, 1);
+        fast.Init(src.Size(), 8, 1.1, 4, Point(2, 2), INT_MAX, -1);
+
+        TEST_LOG_SS(Info, "Test HogLitePyramid for size [" << W << ", " << H << "] with " << fast.Size() << " levels.");
+
+        double time = GetTime();
+        exact.Extract(src);
+        TEST_LOG_SS(Info, "Extract all levels exactly: " << (GetTime() - time) * 1000 << " ms ");
+
+        time = GetTime();
+        fast.Extract(src);
+        TEST_LOG_SS(Info, "Extract with derived levels: " << (GetTime() - time) * 1000 << " ms ");
+
+        if (exact.Size() != fast.Size())
+        {
+            TEST_LOG_SS(Error, "Different number of levels: " << exact.Size() << " != " << fast.Size() << " !");
+            return false;
+        }
+
+        for (size_t i = 0, base = 0; i < fast.Size() && result; ++i)
+        {
+            const Pyramid::Level & level = fast[i];
+            View features(level.size.x * Pyramid::FEATURE_SIZE, level.size.y, level.stride * sizeof(float), View::Float, level.features);
+            View control(features.width, features.height, View::Float, NULL, TEST_ALIGN(features.width));
+            if (level.exact)
+            {
+                base = i;
+                Simd::Copy(View(features.width, features.height, exact[i].stride * sizeof(float), View::Float, exact[i].features), control);
+            }
+            else
+                SimdHogLiteResizeFeatures(fast[base].features, fast[base].stride, fast[base].size.x, fast[base].size.y, Pyramid::FEATURE_SIZE,
+                    (float*)control.data, control.stride / sizeof(float), level.size.x, level.size.y);
+            result = result && Compare(features, control, 0.0f, true, 32, DifferenceAbsolute, "level " + ToString(i));
+        }
+
+        return result;
+    }
+
+    bool HogLiteFilterBankSpecialTest()
+    {
+        typedef Simd::HogLitePyramid<Simd::Allocator> Pyramid;
+        typedef Simd::HogLiteFilterBank<Simd::Allocator> FilterBank;
+        const size_t F = Pyramid::FEATURE_SIZE;
+
+        bool result = true;
+
+        String path = ROOT_PATH + "/data/image/face/lena.pgm";
+        View image;
+        if (!image.Load(path))
+        {
+            TEST_LOG_SS(Error, "Can't load test image '" << path << "' !");
+            return false;
+        }
+        View src(W, H, View::Gray8, NULL, TEST_ALIGN(W));
+        Simd::ResizeBilinear(image, src);
+
+        Pyramid pyramid;
+        pyramid.Init(src.Size(), 8, 1.1, 4, Point(8, 8));
+        pyramid.Extract(src);
+
+        FilterBank bank;
+        const size_t sizes[] = { 8, 4, 4, 4, 4, 6, 6 };
+        std::vector<View> filters(7);
+        for (size_t i = 0; i < filters.size(); ++i)
+        {
+            filters[i].Recreate(sizes[i] * F, sizes[i], View::Float, NULL, TEST_ALIGN(sizes[i] * F));
+            FillRandom32f(filters[i], -1.0f, 1.0f);
+            bank.Add((float*)filters[i].data, sizes[i], sizes[i]);
+        }
+
+        const Pyramid::Level & base = pyramid[0];
+        View root(base.size.x - sizes[0] + 1, base.size.y - sizes[0] + 1, View::Float, NULL, TEST_ALIGN(base.size.x));
+        SimdHogLiteFilterFeatures(base.features, base.stride, base.size.x, base.size.y, F, (float*)filters[0].data, sizes[0], sizes[0], NULL, 0, (float*)root.data, root.stride / sizeof(float));
+        std::vector<float> values((float*)root.data, (float*)root.data + root.width);
+        std::sort(values.begin(), values.end());
+        float threshold = values[values.size() * 9 / 10];
+        const size_t neighborhood = 7;
+        bank.SetRejection(0, threshold, neighborhood);
+
+        TEST_LOG_SS(Info, "Test HogLiteFilterBank for " << filters.size() << " filters and " << pyramid.Size() << " levels.");
+
+        double time = GetTime();
+        bank.Run(pyramid);
+        TEST_LOG_SS(Info, "Apply filter bank: " << (GetTime() - time) * 1000 << " ms ");
+
+        time = GetTime();
+        std::vector<View> controls(pyramid.Size() * filters.size());
+        for (size_t l = 0; l < pyramid.Size(); ++l)
+        {
+            const Pyramid::Level & level = pyramid[l];
+            View mask(level.size.x + neighborhood, level.size.y + neighborhood, View::Int32, NULL, TEST_ALIGN(level.size.x));
+            Simd::Fill(mask, 0);
+            for (size_t f = 0; f < filters.size(); ++f)
+            {
+                if (level.size.x < (ptrdiff_t)sizes[f] || level.size.y < (ptrdiff_t)sizes[f])
+                    continue;
+                View & control = controls[l * filters.size() + f];
+                control.Recreate(level.size.x - sizes[f] + 1, level.size.y - sizes[f] + 1, View::Float, NULL, TEST_ALIGN(level.size.x));
+                SimdHogLiteFilterFeatures(level.features, level.stride, level.size.x, level.size.y, F, (float*)filters[f].data, sizes[f], sizes[f],
+                    f ? (uint32_t*)mask.data : NULL, mask.stride / 4, (float*)control.data, control.stride / sizeof(float));
+                if (f == 0)
+                    SimdHogLiteCreateMask((float*)control.data, control.stride / 4, control.width, control.height, &threshold, 1, neighborhood, (uint32_t*)mask.data, mask.stride / 4);
+            }
+        }
+        TEST_LOG_SS(Info, "Apply filters one by one: " << (GetTime() - time) * 1000 << " ms ");
+
+        for (size_t l = 0; l < pyramid.Size() && result; ++l)
+        {
+            for (size_t f = 0; f < filters.size() && result; ++f)
+            {
+                const FilterBank::Response & response = bank.At(l, f);
+                const View & control = controls[l * filters.size() + f];
+                if (response.size != control.Size())
+                {
+                    TEST_LOG_SS(Error, "Wrong size of response of filter " << f << " at level " << l << " !");
+                    result = false;
+                    break;
+                }
+                if (control.Area() == 0)
+                    continue;
+                View dst(response.size.x, response.size.y, response.stride * sizeof(float), View::Float, response.data);
+                result = result && Compare(dst, control, 0.0f, true, 32, DifferenceAbsolute, "level " + ToString(l) + ", filter " + ToString(f));
+            }
+        }
+
+        return result;
+    }
 }
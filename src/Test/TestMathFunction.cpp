@@ -0,0 +1,139 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncMF
+        {
+            typedef void(*FuncPtr)(const float * src, size_t size, SimdMathFunctionType type, const float * params, SimdMathAccuracyType accuracy, float * dst);
+
+            FuncPtr func;
+            String description;
+
+            FuncMF(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(SimdMathFunctionType type, SimdMathAccuracyType accuracy)
+            {
+                const char * types[] = { "Exp", "Log", "Pow", "Sigmoid", "Tanh", "Gelu", "Erf", "Swish" };
+                description = description + "[" + types[type] + (accuracy == SimdMathAccuracyFast ? "-f" : "-p") + "]";
+            }
+
+            void Call(const View & src, SimdMathFunctionType type, const float * params, SimdMathAccuracyType accuracy, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func((float*)src.data, src.width, type, params, accuracy, (float*)dst.data);
+            }
+        };
+    }
+
+#define FUNC_MF(function) FuncMF(function, #function)
+
+    bool MathFunction32fAutoTest(int size, SimdMathFunctionType type, SimdMathAccuracyType accuracy, FuncMF f1, FuncMF f2)
+    {
+        bool result = true;
+
+        f1.Update(type, accuracy);
+        f2.Update(type, accuracy);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << size << "].");
+
+        const float lo[] = { -20.0f, 0.001f, 0.001f, -20.0f, -100.0f, -6.0f, -4.0f, -20.0f };
+        const float hi[] = { 20.0f, 999.0f, 9.999f, 20.0f, 100.0f, 6.0f, 4.0f, 20.0f };
+        const float params[] = { type == SimdMathFunctionPow ? -0.75f : 1.5f };
+
+        View src(size, 1, View::Float, NULL, TEST_ALIGN(size));
+        FillRandom32f(src, lo[type], hi[type]);
+
+        View dst1(size, 1, View::Float, NULL, TEST_ALIGN(size));
+        View dst2(size, 1, View::Float, NULL, TEST_ALIGN(size));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, type, params, accuracy, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, type, params, accuracy, dst2));
+
+        float error = accuracy == SimdMathAccuracyFast ? 0.00001f : 0.000001f;
+        result = Compare(dst1, dst2, error, true, 32, DifferenceBoth);
+
+        for (int i = 0; i < size && result; ++i)
+        {
+            float a = dst1.At<float>(i, 0), b = dst2.At<float>(i, 0);
+            if (std::isnan(a) != std::isnan(b))
+            {
+                TEST_LOG_SS(Error, "NaN mismatch at [" << i << "] : " << a << " != " << b << " (src = " << src.At<float>(i, 0) << ")!");
+                result = false;
+            }
+        }
+
+        return result;
+    }
+
+    bool MathFunction32fAutoTest(const FuncMF & f1, const FuncMF & f2)
+    {
+        bool result = true;
+
+        for (int type = SimdMathFunctionExp; type <= SimdMathFunctionSwish; ++type)
+        {
+            for (int accuracy = SimdMathAccuracyFast; accuracy <= SimdMathAccuracyPrecise; ++accuracy)
+            {
+                result = result && MathFunction32fAutoTest(W*H, (SimdMathFunctionType)type, (SimdMathAccuracyType)accuracy, f1, f2);
+                result = result && MathFunction32fAutoTest(W*H + O, (SimdMathFunctionType)type, (SimdMathAccuracyType)accuracy, f1, f2);
+            }
+        }
+
+        return result;
+    }
+
+    bool MathFunction32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && MathFunction32fAutoTest(FUNC_MF(Simd::Base::MathFunction32f), FUNC_MF(SimdMathFunction32f));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && MathFunction32fAutoTest(FUNC_MF(Simd::Base::MathFunction32f), FUNC_MF(Simd::Sse2::MathFunction32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && MathFunction32fAutoTest(FUNC_MF(Simd::Base::MathFunction32f), FUNC_MF(Simd::Avx2::MathFunction32f));
+#endif 
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && MathFunction32fAutoTest(FUNC_MF(Simd::Base::MathFunction32f), FUNC_MF(Simd::Avx512f::MathFunction32f));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && MathFunction32fAutoTest(FUNC_MF(Simd::Base::MathFunction32f), FUNC_MF(Simd::Neon::MathFunction32f));
+#endif 
+
+        return result;
+    }
+}
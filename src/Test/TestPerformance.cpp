@@ -439,11 +439,18 @@ namespace Test
         for (FunctionStatisticMap::const_iterator it = functions.begin(); it != functions.end(); ++it)
             AddToCommon(it->second, enable, common);
 
-        size_t size = 0;
+        // Every enabled column has a time and every enabled column after Base has two relations (see AddRow).
+        size_t size = 0, relations = 0;
         for (size_t i = 0; i < enable.Size(); ++i)
+        {
             if (enable[i])
+            {
                 size++;
-        TablePtr table(new Table(size*(align ? 4 : 3) - 3, 1 + functions.size()));
+                if (i >= 2)
+                    relations += 2;
+            }
+        }
+        TablePtr table(new Table(1 + size*(align ? 2 : 1) + relations, 1 + functions.size()));
         AddHeader(*table, names, enable, align);
         size_t row = 0;
         table->SetRowProp(row, true, true);
@@ -139,6 +139,130 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncRBR
+        {
+            typedef void(*FuncPtr)(
+                const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+                uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount,
+                float siteX, size_t dstRowBeg, size_t dstRowEnd);
+
+            FuncPtr func;
+            String description;
+
+            FuncRBR(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(float siteX, size_t bands)
+            {
+                std::stringstream ss;
+                ss << description << "[" << siteX << "-" << bands << "]";
+                description = ss.str();
+            }
+
+            void Call(const View & src, View & dst, float siteX, size_t bands) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                for (size_t b = 0; b < bands; ++b)
+                    func(src.data, src.width, src.height, src.stride, dst.data, dst.width, dst.height, dst.stride, 
+                        View::PixelSize(src.format), siteX, dst.height*b / bands, dst.height*(b + 1) / bands);
+            }
+        };
+    }
+
+#define FUNC_RBR(function) \
+    FuncRBR(function, std::string(#function))
+
+    bool ResizeBilinearRowsAutoTest(View::Format format, int width, int height, double k, float siteX, size_t bands, FuncRBR f1, FuncRBR f2)
+    {
+        bool result = true;
+
+        f1.Update(siteX, bands);
+        f2.Update(siteX, bands);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << ColorDescription(format) << " & " << f2.description << ColorDescription(format)
+            << " [" << size_t(width*k) << ", " << size_t(height*k) << "] -> [" << width << ", " << height << "].");
+
+        View s(size_t(width*k), size_t(height*k), format, NULL, TEST_ALIGN(size_t(k*width)));
+        FillRandom(s);
+
+        View d1(width, height, format, NULL, TEST_ALIGN(width));
+        View d2(width, height, format, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, d1, siteX, 1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, d2, siteX, bands));
+
+        result = result && Compare(d1, d2, 0, true, 64);
+
+        if (siteX == 0.5f)
+        {
+            View d3(width, height, format, NULL, TEST_ALIGN(width));
+            SimdResizeBilinear(s.data, s.width, s.height, s.stride, d3.data, d3.width, d3.height, d3.stride, View::PixelSize(format));
+            result = result && Compare(d1, d3, 0, true, 64);
+        }
+
+        return result;
+    }
+
+    bool ResizeBilinearRowsAutoTest(const FuncRBR & f1, const FuncRBR & f2)
+    {
+        bool result = true;
+
+        for (View::Format format = View::Gray8; format <= View::Bgra32; format = View::Format(format + 1))
+        {
+            for (int site = 0; site < 2; ++site)
+            {
+                float siteX = site ? 0.5f : 0.25f;
+                result = result && ResizeBilinearRowsAutoTest(format, W, H, 0.9, siteX, 1, f1, f2);
+                result = result && ResizeBilinearRowsAutoTest(format, W + O, H - O, 1.3, siteX, 3, f1, f2);
+                result = result && ResizeBilinearRowsAutoTest(format, W - O, H + O, 0.7, siteX, 5, f1, f2);
+                result = result && ResizeBilinearRowsAutoTest(format, W / 2 + 1, H / 2 + 1, 2.0, siteX, 4, f1, f2);
+            }
+        }
+
+        return result;
+    }
+
+    bool ResizeBilinearRowsAutoTest()
+    {
+        bool result = true;
+
+        result = result && ResizeBilinearRowsAutoTest(FUNC_RBR(Simd::Base::ResizeBilinearRows), FUNC_RBR(SimdResizeBilinearRows));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && ResizeBilinearRowsAutoTest(FUNC_RBR(Simd::Sse2::ResizeBilinearRows), FUNC_RBR(SimdResizeBilinearRows));
+#endif 
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable)
+            result = result && ResizeBilinearRowsAutoTest(FUNC_RBR(Simd::Ssse3::ResizeBilinearRows), FUNC_RBR(SimdResizeBilinearRows));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && ResizeBilinearRowsAutoTest(FUNC_RBR(Simd::Avx2::ResizeBilinearRows), FUNC_RBR(SimdResizeBilinearRows));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && ResizeBilinearRowsAutoTest(FUNC_RBR(Simd::Avx512bw::ResizeBilinearRows), FUNC_RBR(SimdResizeBilinearRows));
+#endif 
+
+#ifdef SIMD_VMX_ENABLE
+        if (Simd::Vmx::Enable)
+            result = result && ResizeBilinearRowsAutoTest(FUNC_RBR(Simd::Vmx::ResizeBilinearRows), FUNC_RBR(SimdResizeBilinearRows));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && ResizeBilinearRowsAutoTest(FUNC_RBR(Simd::Neon::ResizeBilinearRows), FUNC_RBR(SimdResizeBilinearRows));
+#endif
+
+        return result;
+    }
+
     String ToString(SimdResizeMethodType method)
     {
         switch (method)
@@ -383,6 +383,179 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncLC
+        {
+            typedef size_t(*FuncPtr)(const uint8_t * mask, size_t maskStride, size_t width, size_t height, SimdCompareType compareType, uint8_t value,
+                int connectivity, uint32_t * labels, size_t labelsStride, SimdConnectedComponent * components, size_t capacity);
+            FuncPtr func;
+            String description;
+
+            FuncLC(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & mask, SimdCompareType compareType, uint8_t value, int connectivity, View & labels, std::vector<SimdConnectedComponent> & components, size_t & count) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                count = func(mask.data, mask.stride, mask.width, mask.height, compareType, value, connectivity, 
+                    (uint32_t*)labels.data, labels.stride, components.data(), components.size());
+            }
+        };
+    }
+
+#define FUNC_LC(func) FuncLC(func, #func)
+
+    bool IsForeground(uint8_t a, uint8_t b, SimdCompareType compareType)
+    {
+        switch (compareType)
+        {
+        case SimdCompareEqual: return a == b;
+        case SimdCompareNotEqual: return a != b;
+        case SimdCompareGreater: return a > b;
+        case SimdCompareGreaterOrEqual: return a >= b;
+        case SimdCompareLesser: return a < b;
+        case SimdCompareLesserOrEqual: return a <= b;
+        default: assert(0); return false;
+        }
+    }
+
+    size_t LabelComponentsReference(const View & mask, SimdCompareType compareType, uint8_t value, int connectivity, View & labels, std::vector<SimdConnectedComponent> & components)
+    {
+        const ptrdiff_t w = mask.width, h = mask.height;
+        const ptrdiff_t dx[8] = { -1, 1, 0, 0, -1, 1, -1, 1 }, dy[8] = { 0, 0, -1, 1, -1, -1, 1, 1 };
+        Simd::Fill(labels, 0);
+        components.clear();
+        std::vector<Point> stack;
+        for (ptrdiff_t y = 0; y < h; ++y)
+        {
+            for (ptrdiff_t x = 0; x < w; ++x)
+            {
+                if (!IsForeground(mask.At<uint8_t>(x, y), value, compareType) || labels.At<uint32_t>(x, y))
+                    continue;
+                uint32_t label = uint32_t(components.size() + 1);
+                SimdConnectedComponent c = { 0, x, y, x + 1, y + 1, 0.0f, 0.0f };
+                double sx = 0, sy = 0;
+                labels.At<uint32_t>(x, y) = label;
+                stack.push_back(Point(x, y));
+                while (stack.size())
+                {
+                    Point p = stack.back();
+                    stack.pop_back();
+                    c.area++;
+                    sx += p.x;
+                    sy += p.y;
+                    c.left = std::min(c.left, p.x);
+                    c.top = std::min(c.top, p.y);
+                    c.right = std::max(c.right, p.x + 1);
+                    c.bottom = std::max(c.bottom, p.y + 1);
+                    for (int i = 0; i < connectivity; ++i)
+                    {
+                        ptrdiff_t nx = p.x + dx[i], ny = p.y + dy[i];
+                        if (nx < 0 || nx >= w || ny < 0 || ny >= h || labels.At<uint32_t>(nx, ny) || !IsForeground(mask.At<uint8_t>(nx, ny), value, compareType))
+                            continue;
+                        labels.At<uint32_t>(nx, ny) = label;
+                        stack.push_back(Point(nx, ny));
+                    }
+                }
+                c.x = float(sx / c.area);
+                c.y = float(sy / c.area);
+                components.push_back(c);
+            }
+        }
+        return components.size();
+    }
+
+    bool Compare(const std::vector<SimdConnectedComponent> & a, size_t na, const std::vector<SimdConnectedComponent> & b, size_t nb, const String & description)
+    {
+        if (na != nb)
+        {
+            TEST_LOG_SS(Error, description << " : component number is different: " << na << " != " << nb << " !");
+            return false;
+        }
+        for (size_t i = 0, n = std::min(na, std::min(a.size(), b.size())); i < n; ++i)
+        {
+            const SimdConnectedComponent & ca = a[i], & cb = b[i];
+            if (ca.area != cb.area || ca.left != cb.left || ca.top != cb.top || ca.right != cb.right || ca.bottom != cb.bottom ||
+                ::fabs(ca.x - cb.x) > 0.001f || ::fabs(ca.y - cb.y) > 0.001f)
+            {
+                TEST_LOG_SS(Error, description << " : component " << i << " is different: {" << ca.area << ", [" << ca.left << ", " << ca.top << ", " << ca.right << ", " << ca.bottom
+                    << "], (" << ca.x << ", " << ca.y << ")} != {" << cb.area << ", [" << cb.left << ", " << cb.top << ", " << cb.right << ", " << cb.bottom
+                    << "], (" << cb.x << ", " << cb.y << ")} !");
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool SegmentationLabelComponentsAutoTest(int width, int height, SimdCompareType compareType, int connectivity, const FuncLC & f1, const FuncLC & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "].");
+
+        uint8_t value = compareType == SimdCompareEqual ? 2 : 127;
+        View mask(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        if (compareType == SimdCompareEqual)
+            FillRandom(mask, 0, 3);
+        else
+            FillRandom(mask);
+
+        View labels1(width, height, View::Int32, NULL, TEST_ALIGN(width));
+        View labels2(width, height, View::Int32, NULL, TEST_ALIGN(width));
+        View labels3(width, height, View::Int32, NULL, TEST_ALIGN(width));
+        size_t capacity = f1.func(mask.data, mask.stride, width, height, compareType, value, connectivity, NULL, 0, NULL, 0);
+        std::vector<SimdConnectedComponent> components1(capacity), components2(capacity), components3;
+        size_t count1, count2, count3;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(mask, compareType, value, connectivity, labels1, components1, count1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(mask, compareType, value, connectivity, labels2, components2, count2));
+
+        count3 = LabelComponentsReference(mask, compareType, value, connectivity, labels3, components3);
+
+        result = result && Compare(labels1, labels2, 0, true, 64);
+        result = result && Compare(components1, count1, components2, count2, f1.description + " & " + f2.description);
+        result = result && Compare(labels1, labels3, 0, true, 64);
+        result = result && Compare(components1, count1, components3, count3, f1.description + " & reference");
+
+        return result;
+    }
+
+    bool SegmentationLabelComponentsAutoTest(const FuncLC & f1, const FuncLC & f2)
+    {
+        bool result = true;
+
+        result = result && SegmentationLabelComponentsAutoTest(W, H, SimdCompareGreater, 8, f1, f2);
+        result = result && SegmentationLabelComponentsAutoTest(W + O, H - O, SimdCompareGreater, 8, f1, f2);
+        result = result && SegmentationLabelComponentsAutoTest(W - O, H + O, SimdCompareEqual, 4, f1, f2);
+
+        return result;
+    }
+
+    bool SegmentationLabelComponentsAutoTest()
+    {
+        bool result = true;
+
+        result = result && SegmentationLabelComponentsAutoTest(FUNC_LC(Simd::Base::SegmentationLabelComponents), FUNC_LC(SimdSegmentationLabelComponents));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && SegmentationLabelComponentsAutoTest(FUNC_LC(Simd::Sse2::SegmentationLabelComponents), FUNC_LC(SimdSegmentationLabelComponents));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SegmentationLabelComponentsAutoTest(FUNC_LC(Simd::Avx2::SegmentationLabelComponents), FUNC_LC(SimdSegmentationLabelComponents));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SegmentationLabelComponentsAutoTest(FUNC_LC(Simd::Avx512bw::SegmentationLabelComponents), FUNC_LC(SimdSegmentationLabelComponents));
+#endif
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     bool SegmentationShrinkRegionDataTest(bool create, int width, int height, const FuncSR & f)
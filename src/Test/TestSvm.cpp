@@ -25,6 +25,8 @@
 #include "Test/TestPerformance.h"
 #include "Test/TestData.h"
 
+#include "Simd/SimdSvm.h"
+
 namespace Test
 {
     namespace
@@ -174,4 +176,158 @@ namespace Test
 
         return result;
     }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncSP
+        {
+            typedef void*(*FuncPtr)(const float * svs, const float * weights, size_t length, size_t count, const float * bias, SimdSvmKernelType kernel, const float * params);
+
+            FuncPtr func;
+            String description;
+
+            FuncSP(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(SimdSvmKernelType kernel)
+            {
+                const char * names[] = { "Linear", "Polynomial", "Rbf", "Sigmoid" };
+                description = description + "[" + names[kernel] + "]";
+            }
+
+            void Call(const View & svs, const View & weights, size_t length, size_t count, float bias, SimdSvmKernelType kernel, const float * params, const View & samples, View & decisions) const
+            {
+                void * svm = func((float*)svs.data, (float*)weights.data, length, count, &bias, kernel, params);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdSvmPredict(svm, (float*)samples.data, samples.height, (float*)decisions.data);
+                }
+                SimdRelease(svm);
+            }
+        };
+    }
+
+#define FUNC_SP(function) FuncSP(function, #function)
+
+    bool SvmPredictAutoTest(size_t length, size_t count, size_t number, SimdSvmKernelType kernel, FuncSP f1, FuncSP f2)
+    {
+        bool result = true;
+
+        f1.Update(kernel);
+        f2.Update(kernel);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << length << ", " << count << ", " << number << "].");
+
+        View svs(length, count, View::Float, NULL, TEST_ALIGN(SIMD_ALIGN));
+        View weights(count, 1, View::Float, NULL, TEST_ALIGN(SIMD_ALIGN));
+        View samples(length, number, View::Float, NULL, TEST_ALIGN(SIMD_ALIGN));
+        View d1(number, 1, View::Float, NULL, TEST_ALIGN(SIMD_ALIGN));
+        View d2(number, 1, View::Float, NULL, TEST_ALIGN(SIMD_ALIGN));
+
+        FillRandom32f(svs, -1.0, 1.0);
+        FillRandom32f(weights, -1.0, 1.0);
+        FillRandom32f(samples, -1.0, 1.0);
+        float bias = 0.5f, params[3] = { 1.0f / length, 1.0f, 3.0f };
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(svs, weights, length, count, bias, kernel, params, samples, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(svs, weights, length, count, bias, kernel, params, samples, d2));
+
+        result = result && Compare(d1, d2, EPS, true, 32, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SvmInitErrorTest(const FuncSP & f)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f.description << " for invalid arguments.");
+
+        const size_t length = 16, count = 4;
+        View svs(length, count, View::Float, NULL, TEST_ALIGN(SIMD_ALIGN));
+        View weights(count, 1, View::Float, NULL, TEST_ALIGN(SIMD_ALIGN));
+        FillRandom32f(svs, -1.0, 1.0);
+        FillRandom32f(weights, -1.0, 1.0);
+        const float * s = (float*)svs.data, * w = (float*)weights.data;
+        float params[3] = { 1.0f / length, 1.0f, 3.0f }, zeroDegree[3] = { 1.0f / length, 1.0f, 0.0f };
+
+        struct Case
+        {
+            const float * svs, * weights;
+            size_t length, count;
+            int kernel;
+            const float * params;
+            const char * name;
+        } cases[] = {
+            { s, w, length, 0, SimdSvmKernelLinear, NULL, "count = 0" },
+            { s, w, length, 0, SimdSvmKernelRbf, params, "count = 0" },
+            { s, w, 0, count, SimdSvmKernelLinear, NULL, "length = 0" },
+            { NULL, w, length, count, SimdSvmKernelLinear, NULL, "svs = NULL" },
+            { s, NULL, length, count, SimdSvmKernelRbf, params, "weights = NULL" },
+            { s, w, length, count, SimdSvmKernelRbf, NULL, "params = NULL" },
+            { s, w, length, count, SimdSvmKernelPolynomial, zeroDegree, "degree = 0" },
+            { s, w, length, count, SimdSvmKernelSigmoid + 1, params, "unknown kernel" },
+        };
+
+        for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); ++i)
+        {
+            const Case & c = cases[i];
+            void * svm = f.func(c.svs, c.weights, c.length, c.count, NULL, (SimdSvmKernelType)c.kernel, c.params);
+            if (svm)
+            {
+                TEST_LOG_SS(Error, f.description << " returns not NULL for invalid arguments (" << c.name << ")!");
+                SimdRelease(svm);
+                result = false;
+            }
+        }
+
+        return result;
+    }
+
+    bool SvmPredictAutoTest(const FuncSP & f1, const FuncSP & f2)
+    {
+        bool result = true;
+
+        result = result && SvmInitErrorTest(f1);
+        result = result && SvmInitErrorTest(f2);
+
+        for (int kernel = SimdSvmKernelLinear; kernel <= SimdSvmKernelSigmoid; ++kernel)
+        {
+            result = result && SvmPredictAutoTest(128, 500, 1000, (SimdSvmKernelType)kernel, f1, f2);
+            result = result && SvmPredictAutoTest(333, 77, 129, (SimdSvmKernelType)kernel, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool SvmPredictAutoTest()
+    {
+        bool result = true;
+
+        result = result && SvmPredictAutoTest(FUNC_SP(Simd::Base::SvmInit), FUNC_SP(SimdSvmInit));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && SvmPredictAutoTest(FUNC_SP(Simd::Sse2::SvmInit), FUNC_SP(SimdSvmInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SvmPredictAutoTest(FUNC_SP(Simd::Avx2::SvmInit), FUNC_SP(SimdSvmInit));
+#endif 
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SvmPredictAutoTest(FUNC_SP(Simd::Avx512f::SvmInit), FUNC_SP(SimdSvmInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SvmPredictAutoTest(FUNC_SP(Simd::Neon::SvmInit), FUNC_SP(SimdSvmInit));
+#endif 
+
+        return result;
+    }
 }
@@ -122,6 +122,224 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncDD
+        {
+            typedef void(*FuncPtr)(const float * loc, const float * prior, size_t count, float * dst);
+
+            FuncPtr func;
+            String desc;
+
+            FuncDD(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Update(size_t count)
+            {
+                desc = desc + "[" + ToString(count) + "]";
+            }
+
+            void Call(const Tensor32f & loc, const Tensor32f & prior, Tensor32f & dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(loc.Data(), prior.Data(), loc.Axis(0), dst.Data());
+            }
+        };
+    }
+
+#define FUNC_DD(function) FuncDD(function, #function)
+
+    static void FillPriors(size_t count, float * prior)
+    {
+        FillRandom(prior, count * 4, 0.0f, 0.9f);
+        for (size_t i = 0; i < count; ++i, prior += 4)
+        {
+            prior[2] = prior[0] + 0.02f + prior[2] * 0.1f;
+            prior[3] = prior[1] + 0.02f + prior[3] * 0.1f;
+        }
+        for (size_t i = 0; i < count; ++i, prior += 4)
+        {
+            prior[0] = 0.1f;
+            prior[1] = 0.1f;
+            prior[2] = 0.2f;
+            prior[3] = 0.2f;
+        }
+    }
+
+    bool SynetDetectionDecode32fAutoTest(size_t count, FuncDD f1, FuncDD f2)
+    {
+        bool result = true;
+
+        f1.Update(count);
+        f2.Update(count);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        Tensor32f loc({ count, 4 });
+        FillRandom(loc.Data(), loc.Size(), -1.0, 1.0f);
+        Tensor32f prior({ 2, count, 4 });
+        FillPriors(count, prior.Data());
+
+        Tensor32f dst1({ count, 4 });
+        Tensor32f dst2({ count, 4 });
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(loc, prior, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(loc, prior, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceAbsolute);
+
+        return result;
+    }
+
+    bool SynetDetectionDecode32fAutoTest(const FuncDD & f1, const FuncDD & f2)
+    {
+        bool result = true;
+
+        result = result && SynetDetectionDecode32fAutoTest(8732, f1, f2);
+        result = result && SynetDetectionDecode32fAutoTest(8732 + O, f1, f2);
+
+        return result;
+    }
+
+    bool SynetDetectionDecode32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetDetectionDecode32fAutoTest(FUNC_DD(Simd::Base::SynetDetectionDecode32f), FUNC_DD(SimdSynetDetectionDecode32f));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && SynetDetectionDecode32fAutoTest(FUNC_DD(Simd::Sse2::SynetDetectionDecode32f), FUNC_DD(SimdSynetDetectionDecode32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetDetectionDecode32fAutoTest(FUNC_DD(Simd::Avx2::SynetDetectionDecode32f), FUNC_DD(SimdSynetDetectionDecode32f));
+#endif 
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetDetectionDecode32fAutoTest(FUNC_DD(Simd::Avx512f::SynetDetectionDecode32f), FUNC_DD(SimdSynetDetectionDecode32f));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SynetDetectionDecode32fAutoTest(FUNC_DD(Simd::Neon::SynetDetectionDecode32f), FUNC_DD(SimdSynetDetectionDecode32f));
+#endif
+
+        return result;
+    }
+
+    namespace
+    {
+        struct FuncDN
+        {
+            typedef size_t(*FuncPtr)(const float * boxes, const float * scores, size_t count, size_t classes, ptrdiff_t background, float scoreThreshold,
+                float nmsThreshold, size_t topK, size_t keepTopK, SimdBool classAware, float * dst);
+
+            FuncPtr func;
+            String desc;
+
+            FuncDN(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Update(size_t count, size_t classes, SimdBool classAware)
+            {
+                desc = desc + "[" + ToString(count) + "-" + ToString(classes) + "-" + ToString(classAware) + "]";
+            }
+
+            void Call(const Tensor32f & boxes, const Tensor32f & scores, float scoreThreshold, float nmsThreshold, 
+                size_t topK, SimdBool classAware, Tensor32f & dst, size_t & size) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                size = func(boxes.Data(), scores.Data(), scores.Axis(0), scores.Axis(1), 0, scoreThreshold, nmsThreshold, topK, dst.Axis(0), classAware, dst.Data());
+            }
+        };
+    }
+
+#define FUNC_DN(function) FuncDN(function, #function)
+
+    bool SynetDetectionNms32fAutoTest(size_t count, size_t classes, SimdBool classAware, FuncDN f1, FuncDN f2)
+    {
+        bool result = true;
+
+        f1.Update(count, classes, classAware);
+        f2.Update(count, classes, classAware);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        Tensor32f loc({ count, 4 });
+        FillRandom(loc.Data(), loc.Size(), -1.0, 1.0f);
+        Tensor32f prior({ 2, count, 4 });
+        FillPriors(count, prior.Data());
+        Tensor32f boxes({ count, 4 });
+        Simd::Base::SynetDetectionDecode32f(loc.Data(), prior.Data(), count, boxes.Data());
+        Tensor32f scores({ count, classes });
+        FillRandom(scores.Data(), scores.Size(), 0.0f, 1.0f);
+
+        const size_t keepTopK = 200;
+        Tensor32f dst1({ keepTopK, 6 });
+        Tensor32f dst2({ keepTopK, 6 });
+        size_t size1 = 0, size2 = 0;
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(boxes, scores, 0.7f, 0.45f, 400, classAware, dst1, size1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(boxes, scores, 0.7f, 0.45f, 400, classAware, dst2, size2));
+
+        if (size1 != size2)
+        {
+            TEST_LOG_SS(Error, "Different number of detections: " << size1 << " != " << size2 << ".");
+            return false;
+        }
+
+        result = result && Compare(dst1, dst2, 0.0f, true, 64, DifferenceAbsolute);
+
+        return result;
+    }
+
+    bool SynetDetectionNms32fAutoTest(const FuncDN & f1, const FuncDN & f2)
+    {
+        bool result = true;
+
+        result = result && SynetDetectionNms32fAutoTest(8732, 21, SimdTrue, f1, f2);
+        result = result && SynetDetectionNms32fAutoTest(8732 + O, 3, SimdTrue, f1, f2);
+        result = result && SynetDetectionNms32fAutoTest(8732, 2, SimdFalse, f1, f2);
+
+        return result;
+    }
+
+    bool SynetDetectionNms32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetDetectionNms32fAutoTest(FUNC_DN(Simd::Base::SynetDetectionNms32f), FUNC_DN(SimdSynetDetectionNms32f));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && SynetDetectionNms32fAutoTest(FUNC_DN(Simd::Sse2::SynetDetectionNms32f), FUNC_DN(SimdSynetDetectionNms32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetDetectionNms32fAutoTest(FUNC_DN(Simd::Avx2::SynetDetectionNms32f), FUNC_DN(SimdSynetDetectionNms32f));
+#endif 
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetDetectionNms32fAutoTest(FUNC_DN(Simd::Avx512f::SynetDetectionNms32f), FUNC_DN(SimdSynetDetectionNms32f));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SynetDetectionNms32fAutoTest(FUNC_DN(Simd::Neon::SynetDetectionNms32f), FUNC_DN(SimdSynetDetectionNms32f));
+#endif
+
+        return result;
+    }
+
     SIMD_INLINE String ToString(SimdSynetEltwiseOperationType type)
     {
         switch (type)
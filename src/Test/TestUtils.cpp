@@ -507,6 +507,10 @@ namespace Test
         case View::BayerGbrg: return "Bayer GBRG";
         case View::BayerRggb: return "Bayer RGGB";
         case View::BayerBggr: return "Bayer BGGR";
+        case View::Rgb24:     return "24-bit RGB";
+        case View::Rgba32:    return "32-bit RGBA";
+        case View::Uv32:      return "32-bit UV";
+        case View::Lab24:     return "24-bit Lab";
         default: assert(0); return "";
         }
     }
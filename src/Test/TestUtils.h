@@ -110,6 +110,37 @@ namespace Test
         return ss.str();
     }
 
+    template <> SIMD_INLINE String ToString<SimdYuvType>(const SimdYuvType & value)
+    {
+        switch (value)
+        {
+        case SimdYuvBt601: return "Bt601";
+        case SimdYuvBt709: return "Bt709";
+        case SimdYuvBt2020: return "Bt2020";
+        case SimdYuvBt601Full: return "Bt601Full";
+        case SimdYuvBt709Full: return "Bt709Full";
+        case SimdYuvBt2020Full: return "Bt2020Full";
+        default: assert(0); return "";
+        }
+    }
+
+    SIMD_INLINE void YuvTypeCoefficients(SimdYuvType yuvType, double & kr, double & kb, bool & fullRange)
+    {
+        switch (yuvType)
+        {
+        case SimdYuvBt601: case SimdYuvBt601Full: kr = 0.299; kb = 0.114; break;
+        case SimdYuvBt709: case SimdYuvBt709Full: kr = 0.2126; kb = 0.0722; break;
+        case SimdYuvBt2020: case SimdYuvBt2020Full: kr = 0.2627; kb = 0.0593; break;
+        default: assert(0); kr = 0; kb = 0;
+        }
+        fullRange = yuvType == SimdYuvBt601Full || yuvType == SimdYuvBt709Full || yuvType == SimdYuvBt2020Full;
+    }
+
+    SIMD_INLINE int RoundAndRestrict(double value)
+    {
+        return std::min(std::max((int)std::floor(value + 0.5), 0), 255);
+    }
+
     SIMD_INLINE String ToString(int value, int width)
     {
         std::stringstream ss;
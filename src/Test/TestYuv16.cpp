@@ -0,0 +1,817 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+
+namespace Test
+{
+    static void FillRandom16u(View & view, size_t bitDepth)
+    {
+        assert(view.ChannelSize() == 2);
+
+        int range = 1 << bitDepth;
+        size_t width = view.width*view.ChannelCount();
+        for (size_t row = 0; row < view.height; ++row)
+        {
+            uint16_t * data = (uint16_t*)(view.data + row*view.stride);
+            for (size_t col = 0; col < width; ++col)
+                data[col] = uint16_t(Random(range));
+        }
+    }
+
+    namespace
+    {
+        struct FuncG
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t width, size_t height, size_t srcStride, size_t bitDepth, SimdBool dither, uint8_t * dst, size_t dstStride);
+
+            FuncPtr func;
+            String description;
+            size_t bitDepth;
+            SimdBool dither;
+
+            FuncG(const FuncPtr & f, const String & d, size_t b = 10, SimdBool t = SimdFalse) : func(f), description(d), bitDepth(b), dither(t) {}
+
+            void Update(size_t b, SimdBool t)
+            {
+                bitDepth = b;
+                dither = t;
+                description = description + "[" + ToString(b) + "-" + ToString(t) + "]";
+            }
+
+            void Call(const View & src, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.width, src.height, src.stride, bitDepth, dither, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_G(function) FuncG(function, #function)
+
+    bool Uint16ToGrayAutoTest(int width, int height, size_t bitDepth, SimdBool dither, FuncG f1, FuncG f2)
+    {
+        bool result = true;
+
+        f1.Update(bitDepth, dither);
+        f2.Update(bitDepth, dither);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View src(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom16u(src, bitDepth);
+
+        View dst1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View dst2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool Uint16ToGrayAutoTest(const FuncG & f1, const FuncG & f2)
+    {
+        bool result = true;
+
+        const size_t bitDepths[3] = { 10, 12, 16 };
+        for (size_t i = 0; i < 3; ++i)
+        {
+            result = result && Uint16ToGrayAutoTest(W, H, bitDepths[i], SimdFalse, f1, f2);
+            result = result && Uint16ToGrayAutoTest(W + O, H - O, bitDepths[i], SimdTrue, f1, f2);
+        }
+        result = result && Uint16ToGrayAutoTest(W - O, H + O, 10, SimdTrue, f1, f2);
+
+        return result;
+    }
+
+    bool Uint16ToGrayAutoTest()
+    {
+        bool result = true;
+
+        result = result && Uint16ToGrayAutoTest(FUNC_G(Simd::Base::Uint16ToGray), FUNC_G(SimdUint16ToGray));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && Uint16ToGrayAutoTest(FUNC_G(Simd::Sse2::Uint16ToGray), FUNC_G(SimdUint16ToGray));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && Uint16ToGrayAutoTest(FUNC_G(Simd::Avx2::Uint16ToGray), FUNC_G(SimdUint16ToGray));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Uint16ToGrayAutoTest(FUNC_G(Simd::Avx512bw::Uint16ToGray), FUNC_G(SimdUint16ToGray));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && Uint16ToGrayAutoTest(FUNC_G(Simd::Neon::Uint16ToGray), FUNC_G(SimdUint16ToGray));
+#endif 
+
+        return result;
+    }
+
+    namespace
+    {
+        struct FuncF
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t width, size_t height, size_t srcStride, size_t bitDepth, uint8_t * dst, size_t dstStride);
+
+            FuncPtr func;
+            String description;
+            size_t bitDepth;
+
+            FuncF(const FuncPtr & f, const String & d, size_t b = 10) : func(f), description(d), bitDepth(b) {}
+
+            void Update(size_t b)
+            {
+                bitDepth = b;
+                description = description + "[" + ToString(b) + "]";
+            }
+
+            void Call(const View & src, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.width, src.height, src.stride, bitDepth, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_F(function) FuncF(function, #function)
+
+    bool Uint16ToFloat32AutoTest(int width, int height, size_t bitDepth, FuncF f1, FuncF f2)
+    {
+        bool result = true;
+
+        f1.Update(bitDepth);
+        f2.Update(bitDepth);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View src(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom16u(src, bitDepth);
+
+        View dst1(width, height, View::Float, NULL, TEST_ALIGN(width));
+        View dst2(width, height, View::Float, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceAbsolute);
+
+        return result;
+    }
+
+    bool Uint16ToFloat32AutoTest(const FuncF & f1, const FuncF & f2)
+    {
+        bool result = true;
+
+        result = result && Uint16ToFloat32AutoTest(W, H, 10, f1, f2);
+        result = result && Uint16ToFloat32AutoTest(W + O, H - O, 12, f1, f2);
+        result = result && Uint16ToFloat32AutoTest(W - O, H + O, 16, f1, f2);
+
+        return result;
+    }
+
+    bool Uint16ToFloat32AutoTest()
+    {
+        bool result = true;
+
+        result = result && Uint16ToFloat32AutoTest(FUNC_F(Simd::Base::Uint16ToFloat32), FUNC_F(SimdUint16ToFloat32));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && Uint16ToFloat32AutoTest(FUNC_F(Simd::Sse2::Uint16ToFloat32), FUNC_F(SimdUint16ToFloat32));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && Uint16ToFloat32AutoTest(FUNC_F(Simd::Avx2::Uint16ToFloat32), FUNC_F(SimdUint16ToFloat32));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Uint16ToFloat32AutoTest(FUNC_F(Simd::Avx512bw::Uint16ToFloat32), FUNC_F(SimdUint16ToFloat32));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && Uint16ToFloat32AutoTest(FUNC_F(Simd::Neon::Uint16ToFloat32), FUNC_F(SimdUint16ToFloat32));
+#endif 
+
+        return result;
+    }
+
+    namespace
+    {
+        struct FuncCbd
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t width, size_t height, size_t srcStride, size_t srcBitDepth, size_t dstBitDepth, uint8_t * dst, size_t dstStride);
+
+            FuncPtr func;
+            String description;
+            size_t srcBitDepth, dstBitDepth;
+
+            FuncCbd(const FuncPtr & f, const String & d, size_t s = 8, size_t b = 10) : func(f), description(d), srcBitDepth(s), dstBitDepth(b) {}
+
+            void Update(size_t s, size_t b)
+            {
+                srcBitDepth = s;
+                dstBitDepth = b;
+                description = description + "[" + ToString(s) + "-" + ToString(b) + "]";
+            }
+
+            void Call(const View & src, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.width*src.ChannelCount(), src.height, src.stride, srcBitDepth, dstBitDepth, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_CBD(function) FuncCbd(function, #function)
+
+    static View::Format BitDepthFormat(size_t bitDepth, bool uv)
+    {
+        if (uv)
+            return bitDepth > 8 ? View::Uv32 : View::Uv16;
+        else
+            return bitDepth > 8 ? View::Int16 : View::Gray8;
+    }
+
+    static void FillRandomBitDepth(View & view, size_t bitDepth)
+    {
+        int range = (1 << bitDepth) - 1;
+        size_t width = view.width*view.ChannelCount();
+        for (size_t row = 0; row < view.height; ++row)
+        {
+            uint8_t * data = view.data + row*view.stride;
+            for (size_t col = 0; col < width; ++col)
+            {
+                if (bitDepth > 8)
+                    ((uint16_t*)data)[col] = uint16_t(Random(range));
+                else
+                    data[col] = uint8_t(Random(range));
+            }
+        }
+    }
+
+    const size_t BIT_DEPTH_PAIRS[][2] = { { 8, 10 }, { 8, 16 }, { 10, 8 }, { 16, 8 }, { 10, 12 }, { 12, 10 }, { 16, 10 }, { 10, 16 }, { 8, 8 }, { 16, 16 } };
+    const size_t BIT_DEPTH_PAIR_COUNT = sizeof(BIT_DEPTH_PAIRS) / sizeof(BIT_DEPTH_PAIRS[0]);
+
+    bool ChangeBitDepthAutoTest(int width, int height, size_t srcBitDepth, size_t dstBitDepth, FuncCbd f1, FuncCbd f2)
+    {
+        bool result = true;
+
+        f1.Update(srcBitDepth, dstBitDepth);
+        f2.Update(srcBitDepth, dstBitDepth);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View src(width, height, BitDepthFormat(srcBitDepth, false), NULL, TEST_ALIGN(width));
+        FillRandomBitDepth(src, srcBitDepth);
+
+        View dst1(width, height, BitDepthFormat(dstBitDepth, false), NULL, TEST_ALIGN(width));
+        View dst2(width, height, BitDepthFormat(dstBitDepth, false), NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool ChangeBitDepthAutoTest(const FuncCbd & f1, const FuncCbd & f2)
+    {
+        bool result = true;
+
+        for (size_t i = 0; i < BIT_DEPTH_PAIR_COUNT; ++i)
+        {
+            result = result && ChangeBitDepthAutoTest(W, H, BIT_DEPTH_PAIRS[i][0], BIT_DEPTH_PAIRS[i][1], f1, f2);
+            result = result && ChangeBitDepthAutoTest(W + O, H - O, BIT_DEPTH_PAIRS[i][0], BIT_DEPTH_PAIRS[i][1], f1, f2);
+        }
+
+        return result;
+    }
+
+    bool ChangeBitDepthAutoTest()
+    {
+        bool result = true;
+
+        result = result && ChangeBitDepthAutoTest(FUNC_CBD(Simd::Base::ChangeBitDepth), FUNC_CBD(SimdChangeBitDepth));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::HA)
+            result = result && ChangeBitDepthAutoTest(FUNC_CBD(Simd::Sse2::ChangeBitDepth), FUNC_CBD(SimdChangeBitDepth));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::HA)
+            result = result && ChangeBitDepthAutoTest(FUNC_CBD(Simd::Avx2::ChangeBitDepth), FUNC_CBD(SimdChangeBitDepth));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::HA)
+            result = result && ChangeBitDepthAutoTest(FUNC_CBD(Simd::Avx512bw::ChangeBitDepth), FUNC_CBD(SimdChangeBitDepth));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::HA)
+            result = result && ChangeBitDepthAutoTest(FUNC_CBD(Simd::Neon::ChangeBitDepth), FUNC_CBD(SimdChangeBitDepth));
+#endif 
+
+        return result;
+    }
+
+    namespace
+    {
+        struct FuncIbd
+        {
+            typedef void(*FuncPtr)(const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height,
+                size_t srcBitDepth, size_t dstBitDepth, uint8_t * uv, size_t uvStride);
+
+            FuncPtr func;
+            String description;
+            size_t srcBitDepth, dstBitDepth;
+
+            FuncIbd(const FuncPtr & f, const String & d, size_t s = 8, size_t b = 10) : func(f), description(d), srcBitDepth(s), dstBitDepth(b) {}
+
+            void Update(size_t s, size_t b)
+            {
+                srcBitDepth = s;
+                dstBitDepth = b;
+                description = description + "[" + ToString(s) + "-" + ToString(b) + "]";
+            }
+
+            void Call(const View & u, const View & v, View & uv) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(u.data, u.stride, v.data, v.stride, u.width, u.height, srcBitDepth, dstBitDepth, uv.data, uv.stride);
+            }
+        };
+    }
+
+#define FUNC_IBD(function) FuncIbd(function, #function)
+
+    bool InterleaveUvBitDepthAutoTest(int width, int height, size_t srcBitDepth, size_t dstBitDepth, FuncIbd f1, FuncIbd f2)
+    {
+        bool result = true;
+
+        f1.Update(srcBitDepth, dstBitDepth);
+        f2.Update(srcBitDepth, dstBitDepth);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View u(width, height, BitDepthFormat(srcBitDepth, false), NULL, TEST_ALIGN(width));
+        View v(width, height, BitDepthFormat(srcBitDepth, false), NULL, TEST_ALIGN(width));
+        FillRandomBitDepth(u, srcBitDepth);
+        FillRandomBitDepth(v, srcBitDepth);
+
+        View uv1(width, height, BitDepthFormat(dstBitDepth, true), NULL, TEST_ALIGN(width));
+        View uv2(width, height, BitDepthFormat(dstBitDepth, true), NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(u, v, uv1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(u, v, uv2));
+
+        result = result && Compare(uv1, uv2, 0, true, 64);
+
+        return result;
+    }
+
+    bool InterleaveUvBitDepthAutoTest(const FuncIbd & f1, const FuncIbd & f2)
+    {
+        bool result = true;
+
+        for (size_t i = 0; i < BIT_DEPTH_PAIR_COUNT; ++i)
+        {
+            result = result && InterleaveUvBitDepthAutoTest(W, H, BIT_DEPTH_PAIRS[i][0], BIT_DEPTH_PAIRS[i][1], f1, f2);
+            result = result && InterleaveUvBitDepthAutoTest(W + O, H - O, BIT_DEPTH_PAIRS[i][0], BIT_DEPTH_PAIRS[i][1], f1, f2);
+        }
+
+        return result;
+    }
+
+    bool InterleaveUvBitDepthAutoTest()
+    {
+        bool result = true;
+
+        result = result && InterleaveUvBitDepthAutoTest(FUNC_IBD(Simd::Base::InterleaveUvBitDepth), FUNC_IBD(SimdInterleaveUvBitDepth));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::HA)
+            result = result && InterleaveUvBitDepthAutoTest(FUNC_IBD(Simd::Sse2::InterleaveUvBitDepth), FUNC_IBD(SimdInterleaveUvBitDepth));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::HA)
+            result = result && InterleaveUvBitDepthAutoTest(FUNC_IBD(Simd::Avx2::InterleaveUvBitDepth), FUNC_IBD(SimdInterleaveUvBitDepth));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::HA)
+            result = result && InterleaveUvBitDepthAutoTest(FUNC_IBD(Simd::Avx512bw::InterleaveUvBitDepth), FUNC_IBD(SimdInterleaveUvBitDepth));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::HA)
+            result = result && InterleaveUvBitDepthAutoTest(FUNC_IBD(Simd::Neon::InterleaveUvBitDepth), FUNC_IBD(SimdInterleaveUvBitDepth));
+#endif 
+
+        return result;
+    }
+
+    namespace
+    {
+        struct FuncDbd
+        {
+            typedef void(*FuncPtr)(const uint8_t * uv, size_t uvStride, size_t width, size_t height, size_t srcBitDepth, size_t dstBitDepth,
+                uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+
+            FuncPtr func;
+            String description;
+            size_t srcBitDepth, dstBitDepth;
+
+            FuncDbd(const FuncPtr & f, const String & d, size_t s = 8, size_t b = 10) : func(f), description(d), srcBitDepth(s), dstBitDepth(b) {}
+
+            void Update(size_t s, size_t b)
+            {
+                srcBitDepth = s;
+                dstBitDepth = b;
+                description = description + "[" + ToString(s) + "-" + ToString(b) + "]";
+            }
+
+            void Call(const View & uv, View & u, View & v) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(uv.data, uv.stride, uv.width, uv.height, srcBitDepth, dstBitDepth, u.data, u.stride, v.data, v.stride);
+            }
+        };
+    }
+
+#define FUNC_DBD(function) FuncDbd(function, #function)
+
+    bool DeinterleaveUvBitDepthAutoTest(int width, int height, size_t srcBitDepth, size_t dstBitDepth, FuncDbd f1, FuncDbd f2)
+    {
+        bool result = true;
+
+        f1.Update(srcBitDepth, dstBitDepth);
+        f2.Update(srcBitDepth, dstBitDepth);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View uv(width, height, BitDepthFormat(srcBitDepth, true), NULL, TEST_ALIGN(width));
+        FillRandomBitDepth(uv, srcBitDepth);
+
+        View u1(width, height, BitDepthFormat(dstBitDepth, false), NULL, TEST_ALIGN(width));
+        View v1(width, height, BitDepthFormat(dstBitDepth, false), NULL, TEST_ALIGN(width));
+        View u2(width, height, BitDepthFormat(dstBitDepth, false), NULL, TEST_ALIGN(width));
+        View v2(width, height, BitDepthFormat(dstBitDepth, false), NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(uv, u1, v1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(uv, u2, v2));
+
+        result = result && Compare(u1, u2, 0, true, 64, 0, "u");
+        result = result && Compare(v1, v2, 0, true, 64, 0, "v");
+
+        return result;
+    }
+
+    bool DeinterleaveUvBitDepthAutoTest(const FuncDbd & f1, const FuncDbd & f2)
+    {
+        bool result = true;
+
+        for (size_t i = 0; i < BIT_DEPTH_PAIR_COUNT; ++i)
+        {
+            result = result && DeinterleaveUvBitDepthAutoTest(W, H, BIT_DEPTH_PAIRS[i][0], BIT_DEPTH_PAIRS[i][1], f1, f2);
+            result = result && DeinterleaveUvBitDepthAutoTest(W + O, H - O, BIT_DEPTH_PAIRS[i][0], BIT_DEPTH_PAIRS[i][1], f1, f2);
+        }
+
+        return result;
+    }
+
+    bool DeinterleaveUvBitDepthAutoTest()
+    {
+        bool result = true;
+
+        result = result && DeinterleaveUvBitDepthAutoTest(FUNC_DBD(Simd::Base::DeinterleaveUvBitDepth), FUNC_DBD(SimdDeinterleaveUvBitDepth));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::HA)
+            result = result && DeinterleaveUvBitDepthAutoTest(FUNC_DBD(Simd::Sse2::DeinterleaveUvBitDepth), FUNC_DBD(SimdDeinterleaveUvBitDepth));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::HA)
+            result = result && DeinterleaveUvBitDepthAutoTest(FUNC_DBD(Simd::Avx2::DeinterleaveUvBitDepth), FUNC_DBD(SimdDeinterleaveUvBitDepth));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::HA)
+            result = result && DeinterleaveUvBitDepthAutoTest(FUNC_DBD(Simd::Avx512bw::DeinterleaveUvBitDepth), FUNC_DBD(SimdDeinterleaveUvBitDepth));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::HA)
+            result = result && DeinterleaveUvBitDepthAutoTest(FUNC_DBD(Simd::Neon::DeinterleaveUvBitDepth), FUNC_DBD(SimdDeinterleaveUvBitDepth));
+#endif 
+
+        return result;
+    }
+
+    namespace
+    {
+        struct FuncYuv16
+        {
+            typedef void(*FuncBgrPtr)(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                size_t width, size_t height, size_t bitDepth, uint8_t * bgr, size_t bgrStride, SimdBool dither, SimdYuvType yuvType, uint8_t * buffer);
+            typedef void(*FuncBgraPtr)(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                size_t width, size_t height, size_t bitDepth, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdBool dither, SimdYuvType yuvType, uint8_t * buffer);
+
+            FuncBgrPtr funcBgr;
+            FuncBgraPtr funcBgra;
+            String description;
+            size_t bitDepth;
+            SimdBool dither;
+            SimdYuvType yuvType;
+
+            FuncYuv16(const FuncBgrPtr & f, const String & d) : funcBgr(f), funcBgra(NULL), description(d), bitDepth(10), dither(SimdFalse), yuvType(SimdYuvBt601) {}
+            FuncYuv16(const FuncBgraPtr & f, const String & d) : funcBgr(NULL), funcBgra(f), description(d), bitDepth(10), dither(SimdFalse), yuvType(SimdYuvBt601) {}
+
+            void Update(size_t b, SimdBool d, SimdYuvType t)
+            {
+                bitDepth = b;
+                dither = d;
+                yuvType = t;
+                description = description + "[" + ToString(b) + "-" + ToString(d) + "-" + ToString(t) + "]";
+            }
+
+            void Call(const View & y, const View & u, const View & v, View & dst, uint8_t * buffer) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                if (funcBgra)
+                    funcBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bitDepth, dst.data, dst.stride, 0xFF, dither, yuvType, buffer);
+                else
+                    funcBgr(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bitDepth, dst.data, dst.stride, dither, yuvType, buffer);
+            }
+        };
+    }
+
+#define FUNC_YUV16(function) FuncYuv16(function, #function)
+
+    bool Yuv420p16ToBgrAutoTest(int width, int height, View::Format format, size_t bitDepth, SimdBool dither, SimdYuvType yuvType, FuncYuv16 f1, FuncYuv16 f2)
+    {
+        bool result = true;
+
+        f1.Update(bitDepth, dither, yuvType);
+        f2.Update(bitDepth, dither, yuvType);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View y(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom16u(y, bitDepth);
+        View u(width / 2, height / 2, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom16u(u, bitDepth);
+        View v(width / 2, height / 2, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom16u(v, bitDepth);
+
+        View dst1(width, height, format, NULL, TEST_ALIGN(width));
+        View dst2(width, height, format, NULL, TEST_ALIGN(width));
+
+        std::vector<uint8_t> buffer(SimdYuv16BufferSize(width) + 1);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, u, v, dst1, NULL));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, u, v, dst2, buffer.data() + 1));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool Yuv420p16ToBgrAutoTest(View::Format format, const FuncYuv16 & f1, const FuncYuv16 & f2)
+    {
+        bool result = true;
+
+        result = result && Yuv420p16ToBgrAutoTest(W, H, format, 10, SimdFalse, SimdYuvBt601, f1, f2);
+        result = result && Yuv420p16ToBgrAutoTest(W + O * 2, H - O * 2, format, 12, SimdTrue, SimdYuvBt709, f1, f2);
+        result = result && Yuv420p16ToBgrAutoTest(W - O * 2, H + O * 2, format, 16, SimdTrue, SimdYuvBt2020, f1, f2);
+
+        return result;
+    }
+
+    bool Yuv420p16ToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && Yuv420p16ToBgrAutoTest(View::Bgr24, FUNC_YUV16(Simd::Base::Yuv420p16ToBgr), FUNC_YUV16(SimdYuv420p16ToBgr));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && Yuv420p16ToBgrAutoTest(View::Bgr24, FUNC_YUV16(Simd::Avx2::Yuv420p16ToBgr), FUNC_YUV16(SimdYuv420p16ToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Yuv420p16ToBgrAutoTest(View::Bgr24, FUNC_YUV16(Simd::Avx512bw::Yuv420p16ToBgr), FUNC_YUV16(SimdYuv420p16ToBgr));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && Yuv420p16ToBgrAutoTest(View::Bgr24, FUNC_YUV16(Simd::Neon::Yuv420p16ToBgr), FUNC_YUV16(SimdYuv420p16ToBgr));
+#endif 
+
+        return result;
+    }
+
+    bool Yuv420p16ToBgraAutoTest()
+    {
+        bool result = true;
+
+        result = result && Yuv420p16ToBgrAutoTest(View::Bgra32, FUNC_YUV16(Simd::Base::Yuv420p16ToBgra), FUNC_YUV16(SimdYuv420p16ToBgra));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && Yuv420p16ToBgrAutoTest(View::Bgra32, FUNC_YUV16(Simd::Sse2::Yuv420p16ToBgra), FUNC_YUV16(SimdYuv420p16ToBgra));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && Yuv420p16ToBgrAutoTest(View::Bgra32, FUNC_YUV16(Simd::Avx2::Yuv420p16ToBgra), FUNC_YUV16(SimdYuv420p16ToBgra));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Yuv420p16ToBgrAutoTest(View::Bgra32, FUNC_YUV16(Simd::Avx512bw::Yuv420p16ToBgra), FUNC_YUV16(SimdYuv420p16ToBgra));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && Yuv420p16ToBgrAutoTest(View::Bgra32, FUNC_YUV16(Simd::Neon::Yuv420p16ToBgra), FUNC_YUV16(SimdYuv420p16ToBgra));
+#endif 
+
+        return result;
+    }
+
+    namespace
+    {
+        struct FuncP016
+        {
+            typedef void(*FuncBgrPtr)(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+                size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdBool dither, SimdYuvType yuvType, uint8_t * buffer);
+            typedef void(*FuncBgraPtr)(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+                size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdBool dither, SimdYuvType yuvType, uint8_t * buffer);
+
+            FuncBgrPtr funcBgr;
+            FuncBgraPtr funcBgra;
+            String description;
+            SimdBool dither;
+            SimdYuvType yuvType;
+
+            FuncP016(const FuncBgrPtr & f, const String & d) : funcBgr(f), funcBgra(NULL), description(d), dither(SimdFalse), yuvType(SimdYuvBt601) {}
+            FuncP016(const FuncBgraPtr & f, const String & d) : funcBgr(NULL), funcBgra(f), description(d), dither(SimdFalse), yuvType(SimdYuvBt601) {}
+
+            void Update(SimdBool d, SimdYuvType t)
+            {
+                dither = d;
+                yuvType = t;
+                description = description + "[" + ToString(d) + "-" + ToString(t) + "]";
+            }
+
+            void Call(const View & y, const View & uv, View & dst, uint8_t * buffer) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                if (funcBgra)
+                    funcBgra(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst.data, dst.stride, 0xFF, dither, yuvType, buffer);
+                else
+                    funcBgr(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst.data, dst.stride, dither, yuvType, buffer);
+            }
+        };
+    }
+
+#define FUNC_P016(function) FuncP016(function, #function)
+
+    bool P016ToBgrAutoTest(int width, int height, View::Format format, SimdBool dither, SimdYuvType yuvType, FuncP016 f1, FuncP016 f2)
+    {
+        bool result = true;
+
+        f1.Update(dither, yuvType);
+        f2.Update(dither, yuvType);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View y(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom16u(y, 16);
+        View uv(width / 2, height / 2, View::Uv32, NULL, TEST_ALIGN(width));
+        FillRandom16u(uv, 16);
+
+        View dst1(width, height, format, NULL, TEST_ALIGN(width));
+        View dst2(width, height, format, NULL, TEST_ALIGN(width));
+
+        std::vector<uint8_t> buffer(SimdYuv16BufferSize(width) + 1);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, uv, dst1, NULL));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, uv, dst2, buffer.data() + 1));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool P016ToBgrAutoTest(View::Format format, const FuncP016 & f1, const FuncP016 & f2)
+    {
+        bool result = true;
+
+        result = result && P016ToBgrAutoTest(W, H, format, SimdFalse, SimdYuvBt601, f1, f2);
+        result = result && P016ToBgrAutoTest(W + O * 2, H - O * 2, format, SimdTrue, SimdYuvBt709, f1, f2);
+        result = result && P016ToBgrAutoTest(W - O * 2, H + O * 2, format, SimdTrue, SimdYuvBt2020, f1, f2);
+
+        return result;
+    }
+
+    bool P016ToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && P016ToBgrAutoTest(View::Bgr24, FUNC_P016(Simd::Base::P016ToBgr), FUNC_P016(SimdP016ToBgr));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && P016ToBgrAutoTest(View::Bgr24, FUNC_P016(Simd::Avx2::P016ToBgr), FUNC_P016(SimdP016ToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && P016ToBgrAutoTest(View::Bgr24, FUNC_P016(Simd::Avx512bw::P016ToBgr), FUNC_P016(SimdP016ToBgr));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && P016ToBgrAutoTest(View::Bgr24, FUNC_P016(Simd::Neon::P016ToBgr), FUNC_P016(SimdP016ToBgr));
+#endif 
+
+        return result;
+    }
+
+    bool P016ToBgraAutoTest()
+    {
+        bool result = true;
+
+        result = result && P016ToBgrAutoTest(View::Bgra32, FUNC_P016(Simd::Base::P016ToBgra), FUNC_P016(SimdP016ToBgra));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && P016ToBgrAutoTest(View::Bgra32, FUNC_P016(Simd::Sse2::P016ToBgra), FUNC_P016(SimdP016ToBgra));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && P016ToBgrAutoTest(View::Bgra32, FUNC_P016(Simd::Avx2::P016ToBgra), FUNC_P016(SimdP016ToBgra));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && P016ToBgrAutoTest(View::Bgra32, FUNC_P016(Simd::Avx512bw::P016ToBgra), FUNC_P016(SimdP016ToBgra));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && P016ToBgrAutoTest(View::Bgra32, FUNC_P016(Simd::Neon::P016ToBgra), FUNC_P016(SimdP016ToBgra));
+#endif 
+
+        return result;
+    }
+}
@@ -33,21 +33,30 @@ namespace Test
         {
             typedef void(*FuncPtr)(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                 size_t width, size_t height, uint8_t * dst, size_t dstStride);
+            typedef void(*FuncV2Ptr)(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                size_t width, size_t height, uint8_t * dst, size_t dstStride, SimdYuvType yuvType);
 
             FuncPtr func;
+            FuncV2Ptr funcV2;
+            SimdYuvType yuvType;
             String description;
 
-            Func(const FuncPtr & f, const String & d) : func(f), description(d) {}
+            Func(const FuncPtr & f, const String & d) : func(f), funcV2(NULL), yuvType(SimdYuvBt601), description(d) {}
+            Func(const FuncV2Ptr & f, const String & d, SimdYuvType t) : func(NULL), funcV2(f), yuvType(t), description(d + "<" + ToString(t) + ">") {}
 
             void Call(const View & y, const View & u, const View & v, View & dst) const
             {
                 TEST_PERFORMANCE_TEST(description);
-                func(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, dst.data, dst.stride);
+                if (funcV2)
+                    funcV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, dst.data, dst.stride, yuvType);
+                else
+                    func(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, dst.data, dst.stride);
             }
         };
     }
 
 #define FUNC(function) Func(function, #function)
+#define FUNC_V2(function, yuvType) Func(function, #function, yuvType)
 
     bool YuvToAnyAutoTest(int width, int height, int dx, int dy, View::Format dstType, const Func & f1, const Func & f2, int maxDifference)
     {
@@ -122,6 +131,69 @@ namespace Test
         return result;
     }
 
+    bool Yuv444pToRgbAutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyAutoTest(1, 1, View::Rgb24, FUNC(Simd::Base::Yuv444pToRgb), FUNC(SimdYuv444pToRgb));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable)
+            result = result && YuvToAnyAutoTest(1, 1, View::Rgb24, FUNC(Simd::Ssse3::Yuv444pToRgb), FUNC(SimdYuv444pToRgb));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && YuvToAnyAutoTest(1, 1, View::Rgb24, FUNC(Simd::Avx2::Yuv444pToRgb), FUNC(SimdYuv444pToRgb));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToAnyAutoTest(1, 1, View::Rgb24, FUNC(Simd::Avx512bw::Yuv444pToRgb), FUNC(SimdYuv444pToRgb));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && YuvToAnyAutoTest(1, 1, View::Rgb24, FUNC(Simd::Neon::Yuv444pToRgb), FUNC(SimdYuv444pToRgb));
+#endif
+
+        return result;
+    }
+
+    bool Yuv444pToBgrV2AutoTest()
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            SimdYuvType yuvType = (SimdYuvType)type;
+
+            result = result && YuvToAnyAutoTest(1, 1, View::Bgr24, FUNC_V2(Simd::Base::Yuv444pToBgrV2, yuvType), FUNC_V2(SimdYuv444pToBgrV2, yuvType));
+
+#ifdef SIMD_SSSE3_ENABLE
+            if (Simd::Ssse3::Enable)
+                result = result && YuvToAnyAutoTest(1, 1, View::Bgr24, FUNC_V2(Simd::Ssse3::Yuv444pToBgrV2, yuvType), FUNC_V2(SimdYuv444pToBgrV2, yuvType));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable)
+                result = result && YuvToAnyAutoTest(1, 1, View::Bgr24, FUNC_V2(Simd::Avx2::Yuv444pToBgrV2, yuvType), FUNC_V2(SimdYuv444pToBgrV2, yuvType));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && YuvToAnyAutoTest(1, 1, View::Bgr24, FUNC_V2(Simd::Avx512bw::Yuv444pToBgrV2, yuvType), FUNC_V2(SimdYuv444pToBgrV2, yuvType));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+            if (Simd::Neon::Enable)
+                result = result && YuvToAnyAutoTest(1, 1, View::Bgr24, FUNC_V2(Simd::Neon::Yuv444pToBgrV2, yuvType), FUNC_V2(SimdYuv444pToBgrV2, yuvType));
+#endif
+        }
+
+        return result;
+    }
+
     bool Yuv422pToBgrAutoTest()
     {
         bool result = true;
@@ -156,6 +228,69 @@ namespace Test
         return result;
     }
 
+    bool Yuv422pToRgbAutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyAutoTest(2, 1, View::Rgb24, FUNC(Simd::Base::Yuv422pToRgb), FUNC(SimdYuv422pToRgb));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable)
+            result = result && YuvToAnyAutoTest(2, 1, View::Rgb24, FUNC(Simd::Ssse3::Yuv422pToRgb), FUNC(SimdYuv422pToRgb));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && YuvToAnyAutoTest(2, 1, View::Rgb24, FUNC(Simd::Avx2::Yuv422pToRgb), FUNC(SimdYuv422pToRgb));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToAnyAutoTest(2, 1, View::Rgb24, FUNC(Simd::Avx512bw::Yuv422pToRgb), FUNC(SimdYuv422pToRgb));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && YuvToAnyAutoTest(2, 1, View::Rgb24, FUNC(Simd::Neon::Yuv422pToRgb), FUNC(SimdYuv422pToRgb));
+#endif
+
+        return result;
+    }
+
+    bool Yuv422pToBgrV2AutoTest()
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            SimdYuvType yuvType = (SimdYuvType)type;
+
+            result = result && YuvToAnyAutoTest(2, 1, View::Bgr24, FUNC_V2(Simd::Base::Yuv422pToBgrV2, yuvType), FUNC_V2(SimdYuv422pToBgrV2, yuvType));
+
+#ifdef SIMD_SSSE3_ENABLE
+            if (Simd::Ssse3::Enable)
+                result = result && YuvToAnyAutoTest(2, 1, View::Bgr24, FUNC_V2(Simd::Ssse3::Yuv422pToBgrV2, yuvType), FUNC_V2(SimdYuv422pToBgrV2, yuvType));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable)
+                result = result && YuvToAnyAutoTest(2, 1, View::Bgr24, FUNC_V2(Simd::Avx2::Yuv422pToBgrV2, yuvType), FUNC_V2(SimdYuv422pToBgrV2, yuvType));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && YuvToAnyAutoTest(2, 1, View::Bgr24, FUNC_V2(Simd::Avx512bw::Yuv422pToBgrV2, yuvType), FUNC_V2(SimdYuv422pToBgrV2, yuvType));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+            if (Simd::Neon::Enable)
+                result = result && YuvToAnyAutoTest(2, 1, View::Bgr24, FUNC_V2(Simd::Neon::Yuv422pToBgrV2, yuvType), FUNC_V2(SimdYuv422pToBgrV2, yuvType));
+#endif
+        }
+
+        return result;
+    }
+
     bool Yuv420pToBgrAutoTest()
     {
         bool result = true;
@@ -190,6 +325,69 @@ namespace Test
         return result;
     }
 
+    bool Yuv420pToRgbAutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyAutoTest(2, 2, View::Rgb24, FUNC(Simd::Base::Yuv420pToRgb), FUNC(SimdYuv420pToRgb));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable)
+            result = result && YuvToAnyAutoTest(2, 2, View::Rgb24, FUNC(Simd::Ssse3::Yuv420pToRgb), FUNC(SimdYuv420pToRgb));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && YuvToAnyAutoTest(2, 2, View::Rgb24, FUNC(Simd::Avx2::Yuv420pToRgb), FUNC(SimdYuv420pToRgb));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToAnyAutoTest(2, 2, View::Rgb24, FUNC(Simd::Avx512bw::Yuv420pToRgb), FUNC(SimdYuv420pToRgb));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && YuvToAnyAutoTest(2, 2, View::Rgb24, FUNC(Simd::Neon::Yuv420pToRgb), FUNC(SimdYuv420pToRgb));
+#endif
+
+        return result;
+    }
+
+    bool Yuv420pToBgrV2AutoTest()
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            SimdYuvType yuvType = (SimdYuvType)type;
+
+            result = result && YuvToAnyAutoTest(2, 2, View::Bgr24, FUNC_V2(Simd::Base::Yuv420pToBgrV2, yuvType), FUNC_V2(SimdYuv420pToBgrV2, yuvType));
+
+#ifdef SIMD_SSSE3_ENABLE
+            if (Simd::Ssse3::Enable)
+                result = result && YuvToAnyAutoTest(2, 2, View::Bgr24, FUNC_V2(Simd::Ssse3::Yuv420pToBgrV2, yuvType), FUNC_V2(SimdYuv420pToBgrV2, yuvType));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable)
+                result = result && YuvToAnyAutoTest(2, 2, View::Bgr24, FUNC_V2(Simd::Avx2::Yuv420pToBgrV2, yuvType), FUNC_V2(SimdYuv420pToBgrV2, yuvType));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && YuvToAnyAutoTest(2, 2, View::Bgr24, FUNC_V2(Simd::Avx512bw::Yuv420pToBgrV2, yuvType), FUNC_V2(SimdYuv420pToBgrV2, yuvType));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+            if (Simd::Neon::Enable)
+                result = result && YuvToAnyAutoTest(2, 2, View::Bgr24, FUNC_V2(Simd::Neon::Yuv420pToBgrV2, yuvType), FUNC_V2(SimdYuv420pToBgrV2, yuvType));
+#endif
+        }
+
+        return result;
+    }
+
     bool Yuv444pToHslAutoTest()
     {
         bool result = true;
@@ -199,6 +397,40 @@ namespace Test
         return result;
     }
 
+    bool Yuv444pToHslV2AutoTest()
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            SimdYuvType yuvType = (SimdYuvType)type;
+
+            result = result && YuvToAnyAutoTest(1, 1, View::Hsl24, FUNC_V2(Simd::Base::Yuv444pToHslV2, yuvType), FUNC_V2(SimdYuv444pToHslV2, yuvType));
+
+#ifdef SIMD_SSE41_ENABLE
+            if (Simd::Sse41::Enable)
+                result = result && YuvToAnyAutoTest(1, 1, View::Hsl24, FUNC_V2(Simd::Sse41::Yuv444pToHslV2, yuvType), FUNC_V2(SimdYuv444pToHslV2, yuvType));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable)
+                result = result && YuvToAnyAutoTest(1, 1, View::Hsl24, FUNC_V2(Simd::Avx2::Yuv444pToHslV2, yuvType), FUNC_V2(SimdYuv444pToHslV2, yuvType));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && YuvToAnyAutoTest(1, 1, View::Hsl24, FUNC_V2(Simd::Avx512bw::Yuv444pToHslV2, yuvType), FUNC_V2(SimdYuv444pToHslV2, yuvType));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+            if (Simd::Neon::Enable)
+                result = result && YuvToAnyAutoTest(1, 1, View::Hsl24, FUNC_V2(Simd::Neon::Yuv444pToHslV2, yuvType), FUNC_V2(SimdYuv444pToHslV2, yuvType));
+#endif
+        }
+
+        return result;
+    }
+
     bool Yuv444pToHsvAutoTest()
     {
         bool result = true;
@@ -208,6 +440,40 @@ namespace Test
         return result;
     }
 
+    bool Yuv444pToHsvV2AutoTest()
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            SimdYuvType yuvType = (SimdYuvType)type;
+
+            result = result && YuvToAnyAutoTest(1, 1, View::Hsv24, FUNC_V2(Simd::Base::Yuv444pToHsvV2, yuvType), FUNC_V2(SimdYuv444pToHsvV2, yuvType));
+
+#ifdef SIMD_SSE41_ENABLE
+            if (Simd::Sse41::Enable)
+                result = result && YuvToAnyAutoTest(1, 1, View::Hsv24, FUNC_V2(Simd::Sse41::Yuv444pToHsvV2, yuvType), FUNC_V2(SimdYuv444pToHsvV2, yuvType));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable)
+                result = result && YuvToAnyAutoTest(1, 1, View::Hsv24, FUNC_V2(Simd::Avx2::Yuv444pToHsvV2, yuvType), FUNC_V2(SimdYuv444pToHsvV2, yuvType));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && YuvToAnyAutoTest(1, 1, View::Hsv24, FUNC_V2(Simd::Avx512bw::Yuv444pToHsvV2, yuvType), FUNC_V2(SimdYuv444pToHsvV2, yuvType));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+            if (Simd::Neon::Enable)
+                result = result && YuvToAnyAutoTest(1, 1, View::Hsv24, FUNC_V2(Simd::Neon::Yuv444pToHsvV2, yuvType), FUNC_V2(SimdYuv444pToHsvV2, yuvType));
+#endif
+        }
+
+        return result;
+    }
+
 #if defined(SIMD_NEON_ENABLE) && (SIMD_NEON_RCP_ITER > -1)
     const int MAX_DIFFERECE = 1;
 #else
@@ -248,6 +514,40 @@ namespace Test
         return result;
     }
 
+    bool Yuv444pToHueV2AutoTest()
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            SimdYuvType yuvType = (SimdYuvType)type;
+
+            result = result && YuvToAnyAutoTest(1, 1, View::Gray8, FUNC_V2(Simd::Base::Yuv444pToHueV2, yuvType), FUNC_V2(SimdYuv444pToHueV2, yuvType), MAX_DIFFERECE);
+
+#ifdef SIMD_SSE2_ENABLE
+            if (Simd::Sse2::Enable)
+                result = result && YuvToAnyAutoTest(1, 1, View::Gray8, FUNC_V2(Simd::Sse2::Yuv444pToHueV2, yuvType), FUNC_V2(SimdYuv444pToHueV2, yuvType));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable)
+                result = result && YuvToAnyAutoTest(1, 1, View::Gray8, FUNC_V2(Simd::Avx2::Yuv444pToHueV2, yuvType), FUNC_V2(SimdYuv444pToHueV2, yuvType));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && YuvToAnyAutoTest(1, 1, View::Gray8, FUNC_V2(Simd::Avx512bw::Yuv444pToHueV2, yuvType), FUNC_V2(SimdYuv444pToHueV2, yuvType));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+            if (Simd::Neon::Enable)
+                result = result && YuvToAnyAutoTest(1, 1, View::Gray8, FUNC_V2(Simd::Neon::Yuv444pToHueV2, yuvType), FUNC_V2(SimdYuv444pToHueV2, yuvType), MAX_DIFFERECE);
+#endif
+        }
+
+        return result;
+    }
+
     bool Yuv420pToHueAutoTest()
     {
         bool result = true;
@@ -282,6 +582,517 @@ namespace Test
         return result;
     }
 
+    bool Yuv420pToHueV2AutoTest()
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            SimdYuvType yuvType = (SimdYuvType)type;
+
+            result = result && YuvToAnyAutoTest(2, 2, View::Gray8, FUNC_V2(Simd::Base::Yuv420pToHueV2, yuvType), FUNC_V2(SimdYuv420pToHueV2, yuvType), MAX_DIFFERECE);
+
+#ifdef SIMD_SSE2_ENABLE
+            if (Simd::Sse2::Enable)
+                result = result && YuvToAnyAutoTest(2, 2, View::Gray8, FUNC_V2(Simd::Sse2::Yuv420pToHueV2, yuvType), FUNC_V2(SimdYuv420pToHueV2, yuvType));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable)
+                result = result && YuvToAnyAutoTest(2, 2, View::Gray8, FUNC_V2(Simd::Avx2::Yuv420pToHueV2, yuvType), FUNC_V2(SimdYuv420pToHueV2, yuvType));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && YuvToAnyAutoTest(2, 2, View::Gray8, FUNC_V2(Simd::Avx512bw::Yuv420pToHueV2, yuvType), FUNC_V2(SimdYuv420pToHueV2, yuvType));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+            if (Simd::Neon::Enable)
+                result = result && YuvToAnyAutoTest(2, 2, View::Gray8, FUNC_V2(Simd::Neon::Yuv420pToHueV2, yuvType), FUNC_V2(SimdYuv420pToHueV2, yuvType), MAX_DIFFERECE);
+#endif
+        }
+
+        return result;
+    }
+
+    namespace
+    {
+        struct FuncNv
+        {
+            typedef void(*FuncPtr)(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+                size_t width, size_t height, uint8_t * dst, size_t dstStride);
+            typedef void(*FuncV2Ptr)(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+                size_t width, size_t height, uint8_t * dst, size_t dstStride, SimdYuvType yuvType);
+
+            FuncPtr func;
+            FuncV2Ptr funcV2;
+            SimdYuvType yuvType;
+            String description;
+
+            FuncNv(const FuncPtr & f, const String & d) : func(f), funcV2(NULL), yuvType(SimdYuvBt601), description(d) {}
+            FuncNv(const FuncV2Ptr & f, const String & d, SimdYuvType t) : func(NULL), funcV2(f), yuvType(t), description(d + "<" + ToString(t) + ">") {}
+
+            void Call(const View & y, const View & uv, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                if (funcV2)
+                    funcV2(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst.data, dst.stride, yuvType);
+                else
+                    func(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_NV(function) FuncNv(function, #function)
+#define FUNC_NV_V2(function, yuvType) FuncNv(function, #function, yuvType)
+
+    bool NvToAnyAutoTest(int width, int height, View::Format dstType, const FuncNv & f1, const FuncNv & f2, int maxDifference)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View y(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(y);
+        View uv(width / 2, height / 2, View::Uv16, NULL, TEST_ALIGN(width));
+        FillRandom(uv);
+
+        View dst1(width, height, dstType, NULL, TEST_ALIGN(width));
+        View dst2(width, height, dstType, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, uv, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, uv, dst2));
+
+        result = result && Compare(dst1, dst2, maxDifference, true, 64, 255);
+
+        return result;
+    }
+
+    bool NvToAnyAutoTest(View::Format dstType, const FuncNv & f1, const FuncNv & f2, int maxDifference = 0)
+    {
+        bool result = true;
+
+        result = result && NvToAnyAutoTest(W, H, dstType, f1, f2, maxDifference);
+        result = result && NvToAnyAutoTest(W + O * 2, H - O * 2, dstType, f1, f2, maxDifference);
+        result = result && NvToAnyAutoTest(W - O * 2, H + O * 2, dstType, f1, f2, maxDifference);
+
+        return result;
+    }
+
+    bool Nv12ToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV(Simd::Base::Nv12ToBgr), FUNC_NV(SimdNv12ToBgr));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable)
+            result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV(Simd::Ssse3::Nv12ToBgr), FUNC_NV(SimdNv12ToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV(Simd::Avx2::Nv12ToBgr), FUNC_NV(SimdNv12ToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV(Simd::Avx512bw::Nv12ToBgr), FUNC_NV(SimdNv12ToBgr));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV(Simd::Neon::Nv12ToBgr), FUNC_NV(SimdNv12ToBgr));
+#endif 
+
+        return result;
+    }
+
+    bool Nv12ToBgrV2AutoTest()
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            SimdYuvType yuvType = (SimdYuvType)type;
+
+            result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV_V2(Simd::Base::Nv12ToBgrV2, yuvType), FUNC_NV_V2(SimdNv12ToBgrV2, yuvType));
+
+#ifdef SIMD_SSSE3_ENABLE
+            if (Simd::Ssse3::Enable)
+                result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV_V2(Simd::Ssse3::Nv12ToBgrV2, yuvType), FUNC_NV_V2(SimdNv12ToBgrV2, yuvType));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable)
+                result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV_V2(Simd::Avx2::Nv12ToBgrV2, yuvType), FUNC_NV_V2(SimdNv12ToBgrV2, yuvType));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV_V2(Simd::Avx512bw::Nv12ToBgrV2, yuvType), FUNC_NV_V2(SimdNv12ToBgrV2, yuvType));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+            if (Simd::Neon::Enable)
+                result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV_V2(Simd::Neon::Nv12ToBgrV2, yuvType), FUNC_NV_V2(SimdNv12ToBgrV2, yuvType));
+#endif
+        }
+
+        return result;
+    }
+
+    bool Nv21ToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV(Simd::Base::Nv21ToBgr), FUNC_NV(SimdNv21ToBgr));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable)
+            result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV(Simd::Ssse3::Nv21ToBgr), FUNC_NV(SimdNv21ToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV(Simd::Avx2::Nv21ToBgr), FUNC_NV(SimdNv21ToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV(Simd::Avx512bw::Nv21ToBgr), FUNC_NV(SimdNv21ToBgr));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV(Simd::Neon::Nv21ToBgr), FUNC_NV(SimdNv21ToBgr));
+#endif 
+
+        return result;
+    }
+
+    bool Nv21ToBgrV2AutoTest()
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            SimdYuvType yuvType = (SimdYuvType)type;
+
+            result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV_V2(Simd::Base::Nv21ToBgrV2, yuvType), FUNC_NV_V2(SimdNv21ToBgrV2, yuvType));
+
+#ifdef SIMD_SSSE3_ENABLE
+            if (Simd::Ssse3::Enable)
+                result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV_V2(Simd::Ssse3::Nv21ToBgrV2, yuvType), FUNC_NV_V2(SimdNv21ToBgrV2, yuvType));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable)
+                result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV_V2(Simd::Avx2::Nv21ToBgrV2, yuvType), FUNC_NV_V2(SimdNv21ToBgrV2, yuvType));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV_V2(Simd::Avx512bw::Nv21ToBgrV2, yuvType), FUNC_NV_V2(SimdNv21ToBgrV2, yuvType));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+            if (Simd::Neon::Enable)
+                result = result && NvToAnyAutoTest(View::Bgr24, FUNC_NV_V2(Simd::Neon::Nv21ToBgrV2, yuvType), FUNC_NV_V2(SimdNv21ToBgrV2, yuvType));
+#endif
+        }
+
+        return result;
+    }
+
+    bool Nv12ToHueAutoTest()
+    {
+        bool result = true;
+
+        result = result && NvToAnyAutoTest(View::Gray8, FUNC_NV(Simd::Base::Nv12ToHue), FUNC_NV(SimdNv12ToHue), MAX_DIFFERECE);
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && NvToAnyAutoTest(View::Gray8, FUNC_NV(Simd::Sse2::Nv12ToHue), FUNC_NV(SimdNv12ToHue));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && NvToAnyAutoTest(View::Gray8, FUNC_NV(Simd::Avx2::Nv12ToHue), FUNC_NV(SimdNv12ToHue));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && NvToAnyAutoTest(View::Gray8, FUNC_NV(Simd::Avx512bw::Nv12ToHue), FUNC_NV(SimdNv12ToHue));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && NvToAnyAutoTest(View::Gray8, FUNC_NV(Simd::Neon::Nv12ToHue), FUNC_NV(SimdNv12ToHue), MAX_DIFFERECE);
+#endif 
+
+        return result;
+    }
+
+    bool Nv12ToHueV2AutoTest()
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            SimdYuvType yuvType = (SimdYuvType)type;
+
+            result = result && NvToAnyAutoTest(View::Gray8, FUNC_NV_V2(Simd::Base::Nv12ToHueV2, yuvType), FUNC_NV_V2(SimdNv12ToHueV2, yuvType), MAX_DIFFERECE);
+
+#ifdef SIMD_SSE2_ENABLE
+            if (Simd::Sse2::Enable)
+                result = result && NvToAnyAutoTest(View::Gray8, FUNC_NV_V2(Simd::Sse2::Nv12ToHueV2, yuvType), FUNC_NV_V2(SimdNv12ToHueV2, yuvType));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable)
+                result = result && NvToAnyAutoTest(View::Gray8, FUNC_NV_V2(Simd::Avx2::Nv12ToHueV2, yuvType), FUNC_NV_V2(SimdNv12ToHueV2, yuvType));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && NvToAnyAutoTest(View::Gray8, FUNC_NV_V2(Simd::Avx512bw::Nv12ToHueV2, yuvType), FUNC_NV_V2(SimdNv12ToHueV2, yuvType));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+            if (Simd::Neon::Enable)
+                result = result && NvToAnyAutoTest(View::Gray8, FUNC_NV_V2(Simd::Neon::Nv12ToHueV2, yuvType), FUNC_NV_V2(SimdNv12ToHueV2, yuvType), MAX_DIFFERECE);
+#endif
+        }
+
+        return result;
+    }
+
+    bool Nv21ToHueAutoTest()
+    {
+        bool result = true;
+
+        result = result && NvToAnyAutoTest(View::Gray8, FUNC_NV(Simd::Base::Nv21ToHue), FUNC_NV(SimdNv21ToHue), MAX_DIFFERECE);
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && NvToAnyAutoTest(View::Gray8, FUNC_NV(Simd::Sse2::Nv21ToHue), FUNC_NV(SimdNv21ToHue));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && NvToAnyAutoTest(View::Gray8, FUNC_NV(Simd::Avx2::Nv21ToHue), FUNC_NV(SimdNv21ToHue));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && NvToAnyAutoTest(View::Gray8, FUNC_NV(Simd::Avx512bw::Nv21ToHue), FUNC_NV(SimdNv21ToHue));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && NvToAnyAutoTest(View::Gray8, FUNC_NV(Simd::Neon::Nv21ToHue), FUNC_NV(SimdNv21ToHue), MAX_DIFFERECE);
+#endif 
+
+        return result;
+    }
+
+    bool Nv21ToHueV2AutoTest()
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            SimdYuvType yuvType = (SimdYuvType)type;
+
+            result = result && NvToAnyAutoTest(View::Gray8, FUNC_NV_V2(Simd::Base::Nv21ToHueV2, yuvType), FUNC_NV_V2(SimdNv21ToHueV2, yuvType), MAX_DIFFERECE);
+
+#ifdef SIMD_SSE2_ENABLE
+            if (Simd::Sse2::Enable)
+                result = result && NvToAnyAutoTest(View::Gray8, FUNC_NV_V2(Simd::Sse2::Nv21ToHueV2, yuvType), FUNC_NV_V2(SimdNv21ToHueV2, yuvType));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable)
+                result = result && NvToAnyAutoTest(View::Gray8, FUNC_NV_V2(Simd::Avx2::Nv21ToHueV2, yuvType), FUNC_NV_V2(SimdNv21ToHueV2, yuvType));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && NvToAnyAutoTest(View::Gray8, FUNC_NV_V2(Simd::Avx512bw::Nv21ToHueV2, yuvType), FUNC_NV_V2(SimdNv21ToHueV2, yuvType));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+            if (Simd::Neon::Enable)
+                result = result && NvToAnyAutoTest(View::Gray8, FUNC_NV_V2(Simd::Neon::Nv21ToHueV2, yuvType), FUNC_NV_V2(SimdNv21ToHueV2, yuvType), MAX_DIFFERECE);
+#endif
+        }
+
+        return result;
+    }
+
+    namespace
+    {
+        struct YuvSample
+        {
+            uint8_t y, u, v;
+        };
+
+        const YuvSample YUV_SAMPLES[] = { { 16, 128, 128 }, { 235, 128, 128 }, { 81, 90, 240 }, { 145, 54, 34 },
+            { 41, 240, 110 }, { 128, 200, 60 }, { 200, 64, 180 }, { 0, 0, 255 }, { 255, 255, 0 } };
+        const size_t YUV_SAMPLES_SIZE = sizeof(YUV_SAMPLES) / sizeof(YUV_SAMPLES[0]);
+
+        SIMD_INLINE const YuvSample & YuvSampleAt(size_t col)
+        {
+            return YUV_SAMPLES[col / 2 % YUV_SAMPLES_SIZE];
+        }
+
+        void ReferenceYuvToBgr(const YuvSample & yuv, SimdYuvType yuvType, int * bgr)
+        {
+            double kr, kb;
+            bool fullRange;
+            YuvTypeCoefficients(yuvType, kr, kb, fullRange);
+            double y = fullRange ? yuv.y : (yuv.y - 16) * 255.0 / 219.0;
+            double u = fullRange ? yuv.u - 128.0 : (yuv.u - 128) * 255.0 / 224.0;
+            double v = fullRange ? yuv.v - 128.0 : (yuv.v - 128) * 255.0 / 224.0;
+            double b = y + 2.0 * (1.0 - kb) * u;
+            double r = y + 2.0 * (1.0 - kr) * v;
+            double g = (y - kr * r - kb * b) / (1.0 - kr - kb);
+            bgr[0] = RoundAndRestrict(b);
+            bgr[1] = RoundAndRestrict(g);
+            bgr[2] = RoundAndRestrict(r);
+        }
+    }
+
+    const int YUV_REFERENCE_ERROR = 2;
+
+    bool YuvToBgrV2ReferenceCheck(const View & bgr, SimdYuvType yuvType, const String & description)
+    {
+        const size_t channels = bgr.PixelSize();
+        for (size_t row = 0; row < bgr.height; ++row)
+        {
+            const uint8_t * pBgr = bgr.data + row * bgr.stride;
+            for (size_t col = 0; col < bgr.width; ++col, pBgr += channels)
+            {
+                int ref[3];
+                ReferenceYuvToBgr(YuvSampleAt(col), yuvType, ref);
+                if (std::abs(pBgr[0] - ref[0]) > YUV_REFERENCE_ERROR || std::abs(pBgr[1] - ref[1]) > YUV_REFERENCE_ERROR ||
+                    std::abs(pBgr[2] - ref[2]) > YUV_REFERENCE_ERROR)
+                {
+                    TEST_LOG_SS(Error, description << "<" << ToString(yuvType) << "> : pixel [" << col << ", " << row << "] = {"
+                        << (int)pBgr[0] << ", " << (int)pBgr[1] << ", " << (int)pBgr[2] << "}, reference = {"
+                        << ref[0] << ", " << ref[1] << ", " << ref[2] << "}.");
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    bool YuvToBgrV2ReferenceAutoTest(int width, int height, SimdYuvType yuvType)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test YUV to BGR conversions with " << ToString(yuvType) << " matrix against reference values [" << width << ", " << height << "].");
+
+        View y(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View u444(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View v444(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View u420(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+        View v420(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+        View uv(width / 2, height / 2, View::Uv16, NULL, TEST_ALIGN(width));
+        View vu(width / 2, height / 2, View::Uv16, NULL, TEST_ALIGN(width));
+        for (size_t row = 0; row < (size_t)height; ++row)
+        {
+            for (size_t col = 0; col < (size_t)width; ++col)
+            {
+                const YuvSample & s = YuvSampleAt(col);
+                y.At<uint8_t>(col, row) = s.y;
+                u444.At<uint8_t>(col, row) = s.u;
+                v444.At<uint8_t>(col, row) = s.v;
+                if ((row & 1) == 0 && (col & 1) == 0 && row / 2 < uv.height && col / 2 < uv.width)
+                {
+                    u420.At<uint8_t>(col / 2, row / 2) = s.u;
+                    v420.At<uint8_t>(col / 2, row / 2) = s.v;
+                    uint8_t * pUv = uv.data + row / 2 * uv.stride + col;
+                    pUv[0] = s.u;
+                    pUv[1] = s.v;
+                    uint8_t * pVu = vu.data + row / 2 * vu.stride + col;
+                    pVu[0] = s.v;
+                    pVu[1] = s.u;
+                }
+            }
+        }
+
+        View bgr(width, height, View::Bgr24, NULL, TEST_ALIGN(width));
+        View bgra(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+
+        SimdYuv420pToBgrV2(y.data, y.stride, u420.data, u420.stride, v420.data, v420.stride, width, height, bgr.data, bgr.stride, yuvType);
+        result = result && YuvToBgrV2ReferenceCheck(bgr, yuvType, "SimdYuv420pToBgrV2");
+
+        SimdNv12ToBgrV2(y.data, y.stride, uv.data, uv.stride, width, height, bgr.data, bgr.stride, yuvType);
+        result = result && YuvToBgrV2ReferenceCheck(bgr, yuvType, "SimdNv12ToBgrV2");
+
+        SimdNv21ToBgrV2(y.data, y.stride, vu.data, vu.stride, width, height, bgr.data, bgr.stride, yuvType);
+        result = result && YuvToBgrV2ReferenceCheck(bgr, yuvType, "SimdNv21ToBgrV2");
+
+        SimdNv12ToBgraV2(y.data, y.stride, uv.data, uv.stride, width, height, bgra.data, bgra.stride, 0xFF, yuvType);
+        result = result && YuvToBgrV2ReferenceCheck(bgra, yuvType, "SimdNv12ToBgraV2");
+
+        SimdNv21ToBgraV2(y.data, y.stride, vu.data, vu.stride, width, height, bgra.data, bgra.stride, 0xFF, yuvType);
+        result = result && YuvToBgrV2ReferenceCheck(bgra, yuvType, "SimdNv21ToBgraV2");
+
+        SimdYuv444pToBgrV2(y.data, y.stride, u444.data, u444.stride, v444.data, v444.stride, width, height, bgr.data, bgr.stride, yuvType);
+        result = result && YuvToBgrV2ReferenceCheck(bgr, yuvType, "SimdYuv444pToBgrV2");
+
+        View hsl1(width, height, View::Hsl24, NULL, TEST_ALIGN(width));
+        View hsl2(width, height, View::Hsl24, NULL, TEST_ALIGN(width));
+        SimdBgrToHsl(bgr.data, width, height, bgr.stride, hsl1.data, hsl1.stride);
+        SimdYuv444pToHslV2(y.data, y.stride, u444.data, u444.stride, v444.data, v444.stride, width, height, hsl2.data, hsl2.stride, yuvType);
+        result = result && Compare(hsl1, hsl2, 0, true, 64, 0, "SimdYuv444pToHslV2<" + ToString(yuvType) + ">");
+
+        View hsv1(width, height, View::Hsv24, NULL, TEST_ALIGN(width));
+        View hsv2(width, height, View::Hsv24, NULL, TEST_ALIGN(width));
+        SimdBgrToHsv(bgr.data, width, height, bgr.stride, hsv1.data, hsv1.stride);
+        SimdYuv444pToHsvV2(y.data, y.stride, u444.data, u444.stride, v444.data, v444.stride, width, height, hsv2.data, hsv2.stride, yuvType);
+        result = result && Compare(hsv1, hsv2, 0, true, 64, 0, "SimdYuv444pToHsvV2<" + ToString(yuvType) + ">");
+
+        View hue1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View hue2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        for (size_t row = 0; row < (size_t)height; ++row)
+            for (size_t col = 0; col < (size_t)width; ++col)
+                hue1.At<uint8_t>(col, row) = hsv1.data[row * hsv1.stride + col * 3];
+
+        SimdYuv444pToHueV2(y.data, y.stride, u444.data, u444.stride, v444.data, v444.stride, width, height, hue2.data, hue2.stride, yuvType);
+        result = result && Compare(hue1, hue2, MAX_DIFFERECE, true, 64, 255, "SimdYuv444pToHueV2<" + ToString(yuvType) + ">");
+
+        SimdYuv420pToHueV2(y.data, y.stride, u420.data, u420.stride, v420.data, v420.stride, width, height, hue2.data, hue2.stride, yuvType);
+        result = result && Compare(hue1, hue2, MAX_DIFFERECE, true, 64, 255, "SimdYuv420pToHueV2<" + ToString(yuvType) + ">");
+
+        SimdNv12ToHueV2(y.data, y.stride, uv.data, uv.stride, width, height, hue2.data, hue2.stride, yuvType);
+        result = result && Compare(hue1, hue2, MAX_DIFFERECE, true, 64, 255, "SimdNv12ToHueV2<" + ToString(yuvType) + ">");
+
+        SimdNv21ToHueV2(y.data, y.stride, vu.data, vu.stride, width, height, hue2.data, hue2.stride, yuvType);
+        result = result && Compare(hue1, hue2, MAX_DIFFERECE, true, 64, 255, "SimdNv21ToHueV2<" + ToString(yuvType) + ">");
+
+        return result;
+    }
+
+    bool YuvToBgrV2ReferenceAutoTest()
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            result = result && YuvToBgrV2ReferenceAutoTest(W, H, (SimdYuvType)type);
+            result = result && YuvToBgrV2ReferenceAutoTest(W + O * 2, H - O * 2, (SimdYuvType)type);
+        }
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     bool YuvToAnyDataTest(bool create, int width, int height, int dx, int dy, View::Format dstType, const Func & f, int maxDifference = 0)
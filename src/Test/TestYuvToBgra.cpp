@@ -124,21 +124,30 @@ namespace Test
         {
             typedef void(*FuncPtr)(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                 size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+            typedef void(*FuncV2Ptr)(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
 
             FuncPtr func;
+            FuncV2Ptr funcV2;
+            SimdYuvType yuvType;
             String description;
 
-            FuncYuv(const FuncPtr & f, const String & d) : func(f), description(d) {}
+            FuncYuv(const FuncPtr & f, const String & d) : func(f), funcV2(NULL), yuvType(SimdYuvBt601), description(d) {}
+            FuncYuv(const FuncV2Ptr & f, const String & d, SimdYuvType t) : func(NULL), funcV2(f), yuvType(t), description(d + "<" + ToString(t) + ">") {}
 
             void Call(const View & y, const View & u, const View & v, View & bgra) const
             {
                 TEST_PERFORMANCE_TEST(description);
-                func(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, 0xFF);
+                if (funcV2)
+                    funcV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, 0xFF, yuvType);
+                else
+                    func(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, 0xFF);
             }
         };
     }
 
 #define FUNC_YUV(function) FuncYuv(function, #function)
+#define FUNC_YUV_V2(function, yuvType) FuncYuv(function, #function, yuvType)
 
     bool YuvToBgraAutoTest(int width, int height, const FuncYuv & f1, const FuncYuv & f2, int dx, int dy)
     {
@@ -213,6 +222,69 @@ namespace Test
         return result;
     }
 
+    bool Yuv444pToRgbaAutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToBgraAutoTest(FUNC_YUV(Simd::Base::Yuv444pToRgba), FUNC_YUV(SimdYuv444pToRgba), 1, 1);
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && YuvToBgraAutoTest(FUNC_YUV(Simd::Sse2::Yuv444pToRgba), FUNC_YUV(SimdYuv444pToRgba), 1, 1);
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && YuvToBgraAutoTest(FUNC_YUV(Simd::Avx2::Yuv444pToRgba), FUNC_YUV(SimdYuv444pToRgba), 1, 1);
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToBgraAutoTest(FUNC_YUV(Simd::Avx512bw::Yuv444pToRgba), FUNC_YUV(SimdYuv444pToRgba), 1, 1);
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && YuvToBgraAutoTest(FUNC_YUV(Simd::Neon::Yuv444pToRgba), FUNC_YUV(SimdYuv444pToRgba), 1, 1);
+#endif 
+
+        return result;
+    }
+
+    bool Yuv444pToBgraV2AutoTest()
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            SimdYuvType yuvType = (SimdYuvType)type;
+
+            result = result && YuvToBgraAutoTest(FUNC_YUV_V2(Simd::Base::Yuv444pToBgraV2, yuvType), FUNC_YUV_V2(SimdYuv444pToBgraV2, yuvType), 1, 1);
+
+#ifdef SIMD_SSE2_ENABLE
+            if (Simd::Sse2::Enable)
+                result = result && YuvToBgraAutoTest(FUNC_YUV_V2(Simd::Sse2::Yuv444pToBgraV2, yuvType), FUNC_YUV_V2(SimdYuv444pToBgraV2, yuvType), 1, 1);
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable)
+                result = result && YuvToBgraAutoTest(FUNC_YUV_V2(Simd::Avx2::Yuv444pToBgraV2, yuvType), FUNC_YUV_V2(SimdYuv444pToBgraV2, yuvType), 1, 1);
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && YuvToBgraAutoTest(FUNC_YUV_V2(Simd::Avx512bw::Yuv444pToBgraV2, yuvType), FUNC_YUV_V2(SimdYuv444pToBgraV2, yuvType), 1, 1);
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+            if (Simd::Neon::Enable)
+                result = result && YuvToBgraAutoTest(FUNC_YUV_V2(Simd::Neon::Yuv444pToBgraV2, yuvType), FUNC_YUV_V2(SimdYuv444pToBgraV2, yuvType), 1, 1);
+#endif 
+        }
+
+        return result;
+    }
+
     bool Yuv422pToBgraAutoTest()
     {
         bool result = true;
@@ -247,6 +319,69 @@ namespace Test
         return result;
     }
 
+    bool Yuv422pToRgbaAutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToBgraAutoTest(FUNC_YUV(Simd::Base::Yuv422pToRgba), FUNC_YUV(SimdYuv422pToRgba), 2, 1);
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && YuvToBgraAutoTest(FUNC_YUV(Simd::Sse2::Yuv422pToRgba), FUNC_YUV(SimdYuv422pToRgba), 2, 1);
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && YuvToBgraAutoTest(FUNC_YUV(Simd::Avx2::Yuv422pToRgba), FUNC_YUV(SimdYuv422pToRgba), 2, 1);
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToBgraAutoTest(FUNC_YUV(Simd::Avx512bw::Yuv422pToRgba), FUNC_YUV(SimdYuv422pToRgba), 2, 1);
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && YuvToBgraAutoTest(FUNC_YUV(Simd::Neon::Yuv422pToRgba), FUNC_YUV(SimdYuv422pToRgba), 2, 1);
+#endif 
+
+        return result;
+    }
+
+    bool Yuv422pToBgraV2AutoTest()
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            SimdYuvType yuvType = (SimdYuvType)type;
+
+            result = result && YuvToBgraAutoTest(FUNC_YUV_V2(Simd::Base::Yuv422pToBgraV2, yuvType), FUNC_YUV_V2(SimdYuv422pToBgraV2, yuvType), 2, 1);
+
+#ifdef SIMD_SSE2_ENABLE
+            if (Simd::Sse2::Enable)
+                result = result && YuvToBgraAutoTest(FUNC_YUV_V2(Simd::Sse2::Yuv422pToBgraV2, yuvType), FUNC_YUV_V2(SimdYuv422pToBgraV2, yuvType), 2, 1);
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable)
+                result = result && YuvToBgraAutoTest(FUNC_YUV_V2(Simd::Avx2::Yuv422pToBgraV2, yuvType), FUNC_YUV_V2(SimdYuv422pToBgraV2, yuvType), 2, 1);
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && YuvToBgraAutoTest(FUNC_YUV_V2(Simd::Avx512bw::Yuv422pToBgraV2, yuvType), FUNC_YUV_V2(SimdYuv422pToBgraV2, yuvType), 2, 1);
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+            if (Simd::Neon::Enable)
+                result = result && YuvToBgraAutoTest(FUNC_YUV_V2(Simd::Neon::Yuv422pToBgraV2, yuvType), FUNC_YUV_V2(SimdYuv422pToBgraV2, yuvType), 2, 1);
+#endif 
+        }
+
+        return result;
+    }
+
     bool Yuv420pToBgraAutoTest()
     {
         bool result = true;
@@ -281,6 +416,272 @@ namespace Test
         return result;
     }
 
+    bool Yuv420pToRgbaAutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToBgraAutoTest(FUNC_YUV(Simd::Base::Yuv420pToRgba), FUNC_YUV(SimdYuv420pToRgba), 2, 2);
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && YuvToBgraAutoTest(FUNC_YUV(Simd::Sse2::Yuv420pToRgba), FUNC_YUV(SimdYuv420pToRgba), 2, 2);
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && YuvToBgraAutoTest(FUNC_YUV(Simd::Avx2::Yuv420pToRgba), FUNC_YUV(SimdYuv420pToRgba), 2, 2);
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToBgraAutoTest(FUNC_YUV(Simd::Avx512bw::Yuv420pToRgba), FUNC_YUV(SimdYuv420pToRgba), 2, 2);
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && YuvToBgraAutoTest(FUNC_YUV(Simd::Neon::Yuv420pToRgba), FUNC_YUV(SimdYuv420pToRgba), 2, 2);
+#endif 
+
+        return result;
+    }
+
+    bool Yuv420pToBgraV2AutoTest()
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            SimdYuvType yuvType = (SimdYuvType)type;
+
+            result = result && YuvToBgraAutoTest(FUNC_YUV_V2(Simd::Base::Yuv420pToBgraV2, yuvType), FUNC_YUV_V2(SimdYuv420pToBgraV2, yuvType), 2, 2);
+
+#ifdef SIMD_SSE2_ENABLE
+            if (Simd::Sse2::Enable)
+                result = result && YuvToBgraAutoTest(FUNC_YUV_V2(Simd::Sse2::Yuv420pToBgraV2, yuvType), FUNC_YUV_V2(SimdYuv420pToBgraV2, yuvType), 2, 2);
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable)
+                result = result && YuvToBgraAutoTest(FUNC_YUV_V2(Simd::Avx2::Yuv420pToBgraV2, yuvType), FUNC_YUV_V2(SimdYuv420pToBgraV2, yuvType), 2, 2);
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && YuvToBgraAutoTest(FUNC_YUV_V2(Simd::Avx512bw::Yuv420pToBgraV2, yuvType), FUNC_YUV_V2(SimdYuv420pToBgraV2, yuvType), 2, 2);
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+            if (Simd::Neon::Enable)
+                result = result && YuvToBgraAutoTest(FUNC_YUV_V2(Simd::Neon::Yuv420pToBgraV2, yuvType), FUNC_YUV_V2(SimdYuv420pToBgraV2, yuvType), 2, 2);
+#endif 
+        }
+
+        return result;
+    }
+
+    namespace
+    {
+        struct FuncNv
+        {
+            typedef void(*FuncPtr)(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+                size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+            typedef void(*FuncV2Ptr)(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+                size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+            FuncPtr func;
+            FuncV2Ptr funcV2;
+            SimdYuvType yuvType;
+            String description;
+
+            FuncNv(const FuncPtr & f, const String & d) : func(f), funcV2(NULL), yuvType(SimdYuvBt601), description(d) {}
+            FuncNv(const FuncV2Ptr & f, const String & d, SimdYuvType t) : func(NULL), funcV2(f), yuvType(t), description(d + "<" + ToString(t) + ">") {}
+
+            void Call(const View & y, const View & uv, View & bgra, uint8_t alpha) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                if (funcV2)
+                    funcV2(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
+                else
+                    func(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgra.data, bgra.stride, alpha);
+            }
+        };
+    }
+
+#define FUNC_NV(function) FuncNv(function, #function)
+#define FUNC_NV_V2(function, yuvType) FuncNv(function, #function, yuvType)
+
+    bool NvToBgraAutoTest(int width, int height, const FuncNv & f1, const FuncNv & f2, bool nv21)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View y(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(y);
+        View uv(width / 2, height / 2, View::Uv16, NULL, TEST_ALIGN(width));
+        FillRandom(uv);
+
+        View bgra1(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        View bgra2(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, uv, bgra1, 0xFF));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, uv, bgra2, 0xFF));
+
+        result = result && Compare(bgra1, bgra2, 0, true, 64);
+
+        if (result)
+        {
+            View u(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+            View v(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+            SimdDeinterleaveUv(uv.data, uv.stride, uv.width, uv.height, (nv21 ? v : u).data, u.stride, (nv21 ? u : v).data, v.stride);
+            if (f1.funcV2)
+                SimdYuv420pToBgraV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, width, height, bgra2.data, bgra2.stride, 0xFF, f1.yuvType);
+            else
+                SimdYuv420pToBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, width, height, bgra2.data, bgra2.stride, 0xFF);
+            result = result && Compare(bgra1, bgra2, 0, true, 64, 0, "yuv420p");
+        }
+
+        return result;
+    }
+
+    bool NvToBgraAutoTest(const FuncNv & f1, const FuncNv & f2, bool nv21)
+    {
+        bool result = true;
+
+        result = result && NvToBgraAutoTest(W, H, f1, f2, nv21);
+        result = result && NvToBgraAutoTest(W + O * 2, H - O * 2, f1, f2, nv21);
+        result = result && NvToBgraAutoTest(W - O * 2, H + O * 2, f1, f2, nv21);
+
+        return result;
+    }
+
+    bool Nv12ToBgraAutoTest()
+    {
+        bool result = true;
+
+        result = result && NvToBgraAutoTest(FUNC_NV(Simd::Base::Nv12ToBgra), FUNC_NV(SimdNv12ToBgra), false);
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && NvToBgraAutoTest(FUNC_NV(Simd::Sse2::Nv12ToBgra), FUNC_NV(SimdNv12ToBgra), false);
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && NvToBgraAutoTest(FUNC_NV(Simd::Avx2::Nv12ToBgra), FUNC_NV(SimdNv12ToBgra), false);
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && NvToBgraAutoTest(FUNC_NV(Simd::Avx512bw::Nv12ToBgra), FUNC_NV(SimdNv12ToBgra), false);
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && NvToBgraAutoTest(FUNC_NV(Simd::Neon::Nv12ToBgra), FUNC_NV(SimdNv12ToBgra), false);
+#endif 
+
+        return result;
+    }
+
+    bool Nv12ToBgraV2AutoTest()
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            SimdYuvType yuvType = (SimdYuvType)type;
+
+            result = result && NvToBgraAutoTest(FUNC_NV_V2(Simd::Base::Nv12ToBgraV2, yuvType), FUNC_NV_V2(SimdNv12ToBgraV2, yuvType), false);
+
+#ifdef SIMD_SSE2_ENABLE
+            if (Simd::Sse2::Enable)
+                result = result && NvToBgraAutoTest(FUNC_NV_V2(Simd::Sse2::Nv12ToBgraV2, yuvType), FUNC_NV_V2(SimdNv12ToBgraV2, yuvType), false);
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable)
+                result = result && NvToBgraAutoTest(FUNC_NV_V2(Simd::Avx2::Nv12ToBgraV2, yuvType), FUNC_NV_V2(SimdNv12ToBgraV2, yuvType), false);
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && NvToBgraAutoTest(FUNC_NV_V2(Simd::Avx512bw::Nv12ToBgraV2, yuvType), FUNC_NV_V2(SimdNv12ToBgraV2, yuvType), false);
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+            if (Simd::Neon::Enable)
+                result = result && NvToBgraAutoTest(FUNC_NV_V2(Simd::Neon::Nv12ToBgraV2, yuvType), FUNC_NV_V2(SimdNv12ToBgraV2, yuvType), false);
+#endif
+        }
+
+        return result;
+    }
+
+    bool Nv21ToBgraAutoTest()
+    {
+        bool result = true;
+
+        result = result && NvToBgraAutoTest(FUNC_NV(Simd::Base::Nv21ToBgra), FUNC_NV(SimdNv21ToBgra), true);
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && NvToBgraAutoTest(FUNC_NV(Simd::Sse2::Nv21ToBgra), FUNC_NV(SimdNv21ToBgra), true);
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && NvToBgraAutoTest(FUNC_NV(Simd::Avx2::Nv21ToBgra), FUNC_NV(SimdNv21ToBgra), true);
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && NvToBgraAutoTest(FUNC_NV(Simd::Avx512bw::Nv21ToBgra), FUNC_NV(SimdNv21ToBgra), true);
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && NvToBgraAutoTest(FUNC_NV(Simd::Neon::Nv21ToBgra), FUNC_NV(SimdNv21ToBgra), true);
+#endif 
+
+        return result;
+    }
+
+    bool Nv21ToBgraV2AutoTest()
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            SimdYuvType yuvType = (SimdYuvType)type;
+
+            result = result && NvToBgraAutoTest(FUNC_NV_V2(Simd::Base::Nv21ToBgraV2, yuvType), FUNC_NV_V2(SimdNv21ToBgraV2, yuvType), true);
+
+#ifdef SIMD_SSE2_ENABLE
+            if (Simd::Sse2::Enable)
+                result = result && NvToBgraAutoTest(FUNC_NV_V2(Simd::Sse2::Nv21ToBgraV2, yuvType), FUNC_NV_V2(SimdNv21ToBgraV2, yuvType), true);
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable)
+                result = result && NvToBgraAutoTest(FUNC_NV_V2(Simd::Avx2::Nv21ToBgraV2, yuvType), FUNC_NV_V2(SimdNv21ToBgraV2, yuvType), true);
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && NvToBgraAutoTest(FUNC_NV_V2(Simd::Avx512bw::Nv21ToBgraV2, yuvType), FUNC_NV_V2(SimdNv21ToBgraV2, yuvType), true);
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+            if (Simd::Neon::Enable)
+                result = result && NvToBgraAutoTest(FUNC_NV_V2(Simd::Neon::Nv21ToBgraV2, yuvType), FUNC_NV_V2(SimdNv21ToBgraV2, yuvType), true);
+#endif
+        }
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     bool YuvToBgraDataTest(bool create, int width, int height, const FuncYuv & f, int dx, int dy)